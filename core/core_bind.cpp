@@ -123,6 +123,23 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 	return ::ResourceLoader::get_resource_uid(p_path);
 }
 
+void ResourceLoader::set_retained_cache_budget(int64_t p_bytes) {
+	ERR_FAIL_COND(p_bytes < 0);
+	ResourceCache::set_retained_budget(p_bytes);
+}
+
+int64_t ResourceLoader::get_retained_cache_budget() const {
+	return ResourceCache::get_retained_budget();
+}
+
+int64_t ResourceLoader::get_retained_cache_usage() const {
+	return ResourceCache::get_retained_usage();
+}
+
+void ResourceLoader::clear_retained_cache() {
+	ResourceCache::clear_retained();
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -137,6 +154,10 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
+	ClassDB::bind_method(D_METHOD("set_retained_cache_budget", "bytes"), &ResourceLoader::set_retained_cache_budget);
+	ClassDB::bind_method(D_METHOD("get_retained_cache_budget"), &ResourceLoader::get_retained_cache_budget);
+	ClassDB::bind_method(D_METHOD("get_retained_cache_usage"), &ResourceLoader::get_retained_cache_usage);
+	ClassDB::bind_method(D_METHOD("clear_retained_cache"), &ResourceLoader::clear_retained_cache);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
@@ -444,6 +465,10 @@ String OS::get_model_name() const {
 	return ::OS::get_singleton()->get_model_name();
 }
 
+float OS::get_thermal_headroom(int p_forecast_seconds) const {
+	return ::OS::get_singleton()->get_thermal_headroom(p_forecast_seconds);
+}
+
 Error OS::set_thread_name(const String &p_name) {
 	return ::Thread::set_name(p_name);
 }
@@ -644,6 +669,7 @@ void OS::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_locale"), &OS::get_locale);
 	ClassDB::bind_method(D_METHOD("get_locale_language"), &OS::get_locale_language);
 	ClassDB::bind_method(D_METHOD("get_model_name"), &OS::get_model_name);
+	ClassDB::bind_method(D_METHOD("get_thermal_headroom", "forecast_seconds"), &OS::get_thermal_headroom, DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("is_userfs_persistent"), &OS::is_userfs_persistent);
 	ClassDB::bind_method(D_METHOD("is_stdout_verbose"), &OS::is_stdout_verbose);
@@ -877,6 +903,59 @@ TypedArray<PackedVector2Array> Geometry2D::offset_polyline(const Vector<Vector2>
 	return ret;
 }
 
+static Vector<Vector<Point2>> _polygon_array_to_vector(const TypedArray<PackedVector2Array> &p_polygons) {
+	Vector<Vector<Point2>> polygons;
+	polygons.resize(p_polygons.size());
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		polygons.write[i] = p_polygons[i];
+	}
+	return polygons;
+}
+
+TypedArray<PackedVector2Array> Geometry2D::merge_many_polygons(const TypedArray<PackedVector2Array> &p_polygons) {
+	Vector<Vector<Point2>> polys = ::Geometry2D::merge_many_polygons(_polygon_array_to_vector(p_polygons));
+
+	TypedArray<PackedVector2Array> ret;
+
+	for (int i = 0; i < polys.size(); ++i) {
+		ret.push_back(polys[i]);
+	}
+	return ret;
+}
+
+TypedArray<PackedVector2Array> Geometry2D::clip_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, const TypedArray<PackedVector2Array> &p_clip_polygons) {
+	Vector<Vector<Point2>> polys = ::Geometry2D::clip_many_polygons(_polygon_array_to_vector(p_polygons), _polygon_array_to_vector(p_clip_polygons));
+
+	TypedArray<PackedVector2Array> ret;
+
+	for (int i = 0; i < polys.size(); ++i) {
+		ret.push_back(polys[i]);
+	}
+	return ret;
+}
+
+TypedArray<PackedVector2Array> Geometry2D::intersect_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, const TypedArray<PackedVector2Array> &p_clip_polygons) {
+	Vector<Vector<Point2>> polys = ::Geometry2D::intersect_many_polygons(_polygon_array_to_vector(p_polygons), _polygon_array_to_vector(p_clip_polygons));
+
+	TypedArray<PackedVector2Array> ret;
+
+	for (int i = 0; i < polys.size(); ++i) {
+		ret.push_back(polys[i]);
+	}
+	return ret;
+}
+
+TypedArray<PackedVector2Array> Geometry2D::offset_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, real_t p_delta, PolyJoinType p_join_type) {
+	Vector<Vector<Point2>> polys = ::Geometry2D::offset_many_polygons(_polygon_array_to_vector(p_polygons), p_delta, ::Geometry2D::PolyJoinType(p_join_type));
+
+	TypedArray<PackedVector2Array> ret;
+
+	for (int i = 0; i < polys.size(); ++i) {
+		ret.push_back(polys[i]);
+	}
+	return ret;
+}
+
 Dictionary Geometry2D::make_atlas(const Vector<Size2> &p_rects) {
 	Dictionary ret;
 
@@ -927,11 +1006,16 @@ void Geometry2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_polygons", "polygon_a", "polygon_b"), &Geometry2D::intersect_polygons);
 	ClassDB::bind_method(D_METHOD("exclude_polygons", "polygon_a", "polygon_b"), &Geometry2D::exclude_polygons);
 
+	ClassDB::bind_method(D_METHOD("merge_many_polygons", "polygons"), &Geometry2D::merge_many_polygons);
+	ClassDB::bind_method(D_METHOD("clip_many_polygons", "polygons", "clip_polygons"), &Geometry2D::clip_many_polygons);
+	ClassDB::bind_method(D_METHOD("intersect_many_polygons", "polygons", "clip_polygons"), &Geometry2D::intersect_many_polygons);
+
 	ClassDB::bind_method(D_METHOD("clip_polyline_with_polygon", "polyline", "polygon"), &Geometry2D::clip_polyline_with_polygon);
 	ClassDB::bind_method(D_METHOD("intersect_polyline_with_polygon", "polyline", "polygon"), &Geometry2D::intersect_polyline_with_polygon);
 
 	ClassDB::bind_method(D_METHOD("offset_polygon", "polygon", "delta", "join_type"), &Geometry2D::offset_polygon, DEFVAL(JOIN_SQUARE));
 	ClassDB::bind_method(D_METHOD("offset_polyline", "polyline", "delta", "join_type", "end_type"), &Geometry2D::offset_polyline, DEFVAL(JOIN_SQUARE), DEFVAL(END_SQUARE));
+	ClassDB::bind_method(D_METHOD("offset_many_polygons", "polygons", "delta", "join_type"), &Geometry2D::offset_many_polygons, DEFVAL(JOIN_SQUARE));
 
 	ClassDB::bind_method(D_METHOD("make_atlas", "sizes"), &Geometry2D::make_atlas);
 
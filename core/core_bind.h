@@ -86,6 +86,11 @@ public:
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
 
+	void set_retained_cache_budget(int64_t p_bytes);
+	int64_t get_retained_cache_budget() const;
+	int64_t get_retained_cache_usage() const;
+	void clear_retained_cache();
+
 	ResourceLoader() { singleton = this; }
 };
 
@@ -191,6 +196,7 @@ public:
 	String get_locale_language() const;
 
 	String get_model_name() const;
+	float get_thermal_headroom(int p_forecast_seconds = 0) const;
 
 	bool is_debug_build() const;
 
@@ -293,6 +299,11 @@ public:
 	TypedArray<PackedVector2Array> intersect_polygons(const Vector<Vector2> &p_polygon_a, const Vector<Vector2> &p_polygon_b); // Common area (multiply).
 	TypedArray<PackedVector2Array> exclude_polygons(const Vector<Vector2> &p_polygon_a, const Vector<Vector2> &p_polygon_b); // All but common area (xor).
 
+	// Batched 2D polygon boolean operations.
+	TypedArray<PackedVector2Array> merge_many_polygons(const TypedArray<PackedVector2Array> &p_polygons);
+	TypedArray<PackedVector2Array> clip_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, const TypedArray<PackedVector2Array> &p_clip_polygons);
+	TypedArray<PackedVector2Array> intersect_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, const TypedArray<PackedVector2Array> &p_clip_polygons);
+
 	// 2D polyline vs polygon operations.
 	TypedArray<PackedVector2Array> clip_polyline_with_polygon(const Vector<Vector2> &p_polyline, const Vector<Vector2> &p_polygon); // Cut.
 	TypedArray<PackedVector2Array> intersect_polyline_with_polygon(const Vector<Vector2> &p_polyline, const Vector<Vector2> &p_polygon); // Chop.
@@ -312,6 +323,7 @@ public:
 	};
 	TypedArray<PackedVector2Array> offset_polygon(const Vector<Vector2> &p_polygon, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE);
 	TypedArray<PackedVector2Array> offset_polyline(const Vector<Vector2> &p_polygon, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE, PolyEndType p_end_type = END_SQUARE);
+	TypedArray<PackedVector2Array> offset_many_polygons(const TypedArray<PackedVector2Array> &p_polygons, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE);
 
 	Dictionary make_atlas(const Vector<Size2> &p_rects);
 
@@ -35,6 +35,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
 #include "core/debugger/script_debugger.h"
+#include "core/debugger/timeline_profiler.h"
 #include "core/input/input.h"
 #include "core/io/resource_loader.h"
 #include "core/object/script_language.h"
@@ -93,6 +94,31 @@ public:
 	}
 };
 
+// Captures per-thread zones while enabled, and saves them as a Chrome trace (also read by Perfetto) when disabled.
+// The first option is the path to save to.
+class RemoteDebugger::TimelineCaptureProfiler : public EngineProfiler {
+	String path;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (p_enable) {
+			path = p_opts.size() ? String(p_opts[0]) : String("user://timeline.json");
+			TimelineProfiler::start_capture();
+		} else if (TimelineProfiler::is_capturing()) {
+			TimelineProfiler::stop_capture();
+			if (TimelineProfiler::save_chrome_trace(path) == OK) {
+				Array arr;
+				arr.push_back(ProjectSettings::get_singleton()->globalize_path(path));
+				EngineDebugger::get_singleton()->send_message("timeline:saved", arr);
+			}
+		}
+	}
+	void add(const Array &p_data) {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		TimelineProfiler::drain();
+	}
+};
+
 Error RemoteDebugger::_put_msg(const String &p_message, const Array &p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -670,6 +696,10 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+	// Timeline Profiler
+	timeline_profiler.instantiate();
+	timeline_profiler->bind("timeline");
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
@@ -51,8 +51,10 @@ private:
 	typedef DebuggerMarshalls::OutputError ErrorMessage;
 
 	class PerformanceProfiler;
+	class TimelineCaptureProfiler;
 
 	Ref<PerformanceProfiler> performance_profiler;
+	Ref<TimelineCaptureProfiler> timeline_profiler;
 
 	Ref<RemoteDebuggerPeer> peer;
 
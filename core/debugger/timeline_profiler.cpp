@@ -0,0 +1,311 @@
+/**************************************************************************/
+/*  timeline_profiler.cpp                                                 */
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "timeline_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+
+#include <atomic>
+
+struct TimelineProfiler::ThreadBuffer {
+	// Must be a power of two. Drained every frame, so it only needs to hold a frame worth of zones.
+	static const uint32_t SIZE = 16384;
+
+	struct Event {
+		const char *name = nullptr;
+		uint64_t begin = 0;
+		uint64_t end = 0;
+	};
+
+	static const uint32_t MAX_OPEN_ZONES = 64;
+
+	Event events[SIZE];
+	std::atomic<uint64_t> write_index = { 0 }; // Only advanced by the owner thread.
+
+	// Read by samplers without synchronization, entries only ever hold string literals.
+	std::atomic<const char *> open_zones[MAX_OPEN_ZONES] = {};
+	std::atomic<uint32_t> open_zone_count = { 0 }; // Only changed by the owner thread, may exceed MAX_OPEN_ZONES.
+	uint64_t read_index = 0; // Only used while holding the buffers mutex.
+
+	Thread::ID thread_id = 0;
+	String name;
+	SafeFlag retired; // The owner thread is gone, the buffer can be reused once drained.
+};
+
+struct TimelineProfiler::ThreadBufferHolder {
+	ThreadBuffer *buffer = nullptr;
+	const char *name = nullptr;
+
+	~ThreadBufferHolder() {
+		if (buffer) {
+			buffer->retired.set();
+		}
+	}
+};
+
+struct TimelineEvent {
+	const char *name = nullptr;
+	uint64_t begin = 0;
+	uint64_t end = 0;
+	Thread::ID thread_id = 0;
+};
+
+// Keeps a capture bounded to a few tens of megabytes.
+static const uint32_t MAX_CAPTURED_EVENTS = 1 << 20;
+
+SafeFlag TimelineProfiler::capturing;
+SafeNumeric<uint32_t> TimelineProfiler::open_zone_trackers;
+thread_local TimelineProfiler::ThreadBufferHolder TimelineProfiler::thread_buffer;
+
+BinaryMutex TimelineProfiler::buffers_mutex;
+LocalVector<TimelineProfiler::ThreadBuffer *> TimelineProfiler::buffers;
+
+static LocalVector<TimelineEvent> captured_events;
+static HashMap<Thread::ID, String> captured_thread_names;
+static uint64_t capture_begin = 0;
+static uint64_t events_dropped = 0;
+
+TimelineProfiler::ThreadBuffer *TimelineProfiler::_acquire_thread_buffer() {
+	MutexLock lock(buffers_mutex);
+
+	ThreadBuffer *buffer = nullptr;
+	for (ThreadBuffer *E : buffers) {
+		if (E->retired.is_set() && E->read_index == E->write_index.load(std::memory_order_acquire)) {
+			buffer = E;
+			buffer->retired.clear();
+			break;
+		}
+	}
+	if (!buffer) {
+		buffer = memnew(ThreadBuffer);
+		buffers.push_back(buffer);
+	}
+	buffer->open_zone_count.store(0, std::memory_order_relaxed);
+
+	buffer->thread_id = Thread::get_caller_id();
+	if (thread_buffer.name) {
+		buffer->name = thread_buffer.name;
+	} else if (Thread::is_main_thread()) {
+		buffer->name = "Main";
+	} else {
+		buffer->name = "Thread " + itos(buffer->thread_id);
+	}
+
+	thread_buffer.buffer = buffer;
+	return buffer;
+}
+
+uint64_t TimelineProfiler::_open(const char *p_name) {
+	ThreadBuffer *buffer = thread_buffer.buffer;
+	if (unlikely(!buffer)) {
+		buffer = _acquire_thread_buffer();
+	}
+
+	uint32_t depth = buffer->open_zone_count.load(std::memory_order_relaxed);
+	if (depth < ThreadBuffer::MAX_OPEN_ZONES) {
+		buffer->open_zones[depth].store(p_name, std::memory_order_relaxed);
+	}
+	buffer->open_zone_count.store(depth + 1, std::memory_order_release);
+
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void TimelineProfiler::_close(const char *p_name, uint64_t p_begin) {
+	ThreadBuffer *buffer = thread_buffer.buffer;
+	if (unlikely(!buffer)) {
+		return; // Finalized while the zone was open.
+	}
+	buffer->open_zone_count.store(buffer->open_zone_count.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+
+	if (!capturing.is_set()) {
+		return;
+	}
+
+	uint64_t index = buffer->write_index.load(std::memory_order_relaxed);
+	ThreadBuffer::Event &event = buffer->events[index & (ThreadBuffer::SIZE - 1)];
+	event.name = p_name;
+	event.begin = p_begin;
+	event.end = OS::get_singleton()->get_ticks_usec();
+	buffer->write_index.store(index + 1, std::memory_order_release);
+}
+
+void TimelineProfiler::set_thread_name(const char *p_name) {
+	thread_buffer.name = p_name;
+	if (thread_buffer.buffer) {
+		MutexLock lock(buffers_mutex);
+		thread_buffer.buffer->name = p_name;
+	}
+}
+
+void TimelineProfiler::start_capture() {
+	MutexLock lock(buffers_mutex);
+
+	// Discard anything recorded before the capture.
+	for (ThreadBuffer *buffer : buffers) {
+		buffer->read_index = buffer->write_index.load(std::memory_order_acquire);
+	}
+	captured_events.clear();
+	captured_thread_names.clear();
+	events_dropped = 0;
+	capture_begin = OS::get_singleton()->get_ticks_usec();
+
+	capturing.set();
+}
+
+void TimelineProfiler::stop_capture() {
+	capturing.clear();
+	drain();
+}
+
+void TimelineProfiler::drain() {
+	MutexLock lock(buffers_mutex);
+
+	for (ThreadBuffer *buffer : buffers) {
+		uint64_t write_index = buffer->write_index.load(std::memory_order_acquire);
+		if (buffer->read_index == write_index) {
+			continue;
+		}
+
+		uint64_t from = buffer->read_index;
+		if (write_index - from > ThreadBuffer::SIZE) {
+			// The owner thread lapped the reader, the oldest events are gone.
+			events_dropped += write_index - from - ThreadBuffer::SIZE;
+			from = write_index - ThreadBuffer::SIZE;
+		}
+
+		uint32_t first_captured = captured_events.size();
+		for (uint64_t i = from; i < write_index; i++) {
+			const ThreadBuffer::Event &event = buffer->events[i & (ThreadBuffer::SIZE - 1)];
+			TimelineEvent captured;
+			captured.name = event.name;
+			captured.begin = event.begin;
+			captured.end = event.end;
+			captured.thread_id = buffer->thread_id;
+			captured_events.push_back(captured);
+		}
+
+		// Events may have been overwritten while being copied, those are discarded.
+		uint64_t written_after = buffer->write_index.load(std::memory_order_acquire);
+		if (written_after - from > ThreadBuffer::SIZE) {
+			uint64_t overwritten = MIN(written_after - from - ThreadBuffer::SIZE, write_index - from);
+			for (uint32_t i = first_captured + overwritten; i < captured_events.size(); i++) {
+				captured_events[i - overwritten] = captured_events[i];
+			}
+			captured_events.resize(captured_events.size() - overwritten);
+			events_dropped += overwritten;
+		}
+
+		buffer->read_index = write_index;
+		captured_thread_names[buffer->thread_id] = buffer->name;
+	}
+
+	if (captured_events.size() > MAX_CAPTURED_EVENTS) {
+		events_dropped += captured_events.size() - MAX_CAPTURED_EVENTS;
+		captured_events.resize(MAX_CAPTURED_EVENTS);
+	}
+}
+
+void TimelineProfiler::track_open_zones(bool p_enable) {
+	if (p_enable) {
+		open_zone_trackers.increment();
+	} else {
+		open_zone_trackers.decrement();
+	}
+}
+
+int TimelineProfiler::get_open_zones(Thread::ID p_thread_id, const char **r_names, int p_max) {
+	MutexLock lock(buffers_mutex);
+
+	for (ThreadBuffer *buffer : buffers) {
+		if (buffer->thread_id != p_thread_id || buffer->retired.is_set()) {
+			continue;
+		}
+
+		uint32_t count = MIN(buffer->open_zone_count.load(std::memory_order_acquire), ThreadBuffer::MAX_OPEN_ZONES);
+		int written = 0;
+		for (uint32_t i = 0; i < count && written < p_max; i++) {
+			const char *name = buffer->open_zones[i].load(std::memory_order_relaxed);
+			if (name) {
+				r_names[written++] = name;
+			}
+		}
+		return written;
+	}
+
+	return 0;
+}
+
+Error TimelineProfiler::save_chrome_trace(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Can't save timeline capture to file: '%s'.", p_path));
+
+	MutexLock lock(buffers_mutex);
+
+	if (events_dropped) {
+		WARN_PRINT(vformat("Timeline capture dropped %d events, drain it more often or record fewer zones.", events_dropped));
+	}
+
+	// Chrome trace event format, which Perfetto also reads. Timestamps are in microseconds.
+	f->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+	for (const KeyValue<Thread::ID, String> &E : captured_thread_names) {
+		f->store_string(vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", E.key, E.value.json_escape()));
+		first = false;
+	}
+	for (const TimelineEvent &event : captured_events) {
+		if (event.begin < capture_begin) {
+			continue; // Began before the capture.
+		}
+		f->store_string(vformat("%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d}", first ? "" : ",\n", String(event.name).json_escape(), event.thread_id, event.begin - capture_begin, event.end - event.begin));
+		first = false;
+	}
+	f->store_string("\n]}\n");
+
+	return OK;
+}
+
+void TimelineProfiler::finalize() {
+	capturing.clear();
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete(buffer);
+	}
+	buffers.clear();
+	captured_events.reset();
+	captured_thread_names.clear();
+
+	// Other threads are expected to be gone by now.
+	thread_buffer.buffer = nullptr;
+}
@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  timeline_profiler.h                                                   */
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TIMELINE_PROFILER_H
+#define TIMELINE_PROFILER_H
+
+#include "core/error/error_list.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/typedefs.h"
+
+class String;
+
+// Records when scoped zones begin and end on every thread, so stalls across threads can be inspected on a timeline.
+// Each thread records into its own ring buffer without locking; the buffers are drained once per frame.
+class TimelineProfiler {
+	struct ThreadBuffer;
+	struct ThreadBufferHolder;
+
+	static SafeFlag capturing;
+	static SafeNumeric<uint32_t> open_zone_trackers;
+	static thread_local ThreadBufferHolder thread_buffer;
+	static BinaryMutex buffers_mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+
+	static ThreadBuffer *_acquire_thread_buffer();
+	static uint64_t _open(const char *p_name);
+	static void _close(const char *p_name, uint64_t p_begin);
+
+public:
+	// Names must be string literals, or otherwise outlive the capture.
+	class Zone {
+		const char *name = nullptr;
+		uint64_t begin = 0;
+
+	public:
+		_FORCE_INLINE_ Zone(const char *p_name) {
+			if (unlikely(capturing.is_set() || open_zone_trackers.get())) {
+				name = p_name;
+				begin = _open(p_name);
+			}
+		}
+		_FORCE_INLINE_ ~Zone() {
+			if (unlikely(name)) {
+				_close(name, begin);
+			}
+		}
+	};
+
+	_FORCE_INLINE_ static bool is_capturing() { return capturing.is_set(); }
+
+	static void set_thread_name(const char *p_name);
+
+	static void start_capture();
+	static void stop_capture();
+	static void drain();
+	static Error save_chrome_trace(const String &p_path);
+
+	// Lets samplers see which zones are open on a thread, outermost first. Works without capturing.
+	static void track_open_zones(bool p_enable);
+	static int get_open_zones(Thread::ID p_thread_id, const char **r_names, int p_max);
+
+	static void finalize();
+};
+
+#ifdef DEBUG_ENABLED
+#define TIMELINE_ZONE(m_name) TimelineProfiler::Zone _timeline_zone(m_name)
+#else
+#define TIMELINE_ZONE(m_name)
+#endif
+
+#endif // TIMELINE_PROFILER_H
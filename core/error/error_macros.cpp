@@ -126,5 +126,8 @@ void _err_print_index_error(const char *p_function, const char *p_file, int p_li
 }
 
 void _err_flush_stdout() {
+	if (OS::get_singleton()) {
+		OS::get_singleton()->flush_log_sync();
+	}
 	fflush(stdout);
 }
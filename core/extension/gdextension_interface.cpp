@@ -1222,6 +1222,14 @@ static void gdextension_object_method_bind_ptrcall(GDExtensionMethodBindPtr p_me
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdextension_object_method_bind_ptrcall_batch(const GDExtensionPtrcallBatchEntry *p_calls, GDExtensionInt p_call_count) {
+	for (GDExtensionInt i = 0; i < p_call_count; i++) {
+		const GDExtensionPtrcallBatchEntry &call = p_calls[i];
+		const MethodBind *mb = reinterpret_cast<const MethodBind *>(call.method_bind);
+		mb->ptrcall((Object *)call.instance, (const void **)call.args, call.r_return);
+	}
+}
+
 static void gdextension_object_destroy(GDExtensionObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1674,6 +1682,7 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(dictionary_operator_index_const);
 	REGISTER_INTERFACE_FUNC(object_method_bind_call);
 	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall);
+	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall_batch);
 	REGISTER_INTERFACE_FUNC(object_destroy);
 	REGISTER_INTERFACE_FUNC(global_get_singleton);
 	REGISTER_INTERFACE_FUNC(object_get_instance_binding);
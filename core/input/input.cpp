@@ -132,6 +132,8 @@ void Input::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_gyroscope", "value"), &Input::set_gyroscope);
 	ClassDB::bind_method(D_METHOD("get_last_mouse_velocity"), &Input::get_last_mouse_velocity);
 	ClassDB::bind_method(D_METHOD("get_last_mouse_screen_velocity"), &Input::get_last_mouse_screen_velocity);
+	ClassDB::bind_method(D_METHOD("get_mouse_motion_samples"), &Input::get_mouse_motion_samples);
+	ClassDB::bind_method(D_METHOD("get_mouse_motion_sample_times"), &Input::get_mouse_motion_sample_times);
 	ClassDB::bind_method(D_METHOD("get_mouse_button_mask"), &Input::get_mouse_button_mask);
 	ClassDB::bind_method(D_METHOD("set_mouse_mode", "mode"), &Input::set_mouse_mode);
 	ClassDB::bind_method(D_METHOD("get_mouse_mode"), &Input::get_mouse_mode);
@@ -851,6 +853,46 @@ Point2 Input::get_last_mouse_screen_velocity() {
 	return mouse_velocity_track.screen_velocity;
 }
 
+void Input::push_mouse_motion_sample(const Vector2 &p_relative, uint64_t p_timestamp_usec) {
+	// Only the display server pushes samples, so there's a single producer.
+	uint32_t write = mouse_motion_sample_write.get();
+	if (write - mouse_motion_sample_read.get() >= MOUSE_MOTION_SAMPLE_BUFFER_SIZE) {
+		return; // Full, the frame is taking too long to consume them; drop the sample.
+	}
+	MouseMotionSample &sample = mouse_motion_sample_buffer[write % MOUSE_MOTION_SAMPLE_BUFFER_SIZE];
+	sample.relative = p_relative;
+	sample.timestamp_usec = p_timestamp_usec;
+	mouse_motion_sample_write.set(write + 1);
+}
+
+void Input::flush_mouse_motion_samples() {
+	uint32_t read = mouse_motion_sample_read.get();
+	uint32_t count = mouse_motion_sample_write.get() - read;
+
+	mouse_motion_samples.resize(count);
+	mouse_motion_sample_times.resize(count);
+	if (count == 0) {
+		return;
+	}
+
+	Vector2 *samples_ptr = mouse_motion_samples.ptrw();
+	int64_t *times_ptr = mouse_motion_sample_times.ptrw();
+	for (uint32_t i = 0; i < count; i++) {
+		const MouseMotionSample &sample = mouse_motion_sample_buffer[(read + i) % MOUSE_MOTION_SAMPLE_BUFFER_SIZE];
+		samples_ptr[i] = sample.relative;
+		times_ptr[i] = sample.timestamp_usec;
+	}
+	mouse_motion_sample_read.set(read + count);
+}
+
+PackedVector2Array Input::get_mouse_motion_samples() const {
+	return mouse_motion_samples;
+}
+
+PackedInt64Array Input::get_mouse_motion_sample_times() const {
+	return mouse_motion_sample_times;
+}
+
 BitField<MouseButtonMask> Input::get_mouse_button_mask() const {
 	return mouse_button_mask; // do not trust OS implementation, should remove it - OS::get_singleton()->get_mouse_button_state();
 }
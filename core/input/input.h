@@ -36,6 +36,7 @@
 #include "core/os/keyboard.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/rb_set.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/typed_array.h"
 
 class Input : public Object {
@@ -133,6 +134,20 @@ private:
 
 	int mouse_from_touch_index = -1;
 
+	// Raw relative mouse motion, pushed by the display server (possibly from its event thread) into a
+	// single-producer single-consumer ring and handed out once per frame as packed arrays, so high polling
+	// rate mice don't need an input event allocated per sample to keep sub-frame precision.
+	static const uint32_t MOUSE_MOTION_SAMPLE_BUFFER_SIZE = 4096;
+	struct MouseMotionSample {
+		Vector2 relative;
+		uint64_t timestamp_usec = 0;
+	};
+	MouseMotionSample mouse_motion_sample_buffer[MOUSE_MOTION_SAMPLE_BUFFER_SIZE];
+	SafeNumeric<uint32_t> mouse_motion_sample_write;
+	SafeNumeric<uint32_t> mouse_motion_sample_read;
+	PackedVector2Array mouse_motion_samples;
+	PackedInt64Array mouse_motion_sample_times;
+
 	struct VibrationInfo {
 		float weak_magnitude;
 		float strong_magnitude;
@@ -313,6 +328,11 @@ public:
 	Point2 get_mouse_position() const;
 	Vector2 get_last_mouse_velocity();
 	Vector2 get_last_mouse_screen_velocity();
+
+	void push_mouse_motion_sample(const Vector2 &p_relative, uint64_t p_timestamp_usec);
+	void flush_mouse_motion_samples();
+	PackedVector2Array get_mouse_motion_samples() const;
+	PackedInt64Array get_mouse_motion_sample_times() const;
 	BitField<MouseButtonMask> get_mouse_button_mask() const;
 
 	void warp_mouse(const Vector2 &p_position);
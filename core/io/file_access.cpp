@@ -39,6 +39,7 @@
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = {};
+FileAccess::CreateFunc FileAccess::create_mapped_func = nullptr;
 
 FileAccess::FileCloseFailNotify FileAccess::close_fail_notify = nullptr;
 
@@ -103,6 +104,13 @@ Ref<FileAccess> FileAccess::open(const String &p_path, int p_mode_flags, Error *
 		}
 	}
 
+#ifndef TOOLS_ENABLED
+	// Exported projects never write to their resources, map them instead of buffering reads.
+	if (p_mode_flags == READ && create_mapped_func && p_path.begins_with("res://")) {
+		return open_mapped(p_path, r_error);
+	}
+#endif
+
 	ret = create_for_path(p_path);
 	Error err = ret->open_internal(p_path, p_mode_flags);
 
@@ -116,6 +124,50 @@ Ref<FileAccess> FileAccess::open(const String &p_path, int p_mode_flags, Error *
 	return ret;
 }
 
+Ref<FileAccess> FileAccess::open_mapped(const String &p_path, Error *r_error) {
+	Ref<FileAccess> ret;
+	if (PackedData::get_singleton() && !PackedData::get_singleton()->is_disabled()) {
+		ret = PackedData::get_singleton()->try_open_path(p_path);
+		if (ret.is_valid()) {
+			if (r_error) {
+				*r_error = OK;
+			}
+			return ret;
+		}
+	}
+
+	if (create_mapped_func) {
+		ret = create_mapped_func();
+		if (p_path.begins_with("res://")) {
+			ret->_set_access_type(ACCESS_RESOURCES);
+		} else if (p_path.begins_with("user://")) {
+			ret->_set_access_type(ACCESS_USERDATA);
+		} else {
+			ret->_set_access_type(ACCESS_FILESYSTEM);
+		}
+
+		if (!p_path.begins_with("pipe://") && ret->open_internal(p_path, READ) == OK) {
+			if (r_error) {
+				*r_error = OK;
+			}
+			return ret;
+		}
+	}
+
+	// Not mappable (empty file, special file, unsupported platform), use a regular buffered file.
+	ret = create_for_path(p_path);
+	Error err = ret->open_internal(p_path, READ);
+
+	if (r_error) {
+		*r_error = err;
+	}
+	if (err != OK) {
+		ret.unref();
+	}
+
+	return ret;
+}
+
 Ref<FileAccess> FileAccess::_open(const String &p_path, ModeFlags p_mode_flags) {
 	Error err = OK;
 	Ref<FileAccess> fa = open(p_path, p_mode_flags, &err);
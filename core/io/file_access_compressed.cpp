@@ -30,6 +30,7 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
@@ -89,6 +90,39 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	return ret == -1 ? ERR_FILE_CORRUPT : OK;
 }
 
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_data, uint64_t p_length, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(p_length > UINT32_MAX, Vector<uint8_t>(), "Compressed files are limited to 4 GiB.");
+
+	CharString mgc = p_magic.utf8();
+	uint32_t bc = (p_length / p_block_size) + 1;
+	uint64_t header_size = mgc.length() + 12 + bc * 4;
+
+	Vector<uint8_t> out;
+	out.resize(header_size + Compression::get_max_compressed_buffer_size(p_block_size, p_mode) * bc + mgc.length());
+	uint8_t *w = out.ptrw();
+
+	memcpy(w, mgc.get_data(), mgc.length()); //write header 4
+	encode_uint32(p_mode, &w[mgc.length()]); //write compression mode 4
+	encode_uint32(p_block_size, &w[mgc.length() + 4]); //write block size 4
+	encode_uint32(p_length, &w[mgc.length() + 8]); //max amount of data written 4
+
+	// Every block is compressed on its own, so readers can seek to any of them.
+	uint64_t ofs = header_size;
+	for (uint32_t i = 0; i < bc; i++) {
+		uint32_t bl = i == (bc - 1) ? p_length % p_block_size : p_block_size;
+		int s = Compression::compress(&w[ofs], &p_data[i * p_block_size], bl, p_mode);
+		ERR_FAIL_COND_V(s < 0, Vector<uint8_t>());
+
+		encode_uint32(s, &w[mgc.length() + 12 + i * 4]);
+		ofs += s;
+	}
+
+	memcpy(&w[ofs], mgc.get_data(), mgc.length()); //magic at the end too
+	out.resize(ofs + mgc.length());
+	return out;
+}
+
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags == READ_WRITE, ERR_UNAVAILABLE);
 	_close();
@@ -132,37 +166,7 @@ void FileAccessCompressed::_close() {
 
 	if (writing) {
 		//save block table and all compressed blocks
-
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(write_max); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
-
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+		f->store_buffer(compress_buffer(write_ptr, write_max, magic, cmode, block_size));
 
 		buffer.clear();
 
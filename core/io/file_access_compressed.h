@@ -70,6 +70,8 @@ public:
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_data, uint64_t p_length, const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
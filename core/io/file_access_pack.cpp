@@ -31,6 +31,7 @@
 #include "file_access_pack.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/os/os.h"
 #include "core/script_encryption_key.gen.h"
@@ -51,7 +52,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, const uint8_t *p_sha256, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_require_verification) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, const uint8_t *p_sha256, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_require_verification, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -59,6 +60,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.require_verification = p_require_verification;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
@@ -351,7 +353,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 
 			uint32_t flags = f->get_32();
 
-			PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, sha256, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_REQUIRE_VERIFICATION));
+			PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, sha256, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_REQUIRE_VERIFICATION), (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
@@ -464,6 +466,23 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_mapped_data() const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+
+	// Encrypted files are read through FileAccessEncrypted, which is never mapped.
+	const uint8_t *data = f->get_mapped_data();
+	return data ? data + off : nullptr;
+}
+
+void FileAccessPack::prefetch(uint64_t p_position, uint64_t p_length) const {
+	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+
+	if (p_position >= pf.size) {
+		return;
+	}
+	f->prefetch(off + p_position, MIN(p_length, pf.size - p_position));
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -500,7 +519,7 @@ void FileAccessPack::close() {
 
 FileAccessPack::FileAccessPack(const String &p_path, PackedData::PackedFile *p_file) :
 		pf(*p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		f(FileAccess::open_mapped(pf.pack)) {
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(p_path) + "', pack '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -522,6 +541,21 @@ FileAccessPack::FileAccessPack(const String &p_path, PackedData::PackedFile *p_f
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		uint8_t magic[4];
+		f->get_buffer(magic, 4);
+		ERR_FAIL_COND_MSG(memcmp(magic, PACK_FILE_COMPRESSED_MAGIC, 4) != 0, "Can't open compressed pack-referenced file '" + String(p_path) + "', pack '" + String(pf.pack) + "'.");
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(f);
+		ERR_FAIL_COND_MSG(err, "Can't open compressed pack-referenced file '" + String(p_path) + "', pack '" + String(pf.pack) + "'.");
+		f = fac;
+		off = 0;
+		// From now on the file is seen through its uncompressed size.
+		pf.size = fac->get_length();
+	}
 	pos = 0;
 	eof = false;
 
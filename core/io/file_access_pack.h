@@ -56,8 +56,13 @@ enum PackFlags {
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REQUIRE_VERIFICATION = 1 << 1,
+	PACK_FILE_COMPRESSED = 1 << 2,
 };
 
+// Compressed files are stored in the FileAccessCompressed format with this magic, one independent block per seek unit.
+#define PACK_FILE_COMPRESSED_MAGIC "GCPF"
+#define PACK_FILE_COMPRESSED_BLOCK_SIZE 65536
+
 class PackSource;
 
 class PackedData {
@@ -75,6 +80,7 @@ public:
 
 		PackSource *src = nullptr;
 		bool encrypted = false;
+		bool compressed = false;
 		bool require_verification = false;
 		bool is_validated = false;
 	};
@@ -125,7 +131,7 @@ public:
 	static bool file_require_encryption(const String &p_name);
 
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, const uint8_t *p_sha256, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_require_verification = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, const uint8_t *p_sha256, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_require_verification = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -187,6 +193,8 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_data() const override;
+	virtual void prefetch(uint64_t p_position, uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
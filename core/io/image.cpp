@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -42,6 +43,15 @@
 #include <stdio.h>
 #include <cmath>
 
+// SSE2 and NEON are part of the x86_64 and arm64 baselines, so the kernels are picked at compile time.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMAGE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define IMAGE_NEON
+#include <arm_neon.h>
+#endif
+
 const char *Image::format_names[Image::FORMAT_MAX] = {
 	"Lum8", //luminance
 	"LumAlpha8", //luminance-alpha
@@ -660,6 +670,72 @@ Image::Format Image::get_format() const {
 	return format;
 }
 
+// Images with fewer destination pixels than this are processed on the calling thread, splitting them costs more than it saves.
+static const uint64_t IMAGE_PARALLEL_MIN_PIXELS = 256 * 256;
+
+struct ImageBandJob {
+	void (*func)(void *, uint32_t, uint32_t) = nullptr;
+	void *userdata = nullptr;
+	uint32_t count = 0;
+	uint32_t bands = 0;
+};
+
+static void _image_band_task(void *p_userdata, uint32_t p_band) {
+	const ImageBandJob *job = (const ImageBandJob *)p_userdata;
+	uint32_t from = uint64_t(job->count) * p_band / job->bands;
+	uint32_t to = uint64_t(job->count) * (p_band + 1) / job->bands;
+	job->func(job->userdata, from, to);
+}
+
+// Calls p_func over [0, p_count) split in one band per worker thread. Calls made from a worker thread run
+// inline, waiting on the pool from inside it could starve it.
+static void _process_image_bands(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, uint32_t p_count, uint64_t p_pixels) {
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	uint32_t bands = wtp ? MIN(uint32_t(wtp->get_thread_count()), p_count) : 0;
+	if (p_pixels < IMAGE_PARALLEL_MIN_PIXELS || bands < 2 || WorkerThreadPool::get_thread_index() != -1) {
+		p_func(p_userdata, 0, p_count);
+		return;
+	}
+
+	ImageBandJob job;
+	job.func = p_func;
+	job.userdata = p_userdata;
+	job.count = p_count;
+	job.bands = bands;
+
+	WorkerThreadPool::GroupID group_task = wtp->add_native_group_task(&_image_band_task, &job, bands, -1, true, SNAME("ImageProcessing"));
+	wtp->wait_for_group_task_completion(group_task);
+}
+
+struct ImageScaleParams {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	float *buffer = nullptr;
+	uint32_t src_width = 0;
+	uint32_t src_height = 0;
+	uint32_t dst_width = 0;
+	uint32_t dst_height = 0;
+};
+
+template <void (*scale_func)(const uint8_t *, uint8_t *, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)>
+static void _scale_rows_band(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	const ImageScaleParams *params = (const ImageScaleParams *)p_userdata;
+	scale_func(params->src, params->dst, params->src_width, params->src_height, params->dst_width, params->dst_height, p_from, p_to);
+}
+
+// Destination rows are independent, so they are split in bands across the worker threads.
+template <void (*scale_func)(const uint8_t *, uint8_t *, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)>
+static void _scale_rows_parallel(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	ImageScaleParams params;
+	params.src = p_src;
+	params.dst = p_dst;
+	params.src_width = p_src_width;
+	params.src_height = p_src_height;
+	params.dst_width = p_dst_width;
+	params.dst_height = p_dst_height;
+	_process_image_bands(&_scale_rows_band<scale_func>, &params, p_dst_height, uint64_t(p_dst_width) * p_dst_height);
+}
+
 static double _bicubic_interp_kernel(double x) {
 	x = ABS(x);
 
@@ -675,7 +751,7 @@ static double _bicubic_interp_kernel(double x) {
 }
 
 template <int CC, typename T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from, uint32_t p_to) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -690,7 +766,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_from; y < p_to; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -762,7 +838,12 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, typename T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_rows_parallel<_scale_cubic_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, typename T>
+static void _scale_bilinear_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from, uint32_t p_to) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -770,7 +851,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -852,8 +933,13 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, typename T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_rows_parallel<_scale_bilinear_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, typename T>
+static void _scale_nearest_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -872,125 +958,154 @@ static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict
 	}
 }
 
+template <int CC, typename T>
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_rows_parallel<_scale_nearest_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
 #define LANCZOS_TYPE 3
 
 static float _lanczos(float p_x) {
 	return Math::abs(p_x) >= LANCZOS_TYPE ? 0 : Math::sincn(p_x) * Math::sincn(p_x / LANCZOS_TYPE);
 }
 
+// First pass, filters the source horizontally into the buffer, one band of buffer columns at a time.
 template <int CC, typename T>
-static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	int32_t src_width = p_src_width;
-	int32_t src_height = p_src_height;
-	int32_t dst_height = p_dst_height;
-	int32_t dst_width = p_dst_width;
-
-	uint32_t buffer_size = src_height * dst_width * CC;
-	float *buffer = memnew_arr(float, buffer_size); // Store the first pass in a buffer
-
-	{ // FIRST PASS (horizontal)
-
-		float x_scale = float(src_width) / float(dst_width);
-
-		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
-		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
-
-		float *kernel = memnew_arr(float, half_kernel * 2);
+static void _scale_lanczos_horizontal(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	const ImageScaleParams *params = (const ImageScaleParams *)p_userdata;
+	const uint8_t *__restrict src = params->src;
+	float *__restrict buffer = params->buffer;
+	int32_t src_width = params->src_width;
+	int32_t src_height = params->src_height;
+	int32_t dst_width = params->dst_width;
+
+	float x_scale = float(src_width) / float(dst_width);
+
+	float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
+	int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+
+	float *kernel = memnew_arr(float, half_kernel * 2);
+
+	for (int32_t buffer_x = p_from; buffer_x < int32_t(p_to); buffer_x++) {
+		// The corresponding point on the source image
+		float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+		int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+		int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+
+		// Create the kernel used by all the pixels of the column
+		for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+			kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+		}
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+		for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
+			float pixel[CC] = { 0 };
+			float weight = 0;
 
-			// Create the kernel used by all the pixels of the column
 			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
-			}
+				float lanczos_val = kernel[target_x - start_x];
+				weight += lanczos_val;
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				const T *__restrict src_data = ((const T *)src) + (buffer_y * src_width + target_x) * CC;
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
-
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
-
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
-						}
+				for (uint32_t i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 2) { //half float
+						pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+					} else {
+						pixel[i] += src_data[i] * lanczos_val;
 					}
 				}
+			}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+			float *dst_data = buffer + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
-				}
+			for (uint32_t i = 0; i < CC; i++) {
+				dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
 			}
 		}
+	}
 
-		memdelete_arr(kernel);
-	} // End of first pass
+	memdelete_arr(kernel);
+}
 
-	{ // SECOND PASS (vertical + result)
+// Second pass, filters the buffer vertically into the destination, one band of destination rows at a time.
+template <int CC, typename T>
+static void _scale_lanczos_vertical(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	const ImageScaleParams *params = (const ImageScaleParams *)p_userdata;
+	const float *__restrict buffer = params->buffer;
+	uint8_t *__restrict dst = params->dst;
+	int32_t src_height = params->src_height;
+	int32_t dst_width = params->dst_width;
+	int32_t dst_height = params->dst_height;
 
-		float y_scale = float(src_height) / float(dst_height);
+	float y_scale = float(src_height) / float(dst_height);
 
-		float scale_factor = MAX(y_scale, 1);
-		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+	float scale_factor = MAX(y_scale, 1);
+	int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+	float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+	for (int32_t dst_y = p_from; dst_y < int32_t(p_to); dst_y++) {
+		float buffer_y = (dst_y + 0.5f) * y_scale;
+		int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+		int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+		for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+			kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+		}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+		for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+			float pixel[CC] = { 0 };
+			float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+				float lanczos_val = kernel[target_y - start_y];
+				weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+				const float *buffer_data = buffer + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
-					}
+				for (uint32_t i = 0; i < CC; i++) {
+					pixel[i] += buffer_data[i] * lanczos_val;
 				}
+			}
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+			T *dst_data = ((T *)dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
-
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
-					}
+			for (uint32_t i = 0; i < CC; i++) {
+				pixel[i] /= weight;
+
+				if constexpr (sizeof(T) == 1) { //byte
+					dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+				} else if constexpr (sizeof(T) == 2) { //half float
+					dst_data[i] = Math::make_half_float(pixel[i]);
+				} else { // float
+					dst_data[i] = pixel[i];
 				}
 			}
 		}
+	}
+
+	memdelete_arr(kernel);
+}
 
-		memdelete_arr(kernel);
-	} // End of second pass
+template <int CC, typename T>
+static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	ImageScaleParams params;
+	params.src = p_src;
+	params.dst = p_dst;
+	params.src_width = p_src_width;
+	params.src_height = p_src_height;
+	params.dst_width = p_dst_width;
+	params.dst_height = p_dst_height;
+
+	uint32_t buffer_size = p_src_height * p_dst_width * CC;
+	params.buffer = memnew_arr(float, buffer_size); // Store the first pass in a buffer
 
-	memdelete_arr(buffer);
+	// Each pass only writes its own band, the second one starts once the whole buffer is filled.
+	uint64_t pixels = uint64_t(p_dst_width) * MAX(p_src_height, p_dst_height);
+	_process_image_bands(&_scale_lanczos_horizontal<CC, T>, &params, p_dst_width, pixels);
+	_process_image_bands(&_scale_lanczos_vertical<CC, T>, &params, p_dst_height, pixels);
+
+	memdelete_arr(params.buffer);
 }
 
 static void _overlay(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, float p_alpha, uint32_t p_width, uint32_t p_height, uint32_t p_pixel_size) {
@@ -1660,23 +1775,80 @@ bool Image::_can_modify(Format p_format) const {
 	return !Image::is_format_compressed(p_format);
 }
 
+#if defined(IMAGE_SSE2) || defined(IMAGE_NEON)
+#define IMAGE_SIMD
+
+// Averages 2x2 blocks of RGBA8 pixels from two source rows, rounding like average_4_uint8().
+// Returns how many of the p_count destination pixels were written, the remainder is left to the scalar loop.
+static uint32_t _average_4_rgba8_simd(const uint8_t *__restrict p_up, const uint8_t *__restrict p_down, uint8_t *__restrict p_dst, uint32_t p_count) {
+	uint32_t i = 0;
+#if defined(IMAGE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+	for (; i + 4 <= p_count; i += 4) {
+		__m128i up0 = _mm_loadu_si128((const __m128i *)(p_up + i * 8));
+		__m128i up1 = _mm_loadu_si128((const __m128i *)(p_up + i * 8 + 16));
+		__m128i down0 = _mm_loadu_si128((const __m128i *)(p_down + i * 8));
+		__m128i down1 = _mm_loadu_si128((const __m128i *)(p_down + i * 8 + 16));
+
+		// Vertical sums, two source pixels per register.
+		__m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(up0, zero), _mm_unpacklo_epi8(down0, zero));
+		__m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(up0, zero), _mm_unpackhi_epi8(down0, zero));
+		__m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(up1, zero), _mm_unpacklo_epi8(down1, zero));
+		__m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(up1, zero), _mm_unpackhi_epi8(down1, zero));
+
+		// Horizontal sums of neighboring pixels.
+		__m128i r0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+		__m128i r1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+
+		r0 = _mm_srli_epi16(_mm_add_epi16(r0, two), 2);
+		r1 = _mm_srli_epi16(_mm_add_epi16(r1, two), 2);
+		_mm_storeu_si128((__m128i *)(p_dst + i * 4), _mm_packus_epi16(r0, r1));
+	}
+#elif defined(IMAGE_NEON)
+	for (; i + 8 <= p_count; i += 8) {
+		uint8x16x4_t up = vld4q_u8(p_up + i * 8);
+		uint8x16x4_t down = vld4q_u8(p_down + i * 8);
+		uint8x8x4_t result;
+		for (int j = 0; j < 4; j++) {
+			// Pairwise widening adds sum neighboring pixels, the rounding narrowing shift adds 2 before dividing by 4.
+			result.val[j] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(up.val[j]), vpaddlq_u8(down.val[j])), 2);
+		}
+		vst4_u8(p_dst + i * 4, result);
+	}
+#endif
+	return i;
+}
+#endif // IMAGE_SIMD
+
 template <typename Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+static void _generate_po2_mipmap_rows(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_from, uint32_t p_to) {
 	//fast power of 2 mipmap generation
 	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
 		uint32_t count = dst_w;
 
+#ifdef IMAGE_SIMD
+		if constexpr (sizeof(Component) == 1 && CC == 4 && !renormalize) {
+			if (right_step != 0) {
+				uint32_t done = _average_4_rgba8_simd((const uint8_t *)rup_ptr, (const uint8_t *)rdown_ptr, (uint8_t *)dst_ptr, count);
+				count -= done;
+				dst_ptr += done * CC;
+				rup_ptr += done * CC * 2;
+				rdown_ptr += done * CC * 2;
+			}
+		}
+#endif
+
 		while (count) {
 			count--;
 			for (int j = 0; j < CC; j++) {
@@ -1694,6 +1866,36 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+struct ImageMipmapParams {
+	const void *src = nullptr;
+	void *dst = nullptr;
+	uint32_t width = 0;
+	uint32_t height = 0;
+};
+
+template <typename Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap_band(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	const ImageMipmapParams *params = (const ImageMipmapParams *)p_userdata;
+	_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>((const Component *)params->src, (Component *)params->dst, params->width, params->height, p_from, p_to);
+}
+
+template <typename Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	ImageMipmapParams params;
+	params.src = p_src;
+	params.dst = p_dst;
+	params.width = p_width;
+	params.height = p_height;
+
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+	_process_image_bands(&_generate_po2_mipmap_band<Component, CC, renormalize, average_func, renormalize_func>, &params, dst_h, uint64_t(dst_w) * dst_h);
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.is_empty());
 
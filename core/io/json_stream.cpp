@@ -0,0 +1,741 @@
+/**************************************************************************/
+/*  json_stream.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "json_stream.h"
+
+void JSONStreamParser::_compact() {
+	// Only move the unread data once it is smaller than what was read, so it's not moved for every chunk.
+	if (pos > 0 && pos >= buffer.size() - pos) {
+		uint32_t remaining = buffer.size() - pos;
+		if (remaining > 0) {
+			memmove(buffer.ptr(), buffer.ptr() + pos, remaining);
+		}
+		buffer.resize(remaining);
+		pos = 0;
+	}
+}
+
+void JSONStreamParser::_skip_whitespace() {
+	const uint32_t size = buffer.size();
+	while (pos < size && buffer[pos] <= 32) {
+		if (buffer[pos] == '\n') {
+			current_line++;
+		}
+		pos++;
+	}
+}
+
+Error JSONStreamParser::_set_error(const String &p_error) {
+	err_str = p_error;
+	state = STATE_ERROR;
+	token_type = TOKEN_NONE;
+	value = Variant();
+	return ERR_PARSE_ERROR;
+}
+
+Error JSONStreamParser::_begin_container(bool p_object) {
+	containers.push_back(p_object);
+	pos++;
+	state = p_object ? STATE_KEY_OR_OBJECT_END : STATE_VALUE_OR_ARRAY_END;
+	token_type = p_object ? TOKEN_OBJECT_BEGIN : TOKEN_ARRAY_BEGIN;
+	return OK;
+}
+
+Error JSONStreamParser::_end_container() {
+	bool object = containers[containers.size() - 1];
+	containers.resize(containers.size() - 1);
+	pos++;
+	token_type = object ? TOKEN_OBJECT_END : TOKEN_ARRAY_END;
+	_end_value();
+	return OK;
+}
+
+void JSONStreamParser::_end_value() {
+	state = containers.is_empty() ? STATE_DONE : STATE_COMMA_OR_END;
+}
+
+static bool _parse_hex4(const uint8_t *p_str, char32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		char32_t c = p_str[i];
+		char32_t v;
+		if (is_digit(c)) {
+			v = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			v = c - 'a' + 10;
+		} else if (c >= 'A' && c <= 'F') {
+			v = c - 'A' + 10;
+		} else {
+			return false;
+		}
+		r_value = (r_value << 4) | v;
+	}
+	return true;
+}
+
+static void _append_utf8(LocalVector<char> &r_bytes, char32_t p_char) {
+	if (p_char < 0x80) {
+		r_bytes.push_back(p_char);
+	} else if (p_char < 0x800) {
+		r_bytes.push_back(0xC0 | (p_char >> 6));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	} else if (p_char < 0x10000) {
+		r_bytes.push_back(0xE0 | (p_char >> 12));
+		r_bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	} else {
+		r_bytes.push_back(0xF0 | (p_char >> 18));
+		r_bytes.push_back(0x80 | ((p_char >> 12) & 0x3F));
+		r_bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	}
+}
+
+JSONStreamParser::ScanResult JSONStreamParser::_scan_string(String &r_string) {
+	const uint32_t size = buffer.size();
+
+	// Find the closing quote first, the string is only decoded once all of it is in the buffer.
+	uint32_t end = pos + 1 + string_scan_offset;
+	while (true) {
+		if (end >= size) {
+			break;
+		}
+		if (buffer[end] == '"') {
+			break;
+		}
+		if (buffer[end] == '\\') {
+			if (end + 1 >= size) {
+				break;
+			}
+			end++;
+		}
+		end++;
+	}
+
+	if (end >= size || buffer[end] != '"') {
+		if (end_of_data) {
+			_set_error("Unterminated string.");
+			return SCAN_ERROR;
+		}
+		string_scan_offset = end - pos - 1;
+		return SCAN_NEED_DATA;
+	}
+
+	string_bytes.clear();
+	for (uint32_t i = pos + 1; i < end; i++) {
+		uint8_t c = buffer[i];
+		if (c != '\\') {
+			if (c == '\n') {
+				current_line++;
+			}
+			string_bytes.push_back(c);
+			continue;
+		}
+
+		i++;
+		switch (buffer[i]) {
+			case 'b':
+				string_bytes.push_back(8);
+				break;
+			case 't':
+				string_bytes.push_back(9);
+				break;
+			case 'n':
+				string_bytes.push_back(10);
+				break;
+			case 'f':
+				string_bytes.push_back(12);
+				break;
+			case 'r':
+				string_bytes.push_back(13);
+				break;
+			case '"':
+			case '\\':
+			case '/':
+				string_bytes.push_back(buffer[i]);
+				break;
+			case 'u': {
+				char32_t res;
+				if (i + 4 >= end || !_parse_hex4(&buffer[i + 1], res)) {
+					_set_error("Malformed hex constant in string.");
+					return SCAN_ERROR;
+				}
+				i += 4;
+
+				if ((res & 0xfffffc00) == 0xd800) {
+					char32_t trail;
+					if (i + 6 >= end || buffer[i + 1] != '\\' || buffer[i + 2] != 'u' || !_parse_hex4(&buffer[i + 3], trail) || (trail & 0xfffffc00) != 0xdc00) {
+						_set_error("Invalid UTF-16 sequence in string, unpaired lead surrogate.");
+						return SCAN_ERROR;
+					}
+					i += 6;
+					res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+				} else if ((res & 0xfffffc00) == 0xdc00) {
+					_set_error("Invalid UTF-16 sequence in string, unpaired trail surrogate.");
+					return SCAN_ERROR;
+				}
+
+				_append_utf8(string_bytes, res);
+			} break;
+			default: {
+				_set_error("Invalid escape sequence.");
+				return SCAN_ERROR;
+			}
+		}
+	}
+
+	r_string = string_bytes.is_empty() ? String() : String::utf8(string_bytes.ptr(), string_bytes.size());
+	pos = end + 1;
+	string_scan_offset = 0;
+	return SCAN_OK;
+}
+
+static bool _is_valid_number(const uint8_t *p_str, uint32_t p_len) {
+	uint32_t i = 0;
+	if (i < p_len && p_str[i] == '-') {
+		i++;
+	}
+	if (i >= p_len || !is_digit(p_str[i])) {
+		return false;
+	}
+	if (p_str[i] == '0') {
+		i++;
+	} else {
+		while (i < p_len && is_digit(p_str[i])) {
+			i++;
+		}
+	}
+	if (i < p_len && p_str[i] == '.') {
+		i++;
+		if (i >= p_len || !is_digit(p_str[i])) {
+			return false;
+		}
+		while (i < p_len && is_digit(p_str[i])) {
+			i++;
+		}
+	}
+	if (i < p_len && (p_str[i] == 'e' || p_str[i] == 'E')) {
+		i++;
+		if (i < p_len && (p_str[i] == '+' || p_str[i] == '-')) {
+			i++;
+		}
+		if (i >= p_len || !is_digit(p_str[i])) {
+			return false;
+		}
+		while (i < p_len && is_digit(p_str[i])) {
+			i++;
+		}
+	}
+	return i == p_len;
+}
+
+JSONStreamParser::ScanResult JSONStreamParser::_scan_number(double &r_number) {
+	const uint32_t size = buffer.size();
+	uint32_t end = pos;
+	while (end < size) {
+		uint8_t c = buffer[end];
+		if (!is_digit(c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+			break;
+		}
+		end++;
+	}
+
+	if (end >= size && !end_of_data) {
+		// The number may continue in the next chunk.
+		return SCAN_NEED_DATA;
+	}
+
+	if (!_is_valid_number(&buffer[pos], end - pos)) {
+		_set_error("Malformed number.");
+		return SCAN_ERROR;
+	}
+
+	string_bytes.resize(end - pos + 1);
+	memcpy(string_bytes.ptr(), &buffer[pos], end - pos);
+	string_bytes[end - pos] = 0;
+	r_number = String::to_float(string_bytes.ptr());
+	pos = end;
+	return SCAN_OK;
+}
+
+JSONStreamParser::ScanResult JSONStreamParser::_scan_identifier(Variant &r_value) {
+	const uint32_t size = buffer.size();
+	uint32_t end = pos;
+	while (end < size && is_ascii_alphabet_char(buffer[end])) {
+		end++;
+	}
+
+	if (end >= size && !end_of_data) {
+		return SCAN_NEED_DATA;
+	}
+
+	const char *id = (const char *)&buffer[pos];
+	const uint32_t len = end - pos;
+	if (len == 4 && memcmp(id, "true", 4) == 0) {
+		r_value = true;
+	} else if (len == 5 && memcmp(id, "false", 5) == 0) {
+		r_value = false;
+	} else if (len == 4 && memcmp(id, "null", 4) == 0) {
+		r_value = Variant();
+	} else {
+		_set_error("Expected 'true', 'false' or 'null', got '" + String::utf8(id, len) + "'.");
+		return SCAN_ERROR;
+	}
+	pos = end;
+	return SCAN_OK;
+}
+
+void JSONStreamParser::feed_data(const PackedByteArray &p_data) {
+	feed_buffer(p_data.ptr(), p_data.size());
+}
+
+void JSONStreamParser::feed_buffer(const uint8_t *p_data, uint32_t p_size) {
+	ERR_FAIL_COND_MSG(end_of_data, "Can't feed more data after end_data() was called.");
+	if (p_size == 0) {
+		return;
+	}
+	_compact();
+	uint32_t size = buffer.size();
+	buffer.resize(size + p_size);
+	memcpy(buffer.ptr() + size, p_data, p_size);
+}
+
+Error JSONStreamParser::feed_from_file(const Ref<FileAccess> &p_file, int p_max_bytes) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_max_bytes <= 0, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(end_of_data, ERR_UNAVAILABLE, "Can't feed more data after end_data() was called.");
+
+	_compact();
+	uint32_t size = buffer.size();
+	buffer.resize(size + p_max_bytes);
+	uint64_t received = p_file->get_buffer(buffer.ptr() + size, p_max_bytes);
+	buffer.resize(size + received);
+
+	if (received < (uint64_t)p_max_bytes || p_file->eof_reached()) {
+		end_of_data = true;
+		return ERR_FILE_EOF;
+	}
+	return OK;
+}
+
+Error JSONStreamParser::feed_from_stream(const Ref<StreamPeer> &p_stream, int p_max_bytes) {
+	ERR_FAIL_COND_V(p_stream.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_max_bytes <= 0, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(end_of_data, ERR_UNAVAILABLE, "Can't feed more data after end_data() was called.");
+
+	_compact();
+	uint32_t size = buffer.size();
+	buffer.resize(size + p_max_bytes);
+	int received = 0;
+	Error err = p_stream->get_partial_data(buffer.ptr() + size, p_max_bytes, received);
+	buffer.resize(size + MAX(received, 0));
+	return err;
+}
+
+void JSONStreamParser::end_data() {
+	end_of_data = true;
+}
+
+Error JSONStreamParser::read() {
+	if (state == STATE_ERROR) {
+		return ERR_PARSE_ERROR;
+	}
+
+	token_type = TOKEN_NONE;
+	value = Variant();
+
+	while (true) {
+		_skip_whitespace();
+
+		if (pos >= buffer.size()) {
+			if (!end_of_data) {
+				return ERR_UNAVAILABLE;
+			}
+			if (state == STATE_DONE) {
+				return ERR_FILE_EOF;
+			}
+			return _set_error("Unexpected end of data.");
+		}
+
+		const uint8_t c = buffer[pos];
+
+		switch (state) {
+			case STATE_VALUE_OR_ARRAY_END: {
+				if (c == ']') {
+					return _end_container();
+				}
+				[[fallthrough]];
+			}
+			case STATE_VALUE: {
+				if (c == '{') {
+					return _begin_container(true);
+				} else if (c == '[') {
+					return _begin_container(false);
+				}
+
+				ScanResult result;
+				if (c == '"') {
+					String str;
+					result = _scan_string(str);
+					value = str;
+				} else if (c == '-' || is_digit(c)) {
+					double number = 0;
+					result = _scan_number(number);
+					value = number;
+				} else if (is_ascii_alphabet_char(c)) {
+					result = _scan_identifier(value);
+				} else {
+					return _set_error("Unexpected character.");
+				}
+
+				if (result != SCAN_OK) {
+					value = Variant();
+					return result == SCAN_NEED_DATA ? ERR_UNAVAILABLE : ERR_PARSE_ERROR;
+				}
+				token_type = TOKEN_VALUE;
+				_end_value();
+				return OK;
+			}
+			case STATE_KEY_OR_OBJECT_END: {
+				if (c == '}') {
+					return _end_container();
+				}
+				[[fallthrough]];
+			}
+			case STATE_KEY: {
+				if (c != '"') {
+					return _set_error("Expected key.");
+				}
+
+				String key;
+				ScanResult result = _scan_string(key);
+				if (result != SCAN_OK) {
+					return result == SCAN_NEED_DATA ? ERR_UNAVAILABLE : ERR_PARSE_ERROR;
+				}
+				value = key;
+				token_type = TOKEN_KEY;
+				state = STATE_COLON;
+				return OK;
+			}
+			case STATE_COLON: {
+				if (c != ':') {
+					return _set_error("Expected ':'.");
+				}
+				pos++;
+				state = STATE_VALUE;
+			} break;
+			case STATE_COMMA_OR_END: {
+				bool object = containers[containers.size() - 1];
+				if (c == ',') {
+					pos++;
+					state = object ? STATE_KEY : STATE_VALUE;
+				} else if (c == (object ? '}' : ']')) {
+					return _end_container();
+				} else {
+					return _set_error(object ? "Expected '}' or ','." : "Expected ']' or ','.");
+				}
+			} break;
+			case STATE_DONE: {
+				return _set_error("Expected end of data.");
+			}
+			case STATE_ERROR: {
+				return ERR_PARSE_ERROR;
+			}
+		}
+	}
+}
+
+void JSONStreamParser::clear() {
+	buffer.clear();
+	pos = 0;
+	string_scan_offset = 0;
+	end_of_data = false;
+	containers.clear();
+	state = STATE_VALUE;
+	token_type = TOKEN_NONE;
+	value = Variant();
+	current_line = 1;
+	err_str = String();
+}
+
+void JSONStreamParser::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("feed_data", "data"), &JSONStreamParser::feed_data);
+	ClassDB::bind_method(D_METHOD("feed_from_file", "file", "max_bytes"), &JSONStreamParser::feed_from_file, DEFVAL(65536));
+	ClassDB::bind_method(D_METHOD("feed_from_stream", "stream", "max_bytes"), &JSONStreamParser::feed_from_stream, DEFVAL(65536));
+	ClassDB::bind_method(D_METHOD("end_data"), &JSONStreamParser::end_data);
+
+	ClassDB::bind_method(D_METHOD("read"), &JSONStreamParser::read);
+	ClassDB::bind_method(D_METHOD("get_token_type"), &JSONStreamParser::get_token_type);
+	ClassDB::bind_method(D_METHOD("get_value"), &JSONStreamParser::get_value);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONStreamParser::get_depth);
+	ClassDB::bind_method(D_METHOD("get_current_line"), &JSONStreamParser::get_current_line);
+	ClassDB::bind_method(D_METHOD("get_error_message"), &JSONStreamParser::get_error_message);
+	ClassDB::bind_method(D_METHOD("clear"), &JSONStreamParser::clear);
+
+	BIND_ENUM_CONSTANT(TOKEN_NONE);
+	BIND_ENUM_CONSTANT(TOKEN_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(TOKEN_OBJECT_END);
+	BIND_ENUM_CONSTANT(TOKEN_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(TOKEN_ARRAY_END);
+	BIND_ENUM_CONSTANT(TOKEN_KEY);
+	BIND_ENUM_CONSTANT(TOKEN_VALUE);
+}
+
+////
+
+void JSONStreamWriter::_write(const char *p_str) {
+	uint32_t len = strlen(p_str);
+	uint32_t size = buffer.size();
+	buffer.resize(size + len);
+	memcpy(buffer.ptr() + size, p_str, len);
+}
+
+void JSONStreamWriter::_write(const String &p_str) {
+	CharString utf8 = p_str.utf8();
+	uint32_t size = buffer.size();
+	buffer.resize(size + utf8.length());
+	memcpy(buffer.ptr() + size, utf8.get_data(), utf8.length());
+}
+
+void JSONStreamWriter::_write_indent(int p_depth) {
+	if (indent.is_empty()) {
+		return;
+	}
+	_write("\n");
+	for (int i = 0; i < p_depth; i++) {
+		_write(indent);
+	}
+}
+
+void JSONStreamWriter::_flush() {
+	if (buffer.size() > 0) {
+		file->store_buffer(buffer.ptr(), buffer.size());
+		buffer.clear();
+	}
+}
+
+bool JSONStreamWriter::_begin_element() {
+	ERR_FAIL_COND_V_MSG(file.is_null(), false, "The writer is not open.");
+
+	if (buffer.size() >= FLUSH_SIZE) {
+		_flush();
+	}
+
+	if (containers.is_empty()) {
+		ERR_FAIL_COND_V_MSG(root_written, false, "A JSON document can only have one root value.");
+		root_written = true;
+		return true;
+	}
+
+	Container &container = containers[containers.size() - 1];
+	if (container.object) {
+		ERR_FAIL_COND_V_MSG(!key_written, false, "A key must be written before each value of an object.");
+		key_written = false;
+		return true;
+	}
+
+	if (container.count > 0) {
+		_write(",");
+	}
+	container.count++;
+	_write_indent(containers.size());
+	return true;
+}
+
+void JSONStreamWriter::_begin_container(bool p_object) {
+	if (!_begin_element()) {
+		return;
+	}
+	_write(p_object ? "{" : "[");
+	Container container;
+	container.object = p_object;
+	containers.push_back(container);
+}
+
+void JSONStreamWriter::_end_container(bool p_object) {
+	ERR_FAIL_COND_MSG(file.is_null(), "The writer is not open.");
+	ERR_FAIL_COND_MSG(containers.is_empty() || containers[containers.size() - 1].object != p_object, p_object ? "There is no object to end." : "There is no array to end.");
+	ERR_FAIL_COND_MSG(key_written, "A value must be written after each key.");
+
+	uint32_t count = containers[containers.size() - 1].count;
+	containers.resize(containers.size() - 1);
+	if (count > 0) {
+		_write_indent(containers.size());
+	}
+	_write(p_object ? "}" : "]");
+}
+
+void JSONStreamWriter::_write_variant(const Variant &p_value, int p_depth) {
+	ERR_FAIL_COND_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, "JSON structure is too deep. Bailing.");
+
+	switch (p_value.get_type()) {
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::ARRAY: {
+			Array a = p_value;
+			_begin_container(false);
+			for (const Variant &var : a) {
+				_write_variant(var, p_depth + 1);
+			}
+			_end_container(false);
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary d = p_value;
+			List<Variant> keys;
+			d.get_key_list(&keys);
+			if (sort_keys) {
+				keys.sort();
+			}
+
+			_begin_container(true);
+			for (const Variant &E : keys) {
+				write_key(E);
+				_write_variant(d[E], p_depth + 1);
+			}
+			_end_container(true);
+		} break;
+		default: {
+			if (!_begin_element()) {
+				return;
+			}
+
+			switch (p_value.get_type()) {
+				case Variant::NIL: {
+					_write("null");
+				} break;
+				case Variant::BOOL: {
+					_write(p_value.operator bool() ? "true" : "false");
+				} break;
+				case Variant::INT: {
+					_write(itos(p_value));
+				} break;
+				case Variant::FLOAT: {
+					// Same precision as JSON.stringify().
+					double num = p_value;
+					_write(String::num(num, (full_precision ? 17 : 14) - (int)floor(log10(num))));
+				} break;
+				default: {
+					_write("\"" + String(p_value).json_escape() + "\"");
+				} break;
+			}
+		} break;
+	}
+}
+
+Error JSONStreamWriter::open(const Ref<FileAccess> &p_file, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(file.is_valid(), ERR_ALREADY_IN_USE, "The writer is already open, close it first.");
+
+	file = p_file;
+	indent = p_indent;
+	sort_keys = p_sort_keys;
+	full_precision = p_full_precision;
+	buffer.clear();
+	containers.clear();
+	key_written = false;
+	root_written = false;
+	return OK;
+}
+
+void JSONStreamWriter::begin_object() {
+	_begin_container(true);
+}
+
+void JSONStreamWriter::end_object() {
+	_end_container(true);
+}
+
+void JSONStreamWriter::begin_array() {
+	_begin_container(false);
+}
+
+void JSONStreamWriter::end_array() {
+	_end_container(false);
+}
+
+void JSONStreamWriter::write_key(const String &p_key) {
+	ERR_FAIL_COND_MSG(file.is_null(), "The writer is not open.");
+	ERR_FAIL_COND_MSG(containers.is_empty() || !containers[containers.size() - 1].object, "Keys can only be written inside an object.");
+	ERR_FAIL_COND_MSG(key_written, "A value must be written after each key.");
+
+	Container &container = containers[containers.size() - 1];
+	if (container.count > 0) {
+		_write(",");
+	}
+	container.count++;
+	_write_indent(containers.size());
+	_write("\"" + p_key.json_escape() + "\"");
+	_write(indent.is_empty() ? ":" : ": ");
+	key_written = true;
+}
+
+void JSONStreamWriter::write_value(const Variant &p_value) {
+	_write_variant(p_value, 0);
+}
+
+Error JSONStreamWriter::close() {
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_UNCONFIGURED, "The writer is not open.");
+
+	Error err = OK;
+	if (!containers.is_empty() || key_written) {
+		ERR_PRINT("Closing the writer before all objects and arrays were ended.");
+		err = ERR_INVALID_DATA;
+	}
+
+	_flush();
+	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
+		err = ERR_CANT_CREATE;
+	}
+
+	file.unref();
+	containers.clear();
+	key_written = false;
+	return err;
+}
+
+void JSONStreamWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "file", "indent", "sort_keys", "full_precision"), &JSONStreamWriter::open, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("begin_object"), &JSONStreamWriter::begin_object);
+	ClassDB::bind_method(D_METHOD("end_object"), &JSONStreamWriter::end_object);
+	ClassDB::bind_method(D_METHOD("begin_array"), &JSONStreamWriter::begin_array);
+	ClassDB::bind_method(D_METHOD("end_array"), &JSONStreamWriter::end_array);
+	ClassDB::bind_method(D_METHOD("write_key", "key"), &JSONStreamWriter::write_key);
+	ClassDB::bind_method(D_METHOD("write_value", "value"), &JSONStreamWriter::write_value);
+	ClassDB::bind_method(D_METHOD("close"), &JSONStreamWriter::close);
+}
+
+JSONStreamWriter::~JSONStreamWriter() {
+	if (file.is_valid()) {
+		_flush();
+	}
+}
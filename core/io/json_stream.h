@@ -0,0 +1,169 @@
+/**************************************************************************/
+/*  json_stream.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include "core/io/file_access.h"
+#include "core/io/stream_peer.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Incremental JSON parser. Data can be fed in chunks of any size, and each call to read()
+// returns the next token, so documents of any size can be processed without building a Variant tree.
+class JSONStreamParser : public RefCounted {
+	GDCLASS(JSONStreamParser, RefCounted);
+
+public:
+	enum TokenType {
+		TOKEN_NONE,
+		TOKEN_OBJECT_BEGIN,
+		TOKEN_OBJECT_END,
+		TOKEN_ARRAY_BEGIN,
+		TOKEN_ARRAY_END,
+		TOKEN_KEY,
+		TOKEN_VALUE,
+	};
+
+private:
+	enum State {
+		STATE_VALUE,
+		STATE_VALUE_OR_ARRAY_END,
+		STATE_KEY,
+		STATE_KEY_OR_OBJECT_END,
+		STATE_COLON,
+		STATE_COMMA_OR_END,
+		STATE_DONE,
+		STATE_ERROR,
+	};
+
+	enum ScanResult {
+		SCAN_OK,
+		SCAN_NEED_DATA,
+		SCAN_ERROR,
+	};
+
+	LocalVector<uint8_t> buffer;
+	uint32_t pos = 0;
+	// Where to resume looking for the end of a string that didn't fit in the buffer yet, relative to pos.
+	uint32_t string_scan_offset = 0;
+	bool end_of_data = false;
+
+	// True for objects, false for arrays.
+	LocalVector<bool> containers;
+	State state = STATE_VALUE;
+	TokenType token_type = TOKEN_NONE;
+	Variant value;
+	LocalVector<char> string_bytes;
+
+	int current_line = 1;
+	String err_str;
+
+	void _compact();
+	void _skip_whitespace();
+	Error _set_error(const String &p_error);
+	Error _begin_container(bool p_object);
+	Error _end_container();
+	void _end_value();
+
+	ScanResult _scan_string(String &r_string);
+	ScanResult _scan_number(double &r_number);
+	ScanResult _scan_identifier(Variant &r_value);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void feed_data(const PackedByteArray &p_data);
+	void feed_buffer(const uint8_t *p_data, uint32_t p_size);
+	Error feed_from_file(const Ref<FileAccess> &p_file, int p_max_bytes = 65536);
+	Error feed_from_stream(const Ref<StreamPeer> &p_stream, int p_max_bytes = 65536);
+	void end_data();
+
+	Error read();
+	TokenType get_token_type() const { return token_type; }
+	Variant get_value() const { return value; }
+	int get_depth() const { return containers.size(); }
+	int get_current_line() const { return current_line; }
+	String get_error_message() const { return err_str; }
+
+	void clear();
+};
+
+// Writes JSON to a file as it is produced, instead of building the whole text in memory first.
+class JSONStreamWriter : public RefCounted {
+	GDCLASS(JSONStreamWriter, RefCounted);
+
+	static const uint32_t FLUSH_SIZE = 65536;
+
+	struct Container {
+		bool object = false;
+		uint32_t count = 0;
+	};
+
+	Ref<FileAccess> file;
+	LocalVector<uint8_t> buffer;
+	LocalVector<Container> containers;
+	bool key_written = false;
+	bool root_written = false;
+
+	String indent;
+	bool sort_keys = true;
+	bool full_precision = false;
+
+	void _write(const char *p_str);
+	void _write(const String &p_str);
+	void _write_indent(int p_depth);
+	void _flush();
+	bool _begin_element();
+	void _begin_container(bool p_object);
+	void _end_container(bool p_object);
+	void _write_variant(const Variant &p_value, int p_depth);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const Ref<FileAccess> &p_file, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	void begin_object();
+	void end_object();
+	void begin_array();
+	void end_array();
+	void write_key(const String &p_key);
+	void write_value(const Variant &p_value);
+	Error close();
+
+	~JSONStreamWriter();
+};
+
+VARIANT_ENUM_CAST(JSONStreamParser::TokenType);
+
+#endif // JSON_STREAM_H
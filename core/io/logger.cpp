@@ -221,7 +221,7 @@ void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 			Memory::free_static(buf);
 		}
 
-		if (p_err || _flush_stdout_on_print) {
+		if (!flush_deferred && (p_err || _flush_stdout_on_print)) {
 			// Don't always flush when printing stdout to avoid performance
 			// issues when `print()` is spammed in release builds.
 			file->flush();
@@ -229,6 +229,12 @@ void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 	}
 }
 
+void RotatedFileLogger::flush() {
+	if (file.is_valid()) {
+		file->flush();
+	}
+}
+
 void StdLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 	if (!should_log(p_err)) {
 		return;
@@ -238,7 +244,7 @@ void StdLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 		vfprintf(stderr, p_format, p_list);
 	} else {
 		vprintf(p_format, p_list);
-		if (_flush_stdout_on_print) {
+		if (_flush_stdout_on_print && !flush_deferred) {
 			// Don't always flush when printing stdout to avoid performance
 			// issues when `print()` is spammed in release builds.
 			fflush(stdout);
@@ -246,8 +252,97 @@ void StdLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 	}
 }
 
+void StdLogger::flush() {
+	fflush(stdout);
+	fflush(stderr);
+}
+
 CompositeLogger::CompositeLogger(const Vector<Logger *> &p_loggers) :
 		loggers(p_loggers) {
+	async_head.store(&async_stub);
+	async_tail = &async_stub;
+}
+
+void CompositeLogger::_async_push(AsyncRecord *p_record) {
+	p_record->next.store(nullptr, std::memory_order_relaxed);
+	AsyncRecord *prev = async_head.exchange(p_record, std::memory_order_acq_rel);
+	prev->next.store(p_record, std::memory_order_release);
+}
+
+CompositeLogger::AsyncRecord *CompositeLogger::_async_pop() {
+	AsyncRecord *tail = async_tail;
+	AsyncRecord *next = tail->next.load(std::memory_order_acquire);
+	if (tail == &async_stub) {
+		if (!next) {
+			return nullptr;
+		}
+		async_tail = next;
+		tail = next;
+		next = next->next.load(std::memory_order_acquire);
+	}
+
+	if (next) {
+		async_tail = next;
+		return tail;
+	}
+
+	if (tail != async_head.load(std::memory_order_acquire)) {
+		// A producer is halfway through pushing, it will wake the thread again once it's done.
+		return nullptr;
+	}
+
+	// Tail is the last record, put the stub back behind it so it can be detached.
+	_async_push(&async_stub);
+	next = tail->next.load(std::memory_order_acquire);
+	if (next) {
+		async_tail = next;
+		return tail;
+	}
+	return nullptr;
+}
+
+void CompositeLogger::_async_write(AsyncRecord *p_record) {
+	for (int i = 0; i < loggers.size(); ++i) {
+		if (p_record->is_error) {
+			loggers[i]->log_error(p_record->function.get_data(), p_record->file.get_data(), p_record->line, p_record->code.get_data(), p_record->message.get_data(), p_record->editor_notify, p_record->type);
+		} else if (p_record->err) {
+			loggers[i]->logf_error("%s", p_record->message.get_data());
+		} else {
+			loggers[i]->logf("%s", p_record->message.get_data());
+		}
+	}
+}
+
+void CompositeLogger::_async_drain() {
+	bool wrote = false;
+	while (AsyncRecord *record = _async_pop()) {
+		_async_write(record);
+		memdelete(record);
+		wrote = true;
+	}
+
+	if (wrote) {
+		flush();
+	}
+}
+
+void CompositeLogger::_async_thread_func(void *p_self) {
+	CompositeLogger *self = static_cast<CompositeLogger *>(p_self);
+	Thread::set_name("Logger");
+
+	while (true) {
+		self->async_semaphore.wait();
+		self->async_wake_pending.store(false);
+
+		{
+			MutexLock lock(self->async_drain_mutex);
+			self->_async_drain();
+		}
+
+		if (self->async_exit) {
+			break;
+		}
+	}
 }
 
 void CompositeLogger::logv(const char *p_format, va_list p_list, bool p_err) {
@@ -255,6 +350,26 @@ void CompositeLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 		return;
 	}
 
+	if (async.load(std::memory_order_acquire)) {
+		AsyncRecord *record = memnew(AsyncRecord);
+		record->err = p_err;
+
+		va_list list_copy;
+		va_copy(list_copy, p_list);
+		int len = vsnprintf(nullptr, 0, p_format, list_copy);
+		va_end(list_copy);
+		if (len > 0) {
+			record->message.resize(len + 1);
+			vsnprintf(record->message.ptrw(), len + 1, p_format, p_list);
+		}
+
+		_async_push(record);
+		if (!async_wake_pending.exchange(true)) {
+			async_semaphore.post();
+		}
+		return;
+	}
+
 	for (int i = 0; i < loggers.size(); ++i) {
 		va_list list_copy;
 		va_copy(list_copy, p_list);
@@ -268,16 +383,98 @@ void CompositeLogger::log_error(const char *p_function, const char *p_file, int
 		return;
 	}
 
+	if (async.load(std::memory_order_acquire)) {
+		AsyncRecord *record = memnew(AsyncRecord);
+		record->is_error = true;
+		record->err = true;
+		record->function = p_function;
+		record->file = p_file;
+		record->line = p_line;
+		record->code = p_code;
+		record->message = p_rationale;
+		record->editor_notify = p_editor_notify;
+		record->type = p_type;
+
+		_async_push(record);
+		if (!async_wake_pending.exchange(true)) {
+			async_semaphore.post();
+		}
+		return;
+	}
+
 	for (int i = 0; i < loggers.size(); ++i) {
 		loggers[i]->log_error(p_function, p_file, p_line, p_code, p_rationale, p_editor_notify, p_type);
 	}
 }
 
 void CompositeLogger::add_logger(Logger *p_logger) {
+	// The background thread reads the logger list, so stop it while the list changes.
+	bool was_async = is_async();
+	if (was_async) {
+		set_async(false);
+	}
+
 	loggers.push_back(p_logger);
+
+	if (was_async) {
+		set_async(true);
+	}
+}
+
+void CompositeLogger::flush() {
+	for (int i = 0; i < loggers.size(); ++i) {
+		loggers[i]->flush();
+	}
+}
+
+void CompositeLogger::set_async(bool p_async) {
+#ifdef THREADS_ENABLED
+	if (p_async && is_async()) {
+		return;
+	}
+
+	async.store(false, std::memory_order_release);
+	if (async_thread.is_started()) {
+		// Also covers a thread left running by flush_sync().
+		async_exit = true;
+		async_semaphore.post();
+		async_thread.wait_to_finish();
+	}
+
+	if (p_async) {
+		for (int i = 0; i < loggers.size(); ++i) {
+			loggers[i]->set_flush_deferred(true);
+		}
+		async_exit = false;
+		async.store(true, std::memory_order_release);
+		async_thread.start(&CompositeLogger::_async_thread_func, this);
+	} else {
+		// Records pushed while the thread was stopping.
+		_async_drain();
+		for (int i = 0; i < loggers.size(); ++i) {
+			loggers[i]->set_flush_deferred(false);
+		}
+	}
+#endif // THREADS_ENABLED
+}
+
+void CompositeLogger::flush_sync() {
+	async.store(false, std::memory_order_release);
+	for (int i = 0; i < loggers.size(); ++i) {
+		loggers[i]->set_flush_deferred(false);
+	}
+
+	// Don't wait for the background thread, it may be the one that crashed.
+	if (async_drain_mutex.try_lock()) {
+		_async_drain();
+		async_drain_mutex.unlock();
+	}
+	flush();
 }
 
 CompositeLogger::~CompositeLogger() {
+	set_async(false);
+
 	for (int i = 0; i < loggers.size(); ++i) {
 		memdelete(loggers[i]);
 	}
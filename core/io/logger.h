@@ -32,6 +32,9 @@
 #define LOGGER_H
 
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/ustring.h"
 #include "core/templates/vector.h"
 #include "modules/modules_enabled.gen.h" // For regex.
@@ -40,6 +43,7 @@
 #endif // MODULE_REGEX_ENABLED
 
 #include <stdarg.h>
+#include <atomic>
 
 class Logger {
 protected:
@@ -47,6 +51,9 @@ protected:
 
 	static bool _flush_stdout_on_print;
 
+	// Set while records are written by the CompositeLogger's background thread, which flushes once per batch.
+	bool flush_deferred = false;
+
 public:
 	enum ErrorType {
 		ERR_ERROR,
@@ -63,6 +70,9 @@ public:
 	void logf(const char *p_format, ...) _PRINTF_FORMAT_ATTRIBUTE_2_3;
 	void logf_error(const char *p_format, ...) _PRINTF_FORMAT_ATTRIBUTE_2_3;
 
+	virtual void flush() {}
+	void set_flush_deferred(bool p_deferred) { flush_deferred = p_deferred; }
+
 	virtual ~Logger() {}
 };
 
@@ -72,6 +82,7 @@ public:
 class StdLogger : public Logger {
 public:
 	virtual void logv(const char *p_format, va_list p_list, bool p_err) override _PRINTF_FORMAT_ATTRIBUTE_2_0;
+	virtual void flush() override;
 	virtual ~StdLogger() {}
 };
 
@@ -98,11 +109,48 @@ public:
 	explicit RotatedFileLogger(const String &p_base_path, int p_max_files = 10);
 
 	virtual void logv(const char *p_format, va_list p_list, bool p_err) override _PRINTF_FORMAT_ATTRIBUTE_2_0;
+	virtual void flush() override;
 };
 
+/**
+ * Forwards messages to all its loggers. In async mode, messages are formatted on the calling thread
+ * and pushed to a lock-free queue, which a background thread drains and writes in batches.
+ */
 class CompositeLogger : public Logger {
 	Vector<Logger *> loggers;
 
+	struct AsyncRecord {
+		std::atomic<AsyncRecord *> next = { nullptr };
+		bool is_error = false; // Structured record for log_error(), otherwise a preformatted message.
+		bool err = false;
+		CharString message;
+		CharString function;
+		CharString file;
+		CharString code;
+		int line = 0;
+		bool editor_notify = false;
+		ErrorType type = ERR_ERROR;
+	};
+
+	// Intrusive multiple-producer single-consumer queue. Producers only ever exchange the head,
+	// the consumer owns the tail.
+	std::atomic<AsyncRecord *> async_head = { nullptr };
+	AsyncRecord *async_tail = nullptr;
+	AsyncRecord async_stub;
+
+	std::atomic<bool> async = { false };
+	std::atomic<bool> async_wake_pending = { false };
+	bool async_exit = false;
+	Thread async_thread;
+	Semaphore async_semaphore;
+	Mutex async_drain_mutex; // Held by whoever is draining, so crash paths can take over safely.
+
+	void _async_push(AsyncRecord *p_record);
+	AsyncRecord *_async_pop();
+	void _async_write(AsyncRecord *p_record);
+	void _async_drain();
+	static void _async_thread_func(void *p_self);
+
 public:
 	explicit CompositeLogger(const Vector<Logger *> &p_loggers);
 
@@ -111,6 +159,14 @@ public:
 
 	void add_logger(Logger *p_logger);
 
+	virtual void flush() override;
+
+	void set_async(bool p_async);
+	bool is_async() const { return async.load(std::memory_order_relaxed); }
+	// Switches back to synchronous logging and writes pending records on the calling thread
+	// without waiting for the background thread, so it can be used from crash handlers.
+	void flush_sync();
+
 	virtual ~CompositeLogger();
 };
 
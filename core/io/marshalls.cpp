@@ -879,10 +879,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -908,10 +905,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const int*rbuf=(const int*)buf;
 				data.resize(count);
+#ifdef BIG_ENDIAN_ENABLED
 				int32_t *w = data.ptrw();
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_uint32(&buf[i * 4]);
 				}
+#else
+				memcpy(data.ptrw(), buf, count * sizeof(int32_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -932,10 +933,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const int*rbuf=(const int*)buf;
 				data.resize(count);
+#ifdef BIG_ENDIAN_ENABLED
 				int64_t *w = data.ptrw();
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_uint64(&buf[i * 8]);
 				}
+#else
+				memcpy(data.ptrw(), buf, count * sizeof(int64_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -956,10 +961,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				//const float*rbuf=(const float*)buf;
 				data.resize(count);
+#ifdef BIG_ENDIAN_ENABLED
 				float *w = data.ptrw();
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_float(&buf[i * 4]);
 				}
+#else
+				memcpy(data.ptrw(), buf, count * sizeof(float));
+#endif
 			}
 			r_variant = data;
 
@@ -980,10 +989,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
+#ifdef BIG_ENDIAN_ENABLED
 				double *w = data.ptrw();
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_double(&buf[i * 8]);
 				}
+#else
+				memcpy(data.ptrw(), buf, count * sizeof(double));
+#endif
 			}
 			r_variant = data;
 
@@ -1037,10 +1050,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(double) * 2);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
 					}
+#endif
 
 					int adv = sizeof(double) * 2 * count;
 
@@ -1062,10 +1079,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(float) * 2);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
 					}
+#endif
 
 					int adv = sizeof(float) * 2 * count;
 
@@ -1097,11 +1118,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(double) * 3);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
 					}
+#endif
 
 					int adv = sizeof(double) * 3 * count;
 
@@ -1123,11 +1148,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(float) * 3);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
 					}
+#endif
 
 					int adv = sizeof(float) * 3 * count;
 
@@ -1160,6 +1189,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				carray.resize(count);
 				Color *w = carray.ptrw();
 
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					// Colors should always be in single-precision.
 					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
@@ -1167,6 +1197,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
 					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
 				}
+#else
+				memcpy((void *)w, buf, count * 4 * 4);
+#endif
 
 				int adv = 4 * 4 * count;
 
@@ -1199,12 +1232,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#if defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(double) * 4);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 2);
 						w[i].w = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 3);
 					}
+#endif
 
 					int adv = sizeof(double) * 4 * count;
 
@@ -1226,12 +1263,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#if !defined(REAL_T_IS_DOUBLE) && !defined(BIG_ENDIAN_ENABLED)
+					memcpy((void *)w, buf, count * sizeof(float) * 4);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 2);
 						w[i].w = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 3);
 					}
+#endif
 
 					int adv = sizeof(float) * 4 * count;
 
@@ -2056,6 +2097,162 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+// Returns an upper bound of the size encode_variant() needs, without converting any string.
+// Returns -1 when the size can't be bounded without encoding, like for full objects.
+static int64_t _get_encode_size_bound(const Variant &p_variant, bool p_full_objects, int p_depth) {
+	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+		return -1;
+	}
+
+	// The header. Every code point takes at most 4 bytes in UTF-8, which also covers the padding of strings.
+	int64_t size = 4;
+
+	switch (p_variant.get_type()) {
+		case Variant::NIL:
+		case Variant::CALLABLE: {
+		} break;
+		case Variant::BOOL:
+		case Variant::INT:
+		case Variant::FLOAT:
+		case Variant::RID: {
+			size += 8;
+		} break;
+		case Variant::VECTOR2:
+		case Variant::VECTOR2I:
+		case Variant::RECT2:
+		case Variant::RECT2I:
+		case Variant::VECTOR3:
+		case Variant::VECTOR3I:
+		case Variant::TRANSFORM2D:
+		case Variant::VECTOR4:
+		case Variant::VECTOR4I:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+		case Variant::AABB:
+		case Variant::BASIS:
+		case Variant::TRANSFORM3D:
+		case Variant::PROJECTION:
+		case Variant::COLOR: {
+			size += 16 * sizeof(real_t);
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			size += 4 + 4 * int64_t(String(p_variant).length());
+		} break;
+		case Variant::NODE_PATH: {
+			NodePath np = p_variant;
+			size += 12;
+			for (int i = 0; i < np.get_name_count(); i++) {
+				size += 4 + 4 * int64_t(String(np.get_name(i)).length());
+			}
+			for (int i = 0; i < np.get_subname_count(); i++) {
+				size += 4 + 4 * int64_t(String(np.get_subname(i)).length());
+			}
+		} break;
+		case Variant::OBJECT: {
+			if (p_full_objects) {
+				return -1;
+			}
+			size += 8;
+		} break;
+		case Variant::SIGNAL: {
+			Signal signal = p_variant;
+			size += 4 + 4 * int64_t(String(signal.get_name()).length()) + 8;
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary d = p_variant;
+			size += 4;
+			for (const Variant *key = d.next(); key; key = d.next(key)) {
+				int64_t key_size = _get_encode_size_bound(*key, p_full_objects, p_depth + 1);
+				int64_t value_size = _get_encode_size_bound(d[*key], p_full_objects, p_depth + 1);
+				if (key_size < 0 || value_size < 0) {
+					return -1;
+				}
+				size += key_size + value_size;
+			}
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_variant;
+			if (array.is_typed()) {
+				if (Ref<Script>(array.get_typed_script()).is_valid() && p_full_objects) {
+					return -1;
+				}
+				// Either a class name or a builtin type.
+				size += 4 + 4 * int64_t(MAX(String(array.get_typed_class_name()).length(), String(EncodedObjectAsID::get_class_static()).length()));
+			}
+			size += 4;
+			for (const Variant &var : array) {
+				int64_t var_size = _get_encode_size_bound(var, p_full_objects, p_depth + 1);
+				if (var_size < 0) {
+					return -1;
+				}
+				size += var_size;
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			size += 4 + ((p_variant.operator Vector<uint8_t>().size() + 3) & ~3);
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			size += 4 + 4 * int64_t(p_variant.operator Vector<int32_t>().size());
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			size += 4 + 8 * int64_t(p_variant.operator Vector<int64_t>().size());
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			size += 4 + 4 * int64_t(p_variant.operator Vector<float>().size());
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			size += 4 + 8 * int64_t(p_variant.operator Vector<double>().size());
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			Vector<String> data = p_variant;
+			size += 4;
+			for (const String &str : data) {
+				size += 8 + 4 * int64_t(str.length());
+			}
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			size += 4 + 2 * sizeof(real_t) * int64_t(p_variant.operator Vector<Vector2>().size());
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			size += 4 + 3 * sizeof(real_t) * int64_t(p_variant.operator Vector<Vector3>().size());
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			size += 4 + 4 * 4 * int64_t(p_variant.operator Vector<Color>().size());
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			size += 4 + 4 * sizeof(real_t) * int64_t(p_variant.operator Vector<Vector4>().size());
+		} break;
+		default: {
+			return -1;
+		}
+	}
+
+	return size <= INT_MAX ? size : -1;
+}
+
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int p_offset, int &r_len, bool p_full_objects) {
+	ERR_FAIL_INDEX_V(p_offset, r_buffer.size() + 1, ERR_INVALID_PARAMETER);
+
+	int64_t needed = _get_encode_size_bound(p_variant, p_full_objects, 0);
+	if (needed < 0) {
+		// The size is only known after encoding, so compute it first.
+		int len;
+		Error err = encode_variant(p_variant, nullptr, len, p_full_objects);
+		if (err) {
+			return err;
+		}
+		needed = len;
+	}
+
+	if (r_buffer.size() < p_offset + needed) {
+		ERR_FAIL_COND_V(p_offset + needed > INT_MAX, ERR_OUT_OF_MEMORY);
+		r_buffer.resize(next_power_of_2(uint32_t(p_offset + needed)));
+	}
+
+	return encode_variant(p_variant, r_buffer.ptrw() + p_offset, r_len, p_full_objects);
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
@@ -214,6 +214,9 @@ public:
 
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+// Encodes in one pass at p_offset of r_buffer, which is only resized if it is too small.
+// Reusing the same buffer for every call avoids allocating and sizing each encoding separately.
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int p_offset, int &r_len, bool p_full_objects = false);
 
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
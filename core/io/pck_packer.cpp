@@ -33,6 +33,7 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
@@ -50,6 +51,8 @@ static int _get_pad(int p_alignment, int p_n) {
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "require_verification"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_compress_files", "enabled"), &PCKPacker::set_compress_files);
+	ClassDB::bind_method(D_METHOD("is_compress_files_enabled"), &PCKPacker::is_compress_files_enabled);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush_and_sign", "private_key", "curve", "verbose"), &PCKPacker::flush_and_sign, DEFVAL(ECP_DP_SECP256R1), DEFVAL(false));
 
@@ -150,6 +153,15 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	pf.encrypted = p_encrypt;
 	pf.require_verification = require_verification;
 
+	if (compress_files && pf.size > 0 && pf.size <= UINT32_MAX) {
+		Vector<uint8_t> compressed = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_FILE_COMPRESSED_BLOCK_SIZE);
+		// Keep files that don't shrink much (already compressed formats) raw.
+		if (!compressed.is_empty() && (uint64_t)compressed.size() < pf.size - pf.size / 8) {
+			pf.compressed_data = compressed;
+			pf.size = compressed.size();
+		}
+	}
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -168,6 +180,14 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	return OK;
 }
 
+void PCKPacker::set_compress_files(bool p_enabled) {
+	compress_files = p_enabled;
+}
+
+bool PCKPacker::is_compress_files_enabled() const {
+	return compress_files;
+}
+
 Error PCKPacker::flush(bool p_verbose) {
 	return flush_and_sign(String(), ECP_DP_NONE, p_verbose);
 }
@@ -242,6 +262,9 @@ Error PCKPacker::flush_and_sign(const String &p_private_key, PCKPacker::CurveTyp
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (!files[i].compressed_data.is_empty()) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		if (files[i].require_verification) {
 			flags |= PACK_FILE_REQUIRE_VERIFICATION;
 		}
@@ -303,6 +326,11 @@ Error PCKPacker::flush_and_sign(const String &p_private_key, PCKPacker::CurveTyp
 			ftmp = fae;
 		}
 
+		if (!files[i].compressed_data.is_empty()) {
+			ftmp->store_buffer(files[i].compressed_data);
+			to_write = 0;
+		}
+
 		while (to_write > 0) {
 			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
 			ftmp->store_buffer(buf, read);
@@ -63,6 +63,7 @@ private:
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	bool compress_files = false;
 
 	static void _bind_methods();
 
@@ -75,6 +76,7 @@ private:
 		bool require_verification = false;
 		Vector<uint8_t> md5;
 		Vector<uint8_t> sha256;
+		Vector<uint8_t> compressed_data; // Stored instead of the source file when not empty.
 	};
 	Vector<File> files;
 
@@ -87,6 +89,8 @@ protected:
 public:
 	Error pck_start(const String &p_file, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false, bool require_verification = false);
+	void set_compress_files(bool p_enabled);
+	bool is_compress_files_enabled() const;
 	Error flush(bool p_verbose = false);
 	Error flush_and_sign(const String &p_private_key, PCKPacker::CurveType p_curve, bool p_verbose = false);
 
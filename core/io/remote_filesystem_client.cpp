@@ -30,18 +30,69 @@
 
 #include "remote_filesystem_client.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/string/string_builder.h"
 
 #define FILESYSTEM_CACHE_VERSION 1
-#define FILESYSTEM_PROTOCOL_VERSION 1
+#define FILESYSTEM_PROTOCOL_VERSION 2
 #define PASSWORD_LENGTH 32
 
+#define CHUNK_MIN_SIZE 2048
+#define CHUNK_MAX_SIZE 65536
+#define CHUNK_BOUNDARY_MASK 0xFFF8000000000000ULL // 13 bits, around 8 KiB between boundaries.
+
 #define FILES_SUBFOLDER "remote_filesystem_files"
 #define FILES_CACHE_FILE "remote_filesystem.cache"
 
+struct GearTable {
+	uint64_t values[256];
+
+	GearTable() {
+		// Fixed seed, both ends of the connection need the same table.
+		uint64_t state = 0x9E3779B97F4A7C15ULL;
+		for (int i = 0; i < 256; i++) {
+			state += 0x9E3779B97F4A7C15ULL;
+			uint64_t z = state;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			values[i] = z ^ (z >> 31);
+		}
+	}
+};
+
+void RemoteFilesystemClient::compute_chunks(const uint8_t *p_data, uint64_t p_size, LocalVector<Chunk> &r_chunks) {
+	static const GearTable gear;
+
+	r_chunks.clear();
+	uint64_t start = 0;
+	while (start < p_size) {
+		uint64_t remaining = p_size - start;
+		uint64_t size = MIN(remaining, (uint64_t)CHUNK_MAX_SIZE);
+		if (remaining > CHUNK_MIN_SIZE) {
+			// Gear rolling hash, a boundary only depends on the last 64 bytes before it.
+			uint64_t hash = 0;
+			for (uint64_t i = CHUNK_MIN_SIZE; i < size; i++) {
+				hash = (hash << 1) + gear.values[p_data[start + i]];
+				if (!(hash & CHUNK_BOUNDARY_MASK)) {
+					size = i + 1;
+					break;
+				}
+			}
+		}
+
+		Chunk chunk;
+		chunk.offset = start;
+		chunk.size = size;
+		CryptoCore::md5(p_data + start, size, chunk.md5);
+		r_chunks.push_back(chunk);
+		start += size;
+	}
+}
+
 Vector<RemoteFilesystemClient::FileCache> RemoteFilesystemClient::_load_cache_file() {
 	Ref<FileAccess> fa = FileAccess::open(cache_path.path_join(FILES_CACHE_FILE), FileAccess::READ);
 	if (!fa.is_valid()) {
@@ -108,6 +159,17 @@ Error RemoteFilesystemClient::_store_file(const String &p_path, const LocalVecto
 	return OK;
 }
 
+Error RemoteFilesystemClient::_load_file(const String &p_path, LocalVector<uint8_t> &r_file) {
+	String full_path = cache_path.path_join(FILES_SUBFOLDER).path_join(p_path);
+	Ref<FileAccess> f = FileAccess::open(full_path, FileAccess::READ);
+	if (f.is_null()) {
+		return ERR_FILE_CANT_OPEN;
+	}
+	r_file.resize(f->get_length());
+	f->get_buffer(r_file.ptr(), r_file.size());
+	return f->get_error() == ERR_FILE_EOF ? OK : f->get_error();
+}
+
 Error RemoteFilesystemClient::_remove_file(const String &p_path) {
 	return DirAccess::remove_absolute(cache_path.path_join(FILES_SUBFOLDER).path_join(p_path));
 }
@@ -127,6 +189,45 @@ Error RemoteFilesystemClient::_store_cache_file(const Vector<FileCache> &p_cache
 	return OK;
 }
 
+Error RemoteFilesystemClient::_receive_file(StreamPeerTCP *p_tcp, const String &p_path, const LocalVector<Chunk> &p_chunks, LocalVector<uint8_t> &r_file) {
+	uint64_t file_size = p_tcp->get_u64();
+	uint32_t op_count = p_tcp->get_u32();
+	ERR_FAIL_COND_V(p_tcp->get_status() != StreamPeerTCP::STATUS_CONNECTED, ERR_CONNECTION_ERROR);
+
+	LocalVector<uint8_t> old_file;
+	if (!p_chunks.is_empty()) {
+		Error err = _load_file(p_path, old_file);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Unable to read the cached copy of a file from the remote filesystem: " + p_path);
+	}
+
+	r_file.resize(file_size);
+	uint64_t offset = 0;
+	for (uint32_t i = 0; i < op_count; i++) {
+		uint8_t op = p_tcp->get_u8();
+		if (op == DELTA_OP_COPY) {
+			uint32_t index = p_tcp->get_u32();
+			ERR_FAIL_COND_V_MSG(index >= p_chunks.size(), ERR_INVALID_DATA, "Invalid chunk received from remote filesystem: " + p_path);
+			const Chunk &chunk = p_chunks[index];
+			ERR_FAIL_COND_V_MSG(chunk.offset + chunk.size > old_file.size() || offset + chunk.size > file_size, ERR_INVALID_DATA, "Invalid chunk received from remote filesystem: " + p_path);
+			memcpy(r_file.ptr() + offset, old_file.ptr() + chunk.offset, chunk.size);
+			offset += chunk.size;
+		} else if (op == DELTA_OP_DATA) {
+			uint32_t size = p_tcp->get_u32();
+			ERR_FAIL_COND_V_MSG(offset + size > file_size, ERR_INVALID_DATA, "Invalid data received from remote filesystem: " + p_path);
+			Error err = p_tcp->get_data(r_file.ptr() + offset, size);
+			ERR_FAIL_COND_V(err != OK, err);
+			offset += size;
+		} else {
+			ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid operation received from remote filesystem: " + p_path);
+		}
+
+		ERR_FAIL_COND_V(p_tcp->get_status() != StreamPeerTCP::STATUS_CONNECTED, ERR_CONNECTION_ERROR);
+	}
+
+	ERR_FAIL_COND_V_MSG(offset != file_size, ERR_INVALID_DATA, "Incomplete file received from remote filesystem: " + p_path);
+	return OK;
+}
+
 Error RemoteFilesystemClient::synchronize_with_server(const String &p_host, int p_port, const String &p_password, String &r_cache_path) {
 	Error err = _synchronize_with_server(p_host, p_port, p_password, r_cache_path);
 	// Ensure no memory is kept
@@ -260,6 +361,36 @@ Error RemoteFilesystemClient::_synchronize_with_server(const String &p_host, int
 		files_processed.insert(file);
 	}
 
+	// Send the chunks of the copies we already have of the changed files, so the server only needs to send what's different.
+	print_verbose("Remote Filesystem: Sending chunks of cached files.");
+
+	HashSet<String> cached_paths;
+	for (int i = 0; i < file_cache.size(); i++) {
+		cached_paths.insert(file_cache[i].path);
+	}
+
+	LocalVector<LocalVector<Chunk>> file_chunks;
+	file_chunks.resize(file_count);
+	LocalVector<uint8_t> signature_buffer;
+	for (uint32_t i = 0; i < file_count; i++) {
+		LocalVector<Chunk> &chunks = file_chunks[i];
+		if (temp_file_cache[i].server_modified_time != 0 && cached_paths.has(temp_file_cache[i].path) && _load_file(temp_file_cache[i].path, file_buffer) == OK) {
+			compute_chunks(file_buffer.ptr(), file_buffer.size(), chunks);
+		}
+
+		signature_buffer.resize(4 + chunks.size() * CHUNK_SIGNATURE_SIZE);
+		uint8_t *w = signature_buffer.ptr();
+		w += encode_uint32(chunks.size(), w);
+		for (const Chunk &chunk : chunks) {
+			w += encode_uint32(chunk.size, w);
+			memcpy(w, chunk.md5, 16);
+			w += 16;
+		}
+		tcp_client->put_data(signature_buffer.ptr(), signature_buffer.size());
+	}
+
+	ERR_FAIL_COND_V_MSG(tcp_client->get_status() != StreamPeerTCP::STATUS_CONNECTED, ERR_CONNECTION_ERROR, "Remote filesystem server disconnected while sending chunks of cached files.");
+
 	Vector<FileCache> new_file_cache;
 
 	// Get the actual files. As a robustness measure, if the connection is interrupted here, any file not yet received will be considered removed.
@@ -275,10 +406,8 @@ Error RemoteFilesystemClient::_synchronize_with_server(const String &p_host, int
 			continue;
 		}
 
-		uint64_t file_size = tcp_client->get_u64();
-		file_buffer.resize(file_size);
-
-		err = tcp_client->get_data(file_buffer.ptr(), file_size);
+		err = _receive_file(tcp_client.ptr(), file, file_chunks[i], file_buffer);
+		file_chunks[i].reset();
 		if (err != OK) {
 			ERR_PRINT("Error retrieving file from remote filesystem: " + file);
 			server_disconnected = true;
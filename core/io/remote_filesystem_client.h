@@ -36,10 +36,33 @@
 #include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 
+class StreamPeerTCP;
+
 class RemoteFilesystemClient {
+public:
+	// Files are split at content defined boundaries, so an edit only changes the chunks around it
+	// and the server can tell the client to reuse the rest of its old copy.
+	struct Chunk {
+		uint64_t offset = 0;
+		uint32_t size = 0;
+		uint8_t md5[16] = {};
+	};
+
+	enum DeltaOp {
+		DELTA_OP_COPY, // Followed by the index of a chunk of the client's copy.
+		DELTA_OP_DATA, // Followed by a size and the new bytes.
+	};
+
+	static const int CHUNK_SIGNATURE_SIZE = 4 + 16; // Size and MD5 of a chunk.
+
+	static void compute_chunks(const uint8_t *p_data, uint64_t p_size, LocalVector<Chunk> &r_chunks);
+
+private:
 	String cache_path;
 	HashSet<String> validated_directories;
 
+	Error _receive_file(StreamPeerTCP *p_tcp, const String &p_path, const LocalVector<Chunk> &p_chunks, LocalVector<uint8_t> &r_file);
+
 protected:
 	String _get_cache_path() { return cache_path; }
 	struct FileCache {
@@ -50,6 +73,7 @@ protected:
 	virtual bool _is_configured() { return !cache_path.is_empty(); }
 	// Can be re-implemented per platform. If so, feel free to ignore get_cache_path()
 	virtual Vector<FileCache> _load_cache_file();
+	virtual Error _load_file(const String &p_path, LocalVector<uint8_t> &r_file);
 	virtual Error _store_file(const String &p_path, const LocalVector<uint8_t> &p_file, uint64_t &modified_time);
 	virtual Error _remove_file(const String &p_path);
 	virtual Error _store_cache_file(const Vector<FileCache> &p_cache);
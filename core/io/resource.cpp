@@ -415,6 +415,15 @@ void Resource::_take_over_path(const String &p_path) {
 	set_path(p_path, true);
 }
 
+void Resource::set_cache_priority(CachePriority p_priority) {
+	ERR_FAIL_INDEX(p_priority, CACHE_PRIORITY_MAX);
+	cache_priority = p_priority;
+}
+
+Resource::CachePriority Resource::get_cache_priority() const {
+	return cache_priority;
+}
+
 RID Resource::get_rid() const {
 	if (get_script_instance()) {
 		Callable::CallError ce;
@@ -541,6 +550,8 @@ void Resource::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_local_to_scene"), &Resource::is_local_to_scene);
 	ClassDB::bind_method(D_METHOD("get_local_scene"), &Resource::get_local_scene);
 	ClassDB::bind_method(D_METHOD("setup_local_to_scene"), &Resource::setup_local_to_scene);
+	ClassDB::bind_method(D_METHOD("set_cache_priority", "priority"), &Resource::set_cache_priority);
+	ClassDB::bind_method(D_METHOD("get_cache_priority"), &Resource::get_cache_priority);
 
 	ClassDB::bind_static_method("Resource", D_METHOD("generate_scene_unique_id"), &Resource::generate_scene_unique_id);
 	ClassDB::bind_method(D_METHOD("set_scene_unique_id", "id"), &Resource::set_scene_unique_id);
@@ -557,6 +568,11 @@ void Resource::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "resource_path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_EDITOR), "set_path", "get_path");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "resource_name"), "set_name", "get_name");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "resource_scene_unique_id", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_scene_unique_id", "get_scene_unique_id");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "resource_cache_priority", PROPERTY_HINT_ENUM, "Low,Normal,High", PROPERTY_USAGE_NONE), "set_cache_priority", "get_cache_priority");
+
+	BIND_ENUM_CONSTANT(CACHE_PRIORITY_LOW);
+	BIND_ENUM_CONSTANT(CACHE_PRIORITY_NORMAL);
+	BIND_ENUM_CONSTANT(CACHE_PRIORITY_HIGH);
 
 	MethodInfo get_rid_bind("_get_rid");
 	get_rid_bind.return_val.type = Variant::RID;
@@ -589,11 +605,17 @@ HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
 
 Mutex ResourceCache::lock;
+Mutex ResourceCache::retained_lock;
+LRUCache<String, ResourceCache::Retained> ResourceCache::retained[Resource::CACHE_PRIORITY_MAX];
+uint64_t ResourceCache::retained_budget = 0;
+uint64_t ResourceCache::retained_usage = 0;
 #ifdef TOOLS_ENABLED
 RWLock ResourceCache::path_cache_lock;
 #endif
 
 void ResourceCache::clear() {
+	clear_retained();
+
 	if (!resources.is_empty()) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
@@ -683,3 +705,119 @@ int ResourceCache::get_cached_resource_count() {
 
 	return rc;
 }
+
+void ResourceCache::_evict_retained(LocalVector<Ref<Resource>> &r_evicted) {
+	for (int i = 0; i < Resource::CACHE_PRIORITY_MAX && retained_usage > retained_budget; i++) {
+		LRUCache<String, Retained> &cache = retained[i];
+		// Resources still used elsewhere would not free anything, they are only moved to the front.
+		size_t checked = 0;
+		size_t count = cache.get_size();
+		while (retained_usage > retained_budget && checked < count) {
+			String path = *cache.get_least_recent_key();
+			const Retained *r = cache.getptr(path);
+			checked++;
+			if (r->resource->get_reference_count() > 1) {
+				continue;
+			}
+			retained_usage -= r->size;
+			r_evicted.push_back(r->resource);
+			cache.erase(path);
+		}
+	}
+}
+
+void ResourceCache::retain(const Ref<Resource> &p_resource) {
+	if (retained_budget == 0 || p_resource.is_null() || p_resource->is_built_in()) {
+		return;
+	}
+
+	String path = p_resource->get_path();
+
+	// Copies loaded while ignoring the cache are not retained.
+	lock.lock();
+	Resource **cached = resources.getptr(path);
+	bool registered = cached && *cached == p_resource.ptr();
+	lock.unlock();
+	if (!registered) {
+		return;
+	}
+
+	LocalVector<Ref<Resource>> evicted;
+
+	retained_lock.lock();
+
+	int priority = p_resource->get_cache_priority();
+	bool found = false;
+	for (int i = 0; i < Resource::CACHE_PRIORITY_MAX; i++) {
+		const Retained *r = retained[i].getptr(path); // Marks it as recently used.
+		if (!r) {
+			continue;
+		}
+		if (r->resource == p_resource && i == priority) {
+			found = true;
+		} else {
+			// Either replaced by a new load, or its priority changed.
+			retained_usage -= r->size;
+			evicted.push_back(r->resource);
+			retained[i].erase(path);
+		}
+		break;
+	}
+
+	if (!found) {
+		Retained r;
+		r.resource = p_resource;
+		r.size = p_resource->get_memory_usage();
+		retained_usage += r.size;
+		retained[priority].insert(path, r);
+		_evict_retained(evicted);
+	}
+
+	retained_lock.unlock();
+
+	// The evicted resources are freed out of the lock, as freeing them may release other resources.
+	evicted.clear();
+}
+
+void ResourceCache::set_retained_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted;
+
+	retained_lock.lock();
+	retained_budget = p_bytes;
+	for (int i = 0; i < Resource::CACHE_PRIORITY_MAX; i++) {
+		// Only the byte budget limits the amount of entries.
+		retained[i].set_capacity(INT32_MAX);
+	}
+	_evict_retained(evicted);
+	retained_lock.unlock();
+
+	if (p_bytes == 0) {
+		// Nothing gets retained anymore, so drop the entries that are still in use as well.
+		clear_retained();
+	}
+}
+
+uint64_t ResourceCache::get_retained_budget() {
+	return retained_budget;
+}
+
+uint64_t ResourceCache::get_retained_usage() {
+	MutexLock mutex_lock(retained_lock);
+	return retained_usage;
+}
+
+void ResourceCache::clear_retained() {
+	LocalVector<Ref<Resource>> evicted;
+
+	retained_lock.lock();
+	for (int i = 0; i < Resource::CACHE_PRIORITY_MAX; i++) {
+		// Moved out first, so the resources are freed out of the lock.
+		while (const String *path = retained[i].get_least_recent_key()) {
+			String key = *path;
+			evicted.push_back(retained[i].get(key).resource);
+			retained[i].erase(key);
+		}
+	}
+	retained_usage = 0;
+	retained_lock.unlock();
+}
@@ -35,6 +35,8 @@
 #include "core/object/class_db.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -54,6 +56,13 @@ public:
 	static void register_custom_data_to_otdb() { ClassDB::add_resource_base_extension("res", get_class_static()); }
 	virtual String get_base_extension() const { return "res"; }
 
+	enum CachePriority {
+		CACHE_PRIORITY_LOW,
+		CACHE_PRIORITY_NORMAL,
+		CACHE_PRIORITY_HIGH,
+		CACHE_PRIORITY_MAX,
+	};
+
 private:
 	friend class ResBase;
 	friend class ResourceCache;
@@ -69,6 +78,7 @@ private:
 #endif
 
 	bool local_to_scene = false;
+	CachePriority cache_priority = CACHE_PRIORITY_NORMAL;
 	friend class SceneState;
 	Node *local_scene = nullptr;
 
@@ -142,6 +152,10 @@ public:
 
 	virtual RID get_rid() const; // some resources may offer conversion to RID
 
+	void set_cache_priority(CachePriority p_priority);
+	CachePriority get_cache_priority() const;
+	virtual uint64_t get_memory_usage() const { return 0; } // Estimate of the memory held by the resource, in bytes.
+
 #ifdef TOOLS_ENABLED
 	//helps keep IDs same number when loading/saving scenes. -1 clears ID and it Returns -1 when no id stored
 	void set_id_for_path(const String &p_path, const String &p_id);
@@ -152,6 +166,8 @@ public:
 	~Resource();
 };
 
+VARIANT_ENUM_CAST(Resource::CachePriority);
+
 class ResourceCache {
 	friend class Resource;
 	friend class ResourceLoader; //need the lock
@@ -165,11 +181,31 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// Strong references to recently loaded resources, so they survive for a while once nothing else uses them.
+	// One LRU per priority, lower priorities are evicted first.
+	struct Retained {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+
+	static Mutex retained_lock;
+	static LRUCache<String, Retained> retained[Resource::CACHE_PRIORITY_MAX];
+	static uint64_t retained_budget;
+	static uint64_t retained_usage;
+
+	static void _evict_retained(LocalVector<Ref<Resource>> &r_evicted);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void retain(const Ref<Resource> &p_resource);
+	static void set_retained_budget(uint64_t p_bytes);
+	static uint64_t get_retained_budget();
+	static uint64_t get_retained_usage();
+	static void clear_retained();
 };
 
 #endif // RESOURCE_H
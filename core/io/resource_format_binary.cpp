@@ -511,6 +511,14 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		case VARIANT_PACKED_BYTE_ARRAY: {
 			uint32_t len = f->get_32();
 
+			if (skip_payloads) {
+				// Placeholders don't need the data (e.g. mesh buffers, audio samples), leave it on disk.
+				f->seek(f->get_position() + len);
+				_advance_padding(len);
+				r_v = Vector<uint8_t>();
+				break;
+			}
+
 			Vector<uint8_t> array;
 			array.resize(len);
 			uint8_t *w = array.ptrw();
@@ -748,6 +756,15 @@ Error ResourceLoaderBinary::load() {
 
 		String t = get_unicode_string();
 
+		skip_payloads = false;
+		if (ResourceLoader::is_loading_placeholders()) {
+			StringName placeholder_type = ResourceLoader::get_placeholder_type(t);
+			if (placeholder_type != StringName()) {
+				t = placeholder_type;
+				skip_payloads = true;
+			}
+		}
+
 		Ref<Resource> res;
 		Resource *r = nullptr;
 
@@ -920,6 +937,17 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
+
+	const uint8_t *mapped = f->get_mapped_data();
+	uint64_t pos = f->get_position();
+	if (mapped && pos + len <= f->get_length()) {
+		// Parse straight from the mapped file instead of copying into the string buffer first.
+		String s;
+		s.parse_utf8((const char *)mapped + pos, len);
+		f->seek(pos + len);
+		return s;
+	}
+
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
 	s.parse_utf8(&str_buf[0]);
@@ -1213,6 +1241,9 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
+	// The whole file gets parsed, let the OS read it while the header is processed.
+	f->prefetch(0, f->get_length());
+
 	ResourceLoaderBinary loader;
 	switch (p_cache_mode) {
 		case CACHE_MODE_IGNORE:
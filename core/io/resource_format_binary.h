@@ -67,6 +67,7 @@ class ResourceLoaderBinary {
 	bool using_uids = false;
 	String script_class;
 	bool use_sub_threads = false;
+	bool skip_payloads = false;
 	float *progress = nullptr;
 	Vector<ExtResource> external_resources;
 
@@ -363,6 +363,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 				}
 			}
 			load_task.resource->set_path(load_task.local_path, replacing);
+			ResourceCache::retain(load_task.resource);
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -465,6 +466,9 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	}
 
 	Ref<Resource> res = _load_complete(*load_token.ptr(), r_error);
+	if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
+		ResourceCache::retain(res); // Marks it as recently used.
+	}
 	return res;
 }
 
@@ -661,6 +665,8 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 
 	print_lt("GET: user load tokens: " + itos(user_load_tokens.size()));
 
+	ResourceCache::retain(res); // Marks it as recently used.
+
 	return res;
 }
 
@@ -1258,6 +1264,15 @@ void ResourceLoader::set_create_missing_resources_if_class_unavailable(bool p_en
 	create_missing_resources_if_class_unavailable = p_enable;
 }
 
+void ResourceLoader::add_placeholder_type(const StringName &p_type, const StringName &p_placeholder_type) {
+	placeholder_types[p_type] = p_placeholder_type;
+}
+
+StringName ResourceLoader::get_placeholder_type(const StringName &p_type) {
+	HashMap<StringName, StringName>::ConstIterator E = placeholder_types.find(p_type);
+	return E ? E->value : StringName();
+}
+
 void ResourceLoader::add_custom_loaders() {
 	// Custom loaders registration exploits global class names
 
@@ -1296,7 +1311,9 @@ bool ResourceLoader::is_cleaning_tasks() {
 
 void ResourceLoader::initialize() {}
 
-void ResourceLoader::finalize() {}
+void ResourceLoader::finalize() {
+	placeholder_types.clear();
+}
 
 ResourceLoadErrorNotify ResourceLoader::err_notify = nullptr;
 DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
@@ -1304,6 +1321,8 @@ DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
 bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
 bool ResourceLoader::timestamp_on_load = false;
+bool ResourceLoader::load_placeholders = false;
+HashMap<StringName, StringName> ResourceLoader::placeholder_types;
 
 thread_local int ResourceLoader::load_nesting = 0;
 thread_local WorkerThreadPool::TaskID ResourceLoader::caller_task_id = 0;
@@ -146,6 +146,8 @@ private:
 	static DependencyErrorNotify dep_err_notify;
 	static bool abort_on_missing_resource;
 	static bool create_missing_resources_if_class_unavailable;
+	static bool load_placeholders;
+	static HashMap<StringName, StringName> placeholder_types;
 	static HashMap<String, Vector<String>> translation_remaps;
 	static HashMap<String, String> path_remaps;
 
@@ -275,6 +277,12 @@ public:
 	static void set_create_missing_resources_if_class_unavailable(bool p_enable);
 	_FORCE_INLINE_ static bool is_creating_missing_resources_if_class_unavailable_enabled() { return create_missing_resources_if_class_unavailable; }
 
+	// Placeholder mode replaces media resources (textures, meshes, audio) by lightweight stand-ins, for dedicated servers.
+	static void set_load_placeholders(bool p_enable) { load_placeholders = p_enable; }
+	_FORCE_INLINE_ static bool is_loading_placeholders() { return load_placeholders; }
+	static void add_placeholder_type(const StringName &p_type, const StringName &p_placeholder_type);
+	static StringName get_placeholder_type(const StringName &p_type);
+
 	static Ref<Resource> ensure_resource_ref_override_for_outer_load(const String &p_path, const String &p_res_type);
 	static Ref<Resource> get_resource_ref_override(const String &p_path);
 
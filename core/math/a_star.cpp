@@ -58,14 +58,16 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
 		points.set(p_id, pt);
+		graph_dirty = true;
 	} else {
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
+		if (!graph_dirty) {
+			graph.positions[found_pt->index] = p_pos;
+			graph.weight_scales[found_pt->index] = p_weight_scale;
+		}
 	}
 }
 
@@ -83,6 +85,9 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
 
 	p->pos = p_pos;
+	if (!graph_dirty) {
+		graph.positions[p->index] = p_pos;
+	}
 }
 
 real_t AStar3D::get_point_weight_scale(int64_t p_id) const {
@@ -100,6 +105,9 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 
 	p->weight_scale = p_weight_scale;
+	if (!graph_dirty) {
+		graph.weight_scales[p->index] = p_weight_scale;
+	}
 }
 
 void AStar3D::remove_point(int64_t p_id) {
@@ -126,6 +134,7 @@ void AStar3D::remove_point(int64_t p_id) {
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
+	graph_dirty = true;
 }
 
 void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
@@ -140,6 +149,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	ERR_FAIL_COND_MSG(!to_exists, vformat("Can't connect points. Point with id: %d doesn't exist.", p_with_id));
 
 	a->neighbors.set(b->id, b);
+	graph_dirty = true;
 
 	if (bidirectional) {
 		b->neighbors.set(a->id, a);
@@ -185,6 +195,7 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 		s.direction = (element->direction & ~remove_direction);
 
 		a->neighbors.remove(b->id);
+		graph_dirty = true;
 		if (bidirectional) {
 			b->neighbors.remove(a->id);
 			if (element->direction != Segment::BIDIRECTIONAL) {
@@ -249,6 +260,7 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	graph_dirty = true;
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -319,72 +331,198 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point) {
-	last_closest_point = nullptr;
-	pass++;
+void AStar3D::_build_graph() {
+	const uint32_t point_count = points.get_num_elements();
 
-	if (!end_point->enabled) {
-		return false;
+	graph.ids.resize(point_count);
+	graph.positions.resize(point_count);
+	graph.weight_scales.resize(point_count);
+	graph.enabled.resize(point_count);
+	graph.nbor_offsets.resize(point_count + 1);
+	graph.nbors.clear();
+
+	uint32_t index = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *(it.value);
+		p->index = index;
+		graph.ids[index] = p->id;
+		graph.positions[index] = p->pos;
+		graph.weight_scales[index] = p->weight_scale;
+		graph.enabled[index] = p->enabled;
+		index++;
 	}
 
-	bool found_route = false;
+	// Second pass, now that every point has its index.
+	index = 0;
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *(it.value);
+		graph.nbor_offsets[index++] = graph.nbors.size();
+		for (OAHashMap<int64_t, Point *>::Iterator nit = p->neighbors.iter(); nit.valid; nit = p->neighbors.next_iter(nit)) {
+			graph.nbors.push_back((*nit.value)->index);
+		}
+	}
+	graph.nbor_offsets[point_count] = graph.nbors.size();
+
+	graph_dirty = false;
+}
+
+AStar3D::SolveState *AStar3D::_acquire_solve_state() {
+	MutexLock lock(solve_mutex);
+
+	if (graph_dirty) {
+		_build_graph();
+	}
+
+	SolveState *state = nullptr;
+	if (solve_states.is_empty()) {
+		state = memnew(SolveState);
+	} else {
+		state = solve_states[solve_states.size() - 1];
+		solve_states.remove_at(solve_states.size() - 1);
+	}
+
+	const uint32_t point_count = graph.ids.size();
+	if (state->g_score.size() < point_count) {
+		const uint32_t old_count = state->g_score.size();
+		state->prev_point.resize(point_count);
+		state->g_score.resize(point_count);
+		state->f_score.resize(point_count);
+		state->abs_g_score.resize(point_count);
+		state->abs_f_score.resize(point_count);
+		state->heap_index.resize(point_count);
+		state->open_pass.resize(point_count);
+		state->closed_pass.resize(point_count);
+		for (uint32_t i = old_count; i < point_count; i++) {
+			state->open_pass[i] = 0;
+			state->closed_pass[i] = 0;
+		}
+	}
+
+	return state;
+}
+
+void AStar3D::_release_solve_state(SolveState *p_state) {
+	MutexLock lock(solve_mutex);
+	solve_states.push_back(p_state);
+}
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+void AStar3D::_heap_push_up(SolveState &r_state, uint32_t p_hole, uint32_t p_point) {
+	uint32_t *heap = r_state.open_list.ptr();
+	while (p_hole > 0) {
+		uint32_t parent = (p_hole - 1) / 2;
+		if (!_is_worse(r_state, heap[parent], p_point)) {
+			break;
+		}
+		heap[p_hole] = heap[parent];
+		r_state.heap_index[heap[p_hole]] = p_hole;
+		p_hole = parent;
+	}
+	heap[p_hole] = p_point;
+	r_state.heap_index[p_point] = p_hole;
+}
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+void AStar3D::_heap_pop(SolveState &r_state) {
+	// Same hole-based sift as SortArray::pop_heap(), so ties resolve as they always did.
+	const uint32_t len = r_state.open_list.size() - 1;
+	if (len == 0) {
+		r_state.open_list.clear();
+		return;
+	}
 
-	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+	uint32_t *heap = r_state.open_list.ptr();
+	const uint32_t last = heap[len];
+	uint32_t hole = 0;
+	uint32_t second_child = 2;
 
-		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+	while (second_child < len) {
+		if (_is_worse(r_state, heap[second_child], heap[second_child - 1])) {
+			second_child--;
 		}
+		heap[hole] = heap[second_child];
+		r_state.heap_index[heap[hole]] = hole;
+		hole = second_child;
+		second_child = 2 * (second_child + 1);
+	}
 
-		if (p == end_point) {
+	if (second_child == len) {
+		heap[hole] = heap[second_child - 1];
+		r_state.heap_index[heap[hole]] = hole;
+		hole = second_child - 1;
+	}
+
+	_heap_push_up(r_state, hole, last);
+	r_state.open_list.resize(len);
+}
+
+void AStar3D::_update_closest_point(SolveState &r_state, uint32_t p_point) {
+	// Find point closer to end_point, or same distance to end_point but closer to begin_point.
+	const uint32_t closest = r_state.last_closest_point;
+	if (closest == INVALID_POINT || r_state.abs_f_score[closest] > r_state.abs_f_score[p_point] || (r_state.abs_f_score[closest] >= r_state.abs_f_score[p_point] && r_state.abs_g_score[closest] > r_state.abs_g_score[p_point])) {
+		r_state.last_closest_point = p_point;
+	}
+}
+
+bool AStar3D::_solve(SolveState &r_state, uint32_t p_begin_point, uint32_t p_end_point) {
+	r_state.last_closest_point = INVALID_POINT;
+	r_state.open_list.clear();
+	r_state.pass++;
+
+	if (!graph.enabled[p_end_point]) {
+		return false;
+	}
+
+	bool found_route = false;
+	const uint64_t pass = r_state.pass;
+	const int64_t end_id = graph.ids[p_end_point];
+
+	r_state.g_score[p_begin_point] = 0;
+	r_state.f_score[p_begin_point] = _estimate_cost(graph.ids[p_begin_point], end_id);
+	r_state.abs_g_score[p_begin_point] = 0;
+	r_state.abs_f_score[p_begin_point] = r_state.f_score[p_begin_point];
+	r_state.open_list.push_back(p_begin_point);
+	r_state.heap_index[p_begin_point] = 0;
+
+	while (!r_state.open_list.is_empty()) {
+		uint32_t p = r_state.open_list[0]; // The currently processed point.
+
+		_update_closest_point(r_state, p);
+
+		if (p == p_end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		_heap_pop(r_state); // Remove the current point from the open list.
+		r_state.closed_pass[p] = pass; // Mark the point as closed.
 
-		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			Point *e = *(it.value); // The neighbor point.
+		const int64_t p_id = graph.ids[p];
+		for (uint32_t i = graph.nbor_offsets[p]; i < graph.nbor_offsets[p + 1]; i++) {
+			uint32_t e = graph.nbors[i]; // The neighbor point.
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!graph.enabled[e] || r_state.closed_pass[e] == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = r_state.g_score[p] + _compute_cost(p_id, graph.ids[e]) * graph.weight_scales[e];
 
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
+			if (r_state.open_pass[e] != pass) { // The point wasn't inside the open list.
+				r_state.open_pass[e] = pass;
+				r_state.open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= r_state.g_score[e]) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			r_state.prev_point[e] = p;
+			r_state.g_score[e] = tentative_g_score;
+			r_state.f_score[e] = tentative_g_score + _estimate_cost(graph.ids[e], end_id);
+			r_state.abs_g_score[e] = tentative_g_score;
+			r_state.abs_f_score[e] = r_state.f_score[e] - tentative_g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			// Decrease-key: the point only ever moves towards the top of the heap.
+			_heap_push_up(r_state, new_point ? r_state.open_list.size() - 1 : r_state.heap_index[e], e);
 		}
 	}
 
@@ -440,24 +578,27 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	SolveState *state = _acquire_solve_state();
+
+	uint32_t begin_point = a->index;
+	uint32_t end_point = b->index;
 
-	bool found_route = _solve(begin_point, end_point);
+	bool found_route = _solve(*state, begin_point, end_point);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
+		if (!p_allow_partial_path || state->last_closest_point == INVALID_POINT) {
+			_release_solve_state(state);
 			return Vector<Vector3>();
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_point = state->last_closest_point;
 	}
 
-	Point *p = end_point;
+	uint32_t p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = state->prev_point[p];
 	}
 
 	Vector<Vector3> path;
@@ -466,16 +607,17 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 	{
 		Vector3 *w = path.ptrw();
 
-		Point *p2 = end_point;
+		p = end_point;
 		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
+		while (p != begin_point) {
+			w[idx--] = graph.positions[p];
+			p = state->prev_point[p];
 		}
 
-		w[0] = p2->pos; // Assign first
+		w[0] = graph.positions[p]; // Assign first
 	}
 
+	_release_solve_state(state);
 	return path;
 }
 
@@ -494,24 +636,27 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	SolveState *state = _acquire_solve_state();
 
-	bool found_route = _solve(begin_point, end_point);
+	uint32_t begin_point = a->index;
+	uint32_t end_point = b->index;
+
+	bool found_route = _solve(*state, begin_point, end_point);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
+		if (!p_allow_partial_path || state->last_closest_point == INVALID_POINT) {
+			_release_solve_state(state);
 			return Vector<int64_t>();
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_point = state->last_closest_point;
 	}
 
-	Point *p = end_point;
+	uint32_t p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = state->prev_point[p];
 	}
 
 	Vector<int64_t> path;
@@ -523,13 +668,14 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		p = end_point;
 		int64_t idx = pc - 1;
 		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
+			w[idx--] = graph.ids[p];
+			p = state->prev_point[p];
 		}
 
-		w[0] = p->id; // Assign first
+		w[0] = graph.ids[p]; // Assign first
 	}
 
+	_release_solve_state(state);
 	return path;
 }
 
@@ -539,6 +685,9 @@ void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set if point is disabled. Point with id: %d doesn't exist.", p_id));
 
 	p->enabled = !p_disabled;
+	if (!graph_dirty) {
+		graph.enabled[p->index] = p->enabled;
+	}
 }
 
 bool AStar3D::is_point_disabled(int64_t p_id) const {
@@ -585,6 +734,9 @@ void AStar3D::_bind_methods() {
 
 AStar3D::~AStar3D() {
 	clear();
+	for (SolveState *state : solve_states) {
+		memdelete(state);
+	}
 }
 
 /////////////////////////////////////////////////////////////
@@ -723,24 +875,27 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
+	AStar3D::SolveState *state = astar._acquire_solve_state();
+
+	uint32_t begin_point = a->index;
+	uint32_t end_point = b->index;
 
-	bool found_route = _solve(begin_point, end_point);
+	bool found_route = _solve(*state, begin_point, end_point);
 	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
+		if (!p_allow_partial_path || state->last_closest_point == AStar3D::INVALID_POINT) {
+			astar._release_solve_state(state);
 			return Vector<Vector2>();
 		}
 
 		// Use closest point instead.
-		end_point = astar.last_closest_point;
+		end_point = state->last_closest_point;
 	}
 
-	AStar3D::Point *p = end_point;
+	uint32_t p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = state->prev_point[p];
 	}
 
 	Vector<Vector2> path;
@@ -749,16 +904,17 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 	{
 		Vector2 *w = path.ptrw();
 
-		AStar3D::Point *p2 = end_point;
+		p = end_point;
 		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
+		while (p != begin_point) {
+			w[idx--] = Vector2(astar.graph.positions[p].x, astar.graph.positions[p].y);
+			p = state->prev_point[p];
 		}
 
-		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
+		w[0] = Vector2(astar.graph.positions[p].x, astar.graph.positions[p].y); // Assign first
 	}
 
+	astar._release_solve_state(state);
 	return path;
 }
 
@@ -777,24 +933,27 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
+	AStar3D::SolveState *state = astar._acquire_solve_state();
 
-	bool found_route = _solve(begin_point, end_point);
+	uint32_t begin_point = a->index;
+	uint32_t end_point = b->index;
+
+	bool found_route = _solve(*state, begin_point, end_point);
 	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
+		if (!p_allow_partial_path || state->last_closest_point == AStar3D::INVALID_POINT) {
+			astar._release_solve_state(state);
 			return Vector<int64_t>();
 		}
 
 		// Use closest point instead.
-		end_point = astar.last_closest_point;
+		end_point = state->last_closest_point;
 	}
 
-	AStar3D::Point *p = end_point;
+	uint32_t p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = state->prev_point[p];
 	}
 
 	Vector<int64_t> path;
@@ -806,82 +965,78 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		p = end_point;
 		int64_t idx = pc - 1;
 		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
+			w[idx--] = astar.graph.ids[p];
+			p = state->prev_point[p];
 		}
 
-		w[0] = p->id; // Assign first
+		w[0] = astar.graph.ids[p]; // Assign first
 	}
 
+	astar._release_solve_state(state);
 	return path;
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
-	astar.last_closest_point = nullptr;
-	astar.pass++;
+bool AStar2D::_solve(AStar3D::SolveState &r_state, uint32_t p_begin_point, uint32_t p_end_point) {
+	r_state.last_closest_point = AStar3D::INVALID_POINT;
+	r_state.open_list.clear();
+	r_state.pass++;
 
-	if (!end_point->enabled) {
+	if (!astar.graph.enabled[p_end_point]) {
 		return false;
 	}
 
 	bool found_route = false;
+	const uint64_t pass = r_state.pass;
+	const int64_t end_id = astar.graph.ids[p_end_point];
 
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
+	r_state.g_score[p_begin_point] = 0;
+	r_state.f_score[p_begin_point] = _estimate_cost(astar.graph.ids[p_begin_point], end_id);
+	r_state.abs_g_score[p_begin_point] = 0;
+	r_state.abs_f_score[p_begin_point] = r_state.f_score[p_begin_point];
+	r_state.open_list.push_back(p_begin_point);
+	r_state.heap_index[p_begin_point] = 0;
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	while (!r_state.open_list.is_empty()) {
+		uint32_t p = r_state.open_list[0]; // The currently processed point.
 
-	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
+		AStar3D::_update_closest_point(r_state, p);
 
-		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (astar.last_closest_point == nullptr || astar.last_closest_point->abs_f_score > p->abs_f_score || (astar.last_closest_point->abs_f_score >= p->abs_f_score && astar.last_closest_point->abs_g_score > p->abs_g_score)) {
-			astar.last_closest_point = p;
-		}
-
-		if (p == end_point) {
+		if (p == p_end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed.
+		AStar3D::_heap_pop(r_state); // Remove the current point from the open list.
+		r_state.closed_pass[p] = pass; // Mark the point as closed.
 
-		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			AStar3D::Point *e = *(it.value); // The neighbor point.
+		const int64_t p_id = astar.graph.ids[p];
+		for (uint32_t i = astar.graph.nbor_offsets[p]; i < astar.graph.nbor_offsets[p + 1]; i++) {
+			uint32_t e = astar.graph.nbors[i]; // The neighbor point.
 
-			if (!e->enabled || e->closed_pass == astar.pass) {
+			if (!astar.graph.enabled[e] || r_state.closed_pass[e] == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = r_state.g_score[p] + _compute_cost(p_id, astar.graph.ids[e]) * astar.graph.weight_scales[e];
 
 			bool new_point = false;
 
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
+			if (r_state.open_pass[e] != pass) { // The point wasn't inside the open list.
+				r_state.open_pass[e] = pass;
+				r_state.open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= r_state.g_score[e]) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			r_state.prev_point[e] = p;
+			r_state.g_score[e] = tentative_g_score;
+			r_state.f_score[e] = tentative_g_score + _estimate_cost(astar.graph.ids[e], end_id);
+			r_state.abs_g_score[e] = tentative_g_score;
+			r_state.abs_f_score[e] = r_state.f_score[e] - tentative_g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			// Decrease-key: the point only ever moves towards the top of the heap.
+			AStar3D::_heap_push_up(r_state, new_point ? r_state.open_list.size() - 1 : r_state.heap_index[e], e);
 		}
 	}
 
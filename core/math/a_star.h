@@ -33,6 +33,8 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -54,28 +56,43 @@ class AStar3D : public RefCounted {
 		OAHashMap<int64_t, Point *> neighbors = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
+		// Index into the packed graph, valid while the graph isn't dirty.
+		uint32_t index = 0;
+	};
 
-		// Used for getting closest_point_of_last_pathing_call.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
+	static constexpr uint32_t INVALID_POINT = UINT32_MAX;
+
+	// Contiguous copy of the points and their connections that the solver works on.
+	// Neighbors are stored as point indices in CSR form: the neighbors of point `i`
+	// are `nbors[nbor_offsets[i]]` up to `nbors[nbor_offsets[i + 1]]`.
+	struct PackedGraph {
+		LocalVector<int64_t> ids;
+		LocalVector<Vector3> positions;
+		LocalVector<real_t> weight_scales;
+		LocalVector<uint8_t> enabled;
+		LocalVector<uint32_t> nbor_offsets;
+		LocalVector<uint32_t> nbors;
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
-				return true;
-			} else if (A->f_score < B->f_score) {
-				return false;
-			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
-			}
-		}
+	// Per-query search data, indexed by packed point index. Kept in a pool so that
+	// several solves can run at the same time on the same graph.
+	struct SolveState {
+		LocalVector<uint32_t> prev_point;
+		LocalVector<real_t> g_score;
+		LocalVector<real_t> f_score;
+		LocalVector<uint64_t> open_pass;
+		LocalVector<uint64_t> closed_pass;
+
+		// Used for getting closest_point_of_last_pathing_call.
+		LocalVector<real_t> abs_g_score;
+		LocalVector<real_t> abs_f_score;
+
+		// Binary heap of point indices, and the position of each open point in it.
+		LocalVector<uint32_t> open_list;
+		LocalVector<uint32_t> heap_index;
+
+		uint64_t pass = 0;
+		uint32_t last_closest_point = INVALID_POINT;
 	};
 
 	struct Segment {
@@ -109,13 +126,34 @@ class AStar3D : public RefCounted {
 	};
 
 	int64_t last_free_id = 0;
-	uint64_t pass = 1;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
-	Point *last_closest_point = nullptr;
 
-	bool _solve(Point *begin_point, Point *end_point);
+	PackedGraph graph;
+	bool graph_dirty = true;
+
+	LocalVector<SolveState *> solve_states;
+	Mutex solve_mutex;
+
+	void _build_graph();
+	SolveState *_acquire_solve_state();
+	void _release_solve_state(SolveState *p_state);
+
+	_FORCE_INLINE_ static bool _is_worse(const SolveState &p_state, uint32_t p_a, uint32_t p_b) { // Returns true when the point A is worse than point B.
+		if (p_state.f_score[p_a] > p_state.f_score[p_b]) {
+			return true;
+		} else if (p_state.f_score[p_a] < p_state.f_score[p_b]) {
+			return false;
+		} else {
+			return p_state.g_score[p_a] < p_state.g_score[p_b]; // If the f_costs are the same then prioritize the points that are further away from the start.
+		}
+	}
+	static void _heap_push_up(SolveState &r_state, uint32_t p_hole, uint32_t p_point);
+	static void _heap_pop(SolveState &r_state);
+	static void _update_closest_point(SolveState &r_state, uint32_t p_point);
+
+	bool _solve(SolveState &r_state, uint32_t p_begin_point, uint32_t p_end_point);
 
 protected:
 	static void _bind_methods();
@@ -171,7 +209,7 @@ class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
 	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point);
+	bool _solve(AStar3D::SolveState &r_state, uint32_t p_begin_point, uint32_t p_end_point);
 
 protected:
 	static void _bind_methods();
@@ -126,37 +126,47 @@ void AStarGrid2D::update() {
 		return;
 	}
 
-	points.clear();
+	const uint64_t cell_count = uint64_t(region.size.x) * uint64_t(region.size.y);
+	ERR_FAIL_COND_MSG(cell_count >= INVALID_CELL, vformat("Grid region %s has too many cells.", region));
 
-	const int32_t end_x = region.get_end().x;
-	const int32_t end_y = region.get_end().y;
-	const Vector2 half_cell_size = cell_size / 2;
+	solid_mask.clear();
+	solid_mask.resize((cell_count + 63) / 64);
+	for (uint64_t &bits : solid_mask) {
+		bits = 0;
+	}
+	weight_scales.clear();
 
-	for (int32_t y = region.position.y; y < end_y; y++) {
-		LocalVector<Point> line;
-		for (int32_t x = region.position.x; x < end_x; x++) {
-			Vector2 v = offset;
-			switch (cell_shape) {
-				case CELL_SHAPE_ISOMETRIC_RIGHT:
-					v += half_cell_size + Vector2(x + y, y - x) * half_cell_size;
-					break;
-				case CELL_SHAPE_ISOMETRIC_DOWN:
-					v += half_cell_size + Vector2(x - y, x + y) * half_cell_size;
-					break;
-				case CELL_SHAPE_SQUARE:
-					v += Vector2(x, y) * cell_size;
-					break;
-				default:
-					break;
-			}
-			line.push_back(Point(Vector2i(x, y), v));
+	{
+		// The solve states are sized for the previous region.
+		MutexLock lock(solve_states_mutex);
+		for (SolveState *state : solve_states) {
+			memdelete(state);
 		}
-		points.push_back(line);
+		solve_states.clear();
 	}
 
 	dirty = false;
 }
 
+Vector2 AStarGrid2D::_get_point_position_unchecked(const Vector2i &p_id) const {
+	const Vector2 half_cell_size = cell_size / 2;
+	Vector2 v = offset;
+	switch (cell_shape) {
+		case CELL_SHAPE_ISOMETRIC_RIGHT:
+			v += half_cell_size + Vector2(p_id.x + p_id.y, p_id.y - p_id.x) * half_cell_size;
+			break;
+		case CELL_SHAPE_ISOMETRIC_DOWN:
+			v += half_cell_size + Vector2(p_id.x - p_id.y, p_id.x + p_id.y) * half_cell_size;
+			break;
+		case CELL_SHAPE_SQUARE:
+			v += Vector2(p_id.x, p_id.y) * cell_size;
+			break;
+		default:
+			break;
+	}
+	return v;
+}
+
 bool AStarGrid2D::is_in_bounds(int32_t p_x, int32_t p_y) const {
 	return region.has_point(Vector2i(p_x, p_y));
 }
@@ -207,26 +217,40 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
-	_get_point_unchecked(p_id)->solid = p_solid;
+	_set_cell_solid(_get_cell_unchecked(p_id.x, p_id.y), p_solid);
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), false, vformat("Can't get if point is disabled. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->solid;
+	return _is_cell_solid(_get_cell_unchecked(p_id.x, p_id.y));
+}
+
+void AStarGrid2D::_set_cell_weight_scale(uint32_t p_cell, real_t p_weight_scale) {
+	if (weight_scales.is_empty()) {
+		if (p_weight_scale == 1.0) {
+			return;
+		}
+		const uint32_t cell_count = region.size.x * region.size.y;
+		weight_scales.resize(cell_count);
+		for (real_t &weight_scale : weight_scales) {
+			weight_scale = 1.0;
+		}
+	}
+	weight_scales[p_cell] = p_weight_scale;
 }
 
 void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
-	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	_set_cell_weight_scale(_get_cell_unchecked(p_id.x, p_id.y), p_weight_scale);
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, 0, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), 0, vformat("Can't get point's weight scale. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->weight_scale;
+	return _get_cell_weight_scale(_get_cell_unchecked(p_id.x, p_id.y));
 }
 
 void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
@@ -238,7 +262,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
 		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_get_point_unchecked(x, y)->solid = p_solid;
+			_set_cell_solid(_get_cell_unchecked(x, y), p_solid);
 		}
 	}
 }
@@ -253,160 +277,169 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
 		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
+			_set_cell_weight_scale(_get_cell_unchecked(x, y), p_weight_scale);
 		}
 	}
 }
 
-AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	if (!p_to || p_to->solid) {
-		return nullptr;
-	}
-	if (p_to == end) {
-		return p_to;
-	}
-
-	int32_t from_x = p_from->id.x;
-	int32_t from_y = p_from->id.y;
+uint32_t AStarGrid2D::_jump(int32_t p_from_x, int32_t p_from_y, int32_t p_to_x, int32_t p_to_y, uint32_t p_end_point) const {
+	const int32_t dx = p_to_x - p_from_x;
+	const int32_t dy = p_to_y - p_from_y;
 
-	int32_t to_x = p_to->id.x;
-	int32_t to_y = p_to->id.y;
+	int32_t to_x = p_to_x;
+	int32_t to_y = p_to_y;
 
-	int32_t dx = to_x - from_x;
-	int32_t dy = to_y - from_y;
+	// Moving on in the same direction is a loop rather than a recursion, so long jumps don't grow the stack.
+	while (true) {
+		if (!_is_walkable(to_x, to_y)) {
+			return INVALID_CELL;
+		}
+		const uint32_t to = _get_cell_unchecked(to_x, to_y);
+		if (to == p_end_point) {
+			return to;
+		}
 
-	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
-		if (dx != 0 && dy != 0) {
-			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
-				return p_to;
-			}
-		} else {
-			if (dx != 0) {
-				if ((_is_walkable(to_x + dx, to_y + 1) && !_is_walkable(to_x, to_y + 1)) || (_is_walkable(to_x + dx, to_y - 1) && !_is_walkable(to_x, to_y - 1))) {
-					return p_to;
+		if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
+			if (dx != 0 && dy != 0) {
+				if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x + dx, to_y, p_end_point) != INVALID_CELL) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x, to_y + dy, p_end_point) != INVALID_CELL) {
+					return to;
 				}
 			} else {
-				if ((_is_walkable(to_x + 1, to_y + dy) && !_is_walkable(to_x + 1, to_y)) || (_is_walkable(to_x - 1, to_y + dy) && !_is_walkable(to_x - 1, to_y))) {
-					return p_to;
+				if (dx != 0) {
+					if ((_is_walkable(to_x + dx, to_y + 1) && !_is_walkable(to_x, to_y + 1)) || (_is_walkable(to_x + dx, to_y - 1) && !_is_walkable(to_x, to_y - 1))) {
+						return to;
+					}
+				} else {
+					if ((_is_walkable(to_x + 1, to_y + dy) && !_is_walkable(to_x + 1, to_y)) || (_is_walkable(to_x - 1, to_y + dy) && !_is_walkable(to_x - 1, to_y))) {
+						return to;
+					}
 				}
 			}
-		}
-		if (_is_walkable(to_x + dx, to_y + dy) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || (_is_walkable(to_x + dx, to_y) || _is_walkable(to_x, to_y + dy)))) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
-		}
-	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
-		if (dx != 0 && dy != 0) {
-			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
-				return p_to;
+			if (_is_walkable(to_x + dx, to_y + dy) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || (_is_walkable(to_x + dx, to_y) || _is_walkable(to_x, to_y + dy)))) {
+				to_x += dx;
+				to_y += dy;
+				continue;
 			}
-		} else {
-			if (dx != 0) {
-				if ((_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1)) || (_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1))) {
-					return p_to;
+		} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
+			if (dx != 0 && dy != 0) {
+				if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x + dx, to_y, p_end_point) != INVALID_CELL) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x, to_y + dy, p_end_point) != INVALID_CELL) {
+					return to;
 				}
 			} else {
-				if ((_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy)) || (_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy))) {
-					return p_to;
+				if (dx != 0) {
+					if ((_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1)) || (_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1))) {
+						return to;
+					}
+				} else {
+					if ((_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy)) || (_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy))) {
+						return to;
+					}
 				}
 			}
-		}
-		if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
-		}
-	} else { // DIAGONAL_MODE_NEVER
-		if (dx != 0) {
-			if ((_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1)) || (_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1))) {
-				return p_to;
-			}
-		} else if (dy != 0) {
-			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
-				return p_to;
-			}
-			if (_jump(p_to, _get_point(to_x + 1, to_y)) != nullptr) {
-				return p_to;
+			if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
+				to_x += dx;
+				to_y += dy;
+				continue;
 			}
-			if (_jump(p_to, _get_point(to_x - 1, to_y)) != nullptr) {
-				return p_to;
+		} else { // DIAGONAL_MODE_NEVER
+			if (dx != 0) {
+				if ((_is_walkable(to_x, to_y - 1) && !_is_walkable(to_x - dx, to_y - 1)) || (_is_walkable(to_x, to_y + 1) && !_is_walkable(to_x - dx, to_y + 1))) {
+					return to;
+				}
+			} else if (dy != 0) {
+				if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x + 1, to_y, p_end_point) != INVALID_CELL) {
+					return to;
+				}
+				if (_jump(to_x, to_y, to_x - 1, to_y, p_end_point) != INVALID_CELL) {
+					return to;
+				}
 			}
+			to_x += dx;
+			to_y += dy;
+			continue;
 		}
-		return _jump(p_to, _get_point(to_x + dx, to_y + dy));
+		return INVALID_CELL;
 	}
-	return nullptr;
 }
 
-void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
+void AStarGrid2D::_get_nbors(uint32_t p_point, LocalVector<uint32_t> &r_nbors) const {
 	bool ts0 = false, td0 = false,
 		 ts1 = false, td1 = false,
 		 ts2 = false, td2 = false,
 		 ts3 = false, td3 = false;
 
-	Point *left = nullptr;
-	Point *right = nullptr;
-	Point *top = nullptr;
-	Point *bottom = nullptr;
+	const Vector2i id = _get_cell_id(p_point);
 
-	Point *top_left = nullptr;
-	Point *top_right = nullptr;
-	Point *bottom_left = nullptr;
-	Point *bottom_right = nullptr;
+	uint32_t left = INVALID_CELL;
+	uint32_t right = INVALID_CELL;
+	uint32_t top = INVALID_CELL;
+	uint32_t bottom = INVALID_CELL;
+
+	uint32_t top_left = INVALID_CELL;
+	uint32_t top_right = INVALID_CELL;
+	uint32_t bottom_left = INVALID_CELL;
+	uint32_t bottom_right = INVALID_CELL;
 
 	{
 		bool has_left = false;
 		bool has_right = false;
 
-		if (p_point->id.x - 1 >= region.position.x) {
-			left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y);
+		if (id.x - 1 >= region.position.x) {
+			left = _get_cell_unchecked(id.x - 1, id.y);
 			has_left = true;
 		}
-		if (p_point->id.x + 1 < region.position.x + region.size.width) {
-			right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y);
+		if (id.x + 1 < region.position.x + region.size.width) {
+			right = _get_cell_unchecked(id.x + 1, id.y);
 			has_right = true;
 		}
-		if (p_point->id.y - 1 >= region.position.y) {
-			top = _get_point_unchecked(p_point->id.x, p_point->id.y - 1);
+		if (id.y - 1 >= region.position.y) {
+			top = _get_cell_unchecked(id.x, id.y - 1);
 			if (has_left) {
-				top_left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y - 1);
+				top_left = _get_cell_unchecked(id.x - 1, id.y - 1);
 			}
 			if (has_right) {
-				top_right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y - 1);
+				top_right = _get_cell_unchecked(id.x + 1, id.y - 1);
 			}
 		}
-		if (p_point->id.y + 1 < region.position.y + region.size.height) {
-			bottom = _get_point_unchecked(p_point->id.x, p_point->id.y + 1);
+		if (id.y + 1 < region.position.y + region.size.height) {
+			bottom = _get_cell_unchecked(id.x, id.y + 1);
 			if (has_left) {
-				bottom_left = _get_point_unchecked(p_point->id.x - 1, p_point->id.y + 1);
+				bottom_left = _get_cell_unchecked(id.x - 1, id.y + 1);
 			}
 			if (has_right) {
-				bottom_right = _get_point_unchecked(p_point->id.x + 1, p_point->id.y + 1);
+				bottom_right = _get_cell_unchecked(id.x + 1, id.y + 1);
 			}
 		}
 	}
 
-	if (top && !top->solid) {
+	if (top != INVALID_CELL && !_is_cell_solid(top)) {
 		r_nbors.push_back(top);
 		ts0 = true;
 	}
-	if (right && !right->solid) {
+	if (right != INVALID_CELL && !_is_cell_solid(right)) {
 		r_nbors.push_back(right);
 		ts1 = true;
 	}
-	if (bottom && !bottom->solid) {
+	if (bottom != INVALID_CELL && !_is_cell_solid(bottom)) {
 		r_nbors.push_back(bottom);
 		ts2 = true;
 	}
-	if (left && !left->solid) {
+	if (left != INVALID_CELL && !_is_cell_solid(left)) {
 		r_nbors.push_back(left);
 		ts3 = true;
 	}
@@ -436,46 +469,153 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 			break;
 	}
 
-	if (td0 && (top_left && !top_left->solid)) {
+	if (td0 && (top_left != INVALID_CELL && !_is_cell_solid(top_left))) {
 		r_nbors.push_back(top_left);
 	}
-	if (td1 && (top_right && !top_right->solid)) {
+	if (td1 && (top_right != INVALID_CELL && !_is_cell_solid(top_right))) {
 		r_nbors.push_back(top_right);
 	}
-	if (td2 && (bottom_right && !bottom_right->solid)) {
+	if (td2 && (bottom_right != INVALID_CELL && !_is_cell_solid(bottom_right))) {
 		r_nbors.push_back(bottom_right);
 	}
-	if (td3 && (bottom_left && !bottom_left->solid)) {
+	if (td3 && (bottom_left != INVALID_CELL && !_is_cell_solid(bottom_left))) {
 		r_nbors.push_back(bottom_left);
 	}
 }
 
-bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
-	last_closest_point = nullptr;
-	pass++;
+void AStarGrid2D::_get_jump_nbors(uint32_t p_point, uint32_t p_prev_point, LocalVector<uint32_t> &r_nbors) const {
+	// Jump Point Search pruning, only the natural and forced neighbors in the direction of travel are kept.
+	// The pruning rules match the forced neighbor checks of _jump() with DIAGONAL_MODE_ALWAYS.
+	const Vector2i id = _get_cell_id(p_point);
+	const Vector2i prev_id = _get_cell_id(p_prev_point);
+	const int32_t dx = SIGN(id.x - prev_id.x);
+	const int32_t dy = SIGN(id.y - prev_id.y);
+
+	const int32_t x = id.x;
+	const int32_t y = id.y;
+
+#define ADD_NBOR_IF_WALKABLE(m_x, m_y)                     \
+	if (_is_walkable(m_x, m_y)) {                          \
+		r_nbors.push_back(_get_cell_unchecked(m_x, m_y)); \
+	}
 
-	if (p_end_point->solid) {
+	if (dx != 0 && dy != 0) {
+		ADD_NBOR_IF_WALKABLE(x, y + dy);
+		ADD_NBOR_IF_WALKABLE(x + dx, y);
+		ADD_NBOR_IF_WALKABLE(x + dx, y + dy);
+		if (!_is_walkable(x - dx, y)) {
+			ADD_NBOR_IF_WALKABLE(x - dx, y + dy);
+		}
+		if (!_is_walkable(x, y - dy)) {
+			ADD_NBOR_IF_WALKABLE(x + dx, y - dy);
+		}
+	} else if (dx != 0) {
+		ADD_NBOR_IF_WALKABLE(x + dx, y);
+		if (!_is_walkable(x, y + 1)) {
+			ADD_NBOR_IF_WALKABLE(x + dx, y + 1);
+		}
+		if (!_is_walkable(x, y - 1)) {
+			ADD_NBOR_IF_WALKABLE(x + dx, y - 1);
+		}
+	} else {
+		ADD_NBOR_IF_WALKABLE(x, y + dy);
+		if (!_is_walkable(x + 1, y)) {
+			ADD_NBOR_IF_WALKABLE(x + 1, y + dy);
+		}
+		if (!_is_walkable(x - 1, y)) {
+			ADD_NBOR_IF_WALKABLE(x - 1, y + dy);
+		}
+	}
+
+#undef ADD_NBOR_IF_WALKABLE
+}
+
+AStarGrid2D::SolveState *AStarGrid2D::_acquire_solve_state() {
+	SolveState *state = nullptr;
+	{
+		MutexLock lock(solve_states_mutex);
+		if (!solve_states.is_empty()) {
+			state = solve_states[solve_states.size() - 1];
+			solve_states.remove_at(solve_states.size() - 1);
+		}
+	}
+
+	if (!state) {
+		state = memnew(SolveState);
+		const uint32_t cell_count = region.size.x * region.size.y;
+		state->prev_point.resize(cell_count);
+		state->g_score.resize(cell_count);
+		state->f_score.resize(cell_count);
+		state->open_pass.resize(cell_count);
+		state->closed_pass.resize(cell_count);
+		for (uint32_t i = 0; i < cell_count; i++) {
+			state->open_pass[i] = 0;
+			state->closed_pass[i] = 0;
+		}
+	}
+	return state;
+}
+
+void AStarGrid2D::_release_solve_state(SolveState *p_state) {
+	MutexLock lock(solve_states_mutex);
+	solve_states.push_back(p_state);
+}
+
+bool AStarGrid2D::_solve(SolveState &p_state, uint32_t p_begin_point, uint32_t p_end_point) {
+	p_state.last_closest_point = INVALID_CELL;
+	p_state.pass++;
+	if (p_state.pass == 0) { // The pass counter wrapped around, the old marks could match again.
+		for (uint32_t i = 0; i < p_state.open_pass.size(); i++) {
+			p_state.open_pass[i] = 0;
+			p_state.closed_pass[i] = 0;
+		}
+		p_state.pass = 1;
+	}
+	const uint32_t pass = p_state.pass;
+
+	if (_is_cell_solid(p_end_point)) {
 		return false;
 	}
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	const Vector2i end_id = _get_cell_id(p_end_point);
+	// Pruning only applies to uniform cost grids, the weight scales are ignored while jumping anyway.
+	const bool prune_nbors = jumping_enabled && diagonal_mode == DIAGONAL_MODE_ALWAYS;
+
+	real_t *g_score = p_state.g_score.ptr();
+	real_t *f_score = p_state.f_score.ptr();
+	uint32_t *prev_point = p_state.prev_point.ptr();
+	uint32_t *open_pass = p_state.open_pass.ptr();
+	uint32_t *closed_pass = p_state.closed_pass.ptr();
+
+	LocalVector<uint32_t> &open_list = p_state.open_list;
+	LocalVector<uint32_t> &nbors = p_state.nbors;
+	open_list.clear();
+
+	SortArray<uint32_t, SortPoints> sorter;
+	sorter.compare.f_score = f_score;
+	sorter.compare.g_score = g_score;
 
-	p_begin_point->g_score = 0;
-	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	p_begin_point->abs_g_score = 0;
-	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	g_score[p_begin_point] = 0;
+	f_score[p_begin_point] = _estimate_cost(_get_cell_id(p_begin_point), end_id);
+	prev_point[p_begin_point] = INVALID_CELL;
+	open_pass[p_begin_point] = pass;
 	open_list.push_back(p_begin_point);
-	end = p_end_point;
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		const uint32_t p = open_list[0]; // The currently processed point.
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		if (p_state.last_closest_point == INVALID_CELL) {
+			p_state.last_closest_point = p;
+		} else {
+			const uint32_t c = p_state.last_closest_point;
+			const real_t c_h_score = f_score[c] - g_score[c];
+			const real_t p_h_score = f_score[p] - g_score[p];
+			if (c_h_score > p_h_score || (c_h_score >= p_h_score && g_score[c] > g_score[p])) {
+				p_state.last_closest_point = p;
+			}
 		}
 
 		if (p == p_end_point) {
@@ -485,44 +625,49 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 
 		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
 		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		closed_pass[p] = pass; // Mark the point as closed.
 
-		LocalVector<Point *> nbors;
-		_get_nbors(p, nbors);
+		nbors.clear();
+		if (prune_nbors && prev_point[p] != INVALID_CELL) {
+			_get_jump_nbors(p, prev_point[p], nbors);
+		} else {
+			_get_nbors(p, nbors);
+		}
 
-		for (Point *e : nbors) {
+		const Vector2i p_id = _get_cell_id(p);
+
+		for (uint32_t e : nbors) {
 			real_t weight_scale = 1.0;
 
 			if (jumping_enabled) {
 				// TODO: Make it works with weight_scale.
-				e = _jump(p, e);
-				if (!e || e->closed_pass == pass) {
+				const Vector2i e_id = _get_cell_id(e);
+				e = _jump(p_id.x, p_id.y, e_id.x, e_id.y, p_end_point);
+				if (e == INVALID_CELL || closed_pass[e] == pass) {
 					continue;
 				}
 			} else {
-				if (e->solid || e->closed_pass == pass) {
+				if (_is_cell_solid(e) || closed_pass[e] == pass) {
 					continue;
 				}
-				weight_scale = e->weight_scale;
+				weight_scale = _get_cell_weight_scale(e);
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * weight_scale;
+			const Vector2i e_id = _get_cell_id(e);
+			real_t tentative_g_score = g_score[p] + _compute_cost(p_id, e_id) * weight_scale;
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
+			if (open_pass[e] != pass) { // The point wasn't inside the open list.
+				open_pass[e] = pass;
 				open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= g_score[e]) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, p_end_point->id);
-
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			prev_point[e] = p;
+			g_score[e] = tentative_g_score;
+			f_score[e] = tentative_g_score + _estimate_cost(e_id, end_id);
 
 			if (new_point) { // The position of the new points is already known.
 				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
@@ -552,14 +697,22 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 }
 
 void AStarGrid2D::clear() {
-	points.clear();
+	solid_mask.clear();
+	weight_scales.clear();
+	{
+		MutexLock lock(solve_states_mutex);
+		for (SolveState *state : solve_states) {
+			memdelete(state);
+		}
+		solve_states.clear();
+	}
 	region = Rect2i();
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, Vector2(), "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), Vector2(), vformat("Can't get point's position. Point %s out of bounds %s.", p_id, region));
-	return _get_point_unchecked(p_id)->pos;
+	return _get_point_position_unchecked(p_id);
 }
 
 Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
@@ -567,49 +720,13 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-	Point *a = _get_point(p_from_id.x, p_from_id.y);
-	Point *b = _get_point(p_to_id.x, p_to_id.y);
-
-	if (a == b) {
-		Vector<Vector2> ret;
-		ret.push_back(a->pos);
-		return ret;
-	}
-
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector2>();
-		}
-
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
-
-	Point *p = end_point;
-	int32_t pc = 1;
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
+	TypedArray<Vector2i> id_path = get_id_path(p_from_id, p_to_id, p_allow_partial_path);
 
 	Vector<Vector2> path;
-	path.resize(pc);
-
-	{
-		Vector2 *w = path.ptrw();
-
-		p = end_point;
-		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->pos;
-			p = p->prev_point;
-		}
-
-		w[0] = p->pos;
+	path.resize(id_path.size());
+	Vector2 *w = path.ptrw();
+	for (int i = 0; i < id_path.size(); i++) {
+		w[i] = _get_point_position_unchecked(id_path[i]);
 	}
 
 	return path;
@@ -620,33 +737,38 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-	Point *a = _get_point(p_from_id.x, p_from_id.y);
-	Point *b = _get_point(p_to_id.x, p_to_id.y);
+	const uint32_t a = _get_cell_unchecked(p_from_id.x, p_from_id.y);
+	const uint32_t b = _get_cell_unchecked(p_to_id.x, p_to_id.y);
 
 	if (a == b) {
 		TypedArray<Vector2i> ret;
-		ret.push_back(a->id);
+		ret.push_back(p_from_id);
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	uint32_t begin_point = a;
+	uint32_t end_point = b;
+
+	SolveState *state = _acquire_solve_state();
 
-	bool found_route = _solve(begin_point, end_point);
+	bool found_route = _solve(*state, begin_point, end_point);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
+		if (!p_allow_partial_path || state->last_closest_point == INVALID_CELL) {
+			_release_solve_state(state);
 			return TypedArray<Vector2i>();
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_point = state->last_closest_point;
 	}
 
-	Point *p = end_point;
+	const uint32_t *prev_point = state->prev_point.ptr();
+
+	uint32_t p = end_point;
 	int32_t pc = 1;
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = prev_point[p];
 	}
 
 	TypedArray<Vector2i> path;
@@ -656,16 +778,24 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 		p = end_point;
 		int32_t idx = pc - 1;
 		while (p != begin_point) {
-			path[idx--] = p->id;
-			p = p->prev_point;
+			path[idx--] = _get_cell_id(p);
+			p = prev_point[p];
 		}
 
-		path[0] = p->id;
+		path[0] = _get_cell_id(p);
 	}
 
+	_release_solve_state(state);
+
 	return path;
 }
 
+AStarGrid2D::~AStarGrid2D() {
+	for (SolveState *state : solve_states) {
+		memdelete(state);
+	}
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -33,6 +33,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/templates/list.h"
 #include "core/templates/local_vector.h"
 
@@ -75,78 +76,89 @@ private:
 	Heuristic default_compute_heuristic = HEURISTIC_EUCLIDEAN;
 	Heuristic default_estimate_heuristic = HEURISTIC_EUCLIDEAN;
 
-	struct Point {
-		Vector2i id;
+	// Only the solid flags and the weight scales are stored per cell, row by row over the region.
+	LocalVector<uint64_t> solid_mask;
+	// Left empty until a cell gets a weight scale other than 1.0.
+	LocalVector<real_t> weight_scales;
 
-		bool solid = false;
-		Vector2 pos;
-		real_t weight_scale = 1.0;
+	static constexpr uint32_t INVALID_CELL = UINT32_MAX;
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
+	// Scratch data of a single path query, so queries on the same grid can run concurrently.
+	struct SolveState {
+		LocalVector<uint32_t> prev_point;
+		LocalVector<real_t> g_score;
+		LocalVector<real_t> f_score;
+		LocalVector<uint32_t> open_pass;
+		LocalVector<uint32_t> closed_pass;
+		LocalVector<uint32_t> open_list;
+		LocalVector<uint32_t> nbors;
+		uint32_t pass = 0;
 
 		// Used for getting last_closest_point.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
-
-		Point() {}
-
-		Point(const Vector2i &p_id, const Vector2 &p_pos) :
-				id(p_id), pos(p_pos) {}
+		uint32_t last_closest_point = INVALID_CELL;
 	};
 
 	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+		const real_t *f_score = nullptr;
+		const real_t *g_score = nullptr;
+
+		_FORCE_INLINE_ bool operator()(uint32_t A, uint32_t B) const { // Returns true when the Point A is worse than Point B.
+			if (f_score[A] > f_score[B]) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (f_score[A] < f_score[B]) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return g_score[A] < g_score[B]; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
 
-	LocalVector<LocalVector<Point>> points;
-	Point *end = nullptr;
-	Point *last_closest_point = nullptr;
-
-	uint64_t pass = 1;
+	// Idle solve states, reused by the next queries.
+	Mutex solve_states_mutex;
+	LocalVector<SolveState *> solve_states;
 
 private: // Internal routines.
-	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
-		if (region.has_point(Vector2i(p_x, p_y))) {
-			return !points[p_y - region.position.y][p_x - region.position.x].solid;
-		}
-		return false;
+	_FORCE_INLINE_ uint32_t _get_cell_unchecked(int32_t p_x, int32_t p_y) const {
+		return uint32_t(p_y - region.position.y) * uint32_t(region.size.x) + uint32_t(p_x - region.position.x);
 	}
 
-	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
-		if (region.has_point(Vector2i(p_x, p_y))) {
-			return &points[p_y - region.position.y][p_x - region.position.x];
-		}
-		return nullptr;
+	_FORCE_INLINE_ Vector2i _get_cell_id(uint32_t p_cell) const {
+		return Vector2i(region.position.x + int32_t(p_cell % uint32_t(region.size.x)), region.position.y + int32_t(p_cell / uint32_t(region.size.x)));
 	}
 
-	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
-		return &points[p_y - region.position.y][p_x - region.position.x];
+	_FORCE_INLINE_ bool _is_cell_solid(uint32_t p_cell) const {
+		return (solid_mask[p_cell >> 6] >> (p_cell & 63)) & 1;
 	}
 
-	_FORCE_INLINE_ Point *_get_point_unchecked(const Vector2i &p_id) {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+	_FORCE_INLINE_ void _set_cell_solid(uint32_t p_cell, bool p_solid) {
+		if (p_solid) {
+			solid_mask[p_cell >> 6] |= uint64_t(1) << (p_cell & 63);
+		} else {
+			solid_mask[p_cell >> 6] &= ~(uint64_t(1) << (p_cell & 63));
+		}
+	}
+
+	_FORCE_INLINE_ real_t _get_cell_weight_scale(uint32_t p_cell) const {
+		return weight_scales.is_empty() ? real_t(1.0) : weight_scales[p_cell];
 	}
 
-	_FORCE_INLINE_ const Point *_get_point_unchecked(const Vector2i &p_id) const {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
+		if (region.has_point(Vector2i(p_x, p_y))) {
+			return !_is_cell_solid(_get_cell_unchecked(p_x, p_y));
+		}
+		return false;
 	}
 
-	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
-	Point *_jump(Point *p_from, Point *p_to);
-	bool _solve(Point *p_begin_point, Point *p_end_point);
+	Vector2 _get_point_position_unchecked(const Vector2i &p_id) const;
+	void _set_cell_weight_scale(uint32_t p_cell, real_t p_weight_scale);
+
+	SolveState *_acquire_solve_state();
+	void _release_solve_state(SolveState *p_state);
+
+	void _get_nbors(uint32_t p_point, LocalVector<uint32_t> &r_nbors) const;
+	void _get_jump_nbors(uint32_t p_point, uint32_t p_prev_point, LocalVector<uint32_t> &r_nbors) const;
+	uint32_t _jump(int32_t p_from_x, int32_t p_from_y, int32_t p_to_x, int32_t p_to_y, uint32_t p_end_point) const;
+	bool _solve(SolveState &p_state, uint32_t p_begin_point, uint32_t p_end_point);
 
 protected:
 	static void _bind_methods();
@@ -211,6 +223,8 @@ public:
 	Vector2 get_point_position(const Vector2i &p_id) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+
+	~AStarGrid2D();
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -40,6 +40,7 @@
  */
 
 class Variant;
+struct Transform3D;
 
 struct [[nodiscard]] AABB {
 	Vector3 position;
@@ -71,6 +72,7 @@ struct [[nodiscard]] AABB {
 	AABB merge(const AABB &p_with) const;
 	void merge_with(const AABB &p_aabb); ///merge with another AABB
 	AABB intersection(const AABB &p_aabb) const; ///get box where two intersect, empty if no intersection occurs
+	static void xform_batch(const Transform3D *p_xforms, const AABB *p_src, AABB *r_dst, uint32_t p_count); ///r_dst[i] is p_src[i] transformed by p_xforms[i]
 	_FORCE_INLINE_ bool smits_intersect_ray(const Vector3 &p_from, const Vector3 &p_dir, real_t p_t0, real_t p_t1) const;
 
 	bool intersects_segment(const Vector3 &p_from, const Vector3 &p_to, Vector3 *r_intersection_point = nullptr, Vector3 *r_normal = nullptr) const;
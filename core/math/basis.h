@@ -139,6 +139,9 @@ struct [[nodiscard]] Basis {
 	_FORCE_INLINE_ void operator/=(real_t p_val);
 	_FORCE_INLINE_ Basis operator/(real_t p_val) const;
 
+	// Sets r_dst[i] to p_a[i] * p_b[i], vectorized when real_t is float. The destination can be one of the sources.
+	static void mul_batch(const Basis *p_a, const Basis *p_b, Basis *r_dst, uint32_t p_count);
+
 	bool is_orthogonal() const;
 	bool is_orthonormal() const;
 	bool is_conformal() const;
@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -71,6 +72,12 @@ public:
 		_thread_safe = p_enable;
 	}
 
+	// When enabled, the changed items of large updates are culled on the WorkerThreadPool.
+	// Pair and unpair callbacks are still sent from the calling thread, in the same order.
+	void params_set_parallel_pairing(bool p_enable) {
+		_parallel_pairing = p_enable;
+	}
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -344,10 +351,18 @@ public:
 		}
 	}
 
+	// Culls may run on several threads at once (e.g. batched physics queries),
+	// so their hits are gathered in a list owned by the calling thread.
+	static LocalVector<uint32_t, uint32_t, true> &_get_thread_cull_hits() {
+		static thread_local LocalVector<uint32_t, uint32_t, true> hits;
+		return hits;
+	}
+
 	// cull tests
 	int cull_aabb(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
+		params.hits = &_get_thread_cull_hits();
 
 		params.result_count_overall = 0;
 		params.result_max = p_result_max;
@@ -365,6 +380,7 @@ public:
 	int cull_segment(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
+		params.hits = &_get_thread_cull_hits();
 
 		params.result_count_overall = 0;
 		params.result_max = p_result_max;
@@ -384,6 +400,7 @@ public:
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
+		params.hits = &_get_thread_cull_hits();
 
 		params.result_count_overall = 0;
 		params.result_max = p_result_max;
@@ -410,6 +427,7 @@ public:
 		}
 
 		typename BVHTREE_CLASS::CullParams params;
+		params.hits = &_get_thread_cull_hits();
 		params.result_count_overall = 0;
 		params.result_max = p_result_max;
 		params.result_array = p_result_array;
@@ -444,7 +462,19 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
-		for (const BVHHandle &h : changed_items) {
+		// The tree doesn't change while pairing, so the culls can all be done up front.
+		bool parallel = _parallel_pairing && changed_items.size() >= PARALLEL_PAIRING_MIN_ITEMS;
+		if (parallel) {
+			if (_changed_item_hits.size() < changed_items.size()) {
+				_changed_item_hits.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, nullptr, changed_items.size(), -1, true, SNAME("BVHPairingCull"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
+		for (uint32_t i = 0; i < changed_items.size(); i++) {
+			const BVHHandle &h = changed_items[i];
+
 			// use the expanded aabb for pairing
 			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
 			BVHABB_CLASS abb;
@@ -458,12 +488,14 @@ private:
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			if (!parallel) {
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+			}
 
-			for (const uint32_t ref_id : tree._cull_hits) {
+			for (const uint32_t ref_id : parallel ? _changed_item_hits[i] : tree._cull_hits) {
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
 					continue;
@@ -480,6 +512,21 @@ private:
 		_reset();
 	}
 
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &_changed_item_hits[p_index];
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+		tree.cull_aabb(params, false);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +820,11 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Below this, culling on the calling thread is cheaper than dispatching to workers.
+	static constexpr uint32_t PARALLEL_PAIRING_MIN_ITEMS = 128;
+	bool _parallel_pairing = false;
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> _changed_item_hits;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
@@ -289,6 +289,8 @@ void DynamicBVH::clear() {
 	}
 	lkhd = -1;
 	opath = 0;
+	refit_levels.clear();
+	refits_since_rebuild = 0;
 }
 
 void DynamicBVH::optimize_bottom_up() {
@@ -371,6 +373,19 @@ bool DynamicBVH::update(const ID &p_id, const AABB &p_box) {
 		return false;
 	}
 
+	if (leaf->parent && leaf->parent->volume.contains(volume)) {
+		// Still inside its parent, only the ancestors' volumes may shrink, no need to reinsert.
+		leaf->volume = volume;
+		for (Node *node = leaf->parent; node; node = node->parent) {
+			const Volume previous = node->volume;
+			node->volume = node->children[0]->volume.merge(node->children[1]->volume);
+			if (!previous.is_not_equal_to(node->volume)) {
+				break;
+			}
+		}
+		return true;
+	}
+
 	Node *base = _remove_leaf(leaf);
 	if (base) {
 		if (lkhd >= 0) {
@@ -386,6 +401,55 @@ bool DynamicBVH::update(const ID &p_id, const AABB &p_box) {
 	return true;
 }
 
+void DynamicBVH::refit(const ID &p_id, const AABB &p_box) {
+	ERR_FAIL_COND(!p_id.is_valid());
+	Node *leaf = p_id.node;
+
+	leaf->volume.min = p_box.position;
+	leaf->volume.max = p_box.position + p_box.size;
+	refits_since_rebuild++;
+
+	Node *parent = leaf->parent;
+	if (!parent || parent->refit_pass == refit_pass) {
+		return;
+	}
+	parent->refit_pass = refit_pass;
+
+	uint32_t depth = 0;
+	for (const Node *node = parent->parent; node; node = node->parent) {
+		depth++;
+	}
+	if (refit_levels.size() <= depth) {
+		refit_levels.resize(depth + 1);
+	}
+	refit_levels[depth].push_back(parent);
+}
+
+void DynamicBVH::finish_refit() {
+	// Deepest nodes first, so every node is recomputed once and only after all of its children.
+	for (int64_t depth = int64_t(refit_levels.size()) - 1; depth >= 0; depth--) {
+		LocalVector<Node *> &level = refit_levels[depth];
+		for (Node *node : level) {
+			const Volume previous = node->volume;
+			node->volume = node->children[0]->volume.merge(node->children[1]->volume);
+			Node *parent = node->parent;
+			if (parent && parent->refit_pass != refit_pass && previous.is_not_equal_to(node->volume)) {
+				parent->refit_pass = refit_pass;
+				refit_levels[depth - 1].push_back(parent);
+			}
+		}
+		level.clear();
+	}
+	if (++refit_pass == 0) {
+		refit_pass = 1; // Freshly allocated nodes use zero.
+	}
+
+	if (refits_since_rebuild > uint32_t(total_leaves) * REFIT_REBUILD_RATIO) {
+		optimize_top_down(REFIT_REBUILD_BU_THRESHOLD);
+		refits_since_rebuild = 0;
+	}
+}
+
 void DynamicBVH::remove(const ID &p_id) {
 	ERR_FAIL_COND(!p_id.is_valid());
 	Node *leaf = p_id.node;
@@ -135,22 +135,25 @@ private:
 					(max.z >= b.min.z));
 		}
 
-		_FORCE_INLINE_ bool intersects_convex(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count) const {
-			Vector3 half_extents = (max - min) * 0.5;
-			Vector3 ofs = min + half_extents;
+		// p_plane_signs holds, per plane and axis, whether the normal is positive, so the corner
+		// closest to the inside of each plane can be picked without branching on the normal.
+		_FORCE_INLINE_ bool intersects_convex(const Plane *p_planes, const uint8_t (*p_plane_signs)[3], int p_plane_count, const Vector3 *p_points, int p_point_count) const {
+			const Vector3 *bounds[2] = { &max, &min };
 
 			for (int i = 0; i < p_plane_count; i++) {
 				const Plane &p = p_planes[i];
-				Vector3 point(
-						(p.normal.x > 0) ? -half_extents.x : half_extents.x,
-						(p.normal.y > 0) ? -half_extents.y : half_extents.y,
-						(p.normal.z > 0) ? -half_extents.z : half_extents.z);
-				point += ofs;
+				const Vector3 point(
+						bounds[p_plane_signs[i][0]]->x,
+						bounds[p_plane_signs[i][1]]->y,
+						bounds[p_plane_signs[i][2]]->z);
 				if (p.is_point_over(point)) {
 					return false;
 				}
 			}
 
+			Vector3 half_extents = (max - min) * 0.5;
+			Vector3 ofs = min + half_extents;
+
 			// Make sure all points in the shape aren't fully separated from the AABB on
 			// each axis.
 			int bad_point_counts_positive[3] = { 0 };
@@ -185,6 +188,7 @@ private:
 			Node *children[2];
 			void *data;
 		};
+		uint32_t refit_pass = 0;
 
 		_FORCE_INLINE_ bool is_leaf() const { return children[1] == nullptr; }
 		_FORCE_INLINE_ bool is_internal() const { return (!is_leaf()); }
@@ -229,8 +233,16 @@ private:
 	uint32_t opath = 0;
 	uint32_t index = 0;
 
+	// Refitted nodes waiting for finish_refit(), bucketed by depth so each is recomputed once, children first.
+	LocalVector<LocalVector<Node *>> refit_levels;
+	uint32_t refit_pass = 1;
+	uint32_t refits_since_rebuild = 0;
+
 	enum {
-		ALLOCA_STACK_SIZE = 128
+		ALLOCA_STACK_SIZE = 128,
+		// Refitting never restructures the tree, rebuild it once the equivalent of this many full refits happened.
+		REFIT_REBUILD_RATIO = 32,
+		REFIT_REBUILD_BU_THRESHOLD = 8,
 	};
 
 	_FORCE_INLINE_ void _delete_node(Node *p_node);
@@ -293,6 +305,10 @@ public:
 	void optimize_incremental(int passes);
 	ID insert(const AABB &p_box, void *p_userdata);
 	bool update(const ID &p_id, const AABB &p_box);
+	// Moves a leaf without restructuring the tree, for many leaves moving by small amounts at once.
+	// Ancestors are recomputed by finish_refit(), the tree must not be queried or modified in between.
+	void refit(const ID &p_id, const AABB &p_box);
+	void finish_refit();
 	void remove(const ID &p_id);
 	void get_elements(List<ID> *r_elements);
 
@@ -381,6 +397,13 @@ void DynamicBVH::convex_query(const Plane *p_planes, int p_plane_count, const Ve
 		}
 	}
 
+	uint8_t(*plane_signs)[3] = (uint8_t(*)[3])alloca(sizeof(uint8_t[3]) * MAX(p_plane_count, 1));
+	for (int i = 0; i < p_plane_count; i++) {
+		plane_signs[i][0] = p_planes[i].normal.x > 0 ? 1 : 0;
+		plane_signs[i][1] = p_planes[i].normal.y > 0 ? 1 : 0;
+		plane_signs[i][2] = p_planes[i].normal.z > 0 ? 1 : 0;
+	}
+
 	const Node **alloca_stack = (const Node **)alloca(ALLOCA_STACK_SIZE * sizeof(const Node *));
 	const Node **stack = alloca_stack;
 	stack[0] = bvh_root;
@@ -392,7 +415,7 @@ void DynamicBVH::convex_query(const Plane *p_planes, int p_plane_count, const Ve
 	do {
 		depth--;
 		const Node *n = stack[depth];
-		if (n->volume.intersects(volume) && n->volume.intersects_convex(p_planes, p_plane_count, p_points, p_point_count)) {
+		if (n->volume.intersects(volume) && n->volume.intersects_convex(p_planes, plane_signs, p_plane_count, p_points, p_point_count)) {
 			if (n->is_internal()) {
 				if (depth > threshold) {
 					if (aux_stack.is_empty()) {
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1232,239 +1233,442 @@ bool Expression::_compile_expression() {
 			memdelete(nodes);
 		}
 		nodes = nullptr;
+		_compile_bytecode();
 		return true;
 	}
 
+	_compile_bytecode();
 	expression_dirty = false;
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+// Validated evaluators skip the checks reporting division by zero, negative shifts, invalid string formats and freed objects.
+static bool _can_validate_operator(Variant::Operator p_op, Variant::Type p_type_a, Variant::Type p_type_b) {
+	if (p_type_a == Variant::OBJECT || p_type_b == Variant::OBJECT) {
+		return false;
+	}
+
+	bool integer_b = p_type_b == Variant::INT || p_type_b == Variant::VECTOR2I || p_type_b == Variant::VECTOR3I || p_type_b == Variant::VECTOR4I;
+	switch (p_op) {
+		case Variant::OP_SHIFT_LEFT:
+		case Variant::OP_SHIFT_RIGHT:
+			return false;
+		case Variant::OP_DIVIDE:
+			return !integer_b;
+		case Variant::OP_MODULE:
+			return !integer_b && p_type_a != Variant::STRING && p_type_a != Variant::STRING_NAME;
+		default:
+			return true;
+	}
+}
+
+int32_t Expression::_add_constant(const Variant &p_value) {
+	constants.push_back(p_value);
+	return (ADDR_TYPE_CONSTANT << ADDR_BITS) | int32_t(constants.size() - 1);
+}
+
+int32_t Expression::_add_register() {
+	registers.push_back(Variant());
+	return (ADDR_TYPE_REGISTER << ADDR_BITS) | int32_t(registers.size() - 1);
+}
+
+int32_t Expression::_compile_node(ENode *p_node) {
 	switch (p_node->type) {
 		case Expression::ENode::TYPE_INPUT: {
 			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
-				return true;
-			}
-			r_ret = p_inputs[in->index];
-		} break;
+			input_count = MAX(input_count, in->index + 1);
+			return (ADDR_TYPE_INPUT << ADDR_BITS) | in->index;
+		}
 		case Expression::ENode::TYPE_CONSTANT: {
 			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
-
-		} break;
+			return _add_constant(c->value);
+		}
 		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
-			}
-			r_ret = p_instance;
-		} break;
+			uses_self = true;
+			return ADDR_TYPE_SELF << ADDR_BITS;
+		}
 		case Expression::ENode::TYPE_OPERATOR: {
 			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
 
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant b;
+			int32_t a = _compile_node(op->nodes[0]);
+			int32_t b = op->nodes[1] ? _compile_node(op->nodes[1]) : _add_constant(Variant());
 
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
+			if ((a >> ADDR_BITS) == ADDR_TYPE_CONSTANT && (b >> ADDR_BITS) == ADDR_TYPE_CONSTANT) {
+				// Fold operations on constants, invalid ones are left to fail when executed.
+				bool valid = true;
+				Variant folded;
+				Variant::evaluate(op->op, constants[a & ADDR_MASK], constants[b & ADDR_MASK], folded, valid);
+				if (valid && folded.get_type() < Variant::OBJECT) {
+					return _add_constant(folded);
 				}
 			}
 
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
-			}
-
-		} break;
+			OperatorCache cache;
+			cache.op = op->op;
+			operator_caches.push_back(cache);
+
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_OPERATOR);
+			code.push_back(a);
+			code.push_back(b);
+			code.push_back(dst);
+			code.push_back(operator_caches.size() - 1);
+			return dst;
+		}
 		case Expression::ENode::TYPE_INDEX: {
 			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			Variant idx;
-
-			ret = _execute(p_inputs, p_instance, index->index, idx, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
-
-			bool valid;
-			r_ret = base.get(idx, &valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
-				return true;
-			}
+			int32_t base = _compile_node(index->base);
+			int32_t idx = _compile_node(index->index);
 
-		} break;
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_GET_INDEX);
+			code.push_back(base);
+			code.push_back(idx);
+			code.push_back(dst);
+			return dst;
+		}
 		case Expression::ENode::TYPE_NAMED_INDEX: {
 			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, p_const_calls_only, r_error_str);
-			if (ret) {
-				return true;
-			}
+			int32_t base = _compile_node(index->base);
+			names.push_back(index->name);
 
-			bool valid;
-			r_ret = base.get_named(index->name, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
-				return true;
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_GET_NAMED);
+			code.push_back(base);
+			code.push_back(names.size() - 1);
+			code.push_back(dst);
+			return dst;
+		}
+		case Expression::ENode::TYPE_ARRAY:
+		case Expression::ENode::TYPE_DICTIONARY: {
+			const Vector<ENode *> &elements = p_node->type == Expression::ENode::TYPE_ARRAY ? static_cast<const Expression::ArrayNode *>(p_node)->array : static_cast<const Expression::DictionaryNode *>(p_node)->dict;
+
+			LocalVector<int32_t> args;
+			for (ENode *element : elements) {
+				args.push_back(_compile_node(element));
 			}
 
-		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
+			int32_t dst = _add_register();
+			code.push_back(p_node->type == Expression::ENode::TYPE_ARRAY ? OPCODE_CONSTRUCT_ARRAY : OPCODE_CONSTRUCT_DICTIONARY);
+			code.push_back(args.size());
+			for (int32_t arg : args) {
+				code.push_back(arg);
+			}
+			code.push_back(dst);
+			return dst;
+		}
+		case Expression::ENode::TYPE_CONSTRUCTOR: {
+			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
 
-			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, p_const_calls_only, r_error_str);
+			LocalVector<int32_t> args;
+			bool all_constant = true;
+			for (ENode *argument : constructor->arguments) {
+				args.push_back(_compile_node(argument));
+				all_constant = all_constant && (args[args.size() - 1] >> ADDR_BITS) == ADDR_TYPE_CONSTANT;
+			}
+			call_arguments.resize(MAX(call_arguments.size(), args.size()));
 
-				if (ret) {
-					return true;
+			if (all_constant && constructor->data_type < Variant::OBJECT) {
+				// Value types built from constants can be built once, reference types must be new on every execution.
+				for (uint32_t i = 0; i < args.size(); i++) {
+					call_arguments[i] = &constants[args[i] & ADDR_MASK];
+				}
+				Variant folded;
+				Callable::CallError ce;
+				Variant::construct(constructor->data_type, folded, call_arguments.ptr(), args.size(), ce);
+				if (ce.error == Callable::CallError::CALL_OK) {
+					return _add_constant(folded);
 				}
-				arr[i] = value;
 			}
 
-			r_ret = arr;
-
-		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
-
-			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, p_const_calls_only, r_error_str);
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_CONSTRUCT);
+			code.push_back(constructor->data_type);
+			code.push_back(args.size());
+			for (int32_t arg : args) {
+				code.push_back(arg);
+			}
+			code.push_back(dst);
+			return dst;
+		}
+		case Expression::ENode::TYPE_BUILTIN_FUNC: {
+			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
 
-				if (ret) {
-					return true;
+			LocalVector<int32_t> args;
+			for (ENode *argument : bifunc->arguments) {
+				args.push_back(_compile_node(argument));
+			}
+			call_arguments.resize(MAX(call_arguments.size(), args.size()));
+
+			UtilityFunction function;
+			function.name = bifunc->func;
+			if (Variant::has_utility_function(bifunc->func) && !Variant::is_utility_function_vararg(bifunc->func) && Variant::get_utility_function_argument_count(bifunc->func) == (int)args.size()) {
+				bool typed = true;
+				for (uint32_t i = 0; i < args.size(); i++) {
+					Variant::Type type = Variant::get_utility_function_argument_type(bifunc->func, i);
+					typed = typed && type != Variant::NIL;
+					function.argument_types.push_back(type);
 				}
-
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, p_const_calls_only, r_error_str);
-				if (ret) {
-					return true;
+				if (typed) {
+					function.validated_call = Variant::get_validated_utility_function(bifunc->func);
 				}
+			}
+			utility_functions.push_back(function);
+
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_CALL_UTILITY);
+			code.push_back(utility_functions.size() - 1);
+			code.push_back(args.size());
+			for (int32_t arg : args) {
+				code.push_back(arg);
+			}
+			code.push_back(dst);
+			return dst;
+		}
+		case Expression::ENode::TYPE_CALL: {
+			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
 
-				d[key] = value;
+			int32_t base = _compile_node(call->base);
+			if ((base >> ADDR_BITS) != ADDR_TYPE_REGISTER) {
+				// Calls may modify their base, work on a copy so constants and inputs are left untouched.
+				int32_t copy = _add_register();
+				code.push_back(OPCODE_ASSIGN);
+				code.push_back(base);
+				code.push_back(copy);
+				base = copy;
 			}
 
-			r_ret = d;
-		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
+			LocalVector<int32_t> args;
+			for (ENode *argument : call->arguments) {
+				args.push_back(_compile_node(argument));
+			}
+			call_arguments.resize(MAX(call_arguments.size(), args.size()));
+			names.push_back(call->method);
+
+			int32_t dst = _add_register();
+			code.push_back(OPCODE_CALL);
+			code.push_back(base);
+			code.push_back(names.size() - 1);
+			code.push_back(args.size());
+			for (int32_t arg : args) {
+				code.push_back(arg);
+			}
+			code.push_back(dst);
+			return dst;
+		}
+	}
+	return _add_constant(Variant());
+}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
+void Expression::_compile_bytecode() {
+	code.clear();
+	constants.clear();
+	names.clear();
+	operator_caches.clear();
+	utility_functions.clear();
+	registers.clear();
+	call_arguments.clear();
+	input_count = 0;
+	uses_self = false;
+
+	if (!root) {
+		return;
+	}
 
-			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, p_const_calls_only, r_error_str);
+	int32_t result = _compile_node(root);
+	code.push_back(OPCODE_END);
+	code.push_back(result);
+}
 
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+bool Expression::_execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+	if (input_count > p_inputs.size()) {
+		r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), input_count - 1);
+		return true;
+	}
 
-			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
+	if (uses_self && !p_instance) {
+		r_error_str = RTR("self can't be used because instance is null (not passed)");
+		return true;
+	}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
-				return true;
-			}
+	// Inputs are addressed directly in the array's memory, which read-only arrays don't expose.
+	Array writable_inputs;
+	if (p_inputs.is_read_only()) {
+		writable_inputs = p_inputs.duplicate();
+	}
+	const Array &inputs_array = p_inputs.is_read_only() ? writable_inputs : p_inputs;
 
-		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
+	Variant self = p_instance;
+	const Variant *inputs = input_count ? &inputs_array[0] : nullptr;
+	const int32_t *ip = code.ptr();
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
+#define GET_ADDRESS(m_address) ((m_address >> ADDR_BITS) == ADDR_TYPE_CONSTANT ? &constants[m_address & ADDR_MASK] : ((m_address >> ADDR_BITS) == ADDR_TYPE_REGISTER ? &registers[m_address & ADDR_MASK] : ((m_address >> ADDR_BITS) == ADDR_TYPE_INPUT ? &inputs[m_address & ADDR_MASK] : &self)))
+#define GET_REGISTER(m_address) (&registers[m_address & ADDR_MASK])
 
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, p_const_calls_only, r_error_str);
-				if (ret) {
+	while (true) {
+		switch (ip[0]) {
+			case OPCODE_OPERATOR: {
+				const Variant *a = GET_ADDRESS(ip[1]);
+				const Variant *b = GET_ADDRESS(ip[2]);
+				Variant *dst = GET_REGISTER(ip[3]);
+				OperatorCache &cache = operator_caches[ip[4]];
+
+				if (unlikely(a->get_type() != cache.type_a || b->get_type() != cache.type_b)) {
+					cache.type_a = a->get_type();
+					cache.type_b = b->get_type();
+					cache.return_type = Variant::get_operator_return_type(cache.op, cache.type_a, cache.type_b);
+					// Operators returning any type can't be validated.
+					bool can_validate = cache.return_type != Variant::NIL && _can_validate_operator(cache.op, cache.type_a, cache.type_b);
+					cache.evaluator = can_validate ? Variant::get_validated_operator_evaluator(cache.op, cache.type_a, cache.type_b) : nullptr;
+				}
+
+				if (likely(cache.evaluator)) {
+					if (dst->get_type() != cache.return_type) {
+						VariantInternal::initialize(dst, cache.return_type);
+					}
+					cache.evaluator(a, b, dst);
+				} else {
+					bool valid = true;
+					Variant::evaluate(cache.op, *a, *b, *dst, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(cache.op), Variant::get_type_name(a->get_type()), Variant::get_type_name(b->get_type()));
+						return true;
+					}
+				}
+				ip += 5;
+			} break;
+			case OPCODE_ASSIGN: {
+				*GET_REGISTER(ip[2]) = *GET_ADDRESS(ip[1]);
+				ip += 3;
+			} break;
+			case OPCODE_GET_INDEX: {
+				const Variant *base = GET_ADDRESS(ip[1]);
+				const Variant *idx = GET_ADDRESS(ip[2]);
+
+				bool valid;
+				*GET_REGISTER(ip[3]) = base->get(*idx, &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx->get_type()), Variant::get_type_name(base->get_type()));
 					return true;
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+				ip += 4;
+			} break;
+			case OPCODE_GET_NAMED: {
+				const Variant *base = GET_ADDRESS(ip[1]);
+				const StringName &name = names[ip[2]];
+
+				bool valid;
+				*GET_REGISTER(ip[3]) = base->get_named(name, valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(name), Variant::get_type_name(base->get_type()));
+					return true;
+				}
+				ip += 4;
+			} break;
+			case OPCODE_CONSTRUCT_ARRAY: {
+				int32_t argc = ip[1];
 
-			r_ret = Variant(); //may not return anything
-			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
-				return true;
-			}
+				Array arr;
+				arr.resize(argc);
+				for (int32_t i = 0; i < argc; i++) {
+					arr[i] = *GET_ADDRESS(ip[2 + i]);
+				}
 
-		} break;
-		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+				*GET_REGISTER(ip[2 + argc]) = arr;
+				ip += 3 + argc;
+			} break;
+			case OPCODE_CONSTRUCT_DICTIONARY: {
+				int32_t argc = ip[1];
+
+				Dictionary d;
+				for (int32_t i = 0; i < argc; i += 2) {
+					d[*GET_ADDRESS(ip[2 + i])] = *GET_ADDRESS(ip[3 + i]);
+				}
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
+				*GET_REGISTER(ip[2 + argc]) = d;
+				ip += 3 + argc;
+			} break;
+			case OPCODE_CONSTRUCT: {
+				Variant::Type type = Variant::Type(ip[1]);
+				int32_t argc = ip[2];
+				for (int32_t i = 0; i < argc; i++) {
+					call_arguments[i] = GET_ADDRESS(ip[3 + i]);
+				}
 
-			if (ret) {
-				return true;
-			}
+				Callable::CallError ce;
+				Variant::construct(type, *GET_REGISTER(ip[3 + argc]), call_arguments.ptr(), argc, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(type));
+					return true;
+				}
+				ip += 4 + argc;
+			} break;
+			case OPCODE_CALL_UTILITY: {
+				const UtilityFunction &function = utility_functions[ip[1]];
+				int32_t argc = ip[2];
+				Variant *dst = GET_REGISTER(ip[3 + argc]);
+
+				bool validated = function.validated_call != nullptr;
+				for (int32_t i = 0; i < argc; i++) {
+					call_arguments[i] = GET_ADDRESS(ip[3 + i]);
+					if (validated) {
+						Variant::Type type = call_arguments[i]->get_type();
+						validated = type == function.argument_types[i] || (type == Variant::INT && function.argument_types[i] == Variant::FLOAT);
+					}
+				}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+				if (validated) {
+					function.validated_call(dst, call_arguments.ptr(), argc);
+				} else {
+					*dst = Variant(); //may not return anything
+					Callable::CallError ce;
+					Variant::call_utility_function(function.name, dst, call_arguments.ptr(), argc, ce);
+					if (ce.error != Callable::CallError::CALL_OK) {
+						r_error_str = "Builtin call failed: " + Variant::get_call_error_text(function.name, call_arguments.ptr(), argc, ce);
+						return true;
+					}
+				}
+				ip += 4 + argc;
+			} break;
+			case OPCODE_CALL: {
+				Variant *base = GET_REGISTER(ip[1]);
+				const StringName &method = names[ip[2]];
+				int32_t argc = ip[3];
+				for (int32_t i = 0; i < argc; i++) {
+					call_arguments[i] = GET_ADDRESS(ip[4 + i]);
+				}
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, p_const_calls_only, r_error_str);
+				Callable::CallError ce;
+				if (p_const_calls_only) {
+					base->call_const(method, call_arguments.ptr(), argc, *GET_REGISTER(ip[4 + argc]), ce);
+				} else {
+					base->callp(method, call_arguments.ptr(), argc, *GET_REGISTER(ip[4 + argc]), ce);
+				}
 
-				if (ret) {
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(method));
 					return true;
 				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
-
-			Callable::CallError ce;
-			if (p_const_calls_only) {
-				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			} else {
-				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
-			}
+				ip += 5 + argc;
+			} break;
+			case OPCODE_END: {
+				r_ret = *GET_ADDRESS(ip[1]);
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
+				// Don't keep objects and containers referenced until the next execution.
+				for (Variant &reg : registers) {
+					if (reg.get_type() >= Variant::OBJECT) {
+						reg = Variant();
+					}
+				}
+				return false;
 			}
-
-		} break;
+		}
 	}
-	return false;
+
+#undef GET_ADDRESS
+#undef GET_REGISTER
 }
 
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
@@ -1488,9 +1692,11 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 			memdelete(nodes);
 		}
 		nodes = nullptr;
+		_compile_bytecode();
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile_bytecode();
 	return OK;
 }
 
@@ -1500,7 +1706,7 @@ Variant Expression::execute(const Array &p_inputs, Object *p_base, bool p_show_e
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	bool err = _execute(p_inputs, p_base, output, p_const_calls_only, error_txt);
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
@@ -1510,6 +1716,34 @@ Variant Expression::execute(const Array &p_inputs, Object *p_base, bool p_show_e
 	return output;
 }
 
+Array Expression::execute_batch(const TypedArray<Array> &p_inputs, Object *p_base, bool p_show_error, bool p_const_calls_only) {
+	ERR_FAIL_COND_V_MSG(error_set, Array(), "There was previously a parse error: " + error_str + ".");
+
+	execution_error = false;
+	Array outputs;
+	outputs.resize(p_inputs.size());
+	String error_txt;
+	for (int i = 0; i < p_inputs.size(); i++) {
+		Variant output;
+		bool err = _execute(p_inputs[i], p_base, output, p_const_calls_only, error_txt);
+		if (err) {
+			// Keep the first error, the following inputs are still executed.
+			if (!execution_error) {
+				execution_error = true;
+				error_str = error_txt;
+			}
+			continue;
+		}
+		outputs[i] = output;
+	}
+
+	if (execution_error && p_show_error) {
+		ERR_PRINT(error_str);
+	}
+
+	return outputs;
+}
+
 bool Expression::has_execute_failed() const {
 	return execution_error;
 }
@@ -1521,6 +1755,7 @@ String Expression::get_error_text() const {
 void Expression::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse", "expression", "input_names"), &Expression::parse, DEFVAL(Vector<String>()));
 	ClassDB::bind_method(D_METHOD("execute", "inputs", "base_instance", "show_error", "const_calls_only"), &Expression::execute, DEFVAL(Array()), DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("execute_batch", "inputs", "base_instance", "show_error", "const_calls_only"), &Expression::execute_batch, DEFVAL(Variant()), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("has_execute_failed"), &Expression::has_execute_failed);
 	ClassDB::bind_method(D_METHOD("get_error_text"), &Expression::get_error_text);
 }
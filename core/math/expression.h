@@ -32,6 +32,8 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/typed_array.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -257,7 +259,63 @@ private:
 	Vector<String> input_names;
 
 	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+
+	// The parsed tree is compiled to a flat bytecode, so executing doesn't need to walk the nodes.
+	// Every instruction reads its operands from addresses and writes its result to a register.
+	enum Opcode {
+		OPCODE_OPERATOR, // a, b, dst, operator cache.
+		OPCODE_ASSIGN, // src, dst.
+		OPCODE_GET_INDEX, // base, index, dst.
+		OPCODE_GET_NAMED, // base, name, dst.
+		OPCODE_CONSTRUCT_ARRAY, // argc, args..., dst.
+		OPCODE_CONSTRUCT_DICTIONARY, // argc, args..., dst.
+		OPCODE_CONSTRUCT, // type, argc, args..., dst.
+		OPCODE_CALL_UTILITY, // function, argc, args..., dst.
+		OPCODE_CALL, // base, method name, argc, args..., dst.
+		OPCODE_END, // result.
+	};
+
+	enum AddressType {
+		ADDR_TYPE_CONSTANT,
+		ADDR_TYPE_REGISTER,
+		ADDR_TYPE_INPUT,
+		ADDR_TYPE_SELF,
+	};
+
+	static const int ADDR_BITS = 24;
+	static const int32_t ADDR_MASK = (1 << ADDR_BITS) - 1;
+
+	// Remembers the validated evaluator for the last operand types seen by an operator, as inputs are untyped.
+	struct OperatorCache {
+		Variant::Operator op = Variant::OP_ADD;
+		Variant::Type type_a = Variant::VARIANT_MAX;
+		Variant::Type type_b = Variant::VARIANT_MAX;
+		Variant::Type return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator evaluator = nullptr;
+	};
+
+	struct UtilityFunction {
+		StringName name;
+		// Only set for functions with typed arguments, the validated call is used when the arguments match them.
+		Variant::ValidatedUtilityFunction validated_call = nullptr;
+		LocalVector<Variant::Type> argument_types;
+	};
+
+	LocalVector<int32_t> code;
+	LocalVector<Variant> constants;
+	LocalVector<StringName> names;
+	LocalVector<OperatorCache> operator_caches;
+	LocalVector<UtilityFunction> utility_functions;
+	LocalVector<Variant> registers;
+	LocalVector<const Variant *> call_arguments;
+	int input_count = 0;
+	bool uses_self = false;
+
+	int32_t _add_constant(const Variant &p_value);
+	int32_t _add_register();
+	int32_t _compile_node(ENode *p_node);
+	void _compile_bytecode();
+	bool _execute(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
 
 protected:
 	static void _bind_methods();
@@ -265,6 +323,7 @@ protected:
 public:
 	Error parse(const String &p_expression, const Vector<String> &p_input_names = Vector<String>());
 	Variant execute(const Array &p_inputs = Array(), Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
+	Array execute_batch(const TypedArray<Array> &p_inputs, Object *p_base = nullptr, bool p_show_error = true, bool p_const_calls_only = false);
 	bool has_execute_failed() const;
 	String get_error_text() const;
 
@@ -315,6 +315,110 @@ Vector<Vector<Point2>> Geometry2D::_polypath_offset(const Vector<Point2> &p_poly
 	return polypaths;
 }
 
+static Clipper2Lib::ClipType _get_clip_type(Geometry2D::PolyBooleanOperation p_op) {
+	switch (p_op) {
+		case Geometry2D::OPERATION_UNION:
+			return Clipper2Lib::ClipType::Union;
+		case Geometry2D::OPERATION_DIFFERENCE:
+			return Clipper2Lib::ClipType::Difference;
+		case Geometry2D::OPERATION_INTERSECTION:
+			return Clipper2Lib::ClipType::Intersection;
+		case Geometry2D::OPERATION_XOR:
+			return Clipper2Lib::ClipType::Xor;
+	}
+	return Clipper2Lib::ClipType::Union;
+}
+
+// Converts polygons to Clipper2 paths with a positive winding, so they can be solved together with the NonZero fill rule.
+template <typename TPaths, typename TPoint>
+static TPaths _polygons_to_positive_paths(const Vector<Vector<TPoint>> &p_polygons) {
+	TPaths paths;
+	paths.reserve(p_polygons.size());
+	for (const Vector<TPoint> &polygon : p_polygons) {
+		if (polygon.size() < 3) {
+			continue;
+		}
+		typename TPaths::value_type path;
+		path.reserve(polygon.size());
+		for (const TPoint &point : polygon) {
+			path.emplace_back(point.x, point.y);
+		}
+		if (!Clipper2Lib::IsPositive(path)) {
+			std::reverse(path.begin(), path.end());
+		}
+		paths.push_back(std::move(path));
+	}
+	return paths;
+}
+
+template <typename TPoint, typename TPaths>
+static Vector<Vector<TPoint>> _paths_to_polygons(const TPaths &p_paths) {
+	Vector<Vector<TPoint>> polygons;
+	polygons.resize(p_paths.size());
+	Vector<TPoint> *polygons_ptrw = polygons.ptrw();
+	for (size_t i = 0; i < p_paths.size(); ++i) {
+		const typename TPaths::value_type &path = p_paths[i];
+		Vector<TPoint> &polygon = polygons_ptrw[i];
+		polygon.resize(path.size());
+		TPoint *polygon_ptrw = polygon.ptrw();
+		for (size_t j = 0; j < path.size(); ++j) {
+			polygon_ptrw[j] = TPoint(path[j].x, path[j].y);
+		}
+	}
+	return polygons;
+}
+
+Vector<Vector<Point2>> Geometry2D::_polypaths_do_batch_operation(PolyBooleanOperation p_op, const Vector<Vector<Point2>> &p_subjects, const Vector<Vector<Point2>> &p_clips) {
+	using namespace Clipper2Lib;
+
+	ClipperD clp(PRECISION); // Scale points up internally to attain the desired precision.
+	clp.PreserveCollinear(false); // Remove redundant vertices.
+	clp.AddSubject(_polygons_to_positive_paths<PathsD>(p_subjects));
+	if (!p_clips.is_empty()) {
+		clp.AddClip(_polygons_to_positive_paths<PathsD>(p_clips));
+	}
+
+	PathsD paths;
+	clp.Execute(_get_clip_type(p_op), FillRule::NonZero, paths);
+	return _paths_to_polygons<Point2>(paths);
+}
+
+Vector<Vector<Point2i>> Geometry2D::_polypaths_do_batch_operation(PolyBooleanOperation p_op, const Vector<Vector<Point2i>> &p_subjects, const Vector<Vector<Point2i>> &p_clips) {
+	using namespace Clipper2Lib;
+
+	Clipper64 clp;
+	clp.PreserveCollinear(false); // Remove redundant vertices.
+	clp.AddSubject(_polygons_to_positive_paths<Paths64>(p_subjects));
+	if (!p_clips.is_empty()) {
+		clp.AddClip(_polygons_to_positive_paths<Paths64>(p_clips));
+	}
+
+	Paths64 paths;
+	clp.Execute(_get_clip_type(p_op), FillRule::NonZero, paths);
+	return _paths_to_polygons<Point2i>(paths);
+}
+
+Vector<Vector<Point2>> Geometry2D::offset_many_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, PolyJoinType p_join_type) {
+	using namespace Clipper2Lib;
+
+	JoinType jt = JoinType::Square;
+	switch (p_join_type) {
+		case JOIN_SQUARE:
+			jt = JoinType::Square;
+			break;
+		case JOIN_ROUND:
+			jt = JoinType::Round;
+			break;
+		case JOIN_MITER:
+			jt = JoinType::Miter;
+			break;
+	}
+
+	// Same miter limit, precision and arc tolerance as _polypath_offset().
+	PathsD paths = InflatePaths(_polygons_to_positive_paths<PathsD>(p_polygons), p_delta, jt, EndType::Polygon, 2.0, PRECISION, 0.0);
+	return _paths_to_polygons<Point2>(paths);
+}
+
 Vector<Vector3i> Geometry2D::partial_pack_rects(const Vector<Vector2i> &p_sizes, const Size2i &p_atlas_size) {
 	Vector<stbrp_node> nodes;
 	nodes.resize(p_atlas_size.width);
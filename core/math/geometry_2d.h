@@ -328,6 +328,36 @@ public:
 		return _polypath_offset(p_polygon, p_delta, p_join_type, p_end_type);
 	}
 
+	// Batch versions of the boolean operations, solving for any number of polygons in a single Clipper2 execution.
+	// Each polygon is treated as a solid outline whatever its winding order, so overlapping polygons merge instead of cancelling out.
+	static Vector<Vector<Point2>> merge_many_polygons(const Vector<Vector<Point2>> &p_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_UNION, p_polygons, Vector<Vector<Point2>>());
+	}
+
+	static Vector<Vector<Point2>> clip_many_polygons(const Vector<Vector<Point2>> &p_polygons, const Vector<Vector<Point2>> &p_clip_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_DIFFERENCE, p_polygons, p_clip_polygons);
+	}
+
+	static Vector<Vector<Point2>> intersect_many_polygons(const Vector<Vector<Point2>> &p_polygons, const Vector<Vector<Point2>> &p_clip_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_INTERSECTION, p_polygons, p_clip_polygons);
+	}
+
+	// Offsets all polygons at once, overlapping results are merged.
+	static Vector<Vector<Point2>> offset_many_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, PolyJoinType p_join_type);
+
+	// Integer coordinate versions, which run on Clipper2's native integer paths without any scaling or float conversion.
+	static Vector<Vector<Point2i>> merge_many_polygons(const Vector<Vector<Point2i>> &p_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_UNION, p_polygons, Vector<Vector<Point2i>>());
+	}
+
+	static Vector<Vector<Point2i>> clip_many_polygons(const Vector<Vector<Point2i>> &p_polygons, const Vector<Vector<Point2i>> &p_clip_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_DIFFERENCE, p_polygons, p_clip_polygons);
+	}
+
+	static Vector<Vector<Point2i>> intersect_many_polygons(const Vector<Vector<Point2i>> &p_polygons, const Vector<Vector<Point2i>> &p_clip_polygons) {
+		return _polypaths_do_batch_operation(OPERATION_INTERSECTION, p_polygons, p_clip_polygons);
+	}
+
 	static Vector<int> triangulate_delaunay(const Vector<Vector2> &p_points) {
 		Vector<Delaunay2D::Triangle> tr = Delaunay2D::triangulate(p_points);
 		Vector<int> triangles;
@@ -497,6 +527,8 @@ public:
 private:
 	static Vector<Vector<Point2>> _polypaths_do_operation(PolyBooleanOperation p_op, const Vector<Point2> &p_polypath_a, const Vector<Point2> &p_polypath_b, bool is_a_open = false);
 	static Vector<Vector<Point2>> _polypath_offset(const Vector<Point2> &p_polypath, real_t p_delta, PolyJoinType p_join_type, PolyEndType p_end_type);
+	static Vector<Vector<Point2>> _polypaths_do_batch_operation(PolyBooleanOperation p_op, const Vector<Vector<Point2>> &p_subjects, const Vector<Vector<Point2>> &p_clips);
+	static Vector<Vector<Point2i>> _polypaths_do_batch_operation(PolyBooleanOperation p_op, const Vector<Vector<Point2i>> &p_subjects, const Vector<Vector<Point2i>> &p_clips);
 };
 
 #endif // GEOMETRY_2D_H
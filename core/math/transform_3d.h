@@ -100,6 +100,15 @@ struct [[nodiscard]] Transform3D {
 	_FORCE_INLINE_ Plane xform_fast(const Plane &p_plane, const Basis &p_basis_inverse_transpose) const;
 	static _FORCE_INLINE_ Plane xform_inv_fast(const Plane &p_plane, const Transform3D &p_inverse, const Basis &p_basis_transpose);
 
+	// Batch versions for bottleneck loops, vectorized when real_t is float.
+	// The destination can be the same array as the source.
+	void xform_array(const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) const;
+	void xform_array(const AABB *p_src, AABB *r_dst, uint32_t p_count) const;
+	// Sets r_dst[i] to this * p_src[i].
+	void mul_array(const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) const;
+	// Sets r_dst[i] to p_a[i] * p_b[i].
+	static void mul_batch(const Transform3D *p_a, const Transform3D *p_b, Transform3D *r_dst, uint32_t p_count);
+
 	void operator*=(const Transform3D &p_transform);
 	Transform3D operator*(const Transform3D &p_transform) const;
 	void operator*=(real_t p_val);
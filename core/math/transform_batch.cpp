@@ -0,0 +1,252 @@
+/**************************************************************************/
+/*  transform_batch.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "core/math/aabb.h"
+#include "core/math/basis.h"
+#include "core/math/transform_3d.h"
+
+// SSE2 and NEON are part of the x86_64 and arm64 baselines, so the kernels are picked at compile time.
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRANSFORM_BATCH_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define TRANSFORM_BATCH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(TRANSFORM_BATCH_SSE2) || defined(TRANSFORM_BATCH_NEON)
+#define TRANSFORM_BATCH_SIMD
+
+// Only the first three lanes are meaningful, the last one is free for the origin when composing transforms.
+// Elements are always read as scalars and written three lanes at a time, so nothing reads or writes past
+// the arrays, and writing an element never overwrites a part of it that is still to be read.
+
+#if defined(TRANSFORM_BATCH_SSE2)
+typedef __m128 simd4;
+
+static _FORCE_INLINE_ simd4 simd_set(float p_x, float p_y, float p_z, float p_w = 0.0f) {
+	return _mm_setr_ps(p_x, p_y, p_z, p_w);
+}
+static _FORCE_INLINE_ simd4 simd_splat(float p_value) {
+	return _mm_set1_ps(p_value);
+}
+static _FORCE_INLINE_ simd4 simd_add(simd4 p_a, simd4 p_b) {
+	return _mm_add_ps(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_sub(simd4 p_a, simd4 p_b) {
+	return _mm_sub_ps(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_mul(simd4 p_a, simd4 p_b) {
+	return _mm_mul_ps(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_madd(simd4 p_a, simd4 p_b, simd4 p_c) {
+	return _mm_add_ps(_mm_mul_ps(p_a, p_b), p_c);
+}
+static _FORCE_INLINE_ simd4 simd_abs(simd4 p_a) {
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), p_a);
+}
+static _FORCE_INLINE_ void simd_store3(float *r_dst, simd4 p_a) {
+	_mm_storel_pi(reinterpret_cast<__m64 *>(r_dst), p_a);
+	_mm_store_ss(r_dst + 2, _mm_movehl_ps(p_a, p_a));
+}
+static _FORCE_INLINE_ void simd_store_w(float *r_dst, simd4 p_a) {
+	_mm_store_ss(r_dst, _mm_shuffle_ps(p_a, p_a, _MM_SHUFFLE(3, 3, 3, 3)));
+}
+#else
+typedef float32x4_t simd4;
+
+static _FORCE_INLINE_ simd4 simd_set(float p_x, float p_y, float p_z, float p_w = 0.0f) {
+	const float values[4] = { p_x, p_y, p_z, p_w };
+	return vld1q_f32(values);
+}
+static _FORCE_INLINE_ simd4 simd_splat(float p_value) {
+	return vdupq_n_f32(p_value);
+}
+static _FORCE_INLINE_ simd4 simd_add(simd4 p_a, simd4 p_b) {
+	return vaddq_f32(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_sub(simd4 p_a, simd4 p_b) {
+	return vsubq_f32(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_mul(simd4 p_a, simd4 p_b) {
+	return vmulq_f32(p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_madd(simd4 p_a, simd4 p_b, simd4 p_c) {
+	return vmlaq_f32(p_c, p_a, p_b);
+}
+static _FORCE_INLINE_ simd4 simd_abs(simd4 p_a) {
+	return vabsq_f32(p_a);
+}
+static _FORCE_INLINE_ void simd_store3(float *r_dst, simd4 p_a) {
+	vst1_f32(r_dst, vget_low_f32(p_a));
+	vst1q_lane_f32(r_dst + 2, p_a, 2);
+}
+static _FORCE_INLINE_ void simd_store_w(float *r_dst, simd4 p_a) {
+	vst1q_lane_f32(r_dst, p_a, 3);
+}
+#endif
+
+// Columns of a basis and of its absolute value, as needed to transform AABBs.
+struct SimdAABBXform {
+	simd4 columns[3];
+	simd4 abs_columns[3];
+	simd4 origin;
+
+	_FORCE_INLINE_ SimdAABBXform(const Transform3D &p_xform) {
+		const Basis &b = p_xform.basis;
+		for (int i = 0; i < 3; i++) {
+			columns[i] = simd_set(b.rows[0][i], b.rows[1][i], b.rows[2][i]);
+			abs_columns[i] = simd_abs(columns[i]);
+		}
+		origin = simd_set(p_xform.origin.x, p_xform.origin.y, p_xform.origin.z);
+	}
+
+	_FORCE_INLINE_ void xform(const AABB &p_src, AABB &r_dst) const {
+		// Transforming the center and the extents separately gives the same box as transforming the corners, without branches.
+		const Vector3 extents = p_src.size.abs() * 0.5f;
+		const Vector3 center = p_src.position + p_src.size * 0.5f;
+
+		simd4 new_center = simd_madd(columns[0], simd_splat(center.x), origin);
+		new_center = simd_madd(columns[1], simd_splat(center.y), new_center);
+		new_center = simd_madd(columns[2], simd_splat(center.z), new_center);
+
+		simd4 new_extents = simd_mul(abs_columns[0], simd_splat(extents.x));
+		new_extents = simd_madd(abs_columns[1], simd_splat(extents.y), new_extents);
+		new_extents = simd_madd(abs_columns[2], simd_splat(extents.z), new_extents);
+
+		simd_store3(r_dst.position.coord, simd_sub(new_center, new_extents));
+		simd_store3(r_dst.size.coord, simd_add(new_extents, new_extents));
+	}
+};
+
+static _FORCE_INLINE_ void simd_mul_transform(const Transform3D &p_a, const Transform3D &p_b, Transform3D &r_dst) {
+	// Rows of p_b extended with the origin, so each row of the result comes with its origin component in the last lane.
+	const simd4 b0 = simd_set(p_b.basis.rows[0].x, p_b.basis.rows[0].y, p_b.basis.rows[0].z, p_b.origin.x);
+	const simd4 b1 = simd_set(p_b.basis.rows[1].x, p_b.basis.rows[1].y, p_b.basis.rows[1].z, p_b.origin.y);
+	const simd4 b2 = simd_set(p_b.basis.rows[2].x, p_b.basis.rows[2].y, p_b.basis.rows[2].z, p_b.origin.z);
+
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &a_row = p_a.basis.rows[i];
+		simd4 row = simd_madd(simd_splat(a_row.x), b0, simd_set(0.0f, 0.0f, 0.0f, p_a.origin.coord[i]));
+		row = simd_madd(simd_splat(a_row.y), b1, row);
+		row = simd_madd(simd_splat(a_row.z), b2, row);
+		simd_store3(r_dst.basis.rows[i].coord, row);
+		simd_store_w(&r_dst.origin.coord[i], row);
+	}
+}
+#endif // TRANSFORM_BATCH_SIMD
+
+void Transform3D::xform_array(const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) const {
+#ifdef TRANSFORM_BATCH_SIMD
+	const simd4 c0 = simd_set(basis.rows[0].x, basis.rows[1].x, basis.rows[2].x);
+	const simd4 c1 = simd_set(basis.rows[0].y, basis.rows[1].y, basis.rows[2].y);
+	const simd4 c2 = simd_set(basis.rows[0].z, basis.rows[1].z, basis.rows[2].z);
+	const simd4 o = simd_set(origin.x, origin.y, origin.z);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Vector3 &v = p_src[i];
+		simd4 r = simd_madd(c0, simd_splat(v.x), o);
+		r = simd_madd(c1, simd_splat(v.y), r);
+		r = simd_madd(c2, simd_splat(v.z), r);
+		simd_store3(r_dst[i].coord, r);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+#endif
+}
+
+void Transform3D::xform_array(const AABB *p_src, AABB *r_dst, uint32_t p_count) const {
+#ifdef TRANSFORM_BATCH_SIMD
+	const SimdAABBXform simd_xform(*this);
+	for (uint32_t i = 0; i < p_count; i++) {
+		simd_xform.xform(p_src[i], r_dst[i]);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+#endif
+}
+
+void Transform3D::mul_array(const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) const {
+	for (uint32_t i = 0; i < p_count; i++) {
+#ifdef TRANSFORM_BATCH_SIMD
+		simd_mul_transform(*this, p_src[i], r_dst[i]);
+#else
+		r_dst[i] = *this * p_src[i];
+#endif
+	}
+}
+
+void Transform3D::mul_batch(const Transform3D *p_a, const Transform3D *p_b, Transform3D *r_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+#ifdef TRANSFORM_BATCH_SIMD
+		simd_mul_transform(p_a[i], p_b[i], r_dst[i]);
+#else
+		r_dst[i] = p_a[i] * p_b[i];
+#endif
+	}
+}
+
+void Basis::mul_batch(const Basis *p_a, const Basis *p_b, Basis *r_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+#ifdef TRANSFORM_BATCH_SIMD
+		const Basis &a = p_a[i];
+		const Basis &b = p_b[i];
+		const simd4 b0 = simd_set(b.rows[0].x, b.rows[0].y, b.rows[0].z);
+		const simd4 b1 = simd_set(b.rows[1].x, b.rows[1].y, b.rows[1].z);
+		const simd4 b2 = simd_set(b.rows[2].x, b.rows[2].y, b.rows[2].z);
+
+		for (int j = 0; j < 3; j++) {
+			const Vector3 &a_row = a.rows[j];
+			simd4 row = simd_mul(simd_splat(a_row.x), b0);
+			row = simd_madd(simd_splat(a_row.y), b1, row);
+			row = simd_madd(simd_splat(a_row.z), b2, row);
+			simd_store3(r_dst[i].rows[j].coord, row);
+		}
+#else
+		r_dst[i] = p_a[i] * p_b[i];
+#endif
+	}
+}
+
+void AABB::xform_batch(const Transform3D *p_xforms, const AABB *p_src, AABB *r_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+#ifdef TRANSFORM_BATCH_SIMD
+		SimdAABBXform(p_xforms[i]).xform(p_src[i], r_dst[i]);
+#else
+		r_dst[i] = p_xforms[i].xform(p_src[i]);
+#endif
+	}
+}
@@ -119,7 +119,7 @@ Callable create_custom_callable_function_pointer(T *p_instance,
 #endif
 		void (T::*p_method)(P...)) {
 	typedef CallableCustomMethodPointer<T, P...> CCMP; // Messes with memnew otherwise.
-	CCMP *ccmp = memnew(CCMP(p_instance, p_method));
+	CCMP *ccmp = CallableCustom::create<CCMP>(p_instance, p_method);
 #ifdef DEBUG_METHODS_ENABLED
 	ccmp->set_text(p_func_text + 1); // Try to get rid of the ampersand.
 #endif
@@ -171,7 +171,7 @@ Callable create_custom_callable_function_pointer(T *p_instance,
 #endif
 		R (T::*p_method)(P...)) {
 	typedef CallableCustomMethodPointerRet<T, R, P...> CCMP; // Messes with memnew otherwise.
-	CCMP *ccmp = memnew(CCMP(p_instance, p_method));
+	CCMP *ccmp = CallableCustom::create<CCMP>(p_instance, p_method);
 #ifdef DEBUG_METHODS_ENABLED
 	ccmp->set_text(p_func_text + 1); // Try to get rid of the ampersand.
 #endif
@@ -223,7 +223,7 @@ Callable create_custom_callable_function_pointer(T *p_instance,
 #endif
 		R (T::*p_method)(P...) const) {
 	typedef CallableCustomMethodPointerRetC<T, R, P...> CCMP; // Messes with memnew otherwise.
-	CCMP *ccmp = memnew(CCMP(p_instance, p_method));
+	CCMP *ccmp = CallableCustom::create<CCMP>(p_instance, p_method);
 #ifdef DEBUG_METHODS_ENABLED
 	ccmp->set_text(p_func_text + 1); // Try to get rid of the ampersand.
 #endif
@@ -277,7 +277,7 @@ Callable create_custom_callable_static_function_pointer(
 #endif
 		void (*p_method)(P...)) {
 	typedef CallableCustomStaticMethodPointer<P...> CCMP; // Messes with memnew otherwise.
-	CCMP *ccmp = memnew(CCMP(p_method));
+	CCMP *ccmp = CallableCustom::create<CCMP>(p_method);
 #ifdef DEBUG_METHODS_ENABLED
 	ccmp->set_text(p_func_text + 1); // Try to get rid of the ampersand.
 #endif
@@ -323,7 +323,7 @@ Callable create_custom_callable_static_function_pointer(
 #endif
 		R (*p_method)(P...)) {
 	typedef CallableCustomStaticMethodPointerRet<R, P...> CCMP; // Messes with memnew otherwise.
-	CCMP *ccmp = memnew(CCMP(p_method));
+	CCMP *ccmp = CallableCustom::create<CCMP>(p_method);
 #ifdef DEBUG_METHODS_ENABLED
 	ccmp->set_text(p_func_text + 1); // Try to get rid of the ampersand.
 #endif
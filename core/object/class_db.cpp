@@ -65,7 +65,10 @@ ClassDB::APIType ClassDB::get_current_api() {
 	return current_api;
 }
 
-HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+FlatHashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+SafeNumeric<uint32_t> ClassDB::property_cache_version;
+Mutex ClassDB::property_cache_mutex;
+LocalVector<ClassDB::PropertyCache *> ClassDB::retired_property_caches;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
@@ -546,6 +549,21 @@ Object *ClassDB::_instantiate_internal(const StringName &p_class, bool p_require
 	}
 }
 
+Object *(*ClassDB::get_native_creation_func(const StringName &p_class))() {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 Object *ClassDB::instantiate(const StringName &p_class) {
 	return _instantiate_internal(p_class);
 }
@@ -726,6 +744,7 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 	ERR_FAIL_COND_MSG(classes.has(name), "Class '" + String(p_class) + "' already exists.");
 
 	classes[name] = ClassInfo();
+	_invalidate_property_caches();
 	ClassInfo &ti = classes[name];
 	ti.name = name;
 	ti.inherits = p_inherits;
@@ -998,6 +1017,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 	}
 
 	type->constant_map[p_name] = p_constant;
+	_invalidate_property_caches();
 
 	String enum_name = p_enum;
 	if (!enum_name.is_empty()) {
@@ -1237,6 +1257,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 #endif
 
 	type->signal_map[sname] = p_signal;
+	_invalidate_property_caches();
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
@@ -1389,6 +1410,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_invalidate_property_caches();
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -1482,82 +1504,179 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 	return false;
 }
 
+void ClassDB::_invalidate_property_caches() {
+	property_cache_version.increment();
+}
+
+const ClassDB::PropertyCache::Entry *ClassDB::_get_property_cache_entry(ClassInfo *p_class, const StringName &p_property) {
+	const uint32_t version = property_cache_version.get();
+	PropertyCache *cache = p_class->property_cache.cache.load(std::memory_order_acquire);
+	if (likely(cache && cache->version == version)) {
+		return cache->entries.getptr(p_property);
+	}
+
+	MutexLock mutex_lock(property_cache_mutex);
+	cache = p_class->property_cache.cache.load(std::memory_order_acquire);
+	if (!cache || cache->version != version) {
+		PropertyCache *new_cache = memnew(PropertyCache);
+		new_cache->version = version;
+
+		// Mirrors the lookup order of get_property(): at each level properties come first, then constants, methods and signals.
+		HashSet<StringName> shadowing;
+		for (ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+			for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+				if (!new_cache->entries.has(E.key)) {
+					PropertyCache::Entry entry;
+					entry.setget = &E.value;
+					entry.shadowed_for_get = shadowing.has(E.key);
+					new_cache->entries.insert(E.key, entry);
+				}
+			}
+			for (const KeyValue<StringName, int64_t> &E : check->constant_map) {
+				shadowing.insert(E.key);
+			}
+			for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+				shadowing.insert(E.key);
+			}
+			for (const KeyValue<StringName, MethodInfo> &E : check->signal_map) {
+				shadowing.insert(E.key);
+			}
+		}
+
+		// Other threads may still be reading the outdated cache, it's only freed on cleanup.
+		if (cache) {
+			retired_property_caches.push_back(cache);
+		}
+		p_class->property_cache.cache.store(new_cache, std::memory_order_release);
+		cache = new_cache;
+	}
+	return cache->entries.getptr(p_property);
+}
+
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
+	if (!type) {
+		return false;
+	}
+
+	const PropertyCache::Entry *entry = _get_property_cache_entry(type, p_property);
+	if (!entry) {
+		return false;
+	}
+
+	if (!entry->setget->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return true; //return true but do nothing
+	}
+
+	set_property_with_setget(p_object, entry->setget, p_value, r_valid);
+	return true;
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *check = classes.getptr(p_class);
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
-
-			Callable::CallError ce;
+			return psg->setter ? psg : nullptr;
+		}
+		check = check->inherits_ptr;
+	}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+	return nullptr;
+}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+void ClassDB::set_property_with_setget(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid) {
+	Callable::CallError ce;
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 2, ce);
+		}
 
-			return true;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(p_setget->setter, arg, 1, ce);
 		}
+	}
+
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
 
+const ClassDB::PropertySetGet *ClassDB::get_property_getter_setget(const StringName &p_class, const StringName &p_property) {
+	OBJTYPE_RLOCK;
+
+	// Mirrors the lookup order of get_property(), so a constant, method or signal shadowing the property resolves to nothing.
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
 		check = check->inherits_ptr;
 	}
 
-	return false;
+	return nullptr;
+}
+
+void ClassDB::get_property_with_setget(Object *p_object, const PropertySetGet *p_setget, Variant &r_value) {
+	if (!p_setget->getter) {
+		return; // Write-only property, leave the value untouched.
+	}
+
+	Callable::CallError ce;
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[1] = { &index };
+		r_value = p_object->callp(p_setget->getter, arg, 1, ce);
+	} else if (p_setget->_getptr) {
+		r_value = p_setget->_getptr->call(p_object, nullptr, 0, ce);
+	} else {
+		r_value = p_object->callp(p_setget->getter, nullptr, 0, ce);
+	}
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	bool has_property = false;
+	if (type) {
+		const PropertyCache::Entry *entry = _get_property_cache_entry(type, p_property);
+		if (entry && !entry->shadowed_for_get) {
+			get_property_with_setget(p_object, entry->setget, r_value);
+			return true;
+		}
+		has_property = entry != nullptr;
+	}
+
 	ClassInfo *check = type;
 	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				r_value = p_object->callp(psg->getter, arg, 1, ce);
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					r_value = p_object->callp(psg->getter, nullptr, 0, ce);
-				}
+		if (has_property) {
+			const PropertySetGet *psg = check->property_setget.getptr(p_property);
+			if (psg) {
+				get_property_with_setget(p_object, psg, r_value);
+				return true;
 			}
-			return true;
 		}
 
 		const int64_t *c = check->constant_map.getptr(p_property); //constants count
@@ -1766,6 +1885,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_invalidate_property_caches();
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
@@ -1792,6 +1912,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
 	type->method_map[p_name] = bind;
+	_invalidate_property_caches();
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1850,6 +1971,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		_invalidate_property_caches();
 	}
 
 	Vector<Variant> defvals;
@@ -2136,6 +2258,7 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 #endif
 
 	classes[p_extension->class_name] = c;
+	_invalidate_property_caches();
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
@@ -2147,6 +2270,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 		}
 	}
 	classes.erase(p_class);
+	_invalidate_property_caches();
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
 #ifdef TOOLS_ENABLED
@@ -2202,6 +2326,10 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+	for (PropertyCache *cache : retired_property_caches) {
+		memdelete(cache);
+	}
+	retired_property_caches.clear();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
@@ -38,8 +38,10 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/hash_set.h"
 
+#include <atomic>
 #include <type_traits>
 
 #define DEFVAL(m_defval) (m_defval)
@@ -97,6 +99,39 @@ public:
 		Variant::Type type;
 	};
 
+	// Flattened view of the properties of a class and all of its ancestors, built on first use by
+	// set_property() and get_property() so they don't need to walk the inheritance chain.
+	struct PropertyCache {
+		struct Entry {
+			const PropertySetGet *setget = nullptr;
+			bool shadowed_for_get = false; // A constant, method or signal of a more derived class has the same name.
+		};
+
+		uint32_t version = 0;
+		HashMap<StringName, Entry> entries;
+	};
+
+	// Copies of a ClassInfo start without a cache.
+	struct PropertyCacheRef {
+		std::atomic<PropertyCache *> cache = { nullptr };
+
+		PropertyCacheRef() {}
+		PropertyCacheRef(const PropertyCacheRef &p_other) {}
+		PropertyCacheRef &operator=(const PropertyCacheRef &p_other) {
+			_free();
+			return *this;
+		}
+		~PropertyCacheRef() { _free(); }
+
+	private:
+		void _free() {
+			PropertyCache *current = cache.exchange(nullptr);
+			if (current) {
+				memdelete(current);
+			}
+		}
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -126,6 +161,7 @@ public:
 		HashMap<StringName, List<StringName>> linked_properties;
 #endif
 		HashMap<StringName, PropertySetGet> property_setget;
+		PropertyCacheRef property_cache;
 
 		StringName inherits;
 		StringName name;
@@ -146,7 +182,13 @@ public:
 	}
 
 	static RWLock lock;
-	static HashMap<StringName, ClassInfo> classes;
+	static FlatHashMap<StringName, ClassInfo> classes;
+	static SafeNumeric<uint32_t> property_cache_version;
+	static Mutex property_cache_mutex;
+	static LocalVector<PropertyCache *> retired_property_caches;
+
+	static const PropertyCache::Entry *_get_property_cache_entry(ClassInfo *p_class, const StringName &p_property);
+	static void _invalidate_property_caches();
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -291,6 +333,8 @@ public:
 	static bool is_virtual(const StringName &p_class);
 	static Object *instantiate(const StringName &p_class);
 	static Object *instantiate_no_placeholders(const StringName &p_class);
+	// Returns the function instantiate() ends up calling, if it can be called directly, so it can be cached.
+	static Object *(*get_native_creation_func(const StringName &p_class))();
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -418,6 +462,11 @@ public:
 	static bool get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance = false, const Object *p_validator = nullptr);
 	static void get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance = false);
 	static bool set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid = nullptr);
+	// For callers caching the setter of a property, only valid for objects without a script instance or extension.
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+	static void set_property_with_setget(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid = nullptr);
+	static const PropertySetGet *get_property_getter_setget(const StringName &p_class, const StringName &p_property);
+	static void get_property_with_setget(Object *p_object, const PropertySetGet *p_setget, Variant &r_value);
 	static bool get_property(Object *p_object, const StringName &p_property, Variant &r_value);
 	static bool has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance = false);
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
@@ -37,6 +37,7 @@
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
 #include "core/templates/local_vector.h"
@@ -813,6 +814,11 @@ Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_
 	return ret;
 }
 
+Variant Object::call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	OBJ_DEBUG_LOCK
+	return p_method->call(this, p_args, p_argcount, r_error);
+}
+
 Variant Object::call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
@@ -1134,31 +1140,36 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
+	if (!s->emit_list) {
+		s->emit_list = memnew(SignalData::EmitList);
+		s->emit_list->refcount.init();
+		s->emit_list->slots.reserve(s->slot_map.size());
+		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
+			s->emit_list->slots.push_back({ slot_kv.value.conn.callable, slot_kv.value.conn.flags });
+			s->emit_list->has_one_shot |= (slot_kv.value.conn.flags & CONNECT_ONE_SHOT) != 0;
+		}
 	}
 
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. Changing connections replaces the list instead of modifying it.
+	SignalData::EmitList *emit_list = s->emit_list;
+	emit_list->refcount.ref();
+	const SignalData::EmitList::EmitSlot *slots = emit_list->slots.ptr();
+	uint32_t slot_count = emit_list->slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+	if (emit_list->has_one_shot) {
+		for (uint32_t i = 0; i < slot_count; ++i) {
+			bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-			disconnect = false;
-		}
+			if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+				disconnect = false;
+			}
 #endif
-		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			if (disconnect) {
+				_disconnect(p_name, slots[i].callable);
+			}
 		}
 	}
 
@@ -1167,8 +1178,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots[i].callable;
+		const uint32_t &flags = slots[i].flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1204,8 +1215,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	if (emit_list->refcount.unref()) {
+		memdelete(emit_list);
 	}
 
 	return err;
@@ -1421,6 +1432,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->invalidate_emit_list();
 
 	return OK;
 }
@@ -1478,6 +1490,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->invalidate_emit_list();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2129,15 +2142,26 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
-	spin_lock.lock();
+	for (Shard &shard : shards) {
+		shard.spin_lock.lock();
+	}
+
+	block_lock.lock();
+	uint32_t blocks = block_count;
+	block_lock.unlock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
-			count--;
+	for (uint32_t i = 0; i < blocks; i++) {
+		ObjectSlot *block = slot_blocks[i].load(std::memory_order_relaxed);
+		for (uint32_t j = 0; j < OBJECTDB_SLOT_BLOCK_SIZE; j++) {
+			if (block[j].id.load(std::memory_order_relaxed)) {
+				p_func(block[j].object.load(std::memory_order_relaxed));
+			}
 		}
 	}
-	spin_lock.unlock();
+
+	for (Shard &shard : shards) {
+		shard.spin_lock.unlock();
+	}
 }
 
 #ifdef TOOLS_ENABLED
@@ -2186,46 +2210,75 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 #endif
 
-SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_blocks[OBJECTDB_MAX_BLOCKS] = {};
+uint8_t ObjectDB::block_shards[OBJECTDB_MAX_BLOCKS] = {};
+SpinLock ObjectDB::block_lock;
+uint32_t ObjectDB::block_count = 0;
+ObjectDB::Shard ObjectDB::shards[OBJECTDB_SHARD_COUNT];
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	int count = 0;
+	for (Shard &shard : shards) {
+		shard.spin_lock.lock();
+		count += shard.object_count;
+		shard.spin_lock.unlock();
+	}
+	return count;
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+void ObjectDB::_add_block(Shard &r_shard, uint32_t p_shard_index) {
+	block_lock.lock();
+	if (unlikely(block_count == OBJECTDB_MAX_BLOCKS)) {
+		block_lock.unlock();
+		CRASH_NOW_MSG("Maximum number of object instances reached.");
+	}
+	uint32_t block_index = block_count++;
+	block_lock.unlock();
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
-		}
-		slot_max = new_slot_max;
+	ObjectSlot *block = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_BLOCK_SIZE);
+	for (uint32_t i = 0; i < OBJECTDB_SLOT_BLOCK_SIZE; i++) {
+		memnew_placement(&block[i].id, std::atomic<uint64_t>(0));
+		memnew_placement(&block[i].object, std::atomic<Object *>(nullptr));
 	}
+	block_shards[block_index] = p_shard_index;
+	slot_blocks[block_index].store(block, std::memory_order_release);
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	// Enough room to hold every slot the shard owns, so freeing never reallocates.
+	r_shard.free_capacity += OBJECTDB_SLOT_BLOCK_SIZE;
+	r_shard.free_slots = (uint32_t *)memrealloc(r_shard.free_slots, sizeof(uint32_t) * r_shard.free_capacity);
+	// Pushed in reverse, so the lowest slots of the block are used first.
+	uint32_t first_slot = block_index << OBJECTDB_SLOT_BLOCK_BITS;
+	for (uint32_t i = 0; i < OBJECTDB_SLOT_BLOCK_SIZE; i++) {
+		r_shard.free_slots[r_shard.free_count++] = first_slot + OBJECTDB_SLOT_BLOCK_SIZE - 1 - i;
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	uint32_t shard_index = Thread::get_caller_id() % OBJECTDB_SHARD_COUNT;
+	Shard &shard = shards[shard_index];
+
+	shard.spin_lock.lock();
+	if (unlikely(shard.free_count == 0)) {
+		_add_block(shard, shard_index);
+	}
+
+	uint32_t slot = shard.free_slots[--shard.free_count];
+	ObjectSlot &object_slot = slot_blocks[slot >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_relaxed)[slot & OBJECTDB_SLOT_BLOCK_MASK];
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_V_MSG(ObjectID(), "ObjectDB slot is already in use.");
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	// Shards hand out distinct validators by starting at their own index and
+	// stepping by the shard count.
+	do {
+		if (shard.validator_counter == 0) {
+			shard.validator_counter = shard_index;
+		}
+		shard.validator_counter = (shard.validator_counter + OBJECTDB_SHARD_COUNT) & OBJECTDB_VALIDATOR_MASK;
+	} while (unlikely(shard.validator_counter == 0));
+
+	uint64_t id = shard.validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2233,9 +2286,13 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
+	// The object must be visible before the id, see `get_instance()`.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.id.store(id, std::memory_order_release);
 
-	spin_lock.unlock();
+	shard.object_count++;
+
+	shard.spin_lock.unlock();
 
 	return ObjectID(id);
 }
@@ -2243,34 +2300,36 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
+	uint32_t block_index = slot >> OBJECTDB_SLOT_BLOCK_BITS;
+
+	// Slots are returned to the shard owning their block, which may not be the
+	// shard of the calling thread.
+	Shard &shard = shards[block_shards[block_index]];
+	ObjectSlot &object_slot = slot_blocks[block_index].load(std::memory_order_acquire)[slot & OBJECTDB_SLOT_BLOCK_MASK];
 
-	spin_lock.lock();
+	shard.spin_lock.lock();
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+	if (object_slot.id.load(std::memory_order_relaxed) != t) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_COND(object_slot.id.load(std::memory_order_relaxed) != t);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.id.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_relaxed);
 
-	spin_lock.unlock();
+	//set the free slot properly
+	shard.free_slots[shard.free_count++] = slot;
+	shard.object_count--;
+
+	shard.spin_lock.unlock();
 }
 
 void ObjectDB::setup() {
@@ -2278,9 +2337,13 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	spin_lock.lock();
+	uint32_t object_count = 0;
+	for (Shard &shard : shards) {
+		shard.spin_lock.lock();
+		object_count += shard.object_count;
+	}
 
-	if (slot_count > 0) {
+	if (object_count > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -2290,9 +2353,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0; i < block_count * OBJECTDB_SLOT_BLOCK_SIZE; i++) {
+				const ObjectSlot &object_slot = slot_blocks[i >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_relaxed)[i & OBJECTDB_SLOT_BLOCK_MASK];
+				uint64_t id = object_slot.id.load(std::memory_order_relaxed);
+				if (id) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2302,20 +2367,28 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
-
-					count--;
 				}
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < block_count; i++) {
+		memfree(slot_blocks[i].load(std::memory_order_relaxed));
+		slot_blocks[i].store(nullptr, std::memory_order_relaxed);
 	}
+	block_count = 0;
 
-	spin_lock.unlock();
+	for (Shard &shard : shards) {
+		if (shard.free_slots) {
+			memfree(shard.free_slots);
+			shard.free_slots = nullptr;
+		}
+		shard.free_count = 0;
+		shard.free_capacity = 0;
+		shard.object_count = 0;
+		shard.spin_lock.unlock();
+	}
 }
@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -618,9 +619,44 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Flat copy of the slots that emissions iterate. Emissions in progress hold a reference to it, so changing
+		// connections while dispatching only drops the signal's reference instead of copying on every emission.
+		struct EmitList {
+			struct EmitSlot {
+				Callable callable;
+				uint32_t flags = 0;
+			};
+
+			SafeRefCount refcount;
+			LocalVector<EmitSlot> slots;
+			bool has_one_shot = false;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		EmitList *emit_list = nullptr; // Built by the first emission after connections change.
 		bool removable = false;
+
+		void invalidate_emit_list() {
+			if (emit_list) {
+				if (emit_list->refcount.unref()) {
+					memdelete(emit_list);
+				}
+				emit_list = nullptr;
+			}
+		}
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		SignalData &operator=(const SignalData &p_other) {
+			invalidate_emit_list();
+			user = p_other.user;
+			slot_map = p_other.slot_map;
+			removable = p_other.removable;
+			return *this;
+		}
+		~SignalData() { invalidate_emit_list(); }
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -873,6 +909,9 @@ public:
 	void get_method_list(List<MethodInfo> *p_list) const;
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	// Calls a method previously resolved with `ClassDB::get_method()` for this object's class,
+	// skipping the lookups of `callp()`. The caller must ensure the script doesn't define it.
+	Variant call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	virtual Variant call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	template <typename... VarArgs>
@@ -1014,18 +1053,37 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+// Slots are allocated in fixed-size blocks that never move, so lookups can read them without locking.
+#define OBJECTDB_SLOT_BLOCK_BITS 11
+#define OBJECTDB_SLOT_BLOCK_SIZE (1 << OBJECTDB_SLOT_BLOCK_BITS)
+#define OBJECTDB_SLOT_BLOCK_MASK (OBJECTDB_SLOT_BLOCK_SIZE - 1)
+#define OBJECTDB_MAX_BLOCKS (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_BLOCK_BITS))
+#define OBJECTDB_SHARD_COUNT 8
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Full ObjectID of the object in this slot, or 0 when the slot is free.
+		std::atomic<uint64_t> id;
+		std::atomic<Object *> object;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	// Each block belongs to one shard, and each thread allocates from its own
+	// shard, so adding and removing objects on different threads rarely contends.
+	struct alignas(64) Shard {
+		SpinLock spin_lock;
+		uint32_t *free_slots = nullptr;
+		uint32_t free_count = 0;
+		uint32_t free_capacity = 0;
+		uint32_t object_count = 0;
+		uint64_t validator_counter = 0;
+	};
+
+	static std::atomic<ObjectSlot *> slot_blocks[OBJECTDB_MAX_BLOCKS];
+	static uint8_t block_shards[OBJECTDB_MAX_BLOCKS];
+	static SpinLock block_lock;
+	static uint32_t block_count;
+	static Shard shards[OBJECTDB_SHARD_COUNT];
+
+	static void _add_block(Shard &r_shard, uint32_t p_shard_index);
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -1042,22 +1100,27 @@ public:
 
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
-		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
-
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
+		if (unlikely(id == 0)) {
+			return nullptr;
+		}
 
-		spin_lock.lock();
+		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
+		ObjectSlot *block = slot_blocks[slot >> OBJECTDB_SLOT_BLOCK_BITS].load(std::memory_order_acquire);
 
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ERR_FAIL_NULL_V(block, nullptr); // This should never happen unless RID is corrupted.
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &object_slot = block[slot & OBJECTDB_SLOT_BLOCK_MASK];
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused between both loads. Seeing the new
+		// object implies seeing the id reset that preceded it, so check the id again.
+		if (unlikely(object_slot.id.load(std::memory_order_relaxed) != id)) {
+			return nullptr;
+		}
 
 		return object;
 	}
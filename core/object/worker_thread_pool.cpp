@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/timeline_profiler.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
@@ -85,9 +86,19 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 #ifdef THREADS_ENABLED
 	bool low_priority = p_task->low_priority;
+
+	// Tasks run while a low priority one waits stay on its processors too.
+	uint64_t affinity_backup = Thread::get_affinity();
+	if (low_priority && low_priority_affinity_mask && !numa_pinning && affinity_backup != low_priority_affinity_mask) {
+		Thread::set_affinity(low_priority_affinity_mask);
+	}
 #endif
 
+	LocalVector<Dependent> ready_dependents;
+
 	if (p_task->group) {
+		TIMELINE_ZONE("WorkerThreadPool group task");
+
 		// Handling a group
 		bool do_post = false;
 
@@ -118,8 +129,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
-			p_task->group->done_semaphore.post();
+			task_mutex.lock();
 			p_task->group->completed.set_to(true);
+			_take_ready_dependents(p_task->group->dependents, ready_dependents);
+			task_mutex.unlock();
+			p_task->group->done_semaphore.post();
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -136,18 +150,23 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
-		if (p_task->native_func) {
-			p_task->native_func(p_task->native_func_userdata);
-		} else if (p_task->template_userdata) {
-			p_task->template_userdata->callback();
-			memdelete(p_task->template_userdata);
-		} else {
-			p_task->callable.call();
+		{
+			TIMELINE_ZONE("WorkerThreadPool task");
+
+			if (p_task->native_func) {
+				p_task->native_func(p_task->native_func_userdata);
+			} else if (p_task->template_userdata) {
+				p_task->template_userdata->callback();
+				memdelete(p_task->template_userdata);
+			} else {
+				p_task->callable.call();
+			}
 		}
 
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_take_ready_dependents(p_task->dependents, ready_dependents);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -178,14 +197,71 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
+
+	if (Thread::get_affinity() != affinity_backup) {
+		Thread::set_affinity(affinity_backup);
+	}
 #endif
+
+	if (ready_dependents.size()) {
+		_post_ready_dependents(ready_dependents);
+	}
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data, bool p_wait_for_locks) {
+	if (local_tasks_queued.get() == 0) {
+		return nullptr;
+	}
+
+	SelfList<Task> *E = nullptr;
+
+	{
+		MutexLock lock(p_thread_data->local_queue_mutex);
+		E = p_thread_data->local_queue.first();
+		if (E) {
+			p_thread_data->local_queue.remove(E);
+		}
+	}
+
+	// Steal the oldest task of another thread. Busy queues are skipped unless about to sleep, so thieves don't contend with owners.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count && !E; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		if (p_wait_for_locks) {
+			victim.local_queue_mutex.lock();
+		} else if (!victim.local_queue_mutex.try_lock()) {
+			continue;
+		}
+		E = victim.local_queue.last();
+		if (E) {
+			victim.local_queue.remove(E);
+		}
+		victim.local_queue_mutex.unlock();
+	}
+
+	if (!E) {
+		return nullptr;
+	}
+
+	local_tasks_queued.decrement();
+	return E->self();
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
+	TimelineProfiler::set_thread_name("WorkerThreadPool");
+
 	ThreadData *thread_data = (ThreadData *)p_user;
+
+	if (singleton->numa_pinning) {
+		// Spread contiguous ranges of threads over the nodes, so the memory they touch first stays local to them.
+		int node_count = OS::get_singleton()->get_numa_node_count();
+		OS::get_singleton()->pin_current_thread_to_numa_node(thread_data->index * node_count / singleton->threads.size());
+	}
+
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Local and stolen tasks don't need the global lock.
+		Task *task_to_process = singleton->_pop_local_task(thread_data, false);
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 			if (singleton->exit_threads) {
 				return;
@@ -196,8 +272,12 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
 			} else {
-				thread_data->cond_var.wait(lock);
-				DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
+				// Tasks are queued locally before the threads are notified under the global lock, so none can be missed here.
+				task_to_process = singleton->_pop_local_task(thread_data, true);
+				if (!task_to_process) {
+					thread_data->cond_var.wait(lock);
+					DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
+				}
 			}
 		}
 
@@ -227,7 +307,13 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+		if (p_high_priority && caller_pool_thread) {
+			// Spawned from a pool thread, keep it close so it's likely to run on the same thread, unless others steal it.
+			MutexLock lock(caller_pool_thread->local_queue_mutex);
+			caller_pool_thread->local_queue.add(&p_tasks[i]->task_elem);
+			local_tasks_queued.increment();
+			to_process++;
+		} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
 			task_queue.add_last(&p_tasks[i]->task_elem);
 			if (!p_high_priority) {
 				low_priority_threads_used++;
@@ -321,11 +407,60 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
-	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
+uint32_t WorkerThreadPool::_add_dependent(const Vector<TaskID> &p_dependencies, const Dependent &p_dependent) {
+	// Tasks and groups no longer registered have already completed and been waited for.
+	uint32_t pending = 0;
+	for (const TaskID &dependency : p_dependencies) {
+		Task **taskp = tasks.getptr(dependency);
+		if (taskp) {
+			if (!(*taskp)->completed) {
+				(*taskp)->dependents.push_back(p_dependent);
+				pending++;
+			}
+			continue;
+		}
+		Group **groupp = groups.getptr(dependency);
+		if (groupp && !(*groupp)->completed.is_set()) {
+			(*groupp)->dependents.push_back(p_dependent);
+			pending++;
+		}
+	}
+	return pending;
+}
+
+void WorkerThreadPool::_take_ready_dependents(LocalVector<Dependent> &p_dependents, LocalVector<Dependent> &r_ready) {
+	for (const Dependent &dependent : p_dependents) {
+		uint32_t &dependencies_left = dependent.task ? dependent.task->dependencies_left : dependent.group->dependencies_left;
+		DEV_ASSERT(dependencies_left > 0);
+		dependencies_left--;
+		if (dependencies_left == 0) {
+			r_ready.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_ready_dependents(const LocalVector<Dependent> &p_ready) {
+	for (const Dependent &dependent : p_ready) {
+		task_mutex.lock();
+		if (dependent.task) {
+			Task *task = dependent.task;
+			_post_tasks_and_unlock(&task, 1, task->deferred_high_priority);
+		} else {
+			// Copied, since the group may be gone as soon as its last task is processed.
+			LocalVector<Task *> group_tasks = dependent.group->deferred_tasks;
+			bool high_priority = dependent.group->deferred_high_priority;
+			dependent.group->deferred_tasks.clear();
+			_post_tasks_and_unlock(group_tasks.ptr(), group_tasks.size(), high_priority);
+		}
+	}
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -336,15 +471,26 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->dependencies_left = _add_dependent(p_dependencies, { task, nullptr });
 	tasks.insert(id, task);
 
-	_post_tasks_and_unlock(&task, 1, p_high_priority);
+	if (task->dependencies_left) {
+		// Posted by whichever dependency completes last.
+		task->deferred_high_priority = p_high_priority;
+		task_mutex.unlock();
+	} else {
+		_post_tasks_and_unlock(&task, 1, p_high_priority);
+	}
 
 	return id;
 }
 
 WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bool p_high_priority, const String &p_description) {
-	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, Vector<TaskID>());
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
 }
 
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
@@ -472,7 +618,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (!exit_threads && was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || local_tasks_queued.get() > 0) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -491,7 +637,9 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 					}
 				}
 
-				if (singleton->task_queue.first()) {
+				task_to_process = _pop_local_task(p_caller_pool_thread, true);
+
+				if (!task_to_process && singleton->task_queue.first()) {
 					task_to_process = task_queue.first()->self();
 					task_queue.remove(task_queue.first());
 				}
@@ -550,7 +698,7 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	task_mutex.unlock();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -587,21 +735,36 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
+		group->dependencies_left = _add_dependent(p_dependencies, { nullptr, group });
 	}
 
 	groups[id] = group;
 
-	_post_tasks_and_unlock(tasks_posted, p_tasks, p_high_priority);
+	if (group->dependencies_left) {
+		// Posted by whichever dependency completes last.
+		group->deferred_tasks.resize(p_tasks);
+		for (int i = 0; i < p_tasks; i++) {
+			group->deferred_tasks[i] = tasks_posted[i];
+		}
+		group->deferred_high_priority = p_high_priority;
+		task_mutex.unlock();
+	} else {
+		_post_tasks_and_unlock(tasks_posted, p_tasks, p_high_priority);
+	}
 
 	return id;
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, Vector<TaskID>());
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
@@ -643,6 +806,11 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 		group->done_semaphore.wait();
 		_lock_unlockable_mutexes();
 
+		// Unregister before the group can be freed, so dependency lookups never find a dangling entry.
+		task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
+		groups.erase(p_group);
+		task_mutex.unlock();
+
 		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = group->finished.increment(); // fetch happens before inc, so increment later.
 
@@ -653,10 +821,6 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			task_mutex.unlock();
 		}
 	}
-
-	task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
-	groups.erase(p_group);
-	task_mutex.unlock();
 #endif
 }
 
@@ -700,12 +864,14 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_numa_pinning) {
 	ERR_FAIL_COND(threads.size() > 0);
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
 	}
 
+	numa_pinning = p_numa_pinning && OS::get_singleton()->get_numa_node_count() > 1;
+
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
 	threads.resize(p_thread_count);
@@ -754,10 +920,12 @@ void WorkerThreadPool::finish() {
 
 void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_task_with_dependencies", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_with_dependencies, DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task_with_dependencies", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task_with_dependencies, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
@@ -53,6 +53,13 @@ public:
 
 private:
 	struct Task;
+	struct Group;
+
+	// Something waiting for a task or group to complete before being posted.
+	struct Dependent {
+		Task *task = nullptr;
+		Group *group = nullptr;
+	};
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -69,6 +76,12 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+
+		// Dependencies, guarded by the task mutex.
+		uint32_t dependencies_left = 0;
+		bool deferred_high_priority = false;
+		LocalVector<Task *> deferred_tasks; // Posted once dependencies_left reaches zero.
+		LocalVector<Dependent> dependents;
 	};
 
 	struct Task {
@@ -89,6 +102,11 @@ private:
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
 
+		// Dependencies, guarded by the task mutex.
+		uint32_t dependencies_left = 0;
+		bool deferred_high_priority = false;
+		LocalVector<Dependent> dependents;
+
 		void free_template_userdata();
 		Task() :
 				completed(false),
@@ -119,6 +137,10 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 
+		// High priority tasks posted from this thread. The owner takes the newest, other threads steal the oldest.
+		SelfList<Task>::List local_queue;
+		BinaryMutex local_queue_mutex;
+
 		ThreadData() :
 				ready_for_scripting(false),
 				signaled(false),
@@ -145,20 +167,28 @@ private:
 			groups;
 
 	uint32_t max_low_priority_threads = 0;
+	bool numa_pinning = false;
+	uint64_t low_priority_affinity_mask = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	SafeNumeric<uint32_t> local_tasks_queued; // Across all the local queues, to skip looking into them when empty.
 
 	uint64_t last_task = 1;
 
 	static void _thread_function(void *p_user);
 
 	void _process_task(Task *task);
+	Task *_pop_local_task(ThreadData *p_thread_data, bool p_wait_for_locks);
 
 	void _post_tasks_and_unlock(Task **p_tasks, uint32_t p_count, bool p_high_priority);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	uint32_t _add_dependent(const Vector<TaskID> &p_dependencies, const Dependent &p_dependent);
+	void _take_ready_dependents(LocalVector<Dependent> &p_dependents, LocalVector<Dependent> &r_ready);
+	void _post_ready_dependents(const LocalVector<Dependent> &p_ready);
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -166,8 +196,8 @@ private:
 	static thread_local uintptr_t unlockable_mutexes[MAX_UNLOCKABLE_MUTEXES];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies);
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies);
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -202,17 +232,19 @@ protected:
 	static void _bind_methods();
 
 public:
+	// Tasks and groups given as dependencies must complete before the new task starts running. Nothing blocks meanwhile.
 	template <typename C, typename M, typename U>
-	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>()) {
 		typedef TaskUserData<C, M, U> TUD;
 		TUD *ud = memnew(TUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description);
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
 	}
-	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
 
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
@@ -221,16 +253,17 @@ public:
 	void notify_yield_over(TaskID p_task_id);
 
 	template <typename C, typename M, typename U>
-	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>()) {
 		typedef GroupUserData<C, M, U> GroupUD;
 		GroupUD *ud = memnew(GroupUD);
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
 	}
-	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String(), const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -249,7 +282,10 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	// Processors to run low priority tasks on, for example the efficiency cores of hybrid CPUs. Ignored with NUMA pinning.
+	void set_low_priority_affinity_mask(uint64_t p_mask) { low_priority_affinity_mask = p_mask; }
+
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_numa_pinning = false);
 	void finish();
 	WorkerThreadPool();
 	~WorkerThreadPool();
@@ -0,0 +1,53 @@
+/**************************************************************************/
+/*  file_system_watcher.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_SYSTEM_WATCHER_H
+#define FILE_SYSTEM_WATCHER_H
+
+#include "core/error/error_list.h"
+#include "core/string/ustring.h"
+#include "core/templates/vector.h"
+
+// Reports changes below a directory of the host file system, as notified by the OS.
+// Created with OS::create_file_system_watcher(), which returns nullptr on platforms without a backend.
+class FileSystemWatcher {
+public:
+	// Starts watching p_path recursively, replacing any previous watch. p_path is an absolute path.
+	virtual Error watch(const String &p_path) = 0;
+
+	// Appends the absolute paths of files and directories changed since the last call, possibly with duplicates.
+	// Returns false when changes may have been lost (event queue overflow, watch limit reached...), in which case
+	// the whole tree must be rescanned.
+	virtual bool poll_changes(Vector<String> &r_paths) = 0;
+
+	virtual ~FileSystemWatcher() {}
+};
+
+#endif // FILE_SYSTEM_WATCHER_H
@@ -35,6 +35,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,10 +62,24 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_usage[Memory::TAG_MAX];
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_DEFAULT;
+
+Memory::PlatformFunctions Memory::platform_functions;
+size_t Memory::large_pages_threshold = 0;
+
+static _FORCE_INLINE_ bool _use_large_pages(size_t p_bytes, size_t p_threshold, const Memory::PlatformFunctions &p_functions) {
+	return p_threshold > 0 && p_bytes >= p_threshold && p_functions.alloc_large_pages != nullptr;
+}
+
+static _FORCE_INLINE_ size_t _get_large_pages_size(size_t p_bytes, size_t p_page_size) {
+	return (p_bytes + p_page_size - 1) / p_page_size * p_page_size;
+}
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
@@ -72,7 +87,16 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	// Large pages need the header to remember how to free the block.
+	void *mem = nullptr;
+	bool large_pages = prepad && _use_large_pages(p_bytes, large_pages_threshold, platform_functions);
+	if (large_pages) {
+		mem = platform_functions.alloc_large_pages(_get_large_pages_size(p_bytes + DATA_OFFSET, platform_functions.large_page_size));
+		large_pages = mem != nullptr;
+	}
+	if (!large_pages) {
+		mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	}
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
@@ -83,8 +107,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
 		*s = p_bytes;
+		if (large_pages) {
+			*s |= LARGE_PAGES_FLAG;
+		}
 
 #ifdef DEBUG_ENABLED
+		*s |= uint64_t(current_tag) << TAG_SHIFT;
+		tag_usage[current_tag].add(p_bytes);
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
 #endif
@@ -110,28 +139,59 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
+		uint64_t old_size = *s & SIZE_MASK;
+		bool large_pages = *s & LARGE_PAGES_FLAG;
 
+		if (unlikely(large_pages || _use_large_pages(p_bytes, large_pages_threshold, platform_functions))) {
+			if (!large_pages || p_bytes == 0 || p_bytes + DATA_OFFSET > _get_large_pages_size(old_size + DATA_OFFSET, platform_functions.large_page_size)) {
+				// Large page mappings can't be resized, and small blocks growing past the threshold should move to one.
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+				MemoryTagScope tag_scope(Tag(*s >> TAG_SHIFT));
+#endif
+				void *new_memory = nullptr;
+				if (p_bytes > 0) {
+					new_memory = alloc_static(p_bytes, p_pad_align);
+					ERR_FAIL_NULL_V(new_memory, nullptr);
+					memcpy(new_memory, p_memory, MIN(old_size, (uint64_t)p_bytes));
+				}
+				free_static(p_memory, p_pad_align);
+				return new_memory;
+			}
+		}
+
+#ifdef DEBUG_ENABLED
+		// Reallocations stay accounted to the tag of the original allocation.
+		Tag tag = Tag(*s >> TAG_SHIFT);
+		if (p_bytes > old_size) {
+			tag_usage[tag].add(p_bytes - old_size);
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_size);
 			max_usage.exchange_if_greater(new_mem_usage);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			tag_usage[tag].sub(old_size - p_bytes);
+			mem_usage.sub(old_size - p_bytes);
 		}
 #endif
 
-		if (p_bytes == 0) {
+		if (large_pages) {
+			// Still fits in the pages already mapped.
+			*s = p_bytes | LARGE_PAGES_FLAG;
+#ifdef DEBUG_ENABLED
+			*s |= uint64_t(tag) << TAG_SHIFT;
+#endif
+			return p_memory;
+		} else if (p_bytes == 0) {
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
-
 			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
 			*s = p_bytes;
+#ifdef DEBUG_ENABLED
+			*s |= uint64_t(tag) << TAG_SHIFT;
+#endif
 
 			return mem + DATA_OFFSET;
 		}
@@ -160,17 +220,154 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 
-#ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+#ifdef DEBUG_ENABLED
+		tag_usage[*s >> TAG_SHIFT].sub(*s & SIZE_MASK);
+		mem_usage.sub(*s & SIZE_MASK);
 #endif
 
-		free(mem);
+		if (*s & LARGE_PAGES_FLAG) {
+			platform_functions.free_large_pages(mem, _get_large_pages_size((*s & SIZE_MASK) + DATA_OFFSET, platform_functions.large_page_size));
+		} else {
+			free(mem);
+		}
 	} else {
 		free(mem);
 	}
 }
 
+SafeNumeric<uint64_t> FrameArena::frame;
+SafeNumeric<uint64_t> FrameArena::max_frame_usage;
+
+struct FrameArenaData {
+	// Every allocation is preceded by a header, also keeping the alignment.
+	struct Header {
+		FrameArenaData *owner;
+		uint64_t size;
+	};
+
+	static constexpr size_t ALIGN = alignof(max_align_t);
+	static constexpr size_t HEADER_SIZE = (sizeof(Header) + ALIGN - 1) & ~(ALIGN - 1);
+	static constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+
+	// Outgrown blocks start with a pointer to the previous one, and are only freed when rewinding.
+	uint8_t *block = nullptr;
+	size_t block_size = 0;
+	size_t offset = HEADER_SIZE;
+	size_t retired_size = 0;
+
+	SafeNumeric<uint64_t> live;
+	uint64_t frame = 0;
+	uint64_t frame_usage = 0;
+
+	_FORCE_INLINE_ static size_t padded(size_t p_bytes) { return (p_bytes + ALIGN - 1) & ~(ALIGN - 1); }
+
+	void free_retired() {
+		uint8_t *retired = block ? *(uint8_t **)block : nullptr;
+		while (retired) {
+			uint8_t *previous = *(uint8_t **)retired;
+			Memory::free_static(retired);
+			retired = previous;
+		}
+		if (block) {
+			*(uint8_t **)block = nullptr;
+		}
+		retired_size = 0;
+	}
+
+	void grow(size_t p_needed) {
+		// Make the next block large enough to hold everything this frame needed so far, so after rewinding one is enough.
+		size_t size = MAX(MIN_BLOCK_SIZE, MAX(p_needed + HEADER_SIZE, (block_size + retired_size) * 2));
+		uint8_t *new_block = (uint8_t *)Memory::alloc_static(size);
+		CRASH_COND_MSG(!new_block, "Out of memory");
+		*(uint8_t **)new_block = block;
+		retired_size += block_size;
+		block = new_block;
+		block_size = size;
+		offset = HEADER_SIZE;
+	}
+
+	void *alloc(size_t p_bytes) {
+		uint64_t current_frame = FrameArena::frame.get();
+		if (frame != current_frame) {
+			FrameArena::max_frame_usage.exchange_if_greater(frame_usage);
+			frame_usage = 0;
+			frame = current_frame;
+		}
+
+		if (live.get() == 0 && (offset > HEADER_SIZE || retired_size)) {
+			// Everything was freed, start over.
+			free_retired();
+			offset = HEADER_SIZE;
+		}
+
+		size_t needed = HEADER_SIZE + padded(p_bytes);
+		if (offset + needed > block_size) {
+			grow(needed);
+		}
+
+		Header *header = (Header *)(block + offset);
+		header->owner = this;
+		header->size = p_bytes;
+		offset += needed;
+		live.increment();
+
+		frame_usage = MAX(frame_usage, (uint64_t)(retired_size + offset));
+
+		return (uint8_t *)header + HEADER_SIZE;
+	}
+
+	~FrameArenaData() {
+		free_retired();
+		if (block) {
+			Memory::free_static(block);
+		}
+	}
+};
+
+static thread_local FrameArenaData frame_arena;
+
+void *FrameArena::alloc(size_t p_bytes) {
+	return frame_arena.alloc(p_bytes);
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc(p_bytes);
+	}
+
+	FrameArenaData::Header *header = (FrameArenaData::Header *)((uint8_t *)p_memory - FrameArenaData::HEADER_SIZE);
+	FrameArenaData &arena = frame_arena;
+
+	// Growing or shrinking the last allocation of this thread's block can be done in place.
+	uint8_t *end = (uint8_t *)p_memory + FrameArenaData::padded(header->size);
+	if (header->owner == &arena && end == arena.block + arena.offset) {
+		size_t new_offset = arena.offset - FrameArenaData::padded(header->size) + FrameArenaData::padded(p_bytes);
+		if (new_offset <= arena.block_size) {
+			arena.offset = new_offset;
+			header->size = p_bytes;
+			arena.frame_usage = MAX(arena.frame_usage, (uint64_t)(arena.retired_size + arena.offset));
+			return p_memory;
+		}
+	}
+
+	if (p_bytes <= header->size) {
+		return p_memory;
+	}
+
+	void *new_memory = alloc(p_bytes);
+	memcpy(new_memory, p_memory, header->size);
+	free(p_memory);
+	return new_memory;
+}
+
+void FrameArena::free(void *p_ptr) {
+	ERR_FAIL_NULL(p_ptr);
+
+	FrameArenaData::Header *header = (FrameArenaData::Header *)((uint8_t *)p_ptr - FrameArenaData::HEADER_SIZE);
+	header->owner->live.decrement();
+}
+
 uint64_t Memory::get_mem_available() {
 	return -1; // 0xFFFF...
 }
@@ -191,6 +388,15 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_mem_usage_by_tag(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -39,13 +39,39 @@
 #include <type_traits>
 
 class Memory {
+public:
+	// Subsystem an allocation is accounted to, see MemoryTagScope.
+	enum Tag : uint8_t {
+		TAG_DEFAULT,
+		TAG_RENDERING,
+		TAG_TEXTURE,
+		TAG_SCRIPT,
+		TAG_PHYSICS,
+		TAG_NAVIGATION,
+		TAG_AUDIO,
+		TAG_MAX,
+	};
+
+	struct PlatformFunctions {
+		size_t large_page_size = 0;
+		void *(*alloc_large_pages)(size_t p_bytes) = nullptr;
+		void (*free_large_pages)(void *p_ptr, size_t p_bytes) = nullptr;
+	};
+
+private:
+	static PlatformFunctions platform_functions;
+	static size_t large_pages_threshold;
+
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
 
+	static thread_local Tag current_tag;
+
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
 	//             ┌─────────────────┬──┬────────────────┬──┬───────────...
@@ -58,6 +84,12 @@ public:
 	static constexpr size_t ELEMENT_OFFSET = ((SIZE_OFFSET + sizeof(uint64_t)) % alignof(uint64_t) == 0) ? (SIZE_OFFSET + sizeof(uint64_t)) : ((SIZE_OFFSET + sizeof(uint64_t)) + alignof(uint64_t) - ((SIZE_OFFSET + sizeof(uint64_t)) % alignof(uint64_t)));
 	static constexpr size_t DATA_OFFSET = ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t) == 0) ? (ELEMENT_OFFSET + sizeof(uint64_t)) : ((ELEMENT_OFFSET + sizeof(uint64_t)) + alignof(max_align_t) - ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t)));
 
+	// With DEBUG_ENABLED, the tag of an allocation is kept in the top byte of its alloc size.
+	// The bit below it marks allocations mapped to large pages.
+	static constexpr uint64_t TAG_SHIFT = 56;
+	static constexpr uint64_t LARGE_PAGES_FLAG = uint64_t(1) << 55;
+	static constexpr uint64_t SIZE_MASK = LARGE_PAGES_FLAG - 1;
+
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
@@ -65,14 +97,66 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	static uint64_t get_mem_usage_by_tag(Tag p_tag);
+
+	_FORCE_INLINE_ static Tag get_current_tag() { return current_tag; }
+	_FORCE_INLINE_ static void set_current_tag(Tag p_tag) { current_tag = p_tag; }
+
+	// Padded allocations of at least this size are backed by large pages when the platform supports them, 0 disables it.
+	static void set_large_pages_threshold(size_t p_bytes) { large_pages_threshold = p_bytes; }
+	static bool has_large_pages() { return platform_functions.alloc_large_pages != nullptr; }
+
+	static void _set_platform_functions(const PlatformFunctions &p_functions) { platform_functions = p_functions; }
+};
+
+// Accounts the allocations made by the current thread to a subsystem, until it goes out of scope.
+class MemoryTagScope {
+	Memory::Tag previous;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {
+		previous = Memory::get_current_tag();
+		Memory::set_current_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(previous);
+	}
+};
+
+// Bump allocator local to each thread, for short lived memory that is allocated and freed many times per frame.
+// Freeing only counts down the live allocations of the thread that made them. Once none are left, that thread
+// rewinds its arena on its next allocation, so memory must be freed before the thread exits.
+class FrameArena {
+	friend struct FrameArenaData;
+
+	static SafeNumeric<uint64_t> frame;
+	static SafeNumeric<uint64_t> max_frame_usage;
+
+public:
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Called by the main loop at the start of every frame.
+	static void begin_frame() { frame.increment(); }
+	// Most memory any thread took from its arena during a single frame.
+	static uint64_t get_max_frame_usage() { return max_frame_usage.get(); }
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+class FrameArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::alloc(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return FrameArena::realloc(p_ptr, p_memory); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { FrameArena::free(p_ptr); }
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -221,4 +305,12 @@ public:
 	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete(p_allocation); }
 };
 
+template <typename T>
+class FrameArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_allocator(T(p_args...), FrameArenaAllocator); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete_allocator<T, FrameArenaAllocator>(p_allocation); }
+};
+
 #endif // MEMORY_H
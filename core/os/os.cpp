@@ -81,6 +81,19 @@ void OS::add_logger(Logger *p_logger) {
 	}
 }
 
+void OS::set_async_logging(bool p_enabled) {
+	if (_logger) {
+		_logger->set_async(p_enabled);
+	}
+}
+
+// Used on crash paths: writes any queued log records on the calling thread.
+void OS::flush_log_sync() {
+	if (_logger) {
+		_logger->flush_sync();
+	}
+}
+
 String OS::get_identifier() const {
 	return get_name().to_lower();
 }
@@ -645,30 +658,31 @@ String OS::get_benchmark_file() {
 }
 
 void OS::benchmark_begin_measure(const String &p_context, const String &p_what) {
-#ifdef TOOLS_ENABLED
+	MutexLock lock(benchmark_mutex);
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' already exists.", p_context, p_what));
 
 	benchmark_marks_from[mark_key] = OS::get_singleton()->get_ticks_usec();
-#endif
 }
+
 void OS::benchmark_end_measure(const String &p_context, const String &p_what) {
-#ifdef TOOLS_ENABLED
+	MutexLock lock(benchmark_mutex);
 	Pair<String, String> mark_key(p_context, p_what);
 	ERR_FAIL_COND_MSG(!benchmark_marks_from.has(mark_key), vformat("Benchmark key '%s:%s' doesn't exist.", p_context, p_what));
 
 	uint64_t total = OS::get_singleton()->get_ticks_usec() - benchmark_marks_from[mark_key];
 	double total_f = double(total) / double(1000000);
 	benchmark_marks_final[mark_key] = total_f;
-#endif
 }
 
 void OS::benchmark_dump() {
-#ifdef TOOLS_ENABLED
-	if (!use_benchmark) {
+	// The startup trace is also printed in verbose mode, so it can be checked without a dedicated run.
+	if (!use_benchmark && !is_stdout_verbose()) {
 		return;
 	}
 
+	MutexLock lock(benchmark_mutex);
+
 	if (!benchmark_file.is_empty()) {
 		Ref<FileAccess> f = FileAccess::open(benchmark_file, FileAccess::WRITE);
 		if (f.is_valid()) {
@@ -682,7 +696,9 @@ void OS::benchmark_dump() {
 			json.instantiate();
 			f->store_string(json->stringify(benchmark_marks, "\t", false, true));
 		}
-	} else {
+	}
+
+	if (benchmark_file.is_empty() || is_stdout_verbose()) {
 		HashMap<String, String> results;
 		for (const KeyValue<Pair<String, String>, double> &E : benchmark_marks_final) {
 			if (E.key.first == "Startup" && !results.has(E.key.first)) {
@@ -697,7 +713,6 @@ void OS::benchmark_dump() {
 			print_line(vformat("\t[%s]\n%s", E.key, E.value));
 		}
 	}
-#endif
 }
 
 OS::OS() {
@@ -35,6 +35,8 @@
 #include "core/io/image.h"
 #include "core/io/logger.h"
 #include "core/io/remote_filesystem_client.h"
+#include "core/os/file_system_watcher.h"
+#include "core/os/mutex.h"
 #include "core/os/time_enums.h"
 #include "core/string/ustring.h"
 #include "core/templates/list.h"
@@ -81,6 +83,7 @@ class OS {
 	// For tracking benchmark data
 	bool use_benchmark = false;
 	String benchmark_file;
+	Mutex benchmark_mutex;
 	HashMap<Pair<String, String>, uint64_t, PairHash<String, String>> benchmark_marks_from;
 	HashMap<Pair<String, String>, double, PairHash<String, String>> benchmark_marks_final;
 
@@ -107,6 +110,7 @@ protected:
 
 	// Functions used by Main to initialize/deinitialize the OS.
 	void add_logger(Logger *p_logger);
+	void set_async_logging(bool p_enabled);
 
 	virtual void initialize() = 0;
 	virtual void initialize_joypads() = 0;
@@ -142,11 +146,13 @@ public:
 	void print(const char *p_format, ...) _PRINTF_FORMAT_ATTRIBUTE_2_3;
 	void print_rich(const char *p_format, ...) _PRINTF_FORMAT_ATTRIBUTE_2_3;
 	void printerr(const char *p_format, ...) _PRINTF_FORMAT_ATTRIBUTE_2_3;
+	void flush_log_sync();
 
 	virtual String get_stdin_string() = 0;
 
 	virtual Error get_entropy(uint8_t *r_buffer, int p_bytes) = 0; // Should return cryptographically-safe random bytes.
 	virtual String get_system_ca_certificates() { return ""; } // Concatenated certificates in PEM format.
+	virtual FileSystemWatcher *create_file_system_watcher() const { return nullptr; } // Freed by the caller with memdelete().
 
 	virtual PackedStringArray get_connected_midi_inputs();
 	virtual void open_midi_inputs();
@@ -204,6 +210,7 @@ public:
 	virtual List<String> get_cmdline_user_args() const { return _user_args; }
 	virtual List<String> get_cmdline_platform_args() const { return List<String>(); }
 	virtual String get_model_name() const;
+	virtual float get_thermal_headroom(int p_forecast_seconds = 0) const { return -1.0; }
 
 	bool is_layered_allowed() const { return _allow_layered; }
 	bool is_hidpi_allowed() const { return _allow_hidpi; }
@@ -301,6 +308,12 @@ public:
 	virtual int get_processor_count() const;
 	virtual String get_processor_name() const;
 	virtual int get_default_thread_pool_size() const { return get_processor_count(); }
+	// Processors of each class on hybrid CPUs, one bit per processor. Both are 0 if all processors are alike.
+	virtual uint64_t get_performance_core_mask() const { return 0; }
+	virtual uint64_t get_efficiency_core_mask() const { return 0; }
+	virtual int get_numa_node_count() const { return 1; }
+	// Restricts the calling thread to the processors of a NUMA node, so the memory it touches first is allocated there.
+	virtual Error pin_current_thread_to_numa_node(int p_node) { return ERR_UNAVAILABLE; }
 
 	virtual String get_unique_id() const;
 
@@ -319,7 +332,7 @@ public:
 	virtual Vector<String> get_granted_permissions() const { return Vector<String>(); }
 	virtual void revoke_granted_permissions() {}
 
-	// For recording / measuring benchmark data. Only enabled with tools
+	// For recording / measuring benchmark data. Measures are always recorded, and dumped with --benchmark or --verbose.
 	void set_use_benchmark(bool p_use_benchmark);
 	bool is_use_benchmark_set();
 	void set_benchmark_file(const String &p_benchmark_file);
@@ -40,6 +40,7 @@
 SafeNumeric<uint64_t> Thread::id_counter(1); // The first value after .increment() is 2, hence by default the main thread ID should be 1.
 
 thread_local Thread::ID Thread::caller_id = Thread::UNASSIGNED_ID;
+thread_local uint64_t Thread::affinity_mask = 0;
 #endif
 
 Thread::PlatformFunctions Thread::platform_functions;
@@ -51,9 +52,12 @@ void Thread::_set_platform_functions(const PlatformFunctions &p_functions) {
 #ifdef THREADS_ENABLED
 void Thread::callback(ID p_caller_id, const Settings &p_settings, Callback p_callback, void *p_userdata) {
 	Thread::caller_id = p_caller_id;
-	if (platform_functions.set_priority) {
+	if (platform_functions.set_priority && p_settings.priority != PRIORITY_NORMAL) {
 		platform_functions.set_priority(p_settings.priority);
 	}
+	if (p_settings.affinity_mask) {
+		set_affinity(p_settings.affinity_mask);
+	}
 	if (platform_functions.init) {
 		platform_functions.init();
 	}
@@ -96,6 +100,26 @@ Error Thread::set_name(const String &p_name) {
 	return ERR_UNAVAILABLE;
 }
 
+Error Thread::set_priority(Priority p_priority) {
+	if (platform_functions.set_priority) {
+		return platform_functions.set_priority(p_priority);
+	}
+
+	return ERR_UNAVAILABLE;
+}
+
+Error Thread::set_affinity(uint64_t p_affinity_mask) {
+	if (platform_functions.set_affinity) {
+		Error err = platform_functions.set_affinity(p_affinity_mask);
+		if (err == OK) {
+			affinity_mask = p_affinity_mask;
+		}
+		return err;
+	}
+
+	return ERR_UNAVAILABLE;
+}
+
 Thread::Thread() {
 }
 
@@ -69,17 +69,21 @@ public:
 	enum Priority {
 		PRIORITY_LOW,
 		PRIORITY_NORMAL,
-		PRIORITY_HIGH
+		PRIORITY_HIGH,
+		PRIORITY_REALTIME, // Falls back to PRIORITY_HIGH if the process isn't allowed real-time scheduling.
 	};
 
 	struct Settings {
 		Priority priority;
+		// One bit per processor the thread may run on, 0 lets it run on any of them.
+		uint64_t affinity_mask = 0;
 		Settings() { priority = PRIORITY_NORMAL; }
 	};
 
 	struct PlatformFunctions {
 		Error (*set_name)(const String &) = nullptr;
-		void (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_affinity)(uint64_t) = nullptr;
 		void (*init)() = nullptr;
 		void (*wrapper)(Thread::Callback, void *) = nullptr;
 		void (*term)() = nullptr;
@@ -93,6 +97,7 @@ private:
 	ID id = UNASSIGNED_ID;
 	static SafeNumeric<uint64_t> id_counter;
 	static thread_local ID caller_id;
+	static thread_local uint64_t affinity_mask;
 	THREADING_NAMESPACE::thread thread;
 
 	static void callback(ID p_caller_id, const Settings &p_settings, Thread::Callback p_callback, void *p_userdata);
@@ -117,6 +122,10 @@ public:
 	_FORCE_INLINE_ static bool is_main_thread() { return caller_id == MAIN_ID; } // Gain a tiny bit of perf here because there is no need to validate caller_id here, because only main thread will be set as 1.
 
 	static Error set_name(const String &p_name);
+	// Both apply to the calling thread.
+	static Error set_priority(Priority p_priority);
+	static Error set_affinity(uint64_t p_affinity_mask);
+	_FORCE_INLINE_ static uint64_t get_affinity() { return affinity_mask; }
 
 	ID start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings());
 	bool is_started() const;
@@ -143,17 +152,21 @@ public:
 	enum Priority {
 		PRIORITY_LOW,
 		PRIORITY_NORMAL,
-		PRIORITY_HIGH
+		PRIORITY_HIGH,
+		PRIORITY_REALTIME, // Falls back to PRIORITY_HIGH if the process isn't allowed real-time scheduling.
 	};
 
 	struct Settings {
 		Priority priority;
+		// One bit per processor the thread may run on, 0 lets it run on any of them.
+		uint64_t affinity_mask = 0;
 		Settings() { priority = PRIORITY_NORMAL; }
 	};
 
 	struct PlatformFunctions {
 		Error (*set_name)(const String &) = nullptr;
-		void (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_affinity)(uint64_t) = nullptr;
 		void (*init)() = nullptr;
 		void (*wrapper)(Thread::Callback, void *) = nullptr;
 		void (*term)() = nullptr;
@@ -177,6 +190,9 @@ public:
 	_FORCE_INLINE_ static bool is_main_thread() { return true; }
 
 	static Error set_name(const String &p_name) { return ERR_UNAVAILABLE; }
+	static Error set_priority(Priority p_priority) { return ERR_UNAVAILABLE; }
+	static Error set_affinity(uint64_t p_affinity_mask) { return ERR_UNAVAILABLE; }
+	static uint64_t get_affinity() { return 0; }
 
 	void start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings()) {}
 	bool is_started() const { return false; }
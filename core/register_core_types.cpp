@@ -37,6 +37,7 @@
 #include "core/crypto/crypto.h"
 #include "core/crypto/hashing_context.h"
 #include "core/debugger/engine_profiler.h"
+#include "core/debugger/timeline_profiler.h"
 #include "core/extension/gdextension.h"
 #include "core/extension/gdextension_manager.h"
 #include "core/input/input.h"
@@ -48,6 +49,7 @@
 #include "core/io/http_client.h"
 #include "core/io/image_loader.h"
 #include "core/io/json.h"
+#include "core/io/json_stream.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/io/packed_data_container.h"
@@ -247,6 +249,8 @@ void register_core_types() {
 
 	GDREGISTER_CLASS(XMLParser);
 	GDREGISTER_CLASS(JSON);
+	GDREGISTER_CLASS(JSONStreamParser);
+	GDREGISTER_CLASS(JSONStreamWriter);
 
 	GDREGISTER_CLASS(ConfigFile);
 
@@ -309,6 +313,9 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+	GLOBAL_DEF("threading/worker_pool/numa_pinning", false);
+	GLOBAL_DEF("threading/affinity/main_threads_on_performance_cores", false);
+	GLOBAL_DEF("threading/affinity/low_priority_tasks_on_efficiency_cores", false);
 }
 
 void register_core_singletons() {
@@ -382,6 +389,7 @@ void unregister_core_types() {
 	// Destroy singletons in reverse order to ensure dependencies are not broken.
 
 	memdelete(worker_thread_pool);
+	TimelineProfiler::finalize(); // After the pool, so its threads no longer record.
 
 	memdelete(_engine_debugger);
 	memdelete(_marshalls);
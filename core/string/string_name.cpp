@@ -47,11 +47,54 @@ StringName _scs_create(const char *p_chr, bool p_static) {
 
 bool StringName::configured = false;
 Mutex StringName::mutex;
+Mutex StringName::table_mutexes[STRING_TABLE_LOCK_COUNT];
+thread_local StringName::LookupCache StringName::lookup_cache;
 
 #ifdef DEBUG_ENABLED
 bool StringName::debug_stringname = false;
 #endif
 
+void StringName::LookupCache::clear() {
+	for (int i = 0; i < LOOKUP_CACHE_SIZE; i++) {
+		if (entries[i]) {
+			StringName cached(entries[i]); // Releases the reference held by the cache.
+			entries[i] = nullptr;
+		}
+	}
+}
+
+StringName::LookupCache::~LookupCache() {
+	if (StringName::configured) {
+		clear();
+	}
+}
+
+template <typename T>
+StringName::_Data *StringName::_cache_lookup(uint32_t p_hash, const T &p_name) {
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		return nullptr; // References are counted under the table lock.
+	}
+#endif
+
+	// The entry is kept alive by the reference the cache holds, so the reference taken here can't fail.
+	_Data *data = lookup_cache.entries[p_hash & LOOKUP_CACHE_MASK];
+	if (data && data->hash == p_hash && data->get_name() == p_name && data->refcount.ref()) {
+		return data;
+	}
+	return nullptr;
+}
+
+void StringName::_cache_store(_Data *p_data) {
+	_Data *&entry = lookup_cache.entries[p_data->hash & LOOKUP_CACHE_MASK];
+	if (entry == p_data || !p_data->refcount.ref()) {
+		return;
+	}
+
+	StringName evicted(entry); // Releases the reference to the previous entry, if any.
+	entry = p_data;
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
@@ -61,6 +104,9 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
+	// Other threads are gone by now, and released their cached names on exit.
+	lookup_cache.clear();
+
 	MutexLock lock(mutex);
 
 #ifdef DEBUG_ENABLED
@@ -120,7 +166,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_table_mutex(_data->idx));
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -216,56 +262,67 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
+	_data = _cache_lookup(hash, p_name);
+	if (_data) {
+		if (p_static) {
+			_data->static_count.increment();
+		}
+		return;
+	}
+
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_data = _table[idx];
+	{
+		MutexLock lock(_get_table_mutex(idx));
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+		_data = _table[idx];
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
+		while (_data) {
+			// compare hash first
+			if (_data->hash == hash && _data->get_name() == p_name) {
+				break;
+			}
+			_data = _data->next;
 		}
+
+		if (_data && _data->refcount.ref()) {
+			// exists
+			if (p_static) {
+				_data->static_count.increment();
+			}
 #ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
+			if (unlikely(debug_stringname)) {
+				_data->debug_references++;
+			}
 #endif
-		return;
-	}
-
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+		} else {
+			_data = memnew(_Data);
+			_data->name = p_name;
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
+			_data->idx = idx;
+			_data->cname = nullptr;
+			_data->next = _table[idx];
+			_data->prev = nullptr;
 
 #ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
+			if (_table[idx]) {
+				_table[idx]->prev = _data;
+			}
+			_table[idx] = _data;
+		}
 	}
-	_table[idx] = _data;
+
+	_cache_store(_data);
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -275,55 +332,66 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
+	_data = _cache_lookup(hash, p_static_string.ptr);
+	if (_data) {
 		if (p_static) {
 			_data->static_count.increment();
 		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
 		return;
 	}
 
-	_data = memnew(_Data);
+	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	{
+		MutexLock lock(_get_table_mutex(idx));
+
+		_data = _table[idx];
+
+		while (_data) {
+			// compare hash first
+			if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
+				break;
+			}
+			_data = _data->next;
+		}
 
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+		if (_data && _data->refcount.ref()) {
+			// exists
+			if (p_static) {
+				_data->static_count.increment();
+			}
 #ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
+			if (unlikely(debug_stringname)) {
+				_data->debug_references++;
+			}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
+		} else {
+			_data = memnew(_Data);
+
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
+			_data->idx = idx;
+			_data->cname = p_static_string.ptr;
+			_data->next = _table[idx];
+			_data->prev = nullptr;
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
+#endif
+			if (_table[idx]) {
+				_table[idx]->prev = _data;
+			}
+			_table[idx] = _data;
+		}
 	}
-	_table[idx] = _data;
+
+	_cache_store(_data);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -335,54 +403,66 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
 
-	if (_data && _data->refcount.ref()) {
-		// exists
+	_data = _cache_lookup(hash, p_name);
+	if (_data) {
 		if (p_static) {
 			_data->static_count.increment();
 		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
 		return;
 	}
 
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	{
+		MutexLock lock(_get_table_mutex(idx));
+
+		_data = _table[idx];
+
+		while (_data) {
+			if (_data->hash == hash && _data->get_name() == p_name) {
+				break;
+			}
+			_data = _data->next;
+		}
+
+		if (_data && _data->refcount.ref()) {
+			// exists
+			if (p_static) {
+				_data->static_count.increment();
+			}
 #ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
+			if (unlikely(debug_stringname)) {
+				_data->debug_references++;
+			}
+#endif
+		} else {
+			_data = memnew(_Data);
+			_data->name = p_name;
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
+			_data->idx = idx;
+			_data->cname = nullptr;
+			_data->next = _table[idx];
+			_data->prev = nullptr;
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
 #endif
 
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
+			if (_table[idx]) {
+				_table[idx]->prev = _data;
+			}
+			_table[idx] = _data;
+		}
 	}
-	_table[idx] = _data;
+
+	_cache_store(_data);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -393,12 +473,18 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
+
+	_Data *_data = _cache_lookup(hash, p_name);
+	if (_data) {
+		return StringName(_data);
+	}
+
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_Data *_data = _table[idx];
+	MutexLock lock(_get_table_mutex(idx));
+
+	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
@@ -429,13 +515,18 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
+	_Data *_data = _cache_lookup(hash, p_name);
+	if (_data) {
+		return StringName(_data);
+	}
+
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_Data *_data = _table[idx];
+	MutexLock lock(_get_table_mutex(idx));
+
+	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
@@ -455,13 +546,18 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
+	_Data *_data = _cache_lookup(hash, p_name);
+	if (_data) {
+		return StringName(_data);
+	}
+
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_Data *_data = _table[idx];
+	MutexLock lock(_get_table_mutex(idx));
+
+	_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
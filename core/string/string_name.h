@@ -48,7 +48,13 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Each lock guards the buckets sharing the lowest bits of their index.
+		STRING_TABLE_LOCK_BITS = 6,
+		STRING_TABLE_LOCK_COUNT = 1 << STRING_TABLE_LOCK_BITS,
+		STRING_TABLE_LOCK_MASK = STRING_TABLE_LOCK_COUNT - 1,
+		LOOKUP_CACHE_SIZE = 256,
+		LOOKUP_CACHE_MASK = LOOKUP_CACHE_SIZE - 1,
 	};
 
 	struct _Data {
@@ -69,6 +75,21 @@ class StringName {
 
 	static _Data *_table[STRING_TABLE_LEN];
 
+	// Names recently looked up by the calling thread, indexed by hash. Each entry holds a reference,
+	// so finding a name here needs no lock.
+	struct LookupCache {
+		_Data *entries[LOOKUP_CACHE_SIZE] = {};
+
+		void clear();
+		~LookupCache();
+	};
+
+	static thread_local LookupCache lookup_cache;
+
+	template <typename T>
+	static _Data *_cache_lookup(uint32_t p_hash, const T &p_name);
+	static void _cache_store(_Data *p_data);
+
 	_Data *_data = nullptr;
 
 	void unref();
@@ -76,6 +97,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static Mutex mutex;
+	static Mutex table_mutexes[STRING_TABLE_LOCK_COUNT];
+	static _FORCE_INLINE_ Mutex &_get_table_mutex(uint32_t p_idx) { return table_mutexes[p_idx & STRING_TABLE_LOCK_MASK]; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -45,5 +45,17 @@ CommandQueueMT::CommandQueueMT() {
 	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
 }
 
+void CommandQueueMT::set_single_producer(Thread::ID p_thread) {
+	ERR_FAIL_COND_MSG(ring, "A single producer was already set for this command queue.");
+	ERR_FAIL_COND_MSG(command_mem.size(), "The single producer must be set before pushing commands.");
+
+	ring_mask = RING_SIZE_KB * 1024 - 1;
+	ring = (uint8_t *)memalloc(ring_mask + 1);
+	ring_producer = p_thread;
+}
+
 CommandQueueMT::~CommandQueueMT() {
+	if (ring) {
+		memfree(ring);
+	}
 }
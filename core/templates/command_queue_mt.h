@@ -31,15 +31,19 @@
 #ifndef COMMAND_QUEUE_MT_H
 #define COMMAND_QUEUE_MT_H
 
+#include "core/debugger/timeline_profiler.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/condition_variable.h"
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 #define COMMA(N) _COMMA_##N
 #define _COMMA_0
 #define _COMMA_1 ,
@@ -251,6 +255,15 @@
 #define DECL_PUSH(N)                                                            \
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>    \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) {    \
+		if (_is_ring_producer()) {                                              \
+			if (CMD_TYPE(N) *cmd = _ring_allocate<CMD_TYPE(N)>()) {             \
+				cmd->instance = p_instance;                                     \
+				cmd->method = p_method;                                         \
+				SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                            \
+				_ring_commit();                                                 \
+				return;                                                         \
+			}                                                                   \
+		}                                                                       \
 		MutexLock mlock(mutex);                                                 \
 		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>();                             \
 		cmd->instance = p_instance;                                             \
@@ -326,6 +339,8 @@ class CommandQueueMT {
 	/***** BASE *******/
 
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
+	static const uint32_t RING_SIZE_KB = 1024;
+	static const uint64_t RING_SKIP = UINT64_MAX;
 
 	BinaryMutex mutex;
 	LocalVector<uint8_t> command_mem;
@@ -335,18 +350,97 @@ class CommandQueueMT {
 	uint32_t sync_awaiters = 0;
 	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	uint64_t flush_read_ptr = 0;
+	bool flushing = false;
+
+	// Commands from the single producer thread skip the mutex and go through this ring, which only that thread writes to.
+	// Every command in command_mem records how far the ring had been written when it was pushed, so the consumer can
+	// keep the order in which commands were pushed across both buffers.
+	Thread::ID ring_producer = Thread::UNASSIGNED_ID;
+	uint8_t *ring = nullptr;
+	uint64_t ring_mask = 0;
+	std::atomic<uint64_t> ring_write = { 0 };
+	std::atomic<uint64_t> ring_read = { 0 };
+	uint64_t ring_pending_write = 0;
+	// Set by the consumer once it runs out of commands, so the producer only wakes it up once per batch.
+	std::atomic<bool> consumer_idle = { true };
 
 	template <typename T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
 		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
+		command_mem.resize(size + alloc_size + 16);
 		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		*(uint64_t *)&command_mem[size + 8] = ring_write.load(std::memory_order_acquire);
+		T *cmd = memnew_placement(&command_mem[size + 16], T);
 		return cmd;
 	}
 
+	_FORCE_INLINE_ bool _is_ring_producer() const {
+		return ring && Thread::get_caller_id() == ring_producer;
+	}
+
+	// Returns nullptr if the ring is full, in which case the command goes through command_mem instead.
+	template <typename T>
+	T *_ring_allocate() {
+		const uint64_t ring_size = ring_mask + 1;
+		const uint64_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1)) + 8;
+		uint64_t write = ring_write.load(std::memory_order_relaxed);
+		// Commands are never split, if there is not enough room until the end of the ring it starts over from the beginning.
+		uint64_t until_end = ring_size - (write & ring_mask);
+		uint64_t needed = alloc_size <= until_end ? alloc_size : until_end + alloc_size;
+		if (unlikely(write + needed - ring_read.load(std::memory_order_acquire) > ring_size)) {
+			return nullptr;
+		}
+
+		if (alloc_size > until_end) {
+			*(uint64_t *)&ring[write & ring_mask] = RING_SKIP;
+			write += until_end;
+		}
+		*(uint64_t *)&ring[write & ring_mask] = alloc_size - 8;
+		ring_pending_write = write + alloc_size;
+		return memnew_placement(&ring[(write & ring_mask) + 8], T);
+	}
+
+	_FORCE_INLINE_ void _ring_commit() {
+		// Sequentially consistent, pairs with the consumer setting itself idle and checking the ring again.
+		ring_write.store(ring_pending_write);
+		if (unlikely(consumer_idle.load())) {
+			consumer_idle.store(false);
+			if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+			}
+		}
+	}
+
+	// Ring commands pushed before the next command in command_mem must run before it.
+	_FORCE_INLINE_ uint64_t _get_ring_flush_limit() const {
+		uint64_t limit = ring_write.load(std::memory_order_acquire);
+		if (flush_read_ptr < command_mem.size()) {
+			limit = MIN(limit, *(const uint64_t *)&command_mem[flush_read_ptr + 8]);
+		}
+		return limit;
+	}
+
+	void _flush_ring(uint64_t p_limit) {
+		uint64_t read = ring_read.load(std::memory_order_relaxed);
+		while (read < p_limit) {
+			uint64_t size = *(uint64_t *)&ring[read & ring_mask];
+			if (size == RING_SKIP) {
+				read += (ring_mask + 1) - (read & ring_mask);
+				continue;
+			}
+
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&ring[(read & ring_mask) + 8]);
+			cmd->call();
+			cmd->~CommandBase();
+
+			read += size + 8;
+			ring_read.store(read, std::memory_order_release);
+		}
+		ring_read.store(read, std::memory_order_release);
+	}
+
 	_FORCE_INLINE_ void _prevent_sync_wraparound() {
 		bool safe_to_reset = !sync_awaiters;
 		bool already_sync_to_latest = sync_head == sync_tail;
@@ -357,43 +451,76 @@ class CommandQueueMT {
 	}
 
 	void _flush() {
-		if (unlikely(flush_read_ptr)) {
+		if (unlikely(flushing)) {
 			// Re-entrant call.
 			return;
 		}
 
+		TIMELINE_ZONE("CommandQueueMT::flush");
+
 		lock();
+		if (unlikely(flushing)) {
+			// Another thread is flushing the ring with the lock released.
+			unlock();
+			return;
+		}
+		flushing = true;
+
+		while (true) {
+			if (ring) {
+				uint64_t ring_limit = _get_ring_flush_limit();
+				if (ring_read.load(std::memory_order_relaxed) < ring_limit) {
+					unlock();
+					_flush_ring(ring_limit);
+					lock();
+					continue;
+				}
+			}
 
-		uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(&mutex);
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			cmd->call();
+			if (flush_read_ptr >= command_mem.size()) {
+				if (ring) {
+					// Sequentially consistent, pairs with the producer publishing commands and checking whether we are idle.
+					consumer_idle.store(true);
+					if (ring_read.load(std::memory_order_relaxed) != ring_write.load()) {
+						consumer_idle.store(false);
+						continue;
+					}
+				}
+				break;
+			}
 
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
+			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(&mutex);
+			do {
+				uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
+				flush_read_ptr += 16;
+				CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
+				cmd->call();
 
-			if (unlikely(cmd->sync)) {
-				sync_head++;
-				unlock(); // Give an opportunity to awaiters right away.
-				sync_cond_var.notify_all();
-				lock();
-				// Handle potential realloc happened during unlock.
+				// Handle potential realloc due to the command and unlock allowance.
 				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			}
 
-			cmd->~CommandBase();
+				if (unlikely(cmd->sync)) {
+					sync_head++;
+					unlock(); // Give an opportunity to awaiters right away.
+					sync_cond_var.notify_all();
+					lock();
+					// Handle potential realloc happened during unlock.
+					cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
+				}
 
-			flush_read_ptr += size;
+				cmd->~CommandBase();
+
+				flush_read_ptr += size;
+			} while (flush_read_ptr < command_mem.size() && !(ring && ring_read.load(std::memory_order_relaxed) < _get_ring_flush_limit()));
+			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
 		}
-		WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
 
 		command_mem.clear();
 		flush_read_ptr = 0;
 
 		_prevent_sync_wraparound();
 
+		flushing = false;
 		unlock();
 	}
 
@@ -426,7 +553,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem.size() > 0 || (ring && ring_read.load(std::memory_order_relaxed) != ring_write.load(std::memory_order_acquire)))) {
 			_flush();
 		}
 	}
@@ -451,6 +578,10 @@ public:
 		unlock();
 	}
 
+	// Lets p_thread push commands without locking, as long as it is the only thread doing so most of the time.
+	// Must be called before any command is pushed.
+	void set_single_producer(Thread::ID p_thread);
+
 	CommandQueueMT();
 	~CommandQueueMT();
 };
@@ -0,0 +1,593 @@
+/**************************************************************************/
+/*  flat_hash_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#include <string.h>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_GROUP_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define FLAT_HASH_GROUP_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Control bytes shared by FlatHashMap and FlatHashSet.
+ *
+ * Every slot has one control byte: either EMPTY, DELETED or the lowest 7 bits
+ * of the hash of the key stored in it. Probing loads a whole group of control
+ * bytes at once and compares all of them in a single SIMD instruction, so
+ * only slots whose 7 bit hash matches ever get their keys compared.
+ *
+ * The first group of control bytes is mirrored after the last slot, so a
+ * group can be loaded unaligned from any position without wrapping around.
+ */
+struct FlatHashGroup {
+	static constexpr uint32_t SIZE = 16;
+	static constexpr int8_t EMPTY = -128;
+	static constexpr int8_t DELETED = -2;
+
+	_FORCE_INLINE_ static uint32_t get_h1(uint32_t p_hash) { return p_hash >> 7; }
+	_FORCE_INLINE_ static int8_t get_h2(uint32_t p_hash) { return (int8_t)(p_hash & 0x7F); }
+	_FORCE_INLINE_ static bool is_full(int8_t p_ctrl) { return p_ctrl >= 0; }
+
+#ifdef FLAT_HASH_GROUP_NEON
+	_FORCE_INLINE_ static uint32_t _to_bit_mask(uint8x16_t p_bytes) {
+		// Keep one distinct bit per byte, then fold each half into a single byte.
+		static const uint8_t bits[SIZE] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+		uint8x16_t masked = vandq_u8(p_bytes, vld1q_u8(bits));
+		return (uint32_t)vaddv_u8(vget_low_u8(masked)) | ((uint32_t)vaddv_u8(vget_high_u8(masked)) << 8);
+	}
+#endif
+
+	// Bit i of the returned masks is set when the control byte at p_ctrl[i] matches.
+
+	_FORCE_INLINE_ static uint32_t match(const int8_t *p_ctrl, int8_t p_h2) {
+#if defined(FLAT_HASH_GROUP_SSE2)
+		__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+		return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(p_h2)));
+#elif defined(FLAT_HASH_GROUP_NEON)
+		return _to_bit_mask(vceqq_s8(vld1q_s8(p_ctrl), vdupq_n_s8(p_h2)));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < SIZE; i++) {
+			mask |= (uint32_t)(p_ctrl[i] == p_h2) << i;
+		}
+		return mask;
+#endif
+	}
+
+	_FORCE_INLINE_ static uint32_t match_empty(const int8_t *p_ctrl) {
+		return match(p_ctrl, EMPTY);
+	}
+
+	_FORCE_INLINE_ static uint32_t match_empty_or_deleted(const int8_t *p_ctrl) {
+		// Both special values have the sign bit set, full slots never do.
+#if defined(FLAT_HASH_GROUP_SSE2)
+		return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl)));
+#elif defined(FLAT_HASH_GROUP_NEON)
+		return _to_bit_mask(vcltzq_s8(vld1q_s8(p_ctrl)));
+#else
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < SIZE; i++) {
+			mask |= (uint32_t)(p_ctrl[i] < 0) << i;
+		}
+		return mask;
+#endif
+	}
+
+	_FORCE_INLINE_ static uint32_t lowest_bit(uint32_t p_mask) {
+#if defined(__GNUC__)
+		return __builtin_ctz(p_mask);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		uint32_t index = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			index++;
+		}
+		return index;
+#endif
+	}
+
+	// Smallest power of two capacity that fits p_elements while staying below the 7/8 maximum occupancy.
+	static uint32_t capacity_for(uint32_t p_elements) {
+		uint32_t capacity = SIZE;
+		while (capacity - capacity / 8 < p_elements) {
+			CRASH_COND_MSG(capacity >= (1u << 31), "Flat hash table maximum capacity reached.");
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+};
+
+/**
+ * An unordered HashMap alternative that stores its elements in a flat array
+ * probed one group of slots at a time (see FlatHashGroup), in the style of
+ * Swiss tables.
+ *
+ * Pairs whose key and value are both trivially copyable are stored inline in
+ * the slot array, they are moved when the map grows. Other pairs are
+ * allocated separately, so pointers to them stay valid until they are erased.
+ *
+ * There is no insertion order: iteration goes through the slots in memory
+ * order. Erasing never moves other elements, so erasing the element an
+ * iterator points to and then incrementing that iterator is supported.
+ *
+ * The assignment operator copy the pairs from one map to the other.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		typename Allocator = DefaultTypedAllocator<KeyValue<TKey, TValue>>>
+class FlatHashMap {
+public:
+	static constexpr bool INLINE_STORAGE = std::is_trivially_copyable<TKey>::value && std::is_trivially_copyable<TValue>::value;
+
+private:
+	typedef KeyValue<TKey, TValue> Pair;
+	typedef std::conditional_t<INLINE_STORAGE, Pair, Pair *> Slot;
+
+	Allocator element_alloc;
+	int8_t *ctrl = nullptr;
+	Slot *slots = nullptr;
+
+	uint32_t capacity = FlatHashGroup::SIZE;
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	_FORCE_INLINE_ static Pair &_get_slot_pair(Slot &p_slot) {
+		if constexpr (INLINE_STORAGE) {
+			return p_slot;
+		} else {
+			return *p_slot;
+		}
+	}
+
+	_FORCE_INLINE_ Pair &_get_pair(uint32_t p_pos) const {
+		return _get_slot_pair(slots[p_pos]);
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_pos, int8_t p_value) {
+		ctrl[p_pos] = p_value;
+		if (p_pos < FlatHashGroup::SIZE) {
+			ctrl[capacity + p_pos] = p_value;
+		}
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (ctrl == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t mask = capacity - 1;
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t h2 = FlatHashGroup::get_h2(hash);
+		uint32_t pos = FlatHashGroup::get_h1(hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const int8_t *group = ctrl + pos;
+
+			uint32_t candidates = FlatHashGroup::match(group, h2);
+			while (candidates) {
+				uint32_t candidate_pos = (pos + FlatHashGroup::lowest_bit(candidates)) & mask;
+				if (Comparator::compare(_get_pair(candidate_pos).key, p_key)) {
+					r_pos = candidate_pos;
+					return true;
+				}
+				candidates &= candidates - 1;
+			}
+
+			if (FlatHashGroup::match_empty(group)) {
+				return false;
+			}
+
+			// Triangular probing visits every group when the capacity is a power of two.
+			step += FlatHashGroup::SIZE;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_free_pos(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = FlatHashGroup::get_h1(p_hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			uint32_t free = FlatHashGroup::match_empty_or_deleted(ctrl + pos);
+			if (free) {
+				return (pos + FlatHashGroup::lowest_bit(free)) & mask;
+			}
+
+			step += FlatHashGroup::SIZE;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		num_deleted = 0;
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + FlatHashGroup::SIZE));
+		slots = reinterpret_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * capacity));
+		memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		Slot *old_slots = slots;
+		uint32_t old_capacity = capacity;
+
+		_allocate(p_new_capacity);
+
+		// Slots are either trivially copyable pairs or pointers, both can be relocated as raw bytes.
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (!FlatHashGroup::is_full(old_ctrl[i])) {
+				continue;
+			}
+
+			uint32_t hash = Hasher::hash(_get_slot_pair(old_slots[i]).key);
+			uint32_t pos = _find_free_pos(hash);
+			_set_ctrl(pos, FlatHashGroup::get_h2(hash));
+			memcpy((void *)&slots[pos], (const void *)&old_slots[i], sizeof(Slot));
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_slots);
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value) {
+		if (unlikely(ctrl == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate(capacity);
+		}
+
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			_get_pair(pos).value = p_value;
+			return pos;
+		}
+
+		if (num_elements + num_deleted + 1 > capacity - capacity / 8) {
+			// Grow when at least half of the slots are alive, otherwise rehashing in place is enough to get rid of the deleted ones.
+			CRASH_COND_MSG(num_elements + 1 > capacity / 2 && capacity >= (1u << 31), "Flat hash table maximum capacity reached.");
+			_resize_and_rehash(num_elements + 1 > capacity / 2 ? capacity * 2 : capacity);
+		}
+
+		uint32_t hash = Hasher::hash(p_key);
+		pos = _find_free_pos(hash);
+		if (ctrl[pos] == FlatHashGroup::DELETED) {
+			num_deleted--;
+		}
+		_set_ctrl(pos, FlatHashGroup::get_h2(hash));
+
+		if constexpr (INLINE_STORAGE) {
+			memnew_placement(&slots[pos], Pair(p_key, p_value));
+		} else {
+			slots[pos] = element_alloc.new_allocation(Pair(p_key, p_value));
+		}
+		num_elements++;
+
+		return pos;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		if constexpr (!INLINE_STORAGE) {
+			element_alloc.delete_allocation(slots[p_pos]);
+		}
+
+		num_elements--;
+		if (num_elements == 0) {
+			// Nothing left to probe past, forget about the deleted slots.
+			memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+			num_deleted = 0;
+		} else {
+			_set_ctrl(p_pos, FlatHashGroup::DELETED);
+			num_deleted++;
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _next_full_pos(uint32_t p_pos) const {
+		if (ctrl == nullptr) {
+			return capacity;
+		}
+		while (p_pos < capacity && !FlatHashGroup::is_full(ctrl[p_pos])) {
+			p_pos++;
+		}
+		return p_pos;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr || (num_elements == 0 && num_deleted == 0)) {
+			return;
+		}
+
+		if constexpr (!INLINE_STORAGE) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (FlatHashGroup::is_full(ctrl[i])) {
+					element_alloc.delete_allocation(slots[i]);
+				}
+			}
+		}
+
+		memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return _get_pair(pos).value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return _get_pair(pos).value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &_get_pair(pos).value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &_get_pair(pos).value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+		_erase_pos(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = FlatHashGroup::capacity_for(p_new_capacity);
+		if (new_capacity <= capacity) {
+			return;
+		}
+
+		if (ctrl == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_pair(pos);
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->_get_pair(pos); }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (map) {
+				pos = map->_next_full_pos(pos + 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		friend class FlatHashMap;
+		const FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->_get_pair(pos);
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->_get_pair(pos); }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (map) {
+				pos = map->_next_full_pos(pos + 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, pos);
+		}
+
+	private:
+		friend class FlatHashMap;
+		FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_full_pos(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, pos);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			_erase_pos(p_iter.pos);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_full_pos(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(this, pos);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return _get_pair(pos).value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			pos = _insert(p_key, TValue());
+		}
+		return _get_pair(pos).value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		return Iterator(this, _insert(p_key, p_value));
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(slots);
+		}
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
@@ -0,0 +1,360 @@
+/**************************************************************************/
+/*  flat_hash_set.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_SET_H
+#define FLAT_HASH_SET_H
+
+#include "core/os/memory.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/hashfuncs.h"
+
+/**
+ * An unordered HashSet alternative probed one group of slots at a time, see
+ * FlatHashGroup. Keys are always stored inline in the slot array, so they
+ * move when the set grows.
+ *
+ * There is no insertion order: iteration goes through the slots in memory
+ * order. Erasing never moves other keys, so erasing the key an iterator
+ * points to and then incrementing that iterator is supported.
+ */
+
+template <typename TKey,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashSet {
+	int8_t *ctrl = nullptr;
+	TKey *keys = nullptr;
+
+	uint32_t capacity = FlatHashGroup::SIZE;
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_pos, int8_t p_value) {
+		ctrl[p_pos] = p_value;
+		if (p_pos < FlatHashGroup::SIZE) {
+			ctrl[capacity + p_pos] = p_value;
+		}
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (ctrl == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t mask = capacity - 1;
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t h2 = FlatHashGroup::get_h2(hash);
+		uint32_t pos = FlatHashGroup::get_h1(hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const int8_t *group = ctrl + pos;
+
+			uint32_t candidates = FlatHashGroup::match(group, h2);
+			while (candidates) {
+				uint32_t candidate_pos = (pos + FlatHashGroup::lowest_bit(candidates)) & mask;
+				if (Comparator::compare(keys[candidate_pos], p_key)) {
+					r_pos = candidate_pos;
+					return true;
+				}
+				candidates &= candidates - 1;
+			}
+
+			if (FlatHashGroup::match_empty(group)) {
+				return false;
+			}
+
+			step += FlatHashGroup::SIZE;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_free_pos(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = FlatHashGroup::get_h1(p_hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			uint32_t free = FlatHashGroup::match_empty_or_deleted(ctrl + pos);
+			if (free) {
+				return (pos + FlatHashGroup::lowest_bit(free)) & mask;
+			}
+
+			step += FlatHashGroup::SIZE;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		num_deleted = 0;
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + FlatHashGroup::SIZE));
+		keys = reinterpret_cast<TKey *>(Memory::alloc_static(sizeof(TKey) * capacity));
+		memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		TKey *old_keys = keys;
+		uint32_t old_capacity = capacity;
+
+		_allocate(p_new_capacity);
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (!FlatHashGroup::is_full(old_ctrl[i])) {
+				continue;
+			}
+
+			uint32_t hash = Hasher::hash(old_keys[i]);
+			uint32_t pos = _find_free_pos(hash);
+			_set_ctrl(pos, FlatHashGroup::get_h2(hash));
+			if constexpr (std::is_trivially_copyable<TKey>::value) {
+				memcpy((void *)&keys[pos], (const void *)&old_keys[i], sizeof(TKey));
+			} else {
+				memnew_placement(&keys[pos], TKey(old_keys[i]));
+				old_keys[i].~TKey();
+			}
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_keys);
+	}
+
+	uint32_t _insert(const TKey &p_key) {
+		if (unlikely(ctrl == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate(capacity);
+		}
+
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return pos;
+		}
+
+		if (num_elements + num_deleted + 1 > capacity - capacity / 8) {
+			// Grow when at least half of the slots are alive, otherwise rehashing in place is enough to get rid of the deleted ones.
+			CRASH_COND_MSG(num_elements + 1 > capacity / 2 && capacity >= (1u << 31), "Flat hash table maximum capacity reached.");
+			_resize_and_rehash(num_elements + 1 > capacity / 2 ? capacity * 2 : capacity);
+		}
+
+		uint32_t hash = Hasher::hash(p_key);
+		pos = _find_free_pos(hash);
+		if (ctrl[pos] == FlatHashGroup::DELETED) {
+			num_deleted--;
+		}
+		_set_ctrl(pos, FlatHashGroup::get_h2(hash));
+		memnew_placement(&keys[pos], TKey(p_key));
+		num_elements++;
+
+		return pos;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		if constexpr (!std::is_trivially_destructible<TKey>::value) {
+			keys[p_pos].~TKey();
+		}
+
+		num_elements--;
+		if (num_elements == 0) {
+			// Nothing left to probe past, forget about the deleted slots.
+			memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+			num_deleted = 0;
+		} else {
+			_set_ctrl(p_pos, FlatHashGroup::DELETED);
+			num_deleted++;
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _next_full_pos(uint32_t p_pos) const {
+		if (ctrl == nullptr) {
+			return capacity;
+		}
+		while (p_pos < capacity && !FlatHashGroup::is_full(ctrl[p_pos])) {
+			p_pos++;
+		}
+		return p_pos;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr || (num_elements == 0 && num_deleted == 0)) {
+			return;
+		}
+
+		if constexpr (!std::is_trivially_destructible<TKey>::value) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (FlatHashGroup::is_full(ctrl[i])) {
+					keys[i].~TKey();
+				}
+			}
+		}
+
+		memset(ctrl, (uint8_t)FlatHashGroup::EMPTY, capacity + FlatHashGroup::SIZE);
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+		_erase_pos(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = FlatHashGroup::capacity_for(p_new_capacity);
+		if (new_capacity <= capacity) {
+			return;
+		}
+
+		if (ctrl == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct Iterator {
+		_FORCE_INLINE_ const TKey &operator*() const {
+			return set->keys[pos];
+		}
+		_FORCE_INLINE_ const TKey *operator->() const {
+			return &set->keys[pos];
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (set) {
+				pos = set->_next_full_pos(pos + 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return set != nullptr && pos < set->capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(const FlatHashSet *p_set, uint32_t p_pos) {
+			set = p_set;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		friend class FlatHashSet;
+		const FlatHashSet *set = nullptr;
+		uint32_t pos = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() const {
+		return Iterator(this, _next_full_pos(0));
+	}
+	_FORCE_INLINE_ Iterator end() const {
+		return Iterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, pos);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			_erase_pos(p_iter.pos);
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key) {
+		return Iterator(this, _insert(p_key));
+	}
+
+	/* Constructors */
+
+	FlatHashSet(const FlatHashSet &p_other) {
+		reserve(p_other.num_elements);
+
+		for (const TKey &E : p_other) {
+			_insert(E);
+		}
+	}
+
+	void operator=(const FlatHashSet &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+
+		for (const TKey &E : p_other) {
+			_insert(E);
+		}
+	}
+
+	FlatHashSet(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashSet() {}
+
+	~FlatHashSet() {
+		clear();
+
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(keys);
+		}
+	}
+};
+
+#endif // FLAT_HASH_SET_H
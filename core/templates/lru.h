@@ -101,6 +101,24 @@ public:
 		}
 	}
 
+	bool erase(const TKey &p_key) {
+		Element *e = _map.getptr(p_key);
+		if (!e) {
+			return false;
+		}
+		_list.erase(*e);
+		_map.erase(p_key);
+		return true;
+	}
+
+	// Doesn't change the order, so it can be used to pick what to evict next.
+	const TKey *get_least_recent_key() const {
+		if (_list.is_empty()) {
+			return nullptr;
+		}
+		return &_list.back()->get().key;
+	}
+
 	_FORCE_INLINE_ size_t get_capacity() const { return capacity; }
 	_FORCE_INLINE_ size_t get_size() const { return _map.size(); }
 
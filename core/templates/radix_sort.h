@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*  radix_sort.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include "core/templates/local_vector.h"
+#include "core/typedefs.h"
+
+#include <string.h>
+
+// Maps a float to an unsigned integer with the same ordering, for use as a sort key.
+_FORCE_INLINE_ uint32_t radix_sort_float_key(float p_value) {
+	uint32_t bits;
+	memcpy(&bits, &p_value, sizeof(uint32_t));
+	return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+// Stable least significant digit radix sort on 64-bit keys.
+// The keys are supplied by the caller alongside the elements and are reordered with them.
+// Sorting by several keys is done by sorting by the least significant one first.
+template <typename T>
+class RadixSort {
+	enum {
+		INSERTION_SORT_THRESHOLD = 32,
+		DIGIT_BITS = 8,
+		DIGIT_COUNT = 1 << DIGIT_BITS,
+		DIGIT_PASSES = 64 / DIGIT_BITS,
+	};
+
+	LocalVector<T> temp_elements;
+	LocalVector<uint64_t> temp_keys;
+
+	void _insertion_sort(T *p_elements, uint64_t *p_keys, uint32_t p_size) {
+		for (uint32_t i = 1; i < p_size; i++) {
+			T element = p_elements[i];
+			uint64_t key = p_keys[i];
+			uint32_t j = i;
+			while (j > 0 && p_keys[j - 1] > key) {
+				p_elements[j] = p_elements[j - 1];
+				p_keys[j] = p_keys[j - 1];
+				j--;
+			}
+			p_elements[j] = element;
+			p_keys[j] = key;
+		}
+	}
+
+public:
+	void sort(T *p_elements, uint64_t *p_keys, uint32_t p_size) {
+		if (p_size < 2) {
+			return;
+		}
+
+		if (p_size <= INSERTION_SORT_THRESHOLD) {
+			_insertion_sort(p_elements, p_keys, p_size);
+			return;
+		}
+
+		// All histograms are gathered in a single pass over the keys.
+		uint32_t histograms[DIGIT_PASSES][DIGIT_COUNT] = {};
+		for (uint32_t i = 0; i < p_size; i++) {
+			uint64_t key = p_keys[i];
+			for (uint32_t pass = 0; pass < DIGIT_PASSES; pass++) {
+				histograms[pass][(key >> (pass * DIGIT_BITS)) & (DIGIT_COUNT - 1)]++;
+			}
+		}
+
+		temp_elements.resize(p_size);
+		temp_keys.resize(p_size);
+
+		T *src_elements = p_elements;
+		uint64_t *src_keys = p_keys;
+		T *dst_elements = temp_elements.ptr();
+		uint64_t *dst_keys = temp_keys.ptr();
+
+		for (uint32_t pass = 0; pass < DIGIT_PASSES; pass++) {
+			uint32_t *histogram = histograms[pass];
+			uint32_t shift = pass * DIGIT_BITS;
+
+			// Digits shared by all keys (such as unused high bits) don't change the order.
+			if (histogram[(src_keys[0] >> shift) & (DIGIT_COUNT - 1)] == p_size) {
+				continue;
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < DIGIT_COUNT; i++) {
+				uint32_t count = histogram[i];
+				histogram[i] = offset;
+				offset += count;
+			}
+
+			for (uint32_t i = 0; i < p_size; i++) {
+				uint32_t index = histogram[(src_keys[i] >> shift) & (DIGIT_COUNT - 1)]++;
+				dst_elements[index] = src_elements[i];
+				dst_keys[index] = src_keys[i];
+			}
+
+			SWAP(src_elements, dst_elements);
+			SWAP(src_keys, dst_keys);
+		}
+
+		if (src_elements != p_elements) {
+			for (uint32_t i = 0; i < p_size; i++) {
+				p_elements[i] = src_elements[i];
+				p_keys[i] = src_keys[i];
+			}
+		}
+	}
+};
+
+#endif // RADIX_SORT_H
@@ -36,6 +36,7 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
@@ -69,62 +70,107 @@ public:
 
 template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
+	// In thread-safe allocators, lookups (`get_or_null()`, `owns()`) don't take the lock.
+	// This relies on the chunk tables only ever growing: a new chunk is published through
+	// `max_alloc`, and tables replaced while growing are kept alive until destruction, since
+	// a concurrent lookup may still be reading the old one.
+	static constexpr std::memory_order ACQUIRE = THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed;
+	static constexpr std::memory_order RELEASE = THREAD_SAFE ? std::memory_order_release : std::memory_order_relaxed;
+
+	std::atomic<T **> chunks{ nullptr };
+	std::atomic<std::atomic<uint32_t> **> validator_chunks{ nullptr };
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+	LocalVector<void *> retired_tables;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	uint32_t chunk_capacity = 0;
+	std::atomic<uint32_t> max_alloc{ 0 };
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
+	Memory::Tag memory_tag = Memory::TAG_DEFAULT;
 
 	mutable SpinLock spin_lock;
 
+	void _retire_table(void *p_table) {
+		if (THREAD_SAFE) {
+			retired_tables.push_back(p_table);
+		} else {
+			memfree(p_table);
+		}
+	}
+
+	void _grow_tables() {
+		uint32_t new_capacity = chunk_capacity == 0 ? 4 : chunk_capacity * 2;
+
+		T **old_chunks = chunks.load(std::memory_order_relaxed);
+		std::atomic<uint32_t> **old_validators = validator_chunks.load(std::memory_order_relaxed);
+
+		T **new_chunks = (T **)memalloc(sizeof(T *) * new_capacity);
+		std::atomic<uint32_t> **new_validators = (std::atomic<uint32_t> **)memalloc(sizeof(std::atomic<uint32_t> *) * new_capacity);
+		if (old_chunks) {
+			memcpy(new_chunks, old_chunks, sizeof(T *) * chunk_capacity);
+			memcpy(new_validators, old_validators, sizeof(std::atomic<uint32_t> *) * chunk_capacity);
+		}
+		free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * new_capacity);
+
+		chunks.store(new_chunks, RELEASE);
+		validator_chunks.store(new_validators, RELEASE);
+		chunk_capacity = new_capacity;
+
+		if (old_chunks) {
+			_retire_table(old_chunks);
+			_retire_table(old_validators);
+		}
+	}
+
+	_FORCE_INLINE_ std::atomic<uint32_t> &_get_validator(uint32_t p_index) const {
+		return validator_chunks.load(ACQUIRE)[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
+		// Generating the validator is atomic, keep it out of the critical section.
+		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
+		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
+
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
 
-		if (alloc_count == max_alloc) {
+		uint32_t current_max = max_alloc.load(std::memory_order_relaxed);
+		if (alloc_count == current_max) {
 			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
+			uint32_t chunk_count = current_max / elements_in_chunk;
+			MemoryTagScope tag_scope(memory_tag == Memory::TAG_DEFAULT ? Memory::get_current_tag() : memory_tag);
 
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			if (chunk_count == chunk_capacity) {
+				_grow_tables();
+			}
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+			// Readers can't reach the new chunk before `max_alloc` is updated below.
+			T **chunk_table = chunks.load(std::memory_order_relaxed);
+			std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_relaxed);
+			chunk_table[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+			validator_table[chunk_count] = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				validator_table[chunk_count][i].store(0xFFFFFFFF, std::memory_order_relaxed);
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
-			max_alloc += elements_in_chunk;
+			max_alloc.store(current_max + elements_in_chunk, RELEASE);
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
-
-		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
-		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_validator(free_index).store(validator | 0x80000000, RELEASE); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -135,6 +181,54 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	// Returns the memory of an allocated but uninitialized RID. It stays
+	// marked uninitialized until `_set_initialized()` is called, so lookups
+	// from other threads can't see a partially constructed object.
+	T *_get_uninitialized(const RID &p_rid) {
+		if (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		uint32_t validator = uint32_t(id >> 32);
+		if (unlikely(p_rid == RID() || idx >= max_alloc.load(std::memory_order_relaxed))) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize an invalid RID");
+		}
+
+		uint32_t current = _get_validator(idx).load(std::memory_order_relaxed);
+		if (unlikely(!(current & 0x80000000))) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+
+		if (unlikely((current & 0x7FFFFFFF) != validator)) {
+			if (THREAD_SAFE) {
+				spin_lock.unlock();
+			}
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		T *ptr = &chunks.load(std::memory_order_relaxed)[idx / elements_in_chunk][idx % elements_in_chunk];
+
+		if (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+
+		return ptr;
+	}
+
+	void _set_initialized(const RID &p_rid) {
+		uint32_t idx = uint32_t(p_rid.get_id() & 0xFFFFFFFF);
+		// Pairs with the acquire in `get_or_null()`, publishing the constructed object.
+		_get_validator(idx).fetch_and(0x7FFFFFFF, RELEASE);
+	}
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -156,16 +250,18 @@ public:
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
+
+		if (unlikely(p_initialize)) {
+			T *ptr = _get_uninitialized(p_rid);
+			if (ptr) {
+				_set_initialized(p_rid);
+			}
+			return ptr;
 		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.load(ACQUIRE))) {
 			return nullptr;
 		}
 
@@ -173,79 +269,40 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
+		uint32_t current = validator_chunks.load(ACQUIRE)[idx_chunk][idx_element].load(ACQUIRE);
 
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		if (unlikely(current != validator)) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &chunks.load(ACQUIRE)[idx_chunk][idx_element];
 	}
 	void initialize_rid(RID p_rid) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _get_uninitialized(p_rid);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T);
+		_set_initialized(p_rid);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
-		T *mem = get_or_null(p_rid, true);
+		T *mem = _get_uninitialized(p_rid);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T(p_value));
+		_set_initialized(p_rid);
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.load(ACQUIRE))) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_get_validator(idx).load(ACQUIRE) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -255,7 +312,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.load(std::memory_order_relaxed))) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
@@ -266,20 +323,22 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		std::atomic<uint32_t> &current = _get_validator(idx);
+		if (unlikely(current.load(std::memory_order_relaxed) & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID.");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current.load(std::memory_order_relaxed) != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		// Invalidate before destroying, so concurrent lookups stop returning the object.
+		current.store(0xFFFFFFFF, RELEASE); // go invalid
+		chunks.load(std::memory_order_relaxed)[idx_chunk][idx_element].~T();
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -296,8 +355,9 @@ public:
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		uint32_t count = max_alloc.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < count; i++) {
+			uint64_t validator = _get_validator(i).load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -313,8 +373,9 @@ public:
 			spin_lock.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		uint32_t count = max_alloc.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < count; i++) {
+			uint64_t validator = _get_validator(i).load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -329,37 +390,49 @@ public:
 		description = p_descrption;
 	}
 
+	void set_memory_tag(Memory::Tag p_tag) {
+		memory_tag = p_tag;
+	}
+
 	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536) {
 		elements_in_chunk = sizeof(T) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(T));
 	}
 
 	~RID_Alloc() {
+		uint32_t count = max_alloc.load(std::memory_order_relaxed);
+		T **chunk_table = chunks.load(std::memory_order_relaxed);
+		std::atomic<uint32_t> **validator_table = validator_chunks.load(std::memory_order_relaxed);
+
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			for (size_t i = 0; i < count; i++) {
+				uint32_t validator = validator_table[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
 				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+					chunk_table[i / elements_in_chunk][i % elements_in_chunk].~T();
 				}
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = count / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
+			memfree(chunk_table[i]);
+			memfree(validator_table[i]);
 			memfree(free_list_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
+		if (chunk_table) {
+			memfree(chunk_table);
 			memfree(free_list_chunks);
-			memfree(validator_chunks);
+			memfree(validator_table);
+		}
+
+		for (void *table : retired_tables) {
+			memfree(table);
 		}
 	}
 };
@@ -419,6 +492,10 @@ public:
 		alloc.set_description(p_descrption);
 	}
 
+	void set_memory_tag(Memory::Tag p_tag) {
+		alloc.set_memory_tag(p_tag);
+	}
+
 	RID_PtrOwner(uint32_t p_target_chunk_byte_size = 65536) :
 			alloc(p_target_chunk_byte_size) {}
 };
@@ -473,6 +550,10 @@ public:
 	void set_description(const char *p_descrption) {
 		alloc.set_description(p_descrption);
 	}
+
+	void set_memory_tag(Memory::Tag p_tag) {
+		alloc.set_memory_tag(p_tag);
+	}
 	RID_Owner(uint32_t p_target_chunk_byte_size = 65536) :
 			alloc(p_target_chunk_byte_size) {}
 };
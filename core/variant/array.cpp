@@ -245,13 +245,28 @@ void Array::assign(const Array &p_array) {
 		ERR_FAIL_MSG(vformat(R"(Cannot assign contents of "Array[%s]" to "Array[%s]".)", Variant::get_type_name(source_typed.type), Variant::get_type_name(typed.type)));
 	}
 
+	int first_mismatch = 0;
+	if (source_typed.type == Variant::NIL) {
+		while (first_mismatch < size && source[first_mismatch].get_type() == typed.type) {
+			first_mismatch++;
+		}
+		if (first_mismatch == size) {
+			// Every element already has the right type, share the storage instead of copying it.
+			_p->array = p_array._p->array;
+			return;
+		}
+	}
+
 	Vector<Variant> array;
 	array.resize(size);
 	Variant *data = array.ptrw();
 
 	if (source_typed.type == Variant::NIL && typed.type != Variant::OBJECT) {
 		// from variants to primitives
-		for (int i = 0; i < size; i++) {
+		for (int i = 0; i < first_mismatch; i++) {
+			data[i] = source[i];
+		}
+		for (int i = first_mismatch; i < size; i++) {
 			const Variant *value = source + i;
 			if (value->get_type() == typed.type) {
 				data[i] = *value;
@@ -289,6 +304,14 @@ void Array::push_back(const Variant &p_value) {
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
 
+	const ContainerTypeValidate &typed = _p->typed;
+	const ContainerTypeValidate &source_typed = p_array._p->typed;
+	if (typed.type == Variant::NIL || typed.can_reference(source_typed)) {
+		// The source elements are already guaranteed to match, skip per-element validation.
+		_p->array.append_array(p_array._p->array);
+		return;
+	}
+
 	Vector<Variant> validated_array = p_array._p->array;
 	for (int i = 0; i < validated_array.size(); ++i) {
 		ERR_FAIL_COND(!_p->typed.validate(validated_array.write[i], "append_array"));
@@ -33,6 +33,7 @@
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/variant/callable_bind.h"
 #include "core/variant/variant_callable.h"
 
@@ -128,7 +129,7 @@ Callable Callable::bindp(const Variant **p_arguments, int p_argcount) const {
 	for (int i = 0; i < p_argcount; i++) {
 		args.write[i] = *p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(CallableCustom::create<CallableCustomBind>(*this, args));
 }
 
 Callable Callable::bindv(const Array &p_arguments) {
@@ -141,12 +142,12 @@ Callable Callable::bindv(const Array &p_arguments) {
 	for (int i = 0; i < p_arguments.size(); i++) {
 		args.write[i] = p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(CallableCustom::create<CallableCustomBind>(*this, args));
 }
 
 Callable Callable::unbind(int p_argcount) const {
 	ERR_FAIL_COND_V_MSG(p_argcount <= 0, Callable(*this), "Amount of unbind() arguments must be 1 or greater.");
-	return Callable(memnew(CallableCustomUnbind(*this, p_argcount)));
+	return Callable(CallableCustom::create<CallableCustomUnbind>(*this, p_argcount));
 }
 
 bool Callable::is_valid() const {
@@ -323,7 +324,7 @@ void Callable::operator=(const Callable &p_callable) {
 		}
 
 		if (custom->ref_count.unref()) {
-			memdelete(custom);
+			CallableCustom::_free(custom);
 			custom = nullptr;
 		}
 	}
@@ -428,12 +429,72 @@ Callable::Callable(const Callable &p_callable) {
 Callable::~Callable() {
 	if (is_custom()) {
 		if (custom->ref_count.unref()) {
-			memdelete(custom);
+			CallableCustom::_free(custom);
 			custom = nullptr;
 		}
 	}
 }
 
+// Freed blocks are kept in a free list and never returned to the system, so the pool
+// stays at the peak number of live custom callables.
+struct CallableCustomPool {
+	struct Block {
+		Block *next;
+	};
+	static constexpr uint32_t BLOCKS_PER_CHUNK = 256;
+
+	SpinLock lock;
+	Block *free_list = nullptr;
+
+	void *alloc() {
+		lock.lock();
+		if (unlikely(!free_list)) {
+			uint8_t *chunk = (uint8_t *)Memory::alloc_static(CallableCustom::POOL_BLOCK_SIZE * BLOCKS_PER_CHUNK);
+			for (uint32_t i = 0; i < BLOCKS_PER_CHUNK; i++) {
+				Block *block = (Block *)(chunk + i * CallableCustom::POOL_BLOCK_SIZE);
+				block->next = free_list;
+				free_list = block;
+			}
+		}
+		Block *block = free_list;
+		free_list = block->next;
+		lock.unlock();
+		return block;
+	}
+
+	void free(void *p_ptr) {
+		Block *block = (Block *)p_ptr;
+		lock.lock();
+		block->next = free_list;
+		free_list = block;
+		lock.unlock();
+	}
+};
+
+// Intentionally leaked, custom callables held by static variables may be released after it would be destroyed.
+static CallableCustomPool *_get_callable_custom_pool() {
+	static CallableCustomPool *pool = memnew_placement(Memory::alloc_static(sizeof(CallableCustomPool)), CallableCustomPool);
+	return pool;
+}
+
+void *CallableCustom::_pool_alloc(size_t p_size) {
+	DEV_ASSERT(p_size <= POOL_BLOCK_SIZE);
+	return _get_callable_custom_pool()->alloc();
+}
+
+void CallableCustom::_pool_free(void *p_ptr) {
+	_get_callable_custom_pool()->free(p_ptr);
+}
+
+void CallableCustom::_free(CallableCustom *p_custom) {
+	if (p_custom->pooled) {
+		p_custom->~CallableCustom();
+		_pool_free(p_custom);
+	} else {
+		memdelete(p_custom);
+	}
+}
+
 bool CallableCustom::is_valid() const {
 	// Sensible default implementation so most custom callables don't need their own.
 	return ObjectDB::get_instance(get_object());
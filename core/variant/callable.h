@@ -140,8 +140,28 @@ class CallableCustom {
 	friend class Callable;
 	SafeRefCount ref_count;
 	bool referenced = false;
+	bool pooled = false;
+
+	static void *_pool_alloc(size_t p_size);
+	static void _pool_free(void *p_ptr);
+	static void _free(CallableCustom *p_custom);
 
 public:
+	// Small custom callables (method pointers, binds) are created and released constantly
+	// by signals and deferred calls, so their storage is recycled instead of hitting the allocator.
+	static constexpr size_t POOL_BLOCK_SIZE = 128;
+
+	template <typename T, typename... Args>
+	static T *create(Args &&...p_args) {
+		if constexpr (sizeof(T) <= POOL_BLOCK_SIZE) {
+			T *custom = memnew_placement(_pool_alloc(sizeof(T)), T(p_args...));
+			custom->pooled = true;
+			return custom;
+		} else {
+			return memnew(T(p_args...));
+		}
+	}
+
 	typedef bool (*CompareEqualFunc)(const CallableCustom *p_a, const CallableCustom *p_b);
 	typedef bool (*CompareLessFunc)(const CallableCustom *p_a, const CallableCustom *p_b);
 
@@ -478,6 +478,17 @@ public:
 
 template <typename T>
 class VariantConstructorToArray {
+	// Writes through one element pointer instead of going through the copy-on-write check for every element.
+	static _FORCE_INLINE_ void _fill(Array &r_dst, const T &p_src) {
+		int size = p_src.size();
+		r_dst.resize(size);
+		const auto *src = p_src.ptr();
+		Array::Iterator dst = r_dst.begin();
+		for (int i = 0; i < size; i++, ++dst) {
+			*dst = src[i];
+		}
+	}
+
 public:
 	static void construct(Variant &r_ret, const Variant **p_args, Callable::CallError &r_error) {
 		if (p_args[0]->get_type() != GetTypeInfo<T>::VARIANT_TYPE) {
@@ -491,11 +502,7 @@ public:
 		Array &dst_arr = *VariantGetInternalPtr<Array>::get_ptr(&r_ret);
 		const T &src_arr = *VariantGetInternalPtr<T>::get_ptr(p_args[0]);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 	}
 
 	static inline void validated_construct(Variant *r_ret, const Variant **p_args) {
@@ -503,21 +510,13 @@ public:
 		Array &dst_arr = *VariantGetInternalPtr<Array>::get_ptr(r_ret);
 		const T &src_arr = *VariantGetInternalPtr<T>::get_ptr(p_args[0]);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 	}
 	static void ptr_construct(void *base, const void **p_args) {
 		Array dst_arr;
 		T src_arr = PtrToArg<T>::convert(p_args[0]);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 
 		PtrConstruct<Array>::construct(dst_arr, base);
 	}
@@ -537,6 +536,16 @@ public:
 
 template <typename T>
 class VariantConstructorFromArray {
+	static _FORCE_INLINE_ void _fill(T &r_dst, const Array &p_src) {
+		int size = p_src.size();
+		r_dst.resize(size);
+		auto *dst = r_dst.ptrw();
+		Array::ConstIterator src = p_src.begin();
+		for (int i = 0; i < size; i++, ++src) {
+			dst[i] = *src;
+		}
+	}
+
 public:
 	static void construct(Variant &r_ret, const Variant **p_args, Callable::CallError &r_error) {
 		if (p_args[0]->get_type() != Variant::ARRAY) {
@@ -550,11 +559,7 @@ public:
 		const Array &src_arr = *VariantGetInternalPtr<Array>::get_ptr(p_args[0]);
 		T &dst_arr = *VariantGetInternalPtr<T>::get_ptr(&r_ret);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 	}
 
 	static inline void validated_construct(Variant *r_ret, const Variant **p_args) {
@@ -562,21 +567,13 @@ public:
 		const Array &src_arr = *VariantGetInternalPtr<Array>::get_ptr(p_args[0]);
 		T &dst_arr = *VariantGetInternalPtr<T>::get_ptr(r_ret);
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 	}
 	static void ptr_construct(void *base, const void **p_args) {
 		Array src_arr = PtrToArg<Array>::convert(p_args[0]);
 		T dst_arr;
 
-		int size = src_arr.size();
-		dst_arr.resize(size);
-		for (int i = 0; i < size; i++) {
-			dst_arr.write[i] = src_arr[i];
-		}
+		_fill(dst_arr, src_arr);
 
 		PtrConstruct<T>::construct(dst_arr, base);
 	}
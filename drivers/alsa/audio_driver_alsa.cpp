@@ -187,7 +187,7 @@ Error AudioDriverALSA::init() {
 
 	Error err = init_output_device();
 	if (err == OK) {
-		thread.start(AudioDriverALSA::thread_func, this);
+		thread.start(AudioDriverALSA::thread_func, this, _get_mix_thread_settings());
 	}
 
 	return err;
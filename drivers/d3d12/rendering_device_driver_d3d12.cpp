@@ -2107,9 +2107,8 @@ void RenderingDeviceDriverD3D12::command_pipeline_barrier(CommandBufferID p_cmd_
 
 	// The command list must support the required interface.
 	const CommandBufferInfo *cmd_buf_info = (const CommandBufferInfo *)(p_cmd_buffer.id);
-	ID3D12GraphicsCommandList7 *cmd_list_7 = nullptr;
-	HRESULT res = cmd_buf_info->cmd_list->QueryInterface(IID_PPV_ARGS(&cmd_list_7));
-	ERR_FAIL_COND(FAILED(res));
+	ID3D12GraphicsCommandList7 *cmd_list_7 = cmd_buf_info->cmd_list_7.Get();
+	ERR_FAIL_NULL(cmd_list_7);
 
 	// Convert the RDD barriers to D3D12 enhanced barriers.
 	thread_local LocalVector<D3D12_GLOBAL_BARRIER> global_barriers;
@@ -2363,6 +2362,11 @@ RDD::CommandBufferID RenderingDeviceDriverD3D12::command_buffer_create(CommandPo
 	CommandBufferInfo *cmd_buf_info = VersatileResource::allocate<CommandBufferInfo>(resources_allocator);
 	cmd_buf_info->cmd_allocator = cmd_allocator;
 	cmd_buf_info->cmd_list = cmd_list;
+	if (barrier_capabilities.enhanced_barriers_supported) {
+		// Query once here instead of on every barrier command.
+		HRESULT res = cmd_list->QueryInterface(cmd_buf_info->cmd_list_7.GetAddressOf());
+		ERR_FAIL_COND_V_MSG(!SUCCEEDED(res), CommandBufferID(), "QueryInterface for ID3D12GraphicsCommandList7 failed with error " + vformat("0x%08ux", (uint64_t)res) + ".");
+	}
 
 	return CommandBufferID(cmd_buf_info);
 }
@@ -2412,6 +2416,11 @@ void RenderingDeviceDriverD3D12::command_buffer_execute_secondary(CommandBufferI
 void RenderingDeviceDriverD3D12::_swap_chain_release(SwapChain *p_swap_chain) {
 	_swap_chain_release_buffers(p_swap_chain);
 
+	if (p_swap_chain->frame_latency_waitable_obj) {
+		CloseHandle(p_swap_chain->frame_latency_waitable_obj);
+		p_swap_chain->frame_latency_waitable_obj = nullptr;
+	}
+
 	p_swap_chain->d3d_swap_chain.Reset();
 }
 
@@ -2493,6 +2502,11 @@ Error RenderingDeviceDriverD3D12::swap_chain_resize(CommandQueueID p_cmd_queue,
 			break;
 	}
 
+	const bool wait_for_present = GLOBAL_GET("rendering/rendering_device/vsync/wait_for_present");
+	if (wait_for_present) {
+		creation_flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+	}
+
 	print_verbose("Using swap chain flags: " + itos(creation_flags) + ", sync interval: " + itos(sync_interval) + ", present flags: " + itos(present_flags));
 
 	if (swap_chain->d3d_swap_chain != nullptr && creation_flags != swap_chain->creation_flags) {
@@ -2548,6 +2562,13 @@ Error RenderingDeviceDriverD3D12::swap_chain_resize(CommandQueueID p_cmd_queue,
 	swap_chain->sync_interval = sync_interval;
 	swap_chain->present_flags = present_flags;
 
+	if (wait_for_present && !swap_chain->frame_latency_waitable_obj) {
+		// Only one frame may be queued for presentation, the lowest latency possible.
+		res = swap_chain->d3d_swap_chain->SetMaximumFrameLatency(1);
+		ERR_FAIL_COND_V(!SUCCEEDED(res), ERR_CANT_CREATE);
+		swap_chain->frame_latency_waitable_obj = swap_chain->d3d_swap_chain->GetFrameLatencyWaitableObject();
+	}
+
 	// Retrieve the render targets associated to the swap chain and recreate the framebuffers. The following code
 	// relies on the address of the elements remaining static when new elements are inserted, so the container must
 	// follow this restriction when reserving the right amount of elements beforehand.
@@ -2623,6 +2644,19 @@ void RenderingDeviceDriverD3D12::swap_chain_free(SwapChainID p_swap_chain) {
 	memdelete(swap_chain);
 }
 
+Error RenderingDeviceDriverD3D12::swap_chain_wait_for_present(SwapChainID p_swap_chain, uint64_t p_timeout_usec) {
+	SwapChain *swap_chain = (SwapChain *)(p_swap_chain.id);
+	if (!swap_chain->frame_latency_waitable_obj) {
+		return ERR_UNAVAILABLE;
+	}
+
+	DWORD res = WaitForSingleObjectEx(swap_chain->frame_latency_waitable_obj, (DWORD)(p_timeout_usec / 1000), FALSE);
+	if (res == WAIT_TIMEOUT) {
+		return ERR_TIMEOUT;
+	}
+	return (res == WAIT_OBJECT_0) ? OK : FAILED;
+}
+
 /*********************/
 /**** FRAMEBUFFER ****/
 /*********************/
@@ -4317,6 +4351,35 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 	set_heap_walkers.resources = uniform_set_info->desc_heaps.resources.make_walker();
 	set_heap_walkers.samplers = uniform_set_info->desc_heaps.samplers.make_walker();
 
+	// Descriptors are copied into the frame heaps in runs. Bindings whose descriptors are adjacent in the set heap
+	// are gathered into a single copy instead of issuing one call per binding. The frame heap side is always
+	// contiguous since it's only advanced while copying.
+	struct PendingCopy {
+		D3D12_CPU_DESCRIPTOR_HANDLE dst_handle = {};
+		D3D12_CPU_DESCRIPTOR_HANDLE src_handle = {};
+		uint32_t src_end_index = 0;
+		uint32_t count = 0;
+	};
+	PendingCopy pending_copies[2]; // Resources, samplers.
+	auto flush_pending_copy = [&](PendingCopy &r_copy, D3D12_DESCRIPTOR_HEAP_TYPE p_type) {
+		if (r_copy.count) {
+			device->CopyDescriptorsSimple(r_copy.count, r_copy.dst_handle, r_copy.src_handle, p_type);
+			r_copy.count = 0;
+		}
+	};
+	auto queue_copy = [&](PendingCopy &r_copy, D3D12_DESCRIPTOR_HEAP_TYPE p_type, DescriptorsHeap::Walker *r_frame_walker, DescriptorsHeap::Walker &r_set_walker, uint32_t p_count) {
+		if (r_copy.count && r_copy.src_end_index != r_set_walker.get_current_handle_index()) {
+			flush_pending_copy(r_copy, p_type);
+		}
+		if (!r_copy.count) {
+			r_copy.dst_handle = r_frame_walker->get_curr_cpu_handle();
+			r_copy.src_handle = r_set_walker.get_curr_cpu_handle();
+		}
+		r_copy.count += p_count;
+		r_copy.src_end_index = r_set_walker.get_current_handle_index() + p_count;
+		r_frame_walker->advance(p_count);
+	};
+
 #ifdef DEV_ENABLED
 	// Whether we have stages where the uniform is actually used should match
 	// whether we have any root signature locations for it.
@@ -4370,6 +4433,8 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 					}
 
 					if (unlikely(frame_heap_walkers.resources->get_free_handles() < num_resource_descs)) {
+						flush_pending_copy(pending_copies[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+						flush_pending_copy(pending_copies[1], D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
 						if (!frames[frame_idx].desc_heaps_exhausted_reported.resources) {
 							frames[frame_idx].desc_heaps_exhausted_reported.resources = true;
 							ERR_FAIL_MSG("Cannot bind uniform set because there's no enough room in current frame's RESOURCES descriptor heap.\n"
@@ -4392,13 +4457,7 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 						set_heap_walkers.resources.advance(num_resource_descs);
 					}
 
-					// TODO: Batch to avoid multiple calls where possible (in any case, flush before setting root descriptor tables, or even batch that as well).
-					device->CopyDescriptorsSimple(
-							num_resource_descs,
-							frame_heap_walkers.resources->get_curr_cpu_handle(),
-							set_heap_walkers.resources.get_curr_cpu_handle(),
-							D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-					frame_heap_walkers.resources->advance(num_resource_descs);
+					queue_copy(pending_copies[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, frame_heap_walkers.resources, set_heap_walkers.resources, num_resource_descs);
 
 					// If there is ambiguity and it didn't clarify as UAVs, skip them, which come later. [[SRV_UAV_AMBIGUITY]]
 					if (srv_uav_ambiguity && shader_set.bindings[i].res_class != RES_CLASS_UAV) {
@@ -4425,6 +4484,8 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 					}
 
 					if (unlikely(frame_heap_walkers.samplers->get_free_handles() < num_sampler_descs)) {
+						flush_pending_copy(pending_copies[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+						flush_pending_copy(pending_copies[1], D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
 						if (!frames[frame_idx].desc_heaps_exhausted_reported.samplers) {
 							frames[frame_idx].desc_heaps_exhausted_reported.samplers = true;
 							ERR_FAIL_MSG("Cannot bind uniform set because there's no enough room in current frame's SAMPLERS descriptors heap.\n"
@@ -4442,13 +4503,7 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 						tables.samplers->start_gpu_handle = frame_heap_walkers.samplers->get_curr_gpu_handle();
 					}
 
-					// TODO: Batch to avoid multiple calls where possible (in any case, flush before setting root descriptor tables, or even batch that as well).
-					device->CopyDescriptorsSimple(
-							num_sampler_descs,
-							frame_heap_walkers.samplers->get_curr_cpu_handle(),
-							set_heap_walkers.samplers.get_curr_cpu_handle(),
-							D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
-					frame_heap_walkers.samplers->advance(num_sampler_descs);
+					queue_copy(pending_copies[1], D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, frame_heap_walkers.samplers, set_heap_walkers.samplers, num_sampler_descs);
 				}
 			}
 		}
@@ -4471,6 +4526,9 @@ void RenderingDeviceDriverD3D12::_command_bind_uniform_set(CommandBufferID p_cmd
 	DEV_ASSERT(set_heap_walkers.resources.is_at_eof());
 	DEV_ASSERT(set_heap_walkers.samplers.is_at_eof());
 
+	flush_pending_copy(pending_copies[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	flush_pending_copy(pending_copies[1], D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+
 	{
 		bool must_flush_table = tables.resources;
 		if (must_flush_table) {
@@ -4908,21 +4966,227 @@ void RenderingDeviceDriverD3D12::command_bind_push_constants(CommandBufferID p_c
 
 // ----- CACHE -----
 
+static const uint32_t PIPELINE_CACHE_MAGIC = 0x44334c50; // "PL3D".
+
+int RenderingDeviceDriverD3D12::caching_instance_count = 0;
+
+RenderingDeviceDriverD3D12::PipelineCacheHeader RenderingDeviceDriverD3D12::_get_pipeline_cache_header() const {
+	PipelineCacheHeader header;
+	header.magic = PIPELINE_CACHE_MAGIC;
+	header.vendor_id = adapter_desc.VendorId;
+	header.device_id = adapter_desc.DeviceId;
+	header.subsys_id = adapter_desc.SubSysId;
+	header.revision = adapter_desc.Revision;
+	LARGE_INTEGER umd_version = {};
+	if (SUCCEEDED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &umd_version))) {
+		header.driver_version = umd_version.QuadPart;
+	}
+	header.driver_abi = sizeof(void *);
+	return header;
+}
+
+uint64_t RenderingDeviceDriverD3D12::_get_pipeline_cache_key(const CD3DX12_PIPELINE_STATE_STREAM &p_desc, const ShaderInfo *p_shader_info, const HashMap<ShaderStage, Vector<uint8_t>> &p_stages_bytecode, bool p_is_compute) const {
+	// The stream holds pointers and padding, so only its meaningful contents are hashed.
+	// Two differently seeded 32-bit hashes make up the key, to keep collisions unlikely across thousands of pipelines.
+	uint32_t h[2] = { HASH_MURMUR3_SEED, 0x9e3779b9 };
+	for (uint32_t &hash : h) {
+		hash = hash_murmur3_one_32(p_shader_info->root_signature_crc, hash);
+		for (const KeyValue<ShaderStage, Vector<uint8_t>> &E : p_stages_bytecode) {
+			hash = hash_murmur3_one_32(E.key, hash);
+			hash = hash_murmur3_buffer(E.value.ptr(), E.value.size(), hash);
+		}
+		if (p_is_compute) {
+			continue;
+		}
+
+		const D3D12_INPUT_LAYOUT_DESC &input_layout = *(&p_desc.InputLayout);
+		for (uint32_t i = 0; i < input_layout.NumElements; i++) {
+			const D3D12_INPUT_ELEMENT_DESC &ied = input_layout.pInputElementDescs[i];
+			hash = hash_murmur3_buffer(ied.SemanticName, strlen(ied.SemanticName), hash);
+			hash = hash_murmur3_one_32(ied.SemanticIndex, hash);
+			hash = hash_murmur3_one_32(ied.Format, hash);
+			hash = hash_murmur3_one_32(ied.InputSlot, hash);
+			hash = hash_murmur3_one_32(ied.AlignedByteOffset, hash);
+			hash = hash_murmur3_one_32(ied.InputSlotClass, hash);
+			hash = hash_murmur3_one_32(ied.InstanceDataStepRate, hash);
+		}
+
+		hash = hash_murmur3_one_32(p_desc.PrimitiveTopologyType, hash);
+		hash = hash_murmur3_one_32(p_desc.IBStripCutValue, hash);
+		hash = hash_murmur3_buffer((&p_desc.RasterizerState), sizeof(D3D12_RASTERIZER_DESC), hash);
+		hash = hash_murmur3_buffer((&p_desc.RTVFormats), sizeof(D3D12_RT_FORMAT_ARRAY), hash);
+		hash = hash_murmur3_one_32(p_desc.DSVFormat, hash);
+		hash = hash_murmur3_one_32((&p_desc.SampleDesc)->Count, hash);
+		hash = hash_murmur3_one_32((&p_desc.SampleDesc)->Quality, hash);
+		hash = hash_murmur3_one_32(p_desc.SampleMask, hash);
+
+		const D3D12_DEPTH_STENCIL_DESC1 &ds = *(&p_desc.DepthStencilState);
+		hash = hash_murmur3_one_32(ds.DepthEnable, hash);
+		hash = hash_murmur3_one_32(ds.DepthWriteMask, hash);
+		hash = hash_murmur3_one_32(ds.DepthFunc, hash);
+		hash = hash_murmur3_one_32(ds.StencilEnable, hash);
+		hash = hash_murmur3_one_32(ds.StencilReadMask, hash);
+		hash = hash_murmur3_one_32(ds.StencilWriteMask, hash);
+		const D3D12_DEPTH_STENCILOP_DESC *stencil_ops[2] = { &ds.FrontFace, &ds.BackFace };
+		for (const D3D12_DEPTH_STENCILOP_DESC *op : stencil_ops) {
+			hash = hash_murmur3_one_32(op->StencilFailOp, hash);
+			hash = hash_murmur3_one_32(op->StencilDepthFailOp, hash);
+			hash = hash_murmur3_one_32(op->StencilPassOp, hash);
+			hash = hash_murmur3_one_32(op->StencilFunc, hash);
+		}
+		hash = hash_murmur3_one_32(ds.DepthBoundsTestEnable, hash);
+
+		const D3D12_BLEND_DESC &bs = *(&p_desc.BlendState);
+		hash = hash_murmur3_one_32(bs.AlphaToCoverageEnable, hash);
+		hash = hash_murmur3_one_32(bs.IndependentBlendEnable, hash);
+		for (uint32_t i = 0; i < ARRAY_SIZE(bs.RenderTarget); i++) {
+			const D3D12_RENDER_TARGET_BLEND_DESC &bd = bs.RenderTarget[i];
+			hash = hash_murmur3_one_32(bd.BlendEnable, hash);
+			hash = hash_murmur3_one_32(bd.LogicOpEnable, hash);
+			hash = hash_murmur3_one_32(bd.SrcBlend, hash);
+			hash = hash_murmur3_one_32(bd.DestBlend, hash);
+			hash = hash_murmur3_one_32(bd.BlendOp, hash);
+			hash = hash_murmur3_one_32(bd.SrcBlendAlpha, hash);
+			hash = hash_murmur3_one_32(bd.DestBlendAlpha, hash);
+			hash = hash_murmur3_one_32(bd.BlendOpAlpha, hash);
+			hash = hash_murmur3_one_32(bd.LogicOp, hash);
+			hash = hash_murmur3_one_32(bd.RenderTargetWriteMask, hash);
+		}
+	}
+	return ((uint64_t)hash_fmix32(h[1]) << 32) | hash_fmix32(h[0]);
+}
+
+HRESULT RenderingDeviceDriverD3D12::_pipeline_state_create(ID3D12Device2 *p_device_2, const D3D12_PIPELINE_STATE_STREAM_DESC &p_desc, uint64_t p_key, ID3D12PipelineState **r_pso) {
+	if (!pipelines_cache.library) {
+		return p_device_2->CreatePipelineState(&p_desc, IID_PPV_ARGS(r_pso));
+	}
+
+	Char16String name = String::num_uint64(p_key, 16).utf16();
+
+	HRESULT res = E_FAIL;
+	{
+		MutexLock lock(pipelines_cache.mutex);
+		res = pipelines_cache.library->LoadPipeline((LPCWSTR)name.get_data(), &p_desc, IID_PPV_ARGS(r_pso));
+	}
+	if (SUCCEEDED(res)) {
+		return res;
+	}
+
+	// Not in the library yet (E_INVALIDARG), or stored for a different description; compile and keep it.
+	res = p_device_2->CreatePipelineState(&p_desc, IID_PPV_ARGS(r_pso));
+	if (SUCCEEDED(res)) {
+		MutexLock lock(pipelines_cache.mutex);
+		// Fails harmlessly if the name is already taken.
+		pipelines_cache.library->StorePipeline((LPCWSTR)name.get_data(), *r_pso);
+	}
+	return res;
+}
+
 bool RenderingDeviceDriverD3D12::pipeline_cache_create(const Vector<uint8_t> &p_data) {
-	WARN_PRINT("PSO caching is not implemented yet in the Direct3D 12 driver.");
-	return false;
+	if (caching_instance_count) {
+		WARN_PRINT("There's already a RenderingDeviceDriverD3D12 instance doing PSO caching. Only one can at the same time. This one won't.");
+		return false;
+	}
+
+	ComPtr<ID3D12Device1> device_1;
+	device->QueryInterface(device_1.GetAddressOf());
+	ComPtr<ID3D12Device2> device_2;
+	device->QueryInterface(device_2.GetAddressOf());
+	if (!device_1 || !device_2) {
+		print_verbose("D3D12: Pipeline libraries are not supported by this device. Pipelines won't be cached on disk.");
+		return false;
+	}
+
+	const PipelineCacheHeader current_header = _get_pipeline_cache_header();
+	pipelines_cache.library_data.clear();
+
+	// Parse.
+	if (p_data.is_empty()) {
+		// No pre-existing cache, just create it.
+	} else if (p_data.size() <= (int)sizeof(PipelineCacheHeader)) {
+		print_verbose("Invalid/corrupt D3D12 pipelines cache. Existing shader pipeline cache will be ignored, which may result in stuttering during gameplay.");
+	} else {
+		const PipelineCacheHeader *loaded_header = reinterpret_cast<const PipelineCacheHeader *>(p_data.ptr());
+		if (loaded_header->magic != PIPELINE_CACHE_MAGIC) {
+			print_verbose("Invalid D3D12 pipelines cache magic number. Existing shader pipeline cache will be ignored, which may result in stuttering during gameplay.");
+		} else {
+			const uint8_t *loaded_buffer_start = p_data.ptr() + sizeof(PipelineCacheHeader);
+			uint32_t loaded_buffer_size = p_data.size() - sizeof(PipelineCacheHeader);
+			if (loaded_header->data_hash != hash_murmur3_buffer(loaded_buffer_start, loaded_buffer_size) ||
+					loaded_header->data_size != loaded_buffer_size ||
+					loaded_header->vendor_id != current_header.vendor_id ||
+					loaded_header->device_id != current_header.device_id ||
+					loaded_header->subsys_id != current_header.subsys_id ||
+					loaded_header->revision != current_header.revision ||
+					loaded_header->driver_version != current_header.driver_version ||
+					loaded_header->driver_abi != current_header.driver_abi) {
+				print_verbose("Invalid D3D12 pipelines cache header. This may be due to an engine change, GPU change or graphics driver version change. Existing shader pipeline cache will be ignored, which may result in stuttering during gameplay.");
+			} else {
+				pipelines_cache.library_data = p_data;
+			}
+		}
+	}
+
+	// Create.
+	HRESULT res = E_FAIL;
+	if (!pipelines_cache.library_data.is_empty()) {
+		const uint8_t *library_blob = pipelines_cache.library_data.ptr() + sizeof(PipelineCacheHeader);
+		SIZE_T library_blob_size = pipelines_cache.library_data.size() - sizeof(PipelineCacheHeader);
+		res = device_1->CreatePipelineLibrary(library_blob, library_blob_size, IID_PPV_ARGS(pipelines_cache.library.GetAddressOf()));
+		if (!SUCCEEDED(res)) {
+			// The runtime does its own validation too (e.g., D3D12_ERROR_DRIVER_VERSION_MISMATCH).
+			print_verbose("D3D12 pipelines cache rejected by the driver with error " + vformat("0x%08ux", (uint64_t)res) + ". Existing shader pipeline cache will be ignored, which may result in stuttering during gameplay.");
+			pipelines_cache.library_data.clear();
+		}
+	}
+	if (!SUCCEEDED(res)) {
+		res = device_1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(pipelines_cache.library.GetAddressOf()));
+		if (!SUCCEEDED(res)) {
+			WARN_PRINT("CreatePipelineLibrary failed with error " + vformat("0x%08ux", (uint64_t)res) + ".");
+			return false;
+		}
+	}
+
+	pipelines_cache.buffer.resize(sizeof(PipelineCacheHeader));
+	*(PipelineCacheHeader *)pipelines_cache.buffer.ptrw() = current_header;
+
+	caching_instance_count++;
+	return true;
 }
 
 void RenderingDeviceDriverD3D12::pipeline_cache_free() {
-	ERR_FAIL_MSG("Not implemented.");
+	DEV_ASSERT(pipelines_cache.library);
+
+	pipelines_cache.library.Reset();
+	pipelines_cache.library_data.clear();
+	pipelines_cache.buffer.clear();
+
+	DEV_ASSERT(caching_instance_count > 0);
+	caching_instance_count--;
 }
 
 size_t RenderingDeviceDriverD3D12::pipeline_cache_query_size() {
-	ERR_FAIL_V_MSG(0, "Not implemented.");
+	DEV_ASSERT(pipelines_cache.library);
+
+	MutexLock lock(pipelines_cache.mutex);
+	return pipelines_cache.library->GetSerializedSize();
 }
 
 Vector<uint8_t> RenderingDeviceDriverD3D12::pipeline_cache_serialize() {
-	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Not implemented.");
+	DEV_ASSERT(pipelines_cache.library);
+
+	MutexLock lock(pipelines_cache.mutex);
+	SIZE_T size = pipelines_cache.library->GetSerializedSize();
+	pipelines_cache.buffer.resize(size + sizeof(PipelineCacheHeader));
+
+	HRESULT res = pipelines_cache.library->Serialize(pipelines_cache.buffer.ptrw() + sizeof(PipelineCacheHeader), size);
+	ERR_FAIL_COND_V_MSG(!SUCCEEDED(res), Vector<uint8_t>(), "ID3D12PipelineLibrary::Serialize failed with error " + vformat("0x%08ux", (uint64_t)res) + ".");
+
+	PipelineCacheHeader *header = (PipelineCacheHeader *)pipelines_cache.buffer.ptrw();
+	header->data_size = size;
+	header->data_hash = hash_murmur3_buffer(pipelines_cache.buffer.ptr() + sizeof(PipelineCacheHeader), size);
+
+	return pipelines_cache.buffer;
 }
 
 /*******************/
@@ -5843,7 +6107,8 @@ RDD::PipelineID RenderingDeviceDriverD3D12::render_pipeline_create(
 		D3D12_PIPELINE_STATE_STREAM_DESC pssd = {};
 		pssd.pPipelineStateSubobjectStream = &pipeline_desc;
 		pssd.SizeInBytes = sizeof(pipeline_desc);
-		res = device_2->CreatePipelineState(&pssd, IID_PPV_ARGS(&pso));
+		uint64_t key = pipelines_cache.library ? _get_pipeline_cache_key(pipeline_desc, shader_info_in, final_stages_bytecode, false) : 0;
+		res = _pipeline_state_create(device_2.Get(), pssd, key, &pso);
 	} else {
 		D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = pipeline_desc.GraphicsDescV0();
 		res = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pso));
@@ -5935,7 +6200,8 @@ RDD::PipelineID RenderingDeviceDriverD3D12::compute_pipeline_create(ShaderID p_s
 		D3D12_PIPELINE_STATE_STREAM_DESC pssd = {};
 		pssd.pPipelineStateSubobjectStream = &pipeline_desc;
 		pssd.SizeInBytes = sizeof(pipeline_desc);
-		res = device_2->CreatePipelineState(&pssd, IID_PPV_ARGS(&pso));
+		uint64_t key = pipelines_cache.library ? _get_pipeline_cache_key(pipeline_desc, shader_info_in, final_stages_bytecode, true) : 0;
+		res = _pipeline_state_create(device_2.Get(), pssd, key, &pso);
 	} else {
 		D3D12_COMPUTE_PIPELINE_STATE_DESC desc = pipeline_desc.ComputeDescV0();
 		res = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&pso));
@@ -6258,6 +6524,8 @@ bool RenderingDeviceDriverD3D12::has_feature(Features p_feature) {
 			return true;
 		case SUPPORTS_MESH_SHADER:
 			return mesh_shader_capabilities.is_supported;
+		case SUPPORTS_MULTI_DRAW_INDIRECT:
+			return true;
 		default:
 			return false;
 	}
@@ -485,6 +485,7 @@ private:
 	struct CommandBufferInfo {
 		ComPtr<ID3D12CommandAllocator> cmd_allocator;
 		ComPtr<ID3D12GraphicsCommandList> cmd_list;
+		ComPtr<ID3D12GraphicsCommandList7> cmd_list_7; // Only if enhanced barriers are supported.
 
 		ID3D12PipelineState *graphics_pso = nullptr;
 		ID3D12PipelineState *compute_pso = nullptr;
@@ -514,6 +515,7 @@ private:
 		UINT present_flags = 0;
 		UINT sync_interval = 1;
 		UINT creation_flags = 0;
+		HANDLE frame_latency_waitable_obj = nullptr; // Only if waiting for presents is enabled.
 		RenderPassID render_pass;
 		TightLocalVector<ID3D12Resource *> render_targets;
 		TightLocalVector<TextureInfo> render_targets_info;
@@ -531,6 +533,7 @@ public:
 	virtual RenderPassID swap_chain_get_render_pass(SwapChainID p_swap_chain) override;
 	virtual DataFormat swap_chain_get_format(SwapChainID p_swap_chain) override;
 	virtual void swap_chain_free(SwapChainID p_swap_chain) override;
+	virtual Error swap_chain_wait_for_present(SwapChainID p_swap_chain, uint64_t p_timeout_usec) override;
 
 	/*********************/
 	/**** FRAMEBUFFER ****/
@@ -809,7 +812,34 @@ public:
 	virtual void command_bind_push_constants(CommandBufferID p_cmd_buffer, ShaderID p_shader, uint32_t p_dst_first_index, VectorView<uint32_t> p_data) override final;
 
 	// ----- CACHE -----
+private:
+	struct PipelineCacheHeader {
+		uint32_t magic = 0;
+		uint32_t data_size = 0;
+		uint64_t data_hash = 0;
+		uint32_t vendor_id = 0;
+		uint32_t device_id = 0;
+		uint32_t subsys_id = 0;
+		uint32_t revision = 0;
+		uint64_t driver_version = 0;
+		uint8_t driver_abi = 0;
+	};
+
+	struct PipelineCache {
+		Vector<uint8_t> library_data; // Header then data. Referenced by the library for its whole lifetime, so never written to.
+		Vector<uint8_t> buffer; // Header then data, as last serialized.
+		ComPtr<ID3D12PipelineLibrary1> library;
+		Mutex mutex;
+	};
 
+	static int caching_instance_count;
+	PipelineCache pipelines_cache;
+
+	PipelineCacheHeader _get_pipeline_cache_header() const;
+	uint64_t _get_pipeline_cache_key(const CD3DX12_PIPELINE_STATE_STREAM &p_desc, const ShaderInfo *p_shader_info, const HashMap<ShaderStage, Vector<uint8_t>> &p_stages_bytecode, bool p_is_compute) const;
+	HRESULT _pipeline_state_create(ID3D12Device2 *p_device_2, const D3D12_PIPELINE_STATE_STREAM_DESC &p_desc, uint64_t p_key, ID3D12PipelineState **r_pso);
+
+public:
 	virtual bool pipeline_cache_create(const Vector<uint8_t> &p_data) override final;
 	virtual void pipeline_cache_free() override final;
 	virtual size_t pipeline_cache_query_size() override final;
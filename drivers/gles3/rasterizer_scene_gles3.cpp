@@ -1448,6 +1448,10 @@ void RasterizerSceneGLES3::_fill_render_list(RenderListType p_render_list, const
 			}
 
 			surf->sort.depth_layer = depth_layer;
+			surf->sort.uses_instancing = inst->instance_count >= 0;
+			surf->sort.uses_mesh_instance = inst->mesh_instance.is_valid();
+			surf->sort.mirror = inst->mirror;
+			surf->sort.uses_lightmap = inst->lightmap_instance.is_valid();
 			surf->finished_base_pass = false;
 			surf->light_pass_index = 0;
 
@@ -2875,6 +2879,102 @@ void RasterizerSceneGLES3::_render_post_processing(const RenderDataGLES3 *p_rend
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+template <PassMode p_pass_mode>
+bool RasterizerSceneGLES3::_can_auto_instance(const GeometryInstanceSurface *p_surf) const {
+	const GeometryInstanceGLES3 *inst = p_surf->owner;
+
+	// MultiMesh and particles are already instanced, and skinned meshes use their own vertex arrays.
+	if (inst->instance_count >= 0 || inst->mesh_instance.is_valid() || !inst->store_transform_cache) {
+		return false;
+	}
+
+	if constexpr (p_pass_mode == PASS_MODE_SHADOW) {
+		return p_surf->surface_shadow && !p_surf->shader_shadow->uses_instance_id;
+	} else {
+		if (!p_surf->surface || p_surf->shader->uses_instance_id) {
+			return false;
+		}
+	}
+
+	if constexpr (p_pass_mode == PASS_MODE_COLOR) {
+		// Per-instance lighting state is bound as uniforms, so only instances without any can share a draw.
+		if (!(p_surf->flags & GeometryInstanceSurface::FLAG_PASS_OPAQUE) || inst->light_passes.size() || inst->omni_light_gl_cache.size() || inst->spot_light_gl_cache.size() || inst->reflection_probe_rid_cache.size() || inst->lightmap_instance.is_valid() || inst->lightmap_sh) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <PassMode p_pass_mode>
+uint32_t RasterizerSceneGLES3::_fill_auto_instance_batch(const RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element) {
+	if (!GLES3::Config::get_singleton()->use_auto_instancing || p_params->force_wireframe || get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_OVERDRAW || get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_LIGHTING) {
+		return 0;
+	}
+
+	const GeometryInstanceSurface *surf = p_params->elements[p_from_element];
+	if (!_can_auto_instance<p_pass_mode>(surf)) {
+		return 0;
+	}
+
+	uint32_t to_element = p_from_element + 1;
+	for (; to_element < p_to_element; to_element++) {
+		const GeometryInstanceSurface *next = p_params->elements[to_element];
+		bool same_state;
+		if constexpr (p_pass_mode == PASS_MODE_SHADOW) {
+			same_state = next->surface_shadow == surf->surface_shadow && next->material_shadow == surf->material_shadow;
+		} else {
+			same_state = next->surface == surf->surface && next->material == surf->material;
+		}
+		same_state = same_state && next->lod_index == surf->lod_index && next->flags == surf->flags && next->owner->flags_cache == surf->owner->flags_cache && next->owner->mirror == surf->owner->mirror;
+
+		if (!same_state || !_can_auto_instance<p_pass_mode>(next)) {
+			break;
+		}
+	}
+
+	uint32_t count = to_element - p_from_element;
+	if (count < 2) {
+		return 0;
+	}
+
+	// Same layout as a 3D MultiMesh without color or custom data.
+	scene_state.auto_instance_data.resize(count * 12);
+	float *data = scene_state.auto_instance_data.ptr();
+	for (uint32_t i = 0; i < count; i++) {
+		const Transform3D &t = p_params->elements[p_from_element + i]->owner->transform;
+		for (int j = 0; j < 3; j++) {
+			data[j * 4 + 0] = t.basis.rows[j][0];
+			data[j * 4 + 1] = t.basis.rows[j][1];
+			data[j * 4 + 2] = t.basis.rows[j][2];
+			data[j * 4 + 3] = t.origin[j];
+		}
+		data += 12;
+	}
+
+	return count;
+}
+
+void RasterizerSceneGLES3::_upload_auto_instance_batch() {
+	uint32_t size = scene_state.auto_instance_data.size() * sizeof(float);
+
+	if (size > scene_state.auto_instance_buffer_size) {
+		if (scene_state.auto_instance_buffer != 0) {
+			GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.auto_instance_buffer);
+		}
+		scene_state.auto_instance_buffer_size = MAX(nearest_power_of_2_templated(size), 4096u);
+		glGenBuffers(1, &scene_state.auto_instance_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer, scene_state.auto_instance_buffer_size, nullptr, GL_STREAM_DRAW, "Auto-instancing buffer");
+	} else {
+		glBindBuffer(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer);
+		// Orphan the previous contents so the driver doesn't stall on draws still using them.
+		glBufferData(GL_ARRAY_BUFFER, scene_state.auto_instance_buffer_size, nullptr, GL_STREAM_DRAW);
+	}
+
+	glBufferSubData(GL_ARRAY_BUFFER, 0, size, scene_state.auto_instance_data.ptr());
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2891,6 +2991,10 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 	SceneShaderGLES3::ShaderVariant shader_variant = SceneShaderGLES3::MODE_COLOR; // Assigned to silence wrong -Wmaybe-initialized
 	uint64_t prev_spec_constants = 0;
 
+	// Per-surface uniforms only need to be set again when the surface, flags or bound shader change.
+	void *prev_uniform_surface = nullptr;
+	uint32_t prev_model_flags = 0;
+
 	// Specializations constants used by all instances in the scene.
 	uint64_t base_spec_constants = p_params->spec_constant_base_flags;
 
@@ -2962,6 +3066,12 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			continue;
 		}
 
+		// Consecutive draws of the same surface and material are merged into one instanced draw.
+		uint32_t auto_instance_count = 0;
+		if constexpr (p_pass_mode == PASS_MODE_COLOR || p_pass_mode == PASS_MODE_DEPTH || p_pass_mode == PASS_MODE_SHADOW) {
+			auto_instance_count = _fill_auto_instance_batch<p_pass_mode>(p_params, i, p_to_element);
+		}
+
 		//request a redraw if one of the shaders uses TIME
 		if (shader->uses_time) {
 			should_request_redraw = true;
@@ -3142,7 +3252,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			}
 
 			Transform3D world_transform;
-			if (inst->store_transform_cache) {
+			if (inst->store_transform_cache && auto_instance_count == 0) {
 				world_transform = inst->transform;
 			}
 
@@ -3153,8 +3263,8 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 
 			SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
 
-			if (inst->instance_count > 0) {
-				// Will need to use instancing to draw (either MultiMesh or Particles).
+			if (inst->instance_count > 0 || auto_instance_count > 0) {
+				// Will need to use instancing to draw (either MultiMesh, Particles or automatic instancing).
 				instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(instance_variant));
 			}
 
@@ -3281,6 +3391,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				prev_shader = shader;
 				prev_variant = instance_variant;
 				prev_spec_constants = spec_constants;
+				prev_uniform_surface = nullptr;
 			}
 
 			// Pass in lighting uniforms.
@@ -3422,7 +3533,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			}
 
 			material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::WORLD_TRANSFORM, world_transform, shader->version, instance_variant, spec_constants);
-			{
+			if (prev_uniform_surface != surf->surface || prev_model_flags != inst->flags_cache) {
 				GLES3::Mesh::Surface *s = reinterpret_cast<GLES3::Mesh::Surface *>(surf->surface);
 				if (s->format & RS::ARRAY_FLAG_COMPRESS_ATTRIBUTES) {
 					material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::COMPRESSED_AABB_POSITION, s->aabb.position, shader->version, instance_variant, spec_constants);
@@ -3433,9 +3544,12 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 					material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::COMPRESSED_AABB_SIZE, Vector3(1.0, 1.0, 1.0), shader->version, instance_variant, spec_constants);
 					material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::UV_SCALE, Vector4(0.0, 0.0, 0.0, 0.0), shader->version, instance_variant, spec_constants);
 				}
-			}
 
-			material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::MODEL_FLAGS, inst->flags_cache, shader->version, instance_variant, spec_constants);
+				material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::MODEL_FLAGS, inst->flags_cache, shader->version, instance_variant, spec_constants);
+
+				prev_uniform_surface = surf->surface;
+				prev_model_flags = inst->flags_cache;
+			}
 
 			if (p_pass_mode == PASS_MODE_MATERIAL) {
 				material_storage->shaders.scene_shader.version_set_uniform(SceneShaderGLES3::UV_OFFSET, p_params->uv_offset, shader->version, instance_variant, spec_constants);
@@ -3461,7 +3575,37 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				}
 			}
 
-			if (inst->instance_count > 0) {
+			if (auto_instance_count > 0) {
+				// Using automatic instancing, transforms only.
+				_upload_auto_instance_batch();
+
+				glEnableVertexAttribArray(12);
+				glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, 12 * sizeof(float), CAST_INT_TO_UCHAR_PTR(0));
+				glVertexAttribDivisor(12, 1);
+				glEnableVertexAttribArray(13);
+				glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, 12 * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 4));
+				glVertexAttribDivisor(13, 1);
+				glEnableVertexAttribArray(14);
+				glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, 12 * sizeof(float), CAST_INT_TO_UCHAR_PTR(sizeof(float) * 8));
+				glVertexAttribDivisor(14, 1);
+
+				// Default instance color of 1.0 and custom data of 0.0, same as a regular mesh.
+				uint16_t zero = Math::make_half_float(0.0f);
+				uint16_t one = Math::make_half_float(1.0f);
+				GLuint default_color = (uint32_t(one) << 16) | one;
+				GLuint default_custom = (uint32_t(zero) << 16) | zero;
+				glVertexAttribI4ui(15, default_color, default_color, default_custom, default_custom);
+
+				if (use_index_buffer) {
+					glDrawElementsInstanced(primitive_gl, count, mesh_storage->mesh_surface_get_index_type(mesh_surface), nullptr, auto_instance_count);
+				} else {
+					glDrawArraysInstanced(primitive_gl, 0, count, auto_instance_count);
+				}
+
+				glDisableVertexAttribArray(12);
+				glDisableVertexAttribArray(13);
+				glDisableVertexAttribArray(14);
+			} else if (inst->instance_count > 0) {
 				// Using MultiMesh or Particles.
 				// Bind instance buffers.
 
@@ -3543,6 +3687,11 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				scene_state.enable_gl_blend(false);
 			}
 		}
+
+		if (auto_instance_count > 0) {
+			// The rest of the batch was drawn along with this element.
+			i += auto_instance_count - 1;
+		}
 	}
 
 	// Make the actual redraw request
@@ -3554,7 +3703,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 void RasterizerSceneGLES3::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
 }
 
-void RasterizerSceneGLES3::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) {
+void RasterizerSceneGLES3::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_area) {
 	GLES3::ParticlesStorage *particles_storage = GLES3::ParticlesStorage::get_singleton();
 
 	ERR_FAIL_COND(!particles_storage->particles_collision_is_heightfield(p_collider));
@@ -4255,6 +4404,9 @@ RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 	GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.spot_light_buffer);
 	GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.positional_shadow_buffer);
 	GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.directional_shadow_buffer);
+	if (scene_state.auto_instance_buffer != 0) {
+		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.auto_instance_buffer);
+	}
 	memdelete_arr(scene_state.directional_lights);
 	memdelete_arr(scene_state.omni_lights);
 	memdelete_arr(scene_state.spot_lights);
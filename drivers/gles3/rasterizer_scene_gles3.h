@@ -256,9 +256,11 @@ private:
 
 				uint64_t material_id_hi : 16;
 				uint64_t shader_id : 32;
-				uint64_t uses_softshadow : 1;
-				uint64_t uses_projector : 1;
-				uint64_t uses_forward_gi : 1;
+				// GL state that forces a shader variant or cull change, kept above
+				// the shader so such switches are grouped together.
+				uint64_t uses_instancing : 1;
+				uint64_t uses_mesh_instance : 1;
+				uint64_t mirror : 1;
 				uint64_t uses_lightmap : 1;
 				uint64_t depth_layer : 4;
 				uint64_t priority : 8;
@@ -562,6 +564,11 @@ private:
 		DirectionalShadowData *directional_shadows = nullptr;
 		GLuint directional_shadow_buffer = 0;
 		RS::ShadowQuality directional_shadow_quality = RS::ShadowQuality::SHADOW_QUALITY_SOFT_LOW;
+
+		// Per-instance transforms for automatically instanced draws, uploaded once per batch.
+		LocalVector<float> auto_instance_data;
+		GLuint auto_instance_buffer = 0;
+		uint32_t auto_instance_buffer_size = 0;
 	} scene_state;
 
 	struct RenderListParameters {
@@ -645,6 +652,12 @@ private:
 	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, RenderingMethod::RenderInfo *p_render_info = nullptr, const Size2i &p_viewport_size = Size2i(1, 1), const Transform3D &p_main_cam_transform = Transform3D());
 	void _render_post_processing(const RenderDataGLES3 *p_render_data);
 
+	template <PassMode p_pass_mode>
+	_FORCE_INLINE_ bool _can_auto_instance(const GeometryInstanceSurface *p_surf) const;
+	template <PassMode p_pass_mode>
+	uint32_t _fill_auto_instance_batch(const RenderListParameters *p_params, uint32_t p_from_element, uint32_t p_to_element);
+	void _upload_auto_instance_batch();
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -830,7 +843,7 @@ public:
 
 	void render_scene(const Ref<RenderSceneBuffers> &p_render_buffers, const CameraData *p_camera_data, const CameraData *p_prev_camera_data, const PagedArray<RenderGeometryInstance *> &p_instances, const PagedArray<RID> &p_lights, const PagedArray<RID> &p_reflection_probes, const PagedArray<RID> &p_voxel_gi_instances, const PagedArray<RID> &p_decals, const PagedArray<RID> &p_lightmaps, const PagedArray<RID> &p_fog_volumes, RID p_environment, RID p_camera_attributes, RID p_compositor, RID p_shadow_atlas, RID p_occluder_debug_tex, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, const RenderShadowData *p_render_shadows, int p_render_shadow_count, const RenderHDDAGIData *p_render_hddagi_regions, int p_render_hddagi_region_count, const RenderHDDAGIUpdateData *p_hddagi_update_data = nullptr, RenderingMethod::RenderInfo *r_render_info = nullptr) override;
 	void render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override;
-	void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) override;
+	void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_area) override;
 
 	void set_scene_pass(uint64_t p_pass) override {
 		scene_pass = p_pass;
@@ -39,6 +39,8 @@
 #include "drivers/gles3/rasterizer_gles3.h"
 #include "drivers/gles3/storage/config.h"
 
+#define _GL_COMPLETION_STATUS_KHR 0x91B1
+
 static String _mkid(const String &p_id) {
 	String id = "m_" + p_id.replace("__", "_dus_");
 	return id.replace("__", "_dus_"); //doubleunderscore is reserved in glsl
@@ -296,10 +298,12 @@ void ShaderGLES3::_get_uniform_locations(Version::Specialization &spec, Version
 	glUseProgram(0);
 }
 
-void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization) {
+void ShaderGLES3::_compile_specialization_begin(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization) {
 	spec.id = glCreateProgram();
 	spec.ok = false;
-	GLint status;
+
+	// Compile and link without querying any status, so drivers supporting parallel compilation can do the work
+	// in the background. Errors are collected in _compile_specialization_finish().
 
 	//vertex stage
 	{
@@ -312,41 +316,6 @@ void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_
 		const char *cstr = cs.ptr();
 		glShaderSource(spec.vert_id, 1, &cstr, nullptr);
 		glCompileShader(spec.vert_id);
-
-		glGetShaderiv(spec.vert_id, GL_COMPILE_STATUS, &status);
-		if (status == GL_FALSE) {
-			GLsizei iloglen;
-			glGetShaderiv(spec.vert_id, GL_INFO_LOG_LENGTH, &iloglen);
-
-			if (iloglen < 0) {
-				glDeleteShader(spec.vert_id);
-				glDeleteProgram(spec.id);
-				spec.id = 0;
-
-				ERR_PRINT("No OpenGL vertex shader compiler log.");
-			} else {
-				if (iloglen == 0) {
-					iloglen = 4096; // buggy driver (Adreno 220+)
-				}
-
-				char *ilogmem = (char *)Memory::alloc_static(iloglen + 1);
-				memset(ilogmem, 0, iloglen + 1);
-				glGetShaderInfoLog(spec.vert_id, iloglen, &iloglen, ilogmem);
-
-				String err_string = name + ": Vertex shader compilation failed:\n";
-
-				err_string += ilogmem;
-
-				_display_error_with_code(err_string, builder_string);
-
-				Memory::free_static(ilogmem);
-				glDeleteShader(spec.vert_id);
-				glDeleteProgram(spec.id);
-				spec.id = 0;
-			}
-
-			ERR_FAIL();
-		}
 	}
 
 	//fragment stage
@@ -360,41 +329,6 @@ void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_
 		const char *cstr = cs.ptr();
 		glShaderSource(spec.frag_id, 1, &cstr, nullptr);
 		glCompileShader(spec.frag_id);
-
-		glGetShaderiv(spec.frag_id, GL_COMPILE_STATUS, &status);
-		if (status == GL_FALSE) {
-			GLsizei iloglen;
-			glGetShaderiv(spec.frag_id, GL_INFO_LOG_LENGTH, &iloglen);
-
-			if (iloglen < 0) {
-				glDeleteShader(spec.frag_id);
-				glDeleteProgram(spec.id);
-				spec.id = 0;
-
-				ERR_PRINT("No OpenGL fragment shader compiler log.");
-			} else {
-				if (iloglen == 0) {
-					iloglen = 4096; // buggy driver (Adreno 220+)
-				}
-
-				char *ilogmem = (char *)Memory::alloc_static(iloglen + 1);
-				memset(ilogmem, 0, iloglen + 1);
-				glGetShaderInfoLog(spec.frag_id, iloglen, &iloglen, ilogmem);
-
-				String err_string = name + ": Fragment shader compilation failed:\n";
-
-				err_string += ilogmem;
-
-				_display_error_with_code(err_string, builder_string);
-
-				Memory::free_static(ilogmem);
-				glDeleteShader(spec.frag_id);
-				glDeleteProgram(spec.id);
-				spec.id = 0;
-			}
-
-			ERR_FAIL();
-		}
 	}
 
 	glAttachShader(spec.id, spec.frag_id);
@@ -417,6 +351,65 @@ void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_
 	}
 
 	glLinkProgram(spec.id);
+}
+
+bool ShaderGLES3::_is_specialization_compile_done(const Version::Specialization &spec) const {
+	if (!parallel_compile) {
+		return true;
+	}
+
+	GLint done = GL_FALSE;
+	glGetProgramiv(spec.id, _GL_COMPLETION_STATUS_KHR, &done);
+	return done == GL_TRUE;
+}
+
+void ShaderGLES3::_compile_specialization_finish(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization) {
+	GLint status;
+
+	for (int i = 0; i < STAGE_TYPE_MAX; i++) {
+		GLuint shader_id = i == STAGE_TYPE_VERTEX ? spec.vert_id : spec.frag_id;
+		const char *stage_name = i == STAGE_TYPE_VERTEX ? "Vertex" : "Fragment";
+
+		glGetShaderiv(shader_id, GL_COMPILE_STATUS, &status);
+		if (status == GL_TRUE) {
+			continue;
+		}
+
+		GLsizei iloglen;
+		glGetShaderiv(shader_id, GL_INFO_LOG_LENGTH, &iloglen);
+
+		if (iloglen < 0) {
+			ERR_PRINT(vformat("No OpenGL %s shader compiler log.", String(stage_name).to_lower()));
+		} else {
+			if (iloglen == 0) {
+				iloglen = 4096; // buggy driver (Adreno 220+)
+			}
+
+			char *ilogmem = (char *)Memory::alloc_static(iloglen + 1);
+			memset(ilogmem, 0, iloglen + 1);
+			glGetShaderInfoLog(shader_id, iloglen, &iloglen, ilogmem);
+
+			String err_string = name + ": " + stage_name + " shader compilation failed:\n";
+
+			err_string += ilogmem;
+
+			// Only rebuild the source when it is needed for the error report.
+			StringBuilder builder;
+			_build_variant_code(builder, p_variant, p_version, StageType(i), p_specialization);
+			_display_error_with_code(err_string, builder.as_string());
+
+			Memory::free_static(ilogmem);
+		}
+
+		glDeleteShader(spec.vert_id);
+		glDeleteShader(spec.frag_id);
+		glDeleteProgram(spec.id);
+		spec.id = 0;
+		spec.vert_id = 0;
+		spec.frag_id = 0;
+
+		ERR_FAIL();
+	}
 
 	glGetProgramiv(spec.id, GL_LINK_STATUS, &status);
 	if (status == GL_FALSE) {
@@ -461,6 +454,69 @@ void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_
 	spec.ok = true;
 }
 
+void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization) {
+	_compile_specialization_begin(spec, p_variant, p_version, p_specialization);
+	_compile_specialization_finish(spec, p_variant, p_version, p_specialization);
+}
+
+ShaderGLES3::Version::Specialization *ShaderGLES3::_get_ready_specialization(Version *p_version, int p_variant, uint64_t p_specialization) {
+	Version::Specialization *spec = p_version->variants[p_variant].lookup_ptr(p_specialization);
+
+	if (!spec) {
+		Version::Specialization *fallback = p_version->variants[p_variant].lookup_ptr(specialization_default_mask);
+		if (parallel_compile && fallback && fallback->ok) {
+			// Start compiling in the background and draw with the default specialization until it's done.
+			Version::Specialization s;
+			_compile_specialization_begin(s, p_variant, p_version, p_specialization);
+			s.build_queued = true;
+			p_version->variants[p_variant].insert(p_specialization, s);
+			pending_compile_count++;
+			// Look it up again, inserting may have moved it.
+			return p_version->variants[p_variant].lookup_ptr(specialization_default_mask);
+		}
+
+		// Compile on the spot.
+		Version::Specialization s;
+		_compile_specialization(s, p_variant, p_version, p_specialization);
+		p_version->variants[p_variant].insert(p_specialization, s);
+		if (shader_cache_dir_valid) {
+			_save_to_cache(p_version);
+		}
+		return p_version->variants[p_variant].lookup_ptr(p_specialization);
+	}
+
+	if (spec->build_queued) {
+		if (!_is_specialization_compile_done(*spec)) {
+			// Still compiling, keep using the default specialization.
+			return p_version->variants[p_variant].lookup_ptr(specialization_default_mask);
+		}
+
+		_compile_specialization_finish(*spec, p_variant, p_version, p_specialization);
+		spec->build_queued = false;
+		pending_compile_count--;
+		if (shader_cache_dir_valid) {
+			_save_to_cache(p_version);
+		}
+	}
+
+	return spec;
+}
+
+void ShaderGLES3::version_precompile(RID p_version, int p_variant, uint64_t p_specialization) {
+	ERR_FAIL_INDEX(p_variant, variant_count);
+
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_NULL(version);
+
+	if (version->variants.size() == 0) {
+		_initialize_version(version);
+	}
+
+	// Queues the compilation (or compiles right away without parallel compilation support),
+	// or finishes it if it's already done.
+	_get_ready_specialization(version, p_variant, p_specialization);
+}
+
 RS::ShaderNativeSourceCode ShaderGLES3::version_get_native_source_code(RID p_version) {
 	Version *version = version_owner.get_or_null(p_version);
 	RS::ShaderNativeSourceCode source_code;
@@ -651,7 +707,8 @@ void ShaderGLES3::_save_to_cache(Version *p_version) {
 			f->store_64(specialization_key);
 
 			const Version::Specialization *specialization = it.value;
-			if (specialization == nullptr) {
+			if (specialization == nullptr || specialization->build_queued || !specialization->ok) {
+				// Still compiling or failed to compile, it will be saved once ready.
 				f->store_32(0);
 				continue;
 			}
@@ -702,12 +759,17 @@ void ShaderGLES3::_initialize_version(Version *p_version) {
 		return;
 	}
 	p_version->variants.reserve(variant_count);
+	LocalVector<Version::Specialization> specs;
+	specs.resize(variant_count);
+	// Issue all variants before checking any of them, so the driver can compile them in parallel.
+	for (int i = 0; i < variant_count; i++) {
+		_compile_specialization_begin(specs[i], i, p_version, specialization_default_mask);
+	}
 	for (int i = 0; i < variant_count; i++) {
 		OAHashMap<uint64_t, Version::Specialization> variant;
 		p_version->variants.push_back(variant);
-		Version::Specialization spec;
-		_compile_specialization(spec, i, p_version, specialization_default_mask);
-		p_version->variants[i].insert(specialization_default_mask, spec);
+		_compile_specialization_finish(specs[i], i, p_version, specialization_default_mask);
+		p_version->variants[i].insert(specialization_default_mask, specs[i]);
 	}
 	if (shader_cache_dir_valid) {
 		_save_to_cache(p_version);
@@ -805,6 +867,7 @@ void ShaderGLES3::initialize(const String &p_general_defines, int p_base_texture
 	GLES3::Config *config = GLES3::Config::get_singleton();
 	ERR_FAIL_NULL(config);
 	max_image_units = config->max_texture_image_units;
+	parallel_compile = config->parallel_shader_compile_supported;
 }
 
 void ShaderGLES3::set_shader_cache_dir(const String &p_dir) {
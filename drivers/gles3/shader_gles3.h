@@ -113,7 +113,11 @@ private:
 	Mutex variant_set_mutex;
 
 	void _get_uniform_locations(Version::Specialization &spec, Version *p_version);
+	void _compile_specialization_begin(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization);
+	void _compile_specialization_finish(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization);
 	void _compile_specialization(Version::Specialization &spec, uint32_t p_variant, Version *p_version, uint64_t p_specialization);
+	bool _is_specialization_compile_done(const Version::Specialization &spec) const;
+	Version::Specialization *_get_ready_specialization(Version *p_version, int p_variant, uint64_t p_specialization);
 
 	void _clear_version(Version *p_version);
 	void _initialize_version(Version *p_version);
@@ -150,6 +154,10 @@ private:
 
 	GLint max_image_units = 0;
 
+	// KHR_parallel_shader_compile is available, new specializations compile in the background.
+	bool parallel_compile = false;
+	uint32_t pending_compile_count = 0;
+
 	enum StageType {
 		STAGE_TYPE_VERTEX,
 		STAGE_TYPE_FRAGMENT,
@@ -198,24 +206,9 @@ protected:
 		}
 
 		Version::Specialization *spec = version->variants[p_variant].lookup_ptr(p_specialization);
-		if (!spec) {
-			if (false) {
-				// Queue load this specialization and use defaults in the meantime (TODO)
-
-				spec = version->variants[p_variant].lookup_ptr(specialization_default_mask);
-			} else {
-				// Compile on the spot
-				Version::Specialization s;
-				_compile_specialization(s, p_variant, version, p_specialization);
-				version->variants[p_variant].insert(p_specialization, s);
-				spec = version->variants[p_variant].lookup_ptr(p_specialization);
-				if (shader_cache_dir_valid) {
-					_save_to_cache(version);
-				}
-			}
-		} else if (spec->build_queued) {
-			// Still queued, wait
-			spec = version->variants[p_variant].lookup_ptr(specialization_default_mask);
+		if (!spec || spec->build_queued) {
+			// Compile, or use the default specialization while it compiles in the background.
+			spec = _get_ready_specialization(version, p_variant, p_specialization);
 		}
 
 		if (!spec || !spec->ok) {
@@ -235,6 +228,11 @@ protected:
 		ERR_FAIL_INDEX_V(p_variant, int(version->variants.size()), -1);
 		Version::Specialization *spec = version->variants[p_variant].lookup_ptr(p_specialization);
 		ERR_FAIL_NULL_V(spec, -1);
+		if (unlikely(spec->build_queued)) {
+			// The default specialization is bound while this one compiles.
+			spec = version->variants[p_variant].lookup_ptr(specialization_default_mask);
+			ERR_FAIL_NULL_V(spec, -1);
+		}
 		ERR_FAIL_INDEX_V(p_which, int(spec->uniform_location.size()), -1);
 		return spec->uniform_location[p_which];
 	}
@@ -250,6 +248,10 @@ public:
 
 	bool version_free(RID p_version);
 
+	// Starts compiling a specialization ahead of its first use, e.g. during a loading screen.
+	void version_precompile(RID p_version, int p_variant, uint64_t p_specialization);
+	uint32_t get_pending_compile_count() const { return pending_compile_count; }
+
 	static void set_shader_cache_dir(const String &p_dir);
 	static void set_shader_cache_save_compressed(bool p_enable);
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
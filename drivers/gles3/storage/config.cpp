@@ -171,6 +171,11 @@ Config::Config() {
 	force_vertex_shading = false; //GLOBAL_GET("rendering/quality/shading/force_vertex_shading");
 	use_nearest_mip_filter = GLOBAL_GET("rendering/textures/default_filters/use_nearest_mipmap_filter");
 
+	use_auto_instancing = bool(GLOBAL_GET("rendering/gl_compatibility/auto_instancing"));
+
+	parallel_shader_compile_supported = extensions.has("GL_KHR_parallel_shader_compile") || extensions.has("GL_ARB_parallel_shader_compile");
+	parallel_shader_compile_supported = parallel_shader_compile_supported && bool(GLOBAL_GET("rendering/gl_compatibility/parallel_shader_compile"));
+
 	use_depth_prepass = bool(GLOBAL_GET("rendering/driver/depth_prepass/enable"));
 	if (use_depth_prepass) {
 		String vendors = GLOBAL_GET("rendering/driver/depth_prepass/disable_for_vendors");
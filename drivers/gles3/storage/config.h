@@ -56,6 +56,8 @@ private:
 public:
 	bool use_nearest_mip_filter = false;
 	bool use_depth_prepass = true;
+	bool use_auto_instancing = true;
+	bool parallel_shader_compile_supported = false;
 
 	GLint max_vertex_texture_image_units = 0;
 	GLint max_texture_image_units = 0;
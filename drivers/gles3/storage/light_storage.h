@@ -185,6 +185,7 @@ struct Lightmap {
 	PackedColorArray point_sh;
 	PackedInt32Array tetrahedra;
 	PackedInt32Array bsp_tree;
+	LocalVector<int32_t> tetrahedra_neighbors;
 
 	struct BSP {
 		static const int32_t EMPTY_LEAF = INT32_MIN;
@@ -728,7 +729,7 @@ public:
 	virtual PackedInt32Array lightmap_get_probe_capture_tetrahedra(RID p_lightmap) const override;
 	virtual PackedInt32Array lightmap_get_probe_capture_bsp_tree(RID p_lightmap) const override;
 	virtual AABB lightmap_get_aabb(RID p_lightmap) const override;
-	virtual void lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh) override;
+	virtual void lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh, int32_t *r_tetrahedron = nullptr) override;
 	virtual bool lightmap_is_interior(RID p_lightmap) const override;
 	virtual void lightmap_set_probe_capture_update_speed(float p_speed) override;
 	virtual float lightmap_get_probe_capture_update_speed() const override;
@@ -2934,6 +2934,7 @@ void SceneShaderData::set_code(const String &p_code, RID p_shader_template) {
 	uses_color = false;
 	uses_uv = false;
 	uses_uv2 = false;
+	uses_instance_id = false;
 	uses_custom0 = false;
 	uses_custom1 = false;
 	uses_custom2 = false;
@@ -3014,6 +3015,7 @@ void SceneShaderData::set_code(const String &p_code, RID p_shader_template) {
 	actions.usage_flag_pointers["COLOR"] = &uses_color;
 	actions.usage_flag_pointers["UV"] = &uses_uv;
 	actions.usage_flag_pointers["UV2"] = &uses_uv2;
+	actions.usage_flag_pointers["INSTANCE_ID"] = &uses_instance_id;
 	actions.usage_flag_pointers["CUSTOM0"] = &uses_custom0;
 	actions.usage_flag_pointers["CUSTOM1"] = &uses_custom1;
 	actions.usage_flag_pointers["CUSTOM2"] = &uses_custom2;
@@ -332,6 +332,7 @@ struct SceneShaderData : public ShaderData {
 	bool uses_color;
 	bool uses_uv;
 	bool uses_uv2;
+	bool uses_instance_id;
 	bool uses_custom0;
 	bool uses_custom1;
 	bool uses_custom2;
@@ -355,6 +355,7 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 	s->mesh_to_skeleton_xform = p_surface.mesh_to_skeleton_xform;
 
 	s->uv_scale = new_surface.uv_scale;
+	s->cluster_data = new_surface.cluster_data; // Not used by this renderer, only kept for mesh_get_surface().
 
 	if (new_surface.skin_data.size() || mesh->blend_shape_count > 0) {
 		// Size must match the size of the vertex array.
@@ -584,6 +585,7 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	}
 
 	sd.uv_scale = s.uv_scale;
+	sd.cluster_data = s.cluster_data;
 
 	return sd;
 }
@@ -669,6 +671,11 @@ AABB MeshStorage::mesh_get_aabb(RID p_mesh, RID p_skeleton) {
 					}
 				}
 			} else {
+				thread_local LocalVector<AABB> bone_aabbs;
+				thread_local LocalVector<Transform3D> bone_xforms;
+				bone_aabbs.clear();
+				bone_xforms.clear();
+
 				for (int j = 0; j < bs; j++) {
 					if (skbones[j].size == Vector3(-1, -1, -1)) {
 						continue; //bone is unused
@@ -691,10 +698,15 @@ AABB MeshStorage::mesh_get_aabb(RID p_mesh, RID p_skeleton) {
 					mtx.basis.rows[2][2] = dataptr[10];
 					mtx.origin.z = dataptr[11];
 
-					// Transform bounds to skeleton's space before applying animation data.
-					AABB baabb = surface.mesh_to_skeleton_xform.xform(skbones[j]);
-					baabb = mtx.xform(baabb);
+					bone_aabbs.push_back(skbones[j]);
+					bone_xforms.push_back(mtx);
+				}
+
+				// Transform bounds to skeleton's space before applying animation data.
+				surface.mesh_to_skeleton_xform.xform_array(bone_aabbs.ptr(), bone_aabbs.ptr(), bone_aabbs.size());
+				AABB::xform_batch(bone_xforms.ptr(), bone_aabbs.ptr(), bone_aabbs.ptr(), bone_aabbs.size());
 
+				for (const AABB &baabb : bone_aabbs) {
 					if (!found_bone_aabb) {
 						laabb = baabb;
 						found_bone_aabb = true;
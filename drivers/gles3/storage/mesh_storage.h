@@ -112,6 +112,8 @@ struct Mesh {
 
 		Vector4 uv_scale;
 
+		Vector<uint8_t> cluster_data;
+
 		struct BlendShape {
 			GLuint vertex_buffer = 0;
 			GLuint vertex_array = 0;
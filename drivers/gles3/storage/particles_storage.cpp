@@ -38,6 +38,7 @@
 #include "texture_storage.h"
 #include "utilities.h"
 
+#include "core/config/project_settings.h"
 #include "servers/rendering/rendering_server_default.h"
 
 using namespace GLES3;
@@ -52,6 +53,8 @@ ParticlesStorage::ParticlesStorage() {
 	singleton = this;
 	GLES3::MaterialStorage *material_storage = GLES3::MaterialStorage::get_singleton();
 
+	particles_budget = GLOBAL_GET("rendering/limits/particles/max_gpu_particles");
+
 	{
 		String global_defines;
 		global_defines += "#define MAX_GLOBAL_SHADER_UNIFORMS 256\n"; // TODO: this is arbitrary for now
@@ -206,6 +209,13 @@ void ParticlesStorage::particles_set_amount_ratio(RID p_particles, float p_amoun
 	particles->amount_ratio = p_amount_ratio;
 }
 
+void ParticlesStorage::particles_set_lod_threshold(RID p_particles, float p_threshold) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	particles->lod_threshold = p_threshold;
+}
+
 void ParticlesStorage::particles_set_lifetime(RID p_particles, double p_lifetime) {
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL(particles);
@@ -378,6 +388,13 @@ void ParticlesStorage::particles_request_process(RID p_particles) {
 	}
 }
 
+void ParticlesStorage::particles_set_lod_screen_size(RID p_particles, float p_screen_size) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	particles->lod_screen_size = MAX(particles->lod_screen_size, p_screen_size);
+}
+
 AABB ParticlesStorage::particles_get_current_aabb(RID p_particles) {
 	const Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL_V(particles, AABB());
@@ -535,7 +552,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 
 	frame_params.cycle = p_particles->cycle_number;
 	frame_params.frame = p_particles->frame_counter++;
-	frame_params.amount_ratio = p_particles->amount_ratio;
+	frame_params.amount_ratio = p_particles->amount_ratio * p_particles->lod_amount_ratio;
 	frame_params.pad1 = 0;
 	frame_params.pad2 = 0;
 	frame_params.interp_to_end = p_particles->interp_to_end;
@@ -1020,6 +1037,33 @@ void ParticlesStorage::update_particles() {
 	glBindBufferBase(GL_UNIFORM_BUFFER, PARTICLES_GLOBALS_UNIFORM_LOCATION, global_buffer);
 	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
+	{
+		// Resolve the LOD of every 3D emitter from the screen size reported last frame, then scale them all down evenly if they exceed the budget.
+		double budget_total = 0.0;
+		for (SelfList<Particles> *E = particle_update_list.first(); E; E = E->next()) {
+			Particles *particles = E->self();
+			if (particles->mode != RS::PARTICLES_MODE_3D) {
+				particles->lod_amount_ratio = 1.0;
+				particles->lod_update_interval = 1;
+				continue;
+			}
+			_particles_get_lod(particles->lod_threshold, particles->lod_screen_size, particles->lod_amount_ratio, particles->lod_update_interval);
+			particles->lod_screen_size = -1.0;
+			if (!particles->inactive || particles->emitting) {
+				budget_total += particles->amount * particles->amount_ratio * particles->lod_amount_ratio;
+			}
+		}
+
+		if (particles_budget > 0 && budget_total > particles_budget) {
+			float budget_scale = particles_budget / budget_total;
+			for (SelfList<Particles> *E = particle_update_list.first(); E; E = E->next()) {
+				if (E->self()->mode == RS::PARTICLES_MODE_3D) {
+					E->self()->lod_amount_ratio *= budget_scale;
+				}
+			}
+		}
+	}
+
 	while (particle_update_list.first()) {
 		// Use transform feedback to process particles.
 
@@ -1061,6 +1105,16 @@ void ParticlesStorage::update_particles() {
 			}
 		}
 
+		// Emitters that are small on screen are simulated every few frames with the accumulated time.
+		particles->lod_skipped_time += RSG::rasterizer->get_frame_delta_time();
+		particles->lod_skipped_frames++;
+		if (particles->lod_skipped_frames < particles->lod_update_interval && !particles->clear) {
+			continue;
+		}
+		double frame_delta = particles->lod_skipped_time;
+		particles->lod_skipped_frames = 0;
+		particles->lod_skipped_time = 0.0;
+
 		// Copy the instance buffer that was last used into the last_frame buffer.
 		// sort_buffer should now be 2 frames out of date.
 		if (particles->draw_order == RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH || particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME) {
@@ -1113,9 +1167,10 @@ void ParticlesStorage::update_particles() {
 				frame_time = 1.0 / fixed_fps;
 				decr = frame_time;
 			}
-			double delta = RSG::rasterizer->get_frame_delta_time();
-			if (delta > 0.1) { //avoid recursive stalls if fps goes below 10
-				delta = 0.1;
+			double delta = frame_delta;
+			double max_delta = 0.1 * particles->lod_update_interval;
+			if (delta > max_delta) { //avoid recursive stalls if fps goes below 10
+				delta = max_delta;
 			} else if (delta <= 0.0) { //unlikely but..
 				delta = 0.001;
 			}
@@ -1132,7 +1187,7 @@ void ParticlesStorage::update_particles() {
 			if (zero_time_scale) {
 				_particles_process(particles, 0.0);
 			} else {
-				_particles_process(particles, RSG::rasterizer->get_frame_delta_time());
+				_particles_process(particles, frame_delta);
 			}
 		}
 
@@ -157,6 +157,16 @@ private:
 		float amount_ratio = 1.0;
 		int amount = 0;
 		double lifetime = 1.0;
+
+		// Screen size below which emission and update rate are reduced, 0 disables LOD.
+		float lod_threshold = 0.0;
+		// Largest screen size reported by the cameras since the last update, negative if none did.
+		float lod_screen_size = -1.0;
+		float lod_amount_ratio = 1.0;
+		uint32_t lod_update_interval = 1;
+		uint32_t lod_skipped_frames = 0;
+		double lod_skipped_time = 0.0;
+
 		double pre_process_time = 0.0;
 		real_t explosiveness = 0.0;
 		real_t randomness = 0.0;
@@ -270,6 +280,9 @@ private:
 
 	SelfList<Particles>::List particle_update_list;
 
+	// Maximum amount of 3D particles simulated per frame, 0 means unlimited.
+	int particles_budget = 0;
+
 	mutable RID_Owner<Particles, true> particles_owner;
 
 	/* Particles Collision */
@@ -323,6 +336,7 @@ public:
 	virtual void particles_set_emitting(RID p_particles, bool p_emitting) override;
 	virtual void particles_set_amount(RID p_particles, int p_amount) override;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) override;
+	virtual void particles_set_lod_threshold(RID p_particles, float p_threshold) override;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) override;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) override;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) override;
@@ -353,6 +367,7 @@ public:
 	virtual void particles_set_draw_pass_mesh(RID p_particles, int p_pass, RID p_mesh) override;
 
 	virtual void particles_request_process(RID p_particles) override;
+	virtual void particles_set_lod_screen_size(RID p_particles, float p_screen_size) override;
 	virtual AABB particles_get_current_aabb(RID p_particles) override;
 	virtual AABB particles_get_aabb(RID p_particles) const override;
 
@@ -364,7 +364,7 @@ Error AudioDriverPulseAudio::init() {
 	}
 
 	init_output_device();
-	thread.start(AudioDriverPulseAudio::thread_func, this);
+	thread.start(AudioDriverPulseAudio::thread_func, this, _get_mix_thread_settings());
 
 	return OK;
 }
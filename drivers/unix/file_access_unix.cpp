@@ -282,6 +282,20 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+void FileAccessUnix::prefetch(uint64_t p_position, uint64_t p_length) const {
+	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
+
+	// Only a hint, the kernel queues the reads and returns immediately.
+#if defined(__APPLE__)
+	struct radvisory advisory;
+	advisory.ra_offset = p_position;
+	advisory.ra_count = (int)MIN(p_length, (uint64_t)INT32_MAX);
+	fcntl(fileno(f), F_RDADVISE, &advisory);
+#elif !defined(WEB_ENABLED)
+	posix_fadvise(fileno(f), p_position, p_length, POSIX_FADV_WILLNEED);
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
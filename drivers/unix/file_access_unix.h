@@ -72,6 +72,7 @@ public:
 	virtual uint32_t get_32() const override;
 	virtual uint64_t get_64() const override;
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual void prefetch(uint64_t p_position, uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
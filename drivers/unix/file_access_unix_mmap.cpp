@@ -0,0 +1,294 @@
+/**************************************************************************/
+/*  file_access_unix_mmap.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_unix_mmap.h"
+
+#if defined(UNIX_ENABLED)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+Mutex FileAccessUnixMMap::mappings_mutex;
+HashMap<String, FileAccessUnixMMap::Mapping *> FileAccessUnixMMap::mappings;
+
+Error FileAccessUnixMMap::open_internal(const String &p_path, int p_mode_flags) {
+	_close();
+
+	path_src = p_path;
+	path = fix_path(p_path);
+
+	// Mappings are shared between every open instance, they can never be written to.
+	if (p_mode_flags != READ) {
+		return ERR_UNAVAILABLE;
+	}
+
+	int fd = ::open(path.utf8().get_data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		switch (errno) {
+			case ENOENT: {
+				return ERR_FILE_NOT_FOUND;
+			} break;
+			default: {
+				return ERR_FILE_CANT_OPEN;
+			} break;
+		}
+	}
+
+	struct stat st = {};
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+		// Empty files can't be mapped, let the caller fall back to a regular file.
+		::close(fd);
+		return ERR_FILE_CANT_OPEN;
+	}
+
+	MutexLock lock(mappings_mutex);
+
+	HashMap<String, Mapping *>::Iterator E = mappings.find(path);
+	if (E) {
+		Mapping *m = E->value;
+		if (m->device == st.st_dev && m->inode == st.st_ino && m->length == (uint64_t)st.st_size && m->modified_time == (uint64_t)st.st_mtime) {
+			m->refcount++;
+			mapping = m;
+		}
+	}
+
+	if (!mapping) {
+		void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			::close(fd);
+			return ERR_FILE_CANT_OPEN;
+		}
+
+		// A previous mapping of a file that has since changed stays alive until its last user closes it.
+		mapping = memnew(Mapping);
+		mapping->path = path;
+		mapping->data = (uint8_t *)data;
+		mapping->length = st.st_size;
+		mapping->device = st.st_dev;
+		mapping->inode = st.st_ino;
+		mapping->modified_time = st.st_mtime;
+		mapping->refcount = 1;
+		mappings[path] = mapping;
+	}
+
+	// The mapping stays valid after the descriptor is closed.
+	::close(fd);
+
+	pos = 0;
+	eof = false;
+	return OK;
+}
+
+void FileAccessUnixMMap::_close() {
+	if (!mapping) {
+		return;
+	}
+
+	MutexLock lock(mappings_mutex);
+
+	mapping->refcount--;
+	if (mapping->refcount == 0) {
+		HashMap<String, Mapping *>::Iterator E = mappings.find(mapping->path);
+		if (E && E->value == mapping) {
+			mappings.remove(E);
+		}
+		munmap(mapping->data, mapping->length);
+		memdelete(mapping);
+	}
+	mapping = nullptr;
+}
+
+bool FileAccessUnixMMap::is_open() const {
+	return mapping != nullptr;
+}
+
+String FileAccessUnixMMap::get_path() const {
+	return path_src;
+}
+
+String FileAccessUnixMMap::get_path_absolute() const {
+	return path;
+}
+
+void FileAccessUnixMMap::seek(uint64_t p_position) {
+	ERR_FAIL_NULL_MSG(mapping, "File must be opened before use.");
+
+	pos = p_position;
+	eof = false;
+}
+
+void FileAccessUnixMMap::seek_end(int64_t p_position) {
+	ERR_FAIL_NULL_MSG(mapping, "File must be opened before use.");
+
+	pos = mapping->length + p_position;
+	eof = false;
+}
+
+uint64_t FileAccessUnixMMap::get_position() const {
+	ERR_FAIL_NULL_V_MSG(mapping, 0, "File must be opened before use.");
+
+	return pos;
+}
+
+uint64_t FileAccessUnixMMap::get_length() const {
+	ERR_FAIL_NULL_V_MSG(mapping, 0, "File must be opened before use.");
+
+	return mapping->length;
+}
+
+bool FileAccessUnixMMap::eof_reached() const {
+	return eof;
+}
+
+uint8_t FileAccessUnixMMap::get_8() const {
+	ERR_FAIL_NULL_V_MSG(mapping, 0, "File must be opened before use.");
+
+	if (pos >= mapping->length) {
+		eof = true;
+		return 0;
+	}
+	return mapping->data[pos++];
+}
+
+uint16_t FileAccessUnixMMap::get_16() const {
+	uint16_t b = 0;
+	get_buffer((uint8_t *)&b, 2);
+
+	if (big_endian) {
+		b = BSWAP16(b);
+	}
+
+	return b;
+}
+
+uint32_t FileAccessUnixMMap::get_32() const {
+	uint32_t b = 0;
+	get_buffer((uint8_t *)&b, 4);
+
+	if (big_endian) {
+		b = BSWAP32(b);
+	}
+
+	return b;
+}
+
+uint64_t FileAccessUnixMMap::get_64() const {
+	uint64_t b = 0;
+	get_buffer((uint8_t *)&b, 8);
+
+	if (big_endian) {
+		b = BSWAP64(b);
+	}
+
+	return b;
+}
+
+uint64_t FileAccessUnixMMap::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	ERR_FAIL_NULL_V_MSG(mapping, -1, "File must be opened before use.");
+
+	if (pos >= mapping->length) {
+		eof = true;
+		return 0;
+	}
+
+	uint64_t to_read = MIN(p_length, mapping->length - pos);
+	memcpy(p_dst, mapping->data + pos, to_read);
+	pos += to_read;
+
+	if (to_read < p_length) {
+		eof = true;
+	}
+	return to_read;
+}
+
+const uint8_t *FileAccessUnixMMap::get_mapped_data() const {
+	ERR_FAIL_NULL_V_MSG(mapping, nullptr, "File must be opened before use.");
+
+	return mapping->data;
+}
+
+void FileAccessUnixMMap::prefetch(uint64_t p_position, uint64_t p_length) const {
+	ERR_FAIL_NULL_MSG(mapping, "File must be opened before use.");
+
+	if (p_position >= mapping->length) {
+		return;
+	}
+	p_length = MIN(p_length, mapping->length - p_position);
+
+	// madvise() needs a page aligned start.
+	static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	uint64_t start = p_position - (p_position % page_size);
+	madvise(mapping->data + start, p_length + (p_position - start), MADV_WILLNEED);
+}
+
+Error FileAccessUnixMMap::get_error() const {
+	return eof ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessUnixMMap::store_8(uint8_t p_dest) {
+	ERR_FAIL_MSG("Memory-mapped files are read-only.");
+}
+
+void FileAccessUnixMMap::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_MSG("Memory-mapped files are read-only.");
+}
+
+bool FileAccessUnixMMap::file_exists(const String &p_path) {
+	String filename = fix_path(p_path);
+	struct stat st = {};
+	if (stat(filename.utf8().get_data(), &st) != 0) {
+		return false;
+	}
+	return S_ISREG(st.st_mode);
+}
+
+uint64_t FileAccessUnixMMap::_get_modified_time(const String &p_file) {
+	String filename = fix_path(p_file);
+	struct stat st = {};
+	if (stat(filename.utf8().get_data(), &st) != 0) {
+		return 0;
+	}
+	return st.st_mtime;
+}
+
+void FileAccessUnixMMap::close() {
+	_close();
+}
+
+FileAccessUnixMMap::~FileAccessUnixMMap() {
+	_close();
+}
+
+#endif // UNIX_ENABLED
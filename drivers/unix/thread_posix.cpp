@@ -39,6 +39,15 @@
 #include <pthread_np.h>
 #endif
 
+#include <pthread.h>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #if defined(__GLIBC__) && __GLIBC__ >= 2 && __GLIBC_MINOR__ < 12
 
 #include "core/templates/hash_map.h"
@@ -112,8 +121,43 @@ static Error set_name(const String &p_name) {
 #endif // PTHREAD_NO_RENAME
 }
 
+static Error set_priority(Thread::Priority p_priority) {
+#ifdef __linux__
+	if (p_priority == Thread::PRIORITY_REALTIME) {
+		sched_param param = {};
+		param.sched_priority = sched_get_priority_min(SCHED_RR) + 1;
+		if (pthread_setschedparam(pthread_self(), SCHED_RR, &param) == 0) {
+			return OK;
+		}
+		// Not allowed by RLIMIT_RTPRIO, use the highest regular priority instead.
+		p_priority = Thread::PRIORITY_HIGH;
+	}
+
+	// Nice values are per thread on Linux. Lowering them needs privileges as well, so high priority may be refused.
+	static const int nice_values[] = { 10, 0, -10 };
+	return setpriority(PRIO_PROCESS, syscall(SYS_gettid), nice_values[p_priority]) == 0 ? OK : ERR_UNAUTHORIZED;
+#else
+	return ERR_UNAVAILABLE;
+#endif
+}
+
+static Error set_affinity(uint64_t p_affinity_mask) {
+#ifdef __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (int i = 0; i < CPU_SETSIZE; i++) {
+		if (p_affinity_mask == 0 || (i < 64 && (p_affinity_mask & (uint64_t(1) << i)))) {
+			CPU_SET(i, &set);
+		}
+	}
+	return sched_setaffinity(0, sizeof(set), &set) == 0 ? OK : ERR_INVALID_PARAMETER;
+#else
+	return ERR_UNAVAILABLE;
+#endif
+}
+
 void init_thread_posix() {
-	Thread::_set_platform_functions({ .set_name = set_name });
+	Thread::_set_platform_functions({ .set_name = set_name, .set_priority = set_priority, .set_affinity = set_affinity });
 }
 
 #endif // UNIX_ENABLED
@@ -498,6 +498,8 @@ Error RenderingDeviceDriverVulkan::_initialize_device_extensions() {
 	_register_requested_device_extension(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME, false);
 	_register_requested_device_extension(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME, false);
 	_register_requested_device_extension(VK_EXT_MESH_SHADER_EXTENSION_NAME, false);
+	_register_requested_device_extension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false);
+	_register_requested_device_extension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false);
 
 	if (Engine::get_singleton()->is_generate_spirv_debug_info_enabled()) {
 		_register_requested_device_extension(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME, true);
@@ -669,6 +671,8 @@ Error RenderingDeviceDriverVulkan::_check_device_capabilities() {
 		VkPhysicalDeviceMultiviewFeatures multiview_features = {};
 		VkPhysicalDevicePipelineCreationCacheControlFeatures pipeline_cache_control_features = {};
 		VkPhysicalDeviceMeshShaderFeaturesEXT mesh_shader_features = {};
+		VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+		VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
 
 		const bool use_1_2_features = physical_device_properties.apiVersion >= VK_API_VERSION_1_2;
 		if (use_1_2_features) {
@@ -711,6 +715,17 @@ Error RenderingDeviceDriverVulkan::_check_device_capabilities() {
 			next_features = &mesh_shader_features;
 		}
 
+		const bool present_wait_extensions = enabled_device_extension_names.has(VK_KHR_PRESENT_ID_EXTENSION_NAME) && enabled_device_extension_names.has(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+		if (present_wait_extensions) {
+			present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+			present_id_features.pNext = next_features;
+			next_features = &present_id_features;
+
+			present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+			present_wait_features.pNext = next_features;
+			next_features = &present_wait_features;
+		}
+
 		VkPhysicalDeviceFeatures2 device_features_2 = {};
 		device_features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
 		device_features_2.pNext = next_features;
@@ -761,6 +776,10 @@ Error RenderingDeviceDriverVulkan::_check_device_capabilities() {
 			mesh_shader_capabilities.primitive_fragment_shading_rate_mesh_shader_is_supported = mesh_shader_features.primitiveFragmentShadingRateMeshShader;
 			mesh_shader_capabilities.mesh_shader_queries_is_supported = mesh_shader_features.meshShaderQueries;
 		}
+
+		if (present_wait_extensions) {
+			present_wait_support = present_id_features.presentId && present_wait_features.presentWait;
+		}
 	}
 
 	if (functions.GetPhysicalDeviceProperties2 != nullptr) {
@@ -961,6 +980,20 @@ Error RenderingDeviceDriverVulkan::_initialize_device(const LocalVector<VkDevice
 		create_info_next = &mesh_shader_features;
 	}
 
+	VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+	VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+	if (present_wait_support) {
+		present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+		present_id_features.pNext = create_info_next;
+		present_id_features.presentId = VK_TRUE;
+		create_info_next = &present_id_features;
+
+		present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+		present_wait_features.pNext = create_info_next;
+		present_wait_features.presentWait = VK_TRUE;
+		create_info_next = &present_wait_features;
+	}
+
 	VkPhysicalDeviceVulkan11Features vulkan_1_1_features = {};
 	VkPhysicalDevice16BitStorageFeaturesKHR storage_features = {};
 	VkPhysicalDeviceMultiviewFeatures multiview_features = {};
@@ -1037,6 +1070,11 @@ Error RenderingDeviceDriverVulkan::_initialize_device(const LocalVector<VkDevice
 		if (enabled_device_extension_names.has(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME)) {
 			device_functions.CreateRenderPass2KHR = PFN_vkCreateRenderPass2KHR(functions.GetDeviceProcAddr(vk_device, "vkCreateRenderPass2KHR"));
 		}
+
+		if (present_wait_support) {
+			device_functions.WaitForPresentKHR = PFN_vkWaitForPresentKHR(functions.GetDeviceProcAddr(vk_device, "vkWaitForPresentKHR"));
+			present_wait_support = device_functions.WaitForPresentKHR != nullptr;
+		}
 	}
 
 	return OK;
@@ -2017,6 +2055,16 @@ static_assert(ENUM_MEMBERS_EQUAL(RDD::BARRIER_ACCESS_MEMORY_READ_BIT, VK_ACCESS_
 static_assert(ENUM_MEMBERS_EQUAL(RDD::BARRIER_ACCESS_MEMORY_WRITE_BIT, VK_ACCESS_MEMORY_WRITE_BIT));
 static_assert(ENUM_MEMBERS_EQUAL(RDD::BARRIER_ACCESS_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT, VK_ACCESS_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT_KHR));
 
+static _FORCE_INLINE_ uint32_t _queue_family_to_vk_index(RDD::CommandQueueFamilyID p_family, RDD::CommandQueueFamilyID p_other_family) {
+	// Only an ownership transfer between two different families uses actual indices.
+	if (p_family.id == 0 || p_family.id == p_other_family.id) {
+		return VK_QUEUE_FAMILY_IGNORED;
+	}
+
+	// Family IDs are offset by one so zero can be used as the invalid value.
+	return uint32_t(p_family.id - 1);
+}
+
 void RenderingDeviceDriverVulkan::command_pipeline_barrier(
 		CommandBufferID p_cmd_buffer,
 		BitField<PipelineStageBits> p_src_stages,
@@ -2036,8 +2084,8 @@ void RenderingDeviceDriverVulkan::command_pipeline_barrier(
 	for (uint32_t i = 0; i < p_buffer_barriers.size(); i++) {
 		vk_buffer_barriers[i] = {};
 		vk_buffer_barriers[i].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-		vk_buffer_barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		vk_buffer_barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vk_buffer_barriers[i].srcQueueFamilyIndex = _queue_family_to_vk_index(p_buffer_barriers[i].src_queue_family, p_buffer_barriers[i].dst_queue_family);
+		vk_buffer_barriers[i].dstQueueFamilyIndex = _queue_family_to_vk_index(p_buffer_barriers[i].dst_queue_family, p_buffer_barriers[i].src_queue_family);
 		vk_buffer_barriers[i].srcAccessMask = _rd_to_vk_access_flags(p_buffer_barriers[i].src_access);
 		vk_buffer_barriers[i].dstAccessMask = _rd_to_vk_access_flags(p_buffer_barriers[i].dst_access);
 		vk_buffer_barriers[i].buffer = ((const BufferInfo *)p_buffer_barriers[i].buffer.id)->vk_buffer;
@@ -2054,8 +2102,8 @@ void RenderingDeviceDriverVulkan::command_pipeline_barrier(
 		vk_image_barriers[i].dstAccessMask = _rd_to_vk_access_flags(p_texture_barriers[i].dst_access);
 		vk_image_barriers[i].oldLayout = RD_TO_VK_LAYOUT[p_texture_barriers[i].prev_layout];
 		vk_image_barriers[i].newLayout = RD_TO_VK_LAYOUT[p_texture_barriers[i].next_layout];
-		vk_image_barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		vk_image_barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vk_image_barriers[i].srcQueueFamilyIndex = _queue_family_to_vk_index(p_texture_barriers[i].src_queue_family, p_texture_barriers[i].dst_queue_family);
+		vk_image_barriers[i].dstQueueFamilyIndex = _queue_family_to_vk_index(p_texture_barriers[i].dst_queue_family, p_texture_barriers[i].src_queue_family);
 		vk_image_barriers[i].image = tex_info->vk_view_create_info.image;
 		vk_image_barriers[i].subresourceRange.aspectMask = (VkImageAspectFlags)p_texture_barriers[i].subresources.aspect;
 		vk_image_barriers[i].subresourceRange.baseMipLevel = p_texture_barriers[i].subresources.base_mipmap;
@@ -2334,15 +2382,21 @@ Error RenderingDeviceDriverVulkan::command_queue_execute_and_present(CommandQueu
 	if (p_swap_chains.size() > 0) {
 		thread_local LocalVector<VkSwapchainKHR> swapchains;
 		thread_local LocalVector<uint32_t> image_indices;
+		thread_local LocalVector<uint64_t> present_ids;
 		thread_local LocalVector<VkResult> results;
 		swapchains.clear();
 		image_indices.clear();
+		present_ids.clear();
 
 		for (uint32_t i = 0; i < p_swap_chains.size(); i++) {
 			SwapChain *swap_chain = (SwapChain *)(p_swap_chains[i].id);
 			swapchains.push_back(swap_chain->vk_swapchain);
 			DEV_ASSERT(swap_chain->image_index < swap_chain->images.size());
 			image_indices.push_back(swap_chain->image_index);
+			if (present_wait_support) {
+				swap_chain->present_id++;
+				present_ids.push_back(swap_chain->present_id);
+			}
 		}
 
 		results.resize(swapchains.size());
@@ -2356,6 +2410,15 @@ Error RenderingDeviceDriverVulkan::command_queue_execute_and_present(CommandQueu
 		present_info.pImageIndices = image_indices.ptr();
 		present_info.pResults = results.ptr();
 
+		VkPresentIdKHR present_id_info = {};
+		if (present_wait_support) {
+			// Identify the presents so swap_chain_wait_for_present() can wait on them.
+			present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+			present_id_info.swapchainCount = present_ids.size();
+			present_id_info.pPresentIds = present_ids.ptr();
+			present_info.pNext = &present_id_info;
+		}
+
 		device_queue.submit_mutex.lock();
 		err = device_functions.QueuePresentKHR(device_queue.queue, &present_info);
 		device_queue.submit_mutex.unlock();
@@ -2764,6 +2827,7 @@ Error RenderingDeviceDriverVulkan::swap_chain_resize(CommandQueueID p_cmd_queue,
 	swap_create_info.clipped = true;
 	err = device_functions.CreateSwapchainKHR(vk_device, &swap_create_info, nullptr, &swap_chain->vk_swapchain);
 	ERR_FAIL_COND_V(err != VK_SUCCESS, ERR_CANT_CREATE);
+	swap_chain->present_id = 0;
 
 	uint32_t image_count = 0;
 	err = device_functions.GetSwapchainImagesKHR(vk_device, swap_chain->vk_swapchain, &image_count, nullptr);
@@ -2918,6 +2982,34 @@ void RenderingDeviceDriverVulkan::swap_chain_free(SwapChainID p_swap_chain) {
 	memdelete(swap_chain);
 }
 
+Error RenderingDeviceDriverVulkan::swap_chain_wait_for_present(SwapChainID p_swap_chain, uint64_t p_timeout_usec) {
+	DEV_ASSERT(p_swap_chain.id != 0);
+
+	if (!present_wait_support) {
+		return ERR_UNAVAILABLE;
+	}
+
+	SwapChain *swap_chain = (SwapChain *)(p_swap_chain.id);
+	if (swap_chain->vk_swapchain == VK_NULL_HANDLE || swap_chain->present_id < 2) {
+		return OK;
+	}
+
+	// Wait on the present before the last one, so only the most recent frame remains queued for display.
+	VkResult err = device_functions.WaitForPresentKHR(vk_device, swap_chain->vk_swapchain, swap_chain->present_id - 1, p_timeout_usec * 1000);
+	switch (err) {
+		case VK_SUCCESS:
+		case VK_SUBOPTIMAL_KHR:
+			return OK;
+		case VK_TIMEOUT:
+			return ERR_TIMEOUT;
+		case VK_ERROR_OUT_OF_DATE_KHR:
+			context_driver->surface_set_needs_resize(swap_chain->surface, true);
+			return FAILED;
+		default:
+			return FAILED;
+	}
+}
+
 /*********************/
 /**** FRAMEBUFFER ****/
 /*********************/
@@ -3980,6 +4072,7 @@ size_t RenderingDeviceDriverVulkan::pipeline_cache_query_size() {
 	// FIXME:
 	// We're letting the cache grow unboundedly. We may want to set at limit and see if implementations use LRU or the like.
 	// If we do, we won't be able to assume any longer that the cache is dirty if, and only if, it has grown.
+	MutexLock lock(pipelines_cache.mutex);
 	VkResult err = vkGetPipelineCacheData(vk_device, pipelines_cache.vk_cache, &pipelines_cache.current_size, nullptr);
 	ERR_FAIL_COND_V_MSG(err, 0, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
 
@@ -3989,6 +4082,7 @@ size_t RenderingDeviceDriverVulkan::pipeline_cache_query_size() {
 Vector<uint8_t> RenderingDeviceDriverVulkan::pipeline_cache_serialize() {
 	DEV_ASSERT(pipelines_cache.vk_cache);
 
+	MutexLock lock(pipelines_cache.mutex);
 	pipelines_cache.buffer.resize(pipelines_cache.current_size + sizeof(PipelineCacheHeader));
 
 	VkResult err = vkGetPipelineCacheData(vk_device, pipelines_cache.vk_cache, &pipelines_cache.current_size, pipelines_cache.buffer.ptrw() + sizeof(PipelineCacheHeader));
@@ -4657,7 +4751,9 @@ RDD::PipelineID RenderingDeviceDriverVulkan::render_pipeline_create(
 	// ---
 
 	VkPipeline vk_pipeline = VK_NULL_HANDLE;
+	pipelines_cache.mutex.lock();
 	VkResult err = vkCreateGraphicsPipelines(vk_device, pipelines_cache.vk_cache, 1, &pipeline_create_info, nullptr, &vk_pipeline);
+	pipelines_cache.mutex.unlock();
 	ERR_FAIL_COND_V_MSG(err, PipelineID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + ".");
 
 	return PipelineID(vk_pipeline);
@@ -4718,7 +4814,9 @@ RDD::PipelineID RenderingDeviceDriverVulkan::compute_pipeline_create(ShaderID p_
 	}
 
 	VkPipeline vk_pipeline = VK_NULL_HANDLE;
+	pipelines_cache.mutex.lock();
 	VkResult err = vkCreateComputePipelines(vk_device, pipelines_cache.vk_cache, 1, &pipeline_create_info, nullptr, &vk_pipeline);
+	pipelines_cache.mutex.unlock();
 	ERR_FAIL_COND_V_MSG(err, PipelineID(), "vkCreateComputePipelines failed with error " + itos(err) + ".");
 
 	return PipelineID(vk_pipeline);
@@ -5033,6 +5131,10 @@ uint64_t RenderingDeviceDriverVulkan::api_trait_get(ApiTrait p_trait) {
 			return (uint64_t)MAX((uint64_t)16, physical_device_properties.limits.optimalBufferCopyOffsetAlignment);
 		case API_TRAIT_SHADER_CHANGE_INVALIDATION:
 			return (uint64_t)SHADER_CHANGE_INVALIDATION_INCOMPATIBLE_SETS_PLUS_CASCADE;
+		case API_TRAIT_CONCURRENT_PIPELINE_CREATION:
+			return true;
+		case API_TRAIT_DEDICATED_TRANSFER_QUEUE:
+			return true;
 		default:
 			return RenderingDeviceDriver::api_trait_get(p_trait);
 	}
@@ -5050,6 +5152,8 @@ bool RenderingDeviceDriverVulkan::has_feature(Features p_feature) {
 			return true;
 		case SUPPORTS_MESH_SHADER:
 			return mesh_shader_capabilities.task_shader_is_supported && mesh_shader_capabilities.mesh_shader_is_supported;
+		case SUPPORTS_MULTI_DRAW_INDIRECT:
+			return physical_device_features.multiDrawIndirect;
 		default:
 			return false;
 	}
@@ -122,6 +122,7 @@ class RenderingDeviceDriverVulkan : public RenderingDeviceDriver {
 		PFN_vkAcquireNextImageKHR AcquireNextImageKHR = nullptr;
 		PFN_vkQueuePresentKHR QueuePresentKHR = nullptr;
 		PFN_vkCreateRenderPass2KHR CreateRenderPass2KHR = nullptr;
+		PFN_vkWaitForPresentKHR WaitForPresentKHR = nullptr;
 	};
 
 	VkDevice vk_device = VK_NULL_HANDLE;
@@ -144,6 +145,7 @@ class RenderingDeviceDriverVulkan : public RenderingDeviceDriver {
 	StorageBufferCapabilities storage_buffer_capabilities;
 	MeshShaderCapabilities mesh_shader_capabilities;
 	bool pipeline_cache_control_support = false;
+	bool present_wait_support = false; // Both VK_KHR_present_id and VK_KHR_present_wait.
 	DeviceFunctions device_functions;
 
 	void _register_requested_device_extension(const CharString &p_extension_name, bool p_required);
@@ -345,6 +347,7 @@ private:
 		LocalVector<uint32_t> command_queues_acquired_semaphores;
 		RenderPassID render_pass;
 		uint32_t image_index = 0;
+		uint64_t present_id = 0; // Last ID given to VK_KHR_present_id, restarts when the swap chain is recreated.
 	};
 
 	void _swap_chain_release(SwapChain *p_swap_chain);
@@ -356,6 +359,7 @@ public:
 	virtual RenderPassID swap_chain_get_render_pass(SwapChainID p_swap_chain) override final;
 	virtual DataFormat swap_chain_get_format(SwapChainID p_swap_chain) override final;
 	virtual void swap_chain_free(SwapChainID p_swap_chain) override final;
+	virtual Error swap_chain_wait_for_present(SwapChainID p_swap_chain, uint64_t p_timeout_usec) override final;
 
 	/*********************/
 	/**** FRAMEBUFFER ****/
@@ -502,6 +506,8 @@ private:
 		size_t current_size = 0;
 		Vector<uint8_t> buffer; // Header then data.
 		VkPipelineCache vk_cache = VK_NULL_HANDLE;
+		// The cache is created externally synchronized when supported, and pipelines may be created from several threads.
+		Mutex mutex;
 	};
 
 	static int caching_instance_count;
@@ -541,7 +541,7 @@ Error AudioDriverWASAPI::init() {
 	Error err = init_output_device();
 	ERR_FAIL_COND_V_MSG(err != OK, err, "WASAPI: init_output_device error.");
 
-	thread.start(thread_func, this);
+	thread.start(thread_func, this, _get_mix_thread_settings());
 
 	return OK;
 }
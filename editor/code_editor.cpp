@@ -1085,7 +1085,8 @@ void CodeTextEditor::update_editor_settings() {
 	text_editor->set_code_hint_draw_below(EDITOR_GET("text_editor/completion/put_callhint_tooltip_below_current_line"));
 	code_complete_enabled = EDITOR_GET("text_editor/completion/code_complete_enabled");
 	code_complete_timer->set_wait_time(EDITOR_GET("text_editor/completion/code_complete_delay"));
-	idle->set_wait_time(EDITOR_GET("text_editor/completion/idle_parse_delay"));
+	idle_time = EDITOR_GET("text_editor/completion/idle_parse_delay");
+	idle->set_wait_time(idle_time);
 
 	// Appearance: Guidelines
 	if (EDITOR_GET("text_editor/appearance/guidelines/show_line_length_guidelines")) {
@@ -1512,8 +1513,14 @@ void CodeTextEditor::_update_font_ligatures() {
 }
 
 void CodeTextEditor::_text_changed_idle_timeout() {
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
 	_validate_script();
 	emit_signal(SNAME("validate_script"));
+
+	// Validation parses the whole file, so back off on large files to keep
+	// it from stalling the editor more than a fraction of the time while typing.
+	float validate_time = (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000000.0f;
+	idle->set_wait_time(MAX(idle_time, validate_time * 4.0f));
 }
 
 void CodeTextEditor::validate_script() {
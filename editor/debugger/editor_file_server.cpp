@@ -35,9 +35,10 @@
 #include "editor/editor_node.h"
 #include "editor/export/editor_export_platform.h"
 
-#define FILESYSTEM_PROTOCOL_VERSION 1
+#define FILESYSTEM_PROTOCOL_VERSION 2
 #define PASSWORD_LENGTH 32
 #define MAX_FILE_BUFFER_SIZE 100 * 1024 * 1024 // 100mb max file buffer size (description of files to update, compressed).
+#define MAX_CLIENT_CHUNKS (1 << 24)
 
 static void _add_file(String f, const uint64_t &p_modified_time, HashMap<String, uint64_t> &files_to_send, HashMap<String, uint64_t> &cached_files) {
 	f = f.replace_first("res://", ""); // remove res://
@@ -105,6 +106,73 @@ static void _add_custom_file(const String &f, HashMap<String, uint64_t> &files_t
 	_add_file(f, FileAccess::get_modified_time(f), files_to_send, cached_files);
 }
 
+void EditorFileServer::_build_file_delta(void *p_job) {
+	FileJob *job = (FileJob *)p_job;
+	Vector<uint8_t> file;
+	if (FileAccess::exists("res://" + job->path)) { // May have been removed since scanning, sent as empty then.
+		file = FileAccess::_get_file_as_bytes("res://" + job->path);
+	}
+	job->file_size = file.size();
+
+	// Chunks of the client's copy, by the first bytes of their hash.
+	HashMap<uint64_t, uint32_t> client_chunks;
+	for (uint32_t i = 0; i < job->client_chunks.size(); i++) {
+		client_chunks.insert(decode_uint64(job->client_chunks[i].md5), i);
+	}
+
+	LocalVector<RemoteFilesystemClient::Chunk> chunks;
+	RemoteFilesystemClient::compute_chunks(file.ptr(), file.size(), chunks);
+
+	LocalVector<uint8_t> &delta = job->delta;
+	delta.resize(8 + 4);
+	encode_uint64(file.size(), delta.ptr());
+	uint32_t op_count = 0;
+
+	uint64_t data_from = 0;
+	uint64_t data_size = 0;
+	auto flush_data = [&]() {
+		if (data_size == 0) {
+			return;
+		}
+		uint32_t pos = delta.size();
+		delta.resize(pos + 1 + 4 + data_size);
+		delta[pos] = RemoteFilesystemClient::DELTA_OP_DATA;
+		encode_uint32(data_size, &delta[pos + 1]);
+		memcpy(&delta[pos + 5], file.ptr() + data_from, data_size);
+		op_count++;
+		data_size = 0;
+	};
+
+	for (const RemoteFilesystemClient::Chunk &chunk : chunks) {
+		const uint32_t *index = client_chunks.getptr(decode_uint64(chunk.md5));
+		if (index) {
+			const RemoteFilesystemClient::Chunk &client_chunk = job->client_chunks[*index];
+			if (client_chunk.size == chunk.size && memcmp(client_chunk.md5, chunk.md5, 16) == 0) {
+				flush_data();
+				uint32_t pos = delta.size();
+				delta.resize(pos + 1 + 4);
+				delta[pos] = RemoteFilesystemClient::DELTA_OP_COPY;
+				encode_uint32(*index, &delta[pos + 1]);
+				op_count++;
+				continue;
+			}
+		}
+
+		// Consecutive new chunks are sent together.
+		if (data_size > 0 && data_size + chunk.size > INT32_MAX) {
+			flush_data();
+		}
+		if (data_size == 0) {
+			data_from = chunk.offset;
+		}
+		data_size += chunk.size;
+	}
+	flush_data();
+
+	encode_uint32(op_count, &delta[8]);
+	job->client_chunks.reset();
+}
+
 void EditorFileServer::poll() {
 	if (!active) {
 		return;
@@ -225,23 +293,66 @@ void EditorFileServer::poll() {
 		tcp_peer->put_64(K.value);
 	}
 
-	print_verbose("EFS: Sending " + itos(files_to_send.size()) + " files.");
+	// The client answers with the chunks of its copies of these files, so only changed chunks are sent.
+	print_verbose("EFS: Getting chunks of client files.");
+	pr.step(TTR("Getting remote file system"), 4, true);
 
-	int idx = 0;
+	LocalVector<FileJob> jobs;
+	jobs.resize(files_to_send.size());
+	LocalVector<uint8_t> signature_buffer;
+	uint32_t job_count = 0;
 	for (KeyValue<String, uint64_t> K : files_to_send) {
-		pr.step(TTR("Sending file:") + " " + K.key.get_file(), 5 + idx * 100 / files_to_send.size(), false);
-		idx++;
+		uint32_t chunk_count = tcp_peer->get_u32();
+		ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+		ERR_FAIL_COND(chunk_count > MAX_CLIENT_CHUNKS);
+
+		signature_buffer.resize(chunk_count * RemoteFilesystemClient::CHUNK_SIGNATURE_SIZE);
+		err = tcp_peer->get_data(signature_buffer.ptr(), signature_buffer.size());
+		ERR_FAIL_COND(err != OK);
 
-		if (K.value == 0 || !FileAccess::exists("res://" + K.key)) { // File was removed
+		if (K.value == 0) { // File was removed
 			continue;
 		}
 
-		Vector<uint8_t> array = FileAccess::_get_file_as_bytes("res://" + K.key);
-		tcp_peer->put_64(array.size());
-		tcp_peer->put_data(array.ptr(), array.size());
-		ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+		FileJob &job = jobs[job_count++];
+		job.path = K.key;
+		job.client_chunks.resize(chunk_count);
+		const uint8_t *r = signature_buffer.ptr();
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			job.client_chunks[i].size = decode_uint32(r);
+			memcpy(job.client_chunks[i].md5, r + 4, 16);
+			r += RemoteFilesystemClient::CHUNK_SIGNATURE_SIZE;
+		}
 	}
 
+	print_verbose("EFS: Sending " + itos(job_count) + " files.");
+
+	// Keep a few files ahead being prepared, without holding too many of them in memory.
+	const uint32_t max_pending = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count() * 2);
+	uint32_t next_job = 0;
+	uint64_t total_size = 0;
+	uint64_t sent_size = 0;
+	for (uint32_t i = 0; i < job_count; i++) {
+		while (next_job < job_count && next_job < i + max_pending) {
+			jobs[next_job].task = WorkerThreadPool::get_singleton()->add_native_task(&EditorFileServer::_build_file_delta, &jobs[next_job], false, SNAME("EditorFileServerDelta"));
+			next_job++;
+		}
+
+		FileJob &job = jobs[i];
+		pr.step(TTR("Sending file:") + " " + job.path.get_file(), 5 + i * 100 / job_count, false);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(job.task);
+
+		if (tcp_peer->get_status() == StreamPeerTCP::STATUS_CONNECTED) {
+			tcp_peer->put_data(job.delta.ptr(), job.delta.size());
+		}
+		total_size += job.file_size;
+		sent_size += job.delta.size();
+		job.delta.reset();
+	}
+
+	ERR_FAIL_COND(tcp_peer->get_status() != StreamPeerTCP::STATUS_CONNECTED);
+	print_verbose("EFS: Sent " + String::humanize_size(sent_size) + " for " + String::humanize_size(total_size) + " of changed files.");
+
 	tcp_peer->put_data((const uint8_t *)"GEND", 4); // End marker.
 
 	print_verbose("EFS: Done.");
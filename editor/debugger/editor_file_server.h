@@ -32,7 +32,9 @@
 #define EDITOR_FILE_SERVER_H
 
 #include "core/io/packet_peer.h"
+#include "core/io/remote_filesystem_client.h"
 #include "core/io/tcp_server.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/object/class_db.h"
 #include "core/os/thread.h"
 #include "editor/editor_file_system.h"
@@ -40,10 +42,20 @@
 class EditorFileServer : public Object {
 	GDCLASS(EditorFileServer, Object);
 
+	// A changed file is read and diffed against the client's copy on a worker thread, while earlier files are sent.
+	struct FileJob {
+		String path;
+		LocalVector<RemoteFilesystemClient::Chunk> client_chunks;
+		LocalVector<uint8_t> delta;
+		uint64_t file_size = 0;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
 	Ref<TCPServer> server;
 	String password;
 	int port = 0;
 	bool active = false;
+	static void _build_file_delta(void *p_job);
 	void _scan_files_changed(EditorFileSystemDirectory *efd, const Vector<String> &p_tags, HashMap<String, uint64_t> &files_to_send, HashMap<String, uint64_t> &cached_files);
 
 public:
@@ -843,6 +843,12 @@ void EditorFileSystem::scan() {
 
 	_update_extensions();
 
+	if (file_system_watcher) {
+		// Everything is scanned anyway.
+		Vector<String> discarded;
+		file_system_watcher->poll_changes(discarded);
+	}
+
 	if (!use_threads) {
 		scanning = true;
 		scan_total = 0;
@@ -1100,14 +1106,64 @@ void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir,
 	}
 }
 
+void EditorFileSystem::_mark_dirty_dir(const String &p_dir, bool p_entries_changed) {
+	HashMap<String, bool>::Iterator E = scan_dirty_dirs.find(p_dir);
+	if (E) {
+		// Its ancestors are already marked.
+		E->value = E->value || p_entries_changed;
+		return;
+	}
+
+	scan_dirty_dirs.insert(p_dir, p_entries_changed);
+	if (p_dir != "res://") {
+		String parent = p_dir.trim_suffix("/").get_base_dir();
+		_mark_dirty_dir(parent.ends_with("/") ? parent : parent + "/", false);
+	}
+}
+
+void EditorFileSystem::_collect_watched_changes() {
+	scan_dirty_dirs.clear();
+	scan_incremental = false;
+
+	if (!file_system_watcher || using_fat32_or_exfat) {
+		return;
+	}
+
+	Vector<String> changes;
+	if (!file_system_watcher->poll_changes(changes)) {
+		return; // Some changes were lost, everything must be checked.
+	}
+
+	const String project_data_dir = ProjectSettings::get_singleton()->get_project_data_path();
+	for (const String &change : changes) {
+		String path = ProjectSettings::get_singleton()->localize_path(change.replace("\\", "/"));
+		if (!path.begins_with("res://") || path.begins_with(project_data_dir)) {
+			continue; // Outside the project, or written by the editor itself.
+		}
+		String dir = path.get_base_dir();
+		_mark_dirty_dir(dir.ends_with("/") ? dir : dir + "/", true);
+	}
+	scan_incremental = true;
+}
+
 void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanProgress &p_progress) {
-	uint64_t current_mtime = FileAccess::get_modified_time(p_dir->get_path());
+	String cd = p_dir->get_path();
+
+	bool entries_changed = true;
+	if (scan_incremental) {
+		HashMap<String, bool>::ConstIterator E = scan_dirty_dirs.find(cd);
+		if (!E) {
+			return; // Nothing changed below this directory.
+		}
+		entries_changed = E->value;
+	}
+
+	uint64_t current_mtime = entries_changed ? FileAccess::get_modified_time(cd) : p_dir->modified_time;
 
 	bool updated_dir = false;
-	String cd = p_dir->get_path();
 	int diff_nb_files = 0;
 
-	if (current_mtime != p_dir->modified_time || using_fat32_or_exfat) {
+	if (current_mtime != p_dir->modified_time || (entries_changed && using_fat32_or_exfat)) {
 		updated_dir = true;
 		p_dir->modified_time = current_mtime;
 		//ooooops, dir changed, see what's going on
@@ -1231,7 +1287,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanPr
 		da->list_dir_end();
 	}
 
-	for (int i = 0; i < p_dir->files.size(); i++) {
+	for (int i = 0; i < p_dir->files.size() && entries_changed; i++) {
 		if (updated_dir && !p_dir->files[i]->verified) {
 			//this file was removed, add action to remove it
 			ItemAction ia;
@@ -1393,6 +1449,7 @@ void EditorFileSystem::scan_changes() {
 	}
 
 	_update_extensions();
+	_collect_watched_changes();
 	sources_changed.clear();
 	scanning_changes = true;
 	scanning_changes_done.clear();
@@ -3058,11 +3115,22 @@ EditorFileSystem::EditorFileSystem() {
 	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 	using_fat32_or_exfat = (da->get_filesystem_type() == "FAT32" || da->get_filesystem_type() == "exFAT");
 
+	if (EDITOR_GET("filesystem/directories/use_file_watcher")) {
+		file_system_watcher = OS::get_singleton()->create_file_system_watcher();
+		if (file_system_watcher && file_system_watcher->watch(ProjectSettings::get_singleton()->get_resource_path()) != OK) {
+			memdelete(file_system_watcher);
+			file_system_watcher = nullptr;
+		}
+	}
+
 	scan_total = 0;
 	callable_mp(ResourceUID::get_singleton(), &ResourceUID::clear).call_deferred(); // Will be updated on scan.
 	ResourceSaver::set_get_resource_id_for_path(_resource_saver_get_resource_id_for_path);
 }
 
 EditorFileSystem::~EditorFileSystem() {
+	if (file_system_watcher) {
+		memdelete(file_system_watcher);
+	}
 	ResourceSaver::set_get_resource_id_for_path(nullptr);
 }
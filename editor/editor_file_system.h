@@ -229,6 +229,16 @@ class EditorFileSystem : public Node {
 
 	void _scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanProgress &p_progress);
 
+	// Reports changes from the OS, so a changes scan only revisits the directories they touched.
+	FileSystemWatcher *file_system_watcher = nullptr;
+	// Directories the next changes scan visits when incremental: true for those whose entries changed, false for
+	// their ancestors, which are only walked through.
+	HashMap<String, bool> scan_dirty_dirs;
+	bool scan_incremental = false;
+
+	void _mark_dirty_dir(const String &p_dir, bool p_entries_changed);
+	void _collect_watched_changes();
+
 	void _delete_internal_files(const String &p_file);
 	int _insert_actions_delete_files_directory(EditorFileSystemDirectory *p_dir);
 
@@ -2842,6 +2842,8 @@ void EditorHelp::_add_text(const String &p_bbcode) {
 
 int EditorHelp::doc_generation_count = 0;
 String EditorHelp::doc_version_hash;
+String EditorHelp::doc_extensions_hash;
+bool EditorHelp::doc_core_loaded = false;
 Thread EditorHelp::worker_thread;
 
 void EditorHelp::_wait_for_thread() {
@@ -2859,6 +2861,11 @@ String EditorHelp::get_cache_full_path() {
 	return EditorPaths::get_singleton()->get_cache_dir().path_join(vformat("editor_doc_cache-%d.%d.res", VERSION_MAJOR, VERSION_MINOR));
 }
 
+String EditorHelp::get_extensions_cache_full_path() {
+	// Extensions are per project, so their docs are cached along with the project.
+	return EditorPaths::get_singleton()->get_project_settings_dir().path_join("editor_doc_cache_extensions.res");
+}
+
 void EditorHelp::load_xml_buffer(const uint8_t *p_buffer, int p_size) {
 	if (!ext_doc) {
 		ext_doc = memnew(DocTools);
@@ -2889,7 +2896,9 @@ void EditorHelp::_load_doc_thread(void *p_udata) {
 			doc->add_doc(DocData::ClassDoc::from_dict(classes[i]));
 		}
 
-		// Extensions' docs are not cached. Generate them now (on the main thread).
+		doc_core_loaded = true;
+
+		// Extensions' docs are cached separately. Load or generate them now (on the main thread).
 		callable_mp_static(&EditorHelp::_gen_extensions_docs).call_deferred();
 	} else {
 		// We have to go back to the main thread to start from scratch, bypassing any possibly existing cache.
@@ -2922,12 +2931,32 @@ void EditorHelp::_gen_doc_thread(void *p_udata) {
 	if (err) {
 		ERR_PRINT("Cannot save editor help cache (" + get_cache_full_path() + ").");
 	}
+	doc_core_loaded = true;
 
 	OS::get_singleton()->benchmark_end_measure("EditorHelp", vformat("Generate Documentation (Run %d)", doc_generation_count));
 }
 
 void EditorHelp::_gen_extensions_docs() {
-	doc->generate((DocTools::GENERATE_FLAG_SKIP_BASIC_TYPES | DocTools::GENERATE_FLAG_EXTENSION_CLASSES_ONLY));
+	List<StringName> extension_classes;
+	ClassDB::get_extensions_class_list(&extension_classes);
+
+	if (!extension_classes.is_empty()) {
+		// The cache is only valid for the exact API of the loaded extensions, so
+		// rebuilding or reloading any of them regenerates it.
+		Ref<Resource> cache_res;
+		if (FileAccess::exists(get_extensions_cache_full_path())) {
+			cache_res = ResourceLoader::load(get_extensions_cache_full_path());
+		}
+		if (cache_res.is_valid() && cache_res->get_meta("version_hash", "") == doc_extensions_hash) {
+			Array classes = cache_res->get_meta("classes", Array());
+			for (int i = 0; i < classes.size(); i++) {
+				doc->add_doc(DocData::ClassDoc::from_dict(classes[i]));
+			}
+		} else {
+			doc->generate((DocTools::GENERATE_FLAG_SKIP_BASIC_TYPES | DocTools::GENERATE_FLAG_EXTENSION_CLASSES_ONLY));
+			_save_extensions_doc_cache();
+		}
+	}
 
 	// Append extra doc data, as it gets overridden by the generation step.
 	if (ext_doc) {
@@ -2935,6 +2964,30 @@ void EditorHelp::_gen_extensions_docs() {
 	}
 }
 
+void EditorHelp::_save_extensions_doc_cache() {
+	List<StringName> extension_classes;
+	ClassDB::get_extensions_class_list(&extension_classes);
+	if (extension_classes.is_empty()) {
+		return;
+	}
+
+	Ref<Resource> cache_res;
+	cache_res.instantiate();
+	cache_res->set_meta("version_hash", doc_extensions_hash);
+	Array classes;
+	for (const StringName &E : extension_classes) {
+		HashMap<String, DocData::ClassDoc>::ConstIterator class_doc = doc->class_list.find(E);
+		if (class_doc) {
+			classes.push_back(DocData::ClassDoc::to_dict(class_doc->value));
+		}
+	}
+	cache_res->set_meta("classes", classes);
+	Error err = ResourceSaver::save(cache_res, get_extensions_cache_full_path(), ResourceSaver::FLAG_COMPRESS);
+	if (err) {
+		ERR_PRINT("Cannot save editor help extensions cache (" + get_extensions_cache_full_path() + ").");
+	}
+}
+
 void EditorHelp::generate_doc(bool p_use_cache) {
 	doc_generation_count++;
 	OS::get_singleton()->benchmark_begin_measure("EditorHelp", vformat("Generate Documentation (Run %d)", doc_generation_count));
@@ -2949,12 +3002,19 @@ void EditorHelp::generate_doc(bool p_use_cache) {
 	if (doc_version_hash.is_empty()) {
 		_compute_doc_version_hash();
 	}
+	// Extensions can be added, removed or reloaded while the editor runs.
+	doc_extensions_hash = vformat("%s/%d/%d", doc_version_hash, ClassDB::get_api_hash(ClassDB::API_EXTENSION), ClassDB::get_api_hash(ClassDB::API_EDITOR_EXTENSION));
 
-	if (p_use_cache && FileAccess::exists(get_cache_full_path())) {
+	if (p_use_cache && doc_core_loaded) {
+		// Only extensions changed (e.g. after a reload); the engine docs are still up to date.
+		_gen_extensions_docs();
+		OS::get_singleton()->benchmark_end_measure("EditorHelp", vformat("Generate Documentation (Run %d)", doc_generation_count));
+	} else if (p_use_cache && FileAccess::exists(get_cache_full_path())) {
 		worker_thread.start(_load_doc_thread, nullptr);
 	} else {
 		print_verbose("Regenerating editor help cache");
 		doc->generate();
+		_save_extensions_doc_cache();
 		worker_thread.start(_gen_doc_thread, nullptr);
 	}
 }
@@ -3024,6 +3084,8 @@ void EditorHelp::update_doc() {
 void EditorHelp::cleanup_doc() {
 	_wait_for_thread();
 	memdelete(doc);
+	doc = nullptr;
+	doc_core_loaded = false;
 }
 
 Vector<Pair<String, int>> EditorHelp::get_sections() {
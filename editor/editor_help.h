@@ -193,12 +193,15 @@ class EditorHelp : public VBoxContainer {
 
 	static int doc_generation_count;
 	static String doc_version_hash;
+	static String doc_extensions_hash;
+	static bool doc_core_loaded;
 	static Thread worker_thread;
 
 	static void _wait_for_thread();
 	static void _load_doc_thread(void *p_udata);
 	static void _gen_doc_thread(void *p_udata);
 	static void _gen_extensions_docs();
+	static void _save_extensions_doc_cache();
 	static void _compute_doc_version_hash();
 
 	struct PropertyCompare {
@@ -222,6 +225,7 @@ public:
 	static DocTools *get_doc_data();
 	static void cleanup_doc();
 	static String get_cache_full_path();
+	static String get_extensions_cache_full_path();
 
 	static void load_xml_buffer(const uint8_t *p_buffer, int p_size);
 	static void remove_class(const String &p_class);
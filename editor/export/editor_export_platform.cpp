@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/io/zip_io.h"
@@ -226,8 +227,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const ExportFileDa
 
 	SavedData sd;
 	sd.path_utf8 = p_info.path.utf8();
-	sd.ofs = pd->f->get_position();
-	sd.size = p_data.size();
 	sd.encrypted = false;
 
 	if (!p_info.enc_key.is_empty()) {
@@ -270,48 +269,176 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const ExportFileDa
 		}
 	}
 
+	PackJob *job = memnew(PackJob);
+	job->sd = sd;
+	job->data = p_data;
+	job->compress = pd->compress_files;
+	if (sd.encrypted) {
+		job->enc_key = p_info.enc_key;
+	} else {
+		job->previous_files = &pd->previous_files;
+	}
+	job->task = WorkerThreadPool::get_singleton()->add_native_task(&EditorExportPlatform::_process_pack_job, job, false, "Export PCK file");
+	pd->pending_jobs.push_back(job);
+
+	// Bound the amount of file data held in memory while workers catch up.
+	while (pd->pending_jobs.size() > pd->max_pending_jobs) {
+		PackJob *oldest = pd->pending_jobs.front()->get();
+		pd->pending_jobs.pop_front();
+		Error err = _write_pack_job(pd, oldest);
+		memdelete(oldest);
+		if (err != OK) {
+			return err;
+		}
+	}
+
+	// TRANSLATORS: This is an editor progress label describing the storing of a file.
+	if (pd->ep->step(vformat(TTR("Storing File: %s"), p_info.path), 2 + p_info.file_index * 100 / p_info.total_files, false)) {
+		return ERR_SKIP;
+	}
+
+	return OK;
+}
+
+void EditorExportPlatform::_process_pack_job(void *p_userdata) {
+	PackJob *job = (PackJob *)p_userdata;
+	const Vector<uint8_t> &data = job->data;
+
+	// Store MD5 of original file, compressed files are verified after decompression.
+	job->sd.md5.resize(16);
+	CryptoCore::md5(data.ptr(), data.size(), job->sd.md5.ptrw());
+
+	job->sd.sha256.resize(32);
+	CryptoCore::sha256(data.ptr(), data.size(), job->sd.sha256.ptrw());
+
+	if (job->previous_files && !job->previous_files->is_empty()) {
+		const PreviousPackFile *previous = job->previous_files->getptr(String::hex_encode_buffer(job->sd.sha256.ptr(), 32));
+		if (previous && (job->compress || !previous->compressed)) {
+			job->reused = previous;
+			return;
+		}
+	}
+
+	if (job->compress && data.size() > 0 && (uint64_t)data.size() <= UINT32_MAX) {
+		job->compressed = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_FILE_COMPRESSED_BLOCK_SIZE);
+		// Textures and audio are usually compressed already, only keep the result if it's worth decompressing on load.
+		job->sd.compressed = !job->compressed.is_empty() && job->compressed.size() < data.size() - data.size() / 8;
+		if (!job->sd.compressed) {
+			job->compressed.clear();
+		}
+	}
+}
+
+Error EditorExportPlatform::_write_pack_job(PackData *p_pd, PackJob *p_job) {
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(p_job->task);
+
+	SavedData &sd = p_job->sd;
+	sd.ofs = p_pd->f->get_position();
+
+	Vector<uint8_t> reused_data;
+	if (p_job->reused) {
+		reused_data.resize(p_job->reused->size);
+		p_pd->previous_pack->seek(p_job->reused->ofs);
+		if (p_pd->previous_pack->get_buffer(reused_data.ptrw(), reused_data.size()) == (uint64_t)reused_data.size()) {
+			sd.compressed = p_job->reused->compressed;
+		} else {
+			// The previous pack changed under us, store the file as if it was new.
+			reused_data.clear();
+			sd.compressed = false;
+		}
+	}
+	const Vector<uint8_t> &stored_data = !reused_data.is_empty() ? reused_data : (sd.compressed ? p_job->compressed : p_job->data);
+	sd.size = stored_data.size();
+
 	Ref<FileAccessEncrypted> fae;
-	Ref<FileAccess> ftmp = pd->f;
+	Ref<FileAccess> ftmp = p_pd->f;
 
 	if (sd.encrypted) {
 		fae.instantiate();
 		ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
 
-		Error err = fae->open_and_parse(ftmp, p_info.enc_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		Error err = fae->open_and_parse(ftmp, p_job->enc_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
 		ERR_FAIL_COND_V(err != OK, ERR_SKIP);
 		ftmp = fae;
 	}
 
 	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
+	ftmp->store_buffer(stored_data.ptr(), stored_data.size());
 
 	if (fae.is_valid()) {
 		ftmp.unref();
 		fae.unref();
 	}
 
-	int pad = _get_pad(PCK_PADDING, pd->f->get_position());
+	int pad = _get_pad(PCK_PADDING, p_pd->f->get_position());
 	for (int i = 0; i < pad; i++) {
-		pd->f->store_8(0);
+		p_pd->f->store_8(0);
 	}
 
-	// Store MD5 of original file.
-	{
-		sd.md5.resize(16);
-		CryptoCore::md5(p_data.ptr(), p_data.size(), sd.md5.ptrw());
+	p_pd->file_ofs.push_back(sd);
+
+	return OK;
+}
 
-		sd.sha256.resize(32);
-		CryptoCore::sha256(p_data.ptr(), p_data.size(), sd.sha256.ptrw());
+Error EditorExportPlatform::_finish_pack_jobs(PackData *p_pd, bool p_write) {
+	Error err = OK;
+	while (!p_pd->pending_jobs.is_empty()) {
+		PackJob *job = p_pd->pending_jobs.front()->get();
+		p_pd->pending_jobs.pop_front();
+		if (p_write && err == OK) {
+			err = _write_pack_job(p_pd, job);
+		} else {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(job->task);
+		}
+		memdelete(job);
 	}
+	return err;
+}
 
-	pd->file_ofs.push_back(sd);
+void EditorExportPlatform::_load_previous_pack(const String &p_path, PackData *r_pd) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null() || f->get_32() != PACK_HEADER_MAGIC || f->get_32() != PACK_FORMAT_VERSION) {
+		return;
+	}
 
-	// TRANSLATORS: This is an editor progress label describing the storing of a file.
-	if (pd->ep->step(vformat(TTR("Storing File: %s"), p_info.path), 2 + p_info.file_index * 100 / p_info.total_files, false)) {
-		return ERR_SKIP;
+	f->get_32(); // Major.
+	f->get_32(); // Minor.
+	f->get_32(); // Patch.
+	uint32_t pack_flags = f->get_32();
+	if (pack_flags & (PACK_DIR_ENCRYPTED | PACK_REL_FILEBASE)) {
+		return;
 	}
 
-	return OK;
+	uint64_t file_base = f->get_64();
+	f->get_64(); // Signature offset.
+	f->get_64(); // Signature size.
+	f->get_32(); // Signature curve.
+	for (int i = 0; i < 11; i++) {
+		f->get_32(); // Reserved.
+	}
+
+	uint32_t file_count = f->get_32();
+	for (uint32_t i = 0; i < file_count && !f->eof_reached(); i++) {
+		uint32_t string_len = f->get_32();
+		f->seek(f->get_position() + string_len);
+
+		PreviousPackFile file;
+		file.ofs = file_base + f->get_64();
+		file.size = f->get_64();
+		uint8_t sha256[32];
+		f->seek(f->get_position() + 16); // MD5.
+		f->get_buffer(sha256, 32);
+		uint32_t flags = f->get_32();
+		file.compressed = flags & PACK_FILE_COMPRESSED;
+
+		if (!(flags & PACK_FILE_ENCRYPTED)) {
+			r_pd->previous_files[String::hex_encode_buffer(sha256, 32)] = file;
+		}
+	}
+
+	if (!r_pd->previous_files.is_empty()) {
+		r_pd->previous_pack = f;
+	}
 }
 
 Error EditorExportPlatform::_save_zip_file(void *p_userdata, const ExportFileData &p_info, const Vector<uint8_t> &p_data) {
@@ -1702,8 +1829,18 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress_files = GLOBAL_GET("editor/export/compress_pack_files");
+	pd.max_pending_jobs = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count() * 2);
+	if (!p_embed && bool(GLOBAL_GET("editor/export/incremental_pack_export"))) {
+		_load_previous_pack(p_path, &pd);
+	}
 
 	Error err = export_project_files(p_preset, p_debug, _save_pack_file, &pd, _add_shared_object);
+	Error jobs_err = _finish_pack_jobs(&pd, err == OK);
+	if (err == OK) {
+		err = jobs_err;
+	}
+	pd.previous_pack.unref();
 
 	// Close temp file.
 	pd.f.unref();
@@ -1844,7 +1981,7 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		uint32_t string_len = pd.file_ofs[i].path_utf8.length();
 		uint32_t pad = _get_pad(4, string_len);
 
-		print_verbose(vformat("   %s %d [%s%s]", String::utf8(pd.file_ofs[i].path_utf8.get_data()), pd.file_ofs[i].size, (pd.file_ofs[i].encrypted ? "E" : ""), (pd.file_ofs[i].require_verification ? "S" : "")));
+		print_verbose(vformat("   %s %d [%s%s%s]", String::utf8(pd.file_ofs[i].path_utf8.get_data()), pd.file_ofs[i].size, (pd.file_ofs[i].encrypted ? "E" : ""), (pd.file_ofs[i].compressed ? "C" : ""), (pd.file_ofs[i].require_verification ? "S" : "")));
 
 		uint32_t full_len = string_len + pad;
 		fhead->store_32(full_len);
@@ -1869,6 +2006,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		if (pd.file_ofs[i].require_verification) {
 			flags |= PACK_FILE_REQUIRE_VERIFICATION;
 		}
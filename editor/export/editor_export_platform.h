@@ -36,6 +36,7 @@ struct EditorProgress;
 
 #include "core/io/dir_access.h"
 #include "core/io/zip_io.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/shared_object.h"
 #include "editor_export_preset.h"
 #include "scene/gui/rich_text_label.h"
@@ -92,6 +93,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		bool require_verification = false;
 		Vector<uint8_t> md5;
 		Vector<uint8_t> sha256;
@@ -102,11 +104,37 @@ private:
 		}
 	};
 
+	struct PreviousPackFile {
+		uint64_t ofs = 0;
+		uint64_t size = 0;
+		bool compressed = false;
+	};
+
+	struct PackJob {
+		SavedData sd;
+		Vector<uint8_t> data;
+		Vector<uint8_t> compressed;
+		Vector<uint8_t> enc_key;
+		bool compress = false;
+		const HashMap<String, PreviousPackFile> *previous_files = nullptr;
+		const PreviousPackFile *reused = nullptr;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
 	struct PackData {
 		Ref<FileAccess> f;
 		Vector<SavedData> file_ofs;
+		bool compress_files = false;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+
+		// Files are hashed and compressed on worker threads, then written in the order they were submitted.
+		List<PackJob *> pending_jobs;
+		int max_pending_jobs = 1;
+
+		// Blobs of the previous export, by SHA-256 of their contents, for incremental exports.
+		Ref<FileAccess> previous_pack;
+		HashMap<String, PreviousPackFile> previous_files;
 	};
 
 	struct ZipData {
@@ -121,6 +149,10 @@ private:
 	void _export_find_dependencies(const String &p_path, HashSet<String> &p_paths);
 
 	static Error _save_pack_file(void *p_userdata, const ExportFileData &p_info, const Vector<uint8_t> &p_data);
+	static void _process_pack_job(void *p_userdata);
+	static Error _write_pack_job(PackData *p_pd, PackJob *p_job);
+	static Error _finish_pack_jobs(PackData *p_pd, bool p_write);
+	static void _load_previous_pack(const String &p_path, PackData *r_pd);
 	static Error _save_zip_file(void *p_userdata, const ExportFileData &p_info, const Vector<uint8_t> &p_data);
 
 	void _edit_files_with_filter(Ref<DirAccess> &da, const Vector<String> &p_filters, HashSet<String> &r_list, bool exclude);
@@ -192,8 +192,156 @@ void SceneTreeEditor::_toggle_visible(Node *p_node) {
 	}
 }
 
-void SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent) {
+bool SceneTreeEditor::_is_node_displayed(Node *p_node) const {
+	// Same checks as in _add_nodes().
+	Node *scene_node = get_scene_node();
+	if (display_foreign || p_node == scene_node || p_node->get_owner() == scene_node) {
+		return true;
+	}
+	return (show_enabled_subscene || can_open_instance) && p_node->get_owner() && scene_node->is_editable_instance(p_node->get_owner());
+}
+
+bool SceneTreeEditor::_is_selection_inside(Node *p_node) const {
+	if (selected && p_node->is_ancestor_of(selected)) {
+		return true;
+	}
+	if (editor_selection) {
+		for (const KeyValue<Node *, Object *> &E : editor_selection->get_selection()) {
+			if (p_node->is_ancestor_of(E.key)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool SceneTreeEditor::_is_item_in_sync(Node *p_node, TreeItem *p_item) {
+	if (lazy_items.has(p_item)) {
+		return true; // Children are created when expanded.
+	}
+
+	TreeItem *child_item = p_item->get_first_child();
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		if (!_is_node_displayed(child)) {
+			continue;
+		}
+
+		TreeItem **E = node_cache.getptr(child);
+		if (!E || *E != child_item || !_is_item_in_sync(child, child_item)) {
+			return false;
+		}
+		child_item = child_item->get_next();
+	}
+
+	return child_item == nullptr;
+}
+
+TreeItem *SceneTreeEditor::_get_node_item(Node *p_node) {
 	if (!p_node) {
+		return nullptr;
+	}
+
+	TreeItem **E = node_cache.getptr(p_node);
+	if (E) {
+		return *E;
+	}
+
+	// The item may not exist yet because an ancestor is collapsed, create the branch leading to it.
+	Node *scene_node = get_scene_node();
+	if (lazy_items.is_empty() || !scene_node || !scene_node->is_ancestor_of(p_node)) {
+		return nullptr;
+	}
+
+	LocalVector<Node *> branch;
+	Node *n = p_node;
+	while (!node_cache.has(n)) {
+		if (n == scene_node) {
+			return nullptr;
+		}
+		branch.push_back(n);
+		n = n->get_parent();
+	}
+
+	for (int i = branch.size() - 1; i >= 0; i--) {
+		_materialize_children(node_cache[n]);
+		n = branch[i];
+		if (!node_cache.has(n)) {
+			return nullptr; // Not displayed.
+		}
+	}
+
+	return node_cache[n];
+}
+
+void SceneTreeEditor::_materialize_children(TreeItem *p_item) {
+	if (!lazy_items.has(p_item)) {
+		return;
+	}
+	lazy_items.erase(p_item);
+	memdelete(p_item->get_first_child()); // Placeholder.
+
+	Node *n = get_node_or_null(p_item->get_metadata(0));
+	ERR_FAIL_NULL(n);
+
+	bool was_updating = updating_tree;
+	updating_tree = true;
+	for (int i = 0; i < n->get_child_count(); i++) {
+		_add_nodes(n->get_child(i), p_item);
+	}
+	updating_tree = was_updating;
+
+	if (!filter.strip_edges().is_empty() || !show_all_nodes) {
+		_update_filter(p_item);
+	}
+}
+
+void SceneTreeEditor::_update_item_paths(Node *p_node) {
+	TreeItem **E = node_cache.getptr(p_node);
+	if (!E) {
+		return;
+	}
+
+	(*E)->set_metadata(0, p_node->get_path());
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_update_item_paths(p_node->get_child(i));
+	}
+}
+
+void SceneTreeEditor::_process_added_nodes() {
+	Node *scene_node = get_scene_node();
+	for (const ObjectID &id : pending_added_nodes) {
+		Node *n = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (!scene_node || !n || !n->is_inside_tree() || node_cache.has(n) || !scene_node->is_ancestor_of(n)) {
+			continue;
+		}
+
+		TreeItem **parent_item = node_cache.getptr(n->get_parent());
+		if (!parent_item || lazy_items.has(*parent_item)) {
+			continue; // Not displayed, or created once the parent is expanded.
+		}
+
+		// Insert right after the item of the closest displayed previous sibling.
+		Node *parent = n->get_parent();
+		int index = 0;
+		for (int i = n->get_index() - 1; i >= 0; i--) {
+			TreeItem **prev_item = node_cache.getptr(parent->get_child(i));
+			if (prev_item) {
+				index = (*prev_item)->get_index() + 1;
+				break;
+			}
+		}
+
+		updating_tree = true;
+		_add_nodes(n, *parent_item, index);
+		updating_tree = false;
+		items_changed = true;
+	}
+	pending_added_nodes.clear();
+}
+
+void SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent, int p_index) {
+	if (!p_node || !p_node->is_inside_tree()) {
 		return;
 	}
 
@@ -213,7 +361,8 @@ void SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent) {
 		part_of_subscene = p_node != get_scene_node() && get_scene_node()->get_scene_inherited_state().is_valid() && get_scene_node()->get_scene_inherited_state()->find_node_by_path(get_scene_node()->get_path_to(p_node)) >= 0;
 	}
 
-	TreeItem *item = tree->create_item(p_parent);
+	TreeItem *item = tree->create_item(p_parent, p_index);
+	node_cache.insert(p_node, item);
 
 	item->set_text(0, p_node->get_name());
 	if (can_rename && !part_of_subscene) {
@@ -441,8 +590,24 @@ void SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent) {
 		item->set_as_cursor(0);
 	}
 
-	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_add_nodes(p_node->get_child(i), item);
+	bool defer_children = false;
+	if (can_rename && item->is_collapsed() && filter.strip_edges().is_empty() && valid_types.is_empty() && !_is_selection_inside(p_node)) {
+		for (int i = 0; i < p_node->get_child_count(); i++) {
+			if (_is_node_displayed(p_node->get_child(i))) {
+				defer_children = true;
+				break;
+			}
+		}
+	}
+
+	if (defer_children) {
+		TreeItem *placeholder = tree->create_item(item);
+		placeholder->set_selectable(0, false);
+		lazy_items.insert(item);
+	} else {
+		for (int i = 0; i < p_node->get_child_count(); i++) {
+			_add_nodes(p_node->get_child(i), item);
+		}
 	}
 
 	if (valid_types.size()) {
@@ -519,11 +684,11 @@ void SceneTreeEditor::_node_visibility_changed(Node *p_node) {
 		return;
 	}
 
-	TreeItem *item = _find(tree->get_root(), p_node->get_path());
-
-	if (!item) {
+	TreeItem **E = node_cache.getptr(p_node);
+	if (!E) {
 		return;
 	}
+	TreeItem *item = *E;
 
 	int idx = item->get_button_by_id(0, BUTTON_VISIBILITY);
 	ERR_FAIL_COND(idx == -1);
@@ -572,11 +737,36 @@ void SceneTreeEditor::_node_script_changed(Node *p_node) {
 	tree_dirty = true;
 }
 
+void SceneTreeEditor::_node_added(Node *p_node) {
+	if (tree_dirty || !get_scene_node() || !get_scene_node()->is_ancestor_of(p_node)) {
+		return;
+	}
+
+	// Processed along with the tree change, by then the owner of the node has been set too.
+	pending_added_nodes.push_back(p_node->get_instance_id());
+}
+
 void SceneTreeEditor::_node_removed(Node *p_node) {
 	if (EditorNode::get_singleton()->is_exiting()) {
 		return; //speed up exit
 	}
 
+	// Children are removed before their parent, so their items are already gone.
+	TreeItem **E = node_cache.getptr(p_node);
+	if (E) {
+		TreeItem *item = *E;
+		node_cache.erase(p_node);
+		if (item == tree->get_root()) {
+			tree->clear();
+			node_cache.clear();
+			lazy_items.clear();
+		} else {
+			lazy_items.erase(item);
+			memdelete(item);
+		}
+		items_changed = true;
+	}
+
 	if (p_node->is_connected(CoreStringName(script_changed), callable_mp(this, &SceneTreeEditor::_node_script_changed))) {
 		p_node->disconnect(CoreStringName(script_changed), callable_mp(this, &SceneTreeEditor::_node_script_changed));
 	}
@@ -599,10 +789,21 @@ void SceneTreeEditor::_node_renamed(Node *p_node) {
 
 	emit_signal(SNAME("node_renamed"));
 
-	if (!tree_dirty) {
+	if (tree_dirty) {
+		return;
+	}
+
+	TreeItem **E = node_cache.getptr(p_node);
+	if (!E || marked.has(p_node)) {
+		// Marked nodes have extra text next to the name.
 		callable_mp(this, &SceneTreeEditor::_update_tree).call_deferred(false);
 		tree_dirty = true;
+		return;
 	}
+
+	(*E)->set_text(0, p_node->get_name());
+	_update_item_paths(p_node);
+	items_changed = true;
 }
 
 void SceneTreeEditor::_update_tree(bool p_scroll_to_selected) {
@@ -617,10 +818,12 @@ void SceneTreeEditor::_update_tree(bool p_scroll_to_selected) {
 
 	updating_tree = true;
 	tree->clear();
-	last_hash = hash_djb2_one_64(0);
+	node_cache.clear();
+	lazy_items.clear();
+	pending_added_nodes.clear();
+	items_changed = false;
 	if (get_scene_node()) {
 		_add_nodes(get_scene_node(), nullptr);
-		_compute_hash(get_scene_node(), last_hash);
 	}
 	updating_tree = false;
 	tree_dirty = false;
@@ -642,9 +845,11 @@ bool SceneTreeEditor::_update_filter(TreeItem *p_parent, bool p_scroll_to_select
 	}
 
 	bool keep_for_children = false;
-	for (TreeItem *child = p_parent->get_first_child(); child; child = child->get_next()) {
-		// Always keep if at least one of the children are kept.
-		keep_for_children = _update_filter(child, p_scroll_to_selected) || keep_for_children;
+	if (!lazy_items.has(p_parent)) {
+		for (TreeItem *child = p_parent->get_first_child(); child; child = child->get_next()) {
+			// Always keep if at least one of the children are kept.
+			keep_for_children = _update_filter(child, p_scroll_to_selected) || keep_for_children;
+		}
 	}
 
 	// Now find other reasons to keep this Node, too.
@@ -786,17 +991,6 @@ bool SceneTreeEditor::_item_matches_all_terms(TreeItem *p_item, const PackedStri
 	return true;
 }
 
-void SceneTreeEditor::_compute_hash(Node *p_node, uint64_t &hash) {
-	hash = hash_djb2_one_64(p_node->get_instance_id(), hash);
-	if (p_node->get_parent()) {
-		hash = hash_djb2_one_64(p_node->get_parent()->get_instance_id(), hash); //so a reparent still produces a different hash
-	}
-
-	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_compute_hash(p_node->get_child(i), hash);
-	}
-}
-
 void SceneTreeEditor::_test_update_tree() {
 	pending_test_update = false;
 
@@ -808,17 +1002,31 @@ void SceneTreeEditor::_test_update_tree() {
 		return; // don't even bother
 	}
 
-	uint64_t hash = hash_djb2_one_64(0);
-	if (get_scene_node()) {
-		_compute_hash(get_scene_node(), hash);
+	_process_added_nodes();
+
+	// Anything the incremental updates didn't account for (e.g. nodes moved within their parent) needs a full rebuild.
+	Node *scene_node = get_scene_node();
+	TreeItem *root = tree->get_root();
+	bool in_sync;
+	if (scene_node) {
+		TreeItem **E = node_cache.getptr(scene_node);
+		in_sync = root && E && *E == root && _is_item_in_sync(scene_node, root);
+	} else {
+		in_sync = root == nullptr;
 	}
-	//test hash
-	if (hash == last_hash) {
-		return; // did not change
+
+	if (!in_sync) {
+		callable_mp(this, &SceneTreeEditor::_update_tree).call_deferred(false);
+		tree_dirty = true;
+		return;
 	}
 
-	callable_mp(this, &SceneTreeEditor::_update_tree).call_deferred(false);
-	tree_dirty = true;
+	if (items_changed) {
+		items_changed = false;
+		if (!filter.strip_edges().is_empty() || !show_all_nodes) {
+			_update_filter();
+		}
+	}
 }
 
 void SceneTreeEditor::_tree_process_mode_changed() {
@@ -913,6 +1121,7 @@ void SceneTreeEditor::_notification(int p_what) {
 		case NOTIFICATION_ENTER_TREE: {
 			get_tree()->connect("tree_changed", callable_mp(this, &SceneTreeEditor::_tree_changed));
 			get_tree()->connect("tree_process_mode_changed", callable_mp(this, &SceneTreeEditor::_tree_process_mode_changed));
+			get_tree()->connect("node_added", callable_mp(this, &SceneTreeEditor::_node_added));
 			get_tree()->connect("node_removed", callable_mp(this, &SceneTreeEditor::_node_removed));
 			get_tree()->connect("node_renamed", callable_mp(this, &SceneTreeEditor::_node_renamed));
 			get_tree()->connect(SceneStringName(node_configuration_warning_changed), callable_mp(this, &SceneTreeEditor::_warning_changed));
@@ -925,6 +1134,7 @@ void SceneTreeEditor::_notification(int p_what) {
 		case NOTIFICATION_EXIT_TREE: {
 			get_tree()->disconnect("tree_changed", callable_mp(this, &SceneTreeEditor::_tree_changed));
 			get_tree()->disconnect("tree_process_mode_changed", callable_mp(this, &SceneTreeEditor::_tree_process_mode_changed));
+			get_tree()->disconnect("node_added", callable_mp(this, &SceneTreeEditor::_node_added));
 			get_tree()->disconnect("node_removed", callable_mp(this, &SceneTreeEditor::_node_removed));
 			get_tree()->disconnect("node_renamed", callable_mp(this, &SceneTreeEditor::_node_renamed));
 			tree->disconnect("item_collapsed", callable_mp(this, &SceneTreeEditor::_cell_collapsed));
@@ -942,12 +1152,12 @@ void SceneTreeEditor::_notification(int p_what) {
 				TreeItem *item = nullptr;
 				if (selected) {
 					// Scroll to selected node.
-					item = _find(tree->get_root(), selected->get_path());
+					item = _get_node_item(selected);
 				} else if (marked.size() == 1) {
 					// Scroll to a single marked node.
 					Node *marked_node = *marked.begin();
 					if (marked_node) {
-						item = _find(tree->get_root(), marked_node->get_path());
+						item = _get_node_item(marked_node);
 					}
 				}
 
@@ -961,28 +1171,6 @@ void SceneTreeEditor::_notification(int p_what) {
 	}
 }
 
-TreeItem *SceneTreeEditor::_find(TreeItem *p_node, const NodePath &p_path) {
-	if (!p_node) {
-		return nullptr;
-	}
-
-	NodePath np = p_node->get_metadata(0);
-	if (np == p_path) {
-		return p_node;
-	}
-
-	TreeItem *children = p_node->get_first_child();
-	while (children) {
-		TreeItem *n = _find(children, p_path);
-		if (n) {
-			return n;
-		}
-		children = children->get_next();
-	}
-
-	return nullptr;
-}
-
 void SceneTreeEditor::set_selected(Node *p_node, bool p_emit_selected) {
 	ERR_FAIL_COND(blocked > 0);
 
@@ -997,7 +1185,7 @@ void SceneTreeEditor::set_selected(Node *p_node, bool p_emit_selected) {
 		return;
 	}
 
-	TreeItem *item = p_node ? _find(tree->get_root(), p_node->get_path()) : nullptr;
+	TreeItem *item = _get_node_item(p_node);
 
 	if (item) {
 		if (auto_expand_selected) {
@@ -1027,9 +1215,9 @@ void SceneTreeEditor::set_selected(Node *p_node, bool p_emit_selected) {
 void SceneTreeEditor::rename_node(Node *p_node, const String &p_name, TreeItem *p_item) {
 	TreeItem *item;
 	if (p_item) {
-		item = p_item; // During batch rename the paths may change, so using _find() is unreliable.
+		item = p_item;
 	} else {
-		item = _find(tree->get_root(), p_node->get_path());
+		item = _get_node_item(p_node);
 	}
 	ERR_FAIL_NULL(item);
 	String new_name = p_name.validate_node_name();
@@ -1164,6 +1352,12 @@ void SceneTreeEditor::set_marked(Node *p_marked, bool p_selectable, bool p_child
 
 void SceneTreeEditor::set_filter(const String &p_filter) {
 	filter = p_filter;
+	if (!filter.strip_edges().is_empty()) {
+		// Filtering needs every item.
+		while (!lazy_items.is_empty()) {
+			_materialize_children(*lazy_items.begin());
+		}
+	}
 	_update_filter(nullptr, true);
 }
 
@@ -1227,6 +1421,10 @@ void SceneTreeEditor::_update_selection(TreeItem *item) {
 		}
 	}
 
+	if (lazy_items.has(item)) {
+		return;
+	}
+
 	TreeItem *c = item->get_first_child();
 
 	while (c) {
@@ -1245,6 +1443,12 @@ void SceneTreeEditor::_selection_changed() {
 	if (!root) {
 		return;
 	}
+
+	// Selected nodes need an item, even inside collapsed branches.
+	for (const KeyValue<Node *, Object *> &E : editor_selection->get_selection()) {
+		_get_node_item(E.key);
+	}
+
 	_update_selection(root);
 }
 
@@ -1257,11 +1461,14 @@ void SceneTreeEditor::_cell_collapsed(Object *p_obj) {
 	}
 
 	TreeItem *ti = Object::cast_to<TreeItem>(p_obj);
-	if (!ti) {
-		return;
+	if (!ti || (ti->get_parent() && lazy_items.has(ti->get_parent()))) {
+		return; // Placeholders don't represent a node.
 	}
 
 	bool collapsed = ti->is_collapsed();
+	if (!collapsed) {
+		_materialize_children(ti);
+	}
 
 	NodePath np = ti->get_metadata(0);
 
@@ -1588,7 +1795,6 @@ SceneTreeEditor::SceneTreeEditor(bool p_label, bool p_can_rename, bool p_can_ope
 	warning->set_title(TTR("Node Configuration Warning!"));
 	warning->set_flag(Window::FLAG_POPUP, true);
 
-	last_hash = 0;
 	blocked = 0;
 
 	update_timer = memnew(Timer);
@@ -74,26 +74,38 @@ class SceneTreeEditor : public Control {
 
 	int blocked;
 
-	void _compute_hash(Node *p_node, uint64_t &hash);
-
-	void _add_nodes(Node *p_node, TreeItem *p_parent);
+	// Items are kept in sync incrementally when nodes are added, removed or renamed, full rebuilds only
+	// happen when a change couldn't be applied that way. Children of collapsed items are only created once
+	// the item is expanded (or one of them needs to be shown), the item gets a placeholder child until then.
+	HashMap<Node *, TreeItem *> node_cache;
+	HashSet<TreeItem *> lazy_items;
+	LocalVector<ObjectID> pending_added_nodes;
+	bool items_changed = false;
+
+	bool _is_node_displayed(Node *p_node) const;
+	bool _is_selection_inside(Node *p_node) const;
+	bool _is_item_in_sync(Node *p_node, TreeItem *p_item);
+	TreeItem *_get_node_item(Node *p_node);
+	void _materialize_children(TreeItem *p_item);
+	void _update_item_paths(Node *p_node);
+	void _process_added_nodes();
+
+	void _add_nodes(Node *p_node, TreeItem *p_parent, int p_index = -1);
 	void _test_update_tree();
 	bool _update_filter(TreeItem *p_parent = nullptr, bool p_scroll_to_selected = false);
 	bool _item_matches_all_terms(TreeItem *p_item, const PackedStringArray &p_terms);
 	void _tree_changed();
 	void _tree_process_mode_changed();
+	void _node_added(Node *p_node);
 	void _node_removed(Node *p_node);
 	void _node_renamed(Node *p_node);
 
-	TreeItem *_find(TreeItem *p_node, const NodePath &p_path);
 	void _notification(int p_what);
 	void _selected_changed();
 	void _deselect_items();
 
 	void _cell_collapsed(Object *p_obj);
 
-	uint64_t last_hash;
-
 	bool can_rename;
 	bool can_open_instance;
 	bool updating_tree = false;
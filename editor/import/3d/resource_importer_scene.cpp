@@ -34,6 +34,7 @@
 #include "core/io/dir_access.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "editor/editor_node.h"
 #include "editor/editor_settings.h"
 #include "editor/import/3d/scene_import_settings.h"
@@ -1323,6 +1324,54 @@ Node *ResourceImporterScene::_post_fix_animations(Node *p_node, Node *p_root, co
 	return p_node;
 }
 
+void ResourceImporterScene::_gather_convex_decompositions(Node *p_node, Node *p_root, const Dictionary &p_node_data, float p_applied_root_scale, HashSet<String> &r_gathered, LocalVector<ConvexDecompositionTask> &r_tasks) {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_gather_convex_decompositions(p_node->get_child(i), p_root, p_node_data, p_applied_root_scale, r_gathered, r_tasks);
+	}
+
+	ImporterMeshInstance3D *mi = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (!mi || mi->get_mesh().is_null()) {
+		return;
+	}
+
+	String import_id = p_node->get_meta("import_id", "PATH:" + p_root->get_path_to(p_node));
+	if (!p_node_data.has(import_id)) {
+		return;
+	}
+
+	Dictionary node_settings = p_node_data[import_id];
+	if (!bool(node_settings.get("generate/physics", false)) || bool(node_settings.get("import/skip_import", false))) {
+		return;
+	}
+
+	ShapeType shape_type = (ShapeType)int(node_settings.get("physics/shape_type", SHAPE_TYPE_AUTOMATIC));
+	if (shape_type == SHAPE_TYPE_AUTOMATIC) {
+		BodyType body_type = (BodyType)int(node_settings.get("physics/body_type", BODY_TYPE_STATIC));
+		shape_type = body_type == BODY_TYPE_DYNAMIC ? SHAPE_TYPE_DECOMPOSE_CONVEX : SHAPE_TYPE_TRIMESH;
+	}
+	if (shape_type != SHAPE_TYPE_DECOMPOSE_CONVEX) {
+		return;
+	}
+
+	// Props instanced many times share their mesh and settings, decompose those only once.
+	String key = itos(mi->get_mesh()->get_instance_id()) + ":" + itos(node_settings.hash());
+	if (r_gathered.has(key)) {
+		return;
+	}
+	r_gathered.insert(key);
+
+	ConvexDecompositionTask task;
+	task.mesh = mi->get_mesh();
+	task.settings = node_settings;
+	task.applied_root_scale = p_applied_root_scale;
+	r_tasks.push_back(task);
+}
+
+void ResourceImporterScene::_convex_decomposition_task(uint32_t p_index, ConvexDecompositionTask *p_tasks) {
+	// The shapes are discarded, this only fills the decomposition cache that _post_fix_node() then reads from.
+	get_collision_shapes(p_tasks[p_index].mesh, p_tasks[p_index].settings, p_tasks[p_index].applied_root_scale);
+}
+
 Node *ResourceImporterScene::_post_fix_node(Node *p_node, Node *p_root, HashMap<Ref<ImporterMesh>, Vector<Ref<Shape3D>>> &collision_map, Pair<PackedVector3Array, PackedInt32Array> &r_occluder_arrays, HashSet<Ref<ImporterMesh>> &r_scanned_meshes, const Dictionary &p_node_data, const Dictionary &p_material_data, const Dictionary &p_animation_data, float p_animation_fps, float p_applied_root_scale) {
 	// children first
 	for (int i = 0; i < p_node->get_child_count(); i++) {
@@ -2013,6 +2062,7 @@ void ResourceImporterScene::get_internal_import_options(InternalImportCategory p
 			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/lods", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "lods/normal_split_angle", PROPERTY_HINT_RANGE, "0,180,0.1,degrees"), 25.0f));
 			r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "lods/normal_merge_angle", PROPERTY_HINT_RANGE, "0,180,0.1,degrees"), 60.0f));
+			r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "generate/clusters", PROPERTY_HINT_ENUM, "Default,Enable,Disable"), 0));
 		} break;
 		case INTERNAL_IMPORT_CATEGORY_MATERIAL: {
 			r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "use_external/enabled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), false));
@@ -2350,6 +2400,7 @@ void ResourceImporterScene::get_import_options(const String &p_path, List<Import
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "nodes/import_as_skeleton_bones"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/ensure_tangents"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_lods"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_clusters"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/create_shadow_meshes"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/light_baking", PROPERTY_HINT_ENUM, "Disabled,Static,Static Lightmaps,Dynamic", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 1));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/lightmap_texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2));
@@ -2423,7 +2474,7 @@ Array ResourceImporterScene::_get_skinned_pose_transforms(ImporterMeshInstance3D
 	return skin_pose_transform_array;
 }
 
-Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_generate_clusters, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
 	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
 	if (src_mesh_node) {
 		//is mesh
@@ -2438,6 +2489,7 @@ Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_
 				//do mesh processing
 
 				bool generate_lods = p_generate_lods;
+				bool generate_clusters = p_generate_clusters;
 				float split_angle = 25.0f;
 				float merge_angle = 60.0f;
 				bool create_shadow_meshes = p_create_shadow_meshes;
@@ -2486,6 +2538,15 @@ Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_
 						}
 					}
 
+					if (mesh_settings.has("generate/clusters")) {
+						int clusters = mesh_settings["generate/clusters"];
+						if (clusters == MESH_OVERRIDE_ENABLE) {
+							generate_clusters = true;
+						} else if (clusters == MESH_OVERRIDE_DISABLE) {
+							generate_clusters = false;
+						}
+					}
+
 					if (mesh_settings.has("lods/normal_split_angle")) {
 						split_angle = mesh_settings["lods/normal_split_angle"];
 					}
@@ -2543,6 +2604,10 @@ Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_
 					src_mesh_node->get_mesh()->generate_lods(merge_angle, split_angle, skin_pose_transform_array);
 				}
 
+				if (generate_clusters) {
+					src_mesh_node->get_mesh()->generate_clusters();
+				}
+
 				if (create_shadow_meshes) {
 					src_mesh_node->get_mesh()->create_shadow_mesh();
 				}
@@ -2605,7 +2670,7 @@ Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_generate_clusters, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
 	}
 
 	return p_node;
@@ -2971,6 +3036,19 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	}
 	bool remove_immutable_tracks = p_options.has("animation/remove_immutable_tracks") ? (bool)p_options["animation/remove_immutable_tracks"] : true;
 	_pre_fix_animations(scene, scene, node_data, animation_data, fps);
+
+	{
+		// Convex decomposition is by far the slowest part of generating colliders, run all of them
+		// in parallel up front. The results are cached, so the serial pass below picks them up.
+		HashSet<String> gathered;
+		LocalVector<ConvexDecompositionTask> decomposition_tasks;
+		_gather_convex_decompositions(scene, scene, node_data, apply_root ? root_scale : 1.0, gathered, decomposition_tasks);
+		if (decomposition_tasks.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceImporterScene::_convex_decomposition_task, decomposition_tasks.ptr(), decomposition_tasks.size(), -1, false, SNAME("ConvexDecomposition"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+	}
+
 	_post_fix_node(scene, scene, collision_map, occluder_arrays, scanned_meshes, node_data, material_data, animation_data, fps, apply_root ? root_scale : 1.0);
 	_post_fix_animations(scene, scene, node_data, animation_data, fps, remove_immutable_tracks);
 
@@ -3018,6 +3096,7 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	}
 
 	bool gen_lods = bool(p_options["meshes/generate_lods"]);
+	bool gen_clusters = bool(p_options["meshes/generate_clusters"]);
 	bool create_shadow_meshes = bool(p_options["meshes/create_shadow_meshes"]);
 	int light_bake_mode = p_options["meshes/light_baking"];
 	float texel_size = p_options["meshes/lightmap_texel_size"];
@@ -3033,7 +3112,7 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		}
 	}
 
-	scene = _generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
+	scene = _generate_meshes(scene, mesh_data, gen_lods, gen_clusters, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
 
 	if (mesh_lightmap_caches.size()) {
 		Ref<FileAccess> f = FileAccess::open(p_source_file + ".unwrap_cache", FileAccess::WRITE);
@@ -218,7 +218,7 @@ class ResourceImporterScene : public ResourceImporter {
 	static Error _check_resource_save_paths(const Dictionary &p_data);
 	Array _get_skinned_pose_transforms(ImporterMeshInstance3D *p_src_mesh_node);
 	void _replace_owner(Node *p_node, Node *p_scene, Node *p_new_owner);
-	Node *_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
+	Node *_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_generate_clusters, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
 	void _add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes);
 	void _copy_meta(Object *p_src_object, Object *p_dst_object);
 
@@ -237,6 +237,15 @@ class ResourceImporterScene : public ResourceImporter {
 
 	void _optimize_track_usage(AnimationPlayer *p_player, AnimationImportTracks *p_track_actions);
 
+	struct ConvexDecompositionTask {
+		Ref<ImporterMesh> mesh;
+		Dictionary settings;
+		float applied_root_scale = 1.0;
+	};
+
+	void _gather_convex_decompositions(Node *p_node, Node *p_root, const Dictionary &p_node_data, float p_applied_root_scale, HashSet<String> &r_gathered, LocalVector<ConvexDecompositionTask> &r_tasks);
+	void _convex_decomposition_task(uint32_t p_index, ConvexDecompositionTask *p_tasks);
+
 	bool animation_importer = false;
 
 public:
@@ -35,6 +35,7 @@
 #include "core/io/config_file.h"
 #include "core/io/image_loader.h"
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "editor/editor_file_system.h"
 #include "editor/editor_node.h"
 #include "editor/import/resource_importer_texture.h"
@@ -161,6 +162,17 @@ void ResourceImporterLayeredTexture::get_import_options(const String &p_path, Li
 	}
 }
 
+struct LayeredTextureCompressionJob {
+	Ref<Image> *images = nullptr;
+	Image::CompressMode mode = Image::COMPRESS_S3TC;
+	Image::UsedChannels channels = Image::USED_CHANNELS_RGBA;
+};
+
+static void _compress_layer(void *p_userdata, uint32_t p_index) {
+	LayeredTextureCompressionJob *job = static_cast<LayeredTextureCompressionJob *>(p_userdata);
+	job->images[p_index]->compress_from_channels(job->mode, job->channels);
+}
+
 void ResourceImporterLayeredTexture::_save_tex(Vector<Ref<Image>> p_images, const String &p_to_path, int p_compress_mode, float p_lossy, Image::CompressMode p_vram_compression, Image::CompressSource p_csource, Image::UsedChannels used_channels, bool p_mipmaps, bool p_force_po2) {
 	Vector<Ref<Image>> mipmap_images; //for 3D
 
@@ -260,6 +272,40 @@ void ResourceImporterLayeredTexture::_save_tex(Vector<Ref<Image>> p_images, cons
 		}
 	}
 
+	int save_compress_mode = p_compress_mode;
+	if (p_compress_mode == COMPRESS_VRAM_COMPRESSED) {
+		// Layers are independent, so they are all compressed upfront in parallel, then stored as is.
+		int layer_count = p_images.size();
+		Vector<Ref<Image>> compressed;
+		for (const Ref<Image> &image : p_images) {
+			compressed.push_back(image->duplicate());
+		}
+		for (const Ref<Image> &image : mipmap_images) {
+			compressed.push_back(image->duplicate());
+		}
+
+		LayeredTextureCompressionJob job;
+		job.images = compressed.ptrw();
+		job.mode = p_vram_compression;
+		job.channels = used_channels;
+
+		// Compressors split their own work across the pool with high priority tasks. Layers use the low priority
+		// ones, so they can't take every thread while waiting. Calls already made from a pool thread (threaded
+		// imports) stay sequential for the same reason.
+		if (WorkerThreadPool::get_thread_index() == -1 && compressed.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_layer, &job, compressed.size(), -1, false, SNAME("Compress Texture Layers"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (int i = 0; i < compressed.size(); i++) {
+				_compress_layer(&job, i);
+			}
+		}
+
+		p_images = compressed.slice(0, layer_count);
+		mipmap_images = compressed.slice(layer_count);
+		save_compress_mode = COMPRESS_VRAM_UNCOMPRESSED;
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_to_path, FileAccess::WRITE);
 	f->store_8('G');
 	f->store_8('S');
@@ -277,11 +323,11 @@ void ResourceImporterLayeredTexture::_save_tex(Vector<Ref<Image>> p_images, cons
 	f->store_32(0);
 
 	for (int i = 0; i < p_images.size(); i++) {
-		ResourceImporterTexture::save_to_ctex_format(f, p_images[i], ResourceImporterTexture::CompressMode(p_compress_mode), used_channels, p_vram_compression, p_lossy);
+		ResourceImporterTexture::save_to_ctex_format(f, p_images[i], ResourceImporterTexture::CompressMode(save_compress_mode), used_channels, p_vram_compression, p_lossy);
 	}
 
 	for (int i = 0; i < mipmap_images.size(); i++) {
-		ResourceImporterTexture::save_to_ctex_format(f, mipmap_images[i], ResourceImporterTexture::CompressMode(p_compress_mode), used_channels, p_vram_compression, p_lossy);
+		ResourceImporterTexture::save_to_ctex_format(f, mipmap_images[i], ResourceImporterTexture::CompressMode(save_compress_mode), used_channels, p_vram_compression, p_lossy);
 	}
 }
 
@@ -453,7 +453,8 @@ Error ResourceImporterTexture::import(const String &p_source_file, const String
 	const bool premult_alpha = p_options["process/premult_alpha"];
 	const bool normal_map_invert_y = p_options["process/normal_map_invert_y"];
 	// Support for texture streaming is not implemented yet.
-	const bool stream = false;
+	// Any mipmapped texture can be loaded starting from a lower mipmap, see rendering/textures/streaming/enabled.
+	const bool stream = mipmaps;
 	const int size_limit = p_options["process/size_limit"];
 	const bool hdr_as_srgb = p_options["process/hdr_as_srgb"];
 	if (hdr_as_srgb) {
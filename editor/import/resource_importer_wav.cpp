@@ -527,6 +527,7 @@ Error ResourceImporterWAV::import(const String &p_source_file, const String &p_s
 		void *encoded = qoa_encode((short *)pcm_data.ptrw(), &desc, &qoa_len);
 		dst_data.resize(qoa_len);
 		memcpy(dst_data.ptrw(), encoded, qoa_len);
+		QOA_FREE(encoded);
 	} else {
 		dst_data = pcm_data;
 	}
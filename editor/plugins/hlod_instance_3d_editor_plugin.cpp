@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  hlod_instance_3d_editor_plugin.cpp                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_instance_3d_editor_plugin.h"
+
+#include "editor/editor_node.h"
+#include "editor/editor_string_names.h"
+#include "editor/editor_undo_redo_manager.h"
+#include "scene/gui/button.h"
+
+void HLODInstance3DEditorPlugin::_bake() {
+	if (!hlod_instance) {
+		return;
+	}
+
+	if (hlod_instance->bake() == HLODInstance3D::BAKE_ERROR_NO_MESHES) {
+		EditorNode::get_singleton()->show_warning(TTR("No meshes to bake.\nMake sure the HLODInstance3D has at least one static MeshInstance3D descendant whose visual layers are part of its Bake Mask property."));
+		return;
+	}
+
+	EditorUndoRedoManager::get_singleton()->set_history_as_unsaved(EditorNode::get_editor_data().get_current_edited_scene_history_id());
+}
+
+void HLODInstance3DEditorPlugin::edit(Object *p_object) {
+	HLODInstance3D *s = Object::cast_to<HLODInstance3D>(p_object);
+	if (!s) {
+		return;
+	}
+
+	hlod_instance = s;
+}
+
+bool HLODInstance3DEditorPlugin::handles(Object *p_object) const {
+	return p_object->is_class("HLODInstance3D");
+}
+
+void HLODInstance3DEditorPlugin::make_visible(bool p_visible) {
+	if (p_visible) {
+		bake->show();
+	} else {
+		bake->hide();
+	}
+}
+
+HLODInstance3DEditorPlugin::HLODInstance3DEditorPlugin() {
+	bake = memnew(Button);
+	bake->set_theme_type_variation("FlatButton");
+	bake->set_icon(EditorNode::get_singleton()->get_editor_theme()->get_icon(SNAME("Bake"), EditorStringName(EditorIcons)));
+	bake->set_text(TTR("Bake HLOD"));
+	bake->hide();
+	bake->connect(SceneStringName(pressed), callable_mp(this, &HLODInstance3DEditorPlugin::_bake));
+	add_control_to_container(CONTAINER_SPATIAL_EDITOR_MENU, bake);
+}
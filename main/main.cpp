@@ -34,6 +34,7 @@
 #include "core/core_globals.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/timeline_profiler.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -46,6 +47,7 @@
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
@@ -180,6 +182,9 @@ String rendering_driver = "";
 String rendering_method = "";
 static int text_driver_idx = -1;
 static int audio_driver_idx = -1;
+// Text server support data is loaded in the background while the remaining types and servers are set up.
+static WorkerThreadPool::TaskID text_server_support_data_task = WorkerThreadPool::INVALID_TASK_ID;
+static String text_server_support_data_path;
 
 // Engine config/tools
 
@@ -241,6 +246,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static bool placeholder_resources = false;
 #ifdef TOOLS_ENABLED
 static bool dump_gdextension_interface = false;
 static bool dump_extension_api = false;
@@ -577,11 +583,15 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --text-driver <driver>            Text driver (Fonts, BiDi, shaping).\n");
 	OS::get_singleton()->print("  --tablet-driver <driver>          Pen tablet input driver.\n");
 	OS::get_singleton()->print("  --headless                        Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script.\n");
+	OS::get_singleton()->print("  --placeholder-resources           Load textures, meshes and audio as lightweight placeholders without their data. Useful for dedicated servers.\n");
 	OS::get_singleton()->print("  --write-movie <file>              Writes a video to the specified path (usually with .avi or .png extension).\n");
 	OS::get_singleton()->print("                                    --fixed-fps is forced when enabled, but it can be used to change movie FPS.\n");
 	OS::get_singleton()->print("                                    --disable-vsync can speed up movie writing but makes interaction more difficult.\n");
 	OS::get_singleton()->print("                                    --quit-after can be used to specify the number of frames to write.\n");
 	OS::get_singleton()->print("  --write-movie-subframes <N>       Number of subframes to render for each frame recorded (requires --write-movie).\n");
+	OS::get_singleton()->print("  --benchmark-scene <file>          Runs with the same deterministic frame pacing as --write-movie, but writes a per-frame\n");
+	OS::get_singleton()->print("                                    performance report (.json or .csv extension) instead of a video.\n");
+	OS::get_singleton()->print("                                    --quit-after can be used to specify the number of frames to record.\n");
 
 	print_help_title("Display options");
 	print_help_option("-f, --fullscreen", "Request fullscreen mode.\n");
@@ -624,6 +634,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--benchmark", "Benchmark the run time and print it to console. Also printed with --verbose.\n");
+	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n");
 
 	print_help_title("Standalone tools");
 	print_help_option("-s, --script <script>", "Run a script.\n");
@@ -656,8 +668,6 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--dump-extension-api-with-docs", "Generate JSON dump of the Godot API like the previous option, but including documentation.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--validate-extension-api <path>", "Validate an extension API file dumped (with one of the two previous options) from a previous version of the engine to ensure API compatibility.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("", "If incompatibilities or errors are detected, the exit code will be non-zero.\n");
-	print_help_option("--benchmark", "Benchmark the run time and print it to console.\n", CLI_OPTION_AVAILABILITY_EDITOR);
-	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #ifdef TESTS_ENABLED
 	print_help_option("--test [--help]", "Run unit tests. Use --test --help for more information.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -935,6 +945,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	// decrease performance if this is enabled.
 	GLOBAL_DEF_RST("application/run/flush_stdout_on_print", false);
 	GLOBAL_DEF_RST("application/run/flush_stdout_on_print.debug", true);
+	GLOBAL_DEF_RST("application/run/async_logging", false);
 
 	MAIN_PRINT("Main: Parse CMDLine");
 
@@ -1312,6 +1323,10 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			audio_driver = NULL_AUDIO_DRIVER;
 			display_driver = NULL_DISPLAY_DRIVER;
 
+		} else if (arg == "--placeholder-resources") { // load media resources as placeholders (dedicated servers).
+
+			placeholder_resources = true;
+
 		} else if (arg == "--log-file") { // write to log file
 
 			if (N) {
@@ -1668,6 +1683,25 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				OS::get_singleton()->print("Missing write-movie argument, aborting.\n");
 				goto error;
 			}
+		} else if (arg == "--benchmark-scene") {
+			if (N) {
+				const String ext = N->get().get_extension().to_lower();
+				if (ext != "json" && ext != "csv") {
+					OS::get_singleton()->print("The benchmark-scene report must have a .json or .csv extension, aborting.\n");
+					goto error;
+				}
+				Engine::get_singleton()->set_write_movie_path(N->get());
+				N = N->next();
+				if (fixed_fps == -1) {
+					fixed_fps = 60;
+				}
+				// Rendering as fast as possible keeps the measured frame times independent of the display refresh rate.
+				disable_vsync = true;
+				OS::get_singleton()->_writing_movie = true;
+			} else {
+				OS::get_singleton()->print("Missing benchmark-scene argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--write-movie-subframes") {
 			if (I->next()) {
 				Engine::get_singleton()->set_write_movie_subframes(I->next()->get().to_int());
@@ -1805,6 +1839,18 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 #endif
 	}
 
+	// Back large allocations with large pages, only for running projects.
+	{
+		int large_pages_threshold_mb = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "memory/large_pages/threshold_mb", PROPERTY_HINT_RANGE, "0,1024,1,suffix:MiB"), 0);
+		if (!editor && !project_manager && large_pages_threshold_mb > 0) {
+			if (Memory::has_large_pages()) {
+				Memory::set_large_pages_threshold(large_pages_threshold_mb * 1024 * 1024);
+			} else {
+				print_verbose("Large pages are not available on this system, allocations use regular pages.");
+			}
+		}
+	}
+
 	// Initialize WorkerThreadPool.
 	{
 #ifdef THREADS_ENABLED
@@ -1813,7 +1859,17 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else {
 			int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 			float low_priority_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio);
+			bool numa_pinning = GLOBAL_GET("threading/worker_pool/numa_pinning");
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio, numa_pinning);
+
+			// The render thread applies the same affinity when it starts.
+			uint64_t performance_core_mask = OS::get_singleton()->get_performance_core_mask();
+			if (performance_core_mask && bool(GLOBAL_GET("threading/affinity/main_threads_on_performance_cores"))) {
+				Thread::set_affinity(performance_core_mask);
+			}
+			if (GLOBAL_GET("threading/affinity/low_priority_tasks_on_efficiency_cores")) {
+				WorkerThreadPool::get_singleton()->set_low_priority_affinity_mask(OS::get_singleton()->get_efficiency_core_mask());
+			}
 		}
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
@@ -1840,6 +1896,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		display_driver = NULL_DISPLAY_DRIVER;
 	}
 
+	// Nothing is rendered nor played when headless, so servers can skip loading media data entirely.
+	// Never done for tools, which need the actual resources (e.g. to import or export them).
+	GLOBAL_DEF("application/run/headless_placeholder_resources", false);
+	if (!editor && !project_manager && !cmdline_tool && (placeholder_resources || (GLOBAL_GET("application/run/headless_placeholder_resources") && display_driver == NULL_DISPLAY_DRIVER))) {
+		ResourceLoader::set_load_placeholders(true);
+		print_verbose("Loading media resources as placeholders.");
+	}
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "network/limits/debugger/max_chars_per_second", PROPERTY_HINT_RANGE, "0, 4096, 1, or_greater"), 32768);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "network/limits/debugger/max_queued_messages", PROPERTY_HINT_RANGE, "0, 8192, 1, or_greater"), 2048);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "network/limits/debugger/max_errors_per_second", PROPERTY_HINT_RANGE, "0, 200, 1, or_greater"), 400);
@@ -1938,6 +2002,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	}
 
 	Logger::set_flush_stdout_on_print(GLOBAL_GET("application/run/flush_stdout_on_print"));
+	OS::get_singleton()->set_async_logging(GLOBAL_GET("application/run/async_logging"));
 
 	OS::get_singleton()->set_cmdline(execpath, main_args, user_args);
 
@@ -2387,6 +2452,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	Engine::get_singleton()->set_max_physics_steps_per_frame(GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "physics/common/max_physics_steps_per_frame", PROPERTY_HINT_RANGE, "1,100,1"), 8));
 	Engine::get_singleton()->set_physics_jitter_fix(GLOBAL_DEF("physics/common/physics_jitter_fix", 0.5));
 	Engine::get_singleton()->set_max_fps(GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/max_fps", PROPERTY_HINT_RANGE, "0,1000,1"), 0));
+	GLOBAL_DEF("application/run/thermal_throttling", false);
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/output_latency", PROPERTY_HINT_RANGE, "1,100,1"), 15);
 	// Use a safer default output_latency for web to avoid audio cracking on low-end devices, especially mobile.
@@ -2565,6 +2631,13 @@ Error _parse_resource_dummy(void *p_data, VariantParser::Stream *p_stream, Ref<R
 	return OK;
 }
 
+static void _load_text_server_support_data(void *p_userdata) {
+	Ref<TextServer> ts = TextServerManager::get_singleton()->get_primary_interface();
+	if (ts.is_valid()) {
+		ts->load_support_data(text_server_support_data_path);
+	}
+}
+
 Error Main::setup2(bool p_show_boot_logo) {
 	OS::get_singleton()->benchmark_begin_measure("Startup", "Main::Setup2");
 
@@ -2981,6 +3054,11 @@ Error Main::setup2(bool p_show_boot_logo) {
 
 		ResourceLoader::load_path_remaps();
 
+		uint64_t retained_budget_mb = GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/resource_cache/retained_budget_mb", PROPERTY_HINT_RANGE, "0,65536,1,suffix:MiB"), 0);
+		if (!editor) {
+			ResourceCache::set_retained_budget(retained_budget_mb * 1024 * 1024);
+		}
+
 		OS::get_singleton()->benchmark_end_measure("Startup", "Translations and Remaps");
 	}
 
@@ -3043,7 +3121,9 @@ Error Main::setup2(bool p_show_boot_logo) {
 			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(text_driver_idx);
 			TextServerManager::get_singleton()->set_primary_interface(ts);
 			if (ts->has_feature(TextServer::FEATURE_USE_SUPPORT_DATA)) {
-				ts->load_support_data("res://" + ts->get_support_data_filename());
+				// Nothing shapes text until the scripts and the default theme are loaded, which waits for this.
+				text_server_support_data_path = "res://" + ts->get_support_data_filename();
+				text_server_support_data_task = WorkerThreadPool::get_singleton()->add_native_task(&_load_text_server_support_data, nullptr, true, "Load text server support data");
 			}
 		} else {
 			ERR_FAIL_V_MSG(ERR_CANT_CREATE, "TextServer: Unable to create TextServer interface.");
@@ -3128,6 +3208,11 @@ Error Main::setup2(bool p_show_boot_logo) {
 
 	register_server_singletons();
 
+	if (text_server_support_data_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(text_server_support_data_task);
+		text_server_support_data_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
 	// This loads global classes, so it must happen before custom loaders and savers are registered
 	ScriptServer::init_languages();
 
@@ -3828,6 +3913,9 @@ int Main::start() {
 			bool font_oversampling = GLOBAL_GET("gui/fonts/dynamic_fonts/use_oversampling");
 			sml->get_root()->set_use_font_oversampling(font_oversampling);
 
+			bool font_async_rasterization = GLOBAL_GET("gui/fonts/dynamic_fonts/async_rasterization");
+			TS->set_async_glyph_rasterization(font_async_rasterization);
+
 			int texture_filter = GLOBAL_GET("rendering/textures/canvas_textures/default_texture_filter");
 			int texture_repeat = GLOBAL_GET("rendering/textures/canvas_textures/default_texture_repeat");
 			sml->get_root()->set_default_canvas_item_texture_filter(
@@ -4015,6 +4103,10 @@ static uint64_t navigation_process_max = 0;
 // will terminate the program. In case of failure, the OS exit code needs
 // to be set explicitly here (defaults to EXIT_SUCCESS).
 bool Main::iteration() {
+	TIMELINE_ZONE("Main::iteration");
+
+	FrameArena::begin_frame();
+
 	iterating++;
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
@@ -4057,10 +4149,18 @@ bool Main::iteration() {
 	XRServer::get_singleton()->_process();
 #endif // _3D_DISABLED
 
-	NavigationServer2D::get_singleton()->sync();
-	NavigationServer3D::get_singleton()->sync();
+	{
+		MemoryTagScope tag_scope(Memory::TAG_NAVIGATION);
+		NavigationServer2D::get_singleton()->sync();
+		NavigationServer3D::get_singleton()->sync();
+	}
+
+	// Physics and process steps of this frame share the same batch of raw mouse motion.
+	Input::get_singleton()->flush_mouse_motion_samples();
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		TIMELINE_ZONE("Main::iteration physics");
+
 		if (Input::get_singleton()->is_agile_input_event_flushing()) {
 			Input::get_singleton()->flush_buffered_events();
 		}
@@ -4095,20 +4195,27 @@ bool Main::iteration() {
 
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
-		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		{
+			MemoryTagScope tag_scope(Memory::TAG_NAVIGATION);
+			NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		}
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
 
 		message_queue->flush();
 
+		{
+			MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
+
 #ifndef _3D_DISABLED
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
 #endif // _3D_DISABLED
 
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -4124,10 +4231,14 @@ bool Main::iteration() {
 
 	uint64_t process_begin = OS::get_singleton()->get_ticks_usec();
 
-	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
-		exit = true;
+	{
+		TIMELINE_ZONE("Main::iteration process");
+
+		if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
+			exit = true;
+		}
+		message_queue->flush();
 	}
-	message_queue->flush();
 
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
@@ -4192,7 +4303,11 @@ bool Main::iteration() {
 
 	if (movie_writer) {
 		if (Engine::get_singleton()->_process_frames % (1 + Engine::get_singleton()->get_write_movie_subframes()) == 0) {
-			movie_writer->add_frame();
+			MovieWriter::FrameStats frame_stats;
+			frame_stats.process_usec = process_ticks;
+			frame_stats.physics_process_usec = physics_process_ticks;
+			frame_stats.navigation_process_usec = navigation_process_ticks;
+			movie_writer->add_frame(frame_stats);
 		}
 	}
 
@@ -4275,6 +4390,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceCache::clear_retained();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
@@ -37,6 +37,7 @@
 #include "servers/audio_server.h"
 #include "servers/navigation_server_3d.h"
 #include "servers/rendering_server.h"
+#include "servers/text_server.h"
 
 // 2D
 #include "servers/physics_server_2d.h"
@@ -91,6 +92,16 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(MEMORY_FRAME_ARENA_MAX);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_PASSES);
+	BIND_ENUM_CONSTANT(TEXT_SHAPING_CACHE_HITS);
+	BIND_ENUM_CONSTANT(TEXT_SHAPING_CACHE_MISSES);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_TEXTURES);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_NAVIGATION);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -141,6 +152,16 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation/edges_merged"),
 		PNAME("navigation/edges_connected"),
 		PNAME("navigation/edges_free"),
+		PNAME("memory/frame_arena_max"),
+		PNAME("gui/layout_passes"),
+		PNAME("text/shaping_cache_hits"),
+		PNAME("text/shaping_cache_misses"),
+		PNAME("memory/rendering"),
+		PNAME("memory/textures"),
+		PNAME("memory/script"),
+		PNAME("memory/physics"),
+		PNAME("memory/navigation"),
+		PNAME("memory/audio"),
 
 	};
 
@@ -225,6 +246,28 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case MEMORY_FRAME_ARENA_MAX:
+			return FrameArena::get_max_frame_usage();
+		case GUI_LAYOUT_PASSES: {
+			SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+			return sml ? sml->get_layout_passes_in_last_frame() : 0;
+		}
+		case TEXT_SHAPING_CACHE_HITS:
+			return TS.is_valid() ? TS->shaped_text_get_cache_hits() : 0;
+		case TEXT_SHAPING_CACHE_MISSES:
+			return TS.is_valid() ? TS->shaped_text_get_cache_misses() : 0;
+		case MEMORY_RENDERING:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_RENDERING);
+		case MEMORY_TEXTURES:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_TEXTURE);
+		case MEMORY_SCRIPT:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_SCRIPT);
+		case MEMORY_PHYSICS:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_PHYSICS);
+		case MEMORY_NAVIGATION:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_NAVIGATION);
+		case MEMORY_AUDIO:
+			return Memory::get_mem_usage_by_tag(Memory::TAG_AUDIO);
 
 		default: {
 		}
@@ -272,6 +315,16 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -100,6 +100,16 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		MEMORY_FRAME_ARENA_MAX,
+		GUI_LAYOUT_PASSES,
+		TEXT_SHAPING_CACHE_HITS,
+		TEXT_SHAPING_CACHE_MISSES,
+		MEMORY_RENDERING,
+		MEMORY_TEXTURES,
+		MEMORY_SCRIPT,
+		MEMORY_PHYSICS,
+		MEMORY_NAVIGATION,
+		MEMORY_AUDIO,
 		MONITOR_MAX
 	};
 
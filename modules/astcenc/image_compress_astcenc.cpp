@@ -30,11 +30,67 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 #include <astcenc.h>
 
+// Rows of blocks per task, small enough to balance the largest mip across threads.
+static const int ASTCENC_TASK_BLOCK_ROWS = 16;
+
+// A horizontal strip of whole block rows of one mip. Blocks are independent, so a strip compressed as its own
+// image produces exactly the blocks the full mip would have at that position.
+struct ASTCCompressionTask {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	int width = 0;
+	int height = 0;
+	size_t dst_len = 0;
+};
+
+struct ASTCCompressionJobQueue {
+	bool is_hdr = false;
+	const ASTCCompressionTask *tasks = nullptr;
+	uint32_t num_tasks = 0;
+	SafeNumeric<uint32_t> current_task;
+	astcenc_context *const *contexts = nullptr;
+	SafeFlag failed;
+};
+
+static void _digest_astc_job_queue(void *p_job_queue, uint32_t p_index) {
+	ASTCCompressionJobQueue *job_queue = static_cast<ASTCCompressionJobQueue *>(p_job_queue);
+	// Each thread has its own single threaded context, astcenc contexts can't be shared between images.
+	astcenc_context *context = job_queue->contexts[p_index];
+
+	const astcenc_swizzle swizzle = {
+		ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
+	};
+
+	for (uint32_t i = job_queue->current_task.postincrement(); i < job_queue->num_tasks; i = job_queue->current_task.postincrement()) {
+		const ASTCCompressionTask &task = job_queue->tasks[i];
+
+		const uint8_t *slices = task.src;
+
+		astcenc_image image;
+		image.dim_x = task.width;
+		image.dim_y = task.height;
+		image.dim_z = 1;
+		image.data_type = job_queue->is_hdr ? ASTCENC_TYPE_F32 : ASTCENC_TYPE_U8;
+		image.data = (void **)(&slices);
+
+		astcenc_error status = astcenc_compress_image(context, &image, &swizzle, task.dst, task.dst_len, 0);
+		astcenc_compress_reset(context);
+
+		if (unlikely(status != ASTCENC_SUCCESS)) {
+			job_queue->failed.set();
+			ERR_FAIL_MSG(vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
+		}
+	}
+}
+
 void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -112,61 +168,73 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Configuration initialization failed: %s.", astcenc_get_error_string(status)));
 
-	// Context allocation.
-
-	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
-	status = astcenc_context_alloc(&config, thread_count, &context);
-	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
-			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
-
 	Vector<uint8_t> image_data = r_img->get_data();
+	const int src_pixel_size = Image::get_format_pixel_size(r_img->get_format());
+
+	LocalVector<ASTCCompressionTask> tasks;
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
 	for (int i = 0; i < mip_count + 1; i++) {
 		int src_mip_w, src_mip_h;
 		int64_t src_ofs = Image::get_image_mipmap_offset_and_dimensions(width, height, r_img->get_format(), i, src_mip_w, src_mip_h);
 
-		const uint8_t *slices = &image_data.ptr()[src_ofs];
-
 		int dst_mip_w, dst_mip_h;
 		int64_t dst_ofs = Image::get_image_mipmap_offset_and_dimensions(width, height, target_format, i, dst_mip_w, dst_mip_h);
 		// Ensure that mip offset is a multiple of 8 (etcpak expects uint64_t pointer).
-		if (unlikely(dst_ofs % 8 != 0)) {
-			astcenc_context_free(context);
-			ERR_FAIL_MSG("astcenc: Mip offset is not a multiple of 8.");
-		}
-		uint8_t *dest_mip_write = (uint8_t *)&dest_write[dst_ofs];
-
-		// Compress image.
-
-		astcenc_image image;
-		image.dim_x = src_mip_w;
-		image.dim_y = src_mip_h;
-		image.dim_z = 1;
-		image.data_type = ASTCENC_TYPE_U8;
-		if (is_hdr) {
-			image.data_type = ASTCENC_TYPE_F32;
-		}
-		image.data = (void **)(&slices);
+		ERR_FAIL_COND_MSG(dst_ofs % 8 != 0, "astcenc: Mip offset is not a multiple of 8.");
 
 		// Compute the number of ASTC blocks in each dimension.
 		unsigned int block_count_x = (src_mip_w + block_x - 1) / block_x;
 		unsigned int block_count_y = (src_mip_h + block_y - 1) / block_y;
-		size_t comp_len = block_count_x * block_count_y * 16;
 
-		const astcenc_swizzle swizzle = {
-			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
-		};
+		for (unsigned int row = 0; row < block_count_y; row += ASTCENC_TASK_BLOCK_ROWS) {
+			unsigned int rows = MIN((unsigned int)ASTCENC_TASK_BLOCK_ROWS, block_count_y - row);
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+			ASTCCompressionTask task;
+			task.src = &image_data.ptr()[src_ofs + int64_t(row) * block_y * src_mip_w * src_pixel_size];
+			task.dst = &dest_write[dst_ofs + int64_t(row) * block_count_x * 16];
+			task.width = src_mip_w;
+			task.height = MIN(int(rows * block_y), src_mip_h - int(row * block_y));
+			task.dst_len = rows * block_count_x * 16;
+			tasks.push_back(task);
+		}
+	}
 
-		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
-				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
-		astcenc_compress_reset(context);
+	// Context allocation, one per thread taking part.
+
+	const uint32_t thread_count = CLAMP((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), 1u, tasks.size());
+	LocalVector<astcenc_context *> contexts;
+	contexts.resize(thread_count);
+	for (uint32_t i = 0; i < thread_count; i++) {
+		status = astcenc_context_alloc(&config, 1, &contexts[i]);
+		if (unlikely(status != ASTCENC_SUCCESS)) {
+			for (uint32_t j = 0; j < i; j++) {
+				astcenc_context_free(contexts[j]);
+			}
+			ERR_FAIL_MSG(vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
+		}
 	}
 
-	astcenc_context_free(context);
+	// Compress image.
+
+	ASTCCompressionJobQueue job_queue;
+	job_queue.is_hdr = is_hdr;
+	job_queue.tasks = tasks.ptr();
+	job_queue.num_tasks = tasks.size();
+	job_queue.contexts = contexts.ptr();
+
+	if (thread_count == 1) {
+		_digest_astc_job_queue(&job_queue, 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_astc_job_queue, &job_queue, thread_count, -1, true, SNAME("ASTC Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	for (astcenc_context *context : contexts) {
+		astcenc_context_free(context);
+	}
+
+	ERR_FAIL_COND_MSG(job_queue.failed.is_set(), "astcenc: ASTC image compression failed, the image was left uncompressed.");
 
 	// Replace original image with compressed one.
 
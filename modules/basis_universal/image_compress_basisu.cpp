@@ -30,6 +30,12 @@
 
 #include "image_compress_basisu.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering_server.h"
 
 #include <transcoder/basisu_transcoder.h>
@@ -37,12 +43,24 @@
 #include <encoder/basisu_comp.h>
 #endif
 
+#define BASIS_TRANSCODE_CACHE_VERSION 1
+
+static String transcode_cache_dir;
+
 void basis_universal_init() {
 #ifdef TOOLS_ENABLED
 	basisu::basisu_encoder_init();
 #endif
 
 	basist::basisu_transcoder_init();
+
+	if (GLOBAL_GET("rendering/textures/basis_universal/cache_transcoded_textures")) {
+		String cache_dir = Engine::get_singleton()->get_shader_cache_path();
+		if (cache_dir.is_empty()) {
+			cache_dir = "user://";
+		}
+		transcode_cache_dir = cache_dir.path_join("basis_universal_cache");
+	}
 }
 
 #ifdef TOOLS_ENABLED
@@ -206,6 +224,97 @@ Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::UsedCha
 }
 #endif // TOOLS_ENABLED
 
+static String _get_transcode_cache_path(const uint8_t *p_data, int p_size, basist::transcoder_texture_format p_format) {
+	unsigned char hash[32];
+	if (CryptoCore::sha256(p_data, p_size, hash) != OK) {
+		return String();
+	}
+	return transcode_cache_dir.path_join(String::hex_encode_buffer(hash, 32) + "." + itos((int)p_format) + ".cache");
+}
+
+static Ref<Image> _load_transcode_cache(const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return Ref<Image>();
+	}
+
+	uint8_t magic[4];
+	f->get_buffer(magic, 4);
+	if (magic[0] != 'B' || magic[1] != 'U' || magic[2] != 'T' || magic[3] != 'C' || f->get_32() != BASIS_TRANSCODE_CACHE_VERSION) {
+		return Ref<Image>();
+	}
+
+	uint32_t width = f->get_32();
+	uint32_t height = f->get_32();
+	bool mipmaps = f->get_8();
+	uint32_t format = f->get_32();
+	uint64_t data_size = f->get_64();
+	if (width == 0 || height == 0 || width > Image::MAX_WIDTH || height > Image::MAX_HEIGHT || format >= Image::FORMAT_MAX || data_size != (uint64_t)Image::get_image_data_size(width, height, Image::Format(format), mipmaps)) {
+		return Ref<Image>();
+	}
+
+	Vector<uint8_t> data;
+	data.resize(data_size);
+	if (f->get_buffer(data.ptrw(), data_size) != data_size) {
+		return Ref<Image>();
+	}
+
+	return Image::create_from_data(width, height, mipmaps, Image::Format(format), data);
+}
+
+static void _save_transcode_cache(const String &p_path, const Ref<Image> &p_image) {
+	Error err = DirAccess::make_dir_recursive_absolute(transcode_cache_dir);
+	ERR_FAIL_COND_MSG(err != OK && err != ERR_ALREADY_EXISTS, "Can't create BasisUniversal transcode cache folder: " + transcode_cache_dir);
+
+	// Write to a temporary file first so concurrent loads never see a partial cache entry.
+	String tmp_path = p_path + ".tmp";
+	{
+		Ref<FileAccess> f = FileAccess::open(tmp_path, FileAccess::WRITE);
+		ERR_FAIL_COND(f.is_null());
+
+		const Vector<uint8_t> data = p_image->get_data();
+		f->store_buffer((const uint8_t *)"BUTC", 4);
+		f->store_32(BASIS_TRANSCODE_CACHE_VERSION);
+		f->store_32(p_image->get_width());
+		f->store_32(p_image->get_height());
+		f->store_8(p_image->has_mipmaps());
+		f->store_32(p_image->get_format());
+		f->store_64(data.size());
+		f->store_buffer(data.ptr(), data.size());
+	}
+
+	Ref<DirAccess> da = DirAccess::create_for_path(transcode_cache_dir);
+	if (da->rename(tmp_path, p_path) != OK) {
+		da->remove(tmp_path);
+	}
+}
+
+struct BasisTranscodeLevels {
+	const basist::basisu_transcoder *transcoder = nullptr;
+	const uint8_t *src = nullptr;
+	uint32_t src_size = 0;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	Image::Format image_format = Image::FORMAT_MAX;
+	basist::transcoder_texture_format basisu_format = basist::transcoder_texture_format::cTFTotalTextureFormats;
+	uint8_t *dst = nullptr;
+	// The transcoder is only thread safe when each level gets its own state.
+	LocalVector<basist::basisu_transcoder_state> states;
+	LocalVector<uint8_t> results;
+};
+
+static void _transcode_level(void *p_userdata, uint32_t p_level) {
+	BasisTranscodeLevels *levels = (BasisTranscodeLevels *)p_userdata;
+
+	basist::basisu_image_level_info basisu_level;
+	levels->transcoder->get_image_level_info(levels->src, levels->src_size, basisu_level, 0, p_level);
+
+	uint32_t mip_block_or_pixel_count = Image::is_format_compressed(levels->image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
+	int64_t ofs = Image::get_image_mipmap_offset(levels->width, levels->height, levels->image_format, p_level);
+
+	levels->results[p_level] = levels->transcoder->transcode_image_level(levels->src, levels->src_size, 0, p_level, levels->dst + ofs, mip_block_or_pixel_count, levels->basisu_format, 0, 0, &levels->states[p_level]);
+}
+
 Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	Ref<Image> image;
 	ERR_FAIL_NULL_V_MSG(p_data, image, "Cannot unpack invalid BasisUniversal data.");
@@ -284,6 +393,18 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 		} break;
 	}
 
+	String cache_path;
+	if (!transcode_cache_dir.is_empty()) {
+		// The target format depends on the device, so it is part of the key.
+		cache_path = _get_transcode_cache_path(p_data, p_size, basisu_format);
+		if (!cache_path.is_empty()) {
+			image = _load_transcode_cache(cache_path);
+			if (image.is_valid()) {
+				return image;
+			}
+		}
+	}
+
 	src_ptr += 4;
 	src_size -= 4;
 
@@ -302,17 +423,31 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	uint8_t *dst = out_data.ptrw();
 	memset(dst, 0, out_data.size());
 
-	for (uint32_t i = 0; i < basisu_info.m_total_levels; i++) {
-		basist::basisu_image_level_info basisu_level;
-		transcoder.get_image_level_info(src_ptr, src_size, basisu_level, 0, i);
-
-		uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
-		int64_t ofs = Image::get_image_mipmap_offset(basisu_info.m_width, basisu_info.m_height, image_format, i);
-
-		bool result = transcoder.transcode_image_level(src_ptr, src_size, 0, i, dst + ofs, mip_block_or_pixel_count, basisu_format);
+	BasisTranscodeLevels levels;
+	levels.transcoder = &transcoder;
+	levels.src = src_ptr;
+	levels.src_size = src_size;
+	levels.width = basisu_info.m_width;
+	levels.height = basisu_info.m_height;
+	levels.image_format = image_format;
+	levels.basisu_format = basisu_format;
+	levels.dst = dst;
+	levels.states.resize(basisu_info.m_total_levels);
+	levels.results.resize(basisu_info.m_total_levels);
+
+	// Each mip level is written to its own region of the output, so levels can be transcoded in parallel.
+	if (basisu_info.m_total_levels > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_transcode_level, &levels, basisu_info.m_total_levels, -1, true, SNAME("BasisUniversalTranscode"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (basisu_info.m_total_levels == 1) {
+		_transcode_level(&levels, 0);
+	}
 
-		if (!result) {
+	bool success = true;
+	for (uint32_t i = 0; i < basisu_info.m_total_levels; i++) {
+		if (!levels.results[i]) {
 			print_line(vformat("BasisUniversal cannot unpack level %d.", i));
+			success = false;
 			break;
 		}
 	}
@@ -324,6 +459,10 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 		image->convert_ra_rgba8_to_rg();
 	}
 
+	if (success && !cache_path.is_empty()) {
+		_save_transcode_cache(cache_path, image);
+	}
+
 	return image;
 }
 
@@ -32,11 +32,15 @@
 
 #include "image_compress_basisu.h"
 
+#include "core/config/project_settings.h"
+
 void initialize_basis_universal_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
 
+	GLOBAL_DEF("rendering/textures/basis_universal/cache_transcoded_textures", false);
+
 	basis_universal_init();
 
 #ifdef TOOLS_ENABLED
@@ -192,6 +192,86 @@ void CSGBrush::_regen_face_aabbs() {
 		faces.write[i].aabb.expand_to(faces[i].vertices[1]);
 		faces.write[i].aabb.expand_to(faces[i].vertices[2]);
 	}
+	face_bvh_dirty = true;
+}
+
+int CSGBrush::_build_face_bvh(int p_from, int p_count) const {
+	const Face *faces_ptr = faces.ptr();
+	int *indices = face_bvh_faces.ptr() + p_from;
+
+	int node_index = face_bvh.size();
+	face_bvh.push_back(FaceBVHNode());
+
+	AABB aabb = faces_ptr[indices[0]].aabb;
+	AABB centers(faces_ptr[indices[0]].aabb.get_center(), Vector3());
+	for (int i = 1; i < p_count; i++) {
+		aabb.merge_with(faces_ptr[indices[i]].aabb);
+		centers.expand_to(faces_ptr[indices[i]].aabb.get_center());
+	}
+	face_bvh[node_index].aabb = aabb;
+
+	if (p_count <= 4) {
+		face_bvh[node_index].first_face = p_from;
+		face_bvh[node_index].face_count = p_count;
+		return node_index;
+	}
+
+	// Median split along the axis where the face centers are most spread out.
+	struct FaceCenterCmp {
+		const Face *faces = nullptr;
+		int axis = 0;
+		_FORCE_INLINE_ bool operator()(int p_left, int p_right) const {
+			return faces[p_left].aabb.get_center()[axis] < faces[p_right].aabb.get_center()[axis];
+		}
+	};
+	SortArray<int, FaceCenterCmp> sorter;
+	sorter.compare.faces = faces_ptr;
+	sorter.compare.axis = centers.get_longest_axis_index();
+	int half = p_count / 2;
+	sorter.nth_element(0, p_count, half, indices);
+
+	_build_face_bvh(p_from, half);
+	int right = _build_face_bvh(p_from + half, p_count - half);
+	face_bvh[node_index].right_child = right;
+	return node_index;
+}
+
+void CSGBrush::get_faces_intersecting(const AABB &p_aabb, LocalVector<int> &r_faces) const {
+	if (face_bvh_dirty) {
+		face_bvh.clear();
+		face_bvh_faces.resize(faces.size());
+		for (int i = 0; i < faces.size(); i++) {
+			face_bvh_faces[i] = i;
+		}
+		if (!faces.is_empty()) {
+			_build_face_bvh(0, faces.size());
+		}
+		face_bvh_dirty = false;
+	}
+	if (face_bvh.is_empty()) {
+		return;
+	}
+
+	int stack[64];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+	while (stack_size > 0) {
+		const FaceBVHNode &node = face_bvh[stack[--stack_size]];
+		if (!node.aabb.intersects_inclusive(p_aabb)) {
+			continue;
+		}
+		if (node.face_count > 0) {
+			for (int i = node.first_face; i < node.first_face + node.face_count; i++) {
+				if (faces[face_bvh_faces[i]].aabb.intersects_inclusive(p_aabb)) {
+					r_faces.push_back(face_bvh_faces[i]);
+				}
+			}
+		} else {
+			ERR_FAIL_COND(stack_size + 2 > 64);
+			stack[stack_size++] = node.right_child;
+			stack[stack_size++] = int(&node - face_bvh.ptr()) + 1;
+		}
+	}
 }
 
 void CSGBrush::build_from_faces(const Vector<Vector3> &p_vertices, const Vector<Vector2> &p_uvs, const Vector<bool> &p_smooth, const Vector<Ref<Material>> &p_materials, const Vector<bool> &p_flip_faces) {
@@ -283,11 +363,14 @@ void CSGBrush::copy_from(const CSGBrush &p_brush, const Transform3D &p_xform) {
 void CSGBrushOperation::merge_brushes(Operation p_operation, const CSGBrush &p_brush_a, const CSGBrush &p_brush_b, CSGBrush &r_merged_brush, float p_vertex_snap) {
 	// Check for face collisions and add necessary faces.
 	Build2DFaceCollection build2DFaceCollection;
+	LocalVector<int> candidates;
 	for (int i = 0; i < p_brush_a.faces.size(); i++) {
-		for (int j = 0; j < p_brush_b.faces.size(); j++) {
-			if (p_brush_a.faces[i].aabb.intersects_inclusive(p_brush_b.faces[j].aabb)) {
-				update_faces(p_brush_a, i, p_brush_b, j, build2DFaceCollection, p_vertex_snap);
-			}
+		candidates.clear();
+		p_brush_b.get_faces_intersecting(p_brush_a.faces[i].aabb, candidates);
+		// Keep the pairs in face order so the result doesn't depend on the tree layout.
+		candidates.sort();
+		for (const int j : candidates) {
+			update_faces(p_brush_a, i, p_brush_b, j, build2DFaceCollection, p_vertex_snap);
 		}
 	}
 
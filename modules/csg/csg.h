@@ -38,6 +38,7 @@
 #include "core/math/vector3.h"
 #include "core/object/ref_counted.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/vector.h"
 #include "scene/resources/material.h"
@@ -55,6 +56,21 @@ struct CSGBrush {
 	Vector<Face> faces;
 	Vector<Ref<Material>> materials;
 
+	// Bounding volume hierarchy over the faces, built on first query and kept
+	// for the lifetime of the brush. Leaves reference a range of face_bvh_faces.
+	struct FaceBVHNode {
+		AABB aabb;
+		int first_face = 0;
+		int face_count = 0; // 0 for internal nodes, whose left child is the next node.
+		int right_child = -1;
+	};
+	mutable LocalVector<FaceBVHNode> face_bvh;
+	mutable LocalVector<int> face_bvh_faces;
+	mutable bool face_bvh_dirty = true;
+
+	int _build_face_bvh(int p_from, int p_count) const;
+	void get_faces_intersecting(const AABB &p_aabb, LocalVector<int> &r_faces) const;
+
 	inline void _regen_face_aabbs();
 
 	// Create a brush from faces.
@@ -31,6 +31,7 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -167,79 +168,126 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 	dirty = true;
 }
 
+void CSGShape3D::_collect_dirty_shapes(uint32_t p_depth, LocalVector<LocalVector<CSGShape3D *>> &r_levels) {
+	// Everything touching the scene tree happens here, on the calling thread.
+	// Shapes that aren't dirty keep their cached brush and aren't visited.
+	if (brush) {
+		memdelete(brush);
+	}
+	brush = nullptr;
+
+	merge_base = _build_brush();
+	merge_children.clear();
+
+	for (int i = 0; i < get_child_count(); i++) {
+		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (!child) {
+			continue;
+		}
+		if (!child->is_visible()) {
+			continue;
+		}
+
+		if (child->dirty) {
+			child->_collect_dirty_shapes(p_depth + 1, r_levels);
+		}
+
+		MergeChild merge_child;
+		merge_child.shape = child;
+		merge_child.transform = child->get_transform();
+		merge_child.operation = child->get_operation();
+		merge_children.push_back(merge_child);
+	}
+
+	if (r_levels.size() <= p_depth) {
+		r_levels.resize(p_depth + 1);
+	}
+	r_levels[p_depth].push_back(this);
+}
+
+void CSGShape3D::_merge_child_brushes_task(uint32_t p_index, CSGShape3D **p_shapes) {
+	p_shapes[p_index]->_merge_child_brushes();
+}
+
 CSGBrush *CSGShape3D::_get_brush() {
 	if (dirty) {
-		if (brush) {
-			memdelete(brush);
+		LocalVector<LocalVector<CSGShape3D *>> levels;
+		_collect_dirty_shapes(0, levels);
+
+		// Children are merged before their parents, and shapes at the same depth
+		// don't depend on each other, so each level is evaluated in parallel.
+		for (int i = int(levels.size()) - 1; i >= 0; i--) {
+			LocalVector<CSGShape3D *> &level = levels[i];
+			if (level.size() > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CSGShape3D::_merge_child_brushes_task, level.ptr(), level.size(), -1, true, SNAME("CSGMergeBrushes"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				level[0]->_merge_child_brushes();
+			}
 		}
-		brush = nullptr;
+	}
+
+	return brush;
+}
 
-		CSGBrush *n = _build_brush();
+void CSGShape3D::_merge_child_brushes() {
+	CSGBrush *n = merge_base;
+	merge_base = nullptr;
 
-		for (int i = 0; i < get_child_count(); i++) {
-			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
-			if (!child) {
-				continue;
-			}
-			if (!child->is_visible()) {
-				continue;
-			}
+	for (const MergeChild &merge_child : merge_children) {
+		CSGBrush *n2 = merge_child.shape->brush;
+		if (!n2) {
+			continue;
+		}
+		if (!n) {
+			n = memnew(CSGBrush);
 
-			CSGBrush *n2 = child->_get_brush();
-			if (!n2) {
-				continue;
-			}
-			if (!n) {
-				n = memnew(CSGBrush);
+			n->copy_from(*n2, merge_child.transform);
 
-				n->copy_from(*n2, child->get_transform());
+		} else {
+			CSGBrush *nn = memnew(CSGBrush);
+			CSGBrush *nn2 = memnew(CSGBrush);
+			nn2->copy_from(*n2, merge_child.transform);
 
-			} else {
-				CSGBrush *nn = memnew(CSGBrush);
-				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
-
-				CSGBrushOperation bop;
-
-				switch (child->get_operation()) {
-					case CSGShape3D::OPERATION_UNION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_INTERSECTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_SUBTRACTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
-						break;
-				}
-				memdelete(n);
-				memdelete(nn2);
-				n = nn;
+			CSGBrushOperation bop;
+
+			switch (merge_child.operation) {
+				case CSGShape3D::OPERATION_UNION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_INTERSECTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_SUBTRACTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
+					break;
 			}
+			memdelete(n);
+			memdelete(nn2);
+			n = nn;
 		}
+	}
+	merge_children.clear();
 
-		if (n) {
-			AABB aabb;
-			for (int i = 0; i < n->faces.size(); i++) {
-				for (int j = 0; j < 3; j++) {
-					if (i == 0 && j == 0) {
-						aabb.position = n->faces[i].vertices[j];
-					} else {
-						aabb.expand_to(n->faces[i].vertices[j]);
-					}
+	if (n) {
+		AABB aabb;
+		for (int i = 0; i < n->faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				if (i == 0 && j == 0) {
+					aabb.position = n->faces[i].vertices[j];
+				} else {
+					aabb.expand_to(n->faces[i].vertices[j]);
 				}
 			}
-			node_aabb = aabb;
-		} else {
-			node_aabb = AABB();
 		}
-
-		brush = n;
-
-		dirty = false;
+		node_aabb = aabb;
+	} else {
+		node_aabb = AABB();
 	}
 
-	return brush;
+	brush = n;
+
+	dirty = false;
 }
 
 int CSGShape3D::mikktGetNumFaces(const SMikkTSpaceContext *pContext) {
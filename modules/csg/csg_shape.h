@@ -56,6 +56,15 @@ private:
 
 	CSGBrush *brush = nullptr;
 
+	// Inputs gathered on the main thread for rebuilding the brush of a dirty shape.
+	struct MergeChild {
+		CSGShape3D *shape = nullptr;
+		Transform3D transform;
+		Operation operation = OPERATION_UNION;
+	};
+	CSGBrush *merge_base = nullptr;
+	LocalVector<MergeChild> merge_children;
+
 	AABB node_aabb;
 
 	bool dirty = false;
@@ -107,6 +116,10 @@ private:
 	static void mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const float fvTangent[], const float fvBiTangent[], const float fMagS, const float fMagT,
 			const tbool bIsOrientationPreserving, const int iFace, const int iVert);
 
+	void _collect_dirty_shapes(uint32_t p_depth, LocalVector<LocalVector<CSGShape3D *>> &r_levels);
+	void _merge_child_brushes();
+	void _merge_child_brushes_task(uint32_t p_index, CSGShape3D **p_shapes);
+
 	void _update_shape();
 	void _update_collision_faces();
 	bool _is_debug_collision_shape_visible();
@@ -132,11 +132,10 @@ static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const
 static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
 	CVTTCompressionJobQueue *job_queue = static_cast<CVTTCompressionJobQueue *>(p_job_queue);
 	uint32_t num_tasks = job_queue->num_tasks;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t start = p_index * num_tasks / total_threads;
-	uint32_t end = (p_index + 1 == total_threads) ? num_tasks : ((p_index + 1) * num_tasks / total_threads);
 
-	for (uint32_t i = start; i < end; i++) {
+	// Rows are taken in order as threads become free. Splitting them evenly by count would leave the threads
+	// handed the rows of the first mip with far more work than those handed the smaller mips.
+	for (uint32_t i = job_queue->current_task.postincrement(); i < num_tasks; i = job_queue->current_task.postincrement()) {
 		_digest_row_task(job_queue->job_params, job_queue->job_tasks[i]);
 	}
 }
@@ -34,10 +34,12 @@
 
 #include "core/io/compression.h"
 #include "core/io/ip.h"
+#include "core/os/os.h"
 #include "core/variant/typed_array.h"
 
 void ENetConnection::broadcast(enet_uint8 p_channel, ENetPacket *p_packet) {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	ERR_FAIL_COND_MSG(p_channel >= host->channelLimit, vformat("Unable to send packet on channel %d, max channels: %d", p_channel, (int)host->channelLimit));
 	enet_host_broadcast(host, p_channel, p_packet);
 }
@@ -72,6 +74,8 @@ Error ENetConnection::create_host(int p_max_peers, int p_max_channels, int p_in_
 
 void ENetConnection::destroy() {
 	ERR_FAIL_NULL_MSG(host, "Host already destroyed.");
+	stop_service_thread();
+	_clear_events();
 	for (List<Ref<ENetPacketPeer>>::Element *E = peers.front(); E; E = E->next()) {
 		E->get()->_on_disconnect();
 	}
@@ -83,6 +87,7 @@ void ENetConnection::destroy() {
 Ref<ENetPacketPeer> ENetConnection::connect_to_host(const String &p_address, int p_port, int p_channels, int p_data) {
 	Ref<ENetPacketPeer> out;
 	ERR_FAIL_NULL_V_MSG(host, out, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	ERR_FAIL_COND_V_MSG(peers.size(), out, "The ENetConnection is already connected to a peer.");
 	ERR_FAIL_COND_V_MSG(p_port < 1 || p_port > 65535, out, "The remote port number must be between 1 and 65535 (inclusive).");
 
@@ -113,16 +118,16 @@ Ref<ENetPacketPeer> ENetConnection::connect_to_host(const String &p_address, int
 	if (peer == nullptr) {
 		return nullptr;
 	}
-	out = Ref<ENetPacketPeer>(memnew(ENetPacketPeer(peer)));
+	out = Ref<ENetPacketPeer>(memnew(ENetPacketPeer(peer, &mutex)));
 	peers.push_back(out);
 	return out;
 }
 
-ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event, Event &r_event) {
+ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event, Event &r_event, bool p_from_thread) {
 	switch (p_event.type) {
 		case ENET_EVENT_TYPE_CONNECT: {
 			if (p_event.peer->data == nullptr) {
-				Ref<ENetPacketPeer> pp = memnew(ENetPacketPeer(p_event.peer));
+				Ref<ENetPacketPeer> pp = memnew(ENetPacketPeer(p_event.peer, &mutex));
 				peers.push_back(pp);
 			}
 			r_event.peer = Ref<ENetPacketPeer>((ENetPacketPeer *)p_event.peer->data);
@@ -133,8 +138,12 @@ ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event,
 			// A peer disconnected.
 			if (p_event.peer->data != nullptr) {
 				Ref<ENetPacketPeer> pp = Ref<ENetPacketPeer>((ENetPacketPeer *)p_event.peer->data);
-				pp->_on_disconnect();
-				peers.erase(pp);
+				if (p_from_thread) {
+					pp->_detach(); // Released by the main thread when the event is popped.
+				} else {
+					pp->_on_disconnect();
+					peers.erase(pp);
+				}
 				r_event.peer = pp;
 				r_event.data = p_event.data;
 				return EVENT_DISCONNECT;
@@ -163,6 +172,7 @@ ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event)
 	ERR_FAIL_NULL_V_MSG(host, EVENT_ERROR, "The ENetConnection instance isn't currently active.");
 	ERR_FAIL_COND_V(r_event.peer.is_valid(), EVENT_ERROR);
 
+	MutexLock lock(mutex);
 	// Drop peers that have already been disconnected.
 	// NOTE: Forcibly disconnected peers (i.e. peers disconnected via
 	// enet_peer_disconnect*) do not trigger DISCONNECTED events.
@@ -174,6 +184,11 @@ ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event)
 		E = E->next();
 	}
 
+	if (_has_queued_events()) {
+		// Serviced on a thread (or it was, and there are events left), only pop what it received.
+		return _pop_event(r_event);
+	}
+
 	ENetEvent event;
 	int ret = enet_host_service(host, &event, p_timeout);
 
@@ -187,6 +202,14 @@ ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event)
 
 int ENetConnection::check_events(EventType &r_type, Event &r_event) {
 	ERR_FAIL_NULL_V_MSG(host, -1, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
+	if (_has_queued_events()) {
+		r_type = _pop_event(r_event);
+		if (r_type == EVENT_ERROR) {
+			return -1;
+		}
+		return r_type == EVENT_NONE ? 0 : 1;
+	}
 	ENetEvent event;
 	int ret = enet_host_check_events(host, &event);
 	if (ret < 0) {
@@ -199,31 +222,132 @@ int ENetConnection::check_events(EventType &r_type, Event &r_event) {
 
 void ENetConnection::flush() {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	if (service_thread_running.is_set()) {
+		return; // The service thread sends queued packets on its next iteration.
+	}
+	MutexLock lock(mutex);
 	enet_host_flush(host);
 }
 
+void ENetConnection::_service_thread_func(void *p_user) {
+	ENetConnection *connection = static_cast<ENetConnection *>(p_user);
+	while (connection->service_thread_running.is_set()) {
+		{
+			MutexLock lock(connection->mutex);
+			LocalVector<QueuedEvent> &queue = connection->event_queues[connection->service_queue];
+			ENetEvent event;
+			int ret = enet_host_service(connection->host, &event, 0);
+			// Servicing also sends queued packets, decrypts, and decompresses, keep going until there's nothing left.
+			while (ret > 0) {
+				QueuedEvent queued;
+				queued.type = connection->_parse_event(event, queued.event, true);
+				if (queued.type != EVENT_NONE) {
+					queue.push_back(queued);
+				}
+				ret = enet_host_service(connection->host, &event, 0);
+			}
+			if (ret < 0) {
+				QueuedEvent queued;
+				queued.type = EVENT_ERROR;
+				queue.push_back(queued);
+			}
+		}
+		OS::get_singleton()->delay_usec(connection->service_thread_interval_usec);
+	}
+}
+
+ENetConnection::EventType ENetConnection::_pop_event(Event &r_event) {
+	// Called with the mutex locked.
+	LocalVector<QueuedEvent> *queue = &event_queues[service_queue ^ 1];
+	if (read_index >= queue->size()) {
+		// Drained, swap with the queue filled by the service thread.
+		queue->clear();
+		read_index = 0;
+		service_queue ^= 1;
+		queue = &event_queues[service_queue ^ 1];
+		if (queue->is_empty()) {
+			return EVENT_NONE;
+		}
+	}
+	QueuedEvent &queued = (*queue)[read_index++];
+	r_event = queued.event;
+	queued.event = Event();
+	if (queued.type == EVENT_DISCONNECT) {
+		r_event.peer->_on_disconnect();
+		peers.erase(r_event.peer);
+	}
+	return queued.type;
+}
+
+bool ENetConnection::_has_queued_events() const {
+	return service_thread_running.is_set() || read_index < event_queues[service_queue ^ 1].size() || !event_queues[service_queue].is_empty();
+}
+
+void ENetConnection::_clear_events() {
+	for (LocalVector<QueuedEvent> &queue : event_queues) {
+		for (QueuedEvent &queued : queue) {
+			if (queued.type == EVENT_RECEIVE && queued.event.packet) {
+				enet_packet_destroy(queued.event.packet);
+			}
+		}
+		queue.clear();
+	}
+	read_index = 0;
+}
+
+Error ENetConnection::start_service_thread(int p_interval_usec) {
+#ifdef THREADS_ENABLED
+	ERR_FAIL_NULL_V_MSG(host, ERR_UNCONFIGURED, "The ENetConnection instance isn't currently active.");
+	ERR_FAIL_COND_V_MSG(service_thread_running.is_set(), ERR_ALREADY_IN_USE, "The ENetConnection instance is already serviced on a thread.");
+	ERR_FAIL_COND_V_MSG(p_interval_usec < 0, ERR_INVALID_PARAMETER, "The service interval must be greater than or equal to 0.");
+	service_thread_interval_usec = p_interval_usec;
+	service_thread_running.set();
+	service_thread.start(_service_thread_func, this);
+	return OK;
+#else
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Threads are not available in this build.");
+#endif
+}
+
+void ENetConnection::stop_service_thread() {
+	if (!service_thread_running.is_set()) {
+		return;
+	}
+	service_thread_running.clear();
+	service_thread.wait_to_finish();
+}
+
+bool ENetConnection::is_service_threaded() const {
+	return service_thread_running.is_set();
+}
+
 void ENetConnection::bandwidth_limit(int p_in_bandwidth, int p_out_bandwidth) {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	enet_host_bandwidth_limit(host, p_in_bandwidth, p_out_bandwidth);
 }
 
 void ENetConnection::channel_limit(int p_max_channels) {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	enet_host_channel_limit(host, p_max_channels);
 }
 
 void ENetConnection::bandwidth_throttle() {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	enet_host_bandwidth_throttle(host);
 }
 
 void ENetConnection::compress(CompressionMode p_mode) {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	Compressor::setup(host, p_mode);
 }
 
 double ENetConnection::pop_statistic(HostStatistic p_stat) {
 	ERR_FAIL_NULL_V_MSG(host, 0, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	uint32_t *ptr = nullptr;
 	switch (p_stat) {
 		case HOST_TOTAL_SENT_DATA:
@@ -259,6 +383,7 @@ int ENetConnection::get_local_port() const {
 }
 
 void ENetConnection::get_peers(List<Ref<ENetPacketPeer>> &r_peers) {
+	MutexLock lock(mutex);
 	for (const Ref<ENetPacketPeer> &I : peers) {
 		r_peers.push_back(I);
 	}
@@ -266,6 +391,7 @@ void ENetConnection::get_peers(List<Ref<ENetPacketPeer>> &r_peers) {
 
 TypedArray<ENetPacketPeer> ENetConnection::_get_peers() {
 	ERR_FAIL_NULL_V_MSG(host, Array(), "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	TypedArray<ENetPacketPeer> out;
 	for (const Ref<ENetPacketPeer> &I : peers) {
 		out.push_back(I);
@@ -277,6 +403,7 @@ Error ENetConnection::dtls_server_setup(const Ref<TLSOptions> &p_options) {
 #ifdef GODOT_ENET
 	ERR_FAIL_NULL_V_MSG(host, ERR_UNCONFIGURED, "The ENetConnection instance isn't currently active.");
 	ERR_FAIL_COND_V(p_options.is_null() || !p_options->is_server(), ERR_INVALID_PARAMETER);
+	MutexLock lock(mutex);
 	return enet_host_dtls_server_setup(host, const_cast<TLSOptions *>(p_options.ptr())) ? FAILED : OK;
 #else
 	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "ENet DTLS support not available in this build.");
@@ -286,6 +413,7 @@ Error ENetConnection::dtls_server_setup(const Ref<TLSOptions> &p_options) {
 void ENetConnection::refuse_new_connections(bool p_refuse) {
 #ifdef GODOT_ENET
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
+	MutexLock lock(mutex);
 	enet_host_refuse_new_connections(host, p_refuse);
 #else
 	ERR_FAIL_MSG("ENet DTLS support not available in this build.");
@@ -296,6 +424,7 @@ Error ENetConnection::dtls_client_setup(const String &p_hostname, const Ref<TLSO
 #ifdef GODOT_ENET
 	ERR_FAIL_NULL_V_MSG(host, ERR_UNCONFIGURED, "The ENetConnection instance isn't currently active.");
 	ERR_FAIL_COND_V(p_options.is_null() || p_options->is_server(), ERR_INVALID_PARAMETER);
+	MutexLock lock(mutex);
 	return enet_host_dtls_client_setup(host, p_hostname.utf8().get_data(), const_cast<TLSOptions *>(p_options.ptr())) ? FAILED : OK;
 #else
 	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "ENet DTLS support not available in this build.");
@@ -372,6 +501,7 @@ void ENetConnection::socket_send(const String &p_address, int p_port, const Pack
 	enet_buffers[0].data = (void *)p_packet.ptr();
 	enet_buffers[0].dataLength = p_packet.size();
 
+	MutexLock lock(mutex);
 	enet_socket_send(host->socket, &address, enet_buffers, 1);
 }
 
@@ -394,6 +524,9 @@ void ENetConnection::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_local_port"), &ENetConnection::get_local_port);
 	ClassDB::bind_method(D_METHOD("get_peers"), &ENetConnection::_get_peers);
 	ClassDB::bind_method(D_METHOD("socket_send", "destination_address", "destination_port", "packet"), &ENetConnection::socket_send);
+	ClassDB::bind_method(D_METHOD("start_service_thread", "interval_usec"), &ENetConnection::start_service_thread, DEFVAL(1000));
+	ClassDB::bind_method(D_METHOD("stop_service_thread"), &ENetConnection::stop_service_thread);
+	ClassDB::bind_method(D_METHOD("is_service_threaded"), &ENetConnection::is_service_threaded);
 
 	BIND_ENUM_CONSTANT(COMPRESS_NONE);
 	BIND_ENUM_CONSTANT(COMPRESS_RANGE_CODER);
@@ -35,6 +35,10 @@
 
 #include "core/crypto/crypto.h"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 #include <enet/enet.h>
 
@@ -79,10 +83,29 @@ protected:
 	static void _bind_methods();
 
 private:
+	struct QueuedEvent {
+		EventType type = EVENT_NONE;
+		Event event;
+	};
+
 	ENetHost *host = nullptr;
 	List<Ref<ENetPacketPeer>> peers;
 
-	EventType _parse_event(const ENetEvent &p_event, Event &r_event);
+	// Threaded service. The service thread fills one queue while the main thread drains the other.
+	Mutex mutex;
+	Thread service_thread;
+	SafeFlag service_thread_running;
+	uint64_t service_thread_interval_usec = 1000;
+	LocalVector<QueuedEvent> event_queues[2];
+	uint32_t service_queue = 0;
+	uint32_t read_index = 0;
+
+	static void _service_thread_func(void *p_user);
+	EventType _pop_event(Event &r_event);
+	bool _has_queued_events() const;
+	void _clear_events();
+
+	EventType _parse_event(const ENetEvent &p_event, Event &r_event, bool p_from_thread = false);
 	Error _create(ENetAddress *p_address, int p_max_peers, int p_max_channels, int p_in_bandwidth, int p_out_bandwidth);
 	Array _service(int p_timeout = 0);
 	void _broadcast(int p_channel, PackedByteArray p_packet, int p_flags);
@@ -133,6 +156,11 @@ public:
 	Error dtls_client_setup(const String &p_hostname, const Ref<TLSOptions> &p_options);
 	void refuse_new_connections(bool p_refuse);
 
+	Error start_service_thread(int p_interval_usec = 1000);
+	void stop_service_thread();
+	bool is_service_threaded() const;
+	Mutex &get_mutex() { return mutex; }
+
 	ENetConnection() {}
 	~ENetConnection();
 };
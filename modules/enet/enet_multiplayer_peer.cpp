@@ -70,7 +70,17 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	if (err != OK) {
 		return err;
 	}
+	if (threaded_service) {
+		err = host->start_service_thread();
+		if (err != OK) {
+			host->destroy();
+			return err;
+		}
+	}
 
+	server_max_clients = p_max_clients;
+	server_max_channels = p_max_channels;
+	server_out_bandwidth = p_out_bandwidth;
 	active_mode = MODE_SERVER;
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
@@ -101,6 +111,14 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "Couldn't connect to the ENet multiplayer server.");
 	}
 
+	if (threaded_service) {
+		err = host->start_service_thread();
+		if (err != OK) {
+			host->destroy();
+			return err;
+		}
+	}
+
 	// Need to wait for CONNECT event.
 	connection_status = CONNECTION_CONNECTING;
 	active_mode = MODE_CLIENT;
@@ -131,6 +149,54 @@ Error ENetMultiplayerPeer::add_mesh_peer(int p_id, Ref<ENetConnection> p_host) {
 	return OK;
 }
 
+Error ENetMultiplayerPeer::add_server_shard(int p_port) {
+	ERR_FAIL_COND_V_MSG(active_mode != MODE_SERVER, ERR_UNCONFIGURED, "The multiplayer instance is not configured as a server. Call 'create_server' first.");
+	Ref<ENetConnection> host;
+	host.instantiate();
+	Error err = host->create_host_bound(bind_ip, p_port, server_max_clients, 0, server_max_channels > 0 ? server_max_channels + SYSCH_MAX : 0, server_out_bandwidth);
+	if (err != OK) {
+		return err;
+	}
+	if (threaded_service) {
+		err = host->start_service_thread();
+		if (err != OK) {
+			host->destroy();
+			return err;
+		}
+	}
+#ifdef GODOT_ENET
+	host->refuse_new_connections(is_refusing_new_connections());
+#endif
+	// Shards use negative keys, so they never clash with peer IDs.
+	hosts[-int(hosts.size())] = host;
+	return OK;
+}
+
+void ENetMultiplayerPeer::set_threaded_service(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The threaded service must be configured before creating the server or client.");
+	threaded_service = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_threaded_service() const {
+	return threaded_service;
+}
+
+void ENetMultiplayerPeer::_lock_hosts() {
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		if (E.value->is_service_threaded()) {
+			E.value->get_mutex().lock();
+		}
+	}
+}
+
+void ENetMultiplayerPeer::_unlock_hosts() {
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		if (E.value->is_service_threaded()) {
+			E.value->get_mutex().unlock();
+		}
+	}
+}
+
 void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event &p_event) {
 	Packet packet;
 	packet.packet = p_event.packet;
@@ -198,38 +264,48 @@ void ENetMultiplayerPeer::poll() {
 			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
 		} break;
 		case MODE_SERVER: {
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
-				if (ret == ENetConnection::EVENT_CONNECT) {
-					if (is_refusing_new_connections()) {
-						event.peer->reset();
-						continue;
-					}
-					// Client joined with invalid ID, probably trying to exploit us.
-					if (event.data < 2 || peers.has((int)event.data)) {
-						event.peer->reset();
-						continue;
-					}
-					int id = event.data;
-					event.peer->set_meta(SNAME("_net_id"), id);
-					peers[id] = event.peer;
-					emit_signal(SNAME("peer_connected"), id);
-				} else if (ret == ENetConnection::EVENT_DISCONNECT) {
-					int id = event.peer->get_meta(SNAME("_net_id"));
-					if (!peers.has(id)) {
-						// Never fully connected.
-						continue;
+			// Shards are bound to other ports, but share the peer IDs.
+			LocalVector<Ref<ENetConnection>> server_hosts;
+			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+				server_hosts.push_back(E.value);
+			}
+			for (Ref<ENetConnection> &host : server_hosts) {
+				ENetConnection::Event event;
+				ENetConnection::EventType ret = host->service(0, event);
+				do {
+					if (ret == ENetConnection::EVENT_CONNECT) {
+						if (is_refusing_new_connections()) {
+							event.peer->reset();
+							continue;
+						}
+						// Client joined with invalid ID, probably trying to exploit us.
+						if (event.data < 2 || peers.has((int)event.data)) {
+							event.peer->reset();
+							continue;
+						}
+						int id = event.data;
+						event.peer->set_meta(SNAME("_net_id"), id);
+						peers[id] = event.peer;
+						emit_signal(SNAME("peer_connected"), id);
+					} else if (ret == ENetConnection::EVENT_DISCONNECT) {
+						int id = event.peer->get_meta(SNAME("_net_id"));
+						if (!peers.has(id)) {
+							// Never fully connected.
+							continue;
+						}
+						emit_signal(SNAME("peer_disconnected"), id);
+						peers.erase(id);
+					} else if (ret == ENetConnection::EVENT_RECEIVE) {
+						int32_t source = event.peer->get_meta(SNAME("_net_id"));
+						_store_packet(source, event);
+					} else if (ret != ENetConnection::EVENT_NONE) {
+						close(); // Error
 					}
-					emit_signal(SNAME("peer_disconnected"), id);
-					peers.erase(id);
-				} else if (ret == ENetConnection::EVENT_RECEIVE) {
-					int32_t source = event.peer->get_meta(SNAME("_net_id"));
-					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
+				} while (_is_active() && host->check_events(ret, event) > 0);
+				if (!_is_active()) {
+					return; // Closed while processing events.
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
+			}
 		} break;
 		case MODE_MESH: {
 			HashSet<int> to_drop;
@@ -273,8 +349,12 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
 	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+	if (active_mode == MODE_CLIENT) {
 		hosts[0]->flush();
+	} else if (active_mode == MODE_SERVER) {
+		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+			E.value->flush();
+		}
 	} else {
 		ERR_FAIL_COND(!hosts.has(p_peer));
 		hosts[p_peer]->flush();
@@ -370,9 +450,17 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	// Hosts serviced on a thread release packets once sent, keep them from doing so until every copy is queued.
+	_lock_hosts();
 	if (is_server()) {
 		if (target_peer == 0) {
-			hosts[0]->broadcast(channel, packet);
+			// Hold a reference, since each host (shard) would release the packet after broadcasting.
+			packet->referenceCount++;
+			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+				E.value->broadcast(channel, packet);
+			}
+			packet->referenceCount--;
+			_destroy_unused(packet);
 
 		} else if (target_peer < 0) {
 			// Send to all but one and make copies for sending.
@@ -387,12 +475,12 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 		} else {
 			peers[target_peer]->send(channel, packet);
 		}
-		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+			E.value->flush();
+		}
 
 	} else if (active_mode == MODE_CLIENT) {
 		peers[1]->send(channel, packet); // Send to server for broadcast.
-		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
 		hosts[0]->flush();
 
 	} else {
@@ -409,10 +497,12 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 			_destroy_unused(packet);
 		} else {
 			peers[target_peer]->send(channel, packet);
-			ERR_FAIL_COND_V(!hosts.has(target_peer), ERR_BUG);
-			hosts[target_peer]->flush();
+			if (hosts.has(target_peer)) {
+				hosts[target_peer]->flush();
+			}
 		}
 	}
+	_unlock_hosts();
 
 	return OK;
 }
@@ -475,12 +565,16 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_client", "address", "port", "channel_count", "in_bandwidth", "out_bandwidth", "local_port"), &ENetMultiplayerPeer::create_client, DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("create_mesh", "unique_id"), &ENetMultiplayerPeer::create_mesh);
 	ClassDB::bind_method(D_METHOD("add_mesh_peer", "peer_id", "host"), &ENetMultiplayerPeer::add_mesh_peer);
+	ClassDB::bind_method(D_METHOD("add_server_shard", "port"), &ENetMultiplayerPeer::add_server_shard);
 	ClassDB::bind_method(D_METHOD("set_bind_ip", "ip"), &ENetMultiplayerPeer::set_bind_ip);
+	ClassDB::bind_method(D_METHOD("set_threaded_service", "enabled"), &ENetMultiplayerPeer::set_threaded_service);
+	ClassDB::bind_method(D_METHOD("is_threaded_service"), &ENetMultiplayerPeer::is_threaded_service);
 
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded_service"), "set_threaded_service", "is_threaded_service");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -90,6 +90,14 @@ private:
 
 	IPAddress bind_ip;
 
+	bool threaded_service = false;
+	int server_max_clients = 32;
+	int server_max_channels = 0;
+	int server_out_bandwidth = 0;
+
+	void _lock_hosts();
+	void _unlock_hosts();
+
 protected:
 	static void _bind_methods();
 
@@ -123,6 +131,10 @@ public:
 	Error create_client(const String &p_address, int p_port, int p_channel_count = 0, int p_in_bandwidth = 0, int p_out_bandwidth = 0, int p_local_port = 0);
 	Error create_mesh(int p_id);
 	Error add_mesh_peer(int p_id, Ref<ENetConnection> p_host);
+	Error add_server_shard(int p_port);
+
+	void set_threaded_service(bool p_enabled);
+	bool is_threaded_service() const;
 
 	void set_bind_ip(const IPAddress &p_ip);
 
@@ -30,33 +30,58 @@
 
 #include "enet_packet_peer.h"
 
+// Locks the host (if any) while accessing the ENet peer, since it might be serviced on another thread.
+class ENetHostLock {
+	Mutex *mutex = nullptr;
+
+public:
+	ENetHostLock(Mutex *p_mutex) :
+			mutex(p_mutex) {
+		if (mutex) {
+			mutex->lock();
+		}
+	}
+
+	~ENetHostLock() {
+		if (mutex) {
+			mutex->unlock();
+		}
+	}
+};
+
 void ENetPacketPeer::peer_disconnect(int p_data) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL(peer);
 	enet_peer_disconnect(peer, p_data);
 }
 
 void ENetPacketPeer::peer_disconnect_later(int p_data) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL(peer);
 	enet_peer_disconnect_later(peer, p_data);
 }
 
 void ENetPacketPeer::peer_disconnect_now(int p_data) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL(peer);
 	enet_peer_disconnect_now(peer, p_data);
 	_on_disconnect();
 }
 
 void ENetPacketPeer::ping() {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL(peer);
 	enet_peer_ping(peer);
 }
 
 void ENetPacketPeer::ping_interval(int p_interval) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL(peer);
 	enet_peer_ping_interval(peer, p_interval);
 }
 
 int ENetPacketPeer::send(uint8_t p_channel, ENetPacket *p_packet) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL_V(peer, -1);
 	ERR_FAIL_NULL_V(p_packet, -1);
 	ERR_FAIL_COND_V_MSG(p_channel >= peer->channelCount, -1, vformat("Unable to send packet on channel %d, max channels: %d", p_channel, (int)peer->channelCount));
@@ -64,17 +89,20 @@ int ENetPacketPeer::send(uint8_t p_channel, ENetPacket *p_packet) {
 }
 
 void ENetPacketPeer::reset() {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL_MSG(peer, "Peer not connected.");
 	enet_peer_reset(peer);
 	_on_disconnect();
 }
 
 void ENetPacketPeer::throttle_configure(int p_interval, int p_acceleration, int p_deceleration) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL_MSG(peer, "Peer not connected.");
 	enet_peer_throttle_configure(peer, p_interval, p_acceleration, p_deceleration);
 }
 
 void ENetPacketPeer::set_timeout(int p_timeout, int p_timeout_min, int p_timeout_max) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL_MSG(peer, "Peer not connected.");
 	ERR_FAIL_COND_MSG(p_timeout > p_timeout_min || p_timeout_min > p_timeout_max, "Timeout limit must be less than minimum timeout, which itself must be less than maximum timeout");
 	enet_peer_timeout(peer, p_timeout, p_timeout_min, p_timeout_max);
@@ -129,6 +157,7 @@ bool ENetPacketPeer::is_active() const {
 }
 
 double ENetPacketPeer::get_statistic(PeerStatistic p_stat) {
+	ENetHostLock lock(host_mutex);
 	ERR_FAIL_NULL_V(peer, 0);
 	switch (p_stat) {
 		case PEER_PACKET_LOSS:
@@ -164,6 +193,7 @@ double ENetPacketPeer::get_statistic(PeerStatistic p_stat) {
 }
 
 ENetPacketPeer::PeerState ENetPacketPeer::get_state() const {
+	ENetHostLock lock(host_mutex);
 	if (!is_active()) {
 		return STATE_DISCONNECTED;
 	}
@@ -176,6 +206,11 @@ int ENetPacketPeer::get_channels() const {
 }
 
 void ENetPacketPeer::_on_disconnect() {
+	_detach();
+	host_mutex = nullptr;
+}
+
+void ENetPacketPeer::_detach() {
 	if (peer) {
 		peer->data = nullptr;
 	}
@@ -247,9 +282,10 @@ void ENetPacketPeer::_bind_methods() {
 	BIND_CONSTANT(FLAG_UNRELIABLE_FRAGMENT);
 }
 
-ENetPacketPeer::ENetPacketPeer(ENetPeer *p_peer) {
+ENetPacketPeer::ENetPacketPeer(ENetPeer *p_peer, Mutex *p_host_mutex) {
 	peer = p_peer;
 	peer->data = this;
+	host_mutex = p_host_mutex;
 }
 
 ENetPacketPeer::~ENetPacketPeer() {
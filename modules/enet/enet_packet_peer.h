@@ -32,6 +32,7 @@
 #define ENET_PACKET_PEER_H
 
 #include "core/io/packet_peer.h"
+#include "core/os/mutex.h"
 
 #include <enet/enet.h>
 
@@ -40,6 +41,7 @@ class ENetPacketPeer : public PacketPeer {
 
 private:
 	ENetPeer *peer = nullptr;
+	Mutex *host_mutex = nullptr; // Guards the host against its service thread. Only changed on the main thread.
 	List<ENetPacket *> packet_queue;
 	ENetPacket *last_packet = nullptr;
 
@@ -50,6 +52,7 @@ protected:
 	friend class ENetConnection;
 	// Internally used by ENetConnection during service, destroy, etc.
 	void _on_disconnect();
+	void _detach(); // Like _on_disconnect, but safe to call from the host service thread.
 	void _queue_packet(ENetPacket *p_packet);
 
 public:
@@ -121,7 +124,7 @@ public:
 	// Used by ENetMultiplayer (TODO use meta? If only they where StringNames)
 	bool is_active() const;
 
-	ENetPacketPeer(ENetPeer *p_peer);
+	ENetPacketPeer(ENetPeer *p_peer, Mutex *p_host_mutex);
 	~ENetPacketPeer();
 };
 
@@ -30,8 +30,11 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
@@ -74,6 +77,77 @@ EtcpakType _determine_dxt_type(Image::UsedChannels p_channels) {
 	}
 }
 
+// Rows of 4x4 blocks per task, small enough to balance the largest mip across threads.
+static const int ETCPAK_TASK_BLOCK_ROWS = 16;
+
+struct EtcpakCompressionTask {
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t blocks = 0;
+	int width = 0;
+};
+
+struct EtcpakCompressionJobQueue {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const EtcpakCompressionTask *tasks = nullptr;
+	uint32_t num_tasks = 0;
+	SafeNumeric<uint32_t> current_task;
+};
+
+static void _digest_etcpak_task(EtcpakType p_compresstype, const EtcpakCompressionTask &p_task) {
+	switch (p_compresstype) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_task.src, p_task.dst, p_task.blocks, p_task.width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(p_task.src, p_task.dst, p_task.blocks, p_task.width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressDxt1Dither(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressDxt5(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(p_task.src, p_task.dst, p_task.blocks, p_task.width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+static void _digest_etcpak_job_queue(void *p_job_queue, uint32_t p_index) {
+	EtcpakCompressionJobQueue *job_queue = static_cast<EtcpakCompressionJobQueue *>(p_job_queue);
+	// Tasks are taken in order as threads become free, so the wide tasks of the first mip don't pile up on one thread.
+	for (uint32_t i = job_queue->current_task.postincrement(); i < job_queue->num_tasks; i = job_queue->current_task.postincrement()) {
+		_digest_etcpak_task(job_queue->type, job_queue->tasks[i]);
+	}
+}
+
 void _compress_etc1(Image *r_img) {
 	_compress_etcpak(EtcpakType::ETCPAK_TYPE_ETC1, r_img);
 }
@@ -187,7 +261,14 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	uint8_t *dest_write = dest_data.ptrw();
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	// Padded copies must outlive the tasks reading them, so there is one per mip.
+	LocalVector<Vector<uint32_t>> padded_src;
+	padded_src.resize(mip_count + 1);
+
+	// Size of a 4x4 block, in units of the uint64_t pointer etcpak writes to.
+	const int block_words = Image::get_image_data_size(4, 4, target_format, false) / 8;
+
+	LocalVector<EtcpakCompressionTask> tasks;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -200,7 +281,6 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int64_t src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -208,8 +288,8 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 
 		// Pad textures to nearest block by smearing.
 		if (mip_w != orig_mip_w || mip_h != orig_mip_h) {
-			padded_src.resize(mip_w * mip_h);
-			uint32_t *ptrw = padded_src.ptrw();
+			padded_src[i].resize(mip_w * mip_h);
+			uint32_t *ptrw = padded_src[i].ptrw();
 			int x = 0, y = 0;
 			for (y = 0; y < orig_mip_h; y++) {
 				for (x = 0; x < orig_mip_w; x++) {
@@ -227,52 +307,33 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 				}
 			}
 			// Override the src_mip_read pointer to our temporary Vector.
-			src_mip_read = padded_src.ptr();
+			src_mip_read = padded_src[i].ptr();
 		}
 
-		switch (p_compresstype) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
+		// Blocks are independent, so each mip is split in bands of block rows.
+		const int blocks_per_row = mip_w / 4;
+		const int block_rows = mip_h / 4;
+		for (int row = 0; row < block_rows; row += ETCPAK_TASK_BLOCK_ROWS) {
+			EtcpakCompressionTask task;
+			task.src = src_mip_read + row * 4 * mip_w;
+			task.dst = dest_mip_write + row * blocks_per_row * block_words;
+			task.blocks = MIN(ETCPAK_TASK_BLOCK_ROWS, block_rows - row) * blocks_per_row;
+			task.width = mip_w;
+			tasks.push_back(task);
+		}
+	}
 
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
+	EtcpakCompressionJobQueue job_queue;
+	job_queue.type = p_compresstype;
+	job_queue.tasks = tasks.ptr();
+	job_queue.num_tasks = tasks.size();
 
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
-		}
+	const uint32_t thread_count = MIN(tasks.size(), (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+	if (thread_count < 2) {
+		_digest_etcpak_job_queue(&job_queue, 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_etcpak_job_queue, &job_queue, thread_count, -1, true, SNAME("Etcpak Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
 
 	// Replace original image with compressed one.
@@ -77,20 +77,20 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 	Color keyword_color;
 	Color color;
 
-	color_region_cache[p_line] = -1;
+	line_state_cache[p_line] = -1;
 	int in_region = -1;
 	if (p_line != 0) {
 		int prev_region_line = p_line - 1;
-		while (prev_region_line > 0 && !color_region_cache.has(prev_region_line)) {
+		while (prev_region_line > 0 && !line_state_cache.has(prev_region_line)) {
 			prev_region_line--;
 		}
 		for (int i = prev_region_line; i < p_line - 1; i++) {
 			get_line_syntax_highlighting(i);
 		}
-		if (!color_region_cache.has(p_line - 1)) {
+		if (!line_state_cache.has(p_line - 1)) {
 			get_line_syntax_highlighting(p_line - 1);
 		}
-		in_region = color_region_cache[p_line - 1];
+		in_region = line_state_cache[p_line - 1];
 	}
 
 	const String &str = text_edit->get_line(p_line);
@@ -98,7 +98,7 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 	Color prev_color;
 
 	if (in_region != -1 && line_length == 0) {
-		color_region_cache[p_line] = in_region;
+		line_state_cache[p_line] = in_region;
 	}
 	for (int j = 0; j < line_length; j++) {
 		Dictionary highlighter_info;
@@ -173,7 +173,7 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 
 							j = line_length;
 							if (!color_regions[c].line_only) {
-								color_region_cache[p_line] = c;
+								line_state_cache[p_line] = c;
 							}
 						}
 						break;
@@ -290,7 +290,7 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 						}
 						j = from + (end_key_length - 1);
 						if (region_end_index == -1) {
-							color_region_cache[p_line] = in_region;
+							line_state_cache[p_line] = in_region;
 						}
 					}
 
@@ -688,7 +688,6 @@ void GDScriptSyntaxHighlighter::_update_cache() {
 	member_keywords.clear();
 	global_functions.clear();
 	color_regions.clear();
-	color_region_cache.clear();
 
 	font_color = text_edit->get_theme_color(SceneStringName(font_color));
 	symbol_color = EDITOR_GET("text_editor/theme/highlighting/symbol_color");
@@ -57,7 +57,6 @@ private:
 		bool is_comment = false; // `TYPE_COMMENT` or `TYPE_CODE_REGION`.
 	};
 	Vector<ColorRegion> color_regions;
-	HashMap<int, int> color_region_cache;
 
 	HashMap<StringName, Color> class_names;
 	HashMap<StringName, Color> reserved_keywords;
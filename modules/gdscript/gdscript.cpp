@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -114,6 +115,8 @@ Variant GDScriptNativeClass::callp(const StringName &p_method, const Variant **p
 	return Variant();
 }
 
+SafeNumeric<uint64_t> GDScript::layout_version;
+
 GDScriptFunction *GDScript::_super_constructor(GDScript *p_script) {
 	if (likely(p_script->valid) && p_script->initializer) {
 		return p_script->initializer;
@@ -450,6 +453,7 @@ void GDScript::set_source_code(const String &p_code) {
 		return;
 	}
 	source = p_code;
+	bytecode_cache.clear();
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
 #endif
@@ -799,6 +803,18 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
+
+	if (!bytecode_cache.is_empty()) {
+		Error err = OK;
+		if (GDScriptBytecodeCache::load(this, err)) {
+			if (err == OK && (ScriptServer::is_scripting_enabled() || tool)) {
+				err = _static_init();
+			}
+			reloading = false;
+			return err;
+		}
+	}
+
 	GDScriptParser parser;
 	Error err;
 	if (!binary_tokens.is_empty()) {
@@ -852,6 +868,10 @@ Error GDScript::reload(bool p_keep_state) {
 		}
 	}
 
+	if (GDScriptBytecodeCache::is_enabled()) {
+		GDScriptBytecodeCache::save(this, parser);
+	}
+
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
@@ -1119,6 +1139,7 @@ Error GDScript::load_source_code(const String &p_path) {
 
 void GDScript::set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens) {
 	binary_tokens = p_binary_tokens;
+	bytecode_cache.clear();
 }
 
 const Vector<uint8_t> &GDScript::get_binary_tokens_source() const {
@@ -1518,6 +1539,7 @@ void GDScript::clear(ClearData *p_clear_data) {
 		return;
 	}
 	clearing = true;
+	layout_version.increment();
 
 	ClearData data;
 	ClearData *clear_data = p_clear_data;
@@ -2839,6 +2861,19 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+BinaryMutex GDScriptLanguage::call_stacks_mutex;
+LocalVector<GDScriptLanguage::CallStack *> GDScriptLanguage::call_stacks;
+
+void GDScriptLanguage::_register_call_stack() {
+	MutexLock lock(call_stacks_mutex);
+	_call_stack.thread_id = Thread::get_caller_id();
+	call_stacks.push_back(&_call_stack);
+}
+
+void GDScriptLanguage::_unregister_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	call_stacks.erase(p_call_stack);
+}
 
 GDScriptLanguage::GDScriptLanguage() {
 	calls = 0;
@@ -39,6 +39,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_set.h"
 
 class GDScriptNativeClass : public RefCounted {
@@ -84,6 +85,7 @@ class GDScript : public Script {
 	friend class GDScriptInstance;
 	friend class GDScriptFunction;
 	friend class GDScriptAnalyzer;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptDocGen;
 	friend class GDScriptLambdaCallable;
@@ -117,6 +119,9 @@ class GDScript : public Script {
 
 	HashMap<GDScriptFunction *, LambdaInfo> lambda_info;
 
+	// Bumped whenever any script drops its functions or member layout, invalidates the VM inline caches.
+	static SafeNumeric<uint64_t> layout_version;
+
 public:
 	class UpdatableFuncPtr {
 		friend class GDScript;
@@ -185,6 +190,7 @@ private:
 	String fully_qualified_name;
 	String simplified_icon_path;
 	SelfList<GDScript> script_list;
+	Vector<uint8_t> bytecode_cache; // Pending entry of `GDScriptBytecodeCache`, restored instead of compiling on reload.
 
 	SelfList<GDScriptFunctionState>::List pending_func_states;
 
@@ -408,6 +414,7 @@ public:
 
 class GDScriptLanguage : public ScriptLanguage {
 	friend class GDScriptFunctionState;
+	friend class GDScriptSamplingProfiler;
 
 	static GDScriptLanguage *singleton;
 
@@ -432,9 +439,11 @@ class GDScriptLanguage : public ScriptLanguage {
 	struct CallStack {
 		CallLevel *levels = nullptr;
 		int stack_pos = 0;
+		Thread::ID thread_id = 0;
 
 		void free() {
 			if (levels) {
+				_unregister_call_stack(this);
 				memdelete(levels);
 				levels = nullptr;
 			}
@@ -445,6 +454,11 @@ class GDScriptLanguage : public ScriptLanguage {
 	};
 
 	static thread_local CallStack _call_stack;
+	// Every thread's call stack, so the sampling profiler can inspect them from its own thread.
+	static BinaryMutex call_stacks_mutex;
+	static LocalVector<CallStack *> call_stacks;
+	static void _register_call_stack();
+	static void _unregister_call_stack(CallStack *p_call_stack);
 	int _debug_max_call_stack = 0;
 
 	void _add_global(const StringName &p_name, const Variant &p_value);
@@ -474,6 +488,7 @@ public:
 	_FORCE_INLINE_ void enter_function(GDScriptInstance *p_instance, GDScriptFunction *p_function, Variant *p_stack, int *p_ip, int *p_line) {
 		if (unlikely(_call_stack.levels == nullptr)) {
 			_call_stack.levels = memnew_arr(CallLevel, _debug_max_call_stack + 1);
+			_register_call_stack();
 		}
 
 		if (EngineDebugger::get_script_debugger()->get_lines_left() > 0 && EngineDebugger::get_script_debugger()->get_depth() >= 0) {
@@ -383,6 +383,24 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_methods_count = 0;
 	}
 
+	if (get_node_cache_count) {
+		function->get_node_caches.resize(get_node_cache_count);
+		function->_get_node_caches_ptr = function->get_node_caches.ptrw();
+		function->_get_node_caches_count = get_node_cache_count;
+	} else {
+		function->_get_node_caches_ptr = nullptr;
+		function->_get_node_caches_count = 0;
+	}
+
+	if (inline_cache_count) {
+		function->inline_caches.resize(inline_cache_count);
+		function->_inline_caches_ptr = function->inline_caches.ptrw();
+		function->_inline_caches_count = inline_cache_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_caches_count = 0;
+	}
+
 	if (lambdas_map.size()) {
 		function->lambdas.resize(lambdas_map.size());
 		function->_lambdas_ptr = function->lambdas.ptrw();
@@ -598,6 +616,9 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		last_operator_pos = opcodes.size();
+		last_operator_result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -759,9 +780,34 @@ void GDScriptByteCodeGenerator::write_end_ternary() {
 	ternary_result.pop_back();
 }
 
+// Packed arrays handled directly by the OPCODE_GET_INDEXED_PACKED and OPCODE_SET_INDEXED_PACKED instructions.
+static bool _has_packed_indexed_access(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::PACKED_BYTE_ARRAY:
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY:
+		case Variant::PACKED_COLOR_ARRAY:
+			return true;
+		default:
+			return false;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_target)) {
-		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && _has_packed_indexed_access(p_target.type.builtin_type) &&
+				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
+			append_opcode(GDScriptFunction::OPCODE_SET_INDEXED_PACKED);
+			append(p_target);
+			append(p_index);
+			append(p_source);
+			return;
+		} else if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
 				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
 			// Use indexed setter instead.
 			Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter(p_target.type.builtin_type);
@@ -788,9 +834,63 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 	append(p_source);
 }
 
+bool GDScriptByteCodeGenerator::write_indexed_operator_in_place(const Address &p_target, const Address &p_index, Variant::Operator p_operator, const Address &p_value) {
+	if (!HAS_BUILTIN_TYPE(p_target) || !IS_BUILTIN_TYPE(p_index, Variant::INT) || !HAS_BUILTIN_TYPE(p_value)) {
+		return false;
+	}
+
+	bool float_elements = false;
+	switch (p_target.type.builtin_type) {
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY: {
+			if (p_value.type.builtin_type != Variant::INT) {
+				return false; // A float operand would turn the element into a float before it's stored.
+			}
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			if (p_value.type.builtin_type != Variant::INT && p_value.type.builtin_type != Variant::FLOAT) {
+				return false;
+			}
+			float_elements = true;
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	switch (p_operator) {
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+			break;
+		case Variant::OP_DIVIDE: {
+			if (!float_elements) {
+				return false; // Integer division needs the division by zero check.
+			}
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	append_opcode(GDScriptFunction::OPCODE_OPERATOR_INDEXED_PACKED);
+	append(p_target);
+	append(p_index);
+	append(p_value);
+	append(p_operator);
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source)) {
-		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && _has_packed_indexed_access(p_source.type.builtin_type)) {
+			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_PACKED);
+			append(p_source);
+			append(p_index);
+			append(p_target);
+			return;
+		} else if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
 			Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(p_source.type.builtin_type);
 			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED);
@@ -832,6 +932,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append(inline_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -850,6 +951,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(inline_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -878,6 +980,13 @@ void GDScriptByteCodeGenerator::write_get_static_variable(const Address &p_targe
 	append(p_index);
 }
 
+void GDScriptByteCodeGenerator::write_get_node(const Address &p_target, const Address &p_path) {
+	append_opcode(GDScriptFunction::OPCODE_GET_NODE);
+	append(p_target);
+	append(p_path);
+	append(get_node_cache_count++);
+}
+
 void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_target, const Address &p_source) {
 	switch (p_target.type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -948,6 +1057,37 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 	}
 }
 
+bool GDScriptByteCodeGenerator::fold_operator_into_assign(const Address &p_target, const Address &p_source) {
+	// Only for `int` and `float` locals and parameters: the validated evaluator writes the raw value, so the target
+	// must already hold the result type, which their static type guarantees.
+	if (p_source.mode != Address::TEMPORARY || (p_target.mode != Address::LOCAL_VARIABLE && p_target.mode != Address::FUNCTION_PARAMETER)) {
+		return false;
+	}
+	if (!HAS_BUILTIN_TYPE(p_target) || (p_target.type.builtin_type != Variant::INT && p_target.type.builtin_type != Variant::FLOAT)) {
+		return false;
+	}
+
+	// The operator must be the last instruction, with nothing jumping in between it and the assignment.
+	constexpr int operator_size = 5;
+	if (last_operator_pos < 0 || last_operator_pos + operator_size != opcodes.size() || last_jump_target == opcodes.size()) {
+		return false;
+	}
+	if (last_operator_result_type != p_target.type.builtin_type) {
+		return false;
+	}
+
+	const int target_index = last_operator_pos + 3;
+	Vector<int> &indices = temporaries.write[p_source.address].bytecode_indices;
+	if (indices.is_empty() || indices[indices.size() - 1] != target_index) {
+		return false; // The operator doesn't write this temporary.
+	}
+	indices.remove_at(indices.size() - 1);
+	opcodes.write[target_index] = address_of(p_target);
+
+	last_operator_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_assign_null(const Address &p_target) {
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_NULL);
 	append(p_target);
@@ -1040,6 +1180,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1065,6 +1206,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1299,6 +1441,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1312,6 +1455,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1325,6 +1469,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1475,13 +1620,25 @@ void GDScriptByteCodeGenerator::write_end_jump_if_shared() {
 	if_jmp_addrs.pop_back();
 }
 
-void GDScriptByteCodeGenerator::start_for(const GDScriptDataType &p_iterator_type, const GDScriptDataType &p_list_type) {
+void GDScriptByteCodeGenerator::start_for(const GDScriptDataType &p_iterator_type, const GDScriptDataType &p_list_type, bool p_is_range) {
 	Address counter(Address::LOCAL_VARIABLE, add_local("@counter_pos", p_iterator_type), p_iterator_type);
 	Address container(Address::LOCAL_VARIABLE, add_local("@container_pos", p_list_type), p_list_type);
 
 	// Store state.
 	for_counter_variables.push_back(counter);
 	for_container_variables.push_back(container);
+
+	if (p_is_range) {
+		GDScriptDataType int_type;
+		int_type.has_type = true;
+		int_type.kind = GDScriptDataType::BUILTIN;
+		int_type.builtin_type = Variant::INT;
+
+		// The bounds are evaluated once, like the array `range()` would return.
+		for_range_from_variables.push_back(Address(Address::LOCAL_VARIABLE, add_local("@range_from", int_type), int_type));
+		for_range_to_variables.push_back(Address(Address::LOCAL_VARIABLE, add_local("@range_to", int_type), int_type));
+		for_range_step_variables.push_back(Address(Address::LOCAL_VARIABLE, add_local("@range_step", int_type), int_type));
+	}
 }
 
 void GDScriptByteCodeGenerator::write_for_assignment(const Address &p_list) {
@@ -1493,12 +1650,61 @@ void GDScriptByteCodeGenerator::write_for_assignment(const Address &p_list) {
 	append(p_list);
 }
 
-void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_conversion) {
+void GDScriptByteCodeGenerator::write_for_range_assignment(const Address &p_from, const Address &p_to, const Address &p_step) {
+	write_assign(for_range_from_variables.back()->get(), p_from);
+	write_assign(for_range_to_variables.back()->get(), p_to);
+	write_assign(for_range_step_variables.back()->get(), p_step);
+}
+
+void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_conversion, bool p_is_range) {
 	const Address &counter = for_counter_variables.back()->get();
 	const Address &container = for_container_variables.back()->get();
 
 	current_breaks_to_patch.push_back(List<int>());
 
+	if (p_is_range) {
+		const Address &range_from = for_range_from_variables.back()->get();
+		const Address &range_to = for_range_to_variables.back()->get();
+		const Address &range_step = for_range_step_variables.back()->get();
+
+		Address temp;
+		if (p_use_conversion) {
+			temp = Address(Address::LOCAL_VARIABLE, add_local("@iterator_temp", GDScriptDataType()));
+		}
+
+		// Begin loop.
+		append_opcode(GDScriptFunction::OPCODE_ITERATE_BEGIN_RANGE);
+		append(counter);
+		append(range_from);
+		append(range_to);
+		append(range_step);
+		append(p_use_conversion ? temp : p_variable);
+		for_jmp_addrs.push_back(opcodes.size());
+		append(0); // End of loop address, will be patched.
+		append_opcode(GDScriptFunction::OPCODE_JUMP);
+		append(opcodes.size() + 7); // Skip over 'continue' code.
+
+		// Next iteration.
+		int continue_addr = opcodes.size();
+		continue_addrs.push_back(continue_addr);
+		append_opcode(GDScriptFunction::OPCODE_ITERATE_RANGE);
+		append(counter);
+		append(range_to);
+		append(range_step);
+		append(p_use_conversion ? temp : p_variable);
+		for_jmp_addrs.push_back(opcodes.size());
+		append(0); // Jump destination, will be patched.
+
+		if (p_use_conversion) {
+			write_assign_with_conversion(p_variable, temp);
+		}
+
+		for_range_from_variables.pop_back();
+		for_range_to_variables.pop_back();
+		for_range_step_variables.pop_back();
+		return;
+	}
+
 	GDScriptFunction::Opcode begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN;
 	GDScriptFunction::Opcode iterate_opcode = GDScriptFunction::OPCODE_ITERATE;
 
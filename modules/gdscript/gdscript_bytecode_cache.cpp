@@ -0,0 +1,1622 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript_cache.h"
+#include "gdscript_function.h"
+#include "gdscript_parser.h"
+#include "gdscript_utility_functions.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/os/os.h"
+#include "core/templates/rb_map.h"
+#include "core/version.h"
+
+// Bump whenever the layout of the serialized data changes.
+static const uint32_t BYTECODE_CACHE_MAGIC = 0x43424447; // "GDBC"
+static const uint32_t BYTECODE_CACHE_VERSION = 1;
+static const int BYTECODE_CACHE_MAX_DEPTH = 64;
+
+enum {
+	VARIANT_VALUE,
+	VARIANT_ARRAY,
+	VARIANT_DICTIONARY,
+	VARIANT_NULL_OBJECT,
+	VARIANT_NATIVE_CLASS,
+	VARIANT_SINGLETON,
+	VARIANT_SCRIPT,
+	VARIANT_RESOURCE,
+};
+
+enum {
+	SCRIPT_NONE,
+	SCRIPT_GDSCRIPT,
+	SCRIPT_RESOURCE,
+};
+
+struct GDScriptBytecodeCache::Writer {
+	Vector<uint8_t> data;
+	const GDScript *root = nullptr;
+	HashSet<String> dependencies;
+	bool failed = false;
+	String error;
+
+	void fail(const String &p_error) {
+		if (!failed) {
+			failed = true;
+			error = p_error;
+		}
+	}
+
+	void put_8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void put_32(uint32_t p_value) {
+		int64_t ofs = data.size();
+		data.resize(ofs + 4);
+		encode_uint32(p_value, data.ptrw() + ofs);
+	}
+
+	void put_buffer(const uint8_t *p_buffer, int64_t p_size) {
+		int64_t ofs = data.size();
+		data.resize(ofs + p_size);
+		memcpy(data.ptrw() + ofs, p_buffer, p_size);
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_32(utf8.length());
+		put_buffer((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+};
+
+struct GDScriptBytecodeCache::Reader {
+	const uint8_t *ptr = nullptr;
+	int64_t size = 0;
+	int64_t pos = 0;
+	GDScript *root = nullptr;
+	bool failed = false;
+
+	bool has(int64_t p_bytes) {
+		if (failed || p_bytes < 0 || pos + p_bytes > size) {
+			failed = true;
+			return false;
+		}
+		return true;
+	}
+
+	uint8_t get_8() {
+		if (!has(1)) {
+			return 0;
+		}
+		return ptr[pos++];
+	}
+
+	uint32_t get_32() {
+		if (!has(4)) {
+			return 0;
+		}
+		uint32_t value = decode_uint32(ptr + pos);
+		pos += 4;
+		return value;
+	}
+
+	// Element counts are validated against the remaining data, so corrupted entries can't trigger huge allocations.
+	uint32_t get_count(int p_min_element_size = 1) {
+		uint32_t count = get_32();
+		if (!has(int64_t(count) * p_min_element_size)) {
+			return 0;
+		}
+		return count;
+	}
+
+	String get_string() {
+		uint32_t length = get_count();
+		if (failed) {
+			return String();
+		}
+		String string;
+		if (length > 0 && string.parse_utf8((const char *)ptr + pos, length) != OK) {
+			failed = true;
+		}
+		pos += length;
+		return string;
+	}
+};
+
+struct GDScriptBytecodeCache::FunctionTables {
+	struct OperatorKey {
+		Variant::Operator op = Variant::OP_MAX;
+		Variant::Type type_a = Variant::NIL;
+		Variant::Type type_b = Variant::NIL;
+	};
+
+	struct MemberKey {
+		Variant::Type type = Variant::NIL;
+		StringName name;
+	};
+
+	struct ConstructorKey {
+		Variant::Type type = Variant::NIL;
+		int index = 0;
+	};
+
+	RBMap<Variant::ValidatedOperatorEvaluator, OperatorKey> operators;
+	RBMap<Variant::ValidatedSetter, MemberKey> setters;
+	RBMap<Variant::ValidatedGetter, MemberKey> getters;
+	RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+	RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+	RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+	RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+	RBMap<Variant::ValidatedBuiltInMethod, MemberKey> builtin_methods;
+	RBMap<Variant::ValidatedConstructor, ConstructorKey> constructors;
+	RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+	RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+};
+
+Mutex GDScriptBytecodeCache::mutex;
+int GDScriptBytecodeCache::enabled = -1;
+bool GDScriptBytecodeCache::global_classes_hashed = false;
+uint32_t GDScriptBytecodeCache::global_classes_hash = 0;
+HashMap<String, uint32_t> GDScriptBytecodeCache::source_hashes;
+GDScriptBytecodeCache::FunctionTables *GDScriptBytecodeCache::function_tables = nullptr;
+
+bool GDScriptBytecodeCache::is_enabled() {
+	if (enabled == -1) {
+		// The editor compiles with different settings than export templates, so the cache is only
+		// ever produced and consumed by the exported project itself.
+		enabled = !Engine::get_singleton()->is_editor_hint() && !EngineDebugger::is_active() && OS::get_singleton()->has_feature("gdscript_bytecode_cache");
+	}
+	return enabled == 1;
+}
+
+String GDScriptBytecodeCache::_get_cache_path(const String &p_path) {
+	return "user://.gdscript_cache/" + p_path.md5_text() + ".gdbc";
+}
+
+String GDScriptBytecodeCache::_get_engine_key() {
+	String key = vformat("%s/%s/%d", VERSION_FULL_BUILD, VERSION_HASH, (int)GDScriptFunction::OPCODE_END);
+#ifdef DEBUG_ENABLED
+	key += "/debug";
+#endif
+#ifdef TOOLS_ENABLED
+	key += "/tools";
+#endif
+#ifdef REAL_T_IS_DOUBLE
+	key += "/double";
+#endif
+	return key;
+}
+
+uint32_t GDScriptBytecodeCache::_get_project_hash() {
+	MutexLock lock(mutex);
+
+	if (!global_classes_hashed) {
+		List<StringName> classes;
+		ScriptServer::get_global_class_list(&classes);
+		classes.sort_custom<StringName::AlphCompare>();
+
+		String key;
+		for (const StringName &E : classes) {
+			key += String(E) + "=" + ScriptServer::get_global_class_path(E) + ";";
+		}
+		global_classes_hash = key.hash();
+		global_classes_hashed = true;
+	}
+
+	// Autoload singletons are read by index from the global array, so their indices are part of the key.
+	List<StringName> autoload_names;
+	const HashMap<StringName, ProjectSettings::AutoloadInfo> &autoloads = ProjectSettings::get_singleton()->get_autoload_list();
+	for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : autoloads) {
+		autoload_names.push_back(E.key);
+	}
+	autoload_names.sort_custom<StringName::AlphCompare>();
+
+	const HashMap<StringName, int> &global_map = GDScriptLanguage::get_singleton()->get_global_map();
+	String key;
+	for (const StringName &E : autoload_names) {
+		const ProjectSettings::AutoloadInfo &info = autoloads[E];
+		const int *index = global_map.getptr(E);
+		key += vformat("%s=%s:%d:%d;", E, info.path, (int)info.is_singleton, index ? *index : -1);
+	}
+
+	return hash_murmur3_one_32(key.hash(), global_classes_hash);
+}
+
+uint32_t GDScriptBytecodeCache::_get_script_source_hash(const GDScript *p_script) {
+	// Same hashes as `GDScriptParserRef`.
+	if (!p_script->binary_tokens.is_empty()) {
+		return hash_djb2_buffer(p_script->binary_tokens.ptr(), p_script->binary_tokens.size());
+	}
+	return p_script->source.hash();
+}
+
+bool GDScriptBytecodeCache::_get_file_source_hash(const String &p_path, uint32_t &r_hash) {
+	MutexLock lock(mutex);
+
+	if (const uint32_t *hash = source_hashes.getptr(p_path)) {
+		r_hash = *hash;
+		return true;
+	}
+
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (!FileAccess::exists(remapped_path)) {
+		return false;
+	}
+
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+		if (tokens.is_empty()) {
+			return false;
+		}
+		r_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+	} else {
+		r_hash = GDScriptCache::get_source_code(remapped_path).hash();
+	}
+
+	source_hashes[p_path] = r_hash;
+	return true;
+}
+
+const GDScriptBytecodeCache::FunctionTables &GDScriptBytecodeCache::_get_function_tables() {
+	MutexLock lock(mutex);
+
+	if (function_tables) {
+		return *function_tables;
+	}
+
+	FunctionTables *tables = memnew(FunctionTables);
+
+	for (int op = 0; op < Variant::OP_MAX; op++) {
+		for (int a = 0; a < Variant::VARIANT_MAX; a++) {
+			for (int b = 0; b < Variant::VARIANT_MAX; b++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, (Variant::Type)a, (Variant::Type)b);
+				if (evaluator && !tables->operators.has(evaluator)) {
+					tables->operators.insert(evaluator, { (Variant::Operator)op, (Variant::Type)a, (Variant::Type)b });
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+		Variant::Type type = (Variant::Type)i;
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &E : members) {
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, E);
+			if (setter && !tables->setters.has(setter)) {
+				tables->setters.insert(setter, { type, E });
+			}
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, E);
+			if (getter && !tables->getters.has(getter)) {
+				tables->getters.insert(getter, { type, E });
+			}
+		}
+
+		if (Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type)) {
+			tables->keyed_setters.insert(keyed_setter, type);
+		}
+		if (Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type)) {
+			tables->keyed_getters.insert(keyed_getter, type);
+		}
+		if (Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type)) {
+			tables->indexed_setters.insert(indexed_setter, type);
+		}
+		if (Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type)) {
+			tables->indexed_getters.insert(indexed_getter, type);
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &E : methods) {
+			Variant::ValidatedBuiltInMethod method = Variant::get_validated_builtin_method(type, E);
+			if (method && !tables->builtin_methods.has(method)) {
+				tables->builtin_methods.insert(method, { type, E });
+			}
+		}
+
+		for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+			Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, j);
+			if (constructor && !tables->constructors.has(constructor)) {
+				tables->constructors.insert(constructor, { type, j });
+			}
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &E : utilities) {
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(E);
+		if (utility && !tables->utilities.has(utility)) {
+			tables->utilities.insert(utility, E);
+		}
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &E : gds_utilities) {
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::get_function(E);
+		if (utility && !tables->gds_utilities.has(utility)) {
+			tables->gds_utilities.insert(utility, E);
+		}
+	}
+
+	function_tables = tables;
+	return *function_tables;
+}
+
+void GDScriptBytecodeCache::_write_variant(Writer &p_writer, const Variant &p_value, int p_depth) {
+	if (p_depth > BYTECODE_CACHE_MAX_DEPTH) {
+		p_writer.fail("Constant is nested too deeply.");
+		return;
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::ARRAY: {
+			Array array = p_value;
+			p_writer.put_8(VARIANT_ARRAY);
+			p_writer.put_32(array.get_typed_builtin());
+			p_writer.put_string(array.get_typed_class_name());
+			_write_script(p_writer, Object::cast_to<Script>(array.get_typed_script().get_validated_object()));
+			p_writer.put_8(array.is_read_only());
+			p_writer.put_32(array.size());
+			for (int i = 0; i < array.size(); i++) {
+				_write_variant(p_writer, array[i], p_depth + 1);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dictionary = p_value;
+			p_writer.put_8(VARIANT_DICTIONARY);
+			p_writer.put_8(dictionary.is_read_only());
+			p_writer.put_32(dictionary.size());
+			for (const Variant &key : dictionary.keys()) {
+				_write_variant(p_writer, key, p_depth + 1);
+				_write_variant(p_writer, dictionary[key], p_depth + 1);
+			}
+		} break;
+		case Variant::OBJECT: {
+			Object *object = p_value.get_validated_object();
+			if (object == nullptr) {
+				p_writer.put_8(VARIANT_NULL_OBJECT);
+				break;
+			}
+
+			if (GDScriptNativeClass *native_class = Object::cast_to<GDScriptNativeClass>(object)) {
+				p_writer.put_8(VARIANT_NATIVE_CLASS);
+				p_writer.put_string(native_class->get_name());
+				break;
+			}
+
+			if (Script *script = Object::cast_to<Script>(object)) {
+				p_writer.put_8(VARIANT_SCRIPT);
+				_write_script(p_writer, script);
+				break;
+			}
+
+			if (Resource *resource = Object::cast_to<Resource>(object)) {
+				if (resource->is_built_in()) {
+					p_writer.fail(vformat(R"(Constant references the built-in resource "%s".)", resource->get_path()));
+					break;
+				}
+				p_writer.put_8(VARIANT_RESOURCE);
+				p_writer.put_string(resource->get_path());
+				p_writer.put_string(resource->get_class());
+				break;
+			}
+
+			List<Engine::Singleton> singletons;
+			Engine::get_singleton()->get_singletons(&singletons);
+			for (const Engine::Singleton &E : singletons) {
+				if (E.ptr == object) {
+					p_writer.put_8(VARIANT_SINGLETON);
+					p_writer.put_string(E.name);
+					return;
+				}
+			}
+
+			p_writer.fail(vformat(R"(Constant references an object of class "%s".)", object->get_class()));
+		} break;
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID: {
+			p_writer.fail(vformat(R"(Constants of type "%s" can't be cached.)", Variant::get_type_name(p_value.get_type())));
+		} break;
+		default: {
+			int length = 0;
+			Error err = encode_variant(p_value, nullptr, length, false);
+			if (err != OK) {
+				p_writer.fail("Failed to encode constant.");
+				break;
+			}
+			p_writer.put_8(VARIANT_VALUE);
+			p_writer.put_32(length);
+			int64_t ofs = p_writer.data.size();
+			p_writer.data.resize(ofs + length);
+			encode_variant(p_value, p_writer.data.ptrw() + ofs, length, false);
+		} break;
+	}
+}
+
+Variant GDScriptBytecodeCache::_read_variant(Reader &p_reader, int p_depth) {
+	if (p_depth > BYTECODE_CACHE_MAX_DEPTH) {
+		p_reader.failed = true;
+		return Variant();
+	}
+
+	switch (p_reader.get_8()) {
+		case VARIANT_VALUE: {
+			uint32_t length = p_reader.get_count();
+			if (p_reader.failed) {
+				return Variant();
+			}
+			Variant value;
+			int read = 0;
+			if (decode_variant(value, p_reader.ptr + p_reader.pos, length, &read, false) != OK || read != (int)length) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			p_reader.pos += length;
+			return value;
+		}
+		case VARIANT_ARRAY: {
+			uint32_t typed_builtin = p_reader.get_32();
+			StringName typed_class_name = p_reader.get_string();
+			Ref<Script> typed_script = _read_script(p_reader);
+			bool read_only = p_reader.get_8();
+			uint32_t count = p_reader.get_count();
+
+			Array array;
+			if (!p_reader.failed && typed_builtin != Variant::NIL) {
+				array.set_typed(typed_builtin, typed_class_name, typed_script);
+			}
+			for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+				array.push_back(_read_variant(p_reader, p_depth + 1));
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			return array;
+		}
+		case VARIANT_DICTIONARY: {
+			bool read_only = p_reader.get_8();
+			uint32_t count = p_reader.get_count(2);
+
+			Dictionary dictionary;
+			for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+				Variant key = _read_variant(p_reader, p_depth + 1);
+				dictionary[key] = _read_variant(p_reader, p_depth + 1);
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			return dictionary;
+		}
+		case VARIANT_NULL_OBJECT: {
+			return Variant((Object *)nullptr);
+		}
+		case VARIANT_NATIVE_CLASS: {
+			StringName name = p_reader.get_string();
+			const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+			if (index == nullptr) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return GDScriptLanguage::get_singleton()->get_global_array()[*index];
+		}
+		case VARIANT_SINGLETON: {
+			StringName name = p_reader.get_string();
+			Object *singleton = Engine::get_singleton()->has_singleton(name) ? Engine::get_singleton()->get_singleton_object(name) : nullptr;
+			if (singleton == nullptr) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return singleton;
+		}
+		case VARIANT_SCRIPT: {
+			Ref<Script> script = _read_script(p_reader);
+			if (script.is_null()) {
+				p_reader.failed = true;
+			}
+			return script;
+		}
+		case VARIANT_RESOURCE: {
+			String path = p_reader.get_string();
+			String type = p_reader.get_string();
+			if (p_reader.failed) {
+				return Variant();
+			}
+
+			// Same as the analyzer does for `preload()`.
+			Error err = OK;
+			Ref<Resource> resource = ResourceLoader::load(path, type, ResourceFormatLoader::CACHE_MODE_REUSE, &err);
+			if (err == ERR_BUSY) {
+				resource = ResourceLoader::ensure_resource_ref_override_for_outer_load(path, type);
+			}
+			if (resource.is_null()) {
+				p_reader.failed = true;
+			}
+			return resource;
+		}
+		default: {
+			p_reader.failed = true;
+			return Variant();
+		}
+	}
+}
+
+void GDScriptBytecodeCache::_write_script(Writer &p_writer, const Script *p_script) {
+	if (p_script == nullptr) {
+		p_writer.put_8(SCRIPT_NONE);
+		return;
+	}
+
+	if (const GDScript *gdscript = Object::cast_to<GDScript>(p_script)) {
+		const String &path = gdscript->path;
+		if (path.is_empty() || path.contains("::")) {
+			p_writer.fail(vformat(R"(References the built-in script "%s".)", gdscript->fully_qualified_name));
+			return;
+		}
+		p_writer.put_8(SCRIPT_GDSCRIPT);
+		p_writer.put_string(path);
+		p_writer.put_string(gdscript->fully_qualified_name);
+		if (path != p_writer.root->path) {
+			p_writer.dependencies.insert(path);
+		}
+		return;
+	}
+
+	if (p_script->is_built_in()) {
+		p_writer.fail(vformat(R"(References the built-in script "%s".)", p_script->get_path()));
+		return;
+	}
+	p_writer.put_8(SCRIPT_RESOURCE);
+	p_writer.put_string(p_script->get_path());
+	p_writer.put_string(p_script->get_class());
+}
+
+Ref<Script> GDScriptBytecodeCache::_read_script(Reader &p_reader) {
+	switch (p_reader.get_8()) {
+		case SCRIPT_NONE: {
+			return Ref<Script>();
+		}
+		case SCRIPT_GDSCRIPT: {
+			String path = p_reader.get_string();
+			String fully_qualified_name = p_reader.get_string();
+			if (p_reader.failed) {
+				return Ref<Script>();
+			}
+
+			Ref<GDScript> script;
+			if (path == p_reader.root->path) {
+				script = Ref<GDScript>(p_reader.root);
+			} else {
+				// Registers the dependency, so `GDScriptCache::finish_compiling()` loads it fully.
+				Error err = OK;
+				script = GDScriptCache::get_shallow_script(path, err, p_reader.root->path);
+				if (err != OK) {
+					script = Ref<GDScript>();
+				}
+			}
+
+			GDScript *found = script.is_valid() ? script->find_class(fully_qualified_name) : nullptr;
+			if (found == nullptr) {
+				p_reader.failed = true;
+				return Ref<Script>();
+			}
+			return Ref<Script>(found);
+		}
+		case SCRIPT_RESOURCE: {
+			String path = p_reader.get_string();
+			String type = p_reader.get_string();
+			if (p_reader.failed) {
+				return Ref<Script>();
+			}
+			Ref<Script> script = ResourceLoader::load(path, type);
+			if (script.is_null()) {
+				p_reader.failed = true;
+			}
+			return script;
+		}
+		default: {
+			p_reader.failed = true;
+			return Ref<Script>();
+		}
+	}
+}
+
+void GDScriptBytecodeCache::_write_data_type(Writer &p_writer, const GDScriptDataType &p_type, int p_depth) {
+	if (p_depth > BYTECODE_CACHE_MAX_DEPTH) {
+		p_writer.fail("Type is nested too deeply.");
+		return;
+	}
+
+	p_writer.put_8(p_type.kind);
+	p_writer.put_8(p_type.has_type);
+	p_writer.put_32(p_type.builtin_type);
+	p_writer.put_string(p_type.native_type);
+	_write_script(p_writer, p_type.script_type);
+	p_writer.put_8(p_type.script_type_ref.is_valid());
+	p_writer.put_32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		_write_data_type(p_writer, element_type, p_depth + 1);
+	}
+}
+
+GDScriptDataType GDScriptBytecodeCache::_read_data_type(Reader &p_reader, int p_depth) {
+	GDScriptDataType type;
+	if (p_depth > BYTECODE_CACHE_MAX_DEPTH) {
+		p_reader.failed = true;
+		return type;
+	}
+
+	uint8_t kind = p_reader.get_8();
+	if (kind > GDScriptDataType::GDSCRIPT) {
+		p_reader.failed = true;
+		return type;
+	}
+	type.kind = (GDScriptDataType::Kind)kind;
+	type.has_type = p_reader.get_8();
+	type.builtin_type = (Variant::Type)p_reader.get_32();
+	type.native_type = p_reader.get_string();
+
+	Ref<Script> script = _read_script(p_reader);
+	bool strong = p_reader.get_8();
+	type.script_type = script.ptr();
+	// Only local classes are held weakly, to avoid reference cycles (see `GDScriptCompiler::_gdtype_from_datatype()`).
+	const GDScript *gdscript = Object::cast_to<GDScript>(script.ptr());
+	if (strong || (script.is_valid() && (gdscript == nullptr || gdscript->path != p_reader.root->path))) {
+		type.script_type_ref = script;
+	}
+
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		type.set_container_element_type(i, _read_data_type(p_reader, p_depth + 1));
+	}
+	return type;
+}
+
+void GDScriptBytecodeCache::_write_property_info(Writer &p_writer, const PropertyInfo &p_info) {
+	p_writer.put_32(p_info.type);
+	p_writer.put_string(p_info.name);
+	p_writer.put_string(p_info.class_name);
+	p_writer.put_32(p_info.hint);
+	p_writer.put_string(p_info.hint_string);
+	p_writer.put_32(p_info.usage);
+}
+
+PropertyInfo GDScriptBytecodeCache::_read_property_info(Reader &p_reader) {
+	PropertyInfo info;
+	info.type = (Variant::Type)p_reader.get_32();
+	info.name = p_reader.get_string();
+	info.class_name = p_reader.get_string();
+	info.hint = (PropertyHint)p_reader.get_32();
+	info.hint_string = p_reader.get_string();
+	info.usage = p_reader.get_32();
+	return info;
+}
+
+void GDScriptBytecodeCache::_write_method_info(Writer &p_writer, const MethodInfo &p_info) {
+	p_writer.put_string(p_info.name);
+	_write_property_info(p_writer, p_info.return_val);
+	p_writer.put_32(p_info.flags);
+	p_writer.put_32(p_info.id);
+	p_writer.put_32(p_info.arguments.size());
+	for (const PropertyInfo &E : p_info.arguments) {
+		_write_property_info(p_writer, E);
+	}
+	p_writer.put_32(p_info.default_arguments.size());
+	for (const Variant &E : p_info.default_arguments) {
+		_write_variant(p_writer, E);
+	}
+	p_writer.put_32(p_info.return_val_metadata);
+	p_writer.put_32(p_info.arguments_metadata.size());
+	for (int E : p_info.arguments_metadata) {
+		p_writer.put_32(E);
+	}
+}
+
+MethodInfo GDScriptBytecodeCache::_read_method_info(Reader &p_reader) {
+	MethodInfo info;
+	info.name = p_reader.get_string();
+	info.return_val = _read_property_info(p_reader);
+	info.flags = p_reader.get_32();
+	info.id = p_reader.get_32();
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		info.arguments.push_back(_read_property_info(p_reader));
+	}
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		info.default_arguments.push_back(_read_variant(p_reader));
+	}
+	info.return_val_metadata = p_reader.get_32();
+	count = p_reader.get_count(4);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		info.arguments_metadata.push_back(p_reader.get_32());
+	}
+	return info;
+}
+
+void GDScriptBytecodeCache::_write_member_indices(Writer &p_writer, const HashMap<StringName, GDScript::MemberInfo> &p_indices) {
+	p_writer.put_32(p_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_indices) {
+		p_writer.put_string(E.key);
+		p_writer.put_32(E.value.index);
+		p_writer.put_string(E.value.setter);
+		p_writer.put_string(E.value.getter);
+		_write_data_type(p_writer, E.value.data_type);
+		_write_property_info(p_writer, E.value.property_info);
+	}
+}
+
+void GDScriptBytecodeCache::_read_member_indices(Reader &p_reader, HashMap<StringName, GDScript::MemberInfo> &r_indices) {
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+		GDScript::MemberInfo info;
+		info.index = p_reader.get_32();
+		info.setter = p_reader.get_string();
+		info.getter = p_reader.get_string();
+		info.data_type = _read_data_type(p_reader);
+		info.property_info = _read_property_info(p_reader);
+		r_indices.insert(name, info);
+	}
+}
+
+void GDScriptBytecodeCache::_write_function(Writer &p_writer, const GDScript *p_script, const GDScriptFunction *p_function) {
+	if (!p_function->stack_debug.is_empty()) {
+		p_writer.fail("Functions with debug stack information can't be cached.");
+		return;
+	}
+
+	const FunctionTables &tables = _get_function_tables();
+
+	p_writer.put_string(p_function->name);
+	p_writer.put_string(p_function->source);
+	p_writer.put_8(p_function->_static);
+	p_writer.put_32(p_function->argument_types.size());
+	for (const GDScriptDataType &E : p_function->argument_types) {
+		_write_data_type(p_writer, E);
+	}
+	_write_data_type(p_writer, p_function->return_type);
+	_write_method_info(p_writer, p_function->method_info);
+	_write_variant(p_writer, p_function->rpc_config);
+	p_writer.put_32(p_function->_initial_line);
+	p_writer.put_32(p_function->_argument_count);
+	p_writer.put_32(p_function->_stack_size);
+	p_writer.put_32(p_function->_instruction_args_size);
+
+	p_writer.put_32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		p_writer.put_32(E.key);
+		p_writer.put_32(E.value);
+	}
+
+	// The bytecode only holds indices into the tables below, so it can be stored as is.
+	p_writer.put_32(p_function->code.size());
+	p_writer.put_buffer((const uint8_t *)p_function->code.ptr(), p_function->code.size() * sizeof(int));
+	p_writer.put_32(p_function->default_arguments.size());
+	for (int E : p_function->default_arguments) {
+		p_writer.put_32(E);
+	}
+
+	p_writer.put_32(p_function->constants.size());
+	for (const Variant &E : p_function->constants) {
+		_write_variant(p_writer, E);
+	}
+	p_writer.put_32(p_function->global_names.size());
+	for (const StringName &E : p_function->global_names) {
+		p_writer.put_string(E);
+	}
+
+	// Function pointers are stored by the name they are registered with.
+	p_writer.put_32(p_function->operator_funcs.size());
+	for (Variant::ValidatedOperatorEvaluator E : p_function->operator_funcs) {
+		const RBMap<Variant::ValidatedOperatorEvaluator, FunctionTables::OperatorKey>::Element *key = tables.operators.find(E);
+		if (key == nullptr) {
+			p_writer.fail("Unknown operator evaluator.");
+			return;
+		}
+		p_writer.put_32(key->value().op);
+		p_writer.put_32(key->value().type_a);
+		p_writer.put_32(key->value().type_b);
+	}
+
+#define WRITE_MEMBER_KEYS(m_vector, m_table, m_what) \
+	p_writer.put_32(p_function->m_vector.size());    \
+	for (const auto &E : p_function->m_vector) {     \
+		const auto *key = tables.m_table.find(E);    \
+		if (key == nullptr) {                        \
+			p_writer.fail("Unknown " m_what ".");    \
+			return;                                  \
+		}                                            \
+		p_writer.put_32(key->value().type);          \
+		p_writer.put_string(key->value().name);      \
+	}
+
+#define WRITE_TYPE_KEYS(m_vector, m_table, m_what) \
+	p_writer.put_32(p_function->m_vector.size());  \
+	for (const auto &E : p_function->m_vector) {   \
+		const auto *key = tables.m_table.find(E);  \
+		if (key == nullptr) {                      \
+			p_writer.fail("Unknown " m_what ".");  \
+			return;                                \
+		}                                          \
+		p_writer.put_32(key->value());             \
+	}
+
+#define WRITE_NAME_KEYS(m_vector, m_table, m_what) \
+	p_writer.put_32(p_function->m_vector.size());  \
+	for (const auto &E : p_function->m_vector) {   \
+		const auto *key = tables.m_table.find(E);  \
+		if (key == nullptr) {                      \
+			p_writer.fail("Unknown " m_what ".");  \
+			return;                                \
+		}                                          \
+		p_writer.put_string(key->value());         \
+	}
+
+	WRITE_MEMBER_KEYS(setters, setters, "setter");
+	WRITE_MEMBER_KEYS(getters, getters, "getter");
+	WRITE_TYPE_KEYS(keyed_setters, keyed_setters, "keyed setter");
+	WRITE_TYPE_KEYS(keyed_getters, keyed_getters, "keyed getter");
+	WRITE_TYPE_KEYS(indexed_setters, indexed_setters, "indexed setter");
+	WRITE_TYPE_KEYS(indexed_getters, indexed_getters, "indexed getter");
+	WRITE_MEMBER_KEYS(builtin_methods, builtin_methods, "builtin method");
+
+	p_writer.put_32(p_function->constructors.size());
+	for (Variant::ValidatedConstructor E : p_function->constructors) {
+		const RBMap<Variant::ValidatedConstructor, FunctionTables::ConstructorKey>::Element *key = tables.constructors.find(E);
+		if (key == nullptr) {
+			p_writer.fail("Unknown constructor.");
+			return;
+		}
+		p_writer.put_32(key->value().type);
+		p_writer.put_32(key->value().index);
+	}
+
+	WRITE_NAME_KEYS(utilities, utilities, "utility function");
+	WRITE_NAME_KEYS(gds_utilities, gds_utilities, "GDScript utility function");
+
+#undef WRITE_MEMBER_KEYS
+#undef WRITE_TYPE_KEYS
+#undef WRITE_NAME_KEYS
+
+	p_writer.put_32(p_function->methods.size());
+	for (const MethodBind *E : p_function->methods) {
+		if (ClassDB::get_method(E->get_instance_class(), E->get_name()) != E) {
+			p_writer.fail(vformat(R"(Method "%s" can't be looked up by name.)", E->get_name()));
+			return;
+		}
+		p_writer.put_string(E->get_instance_class());
+		p_writer.put_string(E->get_name());
+	}
+
+	p_writer.put_32(p_function->lambdas.size());
+	for (const GDScriptFunction *E : p_function->lambdas) {
+		_write_function(p_writer, p_script, E);
+		const GDScript::LambdaInfo *info = p_script->lambda_info.getptr(const_cast<GDScriptFunction *>(E));
+		p_writer.put_8(info != nullptr);
+		p_writer.put_32(info ? info->capture_count : 0);
+		p_writer.put_8(info ? info->use_self : false);
+	}
+
+	p_writer.put_32(p_function->get_node_caches.size());
+	p_writer.put_32(p_function->inline_caches.size());
+
+#ifdef DEBUG_ENABLED
+	p_writer.put_string(p_function->profile.signature);
+
+	const Vector<String> *debug_names[] = {
+		&p_function->operator_names,
+		&p_function->setter_names,
+		&p_function->getter_names,
+		&p_function->builtin_methods_names,
+		&p_function->constructors_names,
+		&p_function->utilities_names,
+		&p_function->gds_utilities_names,
+	};
+	for (const Vector<String> *names : debug_names) {
+		p_writer.put_32(names->size());
+		for (const String &E : *names) {
+			p_writer.put_string(E);
+		}
+	}
+#endif
+}
+
+GDScriptFunction *GDScriptBytecodeCache::_read_function(Reader &p_reader, GDScript *p_script) {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+
+	function->name = p_reader.get_string();
+	function->source = p_reader.get_string();
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+	function->_static = p_reader.get_8();
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		function->argument_types.push_back(_read_data_type(p_reader));
+	}
+	function->return_type = _read_data_type(p_reader);
+	function->method_info = _read_method_info(p_reader);
+	function->rpc_config = _read_variant(p_reader);
+	function->_initial_line = p_reader.get_32();
+	function->_argument_count = p_reader.get_32();
+	function->_stack_size = p_reader.get_32();
+	function->_instruction_args_size = p_reader.get_32();
+
+	count = p_reader.get_count(8);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		int slot = p_reader.get_32();
+		function->temporary_slots[slot] = (Variant::Type)p_reader.get_32();
+	}
+
+	count = p_reader.get_count((int)sizeof(int));
+	if (!p_reader.failed && count > 0) {
+		function->code.resize(count);
+		memcpy(function->code.ptrw(), p_reader.ptr + p_reader.pos, count * sizeof(int));
+		p_reader.pos += count * sizeof(int);
+	}
+	count = p_reader.get_count(4);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		function->default_arguments.push_back(p_reader.get_32());
+	}
+
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		function->constants.push_back(_read_variant(p_reader));
+	}
+	count = p_reader.get_count(4);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		function->global_names.push_back(p_reader.get_string());
+	}
+
+	count = p_reader.get_count(12);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		uint32_t op = p_reader.get_32();
+		uint32_t type_a = p_reader.get_32();
+		uint32_t type_b = p_reader.get_32();
+		Variant::ValidatedOperatorEvaluator evaluator = nullptr;
+		if (op < Variant::OP_MAX && type_a < Variant::VARIANT_MAX && type_b < Variant::VARIANT_MAX) {
+			evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, (Variant::Type)type_a, (Variant::Type)type_b);
+		}
+		p_reader.failed = p_reader.failed || evaluator == nullptr;
+		function->operator_funcs.push_back(evaluator);
+	}
+
+#define READ_MEMBER_KEYS(m_vector, m_lookup)                         \
+	count = p_reader.get_count(8);                                   \
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {       \
+		uint32_t type = p_reader.get_32();                           \
+		StringName name = p_reader.get_string();                     \
+		auto ptr = type < Variant::VARIANT_MAX ? m_lookup : nullptr; \
+		p_reader.failed = p_reader.failed || ptr == nullptr;         \
+		function->m_vector.push_back(ptr);                           \
+	}
+
+#define READ_TYPE_KEYS(m_vector, m_lookup)                           \
+	count = p_reader.get_count(4);                                   \
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {       \
+		uint32_t type = p_reader.get_32();                           \
+		auto ptr = type < Variant::VARIANT_MAX ? m_lookup : nullptr; \
+		p_reader.failed = p_reader.failed || ptr == nullptr;         \
+		function->m_vector.push_back(ptr);                           \
+	}
+
+#define READ_NAME_KEYS(m_vector, m_lookup)                     \
+	count = p_reader.get_count(4);                             \
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) { \
+		StringName name = p_reader.get_string();               \
+		auto ptr = m_lookup;                                   \
+		p_reader.failed = p_reader.failed || ptr == nullptr;   \
+		function->m_vector.push_back(ptr);                     \
+	}
+
+	READ_MEMBER_KEYS(setters, Variant::get_member_validated_setter((Variant::Type)type, name));
+	READ_MEMBER_KEYS(getters, Variant::get_member_validated_getter((Variant::Type)type, name));
+	READ_TYPE_KEYS(keyed_setters, Variant::get_member_validated_keyed_setter((Variant::Type)type));
+	READ_TYPE_KEYS(keyed_getters, Variant::get_member_validated_keyed_getter((Variant::Type)type));
+	READ_TYPE_KEYS(indexed_setters, Variant::get_member_validated_indexed_setter((Variant::Type)type));
+	READ_TYPE_KEYS(indexed_getters, Variant::get_member_validated_indexed_getter((Variant::Type)type));
+	READ_MEMBER_KEYS(builtin_methods, Variant::get_validated_builtin_method((Variant::Type)type, name));
+
+	count = p_reader.get_count(8);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		uint32_t type = p_reader.get_32();
+		int index = p_reader.get_32();
+		Variant::ValidatedConstructor constructor = nullptr;
+		if (type < Variant::VARIANT_MAX && index >= 0 && index < Variant::get_constructor_count((Variant::Type)type)) {
+			constructor = Variant::get_validated_constructor((Variant::Type)type, index);
+		}
+		p_reader.failed = p_reader.failed || constructor == nullptr;
+		function->constructors.push_back(constructor);
+	}
+
+	READ_NAME_KEYS(utilities, Variant::get_validated_utility_function(name));
+	READ_NAME_KEYS(gds_utilities, GDScriptUtilityFunctions::get_function(name));
+
+#undef READ_MEMBER_KEYS
+#undef READ_TYPE_KEYS
+#undef READ_NAME_KEYS
+
+	count = p_reader.get_count(8);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName class_name = p_reader.get_string();
+		StringName method_name = p_reader.get_string();
+		MethodBind *method = ClassDB::get_method(class_name, method_name);
+		p_reader.failed = p_reader.failed || method == nullptr;
+		function->methods.push_back(method);
+	}
+
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		GDScriptFunction *lambda = _read_function(p_reader, p_script);
+		if (lambda == nullptr) {
+			break;
+		}
+		function->lambdas.push_back(lambda);
+		bool has_info = p_reader.get_8();
+		GDScript::LambdaInfo info;
+		info.capture_count = p_reader.get_32();
+		info.use_self = p_reader.get_8();
+		if (has_info) {
+			p_script->lambda_info.insert(lambda, info);
+		}
+	}
+
+	uint32_t get_node_cache_count = p_reader.get_32();
+	uint32_t inline_cache_count = p_reader.get_32();
+
+#ifdef DEBUG_ENABLED
+	function->profile.signature = p_reader.get_string();
+
+	Vector<String> *debug_names[] = {
+		&function->operator_names,
+		&function->setter_names,
+		&function->getter_names,
+		&function->builtin_methods_names,
+		&function->constructors_names,
+		&function->utilities_names,
+		&function->gds_utilities_names,
+	};
+	for (Vector<String> *names : debug_names) {
+		count = p_reader.get_count(4);
+		for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+			names->push_back(p_reader.get_string());
+		}
+	}
+#endif
+
+	if (p_reader.failed || get_node_cache_count > (uint32_t)function->code.size() || inline_cache_count > (uint32_t)function->code.size()) {
+		p_reader.failed = true;
+		memdelete(function);
+		return nullptr;
+	}
+
+	// Same setup as `GDScriptByteCodeGenerator::write_end()`.
+	function->get_node_caches.resize(get_node_cache_count);
+	function->inline_caches.resize(inline_cache_count);
+
+	function->_code_size = function->code.size();
+	function->_code_ptr = function->_code_size ? function->code.ptrw() : nullptr;
+	function->_default_arg_count = function->default_arguments.is_empty() ? 0 : function->default_arguments.size() - 1;
+	function->_default_arg_ptr = function->default_arguments.is_empty() ? nullptr : function->default_arguments.ptr();
+
+#define SETUP_TABLE(m_vector, m_count, m_ptr, m_access) \
+	function->m_count = function->m_vector.size();      \
+	function->m_ptr = function->m_count ? function->m_vector.m_access() : nullptr;
+
+	SETUP_TABLE(constants, _constant_count, _constants_ptr, ptrw);
+	SETUP_TABLE(global_names, _global_names_count, _global_names_ptr, ptr);
+	SETUP_TABLE(operator_funcs, _operator_funcs_count, _operator_funcs_ptr, ptr);
+	SETUP_TABLE(setters, _setters_count, _setters_ptr, ptr);
+	SETUP_TABLE(getters, _getters_count, _getters_ptr, ptr);
+	SETUP_TABLE(keyed_setters, _keyed_setters_count, _keyed_setters_ptr, ptr);
+	SETUP_TABLE(keyed_getters, _keyed_getters_count, _keyed_getters_ptr, ptr);
+	SETUP_TABLE(indexed_setters, _indexed_setters_count, _indexed_setters_ptr, ptr);
+	SETUP_TABLE(indexed_getters, _indexed_getters_count, _indexed_getters_ptr, ptr);
+	SETUP_TABLE(builtin_methods, _builtin_methods_count, _builtin_methods_ptr, ptr);
+	SETUP_TABLE(constructors, _constructors_count, _constructors_ptr, ptr);
+	SETUP_TABLE(utilities, _utilities_count, _utilities_ptr, ptr);
+	SETUP_TABLE(gds_utilities, _gds_utilities_count, _gds_utilities_ptr, ptr);
+	SETUP_TABLE(methods, _methods_count, _methods_ptr, ptrw);
+	SETUP_TABLE(lambdas, _lambdas_count, _lambdas_ptr, ptrw);
+	SETUP_TABLE(get_node_caches, _get_node_caches_count, _get_node_caches_ptr, ptrw);
+	SETUP_TABLE(inline_caches, _inline_caches_count, _inline_caches_ptr, ptrw);
+
+#undef SETUP_TABLE
+
+	return function;
+}
+
+void GDScriptBytecodeCache::_write_class_tree(Writer &p_writer, const GDScript *p_script) {
+	p_writer.put_string(p_script->fully_qualified_name);
+	p_writer.put_string(p_script->local_name);
+	p_writer.put_string(p_script->global_name);
+	p_writer.put_string(p_script->simplified_icon_path);
+	p_writer.put_32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_string(E.key);
+		_write_class_tree(p_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeCache::_read_class_tree(Reader &p_reader, GDScript *p_script) {
+	// Same as `GDScriptCompiler::make_scripts()`.
+	p_script->fully_qualified_name = p_reader.get_string();
+	p_script->local_name = p_reader.get_string();
+	p_script->global_name = p_reader.get_string();
+	p_script->simplified_icon_path = p_reader.get_string();
+
+	HashMap<StringName, Ref<GDScript>> old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass.instantiate();
+		}
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		_read_class_tree(p_reader, subclass.ptr());
+	}
+	return !p_reader.failed;
+}
+
+void GDScriptBytecodeCache::_write_class(Writer &p_writer, const GDScript *p_script) {
+	p_writer.put_8(p_script->tool);
+	p_writer.put_string(p_script->native.is_valid() ? p_script->native->get_name() : StringName());
+	_write_script(p_writer, p_script->base.ptr());
+
+	_write_member_indices(p_writer, p_script->member_indices);
+	p_writer.put_32(p_script->members.size());
+	for (const StringName &E : p_script->members) {
+		p_writer.put_string(E);
+	}
+	_write_member_indices(p_writer, p_script->static_variables_indices);
+
+	p_writer.put_32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		p_writer.put_string(E.key);
+		_write_variant(p_writer, E.value);
+	}
+
+	p_writer.put_32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		p_writer.put_string(E.key);
+		_write_method_info(p_writer, E.value);
+	}
+
+	_write_variant(p_writer, p_script->rpc_config);
+
+#ifdef TOOLS_ENABLED
+	p_writer.put_32(p_script->member_default_values.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->member_default_values) {
+		p_writer.put_string(E.key);
+		_write_variant(p_writer, E.value);
+	}
+#endif
+
+	p_writer.put_32(p_script->member_functions.size());
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		p_writer.put_string(E.key);
+		_write_function(p_writer, p_script, E.value);
+	}
+	p_writer.put_string(p_script->initializer ? p_script->initializer->name : StringName());
+
+	const GDScriptFunction *implicit_functions[] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	for (const GDScriptFunction *function : implicit_functions) {
+		p_writer.put_8(function != nullptr);
+		if (function) {
+			_write_function(p_writer, p_script, function);
+		}
+	}
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_write_class(p_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeCache::_read_class(Reader &p_reader, GDScript *p_script) {
+	_clear_class(p_script);
+
+	p_script->tool = p_reader.get_8();
+
+	StringName native_name = p_reader.get_string();
+	const int *native_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(native_name);
+	if (native_index) {
+		p_script->native = GDScriptLanguage::get_singleton()->get_global_array()[*native_index];
+	}
+	if (p_script->native.is_null()) {
+		p_reader.failed = true;
+		return false;
+	}
+
+	Ref<Script> base = _read_script(p_reader);
+	if (base.is_valid()) {
+		p_script->base = base;
+		p_script->_base = p_script->base.ptr();
+		if (p_script->_base == nullptr) {
+			p_reader.failed = true;
+			return false;
+		}
+	}
+
+	_read_member_indices(p_reader, p_script->member_indices);
+	uint32_t count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		p_script->members.insert(p_reader.get_string());
+	}
+	_read_member_indices(p_reader, p_script->static_variables_indices);
+	p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+		p_script->constants.insert(name, _read_variant(p_reader));
+	}
+
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+		p_script->_signals[name] = _read_method_info(p_reader);
+	}
+
+	p_script->rpc_config = _read_variant(p_reader);
+
+#ifdef TOOLS_ENABLED
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+		p_script->member_default_values[name] = _read_variant(p_reader);
+	}
+#endif
+
+	count = p_reader.get_count();
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		StringName name = p_reader.get_string();
+		GDScriptFunction *function = _read_function(p_reader, p_script);
+		if (function) {
+			p_script->member_functions[name] = function;
+		}
+	}
+
+	StringName initializer_name = p_reader.get_string();
+	if (initializer_name != StringName()) {
+		GDScriptFunction **initializer = p_script->member_functions.getptr(initializer_name);
+		if (initializer == nullptr) {
+			p_reader.failed = true;
+			return false;
+		}
+		p_script->initializer = *initializer;
+	}
+
+	GDScriptFunction **implicit_functions[] = { &p_script->implicit_initializer, &p_script->implicit_ready, &p_script->static_initializer };
+	for (GDScriptFunction **function : implicit_functions) {
+		if (p_reader.get_8()) {
+			*function = _read_function(p_reader, p_script);
+		}
+	}
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		if (!_read_class(p_reader, E.value.ptr())) {
+			return false;
+		}
+	}
+
+	if (p_reader.failed) {
+		return false;
+	}
+
+	p_script->_static_default_init();
+	p_script->valid = true;
+	return true;
+}
+
+void GDScriptBytecodeCache::_clear_class(GDScript *p_script) {
+	// Same as the cleanup at the start of `GDScriptCompiler::_prepare_compilation()`.
+	p_script->clearing = true;
+	GDScript::layout_version.increment();
+
+	p_script->valid = false;
+	p_script->native = Ref<GDScriptNativeClass>();
+	p_script->base = Ref<GDScript>();
+	p_script->_base = nullptr;
+	p_script->members.clear();
+
+	HashMap<StringName, Variant> constants = p_script->constants;
+	p_script->constants.clear();
+	constants.clear();
+
+	HashMap<StringName, GDScriptFunction *> member_functions = p_script->member_functions;
+	p_script->member_functions.clear();
+	for (const KeyValue<StringName, GDScriptFunction *> &E : member_functions) {
+		memdelete(E.value);
+	}
+
+	if (p_script->implicit_initializer) {
+		memdelete(p_script->implicit_initializer);
+	}
+	if (p_script->implicit_ready) {
+		memdelete(p_script->implicit_ready);
+	}
+	if (p_script->static_initializer) {
+		memdelete(p_script->static_initializer);
+	}
+
+	p_script->member_indices.clear();
+	p_script->static_variables_indices.clear();
+	p_script->static_variables.clear();
+	p_script->_signals.clear();
+	p_script->initializer = nullptr;
+	p_script->implicit_initializer = nullptr;
+	p_script->implicit_ready = nullptr;
+	p_script->static_initializer = nullptr;
+	p_script->rpc_config.clear();
+	p_script->lambda_info.clear();
+#ifdef TOOLS_ENABLED
+	p_script->member_default_values.clear();
+#endif
+
+	p_script->clearing = false;
+}
+
+bool GDScriptBytecodeCache::_read_header(Reader &p_reader, const GDScript *p_script, bool p_validate) {
+	if (p_reader.get_32() != BYTECODE_CACHE_MAGIC || p_reader.get_32() != BYTECODE_CACHE_VERSION) {
+		return false;
+	}
+
+	String engine_key = p_reader.get_string();
+	uint32_t project_hash = p_reader.get_32();
+	uint32_t source_hash = p_reader.get_32();
+	uint32_t body_hash = p_reader.get_32();
+	if (p_reader.failed) {
+		return false;
+	}
+
+	if (p_validate) {
+		if (engine_key != _get_engine_key() || project_hash != _get_project_hash() || source_hash != _get_script_source_hash(p_script)) {
+			return false;
+		}
+		if (body_hash != hash_djb2_buffer(p_reader.ptr + p_reader.pos, p_reader.size - p_reader.pos)) {
+			return false;
+		}
+	}
+
+	uint32_t count = p_reader.get_count(8);
+	for (uint32_t i = 0; i < count && !p_reader.failed; i++) {
+		String path = p_reader.get_string();
+		uint32_t dependency_hash = p_reader.get_32();
+		if (p_validate) {
+			uint32_t current_hash = 0;
+			if (!_get_file_source_hash(path, current_hash) || current_hash != dependency_hash) {
+				return false;
+			}
+		}
+	}
+
+	return !p_reader.failed;
+}
+
+bool GDScriptBytecodeCache::prepare(GDScript *p_script) {
+	const String &path = p_script->path;
+	if (path.is_empty() || path.contains("::")) {
+		return false;
+	}
+
+	String cache_path = _get_cache_path(path);
+	if (!FileAccess::exists(cache_path)) {
+		return false;
+	}
+
+	Vector<uint8_t> data = FileAccess::get_file_as_bytes(cache_path);
+
+	Reader reader;
+	reader.ptr = data.ptr();
+	reader.size = data.size();
+	reader.root = p_script;
+	if (!_read_header(reader, p_script, true)) {
+		print_verbose(vformat(R"(GDScript: Bytecode cache of "%s" is outdated.)", path));
+		return false;
+	}
+
+	reader.get_8(); // Static data flag, used by `load()`.
+	if (!_read_class_tree(reader, p_script)) {
+		return false;
+	}
+
+	p_script->bytecode_cache = data;
+	return true;
+}
+
+bool GDScriptBytecodeCache::load(GDScript *p_script, Error &r_error) {
+	r_error = OK;
+
+	Vector<uint8_t> data = p_script->bytecode_cache;
+	p_script->bytecode_cache.clear();
+
+	Reader reader;
+	reader.ptr = data.ptr();
+	reader.size = data.size();
+	reader.root = p_script;
+	if (!_read_header(reader, p_script, false)) {
+		return false;
+	}
+
+	bool keep_static = reader.get_8();
+	if (!_read_class_tree(reader, p_script) || !_read_class(reader, p_script) || reader.pos != reader.size) {
+		print_verbose(vformat(R"(GDScript: Failed to restore "%s" from the bytecode cache, compiling it instead.)", p_script->path));
+		_clear_class(p_script);
+		return false;
+	}
+
+	// Same as the end of `GDScriptCompiler::compile()`.
+	if (keep_static) {
+		GDScriptCache::add_static_script(p_script);
+	}
+	r_error = GDScriptCache::finish_compiling(p_script->path);
+	return true;
+}
+
+void GDScriptBytecodeCache::save(GDScript *p_script, GDScriptParser &p_parser) {
+	const String &path = p_script->path;
+	if (path.is_empty() || path.contains("::") || !p_script->is_valid()) {
+		return;
+	}
+
+	Writer body;
+	body.root = p_script;
+
+	bool has_static_data = false;
+	Vector<const GDScript *> classes;
+	classes.push_back(p_script);
+	for (int i = 0; i < classes.size(); i++) {
+		has_static_data = has_static_data || classes[i]->static_initializer != nullptr;
+		for (const KeyValue<StringName, Ref<GDScript>> &E : classes[i]->subclasses) {
+			classes.push_back(E.value.ptr());
+		}
+	}
+	body.put_8(has_static_data && !p_parser.get_tree()->annotated_static_unload);
+
+	_write_class_tree(body, p_script);
+	_write_class(body, p_script);
+
+	// Everything the analyzer looked at can change the generated code, so take the whole dependency closure into account.
+	List<Ref<GDScriptParserRef>> pending;
+	for (const KeyValue<String, Ref<GDScriptParserRef>> &E : p_parser.get_depended_parsers()) {
+		pending.push_back(E.value);
+	}
+	HashSet<String> visited;
+	while (!pending.is_empty() && !body.failed) {
+		Ref<GDScriptParserRef> parser_ref = pending.front()->get();
+		pending.pop_front();
+		if (parser_ref.is_null() || visited.has(parser_ref->get_path())) {
+			continue;
+		}
+		visited.insert(parser_ref->get_path());
+		if (parser_ref->parser == nullptr) {
+			body.fail(vformat(R"(Dependency "%s" was already released.)", parser_ref->get_path()));
+			break;
+		}
+		body.dependencies.insert(parser_ref->get_path());
+		for (const KeyValue<String, Ref<GDScriptParserRef>> &E : parser_ref->parser->get_depended_parsers()) {
+			pending.push_back(E.value);
+		}
+	}
+	body.dependencies.erase(path);
+
+	if (body.failed) {
+		print_verbose(vformat(R"(GDScript: Not caching the bytecode of "%s": %s)", path, body.error));
+		return;
+	}
+
+	Writer header;
+	header.put_32(BYTECODE_CACHE_MAGIC);
+	header.put_32(BYTECODE_CACHE_VERSION);
+	header.put_string(_get_engine_key());
+	header.put_32(_get_project_hash());
+	header.put_32(_get_script_source_hash(p_script));
+
+	Writer dependencies;
+	dependencies.put_32(body.dependencies.size());
+	for (const String &E : body.dependencies) {
+		uint32_t hash = 0;
+		if (!_get_file_source_hash(E, hash)) {
+			print_verbose(vformat(R"(GDScript: Not caching the bytecode of "%s": Can't read dependency "%s".)", path, E));
+			return;
+		}
+		dependencies.put_string(E);
+		dependencies.put_32(hash);
+	}
+
+	// The body hash covers everything after it, which guards against truncated or corrupted files.
+	uint32_t body_hash = hash_djb2_buffer(dependencies.data.ptr(), dependencies.data.size());
+	body_hash = hash_djb2_buffer(body.data.ptr(), body.data.size(), body_hash);
+	header.put_32(body_hash);
+
+	String cache_path = _get_cache_path(path);
+	String temp_path = cache_path + ".tmp";
+	Error err = DirAccess::make_dir_recursive_absolute(cache_path.get_base_dir());
+	if (err != OK) {
+		return;
+	}
+	{
+		Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE, &err);
+		if (file.is_null()) {
+			return;
+		}
+		file->store_buffer(header.data);
+		file->store_buffer(dependencies.data);
+		file->store_buffer(body.data);
+		if (file->get_error() != OK) {
+			return;
+		}
+	}
+
+	Ref<DirAccess> dir = DirAccess::create_for_path(cache_path);
+	if (dir.is_valid()) {
+		if (dir->file_exists(cache_path)) {
+			dir->remove(cache_path);
+		}
+		dir->rename(temp_path, cache_path);
+	}
+}
+
+void GDScriptBytecodeCache::cleanup() {
+	MutexLock lock(mutex);
+
+	if (function_tables) {
+		memdelete(function_tables);
+		function_tables = nullptr;
+	}
+	source_hashes.clear();
+	global_classes_hashed = false;
+	enabled = -1;
+}
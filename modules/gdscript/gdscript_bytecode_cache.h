@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_BYTECODE_CACHE_H
+#define GDSCRIPT_BYTECODE_CACHE_H
+
+#include "gdscript.h"
+
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+
+class GDScriptParser;
+
+// Persists the compiled state of exported scripts (bytecode, constants and member layouts)
+// in `user://`, so later runs can skip parsing, analysis and compilation entirely.
+// Entries are keyed on the engine build, the project's global classes and autoloads,
+// and the source hashes of the script and everything it depends on.
+class GDScriptBytecodeCache {
+	struct Writer;
+	struct Reader;
+	struct FunctionTables;
+
+	static Mutex mutex;
+	static int enabled;
+	static bool global_classes_hashed;
+	static uint32_t global_classes_hash;
+	static HashMap<String, uint32_t> source_hashes;
+	static FunctionTables *function_tables;
+
+	static String _get_cache_path(const String &p_path);
+	static String _get_engine_key();
+	static uint32_t _get_project_hash();
+	static uint32_t _get_script_source_hash(const GDScript *p_script);
+	static bool _get_file_source_hash(const String &p_path, uint32_t &r_hash);
+	static const FunctionTables &_get_function_tables();
+
+	static void _write_variant(Writer &p_writer, const Variant &p_value, int p_depth = 0);
+	static Variant _read_variant(Reader &p_reader, int p_depth = 0);
+	static void _write_script(Writer &p_writer, const Script *p_script);
+	static Ref<Script> _read_script(Reader &p_reader);
+	static void _write_data_type(Writer &p_writer, const GDScriptDataType &p_type, int p_depth = 0);
+	static GDScriptDataType _read_data_type(Reader &p_reader, int p_depth = 0);
+	static void _write_property_info(Writer &p_writer, const PropertyInfo &p_info);
+	static PropertyInfo _read_property_info(Reader &p_reader);
+	static void _write_method_info(Writer &p_writer, const MethodInfo &p_info);
+	static MethodInfo _read_method_info(Reader &p_reader);
+	static void _write_member_indices(Writer &p_writer, const HashMap<StringName, GDScript::MemberInfo> &p_indices);
+	static void _read_member_indices(Reader &p_reader, HashMap<StringName, GDScript::MemberInfo> &r_indices);
+	static void _write_function(Writer &p_writer, const GDScript *p_script, const GDScriptFunction *p_function);
+	static GDScriptFunction *_read_function(Reader &p_reader, GDScript *p_script);
+	static void _write_class_tree(Writer &p_writer, const GDScript *p_script);
+	static bool _read_class_tree(Reader &p_reader, GDScript *p_script);
+	static void _write_class(Writer &p_writer, const GDScript *p_script);
+	static bool _read_class(Reader &p_reader, GDScript *p_script);
+	static void _clear_class(GDScript *p_script);
+	static bool _read_header(Reader &p_reader, const GDScript *p_script, bool p_validate);
+
+public:
+	static bool is_enabled();
+
+	// Reads the cache entry of a freshly loaded script and, if it is still valid, creates its inner classes and marks it as pending.
+	static bool prepare(GDScript *p_script);
+	// Restores a pending script. Returns false if the script has to be compiled from source instead.
+	static bool load(GDScript *p_script, Error &r_error);
+	static void save(GDScript *p_script, GDScriptParser &p_parser);
+
+	static void cleanup();
+};
+
+#endif // GDSCRIPT_BYTECODE_CACHE_H
@@ -32,6 +32,7 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
@@ -51,6 +52,7 @@ uint32_t GDScriptParserRef::get_source_hash() const {
 }
 
 GDScriptParser *GDScriptParserRef::get_parser() {
+	_finish_parse_task(true);
 	if (parser == nullptr) {
 		parser = memnew(GDScriptParser);
 	}
@@ -64,8 +66,94 @@ GDScriptAnalyzer *GDScriptParserRef::get_analyzer() {
 	return analyzer;
 }
 
+Error GDScriptParserRef::_parse(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash) {
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+		r_source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+		return p_parser->parse_binary(tokens, p_path);
+	} else {
+		String source = GDScriptCache::get_source_code(remapped_path);
+		r_source_hash = source.hash();
+		return p_parser->parse(source, p_path, false);
+	}
+}
+
+void GDScriptParserRef::_parse_task_func(void *p_userdata) {
+	ParseTask *task = static_cast<ParseTask *>(p_userdata);
+
+	// Parsing only touches the source and the parser itself, so it's safe without holding the cache lock.
+	if (task->claimed.postincrement() == 0) {
+		task->parser = memnew(GDScriptParser);
+		task->result = _parse(task->parser, task->path, task->source_hash);
+		task->done.post();
+	}
+
+	if (task->refcount.unref()) {
+		if (task->parser != nullptr) {
+			memdelete(task->parser);
+		}
+		memdelete(task);
+	}
+}
+
+void GDScriptParserRef::_start_parse_task() {
+	ERR_FAIL_COND(parse_task != nullptr || status != EMPTY);
+
+	parse_task = memnew(ParseTask);
+	parse_task->refcount.init(2);
+	parse_task->path = path;
+	parse_task->task_id = WorkerThreadPool::get_singleton()->add_native_task(&GDScriptParserRef::_parse_task_func, parse_task, false, "GDScript parse: " + path);
+}
+
+void GDScriptParserRef::_finish_parse_task(bool p_keep_result) {
+	if (parse_task == nullptr) {
+		return;
+	}
+
+	ParseTask *task = parse_task;
+	parse_task = nullptr;
+
+	if (task->claimed.postincrement() == 0) {
+		// Not started yet, the task will skip itself once the pool gets to it. The caller parses on its own if needed.
+		GDScriptCache::detach_parse_task(task->task_id);
+	} else {
+		Error err = WorkerThreadPool::get_singleton()->wait_for_task_completion(task->task_id);
+		if (err == ERR_BUSY) {
+			// Pool threads can't await older tasks, but this one is already running and never blocks.
+			task->done.wait();
+			GDScriptCache::detach_parse_task(task->task_id);
+		}
+
+		if (p_keep_result) {
+			if (parser != nullptr) {
+				memdelete(parser);
+			}
+			parser = task->parser;
+			task->parser = nullptr;
+			result = task->result;
+			source_hash = task->source_hash;
+			status = PARSED;
+
+			if (result == OK) {
+				GDScriptCache::prefetch_dependencies(path, parser);
+			}
+		}
+	}
+
+	if (task->refcount.unref()) {
+		if (task->parser != nullptr) {
+			memdelete(task->parser);
+		}
+		memdelete(task);
+	}
+}
+
 Error GDScriptParserRef::raise_status(Status p_new_status) {
 	ERR_FAIL_COND_V(clearing, ERR_BUG);
+	if (p_new_status > EMPTY) {
+		_finish_parse_task(true);
+	}
 	ERR_FAIL_COND_V(parser == nullptr && status != EMPTY, ERR_BUG);
 
 	while (result == OK && p_new_status > status) {
@@ -75,15 +163,9 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				// It's ok if its the first thing done here.
 				get_parser()->clear();
 				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
-					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
-					result = get_parser()->parse_binary(tokens, path);
-				} else {
-					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
+				result = _parse(get_parser(), path, source_hash);
+				if (result == OK) {
+					GDScriptCache::prefetch_dependencies(path, parser);
 				}
 			} break;
 			case PARSED: {
@@ -113,6 +195,8 @@ void GDScriptParserRef::clear() {
 	}
 	clearing = true;
 
+	_finish_parse_task(false);
+
 	GDScriptParser *lparser = parser;
 	GDScriptAnalyzer *lanalyzer = analyzer;
 
@@ -165,6 +249,11 @@ void GDScriptCache::move_script(const String &p_from, const String &p_to) {
 	}
 	singleton->parser_inverse_dependencies.erase(p_from);
 
+	if (singleton->prefetched_parsers.has(p_from) && !p_from.is_empty()) {
+		singleton->prefetched_parsers[p_to] = singleton->prefetched_parsers[p_from];
+	}
+	singleton->prefetched_parsers.erase(p_from);
+
 	if (singleton->shallow_gdscript_cache.has(p_from) && !p_from.is_empty()) {
 		singleton->shallow_gdscript_cache[p_to] = singleton->shallow_gdscript_cache[p_from];
 	}
@@ -187,7 +276,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 		return;
 	}
 
-	if (HashMap<String, Vector<ObjectID>>::Iterator E = singleton->abandoned_parser_map.find(p_path)) {
+	if (FlatHashMap<String, Vector<ObjectID>>::Iterator E = singleton->abandoned_parser_map.find(p_path)) {
 		for (ObjectID parser_ref_id : E->value) {
 			Ref<GDScriptParserRef> parser_ref{ ObjectDB::get_instance(parser_ref_id) };
 			if (parser_ref.is_valid()) {
@@ -205,6 +294,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 	remove_parser(p_path);
 
 	singleton->dependencies.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
 }
@@ -255,13 +345,71 @@ void GDScriptCache::remove_parser(const String &p_path) {
 	singleton->parser_map.erase(p_path);
 
 	// Have to copy while iterating, because parser_inverse_dependencies is modified.
-	HashSet<String> ideps = singleton->parser_inverse_dependencies[p_path];
+	FlatHashSet<String> ideps = singleton->parser_inverse_dependencies[p_path];
 	singleton->parser_inverse_dependencies.erase(p_path);
 	for (String idep_path : ideps) {
 		remove_parser(idep_path);
 	}
 }
 
+void GDScriptCache::prefetch_dependencies(const String &p_path, const GDScriptParser *p_parser) {
+	if (singleton == nullptr || WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+
+	if (singleton->cleared) {
+		return;
+	}
+
+	for (int i = singleton->detached_parse_tasks.size() - 1; i >= 0; i--) {
+		WorkerThreadPool::TaskID task_id = singleton->detached_parse_tasks[i];
+		if (WorkerThreadPool::get_singleton()->is_task_completed(task_id)) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+			singleton->detached_parse_tasks.remove_at(i);
+		}
+	}
+
+	// Only a guess of what the analyzer will ask for: literal paths, plus type names that are global GDScript classes.
+	HashSet<String> paths;
+	const String base_dir = p_path.get_base_dir();
+	for (const String &E : p_parser->get_referenced_paths()) {
+		paths.insert((E.is_relative_path() ? base_dir.path_join(E) : E).simplify_path());
+	}
+	for (const StringName &E : p_parser->get_referenced_type_names()) {
+		if (ScriptServer::is_global_class(E) && ScriptServer::get_global_class_language(E) == GDScriptLanguage::get_singleton()->get_name()) {
+			paths.insert(ScriptServer::get_global_class_path(E));
+		}
+	}
+
+	for (const String &E : paths) {
+		if (E == p_path || E.get_extension().to_lower() != "gd" || singleton->parser_map.has(E) || singleton->full_gdscript_cache.has(E)) {
+			continue;
+		}
+		if (!FileAccess::exists(ResourceLoader::path_remap(E))) {
+			continue;
+		}
+
+		Ref<GDScriptParserRef> ref;
+		ref.instantiate();
+		ref->path = E;
+		ref->_start_parse_task();
+		singleton->parser_map[E] = ref.ptr();
+		singleton->prefetched_parsers[p_path].push_back(ref);
+	}
+}
+
+void GDScriptCache::detach_parse_task(WorkerThreadPool::TaskID p_task_id) {
+	if (singleton == nullptr || singleton->cleared) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_task_id);
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->detached_parse_tasks.push_back(p_task_id);
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
@@ -326,6 +474,12 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
+	if (GDScriptBytecodeCache::is_enabled() && GDScriptBytecodeCache::prepare(script.ptr())) {
+		// No need to parse, the compiled state is restored when the script is fully loaded.
+		singleton->shallow_gdscript_cache[p_path] = script;
+		return script;
+	}
+
 	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
 	if (r_error == OK) {
 		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
@@ -412,7 +566,7 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	singleton->full_gdscript_cache[p_owner] = script;
 	singleton->shallow_gdscript_cache.erase(p_owner);
 
-	HashSet<String> depends = singleton->dependencies[p_owner];
+	FlatHashSet<String> depends = singleton->dependencies[p_owner];
 
 	Error err = OK;
 	for (const String &E : depends) {
@@ -426,6 +580,8 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	}
 
 	singleton->dependencies.erase(p_owner);
+	// Whatever was actually needed is referenced by the owner's parser by now.
+	singleton->prefetched_parsers.erase(p_owner);
 
 	return err;
 }
@@ -479,6 +635,13 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->prefetched_parsers.clear();
+
+	for (WorkerThreadPool::TaskID task_id : singleton->detached_parse_tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+	singleton->detached_parse_tasks.clear();
+
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
 }
@@ -34,9 +34,12 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
-#include "core/templates/hash_map.h"
-#include "core/templates/hash_set.h"
+#include "core/os/semaphore.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/flat_hash_set.h"
+#include "core/templates/safe_refcount.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -61,6 +64,26 @@ private:
 	bool clearing = false;
 	bool abandoned = false;
 
+	// Parsing started ahead of time on the WorkerThreadPool. Shared with the task, so the ref can be
+	// released before the pool gets to it. Whichever side claims it first does the parsing.
+	struct ParseTask {
+		SafeRefCount refcount;
+		SafeNumeric<uint32_t> claimed;
+		Semaphore done;
+		String path;
+		GDScriptParser *parser = nullptr;
+		Error result = OK;
+		uint32_t source_hash = 0;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+	ParseTask *parse_task = nullptr;
+
+	static Error _parse(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash);
+	static void _parse_task_func(void *p_userdata);
+	void _start_parse_task();
+	void _finish_parse_task(bool p_keep_result);
+
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCache;
 	friend class GDScript;
 
@@ -79,13 +102,16 @@ public:
 
 class GDScriptCache {
 	// String key is full path.
-	HashMap<String, GDScriptParserRef *> parser_map;
-	HashMap<String, Vector<ObjectID>> abandoned_parser_map;
-	HashMap<String, Ref<GDScript>> shallow_gdscript_cache;
-	HashMap<String, Ref<GDScript>> full_gdscript_cache;
-	HashMap<String, Ref<GDScript>> static_gdscript_cache;
-	HashMap<String, HashSet<String>> dependencies;
-	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	FlatHashMap<String, GDScriptParserRef *> parser_map;
+	FlatHashMap<String, Vector<ObjectID>> abandoned_parser_map;
+	FlatHashMap<String, Ref<GDScript>> shallow_gdscript_cache;
+	FlatHashMap<String, Ref<GDScript>> full_gdscript_cache;
+	FlatHashMap<String, Ref<GDScript>> static_gdscript_cache;
+	FlatHashMap<String, FlatHashSet<String>> dependencies;
+	FlatHashMap<String, FlatHashSet<String>> parser_inverse_dependencies;
+	// Parsers started in the background for scripts referenced by the key, kept alive until it's compiled.
+	FlatHashMap<String, Vector<Ref<GDScriptParserRef>>> prefetched_parsers;
+	Vector<WorkerThreadPool::TaskID> detached_parse_tasks;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -97,6 +123,9 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	static void prefetch_dependencies(const String &p_path, const GDScriptParser *p_parser);
+	static void detach_parse_task(WorkerThreadPool::TaskID p_task_id);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -108,13 +108,20 @@ public:
 	virtual void write_end_ternary() = 0;
 	virtual void write_set(const Address &p_target, const Address &p_index, const Address &p_source) = 0;
 	virtual void write_get(const Address &p_target, const Address &p_index, const Address &p_source) = 0;
+	// Writes `p_target[p_index] = p_target[p_index] <op> p_value` as a single instruction if the types allow it.
+	// Returns false without writing anything otherwise.
+	virtual bool write_indexed_operator_in_place(const Address &p_target, const Address &p_index, Variant::Operator p_operator, const Address &p_value) = 0;
 	virtual void write_set_named(const Address &p_target, const StringName &p_name, const Address &p_source) = 0;
 	virtual void write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) = 0;
 	virtual void write_set_member(const Address &p_value, const StringName &p_name) = 0;
 	virtual void write_get_member(const Address &p_target, const StringName &p_name) = 0;
 	virtual void write_set_static_variable(const Address &p_value, const Address &p_class, int p_index) = 0;
 	virtual void write_get_static_variable(const Address &p_target, const Address &p_class, int p_index) = 0;
+	virtual void write_get_node(const Address &p_target, const Address &p_path) = 0;
 	virtual void write_assign(const Address &p_target, const Address &p_source) = 0;
+	// Redirects the operator that just produced the temporary `p_source` to write into `p_target` instead,
+	// so no assignment is needed. Returns false if that's not possible, in which case the caller must assign.
+	virtual bool fold_operator_into_assign(const Address &p_target, const Address &p_source) = 0;
 	virtual void write_assign_with_conversion(const Address &p_target, const Address &p_source) = 0;
 	virtual void write_assign_null(const Address &p_target) = 0;
 	virtual void write_assign_true(const Address &p_target) = 0;
@@ -148,9 +155,10 @@ public:
 	virtual void write_endif() = 0;
 	virtual void write_jump_if_shared(const Address &p_value) = 0;
 	virtual void write_end_jump_if_shared() = 0;
-	virtual void start_for(const GDScriptDataType &p_iterator_type, const GDScriptDataType &p_list_type) = 0;
+	virtual void start_for(const GDScriptDataType &p_iterator_type, const GDScriptDataType &p_list_type, bool p_is_range) = 0;
 	virtual void write_for_assignment(const Address &p_list) = 0;
-	virtual void write_for(const Address &p_variable, bool p_use_conversion) = 0;
+	virtual void write_for_range_assignment(const Address &p_from, const Address &p_to, const Address &p_step) = 0;
+	virtual void write_for(const Address &p_variable, bool p_use_conversion, bool p_is_range) = 0;
 	virtual void write_endfor() = 0;
 	virtual void start_while_condition() = 0; // Used to allow a jump to the expression evaluation.
 	virtual void write_while(const Address &p_condition) = 0;
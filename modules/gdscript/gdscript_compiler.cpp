@@ -741,13 +741,10 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 		case GDScriptParser::Node::GET_NODE: {
 			const GDScriptParser::GetNodeNode *get_node = static_cast<const GDScriptParser::GetNodeNode *>(p_expression);
 
-			Vector<GDScriptCodeGenerator::Address> args;
-			args.push_back(codegen.add_constant(NodePath(get_node->full_path)));
-
+			GDScriptCodeGenerator::Address path = codegen.add_constant(NodePath(get_node->full_path));
 			GDScriptCodeGenerator::Address result = codegen.add_temporary(_gdtype_from_datatype(get_node->get_datatype(), codegen.script));
 
-			MethodBind *get_node_method = ClassDB::get_method("Node", "get_node");
-			gen->write_call_method_bind_validated(result, GDScriptCodeGenerator::Address(GDScriptCodeGenerator::Address::SELF), get_node_method, args);
+			gen->write_get_node(result, path);
 
 			return result;
 		} break;
@@ -1135,7 +1132,14 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 				}
 
 				// Perform operator if any.
-				if (assignment->operation != GDScriptParser::AssignmentNode::OP_NONE) {
+				bool assigned_in_place = false;
+				if (assignment->operation != GDScriptParser::AssignmentNode::OP_NONE && !subscript->is_attribute) {
+					assigned_in_place = gen->write_indexed_operator_in_place(prev_base, key, assignment->variant_op, assigned);
+				}
+
+				if (assigned_in_place) {
+					// Done by the fused instruction.
+				} else if (assignment->operation != GDScriptParser::AssignmentNode::OP_NONE) {
 					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
 					GDScriptCodeGenerator::Address value = codegen.add_temporary(_gdtype_from_datatype(subscript->get_datatype(), codegen.script));
 					if (subscript->is_attribute) {
@@ -1152,7 +1156,9 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 				}
 
 				// Perform assignment.
-				if (subscript->is_attribute) {
+				if (assigned_in_place) {
+					// Already stored.
+				} else if (subscript->is_attribute) {
 					gen->write_set_named(prev_base, name, assigned);
 				} else {
 					gen->write_set(prev_base, key, assigned);
@@ -1369,7 +1375,7 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					// Just assign.
 					if (assignment->use_conversion_assign) {
 						gen->write_assign_with_conversion(target, to_assign);
-					} else {
+					} else if (!gen->fold_operator_into_assign(target, to_assign)) {
 						gen->write_assign(target, to_assign);
 					}
 				}
@@ -2039,20 +2045,64 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
-
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
-				if (err) {
-					return err;
+				// A `range()` call with `int` arguments that wasn't reduced to a constant is iterated directly, without building the array.
+				const GDScriptParser::CallNode *range_call = nullptr;
+				if (!for_n->list->is_constant && for_n->list->type == GDScriptParser::Node::CALL) {
+					const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(for_n->list);
+					if (call->get_callee_type() == GDScriptParser::Node::IDENTIFIER && call->function_name == "range" && !codegen.class_node->has_member(call->function_name) && call->arguments.size() >= 1 && call->arguments.size() <= 3) {
+						range_call = call;
+						for (const GDScriptParser::ExpressionNode *argument : call->arguments) {
+							const GDScriptParser::DataType &argument_type = argument->get_datatype();
+							if (!argument_type.is_hard_type() || argument_type.kind != GDScriptParser::DataType::BUILTIN || argument_type.builtin_type != Variant::INT) {
+								range_call = nullptr;
+								break;
+							}
+						}
+					}
 				}
 
-				gen->write_for_assignment(list);
+				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script), range_call != nullptr);
 
-				if (list.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					codegen.generator->pop_temporary();
+				if (range_call) {
+					GDScriptCodeGenerator::Address range_args[3];
+					for (int i = 0; i < range_call->arguments.size(); i++) {
+						range_args[i] = _parse_expression(codegen, err, range_call->arguments[i]);
+						if (err) {
+							return err;
+						}
+					}
+
+					switch (range_call->arguments.size()) {
+						case 1:
+							gen->write_for_range_assignment(codegen.add_constant(0), range_args[0], codegen.add_constant(1));
+							break;
+						case 2:
+							gen->write_for_range_assignment(range_args[0], range_args[1], codegen.add_constant(1));
+							break;
+						default:
+							gen->write_for_range_assignment(range_args[0], range_args[1], range_args[2]);
+							break;
+					}
+
+					for (int i = range_call->arguments.size() - 1; i >= 0; i--) {
+						if (range_args[i].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+							codegen.generator->pop_temporary();
+						}
+					}
+				} else {
+					GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
+					if (err) {
+						return err;
+					}
+
+					gen->write_for_assignment(list);
+
+					if (list.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+						codegen.generator->pop_temporary();
+					}
 				}
 
-				gen->write_for(iterator, for_n->use_conversion_assign);
+				gen->write_for(iterator, for_n->use_conversion_assign, range_call != nullptr);
 
 				// Loop variables must be cleared even when `break`/`continue` is used.
 				List<GDScriptCodeGenerator::Address> loop_locals = _add_block_locals(codegen, for_n->loop);
@@ -2636,6 +2686,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 	parsing_classes.insert(p_script);
 
 	p_script->clearing = true;
+	GDScript::layout_version.increment();
 
 	p_script->native = Ref<GDScriptNativeClass>();
 	p_script->base = Ref<GDScript>();
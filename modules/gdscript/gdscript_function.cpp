@@ -114,6 +114,28 @@ GDScriptFunction::GDScriptFunction() {
 #endif
 }
 
+Vector<uint8_t> GDScriptFunction::_acquire_await_frame(uint32_t p_size) {
+	Vector<uint8_t> frame;
+	{
+		MutexLock lock(await_frames_mutex);
+		if (!await_frames.is_empty()) {
+			frame = await_frames[await_frames.size() - 1];
+			await_frames.remove_at(await_frames.size() - 1);
+		}
+	}
+	// Every frame of a function has the same size, this only allocates the first time.
+	frame.resize(p_size);
+	return frame;
+}
+
+void GDScriptFunction::_release_await_frame(Vector<uint8_t> &p_frame) {
+	MutexLock lock(await_frames_mutex);
+	if (await_frames.size() < MAX_POOLED_AWAIT_FRAMES && !p_frame.is_empty()) {
+		await_frames.push_back(p_frame);
+	}
+	p_frame.clear();
+}
+
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
 
@@ -213,6 +235,7 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 
 	state.result = p_arg;
 	Callable::CallError err;
+	GDScriptFunction *resumed_function = function;
 	Variant ret = function->call(nullptr, nullptr, 0, err, &state);
 
 	bool completed = true;
@@ -244,6 +267,10 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 
 		_clear_stack();
 #endif
+
+		// The variants were freed on exit (or just above), only the storage is left to reuse.
+		state.stack_size = 0;
+		resumed_function->_release_await_frame(state.stack);
 	}
 
 	return ret;
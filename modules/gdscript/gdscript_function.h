@@ -35,8 +35,10 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -225,9 +227,12 @@ public:
 		OPCODE_SET_KEYED,
 		OPCODE_SET_KEYED_VALIDATED,
 		OPCODE_SET_INDEXED_VALIDATED,
+		OPCODE_SET_INDEXED_PACKED,
+		OPCODE_OPERATOR_INDEXED_PACKED,
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_PACKED,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -236,6 +241,7 @@ public:
 		OPCODE_GET_MEMBER,
 		OPCODE_SET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_GET_STATIC_VARIABLE, // Only for GDScript.
+		OPCODE_GET_NODE,
 		OPCODE_ASSIGN,
 		OPCODE_ASSIGN_NULL,
 		OPCODE_ASSIGN_TRUE,
@@ -303,6 +309,7 @@ public:
 		OPCODE_ITERATE_BEGIN_PACKED_COLOR_ARRAY,
 		OPCODE_ITERATE_BEGIN_PACKED_VECTOR4_ARRAY,
 		OPCODE_ITERATE_BEGIN_OBJECT,
+		OPCODE_ITERATE_BEGIN_RANGE,
 		OPCODE_ITERATE,
 		OPCODE_ITERATE_INT,
 		OPCODE_ITERATE_FLOAT,
@@ -324,6 +331,7 @@ public:
 		OPCODE_ITERATE_PACKED_COLOR_ARRAY,
 		OPCODE_ITERATE_PACKED_VECTOR4_ARRAY,
 		OPCODE_ITERATE_OBJECT,
+		OPCODE_ITERATE_RANGE,
 		OPCODE_STORE_GLOBAL,
 		OPCODE_STORE_NAMED_GLOBAL,
 		OPCODE_TYPE_ADJUST_BOOL,
@@ -399,8 +407,10 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
+	friend class GDScriptFunctionState;
 	friend class GDScriptLanguage;
 
 	StringName name;
@@ -440,6 +450,37 @@ private:
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
 
+	// Last node found by each `$` expression of the function, reused until the scene tree changes.
+	struct GetNodeCache {
+		ObjectID self;
+		Object *node = nullptr;
+		uint64_t tree_version = 0;
+	};
+	Vector<GetNodeCache> get_node_caches;
+
+	// Resolved target of an untyped `obj.name` or `obj.method()` site, keyed on the native class and script of the receiver.
+	struct InlineCacheEntry {
+		const StringName *native_class = nullptr;
+		const GDScript *script = nullptr;
+		uint64_t layout_version = 0;
+		MethodBind *method = nullptr;
+		GDScriptFunction *function = nullptr;
+		const ClassDB::PropertySetGet *setget = nullptr;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+	};
+	static constexpr int INLINE_CACHE_ENTRIES = 4;
+	struct InlineCache {
+		InlineCacheEntry entries[INLINE_CACHE_ENTRIES];
+		uint32_t next_entry = 0;
+	};
+	Vector<InlineCache> inline_caches;
+
+	// Stack frames of finished coroutines, reused by the next `await` instead of allocating a new one.
+	static constexpr uint32_t MAX_POOLED_AWAIT_FRAMES = 256;
+	BinaryMutex await_frames_mutex;
+	LocalVector<Vector<uint8_t>> await_frames;
+
 	int _code_size = 0;
 	int _default_arg_count = 0;
 	int _constant_count = 0;
@@ -457,6 +498,8 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _get_node_caches_count = 0;
+	int _inline_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -475,6 +518,8 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	GetNodeCache *_get_node_caches_ptr = nullptr;
+	InlineCache *_inline_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -512,6 +557,14 @@ private:
 	_FORCE_INLINE_ String _get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	Vector<uint8_t> _acquire_await_frame(uint32_t p_size);
+	void _release_await_frame(Vector<uint8_t> &p_frame);
+
+	InlineCacheEntry *_get_inline_cache_entry(int p_cache, const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance, bool &r_resolve);
+	bool _inline_cache_call(int p_cache, const Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	bool _inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	bool _inline_cache_set(int p_cache, const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
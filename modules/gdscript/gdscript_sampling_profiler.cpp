@@ -0,0 +1,148 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript.h"
+
+#include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/debugger/timeline_profiler.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+void GDScriptSamplingProfiler::_thread_func(void *p_self) {
+	GDScriptSamplingProfiler *self = static_cast<GDScriptSamplingProfiler *>(p_self);
+	while (!self->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(self->interval_usec);
+		self->_take_sample();
+	}
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+
+	// Functions unregister themselves under the language mutex, so the ones found on a stack stay alive meanwhile.
+	// The stacks themselves keep changing while being read, a sample may mix two consecutive states of a thread.
+	MutexLock lock(language->mutex);
+	MutexLock stacks_lock(GDScriptLanguage::call_stacks_mutex);
+
+	for (const GDScriptLanguage::CallStack *call_stack : GDScriptLanguage::call_stacks) {
+		int depth = MIN(call_stack->stack_pos, language->_debug_max_call_stack);
+		if (depth <= 0) {
+			continue;
+		}
+
+		String stack = call_stack->thread_id == Thread::get_main_id() ? String("Main thread") : "Thread " + itos(call_stack->thread_id);
+
+		if (include_native) {
+			// Engine zones usually wrap script callbacks, so they go above the script frames.
+			const char *zones[MAX_NATIVE_FRAMES];
+			int zone_count = TimelineProfiler::get_open_zones(call_stack->thread_id, zones, MAX_NATIVE_FRAMES);
+			for (int i = 0; i < zone_count; i++) {
+				stack += ";" + String(zones[i]);
+			}
+		}
+
+		for (int i = 0; i < depth; i++) {
+			const GDScriptLanguage::CallLevel &level = call_stack->levels[i];
+			if (!level.function) {
+				continue;
+			}
+			int line = level.line ? *level.line : 0;
+			stack += vformat(";%s (%s:%d)", level.function->get_name(), level.function->get_source(), line);
+		}
+
+		stacks[stack]++;
+		sample_count++;
+	}
+}
+
+void GDScriptSamplingProfiler::_stop() {
+	exit_thread.set();
+	thread.wait_to_finish();
+
+	if (include_native) {
+		TimelineProfiler::track_open_zones(false);
+	}
+}
+
+Error GDScriptSamplingProfiler::_save() const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Can't save GDScript samples to file: '%s'.", path));
+
+	for (const KeyValue<String, uint64_t> &E : stacks) {
+		f->store_line(vformat("%s %d", E.key, E.value));
+	}
+
+	return OK;
+}
+
+void GDScriptSamplingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		if (thread.is_started()) {
+			return;
+		}
+
+		path = p_opts.size() > 0 ? String(p_opts[0]) : String("user://gdscript_samples.folded");
+		interval_usec = p_opts.size() > 1 ? MAX(int64_t(p_opts[1]), 100) : 1000;
+		include_native = p_opts.size() > 2 && bool(p_opts[2]);
+
+		stacks.clear();
+		sample_count = 0;
+
+		if (include_native) {
+			TimelineProfiler::track_open_zones(true);
+		}
+
+		exit_thread.clear();
+		thread.start(&GDScriptSamplingProfiler::_thread_func, this);
+	} else if (thread.is_started()) {
+		_stop();
+
+		if (_save() == OK) {
+			Array arr;
+			arr.push_back(ProjectSettings::get_singleton()->globalize_path(path));
+			arr.push_back(sample_count);
+			EngineDebugger::get_singleton()->send_message("gdscript_sampler:saved", arr);
+		}
+	}
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	if (thread.is_started()) {
+		_stop();
+	}
+}
+
+#endif // DEBUG_ENABLED
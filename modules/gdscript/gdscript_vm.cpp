@@ -33,6 +33,8 @@
 #include "gdscript_lambda_callable.h"
 
 #include "core/os/os.h"
+#include "scene/main/node.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -109,6 +111,102 @@ void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_
 
 #endif // DEBUG_ENABLED
 
+// Applies `p_array[p_index] = p_array[p_index] <op> p_value` in place. Arithmetic happens in `W` (int64_t or double),
+// the same precision the unfused get, operator and set sequence would use. Returns false if the index is out of bounds.
+template <typename T, typename W>
+static _FORCE_INLINE_ bool _packed_indexed_operator(Vector<T> &p_array, int64_t p_index, Variant::Operator p_operator, W p_value) {
+	const int64_t size = p_array.size();
+	if (p_index < 0) {
+		p_index += size;
+	}
+	if (p_index < 0 || p_index >= size) {
+		return false;
+	}
+
+	T *element = p_array.ptrw() + p_index;
+	const W current = W(*element);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			*element = T(current + p_value);
+			break;
+		case Variant::OP_SUBTRACT:
+			*element = T(current - p_value);
+			break;
+		case Variant::OP_MULTIPLY:
+			*element = T(current * p_value);
+			break;
+		case Variant::OP_DIVIDE:
+			*element = T(current / p_value); // Only emitted for float arrays.
+			break;
+		default:
+			break;
+	}
+	return true;
+}
+
+// Element access on packed arrays whose type the analyzer proved, reading and writing the raw element
+// instead of going through the validated indexed accessors. `R` is the Variant storage type of the element.
+// Return false if the index is out of bounds.
+template <typename T, typename R>
+static _FORCE_INLINE_ bool _packed_indexed_get(const Vector<T> &p_array, int64_t p_index, Variant *r_ret) {
+	const int64_t size = p_array.size();
+	if (p_index < 0) {
+		p_index += size;
+	}
+	if (p_index < 0 || p_index >= size) {
+		return false;
+	}
+	VariantTypeAdjust<R>::adjust(r_ret);
+	*VariantGetInternalPtr<R>::get_ptr(r_ret) = R(p_array.ptr()[p_index]);
+	return true;
+}
+
+template <typename T, typename R>
+static _FORCE_INLINE_ bool _packed_indexed_set(Vector<T> &p_array, int64_t p_index, const Variant *p_value) {
+	const int64_t size = p_array.size();
+	if (p_index < 0) {
+		p_index += size;
+	}
+	if (p_index < 0 || p_index >= size) {
+		return false;
+	}
+	p_array.ptrw()[p_index] = T(*VariantGetInternalPtr<R>::get_ptr(p_value));
+	return true;
+}
+
+#define PACKED_INDEXED_ACCESS_CASES(m_func, m_array, m_index, m_value, r_in_bounds, r_valid_base)                   \
+	switch ((m_array)->get_type()) {                                                                                \
+		case Variant::PACKED_BYTE_ARRAY:                                                                            \
+			r_in_bounds = m_func<uint8_t, int64_t>(*VariantInternal::get_byte_array(m_array), m_index, m_value);    \
+			break;                                                                                                  \
+		case Variant::PACKED_INT32_ARRAY:                                                                           \
+			r_in_bounds = m_func<int32_t, int64_t>(*VariantInternal::get_int32_array(m_array), m_index, m_value);   \
+			break;                                                                                                  \
+		case Variant::PACKED_INT64_ARRAY:                                                                           \
+			r_in_bounds = m_func<int64_t, int64_t>(*VariantInternal::get_int64_array(m_array), m_index, m_value);   \
+			break;                                                                                                  \
+		case Variant::PACKED_FLOAT32_ARRAY:                                                                         \
+			r_in_bounds = m_func<float, double>(*VariantInternal::get_float32_array(m_array), m_index, m_value);    \
+			break;                                                                                                  \
+		case Variant::PACKED_FLOAT64_ARRAY:                                                                         \
+			r_in_bounds = m_func<double, double>(*VariantInternal::get_float64_array(m_array), m_index, m_value);   \
+			break;                                                                                                  \
+		case Variant::PACKED_VECTOR2_ARRAY:                                                                         \
+			r_in_bounds = m_func<Vector2, Vector2>(*VariantInternal::get_vector2_array(m_array), m_index, m_value); \
+			break;                                                                                                  \
+		case Variant::PACKED_VECTOR3_ARRAY:                                                                         \
+			r_in_bounds = m_func<Vector3, Vector3>(*VariantInternal::get_vector3_array(m_array), m_index, m_value); \
+			break;                                                                                                  \
+		case Variant::PACKED_VECTOR4_ARRAY:                                                                         \
+			r_in_bounds = m_func<Vector4, Vector4>(*VariantInternal::get_vector4_array(m_array), m_index, m_value); \
+			break;                                                                                                  \
+		case Variant::PACKED_COLOR_ARRAY:                                                                           \
+			r_in_bounds = m_func<Color, Color>(*VariantInternal::get_color_array(m_array), m_index, m_value);       \
+			break;                                                                                                  \
+		default:                                                                                                    \
+			r_valid_base = false;                                                                                   \
+	}
+
 Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataType &p_data_type) {
 	if (p_data_type.kind == GDScriptDataType::BUILTIN) {
 		if (p_data_type.builtin_type == Variant::ARRAY) {
@@ -134,6 +232,164 @@ Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataT
 	return Variant();
 }
 
+// Inline caches are only used from the main thread, like the `$` caches, so they need no synchronization.
+// An entry without target remembers that the generic path has to be taken for that receiver.
+GDScriptFunction::InlineCacheEntry *GDScriptFunction::_get_inline_cache_entry(int p_cache, const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance, bool &r_resolve) {
+	r_resolve = false;
+	if (p_cache < 0 || p_cache >= _inline_caches_count || p_base->get_type() != Variant::OBJECT || !Thread::is_main_thread()) {
+		return nullptr;
+	}
+
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return nullptr;
+	}
+
+	GDScriptInstance *instance = nullptr;
+	ScriptInstance *script_instance = obj->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return nullptr;
+		}
+		instance = static_cast<GDScriptInstance *>(script_instance);
+	}
+
+	const StringName *native_class = &obj->get_class_name();
+	const GDScript *script = instance ? instance->script.ptr() : nullptr;
+	uint64_t layout_version = instance ? GDScript::layout_version.get() : 0;
+
+	r_object = obj;
+	r_instance = instance;
+
+	InlineCache &cache = _inline_caches_ptr[p_cache];
+	for (InlineCacheEntry &entry : cache.entries) {
+		if (entry.native_class == native_class && entry.script == script && entry.layout_version == layout_version) {
+			return &entry;
+		}
+	}
+
+	// Round-robin replacement, sites seeing more receiver types than entries keep working but miss more often.
+	InlineCacheEntry &entry = cache.entries[cache.next_entry];
+	cache.next_entry = (cache.next_entry + 1) % INLINE_CACHE_ENTRIES;
+	entry = InlineCacheEntry();
+	entry.native_class = native_class;
+	entry.script = script;
+	entry.layout_version = layout_version;
+
+	// Extension classes may override get/set and can be unloaded, so they always take the generic path.
+	ClassDB::APIType api = ClassDB::get_api_type(*native_class);
+	r_resolve = api != ClassDB::API_EXTENSION && api != ClassDB::API_EDITOR_EXTENSION;
+	return &entry;
+}
+
+bool GDScriptFunction::_inline_cache_call(int p_cache, const Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	Object *obj = nullptr;
+	GDScriptInstance *instance = nullptr;
+	bool resolve = false;
+	InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, p_base, obj, instance, resolve);
+	if (!entry) {
+		return false;
+	}
+
+	// `_ready` also runs the implicit ready functions, leave it to the script instance.
+	if (resolve && !(instance && p_method == SceneStringName(_ready))) {
+		for (GDScript *sptr = instance ? instance->script.ptr() : nullptr; sptr && !entry->function; sptr = sptr->_base) {
+			if (likely(sptr->valid)) {
+				HashMap<StringName, GDScriptFunction *>::Iterator E = sptr->member_functions.find(p_method);
+				if (E) {
+					entry->function = E->value;
+				}
+			}
+		}
+		if (!entry->function) {
+			entry->method = ClassDB::get_method(obj->get_class_name(), p_method);
+		}
+	}
+
+	if (entry->function) {
+		r_err.error = Callable::CallError::CALL_OK;
+		r_ret = entry->function->call(instance, p_args, p_argcount, r_err);
+	} else if (entry->method) {
+		r_err.error = Callable::CallError::CALL_OK;
+		r_ret = entry->method->call(obj, p_args, p_argcount, r_err);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	Object *obj = nullptr;
+	GDScriptInstance *instance = nullptr;
+	bool resolve = false;
+	InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, p_base, obj, instance, resolve);
+	if (!entry) {
+		return false;
+	}
+
+	if (resolve) {
+		if (instance) {
+			// Only plain members, anything else may end up in a getter or a script `_get()`.
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = instance->script->member_indices.find(p_name);
+			if (E && !(E->value.getter && instance->script->valid)) {
+				entry->member_index = E->value.index;
+			}
+		} else {
+			entry->setget = ClassDB::get_property_getter_setget(obj->get_class_name(), p_name);
+		}
+	}
+
+	if (entry->member_index >= 0) {
+		r_ret = instance->members[entry->member_index];
+	} else if (entry->setget) {
+		ClassDB::get_property_with_setget(obj, entry->setget, r_ret);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_set(int p_cache, const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+	Object *obj = nullptr;
+	GDScriptInstance *instance = nullptr;
+	bool resolve = false;
+	InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, p_base, obj, instance, resolve);
+	if (!entry) {
+		return false;
+	}
+
+	if (resolve) {
+		if (instance) {
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = instance->script->member_indices.find(p_name);
+			if (E && !(E->value.setter && instance->script->valid)) {
+				entry->member_index = E->value.index;
+				entry->member_type = &E->value.data_type;
+			}
+		} else {
+			entry->setget = ClassDB::get_property_setget(obj->get_class_name(), p_name);
+		}
+	}
+
+#ifdef TOOLS_ENABLED
+	if (!obj->is_edited()) {
+		return false; // Let the generic path flag the object as edited.
+	}
+#endif
+
+	if (entry->member_index >= 0) {
+		if (entry->member_type->has_type && !entry->member_type->is_type(p_value)) {
+			return false; // Needs a conversion, done by the generic path.
+		}
+		instance->members.write[entry->member_index] = p_value;
+		r_valid = true;
+	} else if (entry->setget) {
+		ClassDB::set_property_with_setget(obj, entry->setget, p_value, &r_valid);
+	} else {
+		return false;
+	}
+	return true;
+}
+
 String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const {
 	String err_text;
 
@@ -222,9 +478,12 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_SET_KEYED,                              \
 		&&OPCODE_SET_KEYED_VALIDATED,                    \
 		&&OPCODE_SET_INDEXED_VALIDATED,                  \
+		&&OPCODE_SET_INDEXED_PACKED,                     \
+		&&OPCODE_OPERATOR_INDEXED_PACKED,                \
 		&&OPCODE_GET_KEYED,                              \
 		&&OPCODE_GET_KEYED_VALIDATED,                    \
 		&&OPCODE_GET_INDEXED_VALIDATED,                  \
+		&&OPCODE_GET_INDEXED_PACKED,                     \
 		&&OPCODE_SET_NAMED,                              \
 		&&OPCODE_SET_NAMED_VALIDATED,                    \
 		&&OPCODE_GET_NAMED,                              \
@@ -233,6 +492,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_GET_MEMBER,                             \
 		&&OPCODE_SET_STATIC_VARIABLE,                    \
 		&&OPCODE_GET_STATIC_VARIABLE,                    \
+		&&OPCODE_GET_NODE,                               \
 		&&OPCODE_ASSIGN,                                 \
 		&&OPCODE_ASSIGN_NULL,                            \
 		&&OPCODE_ASSIGN_TRUE,                            \
@@ -300,6 +560,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_BEGIN_PACKED_COLOR_ARRAY,       \
 		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR4_ARRAY,     \
 		&&OPCODE_ITERATE_BEGIN_OBJECT,                   \
+		&&OPCODE_ITERATE_BEGIN_RANGE,                    \
 		&&OPCODE_ITERATE,                                \
 		&&OPCODE_ITERATE_INT,                            \
 		&&OPCODE_ITERATE_FLOAT,                          \
@@ -321,6 +582,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_PACKED_COLOR_ARRAY,             \
 		&&OPCODE_ITERATE_PACKED_VECTOR4_ARRAY,           \
 		&&OPCODE_ITERATE_OBJECT,                         \
+		&&OPCODE_ITERATE_RANGE,                          \
 		&&OPCODE_STORE_GLOBAL,                           \
 		&&OPCODE_STORE_NAMED_GLOBAL,                     \
 		&&OPCODE_TYPE_ADJUST_BOOL,                       \
@@ -454,6 +716,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	r_err.error = Callable::CallError::CALL_OK;
 
+	MemoryTagScope tag_scope(Memory::TAG_SCRIPT);
+
 	static thread_local int call_depth = 0;
 	if (unlikely(++call_depth > MAX_CALL_DEPTH)) {
 		call_depth--;
@@ -493,6 +757,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 	uint32_t alloca_size = 0;
+	bool frame_handed_over = false;
 	GDScript *script;
 	int ip = 0;
 	int line = _initial_line;
@@ -1001,6 +1266,92 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_SET_INDEXED_PACKED) {
+				CHECK_SPACE(3);
+
+				GET_VARIANT_PTR(dst, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(value, 2);
+
+				int64_t int_index = *VariantInternal::get_int(index);
+
+				bool valid_base = true;
+				bool in_bounds = false;
+				PACKED_INDEXED_ACCESS_CASES(_packed_indexed_set, dst, int_index, value, in_bounds, valid_base);
+
+				if (unlikely(!valid_base)) {
+#ifdef DEBUG_ENABLED
+					err_text = "Invalid base type '" + _get_var_type(dst) + "' for packed indexed set.";
+#endif
+					OPCODE_BREAK;
+				}
+
+#ifdef DEBUG_ENABLED
+				if (!in_bounds) {
+					err_text = "Out of bounds set index '" + itos(int_index) + "' (on base: '" + _get_var_type(dst) + "')";
+					OPCODE_BREAK;
+				}
+#else
+				(void)in_bounds;
+#endif
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INDEXED_PACKED) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(dst, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(value, 2);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op < 0 || op >= Variant::OP_MAX);
+
+				int64_t int_index = *VariantInternal::get_int(index);
+				bool value_is_int = value->get_type() == Variant::INT;
+
+				bool valid_base = true;
+				bool in_bounds = false;
+				switch (dst->get_type()) {
+					case Variant::PACKED_INT32_ARRAY: {
+						in_bounds = _packed_indexed_operator(*VariantInternal::get_int32_array(dst), int_index, op, *VariantInternal::get_int(value));
+					} break;
+					case Variant::PACKED_INT64_ARRAY: {
+						in_bounds = _packed_indexed_operator(*VariantInternal::get_int64_array(dst), int_index, op, *VariantInternal::get_int(value));
+					} break;
+					case Variant::PACKED_FLOAT32_ARRAY: {
+						double operand = value_is_int ? double(*VariantInternal::get_int(value)) : *VariantInternal::get_float(value);
+						in_bounds = _packed_indexed_operator(*VariantInternal::get_float32_array(dst), int_index, op, operand);
+					} break;
+					case Variant::PACKED_FLOAT64_ARRAY: {
+						double operand = value_is_int ? double(*VariantInternal::get_int(value)) : *VariantInternal::get_float(value);
+						in_bounds = _packed_indexed_operator(*VariantInternal::get_float64_array(dst), int_index, op, operand);
+					} break;
+					default: {
+						valid_base = false;
+					}
+				}
+
+				if (unlikely(!valid_base)) {
+#ifdef DEBUG_ENABLED
+					err_text = "Invalid base type '" + _get_var_type(dst) + "' for fused indexed operator.";
+#endif
+					OPCODE_BREAK;
+				}
+
+#ifdef DEBUG_ENABLED
+				if (!in_bounds) {
+					err_text = "Out of bounds get index '" + itos(int_index) + "' (on base: '" + _get_var_type(dst) + "')";
+					OPCODE_BREAK;
+				}
+#else
+				(void)in_bounds;
+#endif
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_GET_KEYED) {
 				CHECK_SPACE(3);
 
@@ -1105,9 +1456,41 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
-			OPCODE(OPCODE_SET_NAMED) {
+			OPCODE(OPCODE_GET_INDEXED_PACKED) {
 				CHECK_SPACE(3);
 
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				int64_t int_index = *VariantInternal::get_int(index);
+
+				bool valid_base = true;
+				bool in_bounds = false;
+				PACKED_INDEXED_ACCESS_CASES(_packed_indexed_get, src, int_index, dst, in_bounds, valid_base);
+
+				if (unlikely(!valid_base)) {
+#ifdef DEBUG_ENABLED
+					err_text = "Invalid base type '" + _get_var_type(src) + "' for packed indexed get.";
+#endif
+					OPCODE_BREAK;
+				}
+
+#ifdef DEBUG_ENABLED
+				if (!in_bounds) {
+					err_text = "Out of bounds get index '" + itos(int_index) + "' (on base: '" + _get_var_type(src) + "')";
+					OPCODE_BREAK;
+				}
+#else
+				(void)in_bounds;
+#endif
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_SET_NAMED) {
+				CHECK_SPACE(4);
+
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
 
@@ -1117,7 +1500,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				const StringName *index = &_global_names_ptr[indexname];
 
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				if (!_inline_cache_set(_code_ptr[ip + 4], dst, *index, *value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1138,7 +1523,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1158,7 +1543,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1168,22 +1553,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
-
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				// Read into a temporary, src and dst may be the same stack position.
+				bool valid = true;
+				Variant ret;
+				if (!_inline_cache_get(_code_ptr[ip + 4], src, *index, ret)) {
+					ret = src->get_named(*index, valid);
+				}
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1281,6 +1664,38 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_NODE) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(target, 0);
+				GET_VARIANT_PTR(path, 1);
+
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _get_node_caches_count);
+
+				GD_ERR_BREAK(!p_instance);
+				Node *self_node = Object::cast_to<Node>(p_instance->owner);
+				GD_ERR_BREAK(!self_node);
+
+				// Nodes processed in thread groups may run the same function concurrently, only the main thread uses the cache.
+				GetNodeCache &cache = _get_node_caches_ptr[cache_index];
+				uint64_t tree_version = Node::get_tree_version();
+				if (Thread::is_main_thread() && cache.tree_version == tree_version && cache.self == self_node->get_instance_id()) {
+					*target = cache.node;
+				} else {
+					Node *node = self_node->get_node(*path);
+					if (node && Thread::is_main_thread()) {
+						cache.self = self_node->get_instance_id();
+						cache.node = node;
+						cache.tree_version = tree_version;
+					}
+					*target = node;
+				}
+
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_ASSIGN) {
 				CHECK_SPACE(3);
 				GET_VARIANT_PTR(dst, 0);
@@ -1719,7 +2134,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1732,6 +2147,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
+				int cache_index = _code_ptr[ip + 3];
 
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
@@ -1747,7 +2163,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (!_inline_cache_call(cache_index, base, *methodname, (const Variant **)argptrs, argc, *ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1777,7 +2195,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					if (!_inline_cache_call(cache_index, base, *methodname, (const Variant **)argptrs, argc, ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1827,7 +2247,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2391,11 +2811,25 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					if (p_state) {
+						// Resumed from a previous `await`, so the frame already lives in its state. Hand it over
+						// instead of copying, and don't free its variants on exit.
+						gdfs->state.stack = p_state->stack;
+						p_state->stack = Vector<uint8_t>();
+						p_state->stack_size = 0;
+						frame_handed_over = true;
+					} else {
+						// Variants are relocatable (LocalVector and CowData move them the same way), so move them
+						// out of the native stack rather than copying. First 3 stack addresses are special, so we
+						// just skip them here.
+						gdfs->state.stack = _acquire_await_frame(alloca_size);
+						uint8_t *frame = gdfs->state.stack.ptrw();
+						if (_stack_size > 3) {
+							memcpy(&frame[sizeof(Variant) * 3], (void *)&stack[3], sizeof(Variant) * (_stack_size - 3));
+						}
+						for (int i = 3; i < _stack_size; i++) {
+							memnew_placement(&stack[i], Variant);
+						}
 					}
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
@@ -3138,6 +3572,42 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_ITERATE_BEGIN_RANGE) {
+				CHECK_SPACE(12); // Check space for iterate instruction too.
+
+				GET_VARIANT_PTR(counter, 0);
+				GET_VARIANT_PTR(from_ptr, 1);
+				GET_VARIANT_PTR(to_ptr, 2);
+				GET_VARIANT_PTR(step_ptr, 3);
+
+				int64_t from = *VariantInternal::get_int(from_ptr);
+				int64_t to = *VariantInternal::get_int(to_ptr);
+				int64_t step = *VariantInternal::get_int(step_ptr);
+
+				if (unlikely(step == 0)) {
+					err_text = "Step argument is zero!";
+					OPCODE_BREAK;
+				}
+
+				VariantInternal::initialize(counter, Variant::INT);
+				*VariantInternal::get_int(counter) = from;
+
+				if (step > 0 ? from < to : from > to) {
+					GET_VARIANT_PTR(iterator, 4);
+					VariantInternal::initialize(iterator, Variant::INT);
+					*VariantInternal::get_int(iterator) = from;
+
+					// Skip regular iterate.
+					ip += 7;
+				} else {
+					// Jump to end of loop.
+					int jumpto = _code_ptr[ip + 6];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_ITERATE) {
 				CHECK_SPACE(4);
 
@@ -3472,6 +3942,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_ITERATE_RANGE) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(counter, 0);
+				GET_VARIANT_PTR(to_ptr, 1);
+				GET_VARIANT_PTR(step_ptr, 2);
+
+				int64_t to = *VariantInternal::get_int(to_ptr);
+				int64_t step = *VariantInternal::get_int(step_ptr);
+				int64_t *count = VariantInternal::get_int(counter);
+
+				*count += step;
+
+				if (step > 0 ? *count >= to : *count <= to) {
+					int jumpto = _code_ptr[ip + 5];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				} else {
+					GET_VARIANT_PTR(iterator, 3);
+					*VariantInternal::get_int(iterator) = *count;
+
+					ip += 6; // Loop again.
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_STORE_GLOBAL) {
 				CHECK_SPACE(3);
 				int global_idx = _code_ptr[ip + 2];
@@ -3693,9 +4189,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses, unless an `await` took it over.
+		if (!frame_handed_over) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
@@ -32,7 +32,9 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
@@ -74,6 +76,9 @@ GDScriptLanguage *script_language_gd = nullptr;
 Ref<ResourceFormatLoaderGDScript> resource_loader_gd;
 Ref<ResourceFormatSaverGDScript> resource_saver_gd;
 GDScriptCache *gdscript_cache = nullptr;
+#ifdef DEBUG_ENABLED
+Ref<GDScriptSamplingProfiler> gdscript_sampling_profiler;
+#endif
 
 #ifdef TOOLS_ENABLED
 
@@ -116,6 +121,20 @@ protected:
 		add_file(p_path.get_basename() + ".gdc", file, true);
 	}
 
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::BOOL, "gdscript/bytecode_cache"), false));
+	}
+
+	virtual PackedStringArray _get_export_features(const Ref<EditorExportPlatform> &p_export_platform, bool p_debug) const override {
+		PackedStringArray features;
+		// Exported projects compile their scripts once and keep the bytecode in `user://` (see `GDScriptBytecodeCache`).
+		const Ref<EditorExportPreset> &preset = get_export_preset();
+		if (preset.is_valid() && bool(preset->get("gdscript/bytecode_cache"))) {
+			features.push_back("gdscript_bytecode_cache");
+		}
+		return features;
+	}
+
 public:
 	virtual String get_name() const override { return "GDScript"; }
 };
@@ -157,6 +176,11 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		gdscript_cache = memnew(GDScriptCache);
 
 		GDScriptUtilityFunctions::register_functions();
+
+#ifdef DEBUG_ENABLED
+		gdscript_sampling_profiler.instantiate();
+		gdscript_sampling_profiler->bind("gdscript_sampler");
+#endif
 	}
 
 #ifdef TOOLS_ENABLED
@@ -171,6 +195,11 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
+#ifdef DEBUG_ENABLED
+		// Stops sampling before the language goes away.
+		gdscript_sampling_profiler.unref();
+#endif
+
 		ScriptServer::unregister_language(script_language_gd);
 
 		if (gdscript_cache) {
@@ -188,6 +217,7 @@ void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 		resource_saver_gd.unref();
 
 		GDScriptParser::cleanup();
+		GDScriptBytecodeCache::cleanup();
 		GDScriptUtilityFunctions::unregister_functions();
 	}
 
@@ -0,0 +1,20 @@
+signal tick(value)
+
+var results := []
+
+func worker(id: int):
+	var label := "worker %d" % id
+	var total := id
+	for _i in 3:
+		var value = await tick
+		total += value
+	results.append("%s: %d" % [label, total])
+
+func test():
+	for _pass in 2:
+		results.clear()
+		for id in 4:
+			worker(id)
+		for value in [1, 10, 100]:
+			tick.emit(value)
+		print(results)
@@ -0,0 +1,39 @@
+func test():
+	var bytes := PackedByteArray([1, 2, 3])
+	bytes[0] = 300 # Wraps like a regular byte array store.
+	bytes[-1] = 9
+	print(bytes)
+	var first: int = bytes[0]
+	print(first)
+
+	var ints := PackedInt32Array([4, 5, 6])
+	var int_total: int = 0
+	for i in range(ints.size()):
+		int_total += ints[i]
+	print(int_total)
+	print(ints[-1])
+
+	var floats := PackedFloat32Array([0.5, 1.5])
+	floats[1] = 2.25
+	var f: float = floats[1]
+	print(f)
+
+	var doubles := PackedFloat64Array([1.0, 2.0])
+	doubles[0] = doubles[1] * 3.0
+	print(doubles)
+
+	var vectors := PackedVector2Array([Vector2(1, 2), Vector2(3, 4)])
+	vectors[0] = vectors[1] + Vector2(1, 1)
+	print(vectors[0])
+
+	var vectors3 := PackedVector3Array([Vector3.ZERO])
+	vectors3[0] = Vector3(1, 2, 3)
+	print(vectors3)
+
+	var vectors4 := PackedVector4Array([Vector4.ZERO])
+	vectors4[-1] = Vector4(1, 2, 3, 4)
+	print(vectors4[0])
+
+	var colors := PackedColorArray([Color.RED])
+	colors[0] = Color.BLUE
+	print(colors[0])
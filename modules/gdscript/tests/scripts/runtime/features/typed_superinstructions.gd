@@ -0,0 +1,63 @@
+func range_sum(from: int, to: int, step: int) -> int:
+	var total: int = 0
+	for i in range(from, to, step):
+		total += i
+	return total
+
+
+func test():
+	var n: int = 5
+	var out := []
+	for i in range(n):
+		out.append(i)
+		n = 2 # Bounds are evaluated once.
+	print(out)
+
+	print(range_sum(2, 8, 1))
+	print(range_sum(8, 2, -2))
+	print(range_sum(3, 3, 1))
+	print(range_sum(5, 0, 1))
+
+	var a: int = 1
+	var b: int = 4
+	out.clear()
+	for i in range(a, b):
+		out.append(i)
+	print(out)
+
+	var count: int = 3
+	for f: float in range(count):
+		print(f)
+
+	var x: int = 7
+	var y: int = 3
+	x += y
+	print(x)
+	x = x * y
+	print(x)
+	var z: float = 1.5
+	z = z * 2.0
+	print(z)
+	z -= 0.5
+	print(z)
+	x = y if y > 10 else x - 1
+	print(x)
+
+	var ints := PackedInt32Array([1, 2, 3])
+	ints[0] += 10
+	ints[-1] *= 4
+	print(ints)
+
+	var longs := PackedInt64Array([100, 200])
+	longs[1] -= 50
+	print(longs)
+
+	var floats := PackedFloat32Array([1.0, 2.0])
+	floats[0] += 2
+	floats[1] /= 4.0
+	print(floats)
+
+	var doubles := PackedFloat64Array([0.5, 1.0, 1.5])
+	for i in range(doubles.size()):
+		doubles[i] *= 2
+	print(doubles)
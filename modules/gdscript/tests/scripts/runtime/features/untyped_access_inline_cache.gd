@@ -0,0 +1,64 @@
+# Untyped member access and calls are cached per site, the results must match the generic lookup.
+
+class A:
+	var value = 1
+	var typed: float = 0.0
+	var with_getter = 0:
+		get:
+			return with_getter + 100
+
+	func describe():
+		return "A %s" % value
+
+
+class B extends A:
+	func describe():
+		return "B %s" % value
+
+
+class Dynamic:
+	func _get(property):
+		if property == &"value":
+			return "dynamic"
+		return null
+
+	func describe():
+		return "Dynamic"
+
+
+func read_value(obj):
+	return obj.value
+
+
+func call_describe(obj):
+	return obj.describe()
+
+
+func set_typed(obj, v):
+	obj.typed = v
+
+
+func test():
+	var objects = [A.new(), B.new(), A.new(), Dynamic.new()]
+	for i in 3:
+		objects[i].value = i * 10
+	for _pass_index in 2:
+		for obj in objects:
+			print(call_describe(obj), " ", read_value(obj))
+
+	var a = objects[0]
+	for v in [2, 3.5]:
+		set_typed(a, v)
+		print(a.typed, " ", typeof(a.typed) == TYPE_FLOAT)
+	for i in 2:
+		a.with_getter = i
+		print(a.with_getter)
+
+	var nodes = [Node.new(), Node2D.new(), Node3D.new(), Control.new(), Timer.new(), Node2D.new()]
+	for pass_index in 2:
+		for i in nodes.size():
+			nodes[i].name = "N%d" % (i + pass_index)
+		for n in nodes:
+			print(n.get_class(), " ", n.name)
+	for n in nodes:
+		n.free()
@@ -81,6 +81,33 @@ private:
 	Ref<GLTFDocumentExtension> _image_save_extension;
 	RootNodeMode _root_node_mode = RootNodeMode::ROOT_NODE_MODE_SINGLE_ROOT;
 
+	// Per-item state for the parts of the import run on the WorkerThreadPool.
+	// Results are collected here and committed to the state in document order.
+	struct MeshParseTask {
+		Ref<GLTFState> state;
+		Dictionary json;
+		Ref<GLTFMesh> mesh;
+		LocalVector<GLTFMaterialIndex> vertex_color_materials;
+		Error error = OK;
+	};
+
+	struct ImageParseTask {
+		GLTFImageIndex index = -1;
+		String name;
+		String mime_type;
+		String file_extension;
+		Vector<uint8_t> data;
+		Ref<Image> image;
+		Ref<Texture2D> texture;
+	};
+
+	struct AnimationParseTask {
+		Ref<GLTFState> state;
+		Dictionary json;
+		Ref<GLTFAnimation> animation;
+		Error error = OK;
+	};
+
 protected:
 	static void _bind_methods();
 	String _gen_unique_name(Ref<GLTFState> p_state, const String &p_name);
@@ -176,12 +203,16 @@ private:
 	Vector<Transform3D> _decode_accessor_as_xform(Ref<GLTFState> p_state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
+	Error _parse_mesh(Ref<GLTFState> p_state, const Dictionary &p_mesh_dict, Ref<GLTFMesh> p_mesh, LocalVector<GLTFMaterialIndex> &r_vertex_color_materials);
+	void _parse_mesh_task(uint32_t p_index, MeshParseTask *p_tasks);
 	Error _parse_meshes(Ref<GLTFState> p_state);
 	Error _serialize_textures(Ref<GLTFState> p_state);
 	Error _serialize_texture_samplers(Ref<GLTFState> p_state);
 	Error _serialize_images(Ref<GLTFState> p_state);
 	Error _serialize_lights(Ref<GLTFState> p_state);
-	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	Ref<Image> _parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	static Ref<Image> _parse_image_bytes_into_image(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
+	void _parse_image_task(uint32_t p_index, ImageParseTask *p_tasks);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_file_extension, int p_index, Ref<Image> p_image);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
 	Error _parse_textures(Ref<GLTFState> p_state);
@@ -202,6 +233,8 @@ private:
 	Error _serialize_cameras(Ref<GLTFState> p_state);
 	Error _parse_cameras(Ref<GLTFState> p_state);
 	Error _parse_lights(Ref<GLTFState> p_state);
+	Error _parse_animation(Ref<GLTFState> p_state, const Dictionary &p_anim_dict, Ref<GLTFAnimation> p_animation);
+	void _parse_animation_task(uint32_t p_index, AnimationParseTask *p_tasks);
 	Error _parse_animations(Ref<GLTFState> p_state);
 	Error _serialize_animations(Ref<GLTFState> p_state);
 	BoneAttachment3D *_generate_bone_attachment(Ref<GLTFState> p_state,
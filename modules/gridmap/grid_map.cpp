@@ -31,7 +31,12 @@
 #include "grid_map.h"
 
 #include "core/io/marshalls.h"
+#include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/light_3d.h"
+#include "scene/resources/3d/box_shape_3d.h"
+#include "scene/resources/3d/concave_polygon_shape_3d.h"
+#include "scene/resources/3d/convex_polygon_shape_3d.h"
 #include "scene/resources/3d/mesh_library.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "scene/resources/physics_material.h"
@@ -191,6 +196,18 @@ real_t GridMap::get_collision_priority() const {
 	return collision_priority;
 }
 
+void GridMap::set_collision_merge_shapes(bool p_enabled) {
+	if (collision_merge_shapes == p_enabled) {
+		return;
+	}
+	collision_merge_shapes = p_enabled;
+	_recreate_octant_data();
+}
+
+bool GridMap::is_collision_merge_shapes_enabled() const {
+	return collision_merge_shapes;
+}
+
 void GridMap::set_physics_material(Ref<PhysicsMaterial> p_material) {
 	physics_material = p_material;
 	_update_physics_bodies_characteristics();
@@ -340,27 +357,32 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 	ok.y = p_position.y / octant_size;
 	ok.z = p_position.z / octant_size;
 
+	const Cell *old_cell = cell_map.getptr(key);
+	int old_item = old_cell ? (int)old_cell->item : INVALID_CELL_ITEM;
+
 	if (p_item < 0) {
 		//erase
-		if (cell_map.has(key)) {
+		if (old_cell) {
 			OctantKey octantkey = ok;
 
 			ERR_FAIL_COND(!octant_map.has(octantkey));
 			Octant &g = *octant_map[octantkey];
 			g.cells.erase(key);
-			g.dirty = true;
 			cell_map.erase(key);
-			_queue_octants_dirty();
+			_queue_cell_dirty(octantkey, g, key, old_item, INVALID_CELL_ITEM);
 		}
 		return;
 	}
 
+	if (old_cell && old_item == p_item && (int)old_cell->rot == p_rot) {
+		return; // Nothing changes.
+	}
+
 	OctantKey octantkey = ok;
 
 	if (!octant_map.has(octantkey)) {
 		//create octant because it does not exist
 		Octant *g = memnew(Octant);
-		g->dirty = true;
 		g->static_body = PhysicsServer3D::get_singleton()->body_create();
 		PhysicsServer3D::get_singleton()->body_set_mode(g->static_body, PhysicsServer3D::BODY_MODE_STATIC);
 		PhysicsServer3D::get_singleton()->body_attach_object_instance_id(g->static_body, get_instance_id());
@@ -387,16 +409,15 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 		}
 	}
 
-	Octant &g = *octant_map[octantkey];
-	g.cells.insert(key);
-	g.dirty = true;
-	_queue_octants_dirty();
-
 	Cell c;
 	c.item = p_item;
 	c.rot = p_rot;
 
 	cell_map[key] = c;
+
+	Octant &g = *octant_map[octantkey];
+	g.cells.insert(key);
+	_queue_cell_dirty(octantkey, g, key, old_item, p_item);
 }
 
 int GridMap::get_cell_item(const Vector3i &p_position) const {
@@ -540,106 +561,197 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
-	Octant &g = *octant_map[p_key];
-	if (!g.dirty) {
-		return false;
+// Adds the triangles of shapes which can be part of a concave shape, returns false for the others.
+static bool _add_shape_faces(const Ref<Shape3D> &p_shape, const Transform3D &p_xform, PackedVector3Array &r_faces) {
+	Ref<ConcavePolygonShape3D> concave = p_shape;
+	if (concave.is_valid()) {
+		Vector<Vector3> faces = concave->get_faces();
+		int base = r_faces.size();
+		r_faces.resize(base + faces.size());
+		Vector3 *w = r_faces.ptrw();
+		for (int i = 0; i < faces.size(); i++) {
+			w[base + i] = p_xform.xform(faces[i]);
+		}
+		return true;
 	}
 
-	//erase body shapes
-	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
-
-	//erase body shapes debug
-	if (g.collision_debug.is_valid()) {
-		RS::get_singleton()->mesh_clear(g.collision_debug);
+	Ref<BoxShape3D> box = p_shape;
+	if (box.is_valid()) {
+		static const int box_faces[36] = {
+			0, 1, 3, 0, 3, 2, // -X
+			4, 6, 7, 4, 7, 5, // +X
+			0, 4, 5, 0, 5, 1, // -Y
+			2, 3, 7, 2, 7, 6, // +Y
+			0, 2, 6, 0, 6, 4, // -Z
+			1, 5, 7, 1, 7, 3, // +Z
+		};
+		Vector3 half = box->get_size() * 0.5;
+		for (int i = 0; i < 36; i++) {
+			int corner = box_faces[i];
+			r_faces.push_back(p_xform.xform(Vector3((corner & 4) ? half.x : -half.x, (corner & 2) ? half.y : -half.y, (corner & 1) ? half.z : -half.z)));
+		}
+		return true;
 	}
 
-	//erase navigation
-	for (KeyValue<IndexKey, Octant::NavigationCell> &E : g.navigation_cell_ids) {
-		if (E.value.region.is_valid()) {
-			NavigationServer3D::get_singleton()->free(E.value.region);
-			E.value.region = RID();
+	Ref<ConvexPolygonShape3D> convex = p_shape;
+	if (convex.is_valid()) {
+		Geometry3D::MeshData md;
+		if (ConvexHullComputer::convex_hull(convex->get_points(), md) != OK) {
+			return false;
 		}
-		if (E.value.navigation_mesh_debug_instance.is_valid()) {
-			RS::get_singleton()->free(E.value.navigation_mesh_debug_instance);
-			E.value.navigation_mesh_debug_instance = RID();
+		for (const Geometry3D::MeshData::Face &face : md.faces) {
+			for (uint32_t i = 2; i < face.indices.size(); i++) {
+				r_faces.push_back(p_xform.xform(md.vertices[face.indices[0]]));
+				r_faces.push_back(p_xform.xform(md.vertices[face.indices[i - 1]]));
+				r_faces.push_back(p_xform.xform(md.vertices[face.indices[i]]));
+			}
 		}
+		return true;
 	}
-	g.navigation_cell_ids.clear();
 
-	//erase multimeshes
+	return false;
+}
 
-	for (int i = 0; i < g.multimesh_instances.size(); i++) {
-		RS::get_singleton()->free(g.multimesh_instances[i].instance);
-		RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
-	}
-	g.multimesh_instances.clear();
+void GridMap::_octant_build(uint32_t p_index, OctantUpdate *p_updates) {
+	OctantUpdate &u = p_updates[p_index];
+	const Octant &g = *u.octant;
 
-	if (g.cells.size() == 0) {
-		//octant no longer needed
-		_octant_clean_up(p_key);
-		return true;
+	if (g.cells.is_empty() || !mesh_library.is_valid()) {
+		return;
 	}
 
-	Vector<Vector3> col_debug;
-
 	/*
-	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
+	 * foreach cell of a dirty item in this octant,
+	 * gather the transform for the item's multimesh,
+	 * and foreach cell when the collision is dirty, gather the item's shapes
 	 */
 
-	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
-
+	Vector3 ofs = _get_offset();
 	for (const IndexKey &E : g.cells) {
-		ERR_CONTINUE(!cell_map.has(E));
-		const Cell &c = cell_map[E];
+		const Cell *c = cell_map.getptr(E);
+		ERR_CONTINUE(!c);
 
-		if (!mesh_library.is_valid() || !mesh_library->has_item(c.item)) {
+		bool item_dirty = g.dirty_items.has(c->item);
+		if ((!item_dirty && !g.dirty_collision) || !mesh_library->has_item(c->item)) {
 			continue;
 		}
 
 		Vector3 cellpos = Vector3(E.x, E.y, E.z);
-		Vector3 ofs = _get_offset();
 
 		Transform3D xform;
 
-		xform.basis = _ortho_bases[c.rot];
+		xform.basis = _ortho_bases[c->rot];
 		xform.set_origin(cellpos * cell_size + ofs);
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-		if (baked_meshes.size() == 0) {
-			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
-				}
-
-				Pair<Transform3D, IndexKey> p;
-				p.first = xform * mesh_library->get_item_mesh_transform(c.item);
-				p.second = E;
-				multimesh_items[c.item].push_back(p);
+		if (item_dirty && baked_meshes.size() == 0) {
+			if (mesh_library->get_item_mesh(c->item).is_valid()) {
+				u.multimesh_items[c->item].push_back(Pair<Transform3D, IndexKey>(xform * mesh_library->get_item_mesh_transform(c->item), E));
 			}
 		}
 
-		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
+		if (!g.dirty_collision) {
+			continue;
+		}
+
+		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c->item);
 		// add the item's shape at given xform to octant's static_body
 		for (int i = 0; i < shapes.size(); i++) {
 			// add the item's shape
 			if (!shapes[i].shape.is_valid()) {
 				continue;
 			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
+			Transform3D shape_xform = xform * shapes[i].local_transform;
+			if (!collision_merge_shapes || !_add_shape_faces(shapes[i].shape, shape_xform, u.merged_faces)) {
+				u.shapes.push_back(Pair<RID, Transform3D>(shapes[i].shape->get_rid(), shape_xform));
+			}
 			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
+				shapes.write[i].shape->add_vertices_to_array(u.col_debug, shape_xform);
 			}
 		}
+	}
+}
+
+bool GridMap::_octant_update(OctantUpdate &p_update) {
+	Octant &g = *p_update.octant;
+	if (!g.dirty) {
+		return false;
+	}
+
+	if (g.cells.size() == 0) {
+		//octant no longer needed
+		_octant_clean_up(p_update.key);
+		return true;
+	}
+
+	if (g.dirty_collision) {
+		//erase body shapes
+		PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
+		if (g.merged_collision_shape.is_valid()) {
+			PhysicsServer3D::get_singleton()->free(g.merged_collision_shape);
+			g.merged_collision_shape = RID();
+		}
+
+		//erase body shapes debug
+		if (g.collision_debug.is_valid()) {
+			RS::get_singleton()->mesh_clear(g.collision_debug);
+		}
+
+		for (const Pair<RID, Transform3D> &E : p_update.shapes) {
+			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, E.first, E.second);
+		}
+
+		if (p_update.merged_faces.size()) {
+			// All static shapes of the octant in a single concave shape, so the broadphase only has one entry for them.
+			Dictionary d;
+			d["faces"] = p_update.merged_faces;
+			d["backface_collision"] = true;
+			g.merged_collision_shape = PhysicsServer3D::get_singleton()->concave_polygon_shape_create();
+			PhysicsServer3D::get_singleton()->shape_set_data(g.merged_collision_shape, d);
+			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, g.merged_collision_shape);
+		}
+
+		if (p_update.col_debug.size()) {
+			Array arr;
+			arr.resize(RS::ARRAY_MAX);
+			arr[RS::ARRAY_VERTEX] = p_update.col_debug;
+
+			RS::get_singleton()->mesh_add_surface_from_arrays(g.collision_debug, RS::PRIMITIVE_LINES, arr);
+			SceneTree *st = SceneTree::get_singleton();
+			if (st) {
+				RS::get_singleton()->mesh_surface_set_material(g.collision_debug, 0, st->get_debug_collision_material()->get_rid());
+			}
+		}
+	}
+
+	// Navigation regions only depend on their own cell.
+	for (const IndexKey &E : g.dirty_cells) {
+		HashMap<IndexKey, Octant::NavigationCell>::Iterator old = g.navigation_cell_ids.find(E);
+		if (old) {
+			if (old->value.region.is_valid()) {
+				NavigationServer3D::get_singleton()->free(old->value.region);
+			}
+			if (old->value.navigation_mesh_debug_instance.is_valid()) {
+				RS::get_singleton()->free(old->value.navigation_mesh_debug_instance);
+			}
+			g.navigation_cell_ids.remove(old);
+		}
+
+		const Cell *c = cell_map.getptr(E);
+		if (!c || !mesh_library.is_valid() || !mesh_library->has_item(c->item)) {
+			continue;
+		}
 
 		// add the item's navigation_mesh at given xform to GridMap's Navigation ancestor
-		Ref<NavigationMesh> navigation_mesh = mesh_library->get_item_navigation_mesh(c.item);
+		Ref<NavigationMesh> navigation_mesh = mesh_library->get_item_navigation_mesh(c->item);
 		if (navigation_mesh.is_valid()) {
+			Transform3D xform;
+			xform.basis = _ortho_bases[c->rot];
+			xform.set_origin(Vector3(E.x, E.y, E.z) * cell_size + _get_offset());
+			xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+
 			Octant::NavigationCell nm;
-			nm.xform = xform * mesh_library->get_item_navigation_mesh_transform(c.item);
-			nm.navigation_layers = mesh_library->get_item_navigation_layers(c.item);
+			nm.xform = xform * mesh_library->get_item_navigation_mesh_transform(c->item);
+			nm.navigation_layers = mesh_library->get_item_navigation_layers(c->item);
 
 			if (bake_navigation) {
 				RID region = NavigationServer3D::get_singleton()->region_create();
@@ -677,63 +789,62 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	}
 
 #ifdef DEBUG_ENABLED
-	if (bake_navigation) {
-		_update_octant_navigation_debug_edge_connections_mesh(p_key);
+	if (bake_navigation && !g.dirty_cells.is_empty()) {
+		_update_octant_navigation_debug_edge_connections_mesh(p_update.key);
 	}
 #endif // DEBUG_ENABLED
 
+	//erase the multimeshes of the dirty items, the others are kept as they are
+	for (int i = g.multimesh_instances.size() - 1; i >= 0; i--) {
+		if (g.dirty_items.has(g.multimesh_instances[i].item)) {
+			RS::get_singleton()->free(g.multimesh_instances[i].instance);
+			RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
+			g.multimesh_instances.remove_at(i);
+		}
+	}
+
 	//update multimeshes, only if not baked
-	if (baked_meshes.size() == 0) {
-		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
-			Octant::MultimeshInstance mmi;
+	for (const KeyValue<int, LocalVector<Pair<Transform3D, IndexKey>>> &E : p_update.multimesh_items) {
+		Octant::MultimeshInstance mmi;
 
-			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
+		RID mm = RS::get_singleton()->multimesh_create();
+		RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
+		RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
 
-			int idx = 0;
-			for (const Pair<Transform3D, IndexKey> &F : E.value) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
+		int idx = 0;
+		for (const Pair<Transform3D, IndexKey> &F : E.value) {
+			RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
 #ifdef TOOLS_ENABLED
 
-				Octant::MultimeshInstance::Item it;
-				it.index = idx;
-				it.transform = F.first;
-				it.key = F.second;
-				mmi.items.push_back(it);
+			Octant::MultimeshInstance::Item it;
+			it.index = idx;
+			it.transform = F.first;
+			it.key = F.second;
+			mmi.items.push_back(it);
 #endif
 
-				idx++;
-			}
-
-			RID instance = RS::get_singleton()->instance_create();
-			RS::get_singleton()->instance_set_base(instance, mm);
-
-			if (is_inside_tree()) {
-				RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
-				RS::get_singleton()->instance_set_transform(instance, get_global_transform());
-			}
+			idx++;
+		}
 
-			mmi.multimesh = mm;
-			mmi.instance = instance;
+		RID instance = RS::get_singleton()->instance_create();
+		RS::get_singleton()->instance_set_base(instance, mm);
 
-			g.multimesh_instances.push_back(mmi);
+		if (is_inside_tree()) {
+			RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			RS::get_singleton()->instance_set_transform(instance, get_global_transform());
 		}
-	}
 
-	if (col_debug.size()) {
-		Array arr;
-		arr.resize(RS::ARRAY_MAX);
-		arr[RS::ARRAY_VERTEX] = col_debug;
+		mmi.multimesh = mm;
+		mmi.instance = instance;
+		mmi.item = E.key;
 
-		RS::get_singleton()->mesh_add_surface_from_arrays(g.collision_debug, RS::PRIMITIVE_LINES, arr);
-		SceneTree *st = SceneTree::get_singleton();
-		if (st) {
-			RS::get_singleton()->mesh_surface_set_material(g.collision_debug, 0, st->get_debug_collision_material()->get_rid());
-		}
+		g.multimesh_instances.push_back(mmi);
 	}
 
 	g.dirty = false;
+	g.dirty_collision = false;
+	g.dirty_cells.clear();
+	g.dirty_items.clear();
 
 	return false;
 }
@@ -869,6 +980,9 @@ void GridMap::_octant_clean_up(const OctantKey &p_key) {
 	}
 
 	PhysicsServer3D::get_singleton()->free(g.static_body);
+	if (g.merged_collision_shape.is_valid()) {
+		PhysicsServer3D::get_singleton()->free(g.merged_collision_shape);
+	}
 
 	// Erase navigation
 	for (const KeyValue<IndexKey, Octant::NavigationCell> &E : g.navigation_cell_ids) {
@@ -980,6 +1094,27 @@ void GridMap::_update_visibility() {
 	}
 }
 
+void GridMap::_queue_cell_dirty(const OctantKey &p_octant_key, Octant &p_octant, const IndexKey &p_cell, int p_old_item, int p_new_item) {
+	if (!p_octant.dirty) {
+		p_octant.dirty = true;
+		dirty_octants.push_back(p_octant_key);
+	}
+	p_octant.dirty_cells.insert(p_cell);
+
+	const int items[2] = { p_old_item, p_new_item };
+	for (int item : items) {
+		if (item == INVALID_CELL_ITEM) {
+			continue;
+		}
+		p_octant.dirty_items.insert(item);
+		if (!p_octant.dirty_collision && mesh_library.is_valid() && mesh_library->has_item(item) && !mesh_library->get_item_shapes(item).is_empty()) {
+			p_octant.dirty_collision = true;
+		}
+	}
+
+	_queue_octants_dirty();
+}
+
 void GridMap::_queue_octants_dirty() {
 	if (awaiting_update) {
 		return;
@@ -1011,6 +1146,7 @@ void GridMap::_clear_internal() {
 
 	octant_map.clear();
 	cell_map.clear();
+	dirty_octants.clear();
 }
 
 void GridMap::clear() {
@@ -1028,17 +1164,32 @@ void GridMap::_update_octants_callback() {
 		return;
 	}
 
-	List<OctantKey> to_delete;
-	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
-		if (_octant_update(E.key)) {
-			to_delete.push_back(E.key);
+	LocalVector<OctantUpdate> updates;
+	updates.reserve(dirty_octants.size());
+	for (const OctantKey &E : dirty_octants) {
+		Octant **g = octant_map.getptr(E);
+		if (g) {
+			OctantUpdate u;
+			u.key = E;
+			u.octant = *g;
+			updates.push_back(u);
 		}
 	}
+	dirty_octants.clear();
 
-	while (to_delete.front()) {
-		memdelete(octant_map[to_delete.front()->get()]);
-		octant_map.erase(to_delete.front()->get());
-		to_delete.pop_front();
+	// Transforms and shapes of independent octants are gathered in parallel, the servers are only used from this thread.
+	if (updates.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_octant_build, updates.ptr(), updates.size(), -1, true, String("GridMapOctantBuild"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (updates.size() == 1) {
+		_octant_build(0, updates.ptr());
+	}
+
+	for (OctantUpdate &E : updates) {
+		if (_octant_update(E)) {
+			memdelete(E.octant);
+			octant_map.erase(E.key);
+		}
 	}
 
 	_update_visibility();
@@ -1061,6 +1212,9 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_collision_priority", "priority"), &GridMap::set_collision_priority);
 	ClassDB::bind_method(D_METHOD("get_collision_priority"), &GridMap::get_collision_priority);
 
+	ClassDB::bind_method(D_METHOD("set_collision_merge_shapes", "enabled"), &GridMap::set_collision_merge_shapes);
+	ClassDB::bind_method(D_METHOD("is_collision_merge_shapes_enabled"), &GridMap::is_collision_merge_shapes_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_physics_material", "material"), &GridMap::set_physics_material);
 	ClassDB::bind_method(D_METHOD("get_physics_material"), &GridMap::get_physics_material);
 
@@ -1128,6 +1282,7 @@ void GridMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_layer", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_layer", "get_collision_layer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_mask", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_mask", "get_collision_mask");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_priority"), "set_collision_priority", "get_collision_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merge_shapes"), "set_collision_merge_shapes", "is_collision_merge_shapes_enabled");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bake_navigation"), "set_bake_navigation", "is_baking_navigation");
 
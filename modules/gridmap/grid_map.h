@@ -105,6 +105,7 @@ class GridMap : public Node3D {
 		struct MultimeshInstance {
 			RID instance;
 			RID multimesh;
+			int item = -1;
 			struct Item {
 				int index = 0;
 				Transform3D transform;
@@ -124,7 +125,11 @@ class GridMap : public Node3D {
 #endif // DEBUG_ENABLED
 
 		bool dirty = false;
+		bool dirty_collision = false; // Shapes are rebuilt for the whole octant.
+		HashSet<IndexKey> dirty_cells; // Cells whose navigation region is rebuilt.
+		HashSet<int> dirty_items; // Items whose MultiMesh is rebuilt.
 		RID static_body;
+		RID merged_collision_shape;
 		HashMap<IndexKey, NavigationCell> navigation_cell_ids;
 	};
 
@@ -149,9 +154,20 @@ class GridMap : public Node3D {
 		OctantKey() {}
 	};
 
+	// Data gathered on the WorkerThreadPool before an octant applies its changes to the servers.
+	struct OctantUpdate {
+		OctantKey key;
+		Octant *octant = nullptr;
+		HashMap<int, LocalVector<Pair<Transform3D, IndexKey>>> multimesh_items;
+		LocalVector<Pair<RID, Transform3D>> shapes;
+		PackedVector3Array merged_faces;
+		Vector<Vector3> col_debug;
+	};
+
 	uint32_t collision_layer = 1;
 	uint32_t collision_mask = 1;
 	real_t collision_priority = 1.0;
+	bool collision_merge_shapes = false;
 	Ref<PhysicsMaterial> physics_material;
 	bool bake_navigation = false;
 	RID map_override;
@@ -190,7 +206,8 @@ class GridMap : public Node3D {
 	void _update_physics_bodies_characteristics();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
-	bool _octant_update(const OctantKey &p_key);
+	void _octant_build(uint32_t p_index, OctantUpdate *p_updates);
+	bool _octant_update(OctantUpdate &p_update);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
 #ifdef DEBUG_ENABLED
@@ -199,7 +216,9 @@ class GridMap : public Node3D {
 	void _update_navigation_debug_edge_connections();
 #endif // DEBUG_ENABLED
 	bool awaiting_update = false;
+	LocalVector<OctantKey> dirty_octants;
 
+	void _queue_cell_dirty(const OctantKey &p_octant_key, Octant &p_octant, const IndexKey &p_cell, int p_old_item, int p_new_item);
 	void _queue_octants_dirty();
 	void _update_octants_callback();
 
@@ -247,6 +266,9 @@ public:
 	void set_collision_priority(real_t p_priority);
 	real_t get_collision_priority() const;
 
+	void set_collision_merge_shapes(bool p_enabled);
+	bool is_collision_merge_shapes_enabled() const;
+
 	void set_physics_material(Ref<PhysicsMaterial> p_material);
 	Ref<PhysicsMaterial> get_physics_material() const;
 
@@ -94,6 +94,15 @@ int AudioStreamInteractive::get_initial_clip() const {
 	return initial_clip;
 }
 
+void AudioStreamInteractive::set_preroll_clip_limit(int p_limit) {
+	ERR_FAIL_COND(p_limit < 0);
+	preroll_clip_limit = p_limit;
+}
+
+int AudioStreamInteractive::get_preroll_clip_limit() const {
+	return preroll_clip_limit;
+}
+
 int AudioStreamInteractive::get_clip_count() const {
 	return clip_count;
 }
@@ -484,7 +493,11 @@ void AudioStreamInteractive::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_clip_auto_advance_next_clip", "clip_index", "auto_advance_next_clip"), &AudioStreamInteractive::set_clip_auto_advance_next_clip);
 	ClassDB::bind_method(D_METHOD("get_clip_auto_advance_next_clip", "clip_index"), &AudioStreamInteractive::get_clip_auto_advance_next_clip);
 
+	ClassDB::bind_method(D_METHOD("set_preroll_clip_limit", "limit"), &AudioStreamInteractive::set_preroll_clip_limit);
+	ClassDB::bind_method(D_METHOD("get_preroll_clip_limit"), &AudioStreamInteractive::get_preroll_clip_limit);
+
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "initial_clip", PROPERTY_HINT_ENUM, "", PROPERTY_USAGE_DEFAULT), "set_initial_clip", "get_initial_clip");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "preroll_clip_limit", PROPERTY_HINT_RANGE, "0," + itos(MAX_CLIPS)), "set_preroll_clip_limit", "get_preroll_clip_limit");
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "clip_count", PROPERTY_HINT_RANGE, "1," + itos(MAX_CLIPS), PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_ARRAY, "Clips,clip_,page_size=999,unfoldable,numbered,swap_method=_inspector_array_swap_clip,add_button_text=" + String(RTR("Add Clip"))), "set_clip_count", "get_clip_count");
 	for (int i = 0; i < MAX_CLIPS; i++) {
@@ -542,6 +555,9 @@ AudioStreamPlaybackInteractive::AudioStreamPlaybackInteractive() {
 }
 
 AudioStreamPlaybackInteractive::~AudioStreamPlaybackInteractive() {
+	for (int i = 0; i < AudioStreamInteractive::MAX_CLIPS; i++) {
+		_finish_preroll(i);
+	}
 }
 
 void AudioStreamPlaybackInteractive::stop() {
@@ -552,9 +568,11 @@ void AudioStreamPlaybackInteractive::stop() {
 	active = false;
 
 	for (int i = 0; i < AudioStreamInteractive::MAX_CLIPS; i++) {
+		_finish_preroll(i);
 		if (states[i].playback.is_valid()) {
 			states[i].playback->stop();
 		}
+		states[i].preroll_position = -1.0;
 		states[i].fade_speed = 0.0;
 		states[i].fade_volume = 0.0;
 		states[i].fade_wait = 0.0;
@@ -614,7 +632,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 		state.fade_speed = 0;
 		state.first_mix = true;
 
-		state.playback->start(0);
+		_start_state(current, 0);
 
 		playback_current = current;
 
@@ -622,6 +640,8 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 			//prepare auto advance
 			state.auto_advance = stream->clips[current].auto_advance_next_clip;
 		}
+
+		_preroll_candidates(current);
 		return;
 	}
 
@@ -768,7 +788,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 	}
 	// keep volume, since it may have been fading in from something else.
 
-	to_state.playback->start(dst_seek_to);
+	_start_state(p_to_clip_index, dst_seek_to);
 	to_state.active = true;
 	to_state.fade_volume = 0.0;
 	to_state.first_mix = true;
@@ -794,7 +814,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 	if (transition.use_filler_clip && transition.filler_clip >= 0 && transition.filler_clip < (int)stream->clip_count && states[transition.filler_clip].playback.is_valid() && playback_current != transition.filler_clip && p_to_clip_index != transition.filler_clip) {
 		State &filler_state = states[transition.filler_clip];
 
-		filler_state.playback->start(0);
+		_start_state(transition.filler_clip, 0);
 		filler_state.active = true;
 
 		// Filler state does not fade (bake fade in the audio clip if you want fading.
@@ -841,6 +861,96 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 
 		to_state.auto_advance = auto_advance_to;
 	}
+
+	_preroll_candidates(p_to_clip_index);
+}
+
+void AudioStreamPlaybackInteractive::_preroll_state(int p_state_idx) {
+	State &state = states[p_state_idx];
+	state.playback->start(state.preroll_position);
+}
+
+void AudioStreamPlaybackInteractive::_finish_preroll(int p_state_idx) {
+	State &state = states[p_state_idx];
+	if (state.preroll_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(state.preroll_task);
+		state.preroll_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void AudioStreamPlaybackInteractive::_start_state(int p_state_idx, double p_from_pos) {
+	_finish_preroll(p_state_idx);
+	State &state = states[p_state_idx];
+	if (state.preroll_position < 0.0 || !Math::is_equal_approx(state.preroll_position, p_from_pos, 0.001)) {
+		state.playback->start(p_from_pos);
+	}
+	state.preroll_position = -1.0;
+}
+
+void AudioStreamPlaybackInteractive::_preroll_candidates(int p_from_clip) {
+	// Start the clips that can be transitioned to next on a worker thread, so seeking
+	// and decoder setup do not happen on the mix thread when the transition fires.
+	double positions[AudioStreamInteractive::MAX_CLIPS];
+	for (int i = 0; i < stream->clip_count; i++) {
+		positions[i] = -1.0;
+	}
+
+	int count = 0;
+	auto add_candidate = [&](int p_clip, double p_position) {
+		if (count >= stream->preroll_clip_limit || p_clip < 0 || p_clip >= stream->clip_count || p_clip == p_from_clip) {
+			return;
+		}
+		if (states[p_clip].playback.is_null() || states[p_clip].active || positions[p_clip] >= 0.0) {
+			return;
+		}
+		positions[p_clip] = p_position;
+		count++;
+	};
+
+	const AudioStreamInteractive::Clip &from = stream->clips[p_from_clip];
+	if (from.auto_advance == AudioStreamInteractive::AUTO_ADVANCE_ENABLED) {
+		add_candidate(from.auto_advance_next_clip, 0.0);
+	}
+
+	for (const KeyValue<AudioStreamInteractive::TransitionKey, AudioStreamInteractive::Transition> &E : stream->transition_map) {
+		if (int(E.key.from_clip) != p_from_clip) {
+			continue;
+		}
+		const AudioStreamInteractive::Transition &transition = E.value;
+		int to_clip = int(E.key.to_clip);
+		if (to_clip != AudioStreamInteractive::CLIP_ANY) {
+			// The position for TRANSITION_TO_TIME_SAME_POSITION is only known when the switch is requested.
+			if (transition.to_time == AudioStreamInteractive::TRANSITION_TO_TIME_START) {
+				add_candidate(to_clip, 0.0);
+			} else if (transition.to_time == AudioStreamInteractive::TRANSITION_TO_TIME_PREVIOUS_POSITION && states[to_clip].stream.is_valid() && states[to_clip].stream->get_length() > 0.0) {
+				add_candidate(to_clip, states[to_clip].previous_position);
+			}
+		}
+		if (transition.use_filler_clip) {
+			add_candidate(transition.filler_clip, 0.0);
+		}
+	}
+
+	for (int i = 0; i < stream->clip_count; i++) {
+		State &state = states[i];
+		if (state.active) {
+			continue;
+		}
+
+		if (positions[i] >= 0.0) {
+			if (state.preroll_position >= 0.0 && Math::is_equal_approx(state.preroll_position, positions[i], 0.001)) {
+				continue; // Already pre-rolled there.
+			}
+			_finish_preroll(i);
+			state.preroll_position = positions[i];
+			state.preroll_task = WorkerThreadPool::get_singleton()->add_template_task(this, &AudioStreamPlaybackInteractive::_preroll_state, i, false, "AudioStreamInteractivePreroll");
+		} else if (state.preroll_position >= 0.0) {
+			// No longer reachable from the current clip, release whatever the playback holds.
+			_finish_preroll(i);
+			state.playback->stop();
+			state.preroll_position = -1.0;
+		}
+	}
 }
 
 void AudioStreamPlaybackInteractive::seek(double p_time) {
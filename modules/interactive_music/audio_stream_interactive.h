@@ -31,6 +31,7 @@
 #ifndef AUDIO_STREAM_INTERACTIVE_H
 #define AUDIO_STREAM_INTERACTIVE_H
 
+#include "core/object/worker_thread_pool.h"
 #include "servers/audio/audio_stream.h"
 
 class AudioStreamPlaybackInteractive;
@@ -78,6 +79,7 @@ private:
 	int sample_rate = 44100;
 	bool stereo = true;
 	int initial_clip = 0;
+	int preroll_clip_limit = 2;
 
 	double time = 0;
 
@@ -152,6 +154,9 @@ public:
 	void set_initial_clip(int p_clip);
 	int get_initial_clip() const;
 
+	void set_preroll_clip_limit(int p_limit);
+	int get_preroll_clip_limit() const;
+
 	void set_clip_name(int p_clip, const StringName &p_name);
 	StringName get_clip_name(int p_clip) const;
 
@@ -222,6 +227,8 @@ private:
 		int auto_advance = -1;
 		bool first_mix = true;
 		double previous_position = 0;
+		double preroll_position = -1.0; // Position the idle playback was started at ahead of time, negative if none.
+		WorkerThreadPool::TaskID preroll_task = WorkerThreadPool::INVALID_TASK_ID;
 
 		void reset_fade() {
 			fade_wait = 0;
@@ -241,6 +248,11 @@ private:
 
 	void _queue(int p_to_clip_index, bool p_is_auto_advance);
 
+	void _preroll_state(int p_state_idx);
+	void _finish_preroll(int p_state_idx);
+	void _start_state(int p_state_idx, double p_from_pos);
+	void _preroll_candidates(int p_from_clip);
+
 	int switch_request = -1;
 
 protected:
@@ -36,6 +36,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/math/geometry_2d.h"
 #include "editor/editor_paths.h"
 #include "editor/editor_settings.h"
@@ -986,6 +987,95 @@ LightmapperRD::BakeError LightmapperRD::_denoise(RenderingDevice *p_rd, Ref<RDSh
 	return BAKE_OK;
 }
 
+static const uint32_t LIGHTMAP_CHECKPOINT_VERSION = 1;
+
+uint32_t LightmapperRD::_get_checkpoint_hash(uint32_t p_settings_hash) const {
+	uint32_t h = hash_murmur3_one_32(LIGHTMAP_CHECKPOINT_VERSION, p_settings_hash);
+
+	for (const MeshInstance &mi : mesh_instances) {
+		h = hash_murmur3_buffer(mi.data.points.ptr(), mi.data.points.size() * sizeof(Vector3), h);
+		h = hash_murmur3_buffer(mi.data.uv2.ptr(), mi.data.uv2.size() * sizeof(Vector2), h);
+		h = hash_murmur3_buffer(mi.data.normal.ptr(), mi.data.normal.size() * sizeof(Vector3), h);
+		if (mi.data.albedo_on_uv2.is_valid()) {
+			const Vector<uint8_t> data = mi.data.albedo_on_uv2->get_data();
+			h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+		}
+		if (mi.data.emission_on_uv2.is_valid()) {
+			const Vector<uint8_t> data = mi.data.emission_on_uv2->get_data();
+			h = hash_murmur3_buffer(data.ptr(), data.size(), h);
+		}
+		h = hash_murmur3_one_32(mi.slice, h);
+		h = hash_murmur3_one_32(mi.offset.x, h);
+		h = hash_murmur3_one_32(mi.offset.y, h);
+	}
+
+	h = hash_murmur3_buffer(lights.ptr(), lights.size() * sizeof(Light), h);
+	return hash_murmur3_buffer(probe_positions.ptr(), probe_positions.size() * sizeof(Probe), h);
+}
+
+int LightmapperRD::_load_checkpoint(RenderingDevice *p_rd, const String &p_path, uint32_t p_hash, RID p_light_accum_tex, int p_layers, int p_regions) {
+	if (!FileAccess::exists(p_path)) {
+		return 0;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V(f.is_null(), 0);
+
+	if (f->get_32() != LIGHTMAP_CHECKPOINT_VERSION || f->get_32() != p_hash || int(f->get_32()) != p_layers || int(f->get_32()) != p_regions) {
+		// Stale checkpoint from a different scene or bake configuration.
+		return 0;
+	}
+
+	int completed_regions = f->get_32();
+	ERR_FAIL_COND_V(completed_regions <= 0 || completed_regions > p_regions, 0);
+
+	Vector<Vector<uint8_t>> layers;
+	layers.resize(p_layers);
+	for (int i = 0; i < p_layers; i++) {
+		uint32_t size = f->get_32();
+		layers.write[i].resize(size);
+		if (f->get_buffer(layers.write[i].ptrw(), size) != size) {
+			WARN_PRINT("Lightmap bake checkpoint is truncated, ignoring it: " + p_path);
+			return 0;
+		}
+	}
+
+	for (int i = 0; i < p_layers; i++) {
+		if (p_rd->texture_update(p_light_accum_tex, i, layers[i]) != OK) {
+			return 0;
+		}
+	}
+
+	print_verbose(vformat("Lightmap bake: resuming indirect lighting from checkpoint (%d of %d regions done).", completed_regions, p_regions));
+	return completed_regions;
+}
+
+void LightmapperRD::_save_checkpoint(RenderingDevice *p_rd, const String &p_path, uint32_t p_hash, RID p_light_accum_tex, int p_layers, int p_regions, int p_completed_regions) {
+	// Write to a temporary file first, so an interruption while saving never leaves a corrupt checkpoint behind.
+	const String tmp_path = p_path + ".tmp";
+	{
+		Ref<FileAccess> f = FileAccess::open(tmp_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(f.is_null(), "Can't write lightmap bake checkpoint: " + tmp_path);
+
+		f->store_32(LIGHTMAP_CHECKPOINT_VERSION);
+		f->store_32(p_hash);
+		f->store_32(p_layers);
+		f->store_32(p_regions);
+		f->store_32(p_completed_regions);
+		for (int i = 0; i < p_layers; i++) {
+			const Vector<uint8_t> data = p_rd->texture_get_data(p_light_accum_tex, i);
+			f->store_32(data.size());
+			f->store_buffer(data.ptr(), data.size());
+		}
+	}
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->file_exists(p_path)) {
+		da->remove(p_path);
+	}
+	da->rename(tmp_path, p_path);
+}
+
 LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_denoiser, float p_denoiser_strength, int p_denoiser_range, int p_bounces, float p_bounce_indirect_energy, float p_bias, int p_max_texture_size, bool p_bake_sh, bool p_texture_for_bounces, GenerateProbes p_generate_probes, const Ref<Image> &p_environment_panorama, const Basis &p_environment_transform, BakeStepFunc p_step_function, void *p_bake_userdata, float p_exposure_normalization) {
 	int denoiser = GLOBAL_GET("rendering/lightmapping/denoising/denoiser");
 	String oidn_path = EDITOR_GET("filesystem/tools/oidn/oidn_denoise_path");
@@ -1650,12 +1740,56 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		rd->submit();
 		rd->sync();
 
+		// Periodically save the accumulated light, so an interrupted bake can resume from the last completed region.
+		const uint64_t checkpoint_interval_usec = uint64_t(double(GLOBAL_GET("rendering/lightmapping/bake_performance/checkpoint_interval")) * 1000000.0);
+		const int accum_layers = atlas_slices * (p_bake_sh ? 4 : 1);
+		const int total_regions = atlas_slices * x_regions * y_regions;
+		String checkpoint_path;
+		uint32_t checkpoint_hash = 0;
+		int completed_regions = 0;
+
+		if (checkpoint_interval_usec > 0) {
+			uint32_t settings_hash = hash_murmur3_one_32(push_constant.ray_count);
+			settings_hash = hash_murmur3_one_32(p_bounces, settings_hash);
+			settings_hash = hash_murmur3_one_float(p_bounce_indirect_energy, settings_hash);
+			settings_hash = hash_murmur3_one_float(p_bias, settings_hash);
+			settings_hash = hash_murmur3_one_32(p_bake_sh, settings_hash);
+			settings_hash = hash_murmur3_one_32(p_texture_for_bounces, settings_hash);
+			settings_hash = hash_murmur3_one_float(p_exposure_normalization, settings_hash);
+			for (int i = 0; i < 3; i++) {
+				for (int k = 0; k < 3; k++) {
+					settings_hash = hash_murmur3_one_real(p_environment_transform.rows[i][k], settings_hash);
+				}
+			}
+			if (p_environment_panorama.is_valid()) {
+				const Vector<uint8_t> data = p_environment_panorama->get_data();
+				settings_hash = hash_murmur3_buffer(data.ptr(), data.size(), settings_hash);
+			}
+			settings_hash = hash_murmur3_one_32(atlas_size.width, settings_hash);
+			settings_hash = hash_murmur3_one_32(atlas_size.height, settings_hash);
+			settings_hash = hash_murmur3_one_32(atlas_slices, settings_hash);
+			settings_hash = hash_murmur3_one_32(max_region_size, settings_hash);
+			settings_hash = hash_murmur3_one_32(max_rays, settings_hash);
+
+			checkpoint_hash = _get_checkpoint_hash(settings_hash);
+			checkpoint_path = EditorPaths::get_singleton()->get_cache_dir().path_join(vformat("lightmap_checkpoint_%08x.bin", checkpoint_hash));
+			completed_regions = _load_checkpoint(rd, checkpoint_path, checkpoint_hash, light_accum_tex, accum_layers, total_regions);
+		}
+
+		uint64_t last_checkpoint_usec = OS::get_singleton()->get_ticks_usec();
+
 		int count = 0;
 		for (int s = 0; s < atlas_slices; s++) {
 			push_constant.atlas_slice = s;
 
 			for (int i = 0; i < x_regions; i++) {
 				for (int j = 0; j < y_regions; j++) {
+					int region = (s * x_regions + i) * y_regions + j;
+					if (region < completed_regions) {
+						count += ray_iterations;
+						continue;
+					}
+
 					int x = i * max_region_size;
 					int y = j * max_region_size;
 					int w = MIN((i + 1) * max_region_size, atlas_size.width) - x;
@@ -1689,9 +1823,21 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 							p_step_function(0.6 + p, vformat(RTR("Integrate indirect lighting %d%%"), percent), p_bake_userdata, false);
 						}
 					}
+
+					if (!checkpoint_path.is_empty() && region + 1 < total_regions) {
+						uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+						if (ticks - last_checkpoint_usec >= checkpoint_interval_usec) {
+							_save_checkpoint(rd, checkpoint_path, checkpoint_hash, light_accum_tex, accum_layers, total_regions, region + 1);
+							last_checkpoint_usec = ticks;
+						}
+					}
 				}
 			}
 		}
+
+		if (!checkpoint_path.is_empty() && FileAccess::exists(checkpoint_path)) {
+			DirAccess::remove_absolute(checkpoint_path);
+		}
 	}
 
 	/* LIGHTPROBES */
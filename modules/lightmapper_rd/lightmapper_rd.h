@@ -278,6 +278,11 @@ class LightmapperRD : public Lightmapper {
 	Ref<Image> _read_pfm(const String &p_name);
 	BakeError _denoise_oidn(RenderingDevice *p_rd, RID p_source_light_tex, RID p_source_normal_tex, RID p_dest_light_tex, const Size2i &p_atlas_size, int p_atlas_slices, bool p_bake_sh, const String &p_exe);
 
+	// Checkpointing of the indirect light pass, so long bakes can resume after an interruption.
+	uint32_t _get_checkpoint_hash(uint32_t p_settings_hash) const;
+	int _load_checkpoint(RenderingDevice *p_rd, const String &p_path, uint32_t p_hash, RID p_light_accum_tex, int p_layers, int p_regions);
+	void _save_checkpoint(RenderingDevice *p_rd, const String &p_path, uint32_t p_hash, RID p_light_accum_tex, int p_layers, int p_regions, int p_completed_regions);
+
 public:
 	virtual void add_mesh(const MeshData &p_mesh) override;
 	virtual void add_directional_light(bool p_static, const Vector3 &p_direction, const Color &p_color, float p_energy, float p_indirect_energy, float p_angular_distance, float p_shadow_blur) override;
@@ -34,6 +34,75 @@
 
 #include "thirdparty/meshoptimizer/meshoptimizer.h"
 
+static Vector<RS::MeshCluster> _build_clusters(Vector<int> &r_indices, const Vector<Vector3> &p_vertices) {
+	// Cluster sizes recommended by meshoptimizer for GPU culling.
+	const size_t max_vertices = 64;
+	const size_t max_triangles = 124;
+	const float cone_weight = 0.25f;
+
+	Vector<RS::MeshCluster> clusters;
+	ERR_FAIL_COND_V(r_indices.size() % 3 != 0, clusters);
+
+	const size_t index_count = r_indices.size();
+	const size_t vertex_count = p_vertices.size();
+
+	LocalVector<float> positions;
+	positions.resize(vertex_count * 3);
+	for (size_t i = 0; i < vertex_count; i++) {
+		const Vector3 &v = p_vertices[i];
+		positions[i * 3 + 0] = v.x;
+		positions[i * 3 + 1] = v.y;
+		positions[i * 3 + 2] = v.z;
+	}
+
+	const size_t max_meshlets = meshopt_buildMeshletsBound(index_count, max_vertices, max_triangles);
+	LocalVector<meshopt_Meshlet> meshlets;
+	meshlets.resize(max_meshlets);
+	LocalVector<unsigned int> meshlet_vertices;
+	meshlet_vertices.resize(max_meshlets * max_vertices);
+	LocalVector<unsigned char> meshlet_triangles;
+	meshlet_triangles.resize(max_meshlets * max_triangles * 3);
+
+	const size_t meshlet_count = meshopt_buildMeshlets(meshlets.ptr(), meshlet_vertices.ptr(), meshlet_triangles.ptr(), (const unsigned int *)r_indices.ptr(), index_count, positions.ptr(), vertex_count, sizeof(float) * 3, max_vertices, max_triangles, cone_weight);
+
+	Vector<int> sorted_indices;
+	sorted_indices.resize(index_count);
+	int *sorted_ptr = sorted_indices.ptrw();
+	uint32_t offset = 0;
+
+	clusters.resize(meshlet_count);
+	RS::MeshCluster *clusters_ptr = clusters.ptrw();
+
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const meshopt_Meshlet &meshlet = meshlets[i];
+		const unsigned int *local_vertices = &meshlet_vertices[meshlet.vertex_offset];
+		const unsigned char *local_triangles = &meshlet_triangles[meshlet.triangle_offset];
+
+		meshopt_Bounds bounds = meshopt_computeMeshletBounds(local_vertices, local_triangles, meshlet.triangle_count, positions.ptr(), vertex_count, sizeof(float) * 3);
+
+		RS::MeshCluster &cluster = clusters_ptr[i];
+		memset(&cluster, 0, sizeof(RS::MeshCluster));
+		for (int j = 0; j < 3; j++) {
+			cluster.center[j] = bounds.center[j];
+			// meshoptimizer assumes counter-clockwise front faces, Godot uses clockwise ones.
+			cluster.cone_axis[j] = -bounds.cone_axis[j];
+		}
+		cluster.radius = bounds.radius;
+		cluster.cone_cutoff = bounds.cone_cutoff;
+		cluster.index_offset = offset;
+		cluster.index_count = meshlet.triangle_count * 3;
+
+		for (unsigned int j = 0; j < meshlet.triangle_count * 3; j++) {
+			sorted_ptr[offset++] = local_vertices[local_triangles[j]];
+		}
+	}
+
+	ERR_FAIL_COND_V(offset != index_count, Vector<RS::MeshCluster>());
+	r_indices = sorted_indices;
+
+	return clusters;
+}
+
 void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -47,6 +116,7 @@ void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = meshopt_generateVertexRemap;
 	SurfaceTool::remap_vertex_func = meshopt_remapVertexBuffer;
 	SurfaceTool::remap_index_func = meshopt_remapIndexBuffer;
+	SurfaceTool::build_clusters_func = _build_clusters;
 }
 
 void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
@@ -61,4 +131,5 @@ void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = nullptr;
 	SurfaceTool::remap_vertex_func = nullptr;
 	SurfaceTool::remap_index_func = nullptr;
+	SurfaceTool::build_clusters_func = nullptr;
 }
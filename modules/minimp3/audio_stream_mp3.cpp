@@ -36,7 +36,7 @@
 
 #include "core/io/file_access.h"
 
-int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
+int AudioStreamPlaybackMP3::_decode_frames(AudioFrame *p_buffer, int p_frames) {
 	if (!active) {
 		return 0;
 	}
@@ -77,7 +77,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 					}
 				}
 				loop_fade_remaining = 0;
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			}
 		}
@@ -85,7 +85,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (use_loop) {
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -101,34 +101,67 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	return frames_mixed_this_step;
 }
 
+int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
+	return decode_ahead.mix(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackMP3::decode_ahead_mix(AudioFrame *p_buffer, int p_frames) {
+	return _decode_frames(p_buffer, p_frames);
+}
+
+bool AudioStreamPlaybackMP3::decode_ahead_is_active() const {
+	return active;
+}
+
+double AudioStreamPlaybackMP3::decode_ahead_get_position() const {
+	return double(frames_mixed) / mp3_stream->sample_rate;
+}
+
+int AudioStreamPlaybackMP3::decode_ahead_get_loop_count() const {
+	return loops;
+}
+
 float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 	return mp3_stream->sample_rate;
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
-	active = true;
-	seek(p_from_pos);
-	loops = 0;
+	{
+		MutexLock lock(decode_ahead.get_decode_mutex());
+		active = true;
+		_seek(p_from_pos);
+		loops = 0;
+		decode_ahead.flush();
+	}
 	begin_resample();
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	MutexLock lock(decode_ahead.get_decode_mutex());
 	active = false;
+	decode_ahead.flush();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	// The decoder may already have reached the end while the tail is still buffered.
+	return !decode_ahead.is_finished();
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
-	return loops;
+	return decode_ahead.get_loop_count();
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
-	return double(frames_mixed) / mp3_stream->sample_rate;
+	return decode_ahead.get_position();
 }
 
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	MutexLock lock(decode_ahead.get_decode_mutex());
+	_seek(p_time);
+	decode_ahead.flush();
+}
+
+void AudioStreamPlaybackMP3::_seek(double p_time) {
 	if (!active) {
 		return;
 	}
@@ -180,7 +213,21 @@ Variant AudioStreamPlaybackMP3::get_parameter(const StringName &p_name) const {
 	return Variant();
 }
 
+size_t AudioStreamPlaybackMP3::_file_read(void *p_buf, size_t p_size, void *p_user_data) {
+	FileAccess *f = static_cast<FileAccess *>(p_user_data);
+	return f->get_buffer(static_cast<uint8_t *>(p_buf), p_size);
+}
+
+int AudioStreamPlaybackMP3::_file_seek(uint64_t p_position, void *p_user_data) {
+	FileAccess *f = static_cast<FileAccess *>(p_user_data);
+	f->seek(p_position);
+	return f->get_position() == p_position ? 0 : -1;
+}
+
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	// Make sure the decode thread is done with us before tearing down the decoder.
+	decode_ahead.release();
+
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -190,7 +237,7 @@ AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
 Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 	Ref<AudioStreamPlaybackMP3> mp3s;
 
-	ERR_FAIL_COND_V_MSG(data.is_empty(), mp3s,
+	ERR_FAIL_COND_V_MSG(data.is_empty() && stream_path.is_empty(), mp3s,
 			"This AudioStreamMP3 does not have an audio file assigned "
 			"to it. AudioStreamMP3 should not be created from the "
 			"inspector or with `.new()`. Instead, load an audio file.");
@@ -198,8 +245,21 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 	mp3s.instantiate();
 	mp3s->mp3_stream = Ref<AudioStreamMP3>(this);
 	mp3s->mp3d = (mp3dec_ex_t *)memalloc(sizeof(mp3dec_ex_t));
-
-	int errorcode = mp3dec_ex_open_buf(mp3s->mp3d, data.ptr(), data_len, MP3D_SEEK_TO_SAMPLE);
+	memset(mp3s->mp3d, 0, sizeof(mp3dec_ex_t));
+
+	int errorcode;
+	if (stream_path.is_empty()) {
+		errorcode = mp3dec_ex_open_buf(mp3s->mp3d, data.ptr(), data_len, MP3D_SEEK_TO_SAMPLE);
+	} else {
+		mp3s->file = FileAccess::open(stream_path, FileAccess::READ);
+		ERR_FAIL_COND_V_MSG(mp3s->file.is_null(), Ref<AudioStreamPlaybackMP3>(), vformat("Cannot open file '%s'.", stream_path));
+		mp3s->file_io.read = AudioStreamPlaybackMP3::_file_read;
+		mp3s->file_io.read_data = mp3s->file.ptr();
+		mp3s->file_io.seek = AudioStreamPlaybackMP3::_file_seek;
+		mp3s->file_io.seek_data = mp3s->file.ptr();
+		// The length is already known, the seek index is built lazily the first time it's needed.
+		errorcode = mp3dec_ex_open_cb(mp3s->mp3d, &mp3s->file_io, MP3D_SEEK_TO_SAMPLE | MP3D_DO_NOT_SCAN);
+	}
 
 	mp3s->frames_mixed = 0;
 	mp3s->active = false;
@@ -209,6 +269,12 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	mp3s->decode_ahead.init(mp3s.ptr(), sample_rate);
+	{
+		MutexLock lock(mp3s->decode_ahead.get_decode_mutex());
+		mp3s->decode_ahead.flush();
+	}
+
 	return mp3s;
 }
 
@@ -218,6 +284,8 @@ String AudioStreamMP3::get_stream_name() const {
 
 void AudioStreamMP3::clear_data() {
 	data.clear();
+	data_len = 0;
+	stream_path = String();
 }
 
 void AudioStreamMP3::set_data(const Vector<uint8_t> &p_data) {
@@ -245,6 +313,46 @@ Vector<uint8_t> AudioStreamMP3::get_data() const {
 	return data;
 }
 
+Ref<AudioStreamMP3> AudioStreamMP3::load_from_file(const String &p_path, bool p_stream_from_disk) {
+	if (!p_stream_from_disk) {
+		Vector<uint8_t> file_data = FileAccess::get_file_as_bytes(p_path);
+		ERR_FAIL_COND_V_MSG(file_data.is_empty(), Ref<AudioStreamMP3>(), vformat("Cannot open file '%s'.", p_path));
+		Ref<AudioStreamMP3> mp3_stream;
+		mp3_stream.instantiate();
+		mp3_stream->set_data(file_data);
+		ERR_FAIL_COND_V_MSG(mp3_stream->get_data().is_empty(), Ref<AudioStreamMP3>(), vformat("MP3 decoding failed. Check that your data is a valid MP3 audio stream: '%s'.", p_path));
+		return mp3_stream;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), Ref<AudioStreamMP3>(), vformat("Cannot open file '%s'.", p_path));
+
+	mp3dec_io_t io;
+	io.read = AudioStreamPlaybackMP3::_file_read;
+	io.read_data = f.ptr();
+	io.seek = AudioStreamPlaybackMP3::_file_seek;
+	io.seek_data = f.ptr();
+
+	// Scans the whole file once to get an exact length, without keeping it in memory.
+	mp3dec_ex_t mp3d;
+	int err = mp3dec_ex_open_cb(&mp3d, &io, MP3D_SEEK_TO_SAMPLE);
+	if (err || mp3d.info.hz == 0) {
+		mp3dec_ex_close(&mp3d);
+		ERR_FAIL_V_MSG(Ref<AudioStreamMP3>(), vformat("MP3 decoding failed. Check that your data is a valid MP3 audio stream: '%s'.", p_path));
+	}
+
+	Ref<AudioStreamMP3> mp3_stream;
+	mp3_stream.instantiate();
+	mp3_stream->channels = mp3d.info.channels;
+	mp3_stream->sample_rate = mp3d.info.hz;
+	mp3_stream->length = float(mp3d.samples) / (mp3_stream->sample_rate * float(mp3_stream->channels));
+	mp3_stream->stream_path = p_path;
+
+	mp3dec_ex_close(&mp3d);
+
+	return mp3_stream;
+}
+
 void AudioStreamMP3::set_loop(bool p_enable) {
 	loop = p_enable;
 }
@@ -316,6 +424,8 @@ Ref<AudioSample> AudioStreamMP3::generate_sample() const {
 }
 
 void AudioStreamMP3::_bind_methods() {
+	ClassDB::bind_static_method("AudioStreamMP3", D_METHOD("load_from_file", "path", "stream_from_disk"), &AudioStreamMP3::load_from_file, DEFVAL(false));
+
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &AudioStreamMP3::set_data);
 	ClassDB::bind_method(D_METHOD("get_data"), &AudioStreamMP3::get_data);
 
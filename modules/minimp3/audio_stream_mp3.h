@@ -31,14 +31,16 @@
 #ifndef AUDIO_STREAM_MP3_H
 #define AUDIO_STREAM_MP3_H
 
+#include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_stream.h"
 
 #include <minimp3_ex.h>
 
 class AudioStreamMP3;
 
-class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
+class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled, public AudioDecodeAheadBuffer::Source {
 	GDCLASS(AudioStreamPlaybackMP3, AudioStreamPlaybackResampled);
 
 	enum {
@@ -54,6 +56,15 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	bool active = false;
 	int loops = 0;
 
+	// Only used when streaming from disk.
+	Ref<FileAccess> file;
+	mp3dec_io_t file_io;
+
+	static size_t _file_read(void *p_buf, size_t p_size, void *p_user_data);
+	static int _file_seek(uint64_t p_position, void *p_user_data);
+
+	AudioDecodeAheadBuffer decode_ahead;
+
 	friend class AudioStreamMP3;
 
 	Ref<AudioStreamMP3> mp3_stream;
@@ -61,10 +72,18 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	bool _is_sample = false;
 	Ref<AudioSamplePlayback> sample_playback;
 
+	int _decode_frames(AudioFrame *p_buffer, int p_frames);
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
+	virtual int decode_ahead_mix(AudioFrame *p_buffer, int p_frames) override;
+	virtual bool decode_ahead_is_active() const override;
+	virtual double decode_ahead_get_position() const override;
+	virtual int decode_ahead_get_loop_count() const override;
+
 public:
 	virtual void start(double p_from_pos = 0.0) override;
 	virtual void stop() override;
@@ -99,6 +118,9 @@ class AudioStreamMP3 : public AudioStream {
 	PackedByteArray data;
 	uint32_t data_len = 0;
 
+	// When set, playbacks read the file from disk instead of `data`.
+	String stream_path;
+
 	float sample_rate = 1.0;
 	int channels = 1;
 	float length = 0.0;
@@ -114,6 +136,8 @@ protected:
 	static void _bind_methods();
 
 public:
+	static Ref<AudioStreamMP3> load_from_file(const String &p_path, bool p_stream_from_disk = false);
+
 	void set_loop(bool p_enable);
 	virtual bool has_loop() const override;
 
@@ -135,6 +159,8 @@ public:
 	void set_data(const Vector<uint8_t> &p_data);
 	Vector<uint8_t> get_data() const;
 
+	virtual uint64_t get_memory_usage() const override { return data.size(); }
+
 	virtual double get_length() const override;
 
 	virtual bool is_monophonic() const override;
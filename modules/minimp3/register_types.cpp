@@ -32,6 +32,8 @@
 
 #include "audio_stream_mp3.h"
 
+#include "core/io/resource_loader.h"
+
 #ifdef TOOLS_ENABLED
 #include "resource_importer_mp3.h"
 #endif
@@ -62,6 +64,7 @@ void initialize_minimp3_module(ModuleInitializationLevel p_level) {
 #endif
 
 	GDREGISTER_CLASS(AudioStreamMP3);
+	ResourceLoader::add_placeholder_type("AudioStreamMP3", "AudioStreamWAV");
 }
 
 void uninitialize_minimp3_module(ModuleInitializationLevel p_level) {
@@ -112,6 +112,7 @@ StringBuilder &operator<<(StringBuilder &r_sb, const char *p_cstring) {
 #define C_METHOD_MONOSTR_FROM_GODOT C_NS_MONOMARSHAL ".ConvertStringToManaged"
 #define C_METHOD_MONOARRAY_TO(m_type) C_NS_MONOMARSHAL ".ConvertSystemArrayToNative" #m_type
 #define C_METHOD_MONOARRAY_FROM(m_type) C_NS_MONOMARSHAL ".ConvertNative" #m_type "ToSystemArray"
+#define C_METHOD_MONOSPAN_TO(m_type) C_NS_MONOMARSHAL ".ConvertReadOnlySpanToNative" #m_type
 #define C_METHOD_MANAGED_TO_CALLABLE C_NS_MONOMARSHAL ".ConvertCallableToNative"
 #define C_METHOD_MANAGED_FROM_CALLABLE C_NS_MONOMARSHAL ".ConvertCallableToManaged"
 #define C_METHOD_MANAGED_TO_SIGNAL C_NS_MONOMARSHAL ".ConvertSignalToNative"
@@ -2224,6 +2225,14 @@ Error BindingsGenerator::_generate_cs_type(const TypeInterface &itype, const Str
 		Error method_err = _generate_cs_method(itype, imethod, method_bind_count, output);
 		ERR_FAIL_COND_V_MSG(method_err != OK, method_err,
 				"Failed to generate method '" + imethod.name + "' for class '" + itype.name + "'.");
+
+		if (_method_has_span_overload(imethod)) {
+			// The overload shares the method bind field of the method generated above.
+			int method_bind_index = method_bind_count - 1;
+			method_err = _generate_cs_method(itype, imethod, method_bind_index, output, true);
+			ERR_FAIL_COND_V_MSG(method_err != OK, method_err,
+					"Failed to generate span overload of method '" + imethod.name + "' for class '" + itype.name + "'.");
+		}
 	}
 
 	// Signals
@@ -2649,7 +2658,25 @@ Error BindingsGenerator::_generate_cs_property(const BindingsGenerator::TypeInte
 	return OK;
 }
 
-Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output) {
+bool BindingsGenerator::_method_has_span_overload(const MethodInterface &p_imethod) {
+	if (p_imethod.is_virtual || p_imethod.is_vararg || p_imethod.is_compat || p_imethod.requires_object_call) {
+		return false;
+	}
+
+	for (const ArgumentInterface &iarg : p_imethod.arguments) {
+		// Arguments with a default value keep their array type, a span can't default to null.
+		if (iarg.default_argument.is_empty()) {
+			const TypeInterface *arg_type = _get_type_or_null(iarg.type);
+			if (arg_type && !arg_type->cs_span_type.is_empty()) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output, bool p_use_span_args) {
 	const TypeInterface *return_type = _get_type_or_singleton_or_null(p_imethod.return_type);
 	ERR_FAIL_NULL_V(return_type, ERR_BUG); // Return type not found
 
@@ -2707,6 +2734,9 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 		}
 
 		String arg_cs_type = arg_type->cs_type + _get_generic_type_parameters(*arg_type, iarg.type.generic_type_parameters);
+		if (p_use_span_args && !arg_type->cs_span_type.is_empty() && iarg.default_argument.is_empty()) {
+			arg_cs_type = arg_type->cs_span_type;
+		}
 
 		// Add the current arguments to the signature
 		// If the argument has a default value which is not a constant, we will make it Nullable
@@ -2807,7 +2837,7 @@ Error BindingsGenerator::_generate_cs_method(const BindingsGenerator::TypeInterf
 
 	// Generate method
 	{
-		if (!p_imethod.is_virtual && !p_imethod.requires_object_call) {
+		if (!p_imethod.is_virtual && !p_imethod.requires_object_call && !p_use_span_args) {
 			p_output << MEMBER_BEGIN "[DebuggerBrowsable(DebuggerBrowsableState.Never)]\n"
 					 << INDENT1 "private static readonly IntPtr " << method_bind_field << " = ";
 
@@ -4559,38 +4589,45 @@ void BindingsGenerator::_populate_builtin_type_interfaces() {
 	itype.c_type_in = "Variant[]";
 	builtin_types.insert(itype.cname, itype);
 
-#define INSERT_ARRAY_FULL(m_name, m_type, m_managed_type, m_proxy_t)                \
-	{                                                                               \
-		itype = TypeInterface();                                                    \
-		itype.name = #m_name;                                                       \
-		itype.cname = itype.name;                                                   \
-		itype.proxy_name = #m_proxy_t "[]";                                         \
-		itype.cs_type = itype.proxy_name;                                           \
-		itype.c_in = "%5using %0 %1_in = " C_METHOD_MONOARRAY_TO(m_type) "(%1);\n"; \
-		itype.c_out = "%5return " C_METHOD_MONOARRAY_FROM(m_type) "(%1);\n";        \
-		itype.c_arg_in = "&%s_in";                                                  \
-		itype.c_type = #m_managed_type;                                             \
-		itype.c_type_in = itype.proxy_name;                                         \
-		itype.c_type_out = itype.proxy_name;                                        \
-		itype.c_type_is_disposable_struct = true;                                   \
-		builtin_types.insert(itype.name, itype);                                    \
-	}
-
-#define INSERT_ARRAY(m_type, m_managed_type, m_proxy_t) INSERT_ARRAY_FULL(m_type, m_type, m_managed_type, m_proxy_t)
-
-	INSERT_ARRAY(PackedInt32Array, godot_packed_int32_array, int);
-	INSERT_ARRAY(PackedInt64Array, godot_packed_int64_array, long);
-	INSERT_ARRAY_FULL(PackedByteArray, PackedByteArray, godot_packed_byte_array, byte);
-
-	INSERT_ARRAY(PackedFloat32Array, godot_packed_float32_array, float);
-	INSERT_ARRAY(PackedFloat64Array, godot_packed_float64_array, double);
-
-	INSERT_ARRAY(PackedStringArray, godot_packed_string_array, string);
-
-	INSERT_ARRAY(PackedColorArray, godot_packed_color_array, Color);
-	INSERT_ARRAY(PackedVector2Array, godot_packed_vector2_array, Vector2);
-	INSERT_ARRAY(PackedVector3Array, godot_packed_vector3_array, Vector3);
-	INSERT_ARRAY(PackedVector4Array, godot_packed_vector4_array, Vector4);
+#define INSERT_ARRAY_FULL(m_name, m_type, m_managed_type, m_proxy_t, m_span)            \
+	{                                                                                   \
+		itype = TypeInterface();                                                        \
+		itype.name = #m_name;                                                           \
+		itype.cname = itype.name;                                                       \
+		itype.proxy_name = #m_proxy_t "[]";                                             \
+		itype.cs_type = itype.proxy_name;                                               \
+		itype.c_out = "%5return " C_METHOD_MONOARRAY_FROM(m_type) "(%1);\n";            \
+		itype.c_arg_in = "&%s_in";                                                      \
+		itype.c_type = #m_managed_type;                                                 \
+		if (m_span) {                                                                   \
+			itype.cs_span_type = "ReadOnlySpan<" #m_proxy_t ">";                        \
+			itype.c_type_in = itype.cs_span_type;                                       \
+			itype.c_in = "%5using %0 %1_in = " C_METHOD_MONOSPAN_TO(m_type) "(%1);\n";  \
+		} else {                                                                        \
+			itype.c_type_in = itype.proxy_name;                                         \
+			itype.c_in = "%5using %0 %1_in = " C_METHOD_MONOARRAY_TO(m_type) "(%1);\n"; \
+		}                                                                               \
+		itype.c_type_out = itype.proxy_name;                                            \
+		itype.c_type_is_disposable_struct = true;                                       \
+		builtin_types.insert(itype.name, itype);                                        \
+	}
+
+#define INSERT_ARRAY(m_type, m_managed_type, m_proxy_t, m_span) INSERT_ARRAY_FULL(m_type, m_type, m_managed_type, m_proxy_t, m_span)
+
+	// Arrays of blittable elements are marshalled with a single copy straight from the span.
+	INSERT_ARRAY(PackedInt32Array, godot_packed_int32_array, int, true);
+	INSERT_ARRAY(PackedInt64Array, godot_packed_int64_array, long, true);
+	INSERT_ARRAY_FULL(PackedByteArray, PackedByteArray, godot_packed_byte_array, byte, true);
+
+	INSERT_ARRAY(PackedFloat32Array, godot_packed_float32_array, float, true);
+	INSERT_ARRAY(PackedFloat64Array, godot_packed_float64_array, double, true);
+
+	INSERT_ARRAY(PackedStringArray, godot_packed_string_array, string, false);
+
+	INSERT_ARRAY(PackedColorArray, godot_packed_color_array, Color, true);
+	INSERT_ARRAY(PackedVector2Array, godot_packed_vector2_array, Vector2, true);
+	INSERT_ARRAY(PackedVector3Array, godot_packed_vector3_array, Vector3, true);
+	INSERT_ARRAY(PackedVector4Array, godot_packed_vector4_array, Vector4, true);
 
 #undef INSERT_ARRAY
 
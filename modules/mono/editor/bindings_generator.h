@@ -431,6 +431,13 @@ class BindingsGenerator {
 		 */
 		String cs_type;
 
+		/**
+		 * Span type accepted by the additional overload generated for methods with parameters of this type.
+		 * The icall takes this type as well, so the span is marshalled without first allocating a managed array.
+		 * Empty if the type doesn't get such overloads.
+		 */
+		String cs_span_type;
+
 		/**
 		 * Formatting elements:
 		 * %0: input expression of type `in godot_variant`
@@ -840,7 +847,8 @@ class BindingsGenerator {
 	Error _generate_cs_type(const TypeInterface &itype, const String &p_output_file);
 
 	Error _generate_cs_property(const TypeInterface &p_itype, const PropertyInterface &p_iprop, StringBuilder &p_output);
-	Error _generate_cs_method(const TypeInterface &p_itype, const MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output);
+	bool _method_has_span_overload(const MethodInterface &p_imethod);
+	Error _generate_cs_method(const TypeInterface &p_itype, const MethodInterface &p_imethod, int &p_method_bind_count, StringBuilder &p_output, bool p_use_span_args = false);
 	Error _generate_cs_signal(const BindingsGenerator::TypeInterface &p_itype, const BindingsGenerator::SignalInterface &p_isignal, StringBuilder &p_output);
 
 	Error _generate_cs_native_calls(const InternalCall &p_icall, StringBuilder &r_output);
@@ -394,7 +394,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_byte_array ConvertSystemArrayToNativePackedByteArray(Span<byte> p_array)
+        public static godot_packed_byte_array ConvertSystemArrayToNativePackedByteArray(Span<byte> p_array)
+            => ConvertReadOnlySpanToNativePackedByteArray(p_array);
+
+        public static unsafe godot_packed_byte_array ConvertReadOnlySpanToNativePackedByteArray(
+            ReadOnlySpan<byte> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_byte_array();
@@ -417,7 +421,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_int32_array ConvertSystemArrayToNativePackedInt32Array(Span<int> p_array)
+        public static godot_packed_int32_array ConvertSystemArrayToNativePackedInt32Array(Span<int> p_array)
+            => ConvertReadOnlySpanToNativePackedInt32Array(p_array);
+
+        public static unsafe godot_packed_int32_array ConvertReadOnlySpanToNativePackedInt32Array(
+            ReadOnlySpan<int> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_int32_array();
@@ -440,7 +448,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_int64_array ConvertSystemArrayToNativePackedInt64Array(Span<long> p_array)
+        public static godot_packed_int64_array ConvertSystemArrayToNativePackedInt64Array(Span<long> p_array)
+            => ConvertReadOnlySpanToNativePackedInt64Array(p_array);
+
+        public static unsafe godot_packed_int64_array ConvertReadOnlySpanToNativePackedInt64Array(
+            ReadOnlySpan<long> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_int64_array();
@@ -463,8 +475,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_float32_array ConvertSystemArrayToNativePackedFloat32Array(
-            Span<float> p_array)
+        public static godot_packed_float32_array ConvertSystemArrayToNativePackedFloat32Array(Span<float> p_array)
+            => ConvertReadOnlySpanToNativePackedFloat32Array(p_array);
+
+        public static unsafe godot_packed_float32_array ConvertReadOnlySpanToNativePackedFloat32Array(
+            ReadOnlySpan<float> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_float32_array();
@@ -487,8 +502,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_float64_array ConvertSystemArrayToNativePackedFloat64Array(
-            Span<double> p_array)
+        public static godot_packed_float64_array ConvertSystemArrayToNativePackedFloat64Array(Span<double> p_array)
+            => ConvertReadOnlySpanToNativePackedFloat64Array(p_array);
+
+        public static unsafe godot_packed_float64_array ConvertReadOnlySpanToNativePackedFloat64Array(
+            ReadOnlySpan<double> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_float64_array();
@@ -544,8 +562,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_vector2_array ConvertSystemArrayToNativePackedVector2Array(
-            Span<Vector2> p_array)
+        public static godot_packed_vector2_array ConvertSystemArrayToNativePackedVector2Array(Span<Vector2> p_array)
+            => ConvertReadOnlySpanToNativePackedVector2Array(p_array);
+
+        public static unsafe godot_packed_vector2_array ConvertReadOnlySpanToNativePackedVector2Array(
+            ReadOnlySpan<Vector2> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_vector2_array();
@@ -568,8 +589,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_vector3_array ConvertSystemArrayToNativePackedVector3Array(
-            Span<Vector3> p_array)
+        public static godot_packed_vector3_array ConvertSystemArrayToNativePackedVector3Array(Span<Vector3> p_array)
+            => ConvertReadOnlySpanToNativePackedVector3Array(p_array);
+
+        public static unsafe godot_packed_vector3_array ConvertReadOnlySpanToNativePackedVector3Array(
+            ReadOnlySpan<Vector3> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_vector3_array();
@@ -592,8 +616,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_vector4_array ConvertSystemArrayToNativePackedVector4Array(
-            Span<Vector4> p_array)
+        public static godot_packed_vector4_array ConvertSystemArrayToNativePackedVector4Array(Span<Vector4> p_array)
+            => ConvertReadOnlySpanToNativePackedVector4Array(p_array);
+
+        public static unsafe godot_packed_vector4_array ConvertReadOnlySpanToNativePackedVector4Array(
+            ReadOnlySpan<Vector4> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_vector4_array();
@@ -616,7 +643,11 @@ namespace Godot.NativeInterop
             return array;
         }
 
-        public static unsafe godot_packed_color_array ConvertSystemArrayToNativePackedColorArray(Span<Color> p_array)
+        public static godot_packed_color_array ConvertSystemArrayToNativePackedColorArray(Span<Color> p_array)
+            => ConvertReadOnlySpanToNativePackedColorArray(p_array);
+
+        public static unsafe godot_packed_color_array ConvertReadOnlySpanToNativePackedColorArray(
+            ReadOnlySpan<Color> p_array)
         {
             if (p_array.IsEmpty)
                 return new godot_packed_color_array();
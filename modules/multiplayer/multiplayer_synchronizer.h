@@ -59,6 +59,8 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool spatial_interest = false;
+	real_t sync_priority = 1.0;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -117,6 +119,11 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_spatial_interest(bool p_enabled);
+	bool is_spatial_interest() const;
+	void set_sync_priority(real_t p_priority);
+	real_t get_sync_priority() const;
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
@@ -72,6 +72,11 @@ Error SceneMultiplayer::poll() {
 		return OK;
 	}
 
+	if (last_connection_status == MultiplayerPeer::CONNECTION_CONNECTED) {
+		// Send what was queued since the last poll, so the peer can service it right away.
+		_flush_batches();
+	}
+
 	multiplayer_peer->poll();
 
 	_update_status();
@@ -173,6 +178,7 @@ void SceneMultiplayer::clear() {
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	batches.clear();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -259,7 +265,7 @@ _FORCE_INLINE_ Error SceneMultiplayer::_send(const uint8_t *p_packet, int p_pack
 }
 #endif
 
-Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_packet_len) {
+Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_packet_len, bool p_immediate) {
 	if (server_relay && get_unique_id() != 1 && p_to != 1 && multiplayer_peer->is_server_relay_supported()) {
 		// Send relay packet.
 		relay_buffer->seek(0);
@@ -267,26 +273,87 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 		relay_buffer->put_u8(SYS_COMMAND_RELAY);
 		relay_buffer->put_32(p_to); // Set the destination.
 		relay_buffer->put_data(p_packet, p_packet_len);
-		multiplayer_peer->set_target_peer(1);
 		const Vector<uint8_t> data = relay_buffer->get_data_array();
-		return _send(data.ptr(), relay_buffer->get_position());
+		return _send_to(1, data.ptr(), relay_buffer->get_position(), p_immediate);
 	}
 	if (p_to > 0) {
 		ERR_FAIL_COND_V(!connected_peers.has(p_to), ERR_BUG);
-		multiplayer_peer->set_target_peer(p_to);
-		return _send(p_packet, p_packet_len);
+		return _send_to(p_to, p_packet, p_packet_len, p_immediate);
 	} else {
 		for (const int &pid : connected_peers) {
 			if (p_to && pid == -p_to) {
 				continue;
 			}
-			multiplayer_peer->set_target_peer(pid);
-			_send(p_packet, p_packet_len);
+			_send_to(pid, p_packet, p_packet_len, p_immediate);
 		}
 		return OK;
 	}
 }
 
+Error SceneMultiplayer::_send_to(int p_peer, const uint8_t *p_packet, int p_packet_len, bool p_immediate) {
+	if (!send_batching) {
+		multiplayer_peer->set_target_peer(p_peer);
+		return _send(p_packet, p_packet_len);
+	}
+	const int channel = multiplayer_peer->get_transfer_channel();
+	const MultiplayerPeer::TransferMode mode = multiplayer_peer->get_transfer_mode();
+	const uint64_t key = (uint64_t(uint32_t(p_peer)) << 32) | (uint64_t(uint16_t(channel)) << 8) | uint64_t(mode);
+	Batch *batch = batches.getptr(key);
+	if (p_immediate || SYS_CMD_SIZE + BATCH_MSG_HEADER_SIZE + p_packet_len > batch_mtu) {
+		// Can't be batched, but must not overtake what was queued before it.
+		if (batch && batch->count) {
+			_send_batch(*batch);
+		}
+		multiplayer_peer->set_target_peer(p_peer);
+		return _send(p_packet, p_packet_len);
+	}
+	if (!batch) {
+		batch = &batches.insert(key, Batch())->value;
+		batch->peer = p_peer;
+		batch->channel = channel;
+		batch->mode = mode;
+	}
+	if (batch->data.size() + BATCH_MSG_HEADER_SIZE + p_packet_len > uint32_t(batch_mtu)) {
+		// Full, send it and start a new one.
+		_send_batch(*batch);
+	}
+	if (batch->data.is_empty()) {
+		batch->data.resize(SYS_CMD_SIZE);
+		batch->data[0] = NETWORK_COMMAND_SYS;
+		batch->data[1] = SYS_COMMAND_BATCH;
+	}
+	const uint32_t ofs = batch->data.size();
+	batch->data.resize(ofs + BATCH_MSG_HEADER_SIZE + p_packet_len);
+	encode_uint16(p_packet_len, &batch->data[ofs]);
+	memcpy(&batch->data[ofs + BATCH_MSG_HEADER_SIZE], p_packet, p_packet_len);
+	batch->count++;
+	return OK;
+}
+
+void SceneMultiplayer::_send_batch(Batch &p_batch) {
+	multiplayer_peer->set_target_peer(p_batch.peer);
+	multiplayer_peer->set_transfer_channel(p_batch.channel);
+	multiplayer_peer->set_transfer_mode(p_batch.mode);
+	if (p_batch.count == 1) {
+		// No need for the batch header.
+		const int ofs = SYS_CMD_SIZE + BATCH_MSG_HEADER_SIZE;
+		_send(&p_batch.data[ofs], p_batch.data.size() - ofs);
+	} else {
+		encode_uint32(p_batch.count, &p_batch.data[2]);
+		_send(p_batch.data.ptr(), p_batch.data.size());
+	}
+	p_batch.count = 0;
+	p_batch.data.clear();
+}
+
+void SceneMultiplayer::_flush_batches() {
+	for (KeyValue<uint64_t, Batch> &E : batches) {
+		if (E.value.count) {
+			_send_batch(E.value);
+		}
+	}
+}
+
 void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel) {
 	ERR_FAIL_COND_MSG(p_packet_len < SYS_CMD_SIZE, "Invalid packet received. Size too small.");
 	uint8_t sys_cmd_type = p_packet[1];
@@ -321,16 +388,14 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				multiplayer_peer->set_transfer_mode(p_mode);
 				multiplayer_peer->set_transfer_channel(p_channel);
 				if (peer > 0) {
-					multiplayer_peer->set_target_peer(peer);
-					_send(data.ptr(), relay_buffer->get_position());
+					_send_to(peer, data.ptr(), relay_buffer->get_position(), false);
 				} else {
 					for (const int &P : connected_peers) {
 						// Not to sender, nor excluded.
 						if (P == p_from || (peer < 0 && P != -peer)) {
 							continue;
 						}
-						multiplayer_peer->set_target_peer(P);
-						_send(data.ptr(), relay_buffer->get_position());
+						_send_to(P, data.ptr(), relay_buffer->get_position(), false);
 					}
 				}
 				if (peer == 0 || peer == -1) {
@@ -347,12 +412,41 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				remote_sender_id = 0;
 			}
 		} break;
+		case SYS_COMMAND_BATCH: {
+			_process_batch(p_from, p_packet, p_packet_len, p_mode, p_channel);
+		} break;
 		default: {
 			ERR_FAIL();
 		}
 	}
 }
 
+void SceneMultiplayer::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel) {
+	// The peer field holds the number of batched messages.
+	const uint32_t count = decode_uint32(&p_packet[2]);
+	int ofs = SYS_CMD_SIZE;
+	for (uint32_t i = 0; i < count; i++) {
+		ERR_FAIL_COND_MSG(ofs + BATCH_MSG_HEADER_SIZE > p_packet_len, "Invalid batch received. Size smaller than declared.");
+		const int len = decode_uint16(&p_packet[ofs]);
+		ofs += BATCH_MSG_HEADER_SIZE;
+		ERR_FAIL_COND_MSG(len < 1 || ofs + len > p_packet_len, "Invalid batch received. Size smaller than declared.");
+		const uint8_t *packet = &p_packet[ofs];
+		ofs += len;
+		if ((packet[0] & CMD_MASK) == NETWORK_COMMAND_SYS) {
+			ERR_FAIL_COND_MSG(len < 2 || packet[1] == SYS_COMMAND_AUTH || packet[1] == SYS_COMMAND_BATCH, "Invalid batch received. Unexpected system command.");
+			_process_sys(p_from, packet, len, p_mode, p_channel);
+		} else {
+			remote_sender_id = p_from;
+			_process_packet(p_from, packet, len);
+			remote_sender_id = 0;
+		}
+		_update_status();
+		if (last_connection_status != MultiplayerPeer::CONNECTION_CONNECTED) { // Processing a message might have resulted in a disconnection.
+			return;
+		}
+	}
+}
+
 void SceneMultiplayer::_add_peer(int p_id) {
 	if (auth_callback.is_valid()) {
 		pending_peers[p_id] = PendingPeer();
@@ -366,6 +460,7 @@ void SceneMultiplayer::_add_peer(int p_id) {
 
 void SceneMultiplayer::_admit_peer(int p_id) {
 	if (server_relay && get_unique_id() == 1 && multiplayer_peer->is_server_relay_supported()) {
+		_flush_batches(); // Keep queued messages ordered before the notification.
 		// Notify others of connection, and send connected peers to newly connected one.
 		uint8_t buf[SYS_CMD_SIZE];
 		buf[0] = NETWORK_COMMAND_SYS;
@@ -402,7 +497,16 @@ void SceneMultiplayer::_del_peer(int p_id) {
 		return;
 	}
 
+	for (KeyValue<uint64_t, Batch> &E : batches) {
+		if (E.value.peer == p_id) {
+			// Can't be delivered anymore.
+			E.value.count = 0;
+			E.value.data.clear();
+		}
+	}
+
 	if (server_relay && get_unique_id() == 1 && multiplayer_peer->is_server_relay_supported()) {
+		_flush_batches(); // Relayed messages from the peer must arrive before the notification.
 		// Notify others of disconnection.
 		uint8_t buf[SYS_CMD_SIZE];
 		buf[0] = NETWORK_COMMAND_SYS;
@@ -618,6 +722,26 @@ bool SceneMultiplayer::is_server_relay_enabled() const {
 	return server_relay;
 }
 
+void SceneMultiplayer::set_send_batching_enabled(bool p_enabled) {
+	if (send_batching && !p_enabled && last_connection_status == MultiplayerPeer::CONNECTION_CONNECTED) {
+		_flush_batches();
+	}
+	send_batching = p_enabled;
+}
+
+bool SceneMultiplayer::is_send_batching_enabled() const {
+	return send_batching;
+}
+
+void SceneMultiplayer::set_max_batch_packet_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 128, "Batch maximum packet size must be at least 128 bytes.");
+	batch_mtu = p_size;
+}
+
+int SceneMultiplayer::get_max_batch_packet_size() const {
+	return batch_mtu;
+}
+
 void SceneMultiplayer::set_max_sync_packet_size(int p_size) {
 	replicator->set_max_sync_packet_size(p_size);
 }
@@ -634,6 +758,30 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_max_sync_bandwidth(int p_bytes) {
+	replicator->set_max_sync_bandwidth(p_bytes);
+}
+
+int SceneMultiplayer::get_max_sync_bandwidth() const {
+	return replicator->get_max_sync_bandwidth();
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
+void SceneMultiplayer::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	replicator->set_peer_interest(p_peer, p_origin, p_radius);
+}
+
+void SceneMultiplayer::clear_peer_interest(int p_peer) {
+	replicator->clear_peer_interest(p_peer);
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -658,10 +806,20 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_server_relay_enabled"), &SceneMultiplayer::is_server_relay_enabled);
 	ClassDB::bind_method(D_METHOD("send_bytes", "bytes", "id", "mode", "channel"), &SceneMultiplayer::send_bytes, DEFVAL(MultiplayerPeer::TARGET_PEER_BROADCAST), DEFVAL(MultiplayerPeer::TRANSFER_MODE_RELIABLE), DEFVAL(0));
 
+	ClassDB::bind_method(D_METHOD("set_send_batching_enabled", "enabled"), &SceneMultiplayer::set_send_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_send_batching_enabled"), &SceneMultiplayer::is_send_batching_enabled);
+	ClassDB::bind_method(D_METHOD("get_max_batch_packet_size"), &SceneMultiplayer::get_max_batch_packet_size);
+	ClassDB::bind_method(D_METHOD("set_max_batch_packet_size", "size"), &SceneMultiplayer::set_max_batch_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_sync_packet_size"), &SceneMultiplayer::get_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("get_max_sync_bandwidth"), &SceneMultiplayer::get_max_sync_bandwidth);
+	ClassDB::bind_method(D_METHOD("set_max_sync_bandwidth", "bytes"), &SceneMultiplayer::set_max_sync_bandwidth);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_peer_interest", "peer", "origin", "radius"), &SceneMultiplayer::set_peer_interest);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest", "peer"), &SceneMultiplayer::clear_peer_interest);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -669,8 +827,12 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_object_decoding"), "set_allow_object_decoding", "is_object_decoding_allowed");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "refuse_new_connections"), "set_refuse_new_connections", "is_refusing_new_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "send_batching"), "set_send_batching_enabled", "is_send_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_batch_packet_size"), "set_max_batch_packet_size", "get_max_batch_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_bandwidth", PROPERTY_HINT_RANGE, "0,65536,1,or_greater,suffix:B"), "set_max_sync_bandwidth", "get_max_sync_bandwidth");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "0.01,1024,0.01,or_greater"), "set_interest_cell_size", "get_interest_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
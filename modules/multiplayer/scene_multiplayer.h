@@ -82,10 +82,12 @@ public:
 		SYS_COMMAND_ADD_PEER,
 		SYS_COMMAND_DEL_PEER,
 		SYS_COMMAND_RELAY,
+		SYS_COMMAND_BATCH,
 	};
 
 	enum {
 		SYS_CMD_SIZE = 6, // Command + sys command + peer_id (+ optional payload).
+		BATCH_MSG_HEADER_SIZE = 2, // Size of each message in a batch.
 	};
 
 	// For each command, the 4 MSB can contain custom flags, as defined by subsystems.
@@ -108,6 +110,15 @@ private:
 		uint64_t time = 0;
 	};
 
+	// Messages queued for the same peer, channel, and transfer mode, sent as a single packet on flush.
+	struct Batch {
+		int peer = 0;
+		int channel = 0;
+		MultiplayerPeer::TransferMode mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		uint32_t count = 0;
+		LocalVector<uint8_t> data;
+	};
+
 	Ref<MultiplayerPeer> multiplayer_peer;
 	MultiplayerPeer::ConnectionStatus last_connection_status = MultiplayerPeer::CONNECTION_DISCONNECTED;
 	HashMap<int, PendingPeer> pending_peers; // true if locally finalized.
@@ -123,6 +134,9 @@ private:
 	bool allow_object_decoding = false;
 	bool server_relay = true;
 	Ref<StreamPeerBuffer> relay_buffer;
+	bool send_batching = false;
+	int batch_mtu = 1350;
+	HashMap<uint64_t, Batch> batches;
 
 	Ref<SceneCacheInterface> cache;
 	Ref<SceneReplicationInterface> replicator;
@@ -143,6 +157,11 @@ protected:
 	void _process_packet(int p_from, const uint8_t *p_packet, int p_packet_len);
 	void _process_raw(int p_from, const uint8_t *p_packet, int p_packet_len);
 	void _process_sys(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel);
+
+	Error _send_to(int p_peer, const uint8_t *p_packet, int p_packet_len, bool p_immediate);
+	void _send_batch(Batch &p_batch);
+	void _flush_batches();
 
 	void _add_peer(int p_id);
 	void _admit_peer(int p_id);
@@ -179,7 +198,7 @@ public:
 	double get_auth_timeout() const;
 	Vector<int> get_authenticating_peer_ids();
 
-	Error send_command(int p_to, const uint8_t *p_packet, int p_packet_len); // Used internally to relay packets when needed.
+	Error send_command(int p_to, const uint8_t *p_packet, int p_packet_len, bool p_immediate = false); // Used internally to relay and batch packets when needed.
 	Error send_bytes(Vector<uint8_t> p_data, int p_to = MultiplayerPeer::TARGET_PEER_BROADCAST, MultiplayerPeer::TransferMode p_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE, int p_channel = 0);
 	String get_rpc_md5(const Object *p_obj);
 
@@ -195,12 +214,26 @@ public:
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
 
+	void set_send_batching_enabled(bool p_enabled);
+	bool is_send_batching_enabled() const;
+
+	void set_max_batch_packet_size(int p_size);
+	int get_max_batch_packet_size() const;
+
 	void set_max_sync_packet_size(int p_size);
 	int get_max_sync_packet_size() const;
 
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_max_sync_bandwidth(int p_bytes);
+	int get_max_sync_bandwidth() const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
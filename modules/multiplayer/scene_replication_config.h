@@ -32,6 +32,7 @@
 #define SCENE_REPLICATION_CONFIG_H
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 class SceneReplicationConfig : public Resource {
@@ -46,11 +47,26 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	enum QuantizationMode {
+		QUANTIZATION_NONE,
+		QUANTIZATION_HALF,
+		QUANTIZATION_RANGE,
+		QUANTIZATION_QUATERNION,
+	};
+
+	struct Quantization {
+		QuantizationMode mode = QUANTIZATION_NONE;
+		int bits = 16;
+		real_t min = -1024;
+		real_t max = 1024;
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		Quantization quantization;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -67,6 +83,9 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	// Parallel to sync_props and watch_props, left empty when none of those properties are quantized.
+	LocalVector<Quantization> sync_quantization;
+	LocalVector<Quantization> watch_quantization;
 	bool dirty = false;
 
 	void _update();
@@ -100,13 +119,27 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	QuantizationMode property_get_quantization(const NodePath &p_path);
+	void property_set_quantization(const NodePath &p_path, QuantizationMode p_mode);
+
+	int property_get_quantization_bits(const NodePath &p_path);
+	void property_set_quantization_bits(const NodePath &p_path, int p_bits);
+
+	Vector2 property_get_quantization_range(const NodePath &p_path);
+	void property_set_quantization_range(const NodePath &p_path, const Vector2 &p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
 
+	// Return nullptr when the properties are sent without quantization.
+	const LocalVector<Quantization> *get_sync_quantization();
+	const LocalVector<Quantization> *get_watch_quantization();
+
 	SceneReplicationConfig() {}
 };
 
 VARIANT_ENUM_CAST(SceneReplicationConfig::ReplicationMode);
+VARIANT_ENUM_CAST(SceneReplicationConfig::QuantizationMode);
 
 #endif // SCENE_REPLICATION_CONFIG_H
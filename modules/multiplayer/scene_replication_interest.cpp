@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  scene_replication_interest.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_interest.h"
+
+#include "core/error/error_macros.h"
+
+Vector3i SceneReplicationInterest::_get_cell(const Vector3 &p_position) const {
+	return Vector3i(Math::floor(p_position.x / cell_size), Math::floor(p_position.y / cell_size), Math::floor(p_position.z / cell_size));
+}
+
+void SceneReplicationInterest::_query(const Region &p_region, HashSet<ObjectID> &r_result) const {
+	const Vector3 extents(p_region.radius, p_region.radius, p_region.radius);
+	const Vector3i from = _get_cell(p_region.origin - extents);
+	const Vector3i to = _get_cell(p_region.origin + extents);
+	const real_t radius_sq = p_region.radius * p_region.radius;
+	const int64_t range_cells = int64_t(to.x - from.x + 1) * (to.y - from.y + 1) * (to.z - from.z + 1);
+	if (range_cells > int64_t(cells.size())) {
+		// The region covers more cells than there are in use, walking the occupied ones is cheaper.
+		for (const KeyValue<Vector3i, HashSet<ObjectID>> &E : cells) {
+			if (E.key.x < from.x || E.key.y < from.y || E.key.z < from.z || E.key.x > to.x || E.key.y > to.y || E.key.z > to.z) {
+				continue;
+			}
+			for (const ObjectID &id : E.value) {
+				if (p_region.origin.distance_squared_to(entities[id].position) <= radius_sq) {
+					r_result.insert(id);
+				}
+			}
+		}
+		return;
+	}
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = from.z; z <= to.z; z++) {
+				const HashSet<ObjectID> *cell = cells.getptr(Vector3i(x, y, z));
+				if (!cell) {
+					continue;
+				}
+				for (const ObjectID &id : *cell) {
+					if (p_region.origin.distance_squared_to(entities[id].position) <= radius_sq) {
+						r_result.insert(id);
+					}
+				}
+			}
+		}
+	}
+}
+
+void SceneReplicationInterest::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Interest cell size must be greater than zero.");
+	if (cell_size == p_size) {
+		return;
+	}
+	cell_size = p_size;
+	// Only the grid depends on the cell size, relevance stays the same.
+	cells.clear();
+	for (KeyValue<ObjectID, Entity> &E : entities) {
+		E.value.cell = _get_cell(E.value.position);
+		cells[E.value.cell].insert(E.key);
+	}
+}
+
+void SceneReplicationInterest::update_entity(const ObjectID &p_id, const Vector3 &p_position) {
+	Entity *entity = entities.getptr(p_id);
+	if (!entity) {
+		Entity new_entity;
+		new_entity.position = p_position;
+		new_entity.cell = _get_cell(p_position);
+		cells[new_entity.cell].insert(p_id);
+		entities.insert(p_id, new_entity);
+		moved.insert(p_id);
+		return;
+	}
+	if (entity->position == p_position) {
+		return;
+	}
+	entity->position = p_position;
+	const Vector3i cell = _get_cell(p_position);
+	if (cell != entity->cell) {
+		HashSet<ObjectID> &old_cell = cells[entity->cell];
+		old_cell.erase(p_id);
+		if (old_cell.is_empty()) {
+			cells.erase(entity->cell);
+		}
+		entity->cell = cell;
+		cells[cell].insert(p_id);
+	}
+	moved.insert(p_id);
+}
+
+void SceneReplicationInterest::remove_entity(const ObjectID &p_id) {
+	const Entity *entity = entities.getptr(p_id);
+	if (!entity) {
+		return;
+	}
+	HashSet<ObjectID> &cell = cells[entity->cell];
+	cell.erase(p_id);
+	if (cell.is_empty()) {
+		cells.erase(entity->cell);
+	}
+	entities.erase(p_id);
+	moved.erase(p_id);
+	for (KeyValue<int, Region> &E : regions) {
+		E.value.relevant.erase(p_id);
+	}
+}
+
+void SceneReplicationInterest::set_region(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Interest radius must be positive.");
+	Region &region = regions[p_peer];
+	if (!region.dirty && region.origin == p_origin && region.radius == p_radius) {
+		return;
+	}
+	region.origin = p_origin;
+	region.radius = p_radius;
+	region.dirty = true;
+}
+
+void SceneReplicationInterest::remove_region(int p_peer) {
+	regions.erase(p_peer);
+}
+
+bool SceneReplicationInterest::is_relevant(int p_peer, const ObjectID &p_id) const {
+	const Region *region = regions.getptr(p_peer);
+	return !region || region->relevant.has(p_id);
+}
+
+real_t SceneReplicationInterest::get_relevance(int p_peer, const ObjectID &p_id) const {
+	const Region *region = regions.getptr(p_peer);
+	const Entity *entity = entities.getptr(p_id);
+	if (!region || !entity || region->radius <= 0) {
+		return 1.0;
+	}
+	return CLAMP(1.0 - region->origin.distance_to(entity->position) / region->radius, 0.0, 1.0);
+}
+
+void SceneReplicationInterest::flush(LocalVector<Change> &r_changes) {
+	for (KeyValue<int, Region> &E : regions) {
+		Region &region = E.value;
+		if (region.dirty) {
+			// The region changed, query the grid again and diff the result.
+			HashSet<ObjectID> relevant;
+			_query(region, relevant);
+			for (const ObjectID &id : relevant) {
+				if (!region.relevant.has(id)) {
+					r_changes.push_back({ E.key, id, true });
+				}
+			}
+			for (const ObjectID &id : region.relevant) {
+				if (!relevant.has(id)) {
+					r_changes.push_back({ E.key, id, false });
+				}
+			}
+			region.relevant = relevant;
+			region.dirty = false;
+			continue;
+		}
+		// Only the entities that moved since the last flush may have entered or left the region.
+		const real_t radius_sq = region.radius * region.radius;
+		for (const ObjectID &id : moved) {
+			const bool inside = region.origin.distance_squared_to(entities[id].position) <= radius_sq;
+			if (inside == region.relevant.has(id)) {
+				continue;
+			}
+			if (inside) {
+				region.relevant.insert(id);
+			} else {
+				region.relevant.erase(id);
+			}
+			r_changes.push_back({ E.key, id, inside });
+		}
+	}
+	moved.clear();
+}
+
+void SceneReplicationInterest::clear() {
+	cells.clear();
+	entities.clear();
+	regions.clear();
+	moved.clear();
+}
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  scene_replication_interest.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_REPLICATION_INTEREST_H
+#define SCENE_REPLICATION_INTEREST_H
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Spatial interest management for replicated nodes.
+// Entities are bucketed in a uniform grid, and each peer with an interest region only sees the entities inside it.
+// Updates are incremental: only moved entities are checked against unchanged regions.
+class SceneReplicationInterest {
+public:
+	struct Change {
+		int peer = 0;
+		ObjectID id;
+		bool relevant = false;
+	};
+
+private:
+	struct Entity {
+		Vector3 position;
+		Vector3i cell;
+	};
+
+	struct Region {
+		Vector3 origin;
+		real_t radius = 0;
+		bool dirty = true;
+		HashSet<ObjectID> relevant;
+	};
+
+	real_t cell_size = 32;
+	HashMap<Vector3i, HashSet<ObjectID>> cells;
+	HashMap<ObjectID, Entity> entities;
+	HashMap<int, Region> regions;
+	HashSet<ObjectID> moved;
+
+	Vector3i _get_cell(const Vector3 &p_position) const;
+	void _query(const Region &p_region, HashSet<ObjectID> &r_result) const;
+
+public:
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const { return cell_size; }
+
+	bool has_entity(const ObjectID &p_id) const { return entities.has(p_id); }
+	void update_entity(const ObjectID &p_id, const Vector3 &p_position);
+	void remove_entity(const ObjectID &p_id);
+
+	bool has_region(int p_peer) const { return regions.has(p_peer); }
+	bool has_regions() const { return !regions.is_empty(); }
+	void set_region(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void remove_region(int p_peer);
+
+	bool is_relevant(int p_peer, const ObjectID &p_id) const;
+	real_t get_relevance(int p_peer, const ObjectID &p_id) const;
+
+	void flush(LocalVector<Change> &r_changes);
+	void clear();
+};
+
+#endif // SCENE_REPLICATION_INTEREST_H
@@ -31,11 +31,17 @@
 #include "scene_replication_interface.h"
 
 #include "scene_multiplayer.h"
+#include "scene_replication_quantizer.h"
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/node.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif
+
 #define MAKE_ROOM(m_amount)             \
 	if (packet_cache.size() < m_amount) \
 		packet_cache.resize(m_amount);
@@ -105,6 +111,7 @@ void SceneReplicationInterface::on_peer_change(int p_id, bool p_connected) {
 		ERR_FAIL_COND(!peers_info.has(p_id));
 		_free_remotes(peers_info[p_id]);
 		peers_info.erase(p_id);
+		interest.remove_region(p_id);
 	}
 }
 
@@ -113,6 +120,7 @@ void SceneReplicationInterface::on_reset() {
 		_free_remotes(E.value);
 	}
 	peers_info.clear();
+	interest.clear();
 	// Tracked nodes are cleared on deletion, here we only reset the ids so they can be later re-assigned.
 	for (KeyValue<ObjectID, TrackedNode> &E : tracked_nodes) {
 		TrackedNode &tobj = E.value;
@@ -141,6 +149,9 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	// Update spatial interest before deciding what to sync.
+	_update_interest();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
@@ -280,9 +291,11 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	interest.remove_entity(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.sync_deferred.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -302,6 +315,61 @@ void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid)
 	_update_sync_visibility(p_peer, sync);
 }
 
+bool SceneReplicationInterface::_is_in_interest(const MultiplayerSynchronizer *p_sync, int p_peer) const {
+	const ObjectID sid = p_sync->get_instance_id();
+	if (!interest.has_entity(sid)) {
+		return true; // Not spatially managed.
+	}
+	if (p_peer == 0) {
+		return !interest.has_regions(); // Can't be visible to everyone when peers have their own regions.
+	}
+	return interest.is_relevant(p_peer, sid);
+}
+
+bool SceneReplicationInterface::_get_interest_position(Node *p_node, Vector3 &r_position) {
+	if (!p_node || !p_node->is_inside_tree()) {
+		return false;
+	}
+#ifndef _3D_DISABLED
+	if (Node3D *node_3d = Object::cast_to<Node3D>(p_node)) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+#endif
+	if (Node2D *node_2d = Object::cast_to<Node2D>(p_node)) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+void SceneReplicationInterface::_update_interest() {
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		Vector3 position;
+		if (sync->is_spatial_interest() && _has_authority(sync) && _get_interest_position(sync->get_root_node(), position)) {
+			interest.update_entity(sid, position);
+		} else if (interest.has_entity(sid)) {
+			// No longer spatially managed, fall back to the regular visibility rules.
+			interest.remove_entity(sid);
+			_visibility_changed(0, sid);
+		}
+	}
+	_flush_interest();
+}
+
+void SceneReplicationInterface::_flush_interest() {
+	LocalVector<SceneReplicationInterest::Change> changes;
+	interest.flush(changes);
+	for (const SceneReplicationInterest::Change &change : changes) {
+		if (peers_info.has(change.peer)) {
+			_visibility_changed(change.peer, change.id);
+		}
+	}
+}
+
 bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer) const {
 	if (!tracked_nodes.has(p_oid)) {
 		return true; // Untracked nodes are always visible to RPCs.
@@ -333,7 +401,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (_is_in_interest(sync, p_peer) && sync->is_visible_to(p_peer)) {
 				return true;
 			}
 		}
@@ -348,11 +416,11 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	}
 
 	const ObjectID &sid = p_sync->get_instance_id();
-	bool is_visible = p_sync->is_visible_to(p_peer);
 	if (p_peer == 0) {
+		bool is_visible = p_sync->is_visible_to(p_peer);
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
-			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			// Might be visible to this specific peer, spatial interest is checked first to skip the filters when out of range.
+			bool is_visible_to_peer = _is_in_interest(p_sync, E.key) && (is_visible || p_sync->is_visible_to(E.key));
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -361,11 +429,13 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.sync_deferred.erase(sid);
 			}
 		}
 		return OK;
 	} else {
 		ERR_FAIL_COND_V(!peers_info.has(p_peer), ERR_INVALID_PARAMETER);
+		bool is_visible = _is_in_interest(p_sync, p_peer) && p_sync->is_visible_to(p_peer);
 		if (is_visible == peers_info[p_peer].sync_nodes.has(sid)) {
 			return OK;
 		}
@@ -374,6 +444,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].sync_deferred.erase(sid);
 		}
 		return OK;
 	}
@@ -397,7 +468,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (_is_in_interest(sync, p_peer) && sync->is_visible_to(p_peer)) {
 			is_visible = true;
 			break;
 		}
@@ -708,6 +779,20 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 	return sync;
 }
 
+const LocalVector<SceneReplicationConfig::Quantization> *SceneReplicationInterface::_get_delta_quantization(MultiplayerSynchronizer *p_sync, uint64_t p_indexes, LocalVector<SceneReplicationConfig::Quantization> &r_quantization) {
+	const LocalVector<SceneReplicationConfig::Quantization> *watch_quantization = p_sync->get_replication_config_ptr()->get_watch_quantization();
+	if (!watch_quantization) {
+		return nullptr;
+	}
+	// Deltas only contain the changed properties, in the order of the watched ones.
+	for (uint32_t i = 0; i < watch_quantization->size() && i < 64; i++) {
+		if (p_indexes & (1ULL << i)) {
+			r_quantization.push_back((*watch_quantization)[i]);
+		}
+	}
+	return &r_quantization;
+}
+
 void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
 	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
@@ -736,8 +821,10 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			vptr[i] = &v;
 			i++;
 		}
+		LocalVector<SceneReplicationConfig::Quantization> delta_quantization;
+		const LocalVector<SceneReplicationConfig::Quantization> *quantization = _get_delta_quantization(sync, indexes, delta_quantization);
 		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		Error err = SceneReplicationQuantizer::encode_state(vptr, varp.size(), quantization, nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
@@ -751,7 +838,7 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint64(indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			SceneReplicationQuantizer::encode_state(vptr, varp.size(), quantization, &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -785,8 +872,10 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
 		Vector<Variant> vars;
 		vars.resize(props.size());
+		LocalVector<SceneReplicationConfig::Quantization> delta_quantization;
+		const LocalVector<SceneReplicationConfig::Quantization> *quantization = _get_delta_quantization(sync, indexes, delta_quantization);
 		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err = SceneReplicationQuantizer::decode_state(vars, quantization, p_buffer + ofs, size, consumed);
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
@@ -806,15 +895,33 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC;
 	int ofs = 1;
 	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
-	// Can only send updates for already notified nodes.
-	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+	PeerInfo &info = peers_info[p_peer];
+	// Collect the synchronizers due this frame, plus the ones held back by the bandwidth limit in previous frames.
+	LocalVector<SyncCandidate> candidates;
 	for (const ObjectID &oid : p_synchronizers) {
 		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
 		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
-		if (!sync->update_outbound_sync_time(p_usec)) {
+		const real_t *deferred = info.sync_deferred.getptr(oid);
+		if (!sync->update_outbound_sync_time(p_usec) && !deferred) {
 			continue; // nothing to sync.
 		}
-
+		SyncCandidate candidate;
+		candidate.sync = sync;
+		if (sync_bandwidth > 0) {
+			// Closer entities are more relevant, deferred ones accumulate priority so they are not starved.
+			candidate.score = sync->get_sync_priority() * (1.0 + interest.get_relevance(p_peer, oid)) + (deferred ? *deferred : 0);
+		}
+		candidates.push_back(candidate);
+	}
+	if (sync_bandwidth > 0) {
+		candidates.sort_custom<SyncCandidateSort>();
+	}
+	int budget = sync_bandwidth;
+	// Can only send updates for already notified nodes.
+	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+	for (const SyncCandidate &candidate : candidates) {
+		MultiplayerSynchronizer *sync = candidate.sync;
+		const ObjectID oid = sync->get_instance_id();
 		Node *node = sync->get_root_node();
 		ERR_CONTINUE(!node);
 		uint32_t net_id = sync->get_net_id();
@@ -826,12 +933,22 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+		const LocalVector<SceneReplicationConfig::Quantization> *quantization = sync->get_replication_config_ptr()->get_sync_quantization();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		err = SceneReplicationQuantizer::encode_state(varp.ptrw(), varp.size(), quantization, nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (sync_bandwidth > 0) {
+			if (budget < 4 + 4 + size && budget < sync_bandwidth) {
+				// Over budget for this frame, try again next frame with a higher priority.
+				info.sync_deferred[oid] = candidate.score;
+				continue;
+			}
+			budget -= 4 + 4 + size;
+			info.sync_deferred.erase(oid);
+		}
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -840,7 +957,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			SceneReplicationQuantizer::encode_state(varp.ptrw(), varp.size(), quantization, &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -885,10 +1002,11 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			continue;
 		}
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+		const LocalVector<SceneReplicationConfig::Quantization> *quantization = sync->get_replication_config_ptr()->get_sync_quantization();
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err = SceneReplicationQuantizer::decode_state(vars, quantization, &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
@@ -918,3 +1036,56 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_max_sync_bandwidth(int p_bytes) {
+	ERR_FAIL_COND_MSG(p_bytes < 0, "Sync bandwidth must be positive (where 0 means unlimited).");
+	sync_bandwidth = p_bytes;
+	if (sync_bandwidth == 0) {
+		for (KeyValue<int, PeerInfo> &E : peers_info) {
+			E.value.sync_deferred.clear();
+		}
+	}
+}
+
+int SceneReplicationInterface::get_max_sync_bandwidth() const {
+	return sync_bandwidth;
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	interest.set_cell_size(p_size);
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest.get_cell_size();
+}
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(!peers_info.has(p_peer), vformat("Unknown peer %d.", p_peer));
+	const bool is_new = !interest.has_region(p_peer);
+	interest.set_region(p_peer, p_origin, p_radius);
+	if (!is_new) {
+		return; // Changes are applied on the next network frame.
+	}
+	// Entities outside the new region were visible according to the regular rules, re-evaluate them all.
+	_update_interest();
+	for (const ObjectID &sid : sync_nodes) {
+		if (interest.has_entity(sid)) {
+			_visibility_changed(p_peer, sid);
+		}
+	}
+}
+
+void SceneReplicationInterface::clear_peer_interest(int p_peer) {
+	if (!interest.has_region(p_peer)) {
+		return;
+	}
+	interest.remove_region(p_peer);
+	if (!peers_info.has(p_peer)) {
+		return;
+	}
+	for (const ObjectID &sid : sync_nodes) {
+		if (interest.has_entity(sid)) {
+			_visibility_changed(p_peer, sid);
+		}
+	}
+}
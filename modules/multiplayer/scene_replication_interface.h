@@ -33,6 +33,7 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_replication_interest.h"
 
 #include "core/object/ref_counted.h"
 
@@ -64,6 +65,7 @@ private:
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
 		HashMap<ObjectID, uint64_t> last_watch_usecs;
+		HashMap<ObjectID, real_t> sync_deferred; // Synchronizers held back by the bandwidth limit, with their accumulated priority.
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
@@ -76,6 +78,9 @@ private:
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Spatial interest management.
+	SceneReplicationInterest interest;
+
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
 
@@ -92,6 +97,16 @@ private:
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	int sync_bandwidth = 0; // Sync bytes per peer per network frame, 0 means unlimited.
+
+	struct SyncCandidate {
+		MultiplayerSynchronizer *sync = nullptr;
+		real_t score = 0;
+	};
+
+	struct SyncCandidateSort {
+		_FORCE_INLINE_ bool operator()(const SyncCandidate &p_a, const SyncCandidate &p_b) const { return p_a.score > p_b.score; }
+	};
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
@@ -103,11 +118,16 @@ private:
 
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	static const LocalVector<SceneReplicationConfig::Quantization> *_get_delta_quantization(MultiplayerSynchronizer *p_sync, uint64_t p_indexes, LocalVector<SceneReplicationConfig::Quantization> &r_quantization);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
 
 	void _visibility_changed(int p_peer, ObjectID p_oid);
+	bool _is_in_interest(const MultiplayerSynchronizer *p_sync, int p_peer) const;
+	static bool _get_interest_position(Node *p_node, Vector3 &r_position);
+	void _update_interest();
+	void _flush_interest();
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
@@ -146,6 +166,14 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_max_sync_bandwidth(int p_bytes);
+	int get_max_sync_bandwidth() const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_interest(int p_peer);
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -0,0 +1,296 @@
+/**************************************************************************/
+/*  scene_replication_quantizer.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_quantizer.h"
+
+#include "scene/main/multiplayer_api.h"
+
+void SceneReplicationQuantizer::BitWriter::put(uint32_t p_value, int p_bits) {
+	for (int i = 0; i < p_bits; i++) {
+		if (buffer) {
+			uint8_t &byte = buffer[bit_count >> 3];
+			if ((bit_count & 7) == 0) {
+				byte = 0;
+			}
+			byte |= ((p_value >> i) & 1) << (bit_count & 7);
+		}
+		bit_count++;
+	}
+}
+
+uint32_t SceneReplicationQuantizer::BitReader::get(int p_bits) {
+	if (bit_pos + p_bits > bit_len) {
+		overflow = true;
+		return 0;
+	}
+	uint32_t value = 0;
+	for (int i = 0; i < p_bits; i++) {
+		value |= uint32_t((buffer[bit_pos >> 3] >> (bit_pos & 7)) & 1) << i;
+		bit_pos++;
+	}
+	return value;
+}
+
+SceneReplicationQuantizer::ValueTag SceneReplicationQuantizer::_get_tag(const Variant &p_value, SceneReplicationConfig::QuantizationMode p_mode) {
+	if (p_mode == SceneReplicationConfig::QUANTIZATION_QUATERNION) {
+		// Smallest three only applies to rotations.
+		return p_value.get_type() == Variant::QUATERNION ? TAG_QUATERNION : TAG_UNQUANTIZED;
+	}
+	switch (p_value.get_type()) {
+		case Variant::FLOAT:
+			return TAG_FLOAT;
+		case Variant::VECTOR2:
+			return TAG_VECTOR2;
+		case Variant::VECTOR3:
+			return TAG_VECTOR3;
+		case Variant::VECTOR4:
+			return TAG_VECTOR4;
+		case Variant::QUATERNION:
+			return TAG_QUATERNION;
+		default:
+			return TAG_UNQUANTIZED;
+	}
+}
+
+static _FORCE_INLINE_ uint32_t _max_quantized(int p_bits) {
+	return p_bits >= 32 ? UINT32_MAX : (1u << p_bits) - 1;
+}
+
+void SceneReplicationQuantizer::_put_component(BitWriter &p_writer, real_t p_value, const SceneReplicationConfig::Quantization &p_quantization) {
+	if (p_quantization.mode == SceneReplicationConfig::QUANTIZATION_HALF) {
+		p_writer.put(Math::make_half_float(p_value), 16);
+		return;
+	}
+	const uint32_t max_quantized = _max_quantized(p_quantization.bits);
+	const double ratio = CLAMP((double(p_value) - p_quantization.min) / (double(p_quantization.max) - p_quantization.min), 0.0, 1.0);
+	p_writer.put(uint32_t(Math::round(ratio * max_quantized)), p_quantization.bits);
+}
+
+real_t SceneReplicationQuantizer::_get_component(BitReader &p_reader, const SceneReplicationConfig::Quantization &p_quantization) {
+	if (p_quantization.mode == SceneReplicationConfig::QUANTIZATION_HALF) {
+		return Math::half_to_float(p_reader.get(16));
+	}
+	const uint32_t max_quantized = _max_quantized(p_quantization.bits);
+	const double ratio = double(p_reader.get(p_quantization.bits)) / max_quantized;
+	return p_quantization.min + ratio * (double(p_quantization.max) - p_quantization.min);
+}
+
+void SceneReplicationQuantizer::_put_value(BitWriter &p_writer, ValueTag p_tag, const Variant &p_value, const SceneReplicationConfig::Quantization &p_quantization) {
+	switch (p_tag) {
+		case TAG_FLOAT: {
+			_put_component(p_writer, p_value.operator real_t(), p_quantization);
+		} break;
+		case TAG_VECTOR2: {
+			const Vector2 v = p_value;
+			_put_component(p_writer, v.x, p_quantization);
+			_put_component(p_writer, v.y, p_quantization);
+		} break;
+		case TAG_VECTOR3: {
+			const Vector3 v = p_value;
+			for (int i = 0; i < 3; i++) {
+				_put_component(p_writer, v[i], p_quantization);
+			}
+		} break;
+		case TAG_VECTOR4: {
+			const Vector4 v = p_value;
+			for (int i = 0; i < 4; i++) {
+				_put_component(p_writer, v[i], p_quantization);
+			}
+		} break;
+		case TAG_QUATERNION: {
+			Quaternion q = p_value;
+			if (p_quantization.mode != SceneReplicationConfig::QUANTIZATION_QUATERNION) {
+				for (int i = 0; i < 4; i++) {
+					_put_component(p_writer, q[i], p_quantization);
+				}
+				break;
+			}
+			// Smallest three: the largest component is left out, and rebuilt from the others as the quaternion is normalized.
+			// q and -q are the same rotation, so the largest is made positive and its sign needs no bit.
+			q = q.length_squared() > 0 ? q.normalized() : Quaternion();
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (Math::abs(q[i]) > Math::abs(q[largest])) {
+					largest = i;
+				}
+			}
+			if (q[largest] < 0) {
+				q = -q;
+			}
+			p_writer.put(largest, 2);
+			SceneReplicationConfig::Quantization component_quantization = p_quantization;
+			component_quantization.min = -Math_SQRT12;
+			component_quantization.max = Math_SQRT12;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					_put_component(p_writer, q[i], component_quantization);
+				}
+			}
+		} break;
+		default:
+			break;
+	}
+}
+
+Variant SceneReplicationQuantizer::_get_value(BitReader &p_reader, ValueTag p_tag, const SceneReplicationConfig::Quantization &p_quantization) {
+	switch (p_tag) {
+		case TAG_FLOAT: {
+			return _get_component(p_reader, p_quantization);
+		}
+		case TAG_VECTOR2: {
+			Vector2 v;
+			v.x = _get_component(p_reader, p_quantization);
+			v.y = _get_component(p_reader, p_quantization);
+			return v;
+		}
+		case TAG_VECTOR3: {
+			Vector3 v;
+			for (int i = 0; i < 3; i++) {
+				v[i] = _get_component(p_reader, p_quantization);
+			}
+			return v;
+		}
+		case TAG_VECTOR4: {
+			Vector4 v;
+			for (int i = 0; i < 4; i++) {
+				v[i] = _get_component(p_reader, p_quantization);
+			}
+			return v;
+		}
+		case TAG_QUATERNION: {
+			Quaternion q;
+			if (p_quantization.mode != SceneReplicationConfig::QUANTIZATION_QUATERNION) {
+				for (int i = 0; i < 4; i++) {
+					q[i] = _get_component(p_reader, p_quantization);
+				}
+				return q;
+			}
+			const int largest = p_reader.get(2);
+			SceneReplicationConfig::Quantization component_quantization = p_quantization;
+			component_quantization.min = -Math_SQRT12;
+			component_quantization.max = Math_SQRT12;
+			real_t sum = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					q[i] = _get_component(p_reader, component_quantization);
+					sum += q[i] * q[i];
+				}
+			}
+			q[largest] = Math::sqrt(MAX(0, 1 - sum));
+			return q.normalized();
+		}
+		default:
+			return Variant();
+	}
+}
+
+Error SceneReplicationQuantizer::encode_state(const Variant **p_variants, int p_count, const LocalVector<SceneReplicationConfig::Quantization> *p_quantization, uint8_t *p_buffer, int &r_len) {
+	if (!p_quantization) {
+		return MultiplayerAPI::encode_and_compress_variants(p_variants, p_count, p_buffer, r_len);
+	}
+	ERR_FAIL_COND_V(int(p_quantization->size()) != p_count, ERR_INVALID_PARAMETER);
+
+	// The bit packed section must be fully written before the Variants can follow it, so it's measured first.
+	Vector<const Variant *> unquantized;
+	BitWriter counter(nullptr);
+	for (int i = 0; i < p_count; i++) {
+		const SceneReplicationConfig::Quantization &quantization = (*p_quantization)[i];
+		if (quantization.mode == SceneReplicationConfig::QUANTIZATION_NONE) {
+			unquantized.push_back(p_variants[i]);
+			continue;
+		}
+		const ValueTag tag = _get_tag(*p_variants[i], quantization.mode);
+		counter.put(tag, TAG_BITS);
+		if (tag == TAG_UNQUANTIZED) {
+			unquantized.push_back(p_variants[i]);
+		} else {
+			_put_value(counter, tag, *p_variants[i], quantization);
+		}
+	}
+	const int packed_len = counter.get_byte_count();
+
+	if (p_buffer) {
+		BitWriter writer(p_buffer);
+		for (int i = 0; i < p_count; i++) {
+			const SceneReplicationConfig::Quantization &quantization = (*p_quantization)[i];
+			if (quantization.mode == SceneReplicationConfig::QUANTIZATION_NONE) {
+				continue;
+			}
+			const ValueTag tag = _get_tag(*p_variants[i], quantization.mode);
+			writer.put(tag, TAG_BITS);
+			if (tag != TAG_UNQUANTIZED) {
+				_put_value(writer, tag, *p_variants[i], quantization);
+			}
+		}
+	}
+
+	int variants_len = 0;
+	Error err = MultiplayerAPI::encode_and_compress_variants(unquantized.ptrw(), unquantized.size(), p_buffer ? p_buffer + packed_len : nullptr, variants_len);
+	ERR_FAIL_COND_V(err != OK, err);
+	r_len = packed_len + variants_len;
+	return OK;
+}
+
+Error SceneReplicationQuantizer::decode_state(Vector<Variant> &r_variants, const LocalVector<SceneReplicationConfig::Quantization> *p_quantization, const uint8_t *p_buffer, int p_len, int &r_len) {
+	if (!p_quantization) {
+		return MultiplayerAPI::decode_and_decompress_variants(r_variants, p_buffer, p_len, r_len);
+	}
+	ERR_FAIL_COND_V(int(p_quantization->size()) != r_variants.size(), ERR_INVALID_PARAMETER);
+
+	LocalVector<int> unquantized;
+	BitReader reader(p_buffer, p_len);
+	for (int i = 0; i < r_variants.size(); i++) {
+		const SceneReplicationConfig::Quantization &quantization = (*p_quantization)[i];
+		if (quantization.mode == SceneReplicationConfig::QUANTIZATION_NONE) {
+			unquantized.push_back(i);
+			continue;
+		}
+		const uint32_t tag = reader.get(TAG_BITS);
+		ERR_FAIL_COND_V_MSG(reader.overflow || tag >= TAG_MAX, ERR_INVALID_DATA, "Invalid packet received. Unable to decode quantized state.");
+		if (tag == TAG_UNQUANTIZED) {
+			unquantized.push_back(i);
+			continue;
+		}
+		r_variants.write[i] = _get_value(reader, ValueTag(tag), quantization);
+		ERR_FAIL_COND_V_MSG(reader.overflow, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+	}
+	const int packed_len = reader.get_byte_count();
+
+	Vector<Variant> variants;
+	variants.resize(unquantized.size());
+	int variants_len = 0;
+	Error err = MultiplayerAPI::decode_and_decompress_variants(variants, p_buffer + packed_len, p_len - packed_len, variants_len);
+	ERR_FAIL_COND_V(err != OK, err);
+	for (uint32_t i = 0; i < unquantized.size(); i++) {
+		r_variants.write[unquantized[i]] = variants[i];
+	}
+	r_len = packed_len + variants_len;
+	return OK;
+}
@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  scene_replication_quantizer.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_REPLICATION_QUANTIZER_H
+#define SCENE_REPLICATION_QUANTIZER_H
+
+#include "scene_replication_config.h"
+
+// Encodes replicated states, bit packing the quantized properties ahead of the regular Variant encoding of the others.
+// Both peers share the replication configuration, so it isn't part of the encoded state.
+class SceneReplicationQuantizer {
+	enum ValueTag {
+		TAG_UNQUANTIZED, // Couldn't be quantized, encoded as a Variant instead.
+		TAG_FLOAT,
+		TAG_VECTOR2,
+		TAG_VECTOR3,
+		TAG_VECTOR4,
+		TAG_QUATERNION,
+		TAG_MAX,
+	};
+
+	static constexpr int TAG_BITS = 3;
+
+	class BitWriter {
+		uint8_t *buffer = nullptr; // Only counts the bits when null.
+		uint64_t bit_count = 0;
+
+	public:
+		void put(uint32_t p_value, int p_bits);
+		int get_byte_count() const { return (bit_count + 7) / 8; }
+
+		BitWriter(uint8_t *p_buffer) :
+				buffer(p_buffer) {}
+	};
+
+	class BitReader {
+		const uint8_t *buffer = nullptr;
+		uint64_t bit_len = 0;
+		uint64_t bit_pos = 0;
+
+	public:
+		bool overflow = false;
+
+		uint32_t get(int p_bits);
+		int get_byte_count() const { return (bit_pos + 7) / 8; }
+
+		BitReader(const uint8_t *p_buffer, int p_len) :
+				buffer(p_buffer), bit_len(uint64_t(p_len) * 8) {}
+	};
+
+	static ValueTag _get_tag(const Variant &p_value, SceneReplicationConfig::QuantizationMode p_mode);
+	static void _put_component(BitWriter &p_writer, real_t p_value, const SceneReplicationConfig::Quantization &p_quantization);
+	static real_t _get_component(BitReader &p_reader, const SceneReplicationConfig::Quantization &p_quantization);
+	static void _put_value(BitWriter &p_writer, ValueTag p_tag, const Variant &p_value, const SceneReplicationConfig::Quantization &p_quantization);
+	static Variant _get_value(BitReader &p_reader, ValueTag p_tag, const SceneReplicationConfig::Quantization &p_quantization);
+
+public:
+	// Same as MultiplayerAPI::encode_and_compress_variants() and decode_and_decompress_variants() when there is no quantization.
+	static Error encode_state(const Variant **p_variants, int p_count, const LocalVector<SceneReplicationConfig::Quantization> *p_quantization, uint8_t *p_buffer, int &r_len);
+	static Error decode_state(Vector<Variant> &r_variants, const LocalVector<SceneReplicationConfig::Quantization> *p_quantization, const uint8_t *p_buffer, int p_len, int &r_len);
+};
+
+#endif // SCENE_REPLICATION_QUANTIZER_H
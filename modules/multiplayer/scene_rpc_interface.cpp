@@ -93,6 +93,7 @@ void SceneRPCInterface::_parse_rpc_config(const Variant &p_config, bool p_for_no
 		cfg.transfer_mode = ((MultiplayerPeer::TransferMode)dict.get("transfer_mode", MultiplayerPeer::TRANSFER_MODE_RELIABLE).operator int());
 		cfg.call_local = dict.get("call_local", false).operator bool();
 		cfg.channel = dict.get("channel", 0).operator int();
+		cfg.immediate = dict.get("immediate", false).operator bool();
 		uint16_t id = ((uint16_t)i);
 		if (p_for_node) {
 			id |= (1 << 15);
@@ -429,7 +430,7 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 
 	if (has_all_peers) {
 		for (const int P : targets) {
-			multiplayer->send_command(P, packet_cache.ptr(), ofs);
+			multiplayer->send_command(P, packet_cache.ptr(), ofs, p_config.immediate);
 		}
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
@@ -449,11 +450,11 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				multiplayer->send_command(P, packet_cache.ptr(), ofs);
+				multiplayer->send_command(P, packet_cache.ptr(), ofs, p_config.immediate);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len);
+				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len, p_config.immediate);
 			}
 		}
 	}
@@ -49,6 +49,7 @@ private:
 		bool call_local = false;
 		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
 		int channel = 0;
+		bool immediate = false;
 
 		bool operator==(RPCConfig const &p_other) const {
 			return name == p_other.name;
@@ -33,6 +33,7 @@
 #include "nav_mesh_generator_2d.h"
 
 #include "core/config/project_settings.h"
+#include "core/math/geometry_2d.h"
 #include "scene/2d/mesh_instance_2d.h"
 #include "scene/2d/multimesh_instance_2d.h"
 #include "scene/2d/navigation_obstacle_2d.h"
@@ -290,9 +291,7 @@ void NavMeshGenerator2D::generator_parse_meshinstance2d_node(const Ref<Navigatio
 
 	const Transform2D mesh_instance_xform = p_source_geometry_data->root_node_transform * mesh_instance->get_global_transform();
 
-	using namespace Clipper2Lib;
-
-	PathsD subject_paths, dummy_clip_paths;
+	Vector<Vector<Vector2>> surface_polygons;
 
 	for (int i = 0; i < mesh->get_surface_count(); i++) {
 		if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
@@ -303,7 +302,7 @@ void NavMeshGenerator2D::generator_parse_meshinstance2d_node(const Ref<Navigatio
 			continue;
 		}
 
-		PathD subject_path;
+		Vector<Vector2> surface_polygon;
 
 		int index_count = 0;
 		if (mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_INDEX) {
@@ -320,34 +319,21 @@ void NavMeshGenerator2D::generator_parse_meshinstance2d_node(const Ref<Navigatio
 
 		if (mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_INDEX) {
 			Vector<int> mesh_indices = a[Mesh::ARRAY_INDEX];
-			for (int vertex_index : mesh_indices) {
-				const Vector2 &vertex = mesh_vertices[vertex_index];
-				const PointD &point = PointD(vertex.x, vertex.y);
-				subject_path.push_back(point);
+			surface_polygon.resize(mesh_indices.size());
+			Vector2 *surface_polygon_ptrw = surface_polygon.ptrw();
+			for (int j = 0; j < mesh_indices.size(); j++) {
+				surface_polygon_ptrw[j] = mesh_vertices[mesh_indices[j]];
 			}
 		} else {
-			for (const Vector2 &vertex : mesh_vertices) {
-				const PointD &point = PointD(vertex.x, vertex.y);
-				subject_path.push_back(point);
-			}
+			surface_polygon = mesh_vertices;
 		}
-		subject_paths.push_back(subject_path);
+		surface_polygons.push_back(surface_polygon);
 	}
 
-	PathsD path_solution;
-
-	path_solution = Union(subject_paths, dummy_clip_paths, FillRule::NonZero);
-
-	//path_solution = RamerDouglasPeucker(path_solution, 0.025);
-
-	Vector<Vector<Vector2>> polypaths;
-
-	for (const PathD &scaled_path : path_solution) {
-		Vector<Vector2> shape_outline;
-		for (const PointD &scaled_point : scaled_path) {
-			shape_outline.push_back(Point2(static_cast<real_t>(scaled_point.x), static_cast<real_t>(scaled_point.y)));
-		}
+	// Merge all surfaces together in a single boolean pass.
+	Vector<Vector<Vector2>> polypaths = Geometry2D::merge_many_polygons(surface_polygons);
 
+	for (Vector<Vector2> &shape_outline : polypaths) {
 		for (int i = 0; i < shape_outline.size(); i++) {
 			shape_outline.write[i] = mesh_instance_xform.xform(shape_outline[i]);
 		}
@@ -378,9 +364,7 @@ void NavMeshGenerator2D::generator_parse_multimeshinstance2d_node(const Ref<Navi
 		return;
 	}
 
-	using namespace Clipper2Lib;
-
-	PathsD mesh_subject_paths, dummy_clip_paths;
+	Vector<Vector<Vector2>> surface_polygons;
 
 	for (int i = 0; i < mesh->get_surface_count(); i++) {
 		if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
@@ -391,7 +375,7 @@ void NavMeshGenerator2D::generator_parse_multimeshinstance2d_node(const Ref<Navi
 			continue;
 		}
 
-		PathD subject_path;
+		Vector<Vector2> surface_polygon;
 
 		int index_count = 0;
 		if (mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_INDEX) {
@@ -408,23 +392,19 @@ void NavMeshGenerator2D::generator_parse_multimeshinstance2d_node(const Ref<Navi
 
 		if (mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_INDEX) {
 			Vector<int> mesh_indices = a[Mesh::ARRAY_INDEX];
-			for (int vertex_index : mesh_indices) {
-				const Vector2 &vertex = mesh_vertices[vertex_index];
-				const PointD &point = PointD(vertex.x, vertex.y);
-				subject_path.push_back(point);
+			surface_polygon.resize(mesh_indices.size());
+			Vector2 *surface_polygon_ptrw = surface_polygon.ptrw();
+			for (int j = 0; j < mesh_indices.size(); j++) {
+				surface_polygon_ptrw[j] = mesh_vertices[mesh_indices[j]];
 			}
 		} else {
-			for (const Vector2 &vertex : mesh_vertices) {
-				const PointD &point = PointD(vertex.x, vertex.y);
-				subject_path.push_back(point);
-			}
+			surface_polygon = mesh_vertices;
 		}
-		mesh_subject_paths.push_back(subject_path);
+		surface_polygons.push_back(surface_polygon);
 	}
 
-	PathsD mesh_path_solution = Union(mesh_subject_paths, dummy_clip_paths, FillRule::NonZero);
-
-	//path_solution = RamerDouglasPeucker(path_solution, 0.025);
+	// Merge all surfaces together in a single boolean pass.
+	const Vector<Vector<Vector2>> mesh_polypaths = Geometry2D::merge_many_polygons(surface_polygons);
 
 	int multimesh_instance_count = multimesh->get_visible_instance_count();
 	if (multimesh_instance_count == -1) {
@@ -436,12 +416,8 @@ void NavMeshGenerator2D::generator_parse_multimeshinstance2d_node(const Ref<Navi
 	for (int i = 0; i < multimesh_instance_count; i++) {
 		const Transform2D multimesh_instance_mesh_instance_xform = multimesh_instance_xform * multimesh->get_instance_transform_2d(i);
 
-		for (const PathD &mesh_path : mesh_path_solution) {
-			Vector<Vector2> shape_outline;
-
-			for (const PointD &mesh_path_point : mesh_path) {
-				shape_outline.push_back(Point2(static_cast<real_t>(mesh_path_point.x), static_cast<real_t>(mesh_path_point.y)));
-			}
+		for (const Vector<Vector2> &mesh_polypath : mesh_polypaths) {
+			Vector<Vector2> shape_outline = mesh_polypath;
 
 			for (int j = 0; j < shape_outline.size(); j++) {
 				shape_outline.write[j] = multimesh_instance_mesh_instance_xform.xform(shape_outline[j]);
@@ -30,6 +30,7 @@
 
 #include "godot_navigation_server_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/os/mutex.h"
 #include "scene/main/node.h"
 
@@ -82,7 +83,13 @@ using namespace NavigationUtilities;
 	}                                                                 \
 	void GodotNavigationServer3D::MERGE(_cmd_, F_NAME)(T_0 D_0, T_1 D_1)
 
-GodotNavigationServer3D::GodotNavigationServer3D() {}
+GodotNavigationServer3D::GodotNavigationServer3D() {
+	link_owner.set_memory_tag(Memory::TAG_NAVIGATION);
+	map_owner.set_memory_tag(Memory::TAG_NAVIGATION);
+	region_owner.set_memory_tag(Memory::TAG_NAVIGATION);
+	agent_owner.set_memory_tag(Memory::TAG_NAVIGATION);
+	obstacle_owner.set_memory_tag(Memory::TAG_NAVIGATION);
+}
 
 GodotNavigationServer3D::~GodotNavigationServer3D() {
 	flush_queries();
@@ -237,6 +244,20 @@ real_t GodotNavigationServer3D::map_get_link_connection_radius(RID p_map) const
 	return map->get_link_connection_radius();
 }
 
+void GodotNavigationServer3D::map_set_avoidance_lod_origins(RID p_map, const Vector<Vector3> &p_origins) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_avoidance_lod_origins(p_origins);
+}
+
+Vector<Vector3> GodotNavigationServer3D::map_get_avoidance_lod_origins(RID p_map) const {
+	const NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector<Vector3>());
+
+	return map->get_avoidance_lod_origins();
+}
+
 Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) const {
 	const NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector<Vector3>());
@@ -1139,6 +1160,18 @@ bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_na
 #endif // _3D_DISABLED
 }
 
+TypedArray<Vector2i> GodotNavigationServer3D::bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Dictionary p_tiles, real_t p_tile_size, const AABB &p_changed_aabb) {
+#ifdef _3D_DISABLED
+	return TypedArray<Vector2i>();
+#else
+	ERR_FAIL_COND_V_MSG(!p_navigation_mesh.is_valid(), TypedArray<Vector2i>(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_V_MSG(!p_source_geometry_data.is_valid(), TypedArray<Vector2i>(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL_V(NavMeshGenerator3D::get_singleton(), TypedArray<Vector2i>());
+	return NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_tiles, p_tile_size, p_changed_aabb);
+#endif // _3D_DISABLED
+}
+
 COMMAND_1(free, RID, p_object) {
 	if (map_owner.owns(p_object)) {
 		NavMap *map = map_owner.get_or_null(p_object);
@@ -1247,6 +1280,9 @@ void GodotNavigationServer3D::set_active(bool p_active) {
 }
 
 void GodotNavigationServer3D::flush_queries() {
+	// The commands can free or change the maps the async path queries are reading.
+	_wait_for_path_queries();
+
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
 	MutexLock lock(commands_mutex);
@@ -1284,6 +1320,8 @@ void GodotNavigationServer3D::sync() {
 }
 
 void GodotNavigationServer3D::process(real_t p_delta_time) {
+	_dispatch_path_queries();
+
 	flush_queries();
 
 	if (!active) {
@@ -1332,9 +1370,14 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+
+	// The maps are synced, the queued path queries can run until the next process.
+	_start_path_queries();
 }
 
 void GodotNavigationServer3D::init() {
+	max_async_path_queries_per_frame = GLOBAL_GET("navigation/pathfinding/max_async_path_queries_per_frame");
+
 #ifndef _3D_DISABLED
 	navmesh_generator_3d = memnew(NavMeshGenerator3D);
 #endif // _3D_DISABLED
@@ -1342,6 +1385,13 @@ void GodotNavigationServer3D::init() {
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+
+	running_path_queries.clear();
+	{
+		MutexLock lock(path_queries_mutex);
+		pending_path_queries.clear();
+		pending_path_query_results.clear();
+	}
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
@@ -1433,6 +1483,106 @@ PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &
 	return r_query_result;
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_query_parameters.is_valid());
+	ERR_FAIL_COND(!p_query_result.is_valid());
+
+	AsyncPathQuery query;
+	query.parameters = p_query_parameters->get_parameters();
+	query.query_result = p_query_result;
+	query.callback = p_callback;
+
+	MutexLock lock(path_queries_mutex);
+	pending_path_queries.push_back(query);
+
+	uint32_t *pending_count = pending_path_query_results.getptr(p_query_result->get_instance_id());
+	if (pending_count) {
+		(*pending_count)++;
+	} else {
+		pending_path_query_results.insert(p_query_result->get_instance_id(), 1);
+	}
+}
+
+bool GodotNavigationServer3D::is_path_query_pending(const Ref<NavigationPathQueryResult3D> &p_query_result) const {
+	ERR_FAIL_COND_V(!p_query_result.is_valid(), false);
+
+	MutexLock lock(path_queries_mutex);
+	return pending_path_query_results.has(p_query_result->get_instance_id());
+}
+
+void GodotNavigationServer3D::_process_path_query(uint32_t p_index, AsyncPathQuery *p_queries) {
+	AsyncPathQuery &query = p_queries[p_index];
+	query.result = _query_path(query.parameters);
+}
+
+void GodotNavigationServer3D::_start_path_queries() {
+	DEV_ASSERT(path_queries_task_id == -1 && running_path_queries.is_empty());
+
+	MutexLock lock(path_queries_mutex);
+	if (pending_path_queries.is_empty()) {
+		return;
+	}
+
+	// Queries above the frame budget stay queued in order for the next frames.
+	uint32_t query_count = pending_path_queries.size();
+	if (max_async_path_queries_per_frame > 0) {
+		query_count = MIN(query_count, max_async_path_queries_per_frame);
+	}
+
+	running_path_queries.resize(query_count);
+	for (uint32_t i = 0; i < query_count; i++) {
+		running_path_queries[i] = pending_path_queries[i];
+	}
+	for (uint32_t i = query_count; i < pending_path_queries.size(); i++) {
+		pending_path_queries[i - query_count] = pending_path_queries[i];
+	}
+	pending_path_queries.resize(pending_path_queries.size() - query_count);
+
+	path_queries_task_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_process_path_query, running_path_queries.ptr(), running_path_queries.size(), -1, true, SNAME("NavigationServerPathQueries"));
+}
+
+void GodotNavigationServer3D::_wait_for_path_queries() {
+	if (path_queries_task_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(path_queries_task_id);
+		path_queries_task_id = -1;
+	}
+}
+
+void GodotNavigationServer3D::_dispatch_path_queries() {
+	_wait_for_path_queries();
+
+	if (running_path_queries.is_empty()) {
+		return;
+	}
+
+	for (const AsyncPathQuery &query : running_path_queries) {
+		query.query_result->set_path(query.result.path);
+		query.query_result->set_path_types(query.result.path_types);
+		query.query_result->set_path_rids(query.result.path_rids);
+		query.query_result->set_path_owner_ids(query.result.path_owner_ids);
+	}
+
+	{
+		MutexLock lock(path_queries_mutex);
+		for (const AsyncPathQuery &query : running_path_queries) {
+			HashMap<ObjectID, uint32_t>::Iterator E = pending_path_query_results.find(query.query_result->get_instance_id());
+			if (E && --E->value == 0) {
+				pending_path_query_results.remove(E);
+			}
+		}
+	}
+
+	for (const AsyncPathQuery &query : running_path_queries) {
+		if (query.callback.is_valid()) {
+			Callable::CallError ce;
+			Variant result;
+			query.callback.callp(nullptr, 0, result, ce);
+		}
+	}
+
+	running_path_queries.clear();
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
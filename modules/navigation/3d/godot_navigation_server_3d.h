@@ -37,6 +37,7 @@
 #include "../nav_obstacle.h"
 #include "../nav_region.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "core/templates/rid_owner.h"
@@ -86,6 +87,22 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 #endif // _3D_DISABLED
 
+	struct AsyncPathQuery {
+		NavigationUtilities::PathQueryParameters parameters;
+		NavigationUtilities::PathQueryResult result;
+		Ref<NavigationPathQueryResult3D> query_result;
+		Callable callback;
+	};
+
+	/// Async path queries waiting for a frame budget, guarded by the mutex.
+	Mutex path_queries_mutex;
+	LocalVector<AsyncPathQuery> pending_path_queries;
+	HashMap<ObjectID, uint32_t> pending_path_query_results;
+	/// Async path queries processed by the WorkerThreadPool during the current frame.
+	LocalVector<AsyncPathQuery> running_path_queries;
+	WorkerThreadPool::GroupID path_queries_task_id = -1;
+	uint32_t max_async_path_queries_per_frame = 256;
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -129,6 +146,9 @@ public:
 	COMMAND_2(map_set_link_connection_radius, RID, p_map, real_t, p_connection_radius);
 	virtual real_t map_get_link_connection_radius(RID p_map) const override;
 
+	virtual void map_set_avoidance_lod_origins(RID p_map, const Vector<Vector3> &p_origins) override;
+	virtual Vector<Vector3> map_get_avoidance_lod_origins(RID p_map) const override;
+
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) const override;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const override;
@@ -263,6 +283,7 @@ public:
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const override;
+	virtual TypedArray<Vector2i> bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Dictionary p_tiles, real_t p_tile_size, const AABB &p_changed_aabb = AABB()) override;
 
 	virtual RID source_geometry_parser_create() override;
 	virtual void source_geometry_parser_set_callback(RID p_parser, const Callable &p_callback) override;
@@ -285,12 +306,19 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual bool is_path_query_pending(const Ref<NavigationPathQueryResult3D> &p_query_result) const override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
+
+	void _process_path_query(uint32_t p_index, AsyncPathQuery *p_queries);
+	void _start_path_queries();
+	void _wait_for_path_queries();
+	void _dispatch_path_queries();
 };
 
 #undef COMMAND_1
@@ -244,6 +244,220 @@ bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 	return baking;
 }
 
+struct NavMeshGenerator3D::NavMeshGeneratorTileBake3D {
+	struct Tile {
+		Vector2i coords;
+		/// Source triangles overlapping the tile and its border.
+		LocalVector<int> indices;
+		Ref<NavigationMesh> navigation_mesh;
+	};
+
+	rcConfig cfg;
+	const float *verts = nullptr;
+	int nverts = 0;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	/// World size of a tile, a multiple of the cell size.
+	real_t tile_world_size = 0.0;
+	/// World size of the border baked around each tile so tile edges line up.
+	real_t border_world_size = 0.0;
+	LocalVector<Tile> tiles;
+};
+
+TypedArray<Vector2i> NavMeshGenerator3D::bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Dictionary p_tiles, real_t p_tile_size, const AABB &p_changed_aabb) {
+	TypedArray<Vector2i> baked_tiles;
+
+	ERR_FAIL_COND_V(!p_navigation_mesh.is_valid(), baked_tiles);
+	ERR_FAIL_COND_V(!p_source_geometry_data.is_valid(), baked_tiles);
+	ERR_FAIL_COND_V_MSG(p_tile_size <= 0.0, baked_tiles, "Tile size must be greater than zero.");
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_V_MSG(baked_tiles, "NavigationMesh is already baking. Wait for current bake to finish.");
+	}
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	NavMeshGeneratorTileBake3D tile_bake;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			tile_bake.projected_obstructions);
+
+	// Without changed area every tile is rebaked.
+	const bool rebake_all = !p_changed_aabb.has_surface();
+
+	generator_get_config(p_navigation_mesh, tile_bake.cfg);
+	rcConfig &cfg = tile_bake.cfg;
+
+	// Tiles always need a border wide enough for the agent radius erosion, or the tile edges would not line up.
+	cfg.borderSize = MAX(cfg.borderSize, cfg.walkableRadius + 3);
+	const int tile_cells = MAX((int)Math::ceil(p_tile_size / cfg.cs), 1);
+	tile_bake.tile_world_size = tile_cells * cfg.cs;
+	tile_bake.border_world_size = cfg.borderSize * cfg.cs;
+
+	const real_t tile_world_size = tile_bake.tile_world_size;
+	const real_t border_world_size = tile_bake.border_world_size;
+
+	HashMap<Vector2i, uint32_t> tile_indices;
+
+	auto tile_needs_bake = [&](const Vector2i &p_coords) -> bool {
+		if (rebake_all || !p_tiles.has(p_coords)) {
+			return true;
+		}
+		const real_t tile_min_x = p_coords.x * tile_world_size - border_world_size;
+		const real_t tile_min_z = p_coords.y * tile_world_size - border_world_size;
+		const real_t tile_max_x = (p_coords.x + 1) * tile_world_size + border_world_size;
+		const real_t tile_max_z = (p_coords.y + 1) * tile_world_size + border_world_size;
+		const Vector3 changed_end = p_changed_aabb.get_end();
+		return tile_min_x <= changed_end.x && tile_max_x >= p_changed_aabb.position.x && tile_min_z <= changed_end.z && tile_max_z >= p_changed_aabb.position.z;
+	};
+
+	auto add_tile = [&](const Vector2i &p_coords) {
+		if (tile_indices.has(p_coords) || !tile_needs_bake(p_coords)) {
+			return;
+		}
+		tile_indices.insert(p_coords, tile_bake.tiles.size());
+		NavMeshGeneratorTileBake3D::Tile tile;
+		tile.coords = p_coords;
+		tile_bake.tiles.push_back(tile);
+	};
+
+	const int nverts = source_geometry_vertices.size() / 3;
+	const int ntris = source_geometry_indices.size() / 3;
+	const float *verts = source_geometry_vertices.ptr();
+	const int *tris = source_geometry_indices.ptr();
+	tile_bake.verts = verts;
+	tile_bake.nverts = nverts;
+
+	if (nverts >= 3 && ntris >= 1) {
+		rcCalcBounds(verts, nverts, cfg.bmin, cfg.bmax);
+
+		AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+		if (baking_aabb.has_volume()) {
+			Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+			for (int i = 0; i < 3; i++) {
+				cfg.bmin[i] = baking_aabb.position[i] + baking_aabb_offset[i];
+				cfg.bmax[i] = cfg.bmin[i] + baking_aabb.size[i];
+			}
+		}
+
+		const Vector2i tiles_begin = Vector2i(Math::floor(cfg.bmin[0] / tile_world_size), Math::floor(cfg.bmin[2] / tile_world_size));
+		// Geometry ending exactly on a tile boundary does not start the next tile.
+		const Vector2i tiles_end = Vector2i(MAX((int)Math::ceil(cfg.bmax[0] / tile_world_size) - 1, tiles_begin.x), MAX((int)Math::ceil(cfg.bmax[2] / tile_world_size) - 1, tiles_begin.y));
+
+		for (int z = tiles_begin.y; z <= tiles_end.y; z++) {
+			for (int x = tiles_begin.x; x <= tiles_end.x; x++) {
+				add_tile(Vector2i(x, z));
+			}
+		}
+
+		// Bucket the source triangles into the tiles they overlap, border included.
+		for (int i = 0; i < ntris; i++) {
+			const float *v0 = &verts[tris[i * 3 + 0] * 3];
+			const float *v1 = &verts[tris[i * 3 + 1] * 3];
+			const float *v2 = &verts[tris[i * 3 + 2] * 3];
+			const real_t min_x = MIN(v0[0], MIN(v1[0], v2[0]));
+			const real_t max_x = MAX(v0[0], MAX(v1[0], v2[0]));
+			const real_t min_z = MIN(v0[2], MIN(v1[2], v2[2]));
+			const real_t max_z = MAX(v0[2], MAX(v1[2], v2[2]));
+
+			const int begin_x = MAX((int)Math::floor((min_x - border_world_size) / tile_world_size), tiles_begin.x);
+			const int end_x = MIN((int)Math::floor((max_x + border_world_size) / tile_world_size), tiles_end.x);
+			const int begin_z = MAX((int)Math::floor((min_z - border_world_size) / tile_world_size), tiles_begin.y);
+			const int end_z = MIN((int)Math::floor((max_z + border_world_size) / tile_world_size), tiles_end.y);
+
+			for (int z = begin_z; z <= end_z; z++) {
+				for (int x = begin_x; x <= end_x; x++) {
+					HashMap<Vector2i, uint32_t>::Iterator E = tile_indices.find(Vector2i(x, z));
+					if (E) {
+						LocalVector<int> &indices = tile_bake.tiles[E->value].indices;
+						indices.push_back(tris[i * 3 + 0]);
+						indices.push_back(tris[i * 3 + 1]);
+						indices.push_back(tris[i * 3 + 2]);
+					}
+				}
+			}
+		}
+	}
+
+	// Previously baked tiles that lost all their geometry are cleared.
+	for (const Variant &key : p_tiles.keys()) {
+		if (key.get_type() == Variant::VECTOR2I) {
+			add_tile(key);
+		}
+	}
+
+	// New tiles without geometry are not worth adding.
+	for (uint32_t i = 0; i < tile_bake.tiles.size();) {
+		if (tile_bake.tiles[i].indices.is_empty() && !p_tiles.has(tile_bake.tiles[i].coords)) {
+			tile_bake.tiles.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+
+	if (tile_bake.tiles.is_empty()) {
+		return baked_tiles;
+	}
+
+	// Resources are created on the calling thread, the tasks only fill them.
+	for (NavMeshGeneratorTileBake3D::Tile &tile : tile_bake.tiles) {
+		Ref<NavigationMesh> tile_navigation_mesh = p_tiles.get(tile.coords, Variant());
+		if (tile_navigation_mesh.is_null()) {
+			tile_navigation_mesh = p_navigation_mesh->duplicate();
+		}
+		tile.navigation_mesh = tile_navigation_mesh;
+	}
+
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.insert(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	if (use_threads && tile_bake.tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &tile_bake, tile_bake.tiles.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tile_bake.tiles.size(); i++) {
+			generator_thread_bake_tile(&tile_bake, i);
+		}
+	}
+
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.erase(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	for (const NavMeshGeneratorTileBake3D::Tile &tile : tile_bake.tiles) {
+		p_tiles[tile.coords] = tile.navigation_mesh;
+		baked_tiles.push_back(tile.coords);
+	}
+
+	return baked_tiles;
+}
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTileBake3D *tile_bake = static_cast<NavMeshGeneratorTileBake3D *>(p_arg);
+	NavMeshGeneratorTileBake3D::Tile &tile = tile_bake->tiles[p_index];
+
+	if (tile.indices.is_empty()) {
+		tile.navigation_mesh->clear();
+		return;
+	}
+
+	rcConfig cfg = tile_bake->cfg;
+	cfg.bmin[0] = tile.coords.x * tile_bake->tile_world_size - tile_bake->border_world_size;
+	cfg.bmin[2] = tile.coords.y * tile_bake->tile_world_size - tile_bake->border_world_size;
+	cfg.bmax[0] = (tile.coords.x + 1) * tile_bake->tile_world_size + tile_bake->border_world_size;
+	cfg.bmax[2] = (tile.coords.y + 1) * tile_bake->tile_world_size + tile_bake->border_world_size;
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (generator_bake_recast(tile.navigation_mesh, cfg, tile_bake->verts, tile_bake->nverts, tile.indices.ptr(), tile.indices.size() / 3, tile_bake->projected_obstructions, nav_vertices, nav_polygons)) {
+		tile.navigation_mesh->set_data(nav_vertices, nav_polygons);
+	} else {
+		tile.navigation_mesh->clear();
+	}
+}
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -685,18 +899,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
-	// added to keep track of steps, no functionality right now
-	String bake_state = "";
-
-	bake_state = "Setting up Configuration..."; // step #1
-
 	const float *verts = source_geometry_vertices.ptr();
 	const int nverts = source_geometry_vertices.size() / 3;
 	const int *tris = source_geometry_indices.ptr();
@@ -706,127 +908,149 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	rcCalcBounds(verts, nverts, bmin, bmax);
 
 	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
+	generator_get_config(p_navigation_mesh, cfg);
+
+	cfg.bmin[0] = bmin[0];
+	cfg.bmin[1] = bmin[1];
+	cfg.bmin[2] = bmin[2];
+	cfg.bmax[0] = bmax[0];
+	cfg.bmax[1] = bmax[1];
+	cfg.bmax[2] = bmax[2];
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
+		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
+		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
+	}
 
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (generator_bake_recast(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+	}
+}
+
+void NavMeshGenerator3D::generator_get_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
+
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
 	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
 
 	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
 		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
 		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
 		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
 		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
 		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
 		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
 		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
 		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
 	}
 	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
 		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
 	}
+}
 
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
+bool NavMeshGenerator3D::generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
 
-	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
-	if (baking_aabb.has_volume()) {
-		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
-		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
-		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
-		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
-		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
-		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
-		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
-	}
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
 
 	bake_state = "Calculating grid size..."; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+	rcCalcGridSize(p_cfg.bmin, p_cfg.bmax, p_cfg.cs, &p_cfg.width, &p_cfg.height);
 
 	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
+	if ((p_cfg.width * p_cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_V_MSG(false, "Baking interrupted."
+							  "\nNavigationMesh baking process would likely crash the engine."
+							  "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+							  "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+							  "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+							  "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return false;
 	}
 
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -843,11 +1067,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -865,30 +1089,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -940,7 +1164,8 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+	r_vertices = nav_vertices;
+	r_polygons = nav_polygons;
 
 	bake_state = "Cleanup..."; // step #11
 
@@ -950,6 +1175,8 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	detail_mesh = nullptr;
 
 	bake_state = "Baking finished."; // step #12
+
+	return true;
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
@@ -119,7 +119,7 @@ void NavMap::set_link_connection_radius(real_t p_link_connection_radius) {
 		return;
 	}
 	link_connection_radius = p_link_connection_radius;
-	regenerate_links = true;
+	link_connections_dirty = true;
 }
 
 gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
@@ -161,30 +161,32 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
 	// Find the initial poly and the end poly on this map.
-	for (const gd::Polygon &p : polygons) {
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
+	for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+		for (const gd::Polygon &p : E.key->get_polygons()) {
+			// Only consider the polygon if it in a region with compatible layers.
+			if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
 
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+			// For each face check the distance between the origin/destination
+			for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
+				const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
 
-			Vector3 point = face.get_closest_point_to(p_origin);
-			real_t distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
+				Vector3 point = face.get_closest_point_to(p_origin);
+				real_t distance_to_point = point.distance_to(p_origin);
+				if (distance_to_point < begin_d) {
+					begin_d = distance_to_point;
+					begin_poly = &p;
+					begin_point = point;
+				}
 
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
+				point = face.get_closest_point_to(p_destination);
+				distance_to_point = point.distance_to(p_destination);
+				if (distance_to_point < end_d) {
+					end_d = distance_to_point;
+					end_poly = &p;
+					end_point = point;
+				}
 			}
 		}
 	}
@@ -219,9 +221,21 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
+	// Between distant regions, only search the polygons of the regions along the path on the region graph.
+	static thread_local HashSet<const NavBase *> corridor;
+	const HashSet<const NavBase *> *corridor_regions = nullptr;
+	if (use_hierarchical_pathfinding && begin_poly->owner != end_poly->owner) {
+		corridor.clear();
+		if (_get_region_corridor((NavRegion *)begin_poly->owner, (NavRegion *)end_poly->owner, begin_point, end_point, p_navigation_layers, corridor)) {
+			corridor_regions = &corridor;
+		}
+	}
+
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	// The A* buffers are kept per thread so concurrent and batched queries do not reallocate them.
+	static thread_local LocalVector<gd::NavigationPoly> navigation_polys;
+	navigation_polys.clear();
+	navigation_polys.reserve(polygon_count * 0.75);
 
 	// Add the start polygon to the reachable navigation polygons.
 	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
@@ -232,7 +246,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	navigation_polys.push_back(begin_navigation_poly);
 
 	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
+	static thread_local LocalVector<uint32_t> to_visit;
+	to_visit.clear();
 	to_visit.push_back(0);
 
 	// This is an implementation of the A* algorithm.
@@ -256,6 +271,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					continue;
 				}
 
+				// Only consider the regions in the corridor, the links between them stay usable.
+				if (corridor_regions && connection.polygon->owner->get_type() == NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_REGION && !corridor_regions->has(connection.polygon->owner)) {
+					continue;
+				}
+
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
 				real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -303,6 +323,24 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Removes the least cost polygon from the list of polygons to visit so we can advance.
 		to_visit.erase(least_cost_id);
 
+		if (to_visit.size() == 0 && corridor_regions) {
+			// The corridor missed the way to the End Polygon, search the whole map instead.
+			corridor_regions = nullptr;
+
+			gd::NavigationPoly np = navigation_polys[0];
+			navigation_polys.clear();
+			navigation_polys.push_back(np);
+			to_visit.clear();
+			to_visit.push_back(0);
+			least_cost_id = 0;
+			prev_least_cost_id = -1;
+
+			reachable_end = nullptr;
+			reachable_d = FLT_MAX;
+
+			continue;
+		}
+
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
 			// Thus use the further reachable polygon
@@ -383,8 +421,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Find the polygon with the minimum cost from the list of polygons to visit.
 		least_cost_id = -1;
 		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
+		for (const uint32_t &navigation_poly_id : to_visit) {
+			gd::NavigationPoly *np = &navigation_polys[navigation_poly_id];
 			real_t cost = np->traveled_distance;
 			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
 			if (cost < least_cost) {
@@ -611,56 +649,58 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 	Vector3 closest_point;
 	real_t closest_point_d = FLT_MAX;
 
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the segment
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 inters;
-			if (f.intersects_segment(p_from, p_to, &inters)) {
-				const real_t d = p_from.distance_to(inters);
-				if (use_collision == false) {
-					closest_point = inters;
-					use_collision = true;
-					closest_point_d = d;
-				} else if (closest_point_d > d) {
-					closest_point = inters;
-					closest_point_d = d;
-				}
-			}
-			// If segment does not itersect face, check the distance from segment's endpoints.
-			else if (!use_collision) {
-				const Vector3 p_from_closest = f.get_closest_point_to(p_from);
-				const real_t d_p_from = p_from.distance_to(p_from_closest);
-				if (closest_point_d > d_p_from) {
-					closest_point = p_from_closest;
-					closest_point_d = d_p_from;
+	for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+		for (const gd::Polygon &p : E.key->get_polygons()) {
+			// For each face check the distance to the segment
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				Vector3 inters;
+				if (f.intersects_segment(p_from, p_to, &inters)) {
+					const real_t d = p_from.distance_to(inters);
+					if (use_collision == false) {
+						closest_point = inters;
+						use_collision = true;
+						closest_point_d = d;
+					} else if (closest_point_d > d) {
+						closest_point = inters;
+						closest_point_d = d;
+					}
 				}
+				// If segment does not itersect face, check the distance from segment's endpoints.
+				else if (!use_collision) {
+					const Vector3 p_from_closest = f.get_closest_point_to(p_from);
+					const real_t d_p_from = p_from.distance_to(p_from_closest);
+					if (closest_point_d > d_p_from) {
+						closest_point = p_from_closest;
+						closest_point_d = d_p_from;
+					}
 
-				const Vector3 p_to_closest = f.get_closest_point_to(p_to);
-				const real_t d_p_to = p_to.distance_to(p_to_closest);
-				if (closest_point_d > d_p_to) {
-					closest_point = p_to_closest;
-					closest_point_d = d_p_to;
+					const Vector3 p_to_closest = f.get_closest_point_to(p_to);
+					const real_t d_p_to = p_to.distance_to(p_to_closest);
+					if (closest_point_d > d_p_to) {
+						closest_point = p_to_closest;
+						closest_point_d = d_p_to;
+					}
 				}
 			}
-		}
-		// Finally, check for a case when shortest distance is between some point located on a face's edge and some point located on a line segment.
-		if (!use_collision) {
-			for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
-				Vector3 a, b;
-
-				Geometry3D::get_closest_points_between_segments(
-						p_from,
-						p_to,
-						p.points[point_id].pos,
-						p.points[(point_id + 1) % p.points.size()].pos,
-						a,
-						b);
-
-				const real_t d = a.distance_to(b);
-				if (d < closest_point_d) {
-					closest_point_d = d;
-					closest_point = b;
+			// Finally, check for a case when shortest distance is between some point located on a face's edge and some point located on a line segment.
+			if (!use_collision) {
+				for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
+					Vector3 a, b;
+
+					Geometry3D::get_closest_points_between_segments(
+							p_from,
+							p_to,
+							p.points[point_id].pos,
+							p.points[(point_id + 1) % p.points.size()].pos,
+							a,
+							b);
+
+					const real_t d = a.distance_to(b);
+					if (d < closest_point_d) {
+						closest_point_d = d;
+						closest_point = b;
+					}
 				}
 			}
 		}
@@ -705,17 +745,19 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 	gd::ClosestPointQueryResult result;
 	real_t closest_point_ds = FLT_MAX;
 
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
+	for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+		for (const gd::Polygon &p : E.key->get_polygons()) {
+			// For each face check the distance to the point
+			for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 inters = f.get_closest_point_to(p_point);
+				const real_t ds = inters.distance_squared_to(p_point);
+				if (ds < closest_point_ds) {
+					result.point = inters;
+					result.normal = f.get_plane().normal;
+					result.owner = p.owner->get_self();
+					closest_point_ds = ds;
+				}
 			}
 		}
 	}
@@ -724,28 +766,33 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 }
 
 void NavMap::add_region(NavRegion *p_region) {
+	// The region starts dirty and is linked on the next sync.
 	regions.push_back(p_region);
-	regenerate_links = true;
 }
 
 void NavMap::remove_region(NavRegion *p_region) {
 	int64_t region_index = regions.find(p_region);
 	if (region_index >= 0) {
 		regions.remove_at_unordered(region_index);
-		regenerate_links = true;
+
+		// The region can be freed before the next sync, so nothing may keep pointing to its polygons.
+		RWLockWrite write_lock(map_rwlock);
+		_clear_link_connections();
+		_unlink_region(p_region);
+		link_connections_dirty = true;
 	}
 }
 
 void NavMap::add_link(NavLink *p_link) {
 	links.push_back(p_link);
-	regenerate_links = true;
+	link_connections_dirty = true;
 }
 
 void NavMap::remove_link(NavLink *p_link) {
 	int64_t link_index = links.find(p_link);
 	if (link_index >= 0) {
 		links.remove_at_unordered(link_index);
-		regenerate_links = true;
+		link_connections_dirty = true;
 	}
 }
 
@@ -829,6 +876,24 @@ void NavMap::remove_agent_as_controlled(NavAgent *agent) {
 	}
 }
 
+void NavMap::set_avoidance_lod_origins(const Vector<Vector3> &p_origins) {
+	avoidance_lod_origins.clear();
+	avoidance_lod_origins.reserve(p_origins.size());
+	for (const Vector3 &origin : p_origins) {
+		avoidance_lod_origins.push_back(origin);
+	}
+}
+
+Vector<Vector3> NavMap::get_avoidance_lod_origins() const {
+	Vector<Vector3> origins;
+	origins.resize(avoidance_lod_origins.size());
+	Vector3 *origins_ptrw = origins.ptrw();
+	for (uint32_t i = 0; i < avoidance_lod_origins.size(); i++) {
+		origins_ptrw[i] = avoidance_lod_origins[i];
+	}
+	return origins;
+}
+
 Vector3 NavMap::get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const {
 	RWLockRead read_lock(map_rwlock);
 
@@ -902,203 +967,443 @@ void NavMap::sync() {
 	int _new_pm_region_count = regions.size();
 	int _new_pm_agent_count = agents.size();
 	int _new_pm_link_count = links.size();
-	int _new_pm_polygon_count = pm_polygon_count;
-	int _new_pm_edge_count = pm_edge_count;
-	int _new_pm_edge_merge_count = pm_edge_merge_count;
-	int _new_pm_edge_connection_count = pm_edge_connection_count;
-	int _new_pm_edge_free_count = pm_edge_free_count;
 
-	// Check if we need to update the links.
+	// The map geometry settings changed, every region needs to rebuild its polygons.
 	if (regenerate_polygons) {
 		for (NavRegion *region : regions) {
 			region->scratch_polygons();
 		}
-		regenerate_links = true;
 	}
 
+	// Only the changed regions are relinked.
+	LocalVector<NavRegion *> dirty_regions;
 	for (NavRegion *region : regions) {
-		if (region->sync()) {
-			regenerate_links = true;
+		if (region->is_dirty()) {
+			dirty_regions.push_back(region);
+		}
+	}
+
+	// The edge connection settings changed, every region needs new edge margin connections.
+	if (regenerate_links) {
+		for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+			regions_to_reconnect.insert(E.key);
 		}
 	}
 
 	for (NavLink *link : links) {
 		if (link->check_dirty()) {
-			regenerate_links = true;
+			link_connections_dirty = true;
 		}
 	}
 
-	if (regenerate_links) {
-		_new_pm_polygon_count = 0;
-		_new_pm_edge_count = 0;
-		_new_pm_edge_merge_count = 0;
-		_new_pm_edge_connection_count = 0;
-		_new_pm_edge_free_count = 0;
+	if (!dirty_regions.is_empty() || !regions_to_reconnect.is_empty() || link_connections_dirty) {
+		// The link polygons connect to the region polygons, drop them before the regions change.
+		_clear_link_connections();
 
-		// Remove regions connections.
-		for (NavRegion *region : regions) {
-			region->get_connections().clear();
+		// Unlink all the changed regions first, so no connection is left pointing to a rebuilt polygon.
+		for (NavRegion *region : dirty_regions) {
+			_unlink_region(region);
 		}
 
-		// Resize the polygon count.
-		int count = 0;
-		for (const NavRegion *region : regions) {
-			if (!region->get_enabled()) {
-				continue;
+		for (NavRegion *region : dirty_regions) {
+			region->sync();
+			if (region->get_enabled()) {
+				_link_region(region);
 			}
-			count += region->get_polygons().size();
 		}
-		polygons.resize(count);
 
-		// Copy all region polygons in the map.
-		count = 0;
-		for (const NavRegion *region : regions) {
-			if (!region->get_enabled()) {
+		_update_edge_connections();
+		_build_link_connections();
+
+		polygon_count = 0;
+		pm_edge_free_count = 0;
+		pm_edge_connection_count = 0;
+		for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+			polygon_count += E.key->get_polygons().size();
+			pm_edge_free_count += E.value.free_edges.size();
+			pm_edge_connection_count += E.key->get_connections().size();
+		}
+		pm_polygon_count = polygon_count;
+		pm_edge_count = edge_connections.size();
+
+		link_connections_dirty = false;
+
+		// Some code treats 0 as a failure case, so we avoid returning 0 and modulo wrap UINT32_MAX manually.
+		iteration_id = iteration_id % UINT32_MAX + 1;
+	}
+
+	// Do we have modified obstacle positions?
+	for (NavObstacle *obstacle : obstacles) {
+		if (obstacle->check_dirty()) {
+			obstacles_dirty = true;
+		}
+	}
+	// Do we have modified agent arrays?
+	for (NavAgent *agent : agents) {
+		if (agent->check_dirty()) {
+			agents_dirty = true;
+		}
+	}
+
+	// Update avoidance worlds.
+	if (obstacles_dirty || agents_dirty) {
+		_update_rvo_simulation();
+	}
+
+	regenerate_polygons = false;
+	regenerate_links = false;
+	obstacles_dirty = false;
+	agents_dirty = false;
+
+	// Performance Monitor.
+	pm_region_count = _new_pm_region_count;
+	pm_agent_count = _new_pm_agent_count;
+	pm_link_count = _new_pm_link_count;
+}
+
+void NavMap::_link_region(NavRegion *p_region) {
+	RegionConnections &region_data = region_connections[p_region];
+	region_data.bounds = AABB();
+
+	bool first_point = true;
+	for (gd::Polygon &poly : p_region->get_polygons()) {
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			if (first_point) {
+				region_data.bounds.position = poly.points[p].pos;
+				first_point = false;
+			} else {
+				region_data.bounds.expand_to(poly.points[p].pos);
+			}
+
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			LocalVector<gd::Edge::Connection> &edge = edge_connections[ek];
+			if (edge.size() > 1) {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
 				continue;
 			}
-			const LocalVector<gd::Polygon> &polygons_source = region->get_polygons();
-			for (uint32_t n = 0; n < polygons_source.size(); n++) {
-				polygons[count + n] = polygons_source[n];
+
+			// Add the polygon/edge tuple to this key.
+			gd::Edge::Connection new_connection;
+			new_connection.polygon = &poly;
+			new_connection.edge = p;
+			new_connection.pathway_start = poly.points[p].pos;
+			new_connection.pathway_end = poly.points[next_point].pos;
+
+			if (edge.size() == 1) {
+				// Connect edge that are shared in different polygons.
+				// Note: The pathway_start/end are full for those connection and do not need to be modified.
+				const gd::Edge::Connection &other_edge = edge[0];
+				other_edge.polygon->edges[other_edge.edge].connections.push_back(new_connection);
+				poly.edges[p].connections.push_back(other_edge);
+				pm_edge_merge_count += 1;
+
+				NavRegion *other_region = (NavRegion *)other_edge.polygon->owner;
+				if (other_region != p_region) {
+					// The other region lost a free edge.
+					region_data.neighbors.insert(other_region);
+					region_connections[other_region].neighbors.insert(p_region);
+					regions_to_reconnect.insert(other_region);
+				}
 			}
-			count += region->get_polygons().size();
+			edge.push_back(new_connection);
 		}
+	}
 
-		_new_pm_polygon_count = polygons.size();
+	regions_to_reconnect.insert(p_region);
+}
 
-		// Group all edges per key.
-		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
-		for (gd::Polygon &poly : polygons) {
-			for (uint32_t p = 0; p < poly.points.size(); p++) {
-				int next_point = (p + 1) % poly.points.size();
-				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+void NavMap::_unlink_region(NavRegion *p_region) {
+	HashMap<NavRegion *, RegionConnections>::Iterator region_data = region_connections.find(p_region);
+	if (!region_data) {
+		// Disabled or not synced yet, nothing is connected to it.
+		return;
+	}
 
-				HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey>::Iterator connection = connections.find(ek);
-				if (!connection) {
-					connections[ek] = Vector<gd::Edge::Connection>();
-					_new_pm_edge_count += 1;
-				}
-				if (connections[ek].size() <= 1) {
-					// Add the polygon/edge tuple to this key.
-					gd::Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-					connections[ek].push_back(new_connection);
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
+	// Remove the region edges from the map.
+	for (gd::Polygon &poly : p_region->get_polygons()) {
+		for (uint32_t p = 0; p < poly.points.size(); p++) {
+			poly.edges[p].connections.clear();
+
+			int next_point = (p + 1) % poly.points.size();
+			gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+			HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey>::Iterator edge = edge_connections.find(ek);
+			if (!edge) {
+				continue;
+			}
+			for (uint32_t i = 0; i < edge->value.size(); i++) {
+				if (edge->value[i].polygon == &poly && edge->value[i].edge == int(p)) {
+					if (edge->value.size() == 2) {
+						pm_edge_merge_count -= 1;
+					}
+					edge->value.remove_at(i);
+					break;
 				}
 			}
+			if (edge->value.is_empty()) {
+				edge_connections.remove(edge);
+			}
 		}
+	}
 
-		Vector<gd::Edge::Connection> free_edges;
-		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
-			if (E.value.size() == 2) {
-				// Connect edge that are shared in different polygons.
-				gd::Edge::Connection &c1 = E.value.write[0];
-				gd::Edge::Connection &c2 = E.value.write[1];
-				c1.polygon->edges[c1.edge].connections.push_back(c2);
-				c2.polygon->edges[c2.edge].connections.push_back(c1);
-				// Note: The pathway_start/end are full for those connection and do not need to be modified.
-				_new_pm_edge_merge_count += 1;
-			} else {
-				CRASH_COND_MSG(E.value.size() != 1, vformat("Number of connection != 1. Found: %d", E.value.size()));
-				if (use_edge_connections && E.value[0].polygon->owner->get_use_edge_connections()) {
-					free_edges.push_back(E.value[0]);
+	// Remove the merged and edge margin connections of the neighbors to this region.
+	for (NavRegion *neighbor : region_data->value.neighbors) {
+		_remove_region_connections_to(neighbor, p_region, false);
+		RegionConnections *neighbor_data = region_connections.getptr(neighbor);
+		if (neighbor_data) {
+			neighbor_data->neighbors.erase(p_region);
+		}
+		regions_to_reconnect.insert(neighbor);
+	}
+
+	p_region->get_connections().clear();
+	region_connections.remove(region_data);
+	regions_to_reconnect.erase(p_region);
+}
+
+void NavMap::_remove_region_connections_to(NavRegion *p_region, const NavRegion *p_target, bool p_free_edges_only) {
+	if (p_free_edges_only) {
+		// Keep the merged edges, they are only removed when one of the regions is unlinked.
+		const RegionConnections *region_data = region_connections.getptr(p_region);
+		if (region_data) {
+			for (const gd::Edge::Connection &free_edge : region_data->free_edges) {
+				Vector<gd::Edge::Connection> &connections = free_edge.polygon->edges[free_edge.edge].connections;
+				for (int i = connections.size() - 1; i >= 0; i--) {
+					if (connections[i].polygon->owner == p_target) {
+						connections.remove_at(i);
+					}
 				}
 			}
 		}
+	} else {
+		for (gd::Polygon &poly : p_region->get_polygons()) {
+			for (gd::Edge &edge : poly.edges) {
+				for (int i = edge.connections.size() - 1; i >= 0; i--) {
+					if (edge.connections[i].polygon->owner == p_target) {
+						edge.connections.remove_at(i);
+					}
+				}
+			}
+		}
+	}
 
-		// Find the compatible near edges.
-		//
-		// Note:
-		// Considering that the edges must be compatible (for obvious reasons)
-		// to be connected, create new polygons to remove that small gap is
-		// not really useful and would result in wasteful computation during
-		// connection, integration and path finding.
-		_new_pm_edge_free_count = free_edges.size();
+	Vector<gd::Edge::Connection> &region_connections_list = p_region->get_connections();
+	for (int i = region_connections_list.size() - 1; i >= 0; i--) {
+		if (region_connections_list[i].polygon->owner == p_target) {
+			region_connections_list.remove_at(i);
+		}
+	}
+}
 
-		for (int i = 0; i < free_edges.size(); i++) {
-			const gd::Edge::Connection &free_edge = free_edges[i];
-			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+bool NavMap::_connect_free_edges(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge, gd::Edge::Connection &r_connection) const {
+	Vector3 edge_p1 = p_free_edge.polygon->points[p_free_edge.edge].pos;
+	Vector3 edge_p2 = p_free_edge.polygon->points[(p_free_edge.edge + 1) % p_free_edge.polygon->points.size()].pos;
 
-			for (int j = 0; j < free_edges.size(); j++) {
-				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
+	Vector3 other_edge_p1 = p_other_edge.polygon->points[p_other_edge.edge].pos;
+	Vector3 other_edge_p2 = p_other_edge.polygon->points[(p_other_edge.edge + 1) % p_other_edge.polygon->points.size()].pos;
+
+	// Compute the projection of the opposite edge on the current one
+	Vector3 edge_vector = edge_p2 - edge_p1;
+	real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+	real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+	if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		return false;
+	}
+
+	// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+	Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other1;
+	if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+		other1 = other_edge_p1;
+	} else {
+		other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other1.distance_to(self1) > edge_connection_margin) {
+		return false;
+	}
+
+	Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other2;
+	if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+		other2 = other_edge_p2;
+	} else {
+		other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other2.distance_to(self2) > edge_connection_margin) {
+		return false;
+	}
+
+	// The edges can now be connected.
+	r_connection = p_other_edge;
+	r_connection.pathway_start = (self1 + other1) / 2.0;
+	r_connection.pathway_end = (self2 + other2) / 2.0;
+	return true;
+}
+
+void NavMap::_update_edge_connections() {
+	// Reset the edges of the regions to reconnect to their merged connection, and collect their free edges.
+	for (NavRegion *region : regions_to_reconnect) {
+		RegionConnections *region_data = region_connections.getptr(region);
+		ERR_CONTINUE(!region_data);
 
-				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
+		// The unchanged neighbors keep their edges, only drop their edge margin connections to this region.
+		for (NavRegion *neighbor : region_data->neighbors) {
+			if (!regions_to_reconnect.has(neighbor)) {
+				_remove_region_connections_to(neighbor, region, true);
+			}
+		}
+
+		region->get_connections().clear();
+		region_data->free_edges.clear();
 
-				// Compute the projection of the opposite edge on the current one
-				Vector3 edge_vector = edge_p2 - edge_p1;
-				real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-				real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-				if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		const bool region_use_edge_connections = use_edge_connections && region->get_use_edge_connections();
+		for (gd::Polygon &poly : region->get_polygons()) {
+			for (uint32_t p = 0; p < poly.points.size(); p++) {
+				poly.edges[p].connections.clear();
+
+				int next_point = (p + 1) % poly.points.size();
+				gd::EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+
+				const LocalVector<gd::Edge::Connection> *edge = edge_connections.getptr(ek);
+				if (!edge) {
 					continue;
 				}
 
-				// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-				Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other1;
-				if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-					other1 = other_edge_p1;
-				} else {
-					other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+				bool linked = false;
+				const gd::Edge::Connection *merged_edge = nullptr;
+				for (const gd::Edge::Connection &connection : *edge) {
+					if (connection.polygon == &poly && connection.edge == int(p)) {
+						linked = true;
+					} else {
+						merged_edge = &connection;
+					}
 				}
-				if (other1.distance_to(self1) > edge_connection_margin) {
+				if (!linked) {
+					// Skipped as an already-merged edge.
 					continue;
 				}
 
-				Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-				Vector3 other2;
-				if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-					other2 = other_edge_p2;
-				} else {
-					other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+				if (merged_edge) {
+					poly.edges[p].connections.push_back(*merged_edge);
+				} else if (region_use_edge_connections) {
+					region_data->free_edges.push_back((*edge)[0]);
 				}
-				if (other2.distance_to(self2) > edge_connection_margin) {
-					continue;
+			}
+		}
+	}
+
+	// Find the compatible near edges.
+	//
+	// Note:
+	// Considering that the edges must be compatible (for obvious reasons)
+	// to be connected, create new polygons to remove that small gap is
+	// not really useful and would result in wasteful computation during
+	// connection, integration and path finding.
+	for (NavRegion *region : regions_to_reconnect) {
+		RegionConnections *region_data = region_connections.getptr(region);
+		ERR_CONTINUE(!region_data);
+		if (region_data->free_edges.is_empty()) {
+			continue;
+		}
+
+		const AABB search_bounds = region_data->bounds.grow(edge_connection_margin);
+
+		for (KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+			NavRegion *other_region = E.key;
+			if (other_region == region || E.value.free_edges.is_empty() || !search_bounds.intersects_inclusive(E.value.bounds)) {
+				continue;
+			}
+
+			// Regions that are also reconnected add their own connections in their iteration.
+			const bool connect_other = !regions_to_reconnect.has(other_region);
+
+			bool connected = false;
+			for (const gd::Edge::Connection &free_edge : region_data->free_edges) {
+				for (const gd::Edge::Connection &other_edge : E.value.free_edges) {
+					gd::Edge::Connection new_connection;
+					if (_connect_free_edges(free_edge, other_edge, new_connection)) {
+						free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+						region->get_connections().push_back(new_connection);
+						connected = true;
+					}
+					if (connect_other && _connect_free_edges(other_edge, free_edge, new_connection)) {
+						other_edge.polygon->edges[other_edge.edge].connections.push_back(new_connection);
+						other_region->get_connections().push_back(new_connection);
+						connected = true;
+					}
 				}
+			}
 
-				// The edges can now be connected.
-				gd::Edge::Connection new_connection = other_edge;
-				new_connection.pathway_start = (self1 + other1) / 2.0;
-				new_connection.pathway_end = (self2 + other2) / 2.0;
-				free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+			if (connected) {
+				region_data->neighbors.insert(other_region);
+				E.value.neighbors.insert(region);
+			}
+		}
+	}
 
-				// Add the connection to the region_connection map.
-				((NavRegion *)free_edge.polygon->owner)->get_connections().push_back(new_connection);
-				_new_pm_edge_connection_count += 1;
+	if (use_hierarchical_pathfinding) {
+		// The neighbors of the reconnected regions gained or lost connections to them.
+		HashSet<NavRegion *> portal_regions;
+		for (NavRegion *region : regions_to_reconnect) {
+			portal_regions.insert(region);
+			const RegionConnections *region_data = region_connections.getptr(region);
+			if (region_data) {
+				for (NavRegion *neighbor : region_data->neighbors) {
+					portal_regions.insert(neighbor);
+				}
 			}
 		}
+		for (NavRegion *region : portal_regions) {
+			_update_region_portals(region);
+		}
+	}
 
-		uint32_t link_poly_idx = 0;
-		link_polygons.resize(links.size());
+	regions_to_reconnect.clear();
+}
 
-		// Search for polygons within range of a nav link.
-		for (const NavLink *link : links) {
-			if (!link->get_enabled()) {
-				continue;
+void NavMap::_clear_link_connections() {
+	for (gd::Polygon *poly : link_connected_polygons) {
+		Vector<gd::Edge::Connection> &connections = poly->edges[0].connections;
+		for (int i = connections.size() - 1; i >= 0; i--) {
+			if (connections[i].edge == -1) {
+				connections.remove_at(i);
 			}
-			const Vector3 start = link->get_start_position();
-			const Vector3 end = link->get_end_position();
+		}
+	}
+	link_connected_polygons.clear();
+	link_polygons.clear();
 
-			gd::Polygon *closest_start_polygon = nullptr;
-			real_t closest_start_distance = link_connection_radius;
-			Vector3 closest_start_point;
+	for (KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+		E.value.link_portals.clear();
+	}
+}
+
+void NavMap::_build_link_connections() {
+	uint32_t link_poly_idx = 0;
+	link_polygons.resize(links.size());
 
-			gd::Polygon *closest_end_polygon = nullptr;
-			real_t closest_end_distance = link_connection_radius;
-			Vector3 closest_end_point;
+	// Search for polygons within range of a nav link.
+	for (const NavLink *link : links) {
+		if (!link->get_enabled()) {
+			continue;
+		}
+		const Vector3 start = link->get_start_position();
+		const Vector3 end = link->get_end_position();
 
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
+		gd::Polygon *closest_start_polygon = nullptr;
+		real_t closest_start_distance = link_connection_radius;
+		Vector3 closest_start_point;
 
+		gd::Polygon *closest_end_polygon = nullptr;
+		real_t closest_end_distance = link_connection_radius;
+		Vector3 closest_end_point;
+
+		// Create link to any polygons within the search radius of the start point.
+		for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+			for (gd::Polygon &start_poly : E.key->get_polygons()) {
 				// For each face check the distance to the start
 				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
 					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
@@ -1113,9 +1418,11 @@ void NavMap::sync() {
 					}
 				}
 			}
+		}
 
-			// Find any polygons within the search radius of the end point.
-			for (gd::Polygon &end_poly : polygons) {
+		// Find any polygons within the search radius of the end point.
+		for (const KeyValue<NavRegion *, RegionConnections> &E : region_connections) {
+			for (gd::Polygon &end_poly : E.key->get_polygons()) {
 				// For each face check the distance to the end
 				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
 					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
@@ -1130,95 +1437,207 @@ void NavMap::sync() {
 					}
 				}
 			}
+		}
 
-			// If we have both a start and end point, then create a synthetic polygon to route through.
-			if (closest_start_polygon && closest_end_polygon) {
-				gd::Polygon &new_polygon = link_polygons[link_poly_idx++];
-				new_polygon.owner = link;
-
-				new_polygon.edges.clear();
-				new_polygon.edges.resize(4);
-				new_polygon.points.clear();
-				new_polygon.points.reserve(4);
-
-				// Build a set of vertices that create a thin polygon going from the start to the end point.
-				new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
-				new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
-				new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
-				new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
-
-				// Setup connections to go forward in the link.
-				{
-					gd::Edge::Connection entry_connection;
-					entry_connection.polygon = &new_polygon;
-					entry_connection.edge = -1;
-					entry_connection.pathway_start = new_polygon.points[0].pos;
-					entry_connection.pathway_end = new_polygon.points[1].pos;
-					closest_start_polygon->edges[0].connections.push_back(entry_connection);
-
-					gd::Edge::Connection exit_connection;
-					exit_connection.polygon = closest_end_polygon;
-					exit_connection.edge = -1;
-					exit_connection.pathway_start = new_polygon.points[2].pos;
-					exit_connection.pathway_end = new_polygon.points[3].pos;
-					new_polygon.edges[2].connections.push_back(exit_connection);
-				}
+		// If we have both a start and end point, then create a synthetic polygon to route through.
+		if (closest_start_polygon && closest_end_polygon) {
+			gd::Polygon &new_polygon = link_polygons[link_poly_idx++];
+			new_polygon.owner = link;
+
+			new_polygon.edges.clear();
+			new_polygon.edges.resize(4);
+			new_polygon.points.clear();
+			new_polygon.points.reserve(4);
+
+			// Build a set of vertices that create a thin polygon going from the start to the end point.
+			new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
+			new_polygon.points.push_back({ closest_start_point, get_point_key(closest_start_point) });
+			new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
+			new_polygon.points.push_back({ closest_end_point, get_point_key(closest_end_point) });
+
+			// Setup connections to go forward in the link.
+			{
+				gd::Edge::Connection entry_connection;
+				entry_connection.polygon = &new_polygon;
+				entry_connection.edge = -1;
+				entry_connection.pathway_start = new_polygon.points[0].pos;
+				entry_connection.pathway_end = new_polygon.points[1].pos;
+				closest_start_polygon->edges[0].connections.push_back(entry_connection);
+				link_connected_polygons.push_back(closest_start_polygon);
+
+				gd::Edge::Connection exit_connection;
+				exit_connection.polygon = closest_end_polygon;
+				exit_connection.edge = -1;
+				exit_connection.pathway_start = new_polygon.points[2].pos;
+				exit_connection.pathway_end = new_polygon.points[3].pos;
+				new_polygon.edges[2].connections.push_back(exit_connection);
+			}
 
-				// If the link is bi-directional, create connections from the end to the start.
-				if (link->is_bidirectional()) {
-					gd::Edge::Connection entry_connection;
-					entry_connection.polygon = &new_polygon;
-					entry_connection.edge = -1;
-					entry_connection.pathway_start = new_polygon.points[2].pos;
-					entry_connection.pathway_end = new_polygon.points[3].pos;
-					closest_end_polygon->edges[0].connections.push_back(entry_connection);
-
-					gd::Edge::Connection exit_connection;
-					exit_connection.polygon = closest_start_polygon;
-					exit_connection.edge = -1;
-					exit_connection.pathway_start = new_polygon.points[0].pos;
-					exit_connection.pathway_end = new_polygon.points[1].pos;
-					new_polygon.edges[0].connections.push_back(exit_connection);
+			// If the link is bi-directional, create connections from the end to the start.
+			if (link->is_bidirectional()) {
+				gd::Edge::Connection entry_connection;
+				entry_connection.polygon = &new_polygon;
+				entry_connection.edge = -1;
+				entry_connection.pathway_start = new_polygon.points[2].pos;
+				entry_connection.pathway_end = new_polygon.points[3].pos;
+				closest_end_polygon->edges[0].connections.push_back(entry_connection);
+				link_connected_polygons.push_back(closest_end_polygon);
+
+				gd::Edge::Connection exit_connection;
+				exit_connection.polygon = closest_start_polygon;
+				exit_connection.edge = -1;
+				exit_connection.pathway_start = new_polygon.points[0].pos;
+				exit_connection.pathway_end = new_polygon.points[1].pos;
+				new_polygon.edges[0].connections.push_back(exit_connection);
+			}
+
+			if (use_hierarchical_pathfinding) {
+				NavRegion *start_region = (NavRegion *)closest_start_polygon->owner;
+				NavRegion *end_region = (NavRegion *)closest_end_polygon->owner;
+				if (start_region != end_region) {
+					RegionPortal portal;
+					portal.cost = closest_start_point.distance_to(closest_end_point) * link->get_travel_cost() + link->get_enter_cost();
+
+					portal.region = end_region;
+					portal.position = closest_start_point;
+					portal.exit_position = closest_end_point;
+					region_connections[start_region].link_portals.push_back(portal);
+
+					if (link->is_bidirectional()) {
+						portal.region = start_region;
+						portal.position = closest_end_point;
+						portal.exit_position = closest_start_point;
+						region_connections[end_region].link_portals.push_back(portal);
+					}
 				}
 			}
 		}
+	}
+}
 
-		// Some code treats 0 as a failure case, so we avoid returning 0 and modulo wrap UINT32_MAX manually.
-		iteration_id = iteration_id % UINT32_MAX + 1;
+void NavMap::_update_region_portals(NavRegion *p_region) {
+	RegionConnections *region_data = region_connections.getptr(p_region);
+	if (!region_data) {
+		return;
 	}
 
-	// Do we have modified obstacle positions?
-	for (NavObstacle *obstacle : obstacles) {
-		if (obstacle->check_dirty()) {
-			obstacles_dirty = true;
+	// One portal per connected region, in the middle of all the connection pathways to it.
+	struct PortalAccumulator {
+		Vector3 position_sum;
+		uint32_t count = 0;
+	};
+	HashMap<NavRegion *, PortalAccumulator> accumulators;
+
+	for (const gd::Polygon &poly : p_region->get_polygons()) {
+		for (const gd::Edge &edge : poly.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				if (connection.polygon->owner == p_region || connection.edge == -1) {
+					continue;
+				}
+				PortalAccumulator &accumulator = accumulators[(NavRegion *)connection.polygon->owner];
+				accumulator.position_sum += (connection.pathway_start + connection.pathway_end) * 0.5;
+				accumulator.count++;
+			}
 		}
 	}
-	// Do we have modified agent arrays?
-	for (NavAgent *agent : agents) {
-		if (agent->check_dirty()) {
-			agents_dirty = true;
+
+	region_data->portals.clear();
+	for (const KeyValue<NavRegion *, PortalAccumulator> &E : accumulators) {
+		RegionPortal portal;
+		portal.region = E.key;
+		portal.position = E.value.position_sum / E.value.count;
+		portal.exit_position = portal.position;
+		region_data->portals.push_back(portal);
+	}
+}
+
+bool NavMap::_get_region_corridor(NavRegion *p_begin_region, NavRegion *p_end_region, const Vector3 &p_begin_point, const Vector3 &p_end_point, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_corridor) const {
+	struct RegionNode {
+		NavRegion *parent = nullptr;
+		Vector3 entry;
+		real_t traveled_distance = 0.0;
+		bool closed = false;
+	};
+
+	// The region graph is small compared to the polygons, a linear open list is enough.
+	HashMap<NavRegion *, RegionNode> nodes;
+	LocalVector<NavRegion *> to_visit;
+
+	RegionNode &begin_node = nodes[p_begin_region];
+	begin_node.entry = p_begin_point;
+	to_visit.push_back(p_begin_region);
+
+	bool found_route = false;
+	while (!to_visit.is_empty()) {
+		uint32_t least_cost_index = 0;
+		real_t least_cost = FLT_MAX;
+		for (uint32_t i = 0; i < to_visit.size(); i++) {
+			const RegionNode &node = nodes[to_visit[i]];
+			const real_t cost = node.traveled_distance + node.entry.distance_to(p_end_point) * to_visit[i]->get_travel_cost();
+			if (cost < least_cost) {
+				least_cost = cost;
+				least_cost_index = i;
+			}
+		}
+
+		NavRegion *region = to_visit[least_cost_index];
+		to_visit.remove_at_unordered(least_cost_index);
+
+		if (region == p_end_region) {
+			found_route = true;
+			break;
+		}
+
+		RegionNode &node = nodes[region];
+		node.closed = true;
+
+		const RegionConnections *region_data = region_connections.getptr(region);
+		if (!region_data) {
+			continue;
+		}
+
+		const LocalVector<RegionPortal> *portal_lists[2] = { &region_data->portals, &region_data->link_portals };
+		for (const LocalVector<RegionPortal> *portals : portal_lists) {
+			for (const RegionPortal &portal : *portals) {
+				if ((p_navigation_layers & portal.region->get_navigation_layers()) == 0) {
+					continue;
+				}
+
+				const real_t new_distance = node.traveled_distance + node.entry.distance_to(portal.position) * region->get_travel_cost() + portal.cost + portal.region->get_enter_cost();
+
+				HashMap<NavRegion *, RegionNode>::Iterator next = nodes.find(portal.region);
+				if (next) {
+					if (next->value.closed || new_distance >= next->value.traveled_distance) {
+						continue;
+					}
+				} else {
+					next = nodes.insert(portal.region, RegionNode());
+					to_visit.push_back(portal.region);
+				}
+
+				next->value.parent = region;
+				next->value.entry = portal.exit_position;
+				next->value.traveled_distance = new_distance;
+			}
 		}
 	}
 
-	// Update avoidance worlds.
-	if (obstacles_dirty || agents_dirty) {
-		_update_rvo_simulation();
+	if (!found_route) {
+		return false;
 	}
 
-	regenerate_polygons = false;
-	regenerate_links = false;
-	obstacles_dirty = false;
-	agents_dirty = false;
+	// Widen the corridor with the neighbors of the regions on the path, the polygon search can cut corners through them.
+	for (NavRegion *region = p_end_region; region; region = nodes[region].parent) {
+		r_corridor.insert(region);
+		const RegionConnections *region_data = region_connections.getptr(region);
+		if (region_data) {
+			for (const RegionPortal &portal : region_data->portals) {
+				r_corridor.insert(portal.region);
+			}
+		}
+	}
 
-	// Performance Monitor.
-	pm_region_count = _new_pm_region_count;
-	pm_agent_count = _new_pm_agent_count;
-	pm_link_count = _new_pm_link_count;
-	pm_polygon_count = _new_pm_polygon_count;
-	pm_edge_count = _new_pm_edge_count;
-	pm_edge_merge_count = _new_pm_edge_merge_count;
-	pm_edge_connection_count = _new_pm_edge_connection_count;
-	pm_edge_free_count = _new_pm_edge_free_count;
+	return true;
 }
 
 void NavMap::_update_rvo_obstacles_tree_2d() {
@@ -1323,23 +1742,223 @@ void NavMap::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
-	if (agents_dirty) {
+	// The uniform grid is rebuilt every step instead.
+	if (agents_dirty && !avoidance_use_uniform_grid) {
 		_update_rvo_agents_tree_2d();
 		_update_rvo_agents_tree_3d();
 	}
 }
 
+uint32_t NavMap::_get_avoidance_grid_cell(const AvoidanceGrid &p_grid, int p_x, int p_z) const {
+	return (uint32_t(p_x) * 73856093u ^ uint32_t(p_z) * 19349663u) & p_grid.cell_mask;
+}
+
+void NavMap::_update_avoidance_grid_agent_2d(uint32_t p_index, NavAgent **p_agents) {
+	const RVO2D::Agent2D *rvo_agent = (*(p_agents + p_index))->get_rvo_agent_2d();
+	const Vector3 position = Vector3(rvo_agent->position_.x(), rvo_agent->elevation_, rvo_agent->position_.y());
+
+	avoidance_grid_2d.positions[p_index] = position;
+	avoidance_grid_2d.layers[p_index] = rvo_agent->avoidance_layers_;
+	avoidance_grid_2d.agent_cells[p_index] = _get_avoidance_grid_cell(avoidance_grid_2d, Math::floor(position.x / avoidance_grid_cell_size), Math::floor(position.z / avoidance_grid_cell_size));
+}
+
+void NavMap::_update_avoidance_grid_agent_3d(uint32_t p_index, NavAgent **p_agents) {
+	const RVO3D::Agent3D *rvo_agent = (*(p_agents + p_index))->get_rvo_agent_3d();
+	const Vector3 position = Vector3(rvo_agent->position_.x(), rvo_agent->position_.y(), rvo_agent->position_.z());
+
+	avoidance_grid_3d.positions[p_index] = position;
+	avoidance_grid_3d.layers[p_index] = rvo_agent->avoidance_layers_;
+	avoidance_grid_3d.agent_cells[p_index] = _get_avoidance_grid_cell(avoidance_grid_3d, Math::floor(position.x / avoidance_grid_cell_size), Math::floor(position.z / avoidance_grid_cell_size));
+}
+
+void NavMap::_build_avoidance_grid(AvoidanceGrid &r_grid, LocalVector<NavAgent *> &p_agents, bool p_use_3d) {
+	const uint32_t agent_count = p_agents.size();
+
+	r_grid.positions.resize(agent_count);
+	r_grid.layers.resize(agent_count);
+	r_grid.agent_cells.resize(agent_count);
+	// Twice as many buckets as agents keeps the hash collisions low.
+	r_grid.cell_mask = next_power_of_2(MAX(agent_count * 2, 1u)) - 1;
+
+	if (use_threads && avoidance_use_multiple_threads) {
+		WorkerThreadPool::GroupID group_task;
+		if (p_use_3d) {
+			group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::_update_avoidance_grid_agent_3d, p_agents.ptr(), agent_count, -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceGrid3D"));
+		} else {
+			group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::_update_avoidance_grid_agent_2d, p_agents.ptr(), agent_count, -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceGrid2D"));
+		}
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < agent_count; i++) {
+			if (p_use_3d) {
+				_update_avoidance_grid_agent_3d(i, p_agents.ptr());
+			} else {
+				_update_avoidance_grid_agent_2d(i, p_agents.ptr());
+			}
+		}
+	}
+
+	// Counting sort of the agents by cell.
+	const uint32_t cell_count = r_grid.cell_mask + 1;
+	r_grid.cell_starts.resize(cell_count + 1);
+	for (uint32_t &cell_start : r_grid.cell_starts) {
+		cell_start = 0;
+	}
+	for (uint32_t cell : r_grid.agent_cells) {
+		r_grid.cell_starts[cell + 1]++;
+	}
+	for (uint32_t i = 0; i < cell_count; i++) {
+		r_grid.cell_starts[i + 1] += r_grid.cell_starts[i];
+	}
+
+	static thread_local LocalVector<uint32_t> cell_fill;
+	cell_fill.resize(cell_count);
+	for (uint32_t i = 0; i < cell_count; i++) {
+		cell_fill[i] = r_grid.cell_starts[i];
+	}
+	r_grid.cell_agents.resize(agent_count);
+	for (uint32_t i = 0; i < agent_count; i++) {
+		r_grid.cell_agents[cell_fill[r_grid.agent_cells[i]]++] = i;
+	}
+}
+
+void NavMap::_get_avoidance_grid_neighbors(const AvoidanceGrid &p_grid, const LocalVector<NavAgent *> &p_agents, uint32_t p_index, bool p_use_3d) {
+	RVO2D::Agent2D *rvo_agent_2d = nullptr;
+	RVO3D::Agent3D *rvo_agent_3d = nullptr;
+	float neighbor_distance = 0.0;
+	size_t max_neighbors = 0;
+	uint32_t avoidance_mask = 0;
+
+	if (p_use_3d) {
+		rvo_agent_3d = p_agents[p_index]->get_rvo_agent_3d();
+		rvo_agent_3d->agentNeighbors_.clear();
+		neighbor_distance = rvo_agent_3d->neighborDist_;
+		max_neighbors = rvo_agent_3d->maxNeighbors_;
+		avoidance_mask = rvo_agent_3d->avoidance_mask_;
+	} else {
+		rvo_agent_2d = p_agents[p_index]->get_rvo_agent_2d();
+		// Obstacles are static and keep using their kd-tree.
+		rvo_agent_2d->obstacleNeighbors_.clear();
+		const float obstacle_range = rvo_agent_2d->timeHorizonObst_ * rvo_agent_2d->maxSpeed_ + rvo_agent_2d->radius_;
+		rvo_simulation_2d.kdTree_->computeObstacleNeighbors(rvo_agent_2d, obstacle_range * obstacle_range);
+
+		rvo_agent_2d->agentNeighbors_.clear();
+		neighbor_distance = rvo_agent_2d->neighborDist_;
+		max_neighbors = rvo_agent_2d->maxNeighbors_;
+		avoidance_mask = rvo_agent_2d->avoidance_mask_;
+	}
+
+	if (max_neighbors == 0) {
+		return;
+	}
+
+	const Vector3 &position = p_grid.positions[p_index];
+	const int reach = (int)Math::ceil(neighbor_distance / avoidance_grid_cell_size);
+	const int cell_x = (int)Math::floor(position.x / avoidance_grid_cell_size);
+	const int cell_z = (int)Math::floor(position.z / avoidance_grid_cell_size);
+	const uint32_t cell_count = p_grid.cell_mask + 1;
+
+	// Different cells can share a bucket, each bucket is only scanned once.
+	static thread_local LocalVector<uint32_t> search_cells;
+	search_cells.clear();
+	if (uint64_t(reach * 2 + 1) * uint64_t(reach * 2 + 1) >= cell_count) {
+		for (uint32_t cell = 0; cell < cell_count; cell++) {
+			search_cells.push_back(cell);
+		}
+	} else {
+		for (int z = cell_z - reach; z <= cell_z + reach; z++) {
+			for (int x = cell_x - reach; x <= cell_x + reach; x++) {
+				const uint32_t cell = _get_avoidance_grid_cell(p_grid, x, z);
+				if (!search_cells.has(cell)) {
+					search_cells.push_back(cell);
+				}
+			}
+		}
+	}
+
+	float range_sq = neighbor_distance * neighbor_distance;
+
+	for (uint32_t cell : search_cells) {
+		for (uint32_t i = p_grid.cell_starts[cell]; i < p_grid.cell_starts[cell + 1]; i++) {
+			const uint32_t other = p_grid.cell_agents[i];
+			if (other == p_index || (avoidance_mask & p_grid.layers[other]) == 0) {
+				continue;
+			}
+
+			Vector3 offset = p_grid.positions[other] - position;
+			if (!p_use_3d) {
+				offset.y = 0.0;
+			}
+			if (offset.length_squared() >= range_sq) {
+				continue;
+			}
+
+			if (p_use_3d) {
+				rvo_agent_3d->insertAgentNeighbor(p_agents[other]->get_rvo_agent_3d(), range_sq);
+			} else {
+				rvo_agent_2d->insertAgentNeighbor(p_agents[other]->get_rvo_agent_2d(), range_sq);
+			}
+		}
+	}
+}
+
+bool NavMap::_is_avoidance_lod_skipped(uint32_t p_index, const Vector3 &p_position) const {
+	if (avoidance_lod_distance <= 0.0 || avoidance_lod_origins.is_empty()) {
+		return false;
+	}
+
+	const real_t lod_distance_sq = avoidance_lod_distance * avoidance_lod_distance;
+	for (const Vector3 &origin : avoidance_lod_origins) {
+		if (origin.distance_squared_to(p_position) <= lod_distance_sq) {
+			return false;
+		}
+	}
+
+	// Far agents are staggered so their avoidance steps are spread over the update interval.
+	return (avoidance_step_count + p_index) % avoidance_lod_update_interval != 0;
+}
+
 void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+	RVO2D::Agent2D *rvo_agent = (*(agent + index))->get_rvo_agent_2d();
+
+	if (_is_avoidance_lod_skipped(index, Vector3(rvo_agent->position_.x(), rvo_agent->elevation_, rvo_agent->position_.y()))) {
+		// In between its avoidance steps a far agent follows its preferred velocity.
+		rvo_agent->newVelocity_ = rvo_agent->prefVelocity_;
+		if (RVO2D::absSq(rvo_agent->newVelocity_) > rvo_agent->maxSpeed_ * rvo_agent->maxSpeed_) {
+			rvo_agent->newVelocity_ = RVO2D::normalize(rvo_agent->newVelocity_) * rvo_agent->maxSpeed_;
+		}
+	} else {
+		if (avoidance_use_uniform_grid) {
+			_get_avoidance_grid_neighbors(avoidance_grid_2d, active_2d_avoidance_agents, index, false);
+		} else {
+			rvo_agent->computeNeighbors(&rvo_simulation_2d);
+		}
+		rvo_agent->computeNewVelocity(&rvo_simulation_2d);
+	}
+
+	rvo_agent->update(&rvo_simulation_2d);
 	(*(agent + index))->update();
 }
 
 void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+	RVO3D::Agent3D *rvo_agent = (*(agent + index))->get_rvo_agent_3d();
+
+	if (_is_avoidance_lod_skipped(index, Vector3(rvo_agent->position_.x(), rvo_agent->position_.y(), rvo_agent->position_.z()))) {
+		// In between its avoidance steps a far agent follows its preferred velocity.
+		rvo_agent->newVelocity_ = rvo_agent->prefVelocity_;
+		if (RVO3D::absSq(rvo_agent->newVelocity_) > rvo_agent->maxSpeed_ * rvo_agent->maxSpeed_) {
+			rvo_agent->newVelocity_ = RVO3D::normalize(rvo_agent->newVelocity_) * rvo_agent->maxSpeed_;
+		}
+	} else {
+		if (avoidance_use_uniform_grid) {
+			_get_avoidance_grid_neighbors(avoidance_grid_3d, active_3d_avoidance_agents, index, true);
+		} else {
+			rvo_agent->computeNeighbors(&rvo_simulation_3d);
+		}
+		rvo_agent->computeNewVelocity(&rvo_simulation_3d);
+	}
+
+	rvo_agent->update(&rvo_simulation_3d);
 	(*(agent + index))->update();
 }
 
@@ -1350,32 +1969,34 @@ void NavMap::step(real_t p_deltatime) {
 	rvo_simulation_3d.setTimeStep(float(deltatime));
 
 	if (active_2d_avoidance_agents.size() > 0) {
+		if (avoidance_use_uniform_grid) {
+			_build_avoidance_grid(avoidance_grid_2d, active_2d_avoidance_agents, false);
+		}
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
+			for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+				compute_single_avoidance_step_2d(i, active_2d_avoidance_agents.ptr());
 			}
 		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
+		if (avoidance_use_uniform_grid) {
+			_build_avoidance_grid(avoidance_grid_3d, active_3d_avoidance_agents, true);
+		}
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
+			for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+				compute_single_avoidance_step_3d(i, active_3d_avoidance_agents.ptr());
 			}
 		}
 	}
+
+	avoidance_step_count++;
 }
 
 void NavMap::dispatch_callbacks() {
@@ -1429,6 +2050,12 @@ void NavMap::_update_merge_rasterizer_cell_dimensions() {
 NavMap::NavMap() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
+	use_hierarchical_pathfinding = GLOBAL_GET("navigation/pathfinding/use_hierarchical_pathfinding");
+
+	avoidance_use_uniform_grid = GLOBAL_GET("navigation/avoidance/use_uniform_grid");
+	avoidance_grid_cell_size = MAX(real_t(GLOBAL_GET("navigation/avoidance/uniform_grid_cell_size")), real_t(0.01));
+	avoidance_lod_distance = GLOBAL_GET("navigation/avoidance/lod_distance");
+	avoidance_lod_update_interval = MAX(int(GLOBAL_GET("navigation/avoidance/lod_update_interval")), 1);
 }
 
 NavMap::~NavMap() {
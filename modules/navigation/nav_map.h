@@ -34,8 +34,10 @@
 #include "nav_rid.h"
 #include "nav_utils.h"
 
+#include "core/math/aabb.h"
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
 
 #include <KdTree2d.h>
 #include <KdTree3d.h>
@@ -80,9 +82,43 @@ class NavMap : public NavRid {
 	/// Map links
 	LocalVector<NavLink *> links;
 	LocalVector<gd::Polygon> link_polygons;
-
-	/// Map polygons
-	LocalVector<gd::Polygon> polygons;
+	/// Region polygons holding the entry connections of the link polygons.
+	LocalVector<gd::Polygon *> link_connected_polygons;
+	bool link_connections_dirty = true;
+
+	/// Crossing from a region to another one in the hierarchical region graph.
+	struct RegionPortal {
+		NavRegion *region = nullptr;
+		/// Where the crossing starts in the source region and ends in the target region.
+		Vector3 position;
+		Vector3 exit_position;
+		/// Extra cost of the crossing, used by the links.
+		real_t cost = 0.0;
+	};
+
+	/// Connection state of a region linked into the map.
+	struct RegionConnections {
+		AABB bounds;
+		/// Unmerged edges considered for edge margin connections.
+		LocalVector<gd::Edge::Connection> free_edges;
+		/// Regions sharing merged edges or edge margin connections with this one.
+		HashSet<NavRegion *> neighbors;
+		/// Hierarchical region graph, one portal per connected region and link.
+		LocalVector<RegionPortal> portals;
+		LocalVector<RegionPortal> link_portals;
+	};
+
+	/// Enabled regions whose polygons are linked into the map.
+	/// Regions are only unlinked and relinked when they change, so the edges of
+	/// unchanged regions are kept between syncs.
+	HashMap<NavRegion *, RegionConnections> region_connections;
+	/// All the linked polygon edges, grouped per key.
+	HashMap<gd::EdgeKey, LocalVector<gd::Edge::Connection>, gd::EdgeKey> edge_connections;
+	/// Regions whose edge margin connections need to be recomputed.
+	HashSet<NavRegion *> regions_to_reconnect;
+
+	/// Number of polygons in the linked regions.
+	uint32_t polygon_count = 0;
 
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
@@ -104,6 +140,31 @@ class NavMap : public NavRid {
 	/// Are rvo obstacles modified?
 	bool obstacles_dirty = true;
 
+	/// Agent data read by the uniform grid neighbor search.
+	/// Stored per field so scanning the candidates of a cell does not touch the RVO agents.
+	struct AvoidanceGrid {
+		LocalVector<Vector3> positions;
+		LocalVector<uint32_t> layers;
+		/// Hashed grid cell of each agent.
+		LocalVector<uint32_t> agent_cells;
+		/// Agent indices sorted by cell, cell `c` spans `cell_agents[cell_starts[c]]` to `cell_agents[cell_starts[c + 1] - 1]`.
+		LocalVector<uint32_t> cell_agents;
+		LocalVector<uint32_t> cell_starts;
+		uint32_t cell_mask = 0;
+	};
+
+	/// Replaces the RVO agent kd-trees with a uniform grid that is rebuilt every step.
+	bool avoidance_use_uniform_grid = false;
+	real_t avoidance_grid_cell_size = 4.0;
+	AvoidanceGrid avoidance_grid_2d;
+	AvoidanceGrid avoidance_grid_3d;
+
+	/// Agents further than the lod distance from all the lod origins only run avoidance every few steps.
+	LocalVector<Vector3> avoidance_lod_origins;
+	real_t avoidance_lod_distance = 0.0;
+	uint32_t avoidance_lod_update_interval = 4;
+	uint32_t avoidance_step_count = 0;
+
 	/// Physics delta time
 	real_t deltatime = 0.0;
 
@@ -111,6 +172,8 @@ class NavMap : public NavRid {
 	uint32_t iteration_id = 0;
 
 	bool use_threads = true;
+	/// Plan the paths between regions on the region graph first, then search the polygons of the regions along it.
+	bool use_hierarchical_pathfinding = false;
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
 
@@ -203,6 +266,9 @@ public:
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
 
+	void set_avoidance_lod_origins(const Vector<Vector3> &p_origins);
+	Vector<Vector3> get_avoidance_lod_origins() const;
+
 	void sync();
 	void step(real_t p_deltatime);
 	void dispatch_callbacks();
@@ -223,6 +289,13 @@ private:
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
 
+	void _update_avoidance_grid_agent_2d(uint32_t p_index, NavAgent **p_agents);
+	void _update_avoidance_grid_agent_3d(uint32_t p_index, NavAgent **p_agents);
+	void _build_avoidance_grid(AvoidanceGrid &r_grid, LocalVector<NavAgent *> &p_agents, bool p_use_3d);
+	uint32_t _get_avoidance_grid_cell(const AvoidanceGrid &p_grid, int p_x, int p_z) const;
+	void _get_avoidance_grid_neighbors(const AvoidanceGrid &p_grid, const LocalVector<NavAgent *> &p_agents, uint32_t p_index, bool p_use_3d);
+	bool _is_avoidance_lod_skipped(uint32_t p_index, const Vector3 &p_position) const;
+
 	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
@@ -230,6 +303,16 @@ private:
 	void _update_rvo_agents_tree_3d();
 
 	void _update_merge_rasterizer_cell_dimensions();
+
+	void _link_region(NavRegion *p_region);
+	void _unlink_region(NavRegion *p_region);
+	void _remove_region_connections_to(NavRegion *p_region, const NavRegion *p_target, bool p_free_edges_only);
+	bool _connect_free_edges(const gd::Edge::Connection &p_free_edge, const gd::Edge::Connection &p_other_edge, gd::Edge::Connection &r_connection) const;
+	void _update_edge_connections();
+	void _clear_link_connections();
+	void _build_link_connections();
+	void _update_region_portals(NavRegion *p_region);
+	bool _get_region_corridor(NavRegion *p_begin_region, NavRegion *p_end_region, const Vector3 &p_begin_point, const Vector3 &p_end_point, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_corridor) const;
 };
 
 #endif // NAV_MAP_H
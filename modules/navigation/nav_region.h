@@ -64,6 +64,7 @@ public:
 	void scratch_polygons() {
 		polygons_dirty = true;
 	}
+	bool is_dirty() const { return polygons_dirty; }
 
 	void set_enabled(bool p_enabled);
 	bool get_enabled() const { return enabled; }
@@ -95,6 +96,9 @@ public:
 	LocalVector<gd::Polygon> const &get_polygons() const {
 		return polygons;
 	}
+	LocalVector<gd::Polygon> &get_polygons() {
+		return polygons;
+	}
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
 
@@ -336,6 +336,38 @@ real_t FastNoiseLite::get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const {
 	return _noise.GetNoise(p_x, p_y, p_z);
 }
 
+void FastNoiseLite::_get_noise_2d_batch(const Vector2 *p_points, real_t *r_values, int p_count) const {
+	// Same as get_noise_2d(), with the settings checks hoisted out of the loop.
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_points[i].x + offset.x;
+			real_t y = p_points[i].y + offset.y;
+			_domain_warp_noise.DomainWarp(x, y);
+			r_values[i] = _noise.GetNoise(x, y);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_points[i].x + offset.x, p_points[i].y + offset.y);
+		}
+	}
+}
+
+void FastNoiseLite::_get_noise_3d_batch(const Vector3 *p_points, real_t *r_values, int p_count) const {
+	if (domain_warp_enabled) {
+		for (int i = 0; i < p_count; i++) {
+			real_t x = p_points[i].x + offset.x;
+			real_t y = p_points[i].y + offset.y;
+			real_t z = p_points[i].z + offset.z;
+			_domain_warp_noise.DomainWarp(x, y, z);
+			r_values[i] = _noise.GetNoise(x, y, z);
+		}
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = _noise.GetNoise(p_points[i].x + offset.x, p_points[i].y + offset.y, p_points[i].z + offset.z);
+		}
+	}
+}
+
 void FastNoiseLite::_changed() {
 	emit_changed();
 }
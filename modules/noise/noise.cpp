@@ -30,6 +30,8 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include <float.h>
 
 Vector<Ref<Image>> Noise::_get_seamless_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt, bool p_normalize) const {
@@ -80,35 +82,103 @@ uint8_t Noise::_alpha_blend<uint8_t>(uint8_t p_bg, uint8_t p_fg, int p_alpha) co
 	return (uint8_t)((alpha * p_fg + inv_alpha * p_bg) >> 8);
 }
 
+void Noise::_get_noise_2d_batch(const Vector2 *p_points, real_t *r_values, int p_count) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_2d(p_points[i].x, p_points[i].y);
+	}
+}
+
+void Noise::_get_noise_3d_batch(const Vector3 *p_points, real_t *r_values, int p_count) const {
+	for (int i = 0; i < p_count; i++) {
+		r_values[i] = get_noise_3d(p_points[i].x, p_points[i].y, p_points[i].z);
+	}
+}
+
+PackedFloat32Array Noise::get_noise_2d_batch(const PackedVector2Array &p_points) const {
+	LocalVector<real_t> values;
+	values.resize(p_points.size());
+	_get_noise_2d_batch(p_points.ptr(), values.ptr(), p_points.size());
+
+	PackedFloat32Array ret;
+	ret.resize(values.size());
+	float *w = ret.ptrw();
+	for (uint32_t i = 0; i < values.size(); i++) {
+		w[i] = values[i];
+	}
+	return ret;
+}
+
+PackedFloat32Array Noise::get_noise_3d_batch(const PackedVector3Array &p_points) const {
+	LocalVector<real_t> values;
+	values.resize(p_points.size());
+	_get_noise_3d_batch(p_points.ptr(), values.ptr(), p_points.size());
+
+	PackedFloat32Array ret;
+	ret.resize(values.size());
+	float *w = ret.ptrw();
+	for (uint32_t i = 0; i < values.size(); i++) {
+		w[i] = values[i];
+	}
+	return ret;
+}
+
+void Noise::_get_image_row(uint32_t p_row, const ImageRows *p_rows) const {
+	const int y = p_row % p_rows->height;
+	const int d = p_row / p_rows->height;
+	real_t *row_values = p_rows->values + p_row * p_rows->width;
+
+	if (p_rows->in_3d_space) {
+		LocalVector<Vector3> points;
+		points.resize(p_rows->width);
+		for (int x = 0; x < p_rows->width; x++) {
+			points[x] = Vector3(x, y, d);
+		}
+		_get_noise_3d_batch(points.ptr(), row_values, p_rows->width);
+	} else {
+		LocalVector<Vector2> points;
+		points.resize(p_rows->width);
+		for (int x = 0; x < p_rows->width; x++) {
+			points[x] = Vector2(x, y);
+		}
+		_get_noise_2d_batch(points.ptr(), row_values, p_rows->width);
+	}
+}
+
 Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
 	Vector<Ref<Image>> images;
 	images.resize(p_depth);
 
-	if (p_normalize) {
-		// Get all values and identify min/max values.
-		LocalVector<real_t> values;
-		values.resize(p_width * p_height * p_depth);
+	// Sample all values first, splitting the rows across threads.
+	LocalVector<real_t> values;
+	values.resize(p_width * p_height * p_depth);
 
+	ImageRows rows;
+	rows.values = values.ptr();
+	rows.width = p_width;
+	rows.height = p_height;
+	rows.in_3d_space = p_in_3d_space;
+	if (p_height * p_depth > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Noise::_get_image_row, (const ImageRows *)&rows, p_height * p_depth, -1, true, SNAME("NoiseGetImage"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_get_image_row(0, &rows);
+	}
+
+	if (p_normalize) {
+		// Identify min/max values.
 		real_t min_val = FLT_MAX;
 		real_t max_val = -FLT_MAX;
-		int idx = 0;
-		for (int d = 0; d < p_depth; d++) {
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					values[idx] = p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y);
-					if (values[idx] > max_val) {
-						max_val = values[idx];
-					}
-					if (values[idx] < min_val) {
-						min_val = values[idx];
-					}
-					idx++;
-				}
+		for (const real_t value : values) {
+			if (value > max_val) {
+				max_val = value;
+			}
+			if (value < min_val) {
+				min_val = value;
 			}
 		}
-		idx = 0;
+		int idx = 0;
 		// Normalize values and write to texture.
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -147,9 +217,10 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 
 			uint8_t ivalue;
 			int idx = 0;
+			const real_t *slice_values = values.ptr() + d * p_width * p_height;
 			for (int y = 0; y < p_height; y++) {
 				for (int x = 0; x < p_width; x++) {
-					float value = (p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y));
+					float value = slice_values[idx];
 					ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
 					wd8[idx] = p_invert ? (255 - ivalue) : ivalue;
 					idx++;
@@ -190,6 +261,8 @@ void Noise::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_noise_2dv", "v"), &Noise::get_noise_2dv);
 	ClassDB::bind_method(D_METHOD("get_noise_3d", "x", "y", "z"), &Noise::get_noise_3d);
 	ClassDB::bind_method(D_METHOD("get_noise_3dv", "v"), &Noise::get_noise_3dv);
+	ClassDB::bind_method(D_METHOD("get_noise_2d_batch", "points"), &Noise::get_noise_2d_batch);
+	ClassDB::bind_method(D_METHOD("get_noise_3d_batch", "points"), &Noise::get_noise_3d_batch);
 
 	// Textures.
 	ClassDB::bind_method(D_METHOD("get_image", "width", "height", "invert", "in_3d_space", "normalize"), &Noise::get_image, DEFVAL(false), DEFVAL(false), DEFVAL(true));
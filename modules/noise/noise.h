@@ -275,6 +275,15 @@ class Noise : public Resource {
 		return out.l;
 	}
 
+	// Shared by the rows of _get_image() evaluated on the WorkerThreadPool.
+	struct ImageRows {
+		real_t *values = nullptr;
+		int width = 0;
+		int height = 0;
+		bool in_3d_space = false;
+	};
+	void _get_image_row(uint32_t p_row, const ImageRows *p_rows) const;
+
 protected:
 	static void _bind_methods();
 
@@ -290,6 +299,13 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	// Evaluate many samples at once. Implementations can override these to avoid per-sample overhead.
+	virtual void _get_noise_2d_batch(const Vector2 *p_points, real_t *r_values, int p_count) const;
+	virtual void _get_noise_3d_batch(const Vector3 *p_points, real_t *r_values, int p_count) const;
+
+	PackedFloat32Array get_noise_2d_batch(const PackedVector2Array &p_points) const;
+	PackedFloat32Array get_noise_3d_batch(const PackedVector3Array &p_points) const;
+
 	Vector<Ref<Image>> _get_image(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual TypedArray<Image> get_image_3d(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_normalize = true) const;
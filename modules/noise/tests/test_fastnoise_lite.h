@@ -596,6 +596,30 @@ void compare_image_with_reference(const Ref<Image> &p_img, const Ref<Image> &p_r
 	}
 }
 
+TEST_CASE("[FastNoiseLite] Batched noise matches single samples") {
+	FastNoiseLite noise;
+	noise.set_offset(Vector3(1.5, -2.0, 3.0));
+
+	PackedVector2Array points_2d;
+	PackedVector3Array points_3d;
+	for (int i = 0; i < 16; i++) {
+		points_2d.push_back(Vector2(i * 0.7, i * -1.3));
+		points_3d.push_back(Vector3(i * 0.7, i * -1.3, i * 2.1));
+	}
+
+	for (int warp = 0; warp < 2; warp++) {
+		noise.set_domain_warp_enabled(warp == 1);
+		PackedFloat32Array values_2d = noise.get_noise_2d_batch(points_2d);
+		PackedFloat32Array values_3d = noise.get_noise_3d_batch(points_3d);
+		REQUIRE(values_2d.size() == points_2d.size());
+		REQUIRE(values_3d.size() == points_3d.size());
+		for (int i = 0; i < points_2d.size(); i++) {
+			CHECK(values_2d[i] == doctest::Approx(noise.get_noise_2dv(points_2d[i])));
+			CHECK(values_3d[i] == doctest::Approx(noise.get_noise_3dv(points_3d[i])));
+		}
+	}
+}
+
 TEST_CASE("[FastNoiseLite] Generating seamless 2D images (11x11px) and compare to reference images") {
 	FastNoiseLite noise;
 	noise.set_noise_type(FastNoiseLite::NoiseType::TYPE_CELLULAR);
@@ -99,6 +99,16 @@ int64_t OggPacketSequence::get_final_granule_pos() const {
 	return -1;
 }
 
+uint64_t OggPacketSequence::get_memory_usage() const {
+	uint64_t size = 0;
+	for (const Vector<PackedByteArray> &page : page_data) {
+		for (const PackedByteArray &packet : page) {
+			size += packet.size();
+		}
+	}
+	return size;
+}
+
 float OggPacketSequence::get_length() const {
 	int64_t granule_pos = get_final_granule_pos();
 	if (granule_pos < 0) {
@@ -85,6 +85,8 @@ public:
 	// Returns the granule position of the last page in this sequence.
 	int64_t get_final_granule_pos() const;
 
+	virtual uint64_t get_memory_usage() const override;
+
 	Ref<OggPacketSequencePlayback> instantiate_playback();
 
 	OggPacketSequence() {}
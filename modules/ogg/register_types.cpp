@@ -32,6 +32,8 @@
 
 #include "ogg_packet_sequence.h"
 
+#include "core/io/resource_loader.h"
+
 void initialize_ogg_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -39,6 +41,7 @@ void initialize_ogg_module(ModuleInitializationLevel p_level) {
 
 	GDREGISTER_CLASS(OggPacketSequence);
 	GDREGISTER_CLASS(OggPacketSequencePlayback);
+	ResourceLoader::add_placeholder_type("OggPacketSequence", "OggPacketSequence");
 }
 
 void uninitialize_ogg_module(ModuleInitializationLevel p_level) {
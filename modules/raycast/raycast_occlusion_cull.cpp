@@ -51,6 +51,13 @@ void RaycastOcclusionCull::RaycastHZBuffer::clear() {
 	camera_ray_masks.clear();
 	camera_rays_tile_count = 0;
 	tile_grid_size = Size2i();
+
+	trace_tiles.clear();
+	traced_tiles.clear();
+	history_points.clear();
+	reprojected_points.clear();
+	reprojected_depths.clear();
+	has_history = false;
 }
 
 void RaycastOcclusionCull::RaycastHZBuffer::resize(const Size2i &p_size) {
@@ -78,6 +85,12 @@ void RaycastOcclusionCull::RaycastHZBuffer::resize(const Size2i &p_size) {
 
 	camera_ray_masks.resize(camera_rays_tile_count * TILE_RAYS);
 	memset(camera_ray_masks.ptr(), ~0, camera_rays_tile_count * TILE_RAYS * sizeof(uint32_t));
+
+	traced_tiles.resize(camera_rays_tile_count);
+	history_points.resize(p_size.x * p_size.y);
+	reprojected_points.resize(p_size.x * p_size.y);
+	reprojected_depths.resize(p_size.x * p_size.y);
+	has_history = false;
 }
 
 void RaycastOcclusionCull::RaycastHZBuffer::update_camera_rays(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
@@ -198,6 +211,166 @@ void RaycastOcclusionCull::RaycastHZBuffer::sort_rays(const Vector3 &p_camera_di
 	}
 }
 
+void RaycastOcclusionCull::RaycastHZBuffer::trace_all_tiles() {
+	trace_tiles.resize(camera_rays_tile_count);
+	for (uint32_t i = 0; i < camera_rays_tile_count; i++) {
+		trace_tiles[i] = i;
+	}
+	memset(traced_tiles.ptr(), 1, camera_rays_tile_count);
+}
+
+bool RaycastOcclusionCull::RaycastHZBuffer::_invalidate_aabb(const AABB &p_aabb, const Transform3D &p_cam_inv_transform, const Projection &p_cam_projection, real_t p_near) {
+	const Size2i &buffer_size = sizes[0];
+	Vector2 rect_min = Vector2(FLT_MAX, FLT_MAX);
+	Vector2 rect_max = Vector2(-FLT_MAX, -FLT_MAX);
+
+	for (int i = 0; i < 8; i++) {
+		Vector3 view = p_cam_inv_transform.xform(p_aabb.get_endpoint(i));
+		if (-view.z < p_near) {
+			return false; // Crosses the near plane, can't be bounded on screen.
+		}
+		Vector3 projected = p_cam_projection.xform(view);
+		Vector2 pixel = Vector2(projected.x * 0.5f + 0.5f, projected.y * 0.5f + 0.5f) * buffer_size;
+		rect_min = rect_min.min(pixel);
+		rect_max = rect_max.max(pixel);
+	}
+
+	if (rect_max.x < 0 || rect_max.y < 0 || rect_min.x >= buffer_size.x || rect_min.y >= buffer_size.y) {
+		return true; // Off screen.
+	}
+
+	// One pixel of margin, like the occlusion test itself.
+	int min_x = CLAMP(int(Math::floor(rect_min.x)) - 1, 0, buffer_size.x - 1) / TILE_SIZE;
+	int min_y = CLAMP(int(Math::floor(rect_min.y)) - 1, 0, buffer_size.y - 1) / TILE_SIZE;
+	int max_x = CLAMP(int(Math::floor(rect_max.x)) + 1, 0, buffer_size.x - 1) / TILE_SIZE;
+	int max_y = CLAMP(int(Math::floor(rect_max.y)) + 1, 0, buffer_size.y - 1) / TILE_SIZE;
+
+	for (int y = min_y; y <= max_y; y++) {
+		for (int x = min_x; x <= max_x; x++) {
+			traced_tiles[y * tile_grid_size.x + x] = 1;
+		}
+	}
+	return true;
+}
+
+void RaycastOcclusionCull::RaycastHZBuffer::reproject_history(const Transform3D &p_cam_transform, const Projection &p_cam_projection, const LocalVector<AABB> *p_changed_aabbs) {
+	ERR_FAIL_COND(is_empty() || !has_history);
+
+	const Size2i &buffer_size = sizes[0];
+	const uint32_t pixel_count = buffer_size.x * buffer_size.y;
+	const Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	const Vector3 camera_dir = -p_cam_transform.basis.get_column(2);
+	const real_t z_near = p_cam_projection.get_z_near();
+
+	memset(traced_tiles.ptr(), 0, camera_rays_tile_count);
+	if (p_changed_aabbs) {
+		for (const AABB &aabb : *p_changed_aabbs) {
+			if (!_invalidate_aabb(aabb, cam_inv_transform, p_cam_projection, z_near)) {
+				trace_all_tiles();
+				return;
+			}
+		}
+	}
+
+	// Scatter last frame's hits into the new view. When several land on the same pixel the farthest
+	// one is kept, a deeper buffer can only make the culling more conservative.
+	for (uint32_t i = 0; i < pixel_count; i++) {
+		reprojected_depths[i] = -1.0f;
+	}
+
+	for (uint32_t i = 0; i < pixel_count; i++) {
+		const Vector3 &point = history_points[i];
+		Vector3 view = cam_inv_transform.xform(point);
+		float depth = -view.z;
+		if (depth < z_near) {
+			continue;
+		}
+
+		Vector3 projected = p_cam_projection.xform(view);
+		int x = Math::floor((projected.x * 0.5f + 0.5f) * buffer_size.x);
+		int y = Math::floor((projected.y * 0.5f + 0.5f) * buffer_size.y);
+		if (x < 0 || y < 0 || x >= buffer_size.x || y >= buffer_size.y) {
+			continue;
+		}
+
+		uint32_t pixel = y * buffer_size.x + x;
+		if (depth > reprojected_depths[pixel]) {
+			reprojected_depths[pixel] = depth;
+			reprojected_points[pixel] = point;
+		}
+	}
+
+	// Tiles with holes were disoccluded and need to be traced, the rest takes the reprojected depth.
+	// A slice of the tiles is traced every frame anyway, so reused hits can't stay around indefinitely.
+	refresh_offset = (refresh_offset + 1) % HISTORY_REFRESH_FRAMES;
+	trace_tiles.clear();
+
+	for (uint32_t i = 0; i < camera_rays_tile_count; i++) {
+		int tile_x = (i % tile_grid_size.x) * TILE_SIZE;
+		int tile_y = (i / tile_grid_size.x) * TILE_SIZE;
+
+		bool trace = traced_tiles[i] || i % HISTORY_REFRESH_FRAMES == refresh_offset;
+		for (int j = 0; j < TILE_RAYS && !trace; j++) {
+			int x = tile_x + j % TILE_SIZE;
+			int y = tile_y + j / TILE_SIZE;
+			if (x < buffer_size.x && y < buffer_size.y && reprojected_depths[y * buffer_size.x + x] < 0.0f) {
+				trace = true;
+			}
+		}
+
+		traced_tiles[i] = trace;
+		if (trace) {
+			trace_tiles.push_back(i);
+			continue;
+		}
+
+		CameraRayTile &tile = camera_rays[i];
+		for (int j = 0; j < TILE_RAYS; j++) {
+			int x = tile_x + j % TILE_SIZE;
+			int y = tile_y + j / TILE_SIZE;
+			if (x >= buffer_size.x || y >= buffer_size.y) {
+				continue;
+			}
+
+			// Stored as a distance along the ray, so sort_rays() gets the reprojected view depth back.
+			float cos_theta = camera_dir.x * tile.ray.dir_x[j] + camera_dir.y * tile.ray.dir_y[j] + camera_dir.z * tile.ray.dir_z[j];
+			tile.ray.tfar[j] = MIN(reprojected_depths[y * buffer_size.x + x] / cos_theta, tile.ray.tfar[j]);
+		}
+	}
+}
+
+void RaycastOcclusionCull::RaycastHZBuffer::update_history(uint64_t p_scene_version) {
+	ERR_FAIL_COND(is_empty());
+
+	const Size2i &buffer_size = sizes[0];
+	for (uint32_t i = 0; i < camera_rays_tile_count; i++) {
+		const CameraRayTile &tile = camera_rays[i];
+		int tile_x = (i % tile_grid_size.x) * TILE_SIZE;
+		int tile_y = (i / tile_grid_size.x) * TILE_SIZE;
+
+		for (int j = 0; j < TILE_RAYS; j++) {
+			int x = tile_x + j % TILE_SIZE;
+			int y = tile_y + j / TILE_SIZE;
+			if (x >= buffer_size.x || y >= buffer_size.y) {
+				continue;
+			}
+
+			uint32_t pixel = y * buffer_size.x + x;
+			if (traced_tiles[i]) {
+				// Misses are kept at the far distance, so they reproject as empty space.
+				float t = tile.ray.tfar[j];
+				history_points[pixel] = Vector3(tile.ray.org_x[j] + tile.ray.dir_x[j] * t, tile.ray.org_y[j] + tile.ray.dir_y[j] * t, tile.ray.org_z[j] + tile.ray.dir_z[j] * t);
+			} else {
+				// Keep the original hit rather than one rebuilt from this pixel's ray, so errors don't accumulate.
+				history_points[pixel] = reprojected_points[pixel];
+			}
+		}
+	}
+
+	history_scene_version = p_scene_version;
+	has_history = true;
+}
+
 RaycastOcclusionCull::RaycastHZBuffer::~RaycastHZBuffer() {
 	if (camera_rays_unaligned_buffer) {
 		memfree(camera_rays_unaligned_buffer);
@@ -226,6 +399,15 @@ void RaycastOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3
 	occluder->vertices = p_vertices;
 	occluder->indices = p_indices;
 
+	occluder->aabb = AABB();
+	for (int i = 0; i < p_vertices.size(); i++) {
+		if (i == 0) {
+			occluder->aabb.position = p_vertices[i];
+		} else {
+			occluder->aabb.expand_to(p_vertices[i]);
+		}
+	}
+
 	for (const InstanceID &E : occluder->users) {
 		RID scenario_rid = E.scenario;
 		RID instance_rid = E.instance;
@@ -302,6 +484,9 @@ void RaycastOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance,
 
 	if (instance.enabled != p_enabled) {
 		instance.enabled = p_enabled;
+		if (!instance.xformed_vertices.is_empty()) {
+			scenario.dirty_aabbs.push_back(instance.aabb);
+		}
 		scenario.dirty = true; // The scenario needs a scene re-build, but the instance doesn't need update
 	}
 
@@ -370,6 +555,7 @@ void RaycastOcclusionCull::Scenario::_update_dirty_instance(int p_idx, RID *p_in
 		_transform_vertices_range(read_ptr, write_ptr, occ_inst->xform, 0, vertices_size);
 	}
 
+	occ_inst->aabb = occ_inst->xform.xform(occ->aabb);
 	occ_inst->indices.resize(occ->indices.size());
 	memcpy(occ_inst->indices.ptr(), occ->indices.ptr(), occ->indices.size() * sizeof(int32_t));
 }
@@ -423,6 +609,9 @@ void RaycastOcclusionCull::Scenario::update() {
 		if (commit_done) {
 			commit_thread->wait_to_finish();
 			current_scene_idx = 1 - current_scene_idx;
+			scene_version++;
+			changed_aabbs = committing_aabbs;
+			committing_aabbs.clear();
 		} else {
 			return;
 		}
@@ -433,9 +622,21 @@ void RaycastOcclusionCull::Scenario::update() {
 	}
 
 	for (const RID &scenario : removed_instances) {
+		const OccluderInstance *occ_inst = instances.getptr(scenario);
+		if (occ_inst && !occ_inst->xformed_vertices.is_empty()) {
+			dirty_aabbs.push_back(occ_inst->aabb);
+		}
 		instances.erase(scenario);
 	}
 
+	// Both where changed occluders were and where they are now has to be traced again.
+	for (const RID &instance : dirty_instances_array) {
+		const OccluderInstance *occ_inst = instances.getptr(instance);
+		if (occ_inst && !occ_inst->xformed_vertices.is_empty()) {
+			dirty_aabbs.push_back(occ_inst->aabb);
+		}
+	}
+
 	if (dirty_instances_array.size() / WorkerThreadPool::get_singleton()->get_thread_count() > 128) {
 		// Lots of instances, use per-instance threading
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_update_dirty_instance_thread, dirty_instances_array.ptr(), dirty_instances_array.size(), -1, true, SNAME("RaycastOcclusionCullUpdate"));
@@ -448,10 +649,20 @@ void RaycastOcclusionCull::Scenario::update() {
 		}
 	}
 
+	for (const RID &instance : dirty_instances_array) {
+		const OccluderInstance *occ_inst = instances.getptr(instance);
+		if (occ_inst && !occ_inst->xformed_vertices.is_empty()) {
+			dirty_aabbs.push_back(occ_inst->aabb);
+		}
+	}
+
 	dirty_instances.clear();
 	dirty_instances_array.clear();
 	removed_instances.clear();
 
+	committing_aabbs = dirty_aabbs;
+	dirty_aabbs.clear();
+
 	if (raycast_singleton->ebr_device == nullptr) {
 		raycast_singleton->_init_embree();
 	}
@@ -494,10 +705,11 @@ void RaycastOcclusionCull::Scenario::_raycast(uint32_t p_idx, const RaycastThrea
 	rtcInitIntersectArguments(&args);
 	args.flags = RTC_RAY_QUERY_FLAG_COHERENT;
 	args.context = &context;
-	rtcIntersect16((const int *)&p_raycast_data->masks[p_idx * TILE_RAYS], ebr_scene[current_scene_idx], &p_raycast_data->rays[p_idx], &args);
+	uint32_t tile = p_raycast_data->tiles[p_idx];
+	rtcIntersect16((const int *)&p_raycast_data->masks[tile * TILE_RAYS], ebr_scene[current_scene_idx], &p_raycast_data->rays[tile], &args);
 }
 
-void RaycastOcclusionCull::Scenario::raycast(CameraRayTile *r_rays, const uint32_t *p_valid_masks, uint32_t p_tile_count) const {
+void RaycastOcclusionCull::Scenario::raycast(CameraRayTile *r_rays, const uint32_t *p_valid_masks, const uint32_t *p_tiles, uint32_t p_tile_count) const {
 	ERR_FAIL_NULL(singleton);
 	if (raycast_singleton->ebr_device == nullptr) {
 		return; // Embree is initialized on demand when there is some scenario with occluders in it.
@@ -510,6 +722,7 @@ void RaycastOcclusionCull::Scenario::raycast(CameraRayTile *r_rays, const uint32
 	RaycastThreadData td;
 	td.rays = r_rays;
 	td.masks = p_valid_masks;
+	td.tiles = p_tiles;
 
 	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_raycast, &td, p_tile_count, -1, true, SNAME("RaycastOcclusionCullRaycast"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
@@ -531,6 +744,7 @@ void RaycastOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
 	ERR_FAIL_COND(!buffers.has(p_buffer));
 	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
 	buffers[p_buffer].scenario_rid = p_scenario;
+	buffers[p_buffer].has_history = false;
 }
 
 void RaycastOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
@@ -614,7 +828,17 @@ void RaycastOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_
 
 	buffer.update_camera_rays(p_cam_transform, jittered_proj, p_cam_orthogonal);
 
-	scenario.raycast(buffer.camera_rays, buffer.camera_ray_masks.ptr(), buffer.camera_rays_tile_count);
+	// The previous frame can be reused if at most one scene change happened since, whose occluders are traced again.
+	if (_reprojection_enabled && !p_cam_orthogonal && buffer.has_history && buffer.history_scene_version + 1 >= scenario.scene_version) {
+		buffer.reproject_history(p_cam_transform, jittered_proj, buffer.history_scene_version == scenario.scene_version ? nullptr : &scenario.changed_aabbs);
+	} else {
+		buffer.trace_all_tiles();
+	}
+
+	if (!buffer.trace_tiles.is_empty()) {
+		scenario.raycast(buffer.camera_rays, buffer.camera_ray_masks.ptr(), buffer.trace_tiles.ptr(), buffer.trace_tiles.size());
+	}
+	buffer.update_history(scenario.scene_version);
 	buffer.sort_rays(-p_cam_transform.basis.get_column(2), p_cam_orthogonal);
 	buffer.update_mips();
 }
@@ -659,6 +883,7 @@ RaycastOcclusionCull::RaycastOcclusionCull() {
 	raycast_singleton = this;
 	int default_quality = GLOBAL_GET("rendering/occlusion_culling/bvh_build_quality");
 	_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+	_reprojection_enabled = GLOBAL_GET("rendering/occlusion_culling/temporal_reprojection");
 	build_quality = RS::ViewportOcclusionCullingBuildQuality(default_quality);
 }
 
@@ -63,20 +63,35 @@ public:
 			Size2i buffer_size;
 		};
 
+		// World space hit of every pixel in the last frame, reprojected into the next one so only
+		// disoccluded tiles and tiles covering changed occluders need to be traced again.
+		LocalVector<Vector3> history_points;
+		LocalVector<Vector3> reprojected_points;
+		LocalVector<float> reprojected_depths;
+		LocalVector<uint8_t> traced_tiles;
+		uint32_t refresh_offset = 0;
+
 		void _camera_rays_threaded(uint32_t p_thread, const CameraRayThreadData *p_data);
 		void _generate_camera_rays(const CameraRayThreadData *p_data, int p_from, int p_to);
+		bool _invalidate_aabb(const AABB &p_aabb, const Transform3D &p_cam_inv_transform, const Projection &p_cam_projection, real_t p_near);
 
 	public:
 		unsigned int camera_rays_tile_count = 0;
 		uint8_t *camera_rays_unaligned_buffer = nullptr;
 		CameraRayTile *camera_rays = nullptr;
 		LocalVector<uint32_t> camera_ray_masks;
+		LocalVector<uint32_t> trace_tiles;
 		RID scenario_rid;
+		bool has_history = false;
+		uint64_t history_scene_version = 0;
 
 		virtual void clear() override;
 		virtual void resize(const Size2i &p_size) override;
 		void sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal);
 		void update_camera_rays(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal);
+		void trace_all_tiles();
+		void reproject_history(const Transform3D &p_cam_transform, const Projection &p_cam_projection, const LocalVector<AABB> *p_changed_aabbs);
+		void update_history(uint64_t p_scene_version);
 
 		~RaycastHZBuffer();
 	};
@@ -103,6 +118,7 @@ private:
 	struct Occluder {
 		PackedVector3Array vertices;
 		PackedInt32Array indices;
+		AABB aabb;
 		HashSet<InstanceID, InstanceID> users;
 	};
 
@@ -111,6 +127,7 @@ private:
 		LocalVector<uint32_t> indices;
 		LocalVector<Vector3> xformed_vertices;
 		Transform3D xform;
+		AABB aabb;
 		bool enabled = true;
 		bool removed = false;
 	};
@@ -119,6 +136,7 @@ private:
 		struct RaycastThreadData {
 			CameraRayTile *rays = nullptr;
 			const uint32_t *masks;
+			const uint32_t *tiles;
 		};
 
 		struct TransformThreadData {
@@ -135,6 +153,12 @@ private:
 
 		RTCScene ebr_scene[2] = { nullptr, nullptr };
 		int current_scene_idx = 0;
+		uint64_t scene_version = 0; // Increased every time a newly committed scene starts being used.
+
+		// Bounds of the occluders that changed in the scene in use, the scene being committed and the next one.
+		LocalVector<AABB> changed_aabbs;
+		LocalVector<AABB> committing_aabbs;
+		LocalVector<AABB> dirty_aabbs;
 
 		HashMap<RID, OccluderInstance> instances;
 		HashSet<RID> dirty_instances; // To avoid duplicates
@@ -150,13 +174,14 @@ private:
 		void update();
 
 		void _raycast(uint32_t p_thread, const RaycastThreadData *p_raycast_data) const;
-		void raycast(CameraRayTile *r_rays, const uint32_t *p_valid_masks, uint32_t p_tile_count) const;
+		void raycast(CameraRayTile *r_rays, const uint32_t *p_valid_masks, const uint32_t *p_tiles, uint32_t p_tile_count) const;
 	};
 
 	static RaycastOcclusionCull *raycast_singleton;
 
 	static const int TILE_SIZE = 4;
 	static const int TILE_RAYS = TILE_SIZE * TILE_SIZE;
+	static const int HISTORY_REFRESH_FRAMES = 16; // Reused tiles are traced again at least this often.
 
 	RTCDevice ebr_device = nullptr;
 	RID_PtrOwner<Occluder> occluder_owner;
@@ -164,6 +189,7 @@ private:
 	HashMap<RID, RaycastHZBuffer> buffers;
 	RS::ViewportOcclusionCullingBuildQuality build_quality;
 	bool _jitter_enabled = false;
+	bool _reprojection_enabled = true;
 
 	void _init_embree();
 	Projection _jitter_projection(const Projection &p_cam_projection, const Size2i &p_viewport_size);
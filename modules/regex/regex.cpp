@@ -31,6 +31,9 @@
 #include "regex.h"
 
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
+#include "core/templates/lru.h"
+#include "core/templates/safe_refcount.h"
 
 extern "C" {
 #include <pcre2.h>
@@ -46,6 +49,30 @@ static void _regex_free(void *ptr, void *user) {
 	}
 }
 
+// Compiled patterns are immutable and safe to match from several threads, so
+// RegEx instances compiling the same pattern share one and keep it alive with a refcount.
+struct RegExCode {
+	SafeRefCount refcount;
+	pcre2_code_32 *code = nullptr;
+};
+
+static RegExCode *_code_ref(RegExCode *p_code) {
+	p_code->refcount.ref();
+	return p_code;
+}
+
+static void _code_unref(RegExCode *p_code) {
+	if (p_code->refcount.unref()) {
+		pcre2_code_free_32(p_code->code);
+		memdelete(p_code);
+	}
+}
+
+#define REGEX_CACHE_SIZE 256
+
+static LRUCache<String, RegExCode *> code_cache(REGEX_CACHE_SIZE);
+static Mutex code_cache_mutex;
+
 int RegExMatch::_find(const Variant &p_name) const {
 	if (p_name.is_num()) {
 		int i = (int)p_name;
@@ -158,7 +185,25 @@ void RegExMatch::_bind_methods() {
 }
 
 void RegEx::_pattern_info(uint32_t what, void *where) const {
-	pcre2_pattern_info_32((pcre2_code_32 *)code, what, where);
+	pcre2_pattern_info_32(code->code, what, where);
+}
+
+int RegEx::_match(const String &p_subject, int p_offset, int p_end, void *p_match, void *p_match_ctx) const {
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
+	pcre2_match_data_32 *match = (pcre2_match_data_32 *)p_match;
+	pcre2_match_context_32 *mctx = (pcre2_match_context_32 *)p_match_ctx;
+
+	int res = pcre2_match_32(code->code, s, length, p_offset, 0, match, mctx);
+	if (res == PCRE2_ERROR_JIT_STACKLIMIT) {
+		// Patterns that recurse deeply can exhaust the default JIT stack, the interpreter has no such limit.
+		res = pcre2_match_32(code->code, s, length, p_offset, PCRE2_NO_JIT, match, mctx);
+	}
+	return res;
 }
 
 Ref<RegEx> RegEx::create_from_string(const String &p_pattern) {
@@ -170,15 +215,33 @@ Ref<RegEx> RegEx::create_from_string(const String &p_pattern) {
 
 void RegEx::clear() {
 	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
+		_code_unref(code);
 		code = nullptr;
 	}
 }
 
+void RegEx::clear_cache() {
+	MutexLock lock(code_cache_mutex);
+	while (const String *key = code_cache.get_least_recent_key()) {
+		String pattern_key = *key;
+		_code_unref(*code_cache.getptr(pattern_key));
+		code_cache.erase(pattern_key);
+	}
+}
+
 Error RegEx::compile(const String &p_pattern) {
 	pattern = p_pattern;
 	clear();
 
+	{
+		MutexLock lock(code_cache_mutex);
+		RegExCode *const *cached = code_cache.getptr(pattern);
+		if (cached) {
+			code = _code_ref(*cached);
+			return OK;
+		}
+	}
+
 	int err;
 	PCRE2_SIZE offset;
 	uint32_t flags = PCRE2_DUPNAMES;
@@ -187,17 +250,35 @@ Error RegEx::compile(const String &p_pattern) {
 	pcre2_compile_context_32 *cctx = pcre2_compile_context_create_32(gctx);
 	PCRE2_SPTR32 p = (PCRE2_SPTR32)pattern.get_data();
 
-	code = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
+	pcre2_code_32 *c = pcre2_compile_32(p, pattern.length(), flags, &err, &offset, cctx);
 
 	pcre2_compile_context_free_32(cctx);
 
-	if (!code) {
+	if (!c) {
 		PCRE2_UCHAR32 buf[256];
 		pcre2_get_error_message_32(err, buf, 256);
 		String message = String::num(offset) + ": " + String((const char32_t *)buf);
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
+
+	// Fails harmlessly when PCRE2 was built without JIT support or the platform doesn't allow it,
+	// matching then falls back to the interpreter.
+	pcre2_jit_compile_32(c, PCRE2_JIT_COMPLETE);
+
+	code = memnew(RegExCode);
+	code->refcount.init();
+	code->code = c;
+
+	MutexLock lock(code_cache_mutex);
+	if (!code_cache.has(pattern)) {
+		if (code_cache.get_size() >= code_cache.get_capacity()) {
+			String evicted = *code_cache.get_least_recent_key();
+			_code_unref(*code_cache.getptr(evicted));
+			code_cache.erase(evicted);
+		}
+		code_cache.insert(pattern, _code_ref(code));
+	}
 	return OK;
 }
 
@@ -207,19 +288,13 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 
 	Ref<RegExMatch> result = memnew(RegExMatch);
 
-	int length = p_subject.length();
-	if (p_end >= 0 && p_end < length) {
-		length = p_end;
-	}
-
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_code_32 *c = code->code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
 	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
-	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
 	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	int res = _match(p_subject, p_offset, p_end, match, mctx);
 
 	if (res < 0) {
 		pcre2_match_data_free_32(match);
@@ -286,6 +361,45 @@ TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset,
 	return result;
 }
 
+PackedInt32Array RegEx::search_all_offsets(const String &p_subject, int p_offset, int p_end) const {
+	PackedInt32Array result;
+
+	ERR_FAIL_COND_V(!is_valid(), result);
+	ERR_FAIL_COND_V_MSG(p_offset < 0, result, "RegEx search offset must be >= 0");
+
+	pcre2_code_32 *c = code->code;
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+
+	uint32_t group_count = 0;
+	_pattern_info(PCRE2_INFO_CAPTURECOUNT, &group_count);
+	const int stride = (group_count + 1) * 2;
+
+	int offset = p_offset;
+	while (_match(p_subject, offset, p_end, match, mctx) >= 0) {
+		PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+
+		int ofs = result.size();
+		result.resize(ofs + stride);
+		int32_t *w = result.ptrw() + ofs;
+		for (int i = 0; i < stride; i++) {
+			// Unset groups are reported as PCRE2_UNSET, which converts to -1.
+			w[i] = (int32_t)ovector[i];
+		}
+
+		offset = ovector[1];
+		if (ovector[0] == ovector[1]) {
+			offset++;
+		}
+	}
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
+	return result;
+}
+
 String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_all, int p_offset, int p_end) const {
 	ERR_FAIL_COND_V(!is_valid(), String());
 	ERR_FAIL_COND_V_MSG(p_offset < 0, String(), "RegEx sub offset must be >= 0");
@@ -310,7 +424,7 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 		length = p_end;
 	}
 
-	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_code_32 *c = code->code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
 	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
@@ -321,6 +435,11 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 
 	int res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 
+	if (res == PCRE2_ERROR_JIT_STACKLIMIT) {
+		flags |= PCRE2_NO_JIT;
+		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
+	}
+
 	if (res == PCRE2_ERROR_NOMEMORY) {
 		output.resize(olength + safety_zone);
 		o = (PCRE2_UCHAR32 *)output.ptrw();
@@ -388,9 +507,7 @@ RegEx::RegEx(const String &p_pattern) {
 }
 
 RegEx::~RegEx() {
-	if (code) {
-		pcre2_code_free_32((pcre2_code_32 *)code);
-	}
+	clear();
 	pcre2_general_context_free_32((pcre2_general_context_32 *)general_ctx);
 }
 
@@ -401,6 +518,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern"), &RegEx::compile);
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_offsets", "subject", "offset", "end"), &RegEx::search_all_offsets, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
@@ -69,14 +69,17 @@ public:
 	int get_end(const Variant &p_name) const;
 };
 
+struct RegExCode;
+
 class RegEx : public RefCounted {
 	GDCLASS(RegEx, RefCounted);
 
 	void *general_ctx = nullptr;
-	void *code = nullptr;
+	RegExCode *code = nullptr;
 	String pattern;
 
 	void _pattern_info(uint32_t what, void *where) const;
+	int _match(const String &p_subject, int p_offset, int p_end, void *p_match, void *p_match_ctx) const;
 
 protected:
 	static void _bind_methods();
@@ -89,6 +92,7 @@ public:
 
 	Ref<RegExMatch> search(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	TypedArray<RegExMatch> search_all(const String &p_subject, int p_offset = 0, int p_end = -1) const;
+	PackedInt32Array search_all_offsets(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	String sub(const String &p_subject, const String &p_replacement, bool p_all = false, int p_offset = 0, int p_end = -1) const;
 
 	bool is_valid() const;
@@ -96,6 +100,8 @@ public:
 	int get_group_count() const;
 	PackedStringArray get_names() const;
 
+	static void clear_cache();
+
 	RegEx();
 	RegEx(const String &p_pattern);
 	~RegEx();
@@ -109,6 +109,30 @@ TEST_CASE("[RegEx] Searching") {
 	CHECK(re.search_all(s).size() == 0);
 }
 
+TEST_CASE("[RegEx] Searching all offsets") {
+	RegEx re("\\w(\\d)?");
+	REQUIRE(re.is_valid());
+
+	const PackedInt32Array offsets = re.search_all_offsets("a1 b");
+	REQUIRE(offsets.size() == 8);
+	CHECK(offsets[0] == 0);
+	CHECK(offsets[1] == 2);
+	CHECK(offsets[2] == 1);
+	CHECK(offsets[3] == 2);
+	CHECK(offsets[4] == 3);
+	CHECK(offsets[5] == 4);
+	CHECK(offsets[6] == -1);
+	CHECK(offsets[7] == -1);
+
+	CHECK(re.search_all_offsets("a1 b", 4).size() == 0);
+
+	// Compiling a cached pattern again behaves like a fresh compilation.
+	RegEx cached("\\w(\\d)?");
+	REQUIRE(cached.is_valid());
+	CHECK(cached.get_group_count() == 1);
+	CHECK(cached.search_all_offsets("a1 b") == offsets);
+}
+
 TEST_CASE("[RegEx] Substitution") {
 	const String s1 = "Double all the vowels.";
 
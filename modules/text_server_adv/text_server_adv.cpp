@@ -396,9 +396,12 @@ int64_t TextServerAdvanced::_get_features() const {
 void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
+		FontAdvanced *fd = font_owner.get_or_null(p_rid);
+		_async_glyph_cancel(fd);
+
 		MutexLock ftlock(ft_mutex);
+		_font_changed();
 
-		FontAdvanced *fd = font_owner.get_or_null(p_rid);
 		{
 			MutexLock lock(fd->mutex);
 			font_owner.free(p_rid);
@@ -406,6 +409,7 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 		memdelete(fd);
 	} else if (font_var_owner.owns(p_rid)) {
 		MutexLock ftlock(ft_mutex);
+		_font_changed();
 
 		FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_rid);
 		{
@@ -1347,6 +1351,131 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 	return false;
 }
 
+_FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph_or_queue(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const {
+	if (!async_glyph_rasterization) {
+		return _ensure_glyph(p_font_data, p_size, p_glyph);
+	}
+
+	ERR_FAIL_COND_V(!_ensure_cache_for_size(p_font_data, p_size), false);
+
+	const FontForSizeAdvanced *fd = p_font_data->cache[p_size];
+	if (fd->glyph_map.has(p_glyph)) {
+		return fd->glyph_map[p_glyph].found;
+	}
+	if ((p_glyph & 0xffffff) == 0) {
+		return _ensure_glyph(p_font_data, p_size, p_glyph);
+	}
+
+	AsyncGlyphRequest req;
+	req.font = p_font_data;
+	req.size = p_size;
+	req.glyph = p_glyph;
+	_async_glyph_queue(req);
+	glyph_placeholder_count.increment();
+	return false;
+}
+
+void TextServerAdvanced::_ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	if (p_font_data->msdf) {
+		_ensure_glyph(p_font_data, p_size, p_index);
+	} else {
+		for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+			if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+				_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+				_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+				_ensure_glyph(p_font_data, p_size, p_index | (2 << 27) | (aa << 24));
+				_ensure_glyph(p_font_data, p_size, p_index | (3 << 27) | (aa << 24));
+			} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+				_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+				_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+			} else {
+				_ensure_glyph(p_font_data, p_size, p_index | (aa << 24));
+			}
+		}
+	}
+}
+
+void TextServerAdvanced::_async_glyph_queue(const AsyncGlyphRequest &p_request) const {
+	MutexLock lock(async_glyph_mutex);
+	if (async_glyph_pending.has(p_request)) {
+		return;
+	}
+	async_glyph_pending.insert(p_request);
+	async_glyph_queue.push_back(p_request);
+
+	if (!async_glyph_task_running) {
+		if (async_glyph_task != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(async_glyph_task); // Already done, release it.
+		}
+		async_glyph_task_running = true;
+		async_glyph_task = WorkerThreadPool::get_singleton()->add_native_task(&TextServerAdvanced::_async_glyph_task, const_cast<TextServerAdvanced *>(this), false, String("TextServerRasterizeGlyphs"));
+	}
+}
+
+void TextServerAdvanced::_async_glyph_task(void *p_userdata) {
+	TextServerAdvanced *ts = (TextServerAdvanced *)p_userdata;
+	while (true) {
+		MutexLock work_lock(ts->async_glyph_work_mutex);
+
+		AsyncGlyphRequest req;
+		{
+			MutexLock lock(ts->async_glyph_mutex);
+			if (ts->async_glyph_queue_head >= ts->async_glyph_queue.size()) {
+				ts->async_glyph_queue.clear();
+				ts->async_glyph_queue_head = 0;
+				ts->async_glyph_task_running = false;
+				return;
+			}
+			req = ts->async_glyph_queue[ts->async_glyph_queue_head++];
+		}
+
+		if (req.font != nullptr) {
+			// Rasterizing writes to the atlas images and marks them dirty, the textures are updated once on the next draw.
+			MutexLock font_lock(req.font->mutex);
+			if (req.is_char) {
+#ifdef MODULE_FREETYPE_ENABLED
+				if (ts->_ensure_cache_for_size(req.font, req.size) && req.font->cache[req.size]->face) {
+					ts->_ensure_glyph_variants(req.font, req.size, FT_Get_Char_Index(req.font->cache[req.size]->face, req.glyph));
+				}
+#endif
+			} else {
+				ts->_ensure_glyph(req.font, req.size, req.glyph);
+			}
+		}
+
+		MutexLock lock(ts->async_glyph_mutex);
+		ts->async_glyph_pending.erase(req);
+	}
+}
+
+void TextServerAdvanced::_async_glyph_cancel(FontAdvanced *p_font_data) {
+	{
+		MutexLock lock(async_glyph_mutex);
+		for (int i = async_glyph_queue_head; i < async_glyph_queue.size(); i++) {
+			if (async_glyph_queue[i].font == p_font_data) {
+				async_glyph_pending.erase(async_glyph_queue[i]);
+				async_glyph_queue.write[i].font = nullptr;
+			}
+		}
+	}
+	// Wait for the request currently rasterized, it might use this font.
+	MutexLock work_lock(async_glyph_work_mutex);
+}
+
+void TextServerAdvanced::_async_glyph_finish() {
+	WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	{
+		MutexLock lock(async_glyph_mutex);
+		async_glyph_queue_head = async_glyph_queue.size();
+		async_glyph_pending.clear();
+		task = async_glyph_task;
+		async_glyph_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	if (task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+}
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const {
 	ERR_FAIL_COND_V(p_size.x <= 0, false);
 	if (p_font_data->cache.has(p_size)) {
@@ -1894,6 +2023,7 @@ RID TextServerAdvanced::_create_font_linked_variation(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteArray &p_data) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1905,6 +2035,7 @@ void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteA
 }
 
 void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t *p_data_ptr, int64_t p_data_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1916,6 +2047,7 @@ void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t
 }
 
 void TextServerAdvanced::_font_set_face_index(const RID &p_font_rid, int64_t p_face_index) {
+	_font_changed();
 	ERR_FAIL_COND(p_face_index < 0);
 	ERR_FAIL_COND(p_face_index >= 0x7FFF);
 
@@ -1984,6 +2116,7 @@ int64_t TextServerAdvanced::_font_get_face_count(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_style(const RID &p_font_rid, BitField<FontStyle> p_style) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2004,6 +2137,7 @@ BitField<TextServer::FontStyle> TextServerAdvanced::_font_get_style(const RID &p
 }
 
 void TextServerAdvanced::_font_set_style_name(const RID &p_font_rid, const String &p_name) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2024,6 +2158,7 @@ String TextServerAdvanced::_font_get_style_name(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_weight(const RID &p_font_rid, int64_t p_weight) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2044,6 +2179,7 @@ int64_t TextServerAdvanced::_font_get_weight(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_stretch(const RID &p_font_rid, int64_t p_stretch) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2064,6 +2200,7 @@ int64_t TextServerAdvanced::_font_get_stretch(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_name(const RID &p_font_rid, const String &p_name) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2197,6 +2334,7 @@ Dictionary TextServerAdvanced::_font_get_ot_name_strings(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_antialiasing(const RID &p_font_rid, TextServer::FontAntialiasing p_antialiasing) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2216,6 +2354,7 @@ TextServer::FontAntialiasing TextServerAdvanced::_font_get_antialiasing(const RI
 }
 
 void TextServerAdvanced::_font_set_disable_embedded_bitmaps(const RID &p_font_rid, bool p_disable_embedded_bitmaps) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2235,6 +2374,7 @@ bool TextServerAdvanced::_font_get_disable_embedded_bitmaps(const RID &p_font_ri
 }
 
 void TextServerAdvanced::_font_set_generate_mipmaps(const RID &p_font_rid, bool p_generate_mipmaps) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2259,6 +2399,7 @@ bool TextServerAdvanced::_font_get_generate_mipmaps(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_multichannel_signed_distance_field(const RID &p_font_rid, bool p_msdf) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2278,6 +2419,7 @@ bool TextServerAdvanced::_font_is_multichannel_signed_distance_field(const RID &
 }
 
 void TextServerAdvanced::_font_set_msdf_pixel_range(const RID &p_font_rid, int64_t p_msdf_pixel_range) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2297,6 +2439,7 @@ int64_t TextServerAdvanced::_font_get_msdf_pixel_range(const RID &p_font_rid) co
 }
 
 void TextServerAdvanced::_font_set_msdf_size(const RID &p_font_rid, int64_t p_msdf_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2316,6 +2459,7 @@ int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_fixed_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2332,6 +2476,7 @@ int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid, TextServer::FixedSizeScaleMode p_fixed_size_scale_mode) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2348,6 +2493,7 @@ TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mo
 }
 
 void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid, bool p_allow_system_fallback) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2364,6 +2510,7 @@ bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) c
 }
 
 void TextServerAdvanced::_font_set_force_autohinter(const RID &p_font_rid, bool p_force_autohinter) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2383,6 +2530,7 @@ bool TextServerAdvanced::_font_is_force_autohinter(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_hinting(const RID &p_font_rid, TextServer::Hinting p_hinting) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2402,6 +2550,7 @@ TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, TextServer::SubpixelPositioning p_subpixel) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2418,6 +2567,7 @@ TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioni
 }
 
 void TextServerAdvanced::_font_set_embolden(const RID &p_font_rid, double p_strength) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2437,6 +2587,7 @@ double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_spacing, int64_t p_value) {
+	_font_changed();
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2469,6 +2620,7 @@ int64_t TextServerAdvanced::_font_get_spacing(const RID &p_font_rid, SpacingType
 }
 
 void TextServerAdvanced::_font_set_baseline_offset(const RID &p_font_rid, double p_baseline_offset) {
+	_font_changed();
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
 		if (fdv->baseline_offset != p_baseline_offset) {
@@ -2500,6 +2652,7 @@ double TextServerAdvanced::_font_get_baseline_offset(const RID &p_font_rid) cons
 }
 
 void TextServerAdvanced::_font_set_transform(const RID &p_font_rid, const Transform2D &p_transform) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2519,6 +2672,7 @@ Transform2D TextServerAdvanced::_font_get_transform(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_variation_coordinates(const RID &p_font_rid, const Dictionary &p_variation_coordinates) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2538,6 +2692,7 @@ Dictionary TextServerAdvanced::_font_get_variation_coordinates(const RID &p_font
 }
 
 void TextServerAdvanced::_font_set_oversampling(const RID &p_font_rid, double p_oversampling) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2569,6 +2724,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_
 }
 
 void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2581,6 +2737,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2593,6 +2750,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2626,6 +2784,7 @@ double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_siz
 }
 
 void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size, double p_descent) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2658,6 +2817,7 @@ double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_si
 }
 
 void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int64_t p_size, double p_underline_position) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2691,6 +2851,7 @@ double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, i
 }
 
 void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, int64_t p_size, double p_underline_thickness) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2724,6 +2885,7 @@ double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size, double p_scale) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2774,6 +2936,7 @@ int64_t TextServerAdvanced::_font_get_texture_count(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_clear_textures(const RID &p_font_rid, const Vector2i &p_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 	MutexLock lock(fd->mutex);
@@ -2784,6 +2947,7 @@ void TextServerAdvanced::_font_clear_textures(const RID &p_font_rid, const Vecto
 }
 
 void TextServerAdvanced::_font_remove_texture(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2796,6 +2960,7 @@ void TextServerAdvanced::_font_remove_texture(const RID &p_font_rid, const Vecto
 }
 
 void TextServerAdvanced::_font_set_texture_image(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index, const Ref<Image> &p_image) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 	ERR_FAIL_COND(p_image.is_null());
@@ -2837,6 +3002,7 @@ Ref<Image> TextServerAdvanced::_font_get_texture_image(const RID &p_font_rid, co
 }
 
 void TextServerAdvanced::_font_set_texture_offsets(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index, const PackedInt32Array &p_offsets) {
+	_font_changed();
 	ERR_FAIL_COND(p_offsets.size() % 4 != 0);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -2898,6 +3064,7 @@ PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2909,6 +3076,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2978,6 +3146,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64
 }
 
 void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3029,6 +3198,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_offset) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3080,6 +3250,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_gl_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3120,6 +3291,7 @@ Rect2 TextServerAdvanced::_font_get_glyph_uv_rect(const RID &p_font_rid, const V
 }
 
 void TextServerAdvanced::_font_set_glyph_uv_rect(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Rect2 &p_uv_rect) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3160,6 +3332,7 @@ int64_t TextServerAdvanced::_font_get_glyph_texture_idx(const RID &p_font_rid, c
 }
 
 void TextServerAdvanced::_font_set_glyph_texture_idx(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, int64_t p_texture_idx) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3341,6 +3514,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_fon
 }
 
 void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t p_size) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3352,6 +3526,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3363,6 +3538,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3541,23 +3717,7 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
 		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+			_ensure_glyph_variants(fd, size, idx);
 		}
 #endif
 	}
@@ -3573,23 +3733,7 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 	int32_t idx = p_index & 0xffffff; // Remove subpixel shifts.
 	if (fd->cache[size]->face) {
-		if (fd->msdf) {
-			_ensure_glyph(fd, size, (int32_t)idx);
-		} else {
-			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-				} else {
-					_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-				}
-			}
-		}
+		_ensure_glyph_variants(fd, size, idx);
 	}
 #endif
 }
@@ -3629,8 +3773,8 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 	}
 #endif
 
-	if (!_ensure_glyph(fd, size, index)) {
-		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
+	if (!_ensure_glyph_or_queue(fd, size, index)) {
+		return; // Invalid, non-graphical or not yet rasterized glyph, do not display errors, nothing to draw.
 	}
 
 	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
@@ -3737,8 +3881,8 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 	}
 #endif
 
-	if (!_ensure_glyph(fd, size, index)) {
-		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
+	if (!_ensure_glyph_or_queue(fd, size, index)) {
+		return; // Invalid, non-graphical or not yet rasterized glyph, do not display errors, nothing to draw.
 	}
 
 	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
@@ -3823,6 +3967,7 @@ bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, cons
 }
 
 void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_rid, const String &p_language, bool p_supported) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3839,6 +3984,7 @@ bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_r
 }
 
 void TextServerAdvanced::_font_remove_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3873,6 +4019,7 @@ bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid, const String &p_script, bool p_supported) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3889,6 +4036,7 @@ bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid
 }
 
 void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3909,6 +4057,7 @@ PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const R
 }
 
 void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_rid, const Dictionary &p_overrides) {
+	_font_changed();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3951,6 +4100,7 @@ double TextServerAdvanced::_font_get_global_oversampling() const {
 }
 
 void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
+	_font_changed();
 	_THREAD_SAFE_METHOD_
 	if (oversampling != p_oversampling) {
 		oversampling = p_oversampling;
@@ -6097,7 +6247,7 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 			gl.index = glyph_info[i].codepoint;
 			if (gl.index != 0) {
-				_ensure_glyph(fd, fss, gl.index | mod);
+				_ensure_glyph_or_queue(fd, fss, gl.index | mod);
 				if (subpos) {
 					gl.x_off = (double)glyph_pos[i].x_offset / (64.0 / scale);
 				} else if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
@@ -6265,6 +6415,31 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		sd->bidi_override.push_back(Vector3i(sd->start, sd->end, DIRECTION_INHERITED));
 	}
 
+	// Reuse the glyphs of an identical text shaped before, only the BiDi iterators need to be rebuilt then.
+	ShapedTextCacheKey cache_key;
+	const bool cacheable = _shaped_text_cache_make_key(sd, cache_key);
+	bool cache_hit = false;
+	if (cacheable) {
+		if (shaped_text_cache_font_revision != font_revision.get()) {
+			shaped_text_cache.clear();
+			shaped_text_cache_font_revision = font_revision.get();
+		}
+		ShapedTextCacheEntry *entry = shaped_text_cache.getptr(cache_key);
+		if (entry) {
+			entry->last_used = ++shaped_text_cache_tick;
+			sd->glyphs = entry->glyphs;
+			sd->ascent = entry->ascent;
+			sd->descent = entry->descent;
+			sd->width = entry->width;
+			sd->upos = entry->upos;
+			sd->uthk = entry->uthk;
+			cache_hit = true;
+			shaped_text_cache_hits.increment();
+		} else {
+			shaped_text_cache_misses.increment();
+		}
+	}
+
 	for (int ov = 0; ov < sd->bidi_override.size(); ov++) {
 		// Create BiDi iterator.
 		int start = _convert_pos_inv(sd, sd->bidi_override[ov].x - sd->start);
@@ -6307,6 +6482,10 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 		sd->bidi_iter.push_back(bidi_iter);
 
+		if (cache_hit) {
+			continue;
+		}
+
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
 		if (bidi_iter) {
@@ -6415,11 +6594,147 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
-	_realign(sd);
+	if (!cache_hit) {
+		_realign(sd);
+		if (cacheable) {
+			_shaped_text_cache_insert(cache_key, sd);
+		}
+	}
 	sd->valid = true;
 	return sd->valid;
 }
 
+bool TextServerAdvanced::_shaped_text_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const {
+	// Embedded objects are positioned by the user, and long texts are unlikely to be repeated.
+	if (!p_sd->objects.is_empty() || p_sd->text.length() > SHAPED_TEXT_CACHE_MAX_TEXT_LENGTH) {
+		return false;
+	}
+
+	r_key.text = p_sd->text;
+	if (p_sd->direction == DIRECTION_AUTO || p_sd->direction == DIRECTION_INHERITED) {
+		r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+	}
+	r_key.direction = p_sd->direction;
+	r_key.orientation = p_sd->orientation;
+	r_key.preserve_invalid = p_sd->preserve_invalid;
+	r_key.preserve_control = p_sd->preserve_control;
+	r_key.bidi_override = p_sd->bidi_override;
+
+	uint32_t hash = r_key.text.hash();
+	hash = hash_murmur3_one_32(r_key.locale.hash(), hash);
+	hash = hash_murmur3_one_32(((int)r_key.direction) | ((int)r_key.orientation << 4) | ((int)r_key.preserve_invalid << 8) | ((int)r_key.preserve_control << 9), hash);
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+		hash = hash_murmur3_one_32(r_key.extra_spacing[i], hash);
+	}
+	for (const Vector3i &ov : r_key.bidi_override) {
+		hash = hash_murmur3_one_32(ov.x, hash);
+		hash = hash_murmur3_one_32(ov.y, hash);
+		hash = hash_murmur3_one_32(ov.z, hash);
+	}
+
+	r_key.spans.resize(p_sd->spans.size());
+	for (int i = 0; i < p_sd->spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = p_sd->spans[i];
+		if (span.embedded_key != Variant()) {
+			return false;
+		}
+
+		ShapedTextCacheKey::Span &key_span = r_key.spans.write[i];
+		key_span.start = span.start;
+		key_span.end = span.end;
+		key_span.fonts = span.fonts;
+		key_span.font_size = span.font_size;
+		key_span.language = span.language;
+		key_span.features = span.features;
+
+		hash = hash_murmur3_one_32(span.start, hash);
+		hash = hash_murmur3_one_32(span.end, hash);
+		hash = hash_murmur3_one_32(span.font_size, hash);
+		hash = hash_murmur3_one_32(span.fonts.hash(), hash);
+		hash = hash_murmur3_one_32(span.language.hash(), hash);
+		hash = hash_murmur3_one_32(span.features.hash(), hash);
+	}
+	r_key.hash = hash_fmix32(hash);
+
+	return true;
+}
+
+void TextServerAdvanced::_shaped_text_cache_insert(const ShapedTextCacheKey &p_key, const ShapedTextDataAdvanced *p_sd) {
+	if (shaped_text_cache.size() >= SHAPED_TEXT_CACHE_MAX_ENTRIES) {
+		// Evict the least recently used quarter of the entries at once, so the scan is amortized over many insertions.
+		Vector<uint64_t> ticks;
+		ticks.resize(shaped_text_cache.size());
+		int index = 0;
+		for (const KeyValue<ShapedTextCacheKey, ShapedTextCacheEntry> &E : shaped_text_cache) {
+			ticks.write[index++] = E.value.last_used;
+		}
+		ticks.sort();
+		const uint64_t threshold = ticks[ticks.size() / 4];
+
+		Vector<ShapedTextCacheKey> to_erase;
+		for (const KeyValue<ShapedTextCacheKey, ShapedTextCacheEntry> &E : shaped_text_cache) {
+			if (E.value.last_used <= threshold) {
+				to_erase.push_back(E.key);
+			}
+		}
+		for (const ShapedTextCacheKey &key : to_erase) {
+			shaped_text_cache.erase(key);
+		}
+	}
+
+	ShapedTextCacheEntry entry;
+	entry.glyphs = p_sd->glyphs;
+	entry.ascent = p_sd->ascent;
+	entry.descent = p_sd->descent;
+	entry.width = p_sd->width;
+	entry.upos = p_sd->upos;
+	entry.uthk = p_sd->uthk;
+	entry.last_used = ++shaped_text_cache_tick;
+	shaped_text_cache.insert(p_key, entry);
+}
+
+#ifndef GDEXTENSION
+uint64_t TextServerAdvanced::shaped_text_get_cache_hits() const {
+	return shaped_text_cache_hits.get();
+}
+
+uint64_t TextServerAdvanced::shaped_text_get_cache_misses() const {
+	return shaped_text_cache_misses.get();
+}
+
+void TextServerAdvanced::set_async_glyph_rasterization(bool p_enabled) {
+	async_glyph_rasterization = p_enabled;
+}
+
+bool TextServerAdvanced::is_async_glyph_rasterization_enabled() const {
+	return async_glyph_rasterization;
+}
+
+uint64_t TextServerAdvanced::get_glyph_placeholder_count() const {
+	return glyph_placeholder_count.get();
+}
+
+void TextServerAdvanced::font_prewarm_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
+
+	// Always done in the background, regardless of the async rasterization setting.
+	for (int i = 0; i < p_characters.length(); i++) {
+		AsyncGlyphRequest req;
+		req.font = fd;
+		req.size = size;
+		req.glyph = p_characters[i];
+		req.is_char = true;
+		_async_glyph_queue(req);
+	}
+}
+#endif
+
 bool TextServerAdvanced::_shaped_text_is_ready(const RID &p_shaped) const {
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
@@ -7412,6 +7727,7 @@ void TextServerAdvanced::_cleanup() {
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
+	_async_glyph_finish();
 	_bmp_free_font_funcs();
 #ifdef MODULE_FREETYPE_ENABLED
 	if (ft_library != nullptr) {
@@ -361,6 +361,8 @@ class TextServerAdvanced : public TextServerExtension {
 #endif
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
+	_FORCE_INLINE_ bool _ensure_glyph_or_queue(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
+	void _ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
 
@@ -647,6 +649,109 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// Shaping results, shared by all shaped texts with the same input.
+	struct ShapedTextCacheKey {
+		struct Span {
+			int start = -1;
+			int end = -1;
+			Array fonts;
+			int font_size = 0;
+			String language;
+			Dictionary features;
+
+			bool operator==(const Span &p_b) const {
+				return (start == p_b.start) && (end == p_b.end) && (font_size == p_b.font_size) && (language == p_b.language) && (fonts == p_b.fonts) && (features == p_b.features);
+			}
+			bool operator!=(const Span &p_b) const {
+				return !(*this == p_b);
+			}
+		};
+
+		String text;
+		String locale; // Used to guess the direction of neutral text.
+		TextServer::Direction direction = DIRECTION_AUTO;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		Vector<Vector3i> bidi_override;
+		Vector<Span> spans;
+		uint32_t hash = 0;
+
+		bool operator==(const ShapedTextCacheKey &p_b) const {
+			return (hash == p_b.hash) && (direction == p_b.direction) && (orientation == p_b.orientation) && (preserve_invalid == p_b.preserve_invalid) && (preserve_control == p_b.preserve_control) && (extra_spacing[SPACING_TOP] == p_b.extra_spacing[SPACING_TOP]) && (extra_spacing[SPACING_BOTTOM] == p_b.extra_spacing[SPACING_BOTTOM]) && (extra_spacing[SPACING_SPACE] == p_b.extra_spacing[SPACING_SPACE]) && (extra_spacing[SPACING_GLYPH] == p_b.extra_spacing[SPACING_GLYPH]) && (text == p_b.text) && (locale == p_b.locale) && (bidi_override == p_b.bidi_override) && (spans == p_b.spans);
+		}
+	};
+
+	struct ShapedTextCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapedTextCacheKey &p_a) {
+			return p_a.hash;
+		}
+	};
+
+	struct ShapedTextCacheEntry {
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+		uint64_t last_used = 0;
+	};
+
+	static constexpr int SHAPED_TEXT_CACHE_MAX_ENTRIES = 2048;
+	static constexpr int SHAPED_TEXT_CACHE_MAX_TEXT_LENGTH = 256; // Long paragraphs are rarely repeated, don't keep their glyphs around.
+
+	HashMap<ShapedTextCacheKey, ShapedTextCacheEntry, ShapedTextCacheKeyHasher> shaped_text_cache;
+	uint64_t shaped_text_cache_tick = 0;
+	uint64_t shaped_text_cache_font_revision = 0;
+	SafeNumeric<uint64_t> font_revision; // Incremented by every change to a font, invalidates the shaping results.
+	SafeNumeric<uint64_t> shaped_text_cache_hits;
+	SafeNumeric<uint64_t> shaped_text_cache_misses;
+
+	_FORCE_INLINE_ void _font_changed() {
+		font_revision.increment();
+	}
+	bool _shaped_text_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const;
+	void _shaped_text_cache_insert(const ShapedTextCacheKey &p_key, const ShapedTextDataAdvanced *p_sd);
+
+	// Glyphs rasterized on the WorkerThreadPool, drawn as placeholders (nothing) until they are ready.
+	struct AsyncGlyphRequest {
+		FontAdvanced *font = nullptr;
+		Vector2i size;
+		int64_t glyph = 0;
+		bool is_char = false; // Character code to pre-warm, rasterized with all its subpixel and LCD variants.
+
+		bool operator==(const AsyncGlyphRequest &p_b) const {
+			return (font == p_b.font) && (size == p_b.size) && (glyph == p_b.glyph) && (is_char == p_b.is_char);
+		}
+	};
+
+	struct AsyncGlyphRequestHasher {
+		_FORCE_INLINE_ static uint32_t hash(const AsyncGlyphRequest &p_a) {
+			uint32_t hash = hash_murmur3_one_64((uint64_t)(uintptr_t)p_a.font);
+			hash = hash_murmur3_one_32(p_a.size.x, hash);
+			hash = hash_murmur3_one_32(p_a.size.y, hash);
+			hash = hash_murmur3_one_64(p_a.glyph, hash);
+			return hash_fmix32(hash_murmur3_one_32(p_a.is_char, hash));
+		}
+	};
+
+	bool async_glyph_rasterization = false;
+	mutable Mutex async_glyph_mutex; // Protects the queue and the task state.
+	mutable Mutex async_glyph_work_mutex; // Held by the worker while it rasterizes a request.
+	mutable Vector<AsyncGlyphRequest> async_glyph_queue;
+	mutable int async_glyph_queue_head = 0;
+	mutable HashSet<AsyncGlyphRequest, AsyncGlyphRequestHasher> async_glyph_pending;
+	mutable WorkerThreadPool::TaskID async_glyph_task = WorkerThreadPool::INVALID_TASK_ID;
+	mutable bool async_glyph_task_running = false;
+	mutable SafeNumeric<uint64_t> glyph_placeholder_count;
+
+	void _async_glyph_queue(const AsyncGlyphRequest &p_request) const;
+	void _async_glyph_cancel(FontAdvanced *p_font_data);
+	void _async_glyph_finish();
+	static void _async_glyph_task(void *p_userdata);
+
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
@@ -996,6 +1101,16 @@ public:
 
 	MODBIND0(cleanup);
 
+#ifndef GDEXTENSION
+	virtual uint64_t shaped_text_get_cache_hits() const override;
+	virtual uint64_t shaped_text_get_cache_misses() const override;
+
+	virtual void set_async_glyph_rasterization(bool p_enabled) override;
+	virtual bool is_async_glyph_rasterization_enabled() const override;
+	virtual uint64_t get_glyph_placeholder_count() const override;
+	virtual void font_prewarm_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) override;
+#endif
+
 	TextServerAdvanced();
 	~TextServerAdvanced();
 };
@@ -31,6 +31,7 @@
 #include "video_stream_theora.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "scene/resources/image_texture.h"
 
@@ -92,35 +93,56 @@ int VideoStreamPlaybackTheora::queue_page(ogg_page *page) {
 }
 
 void VideoStreamPlaybackTheora::video_write() {
-	th_ycbcr_buffer yuv;
-	th_decode_ycbcr_out(td, yuv);
+	th_decode_ycbcr_out(td, frame_yuv);
 
 	int pitch = 4;
-	frame_data.resize(size.x * size.y * pitch);
+	frame_buffer = (frame_buffer + 1) % FRAME_BUFFERS;
+	Vector<uint8_t> &data = frame_data[frame_buffer];
+	data.resize(size.x * size.y * pitch); // No-op once the buffer has the right size.
 	{
-		uint8_t *w = frame_data.ptrw();
-		char *dst = (char *)w;
+		// The buffer is only referenced here again once the upload of two frames ago has been consumed, so this doesn't copy.
+		uint8_t *w = data.ptrw();
 
-		if (px_fmt == TH_PF_444) {
-			yuv444_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_422) {
-			yuv422_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_420) {
-			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
+		int band_count = (size.y + CONVERT_BAND_HEIGHT - 1) / CONVERT_BAND_HEIGHT;
+		if (band_count > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &VideoStreamPlaybackTheora::_convert_frame_band, w, band_count, -1, true, SNAME("TheoraConvertFrame"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_convert_frame_band(0, w);
 		}
 
 		format = Image::FORMAT_RGBA8;
 	}
 
-	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, frame_data)); //zero copy image creation
+	Ref<Image> img = memnew(Image(size.x, size.y, 0, Image::FORMAT_RGBA8, data)); //zero copy image creation
 
 	texture->update(img); //zero copy send to rendering server
 
 	frames_pending = 1;
 }
 
+void VideoStreamPlaybackTheora::_convert_frame_band(uint32_t p_band, uint8_t *p_dst) {
+	int from = p_band * CONVERT_BAND_HEIGHT;
+	int height = MIN((int)CONVERT_BAND_HEIGHT, size.y - from);
+	// 4:2:0 shares each chroma row between two luma rows.
+	int uv_from = px_fmt == TH_PF_420 ? from / 2 : from;
+
+	uint8_t *dst = p_dst + from * (size.x << 2);
+	const uint8_t *y = frame_yuv[0].data + from * frame_yuv[0].stride;
+	const uint8_t *u = frame_yuv[1].data + uv_from * frame_yuv[1].stride;
+	const uint8_t *v = frame_yuv[2].data + uv_from * frame_yuv[2].stride;
+
+	if (px_fmt == TH_PF_444) {
+		yuv444_2_rgb8888(dst, y, u, v, size.x, height, frame_yuv[0].stride, frame_yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_422) {
+		yuv422_2_rgb8888(dst, y, u, v, size.x, height, frame_yuv[0].stride, frame_yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_420) {
+		yuv420_2_rgb8888(dst, y, u, v, size.x, height, frame_yuv[0].stride, frame_yuv[1].stride, size.x << 2);
+	}
+}
+
 void VideoStreamPlaybackTheora::clear() {
 	if (file.is_null()) {
 		return;
@@ -52,11 +52,16 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 
 	enum {
 		MAX_FRAMES = 4,
+		FRAME_BUFFERS = 2,
+		CONVERT_BAND_HEIGHT = 64, // Must be even so 4:2:0 chroma rows stay aligned.
 	};
 
 	//Image frames[MAX_FRAMES];
 	Image::Format format = Image::Format::FORMAT_L8;
-	Vector<uint8_t> frame_data;
+	// RGBA8 buffers are used in turns, so the one being written is no longer referenced by the previous upload.
+	Vector<uint8_t> frame_data[FRAME_BUFFERS];
+	int frame_buffer = 0;
+	th_ycbcr_buffer frame_yuv;
 	int frames_pending = 0;
 	Ref<FileAccess> file;
 	String file_name;
@@ -66,6 +71,7 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	int buffer_data();
 	int queue_page(ogg_page *page);
 	void video_write();
+	void _convert_frame_band(uint32_t p_band, uint8_t *p_dst);
 	double get_time() const;
 
 	bool theora_eos = false;
@@ -32,8 +32,119 @@
 
 #include "scene/resources/mesh.h"
 
+#ifdef TOOLS_ENABLED
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#endif
+
 #include "thirdparty/vhacd/public/VHACD.h"
 
+#ifdef TOOLS_ENABLED
+// Decompositions run in the editor are cached in the imported files folder, so
+// reimporting a scene whose meshes and decomposition settings didn't change is instant.
+
+#define VHACD_CACHE_VERSION 1
+
+static String _get_cache_path(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const VHACD::IVHACD::Parameters &p_params) {
+	CryptoCore::SHA256Context ctx;
+	ctx.start();
+	ctx.update((const uint8_t *)p_vertices, p_vertex_count * 3 * sizeof(real_t));
+	ctx.update((const uint8_t *)p_triangles, p_triangle_count * 3 * sizeof(uint32_t));
+	// Parameters only holds plain values besides the callback and logger pointers, which don't affect the result.
+	const double values[] = {
+		p_params.m_concavity,
+		p_params.m_alpha,
+		p_params.m_beta,
+		p_params.m_minVolumePerCH,
+		(double)p_params.m_resolution,
+		(double)p_params.m_maxNumVerticesPerCH,
+		(double)p_params.m_planeDownsampling,
+		(double)p_params.m_convexhullDownsampling,
+		(double)p_params.m_pca,
+		(double)p_params.m_mode,
+		(double)p_params.m_convexhullApproximation,
+		(double)p_params.m_maxConvexHulls,
+		(double)p_params.m_projectHullVertices,
+	};
+	ctx.update((const uint8_t *)values, sizeof(values));
+
+	unsigned char hash[32];
+	ctx.finish(hash);
+	return ProjectSettings::get_singleton()->get_imported_files_path().path_join("vhacd").path_join(String::hex_encode_buffer(hash, 32) + ".vhacd");
+}
+
+static bool _load_cache(const String &p_path, Vector<Vector<Vector3>> &r_hulls, Vector<Vector<uint32_t>> *r_convex_indices) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null() || f->get_32() != VHACD_CACHE_VERSION) {
+		return false;
+	}
+
+	uint32_t hull_count = f->get_32();
+	r_hulls.resize(hull_count);
+	if (r_convex_indices) {
+		r_convex_indices->resize(hull_count);
+	}
+
+	for (uint32_t i = 0; i < hull_count; i++) {
+		Vector<Vector3> &points = r_hulls.write[i];
+		points.resize(f->get_32());
+		Vector3 *w = points.ptrw();
+		for (int j = 0; j < points.size(); j++) {
+			w[j].x = f->get_double();
+			w[j].y = f->get_double();
+			w[j].z = f->get_double();
+		}
+
+		Vector<uint32_t> indices;
+		indices.resize(f->get_32());
+		for (uint32_t &index : indices) {
+			index = f->get_32();
+		}
+		if (r_convex_indices) {
+			r_convex_indices->write[i] = indices;
+		}
+	}
+
+	return !f->eof_reached();
+}
+
+static void _save_cache(const String &p_path, const Vector<Vector<Vector3>> &p_hulls, const Vector<Vector<uint32_t>> &p_convex_indices) {
+	Error err = DirAccess::make_dir_recursive_absolute(p_path.get_base_dir());
+	ERR_FAIL_COND(err != OK && err != ERR_ALREADY_EXISTS);
+
+	// Decompositions may run in parallel, write to a temporary file so readers never see a partial one.
+	String tmp_path = p_path + ".tmp";
+	{
+		Ref<FileAccess> f = FileAccess::open(tmp_path, FileAccess::WRITE);
+		ERR_FAIL_COND(f.is_null());
+
+		f->store_32(VHACD_CACHE_VERSION);
+		f->store_32(p_hulls.size());
+		for (int i = 0; i < p_hulls.size(); i++) {
+			f->store_32(p_hulls[i].size());
+			for (const Vector3 &point : p_hulls[i]) {
+				f->store_double(point.x);
+				f->store_double(point.y);
+				f->store_double(point.z);
+			}
+
+			f->store_32(p_convex_indices[i].size());
+			for (uint32_t index : p_convex_indices[i]) {
+				f->store_32(index);
+			}
+		}
+	}
+
+	Ref<DirAccess> da = DirAccess::create_for_path(tmp_path);
+	if (da->rename(tmp_path, p_path) != OK) {
+		da->remove(tmp_path);
+	}
+}
+#endif // TOOLS_ENABLED
+
 static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const Ref<MeshConvexDecompositionSettings> &p_settings, Vector<Vector<uint32_t>> *r_convex_indices) {
 	VHACD::IVHACD::Parameters params;
 	params.m_concavity = p_settings->get_max_concavity();
@@ -51,6 +162,24 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 	params.m_maxConvexHulls = p_settings->get_max_convex_hulls();
 	params.m_projectHullVertices = p_settings->get_project_hull_vertices();
 
+#ifdef TOOLS_ENABLED
+	String cache_path;
+	if (Engine::get_singleton()->is_editor_hint()) {
+		cache_path = _get_cache_path(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params);
+
+		Vector<Vector<Vector3>> cached;
+		if (_load_cache(cache_path, cached, r_convex_indices)) {
+			return cached;
+		}
+	}
+
+	// The cache always stores indices, even if the caller doesn't need them.
+	Vector<Vector<uint32_t>> convex_indices;
+	if (!r_convex_indices && !cache_path.is_empty()) {
+		r_convex_indices = &convex_indices;
+	}
+#endif
+
 	VHACD::IVHACD *decomposer = VHACD::CreateVHACD();
 	decomposer->Compute(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params);
 
@@ -88,6 +217,12 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 	decomposer->Clean();
 	decomposer->Release();
 
+#ifdef TOOLS_ENABLED
+	if (!cache_path.is_empty()) {
+		_save_cache(cache_path, ret, *r_convex_indices);
+	}
+#endif
+
 	return ret;
 }
 
@@ -38,6 +38,27 @@
 
 int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND_V(!ready, 0);
+	return decode_ahead.mix(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackOggVorbis::decode_ahead_mix(AudioFrame *p_buffer, int p_frames) {
+	return _decode_frames(p_buffer, p_frames);
+}
+
+bool AudioStreamPlaybackOggVorbis::decode_ahead_is_active() const {
+	return active;
+}
+
+double AudioStreamPlaybackOggVorbis::decode_ahead_get_position() const {
+	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+}
+
+int AudioStreamPlaybackOggVorbis::decode_ahead_get_loop_count() const {
+	return loops;
+}
+
+int AudioStreamPlaybackOggVorbis::_decode_frames(AudioFrame *p_buffer, int p_frames) {
+	ERR_FAIL_COND_V(!ready, 0);
 
 	if (!active) {
 		return 0;
@@ -116,7 +137,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -129,7 +150,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (use_loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -231,27 +252,34 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
-	loop_fade_remaining = FADE_SIZE;
-	active = true;
-	seek(p_from_pos);
-	loops = 0;
+	{
+		MutexLock lock(decode_ahead.get_decode_mutex());
+		loop_fade_remaining = FADE_SIZE;
+		active = true;
+		_seek(p_from_pos);
+		loops = 0;
+		decode_ahead.flush();
+	}
 	begin_resample();
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	MutexLock lock(decode_ahead.get_decode_mutex());
 	active = false;
+	decode_ahead.flush();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	// The decoder may already have reached the end while the tail is still buffered.
+	return !decode_ahead.is_finished();
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
-	return loops;
+	return decode_ahead.get_loop_count();
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	return decode_ahead.get_position();
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -278,6 +306,12 @@ Variant AudioStreamPlaybackOggVorbis::get_parameter(const StringName &p_name) co
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	MutexLock lock(decode_ahead.get_decode_mutex());
+	_seek(p_time);
+	decode_ahead.flush();
+}
+
+void AudioStreamPlaybackOggVorbis::_seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -393,6 +427,9 @@ void AudioStreamPlaybackOggVorbis::set_sample_playback(const Ref<AudioSamplePlay
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	// Make sure the decode thread is done with us before tearing down the decoder.
+	decode_ahead.release();
+
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
@@ -419,6 +456,9 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->active = false;
 	ovs->loops = 0;
 	if (ovs->_alloc_vorbis()) {
+		ovs->decode_ahead.init(ovs.ptr(), packet_sequence->get_sampling_rate());
+		MutexLock lock(ovs->decode_ahead.get_decode_mutex());
+		ovs->decode_ahead.flush();
 		return ovs;
 	}
 	// Failed to allocate data structures.
@@ -33,13 +33,14 @@
 
 #include "core/variant/variant.h"
 #include "modules/ogg/ogg_packet_sequence.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_stream.h"
 
 #include <vorbis/codec.h>
 
 class AudioStreamOggVorbis;
 
-class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
+class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled, public AudioDecodeAheadBuffer::Source {
 	GDCLASS(AudioStreamPlaybackOggVorbis, AudioStreamPlaybackResampled);
 
 	uint32_t frames_mixed = 0;
@@ -69,6 +70,8 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 	bool have_samples_left = false;
 	bool have_packets_left = false;
 
+	AudioDecodeAheadBuffer decode_ahead;
+
 	friend class AudioStreamOggVorbis;
 
 	Ref<OggPacketSequence> vorbis_data;
@@ -80,6 +83,8 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 
 	int _mix_frames(AudioFrame *p_buffer, int p_frames);
 	int _mix_frames_vorbis(AudioFrame *p_buffer, int p_frames);
+	int _decode_frames(AudioFrame *p_buffer, int p_frames);
+	void _seek(double p_time);
 
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
@@ -88,6 +93,11 @@ protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
+	virtual int decode_ahead_mix(AudioFrame *p_buffer, int p_frames) override;
+	virtual bool decode_ahead_is_active() const override;
+	virtual double decode_ahead_get_position() const override;
+	virtual int decode_ahead_get_loop_count() const override;
+
 public:
 	virtual void start(double p_from_pos = 0.0) override;
 	virtual void stop() override;
@@ -161,6 +171,8 @@ public:
 	void set_packet_sequence(Ref<OggPacketSequence> p_packet_sequence);
 	Ref<OggPacketSequence> get_packet_sequence() const;
 
+	virtual uint64_t get_memory_usage() const override { return packet_sequence.is_valid() ? packet_sequence->get_memory_usage() : 0; }
+
 	virtual double get_length() const override; //if supported, otherwise return 0
 
 	virtual bool is_monophonic() const override;
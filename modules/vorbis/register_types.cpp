@@ -32,6 +32,8 @@
 
 #include "audio_stream_ogg_vorbis.h"
 
+#include "core/io/resource_loader.h"
+
 #ifdef TOOLS_ENABLED
 #include "resource_importer_ogg_vorbis.h"
 #endif
@@ -59,6 +61,7 @@ void initialize_vorbis_module(ModuleInitializationLevel p_level) {
 
 	GDREGISTER_CLASS(AudioStreamOggVorbis);
 	GDREGISTER_CLASS(AudioStreamPlaybackOggVorbis);
+	ResourceLoader::add_placeholder_type("AudioStreamOggVorbis", "AudioStreamWAV");
 }
 
 void uninitialize_vorbis_module(ModuleInitializationLevel p_level) {
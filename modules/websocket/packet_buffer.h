@@ -92,6 +92,36 @@ public:
 		return OK;
 	}
 
+	// Like read_packet, but avoids copying the payload when it is stored contiguously.
+	// r_payload then points into the buffer, and stays valid until the next write.
+	Error read_packet_view(const uint8_t **r_payload, uint8_t *r_fallback, int p_bytes, T *r_info, int &r_read) {
+		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
+		_Packet p = _packets[_read_pos];
+		_read_pos += 1;
+		if (_read_pos >= _packets.size()) {
+			_read_pos = 0;
+		}
+		_queued -= 1;
+
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
+
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		const uint8_t *ptr = _payload.peek_contiguous(p.size);
+		if (ptr) {
+			_payload.advance_read(p.size);
+			*r_payload = ptr;
+			return OK;
+		}
+		if (p_bytes < (int)p.size) {
+			_payload.advance_read(p.size);
+			ERR_FAIL_V(ERR_OUT_OF_MEMORY);
+		}
+		_payload.read(r_fallback, p.size);
+		*r_payload = r_fallback;
+		return OK;
+	}
+
 	void resize(int p_buf_shift, int p_max_packets) {
 		_payload.resize(p_buf_shift);
 		_packets.resize(p_max_packets);
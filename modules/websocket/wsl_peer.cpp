@@ -34,6 +34,8 @@
 
 #include "core/io/stream_peer_tls.h"
 
+#include <zlib.h>
+
 CryptoCore::RandomGenerator *WSLPeer::_static_rng = nullptr;
 
 void WSLPeer::initialize() {
@@ -187,6 +189,9 @@ bool WSLPeer::_parse_client_request() {
 #undef WSL_CHECK_EX
 #undef WSL_CHECK
 	session_key = headers["sec-websocket-key"];
+	if (compression_enabled && headers.has("sec-websocket-extensions")) {
+		deflate_enabled = _parse_deflate_offer(headers["sec-websocket-extensions"]);
+	}
 	if (headers.has("sec-websocket-protocol")) {
 		Vector<String> protos = headers["sec-websocket-protocol"].split(",");
 		for (int i = 0; i < protos.size(); i++) {
@@ -260,6 +265,9 @@ Error WSLPeer::_do_server_handshake() {
 				if (!selected_protocol.is_empty()) {
 					s += "Sec-WebSocket-Protocol: " + selected_protocol + "\r\n";
 				}
+				if (deflate_enabled) {
+					s += "Sec-WebSocket-Extensions: " + _get_deflate_response() + "\r\n";
+				}
 				for (int i = 0; i < handshake_headers.size(); i++) {
 					s += handshake_headers[i] + "\r\n";
 				}
@@ -296,6 +304,10 @@ Error WSLPeer::_do_server_handshake() {
 			// Response sent, initialize wslay context.
 			wslay_event_context_server_init(&wsl_ctx, &_wsl_callbacks, this);
 			wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
+			if (deflate_enabled && _init_deflate() != OK) {
+				close(-1);
+				return FAILED;
+			}
 			in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
 			packet_buffer.resize(inbound_buffer_size);
 			ready_state = STATE_OPEN;
@@ -404,6 +416,10 @@ void WSLPeer::_do_client_handshake() {
 				}
 				wslay_event_context_client_init(&wsl_ctx, &_wsl_callbacks, this);
 				wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
+				if (deflate_enabled && _init_deflate() != OK) {
+					close(-1);
+					return;
+				}
 				in_buffer.resize(nearest_shift(inbound_buffer_size), max_queued_packets);
 				packet_buffer.resize(inbound_buffer_size);
 				ready_state = STATE_OPEN;
@@ -469,6 +485,14 @@ bool WSLPeer::_verify_server_response() {
 			ERR_FAIL_V_MSG(false, "Received unrequested sub-protocol -> " + selected_protocol);
 		}
 	}
+	if (headers.has("sec-websocket-extensions")) {
+		// We only ever offer permessage-deflate.
+		ERR_FAIL_COND_V_MSG(!compression_enabled, false, "Received unrequested extension -> " + headers["sec-websocket-extensions"]);
+		if (!_parse_deflate_response(headers["sec-websocket-extensions"])) {
+			return false;
+		}
+		deflate_enabled = true;
+	}
 	return true;
 }
 
@@ -545,6 +569,10 @@ Error WSLPeer::connect_to_url(const String &p_url, Ref<TLSOptions> p_options) {
 		}
 		request += "\r\n";
 	}
+	if (compression_enabled) {
+		// Any window size is fine for our decompressor, let the server pick ours too.
+		request += "Sec-WebSocket-Extensions: permessage-deflate; client_max_window_bits\r\n";
+	}
 	for (int i = 0; i < handshake_headers.size(); i++) {
 		request += handshake_headers[i] + "\r\n";
 	}
@@ -633,7 +661,19 @@ void WSLPeer::_wsl_msg_recv_callback(wslay_event_context_ptr ctx, const struct w
 	if (op == WSLAY_TEXT_FRAME || op == WSLAY_BINARY_FRAME) {
 		// Message.
 		uint8_t is_string = arg->opcode == WSLAY_TEXT_FRAME ? 1 : 0;
-		peer->in_buffer.write_packet(arg->msg, arg->msg_length, &is_string);
+		if (wslay_get_rsv1(arg->rsv)) {
+			// Compressed, wslay only lets RSV1 through when permessage-deflate was negotiated.
+			const uint8_t *msg = nullptr;
+			int msg_length = 0;
+			if (peer->_inflate(arg->msg, arg->msg_length, &msg, msg_length) != OK) {
+				wslay_event_queue_close(ctx, WSLAY_CODE_INVALID_FRAME_PAYLOAD_DATA, nullptr, 0);
+				peer->ready_state = STATE_CLOSING;
+				return;
+			}
+			peer->in_buffer.write_packet(msg, msg_length, &is_string);
+		} else {
+			peer->in_buffer.write_packet(arg->msg, arg->msg_length, &is_string);
+		}
 	}
 	// Ping or pong.
 }
@@ -663,6 +703,179 @@ String WSLPeer::_compute_key_response(String p_key) {
 	return CryptoCore::b64_encode_str(sha.ptr(), sha.size());
 }
 
+///
+/// Per-message deflate (RFC 7692).
+///
+bool WSLPeer::_parse_deflate_offer(const String &p_offers) {
+	// Accept the first offer we can honor, our decompressor handles any window size and context takeover mode.
+	Vector<String> offers = p_offers.split(",", false);
+	for (int i = 0; i < offers.size(); i++) {
+		Vector<String> params = offers[i].split(";", false);
+		if (params.is_empty() || params[0].strip_edges().to_lower() != "permessage-deflate") {
+			continue;
+		}
+		bool valid = true;
+		bool no_context_takeover = false;
+		int window_bits = 15;
+		for (int j = 1; j < params.size() && valid; j++) {
+			Vector<String> param = params[j].split("=", true, 1);
+			String name = param[0].strip_edges().to_lower();
+			String value = param.size() > 1 ? param[1].strip_edges().trim_prefix("\"").trim_suffix("\"") : String();
+			if (name == "server_no_context_takeover") {
+				no_context_takeover = true;
+			} else if (name == "server_max_window_bits") {
+				// zlib can't produce raw deflate streams with an 8 bits window.
+				window_bits = value.to_int();
+				valid = value.is_valid_int() && window_bits >= 9 && window_bits <= 15;
+			} else if (name == "client_max_window_bits") {
+				valid = value.is_empty() || (value.is_valid_int() && value.to_int() >= 8 && value.to_int() <= 15);
+			} else if (name != "client_no_context_takeover") {
+				valid = false;
+			}
+		}
+		if (valid) {
+			deflate_no_context_takeover = no_context_takeover;
+			deflate_window_bits = window_bits;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool WSLPeer::_parse_deflate_response(const String &p_response) {
+	Vector<String> params = p_response.split(";", false);
+	ERR_FAIL_COND_V_MSG(params.is_empty() || p_response.contains(",") || params[0].strip_edges().to_lower() != "permessage-deflate", false, "Received unrequested extension -> " + p_response);
+	for (int i = 1; i < params.size(); i++) {
+		Vector<String> param = params[i].split("=", true, 1);
+		String name = param[0].strip_edges().to_lower();
+		String value = param.size() > 1 ? param[1].strip_edges().trim_prefix("\"").trim_suffix("\"") : String();
+		if (name == "client_no_context_takeover") {
+			deflate_no_context_takeover = true;
+		} else if (name == "client_max_window_bits") {
+			deflate_window_bits = value.to_int();
+			ERR_FAIL_COND_V_MSG(!value.is_valid_int() || deflate_window_bits < 9 || deflate_window_bits > 15, false, "Unsupported permessage-deflate parameter -> " + params[i]);
+		} else if (name == "server_max_window_bits") {
+			ERR_FAIL_COND_V_MSG(!value.is_valid_int() || value.to_int() < 8 || value.to_int() > 15, false, "Invalid permessage-deflate parameter -> " + params[i]);
+		} else if (name != "server_no_context_takeover") {
+			ERR_FAIL_V_MSG(false, "Unsupported permessage-deflate parameter -> " + params[i]);
+		}
+	}
+	return true;
+}
+
+String WSLPeer::_get_deflate_response() const {
+	String response = "permessage-deflate";
+	if (deflate_no_context_takeover) {
+		response += "; server_no_context_takeover";
+	}
+	if (deflate_window_bits != 15) {
+		response += "; server_max_window_bits=" + itos(deflate_window_bits);
+	}
+	return response;
+}
+
+Error WSLPeer::_init_deflate() {
+	_free_deflate();
+
+	deflate_strm = memnew(z_stream);
+	memset(deflate_strm, 0, sizeof(z_stream));
+	inflate_strm = memnew(z_stream);
+	memset(inflate_strm, 0, sizeof(z_stream));
+
+	// Negative window bits select raw deflate, without zlib header and checksum.
+	int err = deflateInit2(deflate_strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -deflate_window_bits, 8, Z_DEFAULT_STRATEGY);
+	if (err != Z_OK) {
+		memdelete(deflate_strm);
+		deflate_strm = nullptr;
+		_free_deflate();
+		ERR_FAIL_V_MSG(FAILED, "Failed to initialize WebSocket compression.");
+	}
+	err = inflateInit2(inflate_strm, -15);
+	if (err != Z_OK) {
+		memdelete(inflate_strm);
+		inflate_strm = nullptr;
+		_free_deflate();
+		ERR_FAIL_V_MSG(FAILED, "Failed to initialize WebSocket decompression.");
+	}
+
+	// The extra byte lets us detect messages inflating past the inbound buffer size.
+	inflate_buffer.resize(inbound_buffer_size + 1);
+	wslay_event_config_set_allowed_rsv_bits(wsl_ctx, WSLAY_RSV1_BIT);
+	return OK;
+}
+
+void WSLPeer::_free_deflate() {
+	if (deflate_strm) {
+		deflateEnd(deflate_strm);
+		memdelete(deflate_strm);
+		deflate_strm = nullptr;
+	}
+	if (inflate_strm) {
+		inflateEnd(inflate_strm);
+		memdelete(inflate_strm);
+		inflate_strm = nullptr;
+	}
+	deflate_buffer.clear();
+	inflate_buffer.clear();
+}
+
+Error WSLPeer::_deflate(const uint8_t *p_buffer, int p_buffer_size, const uint8_t **r_buffer, int &r_buffer_size) {
+	ERR_FAIL_NULL_V(deflate_strm, ERR_UNCONFIGURED);
+
+	int bound = deflateBound(deflate_strm, p_buffer_size) + 8;
+	if (deflate_buffer.size() < bound) {
+		deflate_buffer.resize(bound);
+	}
+
+	deflate_strm->next_in = (Bytef *)p_buffer;
+	deflate_strm->avail_in = p_buffer_size;
+	int out = 0;
+	do {
+		if (out == deflate_buffer.size()) {
+			deflate_buffer.resize(deflate_buffer.size() * 2);
+		}
+		deflate_strm->next_out = deflate_buffer.ptrw() + out;
+		deflate_strm->avail_out = deflate_buffer.size() - out;
+		int err = deflate(deflate_strm, Z_SYNC_FLUSH);
+		ERR_FAIL_COND_V_MSG(err != Z_OK && err != Z_BUF_ERROR, FAILED, "WebSocket message compression failed.");
+		out = deflate_buffer.size() - deflate_strm->avail_out;
+	} while (deflate_strm->avail_out == 0);
+
+	if (deflate_no_context_takeover) {
+		deflateReset(deflate_strm);
+	}
+
+	// Strip the empty block emitted by the sync flush (0x00 0x00 0xff 0xff), the receiver appends it back.
+	ERR_FAIL_COND_V(out < 4, ERR_BUG);
+	*r_buffer = deflate_buffer.ptr();
+	r_buffer_size = out - 4;
+	return OK;
+}
+
+Error WSLPeer::_inflate(const uint8_t *p_buffer, int p_buffer_size, const uint8_t **r_buffer, int &r_buffer_size) {
+	static const uint8_t tail[4] = { 0x00, 0x00, 0xff, 0xff };
+	ERR_FAIL_NULL_V(inflate_strm, ERR_UNCONFIGURED);
+
+	inflate_strm->next_out = inflate_buffer.ptrw();
+	inflate_strm->avail_out = inflate_buffer.size();
+	for (int i = 0; i < 2; i++) {
+		inflate_strm->next_in = (Bytef *)(i == 0 ? p_buffer : tail);
+		inflate_strm->avail_in = i == 0 ? p_buffer_size : 4;
+		int err = inflate(inflate_strm, Z_SYNC_FLUSH);
+		if (err == Z_STREAM_END) {
+			// The sender terminated the stream, the next message starts a new one.
+			inflateReset(inflate_strm);
+			break;
+		}
+		ERR_FAIL_COND_V_MSG(err != Z_OK && err != Z_BUF_ERROR, FAILED, "Received invalid compressed WebSocket message.");
+		ERR_FAIL_COND_V_MSG(inflate_strm->avail_out == 0, ERR_OUT_OF_MEMORY, "Received compressed WebSocket message larger than the inbound buffer size.");
+	}
+
+	*r_buffer = inflate_buffer.ptr();
+	r_buffer_size = inflate_buffer.size() - inflate_strm->avail_out;
+	return OK;
+}
+
 void WSLPeer::poll() {
 	// Nothing to do.
 	if (ready_state == STATE_CLOSED) {
@@ -703,13 +916,24 @@ Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_
 	ERR_FAIL_COND_V(wslay_event_get_queued_msg_count(wsl_ctx) >= (uint32_t)max_queued_packets, ERR_OUT_OF_MEMORY);
 	ERR_FAIL_COND_V(outbound_buffer_size > 0 && (wslay_event_get_queued_msg_length(wsl_ctx) + p_buffer_size > (uint32_t)outbound_buffer_size), ERR_OUT_OF_MEMORY);
 
+	uint8_t rsv = WSLAY_RSV_NONE;
+	if (deflate_enabled && p_buffer_size >= WSL_DEFLATE_MIN_SIZE) {
+		// The compressor keeps state across messages, so once compressed the message must be sent as is.
+		Error err = _deflate(p_buffer, p_buffer_size, &p_buffer, p_buffer_size);
+		if (err != OK) {
+			close(-1);
+			return err;
+		}
+		rsv = WSLAY_RSV1_BIT;
+	}
+
 	struct wslay_event_msg msg;
 	msg.opcode = p_opcode;
 	msg.msg = p_buffer;
 	msg.msg_length = p_buffer_size;
 
 	// Queue & send message.
-	if (wslay_event_queue_msg(wsl_ctx, &msg) != 0 || wslay_event_send(wsl_ctx) != 0) {
+	if (wslay_event_queue_msg_ex(wsl_ctx, &msg, rsv) != 0 || wslay_event_send(wsl_ctx) != 0) {
 		close(-1);
 		return FAILED;
 	}
@@ -734,11 +958,10 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 		return ERR_UNAVAILABLE;
 	}
 
+	// Hand out the payload in place when possible, packet_buffer is only used when it wraps around the ring buffer.
 	int read = 0;
-	uint8_t *rw = packet_buffer.ptrw();
-	in_buffer.read_packet(rw, packet_buffer.size(), &was_string, read);
-
-	*r_buffer = rw;
+	Error err = in_buffer.read_packet_view(r_buffer, packet_buffer.ptrw(), packet_buffer.size(), &was_string, read);
+	ERR_FAIL_COND_V(err != OK, err);
 	r_buffer_size = read;
 
 	return OK;
@@ -829,6 +1052,12 @@ void WSLPeer::_clear() {
 	selected_protocol.clear();
 	session_key.clear();
 
+	// Compression info.
+	_free_deflate();
+	deflate_enabled = false;
+	deflate_no_context_takeover = false;
+	deflate_window_bits = 15;
+
 	// Pending packets info.
 	was_string = 0;
 	in_buffer.clear();
@@ -845,6 +1074,7 @@ WSLPeer::WSLPeer() {
 
 WSLPeer::~WSLPeer() {
 	close(-1);
+	_free_deflate();
 }
 
 #endif // WEB_ENABLED
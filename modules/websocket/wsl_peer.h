@@ -45,6 +45,10 @@
 #include <wslay/wslay.h>
 
 #define WSL_MAX_HEADER_SIZE 4096
+// Messages smaller than this are sent uncompressed even when permessage-deflate is negotiated.
+#define WSL_DEFLATE_MIN_SIZE 64
+
+struct z_stream_s;
 
 class WSLPeer : public WebSocketPeer {
 private:
@@ -104,6 +108,15 @@ private:
 	bool use_tls = true;
 	Ref<TLSOptions> tls_options;
 
+	// Per-message deflate (RFC 7692).
+	bool deflate_enabled = false; // Negotiated for this connection.
+	bool deflate_no_context_takeover = false; // Reset our compressor after each message.
+	int deflate_window_bits = 15;
+	z_stream_s *deflate_strm = nullptr;
+	z_stream_s *inflate_strm = nullptr;
+	Vector<uint8_t> deflate_buffer;
+	Vector<uint8_t> inflate_buffer;
+
 	// Packet buffers.
 	Vector<uint8_t> packet_buffer;
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
@@ -117,6 +130,14 @@ private:
 	void _do_client_handshake();
 	bool _verify_server_response();
 
+	bool _parse_deflate_offer(const String &p_offers);
+	bool _parse_deflate_response(const String &p_response);
+	String _get_deflate_response() const;
+	Error _init_deflate();
+	void _free_deflate();
+	Error _deflate(const uint8_t *p_buffer, int p_buffer_size, const uint8_t **r_buffer, int &r_buffer_size);
+	Error _inflate(const uint8_t *p_buffer, int p_buffer_size, const uint8_t **r_buffer, int &r_buffer_size);
+
 	void _clear();
 
 public:
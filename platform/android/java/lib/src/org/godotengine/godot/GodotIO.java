@@ -41,6 +41,7 @@ import android.graphics.Rect;
 import android.net.Uri;
 import android.os.Build;
 import android.os.Environment;
+import android.os.PowerManager;
 import android.provider.Settings;
 import android.text.TextUtils;
 import android.util.DisplayMetrics;
@@ -177,6 +178,23 @@ public class GodotIO {
 		return fallback;
 	}
 
+	/**
+	 * Returns the thermal headroom forecast for the given number of seconds, where 1.0 means the device is
+	 * about to be severely throttled, or -1.0 if it's not available (requires Android 11).
+	 * The system rate-limits this query, so it should not be called more than once per second.
+	 */
+	public float getThermalHeadroom(int forecastSeconds) {
+		if (Build.VERSION.SDK_INT < Build.VERSION_CODES.R) {
+			return -1.0f;
+		}
+		PowerManager powerManager = (PowerManager)activity.getSystemService(Activity.POWER_SERVICE);
+		if (powerManager == null) {
+			return -1.0f;
+		}
+		float headroom = powerManager.getThermalHeadroom(forecastSeconds);
+		return Float.isNaN(headroom) ? -1.0f : headroom;
+	}
+
 	public int[] getDisplaySafeArea() {
 		Rect rect = new Rect();
 		activity.getWindow().getDecorView().getWindowVisibleDisplayFrame(rect);
@@ -60,6 +60,7 @@ GodotIOJavaWrapper::GodotIOJavaWrapper(JNIEnv *p_env, jobject p_godot_io_instanc
 		_get_screen_DPI = p_env->GetMethodID(cls, "getScreenDPI", "()I");
 		_get_scaled_density = p_env->GetMethodID(cls, "getScaledDensity", "()F");
 		_get_screen_refresh_rate = p_env->GetMethodID(cls, "getScreenRefreshRate", "(D)D");
+		_get_thermal_headroom = p_env->GetMethodID(cls, "getThermalHeadroom", "(I)F");
 		_get_unique_id = p_env->GetMethodID(cls, "getUniqueID", "()Ljava/lang/String;");
 		_show_keyboard = p_env->GetMethodID(cls, "showKeyboard", "(Ljava/lang/String;IIII)V");
 		_hide_keyboard = p_env->GetMethodID(cls, "hideKeyboard", "()V");
@@ -171,6 +172,16 @@ float GodotIOJavaWrapper::get_screen_refresh_rate(float fallback) {
 	return fallback;
 }
 
+float GodotIOJavaWrapper::get_thermal_headroom(int p_forecast_seconds) {
+	if (_get_thermal_headroom) {
+		JNIEnv *env = get_jni_env();
+		ERR_FAIL_NULL_V(env, -1.0f);
+		return env->CallFloatMethod(godot_io_instance, _get_thermal_headroom, (jint)p_forecast_seconds);
+	} else {
+		return -1.0f;
+	}
+}
+
 TypedArray<Rect2> GodotIOJavaWrapper::get_display_cutouts() {
 	TypedArray<Rect2> result;
 	ERR_FAIL_NULL_V(_get_display_cutouts, result);
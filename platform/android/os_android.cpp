@@ -45,10 +45,12 @@
 #include "drivers/unix/file_access_unix.h"
 #include "main/main.h"
 #include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "servers/rendering_server.h"
 
 #include <dlfcn.h>
 #include <sys/system_properties.h>
+#include <unistd.h>
 
 const char *OS_Android::ANDROID_EXEC_PATH = "apk";
 
@@ -327,21 +329,156 @@ MainLoop *OS_Android::get_main_loop() const {
 	return main_loop;
 }
 
+int64_t OS_Android::_get_target_frame_duration_nsec() const {
+	double fps = Engine::get_singleton()->get_max_fps();
+	if (fps <= 0) {
+		fps = godot_io_java->get_screen_refresh_rate(60.0);
+	}
+	return (int64_t)(1000000000.0 / MAX(fps, 1.0));
+}
+
+void OS_Android::_performance_hint_init() {
+	performance_hint.initialized = true;
+
+	void *lib = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+	if (!lib) {
+		return;
+	}
+	PerformanceHint::GetManagerFn get_manager = (PerformanceHint::GetManagerFn)dlsym(lib, "APerformanceHint_getManager");
+	PerformanceHint::CreateSessionFn create_session = (PerformanceHint::CreateSessionFn)dlsym(lib, "APerformanceHint_createSession");
+	performance_hint.update_target_work_duration = (PerformanceHint::UpdateTargetWorkDurationFn)dlsym(lib, "APerformanceHint_updateTargetWorkDuration");
+	performance_hint.report_actual_work_duration = (PerformanceHint::ReportActualWorkDurationFn)dlsym(lib, "APerformanceHint_reportActualWorkDuration");
+	performance_hint.close_session = (PerformanceHint::CloseSessionFn)dlsym(lib, "APerformanceHint_closeSession");
+	if (!get_manager || !create_session || !performance_hint.update_target_work_duration || !performance_hint.report_actual_work_duration || !performance_hint.close_session) {
+		return; // Not available before API level 33.
+	}
+
+	void *manager = get_manager();
+	if (!manager) {
+		return;
+	}
+
+	// The main loop, which also renders unless rendering runs on its own thread, is the work being paced.
+	int32_t tid = gettid();
+	performance_hint.target_duration_nsec = _get_target_frame_duration_nsec();
+	performance_hint.session = create_session(manager, &tid, 1, performance_hint.target_duration_nsec);
+	print_verbose(vformat("Android: Performance hint session %s.", performance_hint.session ? "created" : "unavailable"));
+}
+
+void OS_Android::_performance_hint_report(int64_t p_frame_duration_nsec) {
+	if (!performance_hint.initialized) {
+		_performance_hint_init();
+	}
+	if (!performance_hint.session) {
+		return;
+	}
+
+	int64_t target_duration_nsec = _get_target_frame_duration_nsec();
+	if (target_duration_nsec != performance_hint.target_duration_nsec) {
+		performance_hint.target_duration_nsec = target_duration_nsec;
+		performance_hint.update_target_work_duration(performance_hint.session, target_duration_nsec);
+	}
+	if (p_frame_duration_nsec > 0) {
+		performance_hint.report_actual_work_duration(performance_hint.session, p_frame_duration_nsec);
+	}
+}
+
+void OS_Android::_performance_hint_finish() {
+	if (performance_hint.session) {
+		performance_hint.close_session(performance_hint.session);
+		performance_hint.session = nullptr;
+	}
+	performance_hint.initialized = false;
+}
+
+void OS_Android::add_frame_delay(bool p_can_draw) {
+	performance_hint.frame_work_end_usec = get_ticks_usec();
+	OS_Unix::add_frame_delay(p_can_draw);
+}
+
+float OS_Android::get_thermal_headroom(int p_forecast_seconds) const {
+	return godot_io_java->get_thermal_headroom(p_forecast_seconds);
+}
+
+void OS_Android::_thermal_throttling_set_level(int p_level) {
+	if (p_level == thermal_throttling.level) {
+		return;
+	}
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(main_loop);
+	Window *root = scene_tree ? scene_tree->get_root() : nullptr;
+
+	if (thermal_throttling.level == 0) {
+		thermal_throttling.saved_max_fps = Engine::get_singleton()->get_max_fps();
+		if (root) {
+			thermal_throttling.saved_scaling_3d_scale = root->get_scaling_3d_scale();
+		}
+	}
+
+	const int throttled_fps = 30;
+	if (p_level >= 1 && (thermal_throttling.saved_max_fps == 0 || thermal_throttling.saved_max_fps > throttled_fps)) {
+		Engine::get_singleton()->set_max_fps(throttled_fps);
+	} else {
+		Engine::get_singleton()->set_max_fps(thermal_throttling.saved_max_fps);
+	}
+	if (root) {
+		root->set_scaling_3d_scale(p_level >= 2 ? thermal_throttling.saved_scaling_3d_scale * 0.75 : thermal_throttling.saved_scaling_3d_scale);
+	}
+
+	print_verbose(vformat("Android: Thermal throttling level changed from %d to %d.", thermal_throttling.level, p_level));
+	thermal_throttling.level = p_level;
+}
+
+void OS_Android::_thermal_throttling_update() {
+	// The system rate-limits headroom queries, so only poll once every few seconds.
+	uint64_t ticks = get_ticks_usec();
+	if (ticks < thermal_throttling.next_check_usec) {
+		return;
+	}
+	thermal_throttling.next_check_usec = ticks + 2000000;
+
+	float headroom = get_thermal_headroom(10);
+	if (headroom < 0.0) {
+		return;
+	}
+
+	// Step up quickly as the forecast nears severe throttling (1.0), and only step back down once the device
+	// has clearly cooled down, to avoid oscillating between levels.
+	if (headroom >= 0.95) {
+		_thermal_throttling_set_level(2);
+	} else if (headroom >= 0.85) {
+		_thermal_throttling_set_level(MAX(thermal_throttling.level, 1));
+	} else if (headroom < 0.7 && thermal_throttling.level > 0) {
+		_thermal_throttling_set_level(thermal_throttling.level - 1);
+	}
+}
+
 void OS_Android::main_loop_begin() {
 	if (main_loop) {
 		main_loop->initialize();
 	}
+	thermal_throttling.enabled = GLOBAL_GET("application/run/thermal_throttling");
 }
 
 bool OS_Android::main_loop_iterate(bool *r_should_swap_buffers) {
 	if (!main_loop) {
 		return false;
 	}
+	uint64_t frame_begin_usec = get_ticks_usec();
+	performance_hint.frame_work_end_usec = 0;
 	DisplayServerAndroid::get_singleton()->reset_swap_buffers_flag();
 	DisplayServerAndroid::get_singleton()->process_events();
 	uint64_t current_frames_drawn = Engine::get_singleton()->get_frames_drawn();
 	bool exit = Main::iteration();
 
+	// Only frames that did work are reported, so idle frames in low processor mode don't lower the hint.
+	if (current_frames_drawn != Engine::get_singleton()->get_frames_drawn()) {
+		uint64_t frame_end_usec = performance_hint.frame_work_end_usec ? performance_hint.frame_work_end_usec : get_ticks_usec();
+		_performance_hint_report((int64_t)(frame_end_usec - frame_begin_usec) * 1000);
+	}
+	if (thermal_throttling.enabled) {
+		_thermal_throttling_update();
+	}
+
 	if (r_should_swap_buffers) {
 		*r_should_swap_buffers = !is_in_low_processor_usage_mode() ||
 				DisplayServerAndroid::get_singleton()->should_swap_buffers() ||
@@ -353,6 +490,7 @@ bool OS_Android::main_loop_iterate(bool *r_should_swap_buffers) {
 }
 
 void OS_Android::main_loop_end() {
+	_performance_hint_finish();
 	if (main_loop) {
 		SceneTree *scene_tree = Object::cast_to<SceneTree>(main_loop);
 		if (scene_tree) {
@@ -83,6 +83,38 @@ private:
 	GodotJavaWrapper *godot_java = nullptr;
 	GodotIOJavaWrapper *godot_io_java = nullptr;
 
+	// Android Dynamic Performance Framework (API level 33+), loaded at runtime since older devices lack it.
+	struct PerformanceHint {
+		typedef void *(*GetManagerFn)();
+		typedef void *(*CreateSessionFn)(void *, const int32_t *, size_t, int64_t);
+		typedef int (*UpdateTargetWorkDurationFn)(void *, int64_t);
+		typedef int (*ReportActualWorkDurationFn)(void *, int64_t);
+		typedef void (*CloseSessionFn)(void *);
+
+		bool initialized = false;
+		void *session = nullptr;
+		int64_t target_duration_nsec = 0;
+		uint64_t frame_work_end_usec = 0; // Set before the frame delay, which isn't work.
+		UpdateTargetWorkDurationFn update_target_work_duration = nullptr;
+		ReportActualWorkDurationFn report_actual_work_duration = nullptr;
+		CloseSessionFn close_session = nullptr;
+	} performance_hint;
+
+	struct ThermalThrottling {
+		bool enabled = false;
+		int level = 0;
+		uint64_t next_check_usec = 0;
+		int saved_max_fps = 0;
+		float saved_scaling_3d_scale = 1.0;
+	} thermal_throttling;
+
+	int64_t _get_target_frame_duration_nsec() const;
+	void _performance_hint_init();
+	void _performance_hint_report(int64_t p_frame_duration_nsec);
+	void _performance_hint_finish();
+	void _thermal_throttling_set_level(int p_level);
+	void _thermal_throttling_update();
+
 	void _load_system_font_config();
 	String get_system_property(const char *key) const;
 
@@ -146,6 +178,9 @@ public:
 	virtual String get_resource_dir() const override;
 	virtual String get_locale() const override;
 	virtual String get_model_name() const override;
+	virtual float get_thermal_headroom(int p_forecast_seconds = 0) const override;
+
+	virtual void add_frame_delay(bool p_can_draw) override;
 
 	virtual String get_unique_id() const override;
 
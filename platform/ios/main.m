@@ -40,6 +40,8 @@ int main(int argc, char *argv[]) {
 #if defined(VULKAN_ENABLED)
 	//MoltenVK - enable full component swizzling support
 	setenv("MVK_CONFIG_FULL_IMAGE_VIEW_SWIZZLE", "1", 1);
+	//MoltenVK - let Metal compile pipelines on all cores where supported, reduces pipeline creation hitches
+	setenv("MVK_CONFIG_SHOULD_MAXIMIZE_CONCURRENT_COMPILATION", "1", 0);
 #endif
 
 	gargc = argc;
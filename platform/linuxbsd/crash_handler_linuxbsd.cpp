@@ -72,6 +72,9 @@ static void handle_crash(int sig) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_CRASH);
 	}
 
+	// Write out anything the async logger still has queued, and log synchronously from now on.
+	OS::get_singleton()->flush_log_sync();
+
 	// Dump the backtrace to stderr with a message to the user
 	print_error("\n================================================================");
 	print_error(vformat("%s: Program crashed with signal %d", __FUNCTION__, sig));
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*  file_system_watcher_inotify.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_system_watcher_inotify.h"
+
+#ifdef __linux__
+
+#include <dirent.h>
+#include <errno.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const uint32_t INOTIFY_WATCH_MASK = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF | IN_ONLYDIR;
+
+void FileSystemWatcherInotify::_add_watch(const String &p_path) {
+	int wd = inotify_add_watch(fd, p_path.utf8().get_data(), INOTIFY_WATCH_MASK);
+	if (wd < 0) {
+		// Usually the fs.inotify.max_user_watches limit, changes below this directory would go unnoticed.
+		incomplete = true;
+		return;
+	}
+	watch_paths[wd] = p_path;
+
+	DIR *dir = opendir(p_path.utf8().get_data());
+	if (!dir) {
+		return;
+	}
+	struct dirent *entry;
+	while ((entry = readdir(dir)) != nullptr) {
+		if (entry->d_name[0] == '.') {
+			continue;
+		}
+		String child = p_path.path_join(String::utf8(entry->d_name));
+		bool is_dir = entry->d_type == DT_DIR;
+		if (entry->d_type == DT_UNKNOWN) {
+			// Some file systems don't fill d_type.
+			struct stat st;
+			is_dir = stat(child.utf8().get_data(), &st) == 0 && S_ISDIR(st.st_mode);
+		}
+		if (is_dir) {
+			_add_watch(child);
+		}
+	}
+	closedir(dir);
+}
+
+void FileSystemWatcherInotify::_clear() {
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+	watch_paths.clear();
+}
+
+Error FileSystemWatcherInotify::watch(const String &p_path) {
+	_clear();
+
+	fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	ERR_FAIL_COND_V_MSG(fd < 0, ERR_CANT_CREATE, "Failed to initialize inotify: " + String::utf8(strerror(errno)) + ".");
+
+	lost_events = false;
+	incomplete = false;
+	_add_watch(p_path.trim_suffix("/"));
+	return OK;
+}
+
+bool FileSystemWatcherInotify::poll_changes(Vector<String> &r_paths) {
+	if (fd < 0) {
+		return false;
+	}
+
+	// Large enough for many events at once, aligned as inotify_event requires.
+	alignas(struct inotify_event) char buffer[16384];
+
+	while (true) {
+		ssize_t len = read(fd, buffer, sizeof(buffer));
+		if (len <= 0) {
+			break; // EAGAIN, no more events.
+		}
+
+		for (char *ptr = buffer; ptr < buffer + len;) {
+			const struct inotify_event *event = (const struct inotify_event *)ptr;
+			ptr += sizeof(struct inotify_event) + event->len;
+
+			if (event->mask & IN_Q_OVERFLOW) {
+				lost_events = true;
+				continue;
+			}
+
+			HashMap<int, String>::Iterator E = watch_paths.find(event->wd);
+			if (!E) {
+				continue;
+			}
+
+			if (event->mask & IN_IGNORED) {
+				// The directory was removed or moved away, its parent reports the change.
+				watch_paths.remove(E);
+				continue;
+			}
+
+			String path = event->len ? E->value.path_join(String::utf8(event->name)) : E->value;
+			r_paths.push_back(path);
+
+			if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len && event->name[0] != '.') {
+				_add_watch(path);
+			}
+		}
+	}
+
+	bool complete = !lost_events && !incomplete;
+	lost_events = false;
+	return complete;
+}
+
+FileSystemWatcherInotify::~FileSystemWatcherInotify() {
+	_clear();
+}
+
+#endif // __linux__
@@ -0,0 +1,59 @@
+/**************************************************************************/
+/*  file_system_watcher_inotify.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_SYSTEM_WATCHER_INOTIFY_H
+#define FILE_SYSTEM_WATCHER_INOTIFY_H
+
+#ifdef __linux__
+
+#include "core/os/file_system_watcher.h"
+#include "core/templates/hash_map.h"
+
+// inotify watches are not recursive, so every directory below the root gets its own watch. Hidden directories
+// (.godot, .git...) are skipped, they are not part of the project tree.
+class FileSystemWatcherInotify : public FileSystemWatcher {
+	int fd = -1;
+	HashMap<int, String> watch_paths;
+	bool lost_events = false; // Until the next poll.
+	bool incomplete = false; // Some directory couldn't be watched, until the next watch() call.
+
+	void _add_watch(const String &p_path);
+	void _clear();
+
+public:
+	virtual Error watch(const String &p_path) override;
+	virtual bool poll_changes(Vector<String> &r_paths) override;
+
+	~FileSystemWatcherInotify();
+};
+
+#endif // __linux__
+
+#endif // FILE_SYSTEM_WATCHER_INOTIFY_H
@@ -30,6 +30,8 @@
 
 #include "os_linuxbsd.h"
 
+#include "file_system_watcher_inotify.h"
+
 #include "core/io/certs_compressed.gen.h"
 #include "core/io/dir_access.h"
 #include "main/main.h"
@@ -66,6 +68,11 @@
 #include <sys/sysctl.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
 void OS_LinuxBSD::alert(const String &p_alert, const String &p_title) {
 	const char *message_programs[] = { "zenity", "kdialog", "Xdialog", "xmessage" };
 
@@ -137,9 +144,178 @@ void OS_LinuxBSD::initialize() {
 
 	OS_Unix::initialize_core();
 
+#ifdef __linux__
+	_init_large_pages();
+	_init_numa_nodes();
+	_init_core_classes();
+#endif
+
 	system_dir_desktop_cache = get_system_dir(SYSTEM_DIR_DESKTOP);
 }
 
+#ifdef __linux__
+static size_t large_page_size = 0;
+
+static void *_alloc_large_pages(size_t p_bytes) {
+	// Transparent huge pages can only back ranges aligned to their size, so map extra and trim it.
+	uint8_t *mem = (uint8_t *)mmap(nullptr, p_bytes + large_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED) {
+		return nullptr;
+	}
+
+	uint8_t *aligned = (uint8_t *)(((uintptr_t)mem + large_page_size - 1) & ~(uintptr_t)(large_page_size - 1));
+	size_t head = aligned - mem;
+	if (head > 0) {
+		munmap(mem, head);
+	}
+	size_t tail = large_page_size - head;
+	if (tail > 0) {
+		munmap(aligned + p_bytes, tail);
+	}
+
+	madvise(aligned, p_bytes, MADV_HUGEPAGE);
+	return aligned;
+}
+
+static void _free_large_pages(void *p_ptr, size_t p_bytes) {
+	munmap(p_ptr, p_bytes);
+}
+
+void OS_LinuxBSD::_init_large_pages() {
+	Ref<FileAccess> f = FileAccess::open("/sys/kernel/mm/transparent_hugepage/enabled", FileAccess::READ);
+	if (f.is_null() || f->get_line().contains("[never]")) {
+		return;
+	}
+
+	large_page_size = 2 * 1024 * 1024;
+	f = FileAccess::open("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", FileAccess::READ);
+	if (f.is_valid()) {
+		int64_t size = f->get_line().to_int();
+		if (size > 0 && (size & (size - 1)) == 0) {
+			large_page_size = size;
+		}
+	}
+
+	Memory::_set_platform_functions({ .large_page_size = large_page_size, .alloc_large_pages = _alloc_large_pages, .free_large_pages = _free_large_pages });
+}
+
+static Vector<int> _read_processor_list(const String &p_path) {
+	Vector<int> processors;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return processors;
+	}
+
+	// Formatted as ranges, like "0-15,32-47".
+	Vector<String> ranges = f->get_line().strip_edges().split(",", false);
+	for (const String &range : ranges) {
+		int from = range.get_slice("-", 0).to_int();
+		int to = range.get_slice_count("-") > 1 ? range.get_slice("-", 1).to_int() : from;
+		for (int i = from; i <= to; i++) {
+			processors.push_back(i);
+		}
+	}
+	return processors;
+}
+
+static uint64_t _processors_to_mask(const Vector<int> &p_processors) {
+	uint64_t mask = 0;
+	for (int processor : p_processors) {
+		if (processor < 64) {
+			mask |= uint64_t(1) << processor;
+		}
+	}
+	return mask;
+}
+
+void OS_LinuxBSD::_init_numa_nodes() {
+	for (int node = 0; DirAccess::dir_exists_absolute(vformat("/sys/devices/system/node/node%d", node)); node++) {
+		numa_node_processors.push_back(_read_processor_list(vformat("/sys/devices/system/node/node%d/cpulist", node)));
+	}
+}
+
+void OS_LinuxBSD::_init_core_classes() {
+	// Hybrid Intel processors expose their core types as separate PMUs.
+	performance_core_mask = _processors_to_mask(_read_processor_list("/sys/devices/cpu_core/cpus"));
+	efficiency_core_mask = _processors_to_mask(_read_processor_list("/sys/devices/cpu_atom/cpus"));
+	if (performance_core_mask && efficiency_core_mask) {
+		return;
+	}
+
+	// ARM big.LITTLE reports the relative capacity of each core.
+	performance_core_mask = 0;
+	efficiency_core_mask = 0;
+	int max_capacity = 0;
+	int min_capacity = INT_MAX;
+	Vector<int> capacities;
+	for (int i = 0; i < MIN(get_processor_count(), 64); i++) {
+		Ref<FileAccess> f = FileAccess::open(vformat("/sys/devices/system/cpu/cpu%d/cpu_capacity", i), FileAccess::READ);
+		if (f.is_null()) {
+			return;
+		}
+		int capacity = f->get_line().to_int();
+		capacities.push_back(capacity);
+		max_capacity = MAX(max_capacity, capacity);
+		min_capacity = MIN(min_capacity, capacity);
+	}
+	if (max_capacity == min_capacity) {
+		return;
+	}
+	for (int i = 0; i < capacities.size(); i++) {
+		if (capacities[i] == max_capacity) {
+			performance_core_mask |= uint64_t(1) << i;
+		} else if (capacities[i] == min_capacity) {
+			efficiency_core_mask |= uint64_t(1) << i;
+		}
+	}
+}
+#endif
+
+uint64_t OS_LinuxBSD::get_performance_core_mask() const {
+#ifdef __linux__
+	return performance_core_mask;
+#else
+	return 0;
+#endif
+}
+
+uint64_t OS_LinuxBSD::get_efficiency_core_mask() const {
+#ifdef __linux__
+	return efficiency_core_mask;
+#else
+	return 0;
+#endif
+}
+
+int OS_LinuxBSD::get_numa_node_count() const {
+#ifdef __linux__
+	return MAX(1, numa_node_processors.size());
+#else
+	return 1;
+#endif
+}
+
+Error OS_LinuxBSD::pin_current_thread_to_numa_node(int p_node) {
+#ifdef __linux__
+	ERR_FAIL_INDEX_V(p_node, numa_node_processors.size(), ERR_INVALID_PARAMETER);
+	const Vector<int> &processors = numa_node_processors[p_node];
+	if (processors.is_empty()) {
+		return ERR_UNAVAILABLE;
+	}
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (int processor : processors) {
+		if (processor < CPU_SETSIZE) {
+			CPU_SET(processor, &set);
+		}
+	}
+	return sched_setaffinity(0, sizeof(set), &set) == 0 ? OK : FAILED;
+#else
+	return ERR_UNAVAILABLE;
+#endif
+}
+
 void OS_LinuxBSD::initialize_joypads() {
 #ifdef JOYDEV_ENABLED
 	joypad = memnew(JoypadLinux(Input::get_singleton()));
@@ -1146,6 +1322,14 @@ Error OS_LinuxBSD::move_to_trash(const String &p_path) {
 	return OK;
 }
 
+FileSystemWatcher *OS_LinuxBSD::create_file_system_watcher() const {
+#ifdef __linux__
+	return memnew(FileSystemWatcherInotify);
+#else
+	return nullptr;
+#endif
+}
+
 String OS_LinuxBSD::get_system_ca_certificates() {
 	String certfile;
 	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
@@ -88,6 +88,16 @@ class OS_LinuxBSD : public OS_Unix {
 
 	String system_dir_desktop_cache;
 
+#ifdef __linux__
+	Vector<Vector<int>> numa_node_processors;
+	uint64_t performance_core_mask = 0;
+	uint64_t efficiency_core_mask = 0;
+
+	void _init_large_pages();
+	void _init_numa_nodes();
+	void _init_core_classes();
+#endif
+
 protected:
 	virtual void initialize() override;
 	virtual void finalize() override;
@@ -123,6 +133,12 @@ public:
 	virtual String get_unique_id() const override;
 	virtual String get_processor_name() const override;
 
+	virtual uint64_t get_performance_core_mask() const override;
+	virtual uint64_t get_efficiency_core_mask() const override;
+
+	virtual int get_numa_node_count() const override;
+	virtual Error pin_current_thread_to_numa_node(int p_node) override;
+
 	virtual bool is_sandboxed() const override;
 
 	virtual void alert(const String &p_alert, const String &p_title = "ALERT!") override;
@@ -137,6 +153,7 @@ public:
 	virtual Error move_to_trash(const String &p_path) override;
 
 	virtual String get_system_ca_certificates() override;
+	virtual FileSystemWatcher *create_file_system_watcher() const override;
 
 	OS_LinuxBSD();
 	~OS_LinuxBSD();
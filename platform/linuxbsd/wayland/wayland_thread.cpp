@@ -2067,6 +2067,11 @@ void WaylandThread::_wp_relative_pointer_on_relative_motion(void *data, struct z
 	pd.relative_motion *= window_state_get_scale_factor(ws);
 
 	pd.relative_motion_time = uptime_lo;
+
+	Vector2 unaccelerated_motion(wl_fixed_to_double(dx_unaccel), wl_fixed_to_double(dy_unaccel));
+	if (unaccelerated_motion != Vector2()) {
+		Input::get_singleton()->push_mouse_motion_sample(unaccelerated_motion, OS::get_singleton()->get_ticks_usec());
+	}
 }
 
 void WaylandThread::_wp_pointer_gesture_pinch_on_begin(void *data, struct zwp_pointer_gesture_pinch_v1 *wp_pointer_gesture_pinch_v1, uint32_t serial, uint32_t time, struct wl_surface *surface, uint32_t fingers) {
@@ -4508,6 +4508,10 @@ void DisplayServerX11::process_events() {
 							// Relative mode device
 							xi.relative_motion.x = xi.raw_pos.x;
 							xi.relative_motion.y = xi.raw_pos.y;
+
+							if (rel_x != 0.0 || rel_y != 0.0) {
+								Input::get_singleton()->push_mouse_motion_sample(Vector2(rel_x, rel_y), OS::get_singleton()->get_ticks_usec());
+							}
 						}
 
 						xi.last_relative_time = raw_event->time;
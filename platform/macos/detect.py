@@ -202,6 +202,8 @@ def configure(env: "SConsEnvironment"):
             "-framework",
             "Carbon",
             "-framework",
+            "CoreServices",
+            "-framework",
             "AudioUnit",
             "-framework",
             "CoreAudio",
@@ -0,0 +1,58 @@
+/**************************************************************************/
+/*  file_system_watcher_macos.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_SYSTEM_WATCHER_MACOS_H
+#define FILE_SYSTEM_WATCHER_MACOS_H
+
+#include "core/os/file_system_watcher.h"
+#include "core/os/mutex.h"
+
+#include <CoreServices/CoreServices.h>
+
+// FSEvents streams are recursive and deliver on a private dispatch queue, changes are buffered until polled.
+class FileSystemWatcherMacOS : public FileSystemWatcher {
+	FSEventStreamRef stream = nullptr;
+	dispatch_queue_t queue = nullptr;
+
+	Mutex mutex;
+	Vector<String> changes;
+	bool lost_events = false;
+
+	static void _stream_callback(ConstFSEventStreamRef p_stream, void *p_info, size_t p_count, void *p_paths, const FSEventStreamEventFlags p_flags[], const FSEventStreamEventId p_ids[]);
+	void _clear();
+
+public:
+	virtual Error watch(const String &p_path) override;
+	virtual bool poll_changes(Vector<String> &r_paths) override;
+
+	~FileSystemWatcherMacOS();
+};
+
+#endif // FILE_SYSTEM_WATCHER_MACOS_H
@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  file_system_watcher_macos.mm                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_system_watcher_macos.h"
+
+void FileSystemWatcherMacOS::_stream_callback(ConstFSEventStreamRef p_stream, void *p_info, size_t p_count, void *p_paths, const FSEventStreamEventFlags p_flags[], const FSEventStreamEventId p_ids[]) {
+	FileSystemWatcherMacOS *watcher = (FileSystemWatcherMacOS *)p_info;
+	const char **paths = (const char **)p_paths;
+
+	MutexLock lock(watcher->mutex);
+	for (size_t i = 0; i < p_count; i++) {
+		if (p_flags[i] & (kFSEventStreamEventFlagMustScanSubDirs | kFSEventStreamEventFlagUserDropped | kFSEventStreamEventFlagKernelDropped | kFSEventStreamEventFlagRootChanged)) {
+			watcher->lost_events = true;
+		}
+		watcher->changes.push_back(String::utf8(paths[i]));
+	}
+}
+
+void FileSystemWatcherMacOS::_clear() {
+	if (stream) {
+		FSEventStreamStop(stream);
+		FSEventStreamInvalidate(stream);
+		FSEventStreamRelease(stream);
+		stream = nullptr;
+	}
+	queue = nullptr;
+}
+
+Error FileSystemWatcherMacOS::watch(const String &p_path) {
+	_clear();
+
+	CFStringRef path = CFStringCreateWithCString(kCFAllocatorDefault, p_path.trim_suffix("/").utf8().get_data(), kCFStringEncodingUTF8);
+	CFArrayRef paths = CFArrayCreate(kCFAllocatorDefault, (const void **)&path, 1, &kCFTypeArrayCallBacks);
+
+	FSEventStreamContext context = { 0, this, nullptr, nullptr, nullptr };
+	stream = FSEventStreamCreate(kCFAllocatorDefault, &_stream_callback, &context, paths, kFSEventStreamEventIdSinceNow, 0.1, kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer);
+
+	CFRelease(paths);
+	CFRelease(path);
+
+	ERR_FAIL_NULL_V_MSG(stream, ERR_CANT_CREATE, "Failed to create an FSEvents stream for '" + p_path + "'.");
+
+	queue = dispatch_queue_create("org.godotengine.file_system_watcher", DISPATCH_QUEUE_SERIAL);
+	FSEventStreamSetDispatchQueue(stream, queue);
+	if (!FSEventStreamStart(stream)) {
+		_clear();
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "Failed to start the FSEvents stream for '" + p_path + "'.");
+	}
+
+	MutexLock lock(mutex);
+	changes.clear();
+	lost_events = false;
+	return OK;
+}
+
+bool FileSystemWatcherMacOS::poll_changes(Vector<String> &r_paths) {
+	if (!stream) {
+		return false;
+	}
+
+	MutexLock lock(mutex);
+	r_paths.append_array(changes);
+	changes.clear();
+	bool complete = !lost_events;
+	lost_events = false;
+	return complete;
+}
+
+FileSystemWatcherMacOS::~FileSystemWatcherMacOS() {
+	_clear();
+}
@@ -43,6 +43,7 @@ int main(int argc, char **argv) {
 #if defined(VULKAN_ENABLED)
 	setenv("MVK_CONFIG_FULL_IMAGE_VIEW_SWIZZLE", "1", 1); // MoltenVK - enable full component swizzling support.
 	setenv("MVK_CONFIG_SWAPCHAIN_MIN_MAG_FILTER_USE_NEAREST", "0", 1); // MoltenVK - use linear surface scaling. TODO: remove when full DPI scaling is implemented.
+	setenv("MVK_CONFIG_SHOULD_MAXIMIZE_CONCURRENT_COMPILATION", "1", 0); // MoltenVK - let Metal compile pipelines on all cores, reduces pipeline creation hitches.
 #endif
 
 #if defined(SANITIZERS_ENABLED)
@@ -32,6 +32,7 @@
 
 #include "dir_access_macos.h"
 #include "display_server_macos.h"
+#include "file_system_watcher_macos.h"
 #include "godot_application.h"
 #include "godot_application_delegate.h"
 #include "macos_terminal_logger.h"
@@ -744,6 +745,10 @@ Error OS_MacOS::move_to_trash(const String &p_path) {
 	return OK;
 }
 
+FileSystemWatcher *OS_MacOS::create_file_system_watcher() const {
+	return memnew(FileSystemWatcherMacOS);
+}
+
 String OS_MacOS::get_system_ca_certificates() {
 	CFArrayRef result;
 	SecCertificateRef item;
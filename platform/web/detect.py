@@ -46,6 +46,11 @@ def get_opts():
             "dlink_enabled", "Enable WebAssembly dynamic linking (GDExtension support). Produces bigger binaries", False
         ),
         BoolVariable("use_closure_compiler", "Use closure compiler to minimize JavaScript code", False),
+        BoolVariable(
+            "wasm_simd",
+            "Use WebAssembly 128-bit SIMD, enabling the engine's SSE2 code paths (requires browser support for WASM SIMD)",
+            False,
+        ),
         BoolVariable(
             "proxy_to_pthread",
             "Use Emscripten PROXY_TO_PTHREAD option to run the main application code to a separate thread",
@@ -236,6 +241,12 @@ def configure(env: "SConsEnvironment"):
         print_warning('"threads=no" support requires "proxy_to_pthread=no", disabling proxy to pthread.')
         env["proxy_to_pthread"] = False
 
+    if env["wasm_simd"]:
+        # Emscripten translates SSE/SSE2 intrinsics to WASM SIMD instructions, so enabling them defines `__SSE2__`
+        # and the existing SSE2 math, image and audio kernels are used as-is.
+        env.Append(CCFLAGS=["-msimd128", "-msse2"])
+        env.Append(LINKFLAGS=["-msimd128"])
+
     if env["lto"] != "none":
         # Workaround https://github.com/emscripten-core/emscripten/issues/19781.
         if cc_semver >= (3, 1, 42) and cc_semver < (3, 1, 46):
@@ -1062,6 +1062,9 @@ DisplayServerWeb::DisplayServerWeb(const String &p_rendering_driver, WindowMode
 		if (!emscripten_webgl_enable_extension(webgl_ctx, "OVR_multiview2")) {
 			print_verbose("Failed to enable WebXR extension.");
 		}
+		if (!emscripten_webgl_enable_extension(webgl_ctx, "KHR_parallel_shader_compile")) {
+			print_verbose("Failed to enable parallel shader compilation extension.");
+		}
 		RasterizerGLES3::make_current(false);
 
 	} else {
@@ -138,6 +138,9 @@ DWORD CrashHandlerException(EXCEPTION_POINTERS *ep) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_CRASH);
 	}
 
+	// Write out anything the async logger still has queued, and log synchronously from now on.
+	OS::get_singleton()->flush_log_sync();
+
 	print_error("\n================================================================");
 	print_error(vformat("%s: Program crashed", __FUNCTION__));
 
@@ -144,6 +144,9 @@ extern void CrashHandlerException(int signal) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_CRASH);
 	}
 
+	// Write out anything the async logger still has queued, and log synchronously from now on.
+	OS::get_singleton()->flush_log_sync();
+
 	print_error("\n================================================================");
 	print_error(vformat("%s: Program crashed with signal %d", __FUNCTION__, signal));
 
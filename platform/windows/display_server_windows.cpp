@@ -4107,6 +4107,10 @@ LRESULT DisplayServerWindows::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARA
 				}
 				mm->set_relative_screen_position(mm->get_relative());
 
+				if (raw->data.mouse.usFlags == MOUSE_MOVE_RELATIVE && mm->get_relative() != Vector2()) {
+					Input::get_singleton()->push_mouse_motion_sample(mm->get_relative(), OS::get_singleton()->get_ticks_usec());
+				}
+
 				if ((windows[window_id].window_focused || windows[window_id].is_popup) && mm->get_relative() != Vector2()) {
 					Input::get_singleton()->parse_input_event(mm);
 				}
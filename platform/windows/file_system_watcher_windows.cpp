@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  file_system_watcher_windows.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_system_watcher_windows.h"
+
+static const DWORD WINDOWS_WATCH_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION;
+
+bool FileSystemWatcherWindows::_request_changes() {
+	pending = ReadDirectoryChangesW(dir_handle, buffer, sizeof(buffer), TRUE, WINDOWS_WATCH_FILTER, nullptr, &overlapped, nullptr);
+	return pending;
+}
+
+void FileSystemWatcherWindows::_clear() {
+	if (dir_handle != INVALID_HANDLE_VALUE) {
+		if (pending) {
+			CancelIoEx(dir_handle, &overlapped);
+			DWORD bytes = 0;
+			GetOverlappedResult(dir_handle, &overlapped, &bytes, TRUE);
+			pending = false;
+		}
+		CloseHandle(dir_handle);
+		dir_handle = INVALID_HANDLE_VALUE;
+	}
+	if (overlapped.hEvent) {
+		CloseHandle(overlapped.hEvent);
+		overlapped.hEvent = nullptr;
+	}
+}
+
+Error FileSystemWatcherWindows::watch(const String &p_path) {
+	_clear();
+
+	root = p_path.trim_suffix("/");
+	dir_handle = CreateFileW((LPCWSTR)root.replace("/", "\\").utf16().get_data(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+	ERR_FAIL_COND_V_MSG(dir_handle == INVALID_HANDLE_VALUE, ERR_CANT_OPEN, "Failed to open '" + root + "' for change notifications.");
+
+	overlapped = {};
+	overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	if (!_request_changes()) {
+		_clear();
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "ReadDirectoryChangesW failed for '" + root + "'.");
+	}
+	return OK;
+}
+
+bool FileSystemWatcherWindows::poll_changes(Vector<String> &r_paths) {
+	if (!pending) {
+		return false;
+	}
+
+	bool complete = true;
+	while (true) {
+		DWORD bytes = 0;
+		if (!GetOverlappedResult(dir_handle, &overlapped, &bytes, FALSE)) {
+			if (GetLastError() != ERROR_IO_INCOMPLETE) {
+				pending = false;
+				return false;
+			}
+			break; // Nothing more for now.
+		}
+
+		if (bytes == 0) {
+			// The buffer overflowed, the changes it couldn't hold are lost.
+			complete = false;
+		} else {
+			const uint8_t *ptr = (const uint8_t *)buffer;
+			while (true) {
+				const FILE_NOTIFY_INFORMATION *info = (const FILE_NOTIFY_INFORMATION *)ptr;
+				String name = String::utf16((const char16_t *)info->FileName, info->FileNameLength / sizeof(WCHAR));
+				r_paths.push_back(root.path_join(name.replace("\\", "/")));
+				if (info->NextEntryOffset == 0) {
+					break;
+				}
+				ptr += info->NextEntryOffset;
+			}
+		}
+
+		ResetEvent(overlapped.hEvent);
+		if (!_request_changes()) {
+			return false;
+		}
+	}
+	return complete;
+}
+
+FileSystemWatcherWindows::~FileSystemWatcherWindows() {
+	_clear();
+}
@@ -0,0 +1,57 @@
+/**************************************************************************/
+/*  file_system_watcher_windows.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_SYSTEM_WATCHER_WINDOWS_H
+#define FILE_SYSTEM_WATCHER_WINDOWS_H
+
+#include "core/os/file_system_watcher.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+// A single overlapped ReadDirectoryChangesW() request on the root, which covers the whole subtree.
+class FileSystemWatcherWindows : public FileSystemWatcher {
+	HANDLE dir_handle = INVALID_HANDLE_VALUE;
+	OVERLAPPED overlapped = {};
+	String root;
+	bool pending = false;
+	DWORD buffer[16384]; // DWORD aligned, as FILE_NOTIFY_INFORMATION requires.
+
+	bool _request_changes();
+	void _clear();
+
+public:
+	virtual Error watch(const String &p_path) override;
+	virtual bool poll_changes(Vector<String> &r_paths) override;
+
+	~FileSystemWatcherWindows();
+};
+
+#endif // FILE_SYSTEM_WATCHER_WINDOWS_H
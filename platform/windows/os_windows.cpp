@@ -31,6 +31,7 @@
 #include "os_windows.h"
 
 #include "display_server_windows.h"
+#include "file_system_watcher_windows.h"
 #include "joypad_windows.h"
 #include "lang_table.h"
 #include "windows_terminal_logger.h"
@@ -39,6 +40,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/templates/local_vector.h"
 #include "core/version_generated.gen.h"
 #include "drivers/unix/net_socket_posix.h"
 #include "drivers/windows/dir_access_windows.h"
@@ -181,6 +183,100 @@ static void _error_handler(void *p_self, const char *p_func, const char *p_file,
 }
 #endif
 
+static void *_alloc_large_pages(size_t p_bytes) {
+	return VirtualAlloc(nullptr, p_bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+}
+
+static void _free_large_pages(void *p_ptr, size_t p_bytes) {
+	VirtualFree(p_ptr, 0, MEM_RELEASE);
+}
+
+static void _init_large_pages() {
+	SIZE_T large_page_size = GetLargePageMinimum();
+	if (large_page_size == 0) {
+		return;
+	}
+
+	// Large pages need the "Lock pages in memory" privilege, which must be granted to the user and enabled for the process.
+	HANDLE token;
+	if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) {
+		return;
+	}
+	TOKEN_PRIVILEGES privileges = {};
+	privileges.PrivilegeCount = 1;
+	privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+	bool enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) && AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) && GetLastError() == ERROR_SUCCESS;
+	CloseHandle(token);
+
+	if (enabled) {
+		Memory::PlatformFunctions functions;
+		functions.large_page_size = large_page_size;
+		functions.alloc_large_pages = _alloc_large_pages;
+		functions.free_large_pages = _free_large_pages;
+		Memory::_set_platform_functions(functions);
+	}
+}
+
+static Error _set_thread_priority(Thread::Priority p_priority) {
+	static const int priorities[] = { THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL, THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_TIME_CRITICAL };
+	return SetThreadPriority(GetCurrentThread(), priorities[p_priority]) ? OK : FAILED;
+}
+
+static Error _set_thread_affinity(uint64_t p_affinity_mask) {
+	DWORD_PTR process_mask = 0;
+	DWORD_PTR system_mask = 0;
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+		return FAILED;
+	}
+	DWORD_PTR mask = p_affinity_mask ? (DWORD_PTR)p_affinity_mask & process_mask : process_mask;
+	return mask && SetThreadAffinityMask(GetCurrentThread(), mask) ? OK : ERR_INVALID_PARAMETER;
+}
+
+void OS_Windows::_init_core_classes() {
+	typedef BOOL(WINAPI * GetSystemCpuSetInformationPtr)(PSYSTEM_CPU_SET_INFORMATION, ULONG, PULONG, HANDLE, ULONG);
+	GetSystemCpuSetInformationPtr get_system_cpu_set_information = (GetSystemCpuSetInformationPtr)GetProcAddress(GetModuleHandle("kernel32.dll"), "GetSystemCpuSetInformation");
+	if (!get_system_cpu_set_information) {
+		return; // Windows 10+ only.
+	}
+
+	ULONG size = 0;
+	get_system_cpu_set_information(nullptr, 0, &size, GetCurrentProcess(), 0);
+	if (size == 0) {
+		return;
+	}
+	LocalVector<uint8_t> buffer;
+	buffer.resize(size);
+	if (!get_system_cpu_set_information((PSYSTEM_CPU_SET_INFORMATION)buffer.ptr(), size, &size, GetCurrentProcess(), 0)) {
+		return;
+	}
+
+	// Processors with the highest efficiency class are the fastest ones, only meaningful if there are several classes.
+	BYTE max_class = 0;
+	BYTE min_class = UINT8_MAX;
+	for (ULONG offset = 0; offset < size;) {
+		const SYSTEM_CPU_SET_INFORMATION *info = (const SYSTEM_CPU_SET_INFORMATION *)(buffer.ptr() + offset);
+		if (info->Type == CpuSetInformation && info->CpuSet.Group == 0) {
+			max_class = MAX(max_class, info->CpuSet.EfficiencyClass);
+			min_class = MIN(min_class, info->CpuSet.EfficiencyClass);
+		}
+		offset += info->Size;
+	}
+	if (max_class <= min_class) {
+		return;
+	}
+	for (ULONG offset = 0; offset < size;) {
+		const SYSTEM_CPU_SET_INFORMATION *info = (const SYSTEM_CPU_SET_INFORMATION *)(buffer.ptr() + offset);
+		if (info->Type == CpuSetInformation && info->CpuSet.Group == 0 && info->CpuSet.LogicalProcessorIndex < 64) {
+			if (info->CpuSet.EfficiencyClass == max_class) {
+				performance_core_mask |= uint64_t(1) << info->CpuSet.LogicalProcessorIndex;
+			} else if (info->CpuSet.EfficiencyClass == min_class) {
+				efficiency_core_mask |= uint64_t(1) << info->CpuSet.LogicalProcessorIndex;
+			}
+		}
+		offset += info->Size;
+	}
+}
+
 void OS_Windows::initialize() {
 	crash_handler.initialize();
 
@@ -220,6 +316,14 @@ void OS_Windows::initialize() {
 	IPUnix::make_default();
 	main_loop = nullptr;
 
+	_init_large_pages();
+	_init_core_classes();
+
+	Thread::PlatformFunctions thread_functions;
+	thread_functions.set_priority = _set_thread_priority;
+	thread_functions.set_affinity = _set_thread_affinity;
+	Thread::_set_platform_functions(thread_functions);
+
 	HRESULT hr = DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory), reinterpret_cast<IUnknown **>(&dwrite_factory));
 	if (SUCCEEDED(hr)) {
 		hr = dwrite_factory->GetSystemFontCollection(&font_collection, false);
@@ -1634,6 +1738,24 @@ String OS_Windows::get_locale() const {
 	return "en";
 }
 
+int OS_Windows::get_numa_node_count() const {
+	ULONG highest_node = 0;
+	if (!GetNumaHighestNodeNumber(&highest_node)) {
+		return 1;
+	}
+	return highest_node + 1;
+}
+
+Error OS_Windows::pin_current_thread_to_numa_node(int p_node) {
+	ERR_FAIL_INDEX_V(p_node, get_numa_node_count(), ERR_INVALID_PARAMETER);
+
+	GROUP_AFFINITY affinity = {};
+	if (!GetNumaNodeProcessorMaskEx((USHORT)p_node, &affinity) || affinity.Mask == 0) {
+		return ERR_UNAVAILABLE;
+	}
+	return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) ? OK : FAILED;
+}
+
 String OS_Windows::get_processor_name() const {
 	const String id = "Hardware\\Description\\System\\CentralProcessor\\0";
 
@@ -1868,6 +1990,10 @@ Error OS_Windows::move_to_trash(const String &p_path) {
 	return OK;
 }
 
+FileSystemWatcher *OS_Windows::create_file_system_watcher() const {
+	return memnew(FileSystemWatcherWindows);
+}
+
 String OS_Windows::get_system_ca_certificates() {
 	HCERTSTORE cert_store = CertOpenSystemStoreA(0, "ROOT");
 	ERR_FAIL_NULL_V_MSG(cert_store, "", "Failed to read the root certificate store.");
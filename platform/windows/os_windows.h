@@ -98,6 +98,11 @@ class OS_Windows : public OS {
 	uint64_t ticks_start = 0;
 	uint64_t ticks_per_second = 0;
 
+	uint64_t performance_core_mask = 0;
+	uint64_t efficiency_core_mask = 0;
+
+	void _init_core_classes();
+
 	HINSTANCE hInstance;
 	MainLoop *main_loop = nullptr;
 
@@ -209,6 +214,12 @@ public:
 
 	virtual String get_processor_name() const override;
 
+	virtual uint64_t get_performance_core_mask() const override { return performance_core_mask; }
+	virtual uint64_t get_efficiency_core_mask() const override { return efficiency_core_mask; }
+
+	virtual int get_numa_node_count() const override;
+	virtual Error pin_current_thread_to_numa_node(int p_node) override;
+
 	virtual uint64_t get_embedded_pck_offset() const override;
 
 	virtual String get_config_path() const override;
@@ -235,6 +246,7 @@ public:
 	virtual Error move_to_trash(const String &p_path) override;
 
 	virtual String get_system_ca_certificates() override;
+	virtual FileSystemWatcher *create_file_system_watcher() const override;
 
 	void set_main_window(HWND p_main_window) { main_window = p_main_window; }
 
@@ -30,6 +30,7 @@
 
 #include "cpu_particles_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/curve_texture.h"
@@ -646,11 +647,16 @@ void CPUParticles2D::_particles_process(double p_delta) {
 
 	double system_phase = time / lifetime;
 
+	// Restarting particles draw from the global random number generator, so they are decided and emitted in order.
+	// The rest of the simulation only depends on each particle, and is spread over the WorkerThreadPool.
+	particle_steps.resize(pcount);
+
 	bool should_be_active = false;
 	for (int i = 0; i < pcount; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
+			particle_steps[i].type = PARTICLE_STEP_SKIP;
 			continue;
 		}
 
@@ -705,15 +711,19 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			restart = true;
 		}
 
-		float tv = 0.0;
+		ParticleStep &step = particle_steps[i];
+		step.delta = local_delta;
 
 		if (restart) {
 			if (!emitting) {
 				p.active = false;
+				step.type = PARTICLE_STEP_SKIP;
 				continue;
 			}
 			p.active = true;
 
+			float tv = 0.0;
+
 			/*real_t tex_linear_velocity = 0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
 				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(0);
@@ -808,12 +818,58 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				p.transform = emission_xform * p.transform;
 			}
 
+			step.type = PARTICLE_STEP_RESTART;
 		} else if (!p.active) {
+			step.type = PARTICLE_STEP_SKIP;
 			continue;
 		} else if (p.time > p.lifetime) {
 			p.active = false;
-			tv = 1.0;
+			step.type = PARTICLE_STEP_END;
 		} else {
+			step.type = PARTICLE_STEP_INTEGRATE;
+		}
+
+		should_be_active = true;
+	}
+
+	if (color_ramp.is_valid()) {
+		color_ramp->get_color_at_offset(0.0); // Sorts the points before the threads read them.
+	}
+
+	ParticlesProcessData data;
+	data.particles = parray;
+	data.steps = particle_steps.ptr();
+	data.count = pcount;
+	data.emission_origin = emission_xform[2];
+
+	uint32_t chunk_count = (pcount + PARTICLES_PROCESS_CHUNK_SIZE - 1) / PARTICLES_PROCESS_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_process_chunk, &data, chunk_count, -1, true, String("CPUParticles2DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_particles_process_chunk(0, &data);
+	}
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
+	}
+}
+
+void CPUParticles2D::_particles_process_chunk(uint32_t p_chunk, const ParticlesProcessData *p_data) {
+	uint32_t from = p_chunk * PARTICLES_PROCESS_CHUNK_SIZE;
+	uint32_t to = MIN(from + PARTICLES_PROCESS_CHUNK_SIZE, p_data->count);
+
+	for (uint32_t i = from; i < to; i++) {
+		const ParticleStep &step = p_data->steps[i];
+		if (step.type == PARTICLE_STEP_SKIP) {
+			continue;
+		}
+
+		Particle &p = p_data->particles[i];
+		double local_delta = step.delta;
+		float tv = step.type == PARTICLE_STEP_END ? 1.0 : 0.0;
+
+		if (step.type == PARTICLE_STEP_INTEGRATE) {
 			uint32_t alt_seed = p.seed;
 
 			p.time += local_delta;
@@ -875,7 +931,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply radial acceleration
-			Vector2 org = emission_xform[2];
+			Vector2 org = p_data->emission_origin;
 			Vector2 diff = pos - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply tangential acceleration;
@@ -992,11 +1048,6 @@ void CPUParticles2D::_particles_process(double p_delta) {
 
 		p.transform[2] += p.velocity * local_delta;
 
-		should_be_active = true;
-	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
 	}
 }
 
@@ -687,24 +687,60 @@ void TileMapLayer::_rendering_draw_cell_debug(const RID &p_canvas_item, const Ve
 void TileMapLayer::_physics_update(bool p_force_cleanup) {
 	// Check if we should cleanup everything.
 	bool forced_cleanup = p_force_cleanup || !enabled || !collision_enabled || !is_inside_tree() || tile_set.is_null();
-	if (forced_cleanup) {
-		// Clean everything.
-		for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-			_physics_clear_cell(kv.value);
+
+	// List all physics quadrants to update, creating new ones if needed.
+	SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
+
+	// Free all quadrants if everything needs to be cleaned, or if the quadrants are not sized the same anymore.
+	if (forced_cleanup || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE]) {
+		for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+			_physics_clear_quadrant(kv.value);
+			for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+				cell_data_list_element->self()->physics_quadrant = Ref<PhysicsQuadrant>();
+			}
+			kv.value->cells.clear();
 		}
-	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
+		physics_quadrant_map.clear();
+		_physics_was_cleaned_up = true;
+	}
+
+	if (!forced_cleanup) {
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_MERGE_COLLISION_RECTANGLES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				_physics_update_cell(kv.value);
+				_physics_quadrants_update_cell(kv.value, dirty_physics_quadrant_list);
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_physics_update_cell(cell_data);
+				_physics_quadrants_update_cell(cell_data, dirty_physics_quadrant_list);
+			}
+		}
+
+		// Rebuilding a quadrant also rebuilds its cells which are not dirty, they might need their runtime tile data too.
+		bool valid_runtime_update = GDVIRTUAL_IS_OVERRIDDEN(_use_tile_data_runtime_update) && GDVIRTUAL_IS_OVERRIDDEN(_tile_data_runtime_update);
+		bool valid_runtime_update_for_tilemap = tile_map_node && tile_map_node->GDVIRTUAL_IS_OVERRIDDEN(_use_tile_data_runtime_update) && tile_map_node->GDVIRTUAL_IS_OVERRIDDEN(_tile_data_runtime_update); // For keeping compatibility.
+		bool use_tilemap_for_runtime = valid_runtime_update_for_tilemap && !valid_runtime_update;
+
+		// Update all dirty quadrants.
+		for (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first(); quadrant_list_element;) {
+			SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
+
+			const Ref<PhysicsQuadrant> physics_quadrant = quadrant_list_element->self();
+			if (physics_quadrant->cells.first()) {
+				_physics_update_quadrant(physics_quadrant, valid_runtime_update || valid_runtime_update_for_tilemap, use_tilemap_for_runtime);
+			} else {
+				// Free the quadrant.
+				_physics_clear_quadrant(physics_quadrant);
+				quadrant_list_element->remove_from_list();
+				physics_quadrant_map.erase(physics_quadrant->quadrant_coords);
 			}
+
+			quadrant_list_element = next_quadrant_list_element;
 		}
+
+		dirty_physics_quadrant_list.clear();
 	}
 
 	// -----------
@@ -720,15 +756,11 @@ void TileMapLayer::_physics_notification(int p_what) {
 		case NOTIFICATION_TRANSFORM_CHANGED:
 			// Move the collisison shapes along with the TileMap.
 			if (is_inside_tree() && tile_set.is_valid()) {
-				for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-					const CellData &cell_data = kv.value;
-
-					for (RID body : cell_data.bodies) {
-						if (body.is_valid()) {
-							Transform2D xform(0, tile_set->map_to_local(kv.key));
-							xform = gl_transform * xform;
-							ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-						}
+				for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						Transform2D xform(0, body.origin);
+						xform = gl_transform * xform;
+						ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 					}
 				}
 			}
@@ -738,144 +770,344 @@ void TileMapLayer::_physics_notification(int p_what) {
 			if (is_inside_tree()) {
 				RID space = get_world_2d()->get_space();
 
-				for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-					const CellData &cell_data = kv.value;
-
-					for (RID body : cell_data.bodies) {
-						if (body.is_valid()) {
-							ps->body_set_space(body, space);
-						}
+				for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+					for (const PhysicsQuadrant::Body &body : kv.value->bodies) {
+						ps->body_set_space(body.rid, space);
 					}
 				}
 			}
 	}
 }
 
-void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
+	Ref<PhysicsQuadrant> physics_quadrant;
+	if (r_cell_data.cell.source_id != TileSet::INVALID_SOURCE) {
+		const Vector2i &coords = r_cell_data.coords;
+
+		// Rounding down, instead of simply rounding towards zero (truncating).
+		Vector2i quadrant_coords = Vector2i(
+				coords.x > 0 ? coords.x / physics_quadrant_size : (coords.x - (physics_quadrant_size - 1)) / physics_quadrant_size,
+				coords.y > 0 ? coords.y / physics_quadrant_size : (coords.y - (physics_quadrant_size - 1)) / physics_quadrant_size);
+
+		if (physics_quadrant_map.has(quadrant_coords)) {
+			// Reuse existing physics quadrant.
+			physics_quadrant = physics_quadrant_map[quadrant_coords];
+		} else {
+			// Create a new physics quadrant.
+			physics_quadrant.instantiate();
+			physics_quadrant->quadrant_coords = quadrant_coords;
+			physics_quadrant_map[quadrant_coords] = physics_quadrant;
+		}
+	}
+
+	if (r_cell_data.physics_quadrant != physics_quadrant) {
+		if (r_cell_data.physics_quadrant.is_valid()) {
+			// Remove the cell from its old quadrant, and mark that quadrant as dirty. Its bodies will be freed there.
+			if (r_cell_data.physics_quadrant_list_element.in_list()) {
+				r_cell_data.physics_quadrant->cells.remove(&r_cell_data.physics_quadrant_list_element);
+			}
+			if (!r_cell_data.physics_quadrant->dirty_quadrant_list_element.in_list()) {
+				r_dirty_physics_quadrant_list.add(&r_cell_data.physics_quadrant->dirty_quadrant_list_element);
+			}
+			r_cell_data.bodies.clear();
+			r_cell_data.bodies_shapes.clear();
+		}
+
+		// Add the cell to its new quadrant.
+		r_cell_data.physics_quadrant = physics_quadrant;
+		if (physics_quadrant.is_valid()) {
+			physics_quadrant->cells.add(&r_cell_data.physics_quadrant_list_element);
+		}
+	}
+
+	// Add the new quadrant to the dirty quadrant list.
+	if (physics_quadrant.is_valid() && !physics_quadrant->dirty_quadrant_list_element.in_list()) {
+		r_dirty_physics_quadrant_list.add(&physics_quadrant->dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant) {
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Clear bodies.
-	for (RID body : r_cell_data.bodies) {
-		if (body.is_valid()) {
-			bodies_coords.erase(body);
-			ps->free(body);
+	for (const PhysicsQuadrant::Body &body : p_physics_quadrant->bodies) {
+		bodies_quadrants.erase(body.rid);
+		ps->free(body.rid);
+	}
+	p_physics_quadrant->bodies.clear();
+
+	// Clear the merged shapes, now that no body uses them.
+	for (const RID &shape : p_physics_quadrant->merged_shapes) {
+		ps->free(shape);
+	}
+	p_physics_quadrant->merged_shapes.clear();
+
+	for (SelfList<CellData> *cell_data_list_element = p_physics_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+		CellData &cell_data = *cell_data_list_element->self();
+		cell_data.bodies.clear();
+		cell_data.bodies_shapes.clear();
+	}
+}
+
+int TileMapLayer::_physics_get_or_create_quadrant_body(const Ref<PhysicsQuadrant> &p_physics_quadrant, int p_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity, const Vector2 &p_origin) {
+	// Bodies with an angular velocity rotate around their origin, so they are never shared between cells.
+	if (p_angular_velocity == 0.0) {
+		for (uint32_t body_index = 0; body_index < p_physics_quadrant->bodies.size(); body_index++) {
+			const PhysicsQuadrant::Body &body = p_physics_quadrant->bodies[body_index];
+			if (body.physics_layer == p_physics_layer && body.angular_velocity == 0.0 && body.linear_velocity == p_linear_velocity) {
+				return body_index;
+			}
+		}
+	}
+
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(p_physics_layer);
+
+	PhysicsQuadrant::Body body;
+	body.rid = ps->body_create();
+	body.physics_layer = p_physics_layer;
+	body.linear_velocity = p_linear_velocity;
+	body.angular_velocity = p_angular_velocity;
+	body.origin = p_origin;
+
+	ps->body_set_mode(body.rid, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(body.rid, get_world_2d()->get_space());
+
+	Transform2D xform;
+	xform.set_origin(body.origin);
+	xform = get_global_transform() * xform;
+	ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+
+	ps->body_attach_object_instance_id(body.rid, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
+	ps->body_set_collision_layer(body.rid, tile_set->get_physics_layer_collision_layer(p_physics_layer));
+	ps->body_set_collision_mask(body.rid, tile_set->get_physics_layer_collision_mask(p_physics_layer));
+	ps->body_set_pickable(body.rid, false);
+	ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, p_linear_velocity);
+	ps->body_set_state(body.rid, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, p_angular_velocity);
+
+	if (!physics_material.is_valid()) {
+		ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+		ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+	} else {
+		ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+		ps->body_set_param(body.rid, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+	}
+
+	bodies_quadrants[body.rid] = p_physics_quadrant;
+	p_physics_quadrant->bodies.push_back(body);
+	return p_physics_quadrant->bodies.size() - 1;
+}
+
+// Returns true if the polygon is the rectangle covering the whole cell, so that neighboring ones can be fused.
+static bool _is_full_cell_rectangle(const Vector<Vector2> &p_points, const Vector2 &p_tile_size) {
+	if (p_points.size() != 4) {
+		return false;
+	}
+	const Vector2 half_size = p_tile_size / 2.0;
+	int corners = 0;
+	for (const Vector2 &point : p_points) {
+		if (!Math::is_equal_approx(Math::abs(point.x), half_size.x) || !Math::is_equal_approx(Math::abs(point.y), half_size.y)) {
+			return false;
 		}
+		corners |= 1 << ((point.x > 0 ? 1 : 0) + (point.y > 0 ? 2 : 0));
 	}
-	r_cell_data.bodies.clear();
+	return corners == 0b1111;
 }
 
-void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
-	Transform2D gl_transform = get_global_transform();
-	RID space = get_world_2d()->get_space();
+void TileMapLayer::_physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant, bool p_runtime_update, bool p_use_tilemap_for_runtime) {
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Recreate bodies and shapes.
-	TileMapCell &c = r_cell_data.cell;
+	_physics_clear_quadrant(p_physics_quadrant);
+
+	// Sort the cells, so bodies and shapes are created in a deterministic order.
+	p_physics_quadrant->cells.sort();
+
+	// Gather the tiles of the quadrant.
+	struct QuadrantTile {
+		CellData *cell_data = nullptr;
+		const TileData *tile_data = nullptr;
+		bool flip_h = false;
+		bool flip_v = false;
+		bool transpose = false;
+		bool built_runtime_tile_data = false;
+	};
+	LocalVector<QuadrantTile> tiles;
+	for (SelfList<CellData> *cell_data_list_element = p_physics_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+		CellData &cell_data = *cell_data_list_element->self();
+		const TileMapCell &c = cell_data.cell;
 
-	TileSetSource *source;
-	if (tile_set->has_source(c.source_id)) {
-		source = *tile_set->get_source(c.source_id);
+		if (!tile_set->has_source(c.source_id)) {
+			continue;
+		}
+		TileSetSource *source = *tile_set->get_source(c.source_id);
+		if (!source->has_tile(c.get_atlas_coords()) || !source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+			continue;
+		}
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
+		if (!atlas_source) {
+			continue;
+		}
 
-		if (source->has_tile(c.get_atlas_coords()) && source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
-			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(source);
-			if (atlas_source) {
-				const TileData *tile_data;
-				if (r_cell_data.runtime_tile_data_cache) {
-					tile_data = r_cell_data.runtime_tile_data_cache;
-				} else {
-					tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+		QuadrantTile tile;
+		tile.cell_data = &cell_data;
+		if (p_runtime_update && !cell_data.runtime_tile_data_cache && !cell_data.dirty_list_element.in_list()) {
+			_build_runtime_update_tile_data_for_cell(cell_data, p_use_tilemap_for_runtime);
+			tile.built_runtime_tile_data = cell_data.runtime_tile_data_cache != nullptr;
+		}
+		if (cell_data.runtime_tile_data_cache) {
+			tile.tile_data = cell_data.runtime_tile_data_cache;
+		} else {
+			tile.tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+		}
+
+		// Transform flags.
+		tile.flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+		tile.flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+		tile.transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+
+		cell_data.bodies.resize(tile_set->get_physics_layers_count());
+		cell_data.bodies_shapes.resize(tile_set->get_physics_layers_count());
+		tiles.push_back(tile);
+	}
+
+	const Vector2 quadrant_origin = tile_set->map_to_local(p_physics_quadrant->quadrant_coords * physics_quadrant_size);
+	const Vector2 tile_size = tile_set->get_tile_size();
+	const bool merge_rectangles = merge_collision_rectangles && physics_quadrant_size > 1 && tile_set->get_tile_shape() == TileSet::TILE_SHAPE_SQUARE;
+
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		// Fuse the cells fully covered by a single rectangle into larger rectangles.
+		HashMap<Vector2i, Vector2i> merged_rects; // Top-left cell coords to the size, in cells, of the rectangle.
+		HashSet<Vector2i> merged_cells;
+		if (merge_rectangles) {
+			HashMap<Vector2i, Vector2> full_cells; // Cell coords to the linear velocity of their body.
+			for (const QuadrantTile &tile : tiles) {
+				const TileData *tile_data = tile.tile_data;
+				if (tile_data->get_collision_polygons_count(tile_set_physics_layer) != 1 ||
+						tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, 0) != 1 ||
+						tile_data->is_collision_polygon_one_way(tile_set_physics_layer, 0) ||
+						tile_data->get_constant_angular_velocity(tile_set_physics_layer) != 0.0) {
+					continue;
+				}
+				Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, 0, 0, tile.flip_h, tile.flip_v, tile.transpose);
+				if (shape.is_valid() && _is_full_cell_rectangle(shape->get_points(), tile_size)) {
+					full_cells[tile.cell_data->coords] = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
 				}
+			}
 
-				// Transform flags.
-				bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
-				bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
-				bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+			// Cells are sorted by column, so grow each rectangle down first, then right.
+			for (const QuadrantTile &tile : tiles) {
+				const Vector2i &coords = tile.cell_data->coords;
+				const Vector2 *linear_velocity = full_cells.getptr(coords);
+				if (!linear_velocity || merged_cells.has(coords)) {
+					continue;
+				}
 
-				// Free unused bodies then resize the bodies array.
-				for (uint32_t i = tile_set->get_physics_layers_count(); i < r_cell_data.bodies.size(); i++) {
-					RID &body = r_cell_data.bodies[i];
-					if (body.is_valid()) {
-						bodies_coords.erase(body);
-						ps->free(body);
-						body = RID();
+				Vector2i size(1, 1);
+				while (true) {
+					const Vector2i next = coords + Vector2i(0, size.y);
+					const Vector2 *next_linear_velocity = full_cells.getptr(next);
+					if (!next_linear_velocity || *next_linear_velocity != *linear_velocity || merged_cells.has(next)) {
+						break;
 					}
+					size.y++;
+				}
+				while (true) {
+					bool can_grow = true;
+					for (int y = 0; y < size.y && can_grow; y++) {
+						const Vector2i next = coords + Vector2i(size.x, y);
+						const Vector2 *next_linear_velocity = full_cells.getptr(next);
+						can_grow = next_linear_velocity && *next_linear_velocity == *linear_velocity && !merged_cells.has(next);
+					}
+					if (!can_grow) {
+						break;
+					}
+					size.x++;
 				}
-				r_cell_data.bodies.resize(tile_set->get_physics_layers_count());
-
-				for (uint32_t tile_set_physics_layer = 0; tile_set_physics_layer < (uint32_t)tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-					Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-					uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-					uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
-
-					RID body = r_cell_data.bodies[tile_set_physics_layer];
-					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
-						// No body needed, free it if it exists.
-						if (body.is_valid()) {
-							bodies_coords.erase(body);
-							ps->free(body);
-						}
-						body = RID();
-					} else {
-						// Create or update the body.
-						if (!body.is_valid()) {
-							body = ps->body_create();
-						}
-						bodies_coords[body] = r_cell_data.coords;
-						ps->body_set_mode(body, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
-
-						Transform2D xform;
-						xform.set_origin(tile_set->map_to_local(r_cell_data.coords));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
 
-						// Clear body's shape if needed.
-						ps->body_clear_shapes(body);
-
-						// Add the shapes to the body.
-						int body_shape_index = 0;
-						for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
-							// Iterate over the polygons.
-							bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
-							float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
-							int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
-							for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
-								// Add decomposed convex shapes.
-								Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, flip_h, flip_v, transpose);
-								ps->body_add_shape(body, shape->get_rid());
-								ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
-
-								body_shape_index++;
-							}
+				if (size.x * size.y > 1) {
+					merged_rects[coords] = size;
+					for (int x = 0; x < size.x; x++) {
+						for (int y = 0; y < size.y; y++) {
+							merged_cells.insert(coords + Vector2i(x, y));
 						}
 					}
-
-					// Set the body again.
-					r_cell_data.bodies[tile_set_physics_layer] = body;
 				}
+			}
+		}
 
-				return;
+		for (const QuadrantTile &tile : tiles) {
+			CellData &cell_data = *tile.cell_data;
+			const TileData *tile_data = tile.tile_data;
+			const Vector2 cell_origin = tile_set->map_to_local(cell_data.coords);
+
+			cell_data.bodies[tile_set_physics_layer] = RID();
+			cell_data.bodies_shapes[tile_set_physics_layer] = Vector2i();
+
+			const Vector2i *merged_rect_size = merged_rects.getptr(cell_data.coords);
+			bool in_merged_rect = merged_cells.has(cell_data.coords);
+			if ((in_merged_rect && !merged_rect_size) || tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
+				// No shapes for this cell, or they are owned by the cell at the top-left corner of their rectangle.
+				continue;
+			}
+
+			real_t angular_velocity = tile_data->get_constant_angular_velocity(tile_set_physics_layer);
+			int body_index = _physics_get_or_create_quadrant_body(p_physics_quadrant, tile_set_physics_layer, tile_data->get_constant_linear_velocity(tile_set_physics_layer), angular_velocity, angular_velocity == 0.0 ? quadrant_origin : cell_origin);
+			PhysicsQuadrant::Body &body = p_physics_quadrant->bodies[body_index];
+
+			cell_data.bodies[tile_set_physics_layer] = body.rid;
+			cell_data.bodies_shapes[tile_set_physics_layer].x = body.shapes_coords.size();
+
+			if (merged_rect_size) {
+				// Add the fused rectangle, centered on the covered cells.
+				RID shape = ps->rectangle_shape_create();
+				ps->shape_set_data(shape, Vector2(*merged_rect_size) * tile_size / 2.0);
+				p_physics_quadrant->merged_shapes.push_back(shape);
+
+				const Vector2 rect_center = (cell_origin + tile_set->map_to_local(cell_data.coords + *merged_rect_size - Vector2i(1, 1))) / 2.0;
+				ps->body_add_shape(body.rid, shape, Transform2D(0, rect_center - body.origin));
+				body.shapes_coords.push_back(cell_data.coords);
+			} else {
+				// Add the shapes to the body.
+				const Transform2D shape_xform(0, cell_origin - body.origin);
+				for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+					// Iterate over the polygons.
+					bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+					float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+					int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+					for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+						// Add decomposed convex shapes.
+						Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index, tile.flip_h, tile.flip_v, tile.transpose);
+						ps->body_add_shape(body.rid, shape->get_rid(), shape_xform);
+						ps->body_set_shape_as_one_way_collision(body.rid, body.shapes_coords.size(), one_way_collision, one_way_collision_margin);
+						body.shapes_coords.push_back(cell_data.coords);
+					}
+				}
 			}
+
+			cell_data.bodies_shapes[tile_set_physics_layer].y = body.shapes_coords.size() - cell_data.bodies_shapes[tile_set_physics_layer].x;
 		}
 	}
 
-	// If we did not return earlier, clear the cell.
-	_physics_clear_cell(r_cell_data);
+	// Free the runtime tile data built only for this quadrant.
+	for (const QuadrantTile &tile : tiles) {
+		if (tile.built_runtime_tile_data) {
+			_clear_runtime_update_tile_data_for_cell(*tile.cell_data);
+		}
+	}
+}
+
+const PhysicsQuadrant::Body *TileMapLayer::_physics_get_body(RID p_physics_body) const {
+	const Ref<PhysicsQuadrant> *physics_quadrant = bodies_quadrants.getptr(p_physics_body);
+	if (!physics_quadrant) {
+		return nullptr;
+	}
+	for (const PhysicsQuadrant::Body &body : (*physics_quadrant)->bodies) {
+		if (body.rid == p_physics_body) {
+			return &body;
+		}
+	}
+	return nullptr;
 }
 
 #ifdef DEBUG_ENABLED
@@ -913,17 +1145,23 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 	Transform2D quadrant_to_local(0, p_quadrant_pos);
 	Transform2D global_to_quadrant = (get_global_transform() * quadrant_to_local).affine_inverse();
 
-	for (RID body : r_cell_data.bodies) {
+	for (uint32_t body_index = 0; body_index < r_cell_data.bodies.size(); body_index++) {
+		const RID &body = r_cell_data.bodies[body_index];
 		if (body.is_valid()) {
+			// Only draw the shapes of this cell, bodies may be shared with other cells.
+			const Vector2i &body_shapes = r_cell_data.bodies_shapes[body_index];
 			Transform2D body_to_quadrant = global_to_quadrant * Transform2D(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM));
-			rs->canvas_item_add_set_transform(p_canvas_item, body_to_quadrant);
-			for (int shape_index = 0; shape_index < ps->body_get_shape_count(body); shape_index++) {
+			for (int shape_index = body_shapes.x; shape_index < body_shapes.x + body_shapes.y; shape_index++) {
+				rs->canvas_item_add_set_transform(p_canvas_item, body_to_quadrant * ps->body_get_shape_transform(body, shape_index));
 				const RID &shape = ps->body_get_shape(body, shape_index);
 				const PhysicsServer2D::ShapeType &type = ps->shape_get_type(shape);
 				if (type == PhysicsServer2D::SHAPE_CONVEX_POLYGON) {
 					rs->canvas_item_add_polygon(p_canvas_item, ps->shape_get_data(shape), color);
+				} else if (type == PhysicsServer2D::SHAPE_RECTANGLE) {
+					Vector2 half_extents = ps->shape_get_data(shape);
+					rs->canvas_item_add_rect(p_canvas_item, Rect2(-half_extents, half_extents * 2.0), debug_collision_color);
 				} else {
-					WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON.");
+					WARN_PRINT("Wrong shape type for a tile, should be SHAPE_CONVEX_POLYGON or SHAPE_RECTANGLE.");
 				}
 			}
 			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
@@ -1764,6 +2002,9 @@ void TileMapLayer::_bind_methods() {
 	// --- Cells manipulation ---
 	// Generic cells manipulations and access.
 	ClassDB::bind_method(D_METHOD("set_cell", "coords", "source_id", "atlas_coords", "alternative_tile"), &TileMapLayer::set_cell, DEFVAL(TileSet::INVALID_SOURCE), DEFVAL(TileSetSource::INVALID_ATLAS_COORDS), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("set_cells_rect", "rect", "source_id", "atlas_coords", "alternative_tile"), &TileMapLayer::set_cells_rect, DEFVAL(TileSet::INVALID_SOURCE), DEFVAL(TileSetSource::INVALID_ATLAS_COORDS), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("set_cells_from_buffer", "coords", "ids"), &TileMapLayer::set_cells_from_buffer);
+	ClassDB::bind_method(D_METHOD("set_cells_from_image", "image", "position", "palette"), &TileMapLayer::set_cells_from_image);
 	ClassDB::bind_method(D_METHOD("erase_cell", "coords"), &TileMapLayer::erase_cell);
 	ClassDB::bind_method(D_METHOD("fix_invalid_tiles"), &TileMapLayer::fix_invalid_tiles);
 	ClassDB::bind_method(D_METHOD("clear"), &TileMapLayer::clear);
@@ -1788,6 +2029,7 @@ void TileMapLayer::_bind_methods() {
 	// --- Physics helpers ---
 	ClassDB::bind_method(D_METHOD("has_body_rid", "body"), &TileMapLayer::has_body_rid);
 	ClassDB::bind_method(D_METHOD("get_coords_for_body_rid", "body"), &TileMapLayer::get_coords_for_body_rid);
+	ClassDB::bind_method(D_METHOD("get_coords_for_body_shape_index", "body", "body_shape_index"), &TileMapLayer::get_coords_for_body_shape_index);
 
 	// --- Runtime ---
 	ClassDB::bind_method(D_METHOD("update_internals"), &TileMapLayer::update_internals);
@@ -1821,6 +2063,10 @@ void TileMapLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_collision_enabled"), &TileMapLayer::is_collision_enabled);
 	ClassDB::bind_method(D_METHOD("set_use_kinematic_bodies", "use_kinematic_bodies"), &TileMapLayer::set_use_kinematic_bodies);
 	ClassDB::bind_method(D_METHOD("is_using_kinematic_bodies"), &TileMapLayer::is_using_kinematic_bodies);
+	ClassDB::bind_method(D_METHOD("set_physics_quadrant_size", "size"), &TileMapLayer::set_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_physics_quadrant_size"), &TileMapLayer::get_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("set_merge_collision_rectangles", "enabled"), &TileMapLayer::set_merge_collision_rectangles);
+	ClassDB::bind_method(D_METHOD("is_merging_collision_rectangles"), &TileMapLayer::is_merging_collision_rectangles);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "visibility_mode"), &TileMapLayer::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMapLayer::get_collision_visibility_mode);
 
@@ -1845,6 +2091,8 @@ void TileMapLayer::_bind_methods() {
 	ADD_GROUP("Physics", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_enabled"), "set_collision_enabled", "is_collision_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_kinematic_bodies"), "set_use_kinematic_bodies", "is_using_kinematic_bodies");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_quadrant_size", PROPERTY_HINT_RANGE, "1,64,1,or_greater"), "set_physics_quadrant_size", "get_physics_quadrant_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "merge_collision_rectangles"), "set_merge_collision_rectangles", "is_merging_collision_rectangles");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_GROUP("Navigation", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "navigation_enabled"), "set_navigation_enabled", "is_navigation_enabled");
@@ -2310,7 +2558,7 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 	}
 }
 
-void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
+bool TileMapLayer::_set_cell_data(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
 	// Set the current cell tile (using integer position).
 	Vector2i pk(p_coords);
 	HashMap<Vector2i, CellData>::Iterator E = tile_map_layer_data.find(pk);
@@ -2328,7 +2576,7 @@ void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vec
 
 	if (!E) {
 		if (source_id == TileSet::INVALID_SOURCE) {
-			return; // Nothing to do, the tile is already empty.
+			return false; // Nothing to do, the tile is already empty.
 		}
 
 		// Insert a new cell in the tile map.
@@ -2337,7 +2585,7 @@ void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vec
 		E = tile_map_layer_data.insert(pk, new_cell_data);
 	} else {
 		if (E->value.cell.source_id == source_id && E->value.cell.get_atlas_coords() == atlas_coords && E->value.cell.alternative_tile == alternative_tile) {
-			return; // Nothing changed.
+			return false; // Nothing changed.
 		}
 	}
 
@@ -2350,9 +2598,96 @@ void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vec
 	if (!E->value.dirty_list_element.in_list()) {
 		dirty.cell_list.add(&(E->value.dirty_list_element));
 	}
-	_queue_internal_update();
+	return true;
+}
 
-	used_rect_cache_dirty = true;
+void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
+	if (_set_cell_data(p_coords, p_source_id, p_atlas_coords, p_alternative_tile)) {
+		_queue_internal_update();
+		used_rect_cache_dirty = true;
+	}
+}
+
+void TileMapLayer::set_cells_rect(const Rect2i &p_rect, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
+	ERR_FAIL_COND_MSG(p_rect.size.x < 0 || p_rect.size.y < 0, "The rect size cannot be negative.");
+
+	if (p_source_id != TileSet::INVALID_SOURCE) {
+		tile_map_layer_data.reserve(tile_map_layer_data.size() + p_rect.size.x * p_rect.size.y);
+	}
+
+	bool changed = false;
+	for (int y = p_rect.position.y; y < p_rect.position.y + p_rect.size.y; y++) {
+		for (int x = p_rect.position.x; x < p_rect.position.x + p_rect.size.x; x++) {
+			changed |= _set_cell_data(Vector2i(x, y), p_source_id, p_atlas_coords, p_alternative_tile);
+		}
+	}
+
+	if (changed) {
+		_queue_internal_update();
+		used_rect_cache_dirty = true;
+	}
+}
+
+void TileMapLayer::set_cells_from_buffer(const PackedInt32Array &p_coords, const PackedInt32Array &p_ids) {
+	ERR_FAIL_COND_MSG(p_coords.size() % 2 != 0, "The coords buffer must contain two integers (x, y) per cell.");
+	int cells_count = p_coords.size() / 2;
+	ERR_FAIL_COND_MSG(p_ids.size() != cells_count * 4, vformat("The ids buffer must contain four integers (source_id, atlas_coords.x, atlas_coords.y, alternative_tile) per cell, expected %d integers but got %d.", cells_count * 4, p_ids.size()));
+
+	tile_map_layer_data.reserve(tile_map_layer_data.size() + cells_count);
+
+	const int32_t *coords_ptr = p_coords.ptr();
+	const int32_t *ids_ptr = p_ids.ptr();
+	bool changed = false;
+	for (int i = 0; i < cells_count; i++) {
+		changed |= _set_cell_data(Vector2i(coords_ptr[i * 2], coords_ptr[i * 2 + 1]), ids_ptr[i * 4], Vector2i(ids_ptr[i * 4 + 1], ids_ptr[i * 4 + 2]), ids_ptr[i * 4 + 3]);
+	}
+
+	if (changed) {
+		_queue_internal_update();
+		used_rect_cache_dirty = true;
+	}
+}
+
+void TileMapLayer::set_cells_from_image(const Ref<Image> &p_image, const Vector2i &p_position, const Dictionary &p_palette) {
+	ERR_FAIL_COND(p_image.is_null());
+	ERR_FAIL_COND_MSG(p_image->is_compressed(), "Cannot set cells from a compressed image.");
+
+	// Compare colors as 32-bit values, so the palette matches the pixels of 8-bit images exactly.
+	HashMap<uint32_t, TileMapCell> palette;
+	for (const Variant *key = p_palette.next(nullptr); key; key = p_palette.next(key)) {
+		ERR_FAIL_COND_MSG(key->get_type() != Variant::COLOR, "The palette keys must be colors.");
+		const Variant &value = p_palette[*key];
+		ERR_FAIL_COND_MSG(value.get_type() != Variant::VECTOR4I, "The palette values must be Vector4i(source_id, atlas_coords.x, atlas_coords.y, alternative_tile).");
+		Vector4i ids = value;
+		palette[Color(*key).to_rgba32()] = TileMapCell(ids.x, Vector2i(ids.y, ids.z), ids.w);
+	}
+
+	Ref<Image> image = p_image;
+	if (image->get_format() != Image::FORMAT_RGBA8) {
+		image = p_image->duplicate();
+		image->convert(Image::FORMAT_RGBA8);
+	}
+
+	const int width = image->get_width();
+	const int height = image->get_height();
+	tile_map_layer_data.reserve(tile_map_layer_data.size() + width * height);
+
+	const uint8_t *pixels = image->ptr();
+	bool changed = false;
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			const uint8_t *pixel = pixels + (y * width + x) * 4;
+			const TileMapCell *cell = palette.getptr((uint32_t(pixel[0]) << 24) | (uint32_t(pixel[1]) << 16) | (uint32_t(pixel[2]) << 8) | uint32_t(pixel[3]));
+			if (cell) {
+				changed |= _set_cell_data(p_position + Vector2i(x, y), cell->source_id, cell->get_atlas_coords(), cell->alternative_tile);
+			}
+		}
+	}
+
+	if (changed) {
+		_queue_internal_update();
+		used_rect_cache_dirty = true;
+	}
 }
 
 void TileMapLayer::erase_cell(const Vector2i &p_coords) {
@@ -2634,13 +2969,21 @@ void TileMapLayer::set_cells_terrain_path(TypedArray<Vector2i> p_path, int p_ter
 }
 
 bool TileMapLayer::has_body_rid(RID p_physics_body) const {
-	return bodies_coords.has(p_physics_body);
+	return bodies_quadrants.has(p_physics_body);
 }
 
 Vector2i TileMapLayer::get_coords_for_body_rid(RID p_physics_body) const {
-	const Vector2i *found = bodies_coords.getptr(p_physics_body);
-	ERR_FAIL_NULL_V(found, Vector2i());
-	return *found;
+	const PhysicsQuadrant::Body *body = _physics_get_body(p_physics_body);
+	ERR_FAIL_NULL_V(body, Vector2i());
+	ERR_FAIL_COND_V(body->shapes_coords.is_empty(), Vector2i());
+	return body->shapes_coords[0];
+}
+
+Vector2i TileMapLayer::get_coords_for_body_shape_index(RID p_physics_body, int p_body_shape_index) const {
+	const PhysicsQuadrant::Body *body = _physics_get_body(p_physics_body);
+	ERR_FAIL_NULL_V(body, Vector2i());
+	ERR_FAIL_INDEX_V(p_body_shape_index, (int)body->shapes_coords.size(), Vector2i());
+	return body->shapes_coords[p_body_shape_index];
 }
 
 void TileMapLayer::update_internals() {
@@ -2930,6 +3273,35 @@ bool TileMapLayer::is_using_kinematic_bodies() const {
 	return use_kinematic_bodies;
 }
 
+void TileMapLayer::set_physics_quadrant_size(int p_size) {
+	if (physics_quadrant_size == p_size) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(p_size < 1, "Physics quadrant size cannot be smaller than 1.");
+	physics_quadrant_size = p_size;
+	dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+int TileMapLayer::get_physics_quadrant_size() const {
+	return physics_quadrant_size;
+}
+
+void TileMapLayer::set_merge_collision_rectangles(bool p_merge_collision_rectangles) {
+	if (merge_collision_rectangles == p_merge_collision_rectangles) {
+		return;
+	}
+	merge_collision_rectangles = p_merge_collision_rectangles;
+	dirty.flags[DIRTY_FLAGS_LAYER_MERGE_COLLISION_RECTANGLES] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+bool TileMapLayer::is_merging_collision_rectangles() const {
+	return merge_collision_rectangles;
+}
+
 void TileMapLayer::set_collision_visibility_mode(TileMapLayer::DebugVisibilityMode p_show_collision) {
 	if (collision_visibility_mode == p_show_collision) {
 		return;
@@ -97,6 +97,7 @@ public:
 class DebugQuadrant;
 #endif // DEBUG_ENABLED
 class RenderingQuadrant;
+class PhysicsQuadrant;
 
 struct CellData {
 	Vector2i coords;
@@ -111,7 +112,10 @@ struct CellData {
 	LocalVector<RID> occluders;
 
 	// Physics.
+	Ref<PhysicsQuadrant> physics_quadrant;
+	SelfList<CellData> physics_quadrant_list_element;
 	LocalVector<RID> bodies;
+	LocalVector<Vector2i> bodies_shapes; // Per physics layer, the index of the first shape of the cell in its body and the number of shapes.
 
 	// Navigation.
 	LocalVector<RID> navigation_regions;
@@ -135,6 +139,7 @@ struct CellData {
 		cell = p_other.cell;
 		occluders = p_other.occluders;
 		bodies = p_other.bodies;
+		bodies_shapes = p_other.bodies_shapes;
 		navigation_regions = p_other.navigation_regions;
 		scene = p_other.scene;
 		runtime_tile_data_cache = p_other.runtime_tile_data_cache;
@@ -143,11 +148,13 @@ struct CellData {
 	CellData(const CellData &p_other) :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
 		cell = p_other.cell;
 		occluders = p_other.occluders;
 		bodies = p_other.bodies;
+		bodies_shapes = p_other.bodies_shapes;
 		navigation_regions = p_other.navigation_regions;
 		scene = p_other.scene;
 		runtime_tile_data_cache = p_other.runtime_tile_data_cache;
@@ -156,6 +163,7 @@ struct CellData {
 	CellData() :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
@@ -219,6 +227,35 @@ public:
 	}
 };
 
+class PhysicsQuadrant : public RefCounted {
+	GDCLASS(PhysicsQuadrant, RefCounted);
+
+public:
+	struct Body {
+		RID rid;
+		int physics_layer = 0;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		Vector2 origin; // In the layer's local coordinates.
+		LocalVector<Vector2i> shapes_coords; // The coords of the cell each shape was created from.
+	};
+
+	Vector2i quadrant_coords;
+	SelfList<CellData>::List cells;
+	LocalVector<Body> bodies;
+	LocalVector<RID> merged_shapes; // Rectangle shapes fused from several cells, owned by the quadrant.
+
+	SelfList<PhysicsQuadrant> dirty_quadrant_list_element;
+
+	PhysicsQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~PhysicsQuadrant() {
+		cells.clear();
+	}
+};
+
 class TileMapLayer : public Node2D {
 	GDCLASS(TileMapLayer, Node2D);
 
@@ -253,6 +290,8 @@ public:
 		DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_SIZE,
 		DIRTY_FLAGS_LAYER_COLLISION_ENABLED,
 		DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES,
+		DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE,
+		DIRTY_FLAGS_LAYER_MERGE_COLLISION_RECTANGLES,
 		DIRTY_FLAGS_LAYER_COLLISION_VISIBILITY_MODE,
 		DIRTY_FLAGS_LAYER_NAVIGATION_ENABLED,
 		DIRTY_FLAGS_LAYER_NAVIGATION_MAP,
@@ -286,6 +325,8 @@ private:
 
 	bool collision_enabled = true;
 	bool use_kinematic_bodies = false;
+	int physics_quadrant_size = 1;
+	bool merge_collision_rectangles = false;
 	DebugVisibilityMode collision_visibility_mode = DEBUG_VISIBILITY_MODE_DEFAULT;
 
 	bool navigation_enabled = true;
@@ -339,12 +380,16 @@ private:
 	void _rendering_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
 
-	HashMap<RID, Vector2i> bodies_coords; // Mapping for RID to coords.
+	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
+	HashMap<RID, Ref<PhysicsQuadrant>> bodies_quadrants; // Mapping for RID to the quadrant owning the body.
 	bool _physics_was_cleaned_up = false;
 	void _physics_update(bool p_force_cleanup);
 	void _physics_notification(int p_what);
-	void _physics_clear_cell(CellData &r_cell_data);
-	void _physics_update_cell(CellData &r_cell_data);
+	void _physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list);
+	void _physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant);
+	void _physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant, bool p_runtime_update, bool p_use_tilemap_for_runtime);
+	int _physics_get_or_create_quadrant_body(const Ref<PhysicsQuadrant> &p_physics_quadrant, int p_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity, const Vector2 &p_origin);
+	const PhysicsQuadrant::Body *_physics_get_body(RID p_physics_body) const;
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -376,6 +421,9 @@ private:
 	void _renamed();
 	void _update_notify_local_transform();
 
+	// Cells manipulation, without queueing an update.
+	bool _set_cell_data(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile);
+
 	// Internal updates.
 	void _queue_internal_update();
 	void _deferred_internal_update();
@@ -425,6 +473,9 @@ public:
 	// --- Cells manipulation ---
 	// Generic cells manipulations and data access.
 	void set_cell(const Vector2i &p_coords, int p_source_id = TileSet::INVALID_SOURCE, const Vector2i &p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
+	void set_cells_rect(const Rect2i &p_rect, int p_source_id = TileSet::INVALID_SOURCE, const Vector2i &p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
+	void set_cells_from_buffer(const PackedInt32Array &p_coords, const PackedInt32Array &p_ids);
+	void set_cells_from_image(const Ref<Image> &p_image, const Vector2i &p_position, const Dictionary &p_palette);
 	void erase_cell(const Vector2i &p_coords);
 	void fix_invalid_tiles();
 	void clear();
@@ -449,6 +500,7 @@ public:
 	// --- Physics helpers ---
 	bool has_body_rid(RID p_physics_body) const;
 	Vector2i get_coords_for_body_rid(RID p_physics_body) const; // For finding tiles from collision.
+	Vector2i get_coords_for_body_shape_index(RID p_physics_body, int p_body_shape_index) const;
 
 	// --- Runtime ---
 	void update_internals();
@@ -490,6 +542,10 @@ public:
 	bool is_collision_enabled() const;
 	void set_use_kinematic_bodies(bool p_use_kinematic_bodies);
 	bool is_using_kinematic_bodies() const;
+	void set_physics_quadrant_size(int p_size);
+	int get_physics_quadrant_size() const;
+	void set_merge_collision_rectangles(bool p_merge_collision_rectangles);
+	bool is_merging_collision_rectangles() const;
 	void set_collision_visibility_mode(DebugVisibilityMode p_show_collision);
 	DebugVisibilityMode get_collision_visibility_mode() const;
 
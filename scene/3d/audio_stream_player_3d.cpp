@@ -31,7 +31,9 @@
 #include "audio_stream_player_3d.h"
 #include "audio_stream_player_3d.compat.inc"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/templates/sort_array.h"
 #include "scene/3d/audio_listener_3d.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/physics/area_3d.h"
@@ -246,10 +248,14 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 		case NOTIFICATION_ENTER_TREE: {
 			velocity_tracker->reset(get_global_transform().origin);
 			AudioServer::get_singleton()->add_listener_changed_callback(_listener_changed_cb, this);
+			if (occlusion_enabled) {
+				_set_occlusion_registered(true);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
 			AudioServer::get_singleton()->remove_listener_changed_callback(_listener_changed_cb, this);
+			_set_occlusion_registered(false);
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
@@ -259,6 +265,11 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
+			if (occlusion_enabled) {
+				// Only the first occluded player processed in this physics tick does the work.
+				_update_occlusion(get_physics_process_delta_time());
+			}
+
 			// Update anything related to position first, if possible of course.
 			Vector<AudioFrame> volume_vector;
 			if (setplay.get() > 0 || (internal->active.is_set() && last_mix_count != AudioServer::get_singleton()->get_mix_count()) || force_update_panning) {
@@ -270,7 +281,8 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 				internal->active.set();
 				HashMap<StringName, Vector<AudioFrame>> bus_map;
 				bus_map[_get_actual_bus()] = volume_vector;
-				AudioServer::get_singleton()->start_playback_stream(setplayback, bus_map, setplay.get(), actual_pitch_scale, linear_attenuation, attenuation_filter_cutoff_hz);
+				AudioServer::get_singleton()->start_playback_stream(setplayback, bus_map, setplay.get(), actual_pitch_scale, linear_attenuation, actual_filter_cutoff_hz);
+				_update_voice_params(setplayback);
 				setplayback.unref();
 				setplay.set(-1);
 			}
@@ -283,6 +295,154 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 	}
 }
 
+BinaryMutex AudioStreamPlayer3D::occlusion_mutex;
+SelfList<AudioStreamPlayer3D>::List AudioStreamPlayer3D::occlusion_players;
+uint64_t AudioStreamPlayer3D::occlusion_physics_frame = UINT64_MAX;
+uint32_t AudioStreamPlayer3D::occlusion_phase_counter = 0;
+
+void AudioStreamPlayer3D::_set_occlusion_registered(bool p_registered) {
+	MutexLock lock(occlusion_mutex);
+	if (p_registered == occlusion_list_elem.in_list()) {
+		return;
+	}
+	if (p_registered) {
+		// Spread the updates of distant players over different ticks.
+		occlusion_phase = occlusion_phase_counter++;
+		occlusion_players.add(&occlusion_list_elem);
+	} else {
+		occlusion_players.remove(&occlusion_list_elem);
+		occlusion = 0.0;
+		occlusion_target = 0.0;
+	}
+}
+
+bool AudioStreamPlayer3D::_get_occlusion_listener_position(Vector3 &r_position) const {
+	Viewport *vp = get_viewport();
+	if (!vp || !vp->is_audio_listener_3d()) {
+		return false;
+	}
+	AudioListener3D *listener = vp->get_audio_listener_3d();
+	if (listener) {
+		r_position = listener->get_global_transform().origin;
+		return true;
+	}
+	Camera3D *camera = vp->get_camera_3d();
+	if (camera) {
+		r_position = camera->get_global_transform().origin;
+		return true;
+	}
+	return false;
+}
+
+// Interacts with PhysicsServer3D, so can only be called during _physics_process.
+void AudioStreamPlayer3D::_update_occlusion(double p_step) {
+	MutexLock lock(occlusion_mutex);
+
+	uint64_t frame = Engine::get_singleton()->get_physics_frames();
+	if (occlusion_physics_frame == frame) {
+		return;
+	}
+	occlusion_physics_frame = frame;
+
+	struct Query {
+		AudioStreamPlayer3D *player = nullptr;
+		RID space;
+		uint32_t mask = 0;
+		Vector3 source;
+		Vector3 listener;
+	};
+
+	struct QuerySort {
+		_FORCE_INLINE_ bool operator()(const Query &p_a, const Query &p_b) const {
+			return p_a.space == p_b.space ? p_a.mask < p_b.mask : p_a.space < p_b.space;
+		}
+	};
+
+	// Takes about 1/8th of a second to fully muffle or restore a source.
+	const float fade_step = MIN(1.0, p_step * 8.0);
+
+	LocalVector<Query> queries;
+	for (SelfList<AudioStreamPlayer3D> *E = occlusion_players.first(); E; E = E->next()) {
+		AudioStreamPlayer3D *player = E->self();
+		player->occlusion = Math::move_toward(player->occlusion, player->occlusion_target, fade_step);
+
+		if (!player->internal->active.is_set() || player->internal->stream_playbacks.is_empty()) {
+			continue;
+		}
+
+		Query query;
+		if (!player->_get_occlusion_listener_position(query.listener)) {
+			continue;
+		}
+		query.source = player->get_global_transform().origin;
+
+		// Nearby sources are tested every tick, distant ones less often.
+		const float stagger_distance = player->max_distance > 0 ? player->max_distance / OCCLUSION_MAX_UPDATE_INTERVAL : player->unit_size * 2.0;
+		uint32_t interval = uint32_t(query.source.distance_to(query.listener) / MAX(stagger_distance, 0.01)) + 1;
+		interval = MIN(interval, uint32_t(OCCLUSION_MAX_UPDATE_INTERVAL));
+		if ((frame + player->occlusion_phase) % interval != 0) {
+			continue;
+		}
+
+		Ref<World3D> world_3d = player->get_world_3d();
+		if (world_3d.is_null()) {
+			continue;
+		}
+		query.player = player;
+		query.space = world_3d->get_space();
+		query.mask = player->occlusion_collision_mask;
+		queries.push_back(query);
+	}
+
+	if (queries.is_empty()) {
+		return;
+	}
+
+	SortArray<Query, QuerySort> sorter;
+	sorter.sort(queries.ptr(), queries.size());
+
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	LocalVector<bool> hits;
+
+	uint32_t begin = 0;
+	while (begin < queries.size()) {
+		uint32_t end = begin + 1;
+		while (end < queries.size() && queries[end].space == queries[begin].space && queries[end].mask == queries[begin].mask) {
+			end++;
+		}
+
+		// Cast both ways and only count the path as blocked when both rays hit. A ray starting inside
+		// a shape ignores it, so the body the source or the listener is attached to does not occlude.
+		uint32_t count = end - begin;
+		from.resize(count * 2);
+		to.resize(count * 2);
+		results.resize(count * 2);
+		hits.resize(count * 2);
+		for (uint32_t i = 0; i < count; i++) {
+			const Query &query = queries[begin + i];
+			from[i * 2 + 0] = query.source;
+			to[i * 2 + 0] = query.listener;
+			from[i * 2 + 1] = query.listener;
+			to[i * 2 + 1] = query.source;
+		}
+
+		PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(queries[begin].space);
+		if (space_state) {
+			PhysicsDirectSpaceState3D::RayParameters ray_params;
+			ray_params.collision_mask = queries[begin].mask;
+			space_state->intersect_rays(ray_params, from.ptr(), to.ptr(), count * 2, results.ptr(), hits.ptr());
+
+			for (uint32_t i = 0; i < count; i++) {
+				queries[begin + i].player->occlusion_target = (hits[i * 2 + 0] && hits[i * 2 + 1]) ? 1.0 : 0.0;
+			}
+		}
+
+		begin = end;
+	}
+}
+
 // Interacts with PhysicsServer3D, so can only be called during _physics_process
 Area3D *AudioStreamPlayer3D::_get_overriding_area() {
 	//check if any area is diverting sound into a bus
@@ -422,9 +582,17 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 			}
 		}
 
+		actual_filter_cutoff_hz = attenuation_filter_cutoff_hz;
+		if (occlusion_enabled && occlusion > 0.0) {
+			db_att += occlusion * occlusion_filter_db;
+			// Interpolate the cutoff in the log domain, so the muffling sounds even.
+			float occluded_cutoff_hz = MIN(attenuation_filter_cutoff_hz, occlusion_filter_cutoff_hz);
+			actual_filter_cutoff_hz = Math::exp(Math::lerp(Math::log(attenuation_filter_cutoff_hz), Math::log(occluded_cutoff_hz), occlusion));
+		}
+
 		linear_attenuation = Math::db_to_linear(db_att);
-		for (Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
-			AudioServer::get_singleton()->set_playback_highshelf_params(playback, linear_attenuation, attenuation_filter_cutoff_hz);
+		for (const Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
+			AudioServer::get_singleton()->set_playback_highshelf_params(playback, linear_attenuation, actual_filter_cutoff_hz);
 		}
 		// Bake in a constant factor here to allow the project setting defaults for 2d and 3d to be normalized to 1.0.
 		float tightness = cached_global_panning_strength * 2.0f;
@@ -452,7 +620,7 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 			bus_volumes[internal->bus] = output_volume_vector;
 		}
 
-		for (Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
+		for (const Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
 			AudioServer::get_singleton()->set_playback_bus_volumes_linear(playback, bus_volumes);
 		}
 
@@ -480,7 +648,7 @@ Vector<AudioFrame> AudioStreamPlayer3D::_update_panning() {
 		} else {
 			actual_pitch_scale = internal->pitch_scale;
 		}
-		for (Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
+		for (const Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
 			AudioServer::get_singleton()->set_playback_pitch_scale(playback, actual_pitch_scale);
 			if (playback->get_is_sample()) {
 				Ref<AudioSamplePlayback> sample_playback = playback->get_sample_playback();
@@ -651,6 +819,7 @@ float AudioStreamPlayer3D::get_emission_angle_filter_attenuation_db() const {
 
 void AudioStreamPlayer3D::set_attenuation_filter_cutoff_hz(float p_hz) {
 	attenuation_filter_cutoff_hz = p_hz;
+	actual_filter_cutoff_hz = p_hz;
 }
 
 float AudioStreamPlayer3D::get_attenuation_filter_cutoff_hz() const {
@@ -665,6 +834,49 @@ float AudioStreamPlayer3D::get_attenuation_filter_db() const {
 	return attenuation_filter_db;
 }
 
+void AudioStreamPlayer3D::set_occlusion_enabled(bool p_enabled) {
+	if (occlusion_enabled == p_enabled) {
+		return;
+	}
+	occlusion_enabled = p_enabled;
+	if (is_inside_tree()) {
+		_set_occlusion_registered(p_enabled);
+	}
+	force_update_panning = true;
+}
+
+bool AudioStreamPlayer3D::is_occlusion_enabled() const {
+	return occlusion_enabled;
+}
+
+void AudioStreamPlayer3D::set_occlusion_collision_mask(uint32_t p_mask) {
+	occlusion_collision_mask = p_mask;
+}
+
+uint32_t AudioStreamPlayer3D::get_occlusion_collision_mask() const {
+	return occlusion_collision_mask;
+}
+
+void AudioStreamPlayer3D::set_occlusion_filter_cutoff_hz(float p_hz) {
+	occlusion_filter_cutoff_hz = p_hz;
+}
+
+float AudioStreamPlayer3D::get_occlusion_filter_cutoff_hz() const {
+	return occlusion_filter_cutoff_hz;
+}
+
+void AudioStreamPlayer3D::set_occlusion_filter_db(float p_db) {
+	occlusion_filter_db = p_db;
+}
+
+float AudioStreamPlayer3D::get_occlusion_filter_db() const {
+	return occlusion_filter_db;
+}
+
+float AudioStreamPlayer3D::get_occlusion() const {
+	return occlusion;
+}
+
 void AudioStreamPlayer3D::set_attenuation_model(AttenuationModel p_model) {
 	ERR_FAIL_INDEX((int)p_model, 4);
 	attenuation_model = p_model;
@@ -730,6 +942,25 @@ float AudioStreamPlayer3D::get_panning_strength() const {
 	return panning_strength;
 }
 
+void AudioStreamPlayer3D::_update_voice_params(const Ref<AudioStreamPlayback> &p_playback) {
+	Ref<AudioStream> stream = internal->stream;
+	if (stream.is_null()) {
+		return;
+	}
+	AudioServer::get_singleton()->set_playback_voice_params(p_playback, voice_priority, stream->get_length(), stream->has_loop());
+}
+
+void AudioStreamPlayer3D::set_voice_priority(int p_priority) {
+	voice_priority = p_priority;
+	for (const Ref<AudioStreamPlayback> &playback : internal->stream_playbacks) {
+		_update_voice_params(playback);
+	}
+}
+
+int AudioStreamPlayer3D::get_voice_priority() const {
+	return voice_priority;
+}
+
 AudioServer::PlaybackType AudioStreamPlayer3D::get_playback_type() const {
 	return internal->get_playback_type();
 }
@@ -803,6 +1034,20 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_attenuation_filter_db", "db"), &AudioStreamPlayer3D::set_attenuation_filter_db);
 	ClassDB::bind_method(D_METHOD("get_attenuation_filter_db"), &AudioStreamPlayer3D::get_attenuation_filter_db);
 
+	ClassDB::bind_method(D_METHOD("set_occlusion_enabled", "enabled"), &AudioStreamPlayer3D::set_occlusion_enabled);
+	ClassDB::bind_method(D_METHOD("is_occlusion_enabled"), &AudioStreamPlayer3D::is_occlusion_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_occlusion_collision_mask", "mask"), &AudioStreamPlayer3D::set_occlusion_collision_mask);
+	ClassDB::bind_method(D_METHOD("get_occlusion_collision_mask"), &AudioStreamPlayer3D::get_occlusion_collision_mask);
+
+	ClassDB::bind_method(D_METHOD("set_occlusion_filter_cutoff_hz", "hz"), &AudioStreamPlayer3D::set_occlusion_filter_cutoff_hz);
+	ClassDB::bind_method(D_METHOD("get_occlusion_filter_cutoff_hz"), &AudioStreamPlayer3D::get_occlusion_filter_cutoff_hz);
+
+	ClassDB::bind_method(D_METHOD("set_occlusion_filter_db", "db"), &AudioStreamPlayer3D::set_occlusion_filter_db);
+	ClassDB::bind_method(D_METHOD("get_occlusion_filter_db"), &AudioStreamPlayer3D::get_occlusion_filter_db);
+
+	ClassDB::bind_method(D_METHOD("get_occlusion"), &AudioStreamPlayer3D::get_occlusion);
+
 	ClassDB::bind_method(D_METHOD("set_attenuation_model", "model"), &AudioStreamPlayer3D::set_attenuation_model);
 	ClassDB::bind_method(D_METHOD("get_attenuation_model"), &AudioStreamPlayer3D::get_attenuation_model);
 
@@ -818,6 +1063,9 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_panning_strength", "panning_strength"), &AudioStreamPlayer3D::set_panning_strength);
 	ClassDB::bind_method(D_METHOD("get_panning_strength"), &AudioStreamPlayer3D::get_panning_strength);
 
+	ClassDB::bind_method(D_METHOD("set_voice_priority", "priority"), &AudioStreamPlayer3D::set_voice_priority);
+	ClassDB::bind_method(D_METHOD("get_voice_priority"), &AudioStreamPlayer3D::get_voice_priority);
+
 	ClassDB::bind_method(D_METHOD("has_stream_playback"), &AudioStreamPlayer3D::has_stream_playback);
 	ClassDB::bind_method(D_METHOD("get_stream_playback"), &AudioStreamPlayer3D::get_stream_playback);
 
@@ -836,6 +1084,7 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_distance", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_max_distance", "get_max_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_polyphony", PROPERTY_HINT_NONE, ""), "set_max_polyphony", "get_max_polyphony");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "panning_strength", PROPERTY_HINT_RANGE, "0,3,0.01,or_greater"), "set_panning_strength", "get_panning_strength");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "voice_priority", PROPERTY_HINT_RANGE, "-128,127,1"), "set_voice_priority", "get_voice_priority");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "bus", PROPERTY_HINT_ENUM, ""), "set_bus", "get_bus");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "area_mask", PROPERTY_HINT_LAYERS_2D_PHYSICS), "set_area_mask", "get_area_mask");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "playback_type", PROPERTY_HINT_ENUM, "Default,Stream,Sample"), "set_playback_type", "get_playback_type");
@@ -846,6 +1095,11 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ADD_GROUP("Attenuation Filter", "attenuation_filter_");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "attenuation_filter_cutoff_hz", PROPERTY_HINT_RANGE, "1,20500,1,suffix:Hz"), "set_attenuation_filter_cutoff_hz", "get_attenuation_filter_cutoff_hz");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "attenuation_filter_db", PROPERTY_HINT_RANGE, "-80,0,0.1,suffix:dB"), "set_attenuation_filter_db", "get_attenuation_filter_db");
+	ADD_GROUP("Occlusion", "occlusion_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "occlusion_enabled"), "set_occlusion_enabled", "is_occlusion_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "occlusion_collision_mask", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_occlusion_collision_mask", "get_occlusion_collision_mask");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "occlusion_filter_cutoff_hz", PROPERTY_HINT_RANGE, "1,20500,1,suffix:Hz"), "set_occlusion_filter_cutoff_hz", "get_occlusion_filter_cutoff_hz");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "occlusion_filter_db", PROPERTY_HINT_RANGE, "-80,0,0.1,suffix:dB"), "set_occlusion_filter_db", "get_occlusion_filter_db");
 	ADD_GROUP("Doppler", "doppler_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "doppler_tracking", PROPERTY_HINT_ENUM, "Disabled,Idle,Physics"), "set_doppler_tracking", "get_doppler_tracking");
 
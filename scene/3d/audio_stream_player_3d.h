@@ -31,6 +31,7 @@
 #ifndef AUDIO_STREAM_PLAYER_3D_H
 #define AUDIO_STREAM_PLAYER_3D_H
 
+#include "core/templates/self_list.h"
 #include "scene/3d/node_3d.h"
 #include "servers/audio_server.h"
 
@@ -62,8 +63,8 @@ public:
 private:
 	enum {
 		MAX_OUTPUTS = 8,
-		MAX_INTERSECT_AREAS = 32
-
+		MAX_INTERSECT_AREAS = 32,
+		OCCLUSION_MAX_UPDATE_INTERVAL = 8, // In physics ticks, for the most distant sources.
 	};
 
 	AudioStreamPlayerInternal *internal = nullptr;
@@ -103,6 +104,28 @@ private:
 	float attenuation_filter_db = -24.0;
 
 	float linear_attenuation = 0;
+	// Cutoff sent to the AudioServer, lowered from attenuation_filter_cutoff_hz while occluded.
+	float actual_filter_cutoff_hz = 5000.0;
+
+	bool occlusion_enabled = false;
+	uint32_t occlusion_collision_mask = 1;
+	float occlusion_filter_cutoff_hz = 800.0;
+	float occlusion_filter_db = -24.0;
+
+	// Written by the shared occlusion pass, which runs once per physics tick for all players.
+	float occlusion = 0.0;
+	float occlusion_target = 0.0;
+	uint32_t occlusion_phase = 0;
+	SelfList<AudioStreamPlayer3D> occlusion_list_elem{ this };
+
+	static BinaryMutex occlusion_mutex;
+	static SelfList<AudioStreamPlayer3D>::List occlusion_players;
+	static uint64_t occlusion_physics_frame;
+	static uint32_t occlusion_phase_counter;
+
+	static void _update_occlusion(double p_step);
+	bool _get_occlusion_listener_position(Vector3 &r_position) const;
+	void _set_occlusion_registered(bool p_registered);
 
 	float max_distance = 0.0;
 
@@ -115,6 +138,9 @@ private:
 	float panning_strength = 1.0f;
 	float cached_global_panning_strength = 0.5f;
 
+	int voice_priority = 0;
+	void _update_voice_params(const Ref<AudioStreamPlayback> &p_playback);
+
 protected:
 	void _validate_property(PropertyInfo &p_property) const;
 	void _notification(int p_what);
@@ -181,6 +207,20 @@ public:
 	void set_attenuation_filter_db(float p_db);
 	float get_attenuation_filter_db() const;
 
+	void set_occlusion_enabled(bool p_enabled);
+	bool is_occlusion_enabled() const;
+
+	void set_occlusion_collision_mask(uint32_t p_mask);
+	uint32_t get_occlusion_collision_mask() const;
+
+	void set_occlusion_filter_cutoff_hz(float p_hz);
+	float get_occlusion_filter_cutoff_hz() const;
+
+	void set_occlusion_filter_db(float p_db);
+	float get_occlusion_filter_db() const;
+
+	float get_occlusion() const;
+
 	void set_attenuation_model(AttenuationModel p_model);
 	AttenuationModel get_attenuation_model() const;
 
@@ -193,6 +233,9 @@ public:
 	void set_panning_strength(float p_panning_strength);
 	float get_panning_strength() const;
 
+	void set_voice_priority(int p_priority);
+	int get_voice_priority() const;
+
 	bool has_stream_playback();
 	Ref<AudioStreamPlayback> get_stream_playback();
 
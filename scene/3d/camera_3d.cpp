@@ -40,6 +40,10 @@ void Camera3D::_request_camera_update() {
 	_update_camera();
 }
 
+void Camera3D::_physics_interpolated_changed() {
+	RenderingServer::get_singleton()->camera_set_interpolated(camera, is_physics_interpolated());
+}
+
 void Camera3D::_update_camera_mode() {
 	force_change = true;
 	switch (mode) {
@@ -111,6 +115,10 @@ void Camera3D::_notification(int p_what) {
 				viewport->_camera_3d_set(this);
 			}
 
+			if (is_physics_interpolated_and_enabled()) {
+				notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+			}
+
 #ifdef TOOLS_ENABLED
 			if (Engine::get_singleton()->is_editor_hint()) {
 				viewport->connect(SNAME("size_changed"), callable_mp((Node3D *)this, &Camera3D::update_gizmos));
@@ -147,6 +155,13 @@ void Camera3D::_notification(int p_what) {
 			}
 		} break;
 
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			if (is_physics_interpolated()) {
+				_update_camera();
+				RenderingServer::get_singleton()->camera_reset_physics_interpolation(camera);
+			}
+		} break;
+
 		case NOTIFICATION_BECAME_CURRENT: {
 			if (viewport) {
 				viewport->find_world_3d()->_register_camera(this);
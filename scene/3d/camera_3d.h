@@ -101,6 +101,7 @@ private:
 protected:
 	void _update_camera();
 	virtual void _request_camera_update();
+	virtual void _physics_interpolated_changed() override;
 	void _update_camera_mode();
 
 	void _notification(int p_what);
@@ -30,6 +30,7 @@
 
 #include "cpu_particles_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -682,11 +683,16 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 	double system_phase = time / lifetime;
 
+	// Restarting particles draw from the global random number generator, so they are decided and emitted in order.
+	// The rest of the simulation only depends on each particle, and is spread over the WorkerThreadPool.
+	particle_steps.resize(pcount);
+
 	bool should_be_active = false;
 	for (int i = 0; i < pcount; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
+			particle_steps[i].type = PARTICLE_STEP_SKIP;
 			continue;
 		}
 
@@ -741,15 +747,19 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			restart = true;
 		}
 
-		float tv = 0.0;
+		ParticleStep &step = particle_steps[i];
+		step.delta = local_delta;
 
 		if (restart) {
 			if (!emitting) {
 				p.active = false;
+				step.type = PARTICLE_STEP_SKIP;
 				continue;
 			}
 			p.active = true;
 
+			float tv = 0.0;
+
 			/*real_t tex_linear_velocity = 0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
 				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(0);
@@ -907,12 +917,58 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				p.transform.origin.z = 0.0;
 			}
 
+			step.type = PARTICLE_STEP_RESTART;
 		} else if (!p.active) {
+			step.type = PARTICLE_STEP_SKIP;
 			continue;
 		} else if (p.time > p.lifetime) {
 			p.active = false;
-			tv = 1.0;
+			step.type = PARTICLE_STEP_END;
 		} else {
+			step.type = PARTICLE_STEP_INTEGRATE;
+		}
+
+		should_be_active = true;
+	}
+
+	if (color_ramp.is_valid()) {
+		color_ramp->get_color_at_offset(0.0); // Sorts the points before the threads read them.
+	}
+
+	ParticlesProcessData data;
+	data.particles = parray;
+	data.steps = particle_steps.ptr();
+	data.count = pcount;
+	data.emission_origin = emission_xform.origin;
+
+	uint32_t chunk_count = (pcount + PARTICLES_PROCESS_CHUNK_SIZE - 1) / PARTICLES_PROCESS_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_particles_process_chunk, &data, chunk_count, -1, true, String("CPUParticles3DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_particles_process_chunk(0, &data);
+	}
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
+	}
+}
+
+void CPUParticles3D::_particles_process_chunk(uint32_t p_chunk, const ParticlesProcessData *p_data) {
+	uint32_t from = p_chunk * PARTICLES_PROCESS_CHUNK_SIZE;
+	uint32_t to = MIN(from + PARTICLES_PROCESS_CHUNK_SIZE, p_data->count);
+
+	for (uint32_t i = from; i < to; i++) {
+		const ParticleStep &step = p_data->steps[i];
+		if (step.type == PARTICLE_STEP_SKIP) {
+			continue;
+		}
+
+		Particle &p = p_data->particles[i];
+		double local_delta = step.delta;
+		float tv = step.type == PARTICLE_STEP_END ? 1.0 : 0.0;
+
+		if (step.type == PARTICLE_STEP_INTEGRATE) {
 			uint32_t alt_seed = p.seed;
 
 			p.time += local_delta;
@@ -978,7 +1034,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(alt_seed)) : Vector3();
 			//apply radial acceleration
-			Vector3 org = emission_xform.origin;
+			Vector3 org = p_data->emission_origin;
 			Vector3 diff = position - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(alt_seed)) : Vector3();
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
@@ -1151,11 +1207,6 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 		p.transform.origin += p.velocity * local_delta;
 
-		should_be_active = true;
-	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
 	}
 }
 
@@ -1204,14 +1255,19 @@ void CPUParticles3D::_update_particle_data_buffer() {
 		}
 	}
 
+	thread_local LocalVector<Transform3D> emission_space_transforms;
+	if (!local_coords) {
+		emission_space_transforms.resize(pc);
+		for (int i = 0; i < pc; i++) {
+			emission_space_transforms[i] = r[i].transform;
+		}
+		inv_emission_transform.mul_array(emission_space_transforms.ptr(), emission_space_transforms.ptr(), pc);
+	}
+
 	for (int i = 0; i < pc; i++) {
 		int idx = order ? order[i] : i;
 
-		Transform3D t = r[idx].transform;
-
-		if (!local_coords) {
-			t = inv_emission_transform * t;
-		}
+		const Transform3D &t = local_coords ? r[idx].transform : emission_space_transforms[idx];
 
 		if (r[idx].active) {
 			ptr[0] = t.basis.rows[0][0];
@@ -112,6 +112,29 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	enum ParticleStepType : uint8_t {
+		PARTICLE_STEP_SKIP,
+		PARTICLE_STEP_RESTART,
+		PARTICLE_STEP_END,
+		PARTICLE_STEP_INTEGRATE,
+	};
+
+	struct ParticleStep {
+		double delta = 0.0;
+		ParticleStepType type = PARTICLE_STEP_SKIP;
+	};
+
+	LocalVector<ParticleStep> particle_steps;
+
+	struct ParticlesProcessData {
+		Particle *particles = nullptr;
+		const ParticleStep *steps = nullptr;
+		uint32_t count = 0;
+		Vector3 emission_origin;
+	};
+
+	static constexpr uint32_t PARTICLES_PROCESS_CHUNK_SIZE = 256;
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -188,6 +211,7 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_process_chunk(uint32_t p_chunk, const ParticlesProcessData *p_data);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
@@ -66,6 +66,7 @@ private:
 	bool one_shot = false;
 	int amount = 0;
 	float amount_ratio = 1.0;
+	float lod_threshold = 0.0;
 	double lifetime = 0.0;
 	double pre_process_time = 0.0;
 	real_t explosiveness_ratio = 0.0;
@@ -146,6 +147,9 @@ public:
 	void set_amount_ratio(float p_ratio);
 	float get_amount_ratio() const;
 
+	void set_lod_threshold(float p_threshold);
+	float get_lod_threshold() const;
+
 	void set_fixed_fps(int p_count);
 	int get_fixed_fps() const;
 
@@ -664,6 +664,16 @@ GPUParticlesCollisionSDF3D::~GPUParticlesCollisionSDF3D() {
 ////////////////////////////
 ////////////////////////////
 
+Vector2 GPUParticlesCollisionHeightField3D::_get_texel_size() const {
+	// Matches how the renderer sizes the heightfield texture.
+	int texels = 256 << resolution;
+	if (size.x > size.z) {
+		return Vector2(size.x / texels, size.z / MAX(int(size.z / size.x * texels), 1));
+	} else {
+		return Vector2(size.x / MAX(int(size.x / size.z * texels), 1), size.z / texels);
+	}
+}
+
 void GPUParticlesCollisionHeightField3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_INTERNAL_PROCESS: {
@@ -677,8 +687,11 @@ void GPUParticlesCollisionHeightField3D::_notification(int p_what) {
 					Transform3D xform = get_global_transform();
 					Vector3 x_axis = xform.basis.get_column(Vector3::AXIS_X).normalized();
 					Vector3 z_axis = xform.basis.get_column(Vector3::AXIS_Z).normalized();
-					float x_len = xform.basis.get_scale().x;
-					float z_len = xform.basis.get_scale().z;
+					// Move in steps of about one unit that are a whole number of texels,
+					// so the renderer can scroll the heightfield instead of redrawing all of it.
+					Vector2 texel_size = _get_texel_size();
+					float x_len = xform.basis.get_scale().x * texel_size.x * MAX(1.0f, Math::round(1.0f / texel_size.x));
+					float z_len = xform.basis.get_scale().z * texel_size.y * MAX(1.0f, Math::round(1.0f / texel_size.y));
 
 					Vector3 cam_pos = cam->get_global_transform().origin;
 					Transform3D new_xform = xform;
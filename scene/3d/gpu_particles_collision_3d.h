@@ -231,6 +231,8 @@ private:
 
 	UpdateMode update_mode = UPDATE_MODE_WHEN_MOVED;
 
+	Vector2 _get_texel_size() const;
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
@@ -0,0 +1,306 @@
+/**************************************************************************/
+/*  hlod_instance_3d.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_instance_3d.h"
+
+#include "core/io/marshalls.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/resources/3d/skin.h"
+#include "scene/resources/surface_tool.h"
+
+void HLODInstance3D::set_mesh(const Ref<Mesh> &p_mesh) {
+	if (mesh == p_mesh) {
+		return;
+	}
+
+	if (mesh.is_valid()) {
+		mesh->disconnect_changed(callable_mp(this, &HLODInstance3D::_mesh_changed));
+	}
+
+	mesh = p_mesh;
+
+	if (mesh.is_valid()) {
+		set_base(mesh->get_rid());
+		mesh->connect_changed(callable_mp(this, &HLODInstance3D::_mesh_changed));
+	} else {
+		set_base(RID());
+	}
+
+	update_gizmos();
+	update_configuration_warnings();
+}
+
+Ref<Mesh> HLODInstance3D::get_mesh() const {
+	return mesh;
+}
+
+void HLODInstance3D::_mesh_changed() {
+	update_gizmos();
+}
+
+void HLODInstance3D::set_bake_mask(uint32_t p_mask) {
+	bake_mask = p_mask;
+}
+
+uint32_t HLODInstance3D::get_bake_mask() const {
+	return bake_mask;
+}
+
+void HLODInstance3D::set_bake_mask_value(int p_layer_number, bool p_value) {
+	ERR_FAIL_COND_MSG(p_layer_number < 1, "Render layer number must be between 1 and 20 inclusive.");
+	ERR_FAIL_COND_MSG(p_layer_number > 20, "Render layer number must be between 1 and 20 inclusive.");
+	uint32_t mask = get_bake_mask();
+	if (p_value) {
+		mask |= 1 << (p_layer_number - 1);
+	} else {
+		mask &= ~(1 << (p_layer_number - 1));
+	}
+	set_bake_mask(mask);
+}
+
+bool HLODInstance3D::get_bake_mask_value(int p_layer_number) const {
+	ERR_FAIL_COND_V_MSG(p_layer_number < 1, false, "Render layer number must be between 1 and 20 inclusive.");
+	ERR_FAIL_COND_V_MSG(p_layer_number > 20, false, "Render layer number must be between 1 and 20 inclusive.");
+	return bake_mask & (1 << (p_layer_number - 1));
+}
+
+void HLODInstance3D::set_bake_simplification_distance(float p_dist) {
+	bake_simplification_dist = MAX(p_dist, 0.0f);
+}
+
+float HLODInstance3D::get_bake_simplification_distance() const {
+	return bake_simplification_dist;
+}
+
+void HLODInstance3D::set_bake_switch_screen_ratio(float p_ratio) {
+	bake_switch_screen_ratio = CLAMP(p_ratio, 0.01f, 1.0f);
+}
+
+float HLODInstance3D::get_bake_switch_screen_ratio() const {
+	return bake_switch_screen_ratio;
+}
+
+AABB HLODInstance3D::get_aabb() const {
+	if (mesh.is_valid()) {
+		return mesh->get_aabb();
+	}
+
+	return AABB();
+}
+
+PackedStringArray HLODInstance3D::get_configuration_warnings() const {
+	PackedStringArray warnings = GeometryInstance3D::get_configuration_warnings();
+
+	if (mesh.is_null()) {
+		warnings.push_back(RTR("No proxy mesh has been baked yet. Use the Bake HLOD button in the 3D editor toolbar to merge the child meshes into a proxy."));
+	} else if (Math::is_zero_approx(get_visibility_range_begin())) {
+		warnings.push_back(RTR("Visibility Range Begin is 0, so the proxy is always drawn and the meshes it replaces are never shown. Set it to the distance at which the proxy should take over."));
+	}
+
+	return warnings;
+}
+
+void HLODInstance3D::_bake_surface(const Ref<Mesh> &p_mesh, int p_surface, const Transform3D &p_xform, const Ref<Material> &p_material, LocalVector<BakeSurface> &r_surfaces) {
+	if (p_mesh->surface_get_primitive_type(p_surface) != Mesh::PRIMITIVE_TRIANGLES) {
+		return;
+	}
+
+	// Surfaces sharing a material are merged, so the proxy costs one draw per material.
+	BakeSurface *surface = nullptr;
+	for (BakeSurface &E : r_surfaces) {
+		if (E.material == p_material) {
+			surface = &E;
+			break;
+		}
+	}
+	if (!surface) {
+		r_surfaces.push_back(BakeSurface());
+		surface = &r_surfaces[r_surfaces.size() - 1];
+		surface->material = p_material;
+		surface->surface_tool.instantiate();
+	}
+
+	surface->surface_tool->append_from(p_mesh, p_surface, p_xform);
+}
+
+void HLODInstance3D::_bake_node(Node *p_node, LocalVector<BakeSurface> &r_surfaces, LocalVector<Node3D *> &r_sources) {
+	HLODInstance3D *hlod = Object::cast_to<HLODInstance3D>(p_node);
+	if (hlod) {
+		// A nested cluster contributes its own proxy and keeps switching its sources itself.
+		if (hlod->is_visible_in_tree() && hlod->mesh.is_valid() && (hlod->get_layer_mask() & bake_mask)) {
+			Transform3D xform = get_global_transform().affine_inverse() * hlod->get_global_transform();
+			for (int i = 0; i < hlod->mesh->get_surface_count(); i++) {
+				Ref<Material> material = hlod->get_material_override();
+				if (material.is_null()) {
+					material = hlod->mesh->surface_get_material(i);
+				}
+				_bake_surface(hlod->mesh, i, xform, material, r_surfaces);
+			}
+			r_sources.push_back(hlod);
+		}
+		return;
+	}
+
+	MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(p_node);
+	if (mi && mi->is_visible_in_tree()) {
+		Ref<Mesh> source_mesh = mi->get_mesh();
+
+		// Skinned meshes move at runtime, so they can't be baked into a static proxy.
+		bool skinned = mi->get_skin().is_valid();
+		for (int i = 0; source_mesh.is_valid() && i < source_mesh->get_surface_count(); i++) {
+			skinned = skinned || (source_mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_BONES);
+		}
+
+		if (source_mesh.is_valid() && !skinned && (mi->get_layer_mask() & bake_mask)) {
+			Transform3D xform = get_global_transform().affine_inverse() * mi->get_global_transform();
+			for (int i = 0; i < source_mesh->get_surface_count(); i++) {
+				_bake_surface(source_mesh, i, xform, mi->get_active_material(i), r_surfaces);
+			}
+			r_sources.push_back(mi);
+		}
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		if (!child->get_owner()) {
+			continue; // may be a helper
+		}
+
+		_bake_node(child, r_surfaces, r_sources);
+	}
+}
+
+HLODInstance3D::BakeError HLODInstance3D::bake() {
+	ERR_FAIL_COND_V(!is_inside_tree(), BAKE_ERROR_NO_MESHES);
+
+	LocalVector<BakeSurface> surfaces;
+	LocalVector<Node3D *> sources;
+
+	for (int i = 0; i < get_child_count(); i++) {
+		Node *child = get_child(i);
+		if (!child->get_owner()) {
+			continue;
+		}
+
+		_bake_node(child, surfaces, sources);
+	}
+
+	Ref<ArrayMesh> proxy;
+	proxy.instantiate();
+
+	for (BakeSurface &surface : surfaces) {
+		surface.surface_tool->index();
+		Array arrays = surface.surface_tool->commit_to_arrays();
+
+		// Per-vertex custom data and skinning are not needed on a distant proxy.
+		for (int i = Mesh::ARRAY_CUSTOM0; i <= Mesh::ARRAY_WEIGHTS; i++) {
+			arrays[i] = Variant();
+		}
+
+		PackedVector3Array vertices = arrays[Mesh::ARRAY_VERTEX];
+		PackedInt32Array indices = arrays[Mesh::ARRAY_INDEX];
+
+		if (!Math::is_zero_approx(bake_simplification_dist) && SurfaceTool::simplify_func && indices.size() > 3) {
+			Vector<float> vertices_f32 = vector3_to_float32_array(vertices.ptr(), vertices.size());
+
+			float error_scale = SurfaceTool::simplify_scale_func(vertices_f32.ptr(), vertices.size(), sizeof(float) * 3);
+			float target_error = bake_simplification_dist / error_scale;
+			float error = -1.0f;
+
+			uint32_t index_count = SurfaceTool::simplify_func(
+					(unsigned int *)indices.ptrw(),
+					(unsigned int *)indices.ptr(),
+					indices.size(),
+					vertices_f32.ptr(), vertices.size(), sizeof(float) * 3,
+					3, target_error, 0, &error);
+			indices.resize(index_count);
+			arrays[Mesh::ARRAY_INDEX] = indices;
+		}
+
+		if (indices.is_empty()) {
+			continue;
+		}
+
+		proxy->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+		proxy->surface_set_material(proxy->get_surface_count() - 1, surface.material);
+	}
+
+	if (proxy->get_surface_count() == 0) {
+		return BAKE_ERROR_NO_MESHES;
+	}
+
+	set_mesh(proxy);
+
+	// Visibility parents let the scene culler swap the whole cluster with a single range check.
+	for (Node3D *source : sources) {
+		source->set_visibility_parent(source->get_path_to(this));
+	}
+
+	if (Math::is_zero_approx(get_visibility_range_begin())) {
+		// Switch where the cluster covers the requested share of the screen height with a 75 degree FOV.
+		float radius = proxy->get_aabb().size.length() * 0.5;
+		set_visibility_range_begin(radius / (bake_switch_screen_ratio * Math::tan(Math::deg_to_rad(75.0 * 0.5))));
+	}
+
+	update_configuration_warnings();
+
+	return BAKE_ERROR_OK;
+}
+
+void HLODInstance3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_mesh", "mesh"), &HLODInstance3D::set_mesh);
+	ClassDB::bind_method(D_METHOD("get_mesh"), &HLODInstance3D::get_mesh);
+
+	ClassDB::bind_method(D_METHOD("set_bake_mask", "mask"), &HLODInstance3D::set_bake_mask);
+	ClassDB::bind_method(D_METHOD("get_bake_mask"), &HLODInstance3D::get_bake_mask);
+	ClassDB::bind_method(D_METHOD("set_bake_mask_value", "layer_number", "value"), &HLODInstance3D::set_bake_mask_value);
+	ClassDB::bind_method(D_METHOD("get_bake_mask_value", "layer_number"), &HLODInstance3D::get_bake_mask_value);
+	ClassDB::bind_method(D_METHOD("set_bake_simplification_distance", "simplification_distance"), &HLODInstance3D::set_bake_simplification_distance);
+	ClassDB::bind_method(D_METHOD("get_bake_simplification_distance"), &HLODInstance3D::get_bake_simplification_distance);
+	ClassDB::bind_method(D_METHOD("set_bake_switch_screen_ratio", "ratio"), &HLODInstance3D::set_bake_switch_screen_ratio);
+	ClassDB::bind_method(D_METHOD("get_bake_switch_screen_ratio"), &HLODInstance3D::get_bake_switch_screen_ratio);
+
+	ClassDB::bind_method(D_METHOD("bake"), &HLODInstance3D::bake);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh", PROPERTY_HINT_RESOURCE_TYPE, "Mesh"), "set_mesh", "get_mesh");
+	ADD_GROUP("Bake", "bake_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bake_mask", PROPERTY_HINT_LAYERS_3D_RENDER), "set_bake_mask", "get_bake_mask");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bake_simplification_distance", PROPERTY_HINT_RANGE, "0.0,2.0,0.01,or_greater,suffix:m"), "set_bake_simplification_distance", "get_bake_simplification_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bake_switch_screen_ratio", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"), "set_bake_switch_screen_ratio", "get_bake_switch_screen_ratio");
+
+	BIND_ENUM_CONSTANT(BAKE_ERROR_OK);
+	BIND_ENUM_CONSTANT(BAKE_ERROR_NO_MESHES);
+}
+
+HLODInstance3D::HLODInstance3D() {
+}
+
+HLODInstance3D::~HLODInstance3D() {
+}
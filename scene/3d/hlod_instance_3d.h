@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  hlod_instance_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HLOD_INSTANCE_3D_H
+#define HLOD_INSTANCE_3D_H
+
+#include "scene/3d/visual_instance_3d.h"
+
+class SurfaceTool;
+
+class HLODInstance3D : public GeometryInstance3D {
+	GDCLASS(HLODInstance3D, GeometryInstance3D);
+
+	Ref<Mesh> mesh;
+	uint32_t bake_mask = 0xFFFFFFFF;
+	float bake_simplification_dist = 0.1f;
+	float bake_switch_screen_ratio = 0.25f;
+
+	struct BakeSurface {
+		Ref<Material> material;
+		Ref<SurfaceTool> surface_tool;
+	};
+
+	void _mesh_changed();
+	static void _bake_surface(const Ref<Mesh> &p_mesh, int p_surface, const Transform3D &p_xform, const Ref<Material> &p_material, LocalVector<BakeSurface> &r_surfaces);
+	void _bake_node(Node *p_node, LocalVector<BakeSurface> &r_surfaces, LocalVector<Node3D *> &r_sources);
+
+protected:
+	static void _bind_methods();
+
+public:
+	enum BakeError {
+		BAKE_ERROR_OK,
+		BAKE_ERROR_NO_MESHES,
+	};
+
+	void set_mesh(const Ref<Mesh> &p_mesh);
+	Ref<Mesh> get_mesh() const;
+
+	void set_bake_mask(uint32_t p_mask);
+	uint32_t get_bake_mask() const;
+
+	void set_bake_mask_value(int p_layer_number, bool p_enable);
+	bool get_bake_mask_value(int p_layer_number) const;
+
+	void set_bake_simplification_distance(float p_dist);
+	float get_bake_simplification_distance() const;
+
+	void set_bake_switch_screen_ratio(float p_ratio);
+	float get_bake_switch_screen_ratio() const;
+
+	virtual AABB get_aabb() const override;
+	virtual PackedStringArray get_configuration_warnings() const override;
+
+	BakeError bake();
+
+	HLODInstance3D();
+	~HLODInstance3D();
+};
+
+VARIANT_ENUM_CAST(HLODInstance3D::BakeError);
+
+#endif // HLOD_INSTANCE_3D_H
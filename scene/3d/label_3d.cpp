@@ -30,6 +30,7 @@
 
 #include "label_3d.h"
 
+#include "core/config/project_settings.h"
 #include "scene/main/viewport.h"
 #include "scene/resources/theme.h"
 #include "scene/theme/theme_db.h"
@@ -360,23 +361,6 @@ void Label3D::_generate_glyph_surfaces(const Glyph &p_glyph, Vector2 &r_offset,
 		SurfaceKey key = SurfaceKey(tex.get_id(), p_priority, p_outline_size);
 		if (!surfaces.has(key)) {
 			SurfaceData surf;
-			surf.material = RenderingServer::get_singleton()->material_create();
-			// Set defaults for material, names need to match up those in StandardMaterial3D
-			RS::get_singleton()->material_set_param(surf.material, "albedo", Color(1, 1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "specular", 0.5);
-			RS::get_singleton()->material_set_param(surf.material, "metallic", 0.0);
-			RS::get_singleton()->material_set_param(surf.material, "roughness", 1.0);
-			RS::get_singleton()->material_set_param(surf.material, "uv1_offset", Vector3(0, 0, 0));
-			RS::get_singleton()->material_set_param(surf.material, "uv1_scale", Vector3(1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "uv2_offset", Vector3(0, 0, 0));
-			RS::get_singleton()->material_set_param(surf.material, "uv2_scale", Vector3(1, 1, 1));
-			RS::get_singleton()->material_set_param(surf.material, "alpha_scissor_threshold", alpha_scissor_threshold);
-			RS::get_singleton()->material_set_param(surf.material, "alpha_hash_scale", alpha_hash_scale);
-			RS::get_singleton()->material_set_param(surf.material, "alpha_antialiasing_edge", alpha_antialiasing_edge);
-			if (msdf) {
-				RS::get_singleton()->material_set_param(surf.material, "msdf_pixel_range", TS->font_get_msdf_pixel_range(p_glyph.font_rid));
-				RS::get_singleton()->material_set_param(surf.material, "msdf_outline_size", p_outline_size);
-			}
 
 			BaseMaterial3D::Transparency mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA;
 			if (get_alpha_cut_mode() == ALPHA_CUT_DISCARD) {
@@ -390,11 +374,46 @@ void Label3D::_generate_glyph_surfaces(const Glyph &p_glyph, Vector2 &r_offset,
 			RID shader_rid;
 			StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), mat_transparency, get_draw_flag(FLAG_DOUBLE_SIDED), get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, msdf, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), texture_filter, alpha_antialiasing_mode, &shader_rid);
 
-			RS::get_singleton()->material_set_shader(surf.material, shader_rid);
-			RS::get_singleton()->material_set_param(surf.material, "texture_albedo", tex);
-			if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
-				RS::get_singleton()->material_set_render_priority(surf.material, p_priority);
+			if (share_materials) {
+				surf.material_params.shader = shader_rid;
+				surf.material_params.texture = tex;
+				surf.material_params.alpha_scissor_threshold = alpha_scissor_threshold;
+				surf.material_params.alpha_hash_scale = alpha_hash_scale;
+				surf.material_params.alpha_antialiasing_edge = alpha_antialiasing_edge;
+				if (msdf) {
+					surf.material_params.msdf_pixel_range = TS->font_get_msdf_pixel_range(p_glyph.font_rid);
+					surf.material_params.msdf_outline_size = p_outline_size;
+				}
+				if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
+					surf.material_params.render_priority = p_priority;
+				}
+				surf.material = BaseMaterial3D::acquire_shared_material_for_2d(surf.material_params);
 			} else {
+				surf.material = RenderingServer::get_singleton()->material_create();
+				// Set defaults for material, names need to match up those in StandardMaterial3D
+				RS::get_singleton()->material_set_param(surf.material, "albedo", Color(1, 1, 1, 1));
+				RS::get_singleton()->material_set_param(surf.material, "specular", 0.5);
+				RS::get_singleton()->material_set_param(surf.material, "metallic", 0.0);
+				RS::get_singleton()->material_set_param(surf.material, "roughness", 1.0);
+				RS::get_singleton()->material_set_param(surf.material, "uv1_offset", Vector3(0, 0, 0));
+				RS::get_singleton()->material_set_param(surf.material, "uv1_scale", Vector3(1, 1, 1));
+				RS::get_singleton()->material_set_param(surf.material, "uv2_offset", Vector3(0, 0, 0));
+				RS::get_singleton()->material_set_param(surf.material, "uv2_scale", Vector3(1, 1, 1));
+				RS::get_singleton()->material_set_param(surf.material, "alpha_scissor_threshold", alpha_scissor_threshold);
+				RS::get_singleton()->material_set_param(surf.material, "alpha_hash_scale", alpha_hash_scale);
+				RS::get_singleton()->material_set_param(surf.material, "alpha_antialiasing_edge", alpha_antialiasing_edge);
+				if (msdf) {
+					RS::get_singleton()->material_set_param(surf.material, "msdf_pixel_range", TS->font_get_msdf_pixel_range(p_glyph.font_rid));
+					RS::get_singleton()->material_set_param(surf.material, "msdf_outline_size", p_outline_size);
+				}
+
+				RS::get_singleton()->material_set_shader(surf.material, shader_rid);
+				RS::get_singleton()->material_set_param(surf.material, "texture_albedo", tex);
+				if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
+					RS::get_singleton()->material_set_render_priority(surf.material, p_priority);
+				}
+			}
+			if (get_alpha_cut_mode() != ALPHA_CUT_DISABLED) {
 				surf.z_shift = p_priority * pixel_size;
 			}
 
@@ -443,6 +462,16 @@ void Label3D::_generate_glyph_surfaces(const Glyph &p_glyph, Vector2 &r_offset,
 	}
 }
 
+void Label3D::_free_surface_materials() {
+	for (const KeyValue<SurfaceKey, SurfaceData> &E : surfaces) {
+		if (share_materials) {
+			BaseMaterial3D::release_shared_material_for_2d(E.value.material_params);
+		} else {
+			RenderingServer::get_singleton()->free(E.value.material);
+		}
+	}
+}
+
 void Label3D::_shape() {
 	// When a shaped text is invalidated by an external source, we want to reshape it.
 	if (!TS->shaped_text_is_ready(text_rid)) {
@@ -461,9 +490,7 @@ void Label3D::_shape() {
 	aabb = AABB();
 
 	// Clear materials.
-	for (const KeyValue<SurfaceKey, SurfaceData> &E : surfaces) {
-		RenderingServer::get_singleton()->free(E.value.material);
-	}
+	_free_surface_materials();
 	surfaces.clear();
 
 	Ref<Font> font = _get_font_or_default();
@@ -1048,6 +1075,7 @@ Label3D::Label3D() {
 	text_rid = TS->create_shaped_text();
 
 	mesh = RenderingServer::get_singleton()->mesh_create();
+	share_materials = GLOBAL_GET("rendering/3d/batching/sprites");
 
 	// Disable shadow casting by default to improve performance and avoid unintended visual artifacts.
 	set_cast_shadows_setting(SHADOW_CASTING_SETTING_OFF);
@@ -1068,8 +1096,6 @@ Label3D::~Label3D() {
 
 	ERR_FAIL_NULL(RenderingServer::get_singleton());
 	RenderingServer::get_singleton()->free(mesh);
-	for (KeyValue<SurfaceKey, SurfaceData> E : surfaces) {
-		RenderingServer::get_singleton()->free(E.value.material);
-	}
+	_free_surface_materials();
 	surfaces.clear();
 }
@@ -79,6 +79,8 @@ private:
 		int offset = 0;
 		float z_shift = 0.0;
 		RID material;
+		// Only used when the material is shared with other labels.
+		BaseMaterial3D::Material2DParams material_params;
 	};
 
 	struct SurfaceKey {
@@ -104,6 +106,9 @@ private:
 	};
 
 	HashMap<SurfaceKey, SurfaceData, SurfaceKeyHasher> surfaces;
+	// Labels with equal font textures and material settings share their materials when 3D batching is enabled.
+	bool share_materials = false;
+	void _free_surface_materials();
 
 	HorizontalAlignment horizontal_alignment = HORIZONTAL_ALIGNMENT_CENTER;
 	VerticalAlignment vertical_alignment = VERTICAL_ALIGNMENT_CENTER;
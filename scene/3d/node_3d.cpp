@@ -107,25 +107,60 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// Moving a node repeatedly (or a parent after its children) within a frame would otherwise walk the same subtrees
+	// over and over. A child fully propagated since the last flush is still dirty and queued as a whole, unless a global
+	// transform below it was read back in between, which clears the dirty bit of the child too.
+	const uint64_t epoch = get_tree()->xform_change_epoch;
+	bool complete = true;
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		if (E->data.xform_propagated_epoch != epoch || !E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			E->_propagate_transform_changed(p_origin);
+		}
+		complete = complete && E->data.xform_propagated_epoch == epoch;
 	}
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !xform_change.in_list()) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform && !xform_change.in_list()) {
 #endif
-		if (likely(is_accessible_from_caller_thread())) {
+		if (data.ignore_notification) {
+			// Not queued this time, so it must be visited again if the transform changes once more.
+			complete = false;
+		} else if (likely(is_accessible_from_caller_thread())) {
 			get_tree()->xform_change_list.add(&xform_change);
 		} else {
 			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+			complete = false;
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	data.xform_propagated_epoch = complete ? epoch : 0;
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	if (!is_inside_tree()) {
+		return;
+	}
+
+	// Ancestors fully propagated in this frame assume the whole subtree is queued, which no longer holds.
+	// An ancestor not marked for this frame can't have marked ancestors either, so the walk stops there.
+	const uint64_t epoch = get_tree()->xform_change_epoch;
+	Node3D *n = this;
+	while (n) {
+		n->data.xform_propagated_epoch = 0;
+		if (n->data.top_level) {
+			break;
+		}
+		n = n->data.parent;
+		if (n && n->data.xform_propagated_epoch != epoch) {
+			break;
+		}
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -158,6 +193,7 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			_invalidate_transform_propagation();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -170,6 +206,7 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			data.xform_propagated_epoch = 0;
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
 			}
@@ -611,6 +648,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -750,6 +788,9 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	if (!p_enabled) {
+		_invalidate_transform_propagation();
+	}
 }
 
 void Node3D::set_as_top_level_keep_local(bool p_enabled) {
@@ -758,6 +799,9 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 		return;
 	}
 	data.top_level = p_enabled;
+	if (!p_enabled) {
+		_invalidate_transform_propagation();
+	}
 	_propagate_transform_changed(this);
 }
 
@@ -967,6 +1011,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	if (p_enabled) {
+		_invalidate_transform_propagation();
+	}
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -110,6 +110,9 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		// SceneTree::xform_change_epoch at which this subtree was fully marked dirty and queued for notification.
+		uint64_t xform_propagated_epoch = 0;
+
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
 		bool notify_transform = false;
@@ -137,6 +140,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
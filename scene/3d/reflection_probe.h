@@ -40,6 +40,7 @@ public:
 	enum UpdateMode {
 		UPDATE_ONCE,
 		UPDATE_ALWAYS,
+		UPDATE_TIME_SLICED,
 	};
 
 	enum AmbientMode {
@@ -394,10 +394,24 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				thread_local LocalVector<uint32_t> bound_indices;
+				thread_local LocalVector<Transform3D> bound_poses;
+				thread_local LocalVector<Transform3D> bind_poses;
+				bound_indices.clear();
+				bound_poses.clear();
+				bind_poses.clear();
+
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					bound_indices.push_back(i);
+					bound_poses.push_back(bonesptr[bone_index].global_pose);
+					bind_poses.push_back(skin->get_bind_pose(i));
+				}
+
+				Transform3D::mul_batch(bound_poses.ptr(), bind_poses.ptr(), bound_poses.ptr(), bound_poses.size());
+				for (uint32_t i = 0; i < bound_indices.size(); i++) {
+					rs->skeleton_bone_set_transform(skeleton, bound_indices[i], bound_poses[i]);
 				}
 			}
 
@@ -672,7 +686,7 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform3D &p_pose) {
 	bones.write[p_bone].pose_scale = p_pose.basis.get_scale();
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_pose_dirty(p_bone);
 	}
 }
 
@@ -683,7 +697,7 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 	bones.write[p_bone].pose_position = p_position;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_pose_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
@@ -693,7 +707,7 @@ void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation
 	bones.write[p_bone].pose_rotation = p_rotation;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_pose_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
@@ -703,7 +717,7 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	bones.write[p_bone].pose_scale = p_scale;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_pose_dirty(p_bone);
 	}
 }
 
@@ -747,6 +761,20 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	all_bones_dirty = true;
+	if (dirty) {
+		return;
+	}
+	dirty = true;
+	_update_deferred();
+}
+
+void Skeleton3D::_make_bone_pose_dirty(int p_bone) {
+	Bone &b = bones.write[p_bone];
+	if (!b.global_pose_dirty) {
+		b.global_pose_dirty = true;
+		dirty_pose_bones.push_back(p_bone);
+	}
 	if (dirty) {
 		return;
 	}
@@ -857,7 +885,32 @@ void Skeleton3D::force_update_all_dirty_bones() {
 	if (!dirty) {
 		return;
 	}
-	force_update_all_bone_transforms();
+	if (all_bones_dirty || rest_dirty || process_order_dirty) {
+		force_update_all_bone_transforms();
+		return;
+	}
+
+	// Only the bones posed since the last update changed, so recompute their subtrees from the parents' global poses.
+	// Modifiers reading global poses in between setting bone poses (e.g. IK) only pay for what they touched.
+	Bone *bonesptr = bones.ptrw();
+	for (const int &bone : dirty_pose_bones) {
+		bool covered = false;
+		for (int parent = bonesptr[bone].parent; parent >= 0; parent = bonesptr[parent].parent) {
+			if (bonesptr[parent].global_pose_dirty) {
+				covered = true; // Recomputed with the subtree of that ancestor.
+				break;
+			}
+		}
+		if (!covered) {
+			force_update_bone_children_transforms(bone);
+		}
+	}
+	_clear_dirty_pose_bones();
+	dirty = false;
+	if (updating) {
+		return;
+	}
+	emit_signal(SceneStringName(pose_updated));
 }
 
 void Skeleton3D::force_update_all_bone_transforms() {
@@ -865,6 +918,8 @@ void Skeleton3D::force_update_all_bone_transforms() {
 	for (int i = 0; i < parentless_bones.size(); i++) {
 		force_update_bone_children_transforms(parentless_bones[i]);
 	}
+	_clear_dirty_pose_bones();
+	all_bones_dirty = false;
 	rest_dirty = false;
 	dirty = false;
 	if (updating) {
@@ -873,6 +928,27 @@ void Skeleton3D::force_update_all_bone_transforms() {
 	emit_signal(SceneStringName(pose_updated));
 }
 
+void Skeleton3D::_clear_dirty_pose_bones() {
+	Bone *bonesptr = bones.ptrw();
+	for (const int &bone : dirty_pose_bones) {
+		if (bone < bones.size()) {
+			bonesptr[bone].global_pose_dirty = false;
+		}
+	}
+	dirty_pose_bones.clear();
+
+#ifndef DISABLE_DEPRECATED
+	// The override of these was applied once, their subtrees must drop it on the next update.
+	for (const int &bone : override_reset_bones) {
+		if (bone < bones.size() && !bonesptr[bone].global_pose_dirty) {
+			bonesptr[bone].global_pose_dirty = true;
+			dirty_pose_bones.push_back(bone);
+		}
+	}
+	override_reset_bones.clear();
+#endif // _DISABLE_DEPRECATED
+}
+
 void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
@@ -928,6 +1004,9 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 			b.global_pose = b.global_pose.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
 		}
 		if (b.global_pose_override_reset) {
+			if (b.global_pose_override_amount != 0.0) {
+				override_reset_bones.push_back(current_bone_idx);
+			}
 			b.global_pose_override_amount = 0.0;
 		}
 #endif // _DISABLE_DEPRECATED
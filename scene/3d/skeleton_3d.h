@@ -102,6 +102,7 @@ private:
 
 		bool enabled = true;
 		bool pose_cache_dirty = true;
+		bool global_pose_dirty = false; // Posed since the last update, so the global poses of its subtree are stale.
 		Transform3D pose_cache;
 		Vector3 pose_position;
 		Quaternion pose_rotation;
@@ -161,8 +162,15 @@ private:
 	void _update_bone_names() const;
 
 	void _make_dirty();
+	void _make_bone_pose_dirty(int p_bone);
 	bool dirty = false;
 	bool rest_dirty = false;
+	bool all_bones_dirty = false;
+	LocalVector<int> dirty_pose_bones;
+#ifndef DISABLE_DEPRECATED
+	LocalVector<int> override_reset_bones;
+#endif // _DISABLE_DEPRECATED
+	void _clear_dirty_pose_bones();
 
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
@@ -89,13 +89,22 @@ void SoftBodyRenderingServerHandler::set_vertex(int p_vertex_id, const Vector3 &
 }
 
 void SoftBodyRenderingServerHandler::set_normal(int p_vertex_id, const Vector3 &p_normal) {
-	Vector2 res = p_normal.octahedron_encode();
-	uint32_t value = 0;
-	value |= (uint16_t)CLAMP(res.x * 65535, 0, 65535);
-	value |= (uint16_t)CLAMP(res.y * 65535, 0, 65535) << 16;
+	uint32_t value = encode_normal(p_normal);
 	memcpy(&write_buffer[p_vertex_id * normal_stride + offset_normal], &value, sizeof(uint32_t));
 }
 
+bool SoftBodyRenderingServerHandler::get_vertex_buffer(uint8_t *&r_buffer, uint32_t &r_vertex_stride, uint32_t &r_vertex_offset, uint32_t &r_normal_stride, uint32_t &r_normal_offset) {
+	if (!write_buffer) {
+		return false;
+	}
+	r_buffer = write_buffer;
+	r_vertex_stride = stride;
+	r_vertex_offset = offset_vertices;
+	r_normal_stride = normal_stride;
+	r_normal_offset = offset_normal;
+	return true;
+}
+
 void SoftBodyRenderingServerHandler::set_aabb(const AABB &p_aabb) {
 	RS::get_singleton()->mesh_set_custom_aabb(mesh, p_aabb);
 }
@@ -63,6 +63,7 @@ public:
 	void set_vertex(int p_vertex_id, const Vector3 &p_vertex) override;
 	void set_normal(int p_vertex_id, const Vector3 &p_normal) override;
 	void set_aabb(const AABB &p_aabb) override;
+	bool get_vertex_buffer(uint8_t *&r_buffer, uint32_t &r_vertex_stride, uint32_t &r_vertex_offset, uint32_t &r_normal_stride, uint32_t &r_normal_offset) override;
 };
 
 class SoftBody3D : public MeshInstance3D {
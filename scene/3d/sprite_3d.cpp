@@ -30,6 +30,7 @@
 
 #include "sprite_3d.h"
 
+#include "core/config/project_settings.h"
 #include "scene/resources/atlas_texture.h"
 
 Color SpriteBase3D::_get_color_accum() {
@@ -184,6 +185,47 @@ void SpriteBase3D::draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect,
 	}
 
 	AABB aabb_new;
+	for (int i = 0; i < 4; i++) {
+		Vector3 vtx;
+		vtx[x_axis] = vertices[i][0];
+		vtx[y_axis] = vertices[i][1];
+		if (i == 0) {
+			aabb_new.position = vtx;
+			aabb_new.size = Vector3();
+		} else {
+			aabb_new.expand_to(vtx);
+		}
+	}
+
+	BaseMaterial3D::Transparency mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_DISABLED;
+	if (get_draw_flag(FLAG_TRANSPARENT)) {
+		if (get_alpha_cut_mode() == ALPHA_CUT_DISCARD) {
+			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_SCISSOR;
+		} else if (get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS) {
+			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_DEPTH_PRE_PASS;
+		} else if (get_alpha_cut_mode() == ALPHA_CUT_HASH) {
+			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_HASH;
+		} else {
+			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA;
+		}
+	}
+
+	RID shader_rid;
+	StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), mat_transparency, get_draw_flag(FLAG_DOUBLE_SIDED), get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, false, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), get_texture_filter(), alpha_antialiasing_mode, &shader_rid, batched);
+
+	if (batched) {
+		// The shared quad goes from (0, 0) to (1, 1) in the plane of the axis, vertex 3 being the origin and vertex 1 the opposite corner.
+		Vector3 rect_offset;
+		Vector3 rect_scale(1, 1, 1);
+		rect_offset[x_axis] = vertices[3].x;
+		rect_offset[y_axis] = vertices[3].y;
+		rect_scale[x_axis] = vertices[1].x - vertices[3].x;
+		rect_scale[y_axis] = vertices[1].y - vertices[3].y;
+		Vector4 uv_rect(uvs[0].x, uvs[0].y, uvs[2].x - uvs[0].x, uvs[2].y - uvs[0].y);
+
+		_batch_draw_texture_rect(p_texture, shader_rid, rect_offset, rect_scale, uv_rect, color, aabb_new);
+		return;
+	}
 
 	// Everything except position and UV is compressed.
 	uint8_t *vertex_write_buffer = vertex_buffer.ptrw();
@@ -225,12 +267,6 @@ void SpriteBase3D::draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect,
 		Vector3 vtx;
 		vtx[x_axis] = vertices[i][0];
 		vtx[y_axis] = vertices[i][1];
-		if (i == 0) {
-			aabb_new.position = vtx;
-			aabb_new.size = Vector3();
-		} else {
-			aabb_new.expand_to(vtx);
-		}
 
 		float v_uv[2] = { (float)uvs[i].x, (float)uvs[i].y };
 		memcpy(&attribute_write_buffer[i * attrib_stride + mesh_surface_offsets[RS::ARRAY_TEX_UV]], v_uv, 8);
@@ -254,22 +290,6 @@ void SpriteBase3D::draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect,
 	RS::get_singleton()->material_set_param(get_material(), "alpha_hash_scale", alpha_hash_scale);
 	RS::get_singleton()->material_set_param(get_material(), "alpha_antialiasing_edge", alpha_antialiasing_edge);
 
-	BaseMaterial3D::Transparency mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_DISABLED;
-	if (get_draw_flag(FLAG_TRANSPARENT)) {
-		if (get_alpha_cut_mode() == ALPHA_CUT_DISCARD) {
-			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_SCISSOR;
-		} else if (get_alpha_cut_mode() == ALPHA_CUT_OPAQUE_PREPASS) {
-			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_DEPTH_PRE_PASS;
-		} else if (get_alpha_cut_mode() == ALPHA_CUT_HASH) {
-			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA_HASH;
-		} else {
-			mat_transparency = BaseMaterial3D::Transparency::TRANSPARENCY_ALPHA;
-		}
-	}
-
-	RID shader_rid;
-	StandardMaterial3D::get_material_for_2d(get_draw_flag(FLAG_SHADED), mat_transparency, get_draw_flag(FLAG_DOUBLE_SIDED), get_billboard_mode() == StandardMaterial3D::BILLBOARD_ENABLED, get_billboard_mode() == StandardMaterial3D::BILLBOARD_FIXED_Y, false, get_draw_flag(FLAG_DISABLE_DEPTH_TEST), get_draw_flag(FLAG_FIXED_SIZE), get_texture_filter(), alpha_antialiasing_mode, &shader_rid);
-
 	if (last_shader != shader_rid) {
 		RS::get_singleton()->material_set_shader(get_material(), shader_rid);
 		last_shader = shader_rid;
@@ -674,11 +694,113 @@ void SpriteBase3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(ALPHA_CUT_HASH);
 }
 
+Mutex SpriteBase3D::batch_mutex;
+RID SpriteBase3D::batch_quads[3];
+int SpriteBase3D::batch_quad_users = 0;
+
+void SpriteBase3D::_batch_create_quads() {
+	// Vertices and UVs in the same order as draw_texture_rect(), the instance uniforms place them.
+	static const Vector2 corners[4] = { Vector2(0, 1), Vector2(1, 1), Vector2(1, 0), Vector2(0, 0) };
+	static const Vector2 corner_uvs[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+
+	for (int ax = 0; ax < 3; ax++) {
+		int x_axis = ((ax + 1) % 3);
+		int y_axis = ((ax + 2) % 3);
+		if (ax != Vector3::AXIS_Z) {
+			SWAP(x_axis, y_axis);
+		}
+
+		Vector3 normal;
+		normal[ax] = 1.0;
+		Plane tangent = ax == Vector3::AXIS_X ? Plane(0, 0, -1, 1) : Plane(1, 0, 0, 1);
+
+		PackedVector3Array mesh_vertices;
+		PackedVector3Array mesh_normals;
+		PackedFloat32Array mesh_tangents;
+		PackedColorArray mesh_colors;
+		PackedVector2Array mesh_uvs;
+		PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+
+		for (int i = 0; i < 4; i++) {
+			Vector3 vtx;
+			vtx[x_axis] = corners[i].x;
+			vtx[y_axis] = corners[i].y;
+			mesh_vertices.push_back(vtx);
+			mesh_normals.push_back(normal);
+			mesh_tangents.push_back(tangent.normal.x);
+			mesh_tangents.push_back(tangent.normal.y);
+			mesh_tangents.push_back(tangent.normal.z);
+			mesh_tangents.push_back(tangent.d);
+			mesh_colors.push_back(Color(1.0, 1.0, 1.0, 1.0));
+			mesh_uvs.push_back(corner_uvs[i]);
+		}
+
+		Array mesh_array;
+		mesh_array.resize(RS::ARRAY_MAX);
+		mesh_array[RS::ARRAY_VERTEX] = mesh_vertices;
+		mesh_array[RS::ARRAY_NORMAL] = mesh_normals;
+		mesh_array[RS::ARRAY_TANGENT] = mesh_tangents;
+		mesh_array[RS::ARRAY_COLOR] = mesh_colors;
+		mesh_array[RS::ARRAY_TEX_UV] = mesh_uvs;
+		mesh_array[RS::ARRAY_INDEX] = indices;
+
+		batch_quads[ax] = RS::get_singleton()->mesh_create();
+		RS::get_singleton()->mesh_add_surface_from_arrays(batch_quads[ax], RS::PRIMITIVE_TRIANGLES, mesh_array);
+	}
+}
+
+void SpriteBase3D::_batch_draw_texture_rect(const Ref<Texture2D> &p_texture, RID p_shader, const Vector3 &p_rect_offset, const Vector3 &p_rect_scale, const Vector4 &p_uv_rect, const Color &p_color, const AABB &p_aabb) {
+	BaseMaterial3D::Material2DParams params;
+	params.shader = p_shader;
+	params.texture = p_texture->get_rid();
+	params.alpha_scissor_threshold = alpha_scissor_threshold;
+	params.alpha_hash_scale = alpha_hash_scale;
+	params.alpha_antialiasing_edge = alpha_antialiasing_edge;
+	if (get_alpha_cut_mode() == ALPHA_CUT_DISABLED) {
+		params.render_priority = get_render_priority();
+	}
+
+	if (!batch_material_valid || !(params == batch_material_params)) {
+		RID new_material = BaseMaterial3D::acquire_shared_material_for_2d(params);
+		if (batch_material_valid) {
+			BaseMaterial3D::release_shared_material_for_2d(batch_material_params);
+		}
+		batch_material = new_material;
+		batch_material_params = params;
+		batch_material_valid = true;
+	}
+
+	RID instance = get_instance();
+	// The base may have changed with the axis, which resets the override.
+	RS::get_singleton()->instance_set_surface_override_material(instance, 0, batch_material);
+
+	RS::get_singleton()->instance_geometry_set_shader_parameter(instance, SNAME("sprite_rect_offset"), p_rect_offset);
+	RS::get_singleton()->instance_geometry_set_shader_parameter(instance, SNAME("sprite_rect_scale"), p_rect_scale);
+	RS::get_singleton()->instance_geometry_set_shader_parameter(instance, SNAME("sprite_uv_rect"), p_uv_rect);
+	// Passed as a vector so it reaches the shader unconverted, like vertex colors.
+	RS::get_singleton()->instance_geometry_set_shader_parameter(instance, SNAME("sprite_modulate"), Vector4(p_color.r, p_color.g, p_color.b, p_color.a));
+
+	// The shared quad is a unit square, the actual bounds are given to the instance.
+	RS::get_singleton()->instance_set_custom_aabb(instance, get_custom_aabb() != AABB() ? get_custom_aabb() : p_aabb);
+	set_aabb(p_aabb);
+}
+
 SpriteBase3D::SpriteBase3D() {
 	for (int i = 0; i < FLAG_MAX; i++) {
 		flags[i] = i == FLAG_TRANSPARENT || i == FLAG_DOUBLE_SIDED;
 	}
 
+	batched = GLOBAL_GET("rendering/3d/batching/sprites");
+	if (batched) {
+		MutexLock lock(batch_mutex);
+		if (batch_quad_users == 0) {
+			_batch_create_quads();
+		}
+		batch_quad_users++;
+		set_base(batch_quads[axis]);
+		return;
+	}
+
 	material = RenderingServer::get_singleton()->material_create();
 	// Set defaults for material, names need to match up those in StandardMaterial3D.
 	RS::get_singleton()->material_set_param(material, "albedo", Color(1, 1, 1, 1));
@@ -750,6 +872,21 @@ SpriteBase3D::SpriteBase3D() {
 
 SpriteBase3D::~SpriteBase3D() {
 	ERR_FAIL_NULL(RenderingServer::get_singleton());
+	if (batched) {
+		if (batch_material_valid) {
+			BaseMaterial3D::release_shared_material_for_2d(batch_material_params);
+		}
+
+		MutexLock lock(batch_mutex);
+		batch_quad_users--;
+		if (batch_quad_users == 0) {
+			for (RID &quad : batch_quads) {
+				RenderingServer::get_singleton()->free(quad);
+				quad = RID();
+			}
+		}
+		return;
+	}
 	RenderingServer::get_singleton()->free(mesh);
 	RenderingServer::get_singleton()->free(material);
 }
@@ -85,6 +85,19 @@ private:
 	RID last_shader;
 	RID last_texture;
 
+	// Batched sprites draw a quad shared by all of them and share their material, so the renderer can instance them.
+	static Mutex batch_mutex;
+	static RID batch_quads[3];
+	static int batch_quad_users;
+
+	bool batched = false;
+	bool batch_material_valid = false;
+	RID batch_material;
+	BaseMaterial3D::Material2DParams batch_material_params;
+
+	static void _batch_create_quads();
+	void _batch_draw_texture_rect(const Ref<Texture2D> &p_texture, RID p_shader, const Vector3 &p_rect_offset, const Vector3 &p_rect_scale, const Vector4 &p_uv_rect, const Color &p_color, const AABB &p_aabb);
+
 	bool flags[FLAG_MAX] = {};
 	AlphaCutMode alpha_cut = ALPHA_CUT_DISABLED;
 	float alpha_scissor_threshold = 0.5;
@@ -105,7 +118,7 @@ protected:
 	virtual void _draw() = 0;
 	void draw_texture_rect(Ref<Texture2D> p_texture, Rect2 p_dst_rect, Rect2 p_src_rect);
 	_FORCE_INLINE_ void set_aabb(const AABB &p_aabb) { aabb = p_aabb; }
-	_FORCE_INLINE_ RID &get_mesh() { return mesh; }
+	_FORCE_INLINE_ RID get_mesh() const { return batched ? batch_quads[axis] : mesh; }
 	_FORCE_INLINE_ RID &get_material() { return material; }
 
 	uint32_t mesh_surface_offsets[RS::ARRAY_MAX];
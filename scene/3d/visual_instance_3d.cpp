@@ -50,6 +50,12 @@ void VisualInstance3D::_notification(int p_what) {
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
 			_update_visibility();
+
+			// As in CanvasItem, reset for this node only when entering, so it doesn't
+			// interpolate from wherever the instance was last placed.
+			if (is_physics_interpolated_and_enabled()) {
+				notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+			}
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
@@ -65,9 +71,22 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			_update_visibility();
 		} break;
+
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			if (is_visible_in_tree() && is_physics_interpolated()) {
+				// Transform notifications are deferred, make sure the RenderingServer
+				// has the current transform before resetting.
+				RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+			}
+		} break;
 	}
 }
 
+void VisualInstance3D::_physics_interpolated_changed() {
+	RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
+}
+
 RID VisualInstance3D::get_instance() const {
 	return instance;
 }
@@ -45,6 +45,8 @@ class VisualInstance3D : public Node3D {
 protected:
 	void _update_visibility();
 
+	virtual void _physics_interpolated_changed() override;
+
 	void _notification(int p_what);
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
@@ -31,6 +31,7 @@
 #include "voxelizer.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
@@ -72,7 +73,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void Voxelizer::_plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
 	if (p_level == cell_subdiv) {
 		//plot the face by guessing its albedo and emission value
 
@@ -219,16 +220,16 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 		}
 
 		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		r_cells.write[p_idx].albedo[0] += albedo_accum.r;
+		r_cells.write[p_idx].albedo[1] += albedo_accum.g;
+		r_cells.write[p_idx].albedo[2] += albedo_accum.b;
+		r_cells.write[p_idx].emission[0] += emission_accum.r;
+		r_cells.write[p_idx].emission[1] += emission_accum.g;
+		r_cells.write[p_idx].emission[2] += emission_accum.b;
+		r_cells.write[p_idx].normal[0] += normal_accum.x;
+		r_cells.write[p_idx].normal[1] += normal_accum.y;
+		r_cells.write[p_idx].normal[2] += normal_accum.z;
+		r_cells.write[p_idx].alpha += alpha;
 
 	} else {
 		//go down
@@ -271,23 +272,94 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			if (r_cells[p_idx].children[i] == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+				uint32_t child_idx = r_cells.size();
+				r_cells.write[p_idx].children[i] = child_idx;
+				r_cells.resize(r_cells.size() + 1);
+				r_cells.write[child_idx].level = p_level + 1;
+				r_cells.write[child_idx].x = nx / half;
+				r_cells.write[child_idx].y = ny / half;
+				r_cells.write[child_idx].z = nz / half;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			_plot_face(r_cells, r_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
 		}
 	}
 }
 
+void Voxelizer::_plot_faces_chunk(uint32_t p_chunk, const PlotFacesData *p_data) {
+	uint32_t from = uint64_t(p_data->faces->size()) * p_chunk / p_data->chunk_count;
+	uint32_t to = uint64_t(p_data->faces->size()) * (p_chunk + 1) / p_data->chunk_count;
+
+	Vector<Cell> &cells = p_data->chunk_cells[p_chunk];
+	cells.resize(1);
+	for (uint32_t i = from; i < to; i++) {
+		const PlotFace &face = (*p_data->faces)[i];
+		_plot_face(cells, 0, 0, 0, 0, 0, face.vtx, face.normal, face.uv, *p_data->material, po2_bounds);
+	}
+}
+
+void Voxelizer::_merge_cells(const Vector<Cell> &p_src_cells, uint32_t p_src_idx, uint32_t p_dst_idx) {
+	const Cell &src = p_src_cells[p_src_idx];
+	Cell &dst = bake_cells.write[p_dst_idx];
+	for (int i = 0; i < 3; i++) {
+		dst.albedo[i] += src.albedo[i];
+		dst.emission[i] += src.emission[i];
+		dst.normal[i] += src.normal[i];
+	}
+	dst.alpha += src.alpha;
+
+	for (int i = 0; i < 8; i++) {
+		uint32_t src_child = src.children[i];
+		if (src_child == CHILD_EMPTY) {
+			continue;
+		}
+
+		uint32_t dst_child = bake_cells[p_dst_idx].children[i];
+		if (dst_child == CHILD_EMPTY) {
+			dst_child = bake_cells.size();
+			bake_cells.resize(bake_cells.size() + 1);
+			bake_cells.write[p_dst_idx].children[i] = dst_child;
+			bake_cells.write[dst_child].level = p_src_cells[src_child].level;
+			bake_cells.write[dst_child].x = p_src_cells[src_child].x;
+			bake_cells.write[dst_child].y = p_src_cells[src_child].y;
+			bake_cells.write[dst_child].z = p_src_cells[src_child].z;
+		}
+
+		_merge_cells(p_src_cells, src_child, dst_child);
+	}
+}
+
+void Voxelizer::_plot_faces(const LocalVector<PlotFace> &p_faces, const MaterialCache &p_material) {
+	uint32_t chunk_count = MIN(uint32_t(WorkerThreadPool::get_singleton()->get_thread_count()), p_faces.size() / PLOT_FACES_CHUNK_MIN_SIZE);
+	if (chunk_count <= 1) {
+		for (const PlotFace &face : p_faces) {
+			_plot_face(bake_cells, 0, 0, 0, 0, 0, face.vtx, face.normal, face.uv, p_material, po2_bounds);
+		}
+		return;
+	}
+
+	// Each chunk plots into its own octree, which are merged afterwards in chunk order so the result
+	// doesn't depend on thread scheduling.
+	LocalVector<Vector<Cell>> chunk_cells;
+	chunk_cells.resize(chunk_count);
+
+	PlotFacesData data;
+	data.faces = &p_faces;
+	data.material = &p_material;
+	data.chunk_cells = chunk_cells.ptr();
+	data.chunk_count = chunk_count;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Voxelizer::_plot_faces_chunk, &data, chunk_count, -1, true, String("VoxelizerPlotFaces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (const Vector<Cell> &cells : chunk_cells) {
+		_merge_cells(cells, 0, 0);
+	}
+}
+
 Vector<Color> Voxelizer::_get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add) {
 	Vector<Color> ret;
 
@@ -419,14 +491,18 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 			nr = normals.ptr();
 		}
 
+		LocalVector<PlotFace> faces;
+
 		if (index.size()) {
 			int facecount = index.size() / 3;
 			const int *ir = index.ptr();
+			faces.reserve(facecount);
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotFace face;
+				Vector3 *vtxs = face.vtx;
+				Vector2 *uvs = face.uv;
+				Vector3 *normal = face.normal;
 
 				for (int k = 0; k < 3; k++) {
 					vtxs[k] = p_xform.xform(vr[ir[j * 3 + k]]);
@@ -448,17 +524,18 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
 					continue;
 				}
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				faces.push_back(face);
 			}
 
 		} else {
 			int facecount = vertices.size() / 3;
+			faces.reserve(facecount);
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotFace face;
+				Vector3 *vtxs = face.vtx;
+				Vector2 *uvs = face.uv;
+				Vector3 *normal = face.normal;
 
 				for (int k = 0; k < 3; k++) {
 					vtxs[k] = p_xform.xform(vr[j * 3 + k]);
@@ -480,10 +557,11 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
 					continue;
 				}
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				faces.push_back(face);
 			}
 		}
+
+		_plot_faces(faces, material);
 	}
 
 	max_original_cells = bake_cells.size();
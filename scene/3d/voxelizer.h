@@ -104,7 +104,26 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	struct PlotFace {
+		Vector3 vtx[3];
+		Vector3 normal[3];
+		Vector2 uv[3];
+	};
+
+	// Faces are plotted in parallel when there are enough of them for each chunk.
+	static const uint32_t PLOT_FACES_CHUNK_MIN_SIZE = 512;
+
+	struct PlotFacesData {
+		const LocalVector<PlotFace> *faces = nullptr;
+		const MaterialCache *material = nullptr;
+		Vector<Cell> *chunk_cells = nullptr;
+		uint32_t chunk_count = 0;
+	};
+
+	void _plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_faces(const LocalVector<PlotFace> &p_faces, const MaterialCache &p_material);
+	void _plot_faces_chunk(uint32_t p_chunk, const PlotFacesData *p_data);
+	void _merge_cells(const Vector<Cell> &p_src_cells, uint32_t p_src_idx, uint32_t p_dst_idx);
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
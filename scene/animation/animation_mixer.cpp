@@ -33,6 +33,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/audio/audio_stream_player.h"
@@ -474,6 +475,14 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_parallel_blending_enabled(bool p_enabled) {
+	parallel_blending = p_enabled;
+}
+
+bool AnimationMixer::is_parallel_blending_enabled() const {
+	return parallel_blending;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -566,6 +575,7 @@ void AnimationMixer::_clear_caches() {
 	track_cache.clear();
 	cache_valid = false;
 	capture_cache.clear();
+	parallel_blend_pending = false;
 
 	emit_signal(SNAME("caches_cleared"));
 }
@@ -689,6 +699,14 @@ bool AnimationMixer::_update_caches() {
 
 						track_value->subpath = leftover_path;
 
+						// Plain properties of built-in classes are set through their setter directly, like Tween does.
+						Object *target = resource.is_valid() ? (Object *)resource.ptr() : (Object *)child;
+						const StringName &target_class = target->get_class_name();
+						const ClassDB::APIType api = ClassDB::get_api_type(target_class);
+						if (leftover_path.size() == 1 && (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR)) {
+							track_value->setter = ClassDB::get_property_setget(target_class, leftover_path[0]);
+						}
+
 						track = track_value;
 
 						bool is_value = track_src_type == Animation::TYPE_VALUE;
@@ -935,18 +953,133 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
-	_blend_init();
-	if (_blend_pre_process(p_delta, track_count, track_map)) {
-		_blend_capture(p_delta);
-		_blend_calc_total_weight();
+	if (_blend_prepare(p_delta)) {
 		_blend_process(p_delta, p_update_only);
-		_blend_apply();
-		_blend_post_process();
-		emit_signal(SNAME("mixer_applied"));
-	};
+		_blend_finish();
+	}
+}
+
+bool AnimationMixer::_blend_prepare(double p_delta) {
+	// Processed again while waiting for a parallel pass (e.g. seeking from a signal), which must then leave it alone.
+	parallel_blend_pending = false;
+
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return false;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+	return true;
+}
+
+void AnimationMixer::_blend_finish() {
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
 	clear_animation_instances();
 }
 
+/* -- Parallel blending ------------------------ */
+
+LocalVector<ObjectID> AnimationMixer::parallel_blend_queue[2];
+
+void AnimationMixer::_queue_parallel_blend(double p_delta, bool p_physics) {
+	LocalVector<ObjectID> &queue = parallel_blend_queue[p_physics ? 1 : 0];
+	if (queue.is_empty()) {
+		// Runs once every node was processed, still before transforms are flushed for this frame.
+		callable_mp_static(&AnimationMixer::_flush_parallel_blend).call_deferred(p_physics);
+	}
+	queue.push_back(get_instance_id());
+	parallel_blend_delta = p_delta;
+}
+
+bool AnimationMixer::_can_blend_in_parallel() const {
+	// Only tracks which are sampled into the caches can be blended away from the main thread,
+	// anything that touches other objects while blending has to stay in order.
+	if (GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+	for (const AnimationInstance &ai : animation_instances) {
+		const Ref<Animation> &a = ai.animation_data.animation;
+		for (int i = 0; i < a->get_track_count(); i++) {
+			if (!a->track_is_enabled(i)) {
+				continue;
+			}
+			switch (a->track_get_type(i)) {
+				case Animation::TYPE_METHOD:
+				case Animation::TYPE_AUDIO:
+				case Animation::TYPE_ANIMATION: {
+					return false;
+				} break;
+				case Animation::TYPE_VALUE: {
+					if (a->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE && callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS) {
+						return false;
+					}
+				} break;
+				default: {
+				} break;
+			}
+		}
+	}
+	return true;
+}
+
+void AnimationMixer::_blend_process_parallel_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->parallel_blend_delta);
+}
+
+void AnimationMixer::_flush_parallel_blend(bool p_physics) {
+	LocalVector<ObjectID> queue;
+	SWAP(queue, parallel_blend_queue[p_physics ? 1 : 0]);
+
+	// Playback and tree processing run in order on the main thread, as they emit signals and call scripts.
+	// Mixers which can't be blended in parallel are finished right away, like they would be without it.
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (!mixer || !mixer->is_inside_tree() || !mixer->_blend_prepare(mixer->parallel_blend_delta)) {
+			continue;
+		}
+		if (mixer->_can_blend_in_parallel()) {
+			mixer->parallel_blend_pending = true;
+		} else {
+			mixer->_blend_process(mixer->parallel_blend_delta);
+			mixer->_blend_finish();
+		}
+	}
+
+	// Signals from the pass above may have freed or processed some of them already.
+	LocalVector<AnimationMixer *> mixers;
+	LocalVector<ObjectID> mixer_ids;
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (mixer && mixer->parallel_blend_pending) {
+			mixer->parallel_blend_pending = false;
+			mixers.push_back(mixer);
+			mixer_ids.push_back(id);
+		}
+	}
+
+	// Sampling and blending only write to the caches of each mixer.
+	if (mixers.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_process_parallel_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (AnimationMixer *mixer : mixers) {
+			mixer->_blend_process(mixer->parallel_blend_delta);
+		}
+	}
+
+	// Applying writes to skeletons, nodes and properties, in queue order.
+	for (const ObjectID &id : mixer_ids) {
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(id));
+		if (mixer) {
+			mixer->_blend_finish();
+		}
+	}
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx) {
 	Variant res;
 	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, p_object_id, p_object_sub_idx, res)) {
@@ -1121,6 +1254,8 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifndef _3D_DISABLED
 		bool calc_root = !seeked || is_external_seeking;
 #endif // _3D_DISABLED
+		// Compressed tracks are all sampled in one pass over the page instead of looking it up for every track.
+		bool use_compressed_samples = a->sample_compressed_tracks(time, compressed_samples);
 
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
@@ -1225,9 +1360,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && a->track_is_compressed(i)) {
+							const Vector4 &sample = compressed_samples[i];
+							loc = Vector3(sample.x, sample.y, sample.z);
+						} else {
+							Error err = a->try_position_track_interpolate(i, time, &loc);
+							if (err != OK) {
+								continue;
+							}
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
 						t->loc += (loc - t->init_loc) * blend;
@@ -1312,9 +1452,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && a->track_is_compressed(i)) {
+							const Vector4 &sample = compressed_samples[i];
+							rot = Quaternion(sample.x, sample.y, sample.z, sample.w);
+						} else {
+							Error err = a->try_rotation_track_interpolate(i, time, &rot);
+							if (err != OK) {
+								continue;
+							}
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
 						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
@@ -1400,9 +1545,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && a->track_is_compressed(i)) {
+							const Vector4 &sample = compressed_samples[i];
+							scale = Vector3(sample.x, sample.y, sample.z);
+						} else {
+							Error err = a->try_scale_track_interpolate(i, time, &scale);
+							if (err != OK) {
+								continue;
+							}
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
 						t->scale += (scale - t->init_scale) * blend;
@@ -1416,10 +1566,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
-					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
-					if (err != OK) {
-						continue;
+					if (use_compressed_samples && a->track_is_compressed(i)) {
+						value = compressed_samples[i].x;
+					} else {
+						Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+						//ERR_CONTINUE(err!=OK); //used for testing, should be removed
+						if (err != OK) {
+							continue;
+						}
 					}
 					value = post_process_key_value(a, i, value, t->object_id, t->shape_index);
 					t->value += (value - t->init_value) * blend;
@@ -1500,7 +1654,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							value = post_process_key_value(a, i, value, t->object_id);
 							Object *t_obj = ObjectDB::get_instance(t->object_id);
 							if (t_obj) {
-								t_obj->set_indexed(t->subpath, value);
+								_set_track_value(t, t_obj, value);
 							}
 						} else {
 							List<int> indices;
@@ -1511,7 +1665,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 								value = post_process_key_value(a, i, value, t->object_id);
 								Object *t_obj = ObjectDB::get_instance(t->object_id);
 								if (t_obj) {
-									t_obj->set_indexed(t->subpath, value);
+									_set_track_value(t, t_obj, value);
 								}
 							}
 						}
@@ -1817,7 +1971,7 @@ void AnimationMixer::_blend_apply() {
 
 				Object *t_obj = ObjectDB::get_instance(t->object_id);
 				if (t_obj) {
-					t_obj->set_indexed(t->subpath, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
+					_set_track_value(t, t_obj, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
 				}
 
 			} break;
@@ -1885,6 +2039,15 @@ void AnimationMixer::_blend_apply() {
 	}
 }
 
+void AnimationMixer::_set_track_value(TrackCacheValue *p_track, Object *p_object, const Variant &p_value) {
+	// A script attached after caching may override the property, so it's checked on every write.
+	if (p_track->setter && !p_object->get_script_instance()) {
+		ClassDB::set_property_with_setget(p_object, p_track->setter, p_value);
+	} else {
+		p_object->set_indexed(p_track->subpath, p_value);
+	}
+}
+
 void AnimationMixer::_call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred) {
 	// Separate function to use alloca() more efficiently
 	const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * p_params.size());
@@ -2205,13 +2368,21 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				if (parallel_blending && Thread::is_main_thread()) {
+					_queue_parallel_blend(get_process_delta_time(), false);
+				} else {
+					_process_animation(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				if (parallel_blending && Thread::is_main_thread()) {
+					_queue_parallel_blend(get_physics_process_delta_time(), true);
+				} else {
+					_process_animation(get_physics_process_delta_time());
+				}
 			}
 		} break;
 
@@ -2263,6 +2434,9 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_parallel_blending_enabled", "enabled"), &AnimationMixer::set_parallel_blending_enabled);
+	ClassDB::bind_method(D_METHOD("is_parallel_blending_enabled"), &AnimationMixer::is_parallel_blending_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2275,6 +2449,19 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_callback_mode_discrete", "mode"), &AnimationMixer::set_callback_mode_discrete);
 	ClassDB::bind_method(D_METHOD("get_callback_mode_discrete"), &AnimationMixer::get_callback_mode_discrete);
 
+	/* ---- Level of detail ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_node", "path"), &AnimationMixer::set_lod_node);
+	ClassDB::bind_method(D_METHOD("get_lod_node"), &AnimationMixer::get_lod_node);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distant_interval", "interval"), &AnimationMixer::set_lod_distant_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_distant_interval"), &AnimationMixer::get_lod_distant_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_off_screen_interval", "interval"), &AnimationMixer::set_lod_off_screen_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_off_screen_interval"), &AnimationMixer::get_lod_off_screen_interval);
+
 	/* ---- Audio ---- */
 	ClassDB::bind_method(D_METHOD("set_audio_max_polyphony", "max_polyphony"), &AnimationMixer::set_audio_max_polyphony);
 	ClassDB::bind_method(D_METHOD("get_audio_max_polyphony"), &AnimationMixer::get_audio_max_polyphony);
@@ -2304,12 +2491,19 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "parallel_blending"), "set_parallel_blending_enabled", "is_parallel_blending_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_save", PROPERTY_HINT_NONE, ""), "set_reset_on_save_enabled", "is_reset_on_save_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_node"), "set_root_node", "get_root_node");
 
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_node", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Node3D"), "set_lod_node", "get_lod_node");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_distant_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_distant_interval", "get_lod_distant_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_off_screen_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_off_screen_interval", "get_lod_off_screen_interval");
+
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
@@ -222,6 +222,7 @@ protected:
 		Variant init_value;
 		Variant value;
 		Vector<StringName> subpath;
+		const ClassDB::PropertySetGet *setter = nullptr; // Resolved once for plain properties of built-in classes.
 
 		// TODO: There are many boolean, can be packed into one integer.
 		bool is_init = false;
@@ -237,6 +238,7 @@ protected:
 				init_value(p_other.init_value),
 				value(p_other.value),
 				subpath(p_other.subpath),
+				setter(p_other.setter),
 				is_init(p_other.is_init),
 				use_continuous(p_other.use_continuous),
 				use_discrete(p_other.use_discrete),
@@ -321,10 +323,30 @@ protected:
 
 	/* ---- Blending processor ---- */
 	LocalVector<AnimationInstance> animation_instances;
+	LocalVector<Vector4> compressed_samples;
 	HashMap<NodePath, int> track_map;
 	int track_count = 0;
 	bool deterministic = false;
 
+	// Mixers with parallel blending queue themselves while processing and are blended together in a deferred pass.
+	bool parallel_blending = false;
+	bool parallel_blend_pending = false;
+	double parallel_blend_delta = 0.0;
+	static LocalVector<ObjectID> parallel_blend_queue[2];
+	void _queue_parallel_blend(double p_delta, bool p_physics);
+	bool _can_blend_in_parallel() const;
+	static void _blend_process_parallel_task(void *p_userdata, uint32_t p_index);
+	static void _flush_parallel_blend(bool p_physics);
+
+	/* ---- Level of detail ---- */
+	NodePath lod_node;
+	real_t lod_distance = 0.0;
+	int lod_distant_interval = 4;
+	int lod_off_screen_interval = 8;
+	double lod_accumulated_delta = 0.0;
+	int _get_lod_interval() const;
+	bool _lod_process(double &r_delta);
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	Vector3 root_motion_position = Vector3(0, 0, 0);
@@ -361,12 +383,15 @@ protected:
 	GDVIRTUAL5RC(Variant, _post_process_key_value, Ref<Animation>, int, Variant, ObjectID, int);
 
 	void _blend_init();
+	bool _blend_prepare(double p_delta);
+	void _blend_finish();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const HashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For undeterministic blending.
 	void _blend_process(double p_delta, bool p_update_only = false);
 	void _blend_apply();
 	virtual void _blend_post_process();
+	void _set_track_value(TrackCacheValue *p_track, Object *p_object, const Variant &p_value);
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
 	/* ---- Capture feature ---- */
@@ -419,6 +444,22 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_parallel_blending_enabled(bool p_enabled);
+	bool is_parallel_blending_enabled() const;
+
+	/* ---- Level of detail ---- */
+	void set_lod_node(const NodePath &p_path);
+	NodePath get_lod_node() const;
+
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_distant_interval(int p_interval);
+	int get_lod_distant_interval() const;
+
+	void set_lod_off_screen_interval(int p_interval);
+	int get_lod_off_screen_interval() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
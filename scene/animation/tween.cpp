@@ -414,8 +414,35 @@ Variant Tween::interpolate_variant(const Variant &p_initial_val, const Variant &
 	ERR_FAIL_INDEX_V(p_trans, TransitionType::TRANS_MAX, Variant());
 	ERR_FAIL_INDEX_V(p_ease, EaseType::EASE_MAX, Variant());
 
+	const float c = run_equation(p_trans, p_ease, p_time, 0.0, 1.0, p_duration);
+
+	// The most commonly tweened types are interpolated directly, without going through Variant operators.
+	// This gives the same results as Animation::add_variant() followed by Animation::interpolate_variant().
+	if (p_initial_val.get_type() == p_delta_val.get_type()) {
+		switch (p_initial_val.get_type()) {
+			case Variant::FLOAT: {
+				const double initial = p_initial_val.operator double();
+				return Math::lerp(initial, initial + p_delta_val.operator double(), c);
+			}
+			case Variant::VECTOR2: {
+				const Vector2 initial = p_initial_val.operator Vector2();
+				return initial.lerp(initial + p_delta_val.operator Vector2(), c);
+			}
+			case Variant::VECTOR3: {
+				const Vector3 initial = p_initial_val.operator Vector3();
+				return initial.lerp(initial + p_delta_val.operator Vector3(), c);
+			}
+			case Variant::COLOR: {
+				const Color initial = p_initial_val.operator Color();
+				return initial.lerp(initial + p_delta_val.operator Color(), c);
+			}
+			default: {
+			}
+		}
+	}
+
 	Variant ret = Animation::add_variant(p_initial_val, p_delta_val);
-	ret = Animation::interpolate_variant(p_initial_val, ret, run_equation(p_trans, p_ease, p_time, 0.0, 1.0, p_duration), p_initial_val.is_string());
+	ret = Animation::interpolate_variant(p_initial_val, ret, c, p_initial_val.is_string());
 	return ret;
 }
 
@@ -551,6 +578,14 @@ void PropertyTweener::start() {
 		return;
 	}
 
+	// Plain properties of built-in classes are set through their setter directly, like PackedScene does when instantiating.
+	setter = nullptr;
+	const StringName &class_name = target_instance->get_class_name();
+	const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (property.size() == 1 && (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR)) {
+		setter = ClassDB::get_property_setget(class_name, property[0]);
+	}
+
 	if (do_continue) {
 		if (Math::is_zero_approx(delay)) {
 			initial_val = target_instance->get_indexed(property);
@@ -604,14 +639,14 @@ bool PropertyTweener::step(double &r_delta) {
 				ERR_FAIL_V_MSG(false, vformat("Wrong return type in PropertyTweener custom method. Expected float, got %s.", Variant::get_type_name(result.get_type())));
 			}
 
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+			_set_value(target_instance, Animation::interpolate_variant(initial_val, final_val, result));
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			_set_value(target_instance, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		}
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_value(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SceneStringName(finished));
@@ -619,6 +654,15 @@ bool PropertyTweener::step(double &r_delta) {
 	}
 }
 
+void PropertyTweener::_set_value(Object *p_target, const Variant &p_value) {
+	// A script attached after start() may override the property, so it's checked on every step.
+	if (setter && !p_target->get_script_instance()) {
+		ClassDB::set_property_with_setget(p_target, setter, p_value);
+	} else {
+		p_target->set_indexed(property, p_value);
+	}
+}
+
 void PropertyTweener::set_tween(const Ref<Tween> &p_tween) {
 	Tweener::set_tween(p_tween);
 	if (trans_type == Tween::TRANS_MAX) {
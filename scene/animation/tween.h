@@ -221,6 +221,7 @@ private:
 	Variant delta_val;
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
+	const ClassDB::PropertySetGet *setter = nullptr; // Built-in setter of a plain property, resolved in start().
 
 	double duration = 0;
 	Tween::TransitionType trans_type = Tween::TRANS_MAX; // This is set inside set_tween();
@@ -231,6 +232,8 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	void _set_value(Object *p_target, const Variant &p_value);
 };
 
 class IntervalTweener : public Tweener {
@@ -136,7 +136,7 @@ void Container::queue_sort() {
 		return;
 	}
 
-	callable_mp(this, &Container::_sort_children).call_deferred();
+	get_tree()->_queue_sort(this);
 	pending_sort = true;
 }
 
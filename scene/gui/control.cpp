@@ -199,6 +199,7 @@ void Control::reparent(Node *p_parent, bool p_keep_global_transform) {
 // Editor integration.
 
 int Control::root_layout_direction = 0;
+SafeNumeric<uint64_t> Control::gui_layout_version;
 
 void Control::set_root_layout_direction(int p_root_dir) {
 	root_layout_direction = p_root_dir;
@@ -1641,7 +1642,7 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	callable_mp(this, &Control::_update_minimum_size).call_deferred();
+	get_tree()->_queue_minimum_size_update(this);
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -1747,6 +1748,7 @@ void Control::_size_changed() {
 			// Ensure global transform is marked as dirty before `NOTIFICATION_RESIZED` / `item_rect_changed` signal
 			// so an up to date global transform could be obtained when handling these.
 			_notify_transform();
+			gui_layout_version.increment();
 
 			if (size_changed) {
 				notification(NOTIFICATION_RESIZED);
@@ -1858,6 +1860,7 @@ void Control::set_mouse_filter(MouseFilter p_filter) {
 	}
 
 	data.mouse_filter = p_filter;
+	gui_layout_version.increment();
 	notify_property_list_changed();
 	update_configuration_warnings();
 
@@ -2450,6 +2453,7 @@ void Control::set_clip_contents(bool p_clip) {
 		return;
 	}
 	data.clip_contents = p_clip;
+	gui_layout_version.increment();
 	queue_redraw();
 }
 
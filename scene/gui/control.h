@@ -273,6 +273,7 @@ private:
 	// Global relations.
 
 	friend class Viewport;
+	friend class SceneTree;
 
 	// Positioning and sizing.
 
@@ -414,6 +415,9 @@ public:
 
 	static void set_root_layout_direction(int p_root_dir);
 
+	// Bumped when the placement, visibility, order or mouse filter of any control may have changed.
+	static SafeNumeric<uint64_t> gui_layout_version;
+
 	PackedStringArray get_configuration_warnings() const override;
 #ifdef TOOLS_ENABLED
 	virtual void get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const override;
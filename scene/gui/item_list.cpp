@@ -1138,6 +1138,7 @@ void ItemList::_notification(int p_what) {
 			}
 
 			// Draw visible items.
+			int last_item_visible = first_item_visible - 1;
 			for (int i = first_item_visible; i < items.size(); i++) {
 				Rect2 rcache = items[i].rect_cache;
 
@@ -1148,6 +1149,7 @@ void ItemList::_notification(int p_what) {
 				if (!clip.intersects(rcache)) {
 					continue;
 				}
+				last_item_visible = i;
 
 				if (current_columns == 1) {
 					rcache.size.width = width - rcache.position.x;
@@ -1348,10 +1350,36 @@ void ItemList::_notification(int p_what) {
 					draw_style_box(cursor, r);
 				}
 			}
+
+			if (_is_text_shaping_lazy()) {
+				_update_shaped_window(first_item_visible, last_item_visible);
+			}
 		} break;
 	}
 }
 
+bool ItemList::_is_text_shaping_lazy() const {
+	// Rows are only independent of the text size with a single column of single line items.
+	return lazy_text_shaping && max_columns == 1 && icon_mode == ICON_MODE_LEFT;
+}
+
+void ItemList::_update_shaped_window(int p_first_visible, int p_last_visible) {
+	// Keep the shaped text of about a page of items on each side, so scrolling back doesn't shape it again.
+	const int margin = MAX(p_last_visible - p_first_visible + 1, 1);
+	const int from = MAX(p_first_visible - margin, 0);
+	const int to = MIN(p_last_visible + margin, items.size() - 1);
+
+	// Resetting the text buffer releases its shaped data, it is shaped again when drawn.
+	for (int i = shaped_from; i <= MIN(shaped_to, items.size() - 1); i++) {
+		if (i < from || i > to) {
+			_shape_text(i);
+		}
+	}
+
+	shaped_from = from;
+	shaped_to = to;
+}
+
 void ItemList::force_update_list_size() {
 	if (!shape_changed) {
 		return;
@@ -1361,6 +1389,10 @@ void ItemList::force_update_list_size() {
 	Size2 size = get_size();
 	float max_column_width = 0.0;
 
+	// Text is drawn on a single line here, and only shaped when it becomes visible.
+	const bool lazy_shaping = _is_text_shaping_lazy();
+	const float line_height = lazy_shaping ? theme_cache.font->get_height(theme_cache.font_size) : 0.0;
+
 	//1- compute item minimum sizes
 	for (int i = 0; i < items.size(); i++) {
 		Size2 minsize;
@@ -1380,7 +1412,9 @@ void ItemList::force_update_list_size() {
 			}
 		}
 
-		if (!items[i].text.is_empty()) {
+		if (!items[i].text.is_empty() && lazy_shaping) {
+			minsize.y = MAX(minsize.y, line_height);
+		} else if (!items[i].text.is_empty()) {
 			int max_width = -1;
 			if (fixed_column_width) {
 				max_width = fixed_column_width;
@@ -1519,24 +1553,49 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	}
 
 	int closest = -1;
-	int closest_dist = 0x7FFFFFFF;
+	float closest_dist = FLT_MAX;
+
+	// Items are laid out in rows from top to bottom, so only the rows around the position need to be checked.
+	// Do a binary search to find the first item whose rect reaches below pos.y.
+	int start = 0;
+	{
+		int lo = 0;
+		int hi = items.size();
+		while (lo < hi) {
+			const int mid = (lo + hi) / 2;
+			const Rect2 &rcache = items[mid].rect_cache;
+			if (rcache.position.y + rcache.size.y < pos.y) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		start = MIN(lo, items.size() - 1);
+	}
 
-	for (int i = 0; i < items.size(); i++) {
-		Rect2 rc = items[i].rect_cache;
+	// Walk away from it in both directions, until the rows are vertically further away than the closest item.
+	for (int dir = 1; dir >= -1; dir -= 2) {
+		for (int i = (dir > 0 ? start : start - 1); i >= 0 && i < items.size(); i += dir) {
+			Rect2 rc = items[i].rect_cache;
 
-		if (i % current_columns == current_columns - 1) {
-			rc.size.width = get_size().width - rc.position.x; // Make sure you can still select the last item when clicking past the column.
-		}
+			const float dist_y = MAX(MAX(rc.position.y - pos.y, pos.y - (rc.position.y + rc.size.y)), 0);
+			if (dist_y > (p_exact ? 0 : closest_dist)) {
+				break;
+			}
 
-		if (rc.has_point(pos)) {
-			closest = i;
-			break;
-		}
+			if (i % current_columns == current_columns - 1) {
+				rc.size.width = get_size().width - rc.position.x; // Make sure you can still select the last item when clicking past the column.
+			}
 
-		float dist = rc.distance_to(pos);
-		if (!p_exact && dist < closest_dist) {
-			closest = i;
-			closest_dist = dist;
+			if (rc.has_point(pos)) {
+				return i;
+			}
+
+			float dist = rc.distance_to(pos);
+			if (!p_exact && (dist < closest_dist || (dist == closest_dist && i < closest))) {
+				closest = i;
+				closest_dist = dist;
+			}
 		}
 	}
 
@@ -1706,6 +1765,22 @@ TextServer::OverrunBehavior ItemList::get_text_overrun_behavior() const {
 	return text_overrun_behavior;
 }
 
+void ItemList::set_lazy_text_shaping(bool p_enable) {
+	if (lazy_text_shaping == p_enable) {
+		return;
+	}
+
+	lazy_text_shaping = p_enable;
+	shaped_from = 0;
+	shaped_to = -1;
+	shape_changed = true;
+	queue_redraw();
+}
+
+bool ItemList::is_lazy_text_shaping() const {
+	return lazy_text_shaping;
+}
+
 bool ItemList::_set(const StringName &p_name, const Variant &p_value) {
 	if (property_helper.property_set_value(p_name, p_value)) {
 		return true;
@@ -1843,6 +1918,9 @@ void ItemList::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_text_overrun_behavior", "overrun_behavior"), &ItemList::set_text_overrun_behavior);
 	ClassDB::bind_method(D_METHOD("get_text_overrun_behavior"), &ItemList::get_text_overrun_behavior);
 
+	ClassDB::bind_method(D_METHOD("set_lazy_text_shaping", "enable"), &ItemList::set_lazy_text_shaping);
+	ClassDB::bind_method(D_METHOD("is_lazy_text_shaping"), &ItemList::is_lazy_text_shaping);
+
 	ClassDB::bind_method(D_METHOD("force_update_list_size"), &ItemList::force_update_list_size);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "select_mode", PROPERTY_HINT_ENUM, "Single,Multi"), "set_select_mode", "get_select_mode");
@@ -1852,6 +1930,7 @@ void ItemList::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_text_lines", PROPERTY_HINT_RANGE, "1,10,1,or_greater"), "set_max_text_lines", "get_max_text_lines");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_height"), "set_auto_height", "has_auto_height");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "text_overrun_behavior", PROPERTY_HINT_ENUM, "Trim Nothing,Trim Characters,Trim Words,Ellipsis,Word Ellipsis"), "set_text_overrun_behavior", "get_text_overrun_behavior");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lazy_text_shaping"), "set_lazy_text_shaping", "is_lazy_text_shaping");
 	ADD_ARRAY_COUNT("Items", "item_count", "set_item_count", "get_item_count", "item_");
 	ADD_GROUP("Columns", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_columns", PROPERTY_HINT_RANGE, "0,10,1,or_greater"), "set_max_columns", "get_max_columns");
@@ -110,6 +110,11 @@ private:
 	VScrollBar *scroll_bar = nullptr;
 	TextServer::OverrunBehavior text_overrun_behavior = TextServer::OVERRUN_TRIM_ELLIPSIS;
 
+	bool lazy_text_shaping = false;
+	// Items around the visible ones whose text may be shaped, only tracked with lazy text shaping.
+	int shaped_from = 0;
+	int shaped_to = -1;
+
 	uint64_t search_time_msec = 0;
 	String search_string;
 
@@ -157,6 +162,8 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	bool _is_text_shaping_lazy() const;
+	void _update_shaped_window(int p_first_visible, int p_last_visible);
 	void _mouse_exited();
 
 protected:
@@ -223,6 +230,9 @@ public:
 	void set_text_overrun_behavior(TextServer::OverrunBehavior p_behavior);
 	TextServer::OverrunBehavior get_text_overrun_behavior() const;
 
+	void set_lazy_text_shaping(bool p_enable);
+	bool is_lazy_text_shaping() const;
+
 	void select(int p_idx, bool p_single = true);
 	void deselect(int p_idx);
 	void deselect_all();
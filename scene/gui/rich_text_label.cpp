@@ -2801,6 +2801,20 @@ bool RichTextLabel::is_updating() const {
 	return updating.load() || validating.load();
 }
 
+void RichTextLabel::set_max_paragraphs(int p_paragraphs) {
+	ERR_FAIL_COND(p_paragraphs < 0);
+	if (max_paragraphs == p_paragraphs) {
+		return;
+	}
+
+	max_paragraphs = p_paragraphs;
+	_trim_paragraphs();
+}
+
+int RichTextLabel::get_max_paragraphs() const {
+	return max_paragraphs;
+}
+
 void RichTextLabel::set_threaded(bool p_threaded) {
 	if (threaded != p_threaded) {
 		_stop_thread();
@@ -2911,7 +2925,11 @@ bool RichTextLabel::_validate_line_caches() {
 	}
 	validating.store(false);
 	stop_thread.store(false);
-	if (threaded) {
+
+	// Only a few paragraphs were appended after the shaped ones, shaping them here is cheaper than starting a task.
+	const int pending_lines = (int)main->lines.size() - main->first_invalid_line.load();
+	const bool appended = main->first_resized_line.load() >= main->first_invalid_line.load() && main->first_invalid_font_line.load() >= main->first_invalid_line.load();
+	if (threaded && !(appended && pending_lines <= MAX_APPENDED_LINES_SHAPED_ON_CALLER)) {
 		updating.store(true);
 		loaded.store(true);
 		task = WorkerThreadPool::get_singleton()->add_template_task(this, &RichTextLabel::_thread_function, nullptr, true, vformat("RichTextLabelShape:%x", (int64_t)get_instance_id()));
@@ -3007,6 +3025,20 @@ void RichTextLabel::_invalidate_current_line(ItemFrame *p_frame) {
 	}
 }
 
+void RichTextLabel::_trim_paragraphs() {
+	// Paragraphs can only be dropped safely while nothing is pushed, tags may span them.
+	if (max_paragraphs <= 0 || current != main || current_frame != main) {
+		return;
+	}
+
+	// The offsets of the remaining paragraphs are shifted, they are not shaped again.
+	while ((int)main->lines.size() > max_paragraphs) {
+		if (!remove_paragraph(0, true)) {
+			break;
+		}
+	}
+}
+
 void RichTextLabel::_texture_changed(RID p_item) {
 	Item *it = items.get_or_null(p_item);
 	if (it && it->type == ITEM_IMAGE) {
@@ -3078,6 +3110,7 @@ void RichTextLabel::add_text(const String &p_text) {
 
 		pos = end + 1;
 	}
+	_trim_paragraphs();
 	queue_redraw();
 }
 
@@ -3303,6 +3336,7 @@ void RichTextLabel::add_newline() {
 	_add_item(item, false);
 	current_frame->lines.resize(current_frame->lines.size() + 1);
 	_invalidate_current_line(current_frame);
+	_trim_paragraphs();
 	queue_redraw();
 }
 
@@ -5126,6 +5160,8 @@ void RichTextLabel::append_text(const String &p_bbcode) {
 			break;
 		}
 	}
+
+	_trim_paragraphs();
 }
 
 void RichTextLabel::scroll_to_selection() {
@@ -5996,6 +6032,9 @@ void RichTextLabel::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("is_ready"), &RichTextLabel::is_ready);
 
+	ClassDB::bind_method(D_METHOD("set_max_paragraphs", "paragraphs"), &RichTextLabel::set_max_paragraphs);
+	ClassDB::bind_method(D_METHOD("get_max_paragraphs"), &RichTextLabel::get_max_paragraphs);
+
 	ClassDB::bind_method(D_METHOD("set_threaded", "threaded"), &RichTextLabel::set_threaded);
 	ClassDB::bind_method(D_METHOD("is_threaded"), &RichTextLabel::is_threaded);
 
@@ -6052,6 +6091,7 @@ void RichTextLabel::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "fit_content"), "set_fit_content", "is_fit_content_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_active"), "set_scroll_active", "is_scroll_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_following"), "set_scroll_follow", "is_scroll_following");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_paragraphs", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), "set_max_paragraphs", "get_max_paragraphs");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "autowrap_mode", PROPERTY_HINT_ENUM, "Off,Arbitrary,Word,Word (Smart)"), "set_autowrap_mode", "get_autowrap_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "tab_size", PROPERTY_HINT_RANGE, "0,24,1"), "set_tab_size", "get_tab_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "context_menu_enabled"), "set_context_menu_enabled", "is_context_menu_enabled");
@@ -451,6 +451,7 @@ private:
 	WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
 	Mutex data_mutex;
 	bool threaded = false;
+	static constexpr int MAX_APPENDED_LINES_SHAPED_ON_CALLER = 8;
 	std::atomic<bool> stop_thread;
 	std::atomic<bool> updating;
 	std::atomic<bool> validating;
@@ -463,6 +464,8 @@ private:
 
 	TextServer::AutowrapMode autowrap_mode = TextServer::AUTOWRAP_WORD_SMART;
 
+	int max_paragraphs = 0;
+
 	bool scroll_visible = false;
 	bool scroll_follow = false;
 	bool scroll_following = false;
@@ -489,6 +492,7 @@ private:
 	Array custom_effects;
 
 	void _invalidate_current_line(ItemFrame *p_frame);
+	void _trim_paragraphs();
 
 	void _thread_function(void *p_userdata);
 	void _thread_end();
@@ -751,6 +755,9 @@ public:
 	int get_paragraph_count() const;
 	int get_visible_paragraph_count() const;
 
+	void set_max_paragraphs(int p_paragraphs);
+	int get_max_paragraphs() const;
+
 	float get_line_offset(int p_line);
 	float get_paragraph_offset(int p_paragraph);
 
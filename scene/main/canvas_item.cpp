@@ -32,6 +32,7 @@
 #include "canvas_item.compat.inc"
 
 #include "scene/2d/canvas_group.h"
+#include "scene/gui/control.h"
 #include "scene/main/canvas_layer.h"
 #include "scene/main/window.h"
 #include "scene/resources/atlas_texture.h"
@@ -64,6 +65,9 @@ bool CanvasItem::is_visible_in_tree() const {
 }
 
 void CanvasItem::_propagate_visibility_changed(bool p_parent_visible_in_tree) {
+	if (parent_visible_in_tree != p_parent_visible_in_tree) {
+		Control::gui_layout_version.increment();
+	}
 	parent_visible_in_tree = p_parent_visible_in_tree;
 	if (!visible) {
 		return;
@@ -79,6 +83,7 @@ void CanvasItem::set_visible(bool p_visible) {
 	}
 
 	visible = p_visible;
+	Control::gui_layout_version.increment();
 
 	if (!parent_visible_in_tree) {
 		notification(NOTIFICATION_VISIBILITY_CHANGED);
@@ -138,6 +143,8 @@ void CanvasItem::_redraw_callback() {
 	RenderingServer::get_singleton()->canvas_item_clear(get_canvas_item());
 	//todo updating = true - only allow drawing here
 	if (is_visible_in_tree()) {
+		uint64_t glyph_placeholders = TS->get_glyph_placeholder_count();
+
 		drawing = true;
 		current_item_drawn = this;
 		notification(NOTIFICATION_DRAW);
@@ -145,6 +152,14 @@ void CanvasItem::_redraw_callback() {
 		GDVIRTUAL_CALL(_draw);
 		current_item_drawn = nullptr;
 		drawing = false;
+
+		// Some glyphs are still rasterized in the background and were skipped, draw again on the next frame.
+		if (TS->get_glyph_placeholder_count() != glyph_placeholders) {
+			Callable redraw = callable_mp(this, &CanvasItem::queue_redraw);
+			if (!get_tree()->is_connected(SNAME("process_frame"), redraw)) {
+				get_tree()->connect(SNAME("process_frame"), redraw, CONNECT_ONE_SHOT);
+			}
+		}
 	}
 	//todo updating = false
 	pending_update = false; // don't change to false until finished drawing (avoid recursive update)
@@ -403,6 +418,8 @@ void CanvasItem::_notification(int p_what) {
 void CanvasItem::update_draw_order() {
 	ERR_MAIN_THREAD_GUARD;
 
+	Control::gui_layout_version.increment();
+
 	if (!is_inside_tree()) {
 		return;
 	}
@@ -483,6 +500,7 @@ void CanvasItem::set_as_top_level(bool p_top_level) {
 	top_level = p_top_level;
 	_top_level_changed();
 	_enter_canvas();
+	Control::gui_layout_version.increment();
 
 	_notify_transform();
 
@@ -959,6 +977,10 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 
 	p_node->_set_global_invalid(true);
 
+	if (Object::cast_to<Control>(p_node)) {
+		Control::gui_layout_version.increment();
+	}
+
 	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
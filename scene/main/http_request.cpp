@@ -32,10 +32,114 @@
 #include "core/io/compression.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+HashMap<String, Vector<Ref<HTTPClient>>> *HTTPRequest::connection_pool = nullptr;
+
 Error HTTPRequest::_request() {
+	if (reused_connection) {
+		// Already connected, taken from the connection pool.
+		return OK;
+	}
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+String HTTPRequest::_get_connection_pool_key() const {
+	String key = (use_tls ? "https://" : "http://") + url + ":" + itos(port);
+	if (use_tls) {
+		key += "|" + https_proxy_host + ":" + itos(https_proxy_port);
+		if (tls_options.is_valid()) {
+			key += tls_options->is_unsafe_client() ? "|unsafe|" : "|";
+			key += tls_options->get_common_name_override();
+			if (tls_options->get_trusted_ca_chain().is_valid()) {
+				key += "|" + itos(tls_options->get_trusted_ca_chain()->get_instance_id());
+			}
+		}
+	} else {
+		key += "|" + http_proxy_host + ":" + itos(http_proxy_port);
+	}
+	return key;
+}
+
+Ref<HTTPClient> HTTPRequest::_create_client() const {
+	Ref<HTTPClient> new_client = Ref<HTTPClient>(HTTPClient::create());
+	new_client->set_read_chunk_size(client->get_read_chunk_size());
+	new_client->set_http_proxy(http_proxy_host, http_proxy_port);
+	new_client->set_https_proxy(https_proxy_host, https_proxy_port);
+	return new_client;
+}
+
+bool HTTPRequest::_take_pooled_connection() {
+	String key = _get_connection_pool_key();
+
+	MutexLock lock(connection_pool_mutex);
+	if (!connection_pool) {
+		return false;
+	}
+
+	Vector<Ref<HTTPClient>> *idle = connection_pool->getptr(key);
+	while (idle && !idle->is_empty()) {
+		Ref<HTTPClient> pooled = (*idle)[idle->size() - 1];
+		idle->remove_at(idle->size() - 1);
+
+		// The server may have closed the connection while it was idle.
+		pooled->poll();
+		if (pooled->get_status() != HTTPClient::STATUS_CONNECTED) {
+			continue;
+		}
+
+		pooled->set_read_chunk_size(client->get_read_chunk_size());
+		client->close();
+		client = pooled;
+		return true;
+	}
+	return false;
+}
+
+void HTTPRequest::_release_connection_to_pool() {
+	// The connection can only be reused once the whole body was read and the server kept it open.
+	if (thread.is_started()) {
+		thread.wait_to_finish();
+	}
+	if (client->get_status() != HTTPClient::STATUS_CONNECTED) {
+		return;
+	}
+
+	String key = _get_connection_pool_key();
+	{
+		MutexLock lock(connection_pool_mutex);
+		if (!connection_pool) {
+			connection_pool = memnew((HashMap<String, Vector<Ref<HTTPClient>>>));
+		}
+		Vector<Ref<HTTPClient>> &idle = (*connection_pool)[key];
+		if (idle.size() >= MAX_POOLED_CONNECTIONS_PER_HOST) {
+			return;
+		}
+		idle.push_back(client);
+	}
+	client = _create_client();
+}
+
+bool HTTPRequest::_retry_stale_connection() {
+	// A pooled connection may have been closed by the server just as the request was sent.
+	// Since nothing was received yet, retry once on a new connection.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	return _request() == OK;
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	if (connection_pool) {
+		memdelete(connection_pool);
+		connection_pool = nullptr;
+	}
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -140,6 +244,8 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 
 	request_data = p_request_data_raw;
 
+	reused_connection = use_connection_pool && _take_pooled_connection();
+
 	requesting = true;
 
 	if (use_threads.is_set()) {
@@ -247,6 +353,7 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 		if (!new_request.is_empty()) {
 			// Process redirect.
 			client->close();
+			reused_connection = false;
 			int new_redirs = redirections + 1; // Because _request() will clear it.
 			Error err;
 			if (new_request.begins_with("http")) {
@@ -290,6 +397,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -342,6 +452,9 @@ bool HTTPRequest::_update_connection() {
 				int size = request_data.size();
 				Error err = client->request(method, request_string, headers, size > 0 ? request_data.ptr() : nullptr, size);
 				if (err != OK) {
+					if (_retry_stale_connection()) {
+						return false;
+					}
 					_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 					return true;
 				}
@@ -378,7 +491,7 @@ bool HTTPRequest::_update_connection() {
 					return true;
 				}
 
-				if (!download_to_file.is_empty()) {
+				if (download_stream.is_null() && !download_to_file.is_empty()) {
 					file = FileAccess::open(download_to_file, FileAccess::WRITE);
 					if (file.is_null()) {
 						_defer_done(RESULT_DOWNLOAD_FILE_CANT_OPEN, response_code, response_headers, PackedByteArray());
@@ -434,7 +547,12 @@ bool HTTPRequest::_update_connection() {
 			}
 
 			if (chunk.size()) {
-				if (file.is_valid()) {
+				if (download_stream.is_valid()) {
+					if (download_stream->put_data(chunk.ptr(), chunk.size()) != OK) {
+						_defer_done(RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PackedByteArray());
+						return true;
+					}
+				} else if (file.is_valid()) {
 					const uint8_t *r = chunk.ptr();
 					file->store_buffer(r, chunk.size());
 					if (file->get_error() != OK) {
@@ -461,6 +579,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -478,6 +599,9 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
+	if (use_connection_pool && requesting && p_status == RESULT_SUCCESS && get_header_value(p_headers, "Connection").to_lower() != "close") {
+		_release_connection_to_pool();
+	}
 	cancel_request();
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
@@ -542,6 +666,24 @@ String HTTPRequest::get_download_file() const {
 	return download_to_file;
 }
 
+void HTTPRequest::set_download_stream(const Ref<StreamPeer> &p_stream) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+
+	download_stream = p_stream;
+}
+
+Ref<StreamPeer> HTTPRequest::get_download_stream() const {
+	return download_stream;
+}
+
+void HTTPRequest::set_use_connection_pool(bool p_enable) {
+	use_connection_pool = p_enable;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
 void HTTPRequest::set_download_chunk_size(int p_chunk_size) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -573,10 +715,14 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -622,6 +768,14 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_download_file", "path"), &HTTPRequest::set_download_file);
 	ClassDB::bind_method(D_METHOD("get_download_file"), &HTTPRequest::get_download_file);
 
+	ClassDB::bind_method(D_METHOD("set_download_stream", "stream"), &HTTPRequest::set_download_stream);
+	ClassDB::bind_method(D_METHOD("get_download_stream"), &HTTPRequest::get_download_stream);
+
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
+	ClassDB::bind_static_method("HTTPRequest", D_METHOD("clear_connection_pool"), &HTTPRequest::clear_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("get_downloaded_bytes"), &HTTPRequest::get_downloaded_bytes);
 	ClassDB::bind_method(D_METHOD("get_body_size"), &HTTPRequest::get_body_size);
 
@@ -637,6 +791,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "download_file", PROPERTY_HINT_FILE), "set_download_file", "get_download_file");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
@@ -33,6 +33,7 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
@@ -84,6 +85,25 @@ private:
 	Vector<String> response_headers;
 
 	String download_to_file;
+	Ref<StreamPeer> download_stream;
+
+	bool use_connection_pool = false;
+	bool reused_connection = false;
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
+
+	// Idle keep-alive connections shared by all HTTPRequest nodes, keyed by host, TLS and proxy settings.
+	static constexpr int MAX_POOLED_CONNECTIONS_PER_HOST = 4;
+	static Mutex connection_pool_mutex;
+	static HashMap<String, Vector<Ref<HTTPClient>>> *connection_pool;
+
+	String _get_connection_pool_key() const;
+	Ref<HTTPClient> _create_client() const;
+	bool _take_pooled_connection();
+	void _release_connection_to_pool();
+	bool _retry_stale_connection();
 
 	Ref<StreamPeerGZIP> decompressor;
 	Ref<FileAccess> file;
@@ -139,6 +159,14 @@ public:
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
+	void set_download_stream(const Ref<StreamPeer> &p_stream);
+	Ref<StreamPeer> get_download_stream() const;
+
+	void set_use_connection_pool(bool p_enable);
+	bool is_using_connection_pool() const;
+
+	static void clear_connection_pool();
+
 	void set_download_chunk_size(int p_chunk_size);
 	int get_download_chunk_size() const;
 
@@ -46,6 +46,7 @@
 #include <stdint.h>
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint64_t> Node::tree_version;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
 
@@ -1302,6 +1303,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	tree_version.increment();
 }
 
 void Node::set_name(const String &p_name) {
@@ -1315,6 +1317,7 @@ void Node::set_name(const String &p_name) {
 	}
 	String old_name = data.name;
 	data.name = name;
+	tree_version.increment();
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
@@ -1522,6 +1525,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	tree_version.increment();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1623,6 +1627,7 @@ void Node::remove_child(Node *p_child) {
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	tree_version.increment();
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
@@ -1726,6 +1731,40 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	if (p_path.get_name_count() < 2 && !p_path.is_absolute()) {
+		// A single lookup in the children or unique names, not worth caching.
+		return _resolve_node_path(p_path);
+	}
+
+	uint64_t version = tree_version.get();
+	if (data.node_path_cache) {
+		if (data.node_path_cache_version != version) {
+			data.node_path_cache->clear();
+		} else {
+			Node **cached = data.node_path_cache->getptr(p_path);
+			if (cached) {
+				return *cached;
+			}
+		}
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	if (!node) {
+		return nullptr;
+	}
+
+	if (!data.node_path_cache) {
+		data.node_path_cache = memnew((HashMap<NodePath, Node *>));
+	} else if (data.node_path_cache->size() >= NODE_PATH_CACHE_MAX) {
+		data.node_path_cache->clear();
+	}
+	data.node_path_cache->insert(p_path, node);
+	data.node_path_cache_version = version;
+
+	return node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -2034,6 +2073,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 
 	ERR_FAIL_COND(data.owner);
 	data.owner = p_owner;
+	tree_version.increment();
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
 
@@ -2048,6 +2088,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	tree_version.increment();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2062,6 +2103,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	tree_version.increment();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2132,6 +2174,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	tree_version.increment();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -3844,6 +3887,12 @@ Node::~Node() {
 	data.children.clear();
 	data.children_cache.clear();
 
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
+	// Paths resolved to this node must not be reused.
+	tree_version.increment();
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children_cache.size());
 
@@ -129,6 +129,13 @@ public:
 
 	static int orphan_node_count;
 
+	// Bumped whenever a node is added, removed, renamed or changes its unique name or owner,
+	// so cached path lookups know when they need to be resolved again.
+	static SafeNumeric<uint64_t> tree_version;
+
+	// Number of multi-name paths remembered by each node before the cache is cleared.
+	static constexpr int NODE_PATH_CACHE_MAX = 32;
+
 	void _update_process(bool p_enable, bool p_for_children);
 
 private:
@@ -242,6 +249,9 @@ private:
 
 		mutable NodePath *path_cache = nullptr;
 
+		mutable HashMap<NodePath, Node *> *node_path_cache = nullptr;
+		mutable uint64_t node_path_cache_version = 0;
+
 	} data;
 
 	Ref<MultiplayerAPI> multiplayer;
@@ -250,6 +260,7 @@ private:
 	String _get_tree_string(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	Node *_resolve_node_path(const NodePath &p_path) const;
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -430,6 +441,7 @@ public:
 	bool has_node(const NodePath &p_path) const;
 	Node *get_node(const NodePath &p_path) const;
 	Node *get_node_or_null(const NodePath &p_path) const;
+	_FORCE_INLINE_ static uint64_t get_tree_version() { return tree_version.get(); }
 	Node *find_child(const String &p_pattern, bool p_recursive = true, bool p_owned = true) const;
 	TypedArray<Node> find_children(const String &p_pattern, const String &p_type = "", bool p_recursive = true, bool p_owned = true) const;
 	bool has_node_and_resource(const NodePath &p_path) const;
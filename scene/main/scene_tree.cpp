@@ -45,9 +45,10 @@
 #include "node.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
-#include "scene/gui/control.h"
+#include "scene/gui/container.h"
 #include "scene/main/multiplayer_api.h"
 #include "scene/main/viewport.h"
+#include "scene/resources/compressed_texture.h"
 #include "scene/resources/environment.h"
 #include "scene/resources/font.h"
 #include "scene/resources/image_texture.h"
@@ -178,6 +179,8 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_change_epoch++;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -225,6 +228,28 @@ void SceneTree::_update_group_order(Group &g) {
 	g.changed = false;
 }
 
+void SceneTree::_call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallMethodCache &r_cache) {
+	ScriptInstance *script_instance = p_node->get_script_instance();
+	const StringName &class_name = p_node->get_class_name();
+	if (!r_cache.resolved || r_cache.class_name != class_name || r_cache.script.ptr() != (script_instance ? script_instance->get_script().ptr() : nullptr)) {
+		r_cache.class_name = class_name;
+		r_cache.script = script_instance ? script_instance->get_script() : Ref<Script>();
+		r_cache.method = nullptr;
+		// Methods defined by the script, and `free()`, still go through `callp()`.
+		if (p_function != CoreStringName(free_) && (r_cache.script.is_null() || !r_cache.script->has_method(p_function))) {
+			r_cache.method = ClassDB::get_method(class_name, p_function);
+		}
+		r_cache.resolved = true;
+	}
+
+	Callable::CallError ce;
+	if (r_cache.method) {
+		p_node->call_method_bind(r_cache.method, p_args, p_argcount, ce);
+	} else {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+	}
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
@@ -264,8 +289,11 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	// Only read from the copy: writing would duplicate the node list, which is otherwise
+	// shared with the group until the group itself changes.
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
+	GroupCallMethodCache method_cache;
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -279,8 +307,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, method_cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -293,8 +320,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, method_cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -328,7 +354,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -390,7 +416,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -510,6 +536,9 @@ bool SceneTree::process(double p_time) {
 
 	process_time = p_time;
 
+	layout_passes_last_frame = layout_passes;
+	layout_passes = 0;
+
 	if (multiplayer_poll) {
 		multiplayer->poll();
 		for (KeyValue<NodePath, Ref<MultiplayerAPI>> &E : custom_multiplayers) {
@@ -539,6 +568,10 @@ bool SceneTree::process(double p_time) {
 
 	process_tweens(p_time, false);
 
+	_flush_threaded_instances();
+
+	CompressedTexture2D::update_streaming();
+
 	flush_transform_notifications(); //additional transforms after timers update
 
 	_call_idle_callbacks();
@@ -609,31 +642,110 @@ void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
 	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
+	// Tweens created while stepping are appended after the current ones and wait for the next frame.
+	const uint32_t count = tweens.size();
+	uint32_t alive = 0;
+
+	for (uint32_t i = 0; i < count; i++) {
+		// Copied, as creating a Tween while stepping may reallocate the array.
+		Ref<Tween> tween = tweens[i];
 
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
-			}
-			E = N;
+		if (tween->can_process(paused) && (p_physics != (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE)) && !tween->step(p_delta)) {
+			tween->clear();
 			continue;
 		}
+		tweens[alive++] = tween;
+	}
 
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
+	if (alive < count) {
+		// Compact finished Tweens away, keeping the processing order.
+		for (uint32_t i = count; i < tweens.size(); i++) {
+			tweens[alive++] = tweens[i];
 		}
-		if (E == L) {
+		tweens.resize(alive);
+	}
+}
+
+bool SceneTree::LayoutDeepestFirst::operator()(const LayoutItem &p_left, const LayoutItem &p_right) const {
+	// The heap pops its greatest item first.
+	if (p_left.depth == p_right.depth) {
+		return p_left.order > p_right.order;
+	}
+	return p_left.depth < p_right.depth;
+}
+
+bool SceneTree::LayoutShallowestFirst::operator()(const LayoutItem &p_left, const LayoutItem &p_right) const {
+	if (p_left.depth == p_right.depth) {
+		return p_left.order > p_right.order;
+	}
+	return p_left.depth > p_right.depth;
+}
+
+void SceneTree::_queue_layout_pass() {
+	if (layout_pass_queued) {
+		return;
+	}
+	layout_pass_queued = true;
+	callable_mp(this, &SceneTree::_flush_layout).call_deferred();
+}
+
+void SceneTree::_queue_minimum_size_update(Control *p_control) {
+	// Control has its own data, the depth is kept by Node.
+	const LayoutItem item = { p_control->get_instance_id(), static_cast<Node *>(p_control)->data.depth, layout_order++ };
+	layout_minimum_size_heap.push_back(item);
+	SortArray<LayoutItem, LayoutDeepestFirst> sorter;
+	sorter.push_heap(0, layout_minimum_size_heap.size() - 1, 0, item, layout_minimum_size_heap.ptr());
+	_queue_layout_pass();
+}
+
+void SceneTree::_queue_sort(Container *p_container) {
+	const LayoutItem item = { p_container->get_instance_id(), static_cast<Node *>(p_container)->data.depth, layout_order++ };
+	layout_sort_heap.push_back(item);
+	SortArray<LayoutItem, LayoutShallowestFirst> sorter;
+	sorter.push_heap(0, layout_sort_heap.size() - 1, 0, item, layout_sort_heap.ptr());
+	_queue_layout_pass();
+}
+
+void SceneTree::_flush_layout() {
+	layout_passes++;
+
+	SortArray<LayoutItem, LayoutDeepestFirst> minimum_size_sorter;
+	SortArray<LayoutItem, LayoutShallowestFirst> sort_sorter;
+
+	// Anything queued while flushing joins this pass. A child changing its minimum size queues its parent,
+	// and sorting a Container resizes its children, so each is usually handled once per pass.
+	while (true) {
+		if (!layout_minimum_size_heap.is_empty()) {
+			minimum_size_sorter.pop_heap(0, layout_minimum_size_heap.size(), layout_minimum_size_heap.ptr());
+			const ObjectID id = layout_minimum_size_heap[layout_minimum_size_heap.size() - 1].id;
+			layout_minimum_size_heap.resize(layout_minimum_size_heap.size() - 1);
+
+			Control *control = Object::cast_to<Control>(ObjectDB::get_instance(id));
+			if (control) {
+				control->_update_minimum_size();
+			}
+		} else if (!layout_sort_heap.is_empty()) {
+			// Sorting waits until all minimum sizes are known, they may change again when children are resized.
+			sort_sorter.pop_heap(0, layout_sort_heap.size(), layout_sort_heap.ptr());
+			const ObjectID id = layout_sort_heap[layout_sort_heap.size() - 1].id;
+			layout_sort_heap.resize(layout_sort_heap.size() - 1);
+
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(id));
+			if (container) {
+				container->_sort_children();
+			}
+		} else {
 			break;
 		}
-		E = N;
 	}
+
+	layout_pass_queued = false;
 }
 
 void SceneTree::finalize() {
+	_clear_threaded_instances();
+
 	_flush_delete_queue();
 
 	_flush_ugc();
@@ -1181,7 +1293,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -1300,7 +1412,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 	ret.resize(nc);
 
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		ret[i] = ptr[i];
 	}
@@ -1351,7 +1463,7 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	if (nc == 0) {
 		return;
 	}
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		p_list->push_back(ptr[i]);
 	}
@@ -1491,15 +1603,91 @@ Ref<Tween> SceneTree::create_tween() {
 	return tween;
 }
 
+void SceneTree::_instantiate_threaded_task(void *p_userdata) {
+	ThreadedInstance *ti = (ThreadedInstance *)p_userdata;
+	// The hierarchy is not inside the tree yet, so it can be built from this thread.
+	ti->node = ti->scene->instantiate();
+}
+
+void SceneTree::instantiate_threaded(const Ref<PackedScene> &p_scene, Node *p_parent, const Callable &p_callback) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND(p_scene.is_null());
+	ERR_FAIL_NULL(p_parent);
+
+	ThreadedInstance *ti = memnew(ThreadedInstance);
+	ti->scene = p_scene;
+	ti->parent = p_parent->get_instance_id();
+	ti->callback = p_callback;
+	ti->task_id = WorkerThreadPool::get_singleton()->add_native_task(&SceneTree::_instantiate_threaded_task, ti, false, "Instantiate " + p_scene->get_path());
+	threaded_instances.push_back(ti);
+}
+
+int SceneTree::get_threaded_instance_count() const {
+	_THREAD_SAFE_METHOD_
+	return threaded_instances.size();
+}
+
+void SceneTree::_flush_threaded_instances() {
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+
+	while (true) {
+		ThreadedInstance *ti = nullptr;
+		{
+			_THREAD_SAFE_METHOD_
+			if (threaded_instances.is_empty()) {
+				return;
+			}
+			// Keep the request order, a later scene must not enter the tree before an earlier one.
+			ti = threaded_instances.front()->get();
+			if (!WorkerThreadPool::get_singleton()->is_task_completed(ti->task_id)) {
+				return;
+			}
+			threaded_instances.pop_front();
+		}
+
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ti->task_id);
+
+		Node *parent = Object::cast_to<Node>(ObjectDB::get_instance(ti->parent));
+		if (ti->node) {
+			if (parent) {
+				parent->add_child(ti->node);
+				if (ti->callback.is_valid()) {
+					ti->callback.call(ti->node);
+				}
+			} else {
+				memdelete(ti->node);
+			}
+		} else {
+			ERR_PRINT("Failed to instantiate scene '" + ti->scene->get_path() + "' on a worker thread.");
+		}
+		memdelete(ti);
+
+		// A single insertion can't be split, so at least one scene is added each frame.
+		if (OS::get_singleton()->get_ticks_usec() - start >= threaded_instance_budget_usec) {
+			return;
+		}
+	}
+}
+
+void SceneTree::_clear_threaded_instances() {
+	_THREAD_SAFE_METHOD_
+	for (ThreadedInstance *ti : threaded_instances) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ti->task_id);
+		if (ti->node) {
+			memdelete(ti->node);
+		}
+		memdelete(ti);
+	}
+	threaded_instances.clear();
+}
+
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Tween> ret;
 	ret.resize(tweens.size());
 
-	int i = 0;
-	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+	for (uint32_t i = 0; i < tweens.size(); i++) {
+		ret[i] = tweens[i];
 	}
 
 	return ret;
@@ -1608,6 +1796,8 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_timer", "time_sec", "process_always", "process_in_physics", "ignore_time_scale"), &SceneTree::create_timer, DEFVAL(true), DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("create_tween"), &SceneTree::create_tween);
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
+	ClassDB::bind_method(D_METHOD("instantiate_threaded", "scene", "parent", "callback"), &SceneTree::instantiate_threaded, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("get_threaded_instance_count"), &SceneTree::get_threaded_instance_count);
 
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
@@ -1736,6 +1926,8 @@ SceneTree::SceneTree() {
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
+	threaded_instance_budget_usec = uint64_t(double(GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "application/run/threaded_instantiation_budget_msec", PROPERTY_HINT_RANGE, "0,100,0.1,or_greater"), 2.0)) * 1000.0);
+
 	process_group_call_queue_allocator = memnew(CallQueue::Allocator(64));
 	Math::randomize();
 
@@ -1801,7 +1993,7 @@ SceneTree::SceneTree() {
 	root->set_snap_2d_vertices_to_pixel(snap_2d_vertices);
 
 	// We setup VRS for the main viewport here, in the editor this will have little effect.
-	const int vrs_mode = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/vrs/mode", PROPERTY_HINT_ENUM, String::utf8("Disabled,Texture,XR")), 0);
+	const int vrs_mode = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/vrs/mode", PROPERTY_HINT_ENUM, String::utf8("Disabled,Texture,XR,Adaptive")), 0);
 	root->set_vrs_mode(Viewport::VRSMode(vrs_mode));
 	const String vrs_texture_path = String(GLOBAL_DEF(PropertyInfo(Variant::STRING, "rendering/vrs/texture", PROPERTY_HINT_FILE, "*.bmp,*.png,*.tga,*.webp"), String())).strip_edges();
 	if (vrs_mode == 1 && !vrs_texture_path.is_empty()) {
@@ -31,6 +31,7 @@
 #ifndef SCENE_TREE_H
 #define SCENE_TREE_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
@@ -48,6 +49,8 @@ class MultiplayerAPI;
 class SceneDebugger;
 class Tween;
 class Viewport;
+class Control;
+class Container;
 
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
@@ -174,6 +177,16 @@ private:
 
 	_FORCE_INLINE_ void _update_group_order(Group &g);
 
+	// Method of a group call, resolved once per script and native class
+	// instead of once per node. Groups are usually made of nodes of one kind.
+	struct GroupCallMethodCache {
+		StringName class_name;
+		Ref<Script> script;
+		MethodBind *method = nullptr;
+		bool resolved = false;
+	};
+	static void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallMethodCache &r_cache);
+
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
 	Node *current_scene = nullptr;
@@ -192,7 +205,23 @@ private:
 	void _flush_scene_change();
 
 	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	LocalVector<Ref<Tween>> tweens;
+
+	// Scenes instantiated on the worker thread pool, added to their parent from the main thread in request order.
+	struct ThreadedInstance {
+		Ref<PackedScene> scene;
+		ObjectID parent;
+		Callable callback;
+		Node *node = nullptr;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	List<ThreadedInstance *> threaded_instances;
+	uint64_t threaded_instance_budget_usec = 0;
+
+	static void _instantiate_threaded_task(void *p_userdata);
+	void _flush_threaded_instances();
+	void _clear_threaded_instances();
 
 	///network///
 
@@ -233,6 +262,39 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Incremented on every flush of the list above, so Node3D can tell what it already propagated since.
+	uint64_t xform_change_epoch = 1;
+
+	// Single layout pass run from the MessageQueue, replacing a deferred call per Control and Container.
+	// Minimum sizes are settled deepest first, then Containers are sorted shallowest first.
+	struct LayoutItem {
+		ObjectID id;
+		int depth = 0;
+		uint64_t order = 0; // Keeps the request order between nodes at the same depth.
+	};
+
+	struct LayoutDeepestFirst {
+		_FORCE_INLINE_ bool operator()(const LayoutItem &p_left, const LayoutItem &p_right) const;
+	};
+
+	struct LayoutShallowestFirst {
+		_FORCE_INLINE_ bool operator()(const LayoutItem &p_left, const LayoutItem &p_right) const;
+	};
+
+	LocalVector<LayoutItem> layout_minimum_size_heap;
+	LocalVector<LayoutItem> layout_sort_heap;
+	uint64_t layout_order = 0;
+	bool layout_pass_queued = false;
+	uint32_t layout_passes = 0;
+	uint32_t layout_passes_last_frame = 0;
+
+	friend class Control;
+	friend class Container;
+
+	void _queue_layout_pass();
+	void _queue_minimum_size_update(Control *p_control);
+	void _queue_sort(Container *p_container);
+	void _flush_layout();
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -399,6 +461,11 @@ public:
 	Ref<Tween> create_tween();
 	TypedArray<Tween> get_processed_tweens();
 
+	uint32_t get_layout_passes_in_last_frame() const { return layout_passes_last_frame; }
+
+	void instantiate_threaded(const Ref<PackedScene> &p_scene, Node *p_parent, const Callable &p_callback = Callable());
+	int get_threaded_instance_count() const;
+
 	//used by Main::start, don't use otherwise
 	void add_current_scene(Node *p_current);
 
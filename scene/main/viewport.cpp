@@ -1630,21 +1630,58 @@ Control *Viewport::gui_find_control(const Point2 &p_global) {
 	// Handle subwindows.
 	_gui_sort_roots();
 
+	LocalVector<GUIHitTestIndex::Root> roots;
 	for (List<Control *>::Element *E = gui.roots.back(); E; E = E->prev()) {
 		Control *sw = E->get();
 		if (!sw->is_visible_in_tree()) {
 			continue;
 		}
 
-		Transform2D xform;
+		GUIHitTestIndex::Root root;
+		root.control = sw;
 		CanvasItem *pci = sw->get_parent_item();
 		if (pci) {
-			xform = pci->get_global_transform_with_canvas();
+			root.xform = pci->get_global_transform_with_canvas();
 		} else {
-			xform = sw->get_canvas_transform();
+			root.xform = sw->get_canvas_transform();
+		}
+		roots.push_back(root);
+	}
+
+	// The drag preview is excluded from the results, which the index doesn't know about.
+	if (!_gui_get_drag_preview()) {
+		uint64_t tree_version = Node::get_tree_version();
+		uint64_t layout_version = Control::gui_layout_version.get();
+
+		bool changed = gui_hit_index.tree_version != tree_version || gui_hit_index.layout_version != layout_version || gui_hit_index.roots.size() != roots.size();
+		for (uint32_t i = 0; !changed && i < roots.size(); i++) {
+			// Canvas layers and parents of the roots may have moved.
+			changed = !(gui_hit_index.roots[i] == roots[i]);
+		}
+
+		if (changed) {
+			// Building the index costs about as much as a regular search, so wait until the layout stops changing.
+			gui_hit_index.valid = false;
+			gui_hit_index.tree_version = tree_version;
+			gui_hit_index.layout_version = layout_version;
+			gui_hit_index.roots = roots;
+		} else if (!gui_hit_index.valid) {
+			gui_hit_index.entries.clear();
+			gui_hit_index.cells.clear();
+			gui_hit_index.unbounded.clear();
+			for (const GUIHitTestIndex::Root &root : roots) {
+				_gui_hit_index_add(root.control, root.xform, -1);
+			}
+			gui_hit_index.valid = true;
+		}
+
+		if (gui_hit_index.valid) {
+			return _gui_hit_index_find(p_global);
 		}
+	}
 
-		Control *ret = _gui_find_control_at_pos(sw, p_global, xform);
+	for (const GUIHitTestIndex::Root &root : roots) {
+		Control *ret = _gui_find_control_at_pos(root.control, p_global, root.xform);
 		if (ret) {
 			return ret;
 		}
@@ -1653,6 +1690,112 @@ Control *Viewport::gui_find_control(const Point2 &p_global) {
 	return nullptr;
 }
 
+void Viewport::_gui_hit_index_add(CanvasItem *p_node, const Transform2D &p_xform, int32_t p_clip_parent) {
+	// Mirrors _gui_find_control_at_pos(), entries are added in the order the controls are tested there.
+	if (!p_node->is_visible()) {
+		return;
+	}
+
+	Transform2D matrix = p_xform * p_node->get_transform();
+	if (matrix.determinant() == 0.0f) {
+		return;
+	}
+
+	Control *c = Object::cast_to<Control>(p_node);
+	if (c) {
+		// Transform changes are only notified to items whose global transform is up to date, make sure it is.
+		c->get_global_transform();
+	}
+
+	int32_t children_clip_parent = p_clip_parent;
+	if (c && c->is_clipping_contents()) {
+		// Only used to clip the children, never returned.
+		GUIHitTestIndex::Entry clip;
+		clip.control = c;
+		clip.inv_xform = matrix.affine_inverse();
+		clip.clip_parent = p_clip_parent;
+		children_clip_parent = gui_hit_index.entries.size();
+		gui_hit_index.entries.push_back(clip);
+	}
+
+	for (int i = p_node->get_child_count() - 1; i >= 0; i--) {
+		CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
+		if (!ci || ci->is_set_as_top_level()) {
+			continue;
+		}
+		_gui_hit_index_add(ci, matrix, children_clip_parent);
+	}
+
+	if (!c || c->data.mouse_filter == Control::MOUSE_FILTER_IGNORE) {
+		return;
+	}
+
+	GUIHitTestIndex::Entry entry;
+	entry.control = c;
+	entry.inv_xform = matrix.affine_inverse();
+	entry.clip_parent = p_clip_parent;
+	uint32_t entry_index = gui_hit_index.entries.size();
+	gui_hit_index.entries.push_back(entry);
+
+	Rect2 rect = matrix.xform(Rect2(Point2(), c->get_size()));
+	Vector2i from = (rect.position / GUIHitTestIndex::CELL_SIZE).floor();
+	Vector2i to = (rect.get_end() / GUIHitTestIndex::CELL_SIZE).floor();
+	int64_t cell_count = int64_t(to.x - from.x + 1) * int64_t(to.y - from.y + 1);
+
+	if (GDVIRTUAL_IS_OVERRIDDEN_PTR(c, _has_point) || !rect.is_finite() || cell_count > GUIHitTestIndex::MAX_CELLS_PER_ENTRY) {
+		gui_hit_index.unbounded.push_back(entry_index);
+		return;
+	}
+
+	for (int y = from.y; y <= to.y; y++) {
+		for (int x = from.x; x <= to.x; x++) {
+			gui_hit_index.cells[Vector2i(x, y)].push_back(entry_index);
+		}
+	}
+}
+
+bool Viewport::_gui_hit_index_has_point(const GUIHitTestIndex::Entry &p_entry, const Point2 &p_global) const {
+	if (!p_entry.control->has_point(p_entry.inv_xform.xform(p_global))) {
+		return false;
+	}
+
+	for (int32_t clip = p_entry.clip_parent; clip != -1; clip = gui_hit_index.entries[clip].clip_parent) {
+		const GUIHitTestIndex::Entry &clip_entry = gui_hit_index.entries[clip];
+		if (!clip_entry.control->has_point(clip_entry.inv_xform.xform(p_global))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+Control *Viewport::_gui_hit_index_find(const Point2 &p_global) const {
+	static const LocalVector<uint32_t> empty;
+	const LocalVector<uint32_t> *cell = gui_hit_index.cells.getptr((p_global / GUIHitTestIndex::CELL_SIZE).floor());
+	if (!cell) {
+		cell = &empty;
+	}
+
+	// Both lists are sorted in hit test order, the first entry containing the point wins.
+	uint32_t cell_pos = 0;
+	uint32_t unbounded_pos = 0;
+	while (cell_pos < cell->size() || unbounded_pos < gui_hit_index.unbounded.size()) {
+		uint32_t index;
+		if (unbounded_pos == gui_hit_index.unbounded.size() || (cell_pos < cell->size() && (*cell)[cell_pos] < gui_hit_index.unbounded[unbounded_pos])) {
+			index = (*cell)[cell_pos++];
+		} else {
+			index = gui_hit_index.unbounded[unbounded_pos++];
+		}
+
+		const GUIHitTestIndex::Entry &entry = gui_hit_index.entries[index];
+		if (_gui_hit_index_has_point(entry, p_global)) {
+			return entry.control;
+		}
+	}
+
+	return nullptr;
+}
+
 Control *Viewport::_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform) {
 	if (!p_node->is_visible()) {
 		return nullptr; // Canvas item hidden, discard.
@@ -2432,9 +2575,9 @@ void Viewport::_gui_update_mouse_over() {
 	}
 
 	// Rebuild the mouse over hierarchy.
-	LocalVector<Control *> new_mouse_over_hierarchy;
-	LocalVector<Control *> needs_enter;
-	LocalVector<int> needs_exit;
+	LocalVector<Control *, uint32_t, false, false, FrameArenaAllocator> new_mouse_over_hierarchy;
+	LocalVector<Control *, uint32_t, false, false, FrameArenaAllocator> needs_enter;
+	LocalVector<int, uint32_t, false, false, FrameArenaAllocator> needs_exit;
 
 	CanvasItem *ancestor = gui.mouse_over;
 	bool removing = false;
@@ -3322,6 +3465,20 @@ void Viewport::_push_unhandled_input_internal(const Ref<InputEvent> &p_event) {
 						Object::cast_to<InputEventScreenTouch>(*p_event)
 
 								)) {
+			Ref<InputEventMouseMotion> mm = p_event;
+			if (mm.is_valid() && !physics_picking_events.is_empty() && Input::get_singleton()->is_using_accumulated_input()) {
+				// Picking only needs the latest position, merge consecutive motions so they cost a single query per frame.
+				Ref<InputEventMouseMotion> last = physics_picking_events.back()->get();
+				if (last.is_valid() && last->get_device() == mm->get_device()) {
+					Ref<InputEventMouseMotion> merged = last->xformed_by(Transform2D());
+					if (merged->accumulate(mm)) {
+						physics_picking_events.back()->get() = merged;
+						set_input_as_handled();
+						return;
+					}
+				}
+			}
+
 			physics_picking_events.push_back(p_event);
 			set_input_as_handled();
 		}
@@ -3731,6 +3888,9 @@ void Viewport::set_vrs_mode(Viewport::VRSMode p_vrs_mode) {
 		case VRS_XR: {
 			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_XR);
 		} break;
+		case VRS_ADAPTIVE: {
+			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_ADAPTIVE);
+		} break;
 		default: {
 			RS::get_singleton()->viewport_set_vrs_mode(viewport, RS::VIEWPORT_VRS_DISABLED);
 		} break;
@@ -4587,6 +4747,60 @@ float Viewport::get_scaling_3d_scale() const {
 	return scaling_3d_scale;
 }
 
+void Viewport::set_scaling_3d_dynamic(bool p_enabled) {
+	ERR_MAIN_THREAD_GUARD;
+	if (scaling_3d_dynamic == p_enabled) {
+		return;
+	}
+
+	scaling_3d_dynamic = p_enabled;
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic(viewport, scaling_3d_dynamic, scaling_3d_dynamic_min_scale, scaling_3d_dynamic_max_scale, scaling_3d_dynamic_target_time);
+}
+
+bool Viewport::is_scaling_3d_dynamic() const {
+	ERR_READ_THREAD_GUARD_V(false);
+	return scaling_3d_dynamic;
+}
+
+void Viewport::set_scaling_3d_dynamic_min_scale(float p_min_scale) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_min_scale = CLAMP(p_min_scale, 0.1, 2.0);
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic(viewport, scaling_3d_dynamic, scaling_3d_dynamic_min_scale, scaling_3d_dynamic_max_scale, scaling_3d_dynamic_target_time);
+}
+
+float Viewport::get_scaling_3d_dynamic_min_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_min_scale;
+}
+
+void Viewport::set_scaling_3d_dynamic_max_scale(float p_max_scale) {
+	ERR_MAIN_THREAD_GUARD;
+	scaling_3d_dynamic_max_scale = CLAMP(p_max_scale, 0.1, 2.0);
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic(viewport, scaling_3d_dynamic, scaling_3d_dynamic_min_scale, scaling_3d_dynamic_max_scale, scaling_3d_dynamic_target_time);
+}
+
+float Viewport::get_scaling_3d_dynamic_max_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_max_scale;
+}
+
+void Viewport::set_scaling_3d_dynamic_target_time(float p_target_time_msec) {
+	ERR_MAIN_THREAD_GUARD;
+	ERR_FAIL_COND_MSG(p_target_time_msec <= 0.0, "Dynamic 3D scaling target time must be greater than 0.");
+	scaling_3d_dynamic_target_time = p_target_time_msec;
+	RS::get_singleton()->viewport_set_scaling_3d_dynamic(viewport, scaling_3d_dynamic, scaling_3d_dynamic_min_scale, scaling_3d_dynamic_max_scale, scaling_3d_dynamic_target_time);
+}
+
+float Viewport::get_scaling_3d_dynamic_target_time() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return scaling_3d_dynamic_target_time;
+}
+
+float Viewport::get_scaling_3d_dynamic_current_scale() const {
+	ERR_READ_THREAD_GUARD_V(0);
+	return RS::get_singleton()->viewport_get_scaling_3d_dynamic_scale(viewport);
+}
+
 void Viewport::set_fsr_sharpness(float p_fsr_sharpness) {
 	ERR_MAIN_THREAD_GUARD;
 	if (fsr_sharpness == p_fsr_sharpness) {
@@ -4796,6 +5010,20 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_scaling_3d_scale", "scale"), &Viewport::set_scaling_3d_scale);
 	ClassDB::bind_method(D_METHOD("get_scaling_3d_scale"), &Viewport::get_scaling_3d_scale);
 
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic", "enabled"), &Viewport::set_scaling_3d_dynamic);
+	ClassDB::bind_method(D_METHOD("is_scaling_3d_dynamic"), &Viewport::is_scaling_3d_dynamic);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_min_scale", "scale"), &Viewport::set_scaling_3d_dynamic_min_scale);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_min_scale"), &Viewport::get_scaling_3d_dynamic_min_scale);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_max_scale", "scale"), &Viewport::set_scaling_3d_dynamic_max_scale);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_max_scale"), &Viewport::get_scaling_3d_dynamic_max_scale);
+
+	ClassDB::bind_method(D_METHOD("set_scaling_3d_dynamic_target_time", "msec"), &Viewport::set_scaling_3d_dynamic_target_time);
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_target_time"), &Viewport::get_scaling_3d_dynamic_target_time);
+
+	ClassDB::bind_method(D_METHOD("get_scaling_3d_dynamic_current_scale"), &Viewport::get_scaling_3d_dynamic_current_scale);
+
 	ClassDB::bind_method(D_METHOD("set_fsr_sharpness", "fsr_sharpness"), &Viewport::set_fsr_sharpness);
 	ClassDB::bind_method(D_METHOD("get_fsr_sharpness"), &Viewport::get_fsr_sharpness);
 
@@ -4836,10 +5064,14 @@ void Viewport::_bind_methods() {
 	ADD_GROUP("Scaling 3D", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "scaling_3d_mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),FSR 2.2 (Slow)"), "set_scaling_3d_mode", "get_scaling_3d_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_scale", "get_scaling_3d_scale");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scaling_3d_dynamic"), "set_scaling_3d_dynamic", "is_scaling_3d_dynamic");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_min_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_dynamic_min_scale", "get_scaling_3d_dynamic_min_scale");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_max_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_dynamic_max_scale", "get_scaling_3d_dynamic_max_scale");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_dynamic_target_time", PROPERTY_HINT_RANGE, "1,100,0.1,suffix:ms"), "set_scaling_3d_dynamic_target_time", "get_scaling_3d_dynamic_target_time");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), "set_texture_mipmap_bias", "get_texture_mipmap_bias");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), "set_fsr_sharpness", "get_fsr_sharpness");
 	ADD_GROUP("Variable Rate Shading", "vrs_");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_mode", PROPERTY_HINT_ENUM, "Disabled,Texture,Depth buffer,XR"), "set_vrs_mode", "get_vrs_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_mode", PROPERTY_HINT_ENUM, "Disabled,Texture,XR,Adaptive"), "set_vrs_mode", "get_vrs_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "vrs_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,Always"), "set_vrs_update_mode", "get_vrs_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "vrs_texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_vrs_texture", "get_vrs_texture");
 #endif
@@ -4903,6 +5135,7 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_INFO_OBJECTS_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_PRIMITIVES_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_INFO_BATCHES_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_INFO_MAX);
 
 	BIND_ENUM_CONSTANT(RENDER_INFO_TYPE_VISIBLE);
@@ -4963,6 +5196,7 @@ void Viewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(VRS_DISABLED);
 	BIND_ENUM_CONSTANT(VRS_TEXTURE);
 	BIND_ENUM_CONSTANT(VRS_XR);
+	BIND_ENUM_CONSTANT(VRS_ADAPTIVE);
 	BIND_ENUM_CONSTANT(VRS_MAX);
 
 	BIND_ENUM_CONSTANT(VRS_UPDATE_DISABLED);
@@ -4976,7 +5210,7 @@ void Viewport::_validate_property(PropertyInfo &p_property) const {
 		p_property.usage = PROPERTY_USAGE_NO_EDITOR;
 	}
 
-	if (vrs_mode == VRS_DISABLED && (p_property.name == "vrs_update_mode")) {
+	if ((vrs_mode == VRS_DISABLED || vrs_mode == VRS_ADAPTIVE) && (p_property.name == "vrs_update_mode")) {
 		p_property.usage = PROPERTY_USAGE_NO_EDITOR;
 	}
 }
@@ -5019,6 +5253,10 @@ Viewport::Viewport() {
 #ifndef _3D_DISABLED
 	set_scaling_3d_mode((Viewport::Scaling3DMode)(int)GLOBAL_GET("rendering/scaling_3d/mode"));
 	set_scaling_3d_scale(GLOBAL_GET("rendering/scaling_3d/scale"));
+	set_scaling_3d_dynamic_min_scale(GLOBAL_GET("rendering/scaling_3d/dynamic_min_scale"));
+	set_scaling_3d_dynamic_max_scale(GLOBAL_GET("rendering/scaling_3d/dynamic_max_scale"));
+	set_scaling_3d_dynamic_target_time(GLOBAL_GET("rendering/scaling_3d/dynamic_target_time"));
+	set_scaling_3d_dynamic(GLOBAL_GET("rendering/scaling_3d/dynamic"));
 	set_fsr_sharpness((float)GLOBAL_GET("rendering/scaling_3d/fsr_sharpness"));
 	set_texture_mipmap_bias((float)GLOBAL_GET("rendering/textures/default_filters/texture_mipmap_bias"));
 #endif // _3D_DISABLED
@@ -5201,7 +5439,7 @@ void SubViewport::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "size_2d_override_stretch"), "set_size_2d_override_stretch", "is_size_2d_override_stretch_enabled");
 	ADD_GROUP("Render Target", "render_target_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_clear_mode", PROPERTY_HINT_ENUM, "Always,Never,Next Frame"), "set_clear_mode", "get_clear_mode");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,When Visible,When Parent Visible,Always"), "set_update_mode", "get_update_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "render_target_update_mode", PROPERTY_HINT_ENUM, "Disabled,Once,When Visible,When Parent Visible,Always,Budget"), "set_update_mode", "get_update_mode");
 
 	BIND_ENUM_CONSTANT(CLEAR_MODE_ALWAYS);
 	BIND_ENUM_CONSTANT(CLEAR_MODE_NEVER);
@@ -5212,6 +5450,7 @@ void SubViewport::_bind_methods() {
 	BIND_ENUM_CONSTANT(UPDATE_WHEN_VISIBLE);
 	BIND_ENUM_CONSTANT(UPDATE_WHEN_PARENT_VISIBLE);
 	BIND_ENUM_CONSTANT(UPDATE_ALWAYS);
+	BIND_ENUM_CONSTANT(UPDATE_BUDGET);
 }
 
 void SubViewport::_validate_property(PropertyInfo &p_property) const {
@@ -132,6 +132,7 @@ public:
 		RENDER_INFO_OBJECTS_IN_FRAME,
 		RENDER_INFO_PRIMITIVES_IN_FRAME,
 		RENDER_INFO_DRAW_CALLS_IN_FRAME,
+		RENDER_INFO_BATCHES_IN_FRAME,
 		RENDER_INFO_MAX
 	};
 
@@ -210,6 +211,7 @@ public:
 		VRS_DISABLED,
 		VRS_TEXTURE,
 		VRS_XR,
+		VRS_ADAPTIVE,
 		VRS_MAX
 	};
 
@@ -300,6 +302,10 @@ private:
 
 	Scaling3DMode scaling_3d_mode = SCALING_3D_MODE_BILINEAR;
 	float scaling_3d_scale = 1.0;
+	bool scaling_3d_dynamic = false;
+	float scaling_3d_dynamic_min_scale = 0.5;
+	float scaling_3d_dynamic_max_scale = 1.0;
+	float scaling_3d_dynamic_target_time = 16.0;
 	float fsr_sharpness = 0.2f;
 	float texture_mipmap_bias = 0.0f;
 	bool use_debanding = false;
@@ -397,6 +403,36 @@ private:
 		Vector<SubWindow> sub_windows; // Don't obtain references or pointers to the elements, as their location can change.
 	} gui;
 
+	// Controls reachable from the GUI roots, flattened in hit test order and bucketed on a screen grid,
+	// so gui_find_control() doesn't need to walk the whole tree for every mouse event.
+	struct GUIHitTestIndex {
+		static constexpr real_t CELL_SIZE = 64.0;
+		static constexpr int MAX_CELLS_PER_ENTRY = 64;
+
+		struct Entry {
+			Control *control = nullptr;
+			Transform2D inv_xform;
+			int32_t clip_parent = -1; // Closest ancestor clipping its contents.
+		};
+
+		struct Root {
+			Control *control = nullptr;
+			Transform2D xform;
+
+			bool operator==(const Root &p_other) const { return control == p_other.control && xform == p_other.xform; }
+		};
+
+		LocalVector<Entry> entries;
+		HashMap<Vector2i, LocalVector<uint32_t>> cells;
+		LocalVector<uint32_t> unbounded; // Entries too large or with a custom `_has_point()`, tested at every position.
+		bool valid = false;
+
+		// Seen by the last hit test, the index is only built once they stop changing.
+		LocalVector<Root> roots;
+		uint64_t tree_version = 0;
+		uint64_t layout_version = 0;
+	} gui_hit_index;
+
 	DefaultCanvasItemTextureFilter default_canvas_item_texture_filter = DEFAULT_CANVAS_ITEM_TEXTURE_FILTER_LINEAR;
 	DefaultCanvasItemTextureRepeat default_canvas_item_texture_repeat = DEFAULT_CANVAS_ITEM_TEXTURE_REPEAT_DISABLED;
 
@@ -407,6 +443,9 @@ private:
 
 	void _gui_sort_roots();
 	Control *_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform);
+	void _gui_hit_index_add(CanvasItem *p_node, const Transform2D &p_xform, int32_t p_clip_parent);
+	bool _gui_hit_index_has_point(const GUIHitTestIndex::Entry &p_entry, const Point2 &p_global) const;
+	Control *_gui_hit_index_find(const Point2 &p_global) const;
 
 	void _gui_input_event(Ref<InputEvent> p_event);
 	void _perform_drop(Control *p_control = nullptr, Point2 p_pos = Point2());
@@ -553,6 +592,20 @@ public:
 	void set_scaling_3d_scale(float p_scaling_3d_scale);
 	float get_scaling_3d_scale() const;
 
+	void set_scaling_3d_dynamic(bool p_enabled);
+	bool is_scaling_3d_dynamic() const;
+
+	void set_scaling_3d_dynamic_min_scale(float p_min_scale);
+	float get_scaling_3d_dynamic_min_scale() const;
+
+	void set_scaling_3d_dynamic_max_scale(float p_max_scale);
+	float get_scaling_3d_dynamic_max_scale() const;
+
+	void set_scaling_3d_dynamic_target_time(float p_target_time_msec);
+	float get_scaling_3d_dynamic_target_time() const;
+
+	float get_scaling_3d_dynamic_current_scale() const;
+
 	void set_fsr_sharpness(float p_fsr_sharpness);
 	float get_fsr_sharpness() const;
 
@@ -805,7 +858,8 @@ public:
 		UPDATE_ONCE, //then goes to disabled
 		UPDATE_WHEN_VISIBLE, // default
 		UPDATE_WHEN_PARENT_VISIBLE,
-		UPDATE_ALWAYS
+		UPDATE_ALWAYS,
+		UPDATE_BUDGET,
 	};
 
 private:
@@ -238,6 +238,7 @@
 #include "scene/3d/fog_volume.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/3d/gpu_particles_collision_3d.h"
+#include "scene/3d/hlod_instance_3d.h"
 #include "scene/3d/importer_mesh_instance_3d.h"
 #include "scene/3d/label_3d.h"
 #include "scene/3d/light_3d.h"
@@ -562,6 +563,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(XRHandModifier3D);
 	GDREGISTER_CLASS(XRFaceModifier3D);
 	GDREGISTER_CLASS(MeshInstance3D);
+	GDREGISTER_CLASS(HLODInstance3D);
 	GDREGISTER_CLASS(OccluderInstance3D);
 	GDREGISTER_ABSTRACT_CLASS(Occluder3D);
 	GDREGISTER_CLASS(ArrayOccluder3D);
@@ -1221,6 +1223,10 @@ void register_scene_types() {
 	ClassDB::add_compatibility_class("VisualShaderNodeFloatUniform", "VisualShaderNodeFloatParameter");
 #endif /* DISABLE_DEPRECATED */
 
+	// Stand-ins used when loading resources in placeholder mode (dedicated servers), payloads are not read.
+	ResourceLoader::add_placeholder_type("ArrayMesh", "PlaceholderMesh");
+	ResourceLoader::add_placeholder_type("AudioStreamWAV", "AudioStreamWAV"); // Silent without its samples.
+
 	OS::get_singleton()->yield(); // may take time to init
 
 	for (int i = 0; i < 20; i++) {
@@ -1255,6 +1261,8 @@ void unregister_scene_types() {
 
 	SceneDebugger::deinitialize();
 
+	HTTPRequest::clear_connection_pool();
+
 	ResourceLoader::remove_resource_format_loader(resource_loader_texture_layered);
 	resource_loader_texture_layered.unref();
 
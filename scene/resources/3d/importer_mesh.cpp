@@ -682,6 +682,46 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 	}
 }
 
+void ImporterMesh::generate_clusters() {
+	if (!SurfaceTool::build_clusters_func) {
+		return;
+	}
+
+	// Below this, culling individual clusters costs more than drawing the whole surface.
+	const int min_cluster_triangles = 4096;
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		surfaces.write[i].cluster_data.clear();
+
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+		// Cluster bounds are computed in rest pose, so they are only valid for static surfaces.
+		if (surfaces[i].blend_shape_data.size() || surfaces[i].arrays[RS::ARRAY_BONES].get_type() != Variant::NIL) {
+			continue;
+		}
+
+		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		Vector<int> indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+		if (indices.size() < min_cluster_triangles * 3) {
+			continue;
+		}
+
+		Vector<RS::MeshCluster> clusters = SurfaceTool::build_clusters_func(indices, vertices);
+		if (clusters.size() < 2) {
+			continue;
+		}
+
+		// Triangles were reordered so each cluster is a contiguous range of the index buffer.
+		surfaces.write[i].arrays[RS::ARRAY_INDEX] = indices;
+
+		Vector<uint8_t> cluster_data;
+		cluster_data.resize(clusters.size() * sizeof(RS::MeshCluster));
+		memcpy(cluster_data.ptrw(), clusters.ptr(), cluster_data.size());
+		surfaces.write[i].cluster_data = cluster_data;
+	}
+}
+
 bool ImporterMesh::has_mesh() const {
 	return mesh.is_valid();
 }
@@ -718,7 +758,14 @@ Ref<ArrayMesh> ImporterMesh::get_mesh(const Ref<ArrayMesh> &p_base) {
 				}
 			}
 
-			mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+			if (surfaces[i].cluster_data.size()) {
+				RS::SurfaceData sd;
+				Error err = RS::get_singleton()->mesh_create_surface_data_from_arrays(&sd, RS::PrimitiveType(surfaces[i].primitive), surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+				ERR_CONTINUE(err != OK);
+				mesh->add_surface(sd.format, Mesh::PrimitiveType(sd.primitive), sd.vertex_data, sd.attribute_data, sd.skin_data, sd.vertex_count, sd.index_data, sd.index_count, sd.aabb, sd.blend_shape_data, sd.bone_aabbs, sd.lods, sd.uv_scale, surfaces[i].cluster_data);
+			} else {
+				mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+			}
 			if (surfaces[i].material.is_valid()) {
 				mesh->surface_set_material(mesh->get_surface_count() - 1, surfaces[i].material);
 			}
@@ -834,6 +881,8 @@ void ImporterMesh::create_shadow_mesh() {
 		}
 
 		shadow_mesh->add_surface(surfaces[i].primitive, new_surface, Array(), lods, Ref<Material>(), surfaces[i].name, surfaces[i].flags);
+		// Indices keep their order, so the clusters are the same and the depth prepass can use the culled draws too.
+		shadow_mesh->surfaces.write[i].cluster_data = surfaces[i].cluster_data;
 	}
 }
 
@@ -876,6 +925,9 @@ void ImporterMesh::_set_data(const Dictionary &p_data) {
 				flags = s["flags"];
 			}
 			add_surface(prim, arr, b_shapes, lods, material, surf_name, flags);
+			if (s.has("cluster_data")) {
+				surfaces.write[surfaces.size() - 1].cluster_data = s["cluster_data"];
+			}
 		}
 	}
 }
@@ -904,6 +956,10 @@ Dictionary ImporterMesh::_get_data() const {
 			d["lods"] = lods;
 		}
 
+		if (surfaces[i].cluster_data.size()) {
+			d["cluster_data"] = surfaces[i].cluster_data;
+		}
+
 		if (surfaces[i].material.is_valid()) {
 			d["material"] = surfaces[i].material;
 		}
@@ -1368,6 +1424,7 @@ void ImporterMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_surface_material", "surface_idx", "material"), &ImporterMesh::set_surface_material);
 
 	ClassDB::bind_method(D_METHOD("generate_lods", "normal_merge_angle", "normal_split_angle", "bone_transform_array"), &ImporterMesh::generate_lods);
+	ClassDB::bind_method(D_METHOD("generate_clusters"), &ImporterMesh::generate_clusters);
 	ClassDB::bind_method(D_METHOD("get_mesh", "base_mesh"), &ImporterMesh::get_mesh, DEFVAL(Ref<ArrayMesh>()));
 	ClassDB::bind_method(D_METHOD("clear"), &ImporterMesh::clear);
 
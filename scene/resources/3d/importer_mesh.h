@@ -59,6 +59,7 @@ class ImporterMesh : public Resource {
 			float distance = 0.0f;
 		};
 		Vector<LOD> lods;
+		Vector<uint8_t> cluster_data;
 		Ref<Material> material;
 		String name;
 		uint64_t flags = 0;
@@ -113,6 +114,7 @@ public:
 	void set_surface_material(int p_surface, const Ref<Material> &p_material);
 
 	void generate_lods(float p_normal_merge_angle, float p_normal_split_angle, Array p_skin_pose_transform_array);
+	void generate_clusters();
 
 	void create_shadow_mesh();
 	Ref<ImporterMesh> get_shadow_mesh() const;
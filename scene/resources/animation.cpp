@@ -2173,6 +2173,61 @@ real_t Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 	ERR_FAIL_V(0);
 }
 
+bool Animation::sample_compressed_tracks(double p_time, LocalVector<Vector4> &r_values) const {
+	if (!compression.enabled) {
+		return false;
+	}
+
+	// All the tracks are stored in the same pages, so search for the page only once.
+	p_time = CLAMP(p_time, 0, length);
+	int32_t page_index = _find_compressed_page(p_time);
+	ERR_FAIL_COND_V(page_index == -1, false);
+
+	r_values.resize(tracks.size());
+	for (int i = 0; i < tracks.size(); i++) {
+		const Track *t = tracks[i];
+		switch (t->type) {
+			case TYPE_POSITION_3D:
+			case TYPE_SCALE_3D: {
+				int32_t compressed_track = t->type == TYPE_POSITION_3D ? static_cast<const PositionTrack *>(t)->compressed_track : static_cast<const ScaleTrack *>(t)->compressed_track;
+				if (compressed_track < 0) {
+					continue;
+				}
+				Vector3 value;
+				if (!_pos_scale_interpolate_compressed(compressed_track, p_time, value, page_index)) {
+					return false;
+				}
+				r_values[i] = Vector4(value.x, value.y, value.z, 0);
+			} break;
+			case TYPE_ROTATION_3D: {
+				int32_t compressed_track = static_cast<const RotationTrack *>(t)->compressed_track;
+				if (compressed_track < 0) {
+					continue;
+				}
+				Quaternion value;
+				if (!_rotation_interpolate_compressed(compressed_track, p_time, value, page_index)) {
+					return false;
+				}
+				r_values[i] = Vector4(value.x, value.y, value.z, value.w);
+			} break;
+			case TYPE_BLEND_SHAPE: {
+				int32_t compressed_track = static_cast<const BlendShapeTrack *>(t)->compressed_track;
+				if (compressed_track < 0) {
+					continue;
+				}
+				float value;
+				if (!_blend_shape_interpolate_compressed(compressed_track, p_time, value, page_index)) {
+					return false;
+				}
+				r_values[i] = Vector4(value, 0, 0, 0);
+			} break;
+			default: {
+			} break;
+		}
+	}
+	return true;
+}
+
 bool Animation::track_is_compressed(int p_track) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	Track *t = tracks[p_track];
@@ -5070,13 +5125,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, int32_t p_page_index) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page_index)) {
 		return false; //some sort of problem
 	}
 
@@ -5094,13 +5149,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, int32_t p_page_index) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page_index)) {
 		return false; //some sort of problem
 	}
 
@@ -5117,13 +5172,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, int32_t p_page_index) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page_index)) {
 		return false; //some sort of problem
 	}
 
@@ -5141,8 +5196,19 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 	return true;
 }
 
+int32_t Animation::_find_compressed_page(double p_time) const {
+	int32_t page_index = -1;
+	for (uint32_t i = 0; i < compression.pages.size(); i++) {
+		if (compression.pages[i].time_offset > p_time) {
+			break;
+		}
+		page_index = i;
+	}
+	return page_index;
+}
+
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, int32_t p_page_index) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5152,13 +5218,8 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
-		}
-		page_index = i;
-	}
+	// The page can be passed when fetching several tracks at the same time.
+	int32_t page_index = p_page_index >= 0 ? p_page_index : _find_compressed_page(p_time);
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5173,21 +5234,38 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+			packet_idx = i;
+			packet_time = frame_time;
+			base_frame = f;
+		}
+	} else {
+		// Time keys are sorted, so when the key index is not needed the packet can be searched for.
+		uint32_t low = 1;
+		uint32_t high = time_key_count;
+		while (low < high) {
+			uint32_t middle = (low + high) / 2;
+			if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+		if (low > 1) {
+			packet_idx = low - 1;
+			base_frame = time_keys[packet_idx * 2 + 0];
+			packet_time = double(base_frame) * frame_to_sec + page_base_time;
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
@@ -86,6 +86,73 @@ void AudioStreamPlaybackWAV::seek(double p_time) {
 	offset = uint64_t(p_time * base->mix_rate) << MIX_FRAC_BITS;
 }
 
+void AudioStreamPlaybackWAV::_qoa_decode(QOA_State *p_qoa, uint32_t p_data_ofs, uint32_t p_frame_pos) {
+	const uint8_t *frame = (const uint8_t *)base->data + AudioStreamWAV::DATA_PAD + p_data_ofs;
+	uint32_t channels = p_qoa->desc->channels;
+
+	if (p_qoa->data_ofs != p_data_ofs) {
+		// Entering a new frame, only read its header and initial LMS state for now.
+		p_qoa->data_ofs = p_data_ofs;
+		p_qoa->decoded_len = 0;
+
+		unsigned int p = 0;
+		qoa_uint64_t frame_header = qoa_read_u64(frame, &p);
+		uint32_t frame_channels = (frame_header >> 56) & 0x0000ff;
+		uint32_t frame_size = frame_header & 0x00ffff;
+		p_qoa->frame_samples = (frame_header >> 16) & 0x00ffff;
+
+		uint32_t max_samples = 0;
+		if (frame_size >= 8 + QOA_LMS_LEN * 4 * channels) {
+			max_samples = (frame_size - 8 - QOA_LMS_LEN * 4 * channels) / 8 * QOA_SLICE_LEN;
+		}
+		if (frame_channels != channels || p_data_ofs + frame_size > base->data_bytes || p_qoa->frame_samples * channels > max_samples || p_qoa->frame_samples > QOA_FRAME_LEN) {
+			// Corrupt frame, play it as silence.
+			p_qoa->frame_samples = MIN(p_qoa->desc->samples - (p_data_ofs - 8) / p_qoa->frame_len * QOA_FRAME_LEN, (uint32_t)QOA_FRAME_LEN);
+			memset(p_qoa->dec, 0, p_qoa->frame_samples * channels * sizeof(int16_t));
+			p_qoa->decoded_len = QOA_FRAME_LEN;
+			ERR_FAIL_MSG("Invalid QOA frame.");
+		}
+
+		for (uint32_t c = 0; c < channels; c++) {
+			qoa_uint64_t history = qoa_read_u64(frame, &p);
+			qoa_uint64_t weights = qoa_read_u64(frame, &p);
+			for (int i = 0; i < QOA_LMS_LEN; i++) {
+				p_qoa->desc->lms[c].history[i] = ((int16_t)(history >> 48));
+				history <<= 16;
+				p_qoa->desc->lms[c].weights[i] = ((int16_t)(weights >> 48));
+				weights <<= 16;
+			}
+		}
+	}
+
+	// Decode slices up to and including the one containing p_frame_pos, continuing the LMS state.
+	while (p_qoa->decoded_len <= p_frame_pos && p_qoa->decoded_len < p_qoa->frame_samples) {
+		uint32_t sample_index = p_qoa->decoded_len;
+		unsigned int p = 8 + QOA_LMS_LEN * 4 * channels + (sample_index / QOA_SLICE_LEN) * 8 * channels;
+		uint32_t slice_len = MIN((uint32_t)QOA_SLICE_LEN, p_qoa->frame_samples - sample_index);
+
+		for (uint32_t c = 0; c < channels; c++) {
+			qoa_uint64_t slice = qoa_read_u64(frame, &p);
+			int scalefactor = (slice >> 60) & 0xf;
+			qoa_lms_t *lms = &p_qoa->desc->lms[c];
+			int16_t *dst = p_qoa->dec + sample_index * channels + c;
+
+			for (uint32_t i = 0; i < slice_len; i++) {
+				int predicted = qoa_lms_predict(lms);
+				int quantized = (slice >> 57) & 0x7;
+				int dequantized = qoa_dequant_tab[scalefactor][quantized];
+				int reconstructed = qoa_clamp_s16(predicted + dequantized);
+
+				dst[i * channels] = reconstructed;
+				slice <<= 3;
+
+				qoa_lms_update(lms, reconstructed, dequantized);
+			}
+		}
+		p_qoa->decoded_len += slice_len;
+	}
+}
+
 template <typename Depth, bool is_stereo, bool is_ima_adpcm, bool is_qoa>
 void AudioStreamPlaybackWAV::do_resample(const Depth *p_src, AudioFrame *p_dst, int64_t &p_offset, int32_t &p_increment, uint32_t p_amount, IMA_ADPCM_State *p_ima_adpcm, QOA_State *p_qoa) {
 	// this function will be compiled branchless by any decent compiler
@@ -181,15 +248,13 @@ void AudioStreamPlaybackWAV::do_resample(const Depth *p_src, AudioFrame *p_dst,
 						// Sign operations prevent triple decoding on backward loops, maxing prevents pop.
 						uint32_t interp_pos = MIN(pos + (i * sign) + (sign < 0), p_qoa->desc->samples - 1);
 						uint32_t new_data_ofs = 8 + interp_pos / QOA_FRAME_LEN * p_qoa->frame_len;
+						uint32_t frame_pos = interp_pos % QOA_FRAME_LEN;
 
-						if (p_qoa->data_ofs != new_data_ofs) {
-							p_qoa->data_ofs = new_data_ofs;
-							const uint8_t *src_ptr = (const uint8_t *)base->data;
-							src_ptr += p_qoa->data_ofs + AudioStreamWAV::DATA_PAD;
-							qoa_decode_frame(src_ptr, p_qoa->frame_len, p_qoa->desc, p_qoa->dec, &p_qoa->dec_len);
+						if (p_qoa->data_ofs != new_data_ofs || frame_pos >= p_qoa->decoded_len) {
+							_qoa_decode(p_qoa, new_data_ofs, frame_pos);
 						}
 
-						uint32_t dec_idx = (interp_pos % QOA_FRAME_LEN) * p_qoa->desc->channels;
+						uint32_t dec_idx = frame_pos * p_qoa->desc->channels;
 
 						if ((sign > 0 && i == 0) || (sign < 0 && i == 1)) {
 							final = p_qoa->dec[dec_idx];
@@ -695,7 +760,7 @@ Ref<AudioStreamPlayback> AudioStreamWAV::instantiate_playback() {
 	sample.instantiate();
 	sample->base = Ref<AudioStreamWAV>(this);
 
-	if (format == AudioStreamWAV::FORMAT_QOA) {
+	if (format == AudioStreamWAV::FORMAT_QOA && data_bytes > 0) {
 		sample->qoa.desc = (qoa_desc *)memalloc(sizeof(qoa_desc));
 		uint32_t ffp = qoa_decode_header((uint8_t *)data + DATA_PAD, data_bytes, sample->qoa.desc);
 		ERR_FAIL_COND_V(ffp != 8, Ref<AudioStreamPlaybackWAV>());
@@ -63,7 +63,9 @@ class AudioStreamPlaybackWAV : public AudioStreamPlayback {
 		uint32_t data_ofs = 0;
 		uint32_t frame_len = 0;
 		int16_t *dec = nullptr;
-		uint32_t dec_len = 0;
+		// Slices are decoded into `dec` as playback reaches them, so that the frame isn't decoded all at once.
+		uint32_t frame_samples = 0;
+		uint32_t decoded_len = 0;
 		int64_t cache_pos = -1;
 		int16_t cache[2] = { 0, 0 };
 		int16_t cache_r[2] = { 0, 0 };
@@ -75,6 +77,8 @@ class AudioStreamPlaybackWAV : public AudioStreamPlayback {
 	friend class AudioStreamWAV;
 	Ref<AudioStreamWAV> base;
 
+	void _qoa_decode(QOA_State *p_qoa, uint32_t p_data_ofs, uint32_t p_frame_pos);
+
 	template <typename Depth, bool is_stereo, bool is_ima_adpcm, bool is_qoa>
 	void do_resample(const Depth *p_src, AudioFrame *p_dst, int64_t &p_offset, int32_t &p_increment, uint32_t p_amount, IMA_ADPCM_State *p_ima_adpcm, QOA_State *p_qoa);
 
@@ -169,6 +173,8 @@ public:
 	void set_data(const Vector<uint8_t> &p_data);
 	Vector<uint8_t> get_data() const;
 
+	virtual uint64_t get_memory_usage() const override { return data_bytes; }
+
 	Error save_to_wav(const String &p_path);
 
 	virtual Ref<AudioStreamPlayback> instantiate_playback() override;
@@ -30,16 +30,22 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/templates/local_vector.h"
+
 #include "scene/resources/bit_map.h"
+#include "scene/resources/placeholder_textures.h"
 
 Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
-	alpha_cache.unref();
-
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Unable to open file: %s.", p_path));
 
+	// Let the OS read the image data while the header is parsed.
+	f->prefetch(0, f->get_length());
+
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] != 'G' || header[1] != 'S' || header[2] != 'T' || header[3] != '2') {
@@ -126,6 +132,9 @@ Image::Format CompressedTexture2D::get_format() const {
 }
 
 Error CompressedTexture2D::load(const String &p_path) {
+	alpha_cache.unref();
+	_streaming_stop();
+
 	int lw, lh;
 	Ref<Image> image;
 	image.instantiate();
@@ -135,7 +144,13 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	// Streamed textures only load their lowest mipmaps here, editors always get everything.
+	int size_limit = 0;
+	if (!Engine::get_singleton()->is_editor_hint() && GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		size_limit = GLOBAL_GET("rendering/textures/streaming/min_resident_size");
+	}
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit);
 	if (err) {
 		return err;
 	}
@@ -152,9 +167,22 @@ Error CompressedTexture2D::load(const String &p_path) {
 
 	w = lw;
 	h = lh;
+	data_size = image->get_data().size();
 	path_to_file = p_path;
 	format = image->get_format();
 
+	if (image->get_width() < lw || image->get_height() < lh) {
+		// Only low mipmaps were loaded, stream in the rest unless the budget says otherwise.
+		streaming_low_image = image;
+		streaming_full_size = MAX(lw, lh);
+		streaming_resident_size = MAX(image->get_width(), image->get_height());
+		streaming_resident_bytes = image->get_data().size();
+
+		MutexLock lock(streaming_mutex);
+		streaming_total_bytes += streaming_resident_bytes;
+		streaming_list.add(&streaming_element);
+	}
+
 	if (get_path().is_empty()) {
 		//temporarily set path if no path set for resource, helps find errors
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -189,6 +217,10 @@ Error CompressedTexture2D::load(const String &p_path) {
 #endif
 	notify_property_list_changed();
 	emit_changed();
+
+	if (streaming_full_size) {
+		request_streaming_size(streaming_full_size);
+	}
 	return OK;
 }
 
@@ -196,6 +228,128 @@ String CompressedTexture2D::get_load_path() const {
 	return path_to_file;
 }
 
+Mutex CompressedTexture2D::streaming_mutex;
+SelfList<CompressedTexture2D>::List CompressedTexture2D::streaming_list;
+uint64_t CompressedTexture2D::streaming_total_bytes = 0;
+
+void CompressedTexture2D::_streaming_load_task(void *p_userdata) {
+	CompressedTexture2D *ct = (CompressedTexture2D *)p_userdata;
+
+	int lw, lh;
+	Ref<Image> image;
+	image.instantiate();
+	bool request_3d;
+	bool request_normal;
+	bool request_roughness;
+	int mipmap_limit;
+
+	// Only the result is written here, it is applied by update_streaming() once the task is done.
+	Error err = ct->_load_data(ct->path_to_file, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, ct->streaming_task_size);
+	if (err == OK) {
+		ct->streaming_loaded_image = image;
+	}
+}
+
+void CompressedTexture2D::_set_streaming_image(const Ref<Image> &p_image, int p_size) {
+	RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(texture, w, h);
+	alpha_cache.unref();
+
+	uint64_t bytes = p_image->get_data().size();
+	streaming_total_bytes = streaming_total_bytes - streaming_resident_bytes + bytes;
+	streaming_resident_bytes = bytes;
+	streaming_resident_size = p_size;
+}
+
+void CompressedTexture2D::_streaming_stop() {
+	if (streaming_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(streaming_task);
+		streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+		streaming_loaded_image.unref();
+	}
+
+	if (streaming_full_size) {
+		MutexLock lock(streaming_mutex);
+		streaming_total_bytes -= streaming_resident_bytes;
+		streaming_list.remove(&streaming_element);
+	}
+
+	streaming_low_image.unref();
+	streaming_full_size = 0;
+	streaming_resident_size = 0;
+	streaming_requested_size = 0;
+	streaming_resident_bytes = 0;
+}
+
+void CompressedTexture2D::request_streaming_size(int p_size) {
+	if (!streaming_full_size) {
+		return;
+	}
+
+	streaming_requested_size = CLAMP(p_size, 1, streaming_full_size);
+	streaming_last_request = Engine::get_singleton()->get_process_frames();
+
+	if (streaming_requested_size > streaming_resident_size && streaming_task == WorkerThreadPool::INVALID_TASK_ID) {
+		streaming_task_size = streaming_requested_size;
+		streaming_task = WorkerThreadPool::get_singleton()->add_native_task(_streaming_load_task, this, false, "Stream texture: " + path_to_file);
+	}
+}
+
+int CompressedTexture2D::get_streaming_resident_size() const {
+	return streaming_full_size ? streaming_resident_size : MAX(w, h);
+}
+
+bool CompressedTexture2D::is_streaming() const {
+	return streaming_full_size != 0;
+}
+
+void CompressedTexture2D::update_streaming() {
+	MutexLock lock(streaming_mutex);
+	if (!streaming_list.first()) {
+		return;
+	}
+
+	LocalVector<CompressedTexture2D *> evictable;
+	for (SelfList<CompressedTexture2D> *E = streaming_list.first(); E; E = E->next()) {
+		CompressedTexture2D *ct = E->self();
+
+		if (ct->streaming_task != WorkerThreadPool::INVALID_TASK_ID && WorkerThreadPool::get_singleton()->is_task_completed(ct->streaming_task)) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(ct->streaming_task);
+			ct->streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+			if (ct->streaming_loaded_image.is_valid()) {
+				ct->_set_streaming_image(ct->streaming_loaded_image, ct->streaming_task_size);
+				ct->streaming_loaded_image.unref();
+			}
+		}
+
+		if (ct->streaming_task == WorkerThreadPool::INVALID_TASK_ID && ct->streaming_resident_bytes > (uint64_t)ct->streaming_low_image->get_data().size()) {
+			evictable.push_back(ct);
+		}
+	}
+
+	const uint64_t budget = uint64_t(GLOBAL_GET("rendering/textures/streaming/budget_mb")) * 1024 * 1024;
+	if (streaming_total_bytes <= budget) {
+		return;
+	}
+
+	// Least recently requested textures go back to their low mipmaps first.
+	struct LastRequestComparator {
+		bool operator()(const CompressedTexture2D *p_a, const CompressedTexture2D *p_b) const {
+			return p_a->streaming_last_request < p_b->streaming_last_request;
+		}
+	};
+	evictable.sort_custom<LastRequestComparator>();
+
+	const uint64_t frame = Engine::get_singleton()->get_process_frames();
+	for (CompressedTexture2D *ct : evictable) {
+		if (streaming_total_bytes <= budget || ct->streaming_last_request == frame) {
+			break;
+		}
+		ct->_set_streaming_image(ct->streaming_low_image, MAX(ct->streaming_low_image->get_width(), ct->streaming_low_image->get_height()));
+	}
+}
+
 int CompressedTexture2D::get_width() const {
 	return w;
 }
@@ -211,6 +365,13 @@ RID CompressedTexture2D::get_rid() const {
 	return texture;
 }
 
+uint64_t CompressedTexture2D::get_memory_usage() const {
+	if (streaming_full_size) {
+		return streaming_resident_bytes;
+	}
+	return data_size;
+}
+
 void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Color &p_modulate, bool p_transpose) const {
 	if ((w | h) == 0) {
 		return;
@@ -326,18 +487,29 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			const uint8_t *mapped = f->get_mapped_data();
+			uint64_t pos = f->get_position();
+			if (mapped && pos + size <= f->get_length()) {
+				// Decode straight from the mapped file, without copying the compressed data first.
+				ImageMemLoadFunc loader_func = data_format == DATA_FORMAT_PNG ? Image::_png_mem_unpacker_func : Image::_webp_mem_loader_func;
+				if (loader_func) {
+					img = loader_func(mapped + pos, size);
+				}
+				f->seek(pos + size);
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -426,7 +598,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				if (ofs) {
 					f->seek(f->get_position() + ofs);
 				}
@@ -453,20 +625,64 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 void CompressedTexture2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load", "path"), &CompressedTexture2D::load);
 	ClassDB::bind_method(D_METHOD("get_load_path"), &CompressedTexture2D::get_load_path);
+	ClassDB::bind_method(D_METHOD("request_streaming_size", "size"), &CompressedTexture2D::request_streaming_size);
+	ClassDB::bind_method(D_METHOD("get_streaming_resident_size"), &CompressedTexture2D::get_streaming_resident_size);
+	ClassDB::bind_method(D_METHOD("is_streaming"), &CompressedTexture2D::is_streaming);
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
-CompressedTexture2D::CompressedTexture2D() {}
+CompressedTexture2D::CompressedTexture2D() :
+		streaming_element(this) {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_streaming_stop();
+
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
 	}
 }
 
+// Placeholders only need the dimensions, read them from the file and first image headers without touching the data.
+static Error _read_placeholder_header(const String &p_path, const char *p_magic, uint32_t p_max_version, uint32_t *r_header, Size2i &r_image_size) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Unable to open file: %s.", p_path));
+
+	uint8_t magic[4];
+	f->get_buffer(magic, 4);
+	ERR_FAIL_COND_V_MSG(memcmp(magic, p_magic, 4) != 0, ERR_FILE_CORRUPT, "Compressed texture file is corrupt (Bad header).");
+
+	// All compressed texture formats start with 8 header words, the first one being the version.
+	for (int i = 0; i < 8; i++) {
+		r_header[i] = f->get_32();
+	}
+	ERR_FAIL_COND_V_MSG(r_header[0] > p_max_version, ERR_FILE_CORRUPT, "Compressed texture file is too new.");
+
+	f->get_32(); // Data format.
+	r_image_size.width = f->get_16();
+	r_image_size.height = f->get_16();
+	return OK;
+}
+
 Ref<Resource> ResourceFormatLoaderCompressedTexture2D::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
+	if (ResourceLoader::is_loading_placeholders()) {
+		uint32_t header[8];
+		Size2i image_size;
+		Error err = _read_placeholder_header(p_path, "GST2", CompressedTexture2D::FORMAT_VERSION, header, image_size);
+		if (r_error) {
+			*r_error = err;
+		}
+		if (err != OK) {
+			return Ref<Resource>();
+		}
+		Ref<PlaceholderTexture2D> pt;
+		pt.instantiate();
+		// The stored size overrides the image size when set.
+		pt->set_size((header[1] || header[2]) ? Size2(header[1], header[2]) : Size2(image_size));
+		return pt;
+	}
+
 	Ref<CompressedTexture2D> st;
 	st.instantiate();
 	Error err = st->load(p_path);
@@ -656,6 +872,22 @@ CompressedTexture3D::~CompressedTexture3D() {
 }
 
 Ref<Resource> ResourceFormatLoaderCompressedTexture3D::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
+	if (ResourceLoader::is_loading_placeholders()) {
+		uint32_t header[8];
+		Size2i image_size;
+		Error err = _read_placeholder_header(p_path, "GSTL", CompressedTexture3D::FORMAT_VERSION, header, image_size);
+		if (r_error) {
+			*r_error = err;
+		}
+		if (err != OK) {
+			return Ref<Resource>();
+		}
+		Ref<PlaceholderTexture3D> pt;
+		pt.instantiate();
+		pt->set_size(Vector3i(image_size.width, image_size.height, header[1]));
+		return pt;
+	}
+
 	Ref<CompressedTexture3D> st;
 	st.instantiate();
 	Error err = st->load(p_path);
@@ -873,6 +1105,34 @@ Ref<Resource> ResourceFormatLoaderCompressedTextureLayered::load(const String &p
 		}
 		return Ref<Resource>();
 	}
+
+	if (ResourceLoader::is_loading_placeholders()) {
+		uint32_t header[8];
+		Size2i image_size;
+		Error err = _read_placeholder_header(p_path, "GSTL", CompressedTextureLayered::FORMAT_VERSION, header, image_size);
+		if (r_error) {
+			*r_error = err;
+		}
+		if (err != OK) {
+			return Ref<Resource>();
+		}
+		Ref<PlaceholderTextureLayered> pt;
+		switch (ct->get_layered_type()) {
+			case TextureLayered::LAYERED_TYPE_2D_ARRAY:
+				pt = Ref<PlaceholderTextureLayered>(memnew(PlaceholderTexture2DArray));
+				break;
+			case TextureLayered::LAYERED_TYPE_CUBEMAP:
+				pt = Ref<PlaceholderTextureLayered>(memnew(PlaceholderCubemap));
+				break;
+			case TextureLayered::LAYERED_TYPE_CUBEMAP_ARRAY:
+				pt = Ref<PlaceholderTextureLayered>(memnew(PlaceholderCubemapArray));
+				break;
+		}
+		pt->set_size(image_size);
+		pt->set_layers(header[1]);
+		return pt;
+	}
+
 	Error err = ct->load(p_path);
 	if (r_error) {
 		*r_error = err;
@@ -31,6 +31,9 @@
 #ifndef COMPRESSED_TEXTURE_H
 #define COMPRESSED_TEXTURE_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -65,8 +68,29 @@ private:
 	Image::Format format = Image::FORMAT_L8;
 	int w = 0;
 	int h = 0;
+	uint64_t data_size = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Streaming keeps the low mipmaps resident and loads the higher ones on demand.
+	SelfList<CompressedTexture2D> streaming_element;
+	Ref<Image> streaming_low_image; // What the texture falls back to when evicted.
+	Ref<Image> streaming_loaded_image; // Written by the streaming task, applied on the main thread.
+	WorkerThreadPool::TaskID streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+	int streaming_full_size = 0;
+	int streaming_resident_size = 0;
+	int streaming_requested_size = 0;
+	int streaming_task_size = 0;
+	uint64_t streaming_resident_bytes = 0;
+	uint64_t streaming_last_request = 0;
+
+	static Mutex streaming_mutex;
+	static SelfList<CompressedTexture2D>::List streaming_list;
+	static uint64_t streaming_total_bytes;
+
+	static void _streaming_load_task(void *p_userdata);
+	void _set_streaming_image(const Ref<Image> &p_image, int p_size);
+	void _streaming_stop();
+
 	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
 	virtual void reload_from_file() override;
 
@@ -92,9 +116,16 @@ public:
 	Error load(const String &p_path);
 	String get_load_path() const;
 
+	void request_streaming_size(int p_size);
+	int get_streaming_resident_size() const;
+	bool is_streaming() const;
+
+	static void update_streaming();
+
 	int get_width() const override;
 	int get_height() const override;
 	virtual RID get_rid() const override;
+	virtual uint64_t get_memory_usage() const override;
 
 	virtual void set_path(const String &p_path, bool p_take_over) override;
 
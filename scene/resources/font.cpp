@@ -1016,6 +1016,7 @@ void FontFile::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("render_range", "cache_index", "size", "start", "end"), &FontFile::render_range);
 	ClassDB::bind_method(D_METHOD("render_glyph", "cache_index", "size", "index"), &FontFile::render_glyph);
+	ClassDB::bind_method(D_METHOD("prewarm_glyphs", "cache_index", "size", "characters"), &FontFile::prewarm_glyphs);
 
 	ClassDB::bind_method(D_METHOD("set_language_support_override", "language", "supported"), &FontFile::set_language_support_override);
 	ClassDB::bind_method(D_METHOD("get_language_support_override", "language"), &FontFile::get_language_support_override);
@@ -2723,6 +2724,12 @@ void FontFile::render_glyph(int p_cache_index, const Vector2i &p_size, int32_t p
 	TS->font_render_glyph(cache[p_cache_index], p_size, p_index);
 }
 
+void FontFile::prewarm_glyphs(int p_cache_index, const Vector2i &p_size, const String &p_characters) {
+	ERR_FAIL_COND(p_cache_index < 0);
+	_ensure_rid(p_cache_index);
+	TS->font_prewarm_glyphs(cache[p_cache_index], p_size, p_characters);
+}
+
 void FontFile::set_language_support_override(const String &p_language, bool p_supported) {
 	_ensure_rid(0);
 	TS->font_set_language_support_override(cache[0], p_language, p_supported);
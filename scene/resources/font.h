@@ -366,6 +366,7 @@ public:
 
 	virtual void render_range(int p_cache_index, const Vector2i &p_size, char32_t p_start, char32_t p_end);
 	virtual void render_glyph(int p_cache_index, const Vector2i &p_size, int32_t p_index);
+	virtual void prewarm_glyphs(int p_cache_index, const Vector2i &p_size, const String &p_characters);
 
 	// Language/script support override.
 	virtual void set_language_support_override(const String &p_language, bool p_supported);
@@ -225,6 +225,13 @@ void ImageTexture::set_path(const String &p_path, bool p_take_over) {
 	Resource::set_path(p_path, p_take_over);
 }
 
+uint64_t ImageTexture::get_memory_usage() const {
+	if (!texture.is_valid()) {
+		return 0;
+	}
+	return Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 void ImageTexture::_bind_methods() {
 	ClassDB::bind_static_method("ImageTexture", D_METHOD("create_from_image", "image"), &ImageTexture::create_from_image);
 	ClassDB::bind_method(D_METHOD("get_format"), &ImageTexture::get_format);
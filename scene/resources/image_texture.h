@@ -82,6 +82,8 @@ public:
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
 
+	virtual uint64_t get_memory_usage() const override;
+
 	ImageTexture();
 	~ImageTexture();
 };
@@ -607,10 +607,16 @@ void BaseMaterial3D::init_shaders() {
 }
 
 HashMap<uint64_t, Ref<StandardMaterial3D>> BaseMaterial3D::materials_for_2d;
+HashMap<BaseMaterial3D::Material2DParams, BaseMaterial3D::SharedMaterial2D, BaseMaterial3D::Material2DParams> BaseMaterial3D::shared_materials_for_2d;
 
 void BaseMaterial3D::finish_shaders() {
 	materials_for_2d.clear();
 
+	for (const KeyValue<Material2DParams, SharedMaterial2D> &E : shared_materials_for_2d) {
+		RS::get_singleton()->free(E.value.material);
+	}
+	shared_materials_for_2d.clear();
+
 	dirty_materials.clear();
 
 	memdelete(shader_names);
@@ -1052,10 +1058,29 @@ uniform vec3 uv2_scale;
 uniform vec3 uv2_offset;
 )";
 
+	if (sprite_instancing) {
+		code += R"(
+// Sprite Instancing: Enabled
+instance uniform vec3 sprite_rect_offset = vec3(0.0);
+instance uniform vec3 sprite_rect_scale = vec3(1.0);
+instance uniform vec4 sprite_uv_rect = vec4(0.0, 0.0, 1.0, 1.0);
+instance uniform vec4 sprite_modulate = vec4(1.0);
+)";
+	}
+
 	// Generate vertex shader.
 	code += R"(
 void vertex() {)";
 
+	if (sprite_instancing) {
+		code += R"(
+	// Sprite Instancing: Enabled
+	VERTEX = sprite_rect_offset + VERTEX * sprite_rect_scale;
+	UV = sprite_uv_rect.xy + UV * sprite_uv_rect.zw;
+	COLOR = sprite_modulate;
+)";
+	}
+
 	if (flags[FLAG_SRGB_VERTEX_COLOR]) {
 		code += R"(
 	// Vertex Color is sRGB: Enabled
@@ -2725,7 +2750,7 @@ BaseMaterial3D::TextureChannel BaseMaterial3D::get_refraction_texture_channel()
 	return refraction_texture_channel;
 }
 
-Ref<Material> BaseMaterial3D::get_material_for_2d(bool p_shaded, Transparency p_transparency, bool p_double_sided, bool p_billboard, bool p_billboard_y, bool p_msdf, bool p_no_depth, bool p_fixed_size, TextureFilter p_filter, AlphaAntiAliasing p_alpha_antialiasing_mode, RID *r_shader_rid) {
+Ref<Material> BaseMaterial3D::get_material_for_2d(bool p_shaded, Transparency p_transparency, bool p_double_sided, bool p_billboard, bool p_billboard_y, bool p_msdf, bool p_no_depth, bool p_fixed_size, TextureFilter p_filter, AlphaAntiAliasing p_alpha_antialiasing_mode, RID *r_shader_rid, bool p_sprite_instancing) {
 	uint64_t key = 0;
 	key |= ((int8_t)p_shaded & 0x01) << 0;
 	key |= ((int8_t)p_transparency & 0x07) << 1; // Bits 1-3.
@@ -2737,6 +2762,7 @@ Ref<Material> BaseMaterial3D::get_material_for_2d(bool p_shaded, Transparency p_
 	key |= ((int8_t)p_fixed_size & 0x01) << 9;
 	key |= ((int8_t)p_filter & 0x07) << 10; // Bits 10-12.
 	key |= ((int8_t)p_alpha_antialiasing_mode & 0x07) << 13; // Bits 13-15.
+	key |= ((int8_t)p_sprite_instancing & 0x01) << 16;
 
 	if (materials_for_2d.has(key)) {
 		if (r_shader_rid) {
@@ -2762,6 +2788,10 @@ Ref<Material> BaseMaterial3D::get_material_for_2d(bool p_shaded, Transparency p_
 		material->set_flag(FLAG_BILLBOARD_KEEP_SCALE, true);
 		material->set_billboard_mode(p_billboard_y ? BILLBOARD_FIXED_Y : BILLBOARD_ENABLED);
 	}
+	if (p_sprite_instancing) {
+		material->sprite_instancing = true;
+		material->_queue_shader_change();
+	}
 
 	materials_for_2d[key] = material;
 
@@ -2855,6 +2885,56 @@ BaseMaterial3D::EmissionOperator BaseMaterial3D::get_emission_operator() const {
 	return emission_op;
 }
 
+RID BaseMaterial3D::acquire_shared_material_for_2d(const Material2DParams &p_params) {
+	MutexLock lock(material_mutex);
+
+	SharedMaterial2D *shared = shared_materials_for_2d.getptr(p_params);
+	if (shared) {
+		shared->users++;
+		return shared->material;
+	}
+
+	RID material = RS::get_singleton()->material_create();
+	// Set defaults for material, names need to match up those in StandardMaterial3D.
+	RS::get_singleton()->material_set_param(material, "albedo", Color(1, 1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "specular", 0.5);
+	RS::get_singleton()->material_set_param(material, "metallic", 0.0);
+	RS::get_singleton()->material_set_param(material, "roughness", 1.0);
+	RS::get_singleton()->material_set_param(material, "uv1_offset", Vector3(0, 0, 0));
+	RS::get_singleton()->material_set_param(material, "uv1_scale", Vector3(1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "uv2_offset", Vector3(0, 0, 0));
+	RS::get_singleton()->material_set_param(material, "uv2_scale", Vector3(1, 1, 1));
+	RS::get_singleton()->material_set_param(material, "alpha_scissor_threshold", p_params.alpha_scissor_threshold);
+	RS::get_singleton()->material_set_param(material, "alpha_hash_scale", p_params.alpha_hash_scale);
+	RS::get_singleton()->material_set_param(material, "alpha_antialiasing_edge", p_params.alpha_antialiasing_edge);
+	if (p_params.msdf_pixel_range != 0.0) {
+		RS::get_singleton()->material_set_param(material, "msdf_pixel_range", p_params.msdf_pixel_range);
+		RS::get_singleton()->material_set_param(material, "msdf_outline_size", p_params.msdf_outline_size);
+	}
+	RS::get_singleton()->material_set_shader(material, p_params.shader);
+	RS::get_singleton()->material_set_param(material, "texture_albedo", p_params.texture);
+	RS::get_singleton()->material_set_render_priority(material, p_params.render_priority);
+
+	SharedMaterial2D new_shared;
+	new_shared.material = material;
+	new_shared.users = 1;
+	shared_materials_for_2d.insert(p_params, new_shared);
+	return material;
+}
+
+void BaseMaterial3D::release_shared_material_for_2d(const Material2DParams &p_params) {
+	MutexLock lock(material_mutex);
+
+	HashMap<Material2DParams, SharedMaterial2D, Material2DParams>::Iterator E = shared_materials_for_2d.find(p_params);
+	ERR_FAIL_COND(!E);
+
+	E->value.users--;
+	if (E->value.users == 0) {
+		RS::get_singleton()->free(E->value.material);
+		shared_materials_for_2d.remove(E);
+	}
+}
+
 RID BaseMaterial3D::get_shader_rid() const {
 	MutexLock lock(material_mutex);
 	if (element.in_list()) {
@@ -335,6 +335,7 @@ private:
 		uint64_t grow : 1;
 		uint64_t proximity_fade : 1;
 		uint64_t orm : 1;
+		uint64_t sprite_instancing : 1;
 
 		// flag bitfield
 		uint32_t feature_mask;
@@ -390,6 +391,7 @@ private:
 		mk.emission_op = emission_op;
 		mk.alpha_antialiasing_mode = alpha_antialiasing_mode;
 		mk.orm = orm;
+		mk.sprite_instancing = sprite_instancing;
 
 		for (int i = 0; i < FEATURE_MAX; i++) {
 			if (features[i]) {
@@ -479,6 +481,8 @@ private:
 	_FORCE_INLINE_ void _queue_shader_change();
 
 	bool orm;
+	// Only set on materials made for batched sprites, which place and color a unit quad from instance uniforms.
+	bool sprite_instancing = false;
 
 	Ref<ShaderTemplate> shader_template;
 
@@ -570,6 +574,43 @@ private:
 
 	static HashMap<uint64_t, Ref<StandardMaterial3D>> materials_for_2d; //used by Sprite3D, Label3D and other stuff
 
+public:
+	// Parameters of a material made from the shader of get_material_for_2d(), nodes using equal parameters share the material.
+	struct Material2DParams {
+		RID shader;
+		RID texture;
+		float alpha_scissor_threshold = 0.5;
+		float alpha_hash_scale = 1.0;
+		float alpha_antialiasing_edge = 0.0;
+		// Only used by MSDF fonts when the pixel range is not zero.
+		float msdf_pixel_range = 0.0;
+		float msdf_outline_size = 0.0;
+		int32_t render_priority = 0;
+
+		static uint32_t hash(const Material2DParams &p_params) {
+			uint32_t h = hash_murmur3_one_64(p_params.shader.get_id());
+			h = hash_murmur3_one_64(p_params.texture.get_id(), h);
+			h = hash_murmur3_one_float(p_params.alpha_scissor_threshold, h);
+			h = hash_murmur3_one_float(p_params.alpha_hash_scale, h);
+			h = hash_murmur3_one_float(p_params.alpha_antialiasing_edge, h);
+			h = hash_murmur3_one_float(p_params.msdf_pixel_range, h);
+			h = hash_murmur3_one_float(p_params.msdf_outline_size, h);
+			h = hash_murmur3_one_32(p_params.render_priority, h);
+			return hash_fmix32(h);
+		}
+		bool operator==(const Material2DParams &p_params) const {
+			return shader == p_params.shader && texture == p_params.texture && alpha_scissor_threshold == p_params.alpha_scissor_threshold && alpha_hash_scale == p_params.alpha_hash_scale && alpha_antialiasing_edge == p_params.alpha_antialiasing_edge && msdf_pixel_range == p_params.msdf_pixel_range && msdf_outline_size == p_params.msdf_outline_size && render_priority == p_params.render_priority;
+		}
+	};
+
+private:
+	struct SharedMaterial2D {
+		RID material;
+		int users = 0;
+	};
+
+	static HashMap<Material2DParams, SharedMaterial2D, Material2DParams> shared_materials_for_2d;
+
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
@@ -788,7 +829,10 @@ public:
 	static void finish_shaders();
 	static void flush_changes();
 
-	static Ref<Material> get_material_for_2d(bool p_shaded, Transparency p_transparency, bool p_double_sided, bool p_billboard = false, bool p_billboard_y = false, bool p_msdf = false, bool p_no_depth = false, bool p_fixed_size = false, TextureFilter p_filter = TEXTURE_FILTER_LINEAR_WITH_MIPMAPS, AlphaAntiAliasing p_alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF, RID *r_shader_rid = nullptr);
+	static Ref<Material> get_material_for_2d(bool p_shaded, Transparency p_transparency, bool p_double_sided, bool p_billboard = false, bool p_billboard_y = false, bool p_msdf = false, bool p_no_depth = false, bool p_fixed_size = false, TextureFilter p_filter = TEXTURE_FILTER_LINEAR_WITH_MIPMAPS, AlphaAntiAliasing p_alpha_antialiasing_mode = ALPHA_ANTIALIASING_OFF, RID *r_shader_rid = nullptr, bool p_sprite_instancing = false);
+	// Reference counted, every call must be matched with a call to release_shared_material_for_2d().
+	static RID acquire_shared_material_for_2d(const Material2DParams &p_params);
+	static void release_shared_material_for_2d(const Material2DParams &p_params);
 
 	virtual RID get_shader_rid() const override;
 
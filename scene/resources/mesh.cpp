@@ -1541,6 +1541,10 @@ Array ArrayMesh::_get_surfaces() const {
 			data["blend_shapes"] = surface.blend_shape_data;
 		}
 
+		if (surface.cluster_data.size()) {
+			data["cluster_data"] = surface.cluster_data;
+		}
+
 		if (surfaces[i].material.is_valid()) {
 			data["material"] = surfaces[i].material;
 		}
@@ -1626,6 +1630,10 @@ void ArrayMesh::_set_surfaces(const Array &p_surfaces) {
 			surface.blend_shape_data = d["blend_shapes"];
 		}
 
+		if (d.has("cluster_data")) {
+			surface.cluster_data = d["cluster_data"];
+		}
+
 		Ref<Material> material;
 		if (d.has("material")) {
 			material = d["material"];
@@ -1763,7 +1771,7 @@ void ArrayMesh::_recompute_aabb() {
 }
 
 // TODO: Need to add binding to add_surface using future MeshSurfaceData object.
-void ArrayMesh::add_surface(BitField<ArrayFormat> p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods, const Vector4 p_uv_scale) {
+void ArrayMesh::add_surface(BitField<ArrayFormat> p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods, const Vector4 p_uv_scale, const Vector<uint8_t> &p_cluster_data) {
 	ERR_FAIL_COND(surfaces.size() == RS::MAX_MESH_SURFACES);
 	_create_if_empty();
 
@@ -1792,6 +1800,7 @@ void ArrayMesh::add_surface(BitField<ArrayFormat> p_format, PrimitiveType p_prim
 	sd.bone_aabbs = p_bone_aabbs;
 	sd.lods = p_lods;
 	sd.uv_scale = p_uv_scale;
+	sd.cluster_data = p_cluster_data;
 
 	RenderingServer::get_singleton()->mesh_add_surface(mesh, sd);
 
@@ -1819,7 +1828,7 @@ void ArrayMesh::add_surface_from_arrays(PrimitiveType p_primitive, const Array &
 	print_line("primitive: " + itos(surface.primitive));
 	*/
 
-	add_surface(surface.format, PrimitiveType(surface.primitive), surface.vertex_data, surface.attribute_data, surface.skin_data, surface.vertex_count, surface.index_data, surface.index_count, surface.aabb, surface.blend_shape_data, surface.bone_aabbs, surface.lods, surface.uv_scale);
+	add_surface(surface.format, PrimitiveType(surface.primitive), surface.vertex_data, surface.attribute_data, surface.skin_data, surface.vertex_count, surface.index_data, surface.index_count, surface.aabb, surface.blend_shape_data, surface.bone_aabbs, surface.lods, surface.uv_scale, surface.cluster_data);
 }
 
 Array ArrayMesh::surface_get_arrays(int p_surface) const {
@@ -1994,6 +2003,22 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::get_memory_usage() const {
+	// Blend shapes and LODs are not accounted for.
+	uint64_t size = 0;
+	for (const Surface &surface : surfaces) {
+		uint32_t offsets[RS::ARRAY_MAX];
+		uint32_t vertex_stride;
+		uint32_t normal_tangent_stride;
+		uint32_t attribute_stride;
+		uint32_t skin_stride;
+		RS::get_singleton()->mesh_surface_make_offsets_from_format(surface.format & ~RS::ARRAY_FORMAT_INDEX, surface.array_length, 0, offsets, vertex_stride, normal_tangent_stride, attribute_stride, skin_stride);
+		size += uint64_t(vertex_stride + normal_tangent_stride + attribute_stride + skin_stride) * surface.array_length;
+		size += uint64_t(surface.index_array_length) * (surface.array_length <= 65536 ? 2 : 4);
+	}
+	return size;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
@@ -2338,6 +2363,24 @@ ArrayMesh::~ArrayMesh() {
 }
 ///////////////
 
+bool PlaceholderMesh::_set(const StringName &p_name, const Variant &p_value) {
+	// Keep the bounds of an ArrayMesh loaded as a placeholder, surface data is skipped by the loader.
+	if (p_name == "_surfaces") {
+		Array surfaces = p_value;
+		for (int i = 0; i < surfaces.size(); i++) {
+			Dictionary d = surfaces[i];
+			AABB surface_aabb = d.get("aabb", AABB());
+			if (i == 0) {
+				aabb = surface_aabb;
+			} else {
+				aabb.merge_with(surface_aabb);
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
 void PlaceholderMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_aabb", "aabb"), &PlaceholderMesh::set_aabb);
 	ADD_PROPERTY(PropertyInfo(Variant::AABB, "aabb", PROPERTY_HINT_NONE, "suffix:m"), "set_aabb", "get_aabb");
@@ -124,6 +124,52 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_built.is_set()) {
+		return &instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_built.is_set()) {
+		return &instantiation_plan;
+	}
+
+	int nc = nodes.size();
+	instantiation_plan.nodes.resize(nc);
+	instantiation_plan.setters.clear();
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::PlanNode &pn = instantiation_plan.nodes[i];
+		pn.setter_offset = instantiation_plan.setters.size();
+
+		if (i > 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent >= 0 && n.parent < i) {
+			instantiation_plan.nodes[n.parent].child_count++;
+		}
+
+		bool created = !(i == 0 && base_scene_idx >= 0) && n.instance < 0 && n.type != TYPE_INSTANTIATED && n.type >= 0 && n.type < names.size();
+		pn.creation_func = created ? ClassDB::get_native_creation_func(names[n.type]) : nullptr;
+
+		for (const NodeData::Property &prop : n.properties) {
+			const ClassDB::PropertySetGet *setter = nullptr;
+			if (pn.creation_func && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name < names.size() && names[prop.name] != CoreStringName(script)) {
+				setter = ClassDB::get_property_setget(names[n.type], names[prop.name]);
+			}
+			instantiation_plan.setters.push_back(setter);
+		}
+	}
+
+	instantiation_plan_built.set();
+	return &instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_built.clear();
+	instantiation_plan.nodes.clear();
+	instantiation_plan.setters.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -141,6 +187,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	int nc = nodes.size();
 	ERR_FAIL_COND_V_MSG(nc == 0, nullptr, vformat("Failed to instantiate scene state of \"%s\", node count is 0. Make sure the PackedScene resource is valid.", path));
 
+	// The plan caches what ClassDB resolves, which can change in the editor (e.g. when reloading extensions).
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = _get_instantiation_plan();
+	}
+
 	const StringName *snames = nullptr;
 	int sname_count = names.size();
 	if (sname_count) {
@@ -191,6 +243,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		const ClassDB::PropertySetGet *const *setters = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -257,10 +310,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *(*creation_func)() = plan ? plan->nodes[i].creation_func : nullptr;
+			Object *obj = creation_func ? creation_func() : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
 
+			if (node && creation_func) {
+				setters = plan->setters.ptr() + plan->nodes[i].setter_offset;
+				if (plan->nodes[i].child_count) {
+					node->data.children.reserve(plan->nodes[i].child_count);
+				}
+			}
+
 			if (!node) {
 				if (obj) {
 					memdelete(obj);
@@ -415,7 +476,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (setters && setters[j] && !node->get_script_instance()) {
+								ClassDB::set_property_with_setget(node, setters[j], value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1215,6 +1280,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1425,6 +1491,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1906,6 +1974,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1922,6 +1991,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1933,6 +2003,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -1977,6 +2048,7 @@ bool SceneState::rename_group_references(const StringName &p_old_name, const Str
 	for (const NodeData &node : nodes) {
 		for (const int &group : node.groups) {
 			if (names[group] == p_old_name) {
+				_clear_instantiation_plan();
 				names.write[group] = p_new_name;
 				edited = true;
 				break;
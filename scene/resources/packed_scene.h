@@ -89,6 +89,25 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Built on the first run-time instantiation, so the following ones don't look classes and setters up again.
+	struct InstantiationPlan {
+		struct PlanNode {
+			Object *(*creation_func)() = nullptr; // Only set for nodes created by this scene.
+			uint32_t setter_offset = 0; // One per property, null when it must go through Object::set().
+			uint32_t child_count = 0;
+		};
+
+		LocalVector<PlanNode> nodes;
+		LocalVector<const ClassDB::PropertySetGet *> setters;
+	};
+
+	mutable Mutex instantiation_plan_mutex;
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_built;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -517,6 +517,13 @@ Error ResourceLoaderText::load() {
 		String type = next_tag.fields["type"];
 		String id = next_tag.fields["id"];
 
+		if (ResourceLoader::is_loading_placeholders()) {
+			StringName placeholder_type = ResourceLoader::get_placeholder_type(type);
+			if (placeholder_type != StringName()) {
+				type = placeholder_type;
+			}
+		}
+
 		String path = local_path + "::" + id;
 
 		//bool exists=ResourceCache::has(path);
@@ -98,6 +98,9 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	// Splits a triangle list into clusters, reordering r_indices so each cluster's triangles are contiguous.
+	typedef Vector<RS::MeshCluster> (*BuildClustersFunc)(Vector<int> &r_indices, const Vector<Vector3> &p_vertices);
+	static BuildClustersFunc build_clusters_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
 private:
@@ -34,7 +34,12 @@
 #include "scene/gui/text_edit.h"
 
 Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
-	if (highlighting_cache.has(p_line)) {
+	// Catch up on the lines in between, in order, so their end state can converge.
+	while (text_edit != nullptr && dirty_line != -1 && dirty_line < p_line) {
+		get_line_syntax_highlighting(dirty_line);
+	}
+
+	if (highlighting_cache.has(p_line) && (dirty_line == -1 || p_line < dirty_line)) {
 		return highlighting_cache[p_line];
 	}
 
@@ -43,29 +48,88 @@ Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
 		return color_map;
 	}
 
+	HashMap<int, int>::ConstIterator prev_state = line_state_cache.find(p_line);
+	const bool had_state = bool(prev_state);
+	const int old_state = had_state ? prev_state->value : 0;
+
 	if (!GDVIRTUAL_CALL(_get_line_syntax_highlighting, p_line, color_map)) {
 		color_map = _get_line_syntax_highlighting_impl(p_line);
 	}
 
 	highlighting_cache[p_line] = color_map;
+
+	if (p_line == dirty_line) {
+		HashMap<int, int>::ConstIterator new_state = line_state_cache.find(p_line);
+		if (had_state && new_state && new_state->value == old_state) {
+			dirty_line = -1; // Same state as before the edit, so the following lines are still valid.
+		} else if (p_line >= highlighting_cache.back()->key()) {
+			dirty_line = -1; // Nothing cached past this line.
+		} else {
+			dirty_line = p_line + 1;
+		}
+	}
+
 	return color_map;
 }
 
 void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
 	if (highlighting_cache.size() < 1) {
+		line_state_cache.clear();
+		dirty_line = -1;
+		return;
+	}
+
+	const int first_line = MIN(p_from_line, p_to_line);
+	if (GDVIRTUAL_IS_OVERRIDDEN(_get_line_syntax_highlighting)) {
+		// Scripted highlighters don't report their line state, invalidate everything after the edit.
+		int cache_size = highlighting_cache.back()->key();
+		for (int i = first_line - 1; i <= cache_size; i++) {
+			if (highlighting_cache.has(i)) {
+				highlighting_cache.erase(i);
+			}
+		}
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
+	// Insertions report (first, last) and removals (last, first), so this is the line count change.
+	const int line_delta = p_to_line - p_from_line;
+	const int last_old_line = first_line + MAX(0, -line_delta);
+
+	// Drop the edited lines and move the ones after them to their new position,
+	// keeping their highlighting until their preceding state is known to differ.
+	RBMap<int, Dictionary> shifted_cache;
+	for (const KeyValue<int, Dictionary> &E : highlighting_cache) {
+		if (E.key < first_line - 1) {
+			shifted_cache.insert(E.key, E.value);
+		} else if (E.key > last_old_line && E.key + line_delta >= 0) {
+			shifted_cache.insert(E.key + line_delta, E.value);
+		}
+	}
+	highlighting_cache = shifted_cache;
+
+	HashMap<int, int> shifted_state;
+	for (const KeyValue<int, int> &E : line_state_cache) {
+		if (E.key < first_line - 1) {
+			shifted_state.insert(E.key, E.value);
+		} else if (E.key > last_old_line && E.key + line_delta >= 0) {
+			shifted_state.insert(E.key + line_delta, E.value);
 		}
 	}
+	line_state_cache = shifted_state;
+
+	if (dirty_line > last_old_line) {
+		dirty_line += line_delta;
+	}
+	dirty_line = dirty_line == -1 ? MAX(0, first_line - 1) : MIN(dirty_line, MAX(0, first_line - 1));
+	if (highlighting_cache.is_empty() || dirty_line > highlighting_cache.back()->key()) {
+		dirty_line = -1;
+	}
 }
 
 void SyntaxHighlighter::clear_highlighting_cache() {
 	highlighting_cache.clear();
+	line_state_cache.clear();
+	dirty_line = -1;
 
 	if (GDVIRTUAL_CALL(_clear_highlighting_cache)) {
 		return;
@@ -129,20 +193,20 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	Color keyword_color;
 	Color color;
 
-	color_region_cache[p_line] = -1;
+	line_state_cache[p_line] = -1;
 	int in_region = -1;
 	if (p_line != 0) {
 		int prev_region_line = p_line - 1;
-		while (prev_region_line > 0 && !color_region_cache.has(prev_region_line)) {
+		while (prev_region_line > 0 && !line_state_cache.has(prev_region_line)) {
 			prev_region_line--;
 		}
 		for (int i = prev_region_line; i < p_line - 1; i++) {
 			get_line_syntax_highlighting(i);
 		}
-		if (!color_region_cache.has(p_line - 1)) {
+		if (!line_state_cache.has(p_line - 1)) {
 			get_line_syntax_highlighting(p_line - 1);
 		}
-		in_region = color_region_cache[p_line - 1];
+		in_region = line_state_cache[p_line - 1];
 	}
 
 	const String &str = text_edit->get_line(p_line);
@@ -150,7 +214,7 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	Color prev_color;
 
 	if (in_region != -1 && str.length() == 0) {
-		color_region_cache[p_line] = in_region;
+		line_state_cache[p_line] = in_region;
 	}
 	for (int j = 0; j < line_length; j++) {
 		Dictionary highlighter_info;
@@ -215,7 +279,7 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 
 							j = line_length;
 							if (!color_regions[c].line_only) {
-								color_region_cache[p_line] = c;
+								line_state_cache[p_line] = c;
 							}
 						}
 						break;
@@ -284,7 +348,7 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 
 					j = from + (end_key_length - 1);
 					if (region_end_index == -1) {
-						color_region_cache[p_line] = in_region;
+						line_state_cache[p_line] = in_region;
 					}
 
 					in_region = -1;
@@ -414,10 +478,6 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	return color_map;
 }
 
-void CodeHighlighter::_clear_highlighting_cache() {
-	color_region_cache.clear();
-}
-
 void CodeHighlighter::_update_cache() {
 	font_color = text_edit->get_font_color();
 }
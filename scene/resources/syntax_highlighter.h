@@ -41,12 +41,18 @@ class SyntaxHighlighter : public Resource {
 
 private:
 	RBMap<int, Dictionary> highlighting_cache;
+	// Cached lines from here on were highlighted before an edit and are only
+	// trusted again once a line ends in the same state as it did before.
+	int dirty_line = -1;
 	void _lines_edited_from(int p_from_line, int p_to_line);
 
 protected:
 	ObjectID text_edit_instance_id; // For validity check
 	TextEdit *text_edit = nullptr;
 
+	// State at the end of each line that the next one depends on, e.g. the color region left open.
+	HashMap<int, int> line_state_cache;
+
 	static void _bind_methods();
 
 	GDVIRTUAL1RC(Dictionary, _get_line_syntax_highlighting, int)
@@ -82,7 +88,6 @@ private:
 		bool line_only = false;
 	};
 	Vector<ColorRegion> color_regions;
-	HashMap<int, int> color_region_cache;
 
 	Dictionary keywords;
 	Dictionary member_keywords;
@@ -101,7 +106,6 @@ protected:
 public:
 	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) override;
 
-	virtual void _clear_highlighting_cache() override;
 	virtual void _update_cache() override;
 
 	void add_keyword_color(const String &p_keyword, const Color &p_color);
@@ -0,0 +1,221 @@
+/**************************************************************************/
+/*  audio_decode_ahead.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_decode_ahead.h"
+
+#include "core/config/project_settings.h"
+#include "core/math/math_funcs.h"
+
+Mutex AudioDecodeAheadBuffer::buffers_mutex;
+LocalVector<AudioDecodeAheadBuffer *> AudioDecodeAheadBuffer::buffers;
+int AudioDecodeAheadBuffer::lookahead_msec = 0;
+Thread *AudioDecodeAheadBuffer::thread = nullptr;
+Semaphore AudioDecodeAheadBuffer::semaphore;
+SafeFlag AudioDecodeAheadBuffer::thread_exit;
+
+void AudioDecodeAheadBuffer::_thread_func(void *p_userdata) {
+	while (true) {
+		semaphore.wait();
+		if (thread_exit.is_set()) {
+			break;
+		}
+
+		// Hand out one block at a time so that every playback gets topped up before any single one is full.
+		MutexLock lock(buffers_mutex);
+		bool progress = true;
+		while (progress && !thread_exit.is_set()) {
+			progress = false;
+			for (AudioDecodeAheadBuffer *buffer : buffers) {
+				progress = buffer->_fill_block() || progress;
+			}
+		}
+	}
+}
+
+void AudioDecodeAheadBuffer::initialize() {
+	lookahead_msec = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/streams/decode_ahead_msec", PROPERTY_HINT_RANGE, "0,2000,1,suffix:ms"), 250);
+#ifdef THREADS_ENABLED
+	if (lookahead_msec > 0 && thread == nullptr) {
+		thread_exit.clear();
+		Thread::Settings settings;
+		settings.priority = Thread::PRIORITY_HIGH;
+		thread = memnew(Thread);
+		thread->start(_thread_func, nullptr, settings);
+	}
+#endif
+}
+
+void AudioDecodeAheadBuffer::finalize() {
+	if (thread == nullptr) {
+		return;
+	}
+	thread_exit.set();
+	semaphore.post();
+	thread->wait_to_finish();
+	memdelete(thread);
+	thread = nullptr;
+}
+
+bool AudioDecodeAheadBuffer::_fill_block() {
+	uint32_t block_count = blocks.size();
+	uint32_t wc = write_count.get();
+	if (block_count == 0 || wc - read_count.get() >= block_count) {
+		return false;
+	}
+
+	MutexLock lock(decode_mutex);
+	if (!source->decode_ahead_is_active()) {
+		return false;
+	}
+
+	uint32_t index = wc % block_count;
+	Block &block = blocks[index];
+	block.generation = generation.get();
+	block.start_position = source->decode_ahead_get_position();
+	block.frames = source->decode_ahead_mix(&block_frames[index * BLOCK_FRAMES], BLOCK_FRAMES);
+	block.end = block.frames < BLOCK_FRAMES || !source->decode_ahead_is_active();
+	block.end_position = source->decode_ahead_get_position();
+	block.loops = source->decode_ahead_get_loop_count();
+	write_count.increment();
+	return true;
+}
+
+void AudioDecodeAheadBuffer::init(Source *p_source, float p_sampling_rate) {
+	ERR_FAIL_NULL(p_source);
+	ERR_FAIL_COND(source != nullptr);
+	source = p_source;
+	frame_length = p_sampling_rate > 0 ? 1.0 / p_sampling_rate : 0.0;
+
+	if (thread == nullptr) {
+		// No decode thread, mix() will always decode directly.
+		return;
+	}
+
+	// Always keep at least two blocks so one can be decoded while the other is read.
+	uint32_t block_count = MAX(2, int(Math::ceil(lookahead_msec * 0.001 * p_sampling_rate / BLOCK_FRAMES)));
+	blocks.resize(block_count);
+	block_frames.resize(block_count * BLOCK_FRAMES);
+
+	MutexLock lock(buffers_mutex);
+	buffers.push_back(this);
+}
+
+void AudioDecodeAheadBuffer::release() {
+	if (blocks.is_empty()) {
+		return;
+	}
+	{
+		// Once removed from the list, the decode thread can't be touching this buffer anymore.
+		MutexLock lock(buffers_mutex);
+		buffers.erase(this);
+	}
+	blocks.clear();
+	block_frames.clear();
+}
+
+void AudioDecodeAheadBuffer::flush() {
+	generation.increment();
+	position.set(source->decode_ahead_get_position());
+	loops.set(source->decode_ahead_get_loop_count());
+	finished.set_to(!source->decode_ahead_is_active());
+	if (!blocks.is_empty()) {
+		semaphore.post();
+	}
+}
+
+int AudioDecodeAheadBuffer::mix(AudioFrame *p_buffer, int p_frames) {
+	int mixed = 0;
+	bool consumed = false;
+
+	while (mixed < p_frames && !finished.is_set()) {
+		uint32_t rc = read_count.get();
+		if (rc != write_count.get()) {
+			uint32_t index = rc % blocks.size();
+			const Block &block = blocks[index];
+			if (block.generation != generation.get()) {
+				// Decoded before the last seek.
+				read_offset = 0;
+				read_count.increment();
+				consumed = true;
+				continue;
+			}
+
+			int to_copy = MIN(block.frames - read_offset, p_frames - mixed);
+			memcpy(p_buffer + mixed, &block_frames[index * BLOCK_FRAMES + read_offset], to_copy * sizeof(AudioFrame));
+			mixed += to_copy;
+			read_offset += to_copy;
+			position.set(block.start_position + read_offset * frame_length);
+
+			if (read_offset == block.frames) {
+				position.set(block.end_position);
+				loops.set(block.loops);
+				if (block.end) {
+					finished.set();
+				}
+				read_offset = 0;
+				read_count.increment();
+				consumed = true;
+			}
+			continue;
+		}
+
+		// Nothing buffered, decode directly. This waits for the decode thread if it's busy with a block for us.
+		MutexLock lock(decode_mutex);
+		if (read_count.get() != write_count.get()) {
+			continue;
+		}
+		if (!source->decode_ahead_is_active()) {
+			finished.set();
+			break;
+		}
+		int to_mix = p_frames - mixed;
+		int decoded = source->decode_ahead_mix(p_buffer + mixed, to_mix);
+		mixed += decoded;
+		position.set(source->decode_ahead_get_position());
+		loops.set(source->decode_ahead_get_loop_count());
+		if (decoded < to_mix || !source->decode_ahead_is_active()) {
+			finished.set();
+		}
+		consumed = true;
+	}
+
+	for (int i = mixed; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+
+	if (consumed && !blocks.is_empty()) {
+		semaphore.post();
+	}
+	return mixed;
+}
+
+AudioDecodeAheadBuffer::~AudioDecodeAheadBuffer() {
+	release();
+}
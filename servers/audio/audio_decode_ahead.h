@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  audio_decode_ahead.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_DECODE_AHEAD_H
+#define AUDIO_DECODE_AHEAD_H
+
+#include "core/math/audio_frame.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Decodes compressed stream playbacks ahead of the audio thread.
+// Each playback owns one buffer. A shared decode thread keeps a ring of PCM blocks filled,
+// so that the audio thread only has to copy frames out of it. When the ring is empty (right
+// after starting or seeking, or if decoding falls behind), the audio thread decodes directly.
+class AudioDecodeAheadBuffer {
+public:
+	class Source {
+	public:
+		// All of these are called with the decode lock held.
+		// Decodes up to p_frames frames, filling the rest with silence if the stream ends.
+		// Returns the number of frames decoded.
+		virtual int decode_ahead_mix(AudioFrame *p_buffer, int p_frames) = 0;
+		virtual bool decode_ahead_is_active() const = 0;
+		virtual double decode_ahead_get_position() const = 0;
+		virtual int decode_ahead_get_loop_count() const = 0;
+
+		virtual ~Source() {}
+	};
+
+private:
+	enum {
+		BLOCK_FRAMES = 512,
+	};
+
+	struct Block {
+		uint32_t generation = 0;
+		int frames = 0;
+		bool end = false;
+		int loops = 0;
+		double start_position = 0.0;
+		double end_position = 0.0;
+	};
+
+	Source *source = nullptr;
+	double frame_length = 0.0;
+
+	LocalVector<Block> blocks;
+	LocalVector<AudioFrame> block_frames;
+
+	// The decode thread only advances write_count and the audio thread only advances read_count.
+	SafeNumeric<uint32_t> write_count;
+	SafeNumeric<uint32_t> read_count;
+	// Bumped on every seek; blocks decoded before it are skipped by the reader.
+	SafeNumeric<uint32_t> generation;
+	int read_offset = 0;
+
+	Mutex decode_mutex;
+
+	SafeNumeric<double> position;
+	SafeNumeric<int> loops;
+	SafeFlag finished;
+
+	bool _fill_block();
+
+	static Mutex buffers_mutex;
+	static LocalVector<AudioDecodeAheadBuffer *> buffers;
+	static int lookahead_msec;
+	static Thread *thread;
+	static Semaphore semaphore;
+	static SafeFlag thread_exit;
+
+	static void _thread_func(void *p_userdata);
+
+public:
+	static void initialize();
+	static void finalize();
+
+	// Registers the buffer with the decode thread. p_source must outlive it or call release() first.
+	void init(Source *p_source, float p_sampling_rate);
+	// Unregisters from the decode thread. Must be called before the source starts tearing down.
+	void release();
+
+	// Held around anything that touches the decoder outside of decode_ahead_mix().
+	Mutex &get_decode_mutex() { return decode_mutex; }
+	// Discards everything decoded so far. Call with the decode lock held, after seeking or stopping the source.
+	void flush();
+
+	// Audio thread only. Same contract as Source::decode_ahead_mix().
+	int mix(AudioFrame *p_buffer, int p_frames);
+
+	bool is_finished() const { return finished.is_set(); }
+	double get_position() const { return position.get(); }
+	int get_loop_count() const { return loops.get(); }
+
+	AudioDecodeAheadBuffer() {}
+	~AudioDecodeAheadBuffer();
+};
+
+#endif // AUDIO_DECODE_AHEAD_H
@@ -30,6 +30,15 @@
 
 #include "audio_filter_sw.h"
 
+// SSE2 and NEON are part of the x86_64 and arm64 baselines, so the stereo kernel is picked at compile time.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_FILTER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define AUDIO_FILTER_NEON
+#include <arm_neon.h>
+#endif
+
 void AudioFilterSW::set_mode(Mode p_mode) {
 	mode = p_mode;
 }
@@ -258,3 +267,106 @@ void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_str
 		}
 	}
 }
+
+void AudioFilterSW::Processor::process_stereo(Processor *p_left, Processor *p_right, AudioFrame *p_frames, int p_amount, bool p_interpolate) {
+	if (!p_left->filter || !p_right->filter) {
+		p_left->process(&p_frames[0].left, p_amount, 2, p_interpolate);
+		p_right->process(&p_frames[0].right, p_amount, 2, p_interpolate);
+		return;
+	}
+
+#if defined(AUDIO_FILTER_SSE2) || defined(AUDIO_FILTER_NEON)
+	// A biquad depends on its previous output, so frames can't be processed side by side. Instead, the left
+	// and right channels go in two lanes of the same register. The operations are the ones of process_one()
+	// in the same order, so the output matches the scalar path exactly.
+#if defined(AUDIO_FILTER_SSE2)
+#define PAIR(m_l, m_r) _mm_setr_ps(m_l, m_r, 0.0f, 0.0f)
+	typedef __m128 pair;
+#else
+#define PAIR(m_l, m_r) vset_lane_f32(m_r, vdup_n_f32(m_l), 1)
+	typedef float32x2_t pair;
+#endif
+
+	pair b0 = PAIR(p_left->coeffs.b0, p_right->coeffs.b0);
+	pair b1 = PAIR(p_left->coeffs.b1, p_right->coeffs.b1);
+	pair b2 = PAIR(p_left->coeffs.b2, p_right->coeffs.b2);
+	pair a1 = PAIR(p_left->coeffs.a1, p_right->coeffs.a1);
+	pair a2 = PAIR(p_left->coeffs.a2, p_right->coeffs.a2);
+
+	const pair ib0 = p_interpolate ? PAIR(p_left->incr_coeffs.b0, p_right->incr_coeffs.b0) : PAIR(0.0f, 0.0f);
+	const pair ib1 = p_interpolate ? PAIR(p_left->incr_coeffs.b1, p_right->incr_coeffs.b1) : PAIR(0.0f, 0.0f);
+	const pair ib2 = p_interpolate ? PAIR(p_left->incr_coeffs.b2, p_right->incr_coeffs.b2) : PAIR(0.0f, 0.0f);
+	const pair ia1 = p_interpolate ? PAIR(p_left->incr_coeffs.a1, p_right->incr_coeffs.a1) : PAIR(0.0f, 0.0f);
+	const pair ia2 = p_interpolate ? PAIR(p_left->incr_coeffs.a2, p_right->incr_coeffs.a2) : PAIR(0.0f, 0.0f);
+
+	pair ha1 = PAIR(p_left->ha1, p_right->ha1);
+	pair ha2 = PAIR(p_left->ha2, p_right->ha2);
+	pair hb1 = PAIR(p_left->hb1, p_right->hb1);
+	pair hb2 = PAIR(p_left->hb2, p_right->hb2);
+#undef PAIR
+
+	float *samples = &p_frames[0].left;
+	for (int i = 0; i < p_amount; i++) {
+#if defined(AUDIO_FILTER_SSE2)
+		const pair pre = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(samples + i * 2));
+		pair out = _mm_add_ps(_mm_mul_ps(pre, b0), _mm_mul_ps(hb1, b1));
+		out = _mm_add_ps(out, _mm_mul_ps(hb2, b2));
+		out = _mm_add_ps(out, _mm_mul_ps(ha1, a1));
+		out = _mm_add_ps(out, _mm_mul_ps(ha2, a2));
+		_mm_storel_pi(reinterpret_cast<__m64 *>(samples + i * 2), out);
+#else
+		const pair pre = vld1_f32(samples + i * 2);
+		pair out = vadd_f32(vmul_f32(pre, b0), vmul_f32(hb1, b1));
+		out = vadd_f32(out, vmul_f32(hb2, b2));
+		out = vadd_f32(out, vmul_f32(ha1, a1));
+		out = vadd_f32(out, vmul_f32(ha2, a2));
+		vst1_f32(samples + i * 2, out);
+#endif
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = pre;
+		ha1 = out;
+
+		if (p_interpolate) {
+#if defined(AUDIO_FILTER_SSE2)
+			b0 = _mm_add_ps(b0, ib0);
+			b1 = _mm_add_ps(b1, ib1);
+			b2 = _mm_add_ps(b2, ib2);
+			a1 = _mm_add_ps(a1, ia1);
+			a2 = _mm_add_ps(a2, ia2);
+#else
+			b0 = vadd_f32(b0, ib0);
+			b1 = vadd_f32(b1, ib1);
+			b2 = vadd_f32(b2, ib2);
+			a1 = vadd_f32(a1, ia1);
+			a2 = vadd_f32(a2, ia2);
+#endif
+		}
+	}
+
+	// Write the state back to each processor.
+	const pair *state[9] = { &b0, &b1, &b2, &a1, &a2, &ha1, &ha2, &hb1, &hb2 };
+	float *left_state[9] = { &p_left->coeffs.b0, &p_left->coeffs.b1, &p_left->coeffs.b2, &p_left->coeffs.a1, &p_left->coeffs.a2, &p_left->ha1, &p_left->ha2, &p_left->hb1, &p_left->hb2 };
+	float *right_state[9] = { &p_right->coeffs.b0, &p_right->coeffs.b1, &p_right->coeffs.b2, &p_right->coeffs.a1, &p_right->coeffs.a2, &p_right->ha1, &p_right->ha2, &p_right->hb1, &p_right->hb2 };
+	for (int i = 0; i < 9; i++) {
+		float lanes[4];
+#if defined(AUDIO_FILTER_SSE2)
+		_mm_storeu_ps(lanes, *state[i]);
+#else
+		vst1_f32(lanes, *state[i]);
+#endif
+		*left_state[i] = lanes[0];
+		*right_state[i] = lanes[1];
+	}
+#else
+	for (int i = 0; i < p_amount; i++) {
+		if (p_interpolate) {
+			p_left->process_one_interp(p_frames[i].left);
+			p_right->process_one_interp(p_frames[i].right);
+		} else {
+			p_left->process_one(p_frames[i].left);
+			p_right->process_one(p_frames[i].right);
+		}
+	}
+#endif
+}
@@ -101,6 +101,40 @@ uint32_t AudioRBResampler::_resample(AudioFrame *p_dest, int p_todo, int32_t p_i
 	return read >> MIX_FRAC_BITS; //rb_read_pos = offset >> MIX_FRAC_BITS;
 }
 
+// Windowed-sinc interpolation, see AudioSincResampler. The frames around the read position
+// are copied out of the ring first, so the kernel can read them contiguously.
+template <int C>
+uint32_t AudioRBResampler::_resample_sinc(AudioFrame *p_dest, int p_todo, int32_t p_increment) {
+	const int taps = AudioSincResampler::get_taps();
+	uint64_t first = uint64_t(offset) + p_increment;
+	uint64_t last = uint64_t(offset) + uint64_t(p_todo) * p_increment;
+
+	// Interpolating between frames `pos` and `pos + 1` reads taps / 2 frames on each side of them.
+	int64_t base = int64_t(first >> MIX_FRAC_BITS) - taps / 2 + 1;
+	uint32_t count = uint32_t((last >> MIX_FRAC_BITS) - (first >> MIX_FRAC_BITS)) + taps;
+	if (kernel_frames.size() < count) {
+		kernel_frames.resize(count);
+	}
+
+	AudioFrame *frames = kernel_frames.ptr();
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t pos = uint32_t(base + i) & rb_mask;
+		if constexpr (C == 1) {
+			frames[i] = AudioFrame(rb[pos], rb[pos]);
+		} else {
+			frames[i] = AudioFrame(rb[pos * C + 0], rb[pos * C + 1]);
+		}
+	}
+
+	// Relative to `frames`, the newest frame the kernel reads is taps - 1 frames past `pos`.
+	uint64_t start = (first & MIX_FRAC_MASK) + (uint64_t(taps - 1) << MIX_FRAC_BITS);
+	AudioSincResampler::resample(frames, p_dest, p_todo, start, p_increment, MIX_FRAC_BITS);
+
+	uint32_t read = (offset & MIX_FRAC_MASK) + uint64_t(p_todo) * p_increment;
+	offset = last & (((1 << (rb_bits + MIX_FRAC_BITS)) - 1));
+	return read >> MIX_FRAC_BITS;
+}
+
 bool AudioRBResampler::mix(AudioFrame *p_dest, int p_frames) {
 	if (!rb) {
 		return false;
@@ -112,19 +146,36 @@ bool AudioRBResampler::mix(AudioFrame *p_dest, int p_frames) {
 
 	{
 		int src_read = 0;
-		switch (channels) {
-			case 1:
-				src_read = _resample<1>(p_dest, target_todo, increment);
-				break;
-			case 2:
-				src_read = _resample<2>(p_dest, target_todo, increment);
-				break;
-			case 4:
-				src_read = _resample<4>(p_dest, target_todo, increment);
-				break;
-			case 6:
-				src_read = _resample<6>(p_dest, target_todo, increment);
-				break;
+		if (kernel_margin > 0) {
+			switch (channels) {
+				case 1:
+					src_read = _resample_sinc<1>(p_dest, target_todo, increment);
+					break;
+				case 2:
+					src_read = _resample_sinc<2>(p_dest, target_todo, increment);
+					break;
+				case 4:
+					src_read = _resample_sinc<4>(p_dest, target_todo, increment);
+					break;
+				case 6:
+					src_read = _resample_sinc<6>(p_dest, target_todo, increment);
+					break;
+			}
+		} else {
+			switch (channels) {
+				case 1:
+					src_read = _resample<1>(p_dest, target_todo, increment);
+					break;
+				case 2:
+					src_read = _resample<2>(p_dest, target_todo, increment);
+					break;
+				case 4:
+					src_read = _resample<4>(p_dest, target_todo, increment);
+					break;
+				case 6:
+					src_read = _resample<6>(p_dest, target_todo, increment);
+					break;
+			}
 		}
 
 		if (src_read > read_space) {
@@ -154,7 +205,7 @@ int AudioRBResampler::get_num_of_ready_frames() {
 		return 0;
 	}
 	int32_t increment = (src_mix_rate * MIX_FRAC_LEN) / target_mix_rate;
-	int read_space = get_reader_space();
+	int read_space = MAX(0, get_reader_space() - int(kernel_margin));
 	return (int64_t(read_space) << MIX_FRAC_BITS) / increment;
 }
 
@@ -183,6 +234,7 @@ Error AudioRBResampler::setup(int p_channels, int p_src_mix_rate, int p_target_m
 
 	src_mix_rate = p_src_mix_rate;
 	target_mix_rate = p_target_mix_rate;
+	kernel_margin = AudioSincResampler::get_taps() / 2;
 	offset = 0;
 	rb_read_pos.set(0);
 	rb_write_pos.set(0);
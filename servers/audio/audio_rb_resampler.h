@@ -33,7 +33,9 @@
 
 #include "core/os/memory.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
+#include "servers/audio/audio_sinc_resampler.h"
 #include "servers/audio_server.h"
 
 struct AudioRBResampler {
@@ -58,8 +60,15 @@ struct AudioRBResampler {
 	float *read_buf = nullptr;
 	float *rb = nullptr;
 
+	// Frames the sinc kernel reads on each side of the read position. They are kept out of
+	// both the reader and the writer space, so neither unwritten nor overwritten frames are read.
+	uint32_t kernel_margin = 0;
+	LocalVector<AudioFrame> kernel_frames;
+
 	template <int C>
 	uint32_t _resample(AudioFrame *p_dest, int p_todo, int32_t p_increment);
+	template <int C>
+	uint32_t _resample_sinc(AudioFrame *p_dest, int p_todo, int32_t p_increment);
 
 public:
 	_FORCE_INLINE_ void flush() {
@@ -90,7 +99,7 @@ public:
 			space = (rb_len - r) + w - 1;
 		}
 
-		return space;
+		return MAX(0, space - int(kernel_margin));
 	}
 
 	_FORCE_INLINE_ int get_reader_space() const {
@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  audio_sinc_resampler.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_sinc_resampler.h"
+
+#include "core/config/project_settings.h"
+#include "core/math/math_funcs.h"
+
+// SSE2 and NEON are part of the x86_64 and arm64 baselines, so the kernel is picked at compile time.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SINC_RESAMPLER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define SINC_RESAMPLER_NEON
+#include <arm_neon.h>
+#endif
+
+AudioSincResampler::Quality AudioSincResampler::quality = AudioSincResampler::QUALITY_CUBIC;
+int AudioSincResampler::taps = 0;
+LocalVector<float> AudioSincResampler::coefficients;
+
+// Zeroth order modified Bessel function of the first kind, for the Kaiser window.
+static double _bessel_i0(double p_x) {
+	double sum = 1.0;
+	double term = 1.0;
+	double half_x = p_x * 0.5;
+	for (int k = 1; k < 32; k++) {
+		term *= half_x / k;
+		sum += term * term;
+		if (term * term < sum * 1e-12) {
+			break;
+		}
+	}
+	return sum;
+}
+
+void AudioSincResampler::initialize() {
+	set_quality(Quality(int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/resampling_quality", PROPERTY_HINT_ENUM, "Cubic,Sinc (Low),Sinc (Medium),Sinc (High)"), QUALITY_CUBIC))));
+}
+
+void AudioSincResampler::set_quality(Quality p_quality) {
+	ERR_FAIL_INDEX(p_quality, QUALITY_SINC_HIGH + 1);
+
+	// Cutoff is relative to the Nyquist frequency. Longer kernels afford a steeper transition band.
+	static const struct {
+		int taps;
+		double cutoff;
+		double beta;
+	} presets[] = {
+		{ 0, 0.0, 0.0 },
+		{ 8, 0.85, 6.0 },
+		{ 16, 0.9, 7.0 },
+		{ 32, 0.95, 8.6 },
+	};
+
+	quality = p_quality;
+	taps = presets[p_quality].taps;
+	coefficients.clear();
+	if (taps == 0) {
+		return;
+	}
+
+	const double cutoff = presets[p_quality].cutoff;
+	const double half = taps / 2;
+	const double window_scale = 1.0 / _bessel_i0(presets[p_quality].beta);
+	coefficients.resize(PHASE_COUNT * taps * 2);
+
+	double row[MAX_TAPS];
+	for (int phase = 0; phase < PHASE_COUNT; phase++) {
+		// Position of the interpolated point, in taps.
+		double center = half - 1.0 + double(phase) / PHASE_COUNT;
+		double sum = 0.0;
+		for (int k = 0; k < taps; k++) {
+			double x = k - center;
+			double sinc = Math::is_zero_approx(x) ? 1.0 : Math::sin(Math_PI * cutoff * x) / (Math_PI * cutoff * x);
+			double r = x / half;
+			double window = r * r < 1.0 ? _bessel_i0(presets[p_quality].beta * Math::sqrt(1.0 - r * r)) * window_scale : 0.0;
+			row[k] = sinc * window;
+			sum += row[k];
+		}
+		// Normalize so that every phase has unity gain at DC.
+		float *dst = &coefficients[phase * taps * 2];
+		for (int k = 0; k < taps; k++) {
+			dst[k * 2 + 0] = row[k] / sum;
+			dst[k * 2 + 1] = row[k] / sum;
+		}
+	}
+}
+
+void AudioSincResampler::resample(const AudioFrame *p_src, AudioFrame *p_dst, int p_frames, uint64_t p_offset, uint64_t p_increment, int p_frac_bits) {
+	const int kernel_taps = taps;
+	ERR_FAIL_COND(kernel_taps == 0);
+	const float *table = coefficients.ptr();
+	const uint64_t frac_mask = (uint64_t(1) << p_frac_bits) - 1;
+	const int phase_shift = p_frac_bits - PHASE_BITS;
+
+	for (int i = 0; i < p_frames; i++) {
+		uint64_t pos = p_offset >> p_frac_bits;
+		uint32_t phase = uint32_t((p_offset & frac_mask) >> phase_shift);
+		const float *src = reinterpret_cast<const float *>(p_src + pos + 1 - kernel_taps);
+		const float *row = table + phase * kernel_taps * 2;
+
+		// Each register holds two stereo frames. Taps are always a multiple of four.
+#if defined(SINC_RESAMPLER_SSE2)
+		__m128 acc0 = _mm_setzero_ps();
+		__m128 acc1 = _mm_setzero_ps();
+		for (int k = 0; k < kernel_taps * 2; k += 8) {
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(src + k), _mm_loadu_ps(row + k)));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(src + k + 4), _mm_loadu_ps(row + k + 4)));
+		}
+		__m128 acc = _mm_add_ps(acc0, acc1);
+		acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+		_mm_storel_pi(reinterpret_cast<__m64 *>(p_dst + i), acc);
+#elif defined(SINC_RESAMPLER_NEON)
+		float32x4_t acc0 = vdupq_n_f32(0.0f);
+		float32x4_t acc1 = vdupq_n_f32(0.0f);
+		for (int k = 0; k < kernel_taps * 2; k += 8) {
+			acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(src + k), vld1q_f32(row + k)));
+			acc1 = vaddq_f32(acc1, vmulq_f32(vld1q_f32(src + k + 4), vld1q_f32(row + k + 4)));
+		}
+		float32x4_t acc = vaddq_f32(acc0, acc1);
+		vst1_f32(reinterpret_cast<float *>(p_dst + i), vadd_f32(vget_low_f32(acc), vget_high_f32(acc)));
+#else
+		float acc0[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float acc1[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int k = 0; k < kernel_taps * 2; k += 8) {
+			for (int l = 0; l < 4; l++) {
+				acc0[l] = acc0[l] + src[k + l] * row[k + l];
+				acc1[l] = acc1[l] + src[k + 4 + l] * row[k + 4 + l];
+			}
+		}
+		p_dst[i].left = (acc0[0] + acc1[0]) + (acc0[2] + acc1[2]);
+		p_dst[i].right = (acc0[1] + acc1[1]) + (acc0[3] + acc1[3]);
+#endif
+
+		p_offset += p_increment;
+	}
+}
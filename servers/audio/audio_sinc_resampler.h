@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  audio_sinc_resampler.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_SINC_RESAMPLER_H
+#define AUDIO_SINC_RESAMPLER_H
+
+#include "core/math/audio_frame.h"
+#include "core/templates/local_vector.h"
+
+// Polyphase windowed-sinc interpolation, shared by AudioStreamPlaybackResampled and AudioRBResampler.
+// The kernel is picked once at startup from the audio/general/resampling_quality project setting.
+class AudioSincResampler {
+public:
+	enum Quality {
+		QUALITY_CUBIC,
+		QUALITY_SINC_LOW,
+		QUALITY_SINC_MEDIUM,
+		QUALITY_SINC_HIGH,
+	};
+
+	enum {
+		MAX_TAPS = 32,
+		PHASE_BITS = 10,
+		PHASE_COUNT = 1 << PHASE_BITS,
+	};
+
+private:
+	static Quality quality;
+	static int taps;
+	// PHASE_COUNT rows of `taps` coefficients. Each coefficient is stored twice, once per stereo channel,
+	// so that a row lines up with the AudioFrames it's applied to.
+	static LocalVector<float> coefficients;
+
+public:
+	static void initialize();
+	// Not thread-safe, must not be called while mixing.
+	static void set_quality(Quality p_quality);
+	static Quality get_quality() { return quality; }
+
+	// Number of source frames the kernel reads, 0 when using cubic interpolation.
+	_FORCE_INLINE_ static int get_taps() { return taps; }
+
+	// Writes p_frames frames to p_dst. Frame i is interpolated at the fixed point position
+	// p_offset + i * p_increment (with p_frac_bits fractional bits), which is truncated to `pos`.
+	// The kernel reads p_src[pos - taps + 1] to p_src[pos] and interpolates between
+	// p_src[pos - taps / 2] and p_src[pos - taps / 2 + 1], so it lags taps / 2 frames behind `pos`.
+	static void resample(const AudioFrame *p_src, AudioFrame *p_dst, int p_frames, uint64_t p_offset, uint64_t p_increment, int p_frac_bits);
+};
+
+#endif // AUDIO_SINC_RESAMPLER_H
@@ -120,13 +120,12 @@ AudioStreamPlayback::~AudioStreamPlayback() {
 //////////////////////////////
 
 void AudioStreamPlaybackResampled::begin_resample() {
-	//clear cubic interpolation history
-	internal_buffer[0] = AudioFrame(0.0, 0.0);
-	internal_buffer[1] = AudioFrame(0.0, 0.0);
-	internal_buffer[2] = AudioFrame(0.0, 0.0);
-	internal_buffer[3] = AudioFrame(0.0, 0.0);
+	//clear interpolation history
+	for (int i = 0; i < INTERP_HISTORY; i++) {
+		internal_buffer[i] = AudioFrame(0.0, 0.0);
+	}
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_mix_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
 }
 
@@ -154,40 +153,71 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
 
+	const int sinc_taps = AudioSincResampler::get_taps();
+	// Both kernels lag half their length behind the newest frame, so they read the same frame when no interpolation is needed.
+	const int lag = sinc_taps > 0 ? sinc_taps / 2 : CUBIC_INTERP_HISTORY / 2;
+	const AudioFrame *src = internal_buffer + INTERP_HISTORY;
+
 	int mixed_frames_total = -1;
 
-	int i;
-	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
-			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
-			mixed_frames_total = i;
+	int i = 0;
+	while (i < p_frames) {
+		// Frames that can be mixed before the internal buffer needs to be refilled.
+		int run = p_frames - i;
+		if (mix_increment > 0) {
+			uint64_t left = (uint64_t(INTERNAL_BUFFER_LEN) << FP_BITS) - mix_offset;
+			run = MIN(uint64_t(run), (left + mix_increment - 1) / mix_increment);
 		}
 
-		float mu2 = mu * mu;
-		AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
-		AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = 2 * y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		if (mixed_frames_total == -1 && internal_buffer_end != (unsigned int)-1) {
+			// The internal buffer ends somewhere in this range, find how many good frames we have.
+			int64_t end_offset = (int64_t(internal_buffer_end) - CUBIC_INTERP_HISTORY) * FP_LEN;
+			if (int64_t(mix_offset) >= end_offset) {
+				mixed_frames_total = i;
+			} else if (mix_increment > 0) {
+				uint64_t until_end = (uint64_t(end_offset - int64_t(mix_offset)) + mix_increment - 1) / mix_increment;
+				if (until_end < uint64_t(run)) {
+					mixed_frames_total = i + int(until_end);
+				}
+			}
+		}
 
-		mix_offset += mix_increment;
+		if (mix_increment == FP_LEN && (mix_offset & FP_MASK) == 0) {
+			// Same rate as the output, no interpolation needed.
+			memcpy(p_buffer + i, src + (mix_offset >> FP_BITS) - lag, run * sizeof(AudioFrame));
+			mix_offset += uint64_t(run) << FP_BITS;
+		} else if (sinc_taps > 0) {
+			AudioSincResampler::resample(src, p_buffer + i, run, mix_offset, mix_increment, FP_BITS);
+			mix_offset += uint64_t(run) * mix_increment;
+		} else {
+			for (int j = 0; j < run; j++) {
+				int idx = int(mix_offset >> FP_BITS);
+				//standard cubic interpolation (great quality/performance ratio)
+				//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+				float mu = (mix_offset & FP_MASK) / float(FP_LEN);
+				AudioFrame y0 = src[idx - 3];
+				AudioFrame y1 = src[idx - 2];
+				AudioFrame y2 = src[idx - 1];
+				AudioFrame y3 = src[idx - 0];
+
+				float mu2 = mu * mu;
+				AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
+				AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
+				AudioFrame a2 = y2 - y0;
+				AudioFrame a3 = 2 * y1;
+
+				p_buffer[i + j] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+
+				mix_offset += mix_increment;
+			}
+		}
+		i += run;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
-			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
-			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
-			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
-			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			for (int j = 0; j < INTERP_HISTORY; j++) {
+				internal_buffer[j] = internal_buffer[INTERNAL_BUFFER_LEN + j];
+			}
+			int mixed_frames = _mix_internal(internal_buffer + INTERP_HISTORY, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
@@ -198,7 +228,7 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
 		}
 	}
-	if (mixed_frames_total == -1 && i == p_frames) {
+	if (mixed_frames_total == -1) {
 		mixed_frames_total = p_frames;
 	}
 	return mixed_frames_total;
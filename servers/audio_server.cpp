@@ -41,11 +41,136 @@
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "scene/scene_string_names.h"
+#include "servers/audio/audio_decode_ahead.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_sinc_resampler.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
 
+// SSE2 and NEON are part of the x86_64 and arm64 baselines, so the mixing kernels are picked at compile time.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+// Frame loops of the mix step. The vector paths handle two stereo frames per register and evaluate
+// the same expressions as the scalar tails, so the output doesn't depend on the backend.
+
+// Applies a volume ramp that goes from p_vol_start at frame 0 to p_vol_final at frame p_length, to the
+// p_count frames that start at p_offset. The result is either stored or added to r_dst.
+template <bool p_accumulate>
+static void _mix_frames_ramp(AudioFrame *r_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_offset, uint32_t p_count, uint32_t p_length) {
+	uint32_t i = 0;
+#if defined(AUDIO_MIX_SSE2)
+	const __m128 vol_start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m128 vol_final = _mm_setr_ps(p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 length = _mm_set1_ps((float)p_length);
+	__m128 frame_idx = _mm_setr_ps((float)p_offset, (float)p_offset, (float)(p_offset + 1), (float)(p_offset + 1));
+	for (; i + 2 <= p_count; i += 2) {
+		const __m128 lerp_param = _mm_div_ps(frame_idx, length);
+		const __m128 vol = _mm_add_ps(_mm_mul_ps(vol_final, lerp_param), _mm_mul_ps(_mm_sub_ps(one, lerp_param), vol_start));
+		__m128 mixed = _mm_mul_ps(vol, _mm_loadu_ps(&p_src[i].left));
+		if (p_accumulate) {
+			mixed = _mm_add_ps(_mm_loadu_ps(&r_dst[i].left), mixed);
+		}
+		_mm_storeu_ps(&r_dst[i].left, mixed);
+		frame_idx = _mm_add_ps(frame_idx, two);
+	}
+#elif defined(AUDIO_MIX_NEON)
+	const float32x4_t vol_start = vcombine_f32(vld1_f32(&p_vol_start.left), vld1_f32(&p_vol_start.left));
+	const float32x4_t vol_final = vcombine_f32(vld1_f32(&p_vol_final.left), vld1_f32(&p_vol_final.left));
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	const float32x4_t two = vdupq_n_f32(2.0f);
+	const float32x4_t length = vdupq_n_f32((float)p_length);
+	float32x4_t frame_idx = vcombine_f32(vdup_n_f32((float)p_offset), vdup_n_f32((float)(p_offset + 1)));
+	for (; i + 2 <= p_count; i += 2) {
+		const float32x4_t lerp_param = vdivq_f32(frame_idx, length);
+		const float32x4_t vol = vaddq_f32(vmulq_f32(vol_final, lerp_param), vmulq_f32(vsubq_f32(one, lerp_param), vol_start));
+		float32x4_t mixed = vmulq_f32(vol, vld1q_f32(&p_src[i].left));
+		if (p_accumulate) {
+			mixed = vaddq_f32(vld1q_f32(&r_dst[i].left), mixed);
+		}
+		vst1q_f32(&r_dst[i].left, mixed);
+		frame_idx = vaddq_f32(frame_idx, two);
+	}
+#endif
+	for (; i < p_count; i++) {
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		float lerp_param = (float)(p_offset + i) / p_length;
+		AudioFrame mixed = (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_src[i];
+		if (p_accumulate) {
+			r_dst[i] += mixed;
+		} else {
+			r_dst[i] = mixed;
+		}
+	}
+}
+
+static void _mix_frames_add(AudioFrame *r_dst, const AudioFrame *p_src, uint32_t p_count) {
+	uint32_t i = 0;
+#if defined(AUDIO_MIX_SSE2)
+	for (; i + 2 <= p_count; i += 2) {
+		_mm_storeu_ps(&r_dst[i].left, _mm_add_ps(_mm_loadu_ps(&r_dst[i].left), _mm_loadu_ps(&p_src[i].left)));
+	}
+#elif defined(AUDIO_MIX_NEON)
+	for (; i + 2 <= p_count; i += 2) {
+		vst1q_f32(&r_dst[i].left, vaddq_f32(vld1q_f32(&r_dst[i].left), vld1q_f32(&p_src[i].left)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_dst[i] += p_src[i];
+	}
+}
+
+// Scales the frames by p_volume and returns the peak absolute value of each channel after scaling.
+static AudioFrame _mix_frames_scale_with_peak(AudioFrame *r_buf, float p_volume, uint32_t p_count) {
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t i = 0;
+#if defined(AUDIO_MIX_SSE2)
+	const __m128 volume = _mm_set1_ps(p_volume);
+	const __m128 sign_mask = _mm_set1_ps(-0.0f);
+	__m128 peak4 = _mm_setzero_ps();
+	for (; i + 2 <= p_count; i += 2) {
+		const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(&r_buf[i].left), volume);
+		_mm_storeu_ps(&r_buf[i].left, scaled);
+		// With the running peak as the second operand, NaN samples are skipped like in the scalar comparison.
+		peak4 = _mm_max_ps(_mm_andnot_ps(sign_mask, scaled), peak4);
+	}
+	float lanes[4];
+	_mm_storeu_ps(lanes, peak4);
+	peak = AudioFrame(MAX(lanes[0], lanes[2]), MAX(lanes[1], lanes[3]));
+#elif defined(AUDIO_MIX_NEON)
+	const float32x4_t volume = vdupq_n_f32(p_volume);
+	float32x4_t peak4 = vdupq_n_f32(0.0f);
+	for (; i + 2 <= p_count; i += 2) {
+		const float32x4_t scaled = vmulq_f32(vld1q_f32(&r_buf[i].left), volume);
+		vst1q_f32(&r_buf[i].left, scaled);
+		peak4 = vmaxnmq_f32(peak4, vabsq_f32(scaled));
+	}
+	const float32x2_t peak2 = vmaxnm_f32(vget_low_f32(peak4), vget_high_f32(peak4));
+	peak = AudioFrame(vget_lane_f32(peak2, 0), vget_lane_f32(peak2, 1));
+#endif
+	for (; i < p_count; i++) {
+		r_buf[i] *= p_volume;
+
+		float l = ABS(r_buf[i].left);
+		if (l > peak.left) {
+			peak.left = l;
+		}
+		float r = ABS(r_buf[i].right);
+		if (r > peak.right) {
+			peak.right = r;
+		}
+	}
+	return peak;
+}
+
 #ifdef TOOLS_ENABLED
 #define MARK_EDITED set_edited(true);
 #else
@@ -134,6 +259,14 @@ int AudioDriver::_get_configured_mix_rate() {
 #endif
 }
 
+Thread::Settings AudioDriver::_get_mix_thread_settings() const {
+	Thread::Settings settings;
+	if (GLOBAL_GET("audio/driver/realtime_thread_priority")) {
+		settings.priority = Thread::PRIORITY_REALTIME;
+	}
+	return settings;
+}
+
 AudioDriver::SpeakerMode AudioDriver::get_speaker_mode_by_total_channels(int p_channels) const {
 	switch (p_channels) {
 		case 4:
@@ -215,6 +348,7 @@ int AudioDriverManager::get_driver_count() {
 
 void AudioDriverManager::initialize(int p_driver) {
 	GLOBAL_DEF_RST("audio/driver/enable_input", false);
+	GLOBAL_DEF_RST("audio/driver/realtime_thread_priority", false);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/mix_rate", PROPERTY_HINT_RANGE, "11025,192000,1,or_greater,suffix:Hz"), DEFAULT_MIX_RATE);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/mix_rate.web", PROPERTY_HINT_RANGE, "0,192000,1,or_greater,suffix:Hz"), 0); // Safer default output_latency for web (use browser default).
 
@@ -259,6 +393,7 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope tag_scope(Memory::TAG_AUDIO);
 	mix_count++;
 	int todo = p_frames;
 
@@ -375,6 +510,10 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	if (virtual_voices_enabled) {
+		_update_voices();
+	}
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -385,7 +524,14 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		if (playback->voice_state.load() == AudioStreamPlaybackListNode::VOICE_VIRTUAL) {
+			// Nothing is decoded nor mixed, only the position moves.
+			_advance_virtual_voice(playback);
+			_update_playback_state(playback);
+			continue;
+		}
+
+		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE || playback->voice_state.load() == AudioStreamPlaybackListNode::VOICE_FADING_TO_VIRTUAL;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -492,156 +638,285 @@ void AudioServer::_mix_step() {
 			std::copy(std::begin(bus_details.volume[bus_idx]), std::end(bus_details.volume[bus_idx]), std::begin(playback->prev_bus_details->volume[bus_idx]));
 		}
 
-		switch (playback->state.load()) {
-			case AudioStreamPlaybackListNode::AWAITING_DELETION:
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
-				playback_list.erase(playback, [](AudioStreamPlaybackListNode *p) {
-					delete p->prev_bus_details;
-					delete p->bus_details;
-					p->stream_playback.unref();
-					delete p;
-				});
-				break;
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
-				// Pause the stream.
-				AudioStreamPlaybackListNode::PlaybackState old_state, new_state;
-				do {
-					old_state = playback->state.load();
-					new_state = AudioStreamPlaybackListNode::PAUSED;
-				} while (!playback->state.compare_exchange_strong(/* expected= */ old_state, new_state));
-			} break;
-			case AudioStreamPlaybackListNode::PLAYING:
-			case AudioStreamPlaybackListNode::PAUSED:
-				// No-op!
-				break;
+		if (playback->voice_state.load() == AudioStreamPlaybackListNode::VOICE_FADING_TO_VIRTUAL) {
+			playback->virtual_position.set(playback->stream_playback->get_playback_position());
+			playback->voice_state.store(AudioStreamPlaybackListNode::VOICE_VIRTUAL);
 		}
-	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
-
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		_update_playback_state(playback);
+	}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+	// Buses only send to buses with a lower index, so every bus can be given a depth that is greater than
+	// the depth of all the buses sending to it. The buses of each depth don't depend on each other.
+	int bus_count = buses.size();
+	bus_send_index.resize(bus_count);
+	bus_depth.resize(bus_count);
+	int max_depth = 0;
+	for (int i = 0; i < bus_count; i++) {
+		bus_depth[i] = 0;
+	}
+	for (int i = bus_count - 1; i >= 0; i--) {
+		int send = -1;
+		if (i > 0) {
+			//everything has a send save for master bus
+			HashMap<StringName, Bus *>::Iterator E = bus_map.find(buses[i]->send);
+			if (!E || E->value->index_cache >= i) { //invalid, send to master
+				send = 0;
+			} else {
+				send = E->value->index_cache;
 			}
+			bus_depth[send] = MAX(bus_depth[send], bus_depth[i] + 1);
 		}
+		bus_send_index[i] = send;
+		max_depth = MAX(max_depth, bus_depth[i]);
+	}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
-
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	for (int depth = 0; depth <= max_depth; depth++) {
+		bus_wave.clear();
+		for (int i = bus_count - 1; i >= 0; i--) {
+			if (bus_depth[i] != depth) {
+				continue;
+			}
+			bus_wave.push_back(i);
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			// Receive sends before processing, in the order buses are sent when processed one by one.
+			for (int j = bus_count - 1; j > i; j--) {
+				if (bus_send_index[j] != i) {
+					continue;
 				}
-
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+				Bus *source = buses[j];
+				for (int k = 0; k < source->channels.size(); k++) {
+					if (!source->channels[k].active) {
 						continue;
 					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+					AudioFrame *target_buf = thread_get_channel_mix_buffer(i, k);
+					_mix_frames_add(target_buf, source->channels[k].buffer.ptr(), buffer_size);
 				}
+			}
+		}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+		bus_wave_solo_mode = solo_mode;
+		if (bus_threads.size() > 0 && bus_wave.size() > 1) {
+			bus_wave_index.set(0);
+			for (uint32_t i = 0; i < bus_threads.size(); i++) {
+				bus_work_semaphore.post();
+			}
+			_process_bus_wave();
+			for (uint32_t i = 0; i < bus_threads.size(); i++) {
+				bus_done_semaphore.wait();
+			}
+		} else {
+			for (int bus_idx : bus_wave) {
+				_process_bus(bus_idx, solo_mode);
 			}
 		}
+	}
 
-		//process send
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
+
+void AudioServer::_update_playback_state(AudioStreamPlaybackListNode *p_playback) {
+	switch (p_playback->state.load()) {
+		case AudioStreamPlaybackListNode::AWAITING_DELETION:
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+			playback_list.erase(p_playback, [](AudioStreamPlaybackListNode *p) {
+				delete p->prev_bus_details;
+				delete p->bus_details;
+				p->stream_playback.unref();
+				delete p;
+			});
+			break;
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
+			// Pause the stream.
+			AudioStreamPlaybackListNode::PlaybackState old_state, new_state;
+			do {
+				old_state = p_playback->state.load();
+				new_state = AudioStreamPlaybackListNode::PAUSED;
+			} while (!p_playback->state.compare_exchange_strong(/* expected= */ old_state, new_state));
+		} break;
+		case AudioStreamPlaybackListNode::PLAYING:
+		case AudioStreamPlaybackListNode::PAUSED:
+			// No-op!
+			break;
+	}
+}
 
-		Bus *send = nullptr;
+void AudioServer::_update_voices() {
+	// Voices that can't become virtual always count as real.
+	int real_voices = 0;
+	voice_candidates.clear();
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING || playback->stream_playback->get_is_sample()) {
+			continue;
+		}
+		if (playback->voice_stream_length.get() <= 0.0) {
+			real_voices++;
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+		// The loudest volume the playback is sent with, to any bus and channel.
+		const AudioStreamPlaybackBusDetails *bus_details = playback->bus_details.load();
+		float audibility = 0.0f;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!bus_details->bus_active[idx]) {
 				continue;
 			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				const AudioFrame &vol = bus_details->volume[idx][channel_idx];
+				audibility = MAX(audibility, MAX(ABS(vol.left), ABS(vol.right)));
+			}
+		}
+		playback->voice_audibility = audibility;
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		if (audibility < virtual_voice_threshold) {
+			_set_voice_virtual(playback, true);
+		} else {
+			voice_candidates.push_back(playback);
+		}
+	}
 
-			AudioFrame peak = AudioFrame(0, 0);
+	if (max_voices > 0) {
+		SortArray<AudioStreamPlaybackListNode *, VoiceSort> sorter;
+		sorter.sort(voice_candidates.ptr(), voice_candidates.size());
+	}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	for (uint32_t i = 0; i < voice_candidates.size(); i++) {
+		_set_voice_virtual(voice_candidates[i], max_voices > 0 && real_voices + (int)i >= max_voices);
+	}
+}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
-			}
+void AudioServer::_set_voice_virtual(AudioStreamPlaybackListNode *p_playback, bool p_virtual) {
+	AudioStreamPlaybackListNode::VoiceState voice_state = p_playback->voice_state.load();
+	if (p_virtual) {
+		if (voice_state == AudioStreamPlaybackListNode::VOICE_REAL) {
+			// Mix once more, fading out, so the voice doesn't pop.
+			p_playback->voice_state.store(AudioStreamPlaybackListNode::VOICE_FADING_TO_VIRTUAL);
+		}
+		return;
+	}
+
+	if (voice_state == AudioStreamPlaybackListNode::VOICE_VIRTUAL) {
+		// Resume where the voice would be now, fading in from silence.
+		p_playback->stream_playback->seek(p_playback->virtual_position.get());
+		for (AudioFrame &frame : p_playback->lookahead) {
+			frame = AudioFrame(0, 0);
+		}
+		memset(p_playback->prev_bus_details->volume, 0, sizeof(p_playback->prev_bus_details->volume));
+	}
+	p_playback->voice_state.store(AudioStreamPlaybackListNode::VOICE_REAL);
+}
+
+void AudioServer::_advance_virtual_voice(AudioStreamPlaybackListNode *p_playback) {
+	double position = p_playback->virtual_position.get() + buffer_size * p_playback->pitch_scale.get() * playback_speed_scale / get_mix_rate();
+	double length = p_playback->voice_stream_length.get();
+	if (position >= length) {
+		if (p_playback->voice_stream_loops.is_set()) {
+			position = Math::fmod(position, length);
+		} else {
+			// Ended while virtual, same as a stream running out of frames.
+			p_playback->state.store(AudioStreamPlaybackListNode::AWAITING_DELETION);
+		}
+	}
+	p_playback->virtual_position.set(position);
+}
+
+void AudioServer::_process_bus(int p_bus, bool p_solo_mode) {
+	Bus *bus = buses[p_bus];
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			//apply volume and compute peak
 			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
 
-				float l = ABS(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = ABS(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
+
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				Bus::Channel &channel = bus->channels.write[k];
+				channel.effect_instances.write[j]->process(channel.buffer.ptr(), channel.effect_buffer.ptrw(), buffer_size);
+				//swap buffers, so internal buffer always has the right data
+				SWAP(channel.buffer, channel.effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+
+		float volume = Math::db_to_linear(bus->volume_db);
+
+		if (p_solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//apply volume and compute peak
+		AudioFrame peak = _mix_frames_scale_with_peak(buf, volume, buffer_size);
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; //went inactive, don't send.
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_process_bus_wave() {
+	uint32_t idx;
+	while ((idx = bus_wave_index.postincrement()) < bus_wave.size()) {
+		_process_bus(bus_wave[idx], bus_wave_solo_mode);
+	}
+}
+
+void AudioServer::_bus_thread_func(void *p_userdata) {
+	AudioServer *as = static_cast<AudioServer *>(p_userdata);
+	while (true) {
+		as->bus_work_semaphore.wait();
+		if (as->bus_threads_exit.is_set()) {
+			break;
+		}
+		as->_process_bus_wave();
+		as->bus_done_semaphore.post();
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -663,22 +938,17 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.left);
-			p_processor_r->process_one_interp(mixed.right);
-			p_out_buf[frame_idx] += mixed;
+		// Ramp into a small block, filter both channels of it together, then add it to the output.
+		AudioFrame mixed[MIX_FILTER_BLOCK_SIZE];
+		for (uint32_t offset = 0; offset < buffer_size; offset += MIX_FILTER_BLOCK_SIZE) {
+			uint32_t count = MIN((uint32_t)MIX_FILTER_BLOCK_SIZE, buffer_size - offset);
+			_mix_frames_ramp<false>(mixed, p_source_buf + offset, p_vol_start, p_vol_final, offset, count, buffer_size);
+			AudioFilterSW::Processor::process_stereo(p_processor_l, p_processor_r, mixed, count, true);
+			_mix_frames_add(p_out_buf + offset, mixed, count);
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		_mix_frames_ramp<true>(p_out_buf, p_source_buf, p_vol_start, p_vol_final, 0, buffer_size, buffer_size);
 	}
 }
 
@@ -773,6 +1043,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -846,6 +1117,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1384,9 +1656,36 @@ float AudioServer::get_playback_position(Ref<AudioStreamPlayback> p_playback) {
 		return 0;
 	}
 
+	if (playback_node->voice_state.load() == AudioStreamPlaybackListNode::VOICE_VIRTUAL) {
+		return playback_node->virtual_position.get();
+	}
 	return playback_node->stream_playback->get_playback_position();
 }
 
+void AudioServer::set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, double p_stream_length, bool p_stream_loops) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->voice_priority.set(p_priority);
+	playback_node->voice_stream_loops.set_to(p_stream_loops);
+	playback_node->voice_stream_length.set(MAX(p_stream_length, 0.0));
+}
+
+bool AudioServer::is_playback_virtual(Ref<AudioStreamPlayback> p_playback) {
+	ERR_FAIL_COND_V(p_playback.is_null(), false);
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return false;
+	}
+
+	return playback_node->voice_state.load() != AudioStreamPlaybackListNode::VOICE_REAL;
+}
+
 bool AudioServer::is_playback_paused(Ref<AudioStreamPlayback> p_playback) {
 	ERR_FAIL_COND_V(p_playback.is_null(), false);
 
@@ -1414,17 +1713,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1437,6 +1732,26 @@ void AudioServer::init() {
 
 	init_channels_and_buffers();
 
+	int bus_thread_count = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/buses/effect_processing_threads", PROPERTY_HINT_RANGE, "0,8,1"), 0);
+#ifdef THREADS_ENABLED
+	Thread::Settings bus_thread_settings;
+	bus_thread_settings.priority = GLOBAL_GET("audio/driver/realtime_thread_priority") ? Thread::PRIORITY_REALTIME : Thread::PRIORITY_HIGH;
+	for (int i = 0; i < bus_thread_count; i++) {
+		Thread *thread = memnew(Thread);
+		thread->start(_bus_thread_func, this, bus_thread_settings);
+		bus_threads.push_back(thread);
+	}
+#else
+	(void)bus_thread_count;
+#endif
+
+	AudioDecodeAheadBuffer::initialize();
+	AudioSincResampler::initialize();
+
+	virtual_voices_enabled = GLOBAL_DEF_RST("audio/voices/enable_virtual_voices", false);
+	virtual_voice_threshold = Math::db_to_linear(float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/voices/virtual_voice_threshold_db", PROPERTY_HINT_RANGE, "-120,0,0.1,suffix:dB"), -60.0)));
+	max_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/voices/max_voices", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 0);
+
 	mix_count = 0;
 	set_bus_count(1);
 	set_bus_name(0, "Master");
@@ -1555,6 +1870,18 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	bus_threads_exit.set();
+	for (uint32_t i = 0; i < bus_threads.size(); i++) {
+		bus_work_semaphore.post();
+	}
+	for (Thread *thread : bus_threads) {
+		thread->wait_to_finish();
+		memdelete(thread);
+	}
+	bus_threads.clear();
+
+	AudioDecodeAheadBuffer::finalize();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1698,6 +2025,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
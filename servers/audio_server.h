@@ -34,6 +34,9 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -69,6 +72,7 @@ protected:
 	void input_buffer_write(int32_t sample);
 
 	int _get_configured_mix_rate();
+	Thread::Settings _get_mix_thread_settings() const;
 
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void start_counting_ticks() { prof_ticks.set(OS::get_singleton()->get_ticks_usec()); }
@@ -202,6 +206,7 @@ public:
 		MAX_CHANNELS_PER_BUS = 4,
 		MAX_BUSES_PER_PLAYBACK = 6,
 		LOOKAHEAD_BUFFER_SIZE = 64,
+		MIX_FILTER_BLOCK_SIZE = 128,
 	};
 
 	typedef void (*AudioCallback)(void *p_userdata);
@@ -241,6 +246,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Output of the effect being processed, swapped with buffer afterwards.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -292,15 +298,49 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+
+		enum VoiceState {
+			VOICE_REAL, // Decoded and mixed.
+			VOICE_FADING_TO_VIRTUAL, // Mixed one last time, fading out.
+			VOICE_VIRTUAL, // Only the playback position moves.
+		};
+		// Set through set_playback_voice_params(). The voice can only become virtual if the length is known.
+		SafeNumeric<int> voice_priority;
+		SafeNumeric<double> voice_stream_length;
+		SafeFlag voice_stream_loops;
+		// Voice state should only be changed on the audio thread.
+		std::atomic<VoiceState> voice_state = VOICE_REAL;
+		SafeNumeric<double> virtual_position;
+		float voice_audibility = 0.0f;
 	};
 
+	struct VoiceSort {
+		_FORCE_INLINE_ bool operator()(const AudioStreamPlaybackListNode *p_a, const AudioStreamPlaybackListNode *p_b) const {
+			int priority_a = p_a->voice_priority.get();
+			int priority_b = p_b->voice_priority.get();
+			if (priority_a != priority_b) {
+				return priority_a > priority_b;
+			}
+			return p_a->voice_audibility > p_b->voice_audibility;
+		}
+	};
+
+	bool virtual_voices_enabled = false;
+	float virtual_voice_threshold = 0.0f;
+	int max_voices = 0;
+	LocalVector<AudioStreamPlaybackListNode *> voice_candidates;
+
+	void _update_voices();
+	void _set_voice_virtual(AudioStreamPlaybackListNode *p_playback, bool p_virtual);
+	void _advance_virtual_voice(AudioStreamPlaybackListNode *p_playback);
+	void _update_playback_state(AudioStreamPlaybackListNode *p_playback);
+
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard;
 
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
@@ -312,6 +352,21 @@ private:
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _process_bus(int p_bus, bool p_solo_mode);
+	void _process_bus_wave();
+	static void _bus_thread_func(void *p_userdata);
+
+	// Buses processed together, see _mix_step(). Extra threads help the audio thread with the
+	// effects of a wave when "audio/buses/effect_processing_threads" is set.
+	LocalVector<int> bus_send_index;
+	LocalVector<int> bus_depth;
+	LocalVector<int> bus_wave;
+	bool bus_wave_solo_mode = false;
+	SafeNumeric<uint32_t> bus_wave_index;
+	LocalVector<Thread *> bus_threads;
+	Semaphore bus_work_semaphore;
+	Semaphore bus_done_semaphore;
+	SafeFlag bus_threads_exit;
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -416,10 +471,13 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	// A stream length of zero means unknown, the playback is then never made virtual.
+	void set_playback_voice_params(Ref<AudioStreamPlayback> p_playback, int p_priority, double p_stream_length, bool p_stream_loops);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
 	bool is_playback_paused(Ref<AudioStreamPlayback> p_playback);
+	bool is_playback_virtual(Ref<AudioStreamPlayback> p_playback);
 
 	uint64_t get_mix_count() const;
 	uint64_t get_mixed_frames() const;
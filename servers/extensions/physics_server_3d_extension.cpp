@@ -46,6 +46,8 @@ void PhysicsDirectSpaceState3DExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_collide_shape, "shape_rid", "transform", "motion", "margin", "collision_mask", "collide_with_bodies", "collide_with_areas", "results", "max_results", "result_count");
 	GDVIRTUAL_BIND(_rest_info, "shape_rid", "transform", "motion", "margin", "collision_mask", "collide_with_bodies", "collide_with_areas", "rest_info");
 	GDVIRTUAL_BIND(_get_closest_point_to_object_volume, "object", "point");
+	GDVIRTUAL_BIND(_intersect_rays, "from", "to", "count", "collision_mask", "collide_with_bodies", "collide_with_areas", "hit_from_inside", "hit_back_faces", "pick_ray", "results", "hits");
+	GDVIRTUAL_BIND(_cast_motions, "shape_rid", "transforms", "motions", "count", "margin", "collision_mask", "collide_with_bodies", "collide_with_areas", "closest_safe", "closest_unsafe");
 }
 
 PhysicsDirectSpaceState3DExtension::PhysicsDirectSpaceState3DExtension() {
@@ -167,6 +169,10 @@ void PhysicsServer3DExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_space_get_contacts, "space");
 	GDVIRTUAL_BIND(_space_get_contact_count, "space");
 
+	GDVIRTUAL_BIND(_space_save_state, "space");
+	GDVIRTUAL_BIND(_space_restore_state, "space", "state");
+	GDVIRTUAL_BIND(_space_step, "space", "step");
+
 	/* AREA API */
 
 	GDVIRTUAL_BIND(_area_create);
@@ -136,6 +136,8 @@ protected:
 	GDVIRTUAL10R(bool, _collide_shape, RID, const Transform3D &, const Vector3 &, real_t, uint32_t, bool, bool, GDExtensionPtr<Vector3>, int, GDExtensionPtr<int>)
 	GDVIRTUAL8R(bool, _rest_info, RID, const Transform3D &, const Vector3 &, real_t, uint32_t, bool, bool, GDExtensionPtr<PhysicsServer3DExtensionShapeRestInfo>)
 	GDVIRTUAL2RC(Vector3, _get_closest_point_to_object_volume, RID, const Vector3 &)
+	GDVIRTUAL11(_intersect_rays, GDExtensionConstPtr<const Vector3>, GDExtensionConstPtr<const Vector3>, int, uint32_t, bool, bool, bool, bool, bool, GDExtensionPtr<PhysicsServer3DExtensionRayResult>, GDExtensionPtr<bool>)
+	GDVIRTUAL10(_cast_motions, RID, GDExtensionConstPtr<const Transform3D>, GDExtensionConstPtr<const Vector3>, int, real_t, uint32_t, bool, bool, GDExtensionPtr<real_t>, GDExtensionPtr<real_t>)
 
 public:
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override {
@@ -145,6 +147,14 @@ public:
 		exclude = nullptr;
 		return ret;
 	}
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override {
+		exclude = &p_parameters.exclude;
+		bool called = GDVIRTUAL_CALL(_intersect_rays, p_from, p_to, p_count, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.hit_from_inside, p_parameters.hit_back_faces, p_parameters.pick_ray, r_results, r_hits);
+		exclude = nullptr;
+		if (!called) {
+			PhysicsDirectSpaceState3D::intersect_rays(p_parameters, p_from, p_to, p_count, r_results, r_hits);
+		}
+	}
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override {
 		exclude = &p_parameters.exclude;
 		int ret = false;
@@ -166,6 +176,14 @@ public:
 		exclude = nullptr;
 		return ret;
 	}
+	virtual void cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override {
+		exclude = &p_parameters.exclude;
+		bool called = GDVIRTUAL_CALL(_cast_motions, p_parameters.shape_rid, p_transforms, p_motions, p_count, p_parameters.margin, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, r_closest_safe, r_closest_unsafe);
+		exclude = nullptr;
+		if (!called) {
+			PhysicsDirectSpaceState3D::cast_motions(p_parameters, p_transforms, p_motions, p_count, r_closest_safe, r_closest_unsafe);
+		}
+	}
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override {
 		exclude = &p_parameters.exclude;
 		bool ret = false;
@@ -243,6 +261,10 @@ public:
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	EXBIND1RC(PackedByteArray, space_save_state, RID)
+	EXBIND2(space_restore_state, RID, const PackedByteArray &)
+	EXBIND2(space_step, RID, real_t)
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
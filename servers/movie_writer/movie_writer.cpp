@@ -174,7 +174,7 @@ void MovieWriter::set_extensions_hint() {
 	ProjectSettings::get_singleton()->set_custom_property_info(PropertyInfo(Variant::STRING, "editor/movie_writer/movie_file", PROPERTY_HINT_GLOBAL_SAVE_FILE, ext_hint));
 }
 
-void MovieWriter::add_frame() {
+void MovieWriter::add_frame(const FrameStats &p_stats) {
 	const int movie_time_seconds = Engine::get_singleton()->get_frames_drawn() / fps / (1 + Engine::get_singleton()->get_write_movie_subframes());
 	const String movie_time = vformat("%s:%s:%s",
 			String::num(movie_time_seconds / 3600).pad_zeros(2),
@@ -213,13 +213,19 @@ void MovieWriter::add_frame() {
 #endif
 
 	RID main_vp_rid = RenderingServer::get_singleton()->viewport_find_from_screen_attachment(DisplayServer::MAIN_WINDOW_ID);
-	RID main_vp_texture = RenderingServer::get_singleton()->viewport_get_texture(main_vp_rid);
-	Ref<Image> vp_tex = RenderingServer::get_singleton()->texture_2d_get(main_vp_texture);
+	Ref<Image> vp_tex;
+	if (needs_frame_image()) {
+		RID main_vp_texture = RenderingServer::get_singleton()->viewport_get_texture(main_vp_rid);
+		vp_tex = RenderingServer::get_singleton()->texture_2d_get(main_vp_texture);
+	}
 
 	RenderingServer::get_singleton()->viewport_set_measure_render_time(main_vp_rid, true);
-	cpu_time += RenderingServer::get_singleton()->viewport_get_measured_render_time_cpu(main_vp_rid);
-	cpu_time += RenderingServer::get_singleton()->get_frame_setup_time_cpu();
-	gpu_time += RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(main_vp_rid);
+	FrameStats stats = p_stats;
+	stats.render_cpu_msec = RenderingServer::get_singleton()->viewport_get_measured_render_time_cpu(main_vp_rid) + RenderingServer::get_singleton()->get_frame_setup_time_cpu();
+	stats.render_gpu_msec = RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(main_vp_rid);
+	cpu_time += stats.render_cpu_msec;
+	gpu_time += stats.render_gpu_msec;
+	write_frame_stats(stats);
 
 	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
 	write_frame(vp_tex, audio_mix_buffer.ptr());
@@ -38,6 +38,16 @@
 class MovieWriter : public Object {
 	GDCLASS(MovieWriter, Object);
 
+public:
+	struct FrameStats {
+		uint64_t process_usec = 0;
+		uint64_t physics_process_usec = 0;
+		uint64_t navigation_process_usec = 0;
+		float render_cpu_msec = 0.0f;
+		float render_gpu_msec = 0.0f;
+	};
+
+private:
 	uint64_t fps = 0;
 	uint32_t subframes = 0;
 	uint64_t mix_rate = 0;
@@ -64,6 +74,10 @@ protected:
 	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
 	virtual void write_end();
 
+	// Writers that only record statistics can skip reading back the viewport texture.
+	virtual bool needs_frame_image() const { return true; }
+	virtual void write_frame_stats(const FrameStats &p_stats) {}
+
 	GDVIRTUAL0RC(uint32_t, _get_audio_mix_rate)
 	GDVIRTUAL0RC(AudioServer::SpeakerMode, _get_audio_speaker_mode)
 
@@ -84,7 +98,7 @@ public:
 	static MovieWriter *find_writer_for_file(const String &p_file);
 
 	void begin(const Size2i &p_movie_size, uint32_t p_fps, const String &p_base_path);
-	void add_frame();
+	void add_frame(const FrameStats &p_stats);
 
 	static void set_extensions_hint();
 
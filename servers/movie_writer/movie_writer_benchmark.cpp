@@ -0,0 +1,262 @@
+/**************************************************************************/
+/*  movie_writer_benchmark.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "movie_writer_benchmark.h"
+#include "core/config/project_settings.h"
+#include "core/io/json.h"
+#include "core/templates/sort_array.h"
+#include "core/version.h"
+#include "servers/rendering_server.h"
+
+const char *MovieWriterBenchmark::column_names[MovieWriterBenchmark::COLUMN_MAX] = {
+	"process_ms",
+	"physics_process_ms",
+	"navigation_process_ms",
+	"render_cpu_ms",
+	"render_gpu_ms",
+	"draw_calls",
+	"primitives",
+	"objects",
+	"static_memory",
+	"video_memory",
+};
+
+uint32_t MovieWriterBenchmark::get_audio_mix_rate() const {
+	return mix_rate;
+}
+
+AudioServer::SpeakerMode MovieWriterBenchmark::get_audio_speaker_mode() const {
+	return speaker_mode;
+}
+
+void MovieWriterBenchmark::get_supported_extensions(List<String> *r_extensions) const {
+	r_extensions->push_back("json");
+	r_extensions->push_back("csv");
+}
+
+bool MovieWriterBenchmark::handles_file(const String &p_path) const {
+	const String ext = p_path.get_extension().to_lower();
+	return ext == "json" || ext == "csv";
+}
+
+Error MovieWriterBenchmark::write_begin(const Size2i &p_movie_size, uint32_t p_fps, const String &p_base_path) {
+	report_path = p_base_path;
+	if (report_path.is_relative_path()) {
+		report_path = "res://" + report_path;
+	}
+	fps = p_fps;
+
+	frames.clear();
+	gpu_pass_names.clear();
+	gpu_pass_indices.clear();
+
+	// Required to get per-pass GPU timings from `RenderingServer::get_frame_profile()`.
+	RenderingServer::get_singleton()->set_frame_profiling_enabled(true);
+
+	return OK;
+}
+
+Error MovieWriterBenchmark::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
+	// No video or audio output, the statistics are gathered in `write_frame_stats()`.
+	return OK;
+}
+
+void MovieWriterBenchmark::write_frame_stats(const FrameStats &p_stats) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	Frame frame;
+	frame.stats = p_stats;
+	frame.draw_calls = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME);
+	frame.primitives = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_PRIMITIVES_IN_FRAME);
+	frame.objects = rs->get_rendering_info(RenderingServer::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
+	frame.static_memory = OS::get_singleton()->get_static_memory_usage();
+	frame.video_memory = rs->get_rendering_info(RenderingServer::RENDERING_INFO_VIDEO_MEM_USED);
+
+	// Same accounting as `--gpu-profile`: each area lasts until the next timestamp,
+	// and the "<" / ">" markers only delimit nested sections.
+	const Vector<RenderingServer::FrameProfileArea> profile = rs->get_frame_profile();
+	frame.gpu_pass_msec.resize(gpu_pass_names.size());
+	for (double &msec : frame.gpu_pass_msec) {
+		msec = 0.0;
+	}
+	for (int i = 0; i < profile.size() - 1; i++) {
+		const String &name = profile[i].name;
+		if (name.is_empty() || name[0] == '<' || name[0] == '>') {
+			continue;
+		}
+
+		const uint32_t *index = gpu_pass_indices.getptr(name);
+		uint32_t pass = 0;
+		if (index) {
+			pass = *index;
+		} else {
+			pass = gpu_pass_names.size();
+			gpu_pass_names.push_back(name);
+			gpu_pass_indices.insert(name, pass);
+			frame.gpu_pass_msec.push_back(0.0);
+		}
+		frame.gpu_pass_msec[pass] += profile[i + 1].gpu_msec - profile[i].gpu_msec;
+	}
+
+	frames.push_back(frame);
+}
+
+double MovieWriterBenchmark::_get_column_value(const Frame &p_frame, Column p_column) const {
+	switch (p_column) {
+		case COLUMN_PROCESS_MSEC:
+			return p_frame.stats.process_usec / 1000.0;
+		case COLUMN_PHYSICS_PROCESS_MSEC:
+			return p_frame.stats.physics_process_usec / 1000.0;
+		case COLUMN_NAVIGATION_PROCESS_MSEC:
+			return p_frame.stats.navigation_process_usec / 1000.0;
+		case COLUMN_RENDER_CPU_MSEC:
+			return p_frame.stats.render_cpu_msec;
+		case COLUMN_RENDER_GPU_MSEC:
+			return p_frame.stats.render_gpu_msec;
+		case COLUMN_DRAW_CALLS:
+			return p_frame.draw_calls;
+		case COLUMN_PRIMITIVES:
+			return p_frame.primitives;
+		case COLUMN_OBJECTS:
+			return p_frame.objects;
+		case COLUMN_STATIC_MEMORY:
+			return p_frame.static_memory;
+		case COLUMN_VIDEO_MEMORY:
+			return p_frame.video_memory;
+		case COLUMN_MAX:
+			break;
+	}
+	return 0.0;
+}
+
+void MovieWriterBenchmark::_write_json(Ref<FileAccess> p_file) const {
+	Array frames_array;
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		const Frame &frame = frames[i];
+
+		Dictionary frame_dict;
+		frame_dict["frame"] = i;
+		for (int j = 0; j < COLUMN_MAX; j++) {
+			frame_dict[column_names[j]] = _get_column_value(frame, Column(j));
+		}
+
+		Dictionary gpu_passes;
+		for (uint32_t j = 0; j < frame.gpu_pass_msec.size(); j++) {
+			gpu_passes[gpu_pass_names[j]] = frame.gpu_pass_msec[j];
+		}
+		frame_dict["gpu_passes_ms"] = gpu_passes;
+
+		frames_array.push_back(frame_dict);
+	}
+
+	// Per-column statistics, so reports from different builds can be compared at a glance.
+	Dictionary summary;
+	LocalVector<double> values;
+	values.resize(frames.size());
+	for (int j = 0; j < COLUMN_MAX; j++) {
+		if (frames.is_empty()) {
+			break;
+		}
+
+		double sum = 0.0;
+		for (uint32_t i = 0; i < frames.size(); i++) {
+			values[i] = _get_column_value(frames[i], Column(j));
+			sum += values[i];
+		}
+		SortArray<double> sorter;
+		sorter.sort(values.ptr(), values.size());
+
+		Dictionary column;
+		column["mean"] = sum / frames.size();
+		column["min"] = values[0];
+		column["median"] = values[values.size() / 2];
+		column["p95"] = values[MIN(values.size() - 1, uint32_t(values.size() * 0.95))];
+		column["max"] = values[values.size() - 1];
+		summary[column_names[j]] = column;
+	}
+
+	Dictionary report;
+	report["engine_version"] = VERSION_FULL_BUILD;
+	report["rendering_method"] = OS::get_singleton()->get_current_rendering_method();
+	report["video_adapter"] = RenderingServer::get_singleton()->get_video_adapter_name();
+	report["fps"] = fps;
+	report["frame_count"] = frames.size();
+	report["summary"] = summary;
+	report["frames"] = frames_array;
+
+	p_file->store_string(JSON::stringify(report, "\t", false));
+}
+
+void MovieWriterBenchmark::_write_csv(Ref<FileAccess> p_file) const {
+	Vector<String> header;
+	header.push_back("frame");
+	for (int j = 0; j < COLUMN_MAX; j++) {
+		header.push_back(column_names[j]);
+	}
+	for (const String &name : gpu_pass_names) {
+		header.push_back("gpu_ms:" + name);
+	}
+	p_file->store_csv_line(header);
+
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		const Frame &frame = frames[i];
+
+		Vector<String> line;
+		line.push_back(itos(i));
+		for (int j = 0; j < COLUMN_MAX; j++) {
+			line.push_back(rtos(_get_column_value(frame, Column(j))));
+		}
+		// Passes first seen in a later frame have no value in earlier ones.
+		for (int j = 0; j < gpu_pass_names.size(); j++) {
+			line.push_back(uint32_t(j) < frame.gpu_pass_msec.size() ? rtos(frame.gpu_pass_msec[j]) : "0");
+		}
+		p_file->store_csv_line(line);
+	}
+}
+
+void MovieWriterBenchmark::write_end() {
+	RenderingServer::get_singleton()->set_frame_profiling_enabled(false);
+
+	Ref<FileAccess> f = FileAccess::open(report_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Cannot write benchmark report to: " + report_path);
+
+	if (report_path.get_extension().to_lower() == "json") {
+		_write_json(f);
+	} else {
+		_write_csv(f);
+	}
+
+	frames.clear();
+}
+
+MovieWriterBenchmark::MovieWriterBenchmark() {
+	mix_rate = GLOBAL_GET("editor/movie_writer/mix_rate");
+	speaker_mode = AudioServer::SpeakerMode(int(GLOBAL_GET("editor/movie_writer/speaker_mode")));
+}
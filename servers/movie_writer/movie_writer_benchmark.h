@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  movie_writer_benchmark.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef MOVIE_WRITER_BENCHMARK_H
+#define MOVIE_WRITER_BENCHMARK_H
+
+#include "core/io/file_access.h"
+#include "core/templates/hash_map.h"
+#include "servers/movie_writer/movie_writer.h"
+
+// Records per-frame performance statistics instead of video, for use with
+// `--benchmark-scene`. The report is written as JSON or CSV depending on
+// the file extension.
+class MovieWriterBenchmark : public MovieWriter {
+	GDCLASS(MovieWriterBenchmark, MovieWriter)
+
+	enum Column {
+		COLUMN_PROCESS_MSEC,
+		COLUMN_PHYSICS_PROCESS_MSEC,
+		COLUMN_NAVIGATION_PROCESS_MSEC,
+		COLUMN_RENDER_CPU_MSEC,
+		COLUMN_RENDER_GPU_MSEC,
+		COLUMN_DRAW_CALLS,
+		COLUMN_PRIMITIVES,
+		COLUMN_OBJECTS,
+		COLUMN_STATIC_MEMORY,
+		COLUMN_VIDEO_MEMORY,
+		COLUMN_MAX,
+	};
+
+	static const char *column_names[COLUMN_MAX];
+
+	struct Frame {
+		FrameStats stats;
+		uint64_t draw_calls = 0;
+		uint64_t primitives = 0;
+		uint64_t objects = 0;
+		uint64_t static_memory = 0;
+		uint64_t video_memory = 0;
+		LocalVector<double> gpu_pass_msec; // Indexed like `gpu_pass_names`.
+	};
+
+	uint32_t mix_rate = 48000;
+	AudioServer::SpeakerMode speaker_mode = AudioServer::SPEAKER_MODE_STEREO;
+	String report_path;
+	uint32_t fps = 0;
+
+	LocalVector<Frame> frames;
+	Vector<String> gpu_pass_names;
+	HashMap<String, uint32_t> gpu_pass_indices;
+
+	double _get_column_value(const Frame &p_frame, Column p_column) const;
+	void _write_json(Ref<FileAccess> p_file) const;
+	void _write_csv(Ref<FileAccess> p_file) const;
+
+protected:
+	virtual uint32_t get_audio_mix_rate() const override;
+	virtual AudioServer::SpeakerMode get_audio_speaker_mode() const override;
+	virtual void get_supported_extensions(List<String> *r_extensions) const override;
+
+	virtual Error write_begin(const Size2i &p_movie_size, uint32_t p_fps, const String &p_base_path) override;
+	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) override;
+	virtual void write_end() override;
+
+	virtual bool needs_frame_image() const override { return false; }
+	virtual void write_frame_stats(const FrameStats &p_stats) override;
+
+	virtual bool handles_file(const String &p_path) const override;
+
+public:
+	MovieWriterBenchmark();
+};
+
+#endif // MOVIE_WRITER_BENCHMARK_H
@@ -55,6 +55,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_link_connection_radius", "map"), &NavigationServer3D::map_get_link_connection_radius);
+	ClassDB::bind_method(D_METHOD("map_set_avoidance_lod_origins", "map", "origins"), &NavigationServer3D::map_set_avoidance_lod_origins);
+	ClassDB::bind_method(D_METHOD("map_get_avoidance_lod_origins", "map"), &NavigationServer3D::map_get_avoidance_lod_origins);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer3D::map_get_path, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_to_segment", "map", "start", "end", "use_collision"), &NavigationServer3D::map_get_closest_point_to_segment, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
@@ -72,6 +74,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result"), &NavigationServer3D::query_path);
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer3D::query_path_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("is_path_query_pending", "result"), &NavigationServer3D::is_path_query_pending);
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_set_enabled", "region", "enabled"), &NavigationServer3D::region_set_enabled);
@@ -186,6 +190,7 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data_async, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("is_baking_navigation_mesh", "navigation_mesh"), &NavigationServer3D::is_baking_navigation_mesh);
+	ClassDB::bind_method(D_METHOD("bake_tiles_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "tiles", "tile_size", "changed_aabb"), &NavigationServer3D::bake_tiles_from_source_geometry_data, DEFVAL(AABB()));
 #endif // _3D_DISABLED
 
 	ClassDB::bind_method(D_METHOD("source_geometry_parser_create"), &NavigationServer3D::source_geometry_parser_create);
@@ -241,6 +246,13 @@ NavigationServer3D::NavigationServer3D() {
 
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_multiple_threads", true);
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_high_priority_threads", true);
+	GLOBAL_DEF("navigation/avoidance/use_uniform_grid", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/avoidance/uniform_grid_cell_size", PROPERTY_HINT_RANGE, "0.01,100,0.01,or_greater"), 4.0);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/avoidance/lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.1,or_greater"), 0.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/avoidance/lod_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), 4);
+
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/pathfinding/max_async_path_queries_per_frame", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 256);
+	GLOBAL_DEF("navigation/pathfinding/use_hierarchical_pathfinding", false);
 
 	GLOBAL_DEF("navigation/baking/use_crash_prevention_checks", true);
 	GLOBAL_DEF("navigation/baking/thread_model/baking_use_multiple_threads", true);
@@ -102,6 +102,12 @@ public:
 	/// Returns the link connection radius of this map.
 	virtual real_t map_get_link_connection_radius(RID p_map) const = 0;
 
+	/// Set the points the avoidance level of detail distance is measured from.
+	virtual void map_set_avoidance_lod_origins(RID p_map, const Vector<Vector3> &p_origins) = 0;
+
+	/// Returns the points the avoidance level of detail distance is measured from.
+	virtual Vector<Vector3> map_get_avoidance_lod_origins(RID p_map) const = 0;
+
 	/// Returns the navigation path to reach the destination from the origin.
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) const = 0;
 
@@ -342,6 +348,11 @@ public:
 	/// Returns a customized navigation path using a query parameters object
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result) const;
 
+	/// Queues a path query that is processed on the WorkerThreadPool.
+	/// The result is written and the callback called on the thread processing the server.
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual bool is_path_query_pending(const Ref<NavigationPathQueryResult3D> &p_query_result) const = 0;
+
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const = 0;
 
 #ifndef _3D_DISABLED
@@ -349,6 +360,7 @@ public:
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const = 0;
+	virtual TypedArray<Vector2i> bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Dictionary p_tiles, real_t p_tile_size, const AABB &p_changed_aabb = AABB()) = 0;
 #endif // _3D_DISABLED
 
 	virtual RID source_geometry_parser_create() = 0;
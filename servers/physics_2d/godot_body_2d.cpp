@@ -388,6 +388,38 @@ Variant GodotBody2D::get_state(PhysicsServer2D::BodyState p_state) const {
 	return Variant();
 }
 
+void GodotBody2D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.transform = get_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.constant_force = constant_force;
+	r_snapshot.constant_torque = constant_torque;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+}
+
+void GodotBody2D::restore_snapshot(const Snapshot &p_snapshot) {
+	new_transform = p_snapshot.new_transform;
+	if (get_transform() != p_snapshot.transform) {
+		_set_transform(p_snapshot.transform);
+		_set_inv_transform(p_snapshot.transform.affine_inverse());
+		_update_transform_dependent();
+	}
+
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	constant_force = p_snapshot.constant_force;
+	constant_torque = p_snapshot.constant_torque;
+	still_time = p_snapshot.still_time;
+	set_active(p_snapshot.active);
+
+	// Let the nodes catch up with the restored state on the next flush, even if the body doesn't move again.
+	if (body_state_callback.is_valid() && get_space() && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody2D::set_space(GodotSpace2D *p_space) {
 	if (get_space()) {
 		wakeup_neighbours();
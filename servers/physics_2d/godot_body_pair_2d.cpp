@@ -591,6 +591,26 @@ void GodotBodyPair2D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodyPair2D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.sep_axis = sep_axis;
+	r_snapshot.collided = collided;
+	r_snapshot.oneway_disabled = oneway_disabled;
+	r_snapshot.contact_count = contact_count;
+	for (int i = 0; i < contact_count; i++) {
+		r_snapshot.contacts[i] = contacts[i];
+	}
+}
+
+void GodotBodyPair2D::restore_snapshot(const Snapshot &p_snapshot) {
+	sep_axis = p_snapshot.sep_axis;
+	collided = p_snapshot.collided;
+	oneway_disabled = p_snapshot.oneway_disabled;
+	contact_count = CLAMP(p_snapshot.contact_count, 0, (int)MAX_CONTACTS);
+	for (int i = 0; i < contact_count; i++) {
+		contacts[i] = p_snapshot.contacts[i];
+	}
+}
+
 GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B) :
 		GodotConstraint2D(_arr, 2) {
 	A = p_A;
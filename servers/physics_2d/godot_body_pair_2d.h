@@ -90,6 +90,25 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
+	// Contact cache saved by GodotPhysicsServer2D::space_save_state(), for rollback.
+	struct Snapshot {
+		Vector2 sep_axis;
+		bool collided = false;
+		bool oneway_disabled = false;
+		int contact_count = 0;
+		Contact contacts[MAX_CONTACTS];
+	};
+
+	_FORCE_INLINE_ GodotBody2D *get_body_a() const { return A; }
+	_FORCE_INLINE_ GodotBody2D *get_body_b() const { return B; }
+	_FORCE_INLINE_ int get_shape_a() const { return shape_A; }
+	_FORCE_INLINE_ int get_shape_b() const { return shape_B; }
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
+	virtual bool is_body_pair() const override { return true; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
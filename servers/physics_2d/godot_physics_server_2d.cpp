@@ -36,12 +36,14 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/timeline_profiler.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
 	ERR_FAIL_COND_MSG(m_object->get_space() && flushing_queries, "Can't change this state while flushing queries. Use call_deferred() or set_deferred() to change monitoring state instead.");
 
 RID GodotPhysicsServer2D::_shape_create(ShapeType p_shape) {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape2D *shape = nullptr;
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY: {
@@ -113,6 +115,7 @@ RID GodotPhysicsServer2D::concave_polygon_shape_create() {
 }
 
 void GodotPhysicsServer2D::shape_set_data(RID p_shape, const Variant &p_data) {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape2D *shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 	shape->set_data(p_data);
@@ -215,6 +218,7 @@ bool GodotPhysicsServer2D::shape_collide(RID p_shape_A, const Transform2D &p_xfo
 }
 
 RID GodotPhysicsServer2D::space_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotSpace2D *space = memnew(GodotSpace2D);
 	RID id = space_owner.make_rid(space);
 	space->set_self(id);
@@ -276,6 +280,151 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+// Space states start with this header, followed by the bodies and then the contact caches of their pairs.
+struct GodotSpaceStateHeader2D {
+	static const uint32_t MAGIC = 0x32535047; // "GPS2"
+	static const uint32_t VERSION = 1;
+
+	uint32_t magic = MAGIC;
+	uint32_t version = VERSION;
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+struct GodotSpaceStateBody2D {
+	uint64_t rid = 0;
+	GodotBody2D::Snapshot snapshot;
+};
+
+struct GodotSpaceStatePair2D {
+	uint64_t rid_a = 0;
+	uint64_t rid_b = 0;
+	int32_t shape_a = 0;
+	int32_t shape_b = 0;
+	GodotBodyPair2D::Snapshot snapshot;
+};
+
+PackedByteArray GodotPhysicsServer2D::space_save_state(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Can't save the state of a space while it's being stepped or queried.");
+
+	LocalVector<const GodotBody2D *> bodies;
+	LocalVector<const GodotBodyPair2D *> pairs;
+	for (const GodotCollisionObject2D *object : space->get_objects()) {
+		if (object->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody2D *body = static_cast<const GodotBody2D *>(object);
+		bodies.push_back(body);
+
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			if (!E.first->is_body_pair()) {
+				continue;
+			}
+			const GodotBodyPair2D *pair = static_cast<const GodotBodyPair2D *>(E.first);
+			if (pair->get_body_a() == body) {
+				pairs.push_back(pair); // Saved once, from its first body.
+			}
+		}
+	}
+
+	GodotSpaceStateHeader2D header;
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+
+	PackedByteArray state;
+	state.resize(sizeof(GodotSpaceStateHeader2D) + sizeof(GodotSpaceStateBody2D) * bodies.size() + sizeof(GodotSpaceStatePair2D) * pairs.size());
+	uint8_t *w = state.ptrw();
+
+	memcpy(w, &header, sizeof(GodotSpaceStateHeader2D));
+	w += sizeof(GodotSpaceStateHeader2D);
+
+	for (const GodotBody2D *body : bodies) {
+		GodotSpaceStateBody2D entry;
+		entry.rid = body->get_self().get_id();
+		body->save_snapshot(entry.snapshot);
+		memcpy(w, &entry, sizeof(GodotSpaceStateBody2D));
+		w += sizeof(GodotSpaceStateBody2D);
+	}
+
+	for (const GodotBodyPair2D *pair : pairs) {
+		GodotSpaceStatePair2D entry;
+		entry.rid_a = pair->get_body_a()->get_self().get_id();
+		entry.rid_b = pair->get_body_b()->get_self().get_id();
+		entry.shape_a = pair->get_shape_a();
+		entry.shape_b = pair->get_shape_b();
+		pair->save_snapshot(entry.snapshot);
+		memcpy(w, &entry, sizeof(GodotSpaceStatePair2D));
+		w += sizeof(GodotSpaceStatePair2D);
+	}
+
+	return state;
+}
+
+void GodotPhysicsServer2D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't restore the state of a space while it's being stepped or queried.");
+	ERR_FAIL_COND(p_state.size() < (int64_t)sizeof(GodotSpaceStateHeader2D));
+
+	const uint8_t *r = p_state.ptr();
+	GodotSpaceStateHeader2D header;
+	memcpy(&header, r, sizeof(GodotSpaceStateHeader2D));
+	r += sizeof(GodotSpaceStateHeader2D);
+
+	ERR_FAIL_COND_MSG(header.magic != GodotSpaceStateHeader2D::MAGIC || header.version != GodotSpaceStateHeader2D::VERSION || header.real_size != sizeof(real_t), "Invalid space state.");
+	ERR_FAIL_COND_MSG(p_state.size() != (int64_t)(sizeof(GodotSpaceStateHeader2D) + sizeof(GodotSpaceStateBody2D) * header.body_count + sizeof(GodotSpaceStatePair2D) * header.pair_count), "Invalid space state.");
+
+	// Bodies which were removed from the space since the state was saved are skipped.
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotSpaceStateBody2D entry;
+		memcpy(&entry, r, sizeof(GodotSpaceStateBody2D));
+		r += sizeof(GodotSpaceStateBody2D);
+
+		GodotBody2D *body = body_owner.get_or_null(RID::from_uint64(entry.rid));
+		if (body && body->get_space() == space) {
+			body->restore_snapshot(entry.snapshot);
+		}
+	}
+
+	// Contact caches are only restored for pairs which still exist, others are rebuilt by the next step.
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotSpaceStatePair2D entry;
+		memcpy(&entry, r, sizeof(GodotSpaceStatePair2D));
+		r += sizeof(GodotSpaceStatePair2D);
+
+		GodotBody2D *body_a = body_owner.get_or_null(RID::from_uint64(entry.rid_a));
+		GodotBody2D *body_b = body_owner.get_or_null(RID::from_uint64(entry.rid_b));
+		if (!body_a || !body_b || body_a->get_space() != space) {
+			continue;
+		}
+
+		for (const Pair<GodotConstraint2D *, int> &E : body_a->get_constraint_list()) {
+			if (!E.first->is_body_pair()) {
+				continue;
+			}
+			GodotBodyPair2D *pair = static_cast<GodotBodyPair2D *>(E.first);
+			if (pair->get_body_a() == body_a && pair->get_body_b() == body_b && pair->get_shape_a() == entry.shape_a && pair->get_shape_b() == entry.shape_b) {
+				pair->restore_snapshot(entry.snapshot);
+				break;
+			}
+		}
+	}
+}
+
+void GodotPhysicsServer2D::space_step(RID p_space, real_t p_step) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't step a space while it's being stepped or queried.");
+	ERR_FAIL_COND(p_step <= 0.0);
+
+	// Only simulates, the state of the bodies reaches their nodes with the next regular flush.
+	_update_shapes();
+	stepper->step(space, p_step);
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -285,6 +434,7 @@ PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_sp
 }
 
 RID GodotPhysicsServer2D::area_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotArea2D *area = memnew(GodotArea2D);
 	RID rid = area_owner.make_rid(area);
 	area->set_self(rid);
@@ -530,6 +680,7 @@ void GodotPhysicsServer2D::area_set_area_monitor_callback(RID p_area, const Call
 /* BODY API */
 
 RID GodotPhysicsServer2D::body_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotBody2D *body = memnew(GodotBody2D);
 	RID rid = body_owner.make_rid(body);
 	body->set_self(rid);
@@ -1024,6 +1175,7 @@ PhysicsDirectBodyState2D *GodotPhysicsServer2D::body_get_direct_state(RID p_body
 /* JOINT API */
 
 RID GodotPhysicsServer2D::joint_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotJoint2D *joint = memnew(GodotJoint2D);
 	RID joint_rid = joint_owner.make_rid(joint);
 	joint->set_self(joint_rid);
@@ -1288,6 +1440,8 @@ void GodotPhysicsServer2D::init() {
 }
 
 void GodotPhysicsServer2D::step(real_t p_step) {
+	TIMELINE_ZONE("PhysicsServer2D::step");
+
 	if (!active) {
 		return;
 	}
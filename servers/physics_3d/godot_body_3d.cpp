@@ -437,6 +437,38 @@ Variant GodotBody3D::get_state(PhysicsServer3D::BodyState p_state) const {
 	return Variant();
 }
 
+void GodotBody3D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.transform = get_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.constant_force = constant_force;
+	r_snapshot.constant_torque = constant_torque;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+}
+
+void GodotBody3D::restore_snapshot(const Snapshot &p_snapshot) {
+	new_transform = p_snapshot.new_transform;
+	if (get_transform() != p_snapshot.transform) {
+		_set_transform(p_snapshot.transform);
+		_set_inv_transform(p_snapshot.transform.affine_inverse());
+		_update_transform_dependent();
+	}
+
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	constant_force = p_snapshot.constant_force;
+	constant_torque = p_snapshot.constant_torque;
+	still_time = p_snapshot.still_time;
+	set_active(p_snapshot.active);
+
+	// Let the nodes catch up with the restored state on the next flush, even if the body doesn't move again.
+	if (body_state_callback.is_valid() && get_space() && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody3D::set_space(GodotSpace3D *p_space) {
 	if (get_space()) {
 		if (mass_properties_update_list.in_list()) {
@@ -452,6 +484,9 @@ void GodotBody3D::set_space(GodotSpace3D *p_space) {
 
 	_set_space(p_space);
 
+	// Versions are only meaningful within a space.
+	motion_query_cache.version = 0;
+
 	if (get_space()) {
 		_mass_properties_changed();
 
@@ -474,6 +509,13 @@ bool GodotBody3D::is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const {
 }
 
 void GodotBody3D::integrate_forces(real_t p_step) {
+	integrate_forces_threaded(p_step);
+	integrate_forces_commit();
+}
+
+void GodotBody3D::integrate_forces_threaded(real_t p_step) {
+	pending_motion_update = false;
+
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -664,22 +706,37 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		pending_motion = motion;
+		pending_motion_update = true;
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody3D::integrate_forces_commit() {
+	if (pending_motion_update) {
+		_update_shapes_with_motion(pending_motion);
+		pending_motion_update = false;
+	}
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
+	integrate_velocities_threaded(p_step);
+	integrate_velocities_commit();
+}
+
+void GodotBody3D::integrate_velocities_threaded(real_t p_step) {
+	pending_state_query = false;
+	pending_shapes_update = false;
+	pending_deactivate = false;
+
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
+	pending_state_query = fi_callback_data || body_state_callback.is_valid();
 
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
@@ -701,7 +758,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			pending_deactivate = true; //stopped moving, deactivate
 		}
 
 		return;
@@ -730,10 +787,31 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
+
+	_update_shape_aabbs();
+	pending_shapes_update = true;
+}
+
+void GodotBody3D::integrate_velocities_commit() {
+	if (pending_state_query) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (pending_shapes_update) {
+		_update_shapes_broadphase();
+	}
+
+	if (pending_deactivate) {
+		set_active(false);
+	}
+
+	pending_state_query = false;
+	pending_shapes_update = false;
+	pending_deactivate = false;
 }
 
 void GodotBody3D::wakeup_neighbours() {
@@ -34,12 +34,24 @@
 #include "godot_area_3d.h"
 #include "godot_collision_object_3d.h"
 
+#include "core/templates/local_vector.h"
 #include "core/templates/vset.h"
 
 class GodotConstraint3D;
 class GodotPhysicsDirectBodyState3D;
 
 class GodotBody3D : public GodotCollisionObject3D {
+public:
+	// Broadphase candidates gathered by GodotSpace3D::test_body_motion() on an expanded AABB,
+	// reused by the following motion tests until anything changes in the broadphase.
+	struct MotionQueryCache {
+		uint64_t version = 0;
+		AABB aabb;
+		LocalVector<GodotCollisionObject3D *> objects;
+		LocalVector<int> shapes;
+	};
+
+private:
 	PhysicsServer3D::BodyMode mode = PhysicsServer3D::BODY_MODE_RIGID;
 
 	Vector3 linear_velocity;
@@ -135,6 +147,8 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	Callable body_state_callback;
 
+	MotionQueryCache motion_query_cache;
+
 	struct ForceIntegrationCallbackData {
 		Callable callable;
 		Variant udata;
@@ -146,9 +160,19 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	uint64_t island_step = 0;
 
+	// Work left by the threaded halves of the integration for their commit.
+	Vector3 pending_motion;
+	bool pending_motion_update = false;
+	bool pending_shapes_update = false;
+	bool pending_state_query = false;
+	bool pending_deactivate = false;
+
+	uint32_t contact_solver_index = 0; // Slot in the GodotContactSolver3D of its island.
+
 	void _update_transform_dependent();
 
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
+	friend class GodotContactSolver3D;
 
 public:
 	void set_state_sync_callback(const Callable &p_callable);
@@ -299,6 +323,23 @@ public:
 	void set_state(PhysicsServer3D::BodyState p_state, const Variant &p_variant);
 	Variant get_state(PhysicsServer3D::BodyState p_state) const;
 
+	// Simulation state saved by GodotPhysicsServer3D::space_save_state(), for rollback.
+	struct Snapshot {
+		Transform3D transform;
+		Transform3D new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 constant_force;
+		Vector3 constant_torque;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
+	_FORCE_INLINE_ MotionQueryCache &get_motion_query_cache() { return motion_query_cache; }
+
 	_FORCE_INLINE_ void set_continuous_collision_detection(bool p_enable) { continuous_cd = p_enable; }
 	_FORCE_INLINE_ bool is_continuous_collision_detection_enabled() const { return continuous_cd; }
 
@@ -319,6 +360,13 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// The same integration split in two. The threaded halves can run for different bodies at once,
+	// the commits update the broadphase and the space lists and must be called from the physics thread.
+	void integrate_forces_threaded(real_t p_step);
+	void integrate_forces_commit();
+	void integrate_velocities_threaded(real_t p_step);
+	void integrate_velocities_commit();
+
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
 	}
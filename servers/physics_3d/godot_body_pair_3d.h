@@ -104,7 +104,27 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
+	friend class GodotContactSolver3D;
+
 public:
+	// Contact cache saved by GodotSpace3D::save_state(), for rollback.
+	struct Snapshot {
+		Vector3 sep_axis;
+		bool collided = false;
+		int contact_count = 0;
+		Contact contacts[MAX_CONTACTS];
+	};
+
+	_FORCE_INLINE_ GodotBody3D *get_body_a() const { return A; }
+	_FORCE_INLINE_ GodotBody3D *get_body_b() const { return B; }
+	_FORCE_INLINE_ int get_shape_a() const { return shape_A; }
+	_FORCE_INLINE_ int get_shape_b() const { return shape_B; }
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
+	virtual bool is_body_pair() const override { return true; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -85,6 +85,7 @@ void GodotCollisionObject3D::set_shape_disabled(int p_idx, bool p_disabled) {
 
 	if (p_disabled && shape.bpid != 0) {
 		space->get_broadphase()->remove(shape.bpid);
+		space->invalidate_motion_query_caches(this);
 		shape.bpid = 0;
 		if (!pending_shape_update_list.in_list()) {
 			GodotPhysicsServer3D::godot_singleton->pending_shape_update_list.add(&pending_shape_update_list);
@@ -115,6 +116,7 @@ void GodotCollisionObject3D::remove_shape(int p_index) {
 		}
 		//should never get here with a null owner
 		space->get_broadphase()->remove(shapes[i].bpid);
+		space->invalidate_motion_query_caches(this);
 		shapes.write[i].bpid = 0;
 	}
 	shapes[p_index].shape->remove_owner(this);
@@ -157,29 +159,70 @@ void GodotCollisionObject3D::_update_shapes() {
 		return;
 	}
 
+	_update_shape_aabbs();
+	_update_shapes_broadphase();
+}
+
+void GodotCollisionObject3D::_update_shape_aabbs() {
+	if (!space) {
+		return;
+	}
+
+	thread_local LocalVector<int> shape_indices;
+	thread_local LocalVector<Transform3D> shape_xforms;
+	thread_local LocalVector<AABB> shape_aabbs;
+	shape_indices.clear();
+	shape_xforms.clear();
+	shape_aabbs.clear();
+
 	for (int i = 0; i < shapes.size(); i++) {
-		Shape &s = shapes.write[i];
+		const Shape &s = shapes[i];
 		if (s.disabled) {
 			continue;
 		}
 
-		//not quite correct, should compute the next matrix..
-		AABB shape_aabb = s.shape->get_aabb();
-		Transform3D xform = transform * s.xform;
-		shape_aabb = xform.xform(shape_aabb);
+		shape_indices.push_back(i);
+		shape_xforms.push_back(s.xform);
+		shape_aabbs.push_back(s.shape->get_aabb());
+	}
+
+	//not quite correct, should compute the next matrix..
+	transform.mul_array(shape_xforms.ptr(), shape_xforms.ptr(), shape_xforms.size());
+	AABB::xform_batch(shape_xforms.ptr(), shape_aabbs.ptr(), shape_aabbs.ptr(), shape_aabbs.size());
+
+	for (uint32_t j = 0; j < shape_indices.size(); j++) {
+		int i = shape_indices[j];
+		Shape &s = shapes.write[i];
+
+		AABB shape_aabb = shape_aabbs[j];
 		shape_aabb.grow_by((s.aabb_cache.size.x + s.aabb_cache.size.y) * 0.5 * 0.05);
 		s.aabb_cache = shape_aabb;
 
-		Vector3 scale = xform.get_basis().get_scale();
+		Vector3 scale = shape_xforms[j].get_basis().get_scale();
 		s.area_cache = s.shape->get_volume() * scale.x * scale.y * scale.z;
+	}
+}
+
+void GodotCollisionObject3D::_update_shapes_broadphase() {
+	if (!space) {
+		return;
+	}
+
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
+		}
 
 		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
+
+	space->invalidate_motion_query_caches(this);
 }
 
 void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion) {
@@ -207,6 +250,8 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 
 		space->get_broadphase()->move(s.bpid, shape_aabb);
 	}
+
+	space->invalidate_motion_query_caches(this);
 }
 
 void GodotCollisionObject3D::_set_space(GodotSpace3D *p_space) {
@@ -223,6 +268,9 @@ void GodotCollisionObject3D::_set_space(GodotSpace3D *p_space) {
 				s.bpid = 0;
 			}
 		}
+
+		// Other bodies may still have this object among their cached candidates.
+		old_space->invalidate_motion_query_caches();
 	}
 
 	if (space) {
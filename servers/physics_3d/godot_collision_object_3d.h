@@ -82,6 +82,9 @@ private:
 	void _update_shapes();
 
 protected:
+	// The two halves of _update_shapes(), only the first one is safe to call from worker threads.
+	void _update_shape_aabbs();
+	void _update_shapes_broadphase();
 	void _update_shapes_with_motion(const Vector3 &p_motion);
 	void _unregister_shapes();
 
@@ -0,0 +1,347 @@
+/**************************************************************************/
+/*  godot_contact_solver_3d.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_contact_solver_3d.h"
+
+#include "godot_body_pair_3d.h"
+
+// Same values as GodotBodyPair3D::solve().
+#define MIN_VELOCITY 0.0001
+#define MAX_BIAS_ROTATION (Math_PI / 8)
+
+uint32_t GodotContactSolver3D::_get_body_slot(GodotBody3D *p_body) {
+	bool shared = p_body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC;
+	if (shared && p_body->contact_solver_index != UINT32_MAX) {
+		return p_body->contact_solver_index;
+	}
+
+	// Static and kinematic bodies can be in several islands solved at the same time, and are never written to.
+	// Each of their contacts gets its own copy, so they don't restrict the coloring either.
+	uint32_t slot = bodies.size();
+	bodies.push_back(p_body);
+	linear_velocity.push_back(p_body->linear_velocity);
+	angular_velocity.push_back(p_body->angular_velocity);
+	biased_linear_velocity.push_back(p_body->biased_linear_velocity);
+	biased_angular_velocity.push_back(p_body->biased_angular_velocity);
+	body_next_batch.push_back(0);
+
+	if (shared) {
+		p_body->contact_solver_index = slot;
+	}
+	return slot;
+}
+
+void GodotContactSolver3D::_add_contact(GodotBodyPair3D *p_pair, int p_contact, uint32_t p_body_a, uint32_t p_body_b) {
+	// Every batch from here on is free of both bodies, take the first one with room left.
+	uint32_t batch_index = MAX(body_next_batch[p_body_a], body_next_batch[p_body_b]);
+	while (batch_index < batch_count && batches[batch_index].lane_count == LANES) {
+		batch_index++;
+	}
+	if (batch_index == batch_count) {
+		if (batches.size() == batch_count) {
+			batches.push_back(Batch());
+		} else {
+			batches[batch_count] = Batch();
+		}
+		batch_count++;
+	}
+	body_next_batch[p_body_a] = batch_index + 1;
+	body_next_batch[p_body_b] = batch_index + 1;
+
+	const GodotBodyPair3D::Contact &c = p_pair->contacts[p_contact];
+	GodotBody3D *A = p_pair->A;
+	GodotBody3D *B = p_pair->B;
+
+	Batch &batch = batches[batch_index];
+	uint32_t l = batch.lane_count++;
+
+	batch.body_a[l] = p_body_a;
+	batch.body_b[l] = p_body_b;
+	batch.normal[l] = c.normal;
+	batch.r_a[l] = c.rA;
+	batch.r_b[l] = c.rB;
+
+	// Bodies excluded from the collision get no impulse, same as having an infinite mass.
+	Basis zero_basis;
+	zero_basis.set_zero();
+	batch.inv_inertia_a[l] = p_pair->collide_A ? A->get_inv_inertia_tensor() : zero_basis;
+	batch.inv_inertia_b[l] = p_pair->collide_B ? B->get_inv_inertia_tensor() : zero_basis;
+	batch.inv_mass_a[l] = p_pair->collide_A ? A->get_inv_mass() : 0.0;
+	batch.inv_mass_b[l] = p_pair->collide_B ? B->get_inv_mass() : 0.0;
+
+	batch.mass_normal[l] = c.mass_normal;
+	batch.bias[l] = c.bias;
+	batch.bounce[l] = c.bounce;
+	batch.friction[l] = ABS(MIN(A->get_friction(), B->get_friction()));
+	batch.acc_normal_impulse[l] = c.acc_normal_impulse;
+	batch.acc_bias_impulse[l] = c.acc_bias_impulse;
+	batch.acc_bias_impulse_center_of_mass[l] = c.acc_bias_impulse_center_of_mass;
+	batch.acc_tangent_impulse[l] = c.acc_tangent_impulse;
+	batch.acc_impulse[l] = c.acc_impulse;
+	batch.active[l] = true;
+
+	batch.pair[l] = p_pair;
+	batch.contact[l] = p_contact;
+}
+
+void GodotContactSolver3D::setup(LocalVector<GodotConstraint3D *> &r_constraints, real_t p_step) {
+	max_bias_av = MAX_BIAS_ROTATION / p_step;
+
+	bodies.clear();
+	linear_velocity.clear();
+	angular_velocity.clear();
+	biased_linear_velocity.clear();
+	biased_angular_velocity.clear();
+	body_next_batch.clear();
+	pairs.clear();
+	batch_count = 0;
+
+	bodies.push_back(nullptr);
+	linear_velocity.push_back(Vector3());
+	angular_velocity.push_back(Vector3());
+	biased_linear_velocity.push_back(Vector3());
+	biased_angular_velocity.push_back(Vector3());
+	body_next_batch.push_back(0);
+
+	uint32_t constraint_count = 0;
+	for (GodotConstraint3D *constraint : r_constraints) {
+		if (!constraint->is_body_pair()) {
+			r_constraints[constraint_count++] = constraint;
+			continue;
+		}
+
+		GodotBodyPair3D *pair = static_cast<GodotBodyPair3D *>(constraint);
+		pair->A->contact_solver_index = UINT32_MAX;
+		pair->B->contact_solver_index = UINT32_MAX;
+		pairs.push_back(pair);
+	}
+	r_constraints.resize(constraint_count);
+
+	for (GodotBodyPair3D *pair : pairs) {
+		uint32_t body_a = _get_body_slot(pair->A);
+		uint32_t body_b = _get_body_slot(pair->B);
+
+		for (int i = 0; i < pair->contact_count; i++) {
+			// Contacts discarded by pre_solve() are never solved.
+			if (pair->contacts[i].active) {
+				_add_contact(pair, i, body_a, body_b);
+			}
+		}
+	}
+}
+
+void GodotContactSolver3D::_solve_batch(Batch &r_batch) {
+	Vector3 lv_a[LANES], av_a[LANES], blv_a[LANES], bav_a[LANES];
+	Vector3 lv_b[LANES], av_b[LANES], blv_b[LANES], bav_b[LANES];
+
+	for (uint32_t l = 0; l < LANES; l++) {
+		uint32_t a = r_batch.body_a[l];
+		uint32_t b = r_batch.body_b[l];
+		lv_a[l] = linear_velocity[a];
+		av_a[l] = angular_velocity[a];
+		blv_a[l] = biased_linear_velocity[a];
+		bav_a[l] = biased_angular_velocity[a];
+		lv_b[l] = linear_velocity[b];
+		av_b[l] = angular_velocity[b];
+		blv_b[l] = biased_linear_velocity[b];
+		bav_b[l] = biased_angular_velocity[b];
+	}
+
+	// Same math as GodotBodyPair3D::solve(), the impulses are applied to the local copies of the velocities.
+	for (uint32_t l = 0; l < LANES; l++) {
+		if (!r_batch.active[l]) {
+			continue;
+		}
+
+		bool active = false;
+
+		const Vector3 &n = r_batch.normal[l];
+		const Vector3 &ra = r_batch.r_a[l];
+		const Vector3 &rb = r_batch.r_b[l];
+		const Basis &ii_a = r_batch.inv_inertia_a[l];
+		const Basis &ii_b = r_batch.inv_inertia_b[l];
+		real_t im_a = r_batch.inv_mass_a[l];
+		real_t im_b = r_batch.inv_mass_b[l];
+
+		// Bias impulse.
+		real_t vbn = (blv_b[l] + bav_b[l].cross(rb) - blv_a[l] - bav_a[l].cross(ra)).dot(n);
+
+		if (Math::abs(-vbn + r_batch.bias[l]) > MIN_VELOCITY) {
+			real_t jbn = (-vbn + r_batch.bias[l]) * r_batch.mass_normal[l];
+			real_t jbn_old = r_batch.acc_bias_impulse[l];
+			r_batch.acc_bias_impulse[l] = MAX(jbn_old + jbn, 0.0f);
+
+			Vector3 jb = n * (r_batch.acc_bias_impulse[l] - jbn_old);
+
+			blv_a[l] -= jb * im_a;
+			Vector3 delta_av_a = ii_a.xform(ra.cross(-jb));
+			if (delta_av_a.length() > max_bias_av) {
+				delta_av_a = delta_av_a.normalized() * max_bias_av;
+			}
+			bav_a[l] += delta_av_a;
+
+			blv_b[l] += jb * im_b;
+			Vector3 delta_av_b = ii_b.xform(rb.cross(jb));
+			if (delta_av_b.length() > max_bias_av) {
+				delta_av_b = delta_av_b.normalized() * max_bias_av;
+			}
+			bav_b[l] += delta_av_b;
+
+			vbn = (blv_b[l] + bav_b[l].cross(rb) - blv_a[l] - bav_a[l].cross(ra)).dot(n);
+
+			if (Math::abs(-vbn + r_batch.bias[l]) > MIN_VELOCITY) {
+				real_t jbn_com = (-vbn + r_batch.bias[l]) / (im_a + im_b);
+				real_t jbn_old_com = r_batch.acc_bias_impulse_center_of_mass[l];
+				r_batch.acc_bias_impulse_center_of_mass[l] = MAX(jbn_old_com + jbn_com, 0.0f);
+
+				Vector3 jb_com = n * (r_batch.acc_bias_impulse_center_of_mass[l] - jbn_old_com);
+				blv_a[l] -= jb_com * im_a;
+				blv_b[l] += jb_com * im_b;
+			}
+
+			active = true;
+		}
+
+		// Normal impulse.
+		real_t vn = (lv_b[l] + av_b[l].cross(rb) - lv_a[l] - av_a[l].cross(ra)).dot(n);
+
+		if (Math::abs(vn) > MIN_VELOCITY) {
+			real_t jn = -(r_batch.bounce[l] + vn) * r_batch.mass_normal[l];
+			real_t jn_old = r_batch.acc_normal_impulse[l];
+			r_batch.acc_normal_impulse[l] = MAX(jn_old + jn, 0.0f);
+
+			Vector3 j = n * (r_batch.acc_normal_impulse[l] - jn_old);
+
+			lv_a[l] -= j * im_a;
+			av_a[l] += ii_a.xform(ra.cross(-j));
+			lv_b[l] += j * im_b;
+			av_b[l] += ii_b.xform(rb.cross(j));
+			r_batch.acc_impulse[l] -= j;
+
+			active = true;
+		}
+
+		// Friction impulse.
+		Vector3 dtv = (lv_b[l] + av_b[l].cross(rb)) - (lv_a[l] + av_a[l].cross(ra));
+		Vector3 tv = dtv - n * n.dot(dtv);
+		real_t tvl = tv.length();
+
+		if (tvl > MIN_VELOCITY) {
+			tv /= tvl;
+
+			Vector3 temp1 = ii_a.xform(ra.cross(tv));
+			Vector3 temp2 = ii_b.xform(rb.cross(tv));
+
+			real_t t = -tvl / (im_a + im_b + tv.dot(temp1.cross(ra) + temp2.cross(rb)));
+
+			Vector3 jt_old = r_batch.acc_tangent_impulse[l];
+			r_batch.acc_tangent_impulse[l] += t * tv;
+
+			real_t fi_len = r_batch.acc_tangent_impulse[l].length();
+			real_t jt_max = r_batch.acc_normal_impulse[l] * r_batch.friction[l];
+
+			if (fi_len > CMP_EPSILON && fi_len > jt_max) {
+				r_batch.acc_tangent_impulse[l] *= jt_max / fi_len;
+			}
+
+			Vector3 jt = r_batch.acc_tangent_impulse[l] - jt_old;
+
+			lv_a[l] -= jt * im_a;
+			av_a[l] += ii_a.xform(ra.cross(-jt));
+			lv_b[l] += jt * im_b;
+			av_b[l] += ii_b.xform(rb.cross(jt));
+			r_batch.acc_impulse[l] -= jt;
+
+			active = true;
+		}
+
+		r_batch.active[l] = active;
+	}
+
+	// No rigid body is used twice in a batch, the lanes can't overwrite each other.
+	for (uint32_t l = 0; l < LANES; l++) {
+		uint32_t a = r_batch.body_a[l];
+		uint32_t b = r_batch.body_b[l];
+		linear_velocity[a] = lv_a[l];
+		angular_velocity[a] = av_a[l];
+		biased_linear_velocity[a] = blv_a[l];
+		biased_angular_velocity[a] = bav_a[l];
+		linear_velocity[b] = lv_b[l];
+		angular_velocity[b] = av_b[l];
+		biased_linear_velocity[b] = blv_b[l];
+		biased_angular_velocity[b] = bav_b[l];
+	}
+}
+
+void GodotContactSolver3D::solve() {
+	for (uint32_t i = 0; i < batch_count; i++) {
+		_solve_batch(batches[i]);
+	}
+}
+
+void GodotContactSolver3D::store_bodies() {
+	for (uint32_t i = 1; i < bodies.size(); i++) {
+		GodotBody3D *body = bodies[i];
+		if (body->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			continue; // Never changed, and possibly shared with other islands.
+		}
+		body->linear_velocity = linear_velocity[i];
+		body->angular_velocity = angular_velocity[i];
+		body->biased_linear_velocity = biased_linear_velocity[i];
+		body->biased_angular_velocity = biased_angular_velocity[i];
+	}
+}
+
+void GodotContactSolver3D::load_bodies() {
+	for (uint32_t i = 1; i < bodies.size(); i++) {
+		GodotBody3D *body = bodies[i];
+		linear_velocity[i] = body->linear_velocity;
+		angular_velocity[i] = body->angular_velocity;
+		biased_linear_velocity[i] = body->biased_linear_velocity;
+		biased_angular_velocity[i] = body->biased_angular_velocity;
+	}
+}
+
+void GodotContactSolver3D::finish() {
+	store_bodies();
+
+	for (uint32_t i = 0; i < batch_count; i++) {
+		const Batch &batch = batches[i];
+		for (uint32_t l = 0; l < batch.lane_count; l++) {
+			GodotBodyPair3D::Contact &c = batch.pair[l]->contacts[batch.contact[l]];
+			c.acc_normal_impulse = batch.acc_normal_impulse[l];
+			c.acc_bias_impulse = batch.acc_bias_impulse[l];
+			c.acc_bias_impulse_center_of_mass = batch.acc_bias_impulse_center_of_mass[l];
+			c.acc_tangent_impulse = batch.acc_tangent_impulse[l];
+			c.acc_impulse = batch.acc_impulse[l];
+			c.active = batch.active[l];
+		}
+	}
+}
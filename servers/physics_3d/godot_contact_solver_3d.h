@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  godot_contact_solver_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_CONTACT_SOLVER_3D_H
+#define GODOT_CONTACT_SOLVER_3D_H
+
+#include "core/math/basis.h"
+#include "core/templates/local_vector.h"
+
+class GodotBody3D;
+class GodotBodyPair3D;
+class GodotConstraint3D;
+
+// Solves the contacts of the body pairs of an island from packed arrays instead of calling GodotBodyPair3D::solve().
+// Contacts are colored into batches of LANES contacts which never share a rigid body, so the lanes of a batch are
+// independent and the loops over them can be vectorized by the compiler.
+class GodotContactSolver3D {
+public:
+	static constexpr uint32_t LANES = 4;
+
+private:
+	struct Batch {
+		uint32_t body_a[LANES] = {};
+		uint32_t body_b[LANES] = {};
+		Vector3 normal[LANES];
+		Vector3 r_a[LANES];
+		Vector3 r_b[LANES];
+		Basis inv_inertia_a[LANES];
+		Basis inv_inertia_b[LANES];
+		real_t inv_mass_a[LANES] = {};
+		real_t inv_mass_b[LANES] = {};
+		real_t mass_normal[LANES] = {};
+		real_t bias[LANES] = {};
+		real_t bounce[LANES] = {};
+		real_t friction[LANES] = {};
+		real_t acc_normal_impulse[LANES] = {};
+		real_t acc_bias_impulse[LANES] = {};
+		real_t acc_bias_impulse_center_of_mass[LANES] = {};
+		Vector3 acc_tangent_impulse[LANES];
+		Vector3 acc_impulse[LANES];
+		bool active[LANES] = {};
+
+		GodotBodyPair3D *pair[LANES] = {};
+		int contact[LANES] = {};
+		uint32_t lane_count = 0;
+	};
+
+	// Slot 0 is a body at rest with no mass, used by the empty lanes.
+	LocalVector<GodotBody3D *> bodies;
+	LocalVector<Vector3> linear_velocity;
+	LocalVector<Vector3> angular_velocity;
+	LocalVector<Vector3> biased_linear_velocity;
+	LocalVector<Vector3> biased_angular_velocity;
+	LocalVector<uint32_t> body_next_batch; // First batch which can take a new contact of the body.
+
+	LocalVector<GodotBodyPair3D *> pairs;
+	LocalVector<Batch> batches;
+	uint32_t batch_count = 0;
+
+	real_t max_bias_av = 0.0;
+
+	uint32_t _get_body_slot(GodotBody3D *p_body);
+	void _add_contact(GodotBodyPair3D *p_pair, int p_contact, uint32_t p_body_a, uint32_t p_body_b);
+	void _solve_batch(Batch &r_batch);
+
+public:
+	// Takes the body pairs out of r_constraints and packs their active contacts, other constraints are left in place.
+	void setup(LocalVector<GodotConstraint3D *> &r_constraints, real_t p_step);
+	_FORCE_INLINE_ bool is_empty() const { return batch_count == 0; }
+
+	// One solver iteration over all the contacts.
+	void solve();
+
+	// Bodies are only updated by store_bodies(), and must be loaded again if something else changed them meanwhile.
+	void store_bodies();
+	void load_bodies();
+
+	// Stores the bodies and the accumulated impulses of the contacts.
+	void finish();
+};
+
+#endif // GODOT_CONTACT_SOLVER_3D_H
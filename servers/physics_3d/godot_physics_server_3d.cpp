@@ -39,70 +39,85 @@
 #include "joints/godot_slider_joint_3d.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/timeline_profiler.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
+#define BODY_TEST_MOTION_MIN_PARALLEL_COUNT 16
+
 #define FLUSH_QUERY_CHECK(m_object) \
 	ERR_FAIL_COND_MSG(m_object->get_space() && flushing_queries, "Can't change this state while flushing queries. Use call_deferred() or set_deferred() to change monitoring state instead.");
 
 RID GodotPhysicsServer3D::world_boundary_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotWorldBoundaryShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::separation_ray_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotSeparationRayShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::sphere_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotSphereShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::box_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotBoxShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::capsule_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotCapsuleShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::cylinder_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotCylinderShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::convex_polygon_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotConvexPolygonShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::concave_polygon_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotConcavePolygonShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::heightmap_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = memnew(GodotHeightMapShape3D);
 	RID rid = shape_owner.make_rid(shape);
 	shape->set_self(rid);
 	return rid;
 }
 RID GodotPhysicsServer3D::custom_shape_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	ERR_FAIL_V(RID());
 }
 
 void GodotPhysicsServer3D::shape_set_data(RID p_shape, const Variant &p_data) {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotShape3D *shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 	shape->set_data(p_data);
@@ -141,6 +156,7 @@ real_t GodotPhysicsServer3D::shape_get_custom_solver_bias(RID p_shape) const {
 }
 
 RID GodotPhysicsServer3D::space_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotSpace3D *space = memnew(GodotSpace3D);
 	RID id = space_owner.make_rid(space);
 	space->set_self(id);
@@ -214,7 +230,153 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+// Space states start with this header, followed by the bodies and then the contact caches of their pairs.
+struct GodotSpaceStateHeader3D {
+	static const uint32_t MAGIC = 0x33535047; // "GPS3"
+	static const uint32_t VERSION = 1;
+
+	uint32_t magic = MAGIC;
+	uint32_t version = VERSION;
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+};
+
+struct GodotSpaceStateBody3D {
+	uint64_t rid = 0;
+	GodotBody3D::Snapshot snapshot;
+};
+
+struct GodotSpaceStatePair3D {
+	uint64_t rid_a = 0;
+	uint64_t rid_b = 0;
+	int32_t shape_a = 0;
+	int32_t shape_b = 0;
+	GodotBodyPair3D::Snapshot snapshot;
+};
+
+PackedByteArray GodotPhysicsServer3D::space_save_state(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Can't save the state of a space while it's being stepped or queried.");
+
+	LocalVector<const GodotBody3D *> bodies;
+	LocalVector<const GodotBodyPair3D *> pairs;
+	for (const GodotCollisionObject3D *object : space->get_objects()) {
+		if (object->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(object);
+		bodies.push_back(body);
+
+		for (const KeyValue<GodotConstraint3D *, int> &E : body->get_constraint_map()) {
+			if (!E.key->is_body_pair()) {
+				continue;
+			}
+			const GodotBodyPair3D *pair = static_cast<const GodotBodyPair3D *>(E.key);
+			if (pair->get_body_a() == body) {
+				pairs.push_back(pair); // Saved once, from its first body.
+			}
+		}
+	}
+
+	GodotSpaceStateHeader3D header;
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+
+	PackedByteArray state;
+	state.resize(sizeof(GodotSpaceStateHeader3D) + sizeof(GodotSpaceStateBody3D) * bodies.size() + sizeof(GodotSpaceStatePair3D) * pairs.size());
+	uint8_t *w = state.ptrw();
+
+	memcpy(w, &header, sizeof(GodotSpaceStateHeader3D));
+	w += sizeof(GodotSpaceStateHeader3D);
+
+	for (const GodotBody3D *body : bodies) {
+		GodotSpaceStateBody3D entry;
+		entry.rid = body->get_self().get_id();
+		body->save_snapshot(entry.snapshot);
+		memcpy(w, &entry, sizeof(GodotSpaceStateBody3D));
+		w += sizeof(GodotSpaceStateBody3D);
+	}
+
+	for (const GodotBodyPair3D *pair : pairs) {
+		GodotSpaceStatePair3D entry;
+		entry.rid_a = pair->get_body_a()->get_self().get_id();
+		entry.rid_b = pair->get_body_b()->get_self().get_id();
+		entry.shape_a = pair->get_shape_a();
+		entry.shape_b = pair->get_shape_b();
+		pair->save_snapshot(entry.snapshot);
+		memcpy(w, &entry, sizeof(GodotSpaceStatePair3D));
+		w += sizeof(GodotSpaceStatePair3D);
+	}
+
+	return state;
+}
+
+void GodotPhysicsServer3D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't restore the state of a space while it's being stepped or queried.");
+	ERR_FAIL_COND(p_state.size() < (int64_t)sizeof(GodotSpaceStateHeader3D));
+
+	const uint8_t *r = p_state.ptr();
+	GodotSpaceStateHeader3D header;
+	memcpy(&header, r, sizeof(GodotSpaceStateHeader3D));
+	r += sizeof(GodotSpaceStateHeader3D);
+
+	ERR_FAIL_COND_MSG(header.magic != GodotSpaceStateHeader3D::MAGIC || header.version != GodotSpaceStateHeader3D::VERSION || header.real_size != sizeof(real_t), "Invalid space state.");
+	ERR_FAIL_COND_MSG(p_state.size() != (int64_t)(sizeof(GodotSpaceStateHeader3D) + sizeof(GodotSpaceStateBody3D) * header.body_count + sizeof(GodotSpaceStatePair3D) * header.pair_count), "Invalid space state.");
+
+	// Bodies which were removed from the space since the state was saved are skipped.
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotSpaceStateBody3D entry;
+		memcpy(&entry, r, sizeof(GodotSpaceStateBody3D));
+		r += sizeof(GodotSpaceStateBody3D);
+
+		GodotBody3D *body = body_owner.get_or_null(RID::from_uint64(entry.rid));
+		if (body && body->get_space() == space) {
+			body->restore_snapshot(entry.snapshot);
+		}
+	}
+
+	// Contact caches are only restored for pairs which still exist, others are rebuilt by the next step.
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotSpaceStatePair3D entry;
+		memcpy(&entry, r, sizeof(GodotSpaceStatePair3D));
+		r += sizeof(GodotSpaceStatePair3D);
+
+		GodotBody3D *body_a = body_owner.get_or_null(RID::from_uint64(entry.rid_a));
+		GodotBody3D *body_b = body_owner.get_or_null(RID::from_uint64(entry.rid_b));
+		if (!body_a || !body_b || body_a->get_space() != space) {
+			continue;
+		}
+
+		for (const KeyValue<GodotConstraint3D *, int> &E : body_a->get_constraint_map()) {
+			if (!E.key->is_body_pair()) {
+				continue;
+			}
+			GodotBodyPair3D *pair = static_cast<GodotBodyPair3D *>(E.key);
+			if (pair->get_body_a() == body_a && pair->get_body_b() == body_b && pair->get_shape_a() == entry.shape_a && pair->get_shape_b() == entry.shape_b) {
+				pair->restore_snapshot(entry.snapshot);
+				break;
+			}
+		}
+	}
+}
+
+void GodotPhysicsServer3D::space_step(RID p_space, real_t p_step) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Can't step a space while it's being stepped or queried.");
+	ERR_FAIL_COND(p_step <= 0.0);
+
+	// Only simulates, the state of the bodies reaches their nodes with the next regular flush.
+	_update_shapes();
+	stepper->step(space, p_step);
+}
+
 RID GodotPhysicsServer3D::area_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
 	area->set_self(rid);
@@ -440,6 +602,7 @@ void GodotPhysicsServer3D::area_set_area_monitor_callback(RID p_area, const Call
 /* BODY API */
 
 RID GodotPhysicsServer3D::body_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotBody3D *body = memnew(GodotBody3D);
 	RID rid = body_owner.make_rid(body);
 	body->set_self(rid);
@@ -691,6 +854,18 @@ Variant GodotPhysicsServer3D::body_get_state(RID p_body, BodyState p_state) cons
 	return body->get_state(p_state);
 }
 
+Vector<Transform3D> GodotPhysicsServer3D::bodies_get_transform(const Vector<RID> &p_bodies) const {
+	Vector<Transform3D> transforms;
+	transforms.resize(p_bodies.size());
+	Transform3D *w = transforms.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		GodotBody3D *body = body_owner.get_or_null(p_bodies[i]);
+		ERR_CONTINUE(!body);
+		w[i] = body->get_transform();
+	}
+	return transforms;
+}
+
 void GodotPhysicsServer3D::body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) {
 	GodotBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -920,6 +1095,79 @@ bool GodotPhysicsServer3D::body_test_motion(RID p_body, const MotionParameters &
 	return body->get_space()->test_body_motion(body, p_parameters, r_result);
 }
 
+void GodotPhysicsServer3D::_body_test_motion_batch_item(uint32_t p_index, BodyTestMotionBatch *p_batch) {
+	GodotBody3D *body = p_batch->bodies[p_index];
+	if (!body) {
+		p_batch->results[p_index] = MotionResult();
+		p_batch->collided[p_index] = false;
+		return;
+	}
+
+	p_batch->collided[p_index] = body->get_space()->test_body_motion(body, p_batch->parameters[p_index], &p_batch->results[p_index]);
+}
+
+void GodotPhysicsServer3D::body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) {
+	ERR_FAIL_COND(p_count < 0);
+
+	_update_shapes();
+
+	LocalVector<GodotBody3D *> bodies;
+	bodies.resize(p_count);
+
+	// Each test only writes to the motion query cache of its own body, so a body can't be tested twice in parallel.
+	HashSet<GodotBody3D *> unique_bodies;
+	bool parallel = p_count >= BODY_TEST_MOTION_MIN_PARALLEL_COUNT;
+
+	for (int i = 0; i < p_count; i++) {
+		GodotBody3D *body = body_owner.get_or_null(p_bodies[i]);
+		if (body && (!body->get_space() || body->get_space()->is_locked())) {
+			body = nullptr;
+		}
+		bodies[i] = body;
+		ERR_CONTINUE_MSG(!body, "Invalid body, or body outside of an unlocked space, in motion test batch.");
+
+		if (parallel) {
+			if (unique_bodies.has(body)) {
+				parallel = false;
+			} else {
+				unique_bodies.insert(body);
+			}
+		}
+	}
+
+	BodyTestMotionBatch batch;
+	batch.bodies = bodies.ptr();
+	batch.parameters = p_parameters;
+	batch.results = r_results;
+	batch.collided = r_collided;
+
+	if (!parallel) {
+		for (int i = 0; i < p_count; i++) {
+			_body_test_motion_batch_item(i, &batch);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsServer3D::_body_test_motion_batch_item, &batch, p_count, -1, true, SNAME("GodotPhysicsTestMotions3D"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsServer3D::get_changed_body_states(LocalVector<BodyStateSnapshot> &r_states) const {
+	for (const GodotSpace3D *space : active_spaces) {
+		for (const SelfList<GodotBody3D> *E = space->get_state_query_list().first(); E; E = E->next()) {
+			const GodotBody3D *body = E->self();
+
+			BodyStateSnapshot state;
+			state.body = body->get_self();
+			state.transform = body->get_transform();
+			state.linear_velocity = body->get_linear_velocity();
+			state.angular_velocity = body->get_angular_velocity();
+			state.sleeping = !body->is_active();
+			r_states.push_back(state);
+		}
+	}
+}
+
 PhysicsDirectBodyState3D *GodotPhysicsServer3D::body_get_direct_state(RID p_body) {
 	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync), nullptr, "Body state is inaccessible right now, wait for iteration or physics process notification.");
 
@@ -942,6 +1190,7 @@ PhysicsDirectBodyState3D *GodotPhysicsServer3D::body_get_direct_state(RID p_body
 /* SOFT BODY */
 
 RID GodotPhysicsServer3D::soft_body_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotSoftBody3D *soft_body = memnew(GodotSoftBody3D);
 	RID rid = soft_body_owner.make_rid(soft_body);
 	soft_body->set_self(rid);
@@ -1202,6 +1451,7 @@ bool GodotPhysicsServer3D::soft_body_is_point_pinned(RID p_body, int p_point_ind
 /* JOINT API */
 
 RID GodotPhysicsServer3D::joint_create() {
+	MemoryTagScope tag_scope(Memory::TAG_PHYSICS);
 	GodotJoint3D *joint = memnew(GodotJoint3D);
 	RID rid = joint_owner.make_rid(joint);
 	joint->set_self(rid);
@@ -1630,6 +1880,7 @@ void GodotPhysicsServer3D::init() {
 
 void GodotPhysicsServer3D::step(real_t p_step) {
 #ifndef _3D_DISABLED
+	TIMELINE_ZONE("PhysicsServer3D::step");
 
 	if (!active) {
 		return;
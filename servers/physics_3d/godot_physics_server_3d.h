@@ -68,6 +68,15 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
 	void _update_shapes();
 
+	struct BodyTestMotionBatch {
+		GodotBody3D **bodies = nullptr;
+		const MotionParameters *parameters = nullptr;
+		MotionResult *results = nullptr;
+		bool *collided = nullptr;
+	};
+
+	void _body_test_motion_batch_item(uint32_t p_index, BodyTestMotionBatch *p_batch);
+
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
@@ -117,6 +126,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual void space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+	virtual void space_step(RID p_space, real_t p_step) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
@@ -208,6 +221,7 @@ public:
 
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) override;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const override;
+	virtual Vector<Transform3D> bodies_get_transform(const Vector<RID> &p_bodies) const override;
 
 	virtual void body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) override;
 	virtual void body_apply_impulse(RID p_body, const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) override;
@@ -251,6 +265,9 @@ public:
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) override;
+	virtual void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) override;
+
+	virtual void get_changed_body_states(LocalVector<BodyStateSnapshot> &r_states) const override;
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override;
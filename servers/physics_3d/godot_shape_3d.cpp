@@ -33,6 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/sort_array.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
@@ -1345,42 +1346,43 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
-
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
+void GodotConcavePolygonShape3D::_quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const {
+	Vector3 from = (p_aabb.position - bvh_origin) * bvh_quantize_scale;
+	Vector3 to = (p_aabb.position + p_aabb.size - bvh_origin) * bvh_quantize_scale;
+	for (int i = 0; i < 3; i++) {
+		r_min[i] = (uint16_t)CLAMP(Math::floor(from[i]), (real_t)0.0, (real_t)UINT16_MAX);
+		r_max[i] = (uint16_t)CLAMP(Math::ceil(to[i]), (real_t)0.0, (real_t)UINT16_MAX);
 	}
+}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->face_index = face_index;
-				p_params->collisions++;
+// Returns the parameter along the segment at which it enters p_aabb, or a negative value if it misses it.
+_FORCE_INLINE_ static real_t _concave_segment_enter(const AABB &p_aabb, const Vector3 &p_from, const Vector3 &p_delta) {
+	real_t enter = 0.0;
+	real_t exit = 1.0;
+	for (int i = 0; i < 3; i++) {
+		real_t seg_from = p_from[i];
+		// Grown a bit, dequantized bounds may be off by rounding errors.
+		real_t box_begin = p_aabb.position[i] - CMP_EPSILON;
+		real_t box_end = p_aabb.position[i] + p_aabb.size[i] + CMP_EPSILON;
+		if (Math::abs(p_delta[i]) < CMP_EPSILON) {
+			if ((seg_from < box_begin) || (seg_from > box_end)) {
+				return -1.0;
 			}
+			continue;
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
+
+		real_t t0 = (box_begin - seg_from) / p_delta[i];
+		real_t t1 = (box_end - seg_from) / p_delta[i];
+		if (t0 > t1) {
+			SWAP(t0, t1);
 		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
+		enter = MAX(enter, t0);
+		exit = MIN(exit, t1);
+		if (enter > exit) {
+			return -1.0;
 		}
 	}
+	return enter;
 }
 
 bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
@@ -1391,29 +1393,76 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	// unlock data
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
-	const BVH *br = bvh.ptr();
 
 	GodotFaceShape3D face;
 	face.backface_collision = backface_collision && p_hit_back_faces;
 
-	_SegmentCullParams params;
-	params.from = p_begin;
-	params.to = p_end;
-	params.dir = (p_end - p_begin).normalized();
+	Vector3 delta = p_end - p_begin;
+	real_t length = delta.length();
+	Vector3 dir = delta.normalized();
 
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
+	Vector3 result;
+	Vector3 normal;
+	int result_face_index = -1;
+	real_t min_d = 1e20;
+	bool collided = false;
 
-	params.face = &face;
+	uint32_t stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
 
-	// cull
-	_cull_segment(0, &params);
+	while (stack_size > 0) {
+		uint32_t node_index = stack[--stack_size];
+		const BVHNode &node = bvh[node_index];
 
-	if (params.collisions > 0) {
-		r_result = params.result;
-		r_normal = params.normal;
-		r_face_index = params.face_index;
+		real_t enter = _concave_segment_enter(_get_node_aabb(node), p_begin, delta);
+		if (enter < 0.0 || enter * length > min_d) {
+			continue; // Missed, or farther than the closest hit so far.
+		}
+
+		if (node.face_count == 0) {
+			// Push the farthest child first, so the closest one is visited next.
+			uint32_t left = node_index + 1;
+			uint32_t right = node.offset;
+			const BVHNode &left_node = bvh[left];
+			const BVHNode &right_node = bvh[right];
+			real_t left_d = dir.dot(Vector3(left_node.min[0] + left_node.max[0], left_node.min[1] + left_node.max[1], left_node.min[2] + left_node.max[2]) * bvh_dequantize_scale);
+			real_t right_d = dir.dot(Vector3(right_node.min[0] + right_node.max[0], right_node.min[1] + right_node.max[1], right_node.min[2] + right_node.max[2]) * bvh_dequantize_scale);
+			if (left_d < right_d) {
+				SWAP(left, right);
+			}
+			stack[stack_size++] = left;
+			stack[stack_size++] = right;
+			continue;
+		}
+
+		for (uint32_t i = 0; i < node.face_count; i++) {
+			int face_index = bvh_faces[node.offset + i];
+			const Face *f = &fr[face_index];
+			face.normal = f->normal;
+			face.vertex[0] = vr[f->indices[0]];
+			face.vertex[1] = vr[f->indices[1]];
+			face.vertex[2] = vr[f->indices[2]];
+
+			Vector3 res;
+			Vector3 res_normal;
+			if (face.intersect_segment(p_begin, p_end, res, res_normal, face_index, true)) {
+				real_t d = dir.dot(res) - dir.dot(p_begin);
+				if ((d > 0) && (d < min_d)) {
+					min_d = d;
+					result = res;
+					normal = res_normal;
+					result_face_index = face_index;
+					collided = true;
+				}
+			}
+		}
+	}
+
+	if (collided) {
+		r_result = result;
+		r_normal = normal;
+		r_face_index = result_face_index;
 		return true;
 	} else {
 		return false;
@@ -1428,34 +1477,27 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
-
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
-	}
+bool GodotConcavePolygonShape3D::_cull_faces(const uint32_t *p_faces, int p_count, const AABB &p_aabb, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const {
+	const Face *fr = faces.ptr();
+	const Vector3 *vr = vertices.ptr();
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
+	for (int i = 0; i < p_count; i++) {
+		const Face &f = fr[p_faces[i]];
+		r_face.vertex[0] = vr[f.indices[0]];
+		r_face.vertex[1] = vr[f.indices[1]];
+		r_face.vertex[2] = vr[f.indices[2]];
+
+		// Leaves are shared by several faces, so check each of them before handing it to the solver.
+		AABB face_aabb(r_face.vertex[0], Vector3());
+		face_aabb.expand_to(r_face.vertex[1]);
+		face_aabb.expand_to(r_face.vertex[2]);
+		if (!p_aabb.intersects_inclusive(face_aabb)) {
+			continue;
 		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		r_face.normal = f.normal;
+		if (p_callback(p_userdata, &r_face)) {
+			return true;
 		}
 	}
 
@@ -1468,28 +1510,55 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	if (!p_local_aabb.intersects_inclusive(get_aabb())) {
+		return;
+	}
 
-	// unlock data
-	const Face *fr = faces.ptr();
-	const Vector3 *vr = vertices.ptr();
-	const BVH *br = bvh.ptr();
+	uint16_t query_min[3];
+	uint16_t query_max[3];
+	_quantize_aabb(p_local_aabb, query_min, query_max);
 
 	GodotFaceShape3D face; // use this to send in the callback
 	face.backface_collision = backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	_CullParams params;
-	params.aabb = local_aabb;
-	params.face = &face;
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
-	params.callback = p_callback;
-	params.userdata = p_userdata;
+	uint32_t stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	// Gather candidate faces during the traversal and hand them over to the solver in batches,
+	// so the tree is walked without the callbacks evicting it from the cache in between.
+	uint32_t candidates[CULL_BATCH_SIZE];
+	int candidate_count = 0;
+
+	while (stack_size > 0) {
+		uint32_t node_index = stack[--stack_size];
+		const BVHNode &node = bvh[node_index];
 
-	// cull
-	_cull(0, &params);
+		if (node.min[0] > query_max[0] || node.max[0] < query_min[0] ||
+				node.min[1] > query_max[1] || node.max[1] < query_min[1] ||
+				node.min[2] > query_max[2] || node.max[2] < query_min[2]) {
+			continue;
+		}
+
+		if (node.face_count == 0) {
+			stack[stack_size++] = node.offset;
+			stack[stack_size++] = node_index + 1;
+			continue;
+		}
+
+		for (uint32_t i = 0; i < node.face_count; i++) {
+			if (candidate_count == CULL_BATCH_SIZE) {
+				if (_cull_faces(candidates, candidate_count, p_local_aabb, p_callback, p_userdata, face)) {
+					return;
+				}
+				candidate_count = 0;
+			}
+			candidates[candidate_count++] = bvh_faces[node.offset + i];
+		}
+	}
+
+	_cull_faces(candidates, candidate_count, p_local_aabb, p_callback, p_userdata, face);
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1502,116 +1571,247 @@ Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
-struct _Volume_BVH_Element {
-	AABB aabb;
-	Vector3 center;
-	int face_index = 0;
-};
+// Binned SAH builder. Large meshes first get split into subtrees which are then built in parallel.
+struct _ConcaveBVHBuilder {
+	typedef GodotConcavePolygonShape3D::BVHNode Node;
+
+	static const int BIN_COUNT = 16;
+	static const int MAX_SAH_DEPTH = 48;
+	static const uint32_t PARALLEL_MIN_FACES = 1 << 15;
+	static const int PARALLEL_MAX_DEPTH = 5;
+
+	struct CenterCompare {
+		const Vector3 *centers = nullptr;
+		int axis = 0;
+
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			return centers[p_a][axis] < centers[p_b][axis];
+		}
+	};
+
+	struct Subtree {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		int depth = 0;
+		LocalVector<Node> nodes;
+	};
+
+	struct TopNode {
+		AABB aabb;
+		int left = -1;
+		int right = -1;
+		int subtree = -1;
+	};
 
-struct _Volume_BVH_CompareX {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.x < b.center.x;
+	const GodotConcavePolygonShape3D *shape = nullptr;
+	const AABB *face_aabbs = nullptr;
+	const Vector3 *face_centers = nullptr;
+	uint32_t *refs = nullptr;
+
+	LocalVector<Subtree> subtrees;
+	LocalVector<TopNode> top_nodes;
+
+	_FORCE_INLINE_ static real_t _get_half_area(const AABB &p_aabb) {
+		const Vector3 &size = p_aabb.size;
+		return size.x * size.y + size.y * size.z + size.z * size.x;
 	}
-};
 
-struct _Volume_BVH_CompareY {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.y < b.center.y;
+	void _get_bounds(uint32_t p_begin, uint32_t p_end, AABB &r_bounds, AABB &r_center_bounds) const {
+		r_bounds = face_aabbs[refs[p_begin]];
+		r_center_bounds = AABB(face_centers[refs[p_begin]], Vector3());
+		for (uint32_t i = p_begin + 1; i < p_end; i++) {
+			r_bounds.merge_with(face_aabbs[refs[i]]);
+			r_center_bounds.expand_to(face_centers[refs[i]]);
+		}
 	}
-};
 
-struct _Volume_BVH_CompareZ {
-	_FORCE_INLINE_ bool operator()(const _Volume_BVH_Element &a, const _Volume_BVH_Element &b) const {
-		return a.center.z < b.center.z;
+	uint32_t _split(uint32_t p_begin, uint32_t p_end, const AABB &p_center_bounds, int p_depth) {
+		int axis = p_center_bounds.get_longest_axis_index();
+		real_t extent = p_center_bounds.size[axis];
+		real_t origin = p_center_bounds.position[axis];
+
+		if (extent > CMP_EPSILON && p_depth < MAX_SAH_DEPTH) {
+			AABB bin_bounds[BIN_COUNT];
+			uint32_t bin_counts[BIN_COUNT] = {};
+			real_t bin_scale = BIN_COUNT / extent;
+
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				int bin = MIN(int((face_centers[refs[i]][axis] - origin) * bin_scale), BIN_COUNT - 1);
+				if (bin_counts[bin] == 0) {
+					bin_bounds[bin] = face_aabbs[refs[i]];
+				} else {
+					bin_bounds[bin].merge_with(face_aabbs[refs[i]]);
+				}
+				bin_counts[bin]++;
+			}
+
+			// Sweep from the right to know the cost of everything past each split plane.
+			real_t right_costs[BIN_COUNT] = {};
+			AABB right_bounds;
+			uint32_t right_count = 0;
+			for (int bin = BIN_COUNT - 1; bin > 0; bin--) {
+				if (bin_counts[bin] > 0) {
+					if (right_count == 0) {
+						right_bounds = bin_bounds[bin];
+					} else {
+						right_bounds.merge_with(bin_bounds[bin]);
+					}
+					right_count += bin_counts[bin];
+				}
+				right_costs[bin] = right_count > 0 ? _get_half_area(right_bounds) * right_count : 0.0;
+			}
+
+			int best_split = -1;
+			real_t best_cost = 0.0;
+			AABB left_bounds;
+			uint32_t left_count = 0;
+			uint32_t count = p_end - p_begin;
+			for (int bin = 0; bin < BIN_COUNT - 1; bin++) {
+				if (bin_counts[bin] > 0) {
+					if (left_count == 0) {
+						left_bounds = bin_bounds[bin];
+					} else {
+						left_bounds.merge_with(bin_bounds[bin]);
+					}
+					left_count += bin_counts[bin];
+				}
+				if (left_count == 0 || left_count == count) {
+					continue;
+				}
+				real_t cost = _get_half_area(left_bounds) * left_count + right_costs[bin + 1];
+				if (best_split < 0 || cost < best_cost) {
+					best_split = bin;
+					best_cost = cost;
+				}
+			}
+
+			if (best_split >= 0) {
+				// Partition the references around the chosen plane.
+				uint32_t mid = p_begin;
+				for (uint32_t i = p_begin; i < p_end; i++) {
+					int bin = MIN(int((face_centers[refs[i]][axis] - origin) * bin_scale), BIN_COUNT - 1);
+					if (bin <= best_split) {
+						SWAP(refs[i], refs[mid]);
+						mid++;
+					}
+				}
+				return mid;
+			}
+		}
+
+		// Degenerate or too deep, split in the middle.
+		uint32_t mid = p_begin + (p_end - p_begin) / 2;
+		if (extent > CMP_EPSILON) {
+			SortArray<uint32_t, CenterCompare> sorter;
+			sorter.compare.centers = face_centers;
+			sorter.compare.axis = axis;
+			sorter.nth_element(p_begin, p_end, mid, refs);
+		}
+		return mid;
 	}
-};
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
+	void _build(uint32_t p_begin, uint32_t p_end, int p_depth, LocalVector<Node> &r_nodes) {
+		AABB bounds;
+		AABB center_bounds;
+		_get_bounds(p_begin, p_end, bounds, center_bounds);
 
-	int face_index = 0;
-};
+		uint32_t index = r_nodes.size();
+		r_nodes.push_back(Node());
+		shape->_quantize_aabb(bounds, r_nodes[index].min, r_nodes[index].max);
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+		if (p_end - p_begin <= GodotConcavePolygonShape3D::BVH_MAX_LEAF_FACES) {
+			r_nodes[index].offset = p_begin;
+			r_nodes[index].face_count = p_end - p_begin;
+			return;
+		}
+
+		uint32_t mid = _split(p_begin, p_end, center_bounds, p_depth);
+		_build(p_begin, mid, p_depth + 1, r_nodes);
+		r_nodes[index].offset = r_nodes.size();
+		_build(mid, p_end, p_depth + 1, r_nodes);
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
+	int _build_top(uint32_t p_begin, uint32_t p_end, int p_depth) {
+		int index = top_nodes.size();
+		top_nodes.push_back(TopNode());
+
+		if (p_end - p_begin < PARALLEL_MIN_FACES || p_depth >= PARALLEL_MAX_DEPTH) {
+			Subtree subtree;
+			subtree.begin = p_begin;
+			subtree.end = p_end;
+			subtree.depth = p_depth;
+			top_nodes[index].subtree = subtrees.size();
+			subtrees.push_back(subtree);
+			return index;
 		}
+
+		AABB center_bounds;
+		_get_bounds(p_begin, p_end, top_nodes[index].aabb, center_bounds);
+
+		uint32_t mid = _split(p_begin, p_end, center_bounds, p_depth);
+		int left = _build_top(p_begin, mid, p_depth + 1);
+		int right = _build_top(mid, p_end, p_depth + 1);
+		top_nodes[index].left = left;
+		top_nodes[index].right = right;
+		return index;
 	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
-		case 0: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
 
-		} break;
-		case 1: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
-		} break;
-		case 2: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
-		} break;
+	void _build_subtree(uint32_t p_index, void *p_userdata) {
+		Subtree &subtree = subtrees[p_index];
+		_build(subtree.begin, subtree.end, subtree.depth, subtree.nodes);
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
+	void _emit(int p_top, LocalVector<Node> &r_nodes) {
+		const TopNode &top = top_nodes[p_top];
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
+		if (top.subtree >= 0) {
+			uint32_t base = r_nodes.size();
+			for (const Node &node : subtrees[top.subtree].nodes) {
+				r_nodes.push_back(node);
+				if (node.face_count == 0) {
+					r_nodes[r_nodes.size() - 1].offset += base;
+				}
+			}
+			return;
+		}
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+		uint32_t index = r_nodes.size();
+		r_nodes.push_back(Node());
+		shape->_quantize_aabb(top.aabb, r_nodes[index].min, r_nodes[index].max);
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+		_emit(top.left, r_nodes);
+		r_nodes[index].offset = r_nodes.size();
+		_emit(top.right, r_nodes);
+	}
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	void build(uint32_t p_count, LocalVector<Node> &r_nodes) {
+		if (p_count < PARALLEL_MIN_FACES) {
+			_build(0, p_count, 0, r_nodes);
+			return;
+		}
 
-	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
+		_build_top(0, p_count, 0);
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &_ConcaveBVHBuilder::_build_subtree, (void *)nullptr, subtrees.size(), -1, true, SNAME("GodotConcavePolygonShape3DBuildBVH"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-	} else {
-		p_bvh_array[p_idx].right = -1;
-	}
+		uint32_t node_count = top_nodes.size();
+		for (const Subtree &subtree : subtrees) {
+			node_count += subtree.nodes.size();
+		}
+		r_nodes.reserve(node_count);
 
-	memdelete(p_bvh_tree);
-}
+		_emit(0, r_nodes);
+	}
+};
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
+		faces.clear();
+		vertices.clear();
+		bvh.clear();
+		bvh_faces.clear();
 		configure(AABB());
 		return;
 	}
@@ -1620,10 +1820,10 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	const Vector3 *facesr = p_faces.ptr();
 
-	Vector<_Volume_BVH_Element> bvh_array;
-	bvh_array.resize(src_face_count);
-
-	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
+	LocalVector<AABB> face_aabbs;
+	face_aabbs.resize(src_face_count);
+	LocalVector<Vector3> face_centers;
+	face_centers.resize(src_face_count);
 
 	faces.resize(src_face_count);
 	Face *facesw = faces.ptrw();
@@ -1637,9 +1837,8 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	for (int i = 0; i < src_face_count; i++) {
 		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
 
-		bvh_arrayw[i].aabb = face.get_aabb();
-		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
-		bvh_arrayw[i].face_index = i;
+		face_aabbs[i] = face.get_aabb();
+		face_centers[i] = face_aabbs[i].get_center();
 		facesw[i].indices[0] = i * 3 + 0;
 		facesw[i].indices[1] = i * 3 + 1;
 		facesw[i].indices[2] = i * 3 + 2;
@@ -1648,21 +1847,32 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		verticesw[i * 3 + 1] = face.vertex[1];
 		verticesw[i * 3 + 2] = face.vertex[2];
 		if (i == 0) {
-			_aabb = bvh_arrayw[i].aabb;
+			_aabb = face_aabbs[i];
 		} else {
-			_aabb.merge_with(bvh_arrayw[i].aabb);
+			_aabb.merge_with(face_aabbs[i]);
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
+	bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		bool flat = _aabb.size[i] < CMP_EPSILON;
+		bvh_quantize_scale[i] = flat ? 0.0 : UINT16_MAX / _aabb.size[i];
+		bvh_dequantize_scale[i] = flat ? 0.0 : _aabb.size[i] / UINT16_MAX;
+	}
 
-	bvh.resize(count + 1);
+	bvh_faces.resize(src_face_count);
+	for (int i = 0; i < src_face_count; i++) {
+		bvh_faces[i] = i;
+	}
 
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	bvh.clear();
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	_ConcaveBVHBuilder builder;
+	builder.shape = this;
+	builder.face_aabbs = face_aabbs.ptr();
+	builder.face_centers = face_centers.ptr();
+	builder.refs = bvh_faces.ptr();
+	builder.build(src_face_count, bvh);
 
 	backface_collision = p_backface_collision;
 
@@ -1769,41 +1979,6 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
-
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
-
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
-	}
-
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
-}
-
 template <typename ProcessFunction>
 bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const {
 	Vector3 delta = (p_end - p_begin);
@@ -1945,6 +2120,64 @@ bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process,
 	return false;
 }
 
+bool GodotHeightMapShape3D::_intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_delta, Vector3 &r_point, Vector3 &r_normal) const {
+	const Range &range = _get_bounds_range(p_level, p_x, p_z);
+
+	// Bounds of the node in shape space.
+	// Chunks include the vertices they share with their neighbors, see _update_bounds_chunks().
+	int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	Vector3 node_min(p_x * node_size, range.min - CMP_EPSILON, p_z * node_size);
+	Vector3 node_max(MIN((p_x + 1) * node_size, width - 1), range.max + CMP_EPSILON, MIN((p_z + 1) * node_size, depth - 1));
+	node_min -= local_origin;
+	node_max -= local_origin;
+
+	// Clip the segment against the node.
+	real_t enter = 0.0;
+	real_t exit = 1.0;
+	for (int i = 0; i < 3; i++) {
+		if (Math::abs(p_delta[i]) < CMP_EPSILON) {
+			if ((p_begin[i] < node_min[i]) || (p_begin[i] > node_max[i])) {
+				return false;
+			}
+			continue;
+		}
+
+		real_t t0 = (node_min[i] - p_begin[i]) / p_delta[i];
+		real_t t1 = (node_max[i] - p_begin[i]) / p_delta[i];
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
+		enter = MAX(enter, t0);
+		exit = MIN(exit, t1);
+		if (enter > exit) {
+			return false;
+		}
+	}
+
+	if (p_level == 0) {
+		Vector3 enter_pos = p_begin + p_delta * enter;
+		Vector3 exit_pos = p_begin + p_delta * exit;
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// Visit children front to back, so the first hit is the closest one.
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	int flip_x = (p_delta.x < 0.0) ? 1 : 0;
+	int flip_z = (p_delta.z < 0.0) ? 1 : 0;
+	for (int i = 0; i < 4; i++) {
+		int child_x = (p_x << 1) + ((i & 1) ^ flip_x);
+		int child_z = (p_z << 1) + ((i >> 1) ^ flip_z);
+		if ((child_x >= child_level.width) || (child_z >= child_level.depth)) {
+			continue;
+		}
+		if (_intersect_bounds_segment(p_level - 1, child_x, child_z, p_begin, p_delta, r_point, r_normal)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
 	if (heights.is_empty()) {
 		return false;
@@ -1981,7 +2214,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_levels.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1991,11 +2224,8 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_grid_width, bounds_grid_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, descend the bounds quadtree from its root and only walk the cells of the chunks it may hit.
+			return _intersect_bounds_segment(bounds_levels.size() - 1, 0, 0, p_begin, p_end - p_begin, r_point, r_normal);
 		}
 	}
 
@@ -2053,26 +2283,73 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
+	if (bounds_levels.is_empty()) {
+		_cull_cells(start_x, end_x, start_z, end_z, p_callback, p_userdata, face);
+	} else {
+		real_t min_height = local_aabb.position.y;
+		real_t max_height = local_aabb.position.y + local_aabb.size.y;
+		_cull_bounds(bounds_levels.size() - 1, 0, 0, start_x, end_x, start_z, end_z, min_height, max_height, p_callback, p_userdata, face);
+	}
+}
+
+bool GodotHeightMapShape3D::_cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const {
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
 			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			_get_point(x, z, r_face.vertex[0]);
+			_get_point(x + 1, z, r_face.vertex[1]);
+			_get_point(x, z + 1, r_face.vertex[2]);
+			r_face.normal = Plane(r_face.vertex[0], r_face.vertex[1], r_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &r_face)) {
+				return true;
 			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			r_face.vertex[0] = r_face.vertex[1];
+			_get_point(x + 1, z + 1, r_face.vertex[1]);
+			r_face.normal = Plane(r_face.vertex[0], r_face.vertex[1], r_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &r_face)) {
+				return true;
 			}
 		}
 	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_cull_bounds(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, real_t p_min_height, real_t p_max_height, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const {
+	const Range &range = _get_bounds_range(p_level, p_x, p_z);
+	if ((range.max < p_min_height) || (range.min > p_max_height)) {
+		return false;
+	}
+
+	// Cells covered by the node, clipped to the queried ones.
+	int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = MAX(p_start_x, p_x * node_size);
+	int end_x = MIN(p_end_x, (p_x + 1) * node_size);
+	int start_z = MAX(p_start_z, p_z * node_size);
+	int end_z = MIN(p_end_z, (p_z + 1) * node_size);
+	if ((start_x >= end_x) || (start_z >= end_z)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _cull_cells(start_x, end_x, start_z, end_z, p_callback, p_userdata, r_face);
+	}
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int child_x = (p_x << 1) + (i & 1);
+		int child_z = (p_z << 1) + (i >> 1);
+		if ((child_x >= child_level.width) || (child_z >= child_level.depth)) {
+			continue;
+		}
+		if (_cull_bounds(p_level - 1, child_x, child_z, start_x, end_x, start_z, end_z, p_min_height, p_max_height, p_callback, p_userdata, r_face)) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2086,10 +2363,10 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 }
 
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+	bounds_levels.clear();
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
 		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
@@ -2106,13 +2383,50 @@ void GodotHeightMapShape3D::_build_accelerator() {
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
+	int level_width = bounds_grid_width;
+	int level_depth = bounds_grid_depth;
+	while (true) {
+		BoundsLevel level;
+		level.width = level_width;
+		level.depth = level_depth;
+		level.ranges.resize(level_width * level_depth);
+		bounds_levels.push_back(level);
+
+		if ((level_width == 1) && (level_depth == 1)) {
+			break;
+		}
+		level_width = (level_width + 1) / 2;
+		level_depth = (level_depth + 1) / 2;
+	}
+
+	_update_bounds_chunks(0, 0, bounds_grid_width - 1, bounds_grid_depth - 1);
+	_update_bounds_levels(0, 0, bounds_grid_width - 1, bounds_grid_depth - 1);
+}
+
+void GodotHeightMapShape3D::_update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	if (bounds_levels.is_empty()) {
+		return;
+	}
+
+	// Chunks share their border vertices with the previous ones.
+	const BoundsLevel &chunks = bounds_levels[0];
+	int from_x = MAX(p_from_x - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int from_z = MAX(p_from_z - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int to_x = MIN(p_to_x / BOUNDS_CHUNK_SIZE, chunks.width - 1);
+	int to_z = MIN(p_to_z / BOUNDS_CHUNK_SIZE, chunks.depth - 1);
+
+	_update_bounds_chunks(from_x, from_z, to_x, to_z);
+	_update_bounds_levels(from_x, from_z, to_x, to_z);
+}
+
+void GodotHeightMapShape3D::_update_bounds_chunks(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	BoundsLevel &chunks = bounds_levels[0];
 
-	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+	// Compute min and max height for the chunks.
+	for (int cz = p_from_z; cz <= p_to_z; ++cz) {
 		int z0 = cz * BOUNDS_CHUNK_SIZE;
 
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		for (int cx = p_from_x; cx <= p_to_x; ++cx) {
 			int x0 = cx * BOUNDS_CHUNK_SIZE;
 
 			Range r;
@@ -2149,12 +2463,82 @@ void GodotHeightMapShape3D::_build_accelerator() {
 				}
 			}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+			chunks.ranges[cx + cz * chunks.width] = r;
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_update_bounds_levels(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	int from_x = p_from_x;
+	int from_z = p_from_z;
+	int to_x = p_to_x;
+	int to_z = p_to_z;
+
+	for (uint32_t l = 1; l < bounds_levels.size(); l++) {
+		const BoundsLevel &children = bounds_levels[l - 1];
+		BoundsLevel &level = bounds_levels[l];
+
+		from_x >>= 1;
+		from_z >>= 1;
+		to_x >>= 1;
+		to_z >>= 1;
+
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				Range r = children.ranges[(z << 1) * children.width + (x << 1)];
+				for (int i = 1; i < 4; i++) {
+					int child_x = (x << 1) + (i & 1);
+					int child_z = (z << 1) + (i >> 1);
+					if ((child_x >= children.width) || (child_z >= children.depth)) {
+						continue;
+					}
+					const Range &child = children.ranges[child_z * children.width + child_x];
+					r.min = MIN(r.min, child.min);
+					r.max = MAX(r.max, child.max);
+				}
+				level.ranges[z * level.width + x] = r;
+			}
 		}
 	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
+	// When only the heights change, find the area which was modified so the
+	// accelerator can be refreshed there instead of being rebuilt.
+	bool update_accelerator = !bounds_levels.is_empty() && (p_width == width) && (p_depth == depth) && (p_heights.size() == heights.size());
+	int dirty_from_x = p_width;
+	int dirty_from_z = p_depth;
+	int dirty_to_x = -1;
+	int dirty_to_z = -1;
+	if (update_accelerator && (p_heights.ptr() != heights.ptr())) {
+		const real_t *old_heights = heights.ptr();
+		const real_t *new_heights = p_heights.ptr();
+		for (int z = 0; z < p_depth; z++) {
+			const real_t *old_row = old_heights + z * p_width;
+			const real_t *new_row = new_heights + z * p_width;
+			if (memcmp(old_row, new_row, sizeof(real_t) * p_width) == 0) {
+				continue;
+			}
+
+			int first = 0;
+			while ((first < p_width) && (old_row[first] == new_row[first])) {
+				first++;
+			}
+			if (first == p_width) {
+				continue; // Only differs by the sign of zeros.
+			}
+			int last = p_width - 1;
+			while (old_row[last] == new_row[last]) {
+				last--;
+			}
+
+			dirty_from_x = MIN(dirty_from_x, first);
+			dirty_to_x = MAX(dirty_to_x, last);
+			dirty_from_z = MIN(dirty_from_z, z);
+			dirty_to_z = z;
+		}
+	}
+
 	heights = p_heights;
 	width = p_width;
 	depth = p_depth;
@@ -2170,7 +2554,11 @@ void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width,
 
 	aabb_new.position -= local_origin;
 
-	_build_accelerator();
+	if (!update_accelerator) {
+		_build_accelerator();
+	} else if (dirty_to_z >= 0) {
+		_update_accelerator(dirty_from_x, dirty_from_z, dirty_to_x, dirty_to_z);
+	}
 
 	configure(aabb_new);
 }
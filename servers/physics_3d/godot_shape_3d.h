@@ -302,7 +302,6 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -316,48 +315,37 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
-	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
-	};
-
-	Vector<BVH> bvh;
-
-	struct _CullParams {
-		AABB aabb;
-		QueryCallback callback = nullptr;
-		void *userdata = nullptr;
-		const Face *faces = nullptr;
-		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
-		GodotFaceShape3D *face = nullptr;
+	struct BVHNode {
+		// Bounds quantized against the shape AABB, rounded outwards.
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Index of the right child for internal nodes (the left one directly follows its parent),
+		// index of the first face in bvh_faces for leaves.
+		uint32_t offset = 0;
+		uint32_t face_count = 0; // Zero for internal nodes.
 	};
 
-	struct _SegmentCullParams {
-		Vector3 from;
-		Vector3 to;
-		Vector3 dir;
-		const Face *faces = nullptr;
-		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
-		GodotFaceShape3D *face = nullptr;
+	static const uint32_t BVH_MAX_LEAF_FACES = 4;
+	static const int BVH_STACK_SIZE = 128;
+	static const int CULL_BATCH_SIZE = 64;
 
-		Vector3 result;
-		Vector3 normal;
-		int face_index = -1;
-		real_t min_d = 1e20;
-		int collisions = 0;
-	};
+	LocalVector<BVHNode> bvh;
+	LocalVector<uint32_t> bvh_faces;
+	Vector3 bvh_origin;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	void _quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	_FORCE_INLINE_ AABB _get_node_aabb(const BVHNode &p_node) const {
+		Vector3 from(p_node.min[0], p_node.min[1], p_node.min[2]);
+		Vector3 to(p_node.max[0], p_node.max[1], p_node.max[2]);
+		return AABB(bvh_origin + from * bvh_dequantize_scale, (to - from) * bvh_dequantize_scale);
+	}
+
+	bool _cull_faces(const uint32_t *p_faces, int p_count, const AABB &p_aabb, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const;
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -394,14 +382,21 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
+
+	// Min/max quadtree. Level 0 holds the height range of each chunk, every
+	// following level merges 2x2 nodes of the previous one, up to a single root.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_levels;
 
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
-	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
+	_FORCE_INLINE_ const Range &_get_bounds_range(int p_level, int p_x, int p_z) const {
+		const BoundsLevel &level = bounds_levels[p_level];
+		return level.ranges[(p_z * level.width) + p_x];
 	}
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
@@ -417,9 +412,16 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
 	void _build_accelerator();
+	void _update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
+	void _update_bounds_chunks(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
+	void _update_bounds_levels(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_delta, Vector3 &r_point, Vector3 &r_normal) const;
+
+	bool _cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const;
+	bool _cull_bounds(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, real_t p_min_height, real_t p_max_height, QueryCallback p_callback, void *p_userdata, GodotFaceShape3D &r_face) const;
 
 	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
 
@@ -33,9 +33,14 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
+#define SOFT_BODY_PARALLEL_MIN_NODES 1024
+#define SOFT_BODY_PARALLEL_CHUNK_SIZE 256
+#define SOFT_BODY_MAX_LINK_BATCHES 64
+
 // Based on Bullet soft body.
 
 /*
@@ -157,12 +162,33 @@ void GodotSoftBody3D::update_rendering_server(PhysicsServer3DRenderingServerHand
 	}
 
 	const uint32_t vertex_count = map_visual_to_physics.size();
-	for (uint32_t i = 0; i < vertex_count; ++i) {
-		const uint32_t node_index = map_visual_to_physics[i];
-		const Node &node = nodes[node_index];
 
-		p_rendering_server_handler->set_vertex(i, node.x);
-		p_rendering_server_handler->set_normal(i, node.n);
+	uint8_t *buffer = nullptr;
+	uint32_t vertex_stride = 0;
+	uint32_t vertex_offset = 0;
+	uint32_t normal_stride = 0;
+	uint32_t normal_offset = 0;
+	if (p_rendering_server_handler->get_vertex_buffer(buffer, vertex_stride, vertex_offset, normal_stride, normal_offset)) {
+		// Write straight into the buffer which is sent to the rendering server.
+		for (uint32_t i = 0; i < vertex_count; ++i) {
+			const Node &node = nodes[map_visual_to_physics[i]];
+
+			float *vertex = reinterpret_cast<float *>(buffer + i * vertex_stride + vertex_offset);
+			vertex[0] = (float)node.x.x;
+			vertex[1] = (float)node.x.y;
+			vertex[2] = (float)node.x.z;
+
+			uint32_t normal = PhysicsServer3DRenderingServerHandler::encode_normal(node.n);
+			memcpy(buffer + i * normal_stride + normal_offset, &normal, sizeof(uint32_t));
+		}
+	} else {
+		for (uint32_t i = 0; i < vertex_count; ++i) {
+			const uint32_t node_index = map_visual_to_physics[i];
+			const Node &node = nodes[node_index];
+
+			p_rendering_server_handler->set_vertex(i, node.x);
+			p_rendering_server_handler->set_normal(i, node.n);
+		}
 	}
 
 	p_rendering_server_handler->set_aabb(bounds);
@@ -191,17 +217,13 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
-void GodotSoftBody3D::update_bounds() {
+bool GodotSoftBody3D::compute_bounds() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
 	bounds = AABB();
 
 	const uint32_t nodes_count = nodes.size();
-	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
-	}
 
 	bool first = true;
 	bool moved = false;
@@ -218,11 +240,24 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
+	return moved;
+}
+
+void GodotSoftBody3D::apply_bounds(bool p_moved) {
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+		return;
+	}
+
 	if (get_space()) {
-		initialize_shape(moved);
+		initialize_shape(p_moved);
 	}
 }
 
+void GodotSoftBody3D::update_bounds() {
+	apply_bounds(compute_bounds());
+}
+
 void GodotSoftBody3D::update_constants() {
 	reset_link_rest_lengths();
 	update_link_constants();
@@ -582,6 +617,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	build_link_batches();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -826,6 +862,63 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::build_link_batches() {
+	link_batch_offsets.clear();
+	last_link_batch_serial = false;
+
+	const uint32_t link_count = links.size();
+	if (link_count == 0) {
+		return;
+	}
+
+	// Greedy coloring: each link takes the first batch which none of its nodes is part of yet.
+	LocalVector<uint64_t> node_batches;
+	node_batches.resize(nodes.size());
+	memset(node_batches.ptr(), 0, node_batches.size() * sizeof(uint64_t));
+
+	LocalVector<uint32_t> link_batches;
+	link_batches.resize(link_count);
+	uint32_t batch_sizes[SOFT_BODY_MAX_LINK_BATCHES + 1] = {};
+
+	for (uint32_t i = 0; i < link_count; i++) {
+		const uint32_t node_a = links[i].n[0] - nodes.ptr();
+		const uint32_t node_b = links[i].n[1] - nodes.ptr();
+		const uint64_t used = node_batches[node_a] | node_batches[node_b];
+
+		uint32_t batch = 0;
+		while (batch < SOFT_BODY_MAX_LINK_BATCHES && (used & ((uint64_t)1 << batch))) {
+			batch++;
+		}
+		if (batch < SOFT_BODY_MAX_LINK_BATCHES) {
+			node_batches[node_a] |= (uint64_t)1 << batch;
+			node_batches[node_b] |= (uint64_t)1 << batch;
+		}
+
+		link_batches[i] = batch;
+		batch_sizes[batch]++;
+	}
+
+	// Stable sort by batch, so links keep the order given by reoptimize_link_order() within a batch.
+	uint32_t batch_starts[SOFT_BODY_MAX_LINK_BATCHES + 1];
+	uint32_t offset = 0;
+	for (uint32_t batch = 0; batch <= SOFT_BODY_MAX_LINK_BATCHES; batch++) {
+		batch_starts[batch] = offset;
+		if (batch_sizes[batch] > 0) {
+			link_batch_offsets.push_back(offset);
+		}
+		offset += batch_sizes[batch];
+	}
+	link_batch_offsets.push_back(link_count);
+	last_link_batch_serial = batch_sizes[SOFT_BODY_MAX_LINK_BATCHES] > 0;
+
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	for (uint32_t i = 0; i < link_count; i++) {
+		sorted_links[batch_starts[link_batches[i]]++] = links[i];
+	}
+	links = sorted_links;
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -969,7 +1062,7 @@ Vector3 GodotSoftBody3D::_compute_area_windforce(const GodotArea3D *p_area, cons
 	return nodal_force_magnitude * p_face->normal;
 }
 
-void GodotSoftBody3D::predict_motion(real_t p_delta) {
+void GodotSoftBody3D::predict_motion(real_t p_delta, bool p_parallel) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	ERR_FAIL_NULL(get_space());
@@ -1033,20 +1126,18 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	const real_t max_displacement = 1000.0;
 	real_t clamp_delta_v = max_displacement * inv_delta;
 
+	p_parallel = p_parallel && nodes.size() >= SOFT_BODY_PARALLEL_MIN_NODES;
+
 	// Integrate.
-	for (Node &node : nodes) {
-		node.q = node.x;
-		Vector3 delta_v = node.f * node.im * p_delta;
-		for (int c = 0; c < 3; c++) {
-			delta_v[c] = CLAMP(delta_v[c], -clamp_delta_v, clamp_delta_v);
-		}
-		node.v += delta_v;
-		node.x += node.v * p_delta;
-		node.f = Vector3();
-	}
+	RangeTask integrate;
+	integrate.type = RangeTask::INTEGRATE_NODES;
+	integrate.end = nodes.size();
+	integrate.delta = p_delta;
+	integrate.factor = clamp_delta_v;
+	_run_range_task(integrate, p_parallel);
 
-	// Bounds and tree update.
-	update_bounds();
+	// Bounds update, the shape follows in predict_motion_commit().
+	pending_bounds_moved = compute_bounds();
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1054,8 +1145,9 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node_aabb.expand_to(node.x + node.v * p_delta);
 		node_aabb.grow_by(collision_margin);
 
-		node_tree.update(node.leaf, node_aabb);
+		node_tree.refit(node.leaf, node_aabb);
 	}
+	node_tree.finish_refit();
 
 	// Face tree update.
 	if (!face_tree.is_empty()) {
@@ -1067,51 +1159,134 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::predict_motion_commit() {
+	apply_bounds(pending_bounds_moved);
+	pending_bounds_moved = false;
+}
+
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_parallel) {
 	const real_t inv_delta = 1.0 / p_delta;
 
-	for (Link &link : links) {
-		link.c3 = link.n[1]->q - link.n[0]->q;
-		link.c2 = 1 / (link.c3.length_squared() * link.c0);
-	}
+	p_parallel = p_parallel && nodes.size() >= SOFT_BODY_PARALLEL_MIN_NODES;
+
+	RangeTask prepare_links;
+	prepare_links.type = RangeTask::PREPARE_LINKS;
+	prepare_links.end = links.size();
+	_run_range_task(prepare_links, p_parallel);
 
 	// Solve velocities.
-	for (Node &node : nodes) {
-		node.x = node.q + node.v * p_delta;
-	}
+	RangeTask predict_nodes;
+	predict_nodes.type = RangeTask::PREDICT_NODES;
+	predict_nodes.end = nodes.size();
+	predict_nodes.delta = p_delta;
+	_run_range_task(predict_nodes, p_parallel);
 
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
 		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, ti, p_parallel);
 	}
-	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
-	for (Node &node : nodes) {
-		node.x += node.bv * p_delta;
-		node.bv = Vector3();
 
-		node.v = (node.x - node.q) * vc;
-
-		node.q = node.x;
-	}
+	RangeTask update_nodes;
+	update_nodes.type = RangeTask::UPDATE_NODES;
+	update_nodes.end = nodes.size();
+	update_nodes.delta = p_delta;
+	update_nodes.factor = (1.0 - damping_coefficient) * inv_delta;
+	_run_range_task(update_nodes, p_parallel);
 
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
-			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
+void GodotSoftBody3D::solve_links(real_t kst, real_t ti, bool p_parallel) {
+	RangeTask solve;
+	solve.type = RangeTask::SOLVE_LINKS;
+	solve.factor = kst;
+
+	for (uint32_t batch = 0; batch + 1 < link_batch_offsets.size(); batch++) {
+		solve.begin = link_batch_offsets[batch];
+		solve.end = link_batch_offsets[batch + 1];
+
+		const bool serial_batch = last_link_batch_serial && batch + 2 == link_batch_offsets.size();
+		_run_range_task(solve, p_parallel && !serial_batch);
+	}
+}
+
+void GodotSoftBody3D::_process_range(uint32_t p_begin, uint32_t p_end, const RangeTask &p_task) {
+	switch (p_task.type) {
+		case RangeTask::INTEGRATE_NODES: {
+			const real_t clamp_delta_v = p_task.factor;
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Node &node = nodes[i];
+				node.q = node.x;
+				Vector3 delta_v = node.f * node.im * p_task.delta;
+				for (int c = 0; c < 3; c++) {
+					delta_v[c] = CLAMP(delta_v[c], -clamp_delta_v, clamp_delta_v);
+				}
+				node.v += delta_v;
+				node.x += node.v * p_task.delta;
+				node.f = Vector3();
 			}
-		}
+		} break;
+		case RangeTask::PREDICT_NODES: {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Node &node = nodes[i];
+				node.x = node.q + node.v * p_task.delta;
+			}
+		} break;
+		case RangeTask::PREPARE_LINKS: {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Link &link = links[i];
+				link.c3 = link.n[1]->q - link.n[0]->q;
+				link.c2 = 1 / (link.c3.length_squared() * link.c0);
+			}
+		} break;
+		case RangeTask::SOLVE_LINKS: {
+			const real_t kst = p_task.factor;
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Link &link = links[i];
+				if (link.c0 > 0) {
+					Node &node_a = *link.n[0];
+					Node &node_b = *link.n[1];
+					const Vector3 del = node_b.x - node_a.x;
+					const real_t len = del.length_squared();
+					if (link.c1 + len > CMP_EPSILON) {
+						const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
+						node_a.x -= del * (k * node_a.im);
+						node_b.x += del * (k * node_b.im);
+					}
+				}
+			}
+		} break;
+		case RangeTask::UPDATE_NODES: {
+			const real_t vc = p_task.factor;
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				Node &node = nodes[i];
+				node.x += node.bv * p_task.delta;
+				node.bv = Vector3();
+
+				node.v = (node.x - node.q) * vc;
+
+				node.q = node.x;
+			}
+		} break;
+	}
+}
+
+void GodotSoftBody3D::_process_range_chunk(uint32_t p_chunk, const RangeTask *p_task) {
+	const uint32_t begin = p_task->begin + p_chunk * SOFT_BODY_PARALLEL_CHUNK_SIZE;
+	const uint32_t end = MIN(begin + SOFT_BODY_PARALLEL_CHUNK_SIZE, p_task->end);
+	_process_range(begin, end, *p_task);
+}
+
+void GodotSoftBody3D::_run_range_task(const RangeTask &p_task, bool p_parallel) {
+	const uint32_t chunk_count = (p_task.end - p_task.begin + SOFT_BODY_PARALLEL_CHUNK_SIZE - 1) / SOFT_BODY_PARALLEL_CHUNK_SIZE;
+	if (!p_parallel || chunk_count < 2) {
+		_process_range(p_task.begin, p_task.end, p_task);
+		return;
 	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_process_range_chunk, &p_task, chunk_count, -1, true, SNAME("GodotSoftBody3DSolve"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 }
 
 struct AABBQueryResult {
@@ -1189,8 +1364,9 @@ void GodotSoftBody3D::update_face_tree(real_t p_delta) {
 
 		face_aabb.grow_by(collision_margin);
 
-		face_tree.update(face.leaf, face_aabb);
+		face_tree.refit(face.leaf, face_aabb);
 	}
+	face_tree.finish_refit();
 }
 
 void GodotSoftBody3D::initialize_shape(bool p_force_move) {
@@ -1223,6 +1399,9 @@ void GodotSoftBody3D::destroy() {
 	links.clear();
 	faces.clear();
 
+	link_batch_offsets.clear();
+	last_link_batch_serial = false;
+
 	bounds = AABB();
 	deinitialize_shape();
 }
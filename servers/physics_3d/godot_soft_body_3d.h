@@ -82,6 +82,28 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Links are sorted in batches which don't share any node, so each batch can be solved in parallel.
+	// Links which didn't fit in any batch end up in a last batch which is always solved serially.
+	LocalVector<uint32_t> link_batch_offsets;
+	bool last_link_batch_serial = false;
+
+	// Ranges of nodes or links which can be processed in chunks on several threads.
+	struct RangeTask {
+		enum Type {
+			INTEGRATE_NODES,
+			PREDICT_NODES,
+			PREPARE_LINKS,
+			SOLVE_LINKS,
+			UPDATE_NODES,
+		};
+
+		Type type = INTEGRATE_NODES;
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		real_t delta = 0.0;
+		real_t factor = 0.0;
+	};
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -111,8 +133,14 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 
 	uint64_t island_step = 0;
 
+	bool pending_bounds_moved = false;
+
 	_FORCE_INLINE_ Vector3 _compute_area_windforce(const GodotArea3D *p_area, const Face *p_face);
 
+	void _process_range(uint32_t p_begin, uint32_t p_end, const RangeTask &p_task);
+	void _process_range_chunk(uint32_t p_chunk, const RangeTask *p_task);
+	void _run_range_task(const RangeTask &p_task, bool p_parallel);
+
 public:
 	GodotSoftBody3D();
 
@@ -201,8 +229,12 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
-	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	// With p_parallel, large soft bodies spread their nodes and links over the WorkerThreadPool.
+	// Only use it when the soft bodies aren't already processed in parallel.
+	void predict_motion(real_t p_delta, bool p_parallel = false);
+	// Applies the new bounds to the broadphase, which can't be done from several soft bodies at once.
+	void predict_motion_commit();
+	void solve_constraints(real_t p_delta, bool p_parallel = false);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -219,6 +251,8 @@ protected:
 
 private:
 	void update_normals_and_centroids();
+	bool compute_bounds();
+	void apply_bounds(bool p_moved);
 	void update_bounds();
 	void update_constants();
 	void update_area();
@@ -234,10 +268,11 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void build_link_batches();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	void solve_links(real_t kst, real_t ti, bool p_parallel);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
@@ -135,6 +135,38 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 
 	int current_priority = 1;
 
+	if (batched_contacts) {
+		GodotContactSolver3D &contact_solver = contact_solvers[p_island_index];
+		contact_solver.setup(constraint_island, delta);
+
+		if (!contact_solver.is_empty()) {
+			// The contacts are solved first on each iteration, then the remaining constraints see their result.
+			uint32_t constraint_count = constraint_island.size();
+			for (int i = 0; i < iterations; i++) {
+				contact_solver.solve();
+				if (constraint_count > 0) {
+					contact_solver.store_bodies();
+					for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+						constraint_island[constraint_index]->solve(delta);
+					}
+					contact_solver.load_bodies();
+				}
+			}
+			contact_solver.finish();
+
+			// Continue with the higher priority constraints only, like below.
+			uint32_t priority_constraint_count = 0;
+			++current_priority;
+			for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+				GodotConstraint3D *constraint = constraint_island[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					constraint_island[priority_constraint_count++] = constraint;
+				}
+			}
+			constraint_island.resize(priority_constraint_count);
+		}
+	}
+
 	uint32_t constraint_count = constraint_island.size();
 	while (constraint_count > 0) {
 		for (int i = 0; i < iterations; i++) {
@@ -182,6 +214,29 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_fill_active_bodies(const SelfList<GodotBody3D>::List *p_body_list) {
+	active_bodies.clear();
+	for (const SelfList<GodotBody3D> *b = p_body_list->first(); b; b = b->next()) {
+		active_bodies.push_back(b->self());
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces_threaded(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities_threaded(delta);
+}
+
+void GodotStep3D::_predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->predict_motion(delta);
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -201,22 +256,35 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	_fill_active_bodies(body_list);
+	int active_count = active_bodies.size();
 
-	const SelfList<GodotBody3D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Broadphase updates are applied in list order, so pairs are always created in the same order.
+	for (GodotBody3D *body : active_bodies) {
+		body->integrate_forces_commit();
 	}
 
 	/* UPDATE SOFT BODY MOTION */
 
-	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->predict_motion(p_delta);
-		sb = sb->next();
-		active_count++;
+	active_soft_bodies.clear();
+	for (const SelfList<GodotSoftBody3D> *sb = soft_body_list->first(); sb; sb = sb->next()) {
+		active_soft_bodies.push_back(sb->self());
+	}
+	active_count += active_soft_bodies.size();
+
+	// A single soft body splits its own work across threads, several soft bodies are processed one per thread.
+	if (active_soft_bodies.size() == 1) {
+		active_soft_bodies[0]->predict_motion(p_delta, true);
+	} else if (active_soft_bodies.size() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_predict_soft_body_motion, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	for (GodotSoftBody3D *soft_body : active_soft_bodies) {
+		soft_body->predict_motion_commit();
 	}
 
 	p_space->set_active_objects(active_count);
@@ -260,7 +328,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<GodotBody3D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -299,7 +367,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE SOFT BODIES */
 
-	sb = soft_body_list->first();
+	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
 		GodotSoftBody3D *soft_body = sb->self();
 
@@ -344,7 +412,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -364,6 +432,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
+	batched_contacts = p_space->is_using_batched_contact_solver();
+	if (batched_contacts && contact_solvers.size() < island_count) {
+		contact_solvers.resize(island_count);
+	}
+
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
@@ -375,11 +448,14 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+	// Bodies may have been woken up by the constraints.
+	_fill_active_bodies(body_list);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (GodotBody3D *body : active_bodies) {
+		body->integrate_velocities_commit();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -390,10 +466,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
+	if (active_soft_bodies.size() == 1) {
+		active_soft_bodies[0]->solve_constraints(p_delta, true);
+	} else if (active_soft_bodies.size() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
 
 	{ //profile
@@ -276,6 +276,11 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Rollback support: snapshot of the simulation state of a space, and stepping of a single space.
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual void space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+	virtual void space_step(RID p_space, real_t p_step) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -30,6 +30,7 @@
 
 #include "physics_server_2d_wrap_mt.h"
 
+#include "core/debugger/timeline_profiler.h"
 #include "core/os/os.h"
 
 void PhysicsServer2DWrapMT::_assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id) {
@@ -42,6 +43,8 @@ void PhysicsServer2DWrapMT::_thread_exit() {
 }
 
 void PhysicsServer2DWrapMT::_thread_loop() {
+	TimelineProfiler::set_thread_name("Physics 2D");
+
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
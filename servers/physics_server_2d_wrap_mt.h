@@ -123,6 +123,10 @@ public:
 		return physics_server_2d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(PackedByteArray, space_save_state, RID);
+	FUNC2(space_restore_state, RID, const PackedByteArray &);
+	FUNC2(space_step, RID, real_t);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
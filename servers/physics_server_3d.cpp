@@ -46,6 +46,14 @@ void PhysicsServer3DRenderingServerHandler::set_aabb(const AABB &p_aabb) {
 	GDVIRTUAL_REQUIRED_CALL(_set_aabb, p_aabb);
 }
 
+uint32_t PhysicsServer3DRenderingServerHandler::encode_normal(const Vector3 &p_normal) {
+	Vector2 res = p_normal.octahedron_encode();
+	uint32_t value = 0;
+	value |= (uint16_t)CLAMP(res.x * 65535, 0, 65535);
+	value |= (uint16_t)CLAMP(res.y * 65535, 0, 65535) << 16;
+	return value;
+}
+
 void PhysicsServer3DRenderingServerHandler::_bind_methods() {
 	GDVIRTUAL_BIND(_set_vertex, "vertex_id", "vertex");
 	GDVIRTUAL_BIND(_set_normal, "vertex_id", "normal");
@@ -437,6 +445,102 @@ Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion(const Ref<PhysicsShapeQue
 	return ret;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_from.size() != p_to.size(), Dictionary());
+
+	int count = p_from.size();
+	Vector<RayResult> results;
+	results.resize(count);
+	Vector<bool> hits;
+	hits.resize(count);
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptrw(), hits.ptrw());
+
+	PackedByteArray collided;
+	collided.resize(count);
+	PackedVector3Array position;
+	position.resize(count);
+	PackedVector3Array normal;
+	normal.resize(count);
+	PackedInt64Array collider_id;
+	collider_id.resize(count);
+	PackedInt32Array shape;
+	shape.resize(count);
+	PackedInt32Array face_index;
+	face_index.resize(count);
+
+	for (int i = 0; i < count; i++) {
+		const RayResult &result = results[i];
+		bool hit = hits[i];
+		collided.write[i] = hit;
+		position.write[i] = hit ? result.position : Vector3();
+		normal.write[i] = hit ? result.normal : Vector3();
+		collider_id.write[i] = hit ? int64_t(result.collider_id) : 0;
+		shape.write[i] = hit ? result.shape : 0;
+		face_index.write[i] = hit ? result.face_index : -1;
+	}
+
+	Dictionary d;
+	d["collided"] = collided;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["face_index"] = face_index;
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
+	ERR_FAIL_COND_V(p_origins.size() != p_motions.size(), Vector<real_t>());
+
+	const ShapeParameters &parameters = p_shape_query->get_parameters();
+	int count = p_origins.size();
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms.write[i] = Transform3D(parameters.transform.basis, p_origins[i]);
+	}
+
+	Vector<real_t> closest_safe;
+	closest_safe.resize(count);
+	Vector<real_t> closest_unsafe;
+	closest_unsafe.resize(count);
+	cast_motions(parameters, transforms.ptr(), p_motions.ptr(), count, closest_safe.ptrw(), closest_unsafe.ptrw());
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *w = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		w[i * 2 + 0] = closest_safe[i];
+		w[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		parameters.motion = p_motions[i];
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+		if (!cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i])) {
+			r_closest_safe[i] = 1.0;
+			r_closest_unsafe[i] = 1.0;
+		}
+	}
+}
+
 TypedArray<Vector3> PhysicsDirectSpaceState3D::_collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), TypedArray<Vector3>());
 
@@ -484,6 +588,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
+	ClassDB::bind_method(D_METHOD("intersect_ray_batch", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_ray_batch);
+	ClassDB::bind_method(D_METHOD("cast_motion_batch", "parameters", "origins", "motions"), &PhysicsDirectSpaceState3D::_cast_motion_batch);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
 }
@@ -662,6 +768,78 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+Vector<Transform3D> PhysicsServer3D::bodies_get_transform(const Vector<RID> &p_bodies) const {
+	Vector<Transform3D> transforms;
+	transforms.resize(p_bodies.size());
+	Transform3D *w = transforms.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		w[i] = body_get_state(p_bodies[i], BODY_STATE_TRANSFORM);
+	}
+	return transforms;
+}
+
+PackedFloat32Array PhysicsServer3D::_bodies_get_transform_bind(const TypedArray<RID> &p_bodies) const {
+	Vector<RID> bodies;
+	bodies.resize(p_bodies.size());
+	RID *bodies_w = bodies.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		bodies_w[i] = p_bodies[i];
+	}
+
+	const Vector<Transform3D> transforms = bodies_get_transform(bodies);
+
+	// Same layout as the transforms of a MultiMesh buffer: each basis row, followed by the matching origin component.
+	PackedFloat32Array ret;
+	ret.resize(transforms.size() * 12);
+	float *w = ret.ptrw();
+	for (const Transform3D &transform : transforms) {
+		for (int row = 0; row < 3; row++) {
+			w[0] = transform.basis.rows[row].x;
+			w[1] = transform.basis.rows[row].y;
+			w[2] = transform.basis.rows[row].z;
+			w[3] = transform.origin[row];
+			w += 4;
+		}
+	}
+	return ret;
+}
+
+void PhysicsServer3D::_body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results) {
+	ERR_FAIL_COND_MSG(p_bodies.size() != p_parameters.size() || p_bodies.size() != p_results.size(), "The bodies, parameters and results arrays must have the same size.");
+
+	int count = p_bodies.size();
+	Vector<RID> bodies;
+	Vector<MotionParameters> parameters;
+	Vector<MotionResult> results;
+	Vector<uint8_t> collided;
+	bodies.resize(count);
+	parameters.resize(count);
+	results.resize(count);
+	collided.resize(count);
+
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsTestMotionParameters3D> body_parameters = p_parameters[i];
+		ERR_FAIL_COND(body_parameters.is_null());
+		Ref<PhysicsTestMotionResult3D> body_result = p_results[i];
+		ERR_FAIL_COND(body_result.is_null());
+		bodies.write[i] = p_bodies[i];
+		parameters.write[i] = body_parameters->get_parameters();
+	}
+
+	body_test_motions(bodies.ptr(), parameters.ptr(), count, results.ptrw(), (bool *)collided.ptrw());
+
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsTestMotionResult3D> body_result = p_results[i];
+		*body_result->get_result_ptr() = results[i];
+	}
+}
+
+void PhysicsServer3D::body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) {
+	for (int i = 0; i < p_count; i++) {
+		r_collided[i] = body_test_motion(p_bodies[i], p_parameters[i], &r_results[i]);
+	}
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -716,6 +894,9 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
+	ClassDB::bind_method(D_METHOD("space_step", "space", "step"), &PhysicsServer3D::space_step);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -796,6 +977,7 @@ void PhysicsServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("body_set_state", "body", "state", "value"), &PhysicsServer3D::body_set_state);
 	ClassDB::bind_method(D_METHOD("body_get_state", "body", "state"), &PhysicsServer3D::body_get_state);
+	ClassDB::bind_method(D_METHOD("bodies_get_transform", "bodies"), &PhysicsServer3D::_bodies_get_transform_bind);
 
 	ClassDB::bind_method(D_METHOD("body_apply_central_impulse", "body", "impulse"), &PhysicsServer3D::body_apply_central_impulse);
 	ClassDB::bind_method(D_METHOD("body_apply_impulse", "body", "impulse", "position"), &PhysicsServer3D::body_apply_impulse, Vector3());
@@ -836,6 +1018,7 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("body_set_ray_pickable", "body", "enable"), &PhysicsServer3D::body_set_ray_pickable);
 
 	ClassDB::bind_method(D_METHOD("body_test_motion", "body", "parameters", "result"), &PhysicsServer3D::_body_test_motion, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("body_test_motion_batch", "bodies", "parameters", "results"), &PhysicsServer3D::_body_test_motion_batch);
 
 	ClassDB::bind_method(D_METHOD("body_get_direct_state", "body"), &PhysicsServer3D::body_get_direct_state);
 
@@ -1135,6 +1318,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF("physics/3d/sleep_threshold_angular", Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"), 16);
+	GLOBAL_DEF("physics/3d/solver/batched_contact_solver", false);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
@@ -36,6 +36,7 @@
 #include "core/io/resource.h"
 #include "core/object/class_db.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/templates/local_vector.h"
 #include "core/variant/native_ptr.h"
 
 class PhysicsDirectSpaceState3D;
@@ -127,6 +128,8 @@ private:
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
+	Vector<real_t> _cast_motion_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_motions);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 
@@ -160,6 +163,9 @@ public:
 	};
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
+	// Casts p_count rays sharing the filters of p_parameters, its from and to are ignored.
+	// The default implementation runs them one after the other, servers may run them in parallel.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits);
 
 	struct ShapeResult {
 		RID rid;
@@ -202,6 +208,9 @@ public:
 
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) = 0;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) = 0;
+	// Casts the shape of p_parameters from p_count transforms along as many motions, its transform and motion are ignored.
+	// Queries without a collision (or which failed) report 1.0 for both proportions.
+	virtual void cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe);
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) = 0;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) = 0;
 
@@ -224,6 +233,12 @@ public:
 	virtual void set_normal(int p_vertex_id, const Vector3 &p_normal);
 	virtual void set_aabb(const AABB &p_aabb);
 
+	// Optional direct access to the vertex buffer, lets the physics server skip the per-vertex calls.
+	virtual bool get_vertex_buffer(uint8_t *&r_buffer, uint32_t &r_vertex_stride, uint32_t &r_vertex_offset, uint32_t &r_normal_stride, uint32_t &r_normal_offset) { return false; }
+
+	// Packs a normal the way the rendering server stores it (16-bit octahedral).
+	static uint32_t encode_normal(const Vector3 &p_normal);
+
 	virtual ~PhysicsServer3DRenderingServerHandler() {}
 };
 
@@ -236,6 +251,8 @@ class PhysicsServer3D : public Object {
 	static PhysicsServer3D *singleton;
 
 	virtual bool _body_test_motion(RID p_body, const Ref<PhysicsTestMotionParameters3D> &p_parameters, const Ref<PhysicsTestMotionResult3D> &p_result = Ref<PhysicsTestMotionResult3D>());
+	void _body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results);
+	PackedFloat32Array _bodies_get_transform_bind(const TypedArray<RID> &p_bodies) const;
 
 protected:
 	static void _bind_methods();
@@ -308,6 +325,11 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Rollback support: snapshot of the simulation state of a space, and stepping of a single space.
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual void space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+	virtual void space_step(RID p_space, real_t p_step) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -465,6 +487,8 @@ public:
 
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) = 0;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const = 0;
+	// Bulk version of body_get_state() for BODY_STATE_TRANSFORM, servers can override it to skip the Variant of each body.
+	virtual Vector<Transform3D> bodies_get_transform(const Vector<RID> &p_bodies) const;
 
 	virtual void body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) = 0;
 	virtual void body_apply_impulse(RID p_body, const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) = 0;
@@ -568,6 +592,20 @@ public:
 	};
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) = 0;
+	// Tests the motions of several bodies at once. The default implementation calls body_test_motion() for each of them.
+	virtual void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided);
+
+	struct BodyStateSnapshot {
+		RID body;
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		bool sleeping = false;
+	};
+
+	// Appends the state of the bodies which changed during the last step, before their state sync callbacks are called.
+	// Used by PhysicsServer3DWrapMT to publish body states to the main thread, servers which don't implement it always sync.
+	virtual void get_changed_body_states(LocalVector<BodyStateSnapshot> &r_states) const {}
 
 	/* SOFT BODY */
 
@@ -30,6 +30,7 @@
 
 #include "physics_server_3d_wrap_mt.h"
 
+#include "core/debugger/timeline_profiler.h"
 #include "core/os/os.h"
 
 void PhysicsServer3DWrapMT::_assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id) {
@@ -41,18 +42,136 @@ void PhysicsServer3DWrapMT::_thread_exit() {
 	exit = true;
 }
 
+void PhysicsServer3DWrapMT::_thread_step(real_t p_delta) {
+	physics_server_3d->step(p_delta);
+	_publish_body_states();
+}
+
 void PhysicsServer3DWrapMT::_thread_loop() {
+	TimelineProfiler::set_thread_name("Physics 3D");
+
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
 	}
 }
 
+/* PUBLISHED BODY STATES */
+
+void PhysicsServer3DWrapMT::_body_state_written(RID p_body) {
+	if (!create_thread) {
+		return;
+	}
+	MutexLock lock(body_state_mutex);
+	written_body_states.insert(p_body);
+}
+
+void PhysicsServer3DWrapMT::_publish_body_states() {
+	// Called on the physics thread after each step, the main thread only reads the front buffer.
+	HashMap<RID, BodyStateSnapshot> &back = published_body_states[published_body_states_front ^ 1];
+
+	// The back buffer was last written one step earlier, catch up with the changes published since.
+	for (const BodyStateSnapshot &state : changed_body_states) {
+		back.insert(state.body, state);
+	}
+
+	changed_body_states.clear();
+	physics_server_3d->get_changed_body_states(changed_body_states);
+	for (const BodyStateSnapshot &state : changed_body_states) {
+		back.insert(state.body, state);
+	}
+
+	published_body_states_pending = true;
+}
+
+void PhysicsServer3DWrapMT::_swap_published_body_states() {
+	// Called on the main thread from sync(), once the physics thread is idle.
+	if (published_body_states_pending) {
+		published_body_states_front ^= 1;
+		published_body_states_pending = false;
+	}
+
+	// The bodies written to before the last step are either in its changes, or didn't move at all.
+	// Drop their older states, they are read from the server until they are published again.
+	MutexLock lock(body_state_mutex);
+	for (const RID &body : stepping_written_body_states) {
+		published_body_states[0].erase(body);
+		published_body_states[1].erase(body);
+	}
+	stepping_written_body_states.clear();
+}
+
+bool PhysicsServer3DWrapMT::_get_published_body_state(RID p_body, BodyState p_state, Variant &r_value) const {
+	if (!create_thread || !Thread::is_main_thread()) {
+		return false;
+	}
+
+	const BodyStateSnapshot *state = published_body_states[published_body_states_front].getptr(p_body);
+	if (!state) {
+		return false;
+	}
+
+	{
+		MutexLock lock(body_state_mutex);
+		if (written_body_states.has(p_body) || stepping_written_body_states.has(p_body)) {
+			return false;
+		}
+	}
+
+	switch (p_state) {
+		case BODY_STATE_TRANSFORM: {
+			r_value = state->transform;
+		} break;
+		case BODY_STATE_LINEAR_VELOCITY: {
+			r_value = state->linear_velocity;
+		} break;
+		case BODY_STATE_ANGULAR_VELOCITY: {
+			r_value = state->angular_velocity;
+		} break;
+		case BODY_STATE_SLEEPING: {
+			r_value = state->sleeping;
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool PhysicsServer3DWrapMT::_get_published_body_transforms(const Vector<RID> &p_bodies, Vector<Transform3D> &r_transforms) const {
+	if (!create_thread || !Thread::is_main_thread()) {
+		return false;
+	}
+
+	const HashMap<RID, BodyStateSnapshot> &published = published_body_states[published_body_states_front];
+	r_transforms.resize(p_bodies.size());
+	Transform3D *w = r_transforms.ptrw();
+
+	MutexLock lock(body_state_mutex);
+	for (int i = 0; i < p_bodies.size(); i++) {
+		const RID &body = p_bodies[i];
+		const BodyStateSnapshot *state = published.getptr(body);
+		// Any body missing from the published states makes the whole batch sync instead.
+		if (!state || written_body_states.has(body) || stepping_written_body_states.has(body)) {
+			return false;
+		}
+		w[i] = state->transform;
+	}
+
+	return true;
+}
+
 /* EVENT QUEUING */
 
 void PhysicsServer3DWrapMT::step(real_t p_step) {
 	if (create_thread) {
-		command_queue.push(physics_server_3d, &PhysicsServer3D::step, p_step);
+		MutexLock lock(body_state_mutex);
+		for (const RID &body : written_body_states) {
+			stepping_written_body_states.insert(body);
+		}
+		written_body_states.clear();
+		command_queue.push(this, &PhysicsServer3DWrapMT::_thread_step, p_step);
 	} else {
 		physics_server_3d->step(p_step);
 	}
@@ -61,8 +180,11 @@ void PhysicsServer3DWrapMT::step(real_t p_step) {
 void PhysicsServer3DWrapMT::sync() {
 	if (create_thread) {
 		command_queue.sync();
+		_swap_published_body_states();
 	} else {
 		command_queue.flush_all(); // Flush all pending from other threads.
+		MutexLock lock(body_state_mutex);
+		written_body_states.clear();
 	}
 	physics_server_3d->sync();
 }
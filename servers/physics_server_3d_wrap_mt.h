@@ -33,8 +33,11 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "servers/physics_server_3d.h"
 
 #ifdef DEBUG_SYNC
@@ -51,6 +54,46 @@
 #endif
 #endif
 
+// Like FUNC1/FUNC2/FUNC3, but the body's published state is no longer used until a step has caught up with the change.
+#define FUNC1BODYWRITE(m_type)                                        \
+	virtual void m_type(RID p1) override {                            \
+		if (Thread::get_caller_id() != server_thread) {               \
+			MutexLock lock(body_state_mutex);                         \
+			written_body_states.insert(p1);                           \
+			command_queue.push(server_name, &ServerName::m_type, p1); \
+		} else {                                                      \
+			_body_state_written(p1);                                  \
+			command_queue.flush_if_pending();                         \
+			server_name->m_type(p1);                                  \
+		}                                                             \
+	}
+
+#define FUNC2BODYWRITE(m_type, m_arg2)                                    \
+	virtual void m_type(RID p1, m_arg2 p2) override {                     \
+		if (Thread::get_caller_id() != server_thread) {                   \
+			MutexLock lock(body_state_mutex);                             \
+			written_body_states.insert(p1);                               \
+			command_queue.push(server_name, &ServerName::m_type, p1, p2); \
+		} else {                                                          \
+			_body_state_written(p1);                                      \
+			command_queue.flush_if_pending();                             \
+			server_name->m_type(p1, p2);                                  \
+		}                                                                 \
+	}
+
+#define FUNC3BODYWRITE(m_type, m_arg2, m_arg3)                                \
+	virtual void m_type(RID p1, m_arg2 p2, m_arg3 p3) override {              \
+		if (Thread::get_caller_id() != server_thread) {                       \
+			MutexLock lock(body_state_mutex);                                 \
+			written_body_states.insert(p1);                                   \
+			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3); \
+		} else {                                                              \
+			_body_state_written(p1);                                          \
+			command_queue.flush_if_pending();                                 \
+			server_name->m_type(p1, p2, p3);                                  \
+		}                                                                     \
+	}
+
 class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	mutable PhysicsServer3D *physics_server_3d = nullptr;
 
@@ -66,6 +109,24 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	void _thread_step(real_t p_delta);
 	void _thread_loop();
 
+	// Body states published after every step, so the main thread can read them without syncing with the physics thread.
+	// The physics thread only writes the back buffer, the buffers are swapped in sync() while the physics thread is idle.
+	HashMap<RID, BodyStateSnapshot> published_body_states[2];
+	uint32_t published_body_states_front = 0;
+	bool published_body_states_pending = false;
+	LocalVector<BodyStateSnapshot> changed_body_states; // Changes of the last step, still missing from the front buffer.
+
+	// Bodies written to since the last step, and before the step in progress. Their published state may be outdated.
+	mutable BinaryMutex body_state_mutex;
+	HashSet<RID> written_body_states;
+	HashSet<RID> stepping_written_body_states;
+
+	void _body_state_written(RID p_body);
+	void _publish_body_states();
+	void _swap_published_body_states();
+	bool _get_published_body_state(RID p_body, BodyState p_state, Variant &r_value) const;
+	bool _get_published_body_transforms(const Vector<RID> &p_bodies, Vector<Transform3D> &r_transforms) const;
+
 public:
 #define ServerName PhysicsServer3D
 #define ServerNameWrapMT PhysicsServer3DWrapMT
@@ -128,6 +189,10 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(PackedByteArray, space_save_state, RID);
+	FUNC2(space_restore_state, RID, const PackedByteArray &);
+	FUNC2(space_step, RID, real_t);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -173,10 +238,10 @@ public:
 	//FUNC2RID(body,BodyMode,bool);
 	FUNCRID(body)
 
-	FUNC2(body_set_space, RID, RID);
+	FUNC2BODYWRITE(body_set_space, RID);
 	FUNC1RC(RID, body_get_space, RID);
 
-	FUNC2(body_set_mode, RID, BodyMode);
+	FUNC2BODYWRITE(body_set_mode, BodyMode);
 	FUNC1RC(BodyMode, body_get_mode, RID);
 
 	FUNC4(body_add_shape, RID, RID, const Transform3D &, bool);
@@ -215,12 +280,44 @@ public:
 
 	FUNC1(body_reset_mass_properties, RID);
 
-	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	FUNC3BODYWRITE(body_set_state, BodyState, const Variant &);
+
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override {
+		Variant ret;
+		if (_get_published_body_state(p_body, p_state, ret)) {
+			return ret;
+		}
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+			SYNC_DEBUG
+			MAIN_THREAD_SYNC_CHECK
+		} else {
+			command_queue.flush_if_pending();
+			ret = physics_server_3d->body_get_state(p_body, p_state);
+		}
+		return ret;
+	}
+
+	virtual Vector<Transform3D> bodies_get_transform(const Vector<RID> &p_bodies) const override {
+		Vector<Transform3D> ret;
+		if (_get_published_body_transforms(p_bodies, ret)) {
+			return ret;
+		}
+		// Sync once for the whole batch.
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::bodies_get_transform, p_bodies, &ret);
+			SYNC_DEBUG
+			MAIN_THREAD_SYNC_CHECK
+		} else {
+			command_queue.flush_if_pending();
+			ret = physics_server_3d->bodies_get_transform(p_bodies);
+		}
+		return ret;
+	}
 
-	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
-	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
-	FUNC3(body_apply_impulse, RID, const Vector3 &, const Vector3 &);
+	FUNC2BODYWRITE(body_apply_torque_impulse, const Vector3 &);
+	FUNC2BODYWRITE(body_apply_central_impulse, const Vector3 &);
+	FUNC3BODYWRITE(body_apply_impulse, const Vector3 &, const Vector3 &);
 
 	FUNC2(body_apply_central_force, RID, const Vector3 &);
 	FUNC3(body_apply_force, RID, const Vector3 &, const Vector3 &);
@@ -236,7 +333,7 @@ public:
 	FUNC2(body_set_constant_torque, RID, const Vector3 &);
 	FUNC1RC(Vector3, body_get_constant_torque, RID);
 
-	FUNC2(body_set_axis_velocity, RID, const Vector3 &);
+	FUNC2BODYWRITE(body_set_axis_velocity, const Vector3 &);
 
 	FUNC3(body_set_axis_lock, RID, BodyAxis, bool);
 	FUNC2RC(bool, body_is_axis_locked, RID, BodyAxis);
@@ -264,6 +361,11 @@ public:
 		return physics_server_3d->body_test_motion(p_body, p_parameters, r_result);
 	}
 
+	void body_test_motions(const RID *p_bodies, const MotionParameters *p_parameters, int p_count, MotionResult *r_results, bool *r_collided) override {
+		ERR_FAIL_COND(!Thread::is_main_thread());
+		physics_server_3d->body_test_motions(p_bodies, p_parameters, p_count, r_results, r_collided);
+	}
+
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override {
 		ERR_FAIL_COND_V(!Thread::is_main_thread(), nullptr);
@@ -379,7 +481,7 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	FUNC1BODYWRITE(free);
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
@@ -411,6 +513,10 @@ public:
 #endif
 #undef SYNC_DEBUG
 
+#undef FUNC1BODYWRITE
+#undef FUNC2BODYWRITE
+#undef FUNC3BODYWRITE
+
 #ifdef DEBUG_ENABLED
 #undef MAIN_THREAD_SYNC_WARN
 #endif
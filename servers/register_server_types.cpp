@@ -60,6 +60,7 @@
 #include "display/native_menu.h"
 #include "display_server.h"
 #include "movie_writer/movie_writer.h"
+#include "movie_writer/movie_writer_benchmark.h"
 #include "movie_writer/movie_writer_exrwav.h"
 #include "movie_writer/movie_writer_mjpeg.h"
 #include "movie_writer/movie_writer_pngwav.h"
@@ -145,6 +146,7 @@ static bool has_server_feature_callback(const String &p_feature) {
 static MovieWriterMJPEG *writer_mjpeg = nullptr;
 static MovieWriterPNGWAV *writer_pngwav = nullptr;
 static MovieWriterEXRWAV *writer_exrwav = nullptr;
+static MovieWriterBenchmark *writer_benchmark = nullptr;
 
 void register_server_types() {
 	OS::get_singleton()->benchmark_begin_measure("Servers", "Register Extensions");
@@ -353,6 +355,9 @@ void register_server_types() {
 
 	writer_exrwav = memnew(MovieWriterEXRWAV);
 	MovieWriter::add_writer(writer_exrwav);
+
+	writer_benchmark = memnew(MovieWriterBenchmark);
+	MovieWriter::add_writer(writer_benchmark);
     
 	OS::get_singleton()->benchmark_end_measure("Servers", "Register Extensions");
 }
@@ -365,6 +370,7 @@ void unregister_server_types() {
 	memdelete(writer_mjpeg);
 	memdelete(writer_pngwav);
 	memdelete(writer_exrwav);
+	memdelete(writer_benchmark);
     
 	OS::get_singleton()->benchmark_end_measure("Servers", "Unregister Extensions");
 }
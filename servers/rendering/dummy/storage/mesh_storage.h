@@ -91,6 +91,7 @@ public:
 		s->bone_aabbs = p_surface.bone_aabbs;
 		s->mesh_to_skeleton_xform = p_surface.mesh_to_skeleton_xform;
 		s->blend_shape_data = p_surface.blend_shape_data;
+		s->cluster_data = p_surface.cluster_data;
 		s->uv_scale = p_surface.uv_scale;
 		s->material = p_surface.material;
 	}
@@ -48,6 +48,7 @@ public:
 	virtual void particles_set_emitting(RID p_particles, bool p_emitting) override {}
 	virtual void particles_set_amount(RID p_particles, int p_amount) override {}
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) override {}
+	virtual void particles_set_lod_threshold(RID p_particles, float p_threshold) override {}
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) override {}
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) override {}
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) override {}
@@ -78,6 +79,7 @@ public:
 	virtual void particles_set_draw_pass_mesh(RID p_particles, int p_pass, RID p_mesh) override {}
 
 	virtual void particles_request_process(RID p_particles) override {}
+	virtual void particles_set_lod_screen_size(RID p_particles, float p_screen_size) override {}
 	virtual AABB particles_get_current_aabb(RID p_particles) override { return AABB(); }
 	virtual AABB particles_get_aabb(RID p_particles) const override { return AABB(); }
 
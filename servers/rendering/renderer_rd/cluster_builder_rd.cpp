@@ -29,6 +29,7 @@
 /**************************************************************************/
 
 #include "cluster_builder_rd.h"
+#include "core/config/project_settings.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server_globals.h"
 
@@ -46,7 +47,16 @@ ClusterBuilderSharedDataRD::ClusterBuilderSharedDataRD() {
 		vertex_format = RD::get_singleton()->vertex_format_create(attributes);
 	}
 
-	{
+	use_compute_binning = GLOBAL_GET("rendering/limits/cluster_builder/use_compute_binning");
+
+	if (use_compute_binning) {
+		Vector<String> versions;
+		versions.push_back("");
+		cluster_bin.cluster_bin_shader.initialize(versions);
+		cluster_bin.shader_version = cluster_bin.cluster_bin_shader.version_create();
+		cluster_bin.shader = cluster_bin.cluster_bin_shader.version_get_shader(cluster_bin.shader_version, 0);
+		cluster_bin.shader_pipeline = RD::get_singleton()->compute_pipeline_create(cluster_bin.shader);
+	} else {
 		RD::FramebufferFormatID fb_format;
 		RD::PipelineColorBlendState blend_state;
 		String defines;
@@ -227,7 +237,11 @@ ClusterBuilderSharedDataRD::~ClusterBuilderSharedDataRD() {
 	RD::get_singleton()->free(box_vertex_buffer);
 	RD::get_singleton()->free(box_index_buffer);
 
-	cluster_render.cluster_render_shader.version_free(cluster_render.shader_version);
+	if (use_compute_binning) {
+		cluster_bin.cluster_bin_shader.version_free(cluster_bin.shader_version);
+	} else {
+		cluster_render.cluster_render_shader.version_free(cluster_render.shader_version);
+	}
 	cluster_store.cluster_store_shader.version_free(cluster_store.shader_version);
 	cluster_debug.cluster_debug_shader.version_free(cluster_debug.shader_version);
 }
@@ -252,10 +266,13 @@ void ClusterBuilderRD::_clear() {
 	render_element_max = 0;
 	render_element_count = 0;
 
-	RD::get_singleton()->free(framebuffer);
-	framebuffer = RID();
+	if (framebuffer.is_valid()) {
+		RD::get_singleton()->free(framebuffer);
+		framebuffer = RID();
+	}
 
 	cluster_render_uniform_set = RID();
+	cluster_bin_uniform_set = RID();
 	cluster_store_uniform_set = RID();
 }
 
@@ -293,14 +310,17 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 
 	element_buffer = RD::get_singleton()->storage_buffer_create(sizeof(RenderElementData) * render_element_max);
 
-	uint32_t div_value = 1 << divisor;
-	if (use_msaa) {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
-	} else {
-		framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+	if (!shared->use_compute_binning) {
+		uint32_t div_value = 1 << divisor;
+		if (use_msaa) {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value, RD::TEXTURE_SAMPLES_4);
+		} else {
+			framebuffer = RD::get_singleton()->framebuffer_create_empty(p_screen_size / div_value);
+		}
 	}
 
 	{
+		// Both the raster and the compute binning use the same bindings.
 		Vector<RD::Uniform> uniforms;
 		{
 			RD::Uniform u;
@@ -324,7 +344,11 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 			uniforms.push_back(u);
 		}
 
-		cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		if (shared->use_compute_binning) {
+			cluster_bin_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_bin.shader, 0);
+		} else {
+			cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		}
 	}
 
 	{
@@ -440,6 +464,11 @@ void ClusterBuilderRD::bake_cluster() {
 			state.cluster_screen_width = cluster_screen_size.x;
 			state.cluster_depth_offset = (render_element_max / 32);
 			state.cluster_data_size = state.cluster_depth_offset + render_element_max;
+			state.pad0 = 0;
+			state.pad1 = 0;
+			state.pad2 = 0;
+
+			RendererRD::MaterialStorage::store_camera(adjusted_projection.inverse(), state.inv_projection);
 
 			RD::get_singleton()->buffer_update(state_uniform, 0, sizeof(StateUniform), &state);
 		}
@@ -448,10 +477,28 @@ void ClusterBuilderRD::bake_cluster() {
 
 		RD::get_singleton()->buffer_update(element_buffer, 0, sizeof(RenderElementData) * render_element_count, render_elements);
 
-		RENDER_TIMESTAMP("Render 3D Cluster Elements");
+		if (shared->use_compute_binning) {
+			RENDER_TIMESTAMP("Bin 3D Cluster Elements");
+
+			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, shared->cluster_bin.shader_pipeline);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, cluster_bin_uniform_set, 0);
+
+			ClusterBuilderSharedDataRD::ClusterBin::PushConstant push_constant;
+			push_constant.screen_size[0] = screen_size.x;
+			push_constant.screen_size[1] = screen_size.y;
+			push_constant.cluster_size = cluster_size;
+			push_constant.render_element_count = render_element_count;
+
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(ClusterBuilderSharedDataRD::ClusterBin::PushConstant));
+
+			// One group per cluster tile.
+			RD::get_singleton()->compute_list_dispatch(compute_list, cluster_screen_size.x, cluster_screen_size.y, 1);
+
+			RD::get_singleton()->compute_list_end();
+		} else {
+			RENDER_TIMESTAMP("Render 3D Cluster Elements");
 
-		// Render elements.
-		{
 			RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD);
 			ClusterBuilderSharedDataRD::ClusterRender::PushConstant push_constant = {};
 
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  depth_occlusion.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "depth_occlusion.h"
+#include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
+using namespace RendererRD;
+
+DepthOcclusion::DepthOcclusion() {
+	Vector<String> modes;
+	modes.push_back("\n");
+
+	depth_occlusion.shader.initialize(modes);
+
+	depth_occlusion.shader_version = depth_occlusion.shader.version_create();
+
+	depth_occlusion.pipeline = RD::get_singleton()->compute_pipeline_create(depth_occlusion.shader.version_get_shader(depth_occlusion.shader_version, 0));
+}
+
+DepthOcclusion::~DepthOcclusion() {
+	depth_occlusion.shader.version_free(depth_occlusion.shader_version);
+}
+
+void DepthOcclusion::reduce_depth(RID p_source_depth, RID p_dest_buffer, const Size2i &p_source_size, const Size2i &p_dest_size, const Projection &p_projection, bool p_flip_y) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+
+	// Linearize with the projection the depth was rendered with.
+	Projection correction;
+	correction.set_depth_correction(p_flip_y);
+
+	DepthOcclusionPushConstant push_constant;
+	MaterialStorage::store_camera((correction * p_projection).inverse(), push_constant.inv_projection);
+	push_constant.source_size[0] = p_source_size.x;
+	push_constant.source_size[1] = p_source_size.y;
+	push_constant.dest_size[0] = p_dest_size.x;
+	push_constant.dest_size[1] = p_dest_size.y;
+	push_constant.flip_y = p_flip_y;
+	push_constant.pad[0] = 0;
+	push_constant.pad[1] = 0;
+	push_constant.pad[2] = 0;
+
+	// setup our uniforms
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::Uniform u_source_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, p_source_depth }));
+	RD::Uniform u_dest_buffer(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, p_dest_buffer);
+
+	RID shader = depth_occlusion.shader.version_get_shader(depth_occlusion.shader_version, 0);
+	ERR_FAIL_COND(shader.is_null());
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, depth_occlusion.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source_depth), 0);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 1, u_dest_buffer), 1);
+
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(DepthOcclusionPushConstant));
+
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, p_dest_size.x, p_dest_size.y, 1);
+
+	RD::get_singleton()->compute_list_end();
+}
@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  depth_occlusion.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef DEPTH_OCCLUSION_RD_H
+#define DEPTH_OCCLUSION_RD_H
+
+#include "servers/rendering/renderer_rd/shaders/effects/depth_occlusion.glsl.gen.h"
+#include "servers/rendering/renderer_scene_render.h"
+
+#include "servers/rendering_server.h"
+
+namespace RendererRD {
+
+// Reduces a depth buffer to a low resolution buffer of linear depths usable as an occlusion buffer.
+class DepthOcclusion {
+private:
+	struct DepthOcclusionPushConstant {
+		float inv_projection[16];
+		int32_t source_size[2];
+		int32_t dest_size[2];
+		uint32_t flip_y;
+		uint32_t pad[3];
+	};
+
+	struct DepthOcclusionShader {
+		DepthOcclusionShaderRD shader;
+		RID shader_version;
+		RID pipeline;
+	} depth_occlusion;
+
+public:
+	// Size in pixels of the screen area covered by one texel of the reduced buffer.
+	static const int TEXEL_SIZE = 8;
+
+	DepthOcclusion();
+	~DepthOcclusion();
+
+	void reduce_depth(RID p_source_depth, RID p_dest_buffer, const Size2i &p_source_size, const Size2i &p_dest_size, const Projection &p_projection, bool p_flip_y);
+};
+
+} // namespace RendererRD
+
+#endif // DEPTH_OCCLUSION_RD_H
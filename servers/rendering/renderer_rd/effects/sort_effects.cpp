@@ -48,9 +48,27 @@ SortEffects::SortEffects() {
 	for (int i = 0; i < SORT_MODE_MAX; i++) {
 		pipelines[i] = RD::get_singleton()->compute_pipeline_create(shader.version_get_shader(shader_version, i));
 	}
+
+	Vector<String> radix_sort_modes;
+	radix_sort_modes.push_back("\n#define MODE_HISTOGRAM\n");
+	radix_sort_modes.push_back("\n#define MODE_SCAN\n");
+	radix_sort_modes.push_back("\n#define MODE_SCATTER\n");
+
+	radix_sort_shader.initialize(radix_sort_modes);
+
+	radix_sort_shader_version = radix_sort_shader.version_create();
+
+	for (int i = 0; i < RADIX_SORT_MODE_MAX; i++) {
+		radix_sort_pipelines[i] = RD::get_singleton()->compute_pipeline_create(radix_sort_shader.version_get_shader(radix_sort_shader_version, i));
+	}
 }
 
 SortEffects::~SortEffects() {
+	if (radix_sort_scratch_buffer.is_valid()) {
+		RD::get_singleton()->free(radix_sort_scratch_buffer);
+		RD::get_singleton()->free(radix_sort_histogram_buffer);
+	}
+	radix_sort_shader.version_free(radix_sort_shader_version);
 	shader.version_free(shader_version);
 }
 
@@ -122,3 +140,68 @@ void SortEffects::sort_buffer(RID p_uniform_set, int p_size) {
 
 	RD::get_singleton()->compute_list_end();
 }
+
+void SortEffects::radix_sort_buffer(RID p_buffer, uint32_t p_size) {
+	if (p_size < 2) {
+		return;
+	}
+
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+
+	uint32_t block_count = (p_size + RADIX_SORT_BLOCK_SIZE - 1) / RADIX_SORT_BLOCK_SIZE;
+
+	if (p_size > radix_sort_scratch_size) {
+		if (radix_sort_scratch_buffer.is_valid()) {
+			RD::get_singleton()->free(radix_sort_scratch_buffer);
+			RD::get_singleton()->free(radix_sort_histogram_buffer);
+		}
+		radix_sort_scratch_size = p_size;
+		uint32_t max_block_count = (radix_sort_scratch_size + RADIX_SORT_BLOCK_SIZE - 1) / RADIX_SORT_BLOCK_SIZE;
+		radix_sort_scratch_buffer = RD::get_singleton()->storage_buffer_create(sizeof(float) * 2 * radix_sort_scratch_size);
+		radix_sort_histogram_buffer = RD::get_singleton()->storage_buffer_create(sizeof(uint32_t) * RADIX_SORT_DIGIT_COUNT * max_block_count);
+	}
+
+	RID histogram_shader = radix_sort_shader.version_get_shader(radix_sort_shader_version, RADIX_SORT_MODE_HISTOGRAM);
+	RID scan_shader = radix_sort_shader.version_get_shader(radix_sort_shader_version, RADIX_SORT_MODE_SCAN);
+	RID scatter_shader = radix_sort_shader.version_get_shader(radix_sort_shader_version, RADIX_SORT_MODE_SCATTER);
+
+	RD::Uniform u_histogram(RD::UNIFORM_TYPE_STORAGE_BUFFER, 2, radix_sort_histogram_buffer);
+
+	RadixSortPushConstant push_constant = {};
+	push_constant.total_elements = p_size;
+	push_constant.block_count = block_count;
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+
+	// Four 8-bit passes, ping-ponging between the buffer and the scratch buffer, so the result ends up in the buffer.
+	for (uint32_t pass = 0; pass < 4; pass++) {
+		RID source = (pass % 2) == 0 ? p_buffer : radix_sort_scratch_buffer;
+		RID dest = (pass % 2) == 0 ? radix_sort_scratch_buffer : p_buffer;
+
+		RD::Uniform u_source(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, source);
+		RD::Uniform u_dest(RD::UNIFORM_TYPE_STORAGE_BUFFER, 1, dest);
+
+		push_constant.shift = pass * 8;
+
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, radix_sort_pipelines[RADIX_SORT_MODE_HISTOGRAM]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(histogram_shader, 0, u_source, u_histogram), 0);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(RadixSortPushConstant));
+		RD::get_singleton()->compute_list_dispatch(compute_list, block_count, 1, 1);
+		RD::get_singleton()->compute_list_add_barrier(compute_list);
+
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, radix_sort_pipelines[RADIX_SORT_MODE_SCAN]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(scan_shader, 0, u_histogram), 0);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(RadixSortPushConstant));
+		RD::get_singleton()->compute_list_dispatch(compute_list, 1, 1, 1);
+		RD::get_singleton()->compute_list_add_barrier(compute_list);
+
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, radix_sort_pipelines[RADIX_SORT_MODE_SCATTER]);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(scatter_shader, 0, u_source, u_dest, u_histogram), 0);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(RadixSortPushConstant));
+		RD::get_singleton()->compute_list_dispatch(compute_list, block_count, 1, 1);
+		RD::get_singleton()->compute_list_add_barrier(compute_list);
+	}
+
+	RD::get_singleton()->compute_list_end();
+}
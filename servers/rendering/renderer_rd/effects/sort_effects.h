@@ -32,6 +32,7 @@
 #define SORT_EFFECTS_RD_H
 
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
+#include "servers/rendering/renderer_rd/shaders/effects/radix_sort.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/effects/sort.glsl.gen.h"
 #include "servers/rendering/renderer_scene_render.h"
 
@@ -58,12 +59,43 @@ private:
 	RID shader_version;
 	RID pipelines[SORT_MODE_MAX];
 
+	enum RadixSortMode {
+		RADIX_SORT_MODE_HISTOGRAM,
+		RADIX_SORT_MODE_SCAN,
+		RADIX_SORT_MODE_SCATTER,
+		RADIX_SORT_MODE_MAX
+	};
+
+	struct RadixSortPushConstant {
+		uint32_t total_elements;
+		uint32_t shift;
+		uint32_t block_count;
+		uint32_t pad;
+	};
+
+	static const uint32_t RADIX_SORT_BLOCK_SIZE = 1024; // Must match BLOCK_SIZE in radix_sort.glsl.
+	static const uint32_t RADIX_SORT_DIGIT_COUNT = 256;
+
+	RadixSortShaderRD radix_sort_shader;
+	RID radix_sort_shader_version;
+	RID radix_sort_pipelines[RADIX_SORT_MODE_MAX];
+
+	// Scratch buffers, grown to the largest sort so far.
+	RID radix_sort_scratch_buffer;
+	RID radix_sort_histogram_buffer;
+	uint32_t radix_sort_scratch_size = 0;
+
 protected:
 public:
+	// Above this many elements, radix_sort_buffer() is faster than the bitonic sort_buffer().
+	static const uint32_t RADIX_SORT_THRESHOLD = 65536;
+
 	SortEffects();
 	~SortEffects();
 
 	void sort_buffer(RID p_uniform_set, int p_size);
+	// Sorts a storage buffer of vec2 (key, value) pairs by key, in the same order as sort_buffer().
+	void radix_sort_buffer(RID p_buffer, uint32_t p_size);
 };
 
 } // namespace RendererRD
@@ -32,6 +32,7 @@
 #include "../renderer_compositor_rd.h"
 #include "../storage_rd/texture_storage.h"
 #include "../uniform_set_cache_rd.h"
+#include "core/config/project_settings.h"
 
 #ifndef _3D_DISABLED
 #include "servers/xr_server.h"
@@ -44,11 +45,14 @@ VRS::VRS() {
 		Vector<String> vrs_modes;
 		vrs_modes.push_back("\n"); // VRS_DEFAULT
 		vrs_modes.push_back("\n#define USE_MULTIVIEW\n"); // VRS_MULTIVIEW
+		vrs_modes.push_back("\n#define MODE_ADAPTIVE\n"); // VRS_ADAPTIVE
+		vrs_modes.push_back("\n#define MODE_ADAPTIVE\n#define USE_MULTIVIEW\n"); // VRS_ADAPTIVE_MULTIVIEW
 
 		vrs_shader.shader.initialize(vrs_modes);
 
 		if (!RendererCompositorRD::get_singleton()->is_xr_enabled()) {
 			vrs_shader.shader.set_variant_enabled(VRS_MULTIVIEW, false);
+			vrs_shader.shader.set_variant_enabled(VRS_ADAPTIVE_MULTIVIEW, false);
 		}
 
 		vrs_shader.shader_version = vrs_shader.shader.version_create();
@@ -63,6 +67,9 @@ VRS::VRS() {
 			}
 		}
 	}
+
+	adaptive_velocity_threshold = GLOBAL_GET("rendering/vrs/adaptive_velocity_threshold");
+	adaptive_contrast_threshold = GLOBAL_GET("rendering/vrs/adaptive_contrast_threshold");
 }
 
 VRS::~VRS() {
@@ -84,12 +91,7 @@ void VRS::copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multi
 
 	int mode = p_multiview ? VRS_MULTIVIEW : VRS_DEFAULT;
 
-	// Set maximum texel factor based on maximum fragment size, some GPUs do not support 8x8 (fragment shading rate approach).
-	if (MIN(RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_WIDTH), RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_HEIGHT)) > 4) {
-		push_constant.max_texel_factor = 3.0;
-	} else {
-		push_constant.max_texel_factor = 2.0;
-	}
+	push_constant.max_texel_factor = _get_max_texel_factor();
 
 	RID shader = vrs_shader.shader.version_get_shader(vrs_shader.shader_version, mode);
 	ERR_FAIL_COND(shader.is_null());
@@ -102,6 +104,52 @@ void VRS::copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multi
 	RD::get_singleton()->draw_list_end();
 }
 
+void VRS::adaptive_vrs(RID p_color, RID p_velocity, RID p_dest_framebuffer, bool p_multiview) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RID velocity = p_velocity;
+	if (velocity.is_null()) {
+		// Without motion vectors, only the contrast is taken into account.
+		velocity = TextureStorage::get_singleton()->texture_rd_get_default(p_multiview ? TextureStorage::DEFAULT_RD_TEXTURE_2D_ARRAY_BLACK : TextureStorage::DEFAULT_RD_TEXTURE_BLACK);
+	}
+
+	RD::Uniform u_color(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, p_color }));
+	RD::Uniform u_velocity(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, Vector<RID>({ default_sampler, velocity }));
+
+	VRSPushConstant push_constant = {};
+	push_constant.max_texel_factor = _get_max_texel_factor();
+	push_constant.velocity_threshold = adaptive_velocity_threshold;
+	push_constant.contrast_threshold = adaptive_contrast_threshold;
+	push_constant.tile_size[0] = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_WIDTH);
+	push_constant.tile_size[1] = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_HEIGHT);
+
+	int mode = p_multiview ? VRS_ADAPTIVE_MULTIVIEW : VRS_ADAPTIVE;
+
+	RID shader = vrs_shader.shader.version_get_shader(vrs_shader.shader_version, mode);
+	ERR_FAIL_COND(shader.is_null());
+
+	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(p_dest_framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD, Vector<Color>());
+	RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, vrs_shader.pipelines[mode].get_render_pipeline(RD::INVALID_ID, RD::get_singleton()->framebuffer_get_format(p_dest_framebuffer)));
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, uniform_set_cache->get_cache(shader, 0, u_color, u_velocity), 0);
+	RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(VRSPushConstant));
+	RD::get_singleton()->draw_list_draw(draw_list, false, 1u, 3u);
+	RD::get_singleton()->draw_list_end();
+}
+
+float VRS::_get_max_texel_factor() const {
+	// Set maximum texel factor based on maximum fragment size, some GPUs do not support 8x8 (fragment shading rate approach).
+	if (MIN(RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_WIDTH), RD::get_singleton()->limit_get(RD::LIMIT_VRS_MAX_FRAGMENT_HEIGHT)) > 4) {
+		return 3.0;
+	} else {
+		return 2.0;
+	}
+}
+
 Size2i VRS::get_vrs_texture_size(const Size2i p_base_size) const {
 	int32_t texel_width = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_WIDTH);
 	int32_t texel_height = RD::get_singleton()->limit_get(RD::LIMIT_VRS_TEXEL_HEIGHT);
@@ -117,12 +165,13 @@ Size2i VRS::get_vrs_texture_size(const Size2i p_base_size) const {
 	return Size2i(width, height);
 }
 
-void VRS::update_vrs_texture(RID p_vrs_fb, RID p_render_target) {
+void VRS::update_vrs_texture(RID p_vrs_fb, RID p_render_target, RID p_color, RID p_velocity, bool p_multiview) {
 	TextureStorage *texture_storage = TextureStorage::get_singleton();
 	RS::ViewportVRSMode vrs_mode = texture_storage->render_target_get_vrs_mode(p_render_target);
 	RS::ViewportVRSUpdateMode vrs_update_mode = texture_storage->render_target_get_vrs_update_mode(p_render_target);
 
-	if (vrs_mode != RS::VIEWPORT_VRS_DISABLED && vrs_update_mode != RS::VIEWPORT_VRS_UPDATE_DISABLED) {
+	// The adaptive shading rate depends on the previous frame, so it is updated every frame.
+	if (vrs_mode != RS::VIEWPORT_VRS_DISABLED && (vrs_update_mode != RS::VIEWPORT_VRS_UPDATE_DISABLED || vrs_mode == RS::VIEWPORT_VRS_ADAPTIVE)) {
 		RD::get_singleton()->draw_command_begin_label("VRS Setup");
 
 		if (vrs_mode == RS::VIEWPORT_VRS_TEXTURE) {
@@ -151,6 +200,10 @@ void VRS::update_vrs_texture(RID p_vrs_fb, RID p_render_target) {
 				}
 			}
 #endif // _3D_DISABLED
+		} else if (vrs_mode == RS::VIEWPORT_VRS_ADAPTIVE) {
+			if (p_color.is_valid()) {
+				adaptive_vrs(p_color, p_velocity, p_vrs_fb, p_multiview);
+			}
 		}
 
 		if (vrs_update_mode == RS::VIEWPORT_VRS_UPDATE_ONCE) {
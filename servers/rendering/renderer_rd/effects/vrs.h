@@ -44,14 +44,18 @@ private:
 	enum VRSMode {
 		VRS_DEFAULT,
 		VRS_MULTIVIEW,
+		VRS_ADAPTIVE,
+		VRS_ADAPTIVE_MULTIVIEW,
 		VRS_MAX,
 	};
 
 	struct VRSPushConstant {
 		float max_texel_factor; // 4x8, 8x4 and 8x8 are only available on some GPUs.
-		float res1;
-		float res2;
-		float res3;
+		float velocity_threshold; // In pixels per frame.
+		float contrast_threshold;
+		float pad;
+		float tile_size[2];
+		float pad2[2];
 	};
 
 	struct VRSShader {
@@ -61,14 +65,20 @@ private:
 		PipelineCacheRD pipelines[VRS_MAX];
 	} vrs_shader;
 
+	float adaptive_velocity_threshold = 8.0;
+	float adaptive_contrast_threshold = 0.05;
+
+	float _get_max_texel_factor() const;
+
 public:
 	VRS();
 	~VRS();
 
 	void copy_vrs(RID p_source_rd_texture, RID p_dest_framebuffer, bool p_multiview = false);
+	void adaptive_vrs(RID p_color, RID p_velocity, RID p_dest_framebuffer, bool p_multiview = false);
 
 	Size2i get_vrs_texture_size(const Size2i p_base_size) const;
-	void update_vrs_texture(RID p_vrs_fb, RID p_render_target);
+	void update_vrs_texture(RID p_vrs_fb, RID p_render_target, RID p_color = RID(), RID p_velocity = RID(), bool p_multiview = false);
 };
 
 } // namespace RendererRD
@@ -1086,9 +1086,19 @@ void GI::HDDAGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = REGION_CELLS / 2;
 
+	// Scrolling re-voxelizes and relights the dirty part of a cascade, which gets expensive when several
+	// cascades scroll in the same frame (fast motion, teleports). Limit the volume updated per frame:
+	// cascades that don't fit keep their position and scroll on a later frame. Near cascades go first,
+	// and the nearest dirty one is always updated so the budget can't stall it.
+	uint64_t cascade_volume = uint64_t(cascade_size.x) * cascade_size.y * cascade_size.z;
+	uint64_t update_budget = gi->hddagi_cascade_update_budget > 0.0 ? uint64_t(cascade_volume * gi->hddagi_cascade_update_budget) : UINT64_MAX;
+	uint64_t update_used = 0;
+	bool updated_cascade = false;
+
 	int idx = 0;
 	for (HDDAGI::Cascade &cascade : cascades) {
 		cascade.dirty_regions = Vector3i();
+		Vector3i prev_position = cascade.position;
 
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(REGION_CELLS) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
@@ -1137,6 +1147,28 @@ void GI::HDDAGI::update(RID p_env, const Vector3 &p_world_position) {
 			}
 		}
 
+		if (cascade.dirty_regions != Vector3i()) {
+			uint64_t update_cost = cascade_volume;
+			if (cascade.dirty_regions != HDDAGI::Cascade::DIRTY_ALL) {
+				uint64_t safe_volume = 1;
+				for (int j = 0; j < 3; j++) {
+					safe_volume *= cascade_size[j] - ABS(cascade.dirty_regions[j]);
+				}
+				update_cost -= safe_volume;
+			}
+
+			if (updated_cascade && update_used + update_cost > update_budget) {
+				// Over budget, scroll this cascade on a later frame.
+				cascade.position = prev_position;
+				cascade.dirty_regions = Vector3i();
+				idx++;
+				continue;
+			}
+
+			update_used += update_cost;
+			updated_cascade = true;
+		}
+
 		if (cascade.dirty_regions != Vector3i()) {
 			uint32_t dirty_mask = 0;
 			for (int j = 0; j < 3; j++) {
@@ -2933,6 +2965,7 @@ GI::GI() {
 
 	hddagi_frames_to_converge = RS::EnvironmentHDDAGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/hddagi/frames_to_converge")), 0, int32_t(RS::ENV_HDDAGI_CONVERGE_MAX - 1)));
 	hddagi_frames_to_update_light = RS::EnvironmentHDDAGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/hddagi/frames_to_update_lights")), 0, int32_t(RS::ENV_HDDAGI_UPDATE_LIGHT_MAX - 1)));
+	hddagi_cascade_update_budget = MAX(0.0f, float(GLOBAL_GET("rendering/global_illumination/hddagi/cascade_update_budget")));
 }
 
 GI::~GI() {
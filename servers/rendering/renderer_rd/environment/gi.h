@@ -748,6 +748,7 @@ public:
 	RS::EnvironmentHDDAGIFramesToConverge hddagi_frames_to_converge = RS::ENV_HDDAGI_CONVERGE_IN_12_FRAMES;
 	RS::EnvironmentHDDAGIFramesToUpdateLight hddagi_frames_to_update_light = RS::ENV_HDDAGI_UPDATE_LIGHT_IN_4_FRAMES;
 	RS::EnvironmentHDDAGIInactiveProbeFrames inactive_probe_frames = RS::ENV_HDDAGI_INACTIVE_PROBE_4_FRAMES;
+	float hddagi_cascade_update_budget = 0.0; // In full cascade volumes per frame, 0 is unlimited.
 
 	float hddagi_solid_cell_ratio = 0.5;
 	Vector3 hddagi_debug_probe_pos;
@@ -725,6 +725,8 @@ SkyRD::SkyRD() {
 	roughness_layers = GLOBAL_GET("rendering/reflections/sky_reflections/roughness_layers");
 	sky_ggx_samples_quality = GLOBAL_GET("rendering/reflections/sky_reflections/ggx_samples");
 	sky_use_cubemap_array = GLOBAL_GET("rendering/reflections/sky_reflections/texture_array_reflections");
+	sky_realtime_update_budget = GLOBAL_GET("rendering/reflections/sky_reflections/realtime_update_budget");
+	sky_realtime_change_threshold = GLOBAL_GET("rendering/reflections/sky_reflections/realtime_change_threshold");
 }
 
 void SkyRD::init() {
@@ -1147,7 +1149,11 @@ void SkyRD::setup_sky(RID p_env, Ref<RenderSceneBuffersRD> p_render_buffers, con
 			sky_scene_state.last_frame_directional_lights = sky_scene_state.directional_lights;
 			sky_scene_state.directional_lights = temp;
 			sky_scene_state.last_frame_directional_light_count = sky_scene_state.ubo.directional_light_count;
-			if (sky) {
+			if (sky && _sky_lights_changed(sky)) {
+				sky->radiance_lights.resize(sky_scene_state.ubo.directional_light_count);
+				for (uint32_t i = 0; i < sky_scene_state.ubo.directional_light_count; i++) {
+					sky->radiance_lights[i] = sky_scene_state.last_frame_directional_lights[i];
+				}
 				sky->reflection.dirty = true;
 			}
 		}
@@ -1222,6 +1228,167 @@ void SkyRD::setup_sky(RID p_env, Ref<RenderSceneBuffersRD> p_render_buffers, con
 	RD::get_singleton()->buffer_update(sky_scene_state.uniform_buffer, 0, sizeof(SkySceneState::UBO), &sky_scene_state.ubo);
 }
 
+static const Vector3 sky_cubemap_view_normals[6] = {
+	Vector3(+1, 0, 0),
+	Vector3(-1, 0, 0),
+	Vector3(0, +1, 0),
+	Vector3(0, -1, 0),
+	Vector3(0, 0, +1),
+	Vector3(0, 0, -1)
+};
+static const Vector3 sky_cubemap_view_up[6] = {
+	Vector3(0, -1, 0),
+	Vector3(0, -1, 0),
+	Vector3(0, 0, +1),
+	Vector3(0, 0, -1),
+	Vector3(0, -1, 0),
+	Vector3(0, -1, 0)
+};
+
+bool SkyRD::_sky_lights_changed(Sky *p_sky) const {
+	if (sky_realtime_change_threshold <= 0.0 || p_sky->radiance_lights.size() != sky_scene_state.ubo.directional_light_count) {
+		return true;
+	}
+
+	// Direction changes are measured as chord length (roughly the angle in radians),
+	// color, energy and size changes relative to their previous value.
+	for (uint32_t i = 0; i < sky_scene_state.ubo.directional_light_count; i++) {
+		const SkyDirectionalLightData &current = sky_scene_state.last_frame_directional_lights[i];
+		const SkyDirectionalLightData &previous = p_sky->radiance_lights[i];
+
+		if (current.enabled != previous.enabled) {
+			return true;
+		}
+
+		Vector3 direction_delta(current.direction[0] - previous.direction[0], current.direction[1] - previous.direction[1], current.direction[2] - previous.direction[2]);
+		if (direction_delta.length() >= sky_realtime_change_threshold) {
+			return true;
+		}
+
+		for (int j = 0; j < 3; j++) {
+			float current_radiance = current.color[j] * current.energy;
+			float previous_radiance = previous.color[j] * previous.energy;
+			if (Math::abs(current_radiance - previous_radiance) >= sky_realtime_change_threshold * MAX(Math::abs(previous_radiance), 0.001f)) {
+				return true;
+			}
+		}
+
+		if (Math::abs(current.size - previous.size) >= sky_realtime_change_threshold * MAX(previous.size, 0.001f)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SkyRD::_render_radiance_face(Sky *p_sky, SkyShaderData *p_shader_data, SkyMaterialData *p_material, int p_face, Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3 &p_global_pos, double p_time, float p_luminance_multiplier) {
+	Projection cm;
+	cm.set_perspective(90, 1, 0.01, 10.0);
+	Projection correction;
+	correction.set_depth_correction(true);
+	cm = correction * cm;
+
+	Basis local_view = Basis::looking_at(sky_cubemap_view_normals[p_face], sky_cubemap_view_up[p_face]);
+
+	if (p_shader_data->uses_quarter_res && roughness_layers >= 3) {
+		PipelineCacheRD *pipeline = &p_shader_data->pipelines[SKY_VERSION_CUBEMAP_QUARTER_RES];
+		RID texture_uniform_set = p_sky->get_textures(SKY_TEXTURE_SET_CUBEMAP_QUARTER_RES, sky_shader.default_shader_rd, p_render_buffers);
+		RID framebuffer = p_sky->reflection.layers[0].mipmaps[2].framebuffers[p_face];
+
+		RD::DrawListID cubemap_draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD);
+		_render_sky(cubemap_draw_list, p_time, framebuffer, pipeline, p_material->uniform_set, texture_uniform_set, cm, local_view, p_global_pos, p_luminance_multiplier);
+		RD::get_singleton()->draw_list_end();
+	}
+
+	if (p_shader_data->uses_half_res && roughness_layers >= 2) {
+		PipelineCacheRD *pipeline = &p_shader_data->pipelines[SKY_VERSION_CUBEMAP_HALF_RES];
+		RID texture_uniform_set = p_sky->get_textures(SKY_TEXTURE_SET_CUBEMAP_HALF_RES, sky_shader.default_shader_rd, p_render_buffers);
+		RID framebuffer = p_sky->reflection.layers[0].mipmaps[1].framebuffers[p_face];
+
+		RD::DrawListID cubemap_draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD);
+		_render_sky(cubemap_draw_list, p_time, framebuffer, pipeline, p_material->uniform_set, texture_uniform_set, cm, local_view, p_global_pos, p_luminance_multiplier);
+		RD::get_singleton()->draw_list_end();
+	}
+
+	PipelineCacheRD *pipeline = &p_shader_data->pipelines[SKY_VERSION_CUBEMAP];
+	RID texture_uniform_set = p_sky->get_textures(SKY_TEXTURE_SET_CUBEMAP, sky_shader.default_shader_rd, p_render_buffers);
+	RID framebuffer = p_sky->reflection.layers[0].mipmaps[0].framebuffers[p_face];
+
+	RD::DrawListID cubemap_draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD);
+	_render_sky(cubemap_draw_list, p_time, framebuffer, pipeline, p_material->uniform_set, texture_uniform_set, cm, local_view, p_global_pos, p_luminance_multiplier);
+	RD::get_singleton()->draw_list_end();
+}
+
+void SkyRD::_update_radiance_budgeted(Sky *p_sky, SkyShaderData *p_shader_data, SkyMaterialData *p_material, Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3 &p_global_pos, double p_time, float p_luminance_multiplier) {
+	// Rendering one cubemap face and filtering the radiance each cost one step. Faces are picked by
+	// staleness weighted by how much they contribute to typical reflections (the upper hemisphere
+	// and the horizon in front of the camera), and the radiance is filtered once half of the cube
+	// has been refreshed, so the important faces show changes first.
+	const uint32_t ALL_FACES = (1 << 6) - 1;
+	const uint32_t FACES_PER_FILTER = 3;
+
+	if (p_sky->reflection.dirty) {
+		p_sky->reflection.dirty = false;
+		p_sky->stale_faces = ALL_FACES;
+	}
+
+	if (p_sky->stale_faces == 0 && p_sky->faces_since_filter == 0) {
+		return;
+	}
+
+	Vector3 camera_forward = -sky_scene_state.cam_transform.basis.get_column(Vector3::AXIS_Z).normalized();
+
+	RD::get_singleton()->draw_command_begin_label("Budgeted Sky Radiance Update");
+
+	for (int step = 0; step < sky_realtime_update_budget; step++) {
+		if (p_sky->faces_since_filter > 0 && (p_sky->faces_since_filter >= FACES_PER_FILTER || p_sky->stale_faces == 0)) {
+			p_sky->reflection.create_reflection_fast_filter(sky_use_cubemap_array);
+			if (sky_use_cubemap_array) {
+				p_sky->reflection.update_reflection_mipmaps(0, p_sky->reflection.layers.size());
+			}
+			p_sky->faces_since_filter = 0;
+			p_sky->baked_exposure = p_luminance_multiplier;
+			continue;
+		}
+
+		if (p_sky->stale_faces == 0) {
+			break;
+		}
+
+		int face = -1;
+		float best_priority = -1.0;
+		for (int i = 0; i < 6; i++) {
+			if (!(p_sky->stale_faces & (1 << i))) {
+				continue;
+			}
+			float weight = 1.0 + MAX(sky_cubemap_view_normals[i].y, 0.0) + 0.5 * MAX(sky_cubemap_view_normals[i].dot(camera_forward), 0.0);
+			float priority = (p_sky->face_age[i] + 1) * weight;
+			if (priority > best_priority) {
+				best_priority = priority;
+				face = i;
+			}
+		}
+
+		_render_radiance_face(p_sky, p_shader_data, p_material, face, p_render_buffers, p_global_pos, p_time, p_luminance_multiplier);
+		p_sky->stale_faces &= ~(1 << face);
+		p_sky->face_age[face] = 0;
+		p_sky->faces_since_filter++;
+	}
+
+	RD::get_singleton()->draw_command_end_label();
+
+	for (int i = 0; i < 6; i++) {
+		if (p_sky->stale_faces & (1 << i)) {
+			p_sky->face_age[i]++;
+		}
+	}
+
+	if (p_sky->stale_faces != 0 || p_sky->faces_since_filter > 0) {
+		// Keep drawing until the budgeted update has caught up.
+		RenderingServerDefault::redraw_request();
+	}
+}
+
 void SkyRD::update_radiance_buffers(Ref<RenderSceneBuffersRD> p_render_buffers, RID p_env, const Vector3 &p_global_pos, double p_time, float p_luminance_multiplier) {
 	ERR_FAIL_COND(p_render_buffers.is_null());
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
@@ -1274,26 +1441,18 @@ void SkyRD::update_radiance_buffers(Ref<RenderSceneBuffersRD> p_render_buffers,
 		sky_mode = RS::SKY_MODE_QUALITY;
 	}
 
+	if (sky_mode == RS::SKY_MODE_REALTIME && sky_realtime_update_budget > 0 && sky->processing_layer > 0) {
+		// The first update after (re)creating the sky is always a full one.
+		_update_radiance_budgeted(sky, shader_data, material, p_render_buffers, p_global_pos, p_time, p_luminance_multiplier);
+		return;
+	}
+
 	int max_processing_layer = sky_use_cubemap_array ? sky->reflection.layers.size() : sky->reflection.layers[0].mipmaps.size();
 
 	// Update radiance cubemap
 	if (sky->reflection.dirty && (sky->processing_layer >= max_processing_layer || update_single_frame)) {
-		static const Vector3 view_normals[6] = {
-			Vector3(+1, 0, 0),
-			Vector3(-1, 0, 0),
-			Vector3(0, +1, 0),
-			Vector3(0, -1, 0),
-			Vector3(0, 0, +1),
-			Vector3(0, 0, -1)
-		};
-		static const Vector3 view_up[6] = {
-			Vector3(0, -1, 0),
-			Vector3(0, -1, 0),
-			Vector3(0, 0, +1),
-			Vector3(0, 0, -1),
-			Vector3(0, -1, 0),
-			Vector3(0, -1, 0)
-		};
+		const Vector3 *view_normals = sky_cubemap_view_normals;
+		const Vector3 *view_up = sky_cubemap_view_up;
 
 		Projection cm;
 		cm.set_perspective(90, 1, 0.01, 10.0);
@@ -1364,6 +1523,7 @@ void SkyRD::update_radiance_buffers(Ref<RenderSceneBuffersRD> p_render_buffers,
 			if (sky_use_cubemap_array) {
 				sky->reflection.update_reflection_mipmaps(0, sky->reflection.layers.size());
 			}
+			sky->processing_layer = 1;
 		} else {
 			if (update_single_frame) {
 				for (int i = 1; i < max_processing_layer; i++) {
@@ -1645,6 +1805,8 @@ void SkyRD::update_dirty_skys() {
 
 		sky->reflection.dirty = true;
 		sky->processing_layer = 0;
+		sky->stale_faces = 0;
+		sky->faces_since_filter = 0;
 
 		Sky *next = sky->dirty_list;
 		sky->dirty_list = nullptr;
@@ -267,6 +267,12 @@ public:
 		SkyMaterialData *prev_material = nullptr;
 		Vector3 prev_position;
 		float prev_time;
+		LocalVector<SkyDirectionalLightData> radiance_lights; // Lights the radiance was last invalidated for.
+
+		// Budgeted real-time updates.
+		uint32_t stale_faces = 0; // Bitmask of cubemap faces that need to be rendered again.
+		uint32_t face_age[6] = {};
+		uint32_t faces_since_filter = 0;
 
 		void free();
 
@@ -282,6 +288,12 @@ public:
 	Sky *dirty_sky_list = nullptr;
 	mutable RID_Owner<Sky, true> sky_owner;
 	int roughness_layers;
+	int sky_realtime_update_budget;
+	float sky_realtime_change_threshold;
+
+	bool _sky_lights_changed(Sky *p_sky) const;
+	void _render_radiance_face(Sky *p_sky, SkyShaderData *p_shader_data, SkyMaterialData *p_material, int p_face, Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3 &p_global_pos, double p_time, float p_luminance_multiplier);
+	void _update_radiance_budgeted(Sky *p_sky, SkyShaderData *p_shader_data, SkyMaterialData *p_material, Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3 &p_global_pos, double p_time, float p_luminance_multiplier);
 
 	RendererRD::MaterialStorage::ShaderData *_create_sky_shader_func();
 	static RendererRD::MaterialStorage::ShaderData *_create_sky_shader_funcs();
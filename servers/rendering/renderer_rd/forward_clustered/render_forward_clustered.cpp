@@ -138,6 +138,14 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::free_data() {
 	if (!render_hddagi_uniform_set.is_null() && RD::get_singleton()->uniform_set_is_valid(render_hddagi_uniform_set)) {
 		RD::get_singleton()->free(render_hddagi_uniform_set);
 	}
+
+	if (depth_occlusion.buffer.is_valid()) {
+		RD::get_singleton()->free(depth_occlusion.buffer);
+		depth_occlusion.buffer = RID();
+	}
+	depth_occlusion.size = Size2i();
+	depth_occlusion.readback_pending = false;
+	depth_occlusion.hz_buffer.clear();
 }
 
 void RenderForwardClustered::RenderBufferDataForwardClustered::configure(RenderSceneBuffersRD *p_render_buffers) {
@@ -158,6 +166,17 @@ void RenderForwardClustered::RenderBufferDataForwardClustered::configure(RenderS
 	cluster_builder->setup(p_render_buffers->get_internal_size(), p_render_buffers->get_max_cluster_elements(), p_render_buffers->get_depth_texture(), sampler, p_render_buffers->get_internal_texture());
 }
 
+void RenderForwardClustered::RenderBufferDataForwardClustered::depth_occlusion_readback(const Vector<uint8_t> &p_data) {
+	depth_occlusion.readback_pending = false;
+
+	// The buffers may have been resized while the data was in flight.
+	if (depth_occlusion.size == Size2i() || p_data.size() != int(depth_occlusion.size.x * depth_occlusion.size.y * sizeof(float))) {
+		return;
+	}
+
+	depth_occlusion.hz_buffer.update((const float *)p_data.ptr(), depth_occlusion.readback_cam_transform, depth_occlusion.readback_cam_projection);
+}
+
 RID RenderForwardClustered::RenderBufferDataForwardClustered::get_color_only_fb() {
 	ERR_FAIL_NULL_V(render_buffers, RID());
 
@@ -263,6 +282,250 @@ void RenderForwardClustered::setup_render_buffer_data(Ref<RenderSceneBuffersRD>
 	p_render_buffers->set_custom_data(RB_SCOPE_GI, rbgi);
 }
 
+const RendererSceneOcclusionCull::DepthHZBuffer *RenderForwardClustered::render_buffers_get_depth_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers) const {
+	Ref<RenderSceneBuffersRD> rb = p_render_buffers;
+	if (depth_occlusion == nullptr || rb.is_null() || !rb->has_custom_data(RB_SCOPE_FORWARD_CLUSTERED)) {
+		return nullptr;
+	}
+
+	Ref<RenderBufferDataForwardClustered> rb_data = rb->get_custom_data(RB_SCOPE_FORWARD_CLUSTERED);
+	if (rb_data.is_null() || rb_data->depth_occlusion.hz_buffer.is_empty()) {
+		return nullptr;
+	}
+
+	return &rb_data->depth_occlusion.hz_buffer;
+}
+
+void RenderForwardClustered::_process_depth_occlusion(Ref<RenderSceneBuffersRD> p_render_buffers, Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data) {
+	RenderBufferDataForwardClustered::DepthOcclusionData &data = p_render_buffers_data->depth_occlusion;
+
+	// Only one reduction is in flight at a time, the buffer is refreshed as soon as the previous one arrives.
+	if (data.readback_pending) {
+		return;
+	}
+
+	Size2i internal_size = p_render_buffers->get_internal_size();
+	Size2i size = Size2i(Math::division_round_up(internal_size.x, RendererRD::DepthOcclusion::TEXEL_SIZE), Math::division_round_up(internal_size.y, RendererRD::DepthOcclusion::TEXEL_SIZE));
+
+	if (data.size != size) {
+		if (data.buffer.is_valid()) {
+			RD::get_singleton()->free(data.buffer);
+		}
+		data.buffer = RD::get_singleton()->storage_buffer_create(size.x * size.y * sizeof(float));
+		data.size = size;
+		data.hz_buffer.resize(size);
+	}
+
+	RD::get_singleton()->draw_command_begin_label("Depth Occlusion Buffer");
+
+	depth_occlusion->reduce_depth(p_render_buffers->get_depth_texture(), data.buffer, internal_size, size, p_render_data->scene_data->cam_projection, p_render_data->scene_data->flip_y);
+
+	data.readback_cam_transform = p_render_data->scene_data->cam_transform;
+	data.readback_cam_projection = p_render_data->scene_data->cam_projection;
+
+	if (RD::get_singleton()->buffer_get_data_async(data.buffer, callable_mp(p_render_buffers_data.ptr(), &RenderBufferDataForwardClustered::depth_occlusion_readback)) == OK) {
+		data.readback_pending = true;
+	}
+
+	RD::get_singleton()->draw_command_end_label();
+}
+
+uint64_t RenderForwardClustered::_cull_multimesh_instances(Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+
+	scene_state.multimesh_cull_pass++;
+
+	Vector<Plane> frustum = p_render_data->scene_data->cam_projection.get_projection_planes(p_render_data->scene_data->cam_transform);
+
+	// Test against the reduced depth of an earlier frame if there is one, the shader relies on a perspective projection.
+	RID occlusion_buffer;
+	Size2i occlusion_size;
+	Projection occlusion_view_projection;
+	float occlusion_z_near = 0.0;
+	if (p_render_buffers_data.is_valid() && p_render_buffers_data->depth_occlusion.buffer.is_valid() && !p_render_buffers_data->depth_occlusion.readback_cam_projection.is_orthogonal()) {
+		const RenderBufferDataForwardClustered::DepthOcclusionData &data = p_render_buffers_data->depth_occlusion;
+		occlusion_buffer = data.buffer;
+		occlusion_size = data.size;
+		occlusion_view_projection = data.readback_cam_projection * Projection(data.readback_cam_transform.affine_inverse());
+		occlusion_z_near = data.readback_cam_projection.get_z_near();
+	}
+
+	RD::get_singleton()->draw_command_begin_label("Cull MultiMesh Instances");
+
+	const RenderListType culled_lists[] = { RENDER_LIST_OPAQUE, RENDER_LIST_ALPHA };
+	for (const RenderListType list : culled_lists) {
+		for (uint32_t i = 0; i < render_list[list].elements.size(); i++) {
+			GeometryInstanceForwardClustered *inst = render_list[list].elements[i]->owner;
+			if (inst->multimesh_cull_pass == scene_state.multimesh_cull_pass || inst->data->base_type != RS::INSTANCE_MULTIMESH || inst->instance_count < multimesh_gpu_culling_min_instances) {
+				continue;
+			}
+
+			if (mesh_storage->multimesh_cull_instances(inst->data->base, inst->transform, frustum, occlusion_buffer, occlusion_size, occlusion_view_projection, occlusion_z_near)) {
+				inst->multimesh_cull_pass = scene_state.multimesh_cull_pass;
+				inst->multimesh_culled_uniform_set = mesh_storage->multimesh_get_culled_3d_uniform_set(inst->data->base, scene_shader.default_shader_rd, TRANSFORMS_UNIFORM_SET);
+				inst->multimesh_draw_commands_buffer = mesh_storage->multimesh_get_draw_commands_buffer(inst->data->base);
+			}
+		}
+	}
+
+	RD::get_singleton()->draw_command_end_label();
+
+	return scene_state.multimesh_cull_pass;
+}
+
+uint64_t RenderForwardClustered::_cull_mesh_clusters(Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data, bool p_reverse_cull) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+
+	scene_state.cluster_cull_pass++;
+
+	const Transform3D &cam_transform = p_render_data->scene_data->cam_transform;
+	Vector<Plane> frustum = p_render_data->scene_data->cam_projection.get_projection_planes(cam_transform);
+	// With an orthogonal projection every cluster is seen from the same direction, not from a point.
+	bool use_cone_culling = !p_render_data->scene_data->cam_projection.is_orthogonal();
+
+	RID occlusion_buffer;
+	Size2i occlusion_size;
+	Projection occlusion_view_projection;
+	float occlusion_z_near = 0.0;
+	if (p_render_buffers_data.is_valid() && p_render_buffers_data->depth_occlusion.buffer.is_valid() && !p_render_buffers_data->depth_occlusion.readback_cam_projection.is_orthogonal()) {
+		const RenderBufferDataForwardClustered::DepthOcclusionData &data = p_render_buffers_data->depth_occlusion;
+		occlusion_buffer = data.buffer;
+		occlusion_size = data.size;
+		occlusion_view_projection = data.readback_cam_projection * Projection(data.readback_cam_transform.affine_inverse());
+		occlusion_z_near = data.readback_cam_projection.get_z_near();
+	}
+	bool use_occlusion = occlusion_buffer.is_valid() && occlusion_size.x > 0 && occlusion_size.y > 0;
+
+	mesh_cluster_cull.elements.clear();
+	mesh_cluster_cull.surfaces.clear();
+	uint32_t cluster_total = 0;
+
+	// Only the first element of a run of repeated elements is drawn, and with instancing.
+	RenderList &rl = render_list[RENDER_LIST_OPAQUE];
+	for (uint32_t i = 0; i < rl.elements.size(); i += MAX(rl.element_info[i].repeat, 1u)) {
+		GeometryInstanceSurfaceDataCache *surf = rl.elements[i];
+		const RenderElementInfo &element_info = rl.element_info[i];
+		GeometryInstanceForwardClustered *inst = surf->owner;
+
+		if (!(surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_MESH_CLUSTERS) || surf->cluster_cull_pass == scene_state.cluster_cull_pass) {
+			continue;
+		}
+		// The clusters describe the base index array of a static mesh.
+		if (element_info.repeat != 1 || element_info.lod_index != 0 || inst->instance_count != 1 || inst->mesh_instance.is_valid() || !mesh_storage->mesh_surface_is_lod_resident(surf->surface, 0)) {
+			continue;
+		}
+
+		uint32_t cluster_count = mesh_storage->mesh_surface_get_cluster_count(surf->surface);
+		if (cluster_count == 0) {
+			continue;
+		}
+
+		MeshClusterCull::Element element;
+		memset(&element, 0, sizeof(MeshClusterCull::Element));
+
+		// Cluster bounds are in mesh space, so bring the camera there instead.
+		Transform3D inverse = inst->transform.affine_inverse();
+		Basis basis_transpose = inst->transform.basis.transposed();
+		for (int j = 0; j < 6; j++) {
+			Plane plane = Transform3D::xform_inv_fast(frustum[j], inverse, basis_transpose);
+			element.frustum_planes[j][0] = plane.normal.x;
+			element.frustum_planes[j][1] = plane.normal.y;
+			element.frustum_planes[j][2] = plane.normal.z;
+			element.frustum_planes[j][3] = plane.d;
+		}
+
+		Vector3 camera_position = inverse.xform(cam_transform.origin);
+		element.camera_position[0] = camera_position.x;
+		element.camera_position[1] = camera_position.y;
+		element.camera_position[2] = camera_position.z;
+
+		// Normal cones don't survive non-uniform scaling.
+		element.cone_cull_mode = MeshClusterCull::CONE_CULL_DISABLED;
+		if (use_cone_culling && surf->shader->cull_mode != SceneShaderForwardClustered::ShaderData::CULL_DISABLED && inst->transform.basis.is_conformal()) {
+			bool cull_front = surf->shader->cull_mode == SceneShaderForwardClustered::ShaderData::CULL_FRONT;
+			if (inst->mirror != p_reverse_cull) {
+				cull_front = !cull_front;
+			}
+			element.cone_cull_mode = cull_front ? MeshClusterCull::CONE_CULL_FRONT : MeshClusterCull::CONE_CULL_BACK;
+		}
+
+		if (use_occlusion) {
+			RendererRD::MaterialStorage::store_camera(occlusion_view_projection * Projection(inst->transform), element.occlusion_view_projection);
+		}
+
+		surf->cluster_cull_pass = scene_state.cluster_cull_pass;
+		surf->cluster_command_offset = cluster_total;
+		cluster_total += cluster_count;
+
+		mesh_cluster_cull.elements.push_back(element);
+		mesh_cluster_cull.surfaces.push_back(surf);
+	}
+
+	if (mesh_cluster_cull.elements.is_empty()) {
+		return scene_state.cluster_cull_pass;
+	}
+
+	if (mesh_cluster_cull.element_buffer_size < mesh_cluster_cull.elements.size()) {
+		if (mesh_cluster_cull.element_buffer.is_valid()) {
+			RD::get_singleton()->free(mesh_cluster_cull.element_buffer);
+		}
+		mesh_cluster_cull.element_buffer_size = next_power_of_2(mesh_cluster_cull.elements.size());
+		mesh_cluster_cull.element_buffer = RD::get_singleton()->storage_buffer_create(mesh_cluster_cull.element_buffer_size * sizeof(MeshClusterCull::Element));
+	}
+
+	if (mesh_cluster_cull.draw_commands_size < cluster_total) {
+		if (mesh_cluster_cull.draw_commands_buffer.is_valid()) {
+			RD::get_singleton()->free(mesh_cluster_cull.draw_commands_buffer);
+		}
+		mesh_cluster_cull.draw_commands_size = next_power_of_2(cluster_total);
+		mesh_cluster_cull.draw_commands_buffer = RD::get_singleton()->storage_buffer_create(mesh_cluster_cull.draw_commands_size * MeshClusterCull::DRAW_COMMAND_SIZE, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+	}
+
+	RD::get_singleton()->buffer_update(mesh_cluster_cull.element_buffer, 0, mesh_cluster_cull.elements.size() * sizeof(MeshClusterCull::Element), mesh_cluster_cull.elements.ptr());
+
+	uint32_t shader_mode = use_occlusion ? MeshClusterCull::SHADER_MODE_FRUSTUM_OCCLUSION : MeshClusterCull::SHADER_MODE_FRUSTUM;
+	RID shader = mesh_cluster_cull.version_shader[shader_mode];
+
+	RD::get_singleton()->draw_command_begin_label("Cull Mesh Clusters");
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, mesh_cluster_cull.pipeline[shader_mode]);
+
+	RD::Uniform u_elements(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, mesh_cluster_cull.element_buffer);
+	RD::Uniform u_draw_commands(RD::UNIFORM_TYPE_STORAGE_BUFFER, 1, mesh_cluster_cull.draw_commands_buffer);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, UniformSetCacheRD::get_singleton()->get_cache(shader, MeshClusterCull::UNIFORM_SET_PASS, u_elements, u_draw_commands), MeshClusterCull::UNIFORM_SET_PASS);
+
+	if (use_occlusion) {
+		RD::Uniform u_occlusion(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, occlusion_buffer);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, UniformSetCacheRD::get_singleton()->get_cache(shader, MeshClusterCull::UNIFORM_SET_OCCLUSION, u_occlusion), MeshClusterCull::UNIFORM_SET_OCCLUSION);
+	}
+
+	MeshClusterCull::PushConstant push_constant;
+	memset(&push_constant, 0, sizeof(MeshClusterCull::PushConstant));
+	push_constant.occlusion_z_near = occlusion_z_near;
+	push_constant.occlusion_size[0] = occlusion_size.x;
+	push_constant.occlusion_size[1] = occlusion_size.y;
+
+	for (uint32_t i = 0; i < mesh_cluster_cull.surfaces.size(); i++) {
+		GeometryInstanceSurfaceDataCache *surf = mesh_cluster_cull.surfaces[i];
+
+		RD::Uniform u_clusters(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, mesh_storage->mesh_surface_get_cluster_buffer(surf->surface));
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, UniformSetCacheRD::get_singleton()->get_cache(shader, MeshClusterCull::UNIFORM_SET_CLUSTERS, u_clusters), MeshClusterCull::UNIFORM_SET_CLUSTERS);
+
+		push_constant.element_index = i;
+		push_constant.cluster_count = mesh_storage->mesh_surface_get_cluster_count(surf->surface);
+		push_constant.command_offset = surf->cluster_command_offset;
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(MeshClusterCull::PushConstant));
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, push_constant.cluster_count, 1, 1);
+	}
+
+	RD::get_singleton()->compute_list_end();
+
+	RD::get_singleton()->draw_command_end_label();
+
+	return scene_state.cluster_cull_pass;
+}
+
 bool RenderForwardClustered::free(RID p_rid) {
 	if (RendererSceneRenderRD::free(p_rid)) {
 		return true;
@@ -376,6 +639,22 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 		RS::PrimitiveType primitive = surf->primitive;
 		RID xforms_uniform_set = surf->owner->transforms_uniform_set;
 
+		// The draw commands are written for the base index array, lower detail surfaces (or ones whose base index array
+		// is not streamed in yet) draw every instance.
+		bool use_culled_multimesh = p_params->multimesh_cull_pass != 0 && surf->owner->multimesh_cull_pass == p_params->multimesh_cull_pass && element_info.lod_index == 0 && mesh_storage->mesh_surface_is_lod_resident(mesh_surface, 0);
+		if (use_culled_multimesh) {
+			xforms_uniform_set = surf->owner->multimesh_culled_uniform_set;
+		}
+
+		// The shadow mesh keeps the index order of the mesh, so the depth prepass can use the same draw commands.
+		uint32_t cluster_count = 0;
+		if (p_params->cluster_cull_pass != 0 && surf->cluster_cull_pass == p_params->cluster_cull_pass && element_info.repeat == 1 && element_info.lod_index == 0 && mesh_storage->mesh_surface_is_lod_resident(mesh_surface, 0)) {
+			cluster_count = mesh_storage->mesh_surface_get_cluster_count(mesh_surface);
+			if (cluster_count != mesh_storage->mesh_surface_get_cluster_count(surf->surface)) {
+				cluster_count = 0;
+			}
+		}
+
 		SceneShaderForwardClustered::PipelineVersion pipeline_version = SceneShaderForwardClustered::PIPELINE_VERSION_MAX; // Assigned to silence wrong -Wmaybe-initialized.
 		uint32_t pipeline_color_pass_flags = 0;
 		uint32_t pipeline_specialization = p_params->spec_constant_base_flags;
@@ -519,7 +798,13 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			instance_count /= surf->owner->trail_steps;
 		}
 
-		RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		if (use_culled_multimesh) {
+			RD::get_singleton()->draw_list_draw_indirect(draw_list, index_array_rd.is_valid(), surf->owner->multimesh_draw_commands_buffer, surf->surface_index * RendererRD::MeshStorage::MULTIMESH_DRAW_COMMAND_SIZE);
+		} else if (cluster_count > 0) {
+			RD::get_singleton()->draw_list_draw_indirect(draw_list, true, mesh_cluster_cull.draw_commands_buffer, surf->cluster_command_offset * MeshClusterCull::DRAW_COMMAND_SIZE, cluster_count);
+		} else {
+			RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		}
 		i += element_info.repeat - 1; //skip equal elements
 	}
 
@@ -767,6 +1052,8 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 		instance_data.uv_scale[3] = uv_scale.w;
 
 		bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
+		// Clusters are culled per instance, which beats drawing every triangle of all the instances at once.
+		cant_repeat = cant_repeat || (p_render_list == RENDER_LIST_OPAQUE && (surface->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_MESH_CLUSTERS));
 
 		if (prev_surface != nullptr && !cant_repeat && prev_surface->sort.sort_key1 == surface->sort.sort_key1 && prev_surface->sort.sort_key2 == surface->sort.sort_key2 && inst->mirror == prev_surface->owner->mirror && repeats < RenderElementInfo::MAX_REPEATS) {
 			//this element is the same as the previous one, count repeats to draw it using instancing
@@ -1655,6 +1942,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	bool using_debug_mvs = get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS;
 	bool using_taa = rb->get_use_taa();
 	bool using_fsr2 = rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR2;
+	bool using_adaptive_vrs = rb->get_render_target().is_valid() && rb->has_texture(RB_SCOPE_VRS, RB_TEXTURE) && RendererRD::TextureStorage::get_singleton()->render_target_get_vrs_mode(rb->get_render_target()) == RS::VIEWPORT_VRS_ADAPTIVE;
 
 	// check if we need motion vectors
 	bool motion_vectors_required;
@@ -1666,6 +1954,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		motion_vectors_required = true;
 	} else if (!is_reflection_probe && using_fsr2) {
 		motion_vectors_required = true;
+	} else if (!is_reflection_probe && using_adaptive_vrs) {
+		motion_vectors_required = true;
 	} else {
 		motion_vectors_required = false;
 	}
@@ -1762,6 +2052,16 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	_fill_instance_data(RENDER_LIST_MOTION, render_info);
 	_fill_instance_data(RENDER_LIST_ALPHA);
 
+	uint64_t multimesh_cull_pass = 0;
+	if (multimesh_gpu_culling && !is_reflection_probe && p_render_data->scene_data->view_count == 1) {
+		multimesh_cull_pass = _cull_multimesh_instances(rb_data, p_render_data);
+	}
+
+	uint64_t cluster_cull_pass = 0;
+	if (mesh_cluster_cull.enabled && !is_reflection_probe && p_render_data->scene_data->view_count == 1) {
+		cluster_cull_pass = _cull_mesh_clusters(rb_data, p_render_data, reverse_cull);
+	}
+
 	RD::get_singleton()->draw_command_end_label();
 
 	if (!is_reflection_probe) {
@@ -1894,6 +2194,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 			RID sky_rid = environment_get_sky(p_render_data->environment);
 			if (sky_rid.is_valid()) {
+				RENDER_TIMESTAMP("Update Sky Radiance");
 				sky.update_radiance_buffers(rb, p_render_data->environment, p_render_data->scene_data->cam_transform.origin, time, sky_energy_multiplier);
 				radiance_texture = sky.sky_get_radiance_texture_rd(sky_rid);
 			} else {
@@ -1958,6 +2259,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 		bool finish_depth = using_ssao || using_ssil || using_hddagi || using_voxelgi || ce_pre_opaque_resolved_depth || ce_post_opaque_resolved_depth;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, depth_pass_mode, 0, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count, 0, spec_constant_base_flags);
+		render_list_params.multimesh_cull_pass = multimesh_cull_pass;
+		render_list_params.cluster_cull_pass = cluster_cull_pass;
 		
 		_render_list_with_draw_list(&render_list_params, depth_framebuffer, needs_pre_resolve ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, needs_pre_resolve ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, needs_pre_resolve ? Vector<Color>() : depth_pass_clear);
 
@@ -2038,6 +2341,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			uint32_t opaque_color_pass_flags = using_motion_pass ? (color_pass_flags & ~COLOR_PASS_FLAG_MOTION_VECTORS) : color_pass_flags;
 			RID opaque_framebuffer = using_motion_pass ? rb_data->get_color_pass_fb(opaque_color_pass_flags) : color_framebuffer;
 			RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, PASS_MODE_COLOR, opaque_color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count, 0, spec_constant_base_flags);
+			render_list_params.multimesh_cull_pass = multimesh_cull_pass;
+			render_list_params.cluster_cull_pass = cluster_cull_pass;
 			_render_list_with_draw_list(&render_list_params, opaque_framebuffer, load_color ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, depth_pre_pass ? RD::INITIAL_ACTION_LOAD : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, c, 0.0, 0);
 		}
 
@@ -2238,6 +2543,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 		RID alpha_framebuffer = rb_data.is_valid() ? rb_data->get_color_pass_fb(transparent_color_pass_flags) : color_only_framebuffer;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_ALPHA].elements.ptr(), render_list[RENDER_LIST_ALPHA].element_info.ptr(), render_list[RENDER_LIST_ALPHA].elements.size(), false, PASS_MODE_COLOR, transparent_color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count, 0, spec_constant_base_flags);
+		render_list_params.multimesh_cull_pass = multimesh_cull_pass;
 		_render_list_with_draw_list(&render_list_params, alpha_framebuffer, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE);
 	}
 
@@ -2248,7 +2554,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	RD::get_singleton()->draw_command_begin_label("Resolve");
 
 	if (rb_data.is_valid() && use_msaa) {
-		bool resolve_velocity_buffer = (using_taa || using_fsr2 || ce_needs_motion_vectors) && rb->has_velocity_buffer(true);
+		bool resolve_velocity_buffer = (using_taa || using_fsr2 || using_adaptive_vrs || ce_needs_motion_vectors) && rb->has_velocity_buffer(true);
 		for (uint32_t v = 0; v < rb->get_view_count(); v++) {
 			RD::get_singleton()->texture_resolve_multisample(rb->get_color_msaa(v), rb->get_internal_texture(v));
 			resolve_effects->resolve_depth(rb->get_depth_msaa(v), rb->get_depth_texture(v), rb->get_internal_size(), texture_multisamples[msaa]);
@@ -2261,6 +2567,11 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 	RD::get_singleton()->draw_command_end_label();
 
+	if (depth_occlusion != nullptr && rb_data.is_valid() && p_render_data->reflection_probe.is_null() && p_render_data->scene_data->view_count == 1) {
+		RENDER_TIMESTAMP("Depth Occlusion Buffer");
+		_process_depth_occlusion(rb, rb_data, p_render_data);
+	}
+
 	{
 		RENDER_TIMESTAMP("Process Post Transparent Compositor Effects");
 		_process_compositor_effects(RS::COMPOSITOR_EFFECT_CALLBACK_TYPE_POST_TRANSPARENT, p_render_data);
@@ -2667,7 +2978,7 @@ void RenderForwardClustered::_render_shadow_end() {
 	RD::get_singleton()->draw_command_end_label();
 }
 
-void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) {
+void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_region) {
 	RENDER_TIMESTAMP("Setup GPUParticlesCollisionHeightField3D");
 
 	RD::get_singleton()->draw_command_begin_label("Render Collider Heightfield");
@@ -2708,7 +3019,7 @@ void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, con
 	{
 		//regular forward for now
 		RenderListParameters render_list_params(render_list[RENDER_LIST_SECONDARY].elements.ptr(), render_list[RENDER_LIST_SECONDARY].element_info.ptr(), render_list[RENDER_LIST_SECONDARY].elements.size(), false, pass_mode, 0, true, false, rp_uniform_set);
-		_render_list_with_draw_list(&render_list_params, p_fb, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE);
+		_render_list_with_draw_list(&render_list_params, p_fb, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, Vector<Color>(), 0.0, 0, p_region);
 	}
 	RD::get_singleton()->draw_command_end_label();
 }
@@ -3848,6 +4159,10 @@ void RenderForwardClustered::_geometry_instance_add_surface_with_material(Geomet
 	sdcache->primitive = mesh_storage->mesh_surface_get_primitive(sdcache->surface);
 	sdcache->surface_index = p_surface;
 
+	if (mesh_cluster_cull.enabled && sdcache->primitive == RS::PRIMITIVE_TRIANGLES && mesh_storage->mesh_surface_get_cluster_count(sdcache->surface) > 0) {
+		sdcache->flags |= GeometryInstanceSurfaceDataCache::FLAG_USES_MESH_CLUSTERS;
+	}
+
 	if (ginstance->data->dirty_dependencies) {
 		RSG::utilities->base_update_dependency(p_mesh, &ginstance->data->dependency_tracker);
 	}
@@ -4380,6 +4695,29 @@ RenderForwardClustered::RenderForwardClustered() {
 	taa = memnew(RendererRD::TAA);
 	fsr2_effect = memnew(RendererRD::FSR2Effect);
 	ss_effects = memnew(RendererRD::SSEffects);
+
+	if (GLOBAL_GET("rendering/occlusion_culling/use_depth_buffer")) {
+		depth_occlusion = memnew(RendererRD::DepthOcclusion);
+	}
+
+	multimesh_gpu_culling = GLOBAL_GET("rendering/multimesh/gpu_culling/enabled");
+	multimesh_gpu_culling_min_instances = GLOBAL_GET("rendering/multimesh/gpu_culling/min_instances");
+
+	// Every cluster is drawn by its own indirect command, which needs multi-draw support to be issued at once.
+	if (GLOBAL_GET("rendering/mesh_clusters/gpu_culling/enabled") && RD::get_singleton()->has_feature(RD::SUPPORTS_MULTI_DRAW_INDIRECT)) {
+		mesh_cluster_cull.enabled = true;
+
+		Vector<String> modes;
+		modes.push_back("");
+		modes.push_back("\n#define USE_OCCLUSION\n");
+
+		mesh_cluster_cull.shader.initialize(modes);
+		mesh_cluster_cull.shader_version = mesh_cluster_cull.shader.version_create();
+		for (int i = 0; i < MeshClusterCull::SHADER_MODE_MAX; i++) {
+			mesh_cluster_cull.version_shader[i] = mesh_cluster_cull.shader.version_get_shader(mesh_cluster_cull.shader_version, i);
+			mesh_cluster_cull.pipeline[i] = RD::get_singleton()->compute_pipeline_create(mesh_cluster_cull.version_shader[i]);
+		}
+	}
 }
 
 RenderForwardClustered::~RenderForwardClustered() {
@@ -4403,10 +4741,25 @@ RenderForwardClustered::~RenderForwardClustered() {
 		resolve_effects = nullptr;
 	}
 
+	if (depth_occlusion != nullptr) {
+		memdelete(depth_occlusion);
+		depth_occlusion = nullptr;
+	}
+
 	RD::get_singleton()->free(shadow_sampler);
 	RSG::light_storage->directional_shadow_atlas_set_size(0);
 	RD::get_singleton()->free(best_fit_normal.texture);
 
+	if (mesh_cluster_cull.enabled) {
+		if (mesh_cluster_cull.element_buffer.is_valid()) {
+			RD::get_singleton()->free(mesh_cluster_cull.element_buffer);
+		}
+		if (mesh_cluster_cull.draw_commands_buffer.is_valid()) {
+			RD::get_singleton()->free(mesh_cluster_cull.draw_commands_buffer);
+		}
+		mesh_cluster_cull.shader.version_free(mesh_cluster_cull.shader_version);
+	}
+
 	{
 		for (const RID &rid : scene_state.uniform_buffers) {
 			RD::get_singleton()->free(rid);
@@ -32,7 +32,9 @@
 #define RENDER_FORWARD_CLUSTERED_H
 
 #include "core/templates/paged_allocator.h"
+#include "core/templates/radix_sort.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
+#include "servers/rendering/renderer_rd/effects/depth_occlusion.h"
 #include "servers/rendering/renderer_rd/effects/fsr2.h"
 #include "servers/rendering/renderer_rd/effects/resolve.h"
 #include "servers/rendering/renderer_rd/effects/ss_effects.h"
@@ -41,6 +43,7 @@
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/shaders/forward_clustered/best_fit_normal.glsl.gen.h"
+#include "servers/rendering/renderer_rd/shaders/forward_clustered/mesh_cluster_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/forward_clustered/scene_forward_clustered.glsl.gen.h"
 #include "servers/rendering/renderer_rd/storage_rd/utilities.h"
 
@@ -124,6 +127,19 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 		RID render_hddagi_uniform_set;
 
+		// Reduced depth of an earlier frame, read back asynchronously to be used for occlusion culling.
+		struct DepthOcclusionData {
+			RID buffer;
+			Size2i size;
+			bool readback_pending = false;
+			Transform3D readback_cam_transform;
+			Projection readback_cam_projection;
+
+			RendererSceneOcclusionCull::DepthHZBuffer hz_buffer;
+		} depth_occlusion;
+
+		void depth_occlusion_readback(const Vector<uint8_t> &p_data);
+
 		void ensure_specular();
 		bool has_specular() const { return render_buffers->has_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR); }
 		RID get_specular() const { return render_buffers->get_texture(RB_SCOPE_FORWARD_CLUSTERED, RB_TEX_SPECULAR); }
@@ -157,6 +173,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	};
 
 	virtual void setup_render_buffer_data(Ref<RenderSceneBuffersRD> p_render_buffers) override;
+	virtual const RendererSceneOcclusionCull::DepthHZBuffer *render_buffers_get_depth_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers) const override;
 
 	RID render_base_uniform_set;
 
@@ -212,6 +229,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		uint32_t element_offset = 0;
 		bool use_directional_soft_shadow = false;
 		uint32_t spec_constant_base_flags = 0;
+		uint64_t multimesh_cull_pass = 0; // MultiMesh instances culled in this pass are drawn indirectly.
+		uint64_t cluster_cull_pass = 0; // Surfaces whose clusters were culled in this pass are drawn indirectly.
 
 		RenderListParameters(GeometryInstanceSurfaceDataCache **p_elements, RenderElementInfo *p_element_info, int p_element_count, bool p_reverse_cull, PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_no_gi, bool p_use_directional_soft_shadows, RID p_render_pass_uniform_set, bool p_force_wireframe = false, const Vector2 &p_uv_offset = Vector2(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, uint32_t p_view_count = 1, uint32_t p_element_offset = 0, uint32_t p_spec_constant_base_flags = 0) {
 			elements = p_elements;
@@ -357,6 +376,9 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 		LocalVector<ShadowPass> shadow_passes;
 
+		uint64_t multimesh_cull_pass = 0;
+		uint64_t cluster_cull_pass = 0;
+
 	} scene_state;
 
 	static RenderForwardClustered *singleton;
@@ -408,6 +430,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			FLAG_USES_DOUBLE_SIDED_SHADOWS = 32768,
 			FLAG_USES_PARTICLE_TRAILS = 65536,
 			FLAG_USES_MOTION_VECTOR = 131072,
+			FLAG_USES_MESH_CLUSTERS = 262144,
 		};
 
 		union {
@@ -446,6 +469,10 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		RID material_uniform_set_shadow;
 		SceneShaderForwardClustered::ShaderData *shader_shadow = nullptr;
 
+		// Clusters culled on the GPU, only valid for the render pass matching cluster_cull_pass.
+		uint64_t cluster_cull_pass = 0;
+		uint32_t cluster_command_offset = 0;
+
 		GeometryInstanceSurfaceDataCache *next = nullptr;
 		GeometryInstanceForwardClustered *owner = nullptr;
 	};
@@ -469,6 +496,11 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		bool using_projectors = false;
 		bool using_softshadows = false;
 
+		// GPU culled MultiMesh instances, only valid for the render pass matching multimesh_cull_pass.
+		uint64_t multimesh_cull_pass = 0;
+		RID multimesh_culled_uniform_set;
+		RID multimesh_draw_commands_buffer;
+
 		//used during setup
 		uint64_t prev_transform_change_frame = 0xFFFFFFFF;
 		bool prev_transform_dirty = true;
@@ -515,51 +547,46 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
 		LocalVector<RenderElementInfo> element_info;
 
+		RadixSort<GeometryInstanceSurfaceDataCache *> sorter;
+		LocalVector<uint64_t> sort_keys;
+
 		void clear() {
 			elements.clear();
 			element_info.clear();
 		}
 
-		//should eventually be replaced by radix
-
-		struct SortByKey {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->sort.sort_key2 == B->sort.sort_key2) ? (A->sort.sort_key1 < B->sort.sort_key1) : (A->sort.sort_key2 < B->sort.sort_key2);
-			}
-		};
-
 		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sort_by_key_range(0, elements.size());
 		}
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr() + p_from, p_size);
-		}
-
-		struct SortByDepth {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->owner->depth < B->owner->depth);
+			// The 128-bit key is sorted in two stable passes, least significant half first.
+			GeometryInstanceSurfaceDataCache **range = elements.ptr() + p_from;
+			sort_keys.resize(p_size);
+			for (uint32_t i = 0; i < p_size; i++) {
+				sort_keys[i] = range[i]->sort.sort_key1;
 			}
-		};
-
-		void sort_by_depth() { //used for shadows
-
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByDepth> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sorter.sort(range, sort_keys.ptr(), p_size);
+			for (uint32_t i = 0; i < p_size; i++) {
+				sort_keys[i] = range[i]->sort.sort_key2;
+			}
+			sorter.sort(range, sort_keys.ptr(), p_size);
 		}
 
-		struct SortByReverseDepthAndPriority {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->sort.priority == B->sort.priority) ? (A->owner->depth > B->owner->depth) : (A->sort.priority < B->sort.priority);
+		void sort_by_depth() { //used for shadows
+			sort_keys.resize(elements.size());
+			for (uint32_t i = 0; i < elements.size(); i++) {
+				sort_keys[i] = radix_sort_float_key(elements[i]->owner->depth);
 			}
-		};
+			sorter.sort(elements.ptr(), sort_keys.ptr(), elements.size());
+		}
 
 		void sort_by_reverse_depth_and_priority() { //used for alpha
-
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByReverseDepthAndPriority> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sort_keys.resize(elements.size());
+			for (uint32_t i = 0; i < elements.size(); i++) {
+				sort_keys[i] = (uint64_t(elements[i]->sort.priority) << 32) | uint64_t(~radix_sort_float_key(elements[i]->owner->depth));
+			}
+			sorter.sort(elements.ptr(), sort_keys.ptr(), elements.size());
 		}
 
 		_FORCE_INLINE_ void add_element(GeometryInstanceSurfaceDataCache *p_element) {
@@ -577,6 +604,78 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	RendererRD::TAA *taa = nullptr;
 	RendererRD::FSR2Effect *fsr2_effect = nullptr;
 	RendererRD::SSEffects *ss_effects = nullptr;
+	RendererRD::DepthOcclusion *depth_occlusion = nullptr;
+
+	void _process_depth_occlusion(Ref<RenderSceneBuffersRD> p_render_buffers, Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data);
+
+	/* MultiMesh GPU culling */
+
+	bool multimesh_gpu_culling = false;
+	uint32_t multimesh_gpu_culling_min_instances = 0;
+
+	uint64_t _cull_multimesh_instances(Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data);
+
+	/* Mesh cluster GPU culling */
+
+	struct MeshClusterCull {
+		// Matches Element in mesh_cluster_cull.glsl, one per culled surface.
+		struct Element {
+			float frustum_planes[6][4];
+
+			float camera_position[3];
+			uint32_t cone_cull_mode;
+
+			float occlusion_view_projection[16];
+		};
+
+		struct PushConstant {
+			uint32_t element_index;
+			uint32_t cluster_count;
+			uint32_t command_offset;
+			float occlusion_z_near;
+
+			uint32_t occlusion_size[2];
+			uint32_t pad[2];
+		};
+
+		enum ConeCullMode {
+			CONE_CULL_DISABLED,
+			CONE_CULL_BACK,
+			CONE_CULL_FRONT,
+		};
+
+		enum {
+			SHADER_MODE_FRUSTUM,
+			SHADER_MODE_FRUSTUM_OCCLUSION,
+			SHADER_MODE_MAX
+		};
+
+		enum {
+			UNIFORM_SET_PASS = 0,
+			UNIFORM_SET_CLUSTERS = 1,
+			UNIFORM_SET_OCCLUSION = 2,
+		};
+
+		// Each cluster gets an indexed indirect draw command, culled ones draw zero instances.
+		static const uint32_t DRAW_COMMAND_SIZE = 5 * sizeof(uint32_t);
+
+		MeshClusterCullShaderRD shader;
+		RID shader_version;
+		RID version_shader[SHADER_MODE_MAX];
+		RID pipeline[SHADER_MODE_MAX];
+
+		bool enabled = false;
+
+		LocalVector<Element> elements;
+		LocalVector<GeometryInstanceSurfaceDataCache *> surfaces;
+
+		RID element_buffer;
+		uint32_t element_buffer_size = 0; // In elements.
+		RID draw_commands_buffer;
+		uint32_t draw_commands_size = 0; // In clusters.
+	} mesh_cluster_cull;
+
+	uint64_t _cull_mesh_clusters(Ref<RenderBufferDataForwardClustered> p_render_buffers_data, const RenderDataRD *p_render_data, bool p_reverse_cull);
 
 	/* Cluster builder */
 
@@ -631,7 +730,7 @@ protected:
 	virtual void _render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region, float p_exposure_normalization) override;
 	virtual void _render_uv2(const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override;
 	virtual void _render_hddagi(Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3i &p_from, const Vector3i &p_size, const AABB &p_bounds, const PagedArray<RenderGeometryInstance *> &p_instances, const RID &p_albedo_texture, const RID &p_emission_texture, const RID &p_emission_aniso_texture, const RID &p_normal_bits_texture, float p_exposure_normalization) override;
-	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) override;
+	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_region) override;
 
 public:
 	static RenderForwardClustered *get_singleton() { return singleton; }
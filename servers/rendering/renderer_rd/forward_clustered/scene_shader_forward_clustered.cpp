@@ -238,6 +238,18 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code, RID
 	print_line("\n**vertex_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX]);
 	print_line("\n**fragment_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT]);
 #endif
+	// Wait for background pipeline compiles before the shader they use is replaced.
+	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
+		for (int j = 0; j < RS::PRIMITIVE_MAX; j++) {
+			for (int k = 0; k < PIPELINE_VERSION_MAX; k++) {
+				pipelines[i][j][k].clear();
+			}
+			for (int k = 0; k < PIPELINE_COLOR_PASS_FLAG_COUNT; k++) {
+				color_pipelines[i][j][k].clear();
+			}
+		}
+	}
+
 	material_storage->shader_template_version_set_code(shader_template, version, gen_code.code, gen_code.uniforms, gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX], gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT], gen_code.defines);
 	ERR_FAIL_COND(!material_storage->shader_template_version_is_valid(shader_template, version));
 
@@ -441,6 +453,8 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code, RID
 
 						RID shader_variant = material_storage->shader_template_version_get_shader(shader_template, version, variant);
 						color_pipelines[i][j][l].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+						// Lights check for projectors and soft shadows at runtime, so a version with these enabled can stand in while the exact one compiles.
+						color_pipelines[i][j][l].set_fallback_specializations(SHADER_SPECIALIZATION_PROJECTOR | SHADER_SPECIALIZATION_SOFT_SHADOWS | SHADER_SPECIALIZATION_DIRECTIONAL_SOFT_SHADOWS, 0);
 					}
 				} else {
 					RD::PipelineColorBlendState blend_state;
@@ -495,7 +509,18 @@ SceneShaderForwardClustered::ShaderData::~ShaderData() {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	ERR_FAIL_NULL(material_storage);
 
-	//pipeline variants will clear themselves if shader is gone
+	// Pipeline variants will clear themselves if shader is gone, but background compiles must be done first.
+	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
+		for (int j = 0; j < RS::PRIMITIVE_MAX; j++) {
+			for (int k = 0; k < PIPELINE_VERSION_MAX; k++) {
+				pipelines[i][j][k].clear();
+			}
+			for (int k = 0; k < PIPELINE_COLOR_PASS_FLAG_COUNT; k++) {
+				color_pipelines[i][j][k].clear();
+			}
+		}
+	}
+
 	if (version.is_valid()) {
 		material_storage->shader_template_version_free(shader_template, version);
 	}
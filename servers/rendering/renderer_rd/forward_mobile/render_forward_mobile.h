@@ -32,6 +32,7 @@
 #define RENDER_FORWARD_MOBILE_H
 
 #include "core/templates/paged_allocator.h"
+#include "core/templates/radix_sort.h"
 #include "servers/rendering/renderer_rd/forward_mobile/scene_shader_forward_mobile.h"
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
@@ -289,51 +290,46 @@ private:
 		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
 		LocalVector<RenderElementInfo> element_info;
 
+		RadixSort<GeometryInstanceSurfaceDataCache *> sorter;
+		LocalVector<uint64_t> sort_keys;
+
 		void clear() {
 			elements.clear();
 			element_info.clear();
 		}
 
-		//should eventually be replaced by radix
-
-		struct SortByKey {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->sort.sort_key2 == B->sort.sort_key2) ? (A->sort.sort_key1 < B->sort.sort_key1) : (A->sort.sort_key2 < B->sort.sort_key2);
-			}
-		};
-
 		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sort_by_key_range(0, elements.size());
 		}
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr() + p_from, p_size);
-		}
-
-		struct SortByDepth {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->owner->depth < B->owner->depth);
+			// The 128-bit key is sorted in two stable passes, least significant half first.
+			GeometryInstanceSurfaceDataCache **range = elements.ptr() + p_from;
+			sort_keys.resize(p_size);
+			for (uint32_t i = 0; i < p_size; i++) {
+				sort_keys[i] = range[i]->sort.sort_key1;
 			}
-		};
-
-		void sort_by_depth() { //used for shadows
-
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByDepth> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sorter.sort(range, sort_keys.ptr(), p_size);
+			for (uint32_t i = 0; i < p_size; i++) {
+				sort_keys[i] = range[i]->sort.sort_key2;
+			}
+			sorter.sort(range, sort_keys.ptr(), p_size);
 		}
 
-		struct SortByReverseDepthAndPriority {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
-				return (A->sort.priority == B->sort.priority) ? (A->owner->depth > B->owner->depth) : (A->sort.priority < B->sort.priority);
+		void sort_by_depth() { //used for shadows
+			sort_keys.resize(elements.size());
+			for (uint32_t i = 0; i < elements.size(); i++) {
+				sort_keys[i] = radix_sort_float_key(elements[i]->owner->depth);
 			}
-		};
+			sorter.sort(elements.ptr(), sort_keys.ptr(), elements.size());
+		}
 
 		void sort_by_reverse_depth_and_priority() { //used for alpha
-
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByReverseDepthAndPriority> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sort_keys.resize(elements.size());
+			for (uint32_t i = 0; i < elements.size(); i++) {
+				sort_keys[i] = (uint64_t(elements[i]->sort.priority) << 32) | uint64_t(~radix_sort_float_key(elements[i]->owner->depth));
+			}
+			sorter.sort(elements.ptr(), sort_keys.ptr(), elements.size());
 		}
 
 		_FORCE_INLINE_ void add_element(GeometryInstanceSurfaceDataCache *p_element) {
@@ -511,7 +507,7 @@ protected:
 	virtual void _render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region, float p_exposure_normalization) override;
 	virtual void _render_uv2(const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override;
 	virtual void _render_hddagi(Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3i &p_from, const Vector3i &p_size, const AABB &p_bounds, const PagedArray<RenderGeometryInstance *> &p_instances, const RID &p_albedo_texture, const RID &p_emission_texture, const RID &p_emission_aniso_texture, const RID &p_normal_bits_texture, float p_exposure_normalization) override;
-	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) override;
+	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_region) override;
 
 	/* Forward ID */
 
@@ -219,6 +219,15 @@ void SceneShaderForwardMobile::ShaderData::set_code(const String &p_code, RID p_
 	print_line("\n**fragment_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT]);
 #endif
 
+	// Wait for background pipeline compiles before the shader they use is replaced.
+	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
+		for (int j = 0; j < RS::PRIMITIVE_MAX; j++) {
+			for (int k = 0; k < SHADER_VERSION_MAX; k++) {
+				pipelines[i][j][k].clear();
+			}
+		}
+	}
+
 	material_storage->shader_template_version_set_code(shader_template, version, gen_code.code, gen_code.uniforms, gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX], gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT], gen_code.defines);
 	ERR_FAIL_COND(!material_storage->shader_template_version_is_valid(shader_template, version));
 
@@ -384,6 +393,14 @@ void SceneShaderForwardMobile::ShaderData::set_code(const String &p_code, RID p_
 
 				RID shader_variant = material_storage->shader_template_version_get_shader(shader_template, version, k);
 				pipelines[i][j][k].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+
+				if (k != SHADER_VERSION_SHADOW_PASS && k != SHADER_VERSION_SHADOW_PASS_MULTIVIEW && k != SHADER_VERSION_SHADOW_PASS_DP) {
+					// Lights check for projectors and soft shadows at runtime and loops over zero lights just fine,
+					// so a version with these forced on (or off) can stand in while the exact one compiles.
+					uint32_t fallback_enabled = (1 << RenderForwardMobile::SPEC_CONSTANT_USING_PROJECTOR) | (1 << RenderForwardMobile::SPEC_CONSTANT_USING_SOFT_SHADOWS) | (1 << RenderForwardMobile::SPEC_CONSTANT_USING_DIRECTIONAL_SOFT_SHADOWS);
+					uint32_t fallback_disabled = (1 << RenderForwardMobile::SPEC_CONSTANT_DISABLE_OMNI_LIGHTS) | (1 << RenderForwardMobile::SPEC_CONSTANT_DISABLE_SPOT_LIGHTS) | (1 << RenderForwardMobile::SPEC_CONSTANT_DISABLE_REFLECTION_PROBES) | (1 << RenderForwardMobile::SPEC_CONSTANT_DISABLE_DECALS);
+					pipelines[i][j][k].set_fallback_specializations(fallback_enabled, fallback_disabled);
+				}
 			}
 		}
 	}
@@ -417,7 +434,15 @@ SceneShaderForwardMobile::ShaderData::~ShaderData() {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 	ERR_FAIL_NULL(material_storage);
 
-	//pipeline variants will clear themselves if shader is gone
+	// Pipeline variants will clear themselves if shader is gone, but background compiles must be done first.
+	for (int i = 0; i < CULL_VARIANT_MAX; i++) {
+		for (int j = 0; j < RS::PRIMITIVE_MAX; j++) {
+			for (int k = 0; k < SHADER_VERSION_MAX; k++) {
+				pipelines[i][j][k].clear();
+			}
+		}
+	}
+
 	if (version.is_valid()) {
 		material_storage->shader_template_version_free(shader_template, version);
 	}
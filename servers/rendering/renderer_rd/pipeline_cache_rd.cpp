@@ -32,14 +32,16 @@
 
 #include "core/os/memory.h"
 
-RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
-	RD::PipelineMultisampleState multisample_state_version = multisample_state;
-	multisample_state_version.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
+bool PipelineCacheRD::background_compilation = false;
+SafeNumeric<uint32_t> PipelineCacheRD::pending_compilations;
+SafeNumeric<uint64_t> PipelineCacheRD::completed_compilations;
 
-	bool wireframe = p_wireframe;
+RID PipelineCacheRD::_create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, RD::TextureSamples p_samples) const {
+	RD::PipelineMultisampleState multisample_state_version = multisample_state;
+	multisample_state_version.sample_count = p_samples;
 
 	RD::PipelineRasterizationState raster_state_version = rasterization_state;
-	raster_state_version.wireframe = wireframe;
+	raster_state_version.wireframe = p_wireframe;
 
 	Vector<RD::PipelineSpecializationConstant> specialization_constants = base_specialization_constants;
 
@@ -57,20 +59,109 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 		bool_index++;
 	}
 
-	RID pipeline = RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
-	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	return RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
+}
+
+void PipelineCacheRD::_add_version(const Version &p_version) {
 	versions = static_cast<Version *>(memrealloc(versions, sizeof(Version) * (version_count + 1)));
-	versions[version_count].framebuffer_id = p_framebuffer_format_id;
-	versions[version_count].vertex_id = p_vertex_format_id;
-	versions[version_count].wireframe = wireframe;
-	versions[version_count].pipeline = pipeline;
-	versions[version_count].render_pass = p_render_pass;
-	versions[version_count].bool_specializations = p_bool_specializations;
+	versions[version_count] = p_version;
 	version_count++;
+}
+
+RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	RD::TextureSamples samples = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
+	RID pipeline = _create_pipeline(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, samples);
+	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+
+	Version version;
+	version.framebuffer_id = p_framebuffer_format_id;
+	version.vertex_id = p_vertex_format_id;
+	version.wireframe = p_wireframe;
+	version.pipeline = pipeline;
+	version.render_pass = p_render_pass;
+	version.bool_specializations = p_bool_specializations;
+	_add_version(version);
 	return pipeline;
 }
 
+void PipelineCacheRD::_compile_version_task(void *p_userdata) {
+	CompilingVersion *compiling = static_cast<CompilingVersion *>(p_userdata);
+	const Version &v = compiling->version;
+	compiling->version.pipeline = compiling->cache->_create_pipeline(v.vertex_id, v.framebuffer_id, v.wireframe, v.render_pass, v.bool_specializations, compiling->samples);
+
+	pending_compilations.decrement();
+	completed_compilations.increment();
+}
+
+RID PipelineCacheRD::_get_version_or_fallback(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
+	uint32_t fallback_specializations = (p_bool_specializations | fallback_enabled_specializations) & ~fallback_disabled_specializations;
+	if (!background_compilation || fallback_specializations == p_bool_specializations) {
+		return _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+	}
+
+	bool queued = false;
+	for (uint32_t i = 0; i < compiling_versions.size(); i++) {
+		CompilingVersion *compiling = compiling_versions[i];
+		const Version &v = compiling->version;
+		if (v.vertex_id != p_vertex_format_id || v.framebuffer_id != p_framebuffer_format_id || v.wireframe != p_wireframe || v.render_pass != p_render_pass || v.bool_specializations != p_bool_specializations) {
+			continue;
+		}
+
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(compiling->task)) {
+			queued = true;
+			break;
+		}
+
+		// Done in the background; swap it in.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(compiling->task);
+		Version version = compiling->version;
+		compiling_versions.remove_at_unordered(i);
+		memdelete(compiling);
+
+		if (version.pipeline.is_null()) {
+			// Failed in the background, try again here so the error is reported normally.
+			return _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+		}
+
+		_add_version(version);
+		return version.pipeline;
+	}
+
+	if (!queued) {
+		CompilingVersion *compiling = memnew(CompilingVersion);
+		compiling->cache = this;
+		compiling->version.vertex_id = p_vertex_format_id;
+		compiling->version.framebuffer_id = p_framebuffer_format_id;
+		compiling->version.wireframe = p_wireframe;
+		compiling->version.render_pass = p_render_pass;
+		compiling->version.bool_specializations = p_bool_specializations;
+		compiling->samples = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
+		compiling->task = WorkerThreadPool::get_singleton()->add_native_task(&_compile_version_task, compiling, false, "PipelineCompilation");
+		compiling_versions.push_back(compiling);
+		pending_compilations.increment();
+	}
+
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == fallback_specializations) {
+			return versions[i].pipeline;
+		}
+	}
+
+	// The fallback itself is compiled right away, but it is shared by all the combinations of dynamic specializations.
+	return _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, fallback_specializations);
+}
+
 void PipelineCacheRD::_clear() {
+	// Background compiles read the current setup, so they must be finished before it changes.
+	for (CompilingVersion *compiling : compiling_versions) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(compiling->task);
+		if (compiling->version.pipeline.is_valid() && RD::get_singleton()->render_pipeline_is_valid(compiling->version.pipeline)) {
+			RD::get_singleton()->free(compiling->version.pipeline);
+		}
+		memdelete(compiling);
+	}
+	compiling_versions.clear();
+
 	// TODO: Clear should probably recompile all the variants already compiled instead to avoid stalls? Needs discussion.
 	if (versions) {
 		for (uint32_t i = 0; i < version_count; i++) {
@@ -99,8 +190,8 @@ void PipelineCacheRD::setup(RID p_shader, RD::RenderPrimitive p_primitive, const
 	base_specialization_constants = p_base_specialization_constants;
 }
 void PipelineCacheRD::update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants) {
-	base_specialization_constants = p_base_specialization_constants;
 	_clear();
+	base_specialization_constants = p_base_specialization_constants;
 }
 
 void PipelineCacheRD::update_shader(RID p_shader) {
@@ -109,6 +200,27 @@ void PipelineCacheRD::update_shader(RID p_shader) {
 	setup(p_shader, render_primitive, rasterization_state, multisample_state, depth_stencil_state, blend_state, dynamic_state_flags);
 }
 
+void PipelineCacheRD::set_fallback_specializations(uint32_t p_enabled, uint32_t p_disabled) {
+	fallback_enabled_specializations = p_enabled;
+	fallback_disabled_specializations = p_disabled;
+}
+
+void PipelineCacheRD::set_background_compilation_enabled(bool p_enabled) {
+	background_compilation = p_enabled;
+}
+
+bool PipelineCacheRD::is_background_compilation_enabled() {
+	return background_compilation;
+}
+
+uint32_t PipelineCacheRD::get_pending_compilation_count() {
+	return pending_compilations.get();
+}
+
+uint64_t PipelineCacheRD::get_completed_compilation_count() {
+	return completed_compilations.get();
+}
+
 void PipelineCacheRD::clear() {
 	_clear();
 	shader = RID(); //clear shader
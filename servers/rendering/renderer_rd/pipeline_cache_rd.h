@@ -31,7 +31,10 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/rendering/rendering_device.h"
 
 class PipelineCacheRD {
@@ -60,7 +63,29 @@ class PipelineCacheRD {
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	// Versions being compiled in the background. Until they are done, the fallback version
+	// (with the dynamic specializations forced on or off, see set_fallback_specializations()) is used instead.
+	struct CompilingVersion {
+		PipelineCacheRD *cache = nullptr;
+		Version version;
+		RD::TextureSamples samples = RD::TEXTURE_SAMPLES_1;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<CompilingVersion *> compiling_versions;
+
+	uint32_t fallback_enabled_specializations = 0;
+	uint32_t fallback_disabled_specializations = 0;
+
+	static bool background_compilation;
+	static SafeNumeric<uint32_t> pending_compilations;
+	static SafeNumeric<uint64_t> completed_compilations;
+
+	RID _create_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, RD::TextureSamples p_samples) const;
+	void _add_version(const Version &p_version);
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
+	RID _get_version_or_fallback(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations);
+	static void _compile_version_task(void *p_userdata);
 
 	void _clear();
 
@@ -69,6 +94,15 @@ public:
 	void update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants);
 	void update_shader(RID p_shader);
 
+	// Specialization bits the shader can also evaluate dynamically. When background compilation is enabled,
+	// a missing version is compiled on the WorkerThreadPool and the version with these bits forced on (or off) is used meanwhile.
+	void set_fallback_specializations(uint32_t p_enabled, uint32_t p_disabled);
+
+	static void set_background_compilation_enabled(bool p_enabled);
+	static bool is_background_compilation_enabled();
+	static uint32_t get_pending_compilation_count();
+	static uint64_t get_completed_compilation_count();
+
 	_FORCE_INLINE_ RID get_render_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe = false, uint32_t p_render_pass = 0, uint32_t p_bool_specializations = 0) {
 #ifdef DEBUG_ENABLED
 		ERR_FAIL_COND_V_MSG(shader.is_null(), RID(),
@@ -86,7 +120,7 @@ public:
 				return result;
 			}
 		}
-		result = _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
+		result = _get_version_or_fallback(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
 		spin_lock.unlock();
 		return result;
 	}
@@ -351,7 +351,7 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
+void RendererCanvasRenderRD::_bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
@@ -369,11 +369,11 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, bool(push_constant.flags & FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR), uniform_set, size, specular_shininess, use_normal, use_specular, p_texture_is_data);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
+		_bind_canvas_texture(default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
 		return;
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+	_record_bind_uniform_set(uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
 
 	if (specular_shininess.a < 0.999) {
 		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
@@ -401,13 +401,207 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	r_last_texture = p_texture;
 }
 
+void RendererCanvasRenderRD::_record_reset() {
+	batching.commands.clear();
+	batching.push_constants.clear();
+	batching.instance_data.clear();
+
+	batching.pipeline = RID();
+	for (uint32_t i = 0; i < 4; i++) {
+		batching.uniform_sets[i] = RID();
+	}
+	// Bound when the draw list is opened.
+	batching.uniform_sets[TRANSFORMS_UNIFORM_SET] = state.default_transforms_uniform_set;
+	batching.vertex_array = RID();
+	batching.index_array = RID();
+	batching.blend_color_set = false;
+}
+
+void RendererCanvasRenderRD::_record_bind_pipeline(RID p_pipeline) {
+	if (batching.pipeline == p_pipeline) {
+		return;
+	}
+	batching.pipeline = p_pipeline;
+	// Dynamic blend constants don't survive switching to a pipeline that does not use them.
+	batching.blend_color_set = false;
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_BIND_PIPELINE;
+	command.rid = p_pipeline;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_bind_uniform_set(RID p_uniform_set, uint32_t p_index) {
+	if (batching.uniform_sets[p_index] == p_uniform_set) {
+		return;
+	}
+	batching.uniform_sets[p_index] = p_uniform_set;
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_BIND_UNIFORM_SET;
+	command.rid = p_uniform_set;
+	command.index = p_index;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_bind_vertex_array(RID p_vertex_array) {
+	if (batching.vertex_array == p_vertex_array) {
+		return;
+	}
+	batching.vertex_array = p_vertex_array;
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_BIND_VERTEX_ARRAY;
+	command.rid = p_vertex_array;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_bind_index_array(RID p_index_array) {
+	if (batching.index_array == p_index_array) {
+		return;
+	}
+	batching.index_array = p_index_array;
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_BIND_INDEX_ARRAY;
+	command.rid = p_index_array;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_set_blend_constants(const Color &p_color) {
+	if (batching.blend_color_set && batching.blend_color == p_color) {
+		return;
+	}
+	batching.blend_color = p_color;
+	batching.blend_color_set = true;
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_SET_BLEND_CONSTANTS;
+	command.color = p_color;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_enable_scissor(const Rect2 &p_rect) {
+	DrawCommand command;
+	command.type = DRAW_COMMAND_ENABLE_SCISSOR;
+	command.rect = p_rect;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_disable_scissor() {
+	DrawCommand command;
+	command.type = DRAW_COMMAND_DISABLE_SCISSOR;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_record_draw(const PushConstant &p_push_constant, bool p_use_indices, uint32_t p_instances) {
+	DrawCommand command;
+	command.type = DRAW_COMMAND_DRAW;
+	command.index = batching.push_constants.size();
+	command.instance_count = p_instances;
+	command.use_indices = p_use_indices;
+	batching.commands.push_back(command);
+
+	batching.push_constants.push_back(p_push_constant);
+}
+
+void RendererCanvasRenderRD::_record_draw_instance(const PushConstant &p_instance) {
+	uint32_t instance_index = batching.instance_data.size();
+	batching.instance_data.push_back(p_instance);
+
+	// Nothing was recorded since the previous instanced draw, so the state is the same and the draw can be extended.
+	if (!batching.commands.is_empty()) {
+		DrawCommand &last = batching.commands[batching.commands.size() - 1];
+		if (last.type == DRAW_COMMAND_DRAW_INSTANCES && last.index + last.instance_count == instance_index) {
+			last.instance_count++;
+			return;
+		}
+	}
+
+	DrawCommand command;
+	command.type = DRAW_COMMAND_DRAW_INSTANCES;
+	command.index = instance_index;
+	command.instance_count = 1;
+	command.use_indices = true;
+	batching.commands.push_back(command);
+}
+
+void RendererCanvasRenderRD::_upload_instance_data() {
+	uint32_t instance_count = batching.instance_data.size();
+	if (instance_count == 0) {
+		return;
+	}
+
+	if (instance_count > batching.instance_buffer_size) {
+		// Uniform sets using the old buffer are freed along with it, and recreated when next used.
+		RD::get_singleton()->free(batching.instance_buffer);
+		batching.instance_buffer_size = next_power_of_2(instance_count);
+		batching.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(PushConstant) * batching.instance_buffer_size);
+	}
+
+	RD::get_singleton()->buffer_update(batching.instance_buffer, 0, sizeof(PushConstant) * instance_count, batching.instance_data.ptr());
+}
+
+void RendererCanvasRenderRD::_submit_draw_commands(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info) {
+	RenderingDevice *rd = RD::get_singleton();
+
+	for (const DrawCommand &command : batching.commands) {
+		switch (command.type) {
+			case DRAW_COMMAND_BIND_PIPELINE: {
+				rd->draw_list_bind_render_pipeline(p_draw_list, command.rid);
+			} break;
+			case DRAW_COMMAND_BIND_UNIFORM_SET: {
+				rd->draw_list_bind_uniform_set(p_draw_list, command.rid, command.index);
+			} break;
+			case DRAW_COMMAND_BIND_VERTEX_ARRAY: {
+				rd->draw_list_bind_vertex_array(p_draw_list, command.rid);
+			} break;
+			case DRAW_COMMAND_BIND_INDEX_ARRAY: {
+				rd->draw_list_bind_index_array(p_draw_list, command.rid);
+			} break;
+			case DRAW_COMMAND_SET_BLEND_CONSTANTS: {
+				rd->draw_list_set_blend_constants(p_draw_list, command.color);
+			} break;
+			case DRAW_COMMAND_ENABLE_SCISSOR: {
+				rd->draw_list_enable_scissor(p_draw_list, command.rect);
+			} break;
+			case DRAW_COMMAND_DISABLE_SCISSOR: {
+				rd->draw_list_disable_scissor(p_draw_list);
+			} break;
+			case DRAW_COMMAND_DRAW: {
+				rd->draw_list_set_push_constant(p_draw_list, &batching.push_constants[command.index], sizeof(PushConstant));
+				rd->draw_list_draw(p_draw_list, command.use_indices, command.instance_count);
+
+				if (r_render_info) {
+					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
+				}
+			} break;
+			case DRAW_COMMAND_DRAW_INSTANCES: {
+				InstancePushConstant push_constant;
+				push_constant.base_instance_index = command.index;
+				push_constant.pad[0] = 0;
+				push_constant.pad[1] = 0;
+				push_constant.pad[2] = 0;
+
+				rd->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(InstancePushConstant));
+				rd->draw_list_draw(p_draw_list, true, command.instance_count);
+
+				if (r_render_info) {
+					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
+					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_BATCHES_IN_FRAME]++;
+				}
+			} break;
+		}
+	}
+}
+
 _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primitive, uint32_t p_indices) {
 	static const uint32_t divisor[RS::PRIMITIVE_MAX] = { 1, 2, 1, 3, 1 };
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info) {
+void RendererCanvasRenderRD::_render_item(RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -517,16 +711,16 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				if (rect->flags & CANVAS_RECT_LCD) {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, modulated);
+					_record_bind_pipeline(pipeline);
+					_record_set_blend_constants(modulated);
 				} else {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
+				_bind_canvas_texture(rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
@@ -602,14 +796,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.dst_rect[2] = dst_rect.size.width;
 				push_constant.dst_rect[3] = dst_rect.size.height;
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_bind_index_array(shader.quad_index_array);
+				_record_draw_instance(push_constant);
 
 				if (r_render_info) {
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 				}
 
 			} break;
@@ -620,12 +812,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				{
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
@@ -677,14 +869,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
 				push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_bind_index_array(shader.quad_index_array);
+				_record_draw_instance(push_constant);
 
 				if (r_render_info) {
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += 2;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 				}
 
 				// Restore if overridden.
@@ -702,7 +892,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
 					ERR_CONTINUE(polygon->primitive < 0 || polygon->primitive >= RS::PRIMITIVE_MAX);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[polygon->primitive]].get_render_pipeline(pb->vertex_format_id, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
 				}
 
 				if (polygon->primitive == RS::PRIMITIVE_LINES) {
@@ -712,7 +902,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Color color = base_color;
 				if (use_linear_colors) {
@@ -730,17 +920,15 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.ninepatch_margins[j] = 0;
 				}
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, pb->vertex_array);
+				_record_bind_vertex_array(pb->vertex_array);
 				if (pb->indices.is_valid()) {
-					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, pb->indices);
+					_record_bind_index_array(pb->indices);
 				}
-				RD::get_singleton()->draw_list_draw(p_draw_list, pb->indices.is_valid());
+				_record_draw(push_constant, pb->indices.is_valid());
 
 				if (r_render_info) {
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += _indices_to_primitives(polygon->primitive, pb->primitive_count);
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 				}
 
 			} break;
@@ -752,14 +940,14 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[4] = { PIPELINE_VARIANT_PRIMITIVE_POINTS, PIPELINE_VARIANT_PRIMITIVE_LINES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES };
 					ERR_CONTINUE(primitive->point_count == 0 || primitive->point_count > 4);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive->point_count - 1]].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
+				_record_bind_index_array(primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
 
 				for (uint32_t j = 0; j < MIN(3u, primitive->point_count); j++) {
 					push_constant.points[j * 2 + 0] = primitive->points[j].x;
@@ -773,13 +961,11 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
 					push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 				}
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				_record_draw(push_constant, true);
 
 				if (r_render_info) {
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME]++;
-					r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 				}
 
 				if (primitive->point_count == 4) {
@@ -797,13 +983,11 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 						push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 					}
 
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					_record_draw(push_constant, true);
 
 					if (r_render_info) {
 						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME]++;
-						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 					}
 				}
 
@@ -846,7 +1030,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID uniform_set = mesh_storage->multimesh_get_2d_uniform_set(multimesh, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					_record_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 					push_constant.flags |= 1; //multimesh, trails disabled
 					if (mesh_storage->multimesh_uses_colors(multimesh)) {
 						push_constant.flags |= FLAGS_INSTANCING_HAS_COLORS;
@@ -873,7 +1057,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					instance_count = particles_storage->particles_get_amount(pt->particles, divisor);
 
 					RID uniform_set = particles_storage->particles_get_instance_buffer_uniform_set(pt->particles, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					_record_bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 
 					push_constant.flags |= divisor;
 					instance_count /= divisor;
@@ -911,7 +1095,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					break;
 				}
 
-				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				uint32_t surf_count = mesh_storage->mesh_get_surface_count(mesh);
 				static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
@@ -950,23 +1134,20 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive]].get_render_pipeline(vertex_format, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					_record_bind_pipeline(pipeline);
 
 					RID index_array = mesh_storage->mesh_surface_get_index_array(surface, 0);
 
 					if (index_array.is_valid()) {
-						RD::get_singleton()->draw_list_bind_index_array(p_draw_list, index_array);
+						_record_bind_index_array(index_array);
 					}
 
-					RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, vertex_array);
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-
-					RD::get_singleton()->draw_list_draw(p_draw_list, index_array.is_valid(), instance_count);
+					_record_bind_vertex_array(vertex_array);
+					_record_draw(push_constant, index_array.is_valid(), instance_count);
 
 					if (r_render_info) {
 						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME]++;
 						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += _indices_to_primitives(primitive, mesh_storage->mesh_surface_get_vertices_drawn_count(surface)) * instance_count;
-						r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
 					}
 				}
 
@@ -985,10 +1166,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				if (current_clip) {
 					if (ci->ignore != reclip) {
 						if (ci->ignore) {
-							RD::get_singleton()->draw_list_disable_scissor(p_draw_list);
+							_record_disable_scissor();
 							reclip = true;
 						} else {
-							RD::get_singleton()->draw_list_enable_scissor(p_draw_list, current_clip->final_clip_rect);
+							_record_enable_scissor(current_clip->final_clip_rect);
 							reclip = false;
 						}
 					}
@@ -1013,11 +1194,11 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		dc.a *= p_item->debug_redraw_time / debug_redraw_time;
 
 		RID pipeline = pipeline_variants->variants[PIPELINE_LIGHT_MODE_DISABLED][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-		RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+		_record_bind_pipeline(pipeline);
 
 		//bind textures
 
-		_bind_canvas_texture(p_draw_list, RID(), current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+		_bind_canvas_texture(RID(), current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 		Rect2 src_rect;
 		Rect2 dst_rect;
@@ -1040,9 +1221,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 		push_constant.dst_rect[2] = dst_rect.size.width;
 		push_constant.dst_rect[3] = dst_rect.size.height;
 
-		RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-		RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-		RD::get_singleton()->draw_list_draw(p_draw_list, true);
+		_record_bind_index_array(shader.quad_index_array);
+		_record_draw_instance(push_constant);
 
 		p_item->debug_redraw_time -= RSG::rasterizer->get_frame_delta_time();
 
@@ -1128,6 +1308,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 8;
+		u.append_id(batching.instance_buffer);
+		uniforms.push_back(u);
+	}
+
 	{
 		RD::Uniform u;
 		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
@@ -1177,16 +1365,9 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		fb_uniform_set = texture_storage->render_target_get_framebuffer_uniform_set(p_to_render_target);
 	}
 
-	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
-		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
-	}
-
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
-	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD, clear_colors);
-
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+	_record_reset();
 
 	RID prev_material;
 
@@ -1200,10 +1381,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			//setup clip
 			if (current_clip) {
-				RD::get_singleton()->draw_list_enable_scissor(draw_list, current_clip->final_clip_rect);
+				_record_enable_scissor(current_clip->final_clip_rect);
 
 			} else {
-				RD::get_singleton()->draw_list_disable_scissor(draw_list);
+				_record_disable_scissor();
 			}
 		}
 
@@ -1235,7 +1416,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 					// Update uniform set.
 					RID uniform_set = texture_storage->render_target_is_using_hdr(p_to_render_target) ? material_data->uniform_set : material_data->uniform_set_srgb;
 					if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) { // Material may not have a uniform set.
-						RD::get_singleton()->draw_list_bind_uniform_set(draw_list, uniform_set, MATERIAL_UNIFORM_SET);
+						_record_bind_uniform_set(uniform_set, MATERIAL_UNIFORM_SET);
 						material_data->set_as_used();
 					}
 				} else {
@@ -1247,7 +1428,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		}
 
 		if (!ci->repeat_size.x && !ci->repeat_size.y) {
-			_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, Point2(), r_render_info);
+			_render_item(p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, Point2(), r_render_info);
 		} else {
 			Point2 start_pos = ci->repeat_size * -(ci->repeat_times / 2);
 			Point2 end_pos = ci->repeat_size * ci->repeat_times + ci->repeat_size + start_pos;
@@ -1255,7 +1436,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			do {
 				do {
-					_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, pos, r_render_info);
+					_render_item(p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used, pos, r_render_info);
 					pos.y += ci->repeat_size.y;
 				} while (pos.y < end_pos.y);
 
@@ -1267,6 +1448,20 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		prev_material = material;
 	}
 
+	// May reallocate the instance buffer, which invalidates the base uniform sets referencing it.
+	_upload_instance_data();
+
+	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
+		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
+	}
+
+	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_LOAD, RD::FINAL_ACTION_DISCARD, clear_colors);
+
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+
+	_submit_draw_commands(draw_list, r_render_info);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -1737,8 +1932,25 @@ void RendererCanvasRenderRD::_update_shadow_atlas() {
 		}
 
 		state.shadow_fb = RD::get_singleton()->framebuffer_create(fb_textures);
+
+		// New atlas, nothing cached in it yet.
+		state.shadow_row_hashes.resize(state.max_lights_per_render);
+		for (uint32_t &row_hash : state.shadow_row_hashes) {
+			row_hash = 0;
+		}
 	}
 }
+
+uint32_t RendererCanvasRenderRD::_hash_occluder(const LightOccluderInstance *p_instance, const OccluderPolygon *p_polygon, uint32_t p_hash) const {
+	p_hash = hash_murmur3_one_64(p_instance->occluder.get_id(), p_hash);
+	p_hash = hash_murmur3_one_32(p_polygon->version, p_hash);
+	for (int i = 0; i < 3; i++) {
+		p_hash = hash_murmur3_one_real(p_instance->xform_cache.columns[i].x, p_hash);
+		p_hash = hash_murmur3_one_real(p_instance->xform_cache.columns[i].y, p_hash);
+	}
+	return p_hash;
+}
+
 void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders) {
 	CanvasLight *cl = canvas_light_owner.get_or_null(p_rid);
 	ERR_FAIL_COND(!cl->shadow.enabled);
@@ -1747,6 +1959,38 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 
 	cl->shadow.z_far = p_far;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
+
+	// Only occluders that overlap the light range can cast into its shadow map. Hash them together with
+	// the light, if the row of the atlas already holds this exact setup there is nothing to redraw.
+	Rect2 light_rect(-p_far, -p_far, p_far * 2.0, p_far * 2.0);
+	uint32_t hash = hash_murmur3_one_64(p_rid.get_id());
+	for (int i = 0; i < 3; i++) {
+		hash = hash_murmur3_one_real(p_light_xform.columns[i].x, hash);
+		hash = hash_murmur3_one_real(p_light_xform.columns[i].y, hash);
+	}
+	hash = hash_murmur3_one_float(p_near, hash);
+	hash = hash_murmur3_one_float(p_far, hash);
+
+	state.shadow_occluders.clear();
+	for (const LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		const OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+		if (!light_rect.intersects_transformed(p_light_xform * instance->xform_cache, instance->aabb_cache)) {
+			continue;
+		}
+		hash = _hash_occluder(instance, co, hash);
+		state.shadow_occluders.push_back(instance);
+	}
+	hash = hash_fmix32(hash);
+	hash = MAX(hash, 1u); // 0 is reserved for rows that must be redrawn.
+
+	if (state.shadow_row_hashes[p_shadow_index] == hash) {
+		return;
+	}
+	state.shadow_row_hashes[p_shadow_index] = hash;
+
 	Vector<Color> cc;
 	cc.push_back(Color(p_far, p_far, p_far, 1.0));
 
@@ -1788,16 +2032,9 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 		push_constant.z_far = p_far;
 		push_constant.pad = 0;
 
-		LightOccluderInstance *instance = p_occluders;
-
-		while (instance) {
+		for (const LightOccluderInstance *instance : state.shadow_occluders) {
 			OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
 
-			if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-				instance = instance->next;
-				continue;
-			}
-
 			_update_transform_2d_to_mat2x4(p_light_xform * instance->xform_cache, push_constant.modelview);
 
 			RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
@@ -1806,8 +2043,6 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 			RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 			RD::get_singleton()->draw_list_draw(draw_list, true);
-
-			instance = instance->next;
 		}
 
 		RD::get_singleton()->draw_list_end();
@@ -1841,6 +2076,37 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 
 	to_light_xform.invert();
 
+	Transform2D to_shadow;
+	to_shadow.columns[0].x = 1.0 / -(half_size * 2.0);
+	to_shadow.columns[2].x = 0.5;
+
+	cl->shadow.directional_xform = to_shadow * to_light_xform;
+
+	uint32_t hash = hash_murmur3_one_64(p_rid.get_id());
+	for (int i = 0; i < 3; i++) {
+		hash = hash_murmur3_one_real(to_light_xform.columns[i].x, hash);
+		hash = hash_murmur3_one_real(to_light_xform.columns[i].y, hash);
+	}
+	hash = hash_murmur3_one_float(half_size, hash);
+	hash = hash_murmur3_one_float(distance, hash);
+
+	state.shadow_occluders.clear();
+	for (const LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		const OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+		hash = _hash_occluder(instance, co, hash);
+		state.shadow_occluders.push_back(instance);
+	}
+	hash = hash_fmix32(hash);
+	hash = MAX(hash, 1u);
+
+	if (state.shadow_row_hashes[p_shadow_index] == hash) {
+		return;
+	}
+	state.shadow_row_hashes[p_shadow_index] = hash;
+
 	Vector<Color> cc;
 	cc.push_back(Color(1, 1, 1, 1));
 
@@ -1863,16 +2129,9 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 	push_constant.z_far = distance;
 	push_constant.pad = 0;
 
-	LightOccluderInstance *instance = p_occluders;
-
-	while (instance) {
+	for (const LightOccluderInstance *instance : state.shadow_occluders) {
 		OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
 
-		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-			instance = instance->next;
-			continue;
-		}
-
 		_update_transform_2d_to_mat2x4(to_light_xform * instance->xform_cache, push_constant.modelview);
 
 		RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
@@ -1881,17 +2140,9 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 		RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 		RD::get_singleton()->draw_list_draw(draw_list, true);
-
-		instance = instance->next;
 	}
 
 	RD::get_singleton()->draw_list_end();
-
-	Transform2D to_shadow;
-	to_shadow.columns[0].x = 1.0 / -(half_size * 2.0);
-	to_shadow.columns[2].x = 0.5;
-
-	cl->shadow.directional_xform = to_shadow * to_light_xform;
 }
 
 void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstance *p_occluders) {
@@ -1900,6 +2151,27 @@ void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstan
 	RID fb = texture_storage->render_target_get_sdf_framebuffer(p_render_target);
 	Rect2i rect = texture_storage->render_target_get_sdf_rect(p_render_target);
 
+	// The jump flood pass spreads every occluder over the whole field, so there is no cheaper partial
+	// update. Skip the redraw entirely while the camera and the occluders in view stay where they were.
+	uint32_t hash = hash_murmur3_one_32(rect.position.x);
+	hash = hash_murmur3_one_32(rect.position.y, hash);
+	hash = hash_murmur3_one_32(rect.size.width, hash);
+	hash = hash_murmur3_one_32(rect.size.height, hash);
+	for (const LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		const OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
+		if (!co || co->sdf_index_array.is_null() || !instance->sdf_collision) {
+			continue;
+		}
+		hash = _hash_occluder(instance, co, hash);
+	}
+	hash = hash_fmix32(hash);
+	hash = MAX(hash, 1u);
+
+	if (texture_storage->render_target_get_sdf_hash(p_render_target) == hash) {
+		return;
+	}
+	texture_storage->render_target_set_sdf_hash(p_render_target, hash);
+
 	Transform2D to_sdf;
 	to_sdf.columns[0] *= rect.size.width;
 	to_sdf.columns[1] *= rect.size.height;
@@ -1955,6 +2227,7 @@ void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstan
 
 	RD::get_singleton()->draw_list_end();
 
+	RENDER_TIMESTAMP("Process 2D SDF");
 	texture_storage->render_target_sdf_process(p_render_target); //done rendering, process it
 }
 
@@ -1971,6 +2244,8 @@ void RendererCanvasRenderRD::occluder_polygon_set_shape(RID p_occluder, const Ve
 	OccluderPolygon *oc = occluder_polygon_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(oc);
 
+	oc->version++;
+
 	Vector<Vector2> lines;
 
 	if (p_points.size()) {
@@ -2162,7 +2437,10 @@ void RendererCanvasRenderRD::occluder_polygon_set_shape(RID p_occluder, const Ve
 void RendererCanvasRenderRD::occluder_polygon_set_cull_mode(RID p_occluder, RS::CanvasOccluderPolygonCullMode p_mode) {
 	OccluderPolygon *oc = occluder_polygon_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(oc);
-	oc->cull_mode = p_mode;
+	if (oc->cull_mode != p_mode) {
+		oc->cull_mode = p_mode;
+		oc->version++;
+	}
 }
 
 void RendererCanvasRenderRD::CanvasShaderData::set_code(const String &p_code, RID p_shader_template) {
@@ -2598,7 +2876,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.renames["SCREEN_PIXEL_SIZE"] = "canvas_data.screen_pixel_size";
 		actions.renames["FRAGCOORD"] = "gl_FragCoord";
 		actions.renames["POINT_COORD"] = "gl_PointCoord";
-		actions.renames["INSTANCE_ID"] = "gl_InstanceIndex";
+		actions.renames["INSTANCE_ID"] = "instance_id";
 		actions.renames["VERTEX_ID"] = "gl_VertexIndex";
 
 		actions.renames["CUSTOM0"] = "custom0";
@@ -2640,7 +2918,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_shader_uniforms.data";
 
@@ -2791,6 +3069,12 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 
 	state.shadow_texture_size = GLOBAL_GET("rendering/2d/shadow_atlas/size");
 
+	{
+		// Grown on demand if a frame batches more instances than this.
+		batching.instance_buffer_size = MAX(uint32_t(GLOBAL_GET("rendering/2d/batching/item_buffer_size")), 128u);
+		batching.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(PushConstant) * batching.instance_buffer_size);
+	}
+
 	//create functions for shader and material
 	material_storage->shader_set_data_request_function(RendererRD::MaterialStorage::SHADER_TYPE_2D, _create_shader_funcs);
 	material_storage->material_set_data_request_function(RendererRD::MaterialStorage::SHADER_TYPE_2D, _create_material_funcs);
@@ -2915,6 +3199,7 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+		RD::get_singleton()->free(batching.instance_buffer);
 	}
 
 	//shadow rendering
@@ -287,6 +287,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID sdf_index_buffer;
 		RID sdf_index_array;
 		bool sdf_is_lines;
+
+		uint32_t version = 0; // Bumped when the shape or cull mode changes, invalidates cached shadows.
 	};
 
 	struct LightUniform {
@@ -366,6 +368,9 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID shadow_depth_texture;
 		RID shadow_fb;
 		int shadow_texture_size = 2048;
+		// Hash of the light and occluders last rendered into each shadow atlas row, 0 if the row must be redrawn.
+		LocalVector<uint32_t> shadow_row_hashes;
+		LocalVector<const LightOccluderInstance *> shadow_occluders; // Scratch list of occluders culled to the light being rendered.
 
 		RID default_transforms_uniform_set;
 
@@ -403,6 +408,75 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		uint32_t lights[4];
 	};
 
+	/******************/
+	/**** BATCHING ****/
+	/******************/
+
+	// Draw commands are recorded before the draw list is opened, so the
+	// instance data of rects and nine-patches can be uploaded in one go and
+	// consecutive compatible commands merged into a single instanced draw.
+
+	enum DrawCommandType {
+		DRAW_COMMAND_BIND_PIPELINE,
+		DRAW_COMMAND_BIND_UNIFORM_SET,
+		DRAW_COMMAND_BIND_VERTEX_ARRAY,
+		DRAW_COMMAND_BIND_INDEX_ARRAY,
+		DRAW_COMMAND_SET_BLEND_CONSTANTS,
+		DRAW_COMMAND_ENABLE_SCISSOR,
+		DRAW_COMMAND_DISABLE_SCISSOR,
+		DRAW_COMMAND_DRAW,
+		DRAW_COMMAND_DRAW_INSTANCES,
+	};
+
+	struct DrawCommand {
+		DrawCommandType type;
+		RID rid;
+		// Uniform set index for DRAW_COMMAND_BIND_UNIFORM_SET, push constant index for DRAW_COMMAND_DRAW,
+		// first instance for DRAW_COMMAND_DRAW_INSTANCES.
+		uint32_t index = 0;
+		uint32_t instance_count = 1;
+		bool use_indices = false;
+		Color color;
+		Rect2 rect;
+	};
+
+	// Push constant used by the batched (quad and nine-patch) variants.
+	struct InstancePushConstant {
+		uint32_t base_instance_index;
+		uint32_t pad[3];
+	};
+
+	struct {
+		LocalVector<DrawCommand> commands;
+		LocalVector<PushConstant> push_constants;
+		// Batched instances use the rect layout of PushConstant, mirrored by InstanceData in the shader.
+		LocalVector<PushConstant> instance_data;
+
+		RID instance_buffer;
+		uint32_t instance_buffer_size = 0; // In instances.
+
+		// Last recorded state, used to avoid redundant commands which would break batches.
+		RID pipeline;
+		RID uniform_sets[4];
+		RID vertex_array;
+		RID index_array;
+		Color blend_color;
+		bool blend_color_set = false;
+	} batching;
+
+	void _record_reset();
+	void _record_bind_pipeline(RID p_pipeline);
+	void _record_bind_uniform_set(RID p_uniform_set, uint32_t p_index);
+	void _record_bind_vertex_array(RID p_vertex_array);
+	void _record_bind_index_array(RID p_index_array);
+	void _record_set_blend_constants(const Color &p_color);
+	void _record_enable_scissor(const Rect2 &p_rect);
+	void _record_disable_scissor();
+	void _record_draw(const PushConstant &p_push_constant, bool p_use_indices, uint32_t p_instances = 1);
+	void _record_draw_instance(const PushConstant &p_instance);
+	void _upload_instance_data();
+	void _submit_draw_commands(RD::DrawListID p_draw_list, RenderingMethod::RenderInfo *r_render_info);
+
 	Item *items[MAX_RENDER_ITEMS];
 
 	bool using_directional_lights = false;
@@ -422,8 +496,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	Color debug_redraw_color;
 	double debug_redraw_time = 1.0;
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
-	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info = nullptr);
+	inline void _bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
+	void _render_item(RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used, const Point2 &p_offset, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false, RenderingMethod::RenderInfo *r_render_info = nullptr);
 
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x4(const Transform2D &p_transform, float *p_mat2x4);
@@ -433,6 +507,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	_FORCE_INLINE_ void _update_transform_to_mat4(const Transform3D &p_transform, float *p_mat4);
 
 	void _update_shadow_atlas();
+	_FORCE_INLINE_ uint32_t _hash_occluder(const LightOccluderInstance *p_instance, const OccluderPolygon *p_polygon, uint32_t p_hash) const;
 
 public:
 	PolygonID request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>()) override;
@@ -34,6 +34,7 @@
 #include "core/os/os.h"
 #include "renderer_compositor_rd.h"
 #include "servers/rendering/renderer_rd/environment/fog.h"
+#include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/shaders/decal_data_inc.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/light_data_inc.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/scene_data_inc.glsl.gen.h"
@@ -1084,7 +1085,17 @@ void RendererSceneRenderRD::_update_vrs(Ref<RenderSceneBuffersRD> p_render_buffe
 
 			RID vrs_fb = FramebufferCacheRD::get_singleton()->get_cache_multipass(textures, passes, p_render_buffers->get_view_count());
 
-			vrs->update_vrs_texture(vrs_fb, p_render_buffers->get_render_target());
+			RID color;
+			RID velocity;
+			if (vrs_mode == RS::VIEWPORT_VRS_ADAPTIVE) {
+				// Nothing has been rendered yet, so these still hold the previous frame.
+				color = p_render_buffers->get_internal_texture();
+				if (p_render_buffers->has_velocity_buffer(false)) {
+					velocity = p_render_buffers->get_velocity_buffer(false);
+				}
+			}
+
+			vrs->update_vrs_texture(vrs_fb, p_render_buffers->get_render_target(), color, velocity, p_render_buffers->get_view_count() > 1);
 		}
 	}
 }
@@ -1243,13 +1254,48 @@ void RendererSceneRenderRD::render_material(const Transform3D &p_cam_transform,
 	_render_material(p_cam_transform, p_cam_projection, p_cam_orthogonal, p_instances, p_framebuffer, p_region, 1.0);
 }
 
-void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) {
+// Part of the heightfield plane (local X and Z) covered by the given texels.
+static Rect2 _particle_collider_heightfield_get_local_rect(const Vector3 &p_extents, const Size2i &p_size, const Rect2i &p_area) {
+	Vector2 texel_size(p_extents.x * 2.0 / p_size.x, p_extents.z * 2.0 / p_size.y);
+	return Rect2(Vector2(-p_extents.x, -p_extents.z) + Vector2(p_area.position) * texel_size, Vector2(p_area.size) * texel_size);
+}
+
+void RendererSceneRenderRD::particle_collider_heightfield_begin_update(RID p_collider, const Transform3D &p_transform, const LocalVector<AABB> &p_changed_areas, LocalVector<ParticleColliderHeightfieldArea> &r_areas) {
 	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
 
 	ERR_FAIL_COND(!particles_storage->particles_collision_is_heightfield(p_collider));
+
+	LocalVector<Rect2i> rects;
+	particles_storage->particles_collision_heightfield_begin_update(p_collider, p_transform, p_changed_areas, rects);
+
 	Vector3 extents = particles_storage->particles_collision_get_extents(p_collider) * p_transform.basis.get_scale();
+	Size2i size = particles_storage->particles_collision_get_heightfield_size(p_collider);
+	Transform3D xform(p_transform.basis.orthonormalized(), p_transform.origin);
+
+	for (const Rect2i &rect : rects) {
+		Rect2 local_rect = _particle_collider_heightfield_get_local_rect(extents, size, rect);
+
+		ParticleColliderHeightfieldArea area;
+		area.rect = rect;
+		area.aabb = xform.xform(AABB(Vector3(local_rect.position.x, -extents.y, local_rect.position.y), Vector3(local_rect.size.x, extents.y * 2.0, local_rect.size.y)));
+		r_areas.push_back(area);
+	}
+}
+
+void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_area) {
+	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
+
+	ERR_FAIL_COND(!particles_storage->particles_collision_is_heightfield(p_collider));
+	Vector3 extents = particles_storage->particles_collision_get_extents(p_collider) * p_transform.basis.get_scale();
+
+	RID fb = particles_storage->particles_collision_get_heightfield_framebuffer(p_collider);
+	Size2i size = particles_storage->particles_collision_get_heightfield_size(p_collider);
+	Rect2i area = p_area.has_area() ? p_area : Rect2i(Point2i(), size);
+
+	// Only project the area being rendered, the camera's up vector is -Z so Z is flipped.
+	Rect2 local_rect = _particle_collider_heightfield_get_local_rect(extents, size, area);
 	Projection cm;
-	cm.set_orthogonal(-extents.x, extents.x, -extents.z, extents.z, 0, extents.y * 2.0);
+	cm.set_orthogonal(local_rect.position.x, local_rect.get_end().x, -local_rect.get_end().y, -local_rect.position.y, 0, extents.y * 2.0);
 
 	Vector3 cam_pos = p_transform.origin;
 	cam_pos.y += extents.y;
@@ -1257,9 +1303,7 @@ void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider,
 	Transform3D cam_xform;
 	cam_xform.set_look_at(cam_pos, cam_pos - p_transform.basis.get_column(Vector3::AXIS_Y), -p_transform.basis.get_column(Vector3::AXIS_Z).normalized());
 
-	RID fb = particles_storage->particles_collision_get_heightfield_framebuffer(p_collider);
-
-	_render_particle_collider_heightfield(fb, cam_xform, cm, p_instances);
+	_render_particle_collider_heightfield(fb, cam_xform, cm, p_instances, area == Rect2i(Point2i(), size) ? Rect2i() : area);
 }
 
 bool RendererSceneRenderRD::free(RID p_rid) {
@@ -1477,6 +1521,7 @@ void RendererSceneRenderRD::init() {
 	RSG::camera_attributes->camera_attributes_set_dof_blur_bokeh_shape(RS::DOFBokehShape(int(GLOBAL_GET("rendering/camera/depth_of_field/depth_of_field_bokeh_shape"))));
 	RSG::camera_attributes->camera_attributes_set_dof_blur_quality(RS::DOFBlurQuality(int(GLOBAL_GET("rendering/camera/depth_of_field/depth_of_field_bokeh_quality"))), GLOBAL_GET("rendering/camera/depth_of_field/depth_of_field_use_jitter"));
 	use_physical_light_units = GLOBAL_GET("rendering/lights_and_shadows/use_physical_light_units");
+	PipelineCacheRD::set_background_compilation_enabled(GLOBAL_GET("rendering/rendering_device/pipeline_compilation/background_specialization"));
 
 	screen_space_roughness_limiter = GLOBAL_GET("rendering/anti_aliasing/screen_space_roughness_limiter/enabled");
 	screen_space_roughness_limiter_amount = GLOBAL_GET("rendering/anti_aliasing/screen_space_roughness_limiter/amount");
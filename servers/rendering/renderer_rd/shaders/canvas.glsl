@@ -34,6 +34,12 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_INSTANCE_DATA
+
+layout(location = 4) flat out uint instance_index_interp;
+
+#endif
+
 #ifdef MATERIAL_UNIFORMS_USED
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 
@@ -51,6 +57,15 @@ vec3 srgb_to_linear(vec3 color) {
 #endif
 
 void main() {
+#ifdef USE_INSTANCE_DATA
+	uint instance_index = params.base_instance_index + gl_InstanceIndex;
+	instance_index_interp = instance_index;
+	draw_data = instances.data[instance_index];
+	int instance_id = 0;
+#else
+	int instance_id = gl_InstanceIndex;
+#endif
+
 	vec4 instance_custom = vec4(0.0);
 #if defined(CUSTOM0_USED)
 	vec4 custom0 = vec4(0.0);
@@ -251,6 +266,12 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_INSTANCE_DATA
+
+layout(location = 4) flat in uint instance_index_interp;
+
+#endif
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef MATERIAL_UNIFORMS_USED
@@ -458,6 +479,10 @@ float msdf_median(float r, float g, float b, float a) {
 }
 
 void main() {
+#ifdef USE_INSTANCE_DATA
+	draw_data = instances.data[instance_index_interp];
+#endif
+
 	vec4 color = color_interp;
 	vec2 uv = uv_interp;
 	vec2 vertex = vertex_interp;
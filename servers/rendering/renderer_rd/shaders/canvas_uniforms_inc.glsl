@@ -29,6 +29,43 @@
 #define FLAGS_FLIP_H (1 << 30)
 #define FLAGS_FLIP_V (1 << 31)
 
+#if !defined(USE_PRIMITIVE) && !defined(USE_ATTRIBUTES)
+// Rects and nine-patches are batched, their draw data is read per instance from the instance buffer.
+#define USE_INSTANCE_DATA
+#endif
+
+struct InstanceData {
+	vec2 world_x;
+	vec2 world_y;
+	vec2 world_ofs;
+	uint flags;
+	uint specular_shininess;
+	vec4 modulation;
+	vec4 ninepatch_margins;
+	vec4 dst_rect; //for built-in rect and UV
+	vec4 src_rect;
+	vec2 pad;
+	vec2 color_texture_pixel_size;
+	uint lights[4];
+};
+
+#ifdef USE_INSTANCE_DATA
+
+// Push Constant
+
+layout(push_constant, std430) uniform Params {
+	uint base_instance_index;
+	uint pad1;
+	uint pad2;
+	uint pad3;
+}
+params;
+
+// Filled from the instance buffer at the beginning of each stage.
+InstanceData draw_data;
+
+#else
+
 // Push Constant
 
 layout(push_constant, std430) uniform DrawData {
@@ -54,6 +91,8 @@ layout(push_constant, std430) uniform DrawData {
 }
 draw_data;
 
+#endif // USE_INSTANCE_DATA
+
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
 // Higher sets: Sets that change format and layout very often
@@ -128,6 +167,12 @@ layout(set = 0, binding = 7) uniform texture2D sdf_texture;
 
 #include "samplers_inc.glsl"
 
+// Must be declared in every variant so all of them share the same SET0 format.
+layout(set = 0, binding = 8, std430) restrict readonly buffer Instances {
+	InstanceData data[];
+}
+instances;
+
 layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalShaderUniformData {
 	vec4 data[];
 }
@@ -0,0 +1,160 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Compute alternative to cluster_render.glsl. One group bins all the elements for a cluster tile,
+// producing the same usage and depth bits, so cluster_store.glsl can run unchanged afterwards.
+
+#define BIN_GROUP_SIZE 64
+
+layout(local_size_x = BIN_GROUP_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+layout(push_constant, std430) uniform Params {
+	uvec2 screen_size;
+	uint cluster_size;
+	uint render_element_count;
+}
+params;
+
+layout(set = 0, binding = 1, std140) uniform State {
+	mat4 projection;
+
+	float inv_z_far;
+	uint screen_to_clusters_shift; // shift to obtain coordinates in block indices
+	uint cluster_screen_width; //
+	uint cluster_data_size; // how much data for a single cluster takes
+
+	uint cluster_depth_offset;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+
+	mat4 inv_projection;
+}
+state;
+
+#define ELEMENT_TYPE_OMNI_LIGHT 0
+#define ELEMENT_TYPE_SPOT_LIGHT 1
+#define ELEMENT_TYPE_DECAL 2
+#define ELEMENT_TYPE_REFLECTION_PROBE 3
+
+struct RenderElement {
+	uint type; //0-4
+	bool touches_near;
+	bool touches_far;
+	uint original_index;
+	mat3x4 transform_inv;
+	vec3 scale;
+	bool has_wide_spot_angle;
+};
+
+layout(set = 0, binding = 2, std430) buffer restrict readonly RenderElements {
+	RenderElement data[];
+}
+render_elements;
+
+//same layout as the one written by cluster_render.glsl
+
+layout(set = 0, binding = 3, std430) buffer restrict ClusterRender {
+	uint data[];
+}
+cluster_render;
+
+shared vec4 tile_planes[4];
+
+vec3 unproject(vec2 p_ndc, float p_depth) {
+	vec4 v = state.inv_projection * vec4(p_ndc, p_depth, 1.0);
+	return v.xyz / v.w;
+}
+
+vec4 plane_from_points(vec3 p_a, vec3 p_b, vec3 p_c, vec3 p_inside) {
+	vec3 normal = normalize(cross(p_b - p_a, p_c - p_a));
+	if (dot(normal, p_inside - p_a) < 0.0) {
+		normal = -normal;
+	}
+	return vec4(normal, -dot(normal, p_a));
+}
+
+// Furthest distance the proxy shape of the element reaches along a direction, matching the meshes used by cluster_render.glsl.
+float element_support(uint p_index, vec3 p_dir) {
+	mat3x4 xform = render_elements.data[p_index].transform_inv;
+	vec3 scale = render_elements.data[p_index].scale;
+	vec3 origin = vec3(xform[0].w, xform[1].w, xform[2].w);
+	vec3 axis_x = vec3(xform[0].x, xform[1].x, xform[2].x);
+	vec3 axis_y = vec3(xform[0].y, xform[1].y, xform[2].y);
+	vec3 axis_z = vec3(xform[0].z, xform[1].z, xform[2].z);
+
+	float support = dot(p_dir, origin);
+	uint type = render_elements.data[p_index].type;
+
+	if (type == ELEMENT_TYPE_DECAL || type == ELEMENT_TYPE_REFLECTION_PROBE) {
+		support += abs(dot(p_dir, axis_x)) * scale.x + abs(dot(p_dir, axis_y)) * scale.y + abs(dot(p_dir, axis_z)) * scale.z;
+	} else if (type == ELEMENT_TYPE_SPOT_LIGHT && !render_elements.data[p_index].has_wide_spot_angle) {
+		// Cone with the apex at the origin, opening towards -Z.
+		vec3 base = origin - axis_z * scale.z;
+		vec3 dir = normalize(-axis_z);
+		float base_radius = scale.x * max(length(axis_x), length(axis_y));
+		support = max(support, dot(p_dir, base) + base_radius * length(p_dir - dot(p_dir, dir) * dir));
+	} else {
+		support += scale.x * max(length(axis_x), max(length(axis_y), length(axis_z)));
+	}
+
+	return support;
+}
+
+void main() {
+	uvec2 cluster = gl_WorkGroupID.xy;
+
+	if (gl_LocalInvocationIndex == 0) {
+		// Side planes of the tile, valid for both perspective and orthogonal projections.
+		vec2 from = vec2(cluster * params.cluster_size) / vec2(params.screen_size) * 2.0 - 1.0;
+		vec2 to = vec2((cluster + 1) * params.cluster_size) / vec2(params.screen_size) * 2.0 - 1.0;
+
+		vec3 a00 = unproject(vec2(from.x, from.y), 0.0);
+		vec3 a10 = unproject(vec2(to.x, from.y), 0.0);
+		vec3 a01 = unproject(vec2(from.x, to.y), 0.0);
+		vec3 a11 = unproject(vec2(to.x, to.y), 0.0);
+		vec3 b00 = unproject(vec2(from.x, from.y), 1.0);
+		vec3 b11 = unproject(vec2(to.x, to.y), 1.0);
+		vec3 center = (unproject((from + to) * 0.5, 0.0) + unproject((from + to) * 0.5, 1.0)) * 0.5;
+
+		tile_planes[0] = plane_from_points(a00, a01, b00, center);
+		tile_planes[1] = plane_from_points(a10, a11, b11, center);
+		tile_planes[2] = plane_from_points(a00, a10, b00, center);
+		tile_planes[3] = plane_from_points(a01, a11, b11, center);
+	}
+
+	barrier();
+
+	uint cluster_offset = (cluster.x + state.cluster_screen_width * cluster.y) * state.cluster_data_size;
+
+	for (uint index = gl_LocalInvocationIndex; index < params.render_element_count; index += BIN_GROUP_SIZE) {
+		bool outside = false;
+		for (uint i = 0; i < 4; i++) {
+			if (element_support(index, tile_planes[i].xyz) + tile_planes[i].w < 0.0) {
+				outside = true;
+				break;
+			}
+		}
+
+		if (outside) {
+			continue;
+		}
+
+		float max_depth = element_support(index, vec3(0.0, 0.0, -1.0));
+		if (max_depth < 0.0) {
+			continue; // Behind the camera.
+		}
+
+		float min_depth = -element_support(index, vec3(0.0, 0.0, 1.0));
+
+		uint from_z = clamp(uint(floor(max(min_depth, 0.0) * state.inv_z_far * 32.0)), 0, 31);
+		uint to_z = clamp(uint(floor(max_depth * state.inv_z_far * 32.0)), 0, 31);
+
+		atomicOr(cluster_render.data[cluster_offset + (index >> 5)], 1u << (index & 0x1F));
+		// Every element has its own depth word in the cluster, and it's only written by this invocation.
+		cluster_render.data[cluster_offset + state.cluster_depth_offset + index] = (2u << to_z) - (1u << from_z);
+	}
+}
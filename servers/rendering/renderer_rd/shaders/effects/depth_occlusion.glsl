@@ -0,0 +1,52 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D source_depth;
+
+layout(set = 1, binding = 0, std430) restrict writeonly buffer DestDepth {
+	float data[];
+}
+dest_depth;
+
+layout(push_constant, std430) uniform Params {
+	mat4 inv_projection;
+	ivec2 source_size;
+	ivec2 dest_size;
+	bool flip_y;
+	uint pad1;
+	uint pad2;
+	uint pad3;
+}
+params;
+
+void main() {
+	// Texel of the occlusion buffer being written.
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.dest_size))) { //too large, do nothing
+		return;
+	}
+
+	// The occlusion buffer starts at the bottom of the screen.
+	ivec2 dest_pos = ivec2(pos.x, params.flip_y ? (params.dest_size.y - 1 - pos.y) : pos.y);
+
+	ivec2 from = dest_pos * params.source_size / params.dest_size;
+	ivec2 to = max(from + 1, (dest_pos + 1) * params.source_size / params.dest_size);
+	to = min(to, params.source_size);
+
+	// Keep the farthest depth, so the texel only occludes what is behind everything it covers.
+	float max_depth = 0.0;
+	for (int y = from.y; y < to.y; y++) {
+		for (int x = from.x; x < to.x; x++) {
+			float depth = texelFetch(source_depth, ivec2(x, y), 0).r;
+			vec4 view = params.inv_projection * vec4(0.0, 0.0, depth, 1.0);
+			max_depth = max(max_depth, -view.z / view.w);
+		}
+	}
+
+	dest_depth.data[pos.y * params.dest_size.x + pos.x] = max_depth;
+}
@@ -0,0 +1,161 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Stable radix sort of (key, index) pairs by key, 8 bits per pass.
+// Each pass builds per block digit histograms, scans them into global offsets,
+// and scatters the elements to their sorted position for that digit.
+
+#define WORKGROUP_SIZE 256
+#define BLOCK_SIZE 1024 // Elements per workgroup for the histogram and scatter passes.
+#define DIGIT_COUNT 256
+
+layout(local_size_x = WORKGROUP_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+#if defined(MODE_HISTOGRAM) || defined(MODE_SCATTER)
+layout(set = 0, binding = 0, std430) restrict readonly buffer SourceBuffer {
+	vec2 data[];
+}
+source_buffer;
+#endif
+
+#ifdef MODE_SCATTER
+layout(set = 0, binding = 1, std430) restrict writeonly buffer DestBuffer {
+	vec2 data[];
+}
+dest_buffer;
+#endif
+
+// Offsets are stored digit major, so scanning the whole buffer yields each block's output offset per digit.
+layout(set = 0, binding = 2, std430) restrict buffer HistogramBuffer {
+	uint data[];
+}
+histogram_buffer;
+
+layout(push_constant, std430) uniform Params {
+	uint total_elements;
+	uint shift;
+	uint block_count;
+	uint pad;
+}
+params;
+
+#if defined(MODE_HISTOGRAM) || defined(MODE_SCATTER)
+uint get_digit(float p_key) {
+	// Flip the bits so that floats sort as unsigned integers.
+	uint bits = floatBitsToUint(p_key);
+	bits ^= (bits & 0x80000000u) != 0u ? 0xFFFFFFFFu : 0x80000000u;
+	return (bits >> params.shift) & (DIGIT_COUNT - 1);
+}
+#endif
+
+#ifdef MODE_HISTOGRAM
+shared uint local_histogram[DIGIT_COUNT];
+#endif
+
+#ifdef MODE_SCAN
+shared uint partial_sums[WORKGROUP_SIZE];
+#endif
+
+#ifdef MODE_SCATTER
+// One bit per thread for each digit, used to rank elements sharing a digit in thread order.
+shared uint digit_masks[DIGIT_COUNT * (WORKGROUP_SIZE / 32)];
+shared uint digit_offsets[DIGIT_COUNT];
+#endif
+
+void main() {
+	uint local_index = gl_LocalInvocationID.x;
+
+#ifdef MODE_HISTOGRAM
+	uint block = gl_WorkGroupID.x;
+
+	local_histogram[local_index] = 0;
+	barrier();
+
+	for (uint i = 0; i < BLOCK_SIZE / WORKGROUP_SIZE; i++) {
+		uint index = block * BLOCK_SIZE + i * WORKGROUP_SIZE + local_index;
+		if (index < params.total_elements) {
+			atomicAdd(local_histogram[get_digit(source_buffer.data[index].x)], 1u);
+		}
+	}
+	barrier();
+
+	histogram_buffer.data[local_index * params.block_count + block] = local_histogram[local_index];
+#endif
+
+#ifdef MODE_SCAN
+	// Single workgroup exclusive scan: each thread sums a contiguous chunk,
+	// the chunk sums are scanned in shared memory, then each chunk is written out.
+	uint count = DIGIT_COUNT * params.block_count;
+	uint chunk_size = (count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+	uint from = min(local_index * chunk_size, count);
+	uint to = min(from + chunk_size, count);
+
+	uint sum = 0;
+	for (uint i = from; i < to; i++) {
+		sum += histogram_buffer.data[i];
+	}
+
+	partial_sums[local_index] = sum;
+	barrier();
+
+	for (uint offset = 1; offset < WORKGROUP_SIZE; offset <<= 1) {
+		uint value = local_index >= offset ? partial_sums[local_index - offset] : 0;
+		barrier();
+		partial_sums[local_index] += value;
+		barrier();
+	}
+
+	uint running = partial_sums[local_index] - sum;
+	for (uint i = from; i < to; i++) {
+		uint value = histogram_buffer.data[i];
+		histogram_buffer.data[i] = running;
+		running += value;
+	}
+#endif
+
+#ifdef MODE_SCATTER
+	uint block = gl_WorkGroupID.x;
+	uint mask_word = local_index / 32;
+	uint mask_bit = 1u << (local_index % 32);
+
+	digit_offsets[local_index] = histogram_buffer.data[local_index * params.block_count + block];
+
+	for (uint i = 0; i < BLOCK_SIZE / WORKGROUP_SIZE; i++) {
+		for (uint j = 0; j < WORKGROUP_SIZE / 32; j++) {
+			digit_masks[local_index * (WORKGROUP_SIZE / 32) + j] = 0;
+		}
+		barrier();
+
+		uint index = block * BLOCK_SIZE + i * WORKGROUP_SIZE + local_index;
+		bool valid = index < params.total_elements;
+		vec2 element;
+		uint digit = 0;
+		if (valid) {
+			element = source_buffer.data[index];
+			digit = get_digit(element.x);
+			atomicOr(digit_masks[digit * (WORKGROUP_SIZE / 32) + mask_word], mask_bit);
+		}
+		barrier();
+
+		if (valid) {
+			uint rank = uint(bitCount(digit_masks[digit * (WORKGROUP_SIZE / 32) + mask_word] & (mask_bit - 1u)));
+			for (uint j = 0; j < mask_word; j++) {
+				rank += uint(bitCount(digit_masks[digit * (WORKGROUP_SIZE / 32) + j]));
+			}
+			dest_buffer.data[digit_offsets[digit] + rank] = element;
+		}
+		barrier();
+
+		// Advance past the elements of this chunk, one digit per thread.
+		uint digit_total = 0;
+		for (uint j = 0; j < WORKGROUP_SIZE / 32; j++) {
+			digit_total += uint(bitCount(digit_masks[local_index * (WORKGROUP_SIZE / 32) + j]));
+		}
+		digit_offsets[local_index] += digit_total;
+		barrier();
+	}
+#endif
+}
@@ -21,9 +21,11 @@ layout(location = 0) out vec2 uv_interp;
 
 layout(push_constant, std430) uniform Params {
 	float max_texel_factor;
-	float res1;
-	float res2;
-	float res3;
+	float velocity_threshold;
+	float contrast_threshold;
+	float pad;
+	vec2 tile_size;
+	vec2 pad2;
 }
 params;
 
@@ -54,18 +56,26 @@ void main() {
 #ifdef USE_MULTIVIEW
 layout(location = 0) in vec3 uv_interp;
 layout(set = 0, binding = 0) uniform sampler2DArray source_color;
+#ifdef MODE_ADAPTIVE
+layout(set = 0, binding = 1) uniform sampler2DArray source_velocity;
+#endif
 #else /* USE_MULTIVIEW */
 layout(location = 0) in vec2 uv_interp;
 layout(set = 0, binding = 0) uniform sampler2D source_color;
+#ifdef MODE_ADAPTIVE
+layout(set = 0, binding = 1) uniform sampler2D source_velocity;
+#endif
 #endif /* USE_MULTIVIEW */
 
 layout(location = 0) out uint frag_color;
 
 layout(push_constant, std430) uniform Params {
 	float max_texel_factor;
-	float res1;
-	float res2;
-	float res3;
+	float velocity_threshold;
+	float contrast_threshold;
+	float pad;
+	vec2 tile_size;
+	vec2 pad2;
 }
 params;
 
@@ -76,8 +86,52 @@ void main() {
 	vec2 uv = uv_interp;
 #endif
 
+#ifdef MODE_ADAPTIVE
+	// Each fragment covers one tile of the shading rate image. The previous frame's color and
+	// motion vectors are sampled on a 4x4 grid within the tile to estimate how much detail
+	// the tile shows, and how fast it moves across the screen.
+	vec2 color_pixel_size = 1.0 / vec2(textureSize(source_color, 0).xy);
+	vec2 velocity_size = vec2(textureSize(source_velocity, 0).xy);
+	float min_luminance = 1.0;
+	float max_luminance = 0.0;
+	float max_speed = 0.0;
+
+	for (int y = 0; y < 4; y++) {
+		for (int x = 0; x < 4; x++) {
+			vec2 pixel = (floor(gl_FragCoord.xy) + (vec2(x, y) + 0.5) * 0.25) * params.tile_size;
+#ifdef USE_MULTIVIEW
+			vec3 sample_uv = vec3(pixel * color_pixel_size, uv.z);
+#else
+			vec2 sample_uv = pixel * color_pixel_size;
+#endif
+
+			// Compress HDR luminance so the contrast is measured roughly as perceived.
+			float luminance = dot(textureLod(source_color, sample_uv, 0.0).rgb, vec3(0.2126, 0.7152, 0.0722));
+			luminance = luminance / (1.0 + luminance);
+			min_luminance = min(min_luminance, luminance);
+			max_luminance = max(max_luminance, luminance);
+
+			// Motion vectors are stored in UV space.
+			vec2 velocity = textureLod(source_velocity, sample_uv, 0.0).xy * velocity_size;
+			max_speed = max(max_speed, length(velocity));
+		}
+	}
+
+	float contrast = max_luminance - min_luminance;
+	float rate = 0.0;
+	if (max_speed > params.velocity_threshold || contrast < params.contrast_threshold) {
+		rate = 1.0;
+	}
+	if (max_speed > params.velocity_threshold * 2.0 || contrast < params.contrast_threshold * 0.5) {
+		rate = 2.0;
+	}
+
+	// Same rate in both directions, so 2x2 or 4x4.
+	vec4 color = vec4(rate / params.max_texel_factor);
+#else
 	// Input is standardized. R for X, G for Y, 0.0 (0) = 1, 0.33 (85) = 2, 0.66 (170) = 3, 1.0 (255) = 8
 	vec4 color = textureLod(source_color, uv, 0.0);
+#endif
 
 	// Output image shading rate image for VRS according to VK_KHR_fragment_shading_rate.
 	color.r = clamp(floor(color.r * params.max_texel_factor + 0.1), 0.0, params.max_texel_factor);
@@ -0,0 +1,169 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Clusters covering more occlusion texels than this are considered visible.
+#define MAX_OCCLUSION_TEXELS 64
+
+#define CONE_CULL_DISABLED 0
+#define CONE_CULL_BACK 1
+#define CONE_CULL_FRONT 2
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+// Matches RS::MeshCluster. Cone axes follow the winding of Godot, they point along the face normals.
+struct Cluster {
+	vec3 center;
+	float radius;
+
+	vec3 cone_axis;
+	float cone_cutoff;
+
+	uint index_offset;
+	uint index_count;
+	uint pad0;
+	uint pad1;
+};
+
+// Everything is in the object space of the instance being culled.
+struct Element {
+	vec4 frustum_planes[6];
+
+	vec3 camera_position;
+	uint cone_cull_mode;
+
+	mat4 occlusion_view_projection;
+};
+
+layout(set = 0, binding = 0, std430) restrict readonly buffer Elements {
+	Element data[];
+}
+elements;
+
+// One indexed indirect draw command (five uints) per cluster, culled clusters draw zero instances.
+layout(set = 0, binding = 1, std430) restrict writeonly buffer DrawCommands {
+	uint data[];
+}
+draw_commands;
+
+layout(set = 1, binding = 0, std430) restrict readonly buffer Clusters {
+	Cluster data[];
+}
+clusters;
+
+#ifdef USE_OCCLUSION
+
+// Farthest linear depth of every texel of the reduced depth buffer, starting at the bottom of the screen.
+layout(set = 2, binding = 0, std430) restrict readonly buffer OcclusionDepth {
+	float data[];
+}
+occlusion_depth;
+
+#endif
+
+layout(push_constant, std430) uniform Params {
+	uint element_index;
+	uint cluster_count;
+	uint command_offset;
+	float occlusion_z_near;
+
+	uvec2 occlusion_size;
+	uint pad0;
+	uint pad1;
+}
+params;
+
+bool is_in_frustum(uint p_element, vec3 p_center, float p_radius) {
+	for (uint i = 0; i < 6; i++) {
+		vec4 plane = elements.data[p_element].frustum_planes[i];
+		if (dot(plane.xyz, p_center) - plane.w > p_radius) {
+			return false;
+		}
+	}
+	return true;
+}
+
+#ifdef USE_OCCLUSION
+
+bool is_occluded(uint p_element, vec3 p_center, vec3 p_extents) {
+	mat4 view_projection = elements.data[p_element].occlusion_view_projection;
+
+	vec2 rect_min = vec2(1e20);
+	vec2 rect_max = vec2(-1e20);
+	float min_depth = 1e20;
+
+	for (uint i = 0; i < 8; i++) {
+		vec3 corner = p_center + p_extents * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = view_projection * vec4(corner, 1.0);
+		if (clip.w <= params.occlusion_z_near) {
+			// Crosses the near plane, can't be tested.
+			return false;
+		}
+		vec2 ndc = clip.xy / clip.w;
+		rect_min = min(rect_min, ndc);
+		rect_max = max(rect_max, ndc);
+		min_depth = min(min_depth, clip.w);
+	}
+
+	vec2 size = vec2(params.occlusion_size);
+	ivec2 from = ivec2(floor(clamp(rect_min * 0.5 + 0.5, 0.0, 1.0) * size));
+	ivec2 to = min(ivec2(ceil(clamp(rect_max * 0.5 + 0.5, 0.0, 1.0) * size)), ivec2(params.occlusion_size));
+
+	if (any(lessThanEqual(to, from))) {
+		// Outside of the screen when the depth was captured, nothing is known about it.
+		return false;
+	}
+
+	if ((to.x - from.x) * (to.y - from.y) > MAX_OCCLUSION_TEXELS) {
+		return false;
+	}
+
+	for (int y = from.y; y < to.y; y++) {
+		for (int x = from.x; x < to.x; x++) {
+			if (occlusion_depth.data[y * int(params.occlusion_size.x) + x] >= min_depth) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
+
+void main() {
+	uint index = gl_GlobalInvocationID.x;
+	if (index >= params.cluster_count) {
+		return;
+	}
+
+	Cluster cluster = clusters.data[index];
+	uint element = params.element_index;
+
+	bool visible = is_in_frustum(element, cluster.center, cluster.radius);
+
+	uint cone_cull_mode = elements.data[element].cone_cull_mode;
+	if (visible && cone_cull_mode != CONE_CULL_DISABLED) {
+		// Every triangle of the cluster faces away from the camera, see meshopt_computeMeshletBounds().
+		vec3 axis = cone_cull_mode == CONE_CULL_FRONT ? -cluster.cone_axis : cluster.cone_axis;
+		vec3 view = cluster.center - elements.data[element].camera_position;
+		if (dot(view, axis) >= cluster.cone_cutoff * length(view) + cluster.radius) {
+			visible = false;
+		}
+	}
+
+#ifdef USE_OCCLUSION
+	if (visible) {
+		visible = !is_occluded(element, cluster.center, vec3(cluster.radius));
+	}
+#endif
+
+	uint offset = (params.command_offset + index) * 5;
+	draw_commands.data[offset + 0] = cluster.index_count;
+	draw_commands.data[offset + 1] = visible ? 1 : 0;
+	draw_commands.data[offset + 2] = cluster.index_offset;
+	draw_commands.data[offset + 3] = 0;
+	draw_commands.data[offset + 4] = 0;
+}
@@ -0,0 +1,173 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Instances are culled in chunks, each chunk reserves its range in the output with a single atomic.
+#define CHUNK_SIZE 64
+
+// Instances covering more occlusion texels than this are considered visible.
+#define MAX_OCCLUSION_TEXELS 64
+
+layout(local_size_x = CHUNK_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0, std140) uniform Params {
+	vec4 frustum_planes[6];
+
+	vec3 aabb_position;
+	uint instance_count;
+
+	vec3 aabb_size;
+	uint stride;
+
+	mat4 occlusion_view_projection;
+
+	uvec2 occlusion_size;
+	uint surface_count;
+	float occlusion_z_near;
+}
+params;
+
+layout(set = 0, binding = 1, std430) restrict readonly buffer Instances {
+	vec4 data[];
+}
+instances;
+
+layout(set = 0, binding = 2, std430) restrict writeonly buffer CulledInstances {
+	vec4 data[];
+}
+culled_instances;
+
+// One indexed indirect draw command (five uints) per mesh surface.
+layout(set = 0, binding = 3, std430) restrict buffer DrawCommands {
+	uint data[];
+}
+draw_commands;
+
+#ifdef USE_OCCLUSION
+
+// Farthest linear depth of every texel of the reduced depth buffer, starting at the bottom of the screen.
+layout(set = 1, binding = 0, std430) restrict readonly buffer OcclusionDepth {
+	float data[];
+}
+occlusion_depth;
+
+#endif
+
+shared uint chunk_visible_count;
+shared uint chunk_offset;
+
+bool is_in_frustum(vec3 p_center, vec3 p_extents) {
+	for (uint i = 0; i < 6; i++) {
+		vec4 plane = params.frustum_planes[i];
+		float distance = dot(plane.xyz, p_center) - plane.w;
+		float radius = dot(abs(plane.xyz), p_extents);
+		if (distance > radius) {
+			return false;
+		}
+	}
+	return true;
+}
+
+#ifdef USE_OCCLUSION
+
+bool is_occluded(vec3 p_center, vec3 p_extents) {
+	vec2 rect_min = vec2(1e20);
+	vec2 rect_max = vec2(-1e20);
+	float min_depth = 1e20;
+
+	for (uint i = 0; i < 8; i++) {
+		vec3 corner = p_center + p_extents * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = params.occlusion_view_projection * vec4(corner, 1.0);
+		if (clip.w <= params.occlusion_z_near) {
+			// Crosses the near plane, can't be tested.
+			return false;
+		}
+		vec2 ndc = clip.xy / clip.w;
+		rect_min = min(rect_min, ndc);
+		rect_max = max(rect_max, ndc);
+		min_depth = min(min_depth, clip.w);
+	}
+
+	vec2 size = vec2(params.occlusion_size);
+	ivec2 from = ivec2(floor(clamp(rect_min * 0.5 + 0.5, 0.0, 1.0) * size));
+	ivec2 to = min(ivec2(ceil(clamp(rect_max * 0.5 + 0.5, 0.0, 1.0) * size)), ivec2(params.occlusion_size));
+
+	if (any(lessThanEqual(to, from))) {
+		// Outside of the screen when the depth was captured, nothing is known about it.
+		return false;
+	}
+
+	if ((to.x - from.x) * (to.y - from.y) > MAX_OCCLUSION_TEXELS) {
+		return false;
+	}
+
+	for (int y = from.y; y < to.y; y++) {
+		for (int x = from.x; x < to.x; x++) {
+			if (occlusion_depth.data[y * int(params.occlusion_size.x) + x] >= min_depth) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
+
+void main() {
+	uint index = gl_GlobalInvocationID.x;
+
+	if (gl_LocalInvocationIndex == 0) {
+		chunk_visible_count = 0;
+	}
+
+	barrier();
+
+	bool visible = false;
+	uint local_offset = 0;
+	uint src_offset = index * params.stride;
+
+	if (index < params.instance_count) {
+		// Instance transforms are stored as three rows of a 3x4 matrix.
+		vec4 row0 = instances.data[src_offset + 0];
+		vec4 row1 = instances.data[src_offset + 1];
+		vec4 row2 = instances.data[src_offset + 2];
+
+		vec3 local_extents = params.aabb_size * 0.5;
+		vec3 local_center = params.aabb_position + local_extents;
+
+		vec3 center = vec3(dot(row0.xyz, local_center) + row0.w, dot(row1.xyz, local_center) + row1.w, dot(row2.xyz, local_center) + row2.w);
+		vec3 extents = vec3(dot(abs(row0.xyz), local_extents), dot(abs(row1.xyz), local_extents), dot(abs(row2.xyz), local_extents));
+
+		visible = is_in_frustum(center, extents);
+#ifdef USE_OCCLUSION
+		if (visible) {
+			visible = !is_occluded(center, extents);
+		}
+#endif
+
+		if (visible) {
+			local_offset = atomicAdd(chunk_visible_count, 1);
+		}
+	}
+
+	barrier();
+
+	if (gl_LocalInvocationIndex == 0 && chunk_visible_count > 0) {
+		chunk_offset = atomicAdd(draw_commands.data[1], chunk_visible_count);
+		for (uint i = 1; i < params.surface_count; i++) {
+			atomicAdd(draw_commands.data[i * 5 + 1], chunk_visible_count);
+		}
+	}
+
+	barrier();
+
+	if (visible) {
+		uint dst_offset = (chunk_offset + local_offset) * params.stride;
+		for (uint i = 0; i < params.stride; i++) {
+			culled_instances.data[dst_offset + i] = instances.data[src_offset + i];
+		}
+	}
+}
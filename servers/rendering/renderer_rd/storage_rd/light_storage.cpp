@@ -1423,7 +1423,8 @@ bool LightStorage::reflection_probe_instance_needs_redraw(RID p_instance) {
 		return true;
 	}
 
-	if (LightStorage::get_singleton()->reflection_probe_get_update_mode(rpi->probe) == RS::REFLECTION_PROBE_UPDATE_ALWAYS) {
+	// Probes updating always or time-sliced are queued again as soon as they are done.
+	if (LightStorage::get_singleton()->reflection_probe_get_update_mode(rpi->probe) != RS::REFLECTION_PROBE_UPDATE_ONCE) {
 		return true;
 	}
 
@@ -1856,6 +1857,7 @@ void LightStorage::lightmap_set_probe_capture_data(RID p_lightmap, const PackedV
 	lm->bsp_tree = p_bsp_tree;
 	lm->point_sh = p_point_sh;
 	lm->tetrahedra = p_tetrahedra;
+	_lightmap_build_tetrahedra_neighbors(lm->tetrahedra, lm->tetrahedra_neighbors);
 }
 
 void LightStorage::lightmap_set_baked_exposure_normalization(RID p_lightmap, float p_exposure) {
@@ -1901,7 +1903,7 @@ Dependency *LightStorage::lightmap_get_dependency(RID p_lightmap) const {
 	return &lm->dependency;
 }
 
-void LightStorage::lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh) {
+void LightStorage::lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh, int32_t *r_tetrahedron) {
 	Lightmap *lm = lightmap_owner.get_or_null(p_lightmap);
 	ERR_FAIL_NULL(lm);
 
@@ -1913,35 +1915,53 @@ void LightStorage::lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point,
 		return;
 	}
 
-	static_assert(sizeof(Lightmap::BSP) == 24);
+	int32_t tetrahedron_index = -1;
+	Color barycentric;
+
+	if (r_tetrahedron) {
+		// Moving objects usually stay in the same tetrahedron or one of its neighbors, so walk from the last one first.
+		tetrahedron_index = _lightmap_walk_tetrahedra(lm->points, lm->tetrahedra, lm->tetrahedra_neighbors, p_point, *r_tetrahedron, barycentric);
+	}
+
+	if (tetrahedron_index < 0) {
+		static_assert(sizeof(Lightmap::BSP) == 24);
 
-	const Lightmap::BSP *bsp = (const Lightmap::BSP *)lm->bsp_tree.ptr();
-	int32_t node = 0;
-	while (node >= 0) {
-		if (Plane(bsp[node].plane[0], bsp[node].plane[1], bsp[node].plane[2], bsp[node].plane[3]).is_point_over(p_point)) {
+		const Lightmap::BSP *bsp = (const Lightmap::BSP *)lm->bsp_tree.ptr();
+		int32_t node = 0;
+		while (node >= 0) {
+			if (Plane(bsp[node].plane[0], bsp[node].plane[1], bsp[node].plane[2], bsp[node].plane[3]).is_point_over(p_point)) {
 #ifdef DEBUG_ENABLED
-			ERR_FAIL_COND(bsp[node].over >= 0 && bsp[node].over < node);
+				ERR_FAIL_COND(bsp[node].over >= 0 && bsp[node].over < node);
 #endif
 
-			node = bsp[node].over;
-		} else {
+				node = bsp[node].over;
+			} else {
 #ifdef DEBUG_ENABLED
-			ERR_FAIL_COND(bsp[node].under >= 0 && bsp[node].under < node);
+				ERR_FAIL_COND(bsp[node].under >= 0 && bsp[node].under < node);
 #endif
-			node = bsp[node].under;
+				node = bsp[node].under;
+			}
 		}
-	}
 
-	if (node == Lightmap::BSP::EMPTY_LEAF) {
-		return; //nothing could be done
+		if (node == Lightmap::BSP::EMPTY_LEAF) {
+			if (r_tetrahedron) {
+				*r_tetrahedron = -1;
+			}
+			return; //nothing could be done
+		}
+
+		tetrahedron_index = ABS(node) - 1;
+
+		uint32_t *tetrahedron = (uint32_t *)&lm->tetrahedra[tetrahedron_index * 4];
+		barycentric = Geometry3D::tetrahedron_get_barycentric_coords(lm->points[tetrahedron[0]], lm->points[tetrahedron[1]], lm->points[tetrahedron[2]], lm->points[tetrahedron[3]], p_point);
 	}
 
-	node = ABS(node) - 1;
+	if (r_tetrahedron) {
+		*r_tetrahedron = tetrahedron_index;
+	}
 
-	uint32_t *tetrahedron = (uint32_t *)&lm->tetrahedra[node * 4];
-	Vector3 points[4] = { lm->points[tetrahedron[0]], lm->points[tetrahedron[1]], lm->points[tetrahedron[2]], lm->points[tetrahedron[3]] };
+	uint32_t *tetrahedron = (uint32_t *)&lm->tetrahedra[tetrahedron_index * 4];
 	const Color *sh_colors[4]{ &lm->point_sh[tetrahedron[0] * 9], &lm->point_sh[tetrahedron[1] * 9], &lm->point_sh[tetrahedron[2] * 9], &lm->point_sh[tetrahedron[3] * 9] };
-	Color barycentric = Geometry3D::tetrahedron_get_barycentric_coords(points[0], points[1], points[2], points[3], p_point);
 
 	for (int i = 0; i < 4; i++) {
 		float c = CLAMP(barycentric[i], 0.0, 1.0);
@@ -30,6 +30,10 @@
 
 #include "mesh_storage.h"
 
+#include "core/config/project_settings.h"
+#include "material_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
 using namespace RendererRD;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -41,6 +45,9 @@ MeshStorage *MeshStorage::get_singleton() {
 MeshStorage::MeshStorage() {
 	singleton = this;
 
+	lod_streaming_enabled = GLOBAL_GET("rendering/mesh_lod/streaming/enabled");
+	lod_streaming_budget = uint64_t(int(GLOBAL_GET("rendering/mesh_lod/streaming/budget_mb"))) * 1024 * 1024;
+
 	default_rd_storage_buffer = RD::get_singleton()->storage_buffer_create(sizeof(uint32_t) * 4);
 
 	//default rd buffers
@@ -181,6 +188,19 @@ MeshStorage::MeshStorage() {
 			skeleton_shader.default_skeleton_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, skeleton_shader.version_shader[0], SkeletonShader::UNIFORM_SET_SKELETON);
 		}
 	}
+
+	{
+		Vector<String> multimesh_cull_modes;
+		multimesh_cull_modes.push_back("");
+		multimesh_cull_modes.push_back("\n#define USE_OCCLUSION\n");
+
+		multimesh_cull_shader.shader.initialize(multimesh_cull_modes);
+		multimesh_cull_shader.version = multimesh_cull_shader.shader.version_create();
+		for (int i = 0; i < MultiMeshCullShader::SHADER_MODE_MAX; i++) {
+			multimesh_cull_shader.version_shader[i] = multimesh_cull_shader.shader.version_get_shader(multimesh_cull_shader.version, i);
+			multimesh_cull_shader.pipeline[i] = RD::get_singleton()->compute_pipeline_create(multimesh_cull_shader.version_shader[i]);
+		}
+	}
 }
 
 MeshStorage::~MeshStorage() {
@@ -190,6 +210,7 @@ MeshStorage::~MeshStorage() {
 	}
 
 	skeleton_shader.shader.version_free(skeleton_shader.version);
+	multimesh_cull_shader.shader.version_free(multimesh_cull_shader.version);
 
 	RD::get_singleton()->free(default_rd_storage_buffer);
 
@@ -408,22 +429,39 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 
 	if (new_surface.index_count) {
 		bool is_index_16 = new_surface.vertex_count <= 65536 && new_surface.vertex_count > 0;
-
-		s->index_buffer = RD::get_singleton()->index_buffer_create(new_surface.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.index_data, false);
+		s->index_format = is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32;
 		s->index_count = new_surface.index_count;
-		s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+
+		// With streaming, only the coarsest LOD is uploaded, finer ones are uploaded once the renderer asks for them.
+		s->lod_streamed = lod_streaming_enabled && new_surface.lods.size() > 0;
+		if (s->lod_streamed) {
+			s->index_data = new_surface.index_data;
+		} else {
+			s->index_buffer = RD::get_singleton()->index_buffer_create(new_surface.index_count, s->index_format, new_surface.index_data, false);
+			s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+		}
 		if (new_surface.lods.size()) {
 			s->lods = memnew_arr(Mesh::Surface::LOD, new_surface.lods.size());
 			s->lod_count = new_surface.lods.size();
 
 			for (int i = 0; i < new_surface.lods.size(); i++) {
 				uint32_t indices = new_surface.lods[i].index_data.size() / (is_index_16 ? 2 : 4);
-				s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, new_surface.lods[i].index_data);
-				s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
+				if (s->lod_streamed) {
+					s->lods[i].index_data = new_surface.lods[i].index_data;
+				}
+				if (!s->lod_streamed || i == new_surface.lods.size() - 1) {
+					s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, s->index_format, new_surface.lods[i].index_data);
+					s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
+				}
 				s->lods[i].edge_length = new_surface.lods[i].edge_length;
 				s->lods[i].index_count = indices;
 			}
 		}
+
+		if (s->lod_streamed) {
+			s->resident_lod = s->lod_count;
+			lod_streamed_surfaces.add(&s->lod_stream_element);
+		}
 	}
 
 	ERR_FAIL_COND_MSG(!new_surface.index_count && !new_surface.vertex_count, "Meshes must contain a vertex array, an index array, or both");
@@ -438,6 +476,12 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 		s->blend_shape_buffer = RD::get_singleton()->storage_buffer_create(new_surface.blend_shape_data.size(), new_surface.blend_shape_data);
 	}
 
+	if (new_surface.cluster_data.size() && new_surface.index_count) {
+		ERR_FAIL_COND(new_surface.cluster_data.size() % sizeof(RS::MeshCluster) != 0);
+		s->cluster_buffer = RD::get_singleton()->storage_buffer_create(new_surface.cluster_data.size(), new_surface.cluster_data);
+		s->cluster_count = new_surface.cluster_data.size() / sizeof(RS::MeshCluster);
+	}
+
 	if (use_as_storage) {
 		Vector<RD::Uniform> uniforms;
 		{
@@ -606,14 +650,14 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	sd.primitive = s.primitive;
 
 	if (sd.index_count) {
-		sd.index_data = RD::get_singleton()->buffer_get_data(s.index_buffer);
+		sd.index_data = s.lod_streamed ? s.index_data : RD::get_singleton()->buffer_get_data(s.index_buffer);
 	}
 	sd.aabb = s.aabb;
 	sd.uv_scale = s.uv_scale;
 	for (uint32_t i = 0; i < s.lod_count; i++) {
 		RS::SurfaceData::LOD lod;
 		lod.edge_length = s.lods[i].edge_length;
-		lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		lod.index_data = s.lod_streamed ? s.lods[i].index_data : RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
 		sd.lods.push_back(lod);
 	}
 
@@ -624,6 +668,10 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 		sd.blend_shape_data = RD::get_singleton()->buffer_get_data(s.blend_shape_buffer);
 	}
 
+	if (s.cluster_buffer.is_valid()) {
+		sd.cluster_data = RD::get_singleton()->buffer_get_data(s.cluster_buffer);
+	}
+
 	return sd;
 }
 
@@ -707,6 +755,11 @@ AABB MeshStorage::mesh_get_aabb(RID p_mesh, RID p_skeleton) {
 					}
 				}
 			} else {
+				thread_local LocalVector<AABB> bone_aabbs;
+				thread_local LocalVector<Transform3D> bone_xforms;
+				bone_aabbs.clear();
+				bone_xforms.clear();
+
 				for (int j = 0; j < bs; j++) {
 					if (skbones[j].size == Vector3(-1, -1, -1)) {
 						continue; //bone is unused
@@ -729,10 +782,15 @@ AABB MeshStorage::mesh_get_aabb(RID p_mesh, RID p_skeleton) {
 					mtx.basis.rows[2][2] = dataptr[10];
 					mtx.origin.z = dataptr[11];
 
-					// Transform bounds to skeleton's space before applying animation data.
-					AABB baabb = surface.mesh_to_skeleton_xform.xform(skbones[j]);
-					baabb = mtx.xform(baabb);
+					bone_aabbs.push_back(skbones[j]);
+					bone_xforms.push_back(mtx);
+				}
+
+				// Transform bounds to skeleton's space before applying animation data.
+				surface.mesh_to_skeleton_xform.xform_array(bone_aabbs.ptr(), bone_aabbs.ptr(), bone_aabbs.size());
+				AABB::xform_batch(bone_xforms.ptr(), bone_aabbs.ptr(), bone_aabbs.ptr(), bone_aabbs.size());
 
+				for (const AABB &baabb : bone_aabbs) {
 					if (!found_bone_aabb) {
 						laabb = baabb;
 						found_bone_aabb = true;
@@ -825,13 +883,23 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 			memfree(s.versions); //reallocs, so free with memfree.
 		}
 
+		if (s.lod_streamed) {
+			// Keep the budget accounting in sync, the buffers themselves are freed below.
+			for (uint32_t j = s.resident_lod; j < s.lod_count; j++) {
+				lod_streaming_bytes -= _mesh_surface_get_lod_size(&s, j);
+			}
+			lod_streamed_surfaces.remove(&s.lod_stream_element);
+		}
+
 		if (s.index_buffer.is_valid()) {
 			RD::get_singleton()->free(s.index_buffer);
 		}
 
 		if (s.lod_count) {
 			for (uint32_t j = 0; j < s.lod_count; j++) {
-				RD::get_singleton()->free(s.lods[j].index_buffer);
+				if (s.lods[j].index_buffer.is_valid()) {
+					RD::get_singleton()->free(s.lods[j].index_buffer);
+				}
 			}
 			memdelete_arr(s.lods);
 		}
@@ -840,6 +908,10 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 			RD::get_singleton()->free(s.blend_shape_buffer);
 		}
 
+		if (s.cluster_buffer.is_valid()) {
+			RD::get_singleton()->free(s.cluster_buffer);
+		}
+
 		memdelete(mesh->surfaces[i]);
 	}
 	if (mesh->surfaces) {
@@ -1048,6 +1120,20 @@ void MeshStorage::update_mesh_instances() {
 
 		Skeleton *sk = skeleton_owner.get_or_null(mi->skeleton);
 
+		// Crowds often share a skeleton between many instances of the same mesh, the skinned vertices are then identical.
+		MeshInstance *shared_from = nullptr;
+		if (sk && !sk->use_2d && mi->mesh->blend_shape_count == 0) {
+			SharedSkinningKey key;
+			key.mesh = mi->mesh;
+			key.skeleton = mi->skeleton;
+			MeshInstance **first = shared_skinning_instances.getptr(key);
+			if (first) {
+				shared_from = *first;
+			} else {
+				shared_skinning_instances.insert(key, mi);
+			}
+		}
+
 		for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 			if (mi->surfaces[i].uniform_set[0].is_null() || mi->mesh->surfaces[i]->uniform_set.is_null()) {
 				// Skip over mesh instances that don't require their own uniform buffers.
@@ -1075,6 +1161,18 @@ void MeshStorage::update_mesh_instances() {
 				continue;
 			}
 
+			if (shared_from) {
+				const MeshInstance::Surface &src = shared_from->surfaces[i];
+				if (src.uniform_set[src.current_buffer].is_valid()) {
+					SharedSkinningCopy copy;
+					copy.src_buffer = src.vertex_buffer[src.current_buffer];
+					copy.dst_buffer = mi->surfaces[i].vertex_buffer[mi->surfaces[i].current_buffer];
+					copy.size = mi->mesh->surfaces[i]->vertex_buffer_size;
+					shared_skinning_copies.push_back(copy);
+					continue;
+				}
+			}
+
 			bool array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
 
 			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
@@ -1138,6 +1236,146 @@ void MeshStorage::update_mesh_instances() {
 	}
 
 	RD::get_singleton()->compute_list_end();
+
+	// Copies can't be recorded in a compute list, the graph orders them after the dispatches they read from.
+	for (const SharedSkinningCopy &copy : shared_skinning_copies) {
+		RD::get_singleton()->buffer_copy(copy.src_buffer, copy.dst_buffer, 0, 0, copy.size);
+	}
+	shared_skinning_copies.clear();
+	shared_skinning_instances.clear();
+}
+
+/* MESH LOD STREAMING */
+
+uint64_t MeshStorage::_mesh_surface_get_lod_size(const Mesh::Surface *s, uint32_t p_lod) const {
+	return p_lod == 0 ? s->index_data.size() : s->lods[p_lod - 1].index_data.size();
+}
+
+void MeshStorage::_mesh_surface_set_resident_lod(Mesh::Surface *s, uint32_t p_lod) {
+	p_lod = MIN(p_lod, s->lod_count);
+
+	// The coarsest LOD is never freed.
+	for (uint32_t i = p_lod; i < s->resident_lod; i++) {
+		RID &index_buffer = i == 0 ? s->index_buffer : s->lods[i - 1].index_buffer;
+		RID &index_array = i == 0 ? s->index_array : s->lods[i - 1].index_array;
+		uint32_t index_count = i == 0 ? s->index_count : s->lods[i - 1].index_count;
+		index_buffer = RD::get_singleton()->index_buffer_create(index_count, s->index_format, i == 0 ? s->index_data : s->lods[i - 1].index_data);
+		index_array = RD::get_singleton()->index_array_create(index_buffer, 0, index_count);
+		lod_streaming_bytes += _mesh_surface_get_lod_size(s, i);
+	}
+	for (uint32_t i = s->resident_lod; i < p_lod; i++) {
+		RID &index_buffer = i == 0 ? s->index_buffer : s->lods[i - 1].index_buffer;
+		RID &index_array = i == 0 ? s->index_array : s->lods[i - 1].index_array;
+		RD::get_singleton()->free(index_buffer); // Frees the index array as a dependency.
+		index_buffer = RID();
+		index_array = RID();
+		lod_streaming_bytes -= _mesh_surface_get_lod_size(s, i);
+	}
+
+	s->resident_lod = p_lod;
+}
+
+void MeshStorage::update_mesh_lod_streaming() {
+	if (lod_streamed_surfaces.first() == nullptr) {
+		return;
+	}
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	LocalVector<Mesh::Surface *> evictable;
+
+	for (SelfList<Mesh::Surface> *E = lod_streamed_surfaces.first(); E; E = E->next()) {
+		Mesh::Surface *s = E->self();
+		uint32_t requested = s->requested_lod.get();
+		if (requested != UINT32_MAX) {
+			s->requested_lod.set(UINT32_MAX);
+			s->lod_last_used = frame;
+			if (requested < s->resident_lod) {
+				_mesh_surface_set_resident_lod(s, requested);
+			}
+		} else if (s->resident_lod < s->lod_count) {
+			// Surfaces drawn this frame are never evicted, even when that means going over the budget.
+			evictable.push_back(s);
+		}
+	}
+
+	if (lod_streaming_bytes <= lod_streaming_budget) {
+		return;
+	}
+
+	struct SortByLastUsed {
+		_FORCE_INLINE_ bool operator()(const Mesh::Surface *p_a, const Mesh::Surface *p_b) const {
+			return p_a->lod_last_used < p_b->lod_last_used;
+		}
+	};
+
+	evictable.sort_custom<SortByLastUsed>();
+	for (Mesh::Surface *s : evictable) {
+		if (lod_streaming_bytes <= lod_streaming_budget) {
+			break;
+		}
+		_mesh_surface_set_resident_lod(s, s->lod_count);
+	}
+}
+
+uint64_t MeshStorage::get_memory_usage() const {
+	RD *rd = RD::get_singleton();
+	uint64_t usage = 0;
+
+	List<RID> meshes;
+	mesh_owner.get_owned_list(&meshes);
+	for (const RID &E : meshes) {
+		const Mesh *mesh = mesh_owner.get_or_null(E);
+		if (!mesh) {
+			continue;
+		}
+		for (uint32_t i = 0; i < mesh->surface_count; i++) {
+			const Mesh::Surface *s = mesh->surfaces[i];
+			const RID buffers[] = { s->vertex_buffer, s->attribute_buffer, s->skin_buffer, s->index_buffer, s->blend_shape_buffer, s->cluster_buffer };
+			for (const RID &buffer : buffers) {
+				if (buffer.is_valid()) {
+					usage += rd->get_resource_memory_usage(buffer);
+				}
+			}
+			for (uint32_t j = 0; j < s->lod_count; j++) {
+				if (s->lods[j].index_buffer.is_valid()) {
+					usage += rd->get_resource_memory_usage(s->lods[j].index_buffer);
+				}
+			}
+		}
+	}
+
+	List<RID> mesh_instances;
+	mesh_instance_owner.get_owned_list(&mesh_instances);
+	for (const RID &E : mesh_instances) {
+		const MeshInstance *mi = mesh_instance_owner.get_or_null(E);
+		if (!mi) {
+			continue;
+		}
+		for (const MeshInstance::Surface &surface : mi->surfaces) {
+			for (uint32_t j = 0; j < 2; j++) {
+				if (surface.vertex_buffer[j].is_valid()) {
+					usage += rd->get_resource_memory_usage(surface.vertex_buffer[j]);
+				}
+			}
+		}
+	}
+
+	List<RID> multimeshes;
+	multimesh_owner.get_owned_list(&multimeshes);
+	for (const RID &E : multimeshes) {
+		const MultiMesh *multimesh = multimesh_owner.get_or_null(E);
+		if (!multimesh) {
+			continue;
+		}
+		const RID buffers[] = { multimesh->buffer, multimesh->cull_params_buffer, multimesh->culled_buffer, multimesh->draw_commands_buffer };
+		for (const RID &buffer : buffers) {
+			if (buffer.is_valid()) {
+				usage += rd->get_resource_memory_usage(buffer);
+			}
+		}
+	}
+
+	return usage;
 }
 
 void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint64_t p_input_mask, bool p_input_motion_vectors, MeshInstance::Surface *mis, uint32_t p_current_buffer, uint32_t p_previous_buffer) {
@@ -1410,6 +1648,8 @@ void MeshStorage::multimesh_allocate_data(RID p_multimesh, int p_instances, RS::
 		multimesh->uniform_set_3d = RID(); //cleared by dependency
 	}
 
+	_multimesh_free_cull_data(multimesh);
+
 	if (multimesh->data_cache_dirty_regions) {
 		memdelete_arr(multimesh->data_cache_dirty_regions);
 		multimesh->data_cache_dirty_regions = nullptr;
@@ -1487,6 +1727,9 @@ void MeshStorage::_multimesh_enable_motion_vectors(MultiMesh *multimesh) {
 	multimesh->buffer = new_buffer;
 	multimesh->uniform_set_3d = RID(); // Cleared by dependency.
 
+	// Instances with motion vectors are never culled on the GPU, as the previous transforms would not match.
+	_multimesh_free_cull_data(multimesh);
+
 	// Invalidate any references to the buffer that was released and the uniform set that was pointing to it.
 	multimesh->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MULTIMESH);
 }
@@ -1820,6 +2063,155 @@ RID MeshStorage::multimesh_get_mesh(RID p_multimesh) const {
 	return multimesh->mesh;
 }
 
+void MeshStorage::_multimesh_free_cull_data(MultiMesh *multimesh) {
+	if (multimesh->culled_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->culled_buffer);
+		multimesh->culled_buffer = RID();
+		multimesh->culled_uniform_set_3d = RID(); // Cleared by dependency.
+	}
+	if (multimesh->draw_commands_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->draw_commands_buffer);
+		multimesh->draw_commands_buffer = RID();
+	}
+	if (multimesh->cull_params_buffer.is_valid()) {
+		RD::get_singleton()->free(multimesh->cull_params_buffer);
+		multimesh->cull_params_buffer = RID();
+	}
+	multimesh->cull_uniform_set = RID(); // Cleared by dependency.
+	multimesh->draw_commands_surface_count = 0;
+}
+
+bool MeshStorage::multimesh_cull_instances(RID p_multimesh, const Transform3D &p_transform, const Vector<Plane> &p_frustum, RID p_occlusion_buffer, const Size2i &p_occlusion_size, const Projection &p_occlusion_view_projection, float p_occlusion_z_near) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL_V(multimesh, false);
+	ERR_FAIL_COND_V(p_frustum.size() != 6, false);
+
+	// 2D transforms are rare in 3D scenes, and motion vectors need both copies of the buffer in the original order.
+	if (multimesh->xform_format != RS::MULTIMESH_TRANSFORM_3D || multimesh->motion_vectors_enabled || !multimesh->buffer.is_valid() || multimesh->mesh.is_null()) {
+		return false;
+	}
+
+	Mesh *mesh = mesh_owner.get_or_null(multimesh->mesh);
+	if (mesh == nullptr || mesh->surface_count == 0) {
+		return false;
+	}
+
+	uint32_t instance_count = multimesh_get_instances_to_draw(p_multimesh);
+	if (instance_count == 0) {
+		return false;
+	}
+
+	if (!multimesh->culled_buffer.is_valid()) {
+		multimesh->culled_buffer = RD::get_singleton()->storage_buffer_create(multimesh->instances * multimesh->stride_cache * sizeof(float));
+		multimesh->cull_params_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(MultiMeshCullShader::Params));
+	}
+
+	if (multimesh->draw_commands_surface_count != mesh->surface_count) {
+		if (multimesh->draw_commands_buffer.is_valid()) {
+			RD::get_singleton()->free(multimesh->draw_commands_buffer);
+		}
+		multimesh->draw_commands_buffer = RD::get_singleton()->storage_buffer_create(mesh->surface_count * MULTIMESH_DRAW_COMMAND_SIZE, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+		multimesh->draw_commands_surface_count = mesh->surface_count;
+		multimesh->cull_uniform_set = RID(); // Cleared by dependency.
+	}
+
+	if (!RD::get_singleton()->uniform_set_is_valid(multimesh->cull_uniform_set)) {
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_UNIFORM_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->cull_params_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 1;
+			u.append_id(multimesh->buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 2;
+			u.append_id(multimesh->culled_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 3;
+			u.append_id(multimesh->draw_commands_buffer);
+			uniforms.push_back(u);
+		}
+		multimesh->cull_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, multimesh_cull_shader.version_shader[0], MultiMeshCullShader::UNIFORM_SET_MULTIMESH);
+	}
+
+	// Reset the draw commands, the instance counts are accumulated by the shader.
+	LocalVector<uint32_t> draw_commands;
+	draw_commands.resize(mesh->surface_count * 5);
+	for (uint32_t i = 0; i < mesh->surface_count; i++) {
+		draw_commands[i * 5 + 0] = mesh_surface_get_vertices_drawn_count(mesh->surfaces[i]);
+		draw_commands[i * 5 + 1] = 0;
+		draw_commands[i * 5 + 2] = 0;
+		draw_commands[i * 5 + 3] = 0;
+		draw_commands[i * 5 + 4] = 0;
+	}
+	RD::get_singleton()->buffer_update(multimesh->draw_commands_buffer, 0, draw_commands.size() * sizeof(uint32_t), draw_commands.ptr());
+
+	bool use_occlusion = p_occlusion_buffer.is_valid() && p_occlusion_size.x > 0 && p_occlusion_size.y > 0;
+
+	MultiMeshCullShader::Params params;
+	memset(&params, 0, sizeof(MultiMeshCullShader::Params));
+
+	// Instance transforms are local to the MultiMesh, so bring the frustum there instead.
+	Transform3D inverse = p_transform.affine_inverse();
+	Basis basis_transpose = p_transform.basis.transposed();
+	for (int i = 0; i < 6; i++) {
+		Plane plane = Transform3D::xform_inv_fast(p_frustum[i], inverse, basis_transpose);
+		params.frustum_planes[i][0] = plane.normal.x;
+		params.frustum_planes[i][1] = plane.normal.y;
+		params.frustum_planes[i][2] = plane.normal.z;
+		params.frustum_planes[i][3] = plane.d;
+	}
+
+	AABB mesh_aabb = mesh_get_aabb(multimesh->mesh);
+	params.aabb_position[0] = mesh_aabb.position.x;
+	params.aabb_position[1] = mesh_aabb.position.y;
+	params.aabb_position[2] = mesh_aabb.position.z;
+	params.aabb_size[0] = mesh_aabb.size.x;
+	params.aabb_size[1] = mesh_aabb.size.y;
+	params.aabb_size[2] = mesh_aabb.size.z;
+	params.instance_count = instance_count;
+	params.stride = multimesh->stride_cache / 4;
+	params.surface_count = mesh->surface_count;
+
+	if (use_occlusion) {
+		MaterialStorage::store_camera(p_occlusion_view_projection * Projection(p_transform), params.occlusion_view_projection);
+		params.occlusion_size[0] = p_occlusion_size.x;
+		params.occlusion_size[1] = p_occlusion_size.y;
+		params.occlusion_z_near = p_occlusion_z_near;
+	}
+
+	RD::get_singleton()->buffer_update(multimesh->cull_params_buffer, 0, sizeof(MultiMeshCullShader::Params), &params);
+
+	uint32_t shader_mode = use_occlusion ? MultiMeshCullShader::SHADER_MODE_FRUSTUM_OCCLUSION : MultiMeshCullShader::SHADER_MODE_FRUSTUM;
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, multimesh_cull_shader.pipeline[shader_mode]);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, multimesh->cull_uniform_set, MultiMeshCullShader::UNIFORM_SET_MULTIMESH);
+	if (use_occlusion) {
+		RD::Uniform u_occlusion(RD::UNIFORM_TYPE_STORAGE_BUFFER, 0, p_occlusion_buffer);
+		RID occlusion_uniform_set = UniformSetCacheRD::get_singleton()->get_cache(multimesh_cull_shader.version_shader[shader_mode], MultiMeshCullShader::UNIFORM_SET_OCCLUSION, u_occlusion);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, occlusion_uniform_set, MultiMeshCullShader::UNIFORM_SET_OCCLUSION);
+	}
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, instance_count, 1, 1);
+	RD::get_singleton()->compute_list_end();
+
+	return true;
+}
+
 Dependency *MeshStorage::multimesh_get_dependency(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, nullptr);
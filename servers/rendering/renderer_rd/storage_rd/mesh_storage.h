@@ -35,6 +35,7 @@
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
+#include "servers/rendering/renderer_rd/shaders/multimesh_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/skeleton.glsl.gen.h"
 #include "servers/rendering/storage/mesh_storage.h"
 #include "servers/rendering/storage/utilities.h"
@@ -111,11 +112,22 @@ private:
 				uint32_t index_count = 0;
 				RID index_buffer;
 				RID index_array;
+				Vector<uint8_t> index_data; // Only kept when LODs are streamed.
 			};
 
 			LOD *lods = nullptr;
 			uint32_t lod_count = 0;
 
+			// When LODs are streamed, only the index buffers from resident_lod to the coarsest LOD exist on the GPU
+			// (0 being the full index buffer). Finer ones are uploaded again from the system memory copies when requested.
+			bool lod_streamed = false;
+			uint32_t resident_lod = 0;
+			SafeNumeric<uint32_t> requested_lod{ UINT32_MAX };
+			uint64_t lod_last_used = 0;
+			RD::IndexBufferFormat index_format = RD::INDEX_BUFFER_FORMAT_UINT32;
+			Vector<uint8_t> index_data;
+			SelfList<Surface> lod_stream_element;
+
 			AABB aabb;
 
 			Vector<AABB> bone_aabbs;
@@ -128,6 +140,10 @@ private:
 
 			RID blend_shape_buffer;
 
+			// Bounds of the triangle clusters of the base index buffer, see RS::MeshCluster.
+			RID cluster_buffer;
+			uint32_t cluster_count = 0;
+
 			RID material;
 
 			uint32_t render_index = 0;
@@ -140,6 +156,9 @@ private:
 			uint64_t particles_render_pass = 0;
 
 			RID uniform_set;
+
+			Surface() :
+					lod_stream_element(this) {}
 		};
 
 		uint32_t blend_shape_count = 0;
@@ -210,6 +229,36 @@ private:
 	SelfList<MeshInstance>::List dirty_mesh_instance_weights;
 	SelfList<MeshInstance>::List dirty_mesh_instance_arrays;
 
+	// Instances of a mesh without blend shapes driven by the same 3D skeleton are skinned once per update, the others copy it.
+	struct SharedSkinningKey {
+		const Mesh *mesh = nullptr;
+		RID skeleton;
+
+		static uint32_t hash(const SharedSkinningKey &p_key) {
+			return hash_murmur3_one_64(p_key.skeleton.get_id(), hash_murmur3_one_64((uint64_t)p_key.mesh));
+		}
+		bool operator==(const SharedSkinningKey &p_key) const {
+			return mesh == p_key.mesh && skeleton == p_key.skeleton;
+		}
+	};
+	struct SharedSkinningCopy {
+		RID src_buffer;
+		RID dst_buffer;
+		uint32_t size = 0;
+	};
+	HashMap<SharedSkinningKey, MeshInstance *, SharedSkinningKey> shared_skinning_instances;
+	LocalVector<SharedSkinningCopy> shared_skinning_copies;
+
+	/* Mesh LOD streaming */
+
+	bool lod_streaming_enabled = false;
+	uint64_t lod_streaming_budget = 0;
+	uint64_t lod_streaming_bytes = 0;
+	SelfList<Mesh::Surface>::List lod_streamed_surfaces;
+
+	uint64_t _mesh_surface_get_lod_size(const Mesh::Surface *s, uint32_t p_lod) const;
+	void _mesh_surface_set_resident_lod(Mesh::Surface *s, uint32_t p_lod);
+
 	/* MultiMesh */
 
 	struct MultiMesh {
@@ -241,6 +290,14 @@ private:
 		RID uniform_set_3d;
 		RID uniform_set_2d;
 
+		// GPU instance culling, allocated the first time the MultiMesh is culled.
+		RID cull_params_buffer;
+		RID culled_buffer; // Compacted copy of the visible instances.
+		RID draw_commands_buffer; // One indirect draw command per mesh surface.
+		RID cull_uniform_set;
+		RID culled_uniform_set_3d;
+		uint32_t draw_commands_surface_count = 0;
+
 		bool dirty = false;
 		MultiMesh *dirty_list = nullptr;
 
@@ -258,6 +315,40 @@ private:
 	_FORCE_INLINE_ void _multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
+	void _multimesh_free_cull_data(MultiMesh *multimesh);
+
+	struct MultiMeshCullShader {
+		struct Params {
+			float frustum_planes[6][4];
+
+			float aabb_position[3];
+			uint32_t instance_count;
+
+			float aabb_size[3];
+			uint32_t stride;
+
+			float occlusion_view_projection[16];
+
+			uint32_t occlusion_size[2];
+			uint32_t surface_count;
+			float occlusion_z_near;
+		};
+
+		enum {
+			UNIFORM_SET_MULTIMESH = 0,
+			UNIFORM_SET_OCCLUSION = 1,
+		};
+		enum {
+			SHADER_MODE_FRUSTUM,
+			SHADER_MODE_FRUSTUM_OCCLUSION,
+			SHADER_MODE_MAX
+		};
+
+		MultimeshCullShaderRD shader;
+		RID version;
+		RID version_shader[SHADER_MODE_MAX];
+		RID pipeline[SHADER_MODE_MAX];
+	} multimesh_cull_shader;
 
 	/* Skeleton */
 
@@ -473,6 +564,12 @@ public:
 	_FORCE_INLINE_ RID mesh_surface_get_index_array(void *p_surface, uint32_t p_lod) const {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
+		if (s->lod_streamed) {
+			// Request the LOD for the next frame, and draw the finest one available meanwhile.
+			s->requested_lod.exchange_if_lower(p_lod);
+			p_lod = MAX(p_lod, s->resident_lod);
+		}
+
 		if (p_lod == 0) {
 			return s->index_array;
 		} else {
@@ -480,6 +577,21 @@ public:
 		}
 	}
 
+	_FORCE_INLINE_ uint32_t mesh_surface_get_cluster_count(void *p_surface) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return s->cluster_count;
+	}
+
+	_FORCE_INLINE_ RID mesh_surface_get_cluster_buffer(void *p_surface) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return s->cluster_buffer;
+	}
+
+	_FORCE_INLINE_ bool mesh_surface_is_lod_resident(void *p_surface, uint32_t p_lod) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return !s->lod_streamed || p_lod >= s->resident_lod;
+	}
+
 	_FORCE_INLINE_ void mesh_surface_get_vertex_arrays_and_format(void *p_surface, uint64_t p_input_mask, bool p_input_motion_vectors, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
@@ -617,6 +729,10 @@ public:
 	virtual void mesh_instance_set_canvas_item_transform(RID p_mesh_instance, const Transform2D &p_transform) override;
 	virtual void update_mesh_instances() override;
 
+	virtual void update_mesh_lod_streaming() override;
+
+	uint64_t get_memory_usage() const;
+
 	/* MULTIMESH API */
 
 	bool owns_multimesh(RID p_rid) { return multimesh_owner.owns(p_rid); };
@@ -722,6 +838,41 @@ public:
 		return multimesh->uniform_set_2d;
 	}
 
+	// Size in bytes of each command in the buffer returned by multimesh_get_draw_commands_buffer().
+	// Commands are laid out for indexed draws, non-indexed surfaces use the first four values.
+	static const uint32_t MULTIMESH_DRAW_COMMAND_SIZE = 5 * sizeof(uint32_t);
+
+	bool multimesh_cull_instances(RID p_multimesh, const Transform3D &p_transform, const Vector<Plane> &p_frustum, RID p_occlusion_buffer = RID(), const Size2i &p_occlusion_size = Size2i(), const Projection &p_occlusion_view_projection = Projection(), float p_occlusion_z_near = 0.0);
+
+	_FORCE_INLINE_ RID multimesh_get_culled_3d_uniform_set(RID p_multimesh, RID p_shader, uint32_t p_set) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr) {
+			return RID();
+		}
+		if (!multimesh->culled_uniform_set_3d.is_valid()) {
+			if (!multimesh->culled_buffer.is_valid()) {
+				return RID();
+			}
+			Vector<RD::Uniform> uniforms;
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = 0;
+			u.append_id(multimesh->culled_buffer);
+			uniforms.push_back(u);
+			multimesh->culled_uniform_set_3d = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_set);
+		}
+
+		return multimesh->culled_uniform_set_3d;
+	}
+
+	_FORCE_INLINE_ RID multimesh_get_draw_commands_buffer(RID p_multimesh) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr) {
+			return RID();
+		}
+		return multimesh->draw_commands_buffer;
+	}
+
 	Dependency *multimesh_get_dependency(RID p_multimesh) const;
 
 	/* SKELETON API */
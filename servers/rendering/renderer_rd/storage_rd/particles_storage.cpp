@@ -30,6 +30,7 @@
 
 #include "particles_storage.h"
 
+#include "core/config/project_settings.h"
 #include "servers/rendering/renderer_rd/renderer_compositor_rd.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "texture_storage.h"
@@ -53,6 +54,8 @@ ParticlesStorage::ParticlesStorage() {
 
 	/* Particles */
 
+	particles_budget = GLOBAL_GET("rendering/limits/particles/max_gpu_particles");
+
 	{
 		String defines = "#define SAMPLERS_BINDING_FIRST_INDEX " + itos(SAMPLERS_BINDING_FIRST_INDEX) + "\n";
 		// Initialize particles
@@ -199,6 +202,10 @@ ParticlesStorage::~ParticlesStorage() {
 		sort_effects = nullptr;
 	}
 
+	if (heightfield_scratch_texture.is_valid()) {
+		RD::get_singleton()->free(heightfield_scratch_texture);
+	}
+
 	singleton = nullptr;
 }
 
@@ -345,6 +352,13 @@ void ParticlesStorage::particles_set_amount_ratio(RID p_particles, float p_amoun
 	particles->amount_ratio = p_amount_ratio;
 }
 
+void ParticlesStorage::particles_set_lod_threshold(RID p_particles, float p_threshold) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	particles->lod_threshold = p_threshold;
+}
+
 void ParticlesStorage::particles_set_lifetime(RID p_particles, double p_lifetime) {
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL(particles);
@@ -606,6 +620,13 @@ void ParticlesStorage::particles_request_process(RID p_particles) {
 	}
 }
 
+void ParticlesStorage::particles_set_lod_screen_size(RID p_particles, float p_screen_size) {
+	Particles *particles = particles_owner.get_or_null(p_particles);
+	ERR_FAIL_NULL(particles);
+
+	particles->lod_screen_size = MAX(particles->lod_screen_size, p_screen_size);
+}
+
 AABB ParticlesStorage::particles_get_current_aabb(RID p_particles) {
 	const Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_NULL_V(particles, AABB());
@@ -827,7 +848,7 @@ void ParticlesStorage::_particles_process(Particles *p_particles, double p_delta
 
 	frame_params.cycle = p_particles->cycle_number;
 	frame_params.frame = p_particles->frame_counter++;
-	frame_params.amount_ratio = p_particles->amount_ratio;
+	frame_params.amount_ratio = p_particles->amount_ratio * p_particles->lod_amount_ratio;
 	frame_params.pad1 = 0;
 	frame_params.pad2 = 0;
 	frame_params.emitter_velocity[0] = p_particles->emitter_velocity.x;
@@ -1272,7 +1293,11 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
 
 		RD::get_singleton()->compute_list_end();
-		sort_effects->sort_buffer(particles->particles_sort_uniform_set, particles->amount);
+		if (uint32_t(particles->amount) > RendererRD::SortEffects::RADIX_SORT_THRESHOLD) {
+			sort_effects->radix_sort_buffer(particles->particles_sort_buffer, particles->amount);
+		} else {
+			sort_effects->sort_buffer(particles->particles_sort_uniform_set, particles->amount);
+		}
 	}
 
 	if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
@@ -1390,6 +1415,34 @@ void ParticlesStorage::update_particles() {
 	RENDER_TIMESTAMP("Update GPUParticles");
 	uint32_t frame = RSG::rasterizer->get_frame_number();
 	bool uses_motion_vectors = RSG::viewport->get_num_viewports_with_motion_vectors() > 0 || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+
+	{
+		// Resolve the LOD of every 3D emitter from the screen size reported last frame, then scale them all down evenly if they exceed the budget.
+		double budget_total = 0.0;
+		for (SelfList<Particles> *E = particle_update_list.first(); E; E = E->next()) {
+			Particles *particles = E->self();
+			if (particles->mode != RS::PARTICLES_MODE_3D) {
+				particles->lod_amount_ratio = 1.0;
+				particles->lod_update_interval = 1;
+				continue;
+			}
+			_particles_get_lod(particles->lod_threshold, particles->lod_screen_size, particles->lod_amount_ratio, particles->lod_update_interval);
+			particles->lod_screen_size = -1.0;
+			if (!particles->inactive || particles->emitting) {
+				budget_total += particles->amount * particles->amount_ratio * particles->lod_amount_ratio;
+			}
+		}
+
+		if (particles_budget > 0 && budget_total > particles_budget) {
+			float budget_scale = particles_budget / budget_total;
+			for (SelfList<Particles> *E = particle_update_list.first(); E; E = E->next()) {
+				if (E->self()->mode == RS::PARTICLES_MODE_3D) {
+					E->self()->lod_amount_ratio *= budget_scale;
+				}
+			}
+		}
+	}
+
 	while (particle_update_list.first()) {
 		//use transform feedback to process particles
 
@@ -1431,6 +1484,16 @@ void ParticlesStorage::update_particles() {
 			}
 		}
 
+		// Emitters that are small on screen are simulated every few frames with the accumulated time.
+		particles->lod_skipped_time += RendererCompositorRD::get_singleton()->get_frame_delta_time();
+		particles->lod_skipped_frames++;
+		if (particles->lod_skipped_frames < particles->lod_update_interval && !particles->clear) {
+			continue;
+		}
+		double frame_delta = particles->lod_skipped_time;
+		particles->lod_skipped_frames = 0;
+		particles->lod_skipped_time = 0.0;
+
 		// TODO: Should use display refresh rate for all this.
 		float screen_hz = 60;
 
@@ -1531,9 +1594,10 @@ void ParticlesStorage::update_particles() {
 				frame_time = 1.0 / fixed_fps;
 				decr = frame_time;
 			}
-			double delta = RendererCompositorRD::get_singleton()->get_frame_delta_time();
-			if (delta > 0.1) { //avoid recursive stalls if fps goes below 10
-				delta = 0.1;
+			double delta = frame_delta;
+			double max_delta = 0.1 * particles->lod_update_interval;
+			if (delta > max_delta) { //avoid recursive stalls if fps goes below 10
+				delta = max_delta;
 			} else if (delta <= 0.0) { //unlikely but..
 				delta = 0.001;
 			}
@@ -1550,7 +1614,7 @@ void ParticlesStorage::update_particles() {
 			if (zero_time_scale) {
 				_particles_process(particles, 0.0);
 			} else {
-				_particles_process(particles, RendererCompositorRD::get_singleton()->get_frame_delta_time());
+				_particles_process(particles, frame_delta);
 			}
 		}
 
@@ -1642,6 +1706,28 @@ bool ParticlesStorage::particles_is_inactive(RID p_particles) const {
 	return !particles->emitting && particles->inactive;
 }
 
+uint64_t ParticlesStorage::get_memory_usage() const {
+	RD *rd = RD::get_singleton();
+	uint64_t usage = 0;
+
+	List<RID> particles_list;
+	particles_owner.get_owned_list(&particles_list);
+	for (const RID &E : particles_list) {
+		const Particles *particles = particles_owner.get_or_null(E);
+		if (!particles) {
+			continue;
+		}
+		const RID buffers[] = { particles->particle_buffer, particles->particle_instance_buffer, particles->frame_params_buffer, particles->particles_sort_buffer, particles->trail_bind_pose_buffer, particles->emission_storage_buffer, particles->unused_storage_buffer };
+		for (const RID &buffer : buffers) {
+			if (buffer.is_valid()) {
+				usage += rd->get_resource_memory_usage(buffer);
+			}
+		}
+	}
+
+	return usage;
+}
+
 /* Particles SHADER */
 
 void ParticlesStorage::ParticlesShaderData::set_code(const String &p_code, RID p_shader_template) {
@@ -1795,7 +1881,7 @@ RID ParticlesStorage::particles_collision_get_heightfield_framebuffer(RID p_part
 		tf.width = size.x;
 		tf.height = size.y;
 		tf.texture_type = RD::TEXTURE_TYPE_2D;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		particles_collision->heightfield_texture = RD::get_singleton()->texture_create(tf, RD::TextureView());
 
@@ -1803,11 +1889,167 @@ RID ParticlesStorage::particles_collision_get_heightfield_framebuffer(RID p_part
 		fb_tex.push_back(particles_collision->heightfield_texture);
 		particles_collision->heightfield_fb = RD::get_singleton()->framebuffer_create(fb_tex);
 		particles_collision->heightfield_fb_size = size;
+		particles_collision->heightfield_valid = false;
 	}
 
 	return particles_collision->heightfield_fb;
 }
 
+Size2i ParticlesStorage::particles_collision_get_heightfield_size(RID p_particles_collision) const {
+	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
+	ERR_FAIL_NULL_V(particles_collision, Size2i());
+	ERR_FAIL_COND_V(particles_collision->type != RS::PARTICLES_COLLISION_TYPE_HEIGHTFIELD_COLLIDE, Size2i());
+
+	return particles_collision->heightfield_fb_size;
+}
+
+bool ParticlesStorage::_particles_collision_heightfield_get_offset(const ParticlesCollision *p_from, const Transform3D &p_transform, const Vector3 &p_extents, const Size2i &p_size, Point2i &r_offset) const {
+	Basis basis = p_transform.basis.orthonormalized();
+	if (!basis.is_equal_approx(p_from->heightfield_transform.basis.orthonormalized()) || !Math::is_equal_approx(p_extents.y, p_from->heightfield_extents.y)) {
+		return false;
+	}
+
+	Vector2 texel_size(p_extents.x * 2.0 / p_size.x, p_extents.z * 2.0 / p_size.y);
+	Vector2 from_texel_size(p_from->heightfield_extents.x * 2.0 / p_from->heightfield_fb_size.x, p_from->heightfield_extents.z * 2.0 / p_from->heightfield_fb_size.y);
+	if (!texel_size.is_equal_approx(from_texel_size)) {
+		return false;
+	}
+
+	Vector3 delta = p_transform.origin - p_from->heightfield_transform.origin;
+	if (Math::abs(basis.get_column(Vector3::AXIS_Y).dot(delta)) > p_extents.y * 0.001) {
+		return false; // Depth values would differ.
+	}
+
+	// Where texel (0, 0) of this heightfield lies in the other one, must be a whole number of texels.
+	Vector2 offset;
+	offset.x = (basis.get_column(Vector3::AXIS_X).dot(delta) - p_extents.x + p_from->heightfield_extents.x) / texel_size.x;
+	offset.y = (basis.get_column(Vector3::AXIS_Z).dot(delta) - p_extents.z + p_from->heightfield_extents.z) / texel_size.y;
+	Vector2 rounded = offset.round();
+	if (Math::abs(offset.x - rounded.x) > 0.05 || Math::abs(offset.y - rounded.y) > 0.05) {
+		return false;
+	}
+
+	r_offset = Point2i(rounded);
+	return true;
+}
+
+void ParticlesStorage::particles_collision_heightfield_begin_update(RID p_particles_collision, const Transform3D &p_transform, const LocalVector<AABB> &p_changed_areas, LocalVector<Rect2i> &r_areas) {
+	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
+	ERR_FAIL_NULL(particles_collision);
+	ERR_FAIL_COND(particles_collision->type != RS::PARTICLES_COLLISION_TYPE_HEIGHTFIELD_COLLIDE);
+
+	particles_collision_get_heightfield_framebuffer(p_particles_collision);
+
+	Size2i size = particles_collision->heightfield_fb_size;
+	Vector3 extents = particles_collision->extents * p_transform.basis.get_scale();
+	Rect2i full_rect(Point2i(), size);
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	if (heightfields_updated_frame != frame) {
+		heightfields_updated.clear();
+		heightfields_updated_frame = frame;
+	}
+
+	// Find the largest part that can be reused, either from the previous contents of this
+	// heightfield (when it was scrolled) or from an overlapping one already updated this frame.
+	ParticlesCollision *source = nullptr;
+	Rect2i reuse_rect;
+	Point2i reuse_offset;
+
+	if (particles_collision->heightfield_valid && extents.is_equal_approx(particles_collision->heightfield_extents)) {
+		Point2i offset;
+		if (_particles_collision_heightfield_get_offset(particles_collision, p_transform, extents, size, offset)) {
+			reuse_rect = full_rect.intersection(Rect2i(-offset, particles_collision->heightfield_fb_size));
+			reuse_offset = offset;
+			source = particles_collision;
+		}
+	}
+
+	for (const RID &E : heightfields_updated) {
+		ParticlesCollision *other = particles_collision_owner.get_or_null(E);
+		if (!other || other == particles_collision || !other->heightfield_valid || other->heightfield_texture.is_null()) {
+			continue;
+		}
+
+		Point2i offset;
+		if (_particles_collision_heightfield_get_offset(other, p_transform, extents, size, offset)) {
+			Rect2i rect = full_rect.intersection(Rect2i(-offset, other->heightfield_fb_size));
+			if (rect.get_area() > reuse_rect.get_area()) {
+				reuse_rect = rect;
+				reuse_offset = offset;
+				source = other;
+			}
+		}
+	}
+
+	if (source && reuse_rect.has_area()) {
+		Vector3 from(reuse_rect.position.x + reuse_offset.x, reuse_rect.position.y + reuse_offset.y, 0);
+		Vector3 to(reuse_rect.position.x, reuse_rect.position.y, 0);
+		Vector3 copy_size(reuse_rect.size.x, reuse_rect.size.y, 1);
+
+		if (source == particles_collision) {
+			// Overlapping regions of the same texture can't be copied directly.
+			if (heightfield_scratch_size.x < reuse_rect.size.x || heightfield_scratch_size.y < reuse_rect.size.y) {
+				if (heightfield_scratch_texture.is_valid()) {
+					RD::get_singleton()->free(heightfield_scratch_texture);
+				}
+				heightfield_scratch_size = heightfield_scratch_size.max(reuse_rect.size);
+
+				RD::TextureFormat tf;
+				tf.format = RD::DATA_FORMAT_D32_SFLOAT;
+				tf.width = heightfield_scratch_size.x;
+				tf.height = heightfield_scratch_size.y;
+				tf.texture_type = RD::TEXTURE_TYPE_2D;
+				tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+				heightfield_scratch_texture = RD::get_singleton()->texture_create(tf, RD::TextureView());
+			}
+
+			RD::get_singleton()->texture_copy(particles_collision->heightfield_texture, heightfield_scratch_texture, from, Vector3(), copy_size, 0, 0, 0, 0);
+			RD::get_singleton()->texture_copy(heightfield_scratch_texture, particles_collision->heightfield_texture, Vector3(), to, copy_size, 0, 0, 0, 0);
+		} else {
+			RD::get_singleton()->texture_copy(source->heightfield_texture, particles_collision->heightfield_texture, from, to, copy_size, 0, 0, 0, 0);
+		}
+
+		// Strips that were not covered.
+		Point2i reuse_end = reuse_rect.get_end();
+		if (reuse_rect.position.y > 0) {
+			r_areas.push_back(Rect2i(0, 0, size.x, reuse_rect.position.y));
+		}
+		if (reuse_end.y < size.y) {
+			r_areas.push_back(Rect2i(0, reuse_end.y, size.x, size.y - reuse_end.y));
+		}
+		if (reuse_rect.position.x > 0) {
+			r_areas.push_back(Rect2i(0, reuse_rect.position.y, reuse_rect.position.x, reuse_rect.size.y));
+		}
+		if (reuse_end.x < size.x) {
+			r_areas.push_back(Rect2i(reuse_end.x, reuse_rect.position.y, size.x - reuse_end.x, reuse_rect.size.y));
+		}
+
+		if (source == particles_collision) {
+			// Geometry that changed since the last update. When copying from another heightfield
+			// updated this frame, its contents are already current.
+			Transform3D to_local = Transform3D(p_transform.basis.orthonormalized(), p_transform.origin).affine_inverse();
+			Vector2 texel_size(extents.x * 2.0 / size.x, extents.z * 2.0 / size.y);
+			for (const AABB &E : p_changed_areas) {
+				AABB local_aabb = to_local.xform(E);
+				Point2i begin(Math::floor((local_aabb.position.x + extents.x) / texel_size.x) - 1, Math::floor((local_aabb.position.z + extents.z) / texel_size.y) - 1);
+				Point2i end(Math::ceil((local_aabb.position.x + local_aabb.size.x + extents.x) / texel_size.x) + 1, Math::ceil((local_aabb.position.z + local_aabb.size.z + extents.z) / texel_size.y) + 1);
+				Rect2i rect = Rect2i(begin, end - begin).intersection(reuse_rect);
+				if (rect.has_area()) {
+					r_areas.push_back(rect);
+				}
+			}
+		}
+	} else {
+		r_areas.push_back(full_rect);
+	}
+
+	particles_collision->heightfield_valid = true;
+	particles_collision->heightfield_transform = p_transform;
+	particles_collision->heightfield_extents = extents;
+	heightfields_updated.push_back(p_particles_collision);
+}
+
 void ParticlesStorage::particles_collision_set_collision_type(RID p_particles_collision, RS::ParticlesCollisionType p_type) {
 	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_NULL(particles_collision);
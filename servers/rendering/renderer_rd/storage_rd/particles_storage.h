@@ -51,6 +51,13 @@ private:
 	/* EFFECTS */
 	SortEffects *sort_effects = nullptr;
 
+	// Heightfields updated this frame, other overlapping heightfields can copy from them.
+	LocalVector<RID> heightfields_updated;
+	uint64_t heightfields_updated_frame = 0;
+
+	RID heightfield_scratch_texture;
+	Size2i heightfield_scratch_size;
+
 	/* PARTICLES */
 
 	enum {
@@ -242,6 +249,15 @@ private:
 		float interp_to_end = 0.0;
 		float amount_ratio = 1.0;
 
+		// Screen size below which emission and update rate are reduced, 0 disables LOD.
+		float lod_threshold = 0.0;
+		// Largest screen size reported by the cameras since the last update, negative if none did.
+		float lod_screen_size = -1.0;
+		float lod_amount_ratio = 1.0;
+		uint32_t lod_update_interval = 1;
+		uint32_t lod_skipped_frames = 0;
+		double lod_skipped_time = 0.0;
+
 		Vector<uint8_t> emission_buffer_data;
 
 		ParticleEmissionBuffer *emission_buffer = nullptr;
@@ -334,6 +350,9 @@ private:
 
 	SelfList<Particles>::List particle_update_list;
 
+	// Maximum amount of 3D particles simulated per frame, 0 means unlimited.
+	int particles_budget = 0;
+
 	mutable RID_Owner<Particles, true> particles_owner;
 
 	/* Particle Shader */
@@ -401,6 +420,11 @@ private:
 		RID heightfield_fb;
 		Size2i heightfield_fb_size;
 
+		// Placement of the last heightfield update, so its contents can be reused.
+		bool heightfield_valid = false;
+		Transform3D heightfield_transform;
+		Vector3 heightfield_extents;
+
 		RS::ParticlesCollisionHeightfieldResolution heightfield_resolution = RS::PARTICLES_COLLISION_HEIGHTFIELD_RESOLUTION_1024;
 
 		Dependency dependency;
@@ -416,6 +440,8 @@ private:
 
 	mutable RID_Owner<ParticlesCollisionInstance> particles_collision_instance_owner;
 
+	bool _particles_collision_heightfield_get_offset(const ParticlesCollision *p_from, const Transform3D &p_transform, const Vector3 &p_extents, const Size2i &p_size, Point2i &r_offset) const;
+
 public:
 	static ParticlesStorage *get_singleton();
 
@@ -436,6 +462,7 @@ public:
 	virtual void particles_set_emitting(RID p_particles, bool p_emitting) override;
 	virtual void particles_set_amount(RID p_particles, int p_amount) override;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) override;
+	virtual void particles_set_lod_threshold(RID p_particles, float p_threshold) override;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) override;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) override;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) override;
@@ -467,6 +494,7 @@ public:
 	virtual void particles_set_draw_pass_mesh(RID p_particles, int p_pass, RID p_mesh) override;
 
 	virtual void particles_request_process(RID p_particles) override;
+	virtual void particles_set_lod_screen_size(RID p_particles, float p_screen_size) override;
 	virtual AABB particles_get_current_aabb(RID p_particles) override;
 	virtual AABB particles_get_aabb(RID p_particles) const override;
 
@@ -482,6 +510,8 @@ public:
 
 	virtual bool particles_is_inactive(RID p_particles) const override;
 
+	uint64_t get_memory_usage() const;
+
 	_FORCE_INLINE_ RS::ParticlesMode particles_get_mode(RID p_particles) {
 		Particles *particles = particles_owner.get_or_null(p_particles);
 		ERR_FAIL_NULL_V(particles, RS::PARTICLES_MODE_2D);
@@ -575,6 +605,8 @@ public:
 	Vector3 particles_collision_get_extents(RID p_particles_collision) const;
 	virtual bool particles_collision_is_heightfield(RID p_particles_collision) const override;
 	RID particles_collision_get_heightfield_framebuffer(RID p_particles_collision) const;
+	Size2i particles_collision_get_heightfield_size(RID p_particles_collision) const;
+	void particles_collision_heightfield_begin_update(RID p_particles_collision, const Transform3D &p_transform, const LocalVector<AABB> &p_changed_areas, LocalVector<Rect2i> &r_areas);
 
 	Dependency *particles_collision_get_dependency(RID p_particles) const;
 
@@ -32,6 +32,7 @@
 
 #include "../effects/copy_effects.h"
 #include "../framebuffer_cache_rd.h"
+#include "core/config/project_settings.h"
 #include "material_storage.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 
@@ -88,6 +89,7 @@ TextureStorage *TextureStorage::get_singleton() {
 
 TextureStorage::TextureStorage() {
 	singleton = this;
+	texture_owner.set_memory_tag(Memory::TAG_TEXTURE);
 
 	{ //create default textures
 
@@ -489,6 +491,11 @@ TextureStorage::TextureStorage() {
 			decal_atlas.texture = RD::get_singleton()->texture_create(tformat, RD::TextureView(), vpv);
 			decal_atlas.texture_srgb = decal_atlas.texture;
 		}
+
+		// The real atlas is created once the first texture is requested.
+		int atlas_pages = MAX(int(GLOBAL_GET("rendering/textures/decals/atlas_size")) / DecalAtlas::PAGE_SIZE, 1);
+		decal_atlas.pages = Size2i(atlas_pages, atlas_pages);
+		decal_atlas.uploads_per_frame = MAX(int(GLOBAL_GET("rendering/textures/decals/atlas_uploads_per_frame")), 1);
 	}
 
 	{ //create default VRS
@@ -790,6 +797,7 @@ void TextureStorage::texture_free(RID p_texture) {
 }
 
 void TextureStorage::texture_2d_initialize(RID p_texture, const Ref<Image> &p_image) {
+	MemoryTagScope tag_scope(Memory::TAG_TEXTURE);
 	ERR_FAIL_COND(p_image.is_null());
 
 	TextureToRDFormat ret_format;
@@ -859,6 +867,7 @@ void TextureStorage::texture_2d_initialize(RID p_texture, const Ref<Image> &p_im
 }
 
 void TextureStorage::texture_2d_layered_initialize(RID p_texture, const Vector<Ref<Image>> &p_layers, RS::TextureLayeredType p_layered_type) {
+	MemoryTagScope tag_scope(Memory::TAG_TEXTURE);
 	ERR_FAIL_COND(p_layers.is_empty());
 
 	ERR_FAIL_COND(p_layered_type == RS::TEXTURE_LAYERED_CUBEMAP && p_layers.size() != 6);
@@ -971,6 +980,7 @@ void TextureStorage::texture_2d_layered_initialize(RID p_texture, const Vector<R
 }
 
 void TextureStorage::texture_3d_initialize(RID p_texture, Image::Format p_format, int p_width, int p_height, int p_depth, bool p_mipmaps, const Vector<Ref<Image>> &p_data) {
+	MemoryTagScope tag_scope(Memory::TAG_TEXTURE);
 	ERR_FAIL_COND(p_data.is_empty());
 
 	Image::Image3DValidateError verr = Image::validate_3d_image(p_format, p_width, p_height, p_depth, p_mipmaps, p_data);
@@ -1109,6 +1119,7 @@ void TextureStorage::texture_proxy_initialize(RID p_texture, RID p_base) {
 }
 
 void TextureStorage::_texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer, bool p_immediate) {
+	MemoryTagScope tag_scope(Memory::TAG_TEXTURE);
 	ERR_FAIL_COND(p_image.is_null() || p_image->is_empty());
 
 	Texture *tex = texture_owner.get_or_null(p_texture);
@@ -1135,6 +1146,7 @@ void TextureStorage::texture_2d_update(RID p_texture, const Ref<Image> &p_image,
 }
 
 void TextureStorage::texture_3d_update(RID p_texture, const Vector<Ref<Image>> &p_data) {
+	MemoryTagScope tag_scope(Memory::TAG_TEXTURE);
 	Texture *tex = texture_owner.get_or_null(p_texture);
 	ERR_FAIL_NULL(tex);
 	ERR_FAIL_COND(tex->type != TextureStorage::TYPE_3D);
@@ -1476,6 +1488,27 @@ void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 	}
 }
 
+uint64_t TextureStorage::texture_get_memory_usage() const {
+	List<RID> textures;
+	texture_owner.get_owned_list(&textures);
+
+	// Only counts texture resources, render targets and render buffers are not included.
+	uint64_t usage = 0;
+	for (const RID &E : textures) {
+		const Texture *t = texture_owner.get_or_null(E);
+		if (!t || t->is_proxy || t->is_render_target) {
+			continue;
+		}
+		if (t->rd_texture.is_valid()) {
+			usage += RD::get_singleton()->get_resource_memory_usage(t->rd_texture);
+		}
+		if (t->rd_texture_srgb.is_valid()) {
+			usage += RD::get_singleton()->get_resource_memory_usage(t->rd_texture_srgb);
+		}
+	}
+	return usage;
+}
+
 void TextureStorage::texture_set_force_redraw_if_visible(RID p_texture, bool p_enable) {
 }
 
@@ -2511,17 +2544,18 @@ void TextureStorage::decal_set_normal_fade(RID p_decal, float p_fade) {
 }
 
 void TextureStorage::decal_atlas_mark_dirty_on_texture(RID p_texture) {
-	if (decal_atlas.textures.has(p_texture)) {
-		//belongs to decal atlas..
-
-		decal_atlas.dirty = true; //mark it dirty since it was most likely modified
+	DecalAtlas::Texture *t = decal_atlas.textures.getptr(p_texture);
+	if (t && t->page_rect.has_area()) {
+		// Resident and most likely modified, upload it again.
+		_decal_atlas_queue_upload(p_texture, t);
 	}
 }
 
 void TextureStorage::decal_atlas_remove_texture(RID p_texture) {
-	if (decal_atlas.textures.has(p_texture)) {
+	DecalAtlas::Texture *t = decal_atlas.textures.getptr(p_texture);
+	if (t) {
+		_decal_atlas_free_pages(t);
 		decal_atlas.textures.erase(p_texture);
-		//there is not much a point of making it dirty, just let it be.
 	}
 }
 
@@ -2546,198 +2580,205 @@ Dependency *TextureStorage::decal_get_dependency(RID p_decal) {
 	return &decal->dependency;
 }
 
-void TextureStorage::update_decal_atlas() {
-	CopyEffects *copy_effects = CopyEffects::get_singleton();
-	ERR_FAIL_NULL(copy_effects);
-
-	if (!decal_atlas.dirty) {
-		return; //nothing to do
+void TextureStorage::_decal_atlas_queue_upload(RID p_texture, DecalAtlas::Texture *p_atlas_texture) {
+	if (!p_atlas_texture->queued) {
+		p_atlas_texture->queued = true;
+		decal_atlas.upload_queue.push_back(p_texture);
 	}
+}
 
-	decal_atlas.dirty = false;
-
+void TextureStorage::_decal_atlas_create() {
 	if (decal_atlas.texture.is_valid()) {
+		// Default placeholder texture.
 		RD::get_singleton()->free(decal_atlas.texture);
-		decal_atlas.texture = RID();
-		decal_atlas.texture_srgb = RID();
-		decal_atlas.texture_mipmaps.clear();
 	}
 
-	int border = 1 << decal_atlas.mipmaps;
+	decal_atlas.size = decal_atlas.pages * DecalAtlas::PAGE_SIZE;
+	decal_atlas.page_owners.resize(decal_atlas.pages.width * decal_atlas.pages.height);
+	for (RID &owner : decal_atlas.page_owners) {
+		owner = RID();
+	}
 
-	if (decal_atlas.textures.size()) {
-		//generate atlas
-		Vector<DecalAtlas::SortItem> itemsv;
-		itemsv.resize(decal_atlas.textures.size());
-		uint32_t base_size = 8;
+	RD::TextureFormat tformat;
+	tformat.format = RD::DATA_FORMAT_R8G8B8A8_UNORM;
+	tformat.width = decal_atlas.size.width;
+	tformat.height = decal_atlas.size.height;
+	tformat.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+	tformat.texture_type = RD::TEXTURE_TYPE_2D;
+	tformat.mipmaps = decal_atlas.mipmaps;
+	tformat.shareable_formats.push_back(RD::DATA_FORMAT_R8G8B8A8_UNORM);
+	tformat.shareable_formats.push_back(RD::DATA_FORMAT_R8G8B8A8_SRGB);
 
-		int idx = 0;
+	decal_atlas.texture = RD::get_singleton()->texture_create(tformat, RD::TextureView());
+	RD::get_singleton()->texture_clear(decal_atlas.texture, Color(0, 0, 0, 0), 0, decal_atlas.mipmaps, 0, 1);
 
-		for (const KeyValue<RID, DecalAtlas::Texture> &E : decal_atlas.textures) {
-			DecalAtlas::SortItem &si = itemsv.write[idx];
+	Size2i s = decal_atlas.size;
 
-			Texture *src_tex = get_texture(E.key);
+	for (int i = 0; i < decal_atlas.mipmaps; i++) {
+		DecalAtlas::MipMap mm;
+		mm.texture = RD::get_singleton()->texture_create_shared_from_slice(RD::TextureView(), decal_atlas.texture, 0, i);
+		Vector<RID> fb;
+		fb.push_back(mm.texture);
+		mm.fb = RD::get_singleton()->framebuffer_create(fb);
+		mm.size = s;
+		decal_atlas.texture_mipmaps.push_back(mm);
 
-			si.size.width = (src_tex->width / border) + 1;
-			si.size.height = (src_tex->height / border) + 1;
-			si.pixel_size = Size2i(src_tex->width, src_tex->height);
+		s = Vector2i(s.width >> 1, s.height >> 1).maxi(1);
+	}
 
-			if (base_size < (uint32_t)si.size.width) {
-				base_size = nearest_power_of_2_templated(si.size.width);
-			}
+	{
+		//create the SRGB variant
+		RD::TextureView rd_view;
+		rd_view.format_override = RD::DATA_FORMAT_R8G8B8A8_SRGB;
+		decal_atlas.texture_srgb = RD::get_singleton()->texture_create_shared(rd_view, decal_atlas.texture);
+	}
+}
 
-			si.texture = E.key;
-			idx++;
+void TextureStorage::_decal_atlas_free_pages(DecalAtlas::Texture *p_atlas_texture) {
+	const Rect2i &r = p_atlas_texture->page_rect;
+	for (int y = r.position.y; y < r.position.y + r.size.height; y++) {
+		for (int x = r.position.x; x < r.position.x + r.size.width; x++) {
+			decal_atlas.page_owners[y * decal_atlas.pages.width + x] = RID();
 		}
+	}
+	p_atlas_texture->page_rect = Rect2i();
+	p_atlas_texture->uv_rect = Rect2();
+}
 
-		//sort items by size
-		itemsv.sort();
-
-		//attempt to create atlas
-		int item_count = itemsv.size();
-		DecalAtlas::SortItem *items = itemsv.ptrw();
-
-		int atlas_height = 0;
-
-		while (true) {
-			Vector<int> v_offsetsv;
-			v_offsetsv.resize(base_size);
-
-			int *v_offsets = v_offsetsv.ptrw();
-			memset(v_offsets, 0, sizeof(int) * base_size);
-
-			int max_height = 0;
-
-			for (int i = 0; i < item_count; i++) {
-				//best fit
-				DecalAtlas::SortItem &si = items[i];
-				int best_idx = -1;
-				int best_height = 0x7FFFFFFF;
-				for (uint32_t j = 0; j <= base_size - si.size.width; j++) {
-					int height = 0;
-					for (int k = 0; k < si.size.width; k++) {
-						int h = v_offsets[k + j];
-						if (h > height) {
-							height = h;
-							if (height > best_height) {
-								break; //already bad
-							}
+bool TextureStorage::_decal_atlas_allocate_pages(RID p_texture, DecalAtlas::Texture *p_atlas_texture, const Size2i &p_page_count) {
+	while (true) {
+		// First fit, the grid is small enough for a linear scan.
+		for (int y = 0; y <= decal_atlas.pages.height - p_page_count.height; y++) {
+			for (int x = 0; x <= decal_atlas.pages.width - p_page_count.width; x++) {
+				bool fits = true;
+				for (int j = 0; j < p_page_count.height && fits; j++) {
+					for (int i = 0; i < p_page_count.width; i++) {
+						if (decal_atlas.page_owners[(y + j) * decal_atlas.pages.width + x + i].is_valid()) {
+							fits = false;
+							break;
 						}
 					}
-
-					if (height < best_height) {
-						best_height = height;
-						best_idx = j;
-					}
-				}
-
-				//update
-				for (int k = 0; k < si.size.width; k++) {
-					v_offsets[k + best_idx] = best_height + si.size.height;
 				}
 
-				si.pos.x = best_idx;
-				si.pos.y = best_height;
-
-				if (si.pos.y + si.size.height > max_height) {
-					max_height = si.pos.y + si.size.height;
+				if (fits) {
+					p_atlas_texture->page_rect = Rect2i(Point2i(x, y), p_page_count);
+					for (int j = 0; j < p_page_count.height; j++) {
+						for (int i = 0; i < p_page_count.width; i++) {
+							decal_atlas.page_owners[(y + j) * decal_atlas.pages.width + x + i] = p_texture;
+						}
+					}
+					return true;
 				}
 			}
+		}
 
-			if ((uint32_t)max_height <= base_size * 2) {
-				atlas_height = max_height;
-				break; //good ratio, break;
+		// Evict the least recently used texture that was not needed in the last frame.
+		DecalAtlas::Texture *lru = nullptr;
+		for (KeyValue<RID, DecalAtlas::Texture> &E : decal_atlas.textures) {
+			DecalAtlas::Texture &t = E.value;
+			if (!t.page_rect.has_area() || t.last_used + 1 >= decal_atlas.frame) {
+				continue;
 			}
+			if (!lru || t.last_used < lru->last_used) {
+				lru = &t;
+			}
+		}
 
-			base_size *= 2;
+		if (!lru) {
+			return false;
 		}
 
-		decal_atlas.size.width = base_size * border;
-		decal_atlas.size.height = nearest_power_of_2_templated(atlas_height * border);
+		_decal_atlas_free_pages(lru);
+	}
+}
 
-		for (int i = 0; i < item_count; i++) {
-			DecalAtlas::Texture *t = decal_atlas.textures.getptr(items[i].texture);
-			t->uv_rect.position = items[i].pos * border + Vector2i(border / 2, border / 2);
-			t->uv_rect.size = items[i].pixel_size;
+void TextureStorage::_decal_atlas_upload(RID p_texture, DecalAtlas::Texture *p_atlas_texture) {
+	CopyEffects *copy_effects = CopyEffects::get_singleton();
+	ERR_FAIL_NULL(copy_effects);
 
-			t->uv_rect.position /= Size2(decal_atlas.size);
-			t->uv_rect.size /= Size2(decal_atlas.size);
-		}
-	} else {
-		//use border as size, so it at least has enough mipmaps
-		decal_atlas.size.width = border;
-		decal_atlas.size.height = border;
-	}
+	Texture *src_tex = get_texture(p_texture);
+	ERR_FAIL_NULL(src_tex);
 
-	//blit textures
+	// Keep a border around each texture so mipmaps do not bleed into the neighboring pages.
+	int border = 1 << (decal_atlas.mipmaps - 1);
 
-	RD::TextureFormat tformat;
-	tformat.format = RD::DATA_FORMAT_R8G8B8A8_UNORM;
-	tformat.width = decal_atlas.size.width;
-	tformat.height = decal_atlas.size.height;
-	tformat.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
-	tformat.texture_type = RD::TEXTURE_TYPE_2D;
-	tformat.mipmaps = decal_atlas.mipmaps;
-	tformat.shareable_formats.push_back(RD::DATA_FORMAT_R8G8B8A8_UNORM);
-	tformat.shareable_formats.push_back(RD::DATA_FORMAT_R8G8B8A8_SRGB);
+	Size2i pixel_size(src_tex->width, src_tex->height);
+	Size2i page_count;
+	page_count.width = CLAMP((pixel_size.width + border * 2 + DecalAtlas::PAGE_SIZE - 1) / DecalAtlas::PAGE_SIZE, 1, decal_atlas.pages.width);
+	page_count.height = CLAMP((pixel_size.height + border * 2 + DecalAtlas::PAGE_SIZE - 1) / DecalAtlas::PAGE_SIZE, 1, decal_atlas.pages.height);
 
-	decal_atlas.texture = RD::get_singleton()->texture_create(tformat, RD::TextureView());
-	RD::get_singleton()->texture_clear(decal_atlas.texture, Color(0, 0, 0, 0), 0, decal_atlas.mipmaps, 0, 1);
+	if (p_atlas_texture->page_rect.has_area() && p_atlas_texture->page_rect.size != page_count) {
+		// Texture was resized.
+		_decal_atlas_free_pages(p_atlas_texture);
+	}
 
-	{
-		//create the framebuffer
+	if (!p_atlas_texture->page_rect.has_area() && !_decal_atlas_allocate_pages(p_texture, p_atlas_texture, page_count)) {
+		WARN_PRINT_ONCE("Decal Atlas: Out of space for visible decal and light projector textures, increase rendering/textures/decals/atlas_size.");
+		return;
+	}
 
-		Size2i s = decal_atlas.size;
+	Rect2i block(p_atlas_texture->page_rect.position * DecalAtlas::PAGE_SIZE, p_atlas_texture->page_rect.size * DecalAtlas::PAGE_SIZE);
 
-		for (int i = 0; i < decal_atlas.mipmaps; i++) {
-			DecalAtlas::MipMap mm;
-			mm.texture = RD::get_singleton()->texture_create_shared_from_slice(RD::TextureView(), decal_atlas.texture, 0, i);
-			Vector<RID> fb;
-			fb.push_back(mm.texture);
-			mm.fb = RD::get_singleton()->framebuffer_create(fb);
-			mm.size = s;
-			decal_atlas.texture_mipmaps.push_back(mm);
+	// Textures larger than the whole atlas are scaled down to fit.
+	Size2i usable = block.size - Size2i(border * 2, border * 2);
+	float scale = MIN(1.0f, MIN(float(usable.width) / MAX(pixel_size.width, 1), float(usable.height) / MAX(pixel_size.height, 1)));
+	Size2i rect_size = Size2i((Size2(pixel_size) * scale).floor()).maxi(1);
 
-			s = Vector2i(s.width >> 1, s.height >> 1).maxi(1);
-		}
-		{
-			//create the SRGB variant
-			RD::TextureView rd_view;
-			rd_view.format_override = RD::DATA_FORMAT_R8G8B8A8_SRGB;
-			decal_atlas.texture_srgb = RD::get_singleton()->texture_create_shared(rd_view, decal_atlas.texture);
-		}
+	Rect2 uv_rect(block.position + Size2i(border, border), rect_size);
+	p_atlas_texture->uv_rect = Rect2(uv_rect.position / Size2(decal_atlas.size), uv_rect.size / Size2(decal_atlas.size));
+
+	// Draw into the pages of the base level, the viewport is the block so the section is relative to it.
+	{
+		const DecalAtlas::MipMap &mm = decal_atlas.texture_mipmaps[0];
+		Vector<Color> cc;
+		cc.push_back(Color(0, 0, 0, 0));
+
+		RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(mm.fb, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, cc, 0.0, 0, block);
+		Rect2 section(Size2(border, border) / Size2(block.size), Size2(rect_size) / Size2(block.size));
+		copy_effects->copy_to_atlas_fb(src_tex->rd_texture, mm.fb, section, draw_list, false, p_atlas_texture->panorama_to_dp_users > 0);
+		RD::get_singleton()->draw_list_end();
 	}
 
-	RID prev_texture;
-	for (int i = 0; i < decal_atlas.texture_mipmaps.size(); i++) {
+	// Then downsample only those pages into the smaller levels.
+	Rect2 block_uv(Point2(block.position) / Size2(decal_atlas.size), Size2(block.size) / Size2(decal_atlas.size));
+	for (int i = 1; i < decal_atlas.texture_mipmaps.size(); i++) {
 		const DecalAtlas::MipMap &mm = decal_atlas.texture_mipmaps[i];
+		Rect2i dest(block.position.x >> i, block.position.y >> i, MAX(block.size.width >> i, 1), MAX(block.size.height >> i, 1));
+		copy_effects->copy_to_fb_rect(decal_atlas.texture_mipmaps[i - 1].texture, mm.fb, dest, false, false, false, false, RID(), false, false, false, false, block_uv);
+	}
+}
 
-		Color clear_color(0, 0, 0, 0);
+void TextureStorage::update_decal_atlas() {
+	decal_atlas.frame++;
 
-		if (decal_atlas.textures.size()) {
-			if (i == 0) {
-				Vector<Color> cc;
-				cc.push_back(clear_color);
+	if (decal_atlas.upload_queue.is_empty()) {
+		return; //nothing to do
+	}
 
-				RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(mm.fb, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_STORE, RD::INITIAL_ACTION_DISCARD, RD::FINAL_ACTION_DISCARD, cc);
+	if (decal_atlas.texture_mipmaps.is_empty()) {
+		_decal_atlas_create();
+	}
 
-				for (const KeyValue<RID, DecalAtlas::Texture> &E : decal_atlas.textures) {
-					DecalAtlas::Texture *t = decal_atlas.textures.getptr(E.key);
-					Texture *src_tex = get_texture(E.key);
-					copy_effects->copy_to_atlas_fb(src_tex->rd_texture, mm.fb, t->uv_rect, draw_list, false, t->panorama_to_dp_users > 0);
-				}
+	uint32_t processed = 0;
+	uint32_t uploads = 0;
+	while (processed < decal_atlas.upload_queue.size() && uploads < decal_atlas.uploads_per_frame) {
+		RID texture = decal_atlas.upload_queue[processed++];
+		DecalAtlas::Texture *t = decal_atlas.textures.getptr(texture);
+		if (!t) {
+			continue; // Removed while queued.
+		}
 
-				RD::get_singleton()->draw_list_end();
+		t->queued = false;
+		_decal_atlas_upload(texture, t);
+		uploads++;
+	}
 
-				prev_texture = mm.texture;
-			} else {
-				copy_effects->copy_to_fb_rect(prev_texture, mm.fb, Rect2i(Point2i(), mm.size));
-				prev_texture = mm.texture;
-			}
-		} else {
-			RD::get_singleton()->texture_clear(mm.texture, clear_color, 0, 1, 0, 1);
-		}
+	// Anything over the budget waits for the next frames.
+	LocalVector<RID> remaining;
+	for (uint32_t i = processed; i < decal_atlas.upload_queue.size(); i++) {
+		remaining.push_back(decal_atlas.upload_queue[i]);
 	}
+	decal_atlas.upload_queue = remaining;
 }
 
 void TextureStorage::texture_add_to_decal_atlas(RID p_texture, bool p_panorama_to_dp) {
@@ -2746,12 +2787,15 @@ void TextureStorage::texture_add_to_decal_atlas(RID p_texture, bool p_panorama_t
 		t.users = 1;
 		t.panorama_to_dp_users = p_panorama_to_dp ? 1 : 0;
 		decal_atlas.textures[p_texture] = t;
-		decal_atlas.dirty = true;
+		// Pages are only allocated once the texture is actually used.
 	} else {
 		DecalAtlas::Texture *t = decal_atlas.textures.getptr(p_texture);
 		t->users++;
 		if (p_panorama_to_dp) {
 			t->panorama_to_dp_users++;
+			if (t->panorama_to_dp_users == 1 && t->page_rect.has_area()) {
+				_decal_atlas_queue_upload(p_texture, t); // Needs to be converted to dual paraboloid.
+			}
 		}
 	}
 }
@@ -2765,8 +2809,8 @@ void TextureStorage::texture_remove_from_decal_atlas(RID p_texture, bool p_panor
 		t->panorama_to_dp_users--;
 	}
 	if (t->users == 0) {
+		_decal_atlas_free_pages(t);
 		decal_atlas.textures.erase(p_texture);
-		//do not mark it dirty, there is no need to since it remains working
 	}
 }
 
@@ -3589,6 +3633,20 @@ bool TextureStorage::render_target_is_sdf_enabled(RID p_render_target) const {
 	return rt->sdf_enabled;
 }
 
+uint32_t TextureStorage::render_target_get_sdf_hash(RID p_render_target) const {
+	const RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, 0);
+
+	return rt->sdf_hash;
+}
+
+void TextureStorage::render_target_set_sdf_hash(RID p_render_target, uint32_t p_hash) {
+	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+
+	rt->sdf_hash = p_hash;
+}
+
 RID TextureStorage::render_target_get_sdf_texture(RID p_render_target) {
 	RenderTarget *rt = render_target_owner.get_or_null(p_render_target);
 	ERR_FAIL_NULL_V(rt, RID());
@@ -3710,6 +3768,7 @@ void TextureStorage::_render_target_allocate_sdf(RenderTarget *rt) {
 }
 
 void TextureStorage::_render_target_clear_sdf(RenderTarget *rt) {
+	rt->sdf_hash = 0;
 	if (rt->sdf_buffer_read.is_valid()) {
 		RD::get_singleton()->free(rt->sdf_buffer_read);
 		rt->sdf_buffer_read = RID();
@@ -219,33 +219,30 @@ private:
 
 	/* DECAL API */
 
+	// The decal atlas is a fixed size texture split into a grid of pages. Textures
+	// are only given pages once a visible decal, light projector or canvas light
+	// asks for them, are uploaded a few at a time, and the least recently used
+	// ones are evicted when the atlas is full. The atlas itself is never repacked.
 	struct DecalAtlas {
 		struct Texture {
 			int panorama_to_dp_users;
 			int users;
 			Rect2 uv_rect;
-		};
-
-		struct SortItem {
-			RID texture;
-			Size2i pixel_size;
-			Size2i size;
-			Point2i pos;
-
-			bool operator<(const SortItem &p_item) const {
-				//sort larger to smaller
-				if (size.height == p_item.size.height) {
-					return size.width > p_item.size.width;
-				} else {
-					return size.height > p_item.size.height;
-				}
-			}
+			Rect2i page_rect; // Empty when the texture is not resident.
+			uint64_t last_used = 0;
+			bool queued = false;
 		};
 
 		HashMap<RID, Texture> textures;
-		bool dirty = true;
+		LocalVector<RID> upload_queue;
+		uint32_t uploads_per_frame = 8;
+		uint64_t frame = 0;
 		int mipmaps = 5;
 
+		static const int PAGE_SIZE = 256;
+		Size2i pages;
+		LocalVector<RID> page_owners; // One per page, empty RID when free.
+
 		RID texture;
 		RID texture_srgb;
 		struct MipMap {
@@ -362,6 +359,7 @@ private:
 		RID sdf_buffer_process_uniform_sets[2];
 		RS::ViewportSDFOversize sdf_oversize = RS::VIEWPORT_SDF_OVERSIZE_120_PERCENT;
 		RS::ViewportSDFScale sdf_scale = RS::VIEWPORT_SDF_SCALE_50_PERCENT;
+		uint32_t sdf_hash = 0; // Occluders last processed into the SDF, 0 if it must be redrawn.
 		Size2i process_size;
 
 		// VRS
@@ -519,6 +517,7 @@ public:
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override;
 
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override;
+	uint64_t texture_get_memory_usage() const;
 
 	virtual void texture_set_force_redraw_if_visible(RID p_texture, bool p_enable) override;
 
@@ -567,13 +566,20 @@ public:
 
 	RID decal_atlas_get_texture() const;
 	RID decal_atlas_get_texture_srgb() const;
+	// Returns an empty rect while the texture is not resident yet, in which case it is queued for upload.
 	_FORCE_INLINE_ Rect2 decal_atlas_get_texture_rect(RID p_texture) {
 		DecalAtlas::Texture *t = decal_atlas.textures.getptr(p_texture);
 		if (!t) {
 			return Rect2();
 		}
 
-		return t->uv_rect;
+		t->last_used = decal_atlas.frame;
+		if (t->page_rect.has_area()) {
+			return t->uv_rect;
+		}
+
+		_decal_atlas_queue_upload(p_texture, t);
+		return Rect2();
 	}
 
 	virtual RID decal_allocate() override;
@@ -593,6 +599,12 @@ public:
 	void decal_atlas_mark_dirty_on_texture(RID p_texture);
 	void decal_atlas_remove_texture(RID p_texture);
 
+	void _decal_atlas_queue_upload(RID p_texture, DecalAtlas::Texture *p_atlas_texture);
+	void _decal_atlas_create();
+	void _decal_atlas_free_pages(DecalAtlas::Texture *p_atlas_texture);
+	bool _decal_atlas_allocate_pages(RID p_texture, DecalAtlas::Texture *p_atlas_texture, const Size2i &p_page_count);
+	void _decal_atlas_upload(RID p_texture, DecalAtlas::Texture *p_atlas_texture);
+
 	virtual void texture_add_to_decal_atlas(RID p_texture, bool p_panorama_to_dp = false) override;
 	virtual void texture_remove_from_decal_atlas(RID p_texture, bool p_panorama_to_dp = false) override;
 
@@ -744,6 +756,8 @@ public:
 	virtual Rect2i render_target_get_sdf_rect(RID p_render_target) const override;
 	virtual void render_target_mark_sdf_enabled(RID p_render_target, bool p_enabled) override;
 	bool render_target_is_sdf_enabled(RID p_render_target) const;
+	uint32_t render_target_get_sdf_hash(RID p_render_target) const;
+	void render_target_set_sdf_hash(RID p_render_target, uint32_t p_hash);
 
 	virtual void render_target_set_vrs_mode(RID p_render_target, RS::ViewportVRSMode p_mode) override;
 	virtual RS::ViewportVRSMode render_target_get_vrs_mode(RID p_render_target) const override;
@@ -33,6 +33,7 @@
 #include "../environment/gi.h"
 #include "light_storage.h"
 #include "mesh_storage.h"
+#include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "particles_storage.h"
 #include "texture_storage.h"
 
@@ -293,6 +294,12 @@ void Utilities::update_memory_info() {
 	texture_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TEXTURES);
 	buffer_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_BUFFERS);
 	total_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TOTAL);
+
+	if (storage_mem_requested.is_set()) {
+		texture_storage_mem_cache = TextureStorage::get_singleton()->texture_get_memory_usage();
+		mesh_storage_mem_cache = MeshStorage::get_singleton()->get_memory_usage();
+		particles_storage_mem_cache = ParticlesStorage::get_singleton()->get_memory_usage();
+	}
 }
 
 uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
@@ -302,6 +309,19 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_PIPELINE_COMPILATIONS_PENDING) {
+		return PipelineCacheRD::get_pending_compilation_count();
+	} else if (p_info == RS::RENDERING_INFO_PIPELINE_COMPILATIONS_COMPLETED) {
+		return PipelineCacheRD::get_completed_compilation_count();
+	} else if (p_info == RS::RENDERING_INFO_TEXTURE_STORAGE_MEM_USED) {
+		storage_mem_requested.set();
+		return texture_storage_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_MESH_STORAGE_MEM_USED) {
+		storage_mem_requested.set();
+		return mesh_storage_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_PARTICLES_STORAGE_MEM_USED) {
+		storage_mem_requested.set();
+		return particles_storage_mem_cache;
 	}
 	return 0;
 }
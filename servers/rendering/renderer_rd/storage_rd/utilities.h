@@ -60,6 +60,12 @@ private:
 	uint64_t buffer_mem_cache = 0;
 	uint64_t total_mem_cache = 0;
 
+	// Walking the storages is not free, so per-category usage is only gathered once it has been queried.
+	SafeFlag storage_mem_requested;
+	uint64_t texture_storage_mem_cache = 0;
+	uint64_t mesh_storage_mem_cache = 0;
+	uint64_t particles_storage_mem_cache = 0;
+
 public:
 	static Utilities *get_singleton() { return singleton; }
 
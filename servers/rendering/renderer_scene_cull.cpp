@@ -31,6 +31,7 @@
 #include "renderer_scene_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/math/transform_interpolator.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "rendering_light_culler.h"
@@ -93,9 +94,28 @@ void RendererSceneCull::camera_set_frustum(RID p_camera, float p_size, Vector2 p
 void RendererSceneCull::camera_set_transform(RID p_camera, const Transform3D &p_transform) {
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_NULL(camera);
+
+	if (_interpolation_data.interpolation_enabled && camera->interpolated && !camera->on_interpolate_transform_list) {
+		_interpolation_data.camera_transform_update_list.push_back(p_camera);
+		camera->on_interpolate_transform_list = true;
+	}
+
 	camera->transform = p_transform.orthonormalized();
 }
 
+void RendererSceneCull::camera_set_interpolated(RID p_camera, bool p_interpolated) {
+	Camera *camera = camera_owner.get_or_null(p_camera);
+	ERR_FAIL_NULL(camera);
+	camera->interpolated = p_interpolated;
+	camera->transform_prev = camera->transform;
+}
+
+void RendererSceneCull::camera_reset_physics_interpolation(RID p_camera) {
+	Camera *camera = camera_owner.get_or_null(p_camera);
+	ERR_FAIL_NULL(camera);
+	camera->transform_prev = camera->transform;
+}
+
 void RendererSceneCull::camera_set_cull_mask(RID p_camera, uint32_t p_layers) {
 	Camera *camera = camera_owner.get_or_null(p_camera);
 	ERR_FAIL_NULL(camera);
@@ -218,8 +238,9 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(A->base_data);
 
 		if (A->dynamic_gi) {
-			geom->lightmap_captures.insert(B);
+			geom->lightmap_captures.insert(B, -1);
 			lightmap_data->geometries.insert(A);
+			A->lightmap_capture_dirty = true;
 
 			if (A->scenario && A->array_index >= 0) {
 				InstanceData &idata = A->scenario->instance_data[A->array_index];
@@ -251,6 +272,8 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 	} else if (B->base_type == RS::INSTANCE_PARTICLES_COLLISION && A->base_type == RS::INSTANCE_PARTICLES) {
 		InstanceParticlesCollisionData *collision = static_cast<InstanceParticlesCollisionData *>(B->base_data);
 		RSG::particles_storage->particles_add_collision(A->base, collision->instance);
+	} else if (B->base_type == RS::INSTANCE_PARTICLES_COLLISION && ((1 << A->base_type) & RS::INSTANCE_GEOMETRY_MASK)) {
+		self->_particles_collision_heightfield_mark_changed(B, A->transformed_aabb);
 	}
 }
 
@@ -335,6 +358,7 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(A->base_data);
 		if (A->dynamic_gi) {
 			geom->lightmap_captures.erase(B);
+			A->lightmap_capture_dirty = true;
 
 			if (geom->lightmap_captures.is_empty() && A->scenario && A->array_index >= 0) {
 				InstanceData &idata = A->scenario->instance_data[A->array_index];
@@ -367,6 +391,9 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 	} else if (B->base_type == RS::INSTANCE_PARTICLES_COLLISION && A->base_type == RS::INSTANCE_PARTICLES) {
 		InstanceParticlesCollisionData *collision = static_cast<InstanceParticlesCollisionData *>(B->base_data);
 		RSG::particles_storage->particles_remove_collision(A->base, collision->instance);
+	} else if (B->base_type == RS::INSTANCE_PARTICLES_COLLISION && ((1 << A->base_type) & RS::INSTANCE_GEOMETRY_MASK)) {
+		self->_particles_collision_heightfield_mark_changed(B, A->transformed_aabb);
+		self->_particles_collision_heightfield_mark_changed(B, A->prev_transformed_aabb);
 	}
 }
 
@@ -924,7 +951,9 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
 
-	if (instance->transform == p_transform) {
+	const bool interpolate = _interpolation_data.interpolation_enabled && instance->interpolated;
+
+	if ((interpolate ? instance->transform_curr : instance->transform) == p_transform) {
 		return; //must be checked to avoid worst evil
 	}
 
@@ -936,10 +965,41 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	}
 
 #endif
+
+	if (interpolate) {
+		// The rendered transform is set each frame in update_interpolation_frame().
+		instance->transform_curr = p_transform;
+
+		if (!instance->on_interpolate_transform_list) {
+			_interpolation_data.instance_transform_update_list.push_back(p_instance);
+			instance->on_interpolate_transform_list = true;
+		}
+		if (!instance->on_interpolate_list) {
+			_interpolation_data.instance_interpolate_update_list.push_back(p_instance);
+			instance->on_interpolate_list = true;
+		}
+		return;
+	}
+
 	instance->transform = p_transform;
+	instance->transform_curr = p_transform;
+	instance->transform_prev = p_transform;
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+	instance->interpolated = p_interpolated;
+	instance->transform_prev = instance->transform_curr;
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+	instance->transform_prev = instance->transform_curr;
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1101,6 +1161,50 @@ void RendererSceneCull::instance_set_ignore_culling(RID p_instance, bool p_enabl
 	}
 }
 
+void RendererSceneCull::instances_set_transform(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		const Transform3D &transform = transforms[i];
+		if (instance->transform == transform) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE(!transform.is_finite());
+#endif
+		instance->transform = transform;
+		// The indexer is updated for all of them at once, when the dirty instances are processed.
+		_instance_queue_update(instance, true);
+	}
+}
+
+void RendererSceneCull::instances_set_visible(const Vector<RID> &p_instances, bool p_visible) {
+	for (const RID &instance : p_instances) {
+		instance_set_visible(instance, p_visible);
+	}
+}
+
+Vector<AABB> RendererSceneCull::instances_get_aabb(const Vector<RID> &p_instances) const {
+	RendererSceneCull *self = const_cast<RendererSceneCull *>(this);
+	self->update_dirty_instances(); // Apply pending transforms first.
+
+	Vector<AABB> aabbs;
+	aabbs.resize(p_instances.size());
+	AABB *w = aabbs.ptrw();
+	for (int i = 0; i < p_instances.size(); i++) {
+		const Instance *instance = self->instance_owner.get_or_null(p_instances[i]);
+		ERR_CONTINUE(!instance);
+		w[i] = instance->transformed_aabb;
+	}
+	return aabbs;
+}
+
 Vector<ObjectID> RendererSceneCull::instances_cull_aabb(const AABB &p_aabb, RID p_scenario) const {
 	Vector<ObjectID> instances;
 	Scenario *scenario = scenario_owner.get_or_null(p_scenario);
@@ -1554,6 +1658,14 @@ Variant RendererSceneCull::instance_geometry_get_shader_parameter_default_value(
 	return Variant();
 }
 
+void RendererSceneCull::instances_geometry_set_shader_parameter(const Vector<RID> &p_instances, const StringName &p_parameter, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND(p_instances.size() != p_values.size());
+
+	for (int i = 0; i < p_instances.size(); i++) {
+		instance_geometry_set_shader_parameter(p_instances[i], p_parameter, p_values[i]);
+	}
+}
+
 void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instance, List<PropertyInfo> *p_parameters) const {
 	const Instance *instance = const_cast<RendererSceneCull *>(this)->instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1581,6 +1693,10 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		RSG::light_storage->light_instance_set_aabb(light->instance, p_instance->transform.xform(p_instance->aabb));
 		light->make_shadow_dirty();
 
+		if (p_instance->scenario) {
+			p_instance->scenario->lighting_version++;
+		}
+
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
 			if (p_instance->visible && p_instance->scenario && light->bake_mode == RS::LIGHT_BAKE_DYNAMIC) {
@@ -1670,7 +1786,13 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 
 		if (!p_instance->lightmap && geom->lightmap_captures.size()) {
 			//affected by lightmap captures, must update capture info!
-			_update_instance_lightmap_captures(p_instance);
+			//slow moving objects are only captured again after moving a minimum distance, and all captures are batched
+			Vector3 center = p_instance->transform.xform(p_instance->aabb.get_center());
+			bool needs_capture = p_instance->lightmap_capture_dirty || p_instance->lightmap_sh.is_empty() || center.distance_squared_to(p_instance->lightmap_capture_position) > lightmap_capture_update_distance_squared;
+			if (needs_capture && !p_instance->lightmap_capture_queued) {
+				p_instance->lightmap_capture_queued = true;
+				lightmap_capture_update_list.push_back(p_instance);
+			}
 		} else {
 			if (!p_instance->lightmap_sh.is_empty()) {
 				p_instance->lightmap_sh.clear(); //don't need SH
@@ -1692,6 +1814,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 
 	//quantize to improve moving object performance
 	AABB bvh_aabb = p_instance->transformed_aabb;
+	bool small_motion = false;
 
 	if (p_instance->indexer_id.is_valid() && bvh_aabb != p_instance->prev_transformed_aabb) {
 		//assume motion, see if bounds need to be quantized
@@ -1703,6 +1826,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 			//moved but not a lot, use motion aabb quantizing
 			float quantize_size = Math::pow(2.0, Math::ceil(Math::log(motion_longest_axis) / Math::log(2.0))) * 0.5; //one fifth
 			bvh_aabb.quantize(quantize_size);
+			small_motion = true;
 		}
 	}
 
@@ -1797,10 +1921,13 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
-		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
-			p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+		DynamicBVH &indexer = p_instance->scenario->indexers[((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) ? Scenario::INDEXER_GEOMETRY : Scenario::INDEXER_VOLUMES];
+		if (small_motion) {
+			// Small moves keep the leaf where it is in the tree, the indexer rebuilds itself once enough of them accumulate.
+			indexer.refit(p_instance->indexer_id, bvh_aabb);
+			indexer.finish_refit();
 		} else {
-			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
+			indexer.update(p_instance->indexer_id, bvh_aabb);
 		}
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
 	}
@@ -1809,6 +1936,18 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		p_instance->scenario->instance_visibility[p_instance->visibility_index].position = p_instance->transformed_aabb.get_center();
 	}
 
+	if (((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) && p_instance->base_type != RS::INSTANCE_PARTICLES) {
+		// Heightfields this geometry already overlapped need to redraw where it was and where it is now.
+		for (SelfList<InstancePair> *E = p_instance->pairs.first(); E; E = E->next()) {
+			InstancePair *pair = E->self();
+			Instance *other_instance = p_instance == pair->a ? pair->b : pair->a;
+			if (other_instance->base_type == RS::INSTANCE_PARTICLES_COLLISION) {
+				_particles_collision_heightfield_mark_changed(other_instance, p_instance->prev_transformed_aabb);
+				_particles_collision_heightfield_mark_changed(other_instance, p_instance->transformed_aabb);
+			}
+		}
+	}
+
 	//move instance and repair
 	pair_pass++;
 
@@ -1824,9 +1963,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		pair.pair_mask |= 1 << RS::INSTANCE_LIGHT;
 		pair.pair_mask |= 1 << RS::INSTANCE_VOXEL_GI;
 		pair.pair_mask |= 1 << RS::INSTANCE_LIGHTMAP;
-		if (p_instance->base_type == RS::INSTANCE_PARTICLES) {
-			pair.pair_mask |= 1 << RS::INSTANCE_PARTICLES_COLLISION;
-		}
+		pair.pair_mask |= 1 << RS::INSTANCE_PARTICLES_COLLISION; // Particles collide, other geometry invalidates heightfields.
 
 		pair.pair_mask |= geometry_instance_pair_mask;
 
@@ -1849,7 +1986,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		pair.bvh = &p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY];
 		pair.cull_mask = RSG::texture_storage->decal_get_cull_mask(p_instance->base);
 	} else if (p_instance->base_type == RS::INSTANCE_PARTICLES_COLLISION) {
-		pair.pair_mask = (1 << RS::INSTANCE_PARTICLES);
+		pair.pair_mask = RS::INSTANCE_GEOMETRY_MASK;
 		pair.bvh = &p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY];
 	} else if (p_instance->base_type == RS::INSTANCE_VOXEL_GI) {
 		//lights and geometries
@@ -2009,6 +2146,7 @@ void RendererSceneCull::_update_instance_aabb(Instance *p_instance) {
 }
 
 void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance) {
+	// May run in worker threads, this must only tap the lightmaps and write to the instance's own data.
 	bool first_set = p_instance->lightmap_sh.size() == 0;
 	p_instance->lightmap_sh.resize(9); //using SH
 	p_instance->lightmap_target_sh.resize(9); //using SH
@@ -2017,9 +2155,13 @@ void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance)
 	Color accum_sh[9];
 	float accum_blend = 0.0;
 
+	Vector3 center = p_instance->transform.xform(p_instance->aabb.get_center()); //use aabb center
+	p_instance->lightmap_capture_position = center;
+	p_instance->lightmap_capture_dirty = false;
+
 	InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
-	for (Instance *E : geom->lightmap_captures) {
-		Instance *lightmap = E;
+	for (KeyValue<Instance *, int32_t> &E : geom->lightmap_captures) {
+		Instance *lightmap = E.key;
 
 		bool interior = RSG::light_storage->lightmap_is_interior(lightmap->base);
 
@@ -2028,8 +2170,6 @@ void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance)
 		}
 
 		Transform3D to_bounds = lightmap->transform.affine_inverse();
-		Vector3 center = p_instance->transform.xform(p_instance->aabb.get_center()); //use aabb center
-
 		Vector3 lm_pos = to_bounds.xform(center);
 
 		AABB bounds = RSG::light_storage->lightmap_get_aabb(lightmap->base);
@@ -2038,7 +2178,7 @@ void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance)
 		}
 
 		Color sh[9];
-		RSG::light_storage->lightmap_tap_sh_light(lightmap->base, lm_pos, sh);
+		RSG::light_storage->lightmap_tap_sh_light(lightmap->base, lm_pos, sh, &E.value);
 
 		//rotate it
 		Basis rot = lightmap->transform.basis.orthonormalized();
@@ -2084,9 +2224,45 @@ void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance)
 			}
 		}
 	}
+}
+
+void RendererSceneCull::_update_instance_lightmap_captures_threaded(uint32_t p_index, Instance **p_instances) {
+	_update_instance_lightmap_captures(p_instances[p_index]);
+}
+
+void RendererSceneCull::_update_dirty_lightmap_captures() {
+	if (lightmap_capture_update_list.is_empty()) {
+		return;
+	}
+
+	// Instances may have stopped using captures since they were queued.
+	uint32_t capture_count = 0;
+	for (Instance *instance : lightmap_capture_update_list) {
+		instance->lightmap_capture_queued = false;
+		if (instance->lightmap || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || static_cast<InstanceGeometryData *>(instance->base_data)->lightmap_captures.is_empty()) {
+			continue;
+		}
+		lightmap_capture_update_list[capture_count++] = instance;
+	}
+	lightmap_capture_update_list.resize(capture_count);
+
+	if (capture_count >= thread_cull_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_update_instance_lightmap_captures_threaded, lightmap_capture_update_list.ptr(), capture_count, -1, true, SNAME("UpdateLightmapCaptures"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (Instance *instance : lightmap_capture_update_list) {
+			_update_instance_lightmap_captures(instance);
+		}
+	}
 
-	ERR_FAIL_NULL(geom->geometry_instance);
-	geom->geometry_instance->set_lightmap_capture(p_instance->lightmap_sh.ptr());
+	// Geometry instances are not thread safe, pass the new captures to them here.
+	for (Instance *instance : lightmap_capture_update_list) {
+		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+		ERR_CONTINUE(geom->geometry_instance == nullptr);
+		geom->geometry_instance->set_lightmap_capture(instance->lightmap_sh.ptr());
+	}
+
+	lightmap_capture_update_list.clear();
 }
 
 void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect) {
@@ -2297,6 +2473,15 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 			ortho_transform.origin = x_vec * (x_min_cam + half_x) + y_vec * (y_min_cam + half_y) + z_vec * z_max;
 
 			cull.shadows[p_shadow_index].cascades[i].frustum = Frustum(light_frustum_planes);
+			cull.shadows[p_shadow_index].cascades[i].cull_min[0] = x_min;
+			cull.shadows[p_shadow_index].cascades[i].cull_max[0] = x_max;
+			cull.shadows[p_shadow_index].cascades[i].cull_min[1] = y_min;
+			cull.shadows[p_shadow_index].cascades[i].cull_max[1] = y_max;
+			cull.shadows[p_shadow_index].cascades[i].cull_min[2] = z_min;
+			cull.shadows[p_shadow_index].cascades[i].cull_max[2] = z_max + 1e6;
+			cull.shadows[p_shadow_index].cull_axes[0] = x_vec;
+			cull.shadows[p_shadow_index].cull_axes[1] = y_vec;
+			cull.shadows[p_shadow_index].cull_axes[2] = z_vec;
 			cull.shadows[p_shadow_index].cascades[i].projection = ortho_camera;
 			cull.shadows[p_shadow_index].cascades[i].transform = ortho_transform;
 			cull.shadows[p_shadow_index].cascades[i].zfar = z_max - z_min_cam;
@@ -2309,13 +2494,13 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
-bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
+bool RendererSceneCull::_light_instance_setup_shadow(Instance *p_instance, int32_t p_light_culler_id) {
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 	Transform3D light_transform = p_instance->transform;
 	light_transform.orthonormalize(); //scale does not count on lights
 
-	bool animated_material_found = false;
+	uint32_t pass_count = 0;
 
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
@@ -2327,14 +2512,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 				if (max_shadows_used + 2 > MAX_UPDATE_SHADOWS) {
 					return true;
 				}
-				for (int i = 0; i < 2; i++) {
-					//using this one ensures that raster deferred will have it
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Paraboloid, Half " + itos(i));
 
-					real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
+				real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 
+				for (int i = 0; i < 2; i++) {
 					real_t z = i == 0 ? -1 : 1;
-					Vector<Plane> planes;
+					Vector<Plane> &planes = shadow_cull_passes[shadow_cull_pass_count + i].planes;
 					planes.resize(6);
 					planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
 					planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
@@ -2343,53 +2526,10 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
 					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
-
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
 				}
+
+				pass_count = 2;
 			} else { //shadow cube
 
 				if (max_shadows_used + 6 > MAX_UPDATE_SHADOWS) {
@@ -2401,9 +2541,6 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 				cm.set_perspective(90, 1, radius * 0.005f, radius);
 
 				for (int i = 0; i < 6; i++) {
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Cube, Side " + itos(i));
-					//using this one ensures that raster deferred will have it
-
 					static const Vector3 view_normals[6] = {
 						Vector3(+1, 0, 0),
 						Vector3(-1, 0, 0),
@@ -2423,63 +2560,19 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					Transform3D xform = light_transform * Transform3D().looking_at(view_normals[i], view_up[i]);
 
-					Vector<Plane> planes = cm.get_projection_planes(xform);
-
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
+					shadow_cull_passes[shadow_cull_pass_count + i].planes = cm.get_projection_planes(xform);
 
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, xform, radius, 0, i, 0);
-
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
 				}
 
+				pass_count = 6;
+
 				//restore the regular DP matrix
 				//RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, 0, 0);
 			}
 
 		} break;
 		case RS::LIGHT_SPOT: {
-			RENDER_TIMESTAMP("Cull SpotLight3D Shadow");
-
 			if (max_shadows_used + 1 > MAX_UPDATE_SHADOWS) {
 				return true;
 			}
@@ -2490,58 +2583,114 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			Projection cm;
 			cm.set_perspective(angle * 2.0, 1.0, 0.005f * radius, radius);
 
-			Vector<Plane> planes = cm.get_projection_planes(light_transform);
+			shadow_cull_passes[shadow_cull_pass_count].planes = cm.get_projection_planes(light_transform);
 
-			instance_shadow_cull_result.clear();
+			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
 
-			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+			pass_count = 1;
+		} break;
+	}
 
-			struct CullConvex {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+	for (uint32_t i = 0; i < pass_count; i++) {
+		ShadowCullPass &pass = shadow_cull_passes[shadow_cull_pass_count++];
+		pass.light = p_instance;
+		pass.light_culler_id = p_light_culler_id;
+		pass.tighter_culling = !light->is_shadow_update_full();
+		pass.shadow_index = max_shadows_used;
 
-			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
+		RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+		shadow_data.light = light->instance;
+		shadow_data.pass = i;
+	}
 
-			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+	return false;
+}
 
-			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+void RendererSceneCull::_light_instance_cull_shadow_pass(uint32_t p_pass, ShadowCullData *p_cull_data) {
+	ShadowCullPass &pass = shadow_cull_passes[p_pass];
 
-			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
-			}
+	pass.cull_result.clear();
+	pass.mesh_instances.clear();
+	pass.animated_material_found = false;
 
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
-					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
+	Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&pass.planes[0], pass.planes.size());
 
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
-				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	struct CullConvex {
+		PagedArray<Instance *> *result;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			Instance *p_instance = (Instance *)p_data;
+			result->push_back(p_instance);
+			return false;
+		}
+	};
+
+	CullConvex cull_convex;
+	cull_convex.result = &pass.cull_result;
+
+	p_cull_data->scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(pass.planes.ptr(), pass.planes.size(), points.ptr(), points.size(), cull_convex);
+
+	if (pass.tighter_culling) {
+		light_culler->cull_regular_light(pass.cull_result, pass.light_culler_id);
+	}
+
+	RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[pass.shadow_index];
+
+	for (int j = 0; j < (int)pass.cull_result.size(); j++) {
+		Instance *instance = pass.cull_result[j];
+		if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_cull_data->visible_layers & instance->layer_mask)) {
+			continue;
+		} else {
+			if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
+				pass.animated_material_found = true;
 			}
 
-			RSG::mesh_storage->update_mesh_instances();
+			if (instance->mesh_instance.is_valid()) {
+				pass.mesh_instances.push_back(instance->mesh_instance);
+			}
+		}
 
-			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
-			shadow_data.light = light->instance;
-			shadow_data.pass = 0;
+		shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	}
+}
 
-		} break;
+void RendererSceneCull::_light_instances_update_shadows(Scenario *p_scenario, uint32_t p_visible_layers) {
+	if (shadow_cull_pass_count == 0) {
+		return;
+	}
+
+	RENDER_TIMESTAMP("Cull Light3D Shadows");
+
+	ShadowCullData cull_data;
+	cull_data.scenario = p_scenario;
+	cull_data.visible_layers = p_visible_layers;
+
+	if (shadow_cull_pass_count > 1) {
+		// Passes only read the scenario and write to their own results, so they can all run at once.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_light_instance_cull_shadow_pass, &cull_data, shadow_cull_pass_count, -1, true, SNAME("RenderCullShadows"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_light_instance_cull_shadow_pass(0, &cull_data);
+	}
+
+	// Mesh instance updates are not thread safe, so they are done once all passes are culled.
+	for (uint32_t i = 0; i < shadow_cull_pass_count; i++) {
+		ShadowCullPass &pass = shadow_cull_passes[i];
+
+		for (const RID &mesh_instance : pass.mesh_instances) {
+			RSG::mesh_storage->mesh_instance_check_for_update(mesh_instance);
+		}
+
+		if (pass.animated_material_found) {
+			static_cast<InstanceLightData *>(pass.light->base_data)->make_shadow_dirty();
+		}
+
+		pass.cull_result.clear();
+		pass.light = nullptr;
 	}
 
-	return animated_material_found;
+	RSG::mesh_storage->update_mesh_instances();
+
+	shadow_cull_pass_count = 0;
 }
 
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
@@ -2572,6 +2721,9 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 	if (p_xr_interface.is_null()) {
 		// Normal camera
 		Transform3D transform = camera->transform;
+		if (_interpolation_data.interpolation_enabled && camera->interpolated) {
+			TransformInterpolator::interpolate_transform_3d(camera->transform_prev, camera->transform, transform, Engine::get_singleton()->get_physics_interpolation_fraction());
+		}
 		Projection projection;
 		bool vaspect = camera->vaspect;
 		bool is_orthogonal = false;
@@ -2761,8 +2913,8 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 	RID instance_pair_buffer[MAX_INSTANCE_PAIRS];
 
-	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
-	float z_near = cull_data.camera_matrix->get_z_near();
+	Transform3D inv_occlusion_cam_transform = cull_data.occlusion_cam_transform.inverse();
+	float occlusion_z_near = cull_data.occlusion_camera_matrix->get_z_near();
 
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
@@ -2777,7 +2929,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
-#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
+#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.occlusion_cam_transform.origin, inv_occlusion_cam_transform, *cull_data.occlusion_camera_matrix, occlusion_z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
 			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
@@ -2800,6 +2952,10 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 								reflection_probe->render_step = 0;
 								reflection_probe_render_list.add_last(&reflection_probe->update_list);
 							}
+							if (!cull_data.render_reflection_probe) {
+								// Used to prioritize time-sliced updates of probes close to the camera.
+								reflection_probe->camera_distance = cull_data.cam_transform.origin.distance_to(idata.instance->transform.origin);
+							}
 							cull_data.cull->lock.unlock();
 
 							idata.flags &= ~uint32_t(InstanceData::FLAG_REFLECTION_PROBE_DIRTY);
@@ -2849,8 +3005,17 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 							//but if nothing is going on, don't do it.
 							keep = false;
 						} else {
+							// Fraction of the viewport width covered by the particles, used to pick their LOD.
+							const AABB &aabb = idata.instance->transformed_aabb;
+							float distance = 1.0;
+							if (!cull_data.camera_matrix->is_orthogonal()) {
+								distance = MAX(cull_data.cam_transform.origin.distance_to(aabb.get_center()) - aabb.size.length() * 0.5f, cull_data.camera_matrix->get_z_near());
+							}
+							float screen_size = aabb.size.length() / (distance * cull_data.camera_matrix->get_lod_multiplier());
+
 							cull_data.cull->lock.lock();
 							RSG::particles_storage->particles_request_process(idata.base_rid);
+							RSG::particles_storage->particles_set_lod_screen_size(idata.base_rid, screen_size);
 							cull_data.cull->lock.unlock();
 							RSG::particles_storage->particles_set_view_axis(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized());
 							//particles visible? request redraw
@@ -2970,19 +3135,40 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 				}
 			}
 
-			for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+			uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
+			bool casts_shadows = ((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && (idata.flags & InstanceData::FLAG_CAST_SHADOWS) && LAYER_CHECK;
+
+			for (uint32_t j = 0; casts_shadows && j < cull_data.cull->shadow_count; j++) {
 				if (!light_culler->cull_directional_light(cull_data.scenario->instance_aabbs[i], j)) {
 					continue;
 				}
-				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
-						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
-						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && LAYER_CHECK) {
-							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
-							mesh_visible = true;
-						}
+				// Project the bounds onto the light axes once, then test each cascade with a few comparisons.
+				const Cull::Shadow &shadow = cull_data.cull->shadows[j];
+				const real_t *bounds = cull_data.scenario->instance_aabbs[i].bounds;
+				Vector3 center = Vector3(bounds[0] + bounds[3], bounds[1] + bounds[4], bounds[2] + bounds[5]) * 0.5;
+				Vector3 half_extents = Vector3(bounds[3] - bounds[0], bounds[4] - bounds[1], bounds[5] - bounds[2]) * 0.5;
+				real_t proj_min[3];
+				real_t proj_max[3];
+				for (uint32_t a = 0; a < 3; a++) {
+					real_t proj_center = shadow.cull_axes[a].dot(center);
+					real_t proj_radius = shadow.cull_axes[a].abs().dot(half_extents);
+					proj_min[a] = proj_center - proj_radius;
+					proj_max[a] = proj_center + proj_radius;
+				}
+
+				for (uint32_t k = 0; k < shadow.cascade_count; k++) {
+					const Cull::Shadow::Cascade &cascade = shadow.cascades[k];
+					if (proj_min[0] >= cascade.cull_max[0] || proj_max[0] <= cascade.cull_min[0] ||
+							proj_min[1] >= cascade.cull_max[1] || proj_max[1] <= cascade.cull_min[1] ||
+							proj_min[2] >= cascade.cull_max[2] || proj_max[2] <= cascade.cull_min[2]) {
+						continue;
+					}
+					if (!VIS_CHECK) {
+						break;
 					}
+					cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+					mesh_visible = true;
 				}
 			}
 		}
@@ -3158,6 +3344,17 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.render_reflection_probe = render_reflection_probe;
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
 		cull_data.camera_matrix = &p_camera_data->main_projection;
+		cull_data.occlusion_cam_transform = p_camera_data->main_transform;
+		cull_data.occlusion_camera_matrix = &p_camera_data->main_projection;
+		if ((cull_data.occlusion_buffer == nullptr || cull_data.occlusion_buffer->is_empty()) && p_render_buffers.is_valid() && p_reflection_probe.is_null()) {
+			// Without occluders, fall back to the depth of an earlier frame if the renderer provides it.
+			const RendererSceneOcclusionCull::DepthHZBuffer *depth_buffer = scene_render->render_buffers_get_depth_occlusion_buffer(p_render_buffers);
+			if (depth_buffer != nullptr && !depth_buffer->is_empty()) {
+				cull_data.occlusion_buffer = depth_buffer;
+				cull_data.occlusion_cam_transform = depth_buffer->get_cam_transform();
+				cull_data.occlusion_camera_matrix = &depth_buffer->get_cam_projection();
+			}
+		}
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
 //#define DEBUG_CULL_TIME
 #ifdef DEBUG_CULL_TIME
@@ -3222,6 +3419,13 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		}
 
 		// Positional Shadows
+
+		uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+		if (frame != shadow_full_updates_frame) {
+			shadow_full_updates_frame = frame;
+			shadow_full_updates_used = 0;
+		}
+
 		for (uint32_t i = 0; i < (uint32_t)scene_cull_result.lights.size(); i++) {
 			Instance *ins = scene_cull_result.lights[i];
 
@@ -3314,7 +3518,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				// the light volume doesn't intersect the camera frustum.
 
 				// Returns false if the entire light can be culled.
-				bool allow_redraw = light_culler->prepare_regular_light(*ins);
+				bool allow_redraw = light_culler->prepare_regular_light(*ins, i);
 
 				// Directional lights aren't handled here, _light_instance_update_shadow is called from elsewhere.
 				// Checking for this in case this changes, as this is assumed.
@@ -3326,6 +3530,17 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				// There is however a cost to tighter shadow culling in this situation (2 shadow updates in 1 frame),
 				// so we should detect this and switch off tighter caster culling automatically.
 				// This is done in the logic for `decrement_shadow_dirty()`.
+
+				// Full updates that follow a tightly culled one are limited per frame, the remaining lights
+				// stay dirty and are updated in the following frames.
+				if (allow_redraw && shadow_full_updates_per_frame > 0 && light->is_shadow_update_deferrable()) {
+					if (shadow_full_updates_used < shadow_full_updates_per_frame) {
+						shadow_full_updates_used++;
+					} else {
+						allow_redraw = false;
+					}
+				}
+
 				if (allow_redraw) {
 					light->last_version++;
 					light->decrement_shadow_dirty();
@@ -3336,17 +3551,17 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 			if (redraw && max_shadows_used < MAX_UPDATE_SHADOWS) {
 				//must redraw!
-				RENDER_TIMESTAMP("> Render Light3D " + itos(i));
-				if (_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold, p_visible_layers)) {
+				if (_light_instance_setup_shadow(ins, i)) {
 					light->make_shadow_dirty();
 				}
-				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
 			} else {
 				if (redraw) {
 					light->make_shadow_dirty();
 				}
 			}
 		}
+
+		_light_instances_update_shadows(scenario, p_visible_layers);
 	}
 
 	//render HDDAGI
@@ -3570,8 +3785,10 @@ void RendererSceneCull::render_probes() {
 
 	SelfList<InstanceReflectionProbeData> *ref_probe = reflection_probe_render_list.first();
 	Vector<SelfList<InstanceReflectionProbeData> *> done_list;
+	LocalVector<InstanceReflectionProbeData *> time_sliced;
 
 	bool busy = false;
+	reflection_probe_frame++;
 
 	if (ref_probe) {
 		RENDER_TIMESTAMP("Render ReflectionProbes");
@@ -3605,11 +3822,59 @@ void RendererSceneCull::render_probes() {
 
 					done_list.push_back(ref_probe);
 				} break;
+				case RS::REFLECTION_PROBE_UPDATE_TIME_SLICED: {
+					time_sliced.push_back(ref_probe->self());
+				} break;
 			}
 
 			ref_probe = next;
 		}
 
+		if (time_sliced.size()) {
+			// Spend the per-frame budget on probes that already started updating first, then on the ones
+			// whose lighting changed, then on the stalest ones relative to their distance from the camera.
+			struct TimeSlicedSort {
+				uint64_t frame = 0;
+				_FORCE_INLINE_ float priority(const InstanceReflectionProbeData *p_probe) const {
+					if (p_probe->render_step > 0) {
+						return FLT_MAX;
+					}
+					float staleness = float(frame - p_probe->last_update_frame);
+					if (p_probe->owner->scenario && p_probe->lighting_version != p_probe->owner->scenario->lighting_version) {
+						staleness *= 4.0;
+					}
+					return staleness / (1.0 + p_probe->camera_distance);
+				}
+				_FORCE_INLINE_ bool operator()(const InstanceReflectionProbeData *p_a, const InstanceReflectionProbeData *p_b) const {
+					return priority(p_a) > priority(p_b);
+				}
+			};
+
+			SortArray<InstanceReflectionProbeData *, TimeSlicedSort> sorter;
+			sorter.compare.frame = reflection_probe_frame;
+			sorter.sort(time_sliced.ptr(), time_sliced.size());
+
+			uint32_t steps_left = reflection_probe_time_sliced_steps;
+			for (uint32_t i = 0; i < time_sliced.size() && steps_left > 0; i++) {
+				InstanceReflectionProbeData *probe = time_sliced[i];
+				if (probe->render_step == 0 && probe->owner->scenario) {
+					// Remember the lighting this update captures.
+					probe->lighting_version = probe->owner->scenario->lighting_version;
+				}
+
+				while (steps_left > 0) {
+					bool done = _render_reflection_probe_step(probe->owner, probe->render_step);
+					steps_left--;
+					if (done) {
+						probe->last_update_frame = reflection_probe_frame;
+						done_list.push_back(&probe->update_list);
+						break;
+					}
+					probe->render_step++;
+				}
+			}
+		}
+
 		// Now remove from our list
 		for (SelfList<InstanceReflectionProbeData> *rp : done_list) {
 			reflection_probe_render_list.remove(rp);
@@ -3817,40 +4082,76 @@ void RendererSceneCull::render_probes() {
 	}
 }
 
+void RendererSceneCull::_particles_collision_heightfield_mark_changed(Instance *p_collision, const AABB &p_aabb) {
+	if (!p_collision->transformed_aabb.intersects(p_aabb) || !RSG::particles_storage->particles_collision_is_heightfield(p_collision->base)) {
+		return;
+	}
+
+	InstanceParticlesCollisionData *collision = static_cast<InstanceParticlesCollisionData *>(p_collision->base_data);
+	AABB area = p_aabb.intersection(p_collision->transformed_aabb);
+
+	for (AABB &E : collision->heightfield_changed_areas) {
+		if (E.intersects(area)) {
+			E.merge_with(area);
+			return;
+		}
+	}
+
+	if (collision->heightfield_changed_areas.size() == HEIGHTFIELD_MAX_CHANGED_AREAS) {
+		collision->heightfield_changed_areas[HEIGHTFIELD_MAX_CHANGED_AREAS - 1].merge_with(area);
+	} else {
+		collision->heightfield_changed_areas.push_back(area);
+	}
+}
+
 void RendererSceneCull::render_particle_colliders() {
+	LocalVector<RendererSceneRender::ParticleColliderHeightfieldArea> areas;
+
 	while (heightfield_particle_colliders_update_list.begin()) {
 		Instance *hfpc = *heightfield_particle_colliders_update_list.begin();
 
 		if (hfpc->scenario && hfpc->base_type == RS::INSTANCE_PARTICLES_COLLISION && RSG::particles_storage->particles_collision_is_heightfield(hfpc->base)) {
 			//update heightfield
-			instance_cull_result.clear();
-			scene_cull_result.geometry_instances.clear();
-
-			struct CullAABB {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+			InstanceParticlesCollisionData *collision = static_cast<InstanceParticlesCollisionData *>(hfpc->base_data);
+
+			// Only the areas that were exposed by moving the heightfield or touched by changed geometry are rendered,
+			// the rest is reused from the previous update or from an overlapping heightfield updated this frame.
+			areas.clear();
+			scene_render->particle_collider_heightfield_begin_update(hfpc->base, hfpc->transform, collision->heightfield_changed_areas, areas);
+			collision->heightfield_changed_areas.clear();
+
+			for (const RendererSceneRender::ParticleColliderHeightfieldArea &area : areas) {
+				AABB area_aabb = area.rect.has_area() ? area.aabb : hfpc->transformed_aabb;
+
+				instance_cull_result.clear();
+				scene_cull_result.geometry_instances.clear();
+
+				struct CullAABB {
+					PagedArray<Instance *> *result;
+					_FORCE_INLINE_ bool operator()(void *p_data) {
+						Instance *p_instance = (Instance *)p_data;
+						result->push_back(p_instance);
+						return false;
+					}
+				};
 
-			CullAABB cull_aabb;
-			cull_aabb.result = &instance_cull_result;
-			hfpc->scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(hfpc->transformed_aabb, cull_aabb);
-			hfpc->scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(hfpc->transformed_aabb, cull_aabb);
+				CullAABB cull_aabb;
+				cull_aabb.result = &instance_cull_result;
+				hfpc->scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(area_aabb, cull_aabb);
+				hfpc->scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(area_aabb, cull_aabb);
 
-			for (int i = 0; i < (int)instance_cull_result.size(); i++) {
-				Instance *instance = instance_cull_result[i];
-				if (!instance || !((1 << instance->base_type) & (RS::INSTANCE_GEOMETRY_MASK & (~(1 << RS::INSTANCE_PARTICLES))))) { //all but particles to avoid self collision
-					continue;
+				for (int i = 0; i < (int)instance_cull_result.size(); i++) {
+					Instance *instance = instance_cull_result[i];
+					if (!instance || !((1 << instance->base_type) & (RS::INSTANCE_GEOMETRY_MASK & (~(1 << RS::INSTANCE_PARTICLES))))) { //all but particles to avoid self collision
+						continue;
+					}
+					InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+					ERR_FAIL_NULL(geom->geometry_instance);
+					scene_cull_result.geometry_instances.push_back(geom->geometry_instance);
 				}
-				InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
-				ERR_FAIL_NULL(geom->geometry_instance);
-				scene_cull_result.geometry_instances.push_back(geom->geometry_instance);
-			}
 
-			scene_render->render_particle_collider_heightfield(hfpc->base, hfpc->transform, scene_cull_result.geometry_instances);
+				scene_render->render_particle_collider_heightfield(hfpc->base, hfpc->transform, scene_cull_result.geometry_instances, area.rect);
+			}
 		}
 		heightfield_particle_colliders_update_list.remove(heightfield_particle_colliders_update_list.begin());
 	}
@@ -4123,6 +4424,8 @@ void RendererSceneCull::update_dirty_instances() {
 		_update_dirty_instance(_instance_update_list.first()->self());
 	}
 
+	_update_dirty_lightmap_captures();
+
 	// Update dirty resources after dirty instances as instance updates may affect resources.
 	RSG::utilities->update_dirty_resources();
 }
@@ -4153,6 +4456,8 @@ bool RendererSceneCull::free(RID p_rid) {
 	}
 
 	if (camera_owner.owns(p_rid)) {
+		Camera *camera = camera_owner.get_or_null(p_rid);
+		_interpolation_data.notify_free_camera(p_rid, *camera);
 		camera_owner.free(p_rid);
 
 	} else if (scenario_owner.owns(p_rid)) {
@@ -4192,6 +4497,7 @@ bool RendererSceneCull::free(RID p_rid) {
 		}
 		update_dirty_instances(); //in case something changed this
 
+		_interpolation_data.notify_free_instance(p_rid, *instance);
 		instance_owner.free(p_rid);
 	} else {
 		return false;
@@ -4226,6 +4532,126 @@ void RendererSceneCull::update_visibility_notifiers() {
 	}
 }
 
+/* INTERPOLATION */
+
+void RendererSceneCull::tick() {
+	if (!_interpolation_data.interpolation_enabled) {
+		return;
+	}
+
+	// Keep the previous transform of everything moved during the last tick up to date and ready for the next one.
+	for (const RID &rid : _interpolation_data.instance_transform_update_list) {
+		Instance *instance = instance_owner.get_or_null(rid);
+		if (instance) {
+			instance->transform_prev = instance->transform_curr;
+			instance->on_interpolate_transform_list = false;
+		}
+	}
+	_interpolation_data.instance_transform_update_list.clear();
+
+	for (const RID &rid : _interpolation_data.camera_transform_update_list) {
+		Camera *camera = camera_owner.get_or_null(rid);
+		if (camera) {
+			camera->transform_prev = camera->transform;
+			camera->on_interpolate_transform_list = false;
+		}
+	}
+	_interpolation_data.camera_transform_update_list.clear();
+}
+
+void RendererSceneCull::update_interpolation_frame() {
+	if (!_interpolation_data.interpolation_enabled) {
+		return;
+	}
+
+	const real_t fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+
+	LocalVector<RID> &interpolate_list = _interpolation_data.instance_interpolate_update_list;
+	uint32_t i = 0;
+	while (i < interpolate_list.size()) {
+		Instance *instance = instance_owner.get_or_null(interpolate_list[i]);
+		if (!instance) {
+			interpolate_list.remove_at_unordered(i);
+			continue;
+		}
+
+		if (instance->interpolated) {
+			TransformInterpolator::interpolate_transform_3d(instance->transform_prev, instance->transform_curr, instance->transform, fraction);
+		} else {
+			instance->transform = instance->transform_curr;
+		}
+		_instance_queue_update(instance, true);
+
+		// Instances which stopped moving get this last update at their current transform, then leave the list.
+		if (!instance->on_interpolate_transform_list && instance->transform_prev == instance->transform_curr) {
+			instance->on_interpolate_list = false;
+			interpolate_list.remove_at_unordered(i);
+			continue;
+		}
+
+		i++;
+	}
+}
+
+void RendererSceneCull::set_physics_interpolation_enabled(bool p_enabled) {
+	if (_interpolation_data.interpolation_enabled == p_enabled) {
+		return;
+	}
+
+	// Snap everything which is still interpolating to its latest transform.
+	for (const RID &rid : _interpolation_data.instance_interpolate_update_list) {
+		Instance *instance = instance_owner.get_or_null(rid);
+		if (instance) {
+			instance->transform = instance->transform_curr;
+			instance->on_interpolate_list = false;
+			_instance_queue_update(instance, true);
+		}
+	}
+	for (const RID &rid : _interpolation_data.instance_transform_update_list) {
+		Instance *instance = instance_owner.get_or_null(rid);
+		if (instance) {
+			instance->transform_prev = instance->transform_curr;
+			instance->on_interpolate_transform_list = false;
+		}
+	}
+	for (const RID &rid : _interpolation_data.camera_transform_update_list) {
+		Camera *camera = camera_owner.get_or_null(rid);
+		if (camera) {
+			camera->transform_prev = camera->transform;
+			camera->on_interpolate_transform_list = false;
+		}
+	}
+
+	_interpolation_data.instance_interpolate_update_list.clear();
+	_interpolation_data.instance_transform_update_list.clear();
+	_interpolation_data.camera_transform_update_list.clear();
+	_interpolation_data.interpolation_enabled = p_enabled;
+}
+
+void RendererSceneCull::InterpolationData::notify_free_camera(RID p_rid, Camera &r_camera) {
+	r_camera.on_interpolate_transform_list = false;
+
+	if (!interpolation_enabled) {
+		return;
+	}
+
+	// If the camera was on any of the lists, remove.
+	camera_transform_update_list.erase_multiple_unordered(p_rid);
+}
+
+void RendererSceneCull::InterpolationData::notify_free_instance(RID p_rid, Instance &r_instance) {
+	r_instance.on_interpolate_list = false;
+	r_instance.on_interpolate_transform_list = false;
+
+	if (!interpolation_enabled) {
+		return;
+	}
+
+	// If the instance was on any of the lists, remove.
+	instance_interpolate_update_list.erase_multiple_unordered(p_rid);
+	instance_transform_update_list.erase_multiple_unordered(p_rid);
+}
+
 /*******************************/
 /* Passthrough to Scene Render */
 /*******************************/
@@ -4244,10 +4670,10 @@ RendererSceneCull::RendererSceneCull() {
 	singleton = this;
 
 	instance_cull_result.set_page_pool(&instance_cull_page_pool);
-	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		shadow_cull_passes[i].cull_result.set_page_pool(&instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < HDDAGI_MAX_CASCADES * HDDAGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_hddagi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4262,6 +4688,10 @@ RendererSceneCull::RendererSceneCull() {
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
+	shadow_full_updates_per_frame = GLOBAL_GET("rendering/lights_and_shadows/positional_shadow/max_full_updates_per_frame");
+	reflection_probe_time_sliced_steps = MAX(1, int(GLOBAL_GET("rendering/reflections/reflection_probes/time_sliced_steps_per_frame")));
+	float lightmap_capture_update_distance = GLOBAL_GET("rendering/lightmapping/probe_capture/update_distance");
+	lightmap_capture_update_distance_squared = lightmap_capture_update_distance * lightmap_capture_update_distance;
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
 	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
@@ -4275,10 +4705,10 @@ RendererSceneCull::RendererSceneCull() {
 
 RendererSceneCull::~RendererSceneCull() {
 	instance_cull_result.reset();
-	instance_shadow_cull_result.reset();
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		shadow_cull_passes[i].cull_result.reset();
 	}
 	for (uint32_t i = 0; i < HDDAGI_MAX_CASCADES * HDDAGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_hddagi_data[i].instances.reset();
@@ -87,6 +87,11 @@ public:
 
 		Transform3D transform;
 
+		// Physics interpolation.
+		Transform3D transform_prev;
+		bool interpolated = true;
+		bool on_interpolate_transform_list = false;
+
 		Camera() {
 			visible_layers = 0xFFFFFFFF;
 			fov = 75;
@@ -108,6 +113,8 @@ public:
 	virtual void camera_set_orthogonal(RID p_camera, float p_size, float p_z_near, float p_z_far);
 	virtual void camera_set_frustum(RID p_camera, float p_size, Vector2 p_offset, float p_z_near, float p_z_far);
 	virtual void camera_set_transform(RID p_camera, const Transform3D &p_transform);
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated);
+	virtual void camera_reset_physics_interpolation(RID p_camera);
 	virtual void camera_set_cull_mask(RID p_camera, uint32_t p_layers);
 	virtual void camera_set_environment(RID p_camera, RID p_env);
 	virtual void camera_set_camera_attributes(RID p_camera, RID p_attributes);
@@ -346,6 +353,9 @@ public:
 
 		LocalVector<RID> dynamic_lights;
 
+		// Bumped whenever a light changes, so time-sliced reflection probes can tell their lighting is outdated.
+		uint64_t lighting_version = 0;
+
 		PagedArray<InstanceBounds> instance_aabbs;
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
@@ -408,6 +418,13 @@ public:
 
 		Transform3D transform;
 
+		// Physics interpolation. With interpolation, transform is the one rendered this frame, between transform_prev and transform_curr.
+		Transform3D transform_curr;
+		Transform3D transform_prev;
+		bool interpolated = true;
+		bool on_interpolate_list = false;
+		bool on_interpolate_transform_list = false;
+
 		float lod_bias;
 
 		bool ignore_occlusion_culling;
@@ -481,6 +498,9 @@ public:
 		bool use_aabb_center = true;
 
 		Vector<Color> lightmap_target_sh; //target is used for incrementally changing the SH over time, this avoids pops in some corner cases and when going interior <-> exterior
+		Vector3 lightmap_capture_position; // Where the target SH was last captured, objects moving less than the update distance keep it.
+		bool lightmap_capture_dirty = true; // Lightmap captures changed, capture again even if the object didn't move.
+		bool lightmap_capture_queued = false;
 
 		uint64_t last_frame_pass;
 
@@ -633,7 +653,7 @@ public:
 		HashSet<Instance *> decals;
 		HashSet<Instance *> reflection_probes;
 		HashSet<Instance *> voxel_gi_instances;
-		HashSet<Instance *> lightmap_captures;
+		HashMap<Instance *, int32_t> lightmap_captures; // Last tetrahedron the instance was found in, for each lightmap.
 
 		InstanceGeometryData() {
 			can_cast_shadows = true;
@@ -651,6 +671,11 @@ public:
 
 		int render_step;
 
+		// Time-sliced updates.
+		float camera_distance = 0.0;
+		uint64_t lighting_version = 0;
+		uint64_t last_update_frame = 0;
+
 		InstanceReflectionProbeData() :
 				update_list(this) {
 			render_step = -1;
@@ -671,8 +696,13 @@ public:
 
 	struct InstanceParticlesCollisionData : public InstanceBaseData {
 		RID instance;
+		// Areas where geometry moved, appeared or disappeared since the heightfield was last rendered.
+		LocalVector<AABB> heightfield_changed_areas;
 	};
 
+	static const uint32_t HEIGHTFIELD_MAX_CHANGED_AREAS = 16;
+	void _particles_collision_heightfield_mark_changed(Instance *p_collision, const AABB &p_aabb);
+
 	struct InstanceFogVolumeData : public InstanceBaseData {
 		RID instance;
 		bool is_global;
@@ -748,6 +778,11 @@ public:
 		// or closely culled to the camera frustum.
 		bool is_shadow_update_full() const { return shadow_dirty_count == 0; }
 
+		// The last update of a dirty light renders the casters outside the camera frustum, which
+		// the previous (tightly culled) update skipped. It only matters once the camera moves, so it
+		// can wait for a later frame.
+		bool is_shadow_update_deferrable() const { return shadow_dirty_count == 1 && !light_intersects_multiple_cameras; }
+
 		InstanceLightData() {
 			bake_mode = RS::LIGHT_BAKE_DISABLED;
 			D = nullptr;
@@ -879,7 +914,6 @@ public:
 	PagedArrayPool<RID> rid_cull_page_pool;
 
 	PagedArray<Instance *> instance_cull_result;
-	PagedArray<Instance *> instance_shadow_cull_result;
 
 	struct InstanceCullResult {
 		PagedArray<RenderGeometryInstance *> geometry_instances;
@@ -1007,11 +1041,39 @@ public:
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
+	// One per positional light shadow pass (render_shadow_data entry) that must be culled this frame.
+	struct ShadowCullPass {
+		Instance *light = nullptr;
+		int32_t light_culler_id = -1;
+		bool tighter_culling = false;
+		uint32_t shadow_index = 0;
+		Vector<Plane> planes;
+
+		PagedArray<Instance *> cull_result;
+		LocalVector<RID> mesh_instances;
+		bool animated_material_found = false;
+	};
+
+	ShadowCullPass shadow_cull_passes[MAX_UPDATE_SHADOWS];
+	uint32_t shadow_cull_pass_count = 0;
+
+	// Budget for deferrable (full) positional shadow updates, shared by all viewports drawn in a frame.
+	uint32_t shadow_full_updates_per_frame = 0;
+	uint32_t shadow_full_updates_used = 0;
+	uint64_t shadow_full_updates_frame = UINT64_MAX;
+
+	// Budget of render and filter steps shared by all time-sliced reflection probes each frame.
+	uint32_t reflection_probe_time_sliced_steps = 4;
+	uint64_t reflection_probe_frame = 0;
+
 	RendererSceneRender::RenderHDDAGIData render_hddagi_data[HDDAGI_MAX_CASCADES * HDDAGI_MAX_REGIONS_PER_CASCADE];
 	RendererSceneRender::RenderHDDAGIUpdateData hddagi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
 
+	LocalVector<Instance *> lightmap_capture_update_list;
+	float lightmap_capture_update_distance_squared = 0.0;
+
 	RID_Owner<Instance, true> instance_owner;
 
 	uint32_t geometry_instance_pair_mask = 0; // used in traditional forward, unnecessary on clustered
@@ -1027,6 +1089,8 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1043,6 +1107,10 @@ public:
 
 	virtual void instance_set_ignore_culling(RID p_instance, bool p_enabled);
 
+	virtual void instances_set_transform(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
+	virtual void instances_set_visible(const Vector<RID> &p_instances, bool p_visible);
+	virtual Vector<AABB> instances_get_aabb(const Vector<RID> &p_instances) const;
+
 	bool _update_instance_visibility_depth(Instance *p_instance);
 	void _update_instance_visibility_dependencies(Instance *p_instance);
 
@@ -1067,16 +1135,26 @@ public:
 	virtual void instance_geometry_get_shader_parameter_list(RID p_instance, List<PropertyInfo> *p_parameters) const;
 	virtual Variant instance_geometry_get_shader_parameter(RID p_instance, const StringName &p_parameter) const;
 	virtual Variant instance_geometry_get_shader_parameter_default_value(RID p_instance, const StringName &p_parameter) const;
+	virtual void instances_geometry_set_shader_parameter(const Vector<RID> &p_instances, const StringName &p_parameter, const Vector<Variant> &p_values);
 
 	_FORCE_INLINE_ void _update_instance(Instance *p_instance);
 	_FORCE_INLINE_ void _update_instance_aabb(Instance *p_instance);
 	_FORCE_INLINE_ void _update_dirty_instance(Instance *p_instance);
 	_FORCE_INLINE_ void _update_instance_lightmap_captures(Instance *p_instance);
+	void _update_instance_lightmap_captures_threaded(uint32_t p_index, Instance **p_instances);
+	void _update_dirty_lightmap_captures();
 	void _unpair_instance(Instance *p_instance);
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
-	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
+	struct ShadowCullData {
+		Scenario *scenario = nullptr;
+		uint32_t visible_layers = 0xFFFFFF;
+	};
+
+	bool _light_instance_setup_shadow(Instance *p_instance, int32_t p_light_culler_id);
+	void _light_instance_cull_shadow_pass(uint32_t p_pass, ShadowCullData *p_cull_data);
+	void _light_instances_update_shadows(Scenario *p_scenario, uint32_t p_visible_layers);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
 	RID _render_get_compositor(RID p_camera, RID p_scenario);
@@ -1086,6 +1164,9 @@ public:
 			RID light_instance;
 			struct Cascade {
 				Frustum frustum;
+				// Frustum extents along the light axes, used to classify instances into all cascades at once.
+				real_t cull_min[3];
+				real_t cull_max[3];
 
 				Projection projection;
 				Transform3D transform;
@@ -1098,6 +1179,7 @@ public:
 
 			} cascades[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; //max 4 cascades
 			uint32_t cascade_count;
+			Vector3 cull_axes[3]; // All cascade frustums are boxes sharing the light basis.
 
 		} shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
@@ -1141,6 +1223,9 @@ public:
 		Instance *render_reflection_probe = nullptr;
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
 		const Projection *camera_matrix;
+		// Camera the occlusion buffer is tested from, may be an earlier frame's camera.
+		Transform3D occlusion_cam_transform;
+		const Projection *occlusion_camera_matrix;
 		uint64_t visibility_viewport_mask;
 	};
 
@@ -1398,6 +1483,26 @@ public:
 
 	virtual void update_visibility_notifiers();
 
+	/* INTERPOLATION */
+
+	virtual void tick();
+	virtual void update_interpolation_frame();
+	virtual void set_physics_interpolation_enabled(bool p_enabled);
+
+	struct InterpolationData {
+		void notify_free_camera(RID p_rid, Camera &r_camera);
+		void notify_free_instance(RID p_rid, Instance &r_instance);
+
+		// Instances and cameras whose transform was set during the current physics tick.
+		LocalVector<RID> instance_transform_update_list;
+		LocalVector<RID> camera_transform_update_list;
+
+		// Instances which need a new interpolated transform each frame.
+		LocalVector<RID> instance_interpolate_update_list;
+
+		bool interpolation_enabled = false;
+	} _interpolation_data;
+
 	RendererSceneCull();
 	virtual ~RendererSceneCull();
 };
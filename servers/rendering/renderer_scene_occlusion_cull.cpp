@@ -175,6 +175,20 @@ void RendererSceneOcclusionCull::HZBuffer::update_mips() {
 	}
 }
 
+void RendererSceneOcclusionCull::DepthHZBuffer::update(const float *p_depth, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	if (sizes.is_empty()) {
+		return;
+	}
+
+	memcpy(mips[0], p_depth, sizes[0].x * sizes[0].y * sizeof(float));
+
+	cam_transform = p_cam_transform;
+	cam_projection = p_cam_projection;
+	debug_tex_range = p_cam_projection.get_z_far();
+
+	update_mips();
+}
+
 RID RendererSceneOcclusionCull::HZBuffer::get_debug_texture() {
 	if (sizes.is_empty() || sizes[0] == Size2i()) {
 		return RID();
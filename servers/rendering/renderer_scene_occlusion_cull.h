@@ -195,6 +195,19 @@ public:
 		virtual ~HZBuffer(){};
 	};
 
+	// Built from the depth buffer of an earlier frame instead of from occluders.
+	// Instances must be tested from the camera that rendered that depth.
+	class DepthHZBuffer : public HZBuffer {
+		Transform3D cam_transform;
+		Projection cam_projection;
+
+	public:
+		void update(const float *p_depth, const Transform3D &p_cam_transform, const Projection &p_cam_projection);
+
+		const Transform3D &get_cam_transform() const { return cam_transform; }
+		const Projection &get_cam_projection() const { return cam_projection; }
+	};
+
 	static RendererSceneOcclusionCull *get_singleton() { return singleton; }
 
 	void _print_warning() {
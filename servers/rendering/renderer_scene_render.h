@@ -32,8 +32,10 @@
 #define RENDERER_SCENE_RENDER_H
 
 #include "core/math/projection.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/paged_array.h"
 #include "servers/rendering/renderer_geometry_instance.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
 #include "servers/rendering/rendering_method.h"
 #include "servers/rendering/storage/compositor_storage.h"
 #include "servers/rendering/storage/environment_storage.h"
@@ -320,13 +322,26 @@ public:
 	virtual void render_scene(const Ref<RenderSceneBuffers> &p_render_buffers, const CameraData *p_camera_data, const CameraData *p_prev_camera_data, const PagedArray<RenderGeometryInstance *> &p_instances, const PagedArray<RID> &p_lights, const PagedArray<RID> &p_reflection_probes, const PagedArray<RID> &p_voxel_gi_instances, const PagedArray<RID> &p_decals, const PagedArray<RID> &p_lightmaps, const PagedArray<RID> &p_fog_volumes, RID p_environment, RID p_camera_attributes, RID p_compositor, RID p_shadow_atlas, RID p_occluder_debug_tex, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, const RenderShadowData *p_render_shadows, int p_render_shadow_count, const RenderHDDAGIData *p_render_hddagi_regions, int p_render_hddagi_region_count, const RenderHDDAGIUpdateData *p_hddagi_update_data = nullptr, RenderingMethod::RenderInfo *r_render_info = nullptr) = 0;
 
 	virtual void render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) = 0;
-	virtual void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) = 0;
+
+	struct ParticleColliderHeightfieldArea {
+		Rect2i rect; // In texels, empty for the whole heightfield.
+		AABB aabb; // World space bounds, used to cull the geometry rendered into the area.
+	};
+
+	// Reuses what is still valid in the heightfield and returns the areas that need to be rendered again.
+	// Renderers that can't update heightfields partially always render all of it.
+	virtual void particle_collider_heightfield_begin_update(RID p_collider, const Transform3D &p_transform, const LocalVector<AABB> &p_changed_areas, LocalVector<ParticleColliderHeightfieldArea> &r_areas) {
+		r_areas.push_back(ParticleColliderHeightfieldArea());
+	}
+	virtual void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_area) = 0;
 
 	virtual void set_scene_pass(uint64_t p_pass) = 0;
 	virtual void set_time(double p_time, double p_step) = 0;
 	virtual void set_debug_draw_mode(RS::ViewportDebugDraw p_debug_draw) = 0;
 
 	virtual Ref<RenderSceneBuffers> render_buffers_create() = 0;
+	// Occlusion buffer built by the renderer from an earlier frame's depth, used when a viewport has no occluders.
+	virtual const RendererSceneOcclusionCull::DepthHZBuffer *render_buffers_get_depth_occlusion_buffer(const Ref<RenderSceneBuffers> &p_render_buffers) const { return nullptr; }
 	virtual void gi_set_use_half_resolution(bool p_enable) = 0;
 
 	virtual void screen_space_roughness_limiter_set_active(bool p_enable, float p_amount, float p_limit) = 0;
@@ -110,7 +110,7 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 			p_viewport->render_buffers.unref();
 		} else {
 			const float EPSILON = 0.0001;
-			float scaling_3d_scale = p_viewport->scaling_3d_scale;
+			float scaling_3d_scale = p_viewport->scaling_3d_dynamic ? p_viewport->scaling_3d_dynamic_scale : p_viewport->scaling_3d_scale;
 			RS::ViewportScaling3DMode scaling_3d_mode = p_viewport->scaling_3d_mode;
 			bool upscaler_available = p_viewport->fsr_enabled;
 
@@ -251,6 +251,50 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 #endif // _3D_DISABLED
 }
 
+void RendererViewport::_update_scaling_3d_dynamic(Viewport *p_viewport) {
+	if (!p_viewport->scaling_3d_dynamic_sample_pending) {
+		return;
+	}
+	p_viewport->scaling_3d_dynamic_sample_pending = false;
+
+	if (p_viewport->time_gpu_3d_end <= p_viewport->time_gpu_3d_begin) {
+		return;
+	}
+
+	float gpu_time = double((p_viewport->time_gpu_3d_end - p_viewport->time_gpu_3d_begin) / 1000) / 1000.0;
+	if (p_viewport->scaling_3d_dynamic_gpu_time <= 0.0) {
+		p_viewport->scaling_3d_dynamic_gpu_time = gpu_time;
+	} else {
+		// Smooth out spikes, a single slow frame should not trigger a resize.
+		p_viewport->scaling_3d_dynamic_gpu_time = Math::lerp(p_viewport->scaling_3d_dynamic_gpu_time, gpu_time, 0.1f);
+	}
+
+	// Timestamps arrive a few frames late, give the last change time to show up in the measurements.
+	if (draw_viewports_pass - p_viewport->scaling_3d_dynamic_last_change < SCALING_3D_DYNAMIC_SETTLE_PASSES) {
+		return;
+	}
+
+	// The cost of the 3D pass is roughly proportional to the pixel count, so the scale follows the square root.
+	float current_scale = p_viewport->scaling_3d_dynamic_scale;
+	float new_scale = current_scale * Math::sqrt(p_viewport->scaling_3d_dynamic_target_time / p_viewport->scaling_3d_dynamic_gpu_time);
+	new_scale = Math::snapped(new_scale, SCALING_3D_DYNAMIC_STEP);
+	new_scale = CLAMP(new_scale, p_viewport->scaling_3d_dynamic_min_scale, p_viewport->scaling_3d_dynamic_max_scale);
+
+	if (new_scale > current_scale && p_viewport->scaling_3d_dynamic_gpu_time > p_viewport->scaling_3d_dynamic_target_time * 0.85) {
+		// Only scale back up with some headroom, otherwise the scale would oscillate around the target.
+		return;
+	}
+
+	if (Math::is_equal_approx(new_scale, current_scale)) {
+		return;
+	}
+
+	p_viewport->scaling_3d_dynamic_scale = new_scale;
+	p_viewport->scaling_3d_dynamic_gpu_time = 0.0;
+	p_viewport->scaling_3d_dynamic_last_change = draw_viewports_pass;
+	_configure_3d_render_buffers(p_viewport);
+}
+
 void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 	if (p_viewport->measure_render_time) {
 		String rt_id = "vp_begin_" + itos(p_viewport->self.get_id());
@@ -291,6 +335,10 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 
 	bool can_draw_3d = RSG::scene->is_camera(p_viewport->camera) && !p_viewport->disable_3d;
 
+	if (can_draw_3d && p_viewport->scaling_3d_dynamic) {
+		_update_scaling_3d_dynamic(p_viewport);
+	}
+
 	if ((scenario_draw_canvas_bg || can_draw_3d) && !p_viewport->render_buffers.is_valid()) {
 		//wants to draw 3D but there is no render buffer, create
 		p_viewport->render_buffers = RSG::scene->render_buffers_create();
@@ -639,7 +687,19 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			if (!can_draw_3d) {
 				RSG::scene->render_empty_scene(p_viewport->render_buffers, p_viewport->scenario, p_viewport->shadow_atlas);
 			} else {
+				if (p_viewport->scaling_3d_dynamic) {
+					String rt_id = "vp_3d_begin_" + itos(p_viewport->self.get_id());
+					RSG::utilities->capture_timestamp(rt_id);
+					timestamp_vp_map[rt_id] = p_viewport->self;
+				}
+
 				_draw_3d(p_viewport);
+
+				if (p_viewport->scaling_3d_dynamic) {
+					String rt_id = "vp_3d_end_" + itos(p_viewport->self.get_id());
+					RSG::utilities->capture_timestamp(rt_id);
+					timestamp_vp_map[rt_id] = p_viewport->self;
+				}
 			}
 		}
 	}
@@ -661,6 +721,39 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 	}
 }
 
+void RendererViewport::_admit_budget_viewports() {
+	// Budgeted viewports take turns: the ones that went the longest without being drawn go first,
+	// and are admitted until their last measured cost no longer fits in the budget.
+	LocalVector<Viewport *> candidates;
+	for (Viewport *vp : sorted_active_viewports) {
+		if (vp->update_mode == RS::VIEWPORT_UPDATE_BUDGET && vp->render_target.is_valid() && RSG::texture_storage->render_target_was_used(vp->render_target)) {
+			candidates.push_back(vp);
+		}
+	}
+
+	if (candidates.is_empty()) {
+		return;
+	}
+
+	struct StalestFirst {
+		_FORCE_INLINE_ bool operator()(const Viewport *p_a, const Viewport *p_b) const {
+			return p_a->budget_last_drawn_pass < p_b->budget_last_drawn_pass;
+		}
+	};
+	candidates.sort_custom<StalestFirst>();
+
+	uint64_t spent = 0;
+	for (uint32_t i = 0; i < candidates.size(); i++) {
+		Viewport *vp = candidates[i];
+		if (i > 0 && spent + vp->budget_cost_usec > update_budget_usec) {
+			// Always admit at least one, so every budgeted viewport is eventually drawn.
+			break;
+		}
+		spent += vp->budget_cost_usec;
+		vp->budget_admitted_pass = draw_viewports_pass;
+	}
+}
+
 void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	timestamp_vp_map.clear();
 
@@ -693,6 +786,8 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	//determine what is visible
 	draw_viewports_pass++;
 
+	_admit_budget_viewports();
+
 	for (int i = sorted_active_viewports.size() - 1; i >= 0; i--) { //to compute parent dependency, must go in reverse draw order
 
 		Viewport *vp = sorted_active_viewports[i];
@@ -733,6 +828,10 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 				visible = true;
 			}
 
+			if (vp->update_mode == RS::VIEWPORT_UPDATE_BUDGET && vp->budget_admitted_pass == draw_viewports_pass) {
+				visible = true;
+			}
+
 			if (vp->update_mode == RS::VIEWPORT_UPDATE_WHEN_PARENT_VISIBLE) {
 				Viewport *parent = viewport_owner.get_or_null(vp->parent);
 				if (parent && parent->last_pass == draw_viewports_pass) {
@@ -805,7 +904,16 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 			RSG::scene->set_debug_draw_mode(vp->debug_draw);
 
 			// render standard mono camera
-			_draw_viewport(vp);
+			if (vp->update_mode == RS::VIEWPORT_UPDATE_BUDGET) {
+				uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+				_draw_viewport(vp);
+				uint64_t cost_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+				// Smooth the cost so a single slow frame doesn't starve the viewport for long.
+				vp->budget_cost_usec = vp->budget_last_drawn_pass == 0 ? cost_usec : (vp->budget_cost_usec * 3 + cost_usec) / 4;
+				vp->budget_last_drawn_pass = draw_viewports_pass;
+			} else {
+				_draw_viewport(vp);
+			}
 
 			if (vp->viewport_to_screen != DisplayServer::INVALID_WINDOW_ID && (!vp->viewport_render_direct_to_screen || !RSG::rasterizer->is_low_end())) {
 				//copy to screen if set as such
@@ -948,6 +1056,36 @@ void RendererViewport::viewport_set_scaling_3d_scale(RID p_viewport, float p_sca
 	_configure_3d_render_buffers(viewport);
 }
 
+void RendererViewport::viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled, float p_min_scale, float p_max_scale, float p_target_time_msec) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+	ERR_FAIL_COND_MSG(p_target_time_msec <= 0.0, "Dynamic 3D scaling target time must be greater than 0.");
+
+	viewport->scaling_3d_dynamic_min_scale = CLAMP(p_min_scale, 0.1, 2.0);
+	viewport->scaling_3d_dynamic_max_scale = CLAMP(p_max_scale, viewport->scaling_3d_dynamic_min_scale, 2.0);
+	viewport->scaling_3d_dynamic_target_time = p_target_time_msec;
+
+	float scale = CLAMP(viewport->scaling_3d_dynamic ? viewport->scaling_3d_dynamic_scale : viewport->scaling_3d_scale, viewport->scaling_3d_dynamic_min_scale, viewport->scaling_3d_dynamic_max_scale);
+	if (viewport->scaling_3d_dynamic == p_enabled && (!p_enabled || scale == viewport->scaling_3d_dynamic_scale)) {
+		return;
+	}
+
+	// Start from the static scale (or the current one if already enabled), the controller adjusts it from there.
+	viewport->scaling_3d_dynamic = p_enabled;
+	viewport->scaling_3d_dynamic_scale = scale;
+	viewport->scaling_3d_dynamic_gpu_time = 0.0;
+	viewport->scaling_3d_dynamic_sample_pending = false;
+	viewport->scaling_3d_dynamic_last_change = draw_viewports_pass;
+	_configure_3d_render_buffers(viewport);
+}
+
+float RendererViewport::viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL_V(viewport, 1.0);
+
+	return viewport->scaling_3d_dynamic ? viewport->scaling_3d_dynamic_scale : viewport->scaling_3d_scale;
+}
+
 void RendererViewport::viewport_set_size(RID p_viewport, int p_width, int p_height) {
 	ERR_FAIL_COND(p_width < 0 || p_height < 0);
 
@@ -1526,6 +1664,15 @@ void RendererViewport::handle_timestamp(String p_timestamp, uint64_t p_cpu_time,
 		viewport->time_cpu_end = p_cpu_time;
 		viewport->time_gpu_end = p_gpu_time;
 	}
+
+	if (p_timestamp.begins_with("vp_3d_begin")) {
+		viewport->time_gpu_3d_begin = p_gpu_time;
+	}
+
+	if (p_timestamp.begins_with("vp_3d_end")) {
+		viewport->time_gpu_3d_end = p_gpu_time;
+		viewport->scaling_3d_dynamic_sample_pending = true;
+	}
 }
 
 void RendererViewport::viewport_set_canvas_cull_mask(RID p_viewport, uint32_t p_canvas_cull_mask) {
@@ -1555,4 +1702,5 @@ int RendererViewport::get_num_viewports_with_motion_vectors() const {
 
 RendererViewport::RendererViewport() {
 	occlusion_rays_per_thread = GLOBAL_GET("rendering/occlusion_culling/occlusion_rays_per_thread");
+	update_budget_usec = uint64_t(double(GLOBAL_GET("rendering/viewport/update_budget_msec")) * 1000.0);
 }
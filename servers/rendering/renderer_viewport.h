@@ -63,11 +63,22 @@ public:
 
 		RS::ViewportScaling3DMode scaling_3d_mode = RenderingServer::VIEWPORT_SCALING_3D_MODE_BILINEAR;
 		float scaling_3d_scale = 1.0;
+		bool scaling_3d_dynamic = false;
+		float scaling_3d_dynamic_min_scale = 0.5;
+		float scaling_3d_dynamic_max_scale = 1.0;
+		float scaling_3d_dynamic_target_time = 16.0; // In milliseconds.
+		float scaling_3d_dynamic_scale = 1.0; // Scale currently used for the 3D buffers.
+		float scaling_3d_dynamic_gpu_time = 0.0; // Smoothed 3D GPU time, in milliseconds.
+		bool scaling_3d_dynamic_sample_pending = false;
+		uint64_t scaling_3d_dynamic_last_change = 0;
 		float fsr_sharpness = 0.2f;
 		float texture_mipmap_bias = 0.0f;
 		bool fsr_enabled = false;
 		uint32_t jitter_phase_count = 0;
 		RS::ViewportUpdateMode update_mode = RenderingServer::VIEWPORT_UPDATE_WHEN_VISIBLE;
+		uint64_t budget_last_drawn_pass = 0; // Only used by VIEWPORT_UPDATE_BUDGET.
+		uint64_t budget_admitted_pass = 0;
+		uint64_t budget_cost_usec = 0; // Smoothed CPU time spent drawing this viewport.
 		RID render_target;
 		RID render_target_texture;
 		Ref<RenderSceneBuffers> render_buffers;
@@ -102,6 +113,9 @@ public:
 		uint64_t time_gpu_begin;
 		uint64_t time_gpu_end;
 
+		uint64_t time_gpu_3d_begin = 0;
+		uint64_t time_gpu_3d_end = 0;
+
 		RID shadow_atlas;
 		int shadow_atlas_size = 2048;
 		bool shadow_atlas_16_bits = true;
@@ -192,6 +206,11 @@ public:
 
 	uint64_t draw_viewports_pass = 0;
 
+	// Dynamic 3D scaling moves in discrete steps and waits for a few passes after each change,
+	// so that the render buffers aren't reallocated every frame.
+	static constexpr float SCALING_3D_DYNAMIC_STEP = 0.05;
+	static constexpr uint64_t SCALING_3D_DYNAMIC_SETTLE_PASSES = 15;
+
 	mutable RID_Owner<Viewport, true> viewport_owner;
 
 	Vector<Viewport *> active_viewports;
@@ -209,10 +228,14 @@ private:
 	void _viewport_set_size(Viewport *p_viewport, int p_width, int p_height, uint32_t p_view_count);
 	bool _viewport_requires_motion_vectors(Viewport *p_viewport);
 	void _configure_3d_render_buffers(Viewport *p_viewport);
+	void _update_scaling_3d_dynamic(Viewport *p_viewport);
 	void _draw_3d(Viewport *p_viewport);
 	void _draw_viewport(Viewport *p_viewport);
 
 	int occlusion_rays_per_thread = 512;
+	uint64_t update_budget_usec = 2000;
+
+	void _admit_budget_viewports();
 
 	void _resize_occlusion_culling_buffer(const Size2i &p_size);
 
@@ -232,6 +255,8 @@ public:
 
 	void viewport_set_scaling_3d_mode(RID p_viewport, RS::ViewportScaling3DMode p_mode);
 	void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale);
+	void viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled, float p_min_scale, float p_max_scale, float p_target_time_msec);
+	float viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const;
 	void viewport_set_fsr_sharpness(RID p_viewport, float p_sharpness);
 	void viewport_set_texture_mipmap_bias(RID p_viewport, float p_mipmap_bias);
 
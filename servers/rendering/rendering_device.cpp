@@ -116,12 +116,6 @@ static uint32_t _get_device_type_score(const RenderingContextDriver::Device &p_d
 
 #define RENDER_GRAPH_FULL_BARRIERS 0
 
-// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
-// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
-// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
-
-#define SECONDARY_COMMAND_BUFFERS_PER_FRAME 0
-
 RenderingDevice *RenderingDevice::singleton = nullptr;
 
 RenderingDevice *RenderingDevice::get_singleton() {
@@ -657,6 +651,40 @@ Vector<uint8_t> RenderingDevice::buffer_get_data(RID p_buffer, uint32_t p_offset
 	return buffer_data;
 }
 
+Error RenderingDevice::buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset, uint32_t p_size) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+
+	Buffer *buffer = _get_buffer_from_owner(p_buffer);
+	if (!buffer) {
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Buffer is either invalid or this type of buffer can't be retrieved. Only Index and Vertex buffers allow retrieving.");
+	}
+
+	// Size of buffer to retrieve.
+	if (!p_size) {
+		p_size = buffer->size - p_offset;
+	}
+	ERR_FAIL_COND_V_MSG(p_size + p_offset > buffer->size, ERR_INVALID_PARAMETER,
+			"Size is larger than the buffer.");
+
+	Frame::BufferGetDataRequest request;
+	request.staging_buffer = driver->buffer_create(p_size, RDD::BUFFER_USAGE_TRANSFER_TO_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
+	ERR_FAIL_COND_V(!request.staging_buffer, ERR_CANT_CREATE);
+	request.size = p_size;
+	request.callback = p_callback;
+
+	RDD::BufferCopyRegion region;
+	region.src_offset = p_offset;
+	region.size = p_size;
+
+	draw_graph.add_buffer_get_data(buffer->driver_id, buffer->draw_tracker, request.staging_buffer, region);
+
+	frames[frame].buffer_get_data_requests.push_back(request);
+
+	return OK;
+}
+
 RID RenderingDevice::storage_buffer_create(uint32_t p_size_bytes, const Vector<uint8_t> &p_data, BitField<StorageBufferUsage> p_usage) {
 	_THREAD_SAFE_METHOD_
 
@@ -1965,6 +1993,335 @@ bool RenderingDevice::texture_is_format_supported_for_usage(DataFormat p_format,
 	return !any_unsupported;
 }
 
+/***********************/
+/**** ASYNC UPLOADS ****/
+/***********************/
+
+RenderingDevice::TransferUpload *RenderingDevice::_transfer_upload_begin(uint32_t p_staging_size, uint8_t *&r_staging_ptr) {
+	TransferUpload *upload = nullptr;
+	if (!transfer_uploads_free.is_empty()) {
+		upload = transfer_uploads_free[transfer_uploads_free.size() - 1];
+		transfer_uploads_free.resize(transfer_uploads_free.size() - 1);
+	} else {
+		upload = memnew(TransferUpload);
+		upload->command_buffer = driver->command_buffer_create(transfer_command_pool);
+		upload->semaphore = driver->semaphore_create();
+		upload->fence = driver->fence_create();
+		if (!upload->command_buffer || !upload->semaphore || !upload->fence) {
+			if (upload->semaphore) {
+				driver->semaphore_free(upload->semaphore);
+			}
+			if (upload->fence) {
+				driver->fence_free(upload->fence);
+			}
+			memdelete(upload);
+			ERR_FAIL_V_MSG(nullptr, "Unable to create the command buffer or the synchronization primitives for an async upload.");
+		}
+	}
+
+	upload->staging_buffer = driver->buffer_create(p_staging_size, RDD::BUFFER_USAGE_TRANSFER_FROM_BIT, RDD::MEMORY_ALLOCATION_TYPE_CPU);
+	if (!upload->staging_buffer) {
+		transfer_uploads_free.push_back(upload);
+		ERR_FAIL_V_MSG(nullptr, "Unable to create the staging buffer for an async upload.");
+	}
+
+	r_staging_ptr = driver->buffer_map(upload->staging_buffer);
+	if (r_staging_ptr == nullptr) {
+		driver->buffer_free(upload->staging_buffer);
+		upload->staging_buffer = RDD::BufferID();
+		transfer_uploads_free.push_back(upload);
+		ERR_FAIL_V_MSG(nullptr, "Unable to map the staging buffer for an async upload.");
+	}
+
+	upload->fence_waited = false;
+	upload->wait_frame = -1;
+
+	return upload;
+}
+
+uint64_t RenderingDevice::_transfer_upload_submit(TransferUpload *p_upload) {
+	driver->command_buffer_end(p_upload->command_buffer);
+	driver->command_queue_execute_and_present(transfer_queue, {}, p_upload->command_buffer, p_upload->semaphore, p_upload->fence, {});
+
+	p_upload->id = transfer_upload_next_id++;
+	transfer_uploads.push_back(p_upload);
+
+	return p_upload->id;
+}
+
+RenderingDevice::TransferUpload *RenderingDevice::_transfer_upload_find(uint64_t p_upload) {
+	for (TransferUpload *upload : transfer_uploads) {
+		if (upload->id == p_upload) {
+			return upload;
+		}
+	}
+
+	return nullptr;
+}
+
+void RenderingDevice::_transfer_upload_wait(TransferUpload *p_upload) {
+	if (p_upload->fence_waited) {
+		return;
+	}
+
+	driver->fence_wait(p_upload->fence);
+	p_upload->fence_waited = true;
+
+	// The staging buffer is no longer needed once the copy is done.
+	driver->buffer_free(p_upload->staging_buffer);
+	p_upload->staging_buffer = RDD::BufferID();
+}
+
+void RenderingDevice::_transfer_uploads_retire(int p_frame) {
+	// The semaphores of these uploads were waited on by a submission that has finished, so they can be reused.
+	uint32_t i = 0;
+	while (i < transfer_uploads.size()) {
+		TransferUpload *upload = transfer_uploads[i];
+		if (upload->wait_frame == p_frame) {
+			_transfer_upload_wait(upload);
+			transfer_uploads_free.push_back(upload);
+			transfer_uploads.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+}
+
+void RenderingDevice::_transfer_uploads_free() {
+	for (TransferUpload *upload : transfer_uploads) {
+		_transfer_upload_wait(upload);
+		transfer_uploads_free.push_back(upload);
+	}
+
+	transfer_uploads.clear();
+
+	for (TransferUpload *upload : transfer_uploads_free) {
+		driver->semaphore_free(upload->semaphore);
+		driver->fence_free(upload->fence);
+		memdelete(upload);
+	}
+
+	transfer_uploads_free.clear();
+}
+
+uint64_t RenderingDevice::buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data) {
+	_THREAD_SAFE_METHOD_
+
+	Buffer *buffer = _get_buffer_from_owner(p_buffer);
+	ERR_FAIL_NULL_V_MSG(buffer, 0, "Buffer argument is not a valid buffer of any type.");
+	ERR_FAIL_COND_V(p_size == 0, 0);
+	ERR_FAIL_COND_V_MSG(p_offset + p_size > buffer->size, 0,
+			"Attempted to write buffer (" + itos((p_offset + p_size) - buffer->size) + " bytes) past the end.");
+
+	uint8_t *staging_ptr = nullptr;
+	TransferUpload *upload = _transfer_upload_begin(p_size, staging_ptr);
+	ERR_FAIL_NULL_V(upload, 0);
+
+	memcpy(staging_ptr, p_data, p_size);
+	driver->buffer_unmap(upload->staging_buffer);
+
+	driver->command_buffer_begin(upload->command_buffer);
+
+	RDD::BufferCopyRegion region;
+	region.src_offset = 0;
+	region.dst_offset = p_offset;
+	region.size = p_size;
+	driver->command_copy_buffer(upload->command_buffer, upload->staging_buffer, buffer->driver_id, region);
+
+	if (transfer_queue_family != main_queue_family) {
+		RDD::BufferBarrier bb;
+		bb.buffer = buffer->driver_id;
+		bb.src_access = RDD::BARRIER_ACCESS_COPY_WRITE_BIT;
+		bb.offset = p_offset;
+		bb.size = p_size;
+		bb.src_queue_family = transfer_queue_family;
+		bb.dst_queue_family = main_queue_family;
+
+		// Release on the transfer queue.
+		driver->command_pipeline_barrier(upload->command_buffer, RDD::PIPELINE_STAGE_COPY_BIT, RDD::PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, {}, bb, {});
+
+		// Acquire on the main queue before the graph runs.
+		bb.src_access.clear();
+		bb.dst_access = RDD::BARRIER_ACCESS_MEMORY_READ_BIT;
+		draw_graph.add_buffer_queue_acquire(bb);
+	}
+
+	return _transfer_upload_submit(upload);
+}
+
+uint64_t RenderingDevice::texture_update_async(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data) {
+	_THREAD_SAFE_METHOD_
+
+	Texture *texture = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_NULL_V(texture, 0);
+
+	if (texture->owner != RID()) {
+		p_texture = texture->owner;
+		texture = texture_owner.get_or_null(texture->owner);
+		ERR_FAIL_NULL_V(texture, 0); // This is a bug.
+	}
+
+	ERR_FAIL_COND_V_MSG(texture->bound, 0,
+			"Texture can't be updated while a draw list that uses it as part of a framebuffer is being created.");
+	ERR_FAIL_COND_V_MSG(!(texture->usage_flags & TEXTURE_USAGE_CAN_UPDATE_BIT), 0,
+			"Texture requires the `RenderingDevice.TEXTURE_USAGE_CAN_UPDATE_BIT` to be set to be updatable.");
+	ERR_FAIL_COND_V(p_layer >= texture->layers, 0);
+
+	if (texture->draw_tracker != nullptr || texture->shared_fallback != nullptr) {
+		// The graph tracks the layout of this texture, so it must go through the regular path. The upload is reported as done right away.
+		Error err = _texture_update(p_texture, p_layer, p_data, false, true);
+		ERR_FAIL_COND_V(err != OK, 0);
+		return transfer_upload_next_id++;
+	}
+
+	uint32_t width, height;
+	uint32_t required_size = get_image_format_required_size(texture->format, texture->width, texture->height, texture->depth, texture->mipmaps, &width, &height);
+	ERR_FAIL_COND_V_MSG(required_size != (uint32_t)p_data.size(), 0,
+			"Required size for texture update (" + itos(required_size) + ") does not match data supplied size (" + itos(p_data.size()) + ").");
+
+	uint32_t required_align = get_compressed_image_format_block_byte_size(texture->format);
+	if (required_align == 1) {
+		required_align = get_image_format_pixel_size(texture->format);
+	}
+	required_align = STEPIFY(required_align, driver->api_trait_get(RDD::API_TRAIT_TEXTURE_TRANSFER_ALIGNMENT));
+
+	const uint32_t pitch_step = driver->api_trait_get(RDD::API_TRAIT_TEXTURE_DATA_ROW_PITCH_STEP);
+	const uint32_t pixel_size = get_image_format_pixel_size(texture->format);
+	const uint32_t pixel_rshift = get_compressed_image_format_pixel_rshift(texture->format);
+	const uint32_t block_size = get_compressed_image_format_block_byte_size(texture->format);
+	uint32_t block_w = 0, block_h = 0;
+	get_compressed_image_format_block_dimensions(texture->format, block_w, block_h);
+
+	// Unlike the staging buffer blocks, the staging buffer is sized for the whole layer, so every slice of every mipmap is copied in a single region.
+	struct SliceCopy {
+		const uint8_t *src = nullptr;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t pitch = 0;
+	};
+
+	thread_local LocalVector<SliceCopy> slice_copies;
+	thread_local LocalVector<RDD::BufferTextureCopyRegion> copy_regions;
+	slice_copies.clear();
+	copy_regions.clear();
+
+	const uint8_t *r = p_data.ptr();
+	uint32_t staging_size = 0;
+	uint32_t mipmap_offset = 0;
+	uint32_t logic_width = texture->width;
+	uint32_t logic_height = texture->height;
+
+	for (uint32_t mm_i = 0; mm_i < texture->mipmaps; mm_i++) {
+		uint32_t depth = 0;
+		uint32_t image_total = get_image_format_required_size(texture->format, texture->width, texture->height, texture->depth, mm_i + 1, &width, &height, &depth);
+		uint32_t tight_mip_size = image_total - mipmap_offset;
+
+		for (uint32_t z = 0; z < depth; z++) {
+			SliceCopy slice;
+			slice.src = r + mipmap_offset + (tight_mip_size / depth) * z;
+			slice.width = width;
+			slice.height = height;
+			slice.pitch = STEPIFY((width * pixel_size * block_w) >> pixel_rshift, pitch_step);
+			slice_copies.push_back(slice);
+
+			staging_size = STEPIFY(staging_size, required_align);
+
+			RDD::BufferTextureCopyRegion copy_region;
+			copy_region.buffer_offset = staging_size;
+			copy_region.texture_subresources.aspect = texture->read_aspect_flags;
+			copy_region.texture_subresources.mipmap = mm_i;
+			copy_region.texture_subresources.base_layer = p_layer;
+			copy_region.texture_subresources.layer_count = 1;
+			copy_region.texture_offset = Vector3i(0, 0, z);
+			copy_region.texture_region_size = Vector3i(logic_width, logic_height, 1);
+			copy_regions.push_back(copy_region);
+
+			staging_size += slice.pitch * height;
+		}
+
+		mipmap_offset = image_total;
+		logic_width = MAX(1u, logic_width >> 1);
+		logic_height = MAX(1u, logic_height >> 1);
+	}
+
+	uint8_t *staging_ptr = nullptr;
+	TransferUpload *upload = _transfer_upload_begin(staging_size, staging_ptr);
+	ERR_FAIL_NULL_V(upload, 0);
+
+	for (uint32_t i = 0; i < slice_copies.size(); i++) {
+		const SliceCopy &slice = slice_copies[i];
+		uint8_t *write_ptr = staging_ptr + copy_regions[i].buffer_offset;
+		if (block_w != 1 || block_h != 1) {
+			_copy_region(slice.src, write_ptr, 0, 0, slice.width / block_w, slice.height / block_h, slice.width / block_w, slice.pitch, block_size);
+		} else {
+			_copy_region(slice.src, write_ptr, 0, 0, slice.width, slice.height, slice.width, slice.pitch, pixel_size);
+		}
+	}
+
+	driver->buffer_unmap(upload->staging_buffer);
+
+	driver->command_buffer_begin(upload->command_buffer);
+
+	const bool honors_barriers = driver->api_trait_get(RDD::API_TRAIT_HONORS_PIPELINE_BARRIERS);
+	RDD::TextureBarrier tb;
+	tb.texture = texture->driver_id;
+	tb.subresources.aspect = texture->barrier_aspect_flags;
+	tb.subresources.mipmap_count = texture->mipmaps;
+	tb.subresources.base_layer = p_layer;
+	tb.subresources.layer_count = 1;
+
+	if (honors_barriers) {
+		// The whole layer is overwritten, so its previous contents can be discarded.
+		tb.dst_access = RDD::BARRIER_ACCESS_COPY_WRITE_BIT;
+		tb.prev_layout = RDD::TEXTURE_LAYOUT_UNDEFINED;
+		tb.next_layout = RDD::TEXTURE_LAYOUT_COPY_DST_OPTIMAL;
+		driver->command_pipeline_barrier(upload->command_buffer, RDD::PIPELINE_STAGE_TOP_OF_PIPE_BIT, RDD::PIPELINE_STAGE_COPY_BIT, {}, {}, tb);
+	}
+
+	driver->command_copy_buffer_to_texture(upload->command_buffer, upload->staging_buffer, texture->driver_id, RDD::TEXTURE_LAYOUT_COPY_DST_OPTIMAL, copy_regions);
+
+	if (honors_barriers) {
+		// Untracked textures are expected to be in the sampling state. If the transfer queue is from another family, this also releases ownership.
+		tb.src_access = RDD::BARRIER_ACCESS_COPY_WRITE_BIT;
+		tb.dst_access.clear();
+		tb.prev_layout = RDD::TEXTURE_LAYOUT_COPY_DST_OPTIMAL;
+		tb.next_layout = RDD::TEXTURE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		tb.src_queue_family = transfer_queue_family;
+		tb.dst_queue_family = main_queue_family;
+		driver->command_pipeline_barrier(upload->command_buffer, RDD::PIPELINE_STAGE_COPY_BIT, RDD::PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, {}, {}, tb);
+
+		if (transfer_queue_family != main_queue_family) {
+			// The acquire must repeat the same layout transition.
+			tb.src_access.clear();
+			tb.dst_access = RDD::BARRIER_ACCESS_SHADER_READ_BIT;
+			draw_graph.add_texture_queue_acquire(tb);
+		}
+	}
+
+	return _transfer_upload_submit(upload);
+}
+
+bool RenderingDevice::upload_is_done(uint64_t p_upload) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V(p_upload == 0 || p_upload >= transfer_upload_next_id, false);
+
+	// Uploads are no longer tracked once the frame that waited on them has finished.
+	TransferUpload *upload = _transfer_upload_find(p_upload);
+	return upload == nullptr || upload->fence_waited;
+}
+
+void RenderingDevice::upload_wait(uint64_t p_upload) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND(p_upload == 0 || p_upload >= transfer_upload_next_id);
+
+	TransferUpload *upload = _transfer_upload_find(p_upload);
+	if (upload != nullptr) {
+		_transfer_upload_wait(upload);
+	}
+}
+
 /*********************/
 /**** FRAMEBUFFER ****/
 /*********************/
@@ -3374,9 +3731,19 @@ RID RenderingDevice::render_pipeline_create(RID p_shader, FramebufferFormatID p_
 		}
 	}
 
+	// When the driver allows it, release the device lock while the pipeline is compiled, so that
+	// compiling from a background thread does not stall the rest of the device.
+	const bool compile_unlocked = driver->api_trait_get(RDD::API_TRAIT_CONCURRENT_PIPELINE_CREATION);
+	const RDD::ShaderID shader_driver_id = shader->driver_id;
+	const RDD::RenderPassID render_pass = fb_format.render_pass;
+	if (compile_unlocked) {
+		render_pipelines_compiling.increment();
+		_THREAD_SAFE_UNLOCK_
+	}
+
 	RenderPipeline pipeline;
 	pipeline.driver_id = driver->render_pipeline_create(
-			shader->driver_id,
+			shader_driver_id,
 			driver_vertex_format,
 			p_render_primitive,
 			p_rasterization_state,
@@ -3385,9 +3752,23 @@ RID RenderingDevice::render_pipeline_create(RID p_shader, FramebufferFormatID p_
 			p_blend_state,
 			pass.color_attachments,
 			p_dynamic_state_flags,
-			fb_format.render_pass,
+			render_pass,
 			p_for_render_pass,
 			p_specialization_constants);
+
+	if (compile_unlocked) {
+		_THREAD_SAFE_LOCK_
+		render_pipelines_compiling.decrement();
+
+		// The shader may have been freed while the lock was released.
+		shader = shader_owner.get_or_null(p_shader);
+		if (shader == nullptr || shader->driver_id != shader_driver_id) {
+			if (pipeline.driver_id) {
+				driver->pipeline_free(pipeline.driver_id);
+			}
+			ERR_FAIL_V_MSG(RID(), "Shader was freed while a render pipeline was being created for it.");
+		}
+	}
 	ERR_FAIL_COND_V(!pipeline.driver_id, RID());
 
 	if (pipeline_cache_enabled) {
@@ -4246,6 +4627,113 @@ void RenderingDevice::draw_list_draw(DrawListID p_list, bool p_use_indices, uint
 	dl->state.draw_count++;
 }
 
+void RenderingDevice::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_NULL(dl);
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_NULL(buffer);
+
+	ERR_FAIL_COND_MSG(!buffer->usage.has_flag(RDD::BUFFER_USAGE_INDIRECT_BIT), "Buffer provided was not created to do indirect draws.");
+
+	// Each indexed indirect command holds five uint32 values, non-indexed ones hold four.
+	const uint32_t command_size = p_use_indices ? 20 : 16;
+	const uint32_t stride = p_stride > 0 ? p_stride : command_size;
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "Indirect draw count is zero.");
+	ERR_FAIL_COND_MSG(p_stride > 0 && p_stride < command_size, "Stride (" + itos(p_stride) + ") is smaller than the size of an indirect draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG(p_offset + (uint64_t)stride * (p_draw_count - 1) + command_size > buffer->size, "Offset and draw count provided go past the end of buffer.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		// Pipeline uses vertices, validate format.
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		// Make sure format is right.
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		// Using push constants, check that they were supplied.
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_count,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			// Nothing expected by this pipeline.
+			continue;
+		}
+
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline.");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+	}
+#endif
+
+	// Prepare descriptor sets if the API doesn't use pipeline barriers.
+	if (!driver->api_trait_get(RDD::API_TRAIT_HONORS_PIPELINE_BARRIERS)) {
+		for (uint32_t i = 0; i < dl->state.set_count; i++) {
+			if (dl->state.sets[i].pipeline_expected_format == 0) {
+				// Nothing expected by this pipeline.
+				continue;
+			}
+
+			draw_graph.add_draw_list_uniform_set_prepare_for_use(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+		}
+	}
+
+	// Bind descriptor sets.
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			draw_graph.add_draw_list_bind_uniform_set(dl->state.pipeline_shader_driver_id, dl->state.sets[i].uniform_set_driver_id, i);
+
+			UniformSet *uniform_set = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+			_uniform_set_update_shared(uniform_set);
+
+			draw_graph.add_draw_list_usages(uniform_set->draw_trackers, uniform_set->draw_trackers_usage);
+
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	if (p_use_indices) {
+		draw_graph.add_draw_list_draw_indexed_indirect(buffer->driver_id, p_offset, p_draw_count, stride);
+	} else {
+		draw_graph.add_draw_list_draw_indirect(buffer->driver_id, p_offset, p_draw_count, stride);
+	}
+
+	if (buffer->draw_tracker != nullptr) {
+		draw_graph.add_draw_list_usage(buffer->draw_tracker, RDG::RESOURCE_USAGE_INDIRECT_BUFFER_READ);
+	}
+
+	dl->state.draw_count++;
+}
+
 void RenderingDevice::draw_list_dispatch_mesh(DrawListID p_list, uint32_t p_x_groups, uint32_t p_y_groups, uint32_t p_z_groups) {
 #ifdef DEBUG_ENABLED
 	ERR_FAIL_COND_MSG(!has_feature(SUPPORTS_MESH_SHADER),
@@ -5290,9 +5778,36 @@ void RenderingDevice::swap_buffers() {
 	_end_frame();
 	_execute_frame(true);
 
+	if (wait_for_present) {
+		_wait_for_present();
+	}
+
 	// Advance to the next frame and begin recording again.
 	frame = (frame + 1) % frames.size();
 	_begin_frame();
+	frames[frame].begin_usec = OS::get_singleton()->get_ticks_usec();
+}
+
+void RenderingDevice::_wait_for_present() {
+	HashMap<DisplayServer::WindowID, RDD::SwapChainID>::ConstIterator it = screen_swap_chains.find(DisplayServer::MAIN_WINDOW_ID);
+	if (it == screen_swap_chains.end()) {
+		return;
+	}
+
+	// Blocking here until the previous frame is displayed keeps a single frame queued ahead of the display, so the
+	// next frame starts (and samples input) just after the one before it was shown instead of several frames early.
+	const uint64_t timeout_usec = 100000;
+	Error err = driver->swap_chain_wait_for_present(it->value, timeout_usec);
+	if (err == ERR_UNAVAILABLE) {
+		// Don't try again, the driver has no way of tracking presentation.
+		wait_for_present = false;
+		return;
+	}
+
+	const Frame &previous_frame = frames[(frame + frames.size() - 1) % frames.size()];
+	if (err == OK && previous_frame.begin_usec != 0) {
+		present_latency_usec = OS::get_singleton()->get_ticks_usec() - previous_frame.begin_usec;
+	}
 }
 
 void RenderingDevice::submit() {
@@ -5334,8 +5849,8 @@ void RenderingDevice::_free_pending_resources(int p_frame) {
 		frames[p_frame].uniform_sets_to_dispose_of.pop_front();
 	}
 
-	// Shaders.
-	while (frames[p_frame].shaders_to_dispose_of.front()) {
+	// Shaders (kept around while render pipelines are being compiled, as they may be using them).
+	while (render_pipelines_compiling.get() == 0 && frames[p_frame].shaders_to_dispose_of.front()) {
 		Shader *shader = &frames[p_frame].shaders_to_dispose_of.front()->get();
 
 		driver->shader_free(shader->driver_id);
@@ -5394,6 +5909,10 @@ uint32_t RenderingDevice::get_frame_delay() const {
 	return frames.size();
 }
 
+double RenderingDevice::get_present_latency() const {
+	return present_latency_usec / 1000.0;
+}
+
 uint64_t RenderingDevice::get_memory_usage(MemoryType p_type) const {
 	switch (p_type) {
 		case MEMORY_BUFFERS: {
@@ -5412,6 +5931,35 @@ uint64_t RenderingDevice::get_memory_usage(MemoryType p_type) const {
 	}
 }
 
+uint64_t RenderingDevice::get_resource_memory_usage(RID p_id) {
+	_THREAD_SAFE_METHOD_
+
+	if (texture_owner.owns(p_id)) {
+		Texture *texture = texture_owner.get_or_null(p_id);
+		uint64_t size = 0;
+		if (texture->owner.is_null()) {
+			size += driver->texture_get_allocation_size(texture->driver_id);
+		}
+		// Shared textures alias the memory of their owner, except for the fallback they may need.
+		if (texture->shared_fallback != nullptr) {
+			if (texture->shared_fallback->texture.id != 0) {
+				size += driver->texture_get_allocation_size(texture->shared_fallback->texture);
+			}
+			if (texture->shared_fallback->buffer.id != 0) {
+				size += driver->buffer_get_allocation_size(texture->shared_fallback->buffer);
+			}
+		}
+		return size;
+	}
+
+	Buffer *buffer = _get_buffer_from_owner(p_id);
+	if (buffer != nullptr) {
+		return buffer->size;
+	}
+
+	return 0;
+}
+
 void RenderingDevice::_begin_frame() {
 	// Before beginning this frame, wait on the fence if it was signaled to make sure its work is finished.
 	if (frames[frame].draw_fence_signaled) {
@@ -5419,6 +5967,9 @@ void RenderingDevice::_begin_frame() {
 		frames[frame].draw_fence_signaled = false;
 	}
 
+	// Async uploads waited on by the frame are done as well.
+	_transfer_uploads_retire(frame);
+
 	// Begin recording on the frame's command buffers.
 	driver->begin_segment(frame, frames_drawn++);
 	driver->command_buffer_begin(frames[frame].setup_command_buffer);
@@ -5446,6 +5997,36 @@ void RenderingDevice::_begin_frame() {
 	frames[frame].timestamp_result_count = frames[frame].timestamp_count;
 	frames[frame].timestamp_count = 0;
 	frames[frame].index = Engine::get_singleton()->get_frames_drawn();
+
+	// Done last, so callbacks can record commands into the new frame.
+	_process_buffer_get_data_requests(frame);
+}
+
+void RenderingDevice::_process_buffer_get_data_requests(int p_frame) {
+	if (frames[p_frame].buffer_get_data_requests.is_empty()) {
+		return;
+	}
+
+	// Callbacks may request new downloads, which go to the same frame.
+	LocalVector<Frame::BufferGetDataRequest> requests;
+	SWAP(requests, frames[p_frame].buffer_get_data_requests);
+
+	for (const Frame::BufferGetDataRequest &request : requests) {
+		uint8_t *buffer_mem = driver->buffer_map(request.staging_buffer);
+		if (buffer_mem) {
+			Vector<uint8_t> buffer_data;
+			buffer_data.resize(request.size);
+			memcpy(buffer_data.ptrw(), buffer_mem, request.size);
+			driver->buffer_unmap(request.staging_buffer);
+
+			// The object owning the callback may have been freed while the frame was in flight.
+			if (request.callback.is_valid()) {
+				request.callback.call(buffer_data);
+			}
+		}
+
+		driver->buffer_free(request.staging_buffer);
+	}
 }
 
 void RenderingDevice::_end_frame() {
@@ -5459,6 +6040,13 @@ void RenderingDevice::_end_frame() {
 
 	driver->command_buffer_end(frames[frame].setup_command_buffer);
 
+	// Async uploads submitted so far will be waited on by this frame. The graph acquires their resources if the transfer queue is from another family.
+	for (TransferUpload *upload : transfer_uploads) {
+		if (upload->wait_frame < 0) {
+			upload->wait_frame = frame;
+		}
+	}
+
 	// The command buffer must be copied into a stack variable as the driver workarounds can change the command buffer in use.
 	RDD::CommandBufferID command_buffer = frames[frame].draw_command_buffer;
 	draw_graph.end(RENDER_GRAPH_REORDER, RENDER_GRAPH_FULL_BARRIERS, command_buffer, frames[frame].command_buffer_pool);
@@ -5473,8 +6061,16 @@ void RenderingDevice::_execute_frame(bool p_present) {
 	thread_local LocalVector<RDD::SwapChainID> swap_chains;
 	swap_chains.clear();
 
-	// Execute the setup command buffer.
-	driver->command_queue_execute_and_present(main_queue, {}, frames[frame].setup_command_buffer, frames[frame].setup_semaphore, {}, {});
+	// Execute the setup command buffer after any async uploads the frame depends on.
+	thread_local LocalVector<RDD::SemaphoreID> transfer_semaphores;
+	transfer_semaphores.clear();
+	for (const TransferUpload *upload : transfer_uploads) {
+		if (upload->wait_frame == frame) {
+			transfer_semaphores.push_back(upload->semaphore);
+		}
+	}
+
+	driver->command_queue_execute_and_present(main_queue, transfer_semaphores, frames[frame].setup_command_buffer, frames[frame].setup_semaphore, {}, {});
 
 	// Execute command buffers and use semaphores to wait on the execution of the previous one. Normally there's only one command buffer,
 	// but driver workarounds can force situations where there'll be more.
@@ -5641,6 +6237,8 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	main_queue = driver->command_queue_create(main_queue_family, true);
 	ERR_FAIL_COND_V(!main_queue, FAILED);
 
+	wait_for_present = main_instance && GLOBAL_GET("rendering/rendering_device/vsync/wait_for_present");
+
 	if (present_queue_family) {
 		// Create the presentation queue.
 		present_queue = driver->command_queue_create(present_queue_family);
@@ -5649,6 +6247,20 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 		present_queue = main_queue;
 	}
 
+	// Create the queue used by async uploads. A dedicated family is only picked if the driver can transfer ownership between families.
+	if (driver->api_trait_get(RDD::API_TRAIT_DEDICATED_TRANSFER_QUEUE)) {
+		transfer_queue_family = driver->command_queue_family_get(RDD::COMMAND_QUEUE_FAMILY_TRANSFER_BIT);
+	}
+
+	if (!transfer_queue_family) {
+		transfer_queue_family = main_queue_family;
+	}
+
+	transfer_queue = driver->command_queue_create(transfer_queue_family);
+	ERR_FAIL_COND_V(!transfer_queue, FAILED);
+	transfer_command_pool = driver->command_pool_create(transfer_queue_family, RDD::COMMAND_BUFFER_TYPE_PRIMARY);
+	ERR_FAIL_COND_V(!transfer_command_pool, FAILED);
+
 	// Create data for all the frames.
 	for (uint32_t i = 0; i < frames.size(); i++) {
 		frames[i].index = 0;
@@ -5690,8 +6302,14 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->command_buffer_begin(frames[0].setup_command_buffer);
 	driver->command_buffer_begin(frames[0].draw_command_buffer);
 
+	// The command graph can automatically issue secondary command buffers and record them on background threads when they reach a
+	// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
+	// this is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
+	uint32_t secondary_command_buffers_per_frame = GLOBAL_GET("rendering/rendering_device/command_recording/secondary_command_buffers_per_frame");
+	uint32_t secondary_command_buffer_threshold = uint32_t(GLOBAL_GET("rendering/rendering_device/command_recording/secondary_command_buffer_threshold_kb")) * 1024;
+
 	// Create draw graph and start it initialized as well.
-	draw_graph.initialize(driver, device, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
+	draw_graph.initialize(driver, device, frames.size(), main_queue_family, secondary_command_buffers_per_frame, secondary_command_buffer_threshold);
 	draw_graph.begin();
 
 	for (uint32_t i = 0; i < frames.size(); i++) {
@@ -5733,7 +6351,9 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	bool project_pipeline_cache_enable = GLOBAL_GET("rendering/rendering_device/pipeline_cache/enable");
 	if (main_instance && project_pipeline_cache_enable) {
 		// Only the instance that is not a local device and is also the singleton is allowed to manage a pipeline cache.
-		pipeline_cache_file_path = vformat("user://vulkan/pipelines.%s.%s",
+		// Each driver validates its own cache format, but keep them apart so switching drivers doesn't discard them.
+		pipeline_cache_file_path = vformat("user://%s/pipelines.%s.%s",
+				driver->get_api_name().to_lower(),
 				OS::get_singleton()->get_current_rendering_method(),
 				device.name.validate_filename().replace(" ", "_").to_lower());
 		if (Engine::get_singleton()->is_editor_hint()) {
@@ -6019,6 +6639,10 @@ void RenderingDevice::finalize() {
 	for (uint32_t i = 0; i < frames.size(); i++) {
 		int f = (frame + i) % frames.size();
 		_free_pending_resources(f);
+		for (const Frame::BufferGetDataRequest &request : frames[i].buffer_get_data_requests) {
+			driver->buffer_free(request.staging_buffer);
+		}
+		frames[i].buffer_get_data_requests.clear();
 		driver->command_pool_free(frames[i].command_pool);
 		driver->timestamp_query_pool_free(frames[i].timestamp_pool);
 		driver->semaphore_free(frames[i].setup_semaphore);
@@ -6031,6 +6655,13 @@ void RenderingDevice::finalize() {
 		}
 	}
 
+	_transfer_uploads_free();
+
+	if (transfer_command_pool) {
+		driver->command_pool_free(transfer_command_pool);
+		transfer_command_pool = RDD::CommandPoolID();
+	}
+
 	if (pipeline_cache_enabled) {
 		_update_pipeline_cache(true);
 		driver->pipeline_cache_free();
@@ -6070,6 +6701,11 @@ void RenderingDevice::finalize() {
 		present_queue = RDD::CommandQueueID();
 	}
 
+	if (transfer_queue) {
+		driver->command_queue_free(transfer_queue);
+		transfer_queue = RDD::CommandQueueID();
+	}
+
 	if (main_queue) {
 		driver->command_queue_free(main_queue);
 		main_queue = RDD::CommandQueueID();
@@ -6103,6 +6739,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("texture_create_from_extension", "type", "format", "samples", "usage_flags", "image", "width", "height", "depth", "layers"), &RenderingDevice::texture_create_from_extension);
 
 	ClassDB::bind_method(D_METHOD("texture_update", "texture", "layer", "data"), &RenderingDevice::texture_update);
+	ClassDB::bind_method(D_METHOD("texture_update_async", "texture", "layer", "data"), &RenderingDevice::texture_update_async);
 	ClassDB::bind_method(D_METHOD("texture_get_data", "texture", "layer"), &RenderingDevice::texture_get_data);
 
 	ClassDB::bind_method(D_METHOD("texture_is_format_supported_for_usage", "format", "usage_flags"), &RenderingDevice::texture_is_format_supported_for_usage);
@@ -6156,8 +6793,12 @@ void RenderingDevice::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("buffer_copy", "src_buffer", "dst_buffer", "src_offset", "dst_offset", "size"), &RenderingDevice::buffer_copy);
 	ClassDB::bind_method(D_METHOD("buffer_update", "buffer", "offset", "size_bytes", "data"), &RenderingDevice::_buffer_update_bind);
+	ClassDB::bind_method(D_METHOD("buffer_update_async", "buffer", "offset", "size_bytes", "data"), &RenderingDevice::_buffer_update_async_bind);
+	ClassDB::bind_method(D_METHOD("upload_is_done", "upload"), &RenderingDevice::upload_is_done);
+	ClassDB::bind_method(D_METHOD("upload_wait", "upload"), &RenderingDevice::upload_wait);
 	ClassDB::bind_method(D_METHOD("buffer_clear", "buffer", "offset", "size_bytes"), &RenderingDevice::buffer_clear);
 	ClassDB::bind_method(D_METHOD("buffer_get_data", "buffer", "offset_bytes", "size_bytes"), &RenderingDevice::buffer_get_data, DEFVAL(0), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("buffer_get_data_async", "buffer", "callback", "offset_bytes", "size_bytes"), &RenderingDevice::buffer_get_data_async, DEFVAL(0), DEFVAL(0));
 
 	ClassDB::bind_method(D_METHOD("render_pipeline_create", "shader", "framebuffer_format", "vertex_format", "primitive", "rasterization_state", "multisample_state", "stencil_state", "color_blend_state", "dynamic_state_flags", "for_render_pass", "specialization_constants"), &RenderingDevice::_render_pipeline_create, DEFVAL(0), DEFVAL(0), DEFVAL(TypedArray<RDPipelineSpecializationConstant>()));
 	ClassDB::bind_method(D_METHOD("render_pipeline_is_valid", "render_pipeline"), &RenderingDevice::render_pipeline_is_valid);
@@ -6184,6 +6825,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("draw_list_set_push_constant", "draw_list", "buffer", "size_bytes"), &RenderingDevice::_draw_list_set_push_constant);
 
 	ClassDB::bind_method(D_METHOD("draw_list_draw", "draw_list", "use_indices", "instances", "procedural_vertex_count"), &RenderingDevice::draw_list_draw, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("draw_list_draw_indirect", "draw_list", "use_indices", "buffer", "offset", "draw_count", "stride"), &RenderingDevice::draw_list_draw_indirect, DEFVAL(0), DEFVAL(1), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("draw_list_dispatch_mesh", "draw_list", "x_groups", "y_groups", "z_groups"), &RenderingDevice::draw_list_dispatch_mesh);
 	ClassDB::bind_method(D_METHOD("draw_list_dispatch_mesh_indirect", "draw_list", "buffer", "offset"), &RenderingDevice::draw_list_dispatch_mesh_indirect);
 
@@ -6218,6 +6860,7 @@ void RenderingDevice::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_feature", "feature"), &RenderingDevice::has_feature);
 	ClassDB::bind_method(D_METHOD("limit_get", "limit"), &RenderingDevice::limit_get);
 	ClassDB::bind_method(D_METHOD("get_frame_delay"), &RenderingDevice::get_frame_delay);
+	ClassDB::bind_method(D_METHOD("get_present_latency"), &RenderingDevice::get_present_latency);
 	ClassDB::bind_method(D_METHOD("submit"), &RenderingDevice::submit);
 	ClassDB::bind_method(D_METHOD("sync"), &RenderingDevice::sync);
 
@@ -6727,6 +7370,7 @@ void RenderingDevice::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_SPECIALIZATION_CONSTANT_TYPE_FLOAT);
 
 	BIND_ENUM_CONSTANT(SUPPORTS_MESH_SHADER);
+	BIND_ENUM_CONSTANT(SUPPORTS_MULTI_DRAW_INDIRECT);
 
 	BIND_ENUM_CONSTANT(LIMIT_MAX_BOUND_UNIFORM_SETS);
 	BIND_ENUM_CONSTANT(LIMIT_MAX_FRAMEBUFFER_COLOR_ATTACHMENTS);
@@ -6982,6 +7626,11 @@ Error RenderingDevice::_buffer_update_bind(RID p_buffer, uint32_t p_offset, uint
 	return buffer_update(p_buffer, p_offset, p_size, p_data.ptr());
 }
 
+uint64_t RenderingDevice::_buffer_update_async_bind(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data) {
+	ERR_FAIL_COND_V(p_size > (uint32_t)p_data.size(), 0);
+	return buffer_update_async(p_buffer, p_offset, p_size, p_data.ptr());
+}
+
 static Vector<RenderingDevice::PipelineSpecializationConstant> _get_spec_constants(const TypedArray<RDPipelineSpecializationConstant> &p_constants) {
 	Vector<RenderingDevice::PipelineSpecializationConstant> ret;
 	ret.resize(p_constants.size());
@@ -192,6 +192,7 @@ public:
 	Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data);
 	Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size);
 	Vector<uint8_t> buffer_get_data(RID p_buffer, uint32_t p_offset = 0, uint32_t p_size = 0); // This causes stall, only use to retrieve large buffers for saving.
+	Error buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset = 0, uint32_t p_size = 0); // Doesn't stall, the callback receives the data once the current frame has finished on the GPU.
 
 	/*****************/
 	/**** TEXTURE ****/
@@ -332,6 +333,50 @@ public:
 	Error texture_clear(RID p_texture, const Color &p_color, uint32_t p_base_mipmap, uint32_t p_mipmaps, uint32_t p_base_layer, uint32_t p_layers);
 	Error texture_resolve_multisample(RID p_from_texture, RID p_to_texture);
 
+	/***********************/
+	/**** ASYNC UPLOADS ****/
+	/***********************/
+
+	// Uploads that bypass both the staging buffer blocks and the draw graph.
+	// Each one owns its staging buffer and command buffer, which is submitted
+	// right away to the transfer queue: a dedicated queue family if the driver
+	// exposes one (ownership is then released there and acquired by the graph),
+	// or a second queue of the main family otherwise.
+	//
+	// Every upload signals its own fence, so it can be waited on individually,
+	// and a semaphore that the next submission of the main queue waits on. The
+	// data is therefore visible to all the work of the frame being recorded.
+	// The destination must not be in use by frames still executing on the GPU.
+
+private:
+	struct TransferUpload {
+		uint64_t id = 0;
+		RDD::CommandBufferID command_buffer;
+		RDD::SemaphoreID semaphore;
+		RDD::FenceID fence;
+		RDD::BufferID staging_buffer;
+		bool fence_waited = false;
+		// Frame whose submission waits on the semaphore, -1 until it's known.
+		int32_t wait_frame = -1;
+	};
+
+	LocalVector<TransferUpload *> transfer_uploads;
+	LocalVector<TransferUpload *> transfer_uploads_free;
+	uint64_t transfer_upload_next_id = 1;
+
+	TransferUpload *_transfer_upload_begin(uint32_t p_staging_size, uint8_t *&r_staging_ptr);
+	uint64_t _transfer_upload_submit(TransferUpload *p_upload);
+	TransferUpload *_transfer_upload_find(uint64_t p_upload);
+	void _transfer_upload_wait(TransferUpload *p_upload);
+	void _transfer_uploads_retire(int p_frame);
+	void _transfer_uploads_free();
+
+public:
+	uint64_t buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data);
+	uint64_t texture_update_async(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data);
+	bool upload_is_done(uint64_t p_upload);
+	void upload_wait(uint64_t p_upload);
+
 	/************************/
 	/**** DRAW LISTS (I) ****/
 	/************************/
@@ -1021,6 +1066,9 @@ private:
 	size_t pipeline_cache_size = 0;
 	String pipeline_cache_file_path;
 	WorkerThreadPool::TaskID pipeline_cache_save_task = WorkerThreadPool::INVALID_TASK_ID;
+	// Render pipelines currently being compiled by the driver with the device lock released.
+	// Shaders are not disposed of while this is non-zero, since those compiles still reference them.
+	SafeNumeric<uint32_t> render_pipelines_compiling;
 
 	Vector<uint8_t> _load_pipeline_cache();
 	void _update_pipeline_cache(bool p_closing = false);
@@ -1163,6 +1211,7 @@ public:
 	void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	void draw_list_dispatch_mesh(DrawListID p_list, uint32_t p_x_groups, uint32_t p_y_groups, uint32_t p_z_groups);
 	void draw_list_dispatch_mesh_indirect(DrawListID p_list, RID p_buffer, uint32_t p_offset);
@@ -1257,6 +1306,11 @@ private:
 	RDD::CommandQueueID main_queue;
 	RDD::CommandQueueID present_queue;
 
+	// Used by the async uploads. The family is the main one if the driver has no dedicated transfer queue.
+	RDD::CommandQueueFamilyID transfer_queue_family;
+	RDD::CommandQueueID transfer_queue;
+	RDD::CommandPoolID transfer_command_pool;
+
 	/**************************/
 	/**** FRAME MANAGEMENT ****/
 	/**************************/
@@ -1312,6 +1366,18 @@ private:
 		// Swap chains prepared for drawing during the frame that must be presented.
 		LocalVector<RDD::SwapChainID> swap_chains_to_present;
 
+		// When the CPU started recording the frame, used to measure the latency until it's displayed.
+		uint64_t begin_usec = 0;
+
+		// Buffers copied by buffer_get_data_async, handed to their callback once the frame's fence is signaled.
+		struct BufferGetDataRequest {
+			RDD::BufferID staging_buffer;
+			uint32_t size = 0;
+			Callable callback;
+		};
+
+		LocalVector<BufferGetDataRequest> buffer_get_data_requests;
+
 		// Extra command buffer pool used for driver workarounds.
 		RDG::CommandBufferPool command_buffer_pool;
 
@@ -1338,7 +1404,13 @@ private:
 	TightLocalVector<Frame> frames;
 	uint64_t frames_drawn = 0;
 
+	bool wait_for_present = false;
+	uint64_t present_latency_usec = 0;
+
+	void _wait_for_present();
+
 	void _free_pending_resources(int p_frame);
+	void _process_buffer_get_data_requests(int p_frame);
 
 	uint64_t texture_memory = 0;
 	uint64_t buffer_memory = 0;
@@ -1383,6 +1455,7 @@ public:
 	void swap_buffers();
 
 	uint32_t get_frame_delay() const;
+	double get_present_latency() const;
 
 	void submit();
 	void sync();
@@ -1394,6 +1467,7 @@ public:
 	};
 
 	uint64_t get_memory_usage(MemoryType p_type) const;
+	uint64_t get_resource_memory_usage(RID p_id);
 
 	RenderingDevice *create_local_device();
 
@@ -1445,6 +1519,7 @@ private:
 	RID _uniform_set_create(const TypedArray<RDUniform> &p_uniforms, RID p_shader, uint32_t p_shader_set);
 
 	Error _buffer_update_bind(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data);
+	uint64_t _buffer_update_async_bind(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data);
 
 	RID _render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const Ref<RDPipelineRasterizationState> &p_rasterization_state, const Ref<RDPipelineMultisampleState> &p_multisample_state, const Ref<RDPipelineDepthStencilState> &p_depth_stencil_state, const Ref<RDPipelineColorBlendState> &p_blend_state, BitField<PipelineDynamicStateFlags> p_dynamic_state_flags, uint32_t p_for_render_pass, const TypedArray<RDPipelineSpecializationConstant> &p_specialization_constants);
 	RID _compute_pipeline_create(RID p_shader, const TypedArray<RDPipelineSpecializationConstant> &p_specialization_constants);
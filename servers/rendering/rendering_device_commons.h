@@ -831,6 +831,8 @@ public:
 		// If not supported, a fragment shader with only side effets (i.e., writes  to buffers, but doesn't output to attachments), may be optimized down to no-op by the GPU driver.
 		SUPPORTS_FRAGMENT_SHADER_WITH_ONLY_SIDE_EFFECTS,
 		SUPPORTS_MESH_SHADER,
+		// Indirect draws with a draw count greater than one.
+		SUPPORTS_MULTI_DRAW_INDIRECT,
 	};
 
 	enum SubgroupOperations {
@@ -374,6 +374,10 @@ uint64_t RenderingDeviceDriver::api_trait_get(ApiTrait p_trait) {
 			return 1;
 		case API_TRAIT_CLEARS_WITH_COPY_ENGINE:
 			return true;
+		case API_TRAIT_CONCURRENT_PIPELINE_CREATION:
+			return false;
+		case API_TRAIT_DEDICATED_TRANSFER_QUEUE:
+			return false;
 		default:
 			ERR_FAIL_V(0);
 	}
@@ -365,6 +365,9 @@ public:
 		BitField<BarrierAccessBits> dst_access;
 		uint64_t offset = 0;
 		uint64_t size = 0;
+		// Only set for queue family ownership transfers. Ignored when the families are the same.
+		CommandQueueFamilyID src_queue_family;
+		CommandQueueFamilyID dst_queue_family;
 	};
 
 	struct TextureBarrier {
@@ -374,6 +377,9 @@ public:
 		TextureLayout prev_layout = TEXTURE_LAYOUT_UNDEFINED;
 		TextureLayout next_layout = TEXTURE_LAYOUT_UNDEFINED;
 		TextureSubresourceRange subresources;
+		// Only set for queue family ownership transfers. Ignored when the families are the same.
+		CommandQueueFamilyID src_queue_family;
+		CommandQueueFamilyID dst_queue_family;
 	};
 
 	virtual void command_pipeline_barrier(
@@ -461,6 +467,10 @@ public:
 	// Wait until all rendering associated to the swap chain is finished before deleting it.
 	virtual void swap_chain_free(SwapChainID p_swap_chain) = 0;
 
+	// Block until at most the most recently presented frame is still waiting to be displayed, or the timeout elapses.
+	// Returns ERR_UNAVAILABLE if the driver can't track presentation, in which case the call returns immediately.
+	virtual Error swap_chain_wait_for_present(SwapChainID p_swap_chain, uint64_t p_timeout_usec) { return ERR_UNAVAILABLE; }
+
 	/*********************/
 	/**** FRAMEBUFFER ****/
 	/*********************/
@@ -751,6 +761,8 @@ public:
 		API_TRAIT_TEXTURE_DATA_ROW_PITCH_STEP,
 		API_TRAIT_SECONDARY_VIEWPORT_SCISSOR,
 		API_TRAIT_CLEARS_WITH_COPY_ENGINE,
+		API_TRAIT_CONCURRENT_PIPELINE_CREATION,
+		API_TRAIT_DEDICATED_TRANSFER_QUEUE,
 	};
 
 	enum ShaderChangeInvalidation {
@@ -699,6 +699,16 @@ void RenderingDeviceGraph::_run_draw_list_command(RDD::CommandBufferID p_command
 				driver->command_render_draw_indexed(p_command_buffer, draw_indexed_instruction->index_count, draw_indexed_instruction->instance_count, draw_indexed_instruction->first_index, 0, 0);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				driver->command_render_draw_indirect(p_command_buffer, draw_indirect_instruction->buffer, draw_indirect_instruction->offset, draw_indirect_instruction->draw_count, draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndexedIndirectInstruction *draw_indexed_indirect_instruction = reinterpret_cast<const DrawListDrawIndexedIndirectInstruction *>(instruction);
+				driver->command_render_draw_indexed_indirect(p_command_buffer, draw_indexed_indirect_instruction->buffer, draw_indexed_indirect_instruction->offset, draw_indexed_indirect_instruction->draw_count, draw_indexed_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndexedIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_DISPATCH_MESH: {
 				const DrawListDispatchMeshInstruction *dispatch_mesh_instruction = reinterpret_cast<const DrawListDispatchMeshInstruction *>(instruction);
 				driver->command_render_dispatch_mesh(p_command_buffer, dispatch_mesh_instruction->x_groups, dispatch_mesh_instruction->y_groups, dispatch_mesh_instruction->z_groups);
@@ -1185,6 +1195,16 @@ void RenderingDeviceGraph::_print_draw_list(const uint8_t *p_instruction_data, u
 				print_line("\tDRAW INDICES", draw_indexed_instruction->index_count, "INSTANCES", draw_indexed_instruction->instance_count, "FIRST INDEX", draw_indexed_instruction->first_index);
 				instruction_data_cursor += sizeof(DrawListDrawIndexedInstruction);
 			} break;
+			case DrawListInstruction::TYPE_DRAW_INDIRECT: {
+				const DrawListDrawIndirectInstruction *draw_indirect_instruction = reinterpret_cast<const DrawListDrawIndirectInstruction *>(instruction);
+				print_line("\tDRAW INDIRECT BUFFER ID", itos(draw_indirect_instruction->buffer.id), "OFFSET", draw_indirect_instruction->offset, "DRAW COUNT", draw_indirect_instruction->draw_count, "STRIDE", draw_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndirectInstruction);
+			} break;
+			case DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT: {
+				const DrawListDrawIndexedIndirectInstruction *draw_indexed_indirect_instruction = reinterpret_cast<const DrawListDrawIndexedIndirectInstruction *>(instruction);
+				print_line("\tDRAW INDEXED INDIRECT BUFFER ID", itos(draw_indexed_indirect_instruction->buffer.id), "OFFSET", draw_indexed_indirect_instruction->offset, "DRAW COUNT", draw_indexed_indirect_instruction->draw_count, "STRIDE", draw_indexed_indirect_instruction->stride);
+				instruction_data_cursor += sizeof(DrawListDrawIndexedIndirectInstruction);
+			} break;
 			case DrawListInstruction::TYPE_DISPATCH_MESH: {
 				const DrawListDispatchMeshInstruction *dispatch_mesh_instruction = reinterpret_cast<const DrawListDispatchMeshInstruction *>(instruction);
 				print_line("\tDISPATCH MESH", dispatch_mesh_instruction->x_groups, dispatch_mesh_instruction->y_groups, dispatch_mesh_instruction->z_groups);
@@ -1286,10 +1306,11 @@ void RenderingDeviceGraph::_print_compute_list(const uint8_t *p_instruction_data
 	}
 }
 
-void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Device p_device, uint32_t p_frame_count, RDD::CommandQueueFamilyID p_secondary_command_queue_family, uint32_t p_secondary_command_buffers_per_frame) {
+void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Device p_device, uint32_t p_frame_count, RDD::CommandQueueFamilyID p_secondary_command_queue_family, uint32_t p_secondary_command_buffers_per_frame, uint32_t p_secondary_command_buffer_threshold) {
 	driver = p_driver;
 	device = p_device;
 	frames.resize(p_frame_count);
+	secondary_command_buffer_threshold = p_secondary_command_buffer_threshold;
 
 	for (uint32_t i = 0; i < p_frame_count; i++) {
 		frames[i].secondary_command_buffers.resize(p_secondary_command_buffers_per_frame);
@@ -1611,6 +1632,24 @@ void RenderingDeviceGraph::add_draw_list_draw_indexed(uint32_t p_index_count, ui
 	instruction->first_index = p_first_index;
 }
 
+void RenderingDeviceGraph::add_draw_list_draw_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawListDrawIndirectInstruction *instruction = reinterpret_cast<DrawListDrawIndirectInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDrawIndirectInstruction)));
+	instruction->type = DrawListInstruction::TYPE_DRAW_INDIRECT;
+	instruction->buffer = p_buffer;
+	instruction->offset = p_offset;
+	instruction->draw_count = p_draw_count;
+	instruction->stride = p_stride;
+}
+
+void RenderingDeviceGraph::add_draw_list_draw_indexed_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawListDrawIndexedIndirectInstruction *instruction = reinterpret_cast<DrawListDrawIndexedIndirectInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDrawIndexedIndirectInstruction)));
+	instruction->type = DrawListInstruction::TYPE_DRAW_INDEXED_INDIRECT;
+	instruction->buffer = p_buffer;
+	instruction->offset = p_offset;
+	instruction->draw_count = p_draw_count;
+	instruction->stride = p_stride;
+}
+
 void RenderingDeviceGraph::add_draw_list_dispatch_mesh(uint32_t p_x_groups, uint32_t p_y_groups, uint32_t p_z_groups) {
 	DrawListDispatchMeshInstruction *instruction = reinterpret_cast<DrawListDispatchMeshInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListDispatchMeshInstruction)));
 	instruction->type = DrawListInstruction::TYPE_DISPATCH_MESH;
@@ -1704,11 +1743,10 @@ void RenderingDeviceGraph::add_draw_list_usages(VectorView<ResourceTracker *> p_
 }
 
 void RenderingDeviceGraph::add_draw_list_end() {
-	// Arbitrary size threshold to evaluate if it'd be best to record the draw list on the background as a secondary buffer.
-	const uint32_t instruction_data_threshold_for_secondary = 16384;
+	// Size threshold to evaluate if it'd be best to record the draw list on the background as a secondary buffer.
 	RDD::CommandBufferType command_buffer_type;
 	uint32_t &secondary_buffers_used = frames[frame].secondary_command_buffers_used;
-	if (draw_instruction_list.data.size() > instruction_data_threshold_for_secondary && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
+	if (draw_instruction_list.data.size() > secondary_command_buffer_threshold && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
 		// Copy the current instruction list data into another array that will be used by the secondary command buffer worker.
 		SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[secondary_buffers_used];
 		secondary.render_pass = draw_instruction_list.render_pass;
@@ -1899,6 +1937,16 @@ void RenderingDeviceGraph::add_capture_timestamp(RDD::QueryPoolID p_query_pool,
 	_add_command_to_graph(nullptr, nullptr, 0, command_index, command);
 }
 
+void RenderingDeviceGraph::add_buffer_queue_acquire(const RDD::BufferBarrier &p_barrier) {
+	DEV_ASSERT(p_barrier.src_queue_family != p_barrier.dst_queue_family);
+	queue_acquire_buffer_barriers.push_back(p_barrier);
+}
+
+void RenderingDeviceGraph::add_texture_queue_acquire(const RDD::TextureBarrier &p_barrier) {
+	DEV_ASSERT(p_barrier.src_queue_family != p_barrier.dst_queue_family);
+	queue_acquire_texture_barriers.push_back(p_barrier);
+}
+
 void RenderingDeviceGraph::add_synchronization() {
 	// Synchronization is only acknowledged if commands have been recorded on the graph already.
 	if (command_count > 0) {
@@ -1924,6 +1972,14 @@ void RenderingDeviceGraph::end_label() {
 }
 
 void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool) {
+	if (!queue_acquire_buffer_barriers.is_empty() || !queue_acquire_texture_barriers.is_empty()) {
+		// Resources released by another queue family must be acquired before any recorded command can use them. The submission
+		// of this command buffer is expected to wait on the semaphores signaled by the release.
+		driver->command_pipeline_barrier(r_command_buffer, RDD::PIPELINE_STAGE_TOP_OF_PIPE_BIT, RDD::PIPELINE_STAGE_ALL_COMMANDS_BIT, {}, queue_acquire_buffer_barriers, queue_acquire_texture_barriers);
+		queue_acquire_buffer_barriers.clear();
+		queue_acquire_texture_barriers.clear();
+	}
+
 	if (command_count == 0) {
 		// No commands have been logged, do nothing.
 		return;
@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/timeline_profiler.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
@@ -69,6 +70,9 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	TIMELINE_ZONE("RenderingServer::draw");
+	MemoryTagScope tag_scope(Memory::TAG_RENDERING);
+
 	RSG::rasterizer->begin_frame(frame_step);
 
 	TIMESTAMP_BEGIN()
@@ -76,6 +80,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
 
 	RENDER_TIMESTAMP("Prepare Render Frame");
+	RSG::scene->update_interpolation_frame(); // Interpolated transforms have to be set before instances are updated.
 	RSG::scene->update(); //update scenes stuff before updating instances
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
@@ -87,6 +92,8 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	RSG::viewport->draw_viewports(p_swap_buffers);
 	RSG::canvas_render->update();
 
+	RSG::mesh_storage->update_mesh_lod_streaming(); // Uses the LOD requests made while drawing.
+
 	RSG::rasterizer->end_frame(p_swap_buffers);
 
 #ifndef _3D_DISABLED
@@ -249,6 +256,8 @@ void RenderingServerDefault::init() {
 	if (create_thread) {
 		print_verbose("RenderingServerWrapMT: Starting render thread");
 		DisplayServer::get_singleton()->release_rendering_thread();
+		// Nearly all commands come from the main thread, let it push them without locking.
+		command_queue.set_single_producer(Thread::get_caller_id());
 		WorkerThreadPool::TaskID tid = WorkerThreadPool::get_singleton()->add_task(callable_mp(this, &RenderingServerDefault::_thread_loop), true);
 		command_queue.set_pump_task_id(tid);
 		command_queue.push(this, &RenderingServerDefault::_assign_mt_ids, tid);
@@ -369,13 +378,26 @@ void RenderingServerDefault::_thread_exit() {
 }
 
 void RenderingServerDefault::_thread_loop() {
+	TimelineProfiler::set_thread_name("Render");
+	MemoryTagScope tag_scope(Memory::TAG_RENDERING);
 	DisplayServer::get_singleton()->gl_window_make_current(DisplayServer::MAIN_WINDOW_ID); // Move GL to this thread.
 
+	// Keep the render thread with the main thread, the pool thread gets its affinity back once done.
+	uint64_t affinity_backup = Thread::get_affinity();
+	uint64_t performance_core_mask = OS::get_singleton()->get_performance_core_mask();
+	if (performance_core_mask && !Engine::get_singleton()->is_editor_hint() && bool(GLOBAL_GET("threading/affinity/main_threads_on_performance_cores"))) {
+		Thread::set_affinity(performance_core_mask);
+	}
+
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
 	}
 
+	if (Thread::get_affinity() != affinity_backup) {
+		Thread::set_affinity(affinity_backup);
+	}
+
 	DisplayServer::get_singleton()->release_rendering_thread();
 }
 
@@ -383,10 +405,12 @@ void RenderingServerDefault::_thread_loop() {
 
 void RenderingServerDefault::tick() {
 	RSG::canvas->tick();
+	RSG::scene->tick();
 }
 
 void RenderingServerDefault::set_physics_interpolation_enabled(bool p_enabled) {
 	RSG::canvas->set_physics_interpolation_enabled(p_enabled);
+	RSG::scene->set_physics_interpolation_enabled(p_enabled);
 }
 
 /* EVENT QUEUING */
@@ -1462,7 +1462,7 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
-Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+Error ShaderCompiler::_compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1570,6 +1570,126 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	return OK;
 }
 
+void ShaderCompiler::_apply_compile_cache_entry(const CompileCacheEntry &p_entry, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	r_gen_code = p_entry.gen_code;
+
+	for (const StringName &E : p_entry.render_mode_flags) {
+		*p_actions->render_mode_flags[E] = true;
+	}
+	for (const StringName &E : p_entry.render_mode_values) {
+		Pair<int *, int> &p = p_actions->render_mode_values[E];
+		*p.first = p.second;
+	}
+	for (const StringName &E : p_entry.usage_flags) {
+		*p_actions->usage_flag_pointers[E] = true;
+	}
+	for (const StringName &E : p_entry.write_flags) {
+		*p_actions->write_flag_pointers[E] = true;
+	}
+
+	if (p_actions->uniforms) {
+		for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : p_entry.uniforms) {
+			p_actions->uniforms->insert(E.key, E.value);
+		}
+	}
+}
+
+Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	ERR_FAIL_INDEX_V(p_mode, RS::SHADER_MAX, ERR_INVALID_PARAMETER);
+
+	HashMap<String, CompileCacheEntry> &cache = compile_cache[p_mode];
+
+	const CompileCacheEntry *cached = cache.getptr(p_code);
+	if (cached) {
+		_apply_compile_cache_entry(*cached, p_actions, r_gen_code);
+		return OK;
+	}
+
+	// Compile against local flags to find out which ones the shader sets.
+	IdentifierActions recording_actions = *p_actions;
+
+	LocalVector<bool> flags;
+	flags.resize(recording_actions.render_mode_flags.size() + recording_actions.usage_flag_pointers.size() + recording_actions.write_flag_pointers.size());
+	LocalVector<int> values;
+	values.resize(recording_actions.render_mode_values.size());
+
+	uint32_t flag_index = 0;
+	for (KeyValue<StringName, bool *> &E : recording_actions.render_mode_flags) {
+		flags[flag_index] = false;
+		E.value = &flags[flag_index++];
+	}
+	for (KeyValue<StringName, bool *> &E : recording_actions.usage_flag_pointers) {
+		flags[flag_index] = false;
+		E.value = &flags[flag_index++];
+	}
+	for (KeyValue<StringName, bool *> &E : recording_actions.write_flag_pointers) {
+		flags[flag_index] = false;
+		E.value = &flags[flag_index++];
+	}
+	uint32_t value_index = 0;
+	for (KeyValue<StringName, Pair<int *, int>> &E : recording_actions.render_mode_values) {
+		values[value_index] = ~E.value.second; // Anything but the value the render mode sets.
+		E.value.first = &values[value_index++];
+	}
+
+	CompileCacheEntry entry;
+	recording_actions.uniforms = &entry.uniforms;
+
+	Error err = _compile(p_mode, p_code, &recording_actions, p_path, entry.gen_code);
+	if (err != OK) {
+		return err;
+	}
+
+	flag_index = 0;
+	for (const KeyValue<StringName, bool *> &E : recording_actions.render_mode_flags) {
+		if (flags[flag_index++]) {
+			entry.render_mode_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &E : recording_actions.usage_flag_pointers) {
+		if (flags[flag_index++]) {
+			entry.usage_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, bool *> &E : recording_actions.write_flag_pointers) {
+		if (flags[flag_index++]) {
+			entry.write_flags.push_back(E.key);
+		}
+	}
+	value_index = 0;
+	for (const KeyValue<StringName, Pair<int *, int>> &E : recording_actions.render_mode_values) {
+		if (values[value_index++] == E.value.second) {
+			entry.render_mode_values.push_back(E.key);
+		}
+	}
+
+	_apply_compile_cache_entry(entry, p_actions, r_gen_code);
+
+	// Global uniforms can be added, removed or change type at any time, which changes the result.
+	bool cacheable = true;
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : entry.uniforms) {
+		if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL) {
+			cacheable = false;
+			break;
+		}
+	}
+
+	if (cacheable) {
+		if (cache.size() >= COMPILE_CACHE_MAX_ENTRIES) {
+			cache.clear();
+		}
+		cache.insert(p_code, entry);
+	}
+
+	return OK;
+}
+
+void ShaderCompiler::clear_compile_cache() {
+	for (int i = 0; i < RS::SHADER_MAX; i++) {
+		compile_cache[i].clear();
+	}
+}
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
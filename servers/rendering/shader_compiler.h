@@ -125,10 +125,28 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// Materials often share the same code (e.g. duplicated visual shaders), so successful compilations are cached
+	// along with the flags and uniforms they reported through the identifier actions.
+	struct CompileCacheEntry {
+		GeneratedCode gen_code;
+		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+		LocalVector<StringName> render_mode_flags;
+		LocalVector<StringName> render_mode_values;
+		LocalVector<StringName> usage_flags;
+		LocalVector<StringName> write_flags;
+	};
+
+	static const uint32_t COMPILE_CACHE_MAX_ENTRIES = 1024;
+	HashMap<String, CompileCacheEntry> compile_cache[RS::SHADER_MAX];
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	Error _compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+	static void _apply_compile_cache_entry(const CompileCacheEntry &p_entry, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+	void clear_compile_cache();
 
 	void initialize(DefaultIdentifierActions p_actions);
 	ShaderCompiler();
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  light_storage.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "light_storage.h"
+
+#include "core/math/geometry_3d.h"
+
+struct LightmapTetrahedronFace {
+	int32_t vertices[3];
+	int32_t index; // Tetrahedron * 4 + opposite vertex.
+
+	_FORCE_INLINE_ bool has_same_vertices(const LightmapTetrahedronFace &p_face) const {
+		return vertices[0] == p_face.vertices[0] && vertices[1] == p_face.vertices[1] && vertices[2] == p_face.vertices[2];
+	}
+
+	_FORCE_INLINE_ bool operator<(const LightmapTetrahedronFace &p_face) const {
+		if (vertices[0] != p_face.vertices[0]) {
+			return vertices[0] < p_face.vertices[0];
+		}
+		if (vertices[1] != p_face.vertices[1]) {
+			return vertices[1] < p_face.vertices[1];
+		}
+		return vertices[2] < p_face.vertices[2];
+	}
+};
+
+void RendererLightStorage::_lightmap_build_tetrahedra_neighbors(const PackedInt32Array &p_tetrahedra, LocalVector<int32_t> &r_neighbors) {
+	r_neighbors.clear();
+
+	const uint32_t face_count = p_tetrahedra.size();
+	if (face_count == 0) {
+		return;
+	}
+
+	const int32_t *tetrahedra = p_tetrahedra.ptr();
+
+	// Sort the faces by their vertices, so faces shared by two tetrahedra end up next to each other.
+	LocalVector<LightmapTetrahedronFace> faces;
+	faces.resize(face_count);
+	for (uint32_t i = 0; i < face_count; i++) {
+		const int32_t *tetrahedron = &tetrahedra[i & ~3u];
+		LightmapTetrahedronFace &face = faces[i];
+		uint32_t vertex_count = 0;
+		for (uint32_t j = 0; j < 4; j++) {
+			if (j != (i & 3)) {
+				face.vertices[vertex_count++] = tetrahedron[j];
+			}
+		}
+		if (face.vertices[0] > face.vertices[1]) {
+			SWAP(face.vertices[0], face.vertices[1]);
+		}
+		if (face.vertices[1] > face.vertices[2]) {
+			SWAP(face.vertices[1], face.vertices[2]);
+		}
+		if (face.vertices[0] > face.vertices[1]) {
+			SWAP(face.vertices[0], face.vertices[1]);
+		}
+		face.index = i;
+	}
+	faces.sort();
+
+	r_neighbors.resize(face_count);
+	for (uint32_t i = 0; i < face_count; i++) {
+		r_neighbors[i] = -1;
+	}
+
+	for (uint32_t i = 0; i + 1 < face_count; i++) {
+		if (faces[i].has_same_vertices(faces[i + 1])) {
+			r_neighbors[faces[i].index] = faces[i + 1].index / 4;
+			r_neighbors[faces[i + 1].index] = faces[i].index / 4;
+			i++;
+		}
+	}
+}
+
+int32_t RendererLightStorage::_lightmap_walk_tetrahedra(const PackedVector3Array &p_points, const PackedInt32Array &p_tetrahedra, const LocalVector<int32_t> &p_neighbors, const Vector3 &p_point, int32_t p_from, Color &r_barycentric) {
+	if (p_from < 0 || p_from >= p_tetrahedra.size() / 4 || p_neighbors.size() != (uint32_t)p_tetrahedra.size()) {
+		return -1;
+	}
+
+	const Vector3 *points = p_points.ptr();
+	const int32_t *tetrahedra = p_tetrahedra.ptr();
+
+	int32_t current = p_from;
+	for (int32_t step = 0; step < LIGHTMAP_TETRAHEDRA_MAX_WALK_STEPS; step++) {
+		const int32_t *tetrahedron = &tetrahedra[current * 4];
+		Color barycentric = Geometry3D::tetrahedron_get_barycentric_coords(points[tetrahedron[0]], points[tetrahedron[1]], points[tetrahedron[2]], points[tetrahedron[3]], p_point);
+
+		// Leave through the face opposite to the most negative coordinate.
+		int32_t exit_vertex = -1;
+		float exit_coord = -CMP_EPSILON;
+		for (int32_t i = 0; i < 4; i++) {
+			if (!Math::is_finite(barycentric[i])) {
+				return -1; // Degenerate tetrahedron, let the BSP tree handle it.
+			}
+			if (barycentric[i] < exit_coord) {
+				exit_coord = barycentric[i];
+				exit_vertex = i;
+			}
+		}
+
+		if (exit_vertex == -1) {
+			r_barycentric = barycentric;
+			return current;
+		}
+
+		current = p_neighbors[current * 4 + exit_vertex];
+		if (current < 0) {
+			return -1; // Outside of the captured volume.
+		}
+	}
+
+	return -1;
+}
@@ -31,6 +31,7 @@
 #ifndef LIGHT_STORAGE_H
 #define LIGHT_STORAGE_H
 
+#include "core/templates/local_vector.h"
 #include "render_scene_buffers.h"
 #include "servers/rendering_server.h"
 
@@ -168,7 +169,9 @@ public:
 	virtual PackedInt32Array lightmap_get_probe_capture_tetrahedra(RID p_lightmap) const = 0;
 	virtual PackedInt32Array lightmap_get_probe_capture_bsp_tree(RID p_lightmap) const = 0;
 	virtual AABB lightmap_get_aabb(RID p_lightmap) const = 0;
-	virtual void lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh) = 0;
+	// If `r_tetrahedron` is not null, it holds the tetrahedron found by a previous lookup (or -1). The search walks from it to its
+	// neighbors before falling back to the BSP tree, and it's updated with the tetrahedron containing `p_point`.
+	virtual void lightmap_tap_sh_light(RID p_lightmap, const Vector3 &p_point, Color *r_sh, int32_t *r_tetrahedron = nullptr) = 0;
 	virtual bool lightmap_is_interior(RID p_lightmap) const = 0;
 	virtual void lightmap_set_probe_capture_update_speed(float p_speed) = 0;
 	virtual float lightmap_get_probe_capture_update_speed() const = 0;
@@ -193,6 +196,16 @@ public:
 	virtual void directional_shadow_atlas_set_size(int p_size, bool p_16_bits = true) = 0;
 	virtual int get_directional_light_shadow_size(RID p_light_intance) = 0;
 	virtual void set_directional_shadow_count(int p_count) = 0;
+
+protected:
+	/* LIGHTMAP PROBE CAPTURE */
+
+	static const int32_t LIGHTMAP_TETRAHEDRA_MAX_WALK_STEPS = 16;
+
+	// Stores, for each face of each tetrahedron (indexed as `tetrahedron * 4 + opposite vertex`), the tetrahedron sharing it, or -1.
+	static void _lightmap_build_tetrahedra_neighbors(const PackedInt32Array &p_tetrahedra, LocalVector<int32_t> &r_neighbors);
+	// Returns the tetrahedron containing `p_point` walking from `p_from`, or -1 if it can't be reached in a few steps.
+	static int32_t _lightmap_walk_tetrahedra(const PackedVector3Array &p_points, const PackedInt32Array &p_tetrahedra, const LocalVector<int32_t> &p_neighbors, const Vector3 &p_point, int32_t p_from, Color &r_barycentric);
 };
 
 #endif // LIGHT_STORAGE_H
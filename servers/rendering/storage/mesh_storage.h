@@ -88,6 +88,8 @@ public:
 	virtual void mesh_instance_set_canvas_item_transform(RID p_mesh_instance, const Transform2D &p_transform) = 0;
 	virtual void update_mesh_instances() = 0;
 
+	virtual void update_mesh_lod_streaming() {}
+
 	/* MULTIMESH API */
 
 	virtual RID multimesh_allocate() = 0;
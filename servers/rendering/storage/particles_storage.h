@@ -34,6 +34,24 @@
 #include "servers/rendering_server.h"
 
 class RendererParticlesStorage {
+protected:
+	enum {
+		PARTICLES_LOD_MAX_UPDATE_INTERVAL = 4,
+	};
+
+	// Emitters covering less than the LOD threshold of the viewport width emit proportionally fewer particles
+	// and are simulated every few frames, until they reach the minimum ratio and the maximum update interval.
+	static void _particles_get_lod(float p_threshold, float p_screen_size, float &r_amount_ratio, uint32_t &r_update_interval) {
+		r_amount_ratio = 1.0;
+		r_update_interval = 1;
+		if (p_threshold <= 0.0 || p_screen_size < 0.0 || p_screen_size >= p_threshold) {
+			return;
+		}
+		float lod = MAX(p_screen_size / p_threshold, 0.1f);
+		r_amount_ratio = lod;
+		r_update_interval = MIN(uint32_t(1.0f / lod), uint32_t(PARTICLES_LOD_MAX_UPDATE_INTERVAL));
+	}
+
 public:
 	virtual ~RendererParticlesStorage() {}
 
@@ -50,6 +68,7 @@ public:
 
 	virtual void particles_set_amount(RID p_particles, int p_amount) = 0;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) = 0;
+	virtual void particles_set_lod_threshold(RID p_particles, float p_threshold) = 0;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) = 0;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) = 0;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) = 0;
@@ -82,6 +101,8 @@ public:
 	virtual void particles_set_draw_pass_mesh(RID p_particles, int p_pass, RID p_mesh) = 0;
 
 	virtual void particles_request_process(RID p_particles) = 0;
+	// Reported by the scene cull for every camera the particles are visible from, the largest size of the frame is used.
+	virtual void particles_set_lod_screen_size(RID p_particles, float p_screen_size) = 0;
 	virtual AABB particles_get_current_aabb(RID p_particles) = 0;
 	virtual AABB particles_get_aabb(RID p_particles) const = 0;
 
@@ -73,6 +73,19 @@ Array RenderingServer::_texture_debug_usage_bind() {
 	return arr;
 }
 
+TypedArray<Dictionary> RenderingServer::_get_frame_profile_bind() {
+	Vector<FrameProfileArea> profile = get_frame_profile();
+	TypedArray<Dictionary> arr;
+	for (const FrameProfileArea &E : profile) {
+		Dictionary dict;
+		dict["name"] = E.name;
+		dict["cpu_msec"] = E.cpu_msec;
+		dict["gpu_msec"] = E.gpu_msec;
+		arr.push_back(dict);
+	}
+	return arr;
+}
+
 static PackedInt64Array to_int_array(const Vector<ObjectID> &ids) {
 	PackedInt64Array a;
 	a.resize(ids.size());
@@ -82,6 +95,57 @@ static PackedInt64Array to_int_array(const Vector<ObjectID> &ids) {
 	return a;
 }
 
+static Vector<RID> to_rid_vector(const TypedArray<RID> &p_array) {
+	Vector<RID> rids;
+	rids.resize(p_array.size());
+	RID *w = rids.ptrw();
+	for (int i = 0; i < p_array.size(); i++) {
+		w[i] = p_array[i];
+	}
+	return rids;
+}
+
+void RenderingServer::_instances_set_transform_bind(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+	Vector<Transform3D> transforms;
+	transforms.resize(p_transforms.size());
+	Transform3D *w = transforms.ptrw();
+	for (int i = 0; i < p_transforms.size(); i++) {
+		w[i] = p_transforms[i];
+	}
+	instances_set_transform(to_rid_vector(p_instances), transforms);
+}
+
+void RenderingServer::_instances_set_visible_bind(const TypedArray<RID> &p_instances, bool p_visible) {
+	instances_set_visible(to_rid_vector(p_instances), p_visible);
+}
+
+PackedVector3Array RenderingServer::_instances_get_aabb_bind(const TypedArray<RID> &p_instances) const {
+	const Vector<AABB> aabbs = instances_get_aabb(to_rid_vector(p_instances));
+
+	// Position and size of each AABB.
+	PackedVector3Array ret;
+	ret.resize(aabbs.size() * 2);
+	Vector3 *w = ret.ptrw();
+	for (const AABB &aabb : aabbs) {
+		w[0] = aabb.position;
+		w[1] = aabb.size;
+		w += 2;
+	}
+	return ret;
+}
+
+void RenderingServer::_instances_geometry_set_shader_parameter_bind(const TypedArray<RID> &p_instances, const StringName &p_parameter, const Array &p_values) {
+	ERR_FAIL_COND(p_instances.size() != p_values.size());
+	Vector<Variant> values;
+	values.resize(p_values.size());
+	Variant *w = values.ptrw();
+	for (int i = 0; i < p_values.size(); i++) {
+		w[i] = p_values[i];
+	}
+	instances_geometry_set_shader_parameter(to_rid_vector(p_instances), p_parameter, values);
+}
+
 PackedInt64Array RenderingServer::_instances_cull_aabb_bind(const AABB &p_aabb, RID p_scenario) const {
 	Vector<ObjectID> ids = instances_cull_aabb(p_aabb, p_scenario);
 	return to_int_array(ids);
@@ -1978,6 +2042,10 @@ static RS::SurfaceData _dict_to_surf(const Dictionary &p_dictionary) {
 		sd.blend_shape_data = p_dictionary["blend_shape_data"];
 	}
 
+	if (p_dictionary.has("cluster_data")) {
+		sd.cluster_data = p_dictionary["cluster_data"];
+	}
+
 	if (p_dictionary.has("material")) {
 		sd.material = p_dictionary["material"];
 	}
@@ -2038,6 +2106,10 @@ Dictionary RenderingServer::_mesh_get_surface(RID p_mesh, int p_idx) {
 		d["blend_shape_data"] = sd.blend_shape_data;
 	}
 
+	if (sd.cluster_data.size()) {
+		d["cluster_data"] = sd.cluster_data;
+	}
+
 	if (sd.material.is_valid()) {
 		d["material"] = sd.material;
 	}
@@ -2566,6 +2638,7 @@ void RenderingServer::_bind_methods() {
 
 	BIND_ENUM_CONSTANT(REFLECTION_PROBE_UPDATE_ONCE);
 	BIND_ENUM_CONSTANT(REFLECTION_PROBE_UPDATE_ALWAYS);
+	BIND_ENUM_CONSTANT(REFLECTION_PROBE_UPDATE_TIME_SLICED);
 
 	BIND_ENUM_CONSTANT(REFLECTION_PROBE_AMBIENT_DISABLED);
 	BIND_ENUM_CONSTANT(REFLECTION_PROBE_AMBIENT_ENVIRONMENT);
@@ -2651,6 +2724,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("particles_get_emitting", "particles"), &RenderingServer::particles_get_emitting);
 	ClassDB::bind_method(D_METHOD("particles_set_amount", "particles", "amount"), &RenderingServer::particles_set_amount);
 	ClassDB::bind_method(D_METHOD("particles_set_amount_ratio", "particles", "ratio"), &RenderingServer::particles_set_amount_ratio);
+	ClassDB::bind_method(D_METHOD("particles_set_lod_threshold", "particles", "threshold"), &RenderingServer::particles_set_lod_threshold);
 	ClassDB::bind_method(D_METHOD("particles_set_lifetime", "particles", "lifetime"), &RenderingServer::particles_set_lifetime);
 	ClassDB::bind_method(D_METHOD("particles_set_one_shot", "particles", "one_shot"), &RenderingServer::particles_set_one_shot);
 	ClassDB::bind_method(D_METHOD("particles_set_pre_process_time", "particles", "time"), &RenderingServer::particles_set_pre_process_time);
@@ -2765,6 +2839,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("camera_set_orthogonal", "camera", "size", "z_near", "z_far"), &RenderingServer::camera_set_orthogonal);
 	ClassDB::bind_method(D_METHOD("camera_set_frustum", "camera", "size", "offset", "z_near", "z_far"), &RenderingServer::camera_set_frustum);
 	ClassDB::bind_method(D_METHOD("camera_set_transform", "camera", "transform"), &RenderingServer::camera_set_transform);
+	ClassDB::bind_method(D_METHOD("camera_set_interpolated", "camera", "interpolated"), &RenderingServer::camera_set_interpolated);
+	ClassDB::bind_method(D_METHOD("camera_reset_physics_interpolation", "camera"), &RenderingServer::camera_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("camera_set_cull_mask", "camera", "layers"), &RenderingServer::camera_set_cull_mask);
 	ClassDB::bind_method(D_METHOD("camera_set_environment", "camera", "env"), &RenderingServer::camera_set_environment);
 	ClassDB::bind_method(D_METHOD("camera_set_camera_attributes", "camera", "effects"), &RenderingServer::camera_set_camera_attributes);
@@ -2784,6 +2860,8 @@ void RenderingServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_mode", "viewport", "scaling_3d_mode"), &RenderingServer::viewport_set_scaling_3d_mode);
 	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_scale", "viewport", "scale"), &RenderingServer::viewport_set_scaling_3d_scale);
+	ClassDB::bind_method(D_METHOD("viewport_set_scaling_3d_dynamic", "viewport", "enabled", "min_scale", "max_scale", "target_time_msec"), &RenderingServer::viewport_set_scaling_3d_dynamic, DEFVAL(0.5), DEFVAL(1.0), DEFVAL(16.0));
+	ClassDB::bind_method(D_METHOD("viewport_get_scaling_3d_dynamic_scale", "viewport"), &RenderingServer::viewport_get_scaling_3d_dynamic_scale);
 	ClassDB::bind_method(D_METHOD("viewport_set_fsr_sharpness", "viewport", "sharpness"), &RenderingServer::viewport_set_fsr_sharpness);
 	ClassDB::bind_method(D_METHOD("viewport_set_texture_mipmap_bias", "viewport", "mipmap_bias"), &RenderingServer::viewport_set_texture_mipmap_bias);
 	ClassDB::bind_method(D_METHOD("viewport_set_update_mode", "viewport", "update_mode"), &RenderingServer::viewport_set_update_mode);
@@ -2846,6 +2924,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_WHEN_VISIBLE); // Default
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_WHEN_PARENT_VISIBLE);
 	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_ALWAYS);
+	BIND_ENUM_CONSTANT(VIEWPORT_UPDATE_BUDGET);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_CLEAR_ALWAYS);
 	BIND_ENUM_CONSTANT(VIEWPORT_CLEAR_NEVER);
@@ -2884,6 +2963,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME);
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME);
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_BATCHES_IN_FRAME);
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_MAX);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_RENDER_INFO_TYPE_VISIBLE);
@@ -2922,6 +3002,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_DISABLED);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_TEXTURE);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_XR);
+	BIND_ENUM_CONSTANT(VIEWPORT_VRS_ADAPTIVE);
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_MAX);
 
 	BIND_ENUM_CONSTANT(VIEWPORT_VRS_UPDATE_DISABLED);
@@ -3131,6 +3212,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -3144,6 +3227,10 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_visibility_parent", "instance", "parent"), &RenderingServer::instance_set_visibility_parent);
 	ClassDB::bind_method(D_METHOD("instance_set_ignore_culling", "instance", "enabled"), &RenderingServer::instance_set_ignore_culling);
 
+	ClassDB::bind_method(D_METHOD("instances_set_transform", "instances", "transforms"), &RenderingServer::_instances_set_transform_bind);
+	ClassDB::bind_method(D_METHOD("instances_set_visible", "instances", "visible"), &RenderingServer::_instances_set_visible_bind);
+	ClassDB::bind_method(D_METHOD("instances_get_aabb", "instances"), &RenderingServer::_instances_get_aabb_bind);
+
 	ClassDB::bind_method(D_METHOD("instance_geometry_set_flag", "instance", "flag", "enabled"), &RenderingServer::instance_geometry_set_flag);
 	ClassDB::bind_method(D_METHOD("instance_geometry_set_cast_shadows_setting", "instance", "shadow_casting_setting"), &RenderingServer::instance_geometry_set_cast_shadows_setting);
 	ClassDB::bind_method(D_METHOD("instance_geometry_set_material_override", "instance", "material"), &RenderingServer::instance_geometry_set_material_override);
@@ -3156,6 +3243,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_geometry_get_shader_parameter", "instance", "parameter"), &RenderingServer::instance_geometry_get_shader_parameter);
 	ClassDB::bind_method(D_METHOD("instance_geometry_get_shader_parameter_default_value", "instance", "parameter"), &RenderingServer::instance_geometry_get_shader_parameter_default_value);
 	ClassDB::bind_method(D_METHOD("instance_geometry_get_shader_parameter_list", "instance"), &RenderingServer::_instance_geometry_get_shader_parameter_list);
+	ClassDB::bind_method(D_METHOD("instances_geometry_set_shader_parameter", "instances", "parameter", "values"), &RenderingServer::_instances_geometry_set_shader_parameter_bind);
 
 	ClassDB::bind_method(D_METHOD("instances_cull_aabb", "aabb", "scenario"), &RenderingServer::_instances_cull_aabb_bind, DEFVAL(RID()));
 	ClassDB::bind_method(D_METHOD("instances_cull_ray", "from", "to", "scenario"), &RenderingServer::_instances_cull_ray_bind, DEFVAL(RID()));
@@ -3437,6 +3525,10 @@ void RenderingServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_frame_setup_time_cpu"), &RenderingServer::get_frame_setup_time_cpu);
 
+	ClassDB::bind_method(D_METHOD("set_frame_profiling_enabled", "enable"), &RenderingServer::set_frame_profiling_enabled);
+	ClassDB::bind_method(D_METHOD("get_frame_profile"), &RenderingServer::_get_frame_profile_bind);
+	ClassDB::bind_method(D_METHOD("get_frame_profile_frame"), &RenderingServer::get_frame_profile_frame);
+
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "render_loop_enabled"), "set_render_loop_enabled", "is_render_loop_enabled");
 
 	BIND_ENUM_CONSTANT(RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
@@ -3445,6 +3537,11 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_VIDEO_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_PENDING);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_COMPLETED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_TEXTURE_STORAGE_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_MESH_STORAGE_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_PARTICLES_STORAGE_MEM_USED);
 
 	ADD_SIGNAL(MethodInfo("frame_pre_draw"));
 	ADD_SIGNAL(MethodInfo("frame_post_draw"));
@@ -3534,10 +3631,18 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF("rendering/textures/lossless_compression/force_png", false);
 
+	GLOBAL_DEF("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/min_resident_size", PROPERTY_HINT_RANGE, "16,4096,1"), 256);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/budget_mb", PROPERTY_HINT_RANGE, "16,65536,1,suffix:MiB"), 2048);
+
+	GLOBAL_DEF_RST("rendering/mesh_lod/streaming/enabled", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/mesh_lod/streaming/budget_mb", PROPERTY_HINT_RANGE, "16,65536,1,suffix:MiB"), 256);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/webp_compression/compression_method", PROPERTY_HINT_RANGE, "0,6,1"), 2);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"), 25);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 3600);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/particles/max_gpu_particles", PROPERTY_HINT_RANGE, "0,16777216,1,or_greater"), 0);
 
 	GLOBAL_DEF_RST("rendering/lights_and_shadows/use_physical_light_units", false);
 
@@ -3549,11 +3654,16 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Very Low (Faster),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"), 2);
 	GLOBAL_DEF("rendering/lights_and_shadows/positional_shadow/soft_shadow_filter_quality.mobile", 0);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/lights_and_shadows/positional_shadow/max_full_updates_per_frame", PROPERTY_HINT_RANGE, "0,256,1"), 0);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/2d/shadow_atlas/size", PROPERTY_HINT_RANGE, "128,16384"), 2048);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/2d/batching/item_buffer_size", PROPERTY_HINT_RANGE, "128,1048576,1"), 16384);
+	GLOBAL_DEF_RST("rendering/3d/batching/sprites", false);
 
 	// Number of commands that can be drawn per frame.
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/gl_compatibility/item_buffer_size", PROPERTY_HINT_RANGE, "128,1048576,1"), 16384);
+	GLOBAL_DEF_RST("rendering/gl_compatibility/auto_instancing", true);
+	GLOBAL_DEF_RST("rendering/gl_compatibility/parallel_shader_compile", true);
 
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
@@ -3567,9 +3677,12 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/ggx_samples", PROPERTY_HINT_RANGE, "0,256,1"), 32);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/ggx_samples.mobile", PROPERTY_HINT_RANGE, "0,128,1"), 16);
 	GLOBAL_DEF("rendering/reflections/sky_reflections/fast_filter_high_quality", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/realtime_update_budget", PROPERTY_HINT_RANGE, "0,7,1"), 0);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/reflections/sky_reflections/realtime_change_threshold", PROPERTY_HINT_RANGE, "0,0.5,0.001"), 0.0);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_size", PROPERTY_HINT_RANGE, "0,4096,1"), 256);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_size.mobile", PROPERTY_HINT_RANGE, "0,2048,1"), 128);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/reflections/reflection_atlas/reflection_count", PROPERTY_HINT_RANGE, "0,256,1"), 64);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/reflections/reflection_probes/time_sliced_steps_per_frame", PROPERTY_HINT_RANGE, "1,64,1"), 4);
 
 	GLOBAL_DEF("rendering/global_illumination/gi/use_half_resolution", true);
 
@@ -3610,14 +3723,25 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/scaling_3d/mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),FSR 2.2 (Slow)"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), 1.0);
+	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "rendering/scaling_3d/dynamic"), false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/dynamic_min_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), 0.5);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/dynamic_max_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), 1.0);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/dynamic_target_time", PROPERTY_HINT_RANGE, "1,100,0.1,suffix:ms"), 16.0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/scaling_3d/fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), 0.2f);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/default_filters/texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), 0.0f);
 
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/textures/decals/atlas_size", PROPERTY_HINT_RANGE, "256,16384,256"), 4096);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/decals/atlas_uploads_per_frame", PROPERTY_HINT_RANGE, "1,64,1"), 8);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/decals/filter", PROPERTY_HINT_ENUM, "Nearest (Fast),Linear (Fast),Nearest Mipmap (Fast),Linear Mipmap (Fast),Nearest Mipmap Anisotropic (Average),Linear Mipmap Anisotropic (Average)"), DECAL_FILTER_LINEAR_MIPMAPS);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/light_projectors/filter", PROPERTY_HINT_ENUM, "Nearest (Fast),Linear (Fast),Nearest Mipmap (Fast),Linear Mipmap (Fast),Nearest Mipmap Anisotropic (Average),Linear Mipmap Anisotropic (Average)"), LIGHT_PROJECTOR_FILTER_LINEAR_MIPMAPS);
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/occlusion_culling/occlusion_rays_per_thread", PROPERTY_HINT_RANGE, "1,2048,1,or_greater"), 512);
 
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/viewport/update_budget_msec", PROPERTY_HINT_RANGE, "0,33.3,0.1,or_greater,suffix:ms"), 2.0);
+
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/vrs/adaptive_velocity_threshold", PROPERTY_HINT_RANGE, "0,64,0.1,suffix:px"), 8.0);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/vrs/adaptive_contrast_threshold", PROPERTY_HINT_RANGE, "0,1,0.001"), 0.05);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/glow/upscale_mode", PROPERTY_HINT_ENUM, "Linear (Fast),Bicubic (Slow)"), 1);
 	GLOBAL_DEF("rendering/environment/glow/upscale_mode.mobile", 0);
 
@@ -3630,10 +3754,12 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/limits/global_shader_variables/buffer_size", PROPERTY_HINT_RANGE, "16,1048576,1"), 65536);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/lightmapping/probe_capture/update_speed", PROPERTY_HINT_RANGE, "0.001,256,0.001"), 15);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/lightmapping/probe_capture/update_distance", PROPERTY_HINT_RANGE, "0,1,0.001,or_greater,suffix:m"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/lightmapping/primitive_meshes/texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/hddagi/frames_to_converge", PROPERTY_HINT_ENUM, "6 (Less Latency/Mem usage & Low Quality),12,18,24,32 (More Latency / Mem Usage & High Quality)"), 1);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/hddagi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Less Latency but Slower),2,4,8,16 (More Latency but Faster)"), 2);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/global_illumination/hddagi/cascade_update_budget", PROPERTY_HINT_RANGE, "0,8,0.05"), 0.0);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/hddagi/frames_to_update_inactive_probes", PROPERTY_HINT_ENUM, "1 (Less Latency but Slower),2,4,8,16 (More Latency but Faster)"), 3);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"), 64);
@@ -3644,6 +3770,12 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"), 1000);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"), 512);
+	GLOBAL_DEF_RST("rendering/limits/cluster_builder/use_compute_binning", false);
+	GLOBAL_DEF_RST("rendering/limits/cluster_builder/use_compute_binning.mobile", true);
+
+	GLOBAL_DEF_RST("rendering/mesh_clusters/gpu_culling/enabled", false);
+	GLOBAL_DEF_RST("rendering/multimesh/gpu_culling/enabled", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/multimesh/gpu_culling/min_instances", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"), 4096);
 
 	// OpenGL limits
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/opengl/max_renderable_elements", PROPERTY_HINT_RANGE, "1024,65536,1"), 65536);
@@ -341,6 +341,19 @@ public:
 		PRIMITIVE_MAX,
 	};
 
+	// Bounds of a group of triangles (meshlet), stored back to back in SurfaceData::cluster_data.
+	// The layout matches the std430 layout used by the cluster culling shaders.
+	struct MeshCluster {
+		float center[3];
+		float radius;
+		// Cone bounding the face normals (using clockwise front faces), for backface culling.
+		float cone_axis[3];
+		float cone_cutoff;
+		uint32_t index_offset;
+		uint32_t index_count;
+		uint32_t pad[2];
+	};
+
 	struct SurfaceData {
 		PrimitiveType primitive = PRIMITIVE_MAX;
 
@@ -360,6 +373,9 @@ public:
 		Vector<LOD> lods;
 		Vector<AABB> bone_aabbs;
 
+		// Array of MeshCluster covering the base index buffer, whose triangles are sorted by cluster.
+		Vector<uint8_t> cluster_data;
+
 		// Transforms used in runtime bone AABBs compute.
 		// Since bone AABBs is saved in Mesh space, but bones is in Skeleton space.
 		Transform3D mesh_to_skeleton_xform;
@@ -589,6 +605,7 @@ public:
 	enum ReflectionProbeUpdateMode {
 		REFLECTION_PROBE_UPDATE_ONCE,
 		REFLECTION_PROBE_UPDATE_ALWAYS,
+		REFLECTION_PROBE_UPDATE_TIME_SLICED,
 	};
 
 	virtual void reflection_probe_set_update_mode(RID p_probe, ReflectionProbeUpdateMode p_mode) = 0;
@@ -708,6 +725,7 @@ public:
 	virtual bool particles_get_emitting(RID p_particles) = 0;
 	virtual void particles_set_amount(RID p_particles, int p_amount) = 0;
 	virtual void particles_set_amount_ratio(RID p_particles, float p_amount_ratio) = 0;
+	virtual void particles_set_lod_threshold(RID p_particles, float p_threshold) = 0;
 	virtual void particles_set_lifetime(RID p_particles, double p_lifetime) = 0;
 	virtual void particles_set_one_shot(RID p_particles, bool p_one_shot) = 0;
 	virtual void particles_set_pre_process_time(RID p_particles, double p_time) = 0;
@@ -840,6 +858,8 @@ public:
 	virtual void camera_set_orthogonal(RID p_camera, float p_size, float p_z_near, float p_z_far) = 0;
 	virtual void camera_set_frustum(RID p_camera, float p_size, Vector2 p_offset, float p_z_near, float p_z_far) = 0;
 	virtual void camera_set_transform(RID p_camera, const Transform3D &p_transform) = 0;
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated) = 0;
+	virtual void camera_reset_physics_interpolation(RID p_camera) = 0;
 	virtual void camera_set_cull_mask(RID p_camera, uint32_t p_layers) = 0;
 	virtual void camera_set_environment(RID p_camera, RID p_env) = 0;
 	virtual void camera_set_camera_attributes(RID p_camera, RID p_camera_attributes) = 0;
@@ -888,6 +908,8 @@ public:
 
 	virtual void viewport_set_scaling_3d_mode(RID p_viewport, ViewportScaling3DMode p_scaling_3d_mode) = 0;
 	virtual void viewport_set_scaling_3d_scale(RID p_viewport, float p_scaling_3d_scale) = 0;
+	virtual void viewport_set_scaling_3d_dynamic(RID p_viewport, bool p_enabled, float p_min_scale = 0.5, float p_max_scale = 1.0, float p_target_time_msec = 16.0) = 0;
+	virtual float viewport_get_scaling_3d_dynamic_scale(RID p_viewport) const = 0;
 	virtual void viewport_set_fsr_sharpness(RID p_viewport, float p_fsr_sharpness) = 0;
 	virtual void viewport_set_texture_mipmap_bias(RID p_viewport, float p_texture_mipmap_bias) = 0;
 
@@ -896,7 +918,8 @@ public:
 		VIEWPORT_UPDATE_ONCE, // Then goes to disabled, must be manually updated.
 		VIEWPORT_UPDATE_WHEN_VISIBLE, // Default
 		VIEWPORT_UPDATE_WHEN_PARENT_VISIBLE,
-		VIEWPORT_UPDATE_ALWAYS
+		VIEWPORT_UPDATE_ALWAYS,
+		VIEWPORT_UPDATE_BUDGET, // Like WHEN_VISIBLE, but shares a per-frame cost budget with other budgeted viewports.
 	};
 
 	virtual void viewport_set_update_mode(RID p_viewport, ViewportUpdateMode p_mode) = 0;
@@ -1000,6 +1023,7 @@ public:
 		VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME,
 		VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME,
 		VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME,
+		VIEWPORT_RENDER_INFO_BATCHES_IN_FRAME,
 		VIEWPORT_RENDER_INFO_MAX,
 	};
 
@@ -1054,6 +1078,7 @@ public:
 		VIEWPORT_VRS_DISABLED,
 		VIEWPORT_VRS_TEXTURE,
 		VIEWPORT_VRS_XR,
+		VIEWPORT_VRS_ADAPTIVE,
 		VIEWPORT_VRS_MAX,
 	};
 
@@ -1345,6 +1370,8 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1359,6 +1386,18 @@ public:
 
 	virtual void instance_set_ignore_culling(RID p_instance, bool p_enabled) = 0;
 
+	// Bulk versions of the setters above, queued as a single command.
+	virtual void instances_set_transform(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) = 0;
+	virtual void instances_set_visible(const Vector<RID> &p_instances, bool p_visible) = 0;
+
+	void _instances_set_transform_bind(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms);
+	void _instances_set_visible_bind(const TypedArray<RID> &p_instances, bool p_visible);
+
+	// World space bounds of the instances, updated with any transform changes still pending.
+	virtual Vector<AABB> instances_get_aabb(const Vector<RID> &p_instances) const = 0;
+
+	PackedVector3Array _instances_get_aabb_bind(const TypedArray<RID> &p_instances) const;
+
 	// Don't use these in a game!
 	virtual Vector<ObjectID> instances_cull_aabb(const AABB &p_aabb, RID p_scenario = RID()) const = 0;
 	virtual Vector<ObjectID> instances_cull_ray(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario = RID()) const = 0;
@@ -1403,6 +1442,9 @@ public:
 	virtual Variant instance_geometry_get_shader_parameter_default_value(RID p_instance, const StringName &) const = 0;
 	virtual void instance_geometry_get_shader_parameter_list(RID p_instance, List<PropertyInfo> *p_parameters) const = 0;
 
+	virtual void instances_geometry_set_shader_parameter(const Vector<RID> &p_instances, const StringName &p_parameter, const Vector<Variant> &p_values) = 0;
+	void _instances_geometry_set_shader_parameter_bind(const TypedArray<RID> &p_instances, const StringName &p_parameter, const Array &p_values);
+
 	/* Bake 3D objects */
 
 	enum BakeChannels {
@@ -1680,6 +1722,11 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_PIPELINE_COMPILATIONS_PENDING,
+		RENDERING_INFO_PIPELINE_COMPILATIONS_COMPLETED,
+		RENDERING_INFO_TEXTURE_STORAGE_MEM_USED,
+		RENDERING_INFO_MESH_STORAGE_MEM_USED,
+		RENDERING_INFO_PARTICLES_STORAGE_MEM_USED,
 		RENDERING_INFO_MAX
 	};
 
@@ -1698,6 +1745,7 @@ public:
 	virtual void set_frame_profiling_enabled(bool p_enable) = 0;
 	virtual Vector<FrameProfileArea> get_frame_profile() = 0;
 	virtual uint64_t get_frame_profile_frame() = 0;
+	TypedArray<Dictionary> _get_frame_profile_bind();
 
 	virtual double get_frame_setup_time_cpu() const = 0;
 
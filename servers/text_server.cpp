@@ -2187,6 +2187,16 @@ bool TextServer::is_valid_letter(uint64_t p_unicode) const {
 	return is_unicode_letter(p_unicode);
 }
 
+void TextServer::font_prewarm_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	// Servers without background rasterization render the glyphs right away.
+	for (int i = 0; i < p_characters.length(); i++) {
+		int64_t index = font_get_glyph_index(p_font_rid, p_size.x, p_characters[i], 0);
+		if (index != 0) {
+			font_render_glyph(p_font_rid, p_size, index);
+		}
+	}
+}
+
 TextServer::TextServer() {
 	_init_diacritics_map();
 }
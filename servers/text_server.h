@@ -558,6 +558,16 @@ public:
 
 	virtual void cleanup() {}
 
+	// Statistics of the shaping results cache, for servers which have one.
+	virtual uint64_t shaped_text_get_cache_hits() const { return 0; }
+	virtual uint64_t shaped_text_get_cache_misses() const { return 0; }
+
+	// Background glyph rasterization, for servers which support it. Glyphs which are not ready are skipped when drawing.
+	virtual void set_async_glyph_rasterization(bool p_enabled) {}
+	virtual bool is_async_glyph_rasterization_enabled() const { return false; }
+	virtual uint64_t get_glyph_placeholder_count() const { return 0; } // Number of glyph draws skipped because the glyph wasn't rasterized yet.
+	virtual void font_prewarm_glyphs(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters);
+
 	TextServer();
 	~TextServer();
 };
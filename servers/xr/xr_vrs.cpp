@@ -111,7 +111,17 @@ RID XRVRS::make_vrs_texture(const Size2 &p_target_size, const PackedVector2Array
 	// For our standard VRS extension on Vulkan this means a maximum of 8x8.
 	// For the density map extension this scales depending on the max texel size.
 
-	if (target_size != vrs_sizei || eye_foci != p_eye_foci || vrs_dirty) {
+	// Eye foci are snapped to VRS texels, with eye tracking they change every frame
+	// but we only need to regenerate our image if the focal point moves to another texel.
+	int view_count = MIN(p_eye_foci.size(), RendererSceneRender::MAX_RENDER_VIEWS);
+	Vector<Vector2i> new_view_centers;
+	new_view_centers.resize(view_count);
+	for (int i = 0; i < view_count; i++) {
+		new_view_centers.write[i].x = int(vrs_size.x * (p_eye_foci[i].x + 1.0) * 0.5);
+		new_view_centers.write[i].y = int(vrs_size.y * (p_eye_foci[i].y + 1.0) * 0.5);
+	}
+
+	if (target_size != vrs_sizei || view_centers.size() != view_count || vrs_dirty || vrs_texture.is_null()) {
 		// Out with the old.
 		if (vrs_texture.is_valid()) {
 			RS::get_singleton()->free(vrs_texture);
@@ -121,28 +131,10 @@ RID XRVRS::make_vrs_texture(const Size2 &p_target_size, const PackedVector2Array
 		// In with the new.
 		Vector<Ref<Image>> images;
 		target_size = vrs_sizei;
-		eye_foci = p_eye_foci;
-
-		for (int i = 0; i < eye_foci.size() && i < RendererSceneRender::MAX_RENDER_VIEWS; i++) {
-			PackedByteArray data;
-			data.resize(vrs_sizei.x * vrs_sizei.y * 2);
-			uint8_t *data_ptr = data.ptrw();
-
-			Vector2i view_center;
-			view_center.x = int(vrs_size.x * (eye_foci[i].x + 1.0) * 0.5);
-			view_center.y = int(vrs_size.y * (eye_foci[i].y + 1.0) * 0.5);
-
-			int d = 0;
-			for (int y = 0; y < vrs_sizei.y; y++) {
-				for (int x = 0; x < vrs_sizei.x; x++) {
-					Vector2 offset = Vector2(x - view_center.x, y - view_center.y);
-					real_t density = 255.0 * MAX(0.0, (Math::abs(offset.x) - min_radius) / outer_radius);
-					data_ptr[d++] = MIN(255, density);
-					density = 255.0 * MAX(0.0, (Math::abs(offset.y) - min_radius) / outer_radius);
-					data_ptr[d++] = MIN(255, density);
-				}
-			}
-			images.push_back(Image::create_from_data(vrs_sizei.x, vrs_sizei.y, false, Image::FORMAT_RG8, data));
+		view_centers = new_view_centers;
+
+		for (int i = 0; i < view_count; i++) {
+			images.push_back(_make_vrs_image(vrs_sizei, view_centers[i], min_radius, outer_radius));
 		}
 
 		if (images.size() == 1) {
@@ -152,7 +144,34 @@ RID XRVRS::make_vrs_texture(const Size2 &p_target_size, const PackedVector2Array
 		}
 
 		vrs_dirty = false;
+	} else if (view_centers != new_view_centers) {
+		// Same size, only our focal points moved, update the layers that changed in place.
+		for (int i = 0; i < view_count; i++) {
+			if (view_centers[i] != new_view_centers[i]) {
+				RS::get_singleton()->texture_2d_update(vrs_texture, _make_vrs_image(vrs_sizei, new_view_centers[i], min_radius, outer_radius), i);
+			}
+		}
+		view_centers = new_view_centers;
 	}
 
 	return vrs_texture;
 }
+
+Ref<Image> XRVRS::_make_vrs_image(const Size2i &p_size, const Vector2i &p_view_center, real_t p_min_radius, real_t p_outer_radius) const {
+	PackedByteArray data;
+	data.resize(p_size.x * p_size.y * 2);
+	uint8_t *data_ptr = data.ptrw();
+
+	int d = 0;
+	for (int y = 0; y < p_size.y; y++) {
+		for (int x = 0; x < p_size.x; x++) {
+			Vector2 offset = Vector2(x - p_view_center.x, y - p_view_center.y);
+			real_t density = 255.0 * MAX(0.0, (Math::abs(offset.x) - p_min_radius) / p_outer_radius);
+			data_ptr[d++] = MIN(255, density);
+			density = 255.0 * MAX(0.0, (Math::abs(offset.y) - p_min_radius) / p_outer_radius);
+			data_ptr[d++] = MIN(255, density);
+		}
+	}
+
+	return Image::create_from_data(p_size.x, p_size.y, false, Image::FORMAT_RG8, data);
+}
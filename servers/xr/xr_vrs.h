@@ -31,6 +31,7 @@
 #ifndef XR_VRS_H
 #define XR_VRS_H
 
+#include "core/io/image.h"
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/templates/rid.h"
@@ -48,7 +49,9 @@ private:
 
 	RID vrs_texture;
 	Size2i target_size;
-	PackedVector2Array eye_foci;
+	Vector<Vector2i> view_centers;
+
+	Ref<Image> _make_vrs_image(const Size2i &p_size, const Vector2i &p_view_center, real_t p_min_radius, real_t p_outer_radius) const;
 
 protected:
 	static void _bind_methods();
@@ -107,6 +107,42 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped read") {
+	const String path = TestUtils::get_data_path("testdata.csv");
+	Vector<uint8_t> expected = FileAccess::get_file_as_bytes(path);
+	REQUIRE(expected.size() > 8);
+
+	Ref<FileAccess> f = FileAccess::open_mapped(path);
+	REQUIRE(!f.is_null());
+	CHECK(f->get_length() == (uint64_t)expected.size());
+
+	Vector<uint8_t> data;
+	data.resize(expected.size());
+	CHECK(f->get_buffer(data.ptrw(), data.size()) == (uint64_t)expected.size());
+	CHECK(data == expected);
+	CHECK(!f->eof_reached());
+
+	// Reading past the end behaves like a buffered file.
+	CHECK(f->get_8() == 0);
+	CHECK(f->eof_reached());
+
+	f->seek(4);
+	CHECK(f->get_8() == expected[4]);
+
+	// Mapping is optional, but when available it must expose the whole file.
+	const uint8_t *mapped = f->get_mapped_data();
+	if (mapped) {
+		CHECK(memcmp(mapped, expected.ptr(), expected.size()) == 0);
+	}
+
+	// Opening the same file again shares the mapping but not the position.
+	Ref<FileAccess> f2 = FileAccess::open_mapped(path);
+	REQUIRE(!f2.is_null());
+	CHECK(f2->get_position() == 0);
+	CHECK(f2->get_8() == expected[0]);
+	CHECK(f->get_position() == 5);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
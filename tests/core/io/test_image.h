@@ -221,6 +221,54 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+TEST_CASE("[Image] Large image mipmaps and resizing") {
+	// Large enough to be split across worker threads.
+	const int size = 1024;
+	PackedByteArray data;
+	data.resize(size * size * 4);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i * 7 + (i >> 12) * 13) & 0xFF;
+	}
+	Ref<Image> image = memnew(Image(size, size, false, Image::FORMAT_RGBA8, data));
+
+	image->generate_mipmaps();
+	REQUIRE(image->has_mipmaps());
+
+	int64_t mip_offset = 0;
+	int64_t mip_size = 0;
+	image->get_mipmap_offset_and_size(1, mip_offset, mip_size);
+	const uint8_t *r = image->get_data().ptr();
+	const uint8_t *mip = r + mip_offset;
+	bool matches = true;
+	for (int y = 0; y < size / 2 && matches; y++) {
+		for (int x = 0; x < size / 2 && matches; x++) {
+			for (int c = 0; c < 4; c++) {
+				const uint8_t *up = r + ((y * 2) * size + x * 2) * 4 + c;
+				const uint8_t *down = up + size * 4;
+				int expected = (up[0] + up[4] + down[0] + down[4] + 2) >> 2;
+				if (mip[(y * (size / 2) + x) * 4 + c] != expected) {
+					matches = false;
+					break;
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(matches, "The first mipmap should be the rounded average of each 2x2 block.");
+
+	// A uniform image must stay uniform, whatever the interpolation and however the rows are split.
+	Ref<Image> uniform = memnew(Image(size, size, false, Image::FORMAT_RGBA8));
+	uniform->fill(Color::hex(0x285078ff));
+	for (int i = 0; i < 5; i++) {
+		Ref<Image> image_resized = memnew(Image());
+		image_resized->copy_internals_from(uniform);
+		image_resized->resize(size / 2 + 3, size / 3, static_cast<Image::Interpolation>(i));
+		CHECK(image_resized->get_pixel(0, 0).to_rgba32() == Color::hex(0x285078ff).to_rgba32());
+		CHECK(image_resized->get_pixel(size / 4, size / 6).to_rgba32() == Color::hex(0x285078ff).to_rgba32());
+		CHECK(image_resized->get_pixel(size / 2 + 2, size / 3 - 1).to_rgba32() == Color::hex(0x285078ff).to_rgba32());
+	}
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
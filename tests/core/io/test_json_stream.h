@@ -0,0 +1,203 @@
+/**************************************************************************/
+/*  test_json_stream.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_JSON_STREAM_H
+#define TEST_JSON_STREAM_H
+
+#include "core/io/json.h"
+#include "core/io/json_stream.h"
+
+#include "tests/test_utils.h"
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestJSONStream {
+
+// Reads the next token, feeding the remaining data one byte at a time whenever the parser needs more.
+static Error read_fed_bytewise(JSONStreamParser &p_parser, const CharString &p_json, int &r_fed) {
+	while (true) {
+		Error err = p_parser.read();
+		if (err != ERR_UNAVAILABLE) {
+			return err;
+		}
+		if (r_fed < p_json.length()) {
+			p_parser.feed_buffer((const uint8_t *)&p_json[r_fed], 1);
+			r_fed++;
+		} else {
+			p_parser.end_data();
+		}
+	}
+}
+
+TEST_CASE("[JSONStreamParser] Tokens of a document fed one byte at a time") {
+	const CharString json = String("{\"name\": \"G\\u00f6dot \\ud83d\\ude00\", \"list\": [1, -2.5e2, true, false, null, []], \"nested\": {}}").utf8();
+
+	JSONStreamParser parser;
+	int fed = 0;
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_OBJECT_BEGIN);
+	CHECK(parser.get_depth() == 1);
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_KEY);
+	CHECK(parser.get_value() == Variant("name"));
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_VALUE);
+	CHECK(parser.get_value() == Variant(String::utf8("G\xc3\xb6" "dot \xf0\x9f\x98\x80")));
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_value() == Variant("list"));
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_ARRAY_BEGIN);
+	CHECK(parser.get_depth() == 2);
+
+	const Variant values[] = { 1.0, -250.0, true, false, Variant() };
+	for (const Variant &value : values) {
+		CHECK(read_fed_bytewise(parser, json, fed) == OK);
+		CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_VALUE);
+		CHECK(parser.get_value() == value);
+	}
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_ARRAY_BEGIN);
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_ARRAY_END);
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_ARRAY_END);
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_value() == Variant("nested"));
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_OBJECT_BEGIN);
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_OBJECT_END);
+
+	CHECK(read_fed_bytewise(parser, json, fed) == OK);
+	CHECK(parser.get_token_type() == JSONStreamParser::TOKEN_OBJECT_END);
+	CHECK(parser.get_depth() == 0);
+
+	CHECK(read_fed_bytewise(parser, json, fed) == ERR_FILE_EOF);
+}
+
+TEST_CASE("[JSONStreamParser] Values at the end of the data") {
+	JSONStreamParser parser;
+	parser.feed_data(String("12").to_utf8_buffer());
+	CHECK_MESSAGE(parser.read() == ERR_UNAVAILABLE, "A number may continue in the next chunk.");
+	parser.feed_data(String("34").to_utf8_buffer());
+	parser.end_data();
+	CHECK(parser.read() == OK);
+	CHECK(parser.get_value() == Variant(1234.0));
+	CHECK(parser.read() == ERR_FILE_EOF);
+}
+
+TEST_CASE("[JSONStreamParser] Parse errors") {
+	const char *invalid[] = {
+		"[1, 2",
+		"[1 2]",
+		"{\"a\" 1}",
+		"{1: 2}",
+		"[01]",
+		"[1.]",
+		"[nope]",
+		"\"unterminated",
+		"\"\\x\"",
+		"\"\\ud83d\"",
+		"[] []",
+	};
+
+	ERR_PRINT_OFF;
+	for (const char *json : invalid) {
+		JSONStreamParser parser;
+		parser.feed_data(String(json).to_utf8_buffer());
+		parser.end_data();
+		Error err = OK;
+		while (err == OK) {
+			err = parser.read();
+		}
+		CHECK_MESSAGE(err == ERR_PARSE_ERROR, vformat("Parsing `%s` should fail.", json));
+		CHECK(!parser.get_error_message().is_empty());
+	}
+	ERR_PRINT_ON;
+
+	JSONStreamParser parser;
+	parser.feed_data(String("[\n1,\n2 3]").to_utf8_buffer());
+	parser.end_data();
+	while (parser.read() == OK) {
+	}
+	CHECK(parser.get_current_line() == 3);
+}
+
+TEST_CASE("[JSONStreamWriter] Output matches JSON.stringify()") {
+	Dictionary dict;
+	dict["b"] = 1;
+	dict["a"] = 0.5;
+	dict["c"] = Array();
+	Array arr;
+	arr.push_back("text with \"quotes\"");
+	arr.push_back(Variant());
+	arr.push_back(false);
+	dict["d"] = arr;
+
+	const String path = TestUtils::get_temp_path("json_stream.json");
+	for (const String &indent : { String(), String("\t") }) {
+		JSONStreamWriter writer;
+		CHECK(writer.open(FileAccess::open(path, FileAccess::WRITE), indent) == OK);
+		writer.write_value(dict);
+		CHECK(writer.close() == OK);
+
+		CHECK(FileAccess::get_file_as_string(path) == JSON::stringify(dict, indent));
+	}
+
+	JSONStreamWriter writer;
+	CHECK(writer.open(FileAccess::open(path, FileAccess::WRITE)) == OK);
+	writer.begin_object();
+	writer.write_key("items");
+	writer.begin_array();
+	for (int i = 0; i < 3; i++) {
+		writer.write_value(i);
+	}
+	writer.end_array();
+	writer.write_key("count");
+	writer.write_value(3);
+	writer.end_object();
+	CHECK(writer.close() == OK);
+	CHECK(FileAccess::get_file_as_string(path) == "{\"items\":[0,1,2],\"count\":3}");
+
+	ERR_PRINT_OFF;
+	CHECK(writer.open(FileAccess::open(path, FileAccess::WRITE)) == OK);
+	writer.begin_array();
+	writer.write_key("not in an object");
+	CHECK_MESSAGE(writer.close() == ERR_INVALID_DATA, "Closing with an unterminated array should fail.");
+	ERR_PRINT_ON;
+}
+
+} // namespace TestJSONStream
+
+#endif // TEST_JSON_STREAM_H
@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  test_logger.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_LOGGER_H
+#define TEST_LOGGER_H
+
+#include "core/io/logger.h"
+#include "core/object/worker_thread_pool.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestLogger {
+
+class CaptureLogger : public Logger {
+public:
+	Mutex mutex;
+	Vector<String> lines;
+	int errors = 0;
+	int flushes = 0;
+
+	virtual void logv(const char *p_format, va_list p_list, bool p_err) override _PRINTF_FORMAT_ATTRIBUTE_2_0 {
+		char buf[256];
+		vsnprintf(buf, sizeof(buf), p_format, p_list);
+		MutexLock lock(mutex);
+		lines.push_back(String(buf));
+		if (p_err) {
+			errors++;
+		}
+	}
+
+	virtual void flush() override {
+		MutexLock lock(mutex);
+		flushes++;
+	}
+};
+
+TEST_CASE("[Logger] CompositeLogger forwards messages synchronously") {
+	CaptureLogger *capture = memnew(CaptureLogger);
+	Vector<Logger *> loggers;
+	loggers.push_back(capture);
+	CompositeLogger *composite = memnew(CompositeLogger(loggers));
+
+	composite->logf("value: %d\n", 42);
+	composite->logf_error("failed\n");
+	REQUIRE_EQ(capture->lines.size(), 2);
+	CHECK_EQ(capture->lines[0], "value: 42\n");
+	CHECK_EQ(capture->lines[1], "failed\n");
+	CHECK_EQ(capture->errors, 1);
+
+	memdelete(composite);
+}
+
+#ifdef THREADS_ENABLED
+static CompositeLogger *async_logger = nullptr;
+
+static void log_from_thread(void *p_userdata, uint32_t p_index) {
+	async_logger->logf("line %u\n", p_index);
+}
+
+TEST_CASE("[Logger] CompositeLogger writes every message in async mode") {
+	CaptureLogger *capture = memnew(CaptureLogger);
+	Vector<Logger *> loggers;
+	loggers.push_back(capture);
+	async_logger = memnew(CompositeLogger(loggers));
+	async_logger->set_async(true);
+	CHECK(async_logger->is_async());
+
+	const uint32_t count = 1000;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&log_from_thread, nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	async_logger->logf_error("error after lines\n");
+
+	// Stopping the background thread writes out everything still queued.
+	async_logger->set_async(false);
+	CHECK_FALSE(async_logger->is_async());
+
+	REQUIRE_EQ(capture->lines.size(), int(count + 1));
+	CHECK_EQ(capture->lines[count], "error after lines\n");
+	CHECK_EQ(capture->errors, 1);
+	CHECK(capture->flushes > 0);
+
+	HashSet<String> seen;
+	for (uint32_t i = 0; i < count; i++) {
+		seen.insert(capture->lines[i]);
+	}
+	CHECK_EQ(seen.size(), count);
+
+	// flush_sync() is what crash paths use, it must leave the logger synchronous.
+	async_logger->set_async(true);
+	async_logger->logf("before crash\n");
+	async_logger->flush_sync();
+	CHECK_FALSE(async_logger->is_async());
+	async_logger->logf("after crash\n");
+	CHECK_EQ(capture->lines[capture->lines.size() - 1], "after crash\n");
+
+	memdelete(async_logger);
+	async_logger = nullptr;
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestLogger
+
+#endif // TEST_LOGGER_H
@@ -386,6 +386,42 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Encoding into a reused buffer") {
+	Array array;
+	array.push_back(String::utf8("\xe2\x82\xac uro"));
+	array.push_back(StringName("name"));
+	array.push_back(NodePath("a/b:c"));
+	array.push_back(Transform3D(Basis(), Vector3(1, 2, 3)));
+	array.push_back(PackedByteArray({ 1, 2, 3 }));
+	array.push_back(PackedStringArray({ "one", "two" }));
+	array.push_back(PackedVector3Array({ Vector3(1, 2, 3) }));
+	array.push_back(PackedColorArray({ Color(1, 0, 0) }));
+	array.push_back(PackedFloat64Array({ 0.5, 1.5 }));
+	Dictionary dict;
+	dict["key"] = 1.0 / 3.0;
+	dict[5] = Variant();
+	array.push_back(dict);
+
+	int expected_len;
+	REQUIRE(encode_variant(array, nullptr, expected_len) == OK);
+	Vector<uint8_t> expected;
+	expected.resize(expected_len);
+	REQUIRE(encode_variant(array, expected.ptrw(), expected_len) == OK);
+
+	Vector<uint8_t> buffer;
+	int len;
+	for (int offset : { 0, 0, 6 }) {
+		CHECK(encode_variant_to_buffer(array, buffer, offset, len) == OK);
+		REQUIRE(len == expected_len);
+		CHECK(buffer.size() >= offset + len);
+		CHECK(memcmp(buffer.ptr() + offset, expected.ptr(), len) == 0);
+	}
+
+	Variant decoded;
+	CHECK(decode_variant(decoded, buffer.ptr() + 6, len) == OK);
+	CHECK(decoded == Variant(array));
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
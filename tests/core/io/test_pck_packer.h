@@ -31,6 +31,7 @@
 #ifndef TEST_PCK_PACKER_H
 #define TEST_PCK_PACKER_H
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
@@ -117,6 +118,76 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack compressed files") {
+	// Text that compresses well, spanning several compression blocks.
+	const String source_path = TestUtils::get_temp_path("compressible.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		for (int i = 0; i < 20000; i++) {
+			f->store_line(vformat("Line %d of a very repetitive file.", i % 100));
+		}
+	}
+	const uint64_t source_length = FileAccess::get_file_as_bytes(source_path).size();
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compress_files(true);
+	CHECK(pck_packer.is_compress_files_enabled());
+	CHECK(pck_packer.add_file("compressible.txt", source_path) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK_MESSAGE(
+			f->get_length() < source_length / 4,
+			"The repetitive file should be stored compressed.");
+}
+
+TEST_CASE("[PCKPacker] Compressed file blocks are seekable") {
+	Vector<uint8_t> data;
+	data.resize(PACK_FILE_COMPRESSED_BLOCK_SIZE * 3 + 123);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i / 7) % 251;
+	}
+
+	Vector<uint8_t> compressed = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_FILE_COMPRESSED_BLOCK_SIZE);
+	REQUIRE(!compressed.is_empty());
+	CHECK(compressed.size() < data.size());
+
+	const String compressed_path = TestUtils::get_temp_path("compressed_blocks.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(compressed_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(compressed);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(compressed_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	uint8_t magic[4];
+	f->get_buffer(magic, 4);
+	CHECK(memcmp(magic, PACK_FILE_COMPRESSED_MAGIC, 4) == 0);
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	REQUIRE(fac->open_after_magic(f) == OK);
+	CHECK(fac->get_length() == (uint64_t)data.size());
+
+	// Jump straight into the last, partial block and back into the first one.
+	const uint64_t tail = PACK_FILE_COMPRESSED_BLOCK_SIZE * 3 + 100;
+	fac->seek(tail);
+	CHECK(fac->get_8() == data[tail]);
+	fac->seek(10);
+	CHECK(fac->get_8() == data[10]);
+
+	Vector<uint8_t> read_back;
+	read_back.resize(data.size());
+	fac->seek(0);
+	CHECK(fac->get_buffer(read_back.ptrw(), read_back.size()) == (uint64_t)data.size());
+	CHECK(read_back == data);
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
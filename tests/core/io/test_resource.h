@@ -166,6 +166,58 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+class SizedResource : public Resource {
+public:
+	uint64_t size = 0;
+	virtual uint64_t get_memory_usage() const override { return size; }
+	SizedResource(uint64_t p_size) :
+			size(p_size) {}
+};
+
+TEST_CASE("[Resource] Retained cache") {
+	ResourceCache::set_retained_budget(100);
+
+	Ref<SizedResource> resource_a = memnew(SizedResource(60));
+	resource_a->set_path("res://retained_a.res");
+	Ref<SizedResource> resource_b = memnew(SizedResource(60));
+	resource_b->set_path("res://retained_b.res");
+	ResourceCache::retain(resource_a);
+	ResourceCache::retain(resource_b);
+	CHECK_MESSAGE(
+			ResourceCache::get_retained_usage() == 120,
+			"Resources still in use should not be evicted, even when over budget.");
+
+	ObjectID id_a = resource_a->get_instance_id();
+	resource_a.unref();
+	CHECK_MESSAGE(
+			ResourceCache::has("res://retained_a.res"),
+			"The retained cache should keep the resource alive.");
+
+	Ref<SizedResource> resource_c = memnew(SizedResource(60));
+	resource_c->set_path("res://retained_c.res");
+	ResourceCache::retain(resource_c);
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(id_a) == nullptr,
+			"The resource only used by the retained cache should be evicted once over budget.");
+	CHECK(ResourceCache::get_retained_usage() == 120);
+
+	resource_b->set_cache_priority(Resource::CACHE_PRIORITY_HIGH);
+	ResourceCache::retain(resource_b);
+	ObjectID id_b = resource_b->get_instance_id();
+	ObjectID id_c = resource_c->get_instance_id();
+	resource_b.unref();
+	resource_c.unref();
+	ResourceCache::set_retained_budget(60);
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(id_c) == nullptr,
+			"Lower priority resources should be evicted first.");
+	CHECK(ObjectDB::get_instance(id_b) != nullptr);
+
+	ResourceCache::set_retained_budget(0);
+	CHECK(ObjectDB::get_instance(id_b) == nullptr);
+	CHECK(ResourceCache::get_retained_usage() == 0);
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
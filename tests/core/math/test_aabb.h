@@ -32,6 +32,7 @@
 #define TEST_AABB_H
 
 #include "core/math/aabb.h"
+#include "core/math/transform_3d.h"
 
 #include "tests/test_macros.h"
 
@@ -480,6 +481,21 @@ TEST_CASE("[AABB] Finite number checks") {
 			"AABB with two components infinite should not be finite.");
 }
 
+TEST_CASE("[AABB] Batch transform") {
+	const Transform3D xforms[3] = {
+		Transform3D(),
+		Transform3D(Basis(Vector3(0, 1, 0), Math_PI / 4), Vector3(1, 2, 3)),
+		Transform3D(Basis(-2, 0, 0, 0, 1, 1, 0, 0, 3), Vector3(-5, 0, 5)),
+	};
+	AABB aabbs[3] = { AABB(Vector3(-1, -1, -1), Vector3(2, 2, 2)), AABB(Vector3(1, 2, 3), Vector3(4, 5, 6)), AABB(Vector3(0, 0, 0), Vector3(1, 0, 2)) };
+
+	AABB transformed[3];
+	AABB::xform_batch(xforms, aabbs, transformed, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK_MESSAGE(transformed[i].is_equal_approx(xforms[i].xform(aabbs[i])), "Batch transformed AABBs should match transforming them one by one.");
+	}
+}
+
 } // namespace TestAABB
 
 #endif // TEST_AABB_H
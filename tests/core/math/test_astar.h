@@ -32,6 +32,8 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -85,6 +87,92 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] Update points between queries") {
+	AStar3D a;
+	// 0 - 1 - 2
+	//  \     /
+	//   - 3 -
+	a.add_point(0, Vector3(0, 0, 0));
+	a.add_point(1, Vector3(1, 0, 0));
+	a.add_point(2, Vector3(2, 0, 0));
+	a.add_point(3, Vector3(1, 1, 0));
+	a.connect_points(0, 1);
+	a.connect_points(1, 2);
+	a.connect_points(0, 3);
+	a.connect_points(3, 2);
+
+	Vector<int64_t> path = a.get_id_path(0, 2);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 1);
+
+	// Point changes after the first query must be seen by the next ones.
+	a.set_point_weight_scale(1, 10.0);
+	path = a.get_id_path(0, 2);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 3);
+
+	a.set_point_disabled(3);
+	path = a.get_id_path(0, 2);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 1);
+
+	a.set_point_disabled(1);
+	CHECK(a.get_id_path(0, 2).is_empty());
+	path = a.get_id_path(0, 2, true);
+	REQUIRE(path.size() == 1);
+	CHECK(path[0] == 0);
+
+	a.set_point_disabled(3, false);
+	a.set_point_position(3, Vector3(1, 5, 0));
+	Vector<Vector3> point_path = a.get_point_path(0, 2);
+	REQUIRE(point_path.size() == 3);
+	CHECK(point_path[1] == Vector3(1, 5, 0));
+
+	// Connection changes.
+	a.disconnect_points(3, 2);
+	CHECK(a.get_id_path(0, 2).is_empty());
+	a.add_point(4, Vector3(2, 2, 0));
+	a.connect_points(3, 4);
+	a.connect_points(4, 2);
+	path = a.get_id_path(0, 2);
+	REQUIRE(path.size() == 4);
+	CHECK(path[2] == 4);
+}
+
+static AStar2D *concurrent_astar = nullptr;
+static Vector<int64_t> concurrent_paths[64];
+
+static void concurrent_astar_query(void *p_userdata, uint32_t p_index) {
+	concurrent_paths[p_index] = concurrent_astar->get_id_path(p_index % 8, 63 - p_index % 8);
+}
+
+TEST_CASE("[AStar2D] Concurrent queries") {
+	// 8x8 grid graph, queried from several threads at once.
+	AStar2D a;
+	for (int y = 0; y < 8; y++) {
+		for (int x = 0; x < 8; x++) {
+			a.add_point(y * 8 + x, Vector2(x, y));
+			if (x > 0) {
+				a.connect_points(y * 8 + x, y * 8 + x - 1);
+			}
+			if (y > 0) {
+				a.connect_points(y * 8 + x, (y - 1) * 8 + x);
+			}
+		}
+	}
+
+	concurrent_astar = &a;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(concurrent_astar_query, nullptr, 64, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	concurrent_astar = nullptr;
+
+	for (int i = 0; i < 64; i++) {
+		Vector<int64_t> expected = a.get_id_path(i % 8, 63 - i % 8);
+		CHECK_MESSAGE(concurrent_paths[i] == expected, vformat("Query %d matches the single threaded result.", i));
+		concurrent_paths[i].clear();
+	}
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -357,6 +445,64 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+static real_t get_grid_path_length(const Vector<Vector2> &p_path) {
+	real_t length = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
+TEST_CASE("[AStarGrid2D] Find paths") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 32, 32));
+	grid->update();
+
+	TypedArray<Vector2i> path = grid->get_id_path(Vector2i(0, 0), Vector2i(3, 4));
+	REQUIRE(path.size() == 5);
+	CHECK(Vector2i(path[0]) == Vector2i(0, 0));
+	CHECK(Vector2i(path[3]) == Vector2i(3, 3));
+	CHECK(Vector2i(path[4]) == Vector2i(3, 4));
+
+	SUBCASE("Solid points should block the path") {
+		grid->fill_solid_region(Rect2i(10, 0, 1, 32));
+		CHECK(grid->is_point_solid(Vector2i(10, 5)));
+		CHECK(grid->get_id_path(Vector2i(0, 0), Vector2i(20, 0)).is_empty());
+
+		TypedArray<Vector2i> partial_path = grid->get_id_path(Vector2i(0, 0), Vector2i(20, 0), true);
+		REQUIRE(partial_path.size() > 0);
+		CHECK(Vector2i(partial_path[partial_path.size() - 1]) == Vector2i(9, 0));
+	}
+
+	SUBCASE("Weight scales should default to one") {
+		CHECK(grid->get_point_weight_scale(Vector2i(1, 1)) == doctest::Approx(1.0));
+		grid->set_point_weight_scale(Vector2i(1, 1), 3.0);
+		CHECK(grid->get_point_weight_scale(Vector2i(1, 1)) == doctest::Approx(3.0));
+		CHECK(grid->get_point_weight_scale(Vector2i(2, 2)) == doctest::Approx(1.0));
+	}
+
+	SUBCASE("Jumping should find paths as short as the plain search") {
+		grid->fill_solid_region(Rect2i(8, 0, 1, 24));
+		grid->fill_solid_region(Rect2i(16, 8, 1, 24));
+		grid->fill_solid_region(Rect2i(20, 4, 8, 1));
+
+		const AStarGrid2D::DiagonalMode modes[] = { AStarGrid2D::DIAGONAL_MODE_ALWAYS, AStarGrid2D::DIAGONAL_MODE_NEVER };
+		for (AStarGrid2D::DiagonalMode mode : modes) {
+			grid->set_diagonal_mode(mode);
+
+			grid->set_jumping_enabled(false);
+			const Vector<Vector2> plain_path = grid->get_point_path(Vector2i(0, 0), Vector2i(31, 0));
+			grid->set_jumping_enabled(true);
+			const Vector<Vector2> jump_path = grid->get_point_path(Vector2i(0, 0), Vector2i(31, 0));
+
+			REQUIRE(plain_path.size() > 0);
+			REQUIRE(jump_path.size() > 0);
+			CHECK_MESSAGE(get_grid_path_length(jump_path) == doctest::Approx(get_grid_path_length(plain_path)), vformat("Diagonal mode %d.", mode));
+		}
+	}
+}
 } // namespace TestAStar
 
 #endif // TEST_ASTAR_H
@@ -420,6 +420,22 @@ TEST_CASE("[Basis] Is rotation checks") {
 			"Edge case: Basis with all zeroes should return false for is_rotation, because it is not just a rotation (has a scale of 0).");
 }
 
+TEST_CASE("[Basis] Batch multiplication") {
+	Basis a[3] = { Basis(), Basis(Vector3(1, 0, 0), 0.3), Basis(1, 2, 3, 4, 5, 6, 7, 8, 10) };
+	Basis b[3] = { Basis(2, 0, 0, 0, 3, 0, 0, 0, 4), Basis(Vector3(0, 0, 1), -1.2), Basis(-1, 0.5, 2, 3, 0, 1, 0, 1, 1) };
+	Basis products[3];
+	Basis::mul_batch(a, b, products, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(products[i].is_equal_approx(a[i] * b[i]));
+	}
+
+	// Multiply in place.
+	Basis::mul_batch(a, b, b, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(b[i].is_equal_approx(products[i]));
+	}
+}
+
 } // namespace TestBasis
 
 #endif // TEST_BASIS_H
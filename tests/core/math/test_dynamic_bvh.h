@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*  test_dynamic_bvh.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_DYNAMIC_BVH_H
+#define TEST_DYNAMIC_BVH_H
+
+#include "core/math/dynamic_bvh.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestDynamicBVH {
+
+struct CollectQuery {
+	LocalVector<int> hits;
+	bool operator()(void *p_data) {
+		hits.push_back(int(intptr_t(p_data)));
+		return false;
+	}
+};
+
+static LocalVector<int> brute_force(const LocalVector<AABB> &p_boxes, const AABB &p_query) {
+	LocalVector<int> hits;
+	for (uint32_t i = 0; i < p_boxes.size(); i++) {
+		if (p_boxes[i].intersects_inclusive(p_query)) {
+			hits.push_back(i);
+		}
+	}
+	return hits;
+}
+
+static bool same_hits(LocalVector<int> p_a, LocalVector<int> p_b) {
+	p_a.sort();
+	p_b.sort();
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_a.size(); i++) {
+		if (p_a[i] != p_b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool queries_match(DynamicBVH &p_bvh, const LocalVector<AABB> &p_boxes) {
+	const AABB queries[] = {
+		AABB(Vector3(-100, -100, -100), Vector3(200, 200, 200)),
+		AABB(Vector3(0, 0, 0), Vector3(3, 3, 3)),
+		AABB(Vector3(5.5, -1, 2.5), Vector3(4, 2, 4)),
+		AABB(Vector3(50, 50, 50), Vector3(1, 1, 1)),
+	};
+	for (const AABB &query : queries) {
+		CollectQuery result;
+		p_bvh.aabb_query(query, result);
+		if (!same_hits(result.hits, brute_force(p_boxes, query))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[DynamicBVH] Update and batched refit keep queries exact") {
+	DynamicBVH bvh;
+	LocalVector<AABB> boxes;
+	LocalVector<DynamicBVH::ID> ids;
+	for (int i = 0; i < 10; i++) {
+		for (int j = 0; j < 10; j++) {
+			AABB box(Vector3(i, 0, j), Vector3(0.5, 0.5, 0.5));
+			boxes.push_back(box);
+			ids.push_back(bvh.insert(box, (void *)intptr_t(boxes.size() - 1)));
+		}
+	}
+	CHECK(bvh.get_leaf_count() == 100);
+	CHECK(queries_match(bvh, boxes));
+
+	// Small moves that stay inside the parent volume.
+	for (uint32_t i = 0; i < boxes.size(); i++) {
+		boxes[i].size = Vector3(0.25, 0.25, 0.25);
+		bvh.update(ids[i], boxes[i]);
+	}
+	CHECK(queries_match(bvh, boxes));
+
+	// Enough rounds of refits to trigger a rebuild of the tree along the way.
+	for (int round = 0; round < 40; round++) {
+		for (uint32_t i = 0; i < boxes.size(); i++) {
+			boxes[i].position += Vector3(Math::sin(real_t(i + round)), 0.1, Math::cos(real_t(i * 3 + round))) * 0.2;
+			bvh.refit(ids[i], boxes[i]);
+		}
+		bvh.finish_refit();
+		if (round % 10 == 0) {
+			CHECK(queries_match(bvh, boxes));
+		}
+	}
+	CHECK(queries_match(bvh, boxes));
+	CHECK(bvh.get_leaf_count() == 100);
+}
+
+TEST_CASE("[DynamicBVH] Convex query") {
+	DynamicBVH bvh;
+	LocalVector<AABB> boxes;
+	for (int i = -10; i < 10; i++) {
+		AABB box(Vector3(i, i * 0.5, -i), Vector3(1, 1, 1));
+		boxes.push_back(box);
+		bvh.insert(box, (void *)intptr_t(boxes.size() - 1));
+	}
+
+	// A box shaped convex volume, from -3 to 3 on every axis.
+	const AABB volume(Vector3(-3, -3, -3), Vector3(6, 6, 6));
+	const Plane planes[6] = {
+		Plane(Vector3(1, 0, 0), 3),
+		Plane(Vector3(-1, 0, 0), 3),
+		Plane(Vector3(0, 1, 0), 3),
+		Plane(Vector3(0, -1, 0), 3),
+		Plane(Vector3(0, 0, 1), 3),
+		Plane(Vector3(0, 0, -1), 3),
+	};
+	Vector3 points[8];
+	for (int i = 0; i < 8; i++) {
+		points[i] = volume.get_endpoint(i);
+	}
+
+	CollectQuery result;
+	bvh.convex_query(planes, 6, points, 8, result);
+	CHECK(same_hits(result.hits, brute_force(boxes, volume)));
+	CHECK(result.hits.size() > 0);
+}
+
+} // namespace TestDynamicBVH
+
+#endif // TEST_DYNAMIC_BVH_H
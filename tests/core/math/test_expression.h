@@ -321,6 +321,64 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+static Array make_inputs(const Variant &p_a, const Variant &p_b) {
+	Array inputs;
+	inputs.push_back(p_a);
+	inputs.push_back(p_b);
+	return inputs;
+}
+
+TEST_CASE("[Expression] Repeated and batched execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("a");
+	parameter_names.push_back("b");
+	CHECK_MESSAGE(
+			expression.parse("a * 2 + 8 / b - sqrt(16)", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	// Changing the input types must not reuse the evaluators of the previous types.
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(3, 8))) == 3,
+			"The expression should return the expected value.");
+	CHECK_MESSAGE(
+			double(expression.execute(make_inputs(1.5, 16.0))) == doctest::Approx(-0.5),
+			"The expression should return the expected value.");
+
+	ERR_PRINT_OFF;
+	expression.execute(make_inputs(1, 0));
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Integer division by zero should still fail.");
+	ERR_PRINT_ON;
+
+	TypedArray<Array> batch;
+	batch.push_back(make_inputs(1, 4));
+	batch.push_back(make_inputs(2, 0));
+	batch.push_back(make_inputs(3, 8));
+	ERR_PRINT_OFF;
+	Array results = expression.execute_batch(batch);
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(
+			results.size() == 3,
+			"There should be one result for each array of inputs.");
+	CHECK(expression.has_execute_failed());
+	CHECK(int(results[0]) == 0);
+	CHECK(results[1].get_type() == Variant::NIL);
+	CHECK(int(results[2]) == 3);
+
+	CHECK_MESSAGE(
+			expression.parse("[a, b].size() + Vector2(1, 2).x", parameter_names) == OK,
+			"The expression should parse successfully.");
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(1, 2))) == 3,
+			"Arrays should be built again on each execution.");
+	CHECK_MESSAGE(
+			int(expression.execute(make_inputs(1, 2))) == 3,
+			"Arrays should be built again on each execution.");
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
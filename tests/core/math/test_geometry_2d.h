@@ -615,6 +615,66 @@ TEST_CASE("[Geometry2D] Exclude polygons") {
 	}
 }
 
+static real_t polygon_area(const Vector<Point2> &p_polygon) {
+	real_t area = 0;
+	for (int i = 0; i < p_polygon.size(); i++) {
+		area += p_polygon[i].cross(p_polygon[(i + 1) % p_polygon.size()]);
+	}
+	return Math::abs(area) * 0.5;
+}
+
+TEST_CASE("[Geometry2D] Batched polygon operations") {
+	Vector<Point2> a = { Point2(0, 0), Point2(100, 0), Point2(100, 100), Point2(0, 100) };
+	Vector<Point2> b = { Point2(50, 0), Point2(150, 0), Point2(150, 100), Point2(50, 100) };
+	Vector<Point2> c = { Point2(25, 25), Point2(75, 25), Point2(75, 75), Point2(25, 75) };
+	Vector<Vector<Point2>> r;
+
+	SUBCASE("[Geometry2D] No polygons") {
+		r = Geometry2D::merge_many_polygons(Vector<Vector<Point2>>());
+		CHECK_MESSAGE(r.is_empty(), "Merging no polygons should result in no polygons.");
+	}
+
+	SUBCASE("[Geometry2D] Merge overlapping polygons of opposite winding") {
+		b.reverse();
+		r = Geometry2D::merge_many_polygons({ a, b });
+		REQUIRE_MESSAGE(r.size() == 1, "The merged polygons should result in 1 polygon.");
+		REQUIRE_MESSAGE(r[0].size() == 4, "The resulting merged polygon should have 4 vertices.");
+		CHECK(Math::is_equal_approx(polygon_area(r[0]), (real_t)15000));
+	}
+
+	SUBCASE("[Geometry2D] Clip a hole out of merged polygons") {
+		r = Geometry2D::clip_many_polygons({ a, b }, { c });
+		REQUIRE_MESSAGE(r.size() == 2, "Clipping should result in 2 polygons (outline and hole).");
+		CHECK(!Geometry2D::is_polygon_clockwise(r[0]));
+		CHECK(Geometry2D::is_polygon_clockwise(r[1]));
+	}
+
+	SUBCASE("[Geometry2D] Intersect merged polygons") {
+		r = Geometry2D::intersect_many_polygons({ a }, { b, c });
+		REQUIRE_MESSAGE(r.size() == 1, "The intersection should result in 1 polygon.");
+		CHECK(Math::is_equal_approx(polygon_area(r[0]), (real_t)6250));
+	}
+
+	SUBCASE("[Geometry2D] Integer coordinates") {
+		Vector<Point2i> ai = { Point2i(0, 0), Point2i(10, 0), Point2i(10, 10), Point2i(0, 10) };
+		Vector<Point2i> bi = { Point2i(5, 0), Point2i(15, 0), Point2i(15, 10), Point2i(5, 10) };
+		Vector<Vector<Point2i>> ri = Geometry2D::merge_many_polygons({ ai, bi });
+		REQUIRE_MESSAGE(ri.size() == 1, "The merged polygons should result in 1 polygon.");
+		REQUIRE_MESSAGE(ri[0].size() == 4, "The resulting merged polygon should have 4 vertices.");
+		ri = Geometry2D::clip_many_polygons({ ai }, { bi });
+		REQUIRE_MESSAGE(ri.size() == 1, "The clipped polygons should result in 1 polygon.");
+		for (const Point2i &p : ri[0]) {
+			CHECK(p.x <= 5);
+		}
+	}
+
+	SUBCASE("[Geometry2D] Offset many polygons") {
+		r = Geometry2D::offset_many_polygons({ a, b }, 10, Geometry2D::JOIN_MITER);
+		REQUIRE_MESSAGE(r.size() == 1, "Offset overlapping polygons should be merged into 1 polygon.");
+		CHECK(Math::is_equal_approx(polygon_area(r[0]), (real_t)(170 * 120)));
+	}
+}
+
 TEST_CASE("[Geometry2D] Intersect polyline with polygon") {
 	Vector<Vector2> l;
 	Vector<Vector2> p;
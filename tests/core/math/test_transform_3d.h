@@ -136,6 +136,40 @@ TEST_CASE("[Transform3D] Rotate in-place (local rotation)") {
 	const Transform3D rotated_transform = Transform3D(transform.rotated_local(Vector3(0, 1, 0), Math_PI));
 	CHECK_MESSAGE(rotated_transform.is_equal_approx(expected), "The rotated transform should have a new orientation but still be based on the same origin.");
 }
+
+TEST_CASE("[Transform3D] Batch transforms match single transforms") {
+	const Transform3D transform = Transform3D(Basis(Vector3(1, 2, 3).normalized(), 0.5).scaled(Vector3(1, 2, 0.5)), Vector3(4, -5, 6));
+
+	Vector3 points[5] = { Vector3(), Vector3(1, 0, 0), Vector3(-1, 2, 3), Vector3(0.5, -7, 1), Vector3(100, 200, -300) };
+	Vector3 transformed_points[5];
+	transform.xform_array(points, transformed_points, 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK(transformed_points[i].is_equal_approx(transform.xform(points[i])));
+	}
+
+	AABB boxes[3] = { AABB(Vector3(), Vector3(1, 1, 1)), AABB(Vector3(-1, 2, -3), Vector3(4, 0.5, 2)), AABB(Vector3(5, 5, 5), Vector3()) };
+	AABB expected_boxes[3];
+	for (int i = 0; i < 3; i++) {
+		expected_boxes[i] = transform.xform(boxes[i]);
+	}
+	// Transform in place.
+	transform.xform_array(boxes, boxes, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(boxes[i].is_equal_approx(expected_boxes[i]));
+	}
+
+	Transform3D others[3] = { Transform3D(), Transform3D(Basis(Vector3(0, 1, 0), 1.0), Vector3(1, 2, 3)), Transform3D(Basis::from_scale(Vector3(2, 3, 4)), Vector3(-1, 0, 1)) };
+	Transform3D products[3];
+	transform.mul_array(others, products, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(products[i].is_equal_approx(transform * others[i]));
+	}
+
+	Transform3D::mul_batch(others, products, products, 3);
+	for (int i = 0; i < 3; i++) {
+		CHECK(products[i].is_equal_approx(others[i] * (transform * others[i])));
+	}
+}
 } // namespace TestTransform3D
 
 #endif // TEST_TRANSFORM_3D_H
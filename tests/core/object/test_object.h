@@ -34,6 +34,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -57,6 +58,20 @@ public:
 	int get_property() const { return property_value; }
 };
 
+class _TestSubDerivedObject : public _TestDerivedObject {
+	GDCLASS(_TestSubDerivedObject, _TestDerivedObject);
+
+protected:
+	static void _bind_methods() {
+		BIND_CONSTANT(SUB_CONSTANT);
+	}
+
+public:
+	enum {
+		SUB_CONSTANT = 7,
+	};
+};
+
 namespace TestObject {
 
 class _MockScriptInstance : public ScriptInstance {
@@ -189,6 +204,50 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+TEST_CASE("[Object] ObjectDB from multiple threads") {
+	struct Context {
+		SafeNumeric<uint32_t> failures;
+
+		void process(uint32_t p_index, void *p_userdata) {
+			// Objects created on different threads come from different shards,
+			// while lookups don't lock at all.
+			Object *objects[64];
+			ObjectID ids[64];
+			for (int i = 0; i < 64; i++) {
+				objects[i] = memnew(Object);
+				ids[i] = objects[i]->get_instance_id();
+			}
+			for (int i = 0; i < 64; i++) {
+				if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+					failures.increment();
+				}
+			}
+			for (int i = 0; i < 64; i++) {
+				memdelete(objects[i]);
+				if (ObjectDB::get_instance(ids[i]) != nullptr) {
+					failures.increment();
+				}
+			}
+		}
+	};
+
+	const int object_count = ObjectDB::get_object_count();
+
+	Context context;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&context, &Context::process, (void *)nullptr, 128);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(
+			context.failures.get() == 0,
+			"Every lookup should return the object with that id, or null once it has been freed.");
+	CHECK_MESSAGE(
+			ObjectDB::get_object_count() == object_count,
+			"All objects created by the tasks should have been removed from the database.");
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(ObjectID()) == nullptr,
+			"A null object id should never resolve to an object.");
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object object;
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
@@ -245,6 +304,36 @@ TEST_CASE("[Object] Built-in property getter") {
 			"The returned value should equal the one which was set with built-in setter.");
 }
 
+TEST_CASE("[Object] Inherited built-in property access") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	GDREGISTER_CLASS(_TestSubDerivedObject);
+	_TestSubDerivedObject object;
+
+	// Repeated to go through both the lookup that builds the cache and the cached one.
+	for (int i = 0; i < 2; i++) {
+		bool valid = false;
+		object.set("property", 42 + i, &valid);
+		CHECK(valid);
+		CHECK(object.get_property() == 42 + i);
+
+		valid = false;
+		CHECK(object.get("property", &valid) == Variant(42 + i));
+		CHECK(valid);
+
+		valid = false;
+		CHECK(object.get("SUB_CONSTANT", &valid) == Variant(7));
+		CHECK(valid);
+
+		valid = false;
+		CHECK(object.get("get_property", &valid) == Variant(Callable(&object, "get_property")));
+		CHECK(valid);
+
+		valid = true;
+		object.set("SUB_CONSTANT", 1, &valid);
+		CHECK(!valid);
+	}
+}
+
 TEST_CASE("[Object] Script property setter") {
 	Object object;
 	Variant script;
@@ -289,6 +378,26 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalReceiver : public Object {
+public:
+	Object *emitter = nullptr;
+	SignalReceiver *to_disconnect = nullptr;
+	SignalReceiver *to_connect = nullptr;
+	int calls = 0;
+
+	void on_signal() {
+		calls++;
+		if (to_disconnect) {
+			emitter->disconnect("my_custom_signal", callable_mp(to_disconnect, &SignalReceiver::on_signal));
+			to_disconnect = nullptr;
+		}
+		if (to_connect) {
+			emitter->connect("my_custom_signal", callable_mp(to_connect, &SignalReceiver::on_signal));
+			to_connect = nullptr;
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -407,6 +516,31 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Changing connections while emitting should only affect later emissions") {
+		SignalReceiver changer;
+		SignalReceiver disconnected;
+		SignalReceiver connected;
+		changer.emitter = &object;
+		changer.to_disconnect = &disconnected;
+		changer.to_connect = &connected;
+
+		object.connect("my_custom_signal", callable_mp(&changer, &SignalReceiver::on_signal));
+		object.connect("my_custom_signal", callable_mp(&disconnected, &SignalReceiver::on_signal));
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(changer.calls == 1);
+		CHECK(disconnected.calls == 1);
+		CHECK(connected.calls == 0);
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(changer.calls == 2);
+		CHECK(disconnected.calls == 1);
+		CHECK(connected.calls == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&changer, &SignalReceiver::on_signal));
+		object.disconnect("my_custom_signal", callable_mp(&connected, &SignalReceiver::on_signal));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
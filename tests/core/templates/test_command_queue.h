@@ -405,6 +405,49 @@ TEST_CASE("[CommandQueue] Test Queue Lapping") {
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
 
+class OrderRecorder {
+public:
+	LocalVector<int> order;
+
+	void record(int p_index) {
+		order.push_back(p_index);
+	}
+
+	void record_large(int p_index, Transform3D p_a, Transform3D p_b) {
+		order.push_back(p_index);
+	}
+};
+
+TEST_CASE("[CommandQueue] Single producer ring keeps command order") {
+	CommandQueueMT command_queue;
+	command_queue.set_single_producer(Thread::get_caller_id());
+
+	OrderRecorder recorder;
+	// Enough commands to fill the ring, so the rest fall back to the locked queue.
+	const int command_count = 100000;
+	for (int i = 0; i < command_count; i++) {
+		if (i % 7 == 0) {
+			command_queue.push(&recorder, &OrderRecorder::record_large, i, Transform3D(), Transform3D());
+		} else {
+			command_queue.push(&recorder, &OrderRecorder::record, i);
+		}
+		if (i % 30000 == 0) {
+			command_queue.flush_if_pending();
+		}
+	}
+	command_queue.flush_all();
+
+	REQUIRE(recorder.order.size() == (uint32_t)command_count);
+	bool in_order = true;
+	for (int i = 0; i < command_count; i++) {
+		if (recorder.order[i] != i) {
+			in_order = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(in_order, "Commands should run in the order they were pushed.");
+}
+
 TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  test_flat_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/templates/flat_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+	CHECK_FALSE(map.has(84));
+}
+
+TEST_CASE("[FlatHashMap] Overwrite element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[FlatHashMap] Insert, iterate and remove many elements") {
+	const int elem_max = 12343;
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(i, i * 3);
+	}
+	CHECK(map.size() == elem_max);
+
+	// There is no insertion order, but every element must be visited exactly once.
+	Vector<bool> visited;
+	visited.resize(elem_max);
+	visited.fill(false);
+	int count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.value == E.key * 3);
+		CHECK_FALSE(visited[E.key]);
+		visited.write[E.key] = true;
+		count++;
+	}
+	CHECK(count == elem_max);
+
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			CHECK(map.erase(i));
+		}
+	}
+
+	bool all_found = true;
+	for (int i = 0; i < elem_max; i++) {
+		all_found &= map.has(i) == ((i % 5) != 0);
+	}
+	CHECK(all_found);
+	CHECK(map.size() == elem_max - (elem_max + 4) / 5);
+}
+
+TEST_CASE("[FlatHashMap] Reuse deleted slots") {
+	FlatHashMap<int, int> map;
+	map.reserve(64);
+	const uint32_t capacity = map.get_capacity();
+
+	// Inserting and erasing keeps a constant number of elements, which must not grow the table.
+	for (int i = 0; i < 10000; i++) {
+		map.insert(i, i);
+		if (i >= 10) {
+			map.erase(i - 10);
+		}
+	}
+
+	CHECK(map.size() == 10);
+	CHECK(map.get_capacity() == capacity);
+	for (int i = 9990; i < 10000; i++) {
+		CHECK(map[i] == i);
+	}
+}
+
+TEST_CASE("[FlatHashMap] Remove while iterating") {
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i);
+	}
+
+	for (FlatHashMap<int, int>::Iterator E = map.begin(); E; ++E) {
+		if (E->key % 2 == 0) {
+			map.remove(E);
+		}
+	}
+
+	CHECK(map.size() == 50);
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key % 2 == 1);
+	}
+}
+
+TEST_CASE("[FlatHashMap] Insert, iterate and remove many strings") {
+	// This tests a pair that is allocated separately, to see if any leaks occur.
+	uint64_t pre_mem = Memory::get_mem_usage();
+	{
+		const int elem_max = 4018;
+		FlatHashMap<String, String> map;
+		for (int i = 0; i < elem_max; i++) {
+			map.insert(itos(i), itos(i * 2));
+		}
+
+		// Pairs that are not trivially copyable keep their address when the map grows.
+		String *first = map.getptr("0");
+		for (int i = elem_max; i < elem_max * 2; i++) {
+			map.insert(itos(i), itos(i * 2));
+		}
+		CHECK(map.getptr("0") == first);
+
+		for (int i = 0; i < elem_max * 2; i++) {
+			if ((i % 5) == 0) {
+				map.erase(itos(i));
+			}
+		}
+
+		bool all_found = true;
+		for (int i = 0; i < elem_max * 2; i++) {
+			const String *value = map.getptr(itos(i));
+			all_found &= ((i % 5) == 0) ? value == nullptr : *value == itos(i * 2);
+		}
+		CHECK(all_found);
+
+		FlatHashMap<String, String> copy = map;
+		CHECK(copy.size() == map.size());
+		CHECK(copy["1"] == "2");
+	}
+	CHECK(Memory::get_mem_usage() == pre_mem);
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  test_flat_hash_set.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_SET_H
+#define TEST_FLAT_HASH_SET_H
+
+#include "core/templates/flat_hash_set.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashSet {
+
+TEST_CASE("[FlatHashSet] Insert element") {
+	FlatHashSet<int> set;
+	FlatHashSet<int>::Iterator e = set.insert(42);
+
+	CHECK(e);
+	CHECK(*e == 42);
+	CHECK(set.has(42));
+	CHECK(set.find(42));
+	CHECK_FALSE(set.has(84));
+}
+
+TEST_CASE("[FlatHashSet] Insert existing element") {
+	FlatHashSet<int> set;
+	set.insert(42);
+	set.insert(42);
+
+	CHECK(set.has(42));
+	CHECK(set.size() == 1);
+}
+
+TEST_CASE("[FlatHashSet] Insert, iterate and remove many strings") {
+	// This tests a key that uses allocation, to see if any leaks occur.
+	uint64_t pre_mem = Memory::get_mem_usage();
+	{
+		const int elem_max = 4018;
+		FlatHashSet<String> set;
+		for (int i = 0; i < elem_max; i++) {
+			set.insert(itos(i));
+		}
+		CHECK(set.size() == elem_max);
+
+		int count = 0;
+		for (const String &K : set) {
+			CHECK(K.to_int() < elem_max);
+			count++;
+		}
+		CHECK(count == elem_max);
+
+		for (int i = 0; i < elem_max; i++) {
+			if ((i % 5) == 0) {
+				set.erase(itos(i));
+			}
+		}
+
+		bool all_found = true;
+		for (int i = 0; i < elem_max; i++) {
+			all_found &= set.has(itos(i)) == ((i % 5) != 0);
+		}
+		CHECK(all_found);
+
+		FlatHashSet<String> copy = set;
+		CHECK(copy.size() == set.size());
+		CHECK(copy.has("1"));
+		CHECK_FALSE(copy.has("0"));
+
+		set.clear();
+		CHECK(set.is_empty());
+		CHECK_FALSE(set.has("1"));
+	}
+	CHECK(Memory::get_mem_usage() == pre_mem);
+}
+
+} // namespace TestFlatHashSet
+
+#endif // TEST_FLAT_HASH_SET_H
@@ -244,6 +244,34 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Frame arena allocator") {
+	LocalVector<int, uint32_t, false, false, FrameArenaAllocator> first;
+	LocalVector<int, uint32_t, false, false, FrameArenaAllocator> second;
+
+	// Interleaved growth moves the vectors around the arena, values must survive it.
+	for (int i = 0; i < 10000; i++) {
+		first.push_back(i);
+		second.push_back(-i);
+	}
+
+	bool all_kept = true;
+	for (int i = 0; i < 10000; i++) {
+		all_kept &= first[i] == i && second[i] == -i;
+	}
+	CHECK(all_kept);
+
+	first.reset();
+	second.reset();
+
+	// Everything was freed, so the arena is reused from the start.
+	first.push_back(1);
+	void *rewound = first.ptr();
+	first.reset();
+	first.push_back(2);
+	CHECK(first.ptr() == rewound);
+	CHECK(first[0] == 2);
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
@@ -94,6 +94,31 @@ TEST_CASE("[LRU] Resize and clear") {
 	CHECK(!lru.has(3));
 	CHECK(!lru.has(4));
 }
+
+TEST_CASE("[LRU] Erase and least recent key") {
+	LRUCache<int, int> lru;
+
+	CHECK(lru.get_least_recent_key() == nullptr);
+
+	lru.set_capacity(3);
+	lru.insert(1, 1);
+	lru.insert(2, 2);
+	lru.insert(3, 3);
+
+	CHECK(*lru.get_least_recent_key() == 1);
+	lru.get(1);
+	CHECK_MESSAGE(*lru.get_least_recent_key() == 2, "Reading an entry should make it the most recent.");
+
+	CHECK(lru.erase(2));
+	CHECK(!lru.erase(2));
+	CHECK(!lru.has(2));
+	CHECK(lru.get_size() == 2);
+	CHECK(*lru.get_least_recent_key() == 3);
+
+	lru.erase(1);
+	lru.erase(3);
+	CHECK(lru.get_least_recent_key() == nullptr);
+}
 } // namespace TestLRU
 
 #endif // TEST_LRU_H
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  test_radix_sort.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RADIX_SORT_H
+#define TEST_RADIX_SORT_H
+
+#include "core/templates/radix_sort.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRadixSort {
+
+TEST_CASE("[RadixSort] Sort small and large arrays") {
+	for (uint32_t size : { 0u, 1u, 5u, 32u, 33u, 1000u }) {
+		LocalVector<uint32_t> elements;
+		LocalVector<uint64_t> keys;
+		for (uint32_t i = 0; i < size; i++) {
+			// Spread keys over all bytes, with duplicates.
+			uint64_t key = (uint64_t(i * 7919u % 101u) << 40) | (i * 31u % 17u);
+			elements.push_back(i);
+			keys.push_back(key);
+		}
+
+		RadixSort<uint32_t> sorter;
+		sorter.sort(elements.ptr(), keys.ptr(), size);
+
+		bool sorted = true;
+		for (uint32_t i = 1; i < size; i++) {
+			if (keys[i - 1] > keys[i]) {
+				sorted = false;
+			}
+		}
+		CHECK_MESSAGE(sorted, "Keys should be in ascending order for size ", size, ".");
+
+		bool elements_follow_keys = true;
+		for (uint32_t i = 0; i < size; i++) {
+			uint32_t e = elements[i];
+			if (keys[i] != ((uint64_t(e * 7919u % 101u) << 40) | (e * 31u % 17u))) {
+				elements_follow_keys = false;
+			}
+		}
+		CHECK_MESSAGE(elements_follow_keys, "Elements should be moved along with their keys for size ", size, ".");
+	}
+}
+
+TEST_CASE("[RadixSort] Sort is stable") {
+	LocalVector<uint32_t> elements;
+	LocalVector<uint64_t> keys;
+	for (uint32_t i = 0; i < 200; i++) {
+		elements.push_back(i);
+		keys.push_back(i % 3);
+	}
+
+	RadixSort<uint32_t> sorter;
+	sorter.sort(elements.ptr(), keys.ptr(), elements.size());
+
+	bool stable = true;
+	for (uint32_t i = 1; i < elements.size(); i++) {
+		if (keys[i - 1] == keys[i] && elements[i - 1] > elements[i]) {
+			stable = false;
+		}
+	}
+	CHECK(stable);
+	CHECK(elements[0] == 0);
+	CHECK(elements[199] == 197);
+}
+
+TEST_CASE("[RadixSort] Float keys") {
+	const float values[] = { 3.5f, -1.0f, 0.0f, -0.5f, 1e10f, -1e10f, 0.25f };
+	for (uint32_t i = 0; i < 7; i++) {
+		for (uint32_t j = 0; j < 7; j++) {
+			CHECK((values[i] < values[j]) == (radix_sort_float_key(values[i]) < radix_sort_float_key(values[j])));
+		}
+	}
+}
+
+} // namespace TestRadixSort
+
+#endif // TEST_RADIX_SORT_H
@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,71 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Allocation, lookup and free") {
+	// Small chunks, so the chunk tables have to grow several times.
+	RID_Owner<int, true> owner(sizeof(int) * 4);
+	Vector<RID> rids;
+	for (int i = 0; i < 100; i++) {
+		rids.push_back(owner.make_rid(i));
+	}
+	CHECK(owner.get_rid_count() == 100);
+
+	for (int i = 0; i < 100; i++) {
+		CHECK(owner.owns(rids[i]));
+		int *value = owner.get_or_null(rids[i]);
+		REQUIRE(value != nullptr);
+		CHECK(*value == i);
+	}
+
+	owner.free(rids[10]);
+	CHECK_FALSE(owner.owns(rids[10]));
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+
+	// The freed slot is reused, but the old RID stays invalid.
+	RID reused = owner.make_rid(1000);
+	CHECK(reused.get_local_index() == rids[10].get_local_index());
+	CHECK(owner.get_or_null(rids[10]) == nullptr);
+	CHECK(*owner.get_or_null(reused) == 1000);
+
+	rids.write[10] = reused;
+	for (const RID &rid : rids) {
+		owner.free(rid);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
+TEST_CASE("[RID_Owner] Concurrent allocation and lookup") {
+	struct Context {
+		RID_Owner<uint32_t, true> owner{ sizeof(uint32_t) * 16 };
+		SafeNumeric<uint32_t> failures;
+
+		void process(uint32_t p_index, void *p_userdata) {
+			// Each task allocates its own RIDs (which may grow the chunk tables)
+			// while other tasks look theirs up without locking.
+			RID rids[32];
+			for (uint32_t i = 0; i < 32; i++) {
+				rids[i] = owner.make_rid(p_index * 32 + i);
+			}
+			for (uint32_t i = 0; i < 32; i++) {
+				const uint32_t *value = owner.get_or_null(rids[i]);
+				if (!value || *value != p_index * 32 + i) {
+					failures.increment();
+				}
+			}
+			for (uint32_t i = 0; i < 32; i++) {
+				owner.free(rids[i]);
+			}
+		}
+	};
+
+	Context context;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&context, &Context::process, (void *)nullptr, 256);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(context.failures.get() == 0);
+	CHECK(context.owner.get_rid_count() == 0);
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
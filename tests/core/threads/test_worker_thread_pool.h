@@ -107,6 +107,82 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+}
+static void static_spawning_test(void *p_arg) {
+	// Tasks posted from a pool thread go to its local queue, others may steal them.
+	const int count = (int)(uintptr_t)p_arg;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+TEST_CASE("[WorkerThreadPool] Process group tasks spawned from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 8.0f));
+		const int spawners = Math::pow(2.0f, Math::random(0.0f, 3.0f));
+
+		counter.clear();
+		counter.resize(count);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < spawners; i++) {
+			tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_spawning_test, (void *)(uintptr_t)count, true));
+		}
+		for (uint32_t i = 0; i < tasks.size(); i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		bool all_run = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run &= counter[i].get() == spawners;
+		}
+		CHECK(all_run);
+	}
+}
+
+static SafeNumeric<uint32_t> chain_first_done;
+static SafeNumeric<uint32_t> chain_elements_done;
+static SafeFlag chain_out_of_order;
+
+static void static_chain_first(void *p_arg) {
+	chain_first_done.increment();
+}
+static void static_chain_group(void *p_arg, uint32_t p_index) {
+	if (chain_first_done.get() != 1) {
+		chain_out_of_order.set();
+	}
+	chain_elements_done.increment();
+}
+static void static_chain_last(void *p_arg) {
+	if (chain_elements_done.get() != (uint32_t)(uintptr_t)p_arg) {
+		chain_out_of_order.set();
+	}
+}
+TEST_CASE("[WorkerThreadPool] Run tasks and group tasks after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 8.0f));
+
+		chain_first_done.set(0);
+		chain_elements_done.set(0);
+		chain_out_of_order.clear();
+
+		WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_chain_first, nullptr, true);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_chain_group, nullptr, count, -1, true, String(), { first });
+		WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_task(static_chain_last, (void *)(uintptr_t)count, true, String(), { group });
+
+		// Waiting for the last one first, the others must have completed by then.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+		CHECK(WorkerThreadPool::get_singleton()->is_task_completed(first));
+		CHECK(WorkerThreadPool::get_singleton()->is_group_task_completed(group));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+
+		CHECK(chain_elements_done.get() == (uint32_t)count);
+		CHECK_FALSE(chain_out_of_order.is_set());
+	}
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
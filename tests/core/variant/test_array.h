@@ -634,6 +634,53 @@ TEST_CASE("[Array] Typed copying") {
 	a6.clear();
 }
 
+TEST_CASE("[Array] Typed assignment and packed array conversion") {
+	Array untyped;
+	untyped.push_back(Vector3(1, 2, 3));
+	untyped.push_back(Vector3(4, 5, 6));
+
+	TypedArray<Vector3> typed;
+	typed.assign(untyped);
+	CHECK(typed.size() == 2);
+	CHECK(typed.get_typed_builtin() == Variant::VECTOR3);
+	CHECK(typed[1] == Variant(Vector3(4, 5, 6)));
+
+	// Modifying the source after the assignment must not affect the typed copy.
+	untyped[0] = Vector3();
+	CHECK(typed[0] == Variant(Vector3(1, 2, 3)));
+
+	TypedArray<Vector3> appended;
+	appended.push_back(Vector3(7, 8, 9));
+	appended.append_array(typed);
+	CHECK(appended.size() == 3);
+	CHECK(appended[2] == Variant(Vector3(4, 5, 6)));
+
+	Array mixed;
+	mixed.push_back(1);
+	mixed.push_back(2.5);
+	TypedArray<double> floats;
+	floats.assign(mixed);
+	CHECK(floats.size() == 2);
+	CHECK(floats[0].get_type() == Variant::FLOAT);
+	CHECK(floats[0] == Variant(1.0));
+
+	Variant packed;
+	Callable::CallError ce;
+	const Variant typed_variant = typed;
+	const Variant *args[1] = { &typed_variant };
+	Variant::construct(Variant::PACKED_VECTOR3_ARRAY, packed, args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	PackedVector3Array vectors = packed;
+	CHECK(vectors.size() == 2);
+	CHECK(vectors[0] == Vector3(1, 2, 3));
+
+	Variant back;
+	args[0] = &packed;
+	Variant::construct(Variant::ARRAY, back, args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(Array(back) == Array(typed));
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
@@ -80,6 +80,9 @@ public:
 
 	void test_func_7(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {}
 	void test_func_8(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {}
+
+	int sum = 0;
+	void add(int p_value) { sum += p_value; }
 };
 
 TEST_CASE("[Callable] Argument count") {
@@ -135,6 +138,30 @@ TEST_CASE("[Callable] Argument count") {
 
 	memdelete(my_test);
 }
+
+TEST_CASE("[Callable] Recycled custom callables") {
+	TestClass *my_test = memnew(TestClass);
+
+	Callable kept = callable_mp(my_test, &TestClass::add);
+	for (int i = 0; i < 1000; i++) {
+		// Storage released by previous iterations is reused, which must not affect equality or calls.
+		Callable temporary = callable_mp(my_test, &TestClass::add);
+		CHECK(temporary == kept);
+		CHECK(temporary.hash() == kept.hash());
+		temporary.bind(1).call();
+		Callable unbound = callable_mp(my_test, &TestClass::add).unbind(1);
+		unbound.call(1, Variant());
+	}
+	CHECK_EQ(my_test->sum, 2000);
+
+	Callable bound = kept.bind(5);
+	bound.call();
+	CHECK_EQ(my_test->sum, 2005);
+	CHECK(bound.get_object() == my_test);
+	CHECK(bound != kept);
+
+	memdelete(my_test);
+}
 } // namespace TestCallable
 
 #endif // TEST_CALLABLE_H
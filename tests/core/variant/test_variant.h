@@ -1755,6 +1755,43 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays") {
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant parsed;
+
+	ss.s = "PackedVector3Array(1, -2.5, 3e2,\n\t4, 5, 6 )";
+	CHECK_EQ(VariantParser::parse(&ss, parsed, errs, line), OK);
+	CHECK_EQ(line, 2);
+	PackedVector3Array v3 = parsed;
+	REQUIRE_EQ(v3.size(), 2);
+	CHECK_EQ(v3[0], Vector3(1, -2.5, 300));
+	CHECK_EQ(v3[1], Vector3(4, 5, 6));
+
+	// Comments and special float identifiers go through the regular tokenizer.
+	ss = VariantParser::StreamString();
+	ss.s = "PackedFloat64Array(0.5, inf ; comment\n, -7, nan)";
+	CHECK_EQ(VariantParser::parse(&ss, parsed, errs, line), OK);
+	PackedFloat64Array f64 = parsed;
+	REQUIRE_EQ(f64.size(), 4);
+	CHECK_EQ(f64[0], 0.5);
+	CHECK(Math::is_inf(f64[1]));
+	CHECK_EQ(f64[2], -7.0);
+	CHECK(Math::is_nan(f64[3]));
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedInt32Array()";
+	CHECK_EQ(VariantParser::parse(&ss, parsed, errs, line), OK);
+	CHECK_EQ(PackedInt32Array(parsed).size(), 0);
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedInt64Array(1, 2 3)";
+	ERR_PRINT_OFF;
+	CHECK_EQ(VariantParser::parse(&ss, parsed, errs, line), ERR_PARSE_ERROR);
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
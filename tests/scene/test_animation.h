@@ -309,6 +309,43 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sample compressed tracks") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Enemy:position"));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Enemy:rotation"));
+	const int value_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(value_track, NodePath("Enemy:modulate"));
+	for (int i = 0; i <= 40; i++) {
+		double time = i * 0.1;
+		animation->position_track_insert_key(position_track, time, Vector3(Math::sin(time), i * 0.25, Math::cos(time * 3.0)));
+		animation->rotation_track_insert_key(rotation_track, time, Quaternion(Vector3(0, 1, 0), time));
+	}
+	animation->track_insert_key(value_track, 0.0, Color(1, 1, 1));
+
+	LocalVector<Vector4> samples;
+	CHECK_FALSE(animation->sample_compressed_tracks(0.0, samples));
+
+	animation->compress();
+	CHECK(animation->track_is_compressed(position_track));
+	CHECK(animation->track_is_compressed(rotation_track));
+
+	for (double time = 0.0; time <= 4.0; time += 0.13) {
+		CHECK(animation->sample_compressed_tracks(time, samples));
+		CHECK(samples.size() == 3);
+
+		Vector3 position;
+		CHECK(animation->try_position_track_interpolate(position_track, time, &position) == OK);
+		CHECK(Vector3(samples[position_track].x, samples[position_track].y, samples[position_track].z).is_equal_approx(position));
+
+		Quaternion rotation;
+		CHECK(animation->try_rotation_track_interpolate(rotation_track, time, &rotation) == OK);
+		CHECK(Quaternion(samples[rotation_track].x, samples[rotation_track].y, samples[rotation_track].z, samples[rotation_track].w).is_equal_approx(rotation));
+	}
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
@@ -31,10 +31,13 @@
 #ifndef TEST_ARRAYMESH_H
 #define TEST_ARRAYMESH_H
 
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "scene/resources/mesh.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestArrayMesh {
 
@@ -339,6 +342,27 @@ TEST_CASE("[SceneTree][ArrayMesh] Get/Set mesh metadata and actions") {
 	}
 }
 
+TEST_CASE("[SceneTree][ArrayMesh] Loading as placeholder.") {
+	Ref<ArrayMesh> mesh = memnew(ArrayMesh);
+	Ref<BoxMesh> box = memnew(BoxMesh);
+	Array box_array{};
+	box_array.resize(Mesh::ARRAY_MAX);
+	box->create_mesh_array(box_array, Vector3(2.f, 1.2f, 1.6f));
+	mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, box_array);
+
+	const String save_path = TestUtils::get_temp_path("placeholder_mesh.res");
+	REQUIRE(ResourceSaver::save(mesh, save_path) == OK);
+
+	ResourceLoader::set_load_placeholders(true);
+	Ref<Mesh> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	ResourceLoader::set_load_placeholders(false);
+
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->is_class("PlaceholderMesh"));
+	CHECK(loaded->get_surface_count() == 0);
+	CHECK(loaded->get_aabb().is_equal_approx(mesh->get_aabb()));
+}
+
 } // namespace TestArrayMesh
 
 #endif // TEST_ARRAYMESH_H
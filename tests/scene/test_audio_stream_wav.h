@@ -238,6 +238,70 @@ TEST_CASE("[AudioStreamWAV] Saving IMA ADPCM is not supported") {
 	ERR_PRINT_ON;
 }
 
+void run_qoa_playback_test(bool p_stereo, double p_from_pos) {
+	const int mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	// Spans several QOA frames, with a partial one at the end.
+	const int frame_count = QOA_FRAME_LEN * 2 + 1234;
+	const int channels = p_stereo ? 2 : 1;
+
+	Vector<uint8_t> pcm = gen_pcm16_test(mix_rate, frame_count, p_stereo);
+	qoa_desc desc = {};
+	desc.channels = channels;
+	desc.samplerate = mix_rate;
+	desc.samples = frame_count;
+	unsigned int qoa_len = 0;
+	uint8_t *encoded = (uint8_t *)qoa_encode((const short *)pcm.ptr(), &desc, &qoa_len);
+	REQUIRE(encoded != nullptr);
+	Vector<uint8_t> qoa_data;
+	qoa_data.resize(qoa_len);
+	memcpy(qoa_data.ptrw(), encoded, qoa_len);
+	QOA_FREE(encoded);
+
+	qoa_desc ref_desc;
+	short *reference = qoa_decode(qoa_data.ptr(), qoa_len, &ref_desc);
+	REQUIRE(reference != nullptr);
+
+	Ref<AudioStreamWAV> stream = memnew(AudioStreamWAV);
+	stream->set_format(AudioStreamWAV::FORMAT_QOA);
+	stream->set_mix_rate(mix_rate);
+	stream->set_stereo(p_stereo);
+	stream->set_data(qoa_data);
+
+	// Playing at the stream's own rate, output frames map 1:1 to samples.
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	playback->start(p_from_pos);
+	int pos = int(uint64_t(p_from_pos * mix_rate));
+
+	AudioFrame buffer[512];
+	int mismatches = 0;
+	while (pos < frame_count - 1) {
+		int to_mix = MIN(512, frame_count - 1 - pos);
+		playback->mix(buffer, 1.0, to_mix);
+		for (int i = 0; i < to_mix; i++, pos++) {
+			float left = reference[pos * channels] / 32767.0;
+			float right = reference[pos * channels + channels - 1] / 32767.0;
+			if (buffer[i].left != left || buffer[i].right != right) {
+				mismatches++;
+			}
+		}
+	}
+	CHECK(mismatches == 0);
+
+	QOA_FREE(reference);
+}
+
+TEST_CASE("[AudioStreamWAV] QOA playback matches the reference decoder") {
+	SUBCASE("Mono") {
+		run_qoa_playback_test(false, 0.0);
+	}
+	SUBCASE("Stereo") {
+		run_qoa_playback_test(true, 0.0);
+	}
+	SUBCASE("Starting in the middle of a frame") {
+		run_qoa_playback_test(true, double(QOA_FRAME_LEN + 1000) / AudioServer::get_singleton()->get_mix_rate());
+	}
+}
+
 } // namespace TestAudioStreamWAV
 
 #endif // TEST_AUDIO_STREAM_WAV_H
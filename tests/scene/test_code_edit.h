@@ -5629,6 +5629,49 @@ func _ready():
 	memdelete(code_edit);
 }
 
+TEST_CASE("[SceneTree][CodeEdit] syntax highlighting cache") {
+	CodeEdit *code_edit = memnew(CodeEdit);
+	SceneTree::get_singleton()->get_root()->add_child(code_edit);
+
+	const Color region_color = Color(1, 0, 0);
+	Ref<CodeHighlighter> highlighter;
+	highlighter.instantiate();
+	highlighter->add_color_region("/*", "*/", region_color);
+	code_edit->set_syntax_highlighter(highlighter);
+	code_edit->set_text("a\nb\nc\nd");
+
+	for (int i = 0; i < code_edit->get_line_count(); i++) {
+		CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(i)[0])["color"]) != region_color);
+	}
+
+	// Opening a region affects every line after it.
+	code_edit->insert_line_at(1, "/*");
+	CHECK(code_edit->get_line_count() == 5);
+	for (int i = 1; i < code_edit->get_line_count(); i++) {
+		CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(i)[0])["color"]) == region_color);
+	}
+
+	// Edits that don't change the state at the end of the line keep later lines valid.
+	code_edit->set_line(0, "x");
+	CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(0)[0])["color"]) != region_color);
+	CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(4)[0])["color"]) == region_color);
+
+	// Closing it restores them.
+	code_edit->set_line(2, "*/");
+	CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(2)[0])["color"]) == region_color);
+	CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(3)[0])["color"]) != region_color);
+	CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(4)[0])["color"]) != region_color);
+
+	code_edit->remove_line_at(1);
+	code_edit->remove_line_at(1);
+	CHECK(code_edit->get_line_count() == 3);
+	for (int i = 0; i < code_edit->get_line_count(); i++) {
+		CHECK(Color(Dictionary(highlighter->get_line_syntax_highlighting(i)[0])["color"]) != region_color);
+	}
+
+	memdelete(code_edit);
+}
+
 } // namespace TestCodeEdit
 
 #endif // TEST_CODE_EDIT_H
@@ -31,7 +31,10 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "core/object/message_queue.h"
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
+#include "scene/main/window.h"
 
 #include "tests/test_macros.h"
 
@@ -61,6 +64,77 @@ TEST_CASE("[SceneTree][Control]") {
 	}
 }
 
+class TestContainer : public Container {
+	GDCLASS(TestContainer, Container);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_SORT_CHILDREN) {
+			sort_count++;
+			for (int i = 0; i < get_child_count(); i++) {
+				Control *c = as_sortable_control(get_child(i));
+				if (c) {
+					fit_child_in_rect(c, Rect2(Point2(), get_size()));
+				}
+			}
+		}
+	}
+
+public:
+	int sort_count = 0;
+
+	virtual Size2 get_minimum_size() const override {
+		Size2 ms;
+		for (int i = 0; i < get_child_count(); i++) {
+			Control *c = Object::cast_to<Control>(get_child(i));
+			if (c) {
+				ms = ms.max(c->get_combined_minimum_size());
+			}
+		}
+		return ms;
+	}
+};
+
+TEST_CASE("[SceneTree][Container] Layout pass") {
+	TestContainer *outer = memnew(TestContainer);
+	TestContainer *inner = memnew(TestContainer);
+	Control *leaves[3];
+	outer->add_child(inner);
+	for (int i = 0; i < 3; i++) {
+		leaves[i] = memnew(Control);
+		inner->add_child(leaves[i]);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	MessageQueue::get_singleton()->flush();
+
+	SUBCASE("[Container] Minimum sizes are settled before Containers are sorted once, parents first") {
+		outer->sort_count = 0;
+		inner->sort_count = 0;
+
+		leaves[0]->set_custom_minimum_size(Size2(10, 10));
+		leaves[1]->set_custom_minimum_size(Size2(20, 5));
+		leaves[2]->set_custom_minimum_size(Size2(5, 30));
+		MessageQueue::get_singleton()->flush();
+
+		CHECK_EQ(inner->get_combined_minimum_size(), Size2(20, 30));
+		CHECK_EQ(outer->get_combined_minimum_size(), Size2(20, 30));
+		CHECK_EQ(outer->sort_count, 1);
+		CHECK_EQ(inner->sort_count, 1);
+		CHECK_EQ(inner->get_size(), outer->get_size());
+		CHECK_EQ(leaves[2]->get_size(), inner->get_size());
+	}
+
+	SUBCASE("[Container] Controls freed before the layout pass are skipped") {
+		leaves[1]->set_custom_minimum_size(Size2(40, 40));
+		memdelete(leaves[1]);
+		MessageQueue::get_singleton()->flush();
+
+		CHECK_EQ(outer->get_combined_minimum_size(), Size2(10, 30));
+	}
+
+	memdelete(outer);
+}
+
 } // namespace TestControl
 
 #endif // TEST_CONTROL_H
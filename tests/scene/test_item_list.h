@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  test_item_list.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ITEM_LIST_H
+#define TEST_ITEM_LIST_H
+
+#include "scene/gui/item_list.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestItemList {
+
+TEST_CASE("[SceneTree][ItemList] Item at position") {
+	ItemList *item_list = memnew(ItemList);
+	SceneTree::get_singleton()->get_root()->add_child(item_list);
+	item_list->set_size(Size2(300, 200));
+	item_list->set_max_columns(3);
+	item_list->set_same_column_width(true);
+	for (int i = 0; i < 40; i++) {
+		item_list->add_item(itos(i));
+	}
+	item_list->force_update_list_size();
+
+	Vector2 scroll_ofs = Vector2(0, item_list->get_v_scroll_bar()->get_value());
+	for (int i = 0; i < item_list->get_item_count(); i++) {
+		const Rect2 rect = item_list->get_item_rect(i, false);
+		CHECK_EQ(item_list->get_item_at_position(rect.get_center() - scroll_ofs, true), i);
+	}
+
+	// The closest item is found from outside of the items too.
+	CHECK_EQ(item_list->get_item_at_position(Vector2(10, -50), false), 0);
+	CHECK_EQ(item_list->get_item_at_position(Vector2(10, 100000), false), 39);
+	CHECK_EQ(item_list->get_item_at_position(Vector2(10, 100000), true), -1);
+
+	memdelete(item_list);
+}
+
+TEST_CASE("[SceneTree][ItemList] Lazy text shaping") {
+	ItemList *item_list = memnew(ItemList);
+	SceneTree::get_singleton()->get_root()->add_child(item_list);
+	item_list->set_size(Size2(300, 200));
+	for (int i = 0; i < 1000; i++) {
+		item_list->add_item(vformat("Item %d", i));
+	}
+	item_list->force_update_list_size();
+	const Rect2 shaped_rect = item_list->get_item_rect(500);
+
+	item_list->set_lazy_text_shaping(true);
+	item_list->force_update_list_size();
+	const Rect2 lazy_rect = item_list->get_item_rect(500);
+
+	// Single line rows keep their height, and therefore their position.
+	CHECK(Math::is_equal_approx(lazy_rect.size.y, shaped_rect.size.y));
+	CHECK(Math::is_equal_approx(lazy_rect.position.y, shaped_rect.position.y));
+	CHECK_EQ(item_list->get_item_at_position(lazy_rect.get_center() - Vector2(0, item_list->get_v_scroll_bar()->get_value()), true), 500);
+
+	memdelete(item_list);
+}
+
+} // namespace TestItemList
+
+#endif // TEST_ITEM_LIST_H
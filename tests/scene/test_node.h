@@ -387,6 +387,34 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(child_by_path, node1_1);
 	}
 
+	SUBCASE("Cached node paths should follow changes to the scene tree") {
+		Node *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		node1_1->set_name("NestedNode");
+
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+
+		node1_1->set_name("RenamedNode");
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/RenamedNode")), node1_1);
+
+		node1->remove_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/RenamedNode")), nullptr);
+
+		node2->add_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/RenamedNode")), nullptr);
+		CHECK_EQ(root->get_node_or_null(node1_1->get_path()), node1_1);
+
+		Node *node2_1 = memnew(Node);
+		node2_1->set_name("Replacement");
+		node2->add_child(node2_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("/root/" + String(node2->get_name()) + "/Replacement")), node2_1);
+
+		memdelete(node2_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("/root/" + String(node2->get_name()) + "/Replacement")), nullptr);
+	}
+
 	SUBCASE("Nodes should be accessible via their groups") {
 		List<Node *> nodes;
 		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
@@ -430,6 +458,23 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E->get(), node1_1);
 	}
 
+	SUBCASE("Group calls should reach every node of the group") {
+		node1->add_to_group("nodes");
+		node1_1->add_to_group("nodes");
+		node2->add_to_group("nodes");
+
+		SceneTree::get_singleton()->call_group("nodes", "set_meta", "called", 1);
+		CHECK_EQ(int(node1->get_meta("called", 0)), 1);
+		CHECK_EQ(int(node1_1->get_meta("called", 0)), 1);
+		CHECK_EQ(int(node2->get_meta("called", 0)), 1);
+
+		// Calling again must not reuse stale results, and unknown methods are ignored.
+		SceneTree::get_singleton()->call_group_flags(SceneTree::GROUP_CALL_REVERSE, "nodes", "set_meta", "called", 2);
+		SceneTree::get_singleton()->call_group("nodes", "method_that_does_not_exist");
+		CHECK_EQ(int(node1->get_meta("called", 0)), 2);
+		CHECK_EQ(int(node2->get_meta("called", 0)), 2);
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
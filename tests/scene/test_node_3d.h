@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TestNode3D : public Node3D {
+	GDCLASS(TestNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_counter++;
+		}
+	}
+
+public:
+	int transform_changed_counter = 0;
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform propagation") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	TestNode3D *leaf = memnew(TestNode3D);
+	leaf->set_notify_transform(true);
+	middle->add_child(leaf);
+	root->add_child(middle);
+	tree->get_root()->add_child(root);
+	tree->flush_transform_notifications();
+	leaf->transform_changed_counter = 0;
+
+	SUBCASE("Moving a node several times notifies its descendants once per flush") {
+		for (int i = 1; i <= 10; i++) {
+			root->set_position(Vector3(i, 0, 0));
+		}
+		middle->set_position(Vector3(0, 1, 0));
+		root->set_position(Vector3(0, 0, 1));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(0, 1, 1)));
+
+		tree->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_counter, 1);
+
+		root->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_counter, 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(2, 1, 0)));
+	}
+
+	SUBCASE("Global transforms are recomputed after being read back in between") {
+		root->set_position(Vector3(1, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(1, 0, 0)));
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 0, 0)));
+		middle->set_position(Vector3(0, 2, 0));
+		root->set_position(Vector3(4, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(4, 2, 0)));
+	}
+
+	SUBCASE("Nodes added or enabled after a propagation are still notified") {
+		root->set_position(Vector3(1, 0, 0));
+
+		TestNode3D *late = memnew(TestNode3D);
+		middle->add_child(late);
+		late->set_notify_transform(true);
+		tree->flush_transform_notifications();
+		late->transform_changed_counter = 0;
+		leaf->transform_changed_counter = 0;
+
+		leaf->set_notify_transform(false);
+		root->set_position(Vector3(2, 0, 0));
+		leaf->set_notify_transform(true);
+		root->set_position(Vector3(3, 0, 0));
+		root->set_position(Vector3(4, 0, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(late->transform_changed_counter, 1);
+		CHECK_EQ(leaf->transform_changed_counter, 1);
+		CHECK(late->get_global_position().is_equal_approx(Vector3(4, 0, 0)));
+
+		memdelete(late);
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -31,6 +31,8 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +152,41 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_process_priority(7);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instances after the first one reuse the instantiation plan.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		CHECK(instance != nullptr);
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_process_priority() == 7);
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse the previous plan.
+	child->set_process_priority(3);
+	packed_scene.pack(scene);
+	Node *instance = packed_scene.instantiate();
+	CHECK(instance != nullptr);
+	CHECK(instance->get_child(0)->get_process_priority() == 3);
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -215,6 +252,40 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[SceneTree][PackedScene] Instantiate Threaded") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	Node *child = memnew(Node);
+	child->set_name("TestChild");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *parent = memnew(Node);
+	tree->get_root()->add_child(parent);
+
+	tree->instantiate_threaded(packed_scene, parent);
+	tree->instantiate_threaded(packed_scene, parent);
+	CHECK(tree->get_threaded_instance_count() == 2);
+
+	for (int i = 0; i < 1000 && tree->get_threaded_instance_count() > 0; i++) {
+		tree->process(0);
+		OS::get_singleton()->delay_usec(1000);
+	}
+
+	CHECK(tree->get_threaded_instance_count() == 0);
+	REQUIRE(parent->get_child_count() == 2);
+	CHECK(parent->get_child(0)->is_inside_tree());
+	CHECK(parent->get_child(0)->get_child_count() == 1);
+
+	memdelete(parent);
+}
+
 } // namespace TestPackedScene
 
 #endif // TEST_PACKED_SCENE_H
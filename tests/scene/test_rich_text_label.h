@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  test_rich_text_label.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RICH_TEXT_LABEL_H
+#define TEST_RICH_TEXT_LABEL_H
+
+#include "scene/gui/rich_text_label.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRichTextLabel {
+
+TEST_CASE("[SceneTree][RichTextLabel] Maximum number of paragraphs") {
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+	rtl->set_size(Size2(400, 100));
+	rtl->set_use_bbcode(true);
+	rtl->set_max_paragraphs(3);
+
+	for (int i = 0; i < 5; i++) {
+		rtl->append_text(vformat("[b]Line %d[/b]\n", i));
+		CHECK(rtl->is_ready());
+	}
+	rtl->add_text("Line 5");
+
+	CHECK_EQ(rtl->get_paragraph_count(), 3);
+	CHECK_EQ(rtl->get_parsed_text(), "Line 3\nLine 4\nLine 5");
+
+	SUBCASE("[RichTextLabel] Remaining paragraphs keep consecutive offsets") {
+		CHECK(Math::is_zero_approx(rtl->get_paragraph_offset(0)));
+		CHECK(rtl->get_paragraph_offset(1) > rtl->get_paragraph_offset(0));
+		CHECK(rtl->get_paragraph_offset(2) > rtl->get_paragraph_offset(1));
+	}
+
+	SUBCASE("[RichTextLabel] Paragraphs are not dropped while a tag is open") {
+		rtl->push_color(Color(1, 0, 0));
+		rtl->add_text("\nLine 6\nLine 7");
+		CHECK_EQ(rtl->get_paragraph_count(), 5);
+		rtl->pop();
+		rtl->add_newline();
+		CHECK_EQ(rtl->get_paragraph_count(), 3);
+	}
+
+	SUBCASE("[RichTextLabel] Lowering the maximum trims the oldest paragraphs") {
+		rtl->set_max_paragraphs(1);
+		CHECK_EQ(rtl->get_parsed_text(), "Line 5");
+	}
+
+	memdelete(rtl);
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Threaded append") {
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+	rtl->set_size(Size2(400, 100));
+	rtl->set_threaded(true);
+
+	rtl->add_text("First\nSecond");
+	// Few appended paragraphs are shaped right away, without waiting for a background task.
+	CHECK(rtl->is_ready());
+	CHECK_EQ(rtl->get_line_count(), 2);
+
+	memdelete(rtl);
+}
+
+} // namespace TestRichTextLabel
+
+#endif // TEST_RICH_TEXT_LABEL_H
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  test_skeleton_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SKELETON_3D_H
+#define TEST_SKELETON_3D_H
+
+#include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSkeleton3D {
+
+TEST_CASE("[SceneTree][Skeleton3D] Global poses after posing some bones") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	// A chain of three bones with a sibling branch at the root.
+	skeleton->add_bone("root");
+	skeleton->add_bone("spine");
+	skeleton->add_bone("head");
+	skeleton->add_bone("leg");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_parent(3, 0);
+	for (int i = 0; i < skeleton->get_bone_count(); i++) {
+		skeleton->set_bone_rest(i, Transform3D(Basis(), Vector3(0, 1, 0)));
+		skeleton->reset_bone_pose(i);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 3, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 0)));
+
+	SUBCASE("Posing a bone updates its descendants only") {
+		skeleton->set_bone_pose_position(1, Vector3(1, 1, 0));
+		CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 2, 0)));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(1, 3, 0)));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 0)));
+	}
+
+	SUBCASE("Posing a bone and one of its ancestors updates the whole subtree") {
+		skeleton->set_bone_pose_position(2, Vector3(0, 2, 0));
+		skeleton->set_bone_pose_rotation(0, Quaternion(Vector3(0, 0, 1), Math_PI));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, -2, 0)));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 0, 0)));
+
+		skeleton->set_bone_pose_position(2, Vector3(0, 1, 0));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, -1, 0)));
+	}
+
+	SUBCASE("Changing a rest updates every bone") {
+		skeleton->set_bone_pose_position(3, Vector3(0, 2, 0));
+		skeleton->set_bone_rest(0, Transform3D(Basis(), Vector3(0, 5, 0)));
+		skeleton->set_bone_pose_position(0, Vector3(0, 5, 0));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 7, 0)));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 7, 0)));
+		CHECK(skeleton->get_bone_global_rest(3).origin.is_equal_approx(Vector3(0, 6, 0)));
+	}
+
+	memdelete(skeleton);
+}
+
+} // namespace TestSkeleton3D
+
+#endif // TEST_SKELETON_3D_H
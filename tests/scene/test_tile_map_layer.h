@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  test_tile_map_layer.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TILE_MAP_LAYER_H
+#define TEST_TILE_MAP_LAYER_H
+
+#include "scene/2d/tile_map_layer.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTileMapLayer {
+
+TEST_CASE("[SceneTree][TileMapLayer] Bulk cells editing") {
+	TileMapLayer *layer = memnew(TileMapLayer);
+
+	SUBCASE("Set cells in a rect") {
+		layer->set_cells_rect(Rect2i(-2, -3, 4, 5), 1, Vector2i(2, 3), 4);
+		CHECK_EQ(layer->get_used_cells().size(), 20);
+		CHECK_EQ(layer->get_used_rect(), Rect2i(-2, -3, 4, 5));
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(1, 1)), 1);
+		CHECK_EQ(layer->get_cell_atlas_coords(Vector2i(-2, -3)), Vector2i(2, 3));
+		CHECK_EQ(layer->get_cell_alternative_tile(Vector2i(0, 0)), 4);
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(2, 2)), TileSet::INVALID_SOURCE);
+
+		// Erasing uses the default arguments.
+		layer->set_cells_rect(Rect2i(-2, -3, 4, 4));
+		CHECK_EQ(layer->get_used_cells().size(), 4);
+		CHECK_EQ(layer->get_used_rect(), Rect2i(-2, 1, 4, 1));
+	}
+
+	SUBCASE("Set cells from buffers") {
+		PackedInt32Array coords = { 0, 0, 5, -1, 3, 2 };
+		PackedInt32Array ids = { 0, 1, 1, 0, 2, 0, 3, 1, -1, -1, -1, -1 };
+		layer->set_cell(Vector2i(3, 2), 0, Vector2i(0, 0));
+		layer->set_cells_from_buffer(coords, ids);
+		CHECK_EQ(layer->get_used_cells().size(), 2);
+		CHECK_EQ(layer->get_cell_atlas_coords(Vector2i(0, 0)), Vector2i(1, 1));
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(5, -1)), 2);
+		CHECK_EQ(layer->get_cell_atlas_coords(Vector2i(5, -1)), Vector2i(0, 3));
+		CHECK_EQ(layer->get_cell_alternative_tile(Vector2i(5, -1)), 1);
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(3, 2)), TileSet::INVALID_SOURCE);
+
+		ERR_PRINT_OFF;
+		ids.resize(8);
+		layer->set_cells_from_buffer(coords, ids);
+		ERR_PRINT_ON;
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(3, 2)), TileSet::INVALID_SOURCE);
+	}
+
+	SUBCASE("Set cells from an image") {
+		Ref<Image> image = Image::create_empty(3, 2, false, Image::FORMAT_RGB8);
+		image->fill(Color(1, 1, 1));
+		image->set_pixel(0, 0, Color(1, 0, 0));
+		image->set_pixel(2, 1, Color(0, 0, 1));
+
+		Dictionary palette;
+		palette[Color(1, 0, 0)] = Vector4i(0, 1, 2, 0);
+		palette[Color(0, 0, 1)] = Vector4i(1, 0, 0, 3);
+
+		layer->set_cells_from_image(image, Vector2i(10, 20), palette);
+		CHECK_EQ(layer->get_used_cells().size(), 2);
+		CHECK_EQ(layer->get_cell_atlas_coords(Vector2i(10, 20)), Vector2i(1, 2));
+		CHECK_EQ(layer->get_cell_source_id(Vector2i(12, 21)), 1);
+		CHECK_EQ(layer->get_cell_alternative_tile(Vector2i(12, 21)), 3);
+	}
+
+	memdelete(layer);
+}
+
+} // namespace TestTileMapLayer
+
+#endif // TEST_TILE_MAP_LAYER_H
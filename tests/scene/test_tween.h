@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TWEEN_H
+#define TEST_TWEEN_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/window.h"
+#include "scene/resources/animation.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTween {
+
+TEST_CASE("[Tween] Direct interpolation matches Variant interpolation") {
+	const Variant initial_values[] = { 2.0, Vector2(1, -3), Vector3(4, 5, -6), Color(0.2, 0.4, 0.6, 1.0) };
+	const Variant delta_values[] = { -7.5, Vector2(10, 2), Vector3(-1, 0.5, 3), Color(0.5, -0.25, 0.1, -0.5) };
+
+	for (int i = 0; i < 4; i++) {
+		const Variant &initial = initial_values[i];
+		const Variant &delta = delta_values[i];
+		for (double time : { 0.0, 0.3, 0.75, 1.0 }) {
+			const double c = Tween::run_equation(Tween::TRANS_QUAD, Tween::EASE_IN_OUT, time, 0.0, 1.0, 1.0);
+			const Variant expected = Animation::interpolate_variant(initial, Animation::add_variant(initial, delta), c);
+			const Variant result = Tween::interpolate_variant(initial, delta, time, 1.0, Tween::TRANS_QUAD, Tween::EASE_IN_OUT);
+			CHECK(result.get_type() == initial.get_type());
+			CHECK(result == expected);
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][Tween] Tween built-in properties") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+	tween->tween_property(node, NodePath("position"), Vector2(10, 20), 1.0);
+	tween->parallel()->tween_property(node, NodePath("position:x"), 10.0, 1.0);
+	tween->parallel()->tween_property(node, NodePath("modulate"), Color(0, 0, 0, 0), 1.0);
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(node->get_position().is_equal_approx(Vector2(5, 10)));
+	CHECK(node->get_modulate().is_equal_approx(Color(0.5, 0.5, 0.5, 0.5)));
+	CHECK(tween->is_running());
+
+	SceneTree::get_singleton()->process(0.75);
+	CHECK(node->get_position() == Vector2(10, 20));
+	CHECK(node->get_modulate() == Color(0, 0, 0, 0));
+	CHECK_FALSE(tween->is_valid());
+	CHECK(SceneTree::get_singleton()->get_processed_tweens().is_empty());
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Tween] Finished Tweens are removed in order") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> short_tween = SceneTree::get_singleton()->create_tween();
+	short_tween->tween_property(node, NodePath("rotation"), 1.0, 0.25);
+	Ref<Tween> long_tween = SceneTree::get_singleton()->create_tween();
+	long_tween->tween_property(node, NodePath("skew"), 1.0, 1.0);
+	Ref<Tween> paused_tween = SceneTree::get_singleton()->create_tween();
+	paused_tween->tween_property(node, NodePath("position:y"), 1.0, 0.25);
+	paused_tween->pause();
+
+	SceneTree::get_singleton()->process(0.5);
+	TypedArray<Tween> processed = SceneTree::get_singleton()->get_processed_tweens();
+	REQUIRE(processed.size() == 2);
+	CHECK(Ref<Tween>(processed[0]) == long_tween);
+	CHECK(Ref<Tween>(processed[1]) == paused_tween);
+	CHECK(Math::is_equal_approx(node->get_rotation(), 1.0));
+	CHECK(Math::is_equal_approx(node->get_skew(), 0.5));
+	CHECK(node->get_position().y == 0);
+
+	long_tween->kill();
+	paused_tween->kill();
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(SceneTree::get_singleton()->get_processed_tweens().is_empty());
+
+	memdelete(node);
+}
+
+} // namespace TestTween
+
+#endif // TEST_TWEEN_H
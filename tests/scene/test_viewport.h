@@ -267,6 +267,39 @@ TEST_CASE("[SceneTree][Viewport] Controls and InputEvent handling") {
 			CHECK_FALSE(root->gui_find_control(on_d + Point2i(20, 20)));
 			CHECK(root->gui_find_control(on_b) == node_d);
 		}
+
+		SUBCASE("[VIEWPORT][GuiFindControl] Repeated searches follow layout changes.") {
+			// The first search sees new versions, following ones use the hit test index.
+			for (int i = 0; i < 3; i++) {
+				CHECK(root->gui_find_control(on_a) == node_a);
+				CHECK(root->gui_find_control(on_d) == node_d);
+				CHECK(root->gui_find_control(on_g) == node_g);
+				CHECK_FALSE(root->gui_find_control(on_background));
+			}
+
+			node_a->set_position(on_background);
+			for (int i = 0; i < 3; i++) {
+				CHECK(root->gui_find_control(on_background + Point2i(5, 5)) == node_a);
+				CHECK_FALSE(root->gui_find_control(on_a));
+			}
+
+			node_d->set_size(Point2i(100, 100));
+			for (int i = 0; i < 3; i++) {
+				CHECK(root->gui_find_control(on_d + Point2i(50, 50)) == node_d);
+			}
+
+			node_d->set_mouse_filter(Control::MOUSE_FILTER_IGNORE);
+			for (int i = 0; i < 3; i++) {
+				CHECK(root->gui_find_control(on_d) == node_b);
+			}
+
+			node_c->set_position(Point2i(200, 0));
+			node_d->set_mouse_filter(Control::MOUSE_FILTER_STOP);
+			for (int i = 0; i < 3; i++) {
+				CHECK(root->gui_find_control(on_d + Point2i(200, 0)) == node_d);
+				CHECK(root->gui_find_control(on_d) == node_b);
+			}
+		}
 	}
 
 	SUBCASE("[Viewport][GuiInputEvent] nullptr as argument doesn't lead to a crash.") {
@@ -156,6 +156,9 @@ TEST_SUITE("[Navigation]") {
 			navigation_server->map_set_edge_connection_margin(map, 0.66);
 			navigation_server->map_set_link_connection_radius(map, 0.77);
 			navigation_server->map_set_up(map, Vector3(1, 0, 0));
+			Vector<Vector3> lod_origins;
+			lod_origins.push_back(Vector3(1, 2, 3));
+			navigation_server->map_set_avoidance_lod_origins(map, lod_origins);
 			bool initial_use_edge_connections = navigation_server->map_get_use_edge_connections(map);
 			navigation_server->map_set_use_edge_connections(map, !initial_use_edge_connections);
 			navigation_server->process(0.0); // Give server some cycles to commit.
@@ -164,6 +167,7 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(navigation_server->map_get_edge_connection_margin(map), doctest::Approx(0.66));
 			CHECK_EQ(navigation_server->map_get_link_connection_radius(map), doctest::Approx(0.77));
 			CHECK_EQ(navigation_server->map_get_up(map), Vector3(1, 0, 0));
+			CHECK_EQ(navigation_server->map_get_avoidance_lod_origins(map), lod_origins);
 			CHECK_EQ(navigation_server->map_get_use_edge_connections(map), !initial_use_edge_connections);
 		}
 
@@ -768,6 +772,40 @@ TEST_SUITE("[Navigation]") {
 		navigation_server->process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should be able to bake tiles incrementally") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+
+		Dictionary tiles;
+		TypedArray<Vector2i> baked_tiles = navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, tiles, 5.0);
+		CHECK_EQ(baked_tiles.size(), 4);
+		CHECK_EQ(tiles.size(), 4);
+		CHECK(tiles.has(Vector2i(-1, -1)));
+		CHECK(tiles.has(Vector2i(0, 0)));
+		Ref<NavigationMesh> tile = tiles[Vector2i(0, 0)];
+		CHECK_NE(tile->get_polygon_count(), 0);
+
+		SUBCASE("Only the tiles overlapping the changed area should be rebaked") {
+			baked_tiles = navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, tiles, 5.0, AABB(Vector3(3.0, -1.0, 3.0), Vector3(1.0, 2.0, 1.0)));
+			CHECK_EQ(baked_tiles.size(), 1);
+			CHECK_EQ(Vector2i(baked_tiles[0]), Vector2i(0, 0));
+			CHECK_EQ(tiles.size(), 4);
+		}
+
+		SUBCASE("Tiles that lost their geometry should be cleared") {
+			source_geometry->clear();
+			baked_tiles = navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, tiles, 5.0);
+			CHECK_EQ(baked_tiles.size(), 4);
+			CHECK_EQ(tile->get_polygon_count(), 0);
+		}
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -616,6 +616,62 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Text layout: Shaping cache") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SIMPLE_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				String test = U"Cached text";
+
+				uint64_t misses = ts->shaped_text_get_cache_misses();
+				RID ctx1 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx1, test, font, 16);
+				CHECK_FALSE_MESSAGE(ts->shaped_text_get_glyph_count(ctx1) == 0, "Shaping failed");
+
+				if (ts->shaped_text_get_cache_misses() == misses) {
+					// This server has no shaping cache.
+					ts->free_rid(ctx1);
+					ts->free_rid(font1);
+					continue;
+				}
+
+				// The same input reuses the glyphs.
+				uint64_t hits = ts->shaped_text_get_cache_hits();
+				RID ctx2 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx2, test, font, 16);
+				CHECK(ts->shaped_text_get_glyph_count(ctx2) == ts->shaped_text_get_glyph_count(ctx1));
+				CHECK(ts->shaped_text_get_width(ctx2) == ts->shaped_text_get_width(ctx1));
+				CHECK(ts->shaped_text_get_cache_hits() == hits + 1);
+
+				// A different size, or a modified font, is shaped again.
+				RID ctx3 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx3, test, font, 20);
+				ts->shaped_text_shape(ctx3);
+				ts->font_set_embolden(font1, 0.5);
+				RID ctx4 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx4, test, font, 16);
+				ts->shaped_text_shape(ctx4);
+				CHECK(ts->shaped_text_get_cache_hits() == hits + 1);
+
+				ts->free_rid(ctx1);
+				ts->free_rid(ctx2);
+				ts->free_rid(ctx3);
+				ts->free_rid(ctx4);
+				ts->free_rid(font1);
+			}
+		}
+
 		SUBCASE("[TextServer] Unicode identifiers") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
@@ -0,0 +1,646 @@
+/**************************************************************************/
+/*  test_benchmark.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/object/callable_method_pointer.h"
+#include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/sort_array.h"
+#include "core/templates/vector.h"
+#include "core/variant/callable.h"
+#include "core/variant/variant.h"
+
+#ifndef _3D_DISABLED
+#include "servers/physics_server_3d.h"
+#include "servers/rendering/dummy/rasterizer_dummy.h"
+#include "servers/rendering/rendering_server_default.h"
+#include "servers/rendering/rendering_server_globals.h"
+#include "servers/xr/xr_interface.h"
+#endif // _3D_DISABLED
+
+namespace TestBenchmark {
+
+// Each benchmark runs `p_iterations` times and returns a value derived from
+// its work, which is stored in `benchmark_sink` so the compiler can't discard it.
+typedef uint64_t (*BenchmarkFunc)(uint64_t p_iterations);
+typedef void (*BenchmarkSetupFunc)();
+
+struct Benchmark {
+	const char *name = nullptr;
+	BenchmarkFunc func = nullptr;
+	BenchmarkSetupFunc setup = nullptr;
+	BenchmarkSetupFunc teardown = nullptr;
+};
+
+struct BenchmarkResult {
+	String name;
+	uint64_t iterations = 0;
+	double median_ns = 0.0;
+	double min_ns = 0.0;
+	double mean_ns = 0.0;
+	double stddev_ns = 0.0;
+};
+
+static volatile uint64_t benchmark_sink = 0;
+
+// A sample must take at least this long to keep timer resolution and
+// scheduling noise small relative to the measured time.
+static const uint64_t MIN_SAMPLE_USEC = 10000;
+static const uint64_t MAX_ITERATIONS = uint64_t(1) << 30;
+
+/* HashMap */
+
+static HashMap<int, int> bench_lookup_map;
+static const int LOOKUP_MAP_SIZE = 4096;
+
+static void _hash_map_lookup_setup() {
+	for (int i = 0; i < LOOKUP_MAP_SIZE; i++) {
+		bench_lookup_map.insert(i * 31, i);
+	}
+}
+
+static void _hash_map_lookup_teardown() {
+	bench_lookup_map.clear();
+}
+
+static uint64_t _hash_map_insert_1k(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		HashMap<int, int> map;
+		for (int j = 0; j < 1024; j++) {
+			map.insert(j * 31, j);
+		}
+		result += map.size();
+	}
+	return result;
+}
+
+static uint64_t _hash_map_lookup(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		// Half of the lookups miss, as only the first LOOKUP_MAP_SIZE multiples of 31 are keys.
+		const int key = int((i * 7919) % (LOOKUP_MAP_SIZE * 2)) * 31;
+		const int *value = bench_lookup_map.getptr(key);
+		result += value ? *value : 1;
+	}
+	return result;
+}
+
+/* Vector / CowData */
+
+static Vector<int> bench_shared_vector;
+
+static void _vector_shared_setup() {
+	bench_shared_vector.resize(4096);
+	int *w = bench_shared_vector.ptrw();
+	for (int i = 0; i < 4096; i++) {
+		w[i] = i;
+	}
+}
+
+static void _vector_shared_teardown() {
+	bench_shared_vector.clear();
+}
+
+static uint64_t _vector_push_back_1k(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Vector<int> vector;
+		for (int j = 0; j < 1024; j++) {
+			vector.push_back(j);
+		}
+		result += vector[int(i & 1023)];
+	}
+	return result;
+}
+
+static uint64_t _vector_copy_shared(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		// Copying only bumps the reference count.
+		Vector<int> copy = bench_shared_vector;
+		result += copy[int(i & 4095)];
+	}
+	return result;
+}
+
+static uint64_t _vector_copy_on_write_4k(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		// Writing to a shared copy duplicates the whole buffer.
+		Vector<int> copy = bench_shared_vector;
+		copy.write[0] = int(i);
+		result += copy[0];
+	}
+	return result;
+}
+
+/* StringName */
+
+static LocalVector<String> bench_strings;
+static LocalVector<StringName> bench_string_names;
+
+static void _string_name_setup() {
+	for (int i = 0; i < 256; i++) {
+		const String string = "benchmark_string_name_" + itos(i);
+		bench_strings.push_back(string);
+		bench_string_names.push_back(StringName(string));
+	}
+}
+
+static void _string_name_teardown() {
+	bench_strings.clear();
+	bench_string_names.clear();
+}
+
+static uint64_t _string_name_from_string(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		// All names already exist, so this measures the interning lookup.
+		const StringName name = bench_strings[i & 255];
+		result += name.hash();
+	}
+	return result;
+}
+
+static uint64_t _string_name_compare(uint64_t p_iterations) {
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		result += bench_string_names[i & 255] == bench_string_names[(i * 7) & 255];
+	}
+	return result;
+}
+
+/* Variant */
+
+static uint64_t _variant_evaluate_add_int(uint64_t p_iterations) {
+	Variant a = 1;
+	const Variant b = 3;
+	Variant ret;
+	bool valid = false;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Variant::evaluate(Variant::OP_ADD, a, b, ret, valid);
+		a = ret;
+	}
+	return int64_t(a);
+}
+
+static uint64_t _variant_evaluate_mul_vector3(uint64_t p_iterations) {
+	Variant a = Vector3(1, 2, 3);
+	const Variant b = 1.0001;
+	Variant ret;
+	bool valid = false;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		Variant::evaluate(Variant::OP_MULTIPLY, a, b, ret, valid);
+		a = ret;
+	}
+	return uint64_t(Vector3(a).x);
+}
+
+static uint64_t _variant_validated_add_int(uint64_t p_iterations) {
+	Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::OP_ADD, Variant::INT, Variant::INT);
+	Variant a = 1;
+	const Variant b = 3;
+	Variant ret = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		evaluator(&a, &b, &ret);
+		a = ret;
+	}
+	return int64_t(a);
+}
+
+/* Callable */
+
+static Ref<RefCounted> bench_callable_object;
+
+static int64_t _callable_static_target(int64_t p_value) {
+	return p_value + 1;
+}
+
+static void _callable_setup() {
+	bench_callable_object.instantiate();
+}
+
+static void _callable_teardown() {
+	bench_callable_object.unref();
+}
+
+static uint64_t _callable_call_method_bind(uint64_t p_iterations) {
+	const Callable callable(bench_callable_object.ptr(), "get_reference_count");
+	uint64_t result = 0;
+	Variant ret;
+	Callable::CallError ce;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		callable.callp(nullptr, 0, ret, ce);
+		result += int64_t(ret);
+	}
+	return result;
+}
+
+static uint64_t _callable_call_method_pointer(uint64_t p_iterations) {
+	const Callable callable = callable_mp_static(&_callable_static_target);
+	uint64_t result = 0;
+	Variant arg = 0;
+	const Variant *args[1] = { &arg };
+	Variant ret;
+	Callable::CallError ce;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		callable.callp(args, 1, ret, ce);
+		arg = ret;
+	}
+	result += int64_t(arg);
+	return result;
+}
+
+/* WorkerThreadPool */
+
+static void _worker_task_func(void *p_userdata) {
+	uint64_t *counter = static_cast<uint64_t *>(p_userdata);
+	(*counter)++;
+}
+
+static void _worker_group_func(void *p_userdata, uint32_t p_index) {
+	uint32_t *values = static_cast<uint32_t *>(p_userdata);
+	values[p_index] = p_index * 3;
+}
+
+static uint64_t _worker_thread_pool_task(uint64_t p_iterations) {
+	uint64_t counter = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&_worker_task_func, &counter);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+	return counter;
+}
+
+static uint64_t _worker_thread_pool_group_1k(uint64_t p_iterations) {
+	uint32_t values[1024] = {};
+	uint64_t result = 0;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_worker_group_func, values, 1024);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		result += values[i & 1023];
+	}
+	return result;
+}
+
+#ifndef _3D_DISABLED
+
+/* RendererSceneCull */
+
+static RID bench_scenario;
+static RID bench_camera;
+static RID bench_mesh;
+static LocalVector<RID> bench_instances;
+
+static void _scene_cull_setup() {
+	RasterizerDummy::make_current();
+	memnew(RenderingServerDefault());
+	RenderingServerDefault::get_singleton()->init();
+	RenderingServerDefault::get_singleton()->set_render_loop_enabled(false);
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	bench_scenario = rs->scenario_create();
+	bench_mesh = rs->mesh_create();
+
+	// A 32x8x32 grid of 8192 instances; the camera sees roughly a third of it.
+	for (int x = 0; x < 32; x++) {
+		for (int y = 0; y < 8; y++) {
+			for (int z = 0; z < 32; z++) {
+				RID instance = rs->instance_create2(bench_mesh, bench_scenario);
+				rs->instance_set_custom_aabb(instance, AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+				rs->instance_set_transform(instance, Transform3D(Basis(), Vector3(x - 16, y - 4, z - 16) * 4.0));
+				bench_instances.push_back(instance);
+			}
+		}
+	}
+
+	bench_camera = rs->camera_create();
+	rs->camera_set_perspective(bench_camera, 75.0, 0.05, 200.0);
+	rs->camera_set_transform(bench_camera, Transform3D(Basis(), Vector3(0, 0, 80)));
+
+	// Process the pending instance updates outside of the measured loop.
+	RSG::scene->update();
+}
+
+static void _scene_cull_teardown() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (const RID &instance : bench_instances) {
+		rs->free(instance);
+	}
+	bench_instances.clear();
+	rs->free(bench_camera);
+	rs->free(bench_mesh);
+	rs->free(bench_scenario);
+
+	rs->sync();
+	rs->finish();
+	memdelete(rs);
+}
+
+static uint64_t _scene_cull_render_camera(uint64_t p_iterations) {
+	Ref<XRInterface> xr_interface;
+	RenderingMethod::RenderInfo render_info;
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		RSG::scene->render_camera(Ref<RenderSceneBuffers>(), bench_camera, bench_scenario, RID(), Size2(1920, 1080), 0, 1.0, RID(), xr_interface, &render_info);
+	}
+	return render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME];
+}
+
+/* GodotStep3D */
+
+static PhysicsServer3D *bench_physics_server = nullptr;
+static RID bench_space;
+static RID bench_sphere_shape;
+static RID bench_floor_shape;
+static LocalVector<RID> bench_bodies;
+
+static void _physics_step_setup() {
+	bench_physics_server = PhysicsServer3DManager::get_singleton()->new_default_server();
+	bench_physics_server->init();
+	bench_physics_server->set_active(true);
+
+	PhysicsServer3D *ps = bench_physics_server;
+	bench_space = ps->space_create();
+	ps->space_set_active(bench_space, true);
+
+	bench_floor_shape = ps->box_shape_create();
+	ps->shape_set_data(bench_floor_shape, Vector3(50, 1, 50));
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, bench_floor_shape);
+	ps->body_set_space(floor, bench_space);
+	bench_bodies.push_back(floor);
+
+	// 512 spheres dropped in a loose 8x8x8 stack. Sleeping is disabled so
+	// every step keeps doing the same amount of work.
+	bench_sphere_shape = ps->sphere_shape_create();
+	ps->shape_set_data(bench_sphere_shape, 0.5);
+	for (int x = 0; x < 8; x++) {
+		for (int y = 0; y < 8; y++) {
+			for (int z = 0; z < 8; z++) {
+				RID body = ps->body_create();
+				ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+				ps->body_add_shape(body, bench_sphere_shape);
+				ps->body_set_state(body, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+				ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 1.1 - 4.0, 2.0 + y * 1.1, z * 1.1 - 4.0)));
+				ps->body_set_space(body, bench_space);
+				bench_bodies.push_back(body);
+			}
+		}
+	}
+}
+
+static void _physics_step_teardown() {
+	PhysicsServer3D *ps = bench_physics_server;
+	for (const RID &body : bench_bodies) {
+		ps->free(body);
+	}
+	bench_bodies.clear();
+	ps->free(bench_sphere_shape);
+	ps->free(bench_floor_shape);
+	ps->free(bench_space);
+
+	ps->finish();
+	memdelete(ps);
+	bench_physics_server = nullptr;
+}
+
+static uint64_t _physics_step_512_bodies(uint64_t p_iterations) {
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		bench_physics_server->step(1.0 / 60.0);
+		bench_physics_server->flush_queries();
+	}
+	return bench_physics_server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS);
+}
+
+#endif // _3D_DISABLED
+
+static const Benchmark benchmarks[] = {
+	{ "HashMap/insert_1k", &_hash_map_insert_1k },
+	{ "HashMap/lookup", &_hash_map_lookup, &_hash_map_lookup_setup, &_hash_map_lookup_teardown },
+	{ "Vector/push_back_1k", &_vector_push_back_1k },
+	{ "Vector/copy_shared", &_vector_copy_shared, &_vector_shared_setup, &_vector_shared_teardown },
+	{ "Vector/copy_on_write_4k", &_vector_copy_on_write_4k, &_vector_shared_setup, &_vector_shared_teardown },
+	{ "StringName/from_string", &_string_name_from_string, &_string_name_setup, &_string_name_teardown },
+	{ "StringName/compare", &_string_name_compare, &_string_name_setup, &_string_name_teardown },
+	{ "Variant/evaluate_add_int", &_variant_evaluate_add_int },
+	{ "Variant/evaluate_mul_vector3", &_variant_evaluate_mul_vector3 },
+	{ "Variant/validated_add_int", &_variant_validated_add_int },
+	{ "Callable/call_method_bind", &_callable_call_method_bind, &_callable_setup, &_callable_teardown },
+	{ "Callable/call_method_pointer", &_callable_call_method_pointer },
+	{ "WorkerThreadPool/task", &_worker_thread_pool_task },
+	{ "WorkerThreadPool/group_1k", &_worker_thread_pool_group_1k },
+#ifndef _3D_DISABLED
+	{ "RendererSceneCull/render_camera_8k_instances", &_scene_cull_render_camera, &_scene_cull_setup, &_scene_cull_teardown },
+	{ "GodotStep3D/step_512_bodies", &_physics_step_512_bodies, &_physics_step_setup, &_physics_step_teardown },
+#endif // _3D_DISABLED
+};
+
+static uint64_t _measure_usec(const Benchmark &p_benchmark, uint64_t p_iterations) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	benchmark_sink = p_benchmark.func(p_iterations);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+static BenchmarkResult _run_benchmark(const Benchmark &p_benchmark, int p_samples) {
+	BenchmarkResult result;
+	result.name = p_benchmark.name;
+
+	if (p_benchmark.setup) {
+		p_benchmark.setup();
+	}
+
+	// Grow the iteration count until a single sample is long enough to time.
+	// This also serves as warm-up for caches and lazily allocated state.
+	uint64_t iterations = 1;
+	while (iterations < MAX_ITERATIONS) {
+		const uint64_t usec = _measure_usec(p_benchmark, iterations);
+		if (usec >= MIN_SAMPLE_USEC) {
+			break;
+		}
+		iterations *= usec < MIN_SAMPLE_USEC / 10 ? 10 : 2;
+	}
+	result.iterations = iterations;
+
+	LocalVector<double> samples;
+	samples.resize(p_samples);
+	for (int i = 0; i < p_samples; i++) {
+		samples[i] = double(_measure_usec(p_benchmark, iterations)) * 1000.0 / double(iterations);
+	}
+
+	if (p_benchmark.teardown) {
+		p_benchmark.teardown();
+	}
+
+	SortArray<double> sorter;
+	sorter.sort(samples.ptr(), samples.size());
+
+	const uint32_t mid = samples.size() / 2;
+	result.median_ns = samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) * 0.5;
+	result.min_ns = samples[0];
+
+	double sum = 0.0;
+	for (const double sample : samples) {
+		sum += sample;
+	}
+	result.mean_ns = sum / samples.size();
+
+	double variance = 0.0;
+	for (const double sample : samples) {
+		variance += (sample - result.mean_ns) * (sample - result.mean_ns);
+	}
+	result.stddev_ns = samples.size() > 1 ? Math::sqrt(variance / (samples.size() - 1)) : 0.0;
+
+	return result;
+}
+
+static Dictionary _result_to_dict(const BenchmarkResult &p_result) {
+	Dictionary dict;
+	dict["name"] = p_result.name;
+	dict["iterations"] = p_result.iterations;
+	dict["median_ns"] = p_result.median_ns;
+	dict["min_ns"] = p_result.min_ns;
+	dict["mean_ns"] = p_result.mean_ns;
+	dict["stddev_ns"] = p_result.stddev_ns;
+	return dict;
+}
+
+static bool _load_baseline(const String &p_path, HashMap<String, Dictionary> &r_baseline) {
+	Error err = OK;
+	const String text = FileAccess::get_file_as_string(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, false, vformat("Cannot open benchmark baseline \"%s\".", p_path));
+
+	const Variant parsed = JSON::parse_string(text);
+	ERR_FAIL_COND_V_MSG(parsed.get_type() != Variant::DICTIONARY, false, vformat("Invalid benchmark baseline \"%s\".", p_path));
+
+	const Array entries = Dictionary(parsed).get("benchmarks", Array());
+	for (int i = 0; i < entries.size(); i++) {
+		const Dictionary entry = entries[i];
+		if (entry.has("name") && entry.has("median_ns")) {
+			r_baseline.insert(entry["name"], entry);
+		}
+	}
+	return true;
+}
+
+void run() {
+	String filter;
+	String json_path;
+	String baseline_path;
+	int samples = 15;
+	double threshold = 10.0;
+
+	const List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (const List<String>::Element *E = args.front(); E; E = E->next()) {
+		const String &arg = E->get();
+		if (!E->next()) {
+			break;
+		}
+		if (arg == "--bench-filter") {
+			filter = E->next()->get();
+		} else if (arg == "--bench-samples") {
+			samples = MAX(3, E->next()->get().to_int());
+		} else if (arg == "--bench-json") {
+			json_path = E->next()->get();
+		} else if (arg == "--bench-baseline") {
+			baseline_path = E->next()->get();
+		} else if (arg == "--bench-threshold") {
+			threshold = MAX(0.0, E->next()->get().to_float());
+		}
+	}
+
+	HashMap<String, Dictionary> baseline;
+	if (!baseline_path.is_empty() && !_load_baseline(baseline_path, baseline)) {
+		OS::get_singleton()->set_exit_code(EXIT_FAILURE);
+		return;
+	}
+
+	print_line(vformat("Running benchmarks (%d samples each, times in ns per iteration).", samples));
+	print_line(String("Benchmark").rpad(48) + String("Median").lpad(14) + String("Min").lpad(14) + String("Stddev").lpad(12) + (baseline.is_empty() ? String() : String("Baseline").lpad(14) + String("Change").lpad(10)));
+
+	Array json_results;
+	int regressions = 0;
+
+	for (const Benchmark &benchmark : benchmarks) {
+		if (!filter.is_empty() && !String(benchmark.name).contains(filter)) {
+			continue;
+		}
+
+		const BenchmarkResult result = _run_benchmark(benchmark, samples);
+		json_results.push_back(_result_to_dict(result));
+
+		String line = result.name.rpad(48) + String::num(result.median_ns, 2).lpad(14) + String::num(result.min_ns, 2).lpad(14) + String::num(result.stddev_ns, 2).lpad(12);
+
+		const Dictionary *base = baseline.getptr(result.name);
+		if (base) {
+			const double base_median = (*base)["median_ns"];
+			const double change = base_median > 0.0 ? (result.median_ns - base_median) / base_median * 100.0 : 0.0;
+			line += String::num(base_median, 2).lpad(14) + (String::num(change, 1) + "%").lpad(10);
+
+			// Only report a regression when even the fastest sample is slower
+			// than the baseline median, so a single noisy run isn't flagged.
+			if (change > threshold && result.min_ns > base_median) {
+				line += "  REGRESSION";
+				regressions++;
+			}
+		}
+		print_line(line);
+	}
+
+	if (!json_path.is_empty()) {
+		Dictionary root;
+		root["version"] = 1;
+		root["samples"] = samples;
+		root["benchmarks"] = json_results;
+
+		Ref<FileAccess> f = FileAccess::open(json_path, FileAccess::WRITE);
+		if (f.is_null()) {
+			ERR_PRINT(vformat("Cannot write benchmark results to \"%s\".", json_path));
+			OS::get_singleton()->set_exit_code(EXIT_FAILURE);
+		} else {
+			f->store_string(JSON::stringify(root, "\t", false));
+			print_line(vformat("Benchmark results written to \"%s\".", json_path));
+		}
+	}
+
+	if (regressions > 0) {
+		ERR_PRINT(vformat("%d benchmark(s) regressed by more than %s%% compared to the baseline.", regressions, String::num(threshold, 1)));
+		OS::get_singleton()->set_exit_code(EXIT_FAILURE);
+	}
+}
+} // namespace TestBenchmark